@@ -104,9 +104,13 @@ extern "C" {
 
 typedef struct {
 
-  int       n;       /* Number of intersecting distant ranks */
-  int      *rank;    /* List of intersecting distant ranks */
-  double   *extents; /* List of intersecting distant extents */
+  int       n;            /* Number of intersecting distant ranks */
+  int      *rank;         /* List of intersecting distant ranks */
+  double   *extents;      /* List of intersecting distant extents */
+
+  int      *sub_idx;      /* Optional index of distant sub-extents
+                             (size: n+1), or NULL */
+  double   *sub_extents;  /* Optional distant sub-extents, or NULL */
 
 } _rank_intersects_t;
 
@@ -125,6 +129,8 @@ struct _ple_locator_t {
   int       locate_algorithm;    /* Location algorithm id */
   int       exchange_algorithm;  /* Exchange algorithm id */
   int       async_threshold;     /* Threshold for asynchronous exchange */
+  int       max_sub_extents;     /* Maximum number of mesh sub-extents
+                                    used for distributed search */
 
 #if defined(PLE_HAVE_MPI)
   MPI_Comm  comm;                /* Associated MPI communicator */
@@ -169,6 +175,31 @@ struct _ple_locator_t {
   double  exchange_cpu_time[2];    /* Variable exchange CPU time */
 };
 
+/*----------------------------------------------------------------------------
+ * Structure defining a pending (non-blocking) variable exchange
+ *----------------------------------------------------------------------------*/
+
+struct _ple_locator_exchange_t {
+
+  ple_locator_t     *locator;       /* Associated locator */
+
+  void              *local_var;     /* Variable defined on local points */
+  const ple_lnum_t  *local_list;    /* Optional indirection for local_var */
+  size_t             nbytes;        /* Size of values for one point */
+  bool               reverse;       /* Is exchange reversed */
+  bool               packed;        /* Are local values in exchange order
+                                       (loc_v_buf is then local_var) */
+
+  unsigned char     *loc_v_buf;     /* Buffer for local point values */
+  int               *flag;          /* Send and receive flags (interlaced) */
+
+#if defined(PLE_HAVE_MPI)
+  int                n_requests;    /* Number of pending requests */
+  MPI_Request       *request;       /* Pending requests */
+#endif
+
+};
+
 /*============================================================================
  * Local function pointer type documentation
  *============================================================================*/
@@ -273,6 +304,11 @@ static int _ple_locator_location_algorithm = _LOCATE_BB_SENDRECV_ORDERED;
 
 static int _ple_locator_async_threshold = 128;
 
+/* maximum number of mesh sub-extents per rank exchanged to filter
+   points sent to each rank (1 for whole mesh extents only) */
+
+static int _ple_locator_max_sub_extents = 64;
+
 #if defined(PLE_HAVE_MPI)
 
 /* global logging function */
@@ -306,7 +342,8 @@ static void
 _parse_locator_option(const char   *key,
                       const char   *value,
                       int          *location_algorithm,
-                      int          *async_threshold)
+                      int          *async_threshold,
+                      int          *max_sub_extents)
 {
   if (key == NULL || value == NULL)
     return;
@@ -323,6 +360,12 @@ _parse_locator_option(const char   *key,
     if (sscanf(value, "%d", &i_value) == 1)
       *async_threshold = i_value;
   }
+
+  else if (strncmp(key, "max_sub_extents", 64) == 0) {
+    int i_value = 0;
+    if (sscanf(value, "%d", &i_value) == 1)
+      *max_sub_extents = (i_value > 1) ? i_value : 1;
+  }
 }
 
 #if defined(PLE_HAVE_MPI)
@@ -601,6 +644,78 @@ _within_extents(int                dim,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Test if a point is within given extents and optional sub-extents
+ *
+ * parameters:
+ *   dim             <-- spatial (coordinates) dimension
+ *   coords          <-- coordinates: x, y, ...
+ *                       size: dim
+ *   extents         <-- extents: x_min, y_min, ..., x_max, y_max, ...
+ *                       size: dim*2
+ *   n_sub_extents   <-- number of sub-extents, or 0 if not available
+ *   sub_extents     <-- sub-extents: x_min_0, y_min_0, ..., x_max_i, ...
+ *                       size: dim*2*n_sub_extents
+ *
+ * returns:
+ *   true if point lies within extents and one of the sub-extents,
+ *   false otherwise
+ *----------------------------------------------------------------------------*/
+
+inline static bool
+_within_sub_extents(int                dim,
+                    const ple_coord_t  coords[],
+                    const double       extents[],
+                    int                n_sub_extents,
+                    const double       sub_extents[])
+{
+  if (_within_extents(dim, coords, extents) == false)
+    return false;
+
+  if (n_sub_extents < 1)
+    return true;
+
+  for (int i = 0; i < n_sub_extents; i++) {
+    if (_within_extents(dim, coords, sub_extents + i*dim*2) == true)
+      return true;
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Test if extents intersect given optional sub-extents
+ *
+ * parameters:
+ *   dim             <-- spatial (coordinates) dimension
+ *   extents         <-- extents: x_min, y_min, ..., x_max, y_max, ...
+ *                       size: dim*2
+ *   n_sub_extents   <-- number of sub-extents, or 0 if not available
+ *   sub_extents     <-- sub-extents: x_min_0, y_min_0, ..., x_max_i, ...
+ *                       size: dim*2*n_sub_extents
+ *
+ * returns:
+ *   true if extents intersect one of the sub-extents or if no sub-extents
+ *   are available, false otherwise
+ *----------------------------------------------------------------------------*/
+
+inline static bool
+_intersect_sub_extents(int           dim,
+                       const double  extents[],
+                       int           n_sub_extents,
+                       const double  sub_extents[])
+{
+  if (n_sub_extents < 1)
+    return true;
+
+  for (int i = 0; i < n_sub_extents; i++) {
+    if (_intersect_extents(dim, extents, sub_extents + i*dim*2) == true)
+      return true;
+  }
+
+  return false;
+}
+
 /*----------------------------------------------------------------------------
  * Compute extents of a point set
  *
@@ -879,7 +994,7 @@ _intersects_distant(ple_locator_t       *this_locator,
                     ple_mesh_extents_t  *mesh_extents_f)
 {
   int stride2;
-  double extents[12];
+  double extents[13];
 
   int j;
   int stride4;
@@ -887,6 +1002,8 @@ _intersects_distant(ple_locator_t       *this_locator,
   int n_intersects;
   int  *intersect_rank;
   double *recvbuf;
+  double *sub_extents = NULL, *g_sub_extents = NULL;
+  int *g_sub_count = NULL, *g_sub_displ = NULL;
 
   double comm_timing[4] = {0., 0., 0., 0.};
   const int dim = this_locator->dim;
@@ -896,6 +1013,8 @@ _intersects_distant(ple_locator_t       *this_locator,
   /* Update intersects */
 
   intersects.n = 0;
+  intersects.sub_idx = NULL;
+  intersects.sub_extents = NULL;
 
   /* initialize mesh extents in case mesh is empty or dim < 3 */
   for (int i = 0; i < dim; i++) {
@@ -938,24 +1057,88 @@ _intersects_distant(ple_locator_t       *this_locator,
 
   }
 
-  /* Exchange extent information */
+  stride2 = dim * 2; /* Stride for one type of extent */
+  stride4 = dim * 4; /* Stride for element and vertex
+                        extents, end-to-end */
+
+  /* Optional mesh sub-extents, allowing finer filtering of points;
+     if only one sub-extent is available, mesh extents suffice */
+
+  int n_sub_extents = 0;
+
+  if (this_locator->max_sub_extents > 1 && mesh != NULL) {
+
+    ple_lnum_t n_max_sub = mesh_extents_f(mesh,
+                                          -1,
+                                          tolerance_fraction,
+                                          NULL);
+
+    if (n_max_sub > this_locator->max_sub_extents)
+      n_max_sub = this_locator->max_sub_extents;
+
+    if (n_max_sub > 1) {
+      PLE_MALLOC(sub_extents, n_max_sub*stride2, double);
+      n_sub_extents = mesh_extents_f(mesh,
+                                     n_max_sub,
+                                     tolerance_fraction,
+                                     sub_extents);
+      if (n_sub_extents < 2)
+        n_sub_extents = 0;
+    }
+
+    for (int k = 0; k < n_sub_extents; k++) {
+      double *_sub_extents = sub_extents + k*stride2;
+      for (int i = 0; i < dim; i++) {
+        _sub_extents[i]       -= tolerance_base;
+        _sub_extents[i + dim] += tolerance_base;
+      }
+    }
+
+  }
+
+  extents[stride4] = n_sub_extents;
+
+  /* Exchange extent information (with number of sub-extents) */
 
   MPI_Comm_rank(this_locator->comm, &comm_rank);
   MPI_Comm_size(this_locator->comm, &comm_size);
 
-  stride2 = dim * 2; /* Stride for one type of extent */
-  stride4 = dim * 4; /* Stride for element and vertex
-                        extents, end-to-end */
+  const int g_stride = stride4 + 1;
 
-  PLE_MALLOC(recvbuf, stride4*comm_size, double);
+  PLE_MALLOC(recvbuf, g_stride*comm_size, double);
 
   _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
 
-  MPI_Allgather(extents, stride4, MPI_DOUBLE, recvbuf, stride4, MPI_DOUBLE,
+  MPI_Allgather(extents, g_stride, MPI_DOUBLE, recvbuf, g_stride, MPI_DOUBLE,
                 this_locator->comm);
 
   _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
 
+  /* Exchange sub-extents if available on any rank */
+
+  PLE_MALLOC(g_sub_count, comm_size, int);
+  PLE_MALLOC(g_sub_displ, comm_size + 1, int);
+
+  g_sub_displ[0] = 0;
+  for (int i = 0; i < comm_size; i++) {
+    g_sub_count[i] = (int)(recvbuf[i*g_stride + stride4]) * stride2;
+    g_sub_displ[i+1] = g_sub_displ[i] + g_sub_count[i];
+  }
+
+  if (g_sub_displ[comm_size] > 0) {
+
+    PLE_MALLOC(g_sub_extents, g_sub_displ[comm_size], double);
+
+    _locator_trace_start_comm(_ple_locator_log_start_g_comm, comm_timing);
+
+    MPI_Allgatherv(sub_extents, n_sub_extents*stride2, MPI_DOUBLE,
+                   g_sub_extents, g_sub_count, g_sub_displ, MPI_DOUBLE,
+                   this_locator->comm);
+
+    _locator_trace_end_comm(_ple_locator_log_end_g_comm, comm_timing);
+
+  }
+
   /* Count and mark possible overlaps */
 
   n_intersects = 0;
@@ -963,12 +1146,23 @@ _intersects_distant(ple_locator_t       *this_locator,
 
   for (int i = 0; i < this_locator->n_ranks; i++) {
     j = this_locator->start_rank + i;
-    if (  (_intersect_extents(dim,
-                              extents + (2*dim),
-                              recvbuf + (j*stride4)) == true)
-        || (_intersect_extents(dim,
-                               extents,
-                               recvbuf + (j*stride4) + (2*dim)) == true)) {
+    const double *d_extents = recvbuf + (j*g_stride);
+    const int n_d_sub_extents = g_sub_count[j] / stride2;
+    const double *d_sub_extents = g_sub_extents + g_sub_displ[j];
+    if (  (   _intersect_extents(dim,
+                                 extents + (2*dim),
+                                 d_extents) == true
+           && _intersect_sub_extents(dim,
+                                     extents + (2*dim),
+                                     n_d_sub_extents,
+                                     d_sub_extents) == true)
+        || (   _intersect_extents(dim,
+                                  extents,
+                                  d_extents + (2*dim)) == true
+            && _intersect_sub_extents(dim,
+                                      d_extents + (2*dim),
+                                      n_sub_extents,
+                                      sub_extents) == true)) {
       intersect_rank[n_intersects] = j;
       n_intersects += 1;
     }
@@ -986,7 +1180,34 @@ _intersects_distant(ple_locator_t       *this_locator,
 
     for (j = 0; j < stride2; j++)
       intersects.extents[i*stride2 + j]
-        = recvbuf[intersect_rank[i]*stride4 + j];
+        = recvbuf[intersect_rank[i]*g_stride + j];
+
+  }
+
+  /* Copy distant sub-extents if available */
+
+  if (g_sub_extents != NULL) {
+
+    PLE_MALLOC(intersects.sub_idx, intersects.n + 1, int);
+
+    intersects.sub_idx[0] = 0;
+    for (int i = 0; i < intersects.n; i++)
+      intersects.sub_idx[i+1] =   intersects.sub_idx[i]
+                                + g_sub_count[intersect_rank[i]] / stride2;
+
+    PLE_MALLOC(intersects.sub_extents,
+               intersects.sub_idx[intersects.n] * stride2,
+               double);
+
+    for (int i = 0; i < intersects.n; i++) {
+      const double *d_sub_extents
+        = g_sub_extents + g_sub_displ[intersect_rank[i]];
+      double *_sub_extents
+        = intersects.sub_extents + intersects.sub_idx[i]*stride2;
+      const int n = (intersects.sub_idx[i+1] - intersects.sub_idx[i])*stride2;
+      for (j = 0; j < n; j++)
+        _sub_extents[j] = d_sub_extents[j];
+    }
 
   }
 
@@ -994,6 +1215,10 @@ _intersects_distant(ple_locator_t       *this_locator,
 
   PLE_FREE(intersect_rank);
   PLE_FREE(recvbuf);
+  PLE_FREE(g_sub_extents);
+  PLE_FREE(g_sub_displ);
+  PLE_FREE(g_sub_count);
+  PLE_FREE(sub_extents);
 
   /* Finalize timing */
 
@@ -1078,7 +1303,8 @@ _transfer_location_distant(ple_locator_t  *this_locator,
     for (k = 0; k < n_points_loc; k++) {
       ple_lnum_t pt_id = _interior_list[_local_point_ids[k]] - idb;
       location[pt_id] = loc_v_buf[k];
-      location_rank_id[pt_id] = dist_rank;
+      if (loc_v_buf[k] > -1)
+        location_rank_id[pt_id] = dist_rank;
     }
 
     PLE_FREE(loc_v_buf);
@@ -1179,16 +1405,19 @@ _locate_distant(ple_locator_t               *this_locator,
     PLE_MALLOC(_point_list, _n_points, ple_lnum_t);
     _point_list_p = _point_list;
 
+    if (point_list == NULL)
+      _point_id = _point_list;
+    else
+      PLE_MALLOC(_point_id, _n_points, ple_lnum_t);
+
     _n_points = 0;
     if (point_list == NULL) {
-      _point_id = _point_list;
       for (j = 0; j < n_points; j++) {
         if (location[j] < 0)
           _point_list[_n_points++] = j + idb;
       }
     }
     else {
-      PLE_MALLOC(_point_id, _n_points, ple_lnum_t);
       for (j = 0; j < n_points; j++) {
         if (location[j] < 0) {
           _point_list[_n_points] = point_list[j];
@@ -1254,6 +1483,16 @@ _locate_distant(ple_locator_t               *this_locator,
     for (k = 0; k < stride; k++)
       extents[k] = intersects.extents[dist_index*stride + k];
 
+    int n_sub_extents = 0;
+    const double *sub_extents = NULL;
+
+    if (intersects.sub_idx != NULL) {
+      n_sub_extents =   intersects.sub_idx[dist_index + 1]
+                      - intersects.sub_idx[dist_index];
+      sub_extents =   intersects.sub_extents
+                    + intersects.sub_idx[dist_index]*stride;
+    }
+
     /* Build partial buffer */
 
     for (j = 0; j < _n_points; j++) {
@@ -1265,9 +1504,11 @@ _locate_distant(ple_locator_t               *this_locator,
       else
         coord_idx = j;
 
-      if (_within_extents(dim,
-                          &(point_coords[dim*coord_idx]),
-                          extents) == true) {
+      if (_within_sub_extents(dim,
+                              &(point_coords[dim*coord_idx]),
+                              extents,
+                              n_sub_extents,
+                              sub_extents) == true) {
 
         if (_point_id != NULL)
           send_id[n_coords_loc] = _point_id[j] -idb;
@@ -1402,6 +1643,8 @@ _locate_distant(ple_locator_t               *this_locator,
 
   PLE_FREE(intersects.rank);
   PLE_FREE(intersects.extents);
+  PLE_FREE(intersects.sub_idx);
+  PLE_FREE(intersects.sub_extents);
 
   /* Finalize timing */
 
@@ -1690,6 +1933,176 @@ _locate_all_distant(ple_locator_t               *this_locator,
   this_locator->location_cpu_time[1] += comm_timing[1];
 }
 
+/*----------------------------------------------------------------------------
+ * Relocate previously located points on the rank on which they were
+ * located, in parallel mode.
+ *
+ * Updated point coordinates are sent to the distant rank on which each
+ * point was previously located, and located again on that rank's mesh
+ * only. Points not found there anymore are marked as lost (with a
+ * distant location of -1).
+ *
+ * parameters:
+ *   this_locator       <-> pointer to locator structure
+ *   mesh               <-- pointer to mesh representation structure
+ *   tolerance_base     <-- associated fixed tolerance
+ *   tolerance_fraction <-- associated fraction of element bounding
+ *                          boxes added to tolerance
+ *   point_tag          <-- optional point tag (size: n_points)
+ *   point_coords       <-- coordinates of points to locate
+ *   point_id           <-- point id matching each interior point
+ *                          (size: n_interior)
+ *   distance           <-> optional distance from point to matching element
+ *                          (size: n_points)
+ *   mesh_locate_f      <-- function locating points in or on elements
+ *
+ * returns:
+ *   number of local points lost
+ *----------------------------------------------------------------------------*/
+
+static ple_lnum_t
+_relocate_distant(ple_locator_t               *this_locator,
+                  const void                  *mesh,
+                  float                        tolerance_base,
+                  float                        tolerance_fraction,
+                  const int                    point_tag[],
+                  const ple_coord_t            point_coords[],
+                  const ple_lnum_t             point_id[],
+                  float                        distance[],
+                  ple_mesh_elements_locate_t  *mesh_locate_f)
+{
+  ple_lnum_t n_lost = 0;
+
+  MPI_Status status;
+
+  double comm_timing[4] = {0., 0., 0., 0.};
+  const int dim = this_locator->dim;
+  const int have_tags = this_locator->have_tags;
+  const ple_lnum_t idb = this_locator->point_id_base;
+  const ple_lnum_t *_interior_list = this_locator->interior_list;
+
+  for (int li = 0; li < this_locator->n_intersects; li++) {
+
+    int i = (this_locator->comm_order != NULL) ?
+      this_locator->comm_order[li] : li;
+
+    int dist_rank = this_locator->intersect_rank[i];
+
+    const ple_lnum_t *_local_point_ids
+      = this_locator->local_point_ids + this_locator->local_points_idx[i];
+
+    ple_lnum_t n_coords_loc =   this_locator->local_points_idx[i+1]
+                              - this_locator->local_points_idx[i];
+
+    ple_lnum_t n_coords_dist =   this_locator->distant_points_idx[i+1]
+                               - this_locator->distant_points_idx[i];
+
+    ple_lnum_t dist_v_idx = this_locator->distant_points_idx[i];
+
+    ple_coord_t *send_coords;
+    int *send_tag = NULL, *tag_dist = NULL;
+    float *distance_loc, *distance_dist;
+
+    PLE_MALLOC(send_coords, n_coords_loc * dim, ple_coord_t);
+    if (have_tags) {
+      PLE_MALLOC(send_tag, n_coords_loc, int);
+      PLE_MALLOC(tag_dist, n_coords_dist, int);
+    }
+
+    for (ple_lnum_t j = 0; j < n_coords_loc; j++) {
+      ple_lnum_t coord_idx = _interior_list[_local_point_ids[j]] - idb;
+      for (int k = 0; k < dim; k++)
+        send_coords[j*dim + k] = point_coords[dim*coord_idx + k];
+      if (have_tags)
+        send_tag[j] = point_tag[point_id[_local_point_ids[j]]];
+    }
+
+    /* Send updated coordinates to rank of previous location */
+
+    ple_coord_t *coords_dist
+      = this_locator->distant_point_coords + dist_v_idx*dim;
+    ple_lnum_t *location_dist
+      = this_locator->distant_point_location + dist_v_idx;
+
+    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+    MPI_Sendrecv(send_coords, (int)(n_coords_loc*dim),
+                 PLE_MPI_COORD, dist_rank, PLE_MPI_TAG,
+                 coords_dist, (int)(n_coords_dist*dim),
+                 PLE_MPI_COORD, dist_rank, PLE_MPI_TAG,
+                 this_locator->comm, &status);
+
+    if (have_tags)
+      MPI_Sendrecv(send_tag, (int)(n_coords_loc),
+                   MPI_INT, dist_rank, PLE_MPI_TAG,
+                   tag_dist, (int)(n_coords_dist),
+                   MPI_INT, dist_rank, PLE_MPI_TAG,
+                   this_locator->comm, &status);
+
+    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+    PLE_FREE(send_tag);
+    PLE_FREE(send_coords);
+
+    /* Locate received coords on local mesh only */
+
+    PLE_MALLOC(distance_dist, n_coords_dist, float);
+
+    for (ple_lnum_t j = 0; j < n_coords_dist; j++) {
+      location_dist[j] = -1;
+      distance_dist[j] = -1.0;
+    }
+
+    mesh_locate_f(mesh,
+                  tolerance_base,
+                  tolerance_fraction,
+                  n_coords_dist,
+                  coords_dist,
+                  tag_dist,
+                  location_dist,
+                  distance_dist);
+
+    PLE_FREE(tag_dist);
+
+    for (ple_lnum_t j = 0; j < n_coords_dist; j++) {
+      if (distance_dist[j] < -0.1)
+        location_dist[j] = -1;
+    }
+
+    /* Return distance (and thus location status) to local rank */
+
+    PLE_MALLOC(distance_loc, n_coords_loc, float);
+
+    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+    MPI_Sendrecv(distance_dist, (int)n_coords_dist,
+                 MPI_FLOAT, dist_rank, PLE_MPI_TAG,
+                 distance_loc, (int)n_coords_loc,
+                 MPI_FLOAT, dist_rank, PLE_MPI_TAG,
+                 this_locator->comm, &status);
+
+    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+    PLE_FREE(distance_dist);
+
+    for (ple_lnum_t j = 0; j < n_coords_loc; j++) {
+      ple_lnum_t l = point_id[_local_point_ids[j]];
+      if (distance_loc[j] < -0.1)
+        n_lost += 1;
+      if (distance != NULL)
+        distance[l] = (distance_loc[j] < -0.1) ? -1 : distance_loc[j];
+    }
+
+    PLE_FREE(distance_loc);
+
+  } /* End of loop on MPI ranks */
+
+  this_locator->location_wtime[1] += comm_timing[0];
+  this_locator->location_cpu_time[1] += comm_timing[1];
+
+  return n_lost;
+}
+
 #endif /* defined(PLE_HAVE_MPI) */
 
 /*----------------------------------------------------------------------------
@@ -1800,6 +2213,9 @@ _intersects_local(ple_locator_t       *this_locator,
   /* Update intersects */
 
   intersects.n = 0;
+  intersects.rank = NULL;
+  intersects.sub_idx = NULL;
+  intersects.sub_extents = NULL;
 
   mesh_extents_f(mesh,
                  1,
@@ -2350,6 +2766,67 @@ _exchange_point_var_distant(ple_locator_t     *this_locator,
   this_locator->exchange_cpu_time[1] += comm_timing[1];
 }
 
+/*----------------------------------------------------------------------------
+ * Copy variable values between an exchange buffer and the local points
+ * associated with a given intersecting rank.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   intersect_id  <-- id of intersecting rank
+ *   local_var     <-> variable defined on local points
+ *   local_list    <-- optional indirection list for local_var
+ *   nbytes        <-- size of values for one point (type size * stride)
+ *   reverse       <-- if true, copy from local_var to buffer,
+ *                     otherwise copy from buffer to local_var
+ *   interior      <-- if true, local_var is restricted to located points
+ *   loc_v_buf     <-> buffer associated with intersecting rank
+ *----------------------------------------------------------------------------*/
+
+static void
+_copy_local_block(const ple_locator_t  *this_locator,
+                  int                   intersect_id,
+                  void                 *local_var,
+                  const ple_lnum_t     *local_list,
+                  size_t                nbytes,
+                  bool                  reverse,
+                  bool                  interior,
+                  unsigned char        *loc_v_buf)
+{
+  const ple_lnum_t idb = this_locator->point_id_base;
+  const ple_lnum_t *il = this_locator->interior_list;
+  const ple_lnum_t *_local_point_ids
+    = this_locator->local_point_ids
+      + this_locator->local_points_idx[intersect_id];
+
+  const ple_lnum_t n_points_loc
+    =   this_locator->local_points_idx[intersect_id + 1]
+      - this_locator->local_points_idx[intersect_id];
+
+  const bool use_il = (this_locator->n_exterior > 0 && !interior);
+
+  for (ple_lnum_t k = 0; k < n_points_loc; k++) {
+
+    ple_lnum_t p_id = _local_point_ids[k];
+    if (use_il)
+      p_id = il[p_id];
+    if (local_list != NULL)
+      p_id = local_list[p_id] - idb;
+
+    unsigned char *local_v_p = (unsigned char *)local_var + p_id*nbytes;
+    unsigned char *loc_v_buf_p = loc_v_buf + k*nbytes;
+
+    if (reverse) {
+      for (size_t l = 0; l < nbytes; l++)
+        loc_v_buf_p[l] = local_v_p[l];
+    }
+    else {
+      for (size_t l = 0; l < nbytes; l++)
+        local_v_p[l] = loc_v_buf_p[l];
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Distribute variable defined on distant points to processes owning
  * the original points (i.e. distant processes).
@@ -2419,8 +2896,6 @@ _exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
 
   PLE_MALLOC(loc_v_buf, n_points_loc_tot*size*stride, char);
 
-  const ple_lnum_t *il = this_locator->interior_list;
-
   /* First loop on distant ranks for argument checks */
   /*-------------------------------------------------*/
 
@@ -2525,144 +3000,23 @@ _exchange_point_var_distant_asyn(ple_locator_t     *this_locator,
 
   for (int i = 0; i < this_locator->n_intersects; i++) {
 
-    const ple_lnum_t *_local_point_ids
-      = this_locator->local_point_ids + this_locator->local_points_idx[i];
-
-    dist_rank = this_locator->intersect_rank[i];
-
     n_points_loc =    this_locator->local_points_idx[i+1]
-      - this_locator->local_points_idx[i];
-
-    n_points_dist =   this_locator->distant_points_idx[i+1]
-                    - this_locator->distant_points_idx[i];
-
-    dist_v_idx = this_locator->distant_points_idx[i] * stride*size;
-
-    if (distant_var != NULL)
-      dist_v_count = n_points_dist * stride;
-    else
-      dist_v_count = 0;
+                    - this_locator->local_points_idx[i];
 
     if (loc_v_flag[i] > 0)
       loc_v_count = n_points_loc*stride;
     else
       loc_v_count = 0;
 
-    /* Exchange information */
-
-    if (distant_var != NULL)
-      dist_v_ptr = ((unsigned char *)distant_var) + dist_v_idx;
-    else
-      dist_v_ptr = NULL;
-
-    dist_rank = this_locator->intersect_rank[i];
-
-    n_points_loc =    this_locator->local_points_idx[i+1]
-                    - this_locator->local_points_idx[i];
-
-    n_points_dist =   this_locator->distant_points_idx[i+1]
-                    - this_locator->distant_points_idx[i];
-
-    if (reverse == false) {
-
-      if (loc_v_flag[i] > 0) {
-        if (local_list == NULL) {
-          const size_t nbytes = stride*size;
-          if (this_locator->n_exterior == 0 || interior) {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
-              char *local_v_p = (char *)local_var + _local_point_ids[k]*nbytes;
-              const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                local_v_p[l] = loc_v_buf_p[l];
-            }
-          }
-          else {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
-              char *local_v_p =   (char *)local_var
-                                + il[_local_point_ids[k]]*nbytes;
-              const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                local_v_p[l] = loc_v_buf_p[l];
-            }
-          }
-        }
-        else {
-          const size_t nbytes = stride*size;
-          const ple_lnum_t idb = this_locator->point_id_base;
-          if (this_locator->n_exterior == 0 || interior) {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
-              char *local_v_p =   (char *)local_var
-                                + (local_list[_local_point_ids[k]] - idb)*nbytes;
-              const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                local_v_p[l] = loc_v_buf_p[l];
-            }
-          }
-          else {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
-              char *local_v_p =   (char *)local_var
-                                +  (local_list[il[_local_point_ids[k]]] - idb)
-                                  *nbytes;
-              const char *loc_v_buf_p = (const char *)loc_v_ptr + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                local_v_p[l] = loc_v_buf_p[l];
-            }
-          }
-        }
-      }
-
-    }
-    else { /* if (reverse == true) */
-
-      if (loc_v_flag[i] > 0) {
-        if (local_list == NULL) {
-          const size_t nbytes = stride*size;
-          if (this_locator->n_exterior == 0 || interior) {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
-              const char *local_v_p
-                = (const char *)local_var + _local_point_ids[k]*nbytes;
-              char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                loc_v_buf_p[l] = local_v_p[l];
-            }
-          }
-          else {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
-              const char *local_v_p
-                = (const char *)local_var + il[_local_point_ids[k]]*nbytes;
-              char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                loc_v_buf_p[l] = local_v_p[l];
-            }
-          }
-        }
-        else {
-          const size_t nbytes = stride*size;
-          const ple_lnum_t idb = this_locator->point_id_base;
-          if (this_locator->n_exterior == 0 || interior) {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
-              const char *local_v_p
-                = (const char *)local_var
-                  + (local_list[_local_point_ids[k]] - idb)*nbytes;
-              char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                loc_v_buf_p[l] = local_v_p[l];
-            }
-          }
-          else {
-            for (ple_lnum_t k = 0; k < n_points_loc; k++) {
-              const char *local_v_p
-                = (const char *)local_var
-                  + (local_list[il[_local_point_ids[k]]] - idb)*nbytes;
-              char *loc_v_buf_p = (char *)loc_v_ptr + k*nbytes;
-              for (size_t l = 0; l < nbytes; l++)
-                loc_v_buf_p[l] = local_v_p[l];
-            }
-          }
-        }
-      }
-
-    }
+    if (loc_v_flag[i] > 0)
+      _copy_local_block(this_locator,
+                        i,
+                        local_var,
+                        local_list,
+                        stride*size,
+                        reverse,
+                        interior,
+                        loc_v_ptr);
 
     loc_v_ptr += loc_v_count*size;
 
@@ -3038,6 +3392,221 @@ _exchange_point_var(ple_locator_t     *this_locator,
   this_locator->exchange_cpu_time[0] += (cpu_end - cpu_start);
 }
 
+/*----------------------------------------------------------------------------
+ * Start a non-blocking distribution of a variable defined on distant
+ * points to processes owning the original points.
+ *
+ * In packed mode, local_var is used directly as the exchange buffer,
+ * in the order given by ple_locator_get_packed_ids(), and local_list
+ * is ignored; no value is copied by the locator in parallel mode.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   distant_var   <-> variable defined on distant points (ready to send)
+ *   local_var     <-> variable defined on local points (received)
+ *   local_list    <-- optional indirection list for local_var
+ *   type_size     <-- sizeof (float or double) variable type
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse       <-- if nonzero, exchange is reversed
+ *                     (receive values associated with distant points
+ *                     from the processes owning the original points)
+ *   packed        <-- if true, local_var is in exchange order
+ *
+ * returns:
+ *   pointer to pending exchange structure
+ *----------------------------------------------------------------------------*/
+
+static ple_locator_exchange_t *
+_exchange_point_var_start(ple_locator_t     *this_locator,
+                          void              *distant_var,
+                          void              *local_var,
+                          const ple_lnum_t  *local_list,
+                          size_t             type_size,
+                          size_t             stride,
+                          int                reverse,
+                          bool               packed)
+{
+  ple_locator_exchange_t *ex;
+
+  double w_start = ple_timer_wtime();
+  double cpu_start = ple_timer_cpu_time();
+
+  PLE_MALLOC(ex, 1, ple_locator_exchange_t);
+
+  ex->locator = this_locator;
+  ex->local_var = local_var;
+  ex->local_list = local_list;
+  ex->nbytes = type_size*stride;
+  ex->reverse = (reverse) ? true : false;
+  ex->packed = packed;
+  ex->loc_v_buf = (packed) ? (unsigned char *)local_var : NULL;
+  ex->flag = NULL;
+
+  int mpi_flag = 0;
+
+#if defined(PLE_HAVE_MPI)
+
+  ex->n_requests = 0;
+  ex->request = NULL;
+
+  MPI_Initialized(&mpi_flag);
+
+  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
+    mpi_flag = 0;
+
+  if (mpi_flag) {
+
+    MPI_Datatype datatype = MPI_DATATYPE_NULL;
+
+    if (type_size == sizeof(double))
+      datatype = MPI_DOUBLE;
+    else if (type_size == sizeof(float))
+      datatype = MPI_FLOAT;
+    else
+      ple_error(__FILE__, __LINE__, 0,
+                _("type_size passed to ple_locator_exchange_point_var() does\n"
+                  "not correspond to double or float."));
+
+    double comm_timing[4] = {0., 0., 0., 0.};
+
+    const int n_intersects = this_locator->n_intersects;
+    const ple_lnum_t *l_idx = this_locator->local_points_idx;
+    const ple_lnum_t *d_idx = this_locator->distant_points_idx;
+
+    PLE_MALLOC(ex->flag, n_intersects*2, int);
+    PLE_MALLOC(ex->request, n_intersects*4, MPI_Request);
+    if (packed == false)
+      PLE_MALLOC(ex->loc_v_buf, l_idx[n_intersects]*ex->nbytes,
+                 unsigned char);
+
+    /* Post exchange of send/receive flags, as for blocking exchanges */
+
+    MPI_Request *flag_request;
+    PLE_MALLOC(flag_request, n_intersects, MPI_Request);
+
+    for (int i = 0; i < n_intersects; i++) {
+
+      int dist_rank = this_locator->intersect_rank[i];
+
+      ex->flag[i*2] = (distant_var != NULL && d_idx[i+1] > d_idx[i]) ? 1 : 0;
+
+      MPI_Irecv(ex->flag + i*2 + 1, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, flag_request + i);
+      MPI_Isend(ex->flag + i*2, 1, MPI_INT, dist_rank, PLE_MPI_TAG,
+                this_locator->comm, &(ex->request[ex->n_requests++]));
+    }
+
+    /* Post exchange of values; in reverse mode, the number of values
+       to send depends on the distant flag, so values are posted for
+       each distant rank as soon as its flag is received (which avoids
+       waiting on all ranks when others use blocking exchanges) */
+
+    for (int li = 0; li < n_intersects; li++) {
+
+      int i = li;
+
+      if (ex->reverse) {
+        _locator_trace_start_comm(_ple_locator_log_start_p_comm,
+                                  comm_timing);
+        MPI_Waitany(n_intersects, flag_request, &i, MPI_STATUS_IGNORE);
+        _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+      }
+
+      int dist_rank = this_locator->intersect_rank[i];
+
+      unsigned char *loc_v_ptr = NULL;
+      unsigned char *dist_v_ptr = NULL;
+      int dist_v_count = 0;
+
+      if (ex->loc_v_buf != NULL)
+        loc_v_ptr = ex->loc_v_buf + l_idx[i]*ex->nbytes;
+
+      if (distant_var != NULL) {
+        dist_v_ptr = (unsigned char *)distant_var + d_idx[i]*ex->nbytes;
+        dist_v_count = (d_idx[i+1] - d_idx[i]) * stride;
+      }
+
+      if (ex->reverse == false) {
+
+        int loc_v_count = 0;
+        if (local_var != NULL)
+          loc_v_count = (l_idx[i+1] - l_idx[i]) * stride;
+
+        MPI_Irecv(loc_v_ptr, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                  this_locator->comm, &(ex->request[ex->n_requests++]));
+        MPI_Isend(dist_v_ptr, dist_v_count, datatype, dist_rank,
+                  PLE_MPI_TAG, this_locator->comm,
+                  &(ex->request[ex->n_requests++]));
+
+      }
+      else {
+
+        int loc_v_count = 0;
+
+        if (ex->flag[i*2 + 1] > 0) {
+          if (local_var == NULL)
+            ple_error(__FILE__, __LINE__, 0,
+                      _("Incoherent arguments to different instances in "
+                        "_exchange_point_var().\n"
+                        "Send and receive operations do not match "
+                        "(dist_rank = %d\n)\n"), dist_rank);
+          loc_v_count = (l_idx[i+1] - l_idx[i]) * stride;
+          if (packed == false)
+            _copy_local_block(this_locator,
+                              i,
+                              local_var,
+                              local_list,
+                              ex->nbytes,
+                              true,
+                              true,
+                              loc_v_ptr);
+        }
+
+        MPI_Irecv(dist_v_ptr, dist_v_count, datatype, dist_rank,
+                  PLE_MPI_TAG, this_locator->comm,
+                  &(ex->request[ex->n_requests++]));
+        MPI_Isend(loc_v_ptr, loc_v_count, datatype, dist_rank, PLE_MPI_TAG,
+                  this_locator->comm, &(ex->request[ex->n_requests++]));
+
+      }
+
+    }
+
+    /* In standard mode, flags are checked once exchange is complete */
+
+    if (ex->reverse == false) {
+      for (int i = 0; i < n_intersects; i++)
+        ex->request[ex->n_requests++] = flag_request[i];
+    }
+
+    PLE_FREE(flag_request);
+
+    this_locator->exchange_wtime[1] += comm_timing[0];
+    this_locator->exchange_cpu_time[1] += comm_timing[1];
+
+  }
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+  if (!mpi_flag)
+    _exchange_point_var(this_locator,
+                        distant_var,
+                        local_var,
+                        (packed) ? NULL : local_list,
+                        type_size,
+                        stride,
+                        reverse,
+                        true);
+
+  double w_end = ple_timer_wtime();
+  double cpu_end = ple_timer_cpu_time();
+
+  this_locator->exchange_wtime[0] += (w_end - w_start);
+  this_locator->exchange_cpu_time[0] += (cpu_end - cpu_start);
+
+  return ex;
+}
+
 /*----------------------------------------------------------------------------
  * Return timing information.
  *
@@ -3146,6 +3715,7 @@ ple_locator_create(void)
   this_locator->locate_algorithm = _ple_locator_location_algorithm;
   this_locator->exchange_algorithm = _EXCHANGE_SENDRECV;
   this_locator->async_threshold = _ple_locator_async_threshold;
+  this_locator->max_sub_extents = _ple_locator_max_sub_extents;
 
   this_locator->point_id_base = 0;
 
@@ -3593,6 +4163,234 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
   this_locator->location_cpu_time[1] += comm_timing[1];
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update location of points for which set_mesh has already been
+ *        called, after displacement of the points or of the mesh.
+ *
+ * The point set must be the same as for the previous location (though
+ * the point_list ordering may differ), and the mesh representation must
+ * use the same partitioning, with possibly updated coordinates.
+ *
+ * Each previously located point is first located again only on the
+ * distant rank on which it was previously found, so the cost depends
+ * on the number of points handled by each rank and not on the global
+ * search. Points not found there anymore, and points which were not
+ * located, are then searched for using the global search (as with
+ * \ref ple_locator_extend_search), only if present on some rank.
+ *
+ * A point which is still found on its previous rank is not moved to
+ * another rank, even if the element found on that other rank would be
+ * closer (but in tolerance-based cases only, as an element containing
+ * the point is usually unique).
+ *
+ * If the point set does not match the previous one, or in serial mode,
+ * this is equivalent to \ref ple_locator_set_mesh.
+ *
+ * As with \ref ple_locator_set_mesh, location ids are those returned by
+ * mesh_locate_f, so any shift applied using
+ * \ref ple_locator_shift_locations must be applied again.
+ *
+ * \param[in, out] this_locator        pointer to locator structure
+ * \param[in]      mesh                pointer to mesh representation structure
+ * \param[in]      options             options array (size
+ *                                     PLE_LOCATOR_N_OPTIONS), or NULL
+ * \param[in]      tolerance_base      associated fixed tolerance
+ * \param[in]      tolerance_fraction  associated fraction of element bounding
+ *                                     boxes added to tolerance
+ * \param[in]      dim                 spatial dimension of mesh and points to
+ *                                     locate
+ * \param[in]      n_points            number of points to locate
+ * \param[in]      point_list          optional indirection array to point_coords
+ * \param[in]      point_tag           optional point tag (size: n_points)
+ * \param[in]      point_coords        coordinates of points to locate
+ *                                     (dimension: dim * n_points)
+ * \param[out]     distance            optional distance from point to matching
+ *                                     element: < 0 if unlocated; 0 - 1 if inside
+ *                                     and > 1 if outside a volume element, or
+ *                                     absolute distance to a surface element
+ *                                     (size: n_points)
+ * \param[in]      mesh_extents_f      pointer to function computing mesh or mesh
+ *                                     subset or element extents
+ * \param[in]      mesh_locate_f       pointer to function wich updates the
+ *                                     location[] and distance[] arrays
+ *                                     associated with a set of points for
+ *                                     points that are in an element of this
+ *                                     mesh, or closer to one than to previously
+ *                                     encountered elements.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_relocate(ple_locator_t               *this_locator,
+                     const void                  *mesh,
+                     const int                   *options,
+                     float                        tolerance_base,
+                     float                        tolerance_fraction,
+                     int                          dim,
+                     ple_lnum_t                   n_points,
+                     const ple_lnum_t             point_list[],
+                     const int                    point_tag[],
+                     const ple_coord_t            point_coords[],
+                     float                        distance[],
+                     ple_mesh_extents_t          *mesh_extents_f,
+                     ple_mesh_elements_locate_t  *mesh_locate_f)
+{
+  int mpi_flag = 0;
+
+#if defined(PLE_HAVE_MPI)
+
+  MPI_Initialized(&mpi_flag);
+
+  if (mpi_flag && this_locator->comm == MPI_COMM_NULL)
+    mpi_flag = 0;
+
+  if (mpi_flag) {
+
+    double w_start = ple_timer_wtime();
+    double cpu_start = ple_timer_cpu_time();
+
+    const ple_lnum_t idb = this_locator->point_id_base;
+    const ple_lnum_t n_interior = this_locator->n_interior;
+
+    /* Check the point set is consistent with the previous one, and
+       determine point ids of interior points (whose coordinate ids
+       are stored in interior_list) */
+
+    int l_flag = 0, g_flag = 0;
+
+    if (   this_locator->dim != dim
+        || n_interior + this_locator->n_exterior != n_points)
+      l_flag = 1;
+
+    ple_lnum_t *point_id;
+    PLE_MALLOC(point_id, n_interior, ple_lnum_t);
+
+    if (l_flag == 0 && point_list == NULL) {
+      for (ple_lnum_t i = 0; i < n_interior; i++) {
+        point_id[i] = this_locator->interior_list[i] - idb;
+        if (point_id[i] < 0 || point_id[i] >= n_points)
+          l_flag = 1;
+      }
+    }
+    else if (l_flag == 0) {
+      ple_lnum_t n_coords = 0;
+      for (ple_lnum_t j = 0; j < n_points; j++) {
+        if (point_list[j] - idb >= n_coords)
+          n_coords = point_list[j] - idb + 1;
+      }
+      for (ple_lnum_t i = 0; i < n_interior; i++) {
+        if (this_locator->interior_list[i] - idb >= n_coords)
+          n_coords = this_locator->interior_list[i] - idb + 1;
+      }
+      ple_lnum_t *coord_point_id;
+      PLE_MALLOC(coord_point_id, n_coords, ple_lnum_t);
+      for (ple_lnum_t j = 0; j < n_coords; j++)
+        coord_point_id[j] = -1;
+      for (ple_lnum_t j = 0; j < n_points; j++)
+        coord_point_id[point_list[j] - idb] = j;
+      for (ple_lnum_t i = 0; i < n_interior; i++) {
+        point_id[i] = coord_point_id[this_locator->interior_list[i] - idb];
+        if (point_id[i] < 0)
+          l_flag = 1;
+      }
+      PLE_FREE(coord_point_id);
+    }
+
+    MPI_Allreduce(&l_flag, &g_flag, 1, MPI_INT, MPI_MAX,
+                  this_locator->comm);
+
+    if (g_flag > 0) {
+      PLE_FREE(point_id);
+      ple_locator_set_mesh(this_locator,
+                           mesh,
+                           options,
+                           tolerance_base,
+                           tolerance_fraction,
+                           dim,
+                           n_points,
+                           point_list,
+                           point_tag,
+                           point_coords,
+                           distance,
+                           mesh_extents_f,
+                           mesh_locate_f);
+      return;
+    }
+
+    if (distance != NULL) {
+      for (ple_lnum_t j = 0; j < n_points; j++)
+        distance[j] = -1;
+    }
+
+    /* Relocate points on previous ranks */
+
+    ple_lnum_t n_lost = _relocate_distant(this_locator,
+                                          mesh,
+                                          tolerance_base,
+                                          tolerance_fraction,
+                                          point_tag,
+                                          point_coords,
+                                          point_id,
+                                          distance,
+                                          mesh_locate_f);
+
+    l_flag = (n_lost + this_locator->n_exterior > 0) ? 1 : 0;
+
+    MPI_Allreduce(&l_flag, &g_flag, 1, MPI_INT, MPI_MAX,
+                  this_locator->comm);
+
+    /* Search for lost or previously unlocated points; interior
+       point ids are first reset to the numbering expected by
+       ple_locator_extend_search (i.e. not through point_list) */
+
+    if (g_flag > 0) {
+
+      for (ple_lnum_t i = 0; i < n_interior; i++)
+        this_locator->interior_list[i] = point_id[i] + idb;
+
+      ple_locator_extend_search(this_locator,
+                                mesh,
+                                options,
+                                tolerance_base,
+                                tolerance_fraction,
+                                n_points,
+                                point_list,
+                                point_tag,
+                                point_coords,
+                                distance,
+                                mesh_extents_f,
+                                mesh_locate_f);
+
+    }
+
+    PLE_FREE(point_id);
+
+    double w_end = ple_timer_wtime();
+    double cpu_end = ple_timer_cpu_time();
+
+    this_locator->location_wtime[0] += (w_end - w_start);
+    this_locator->location_cpu_time[0] += (cpu_end - cpu_start);
+  }
+
+#endif
+
+  if (!mpi_flag)
+    ple_locator_set_mesh(this_locator,
+                         mesh,
+                         options,
+                         tolerance_base,
+                         tolerance_fraction,
+                         dim,
+                         n_points,
+                         point_list,
+                         point_tag,
+                         point_coords,
+                         distance,
+                         mesh_extents_f,
+                         mesh_locate_f);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Shift location ids for located points after locator initialization.
@@ -3729,6 +4527,28 @@ ple_locator_get_interior_list(const ple_locator_t  *this_locator)
   return this_locator->interior_list;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return ordering of located points in exchange buffers.
+ *
+ * Values exchanged with \ref ple_locator_exchange_point_var_packed
+ * are ordered by distant rank; for each such value, this list provides
+ * the matching (0 to n-1) index in the list of located points returned
+ * by \ref ple_locator_get_interior_list.
+ *
+ * \param[in] this_locator pointer to locator structure
+ *
+ * \return ids of located points in exchange order (size: n_interior),
+ *         or NULL if this order is the identity (i.e. in serial mode).
+ */
+/*----------------------------------------------------------------------------*/
+
+const ple_lnum_t *
+ple_locator_get_packed_ids(const ple_locator_t  *this_locator)
+{
+  return this_locator->local_point_ids;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return number of points not located after locator initialization.
@@ -3886,6 +4706,203 @@ ple_locator_exchange_point_var_all(ple_locator_t     *this_locator,
                       false);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start a non-blocking distribution of a variable defined on
+ * distant points to processes owning the original points.
+ *
+ * This function's arguments and semantics are the same as those of
+ * \ref ple_locator_exchange_point_var, but it only posts the associated
+ * communications, which are completed by a matching call to
+ * \ref ple_locator_exchange_point_var_wait. In between, the caller may
+ * do independent work, but may not modify distant_var (or local_var in
+ * reverse mode), nor use received values.
+ *
+ * Pending exchanges are compatible with blocking exchanges on the
+ * distant side. In serial mode, the exchange is completed immediately.
+ *
+ * In standard mode, if local_var is NULL while the distant side sends
+ * values, the mismatch is detected by MPI (truncation) rather than
+ * by the locator.
+ *
+ * \param[in]      this_locator pointer to locator structure
+ * \param[in, out] distant_var  variable defined on distant points
+ *                              (ready to send); size: n_dist_points*stride
+ * \param[in, out] local_var    variable defined on located local points
+ *                              (received); size: n_interior*stride
+ * \param[in]      local_list   optional indirection list for local_var
+ * \param[in]      type_size    sizeof (float or double) variable type
+ * \param[in]      stride       dimension (1 for scalar,
+ *                              3 for interleaved vector)
+ * \param[in]      reverse      if nonzero, exchange is reversed
+ *                              (receive values associated with distant points
+ *                              from the processes owning the original points)
+ *
+ * \return pointer to pending exchange structure
+ */
+/*----------------------------------------------------------------------------*/
+
+ple_locator_exchange_t *
+ple_locator_exchange_point_var_start(ple_locator_t     *this_locator,
+                                     void              *distant_var,
+                                     void              *local_var,
+                                     const ple_lnum_t  *local_list,
+                                     size_t             type_size,
+                                     size_t             stride,
+                                     int                reverse)
+{
+  return _exchange_point_var_start(this_locator,
+                                   distant_var,
+                                   local_var,
+                                   local_list,
+                                   type_size,
+                                   stride,
+                                   reverse,
+                                   false);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete a non-blocking variable exchange.
+ *
+ * Once this function returns, received values are available, and
+ * sent values may be modified.
+ *
+ * \param[in, out]  exchange  pointer to pending exchange structure
+ *                            (set to NULL on return)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_wait(ple_locator_exchange_t  **exchange)
+{
+  if (exchange == NULL || *exchange == NULL)
+    return;
+
+  ple_locator_exchange_t *ex = *exchange;
+  ple_locator_t *this_locator = ex->locator;
+
+#if defined(PLE_HAVE_MPI)
+
+  if (ex->request != NULL) {
+
+    double comm_timing[4] = {0., 0., 0., 0.};
+
+    double w_start = ple_timer_wtime();
+    double cpu_start = ple_timer_cpu_time();
+
+    _locator_trace_start_comm(_ple_locator_log_start_p_comm, comm_timing);
+
+    MPI_Waitall(ex->n_requests, ex->request, MPI_STATUSES_IGNORE);
+
+    _locator_trace_end_comm(_ple_locator_log_end_p_comm, comm_timing);
+
+    /* Copy received values to local points */
+
+    if (ex->reverse == false) {
+
+      for (int i = 0; i < this_locator->n_intersects; i++) {
+
+        if (ex->flag[i*2 + 1] < 1)
+          continue;
+
+        if (ex->local_var == NULL)
+          ple_error(__FILE__, __LINE__, 0,
+                    _("Incoherent arguments to different instances in "
+                      "_exchange_point_var().\n"
+                      "Send and receive operations do not match "
+                      "(dist_rank = %d\n)\n"),
+                    this_locator->intersect_rank[i]);
+
+        if (ex->packed)
+          continue;
+
+        _copy_local_block(this_locator,
+                          i,
+                          ex->local_var,
+                          ex->local_list,
+                          ex->nbytes,
+                          false,
+                          true,
+                          (  ex->loc_v_buf
+                           + this_locator->local_points_idx[i]*ex->nbytes));
+
+      }
+
+    }
+
+    double w_end = ple_timer_wtime();
+    double cpu_end = ple_timer_cpu_time();
+
+    this_locator->exchange_wtime[0] += (w_end - w_start);
+    this_locator->exchange_cpu_time[0] += (cpu_end - cpu_start);
+    this_locator->exchange_wtime[1] += comm_timing[0];
+    this_locator->exchange_cpu_time[1] += comm_timing[1];
+
+    PLE_FREE(ex->request);
+
+  }
+
+#endif /* defined(PLE_HAVE_MPI) */
+
+  PLE_FREE(ex->flag);
+  if (ex->packed == false)
+    PLE_FREE(ex->loc_v_buf);
+
+  PLE_FREE(*exchange);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Distribute variable defined on distant points to processes owning
+ * the original points, with local values in exchange order.
+ *
+ * This function is similar to \ref ple_locator_exchange_point_var, but
+ * local values are ordered as described by \ref ple_locator_get_packed_ids,
+ * so in parallel mode, both arrays are passed directly to MPI, and no
+ * value is copied by the locator. This allows using buffers allocated on
+ * an accelerator with a device-aware MPI library, the caller handling
+ * the matching reordering.
+ *
+ * The distant side of the exchange may use any of the other exchange
+ * functions.
+ *
+ * \param[in]      this_locator pointer to locator structure
+ * \param[in, out] distant_var  variable defined on distant points
+ *                              (ready to send); size: n_dist_points*stride
+ * \param[in, out] packed_var   variable defined on located local points,
+ *                              in exchange order
+ *                              (received); size: n_interior*stride
+ * \param[in]      type_size    sizeof (float or double) variable type
+ * \param[in]      stride       dimension (1 for scalar,
+ *                              3 for interleaved vector)
+ * \param[in]      reverse      if nonzero, exchange is reversed
+ *                              (receive values associated with distant points
+ *                              from the processes owning the original points)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_packed(ple_locator_t     *this_locator,
+                                      void              *distant_var,
+                                      void              *packed_var,
+                                      size_t             type_size,
+                                      size_t             stride,
+                                      int                reverse)
+{
+  ple_locator_exchange_t *ex
+    = _exchange_point_var_start(this_locator,
+                                distant_var,
+                                packed_var,
+                                NULL,
+                                type_size,
+                                stride,
+                                reverse,
+                                true);
+
+  ple_locator_exchange_point_var_wait(&ex);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return timing information.
@@ -4169,7 +5186,8 @@ ple_locator_set_default_option(const char  *key,
   _parse_locator_option(key,
                         value,
                         &_ple_locator_location_algorithm,
-                        &_ple_locator_async_threshold);
+                        &_ple_locator_async_threshold,
+                        &_ple_locator_max_sub_extents);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4193,7 +5211,8 @@ ple_locator_set_options(ple_locator_t  *this_locator,
   _parse_locator_option(key,
                         value,
                         &(this_locator->locate_algorithm),
-                        &(this_locator->async_threshold));
+                        &(this_locator->async_threshold),
+                        &(this_locator->max_sub_extents));
 }
 
 #if defined(PLE_HAVE_MPI)
@@ -160,6 +160,12 @@ typedef int
 
 typedef struct _ple_locator_t ple_locator_t;
 
+/*----------------------------------------------------------------------------
+ * Structure defining a pending (non-blocking) variable exchange
+ *----------------------------------------------------------------------------*/
+
+typedef struct _ple_locator_exchange_t ple_locator_exchange_t;
+
 /*=============================================================================
  * Static global variables
  *============================================================================*/
@@ -301,6 +307,60 @@ ple_locator_extend_search(ple_locator_t               *this_locator,
                           ple_mesh_extents_t          *mesh_extents_f,
                           ple_mesh_elements_locate_t  *mesh_locate_f);
 
+/*----------------------------------------------------------------------------
+ * Update location of points for which set_mesh has already been called,
+ * after displacement of the points or of the mesh.
+ *
+ * Previously located points are first located again only on the rank on
+ * which they were previously found; lost or unlocated points are then
+ * searched for globally. The point set must match the previous one
+ * (otherwise, or in serial mode, this is equivalent to set_mesh).
+ *
+ * As with set_mesh, location ids returned are those of locate_f, so
+ * any shift applied with ple_locator_shift_locations must be reapplied.
+ *
+ * parameters:
+ *   this_locator       <-> pointer to locator structure
+ *   mesh               <-- pointer to mesh representation structure
+ *   options            <-- options array (size PLE_LOCATOR_N_OPTIONS),
+ *                          or NULL
+ *   tolerance_base     <-- associated base tolerance
+ *   tolerance_fraction <-- associated fraction of element bounding boxes
+ *                          added to tolerance
+ *   dim                <-- spatial dimension of mesh and points to locate
+ *   n_points           <-- number of points to locate
+ *   point_list         <-- optional indirection array to point_coords
+ *   point_tag          <-- optional point tag (size: n_points)
+ *   point_coords       <-- coordinates of points to locate
+ *                          (dimension: dim * n_points)
+ *   distance           --> optional distance from point to matching element:
+ *                          < 0 if unlocated; 0 - 1 if inside and > 1 if
+ *                          outside a volume element, or absolute distance
+ *                          to a surface element (size: n_points)
+ *   mesh_extents_f     <-- pointer to function computing mesh extents
+ *   locate_f           <-- pointer to function wich updates the location[]
+ *                          and distance[] arrays associated with a set of
+ *                          points for points that are in an element of this
+ *                          mesh, or closer to one than to previously
+ *                          encountered elements.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_relocate(ple_locator_t               *this_locator,
+                     const void                  *mesh,
+                     const int                   *options,
+                     float                        tolerance_base,
+                     float                        tolerance_fraction,
+                     int                          dim,
+                     ple_lnum_t                   n_points,
+                     const ple_lnum_t             point_list[],
+                     const int                    point_tag[],
+                     const ple_coord_t            point_coords[],
+                     float                        distance[],
+                     ple_mesh_extents_t          *mesh_extents_f,
+                     ple_mesh_elements_locate_t  *mesh_locate_f);
+
 /*----------------------------------------------------------------------------
  * Shift location ids for located points after locator initialization.
  *
@@ -383,6 +443,23 @@ ple_locator_get_n_interior(const ple_locator_t  *this_locator);
 const ple_lnum_t *
 ple_locator_get_interior_list(const ple_locator_t  *this_locator);
 
+/*----------------------------------------------------------------------------
+ * Return ordering of located points in exchange buffers.
+ *
+ * For each value exchanged with ple_locator_exchange_point_var_packed(),
+ * this list provides the matching (0 to n-1) index in the list of
+ * located points returned by ple_locator_get_interior_list().
+ *
+ * parameters:
+ *   this_locator <-- pointer to locator structure
+ *
+ * returns:
+ *   ids of located points in exchange order, or NULL for identity.
+ *----------------------------------------------------------------------------*/
+
+const ple_lnum_t *
+ple_locator_get_packed_ids(const ple_locator_t  *this_locator);
+
 /*----------------------------------------------------------------------------
  * Return number of points not located after locator initialization.
  *
@@ -505,6 +582,86 @@ ple_locator_exchange_point_var_all(ple_locator_t     *this_locator,
                                    size_t             stride,
                                    int                reverse);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Start a non-blocking distribution of a variable defined on
+ * distant points to processes owning the original points.
+ *
+ * This function's arguments and semantics are the same as those of
+ * \ref ple_locator_exchange_point_var, but it only posts the associated
+ * communications, which are completed by a matching call to
+ * \ref ple_locator_exchange_point_var_wait. In between, the caller may
+ * do independent work, but may not modify distant_var (or local_var in
+ * reverse mode), nor use received values.
+ *
+ * \param[in]      this_locator pointer to locator structure
+ * \param[in, out] distant_var  variable defined on distant points
+ *                              (ready to send); size: n_dist_points*stride
+ * \param[in, out] local_var    variable defined on located local points
+ *                              (received); size: n_interior*stride
+ * \param[in]      local_list   optional indirection list for local_var
+ * \param[in]      type_size    sizeof (float or double) variable type
+ * \param[in]      stride       dimension (1 for scalar,
+ *                              3 for interleaved vector)
+ * \param[in]      reverse      if nonzero, exchange is reversed
+ *                              (receive values associated with distant points
+ *                              from the processes owning the original points)
+ *
+ * \return pointer to pending exchange structure
+ */
+/*----------------------------------------------------------------------------*/
+
+ple_locator_exchange_t *
+ple_locator_exchange_point_var_start(ple_locator_t     *this_locator,
+                                     void              *distant_var,
+                                     void              *local_var,
+                                     const ple_lnum_t  *local_list,
+                                     size_t             type_size,
+                                     size_t             stride,
+                                     int                reverse);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Complete a non-blocking variable exchange.
+ *
+ * \param[in, out]  exchange  pointer to pending exchange structure
+ *                            (set to NULL on return)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_wait(ple_locator_exchange_t  **exchange);
+
+/*----------------------------------------------------------------------------
+ * Distribute variable defined on distant points to processes owning
+ * the original points, with local values in exchange order.
+ *
+ * Local values are ordered as described by ple_locator_get_packed_ids(),
+ * so in parallel mode, both arrays are passed directly to MPI, allowing
+ * the use of device buffers with a device-aware MPI library.
+ *
+ * parameters:
+ *   this_locator  <-- pointer to locator structure
+ *   distant_var   <-> variable defined on distant points (ready to send)
+ *                     size: n_dist_points*stride
+ *   packed_var    <-> variable defined on located local points,
+ *                     in exchange order (received)
+ *                     size: n_interior*stride
+ *   type_size     <-- sizeof (float or double) variable type
+ *   stride        <-- dimension (1 for scalar, 3 for interlaced vector)
+ *   reverse       <-- if nonzero, exchange is reversed
+ *                     (receive values associated with distant points
+ *                     from the processes owning the original points)
+ *----------------------------------------------------------------------------*/
+
+void
+ple_locator_exchange_point_var_packed(ple_locator_t     *this_locator,
+                                      void              *distant_var,
+                                      void              *packed_var,
+                                      size_t             type_size,
+                                      size_t             stride,
+                                      int                reverse);
+
 /*----------------------------------------------------------------------------
  * Return timing information.
  *
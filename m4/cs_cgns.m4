@@ -29,6 +29,7 @@ AC_DEFUN([CS_AC_TEST_CGNS], [
 
 cs_have_cgns=no
 cs_have_cgns_headers=no
+cs_have_cgns_mpi=no
 cgns_prefix=""
 
 AC_ARG_VAR([CGNS_ROOT_DIR], [CGNS root directory (superseded by --with-cgns=PATH)])
@@ -143,6 +144,24 @@ Otherwise, you need to provide a CGNS 3.1 library and development headers.])
 
   fi
 
+  # Check for parallel CGNS options
+  #--------------------------------
+
+  if test "x$cs_have_mpi" = "xyes" -a "x$cs_have_cgns" = "xyes"; then
+
+    AC_LINK_IFELSE([AC_LANG_PROGRAM(
+[[#include <pcgnslib.h>]],
+[[(void)cgp_mpi_comm(MPI_COMM_NULL);
+(void)cgp_poly_elements_write_data(0, 0, 0, 0, 0, 0, NULL, NULL);]])
+                   ],
+                   [ AC_DEFINE([HAVE_CGNS_MPI], 1, [CGNS parallel I/O support])
+                     cs_have_cgns_mpi=yes
+                   ],
+                   [ AC_MSG_WARN([no CGNS parallel I/O support]) ],
+                  )
+
+  fi
+
   if test "x$cs_have_cgns" != "xyes"; then
     CGNS_LIBS=""
   fi
@@ -216,6 +216,8 @@ if test "x$with_hdf5" != "xno" ; then
 
 fi
 
+AM_CONDITIONAL(HAVE_HDF5, test x$cs_have_hdf5 = xyes)
+
 AC_SUBST(cs_have_hdf5)
 AC_SUBST(hdf5_prefix, [${hdf5_prefix}])
 AC_SUBST(HDF5_CPPFLAGS)
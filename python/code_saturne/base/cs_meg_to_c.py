@@ -172,6 +172,13 @@ _function_names = {'vol': 'cs_meg_volume_function.cxx',
                    'pwa': 'cs_meg_post_output.cxx',
                    'pca': 'cs_meg_post_calculator.cxx'}
 
+# Arguments used to select blocks (by bisection in a sorted keys table)
+# for functions which may contain many blocks.
+_dispatch_args = {'vol': ('fields_names', 'zone_name'),
+                  'bnd': ('field_name', 'condition', 'zone_name'),
+                  'src': ('zone_name', 'name', 'source_type'),
+                  'ini': ('zone_name', 'field_name')}
+
 _block_comments = {'vol': 'User defined formula for variable(s) %s over zone %s',
                    'bnd': 'User defined formula for "%s" over BC=%s',
                    'src': 'User defined source term for %s over zone %s',
@@ -324,6 +331,8 @@ class meg_to_c_interpreter:
 
         self.tmp_path = os.path.join(data_path, 'tmp')
 
+        self.block_keys = []
+
         # function name to file name dictionary
         self.funcs = {'vol': {},
                       'bnd': {},
@@ -387,6 +396,47 @@ class meg_to_c_interpreter:
 
     #---------------------------------------------------------------------------
 
+    def block_condition(self, key):
+        """
+        Return the condition selecting a given block, and register
+        the associated key (in _dispatch_args order). The block id is
+        a placeholder, replaced once all keys are known.
+        """
+
+        if key not in self.block_keys:
+            self.block_keys.append(key)
+        b_id = self.block_keys.index(key)
+
+        return '  if (_b_id == @CS_MEG_BLOCK_%d@) {\n' % b_id
+
+    #---------------------------------------------------------------------------
+
+    def write_dispatch(self, func_type, code):
+        """
+        Write the sorted keys table and block id lookup, and
+        replace block id placeholders in the given code.
+        """
+
+        args = _dispatch_args[func_type]
+        n_parts = len(args)
+        s_keys = sorted(self.block_keys)
+
+        for i, k in enumerate(self.block_keys):
+            code = code.replace('@CS_MEG_BLOCK_%d@' % i,
+                                str(s_keys.index(k)))
+
+        lookup = '  static const char *_keys[] = {\n'
+        for k in s_keys:
+            lookup += '    ' + ', '.join(['"%s"' % p for p in k]) + ',\n'
+        lookup += '  };\n\n'
+        lookup += '  const char *_key[] = {%s};\n' % ', '.join(args)
+        lookup += '  const int _b_id = cs_meg_dispatch_id(%d, %d, _keys, _key);\n\n' \
+            % (len(s_keys), n_parts)
+
+        return lookup + code
+
+    #---------------------------------------------------------------------------
+
     def update_block_expression(self, func_type, key, new_exp):
 
         self.funcs[func_type][key]['exp']   = new_exp
@@ -545,8 +595,7 @@ class meg_to_c_interpreter:
 
         # Write the block
         nsplit = name.split('+')
-        usr_blck = tab + 'if (strcmp(fields_names, "%s") == 0 &&\n' % (name)
-        usr_blck += tab + '    strcmp(zone_name, "%s") == 0) {\n' % (zone)
+        usr_blck = self.block_condition((name, zone))
 
         usr_blck += usr_defs
 
@@ -654,10 +703,7 @@ class meg_to_c_interpreter:
             usr_defs += parsed_exp[1]
 
         # Write the block
-        block_cond  = tab + 'if (strcmp(field_name, "%s") == 0 &&\n' % (field_name)
-        block_cond += tab + '    strcmp(condition, "%s") == 0 &&\n' % (cname)
-        block_cond += tab + '    strcmp(zone_name, "%s") == 0) {\n' % (zone)
-        usr_blck = block_cond + '\n'
+        usr_blck = self.block_condition((field_name, cname, zone)) + '\n'
 
         usr_blck += usr_defs
 
@@ -773,10 +819,7 @@ class meg_to_c_interpreter:
             usr_defs += parsed_exp[1]
 
         # Write the block
-        block_cond  = tab + 'if (strcmp(zone_name, "%s") == 0 &&\n' % (zone)
-        block_cond += tab + '    strcmp(name, "%s") == 0 && \n' % (name)
-        block_cond += tab + '    strcmp(source_type, "%s") == 0) {\n' % (source_type)
-        usr_blck = block_cond + '\n'
+        usr_blck = self.block_condition((zone, name, source_type)) + '\n'
 
         usr_blck += usr_defs
 
@@ -885,9 +928,7 @@ class meg_to_c_interpreter:
             usr_defs += parsed_exp[1]
 
         # Write the block
-        block_cond  = tab + 'if (strcmp(zone_name, "%s") == 0 &&\n' % (zone)
-        block_cond += tab + '    strcmp(field_name, "%s") == 0) {\n' % (name)
-        usr_blck = block_cond + '\n'
+        usr_blck = self.block_condition((zone, name)) + '\n'
 
         usr_blck += usr_defs
 
@@ -2506,6 +2547,8 @@ class meg_to_c_interpreter:
 #                code_to_write += _file_header2
             code_to_write += _file_header3
             code_to_write += _function_header[func_type]
+            self.block_keys = []
+            blocks_code = ''
             k_count = 0
             for key in self.funcs[func_type].keys():
                 w_block = self.write_block(func_type, key)
@@ -2521,13 +2564,17 @@ class meg_to_c_interpreter:
                 m1 = '/* ' + m1 + '\n'
 
                 if k_count > 0:
-                    code_to_write += '\n'
-                code_to_write += '  ' + m1
-                code_to_write += '  ' + m2
-                code_to_write += w_block
+                    blocks_code += '\n'
+                blocks_code += '  ' + m1
+                blocks_code += '  ' + m2
+                blocks_code += w_block
 
                 k_count += 1
 
+            if func_type in _dispatch_args and self.block_keys:
+                blocks_code = self.write_dispatch(func_type, blocks_code)
+
+            code_to_write += blocks_code
             code_to_write += _file_footer
 
         # Write the C file if necessary
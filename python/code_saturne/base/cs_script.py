@@ -52,6 +52,7 @@ class master_script:
                          'salome':self.salome,
                          'submit':self.submit,
                          'symbol2line':self.symbol2line,
+                         'tpconvert':self.tpconvert,
                          'update':self.update,
                          'up':self.update}
 
@@ -124,6 +125,7 @@ Topics:
   run
   submit
   symbol2line
+  tpconvert
 
 Options:
   -h, --help  show this help message and exit"""
@@ -195,6 +197,10 @@ command"""
         from code_saturne.base import cs_submit
         return cs_submit.main(options, self.package)
 
+    def tpconvert(self, options = None):
+        from code_saturne.base import cs_time_plot_convert
+        return cs_time_plot_convert.main(options, self.package)
+
     def update(self, options = None):
         from code_saturne.base import cs_update
         return cs_update.main(options, self.package)
@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+
+#-------------------------------------------------------------------------------
+
+# This file is part of code_saturne, a general-purpose CFD tool.
+#
+# Copyright (C) 1998-2024 EDF S.A.
+#
+# This program is free software; you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 2 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+# details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+# Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#-------------------------------------------------------------------------------
+
+"""
+This module converts binary (.tpb) time plot files to CSV files.
+
+A binary time plot file contains a magic string line, a 32-bit integer
+used to check endianness, a CSV header line, and records made of
+the number of values and time step number (32-bit integers), followed
+by the time value and the associated values (64-bit floating-point).
+
+This module defines the following functions:
+- process_cmd_line
+- convert
+- main
+"""
+
+#===============================================================================
+# Import required Python modules
+#===============================================================================
+
+import os, sys
+import struct
+from optparse import OptionParser
+
+#-------------------------------------------------------------------------------
+# Global definitions
+#-------------------------------------------------------------------------------
+
+_magic = b"code_saturne binary time plot 1.0\n"
+
+#-------------------------------------------------------------------------------
+# Process the command line arguments
+#-------------------------------------------------------------------------------
+
+def process_cmd_line(argv, pkg):
+    """
+    Process the passed command line arguments.
+    """
+
+    if sys.argv[0][-3:] == '.py':
+        usage = "usage: %prog [options] <file_name> [<file_name> ...]"
+    else:
+        usage = "usage: %prog tpconvert [options] <file_name> [<file_name> ...]"
+
+    usage += """
+
+Convert binary (.tpb) time plot files to CSV files.
+"""
+
+    parser = OptionParser(usage=usage)
+
+    parser.add_option("-o", "--output", dest="output", type="string",
+                      metavar="<file>",
+                      help="output file name (only with a single input " \
+                          + "file; default: input name with .csv extension).")
+
+    parser.set_defaults(output=None)
+
+    (options, args) = parser.parse_args(argv)
+
+    if len(args) < 1 or (options.output and len(args) > 1):
+        parser.print_help()
+        args = None
+
+    return  options, args
+
+#-------------------------------------------------------------------------------
+# Convert a binary time plot file
+#-------------------------------------------------------------------------------
+
+def convert(input_name, output_name):
+    """
+    Convert a binary time plot file to CSV.
+    """
+
+    f = open(input_name, 'rb')
+
+    if f.readline() != _magic:
+        f.close()
+        raise Exception("File \"" + input_name + "\" is not a binary "
+                        + "time plot file.")
+
+    endian = '<'
+    if struct.unpack('<i', f.read(4))[0] != 1:
+        endian = '>'
+
+    header = f.readline().decode('utf-8')
+    use_iteration = header.startswith(' iteration')
+
+    r_head = struct.Struct(endian + 'iid')
+
+    g = open(output_name, 'w')
+    g.write(header)
+
+    while True:
+        b = f.read(r_head.size)
+        if len(b) < r_head.size:
+            break
+        n_vals, tn, t = r_head.unpack(b)
+        b = f.read(8*n_vals)
+        if len(b) < 8*n_vals:
+            break
+        vals = struct.unpack(endian + str(n_vals) + 'd', b)
+        if use_iteration:
+            l = "%8d" % tn
+        else:
+            l = "%14.7e" % t
+        for v in vals:
+            l += ", %14.7e" % v
+        g.write(l + '\n')
+
+    g.close()
+    f.close()
+
+#===============================================================================
+# Run the utility
+#===============================================================================
+
+def main(argv, pkg):
+    """
+    Main function.
+    """
+
+    options, args = process_cmd_line(argv, pkg)
+
+    if not args:
+        return 1
+
+    for input_name in args:
+        output_name = options.output
+        if not output_name:
+            output_name = os.path.splitext(input_name)[0] + '.csv'
+        convert(input_name, output_name)
+
+    return 0
+
+#-------------------------------------------------------------------------------
+
+if __name__ == '__main__':
+
+    retval = main(sys.argv[1:], None)
+
+    sys.exit(retval)
+
+#-------------------------------------------------------------------------------
+# End
+#-------------------------------------------------------------------------------
@@ -67,6 +67,7 @@
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
 #include "cs_parameters.h"
+#include "cs_perf_summary.h"
 #include "cs_prototypes.h"
 #include "cs_timer.h"
 #include "cs_timer_stats.h"
@@ -352,6 +353,10 @@ cs_balance_scalar(int                         idtvar,
 
   if (_balance_stat_id > -1)
     cs_timer_stats_add_diff(_balance_stat_id, &t0, &t1);
+
+  if (f_id > -1)
+    cs_perf_summary_add_diff(cs_field_by_id(f_id)->name,
+                             CS_PERF_SUMMARY_RHS_ASSEMBLY, &t0, &t1);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -586,6 +591,10 @@ cs_balance_vector(int                         idtvar,
 
   if (_balance_stat_id > -1)
     cs_timer_stats_add_diff(_balance_stat_id, &t0, &t1);
+
+  if (f_id > -1)
+    cs_perf_summary_add_diff(cs_field_by_id(f_id)->name,
+                             CS_PERF_SUMMARY_RHS_ASSEMBLY, &t0, &t1);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -768,6 +777,10 @@ cs_balance_tensor(int                         idtvar,
 
   if (_balance_stat_id > -1)
     cs_timer_stats_add_diff(_balance_stat_id, &t0, &t1);
+
+  if (f_id > -1)
+    cs_perf_summary_add_diff(cs_field_by_id(f_id)->name,
+                             CS_PERF_SUMMARY_RHS_ASSEMBLY, &t0, &t1);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -48,7 +48,9 @@
 
 #include "fvm_writer.h"
 
+#include "cs_array.h"
 #include "cs_base.h"
+#include "cs_base_accel.h"
 #include "cs_boundary_conditions.h"
 #include "cs_convection_diffusion.h"
 #include "cs_convection_diffusion_priv.h"
@@ -801,7 +803,7 @@ cs_balance_by_zone_compute(const char      *scalar_name,
 
   /* Parallel or device dispatch */
   cs_dispatch_context ctx;
-  ctx.set_use_gpu(false);  /* balance_by_zone case not ported to GPU */
+  ctx.set_use_gpu(false);  /* face-based terms not ported to GPU */
 
   /* initialize output */
 
@@ -850,17 +852,13 @@ cs_balance_by_zone_compute(const char      *scalar_name,
       cpro_cp = CS_F_(cp)->val;
     else {
       const double cp0 = cs_glob_fluid_properties->cp0;
-      BFT_MALLOC(cpro_cp, n_cells, cs_real_t);
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        cpro_cp[c_id] = cp0;
-      }
+      CS_MALLOC_HD(cpro_cp, n_cells, cs_real_t, ctx.alloc_mode());
+      cs_array_real_set_scalar(n_cells, cp0, cpro_cp);
     }
   }
   else {
-    BFT_MALLOC(cpro_cp, n_cells, cs_real_t);
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      cpro_cp[c_id] = 1.;
-    }
+    CS_MALLOC_HD(cpro_cp, n_cells, cs_real_t, ctx.alloc_mode());
+    cs_array_real_set_scalar(n_cells, 1., cpro_cp);
   }
 
   /* Internal coupling initialization*/
@@ -1197,17 +1195,28 @@ cs_balance_by_zone_compute(const char      *scalar_name,
         total quantity on interior volumes
         ---------------------------------- */
 
-  for (cs_lnum_t c_id = 0; c_id < n_cells_sel; c_id++) {
-
-    cs_lnum_t c_id_sel = cell_sel_ids[c_id];
-
-    vol_balance += cell_vol[c_id_sel] * rho[c_id_sel]
-                 * cpro_cp[c_id_sel]
-                 * (f->val_pre[c_id_sel] - f->val[c_id_sel]);
-
-    cs_real_t rho_y_dt =  rho[c_id_sel] * cpro_cp[c_id_sel]
-                        * f->val_pre[c_id_sel] * dt[c_id_sel];
-    tot_vol_balance2 += cell_vol[c_id_sel] * rho_y_dt * rho_y_dt;
+  {
+    const cs_real_t *f_val = f->val;
+    const cs_real_t *f_val_pre = f->val_pre;
+
+    ctx.parallel_for_reduce_sum
+      (n_cells_sel, vol_balance, [=] CS_F_HOST_DEVICE
+       (cs_lnum_t c_id, CS_DISPATCH_SUM_DOUBLE &sum) {
+      cs_lnum_t c_id_sel = cell_sel_ids[c_id];
+      sum += cell_vol[c_id_sel] * rho[c_id_sel] * cpro_cp[c_id_sel]
+             * (f_val_pre[c_id_sel] - f_val[c_id_sel]);
+    });
+
+    ctx.parallel_for_reduce_sum
+      (n_cells_sel, tot_vol_balance2, [=] CS_F_HOST_DEVICE
+       (cs_lnum_t c_id, CS_DISPATCH_SUM_DOUBLE &sum) {
+      cs_lnum_t c_id_sel = cell_sel_ids[c_id];
+      cs_real_t rho_y_dt =  rho[c_id_sel] * cpro_cp[c_id_sel]
+                          * f_val_pre[c_id_sel] * dt[c_id_sel];
+      sum += cell_vol[c_id_sel] * rho_y_dt * rho_y_dt;
+    });
+
+    ctx.wait();
   }
 
   /* Balance on all faces (interior and boundary), for div(rho u)
@@ -1605,7 +1614,7 @@ cs_balance_by_zone_compute(const char      *scalar_name,
   BFT_FREE(courant);
 
   if (!itemperature || icp == -1)
-    BFT_FREE(cpro_cp);
+    CS_FREE_HD(cpro_cp);
   BFT_FREE(c_visc);
   BFT_FREE(i_visc);
   BFT_FREE(b_visc);
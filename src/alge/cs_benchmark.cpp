@@ -32,6 +32,7 @@
 
 #include <chrono>
 
+#include <errno.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -61,7 +62,12 @@
 #include "cs_base.h"
 #include "cs_base_accel.h"
 #include "cs_blas.h"
+#include "cs_boundary_conditions.h"
+#include "cs_convection_diffusion.h"
 #include "cs_dispatch.h"
+#include "cs_field.h"
+#include "cs_field_pointer.h"
+#include "cs_gradient.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
 #include "cs_log.h"
@@ -72,6 +78,10 @@
 #include "cs_matrix_assembler.h"
 #include "cs_matrix_default.h"
 #include "cs_matrix_tuning.h"
+#include "cs_multigrid.h"
+#include "cs_parall.h"
+#include "cs_parameters.h"
+#include "cs_sles.h"
 #include "cs_timer.h"
 
 #if defined(HAVE_HYPRE)
@@ -104,14 +114,31 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Machine-readable results file */
+
+#define _RESULTS_FILE_NAME "benchmark.csv"
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
 
+/* Reference results, for parallel efficiency */
+
+typedef struct {
+
+  int      n_ops;   /* number of operations */
+  char   **name;    /* operation names */
+  double  *cost;    /* time per run multiplied by number of ranks and
+                       divided by number of cells */
+
+} _benchmark_ref_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
 
+static char *_ref_file_name = NULL;
+
 static const char *_matrix_operation_name[CS_MATRIX_N_FILL_TYPES][2]
   = {{"y <- A.x",
       "y <- (A-D).x"},
@@ -1124,12 +1151,520 @@ _matrix_check_asmb(cs_lnum_t              n_rows,
   BFT_FREE(da);
 }
 
+/*----------------------------------------------------------------------------
+ * Load reference results from a previous benchmark results file.
+ *
+ * The reference is only needed on rank 0, and the results file may
+ * come from a run on a different mesh size or number of ranks.
+ *
+ * parameters:
+ *   path <-- path to reference results file
+ *   r    --> reference results
+ *----------------------------------------------------------------------------*/
+
+static void
+_ref_load(const char        *path,
+          _benchmark_ref_t  *r)
+{
+  r->n_ops = 0;
+  r->name = NULL;
+  r->cost = NULL;
+
+  FILE *f = fopen(path, "r");
+  if (f == NULL)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error opening file: \"%s\""), path);
+
+  char line[256];
+
+  /* Skip header */
+
+  if (fgets(line, 256, f) == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Empty benchmark results file: \"%s\""), path);
+
+  while (fgets(line, 256, f) != NULL) {
+
+    char *sep = strchr(line, ',');
+    unsigned long long n_g_cells = 0;
+    int n_ranks = 0, n_runs = 0;
+    double t_mean = 0;
+
+    if (sep == NULL)
+      continue;
+    *sep = '\0';
+    if (   sscanf(sep + 1, "%llu,%d,%d,%lf",
+                  &n_g_cells, &n_ranks, &n_runs, &t_mean) != 4
+        || n_g_cells < 1)
+      continue;
+
+    int i = r->n_ops;
+    r->n_ops += 1;
+    BFT_REALLOC(r->name, r->n_ops, char *);
+    BFT_REALLOC(r->cost, r->n_ops, double);
+
+    BFT_MALLOC(r->name[i], strlen(line) + 1, char);
+    strcpy(r->name[i], line);
+    r->cost[i] = t_mean * n_ranks / n_g_cells;
+
+  }
+
+  if (fclose(f) != 0)
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error closing file: \"%s\""), path);
+}
+
+/*----------------------------------------------------------------------------
+ * Free reference results.
+ *
+ * parameters:
+ *   r <-> reference results
+ *----------------------------------------------------------------------------*/
+
+static void
+_ref_free(_benchmark_ref_t  *r)
+{
+  for (int i = 0; i < r->n_ops; i++)
+    BFT_FREE(r->name[i]);
+  BFT_FREE(r->name);
+  BFT_FREE(r->cost);
+  r->n_ops = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Log and record timing of an operation.
+ *
+ * The time per run is logged with its mean, minimum and maximum over ranks,
+ * and also written to the machine-readable results file on rank 0.
+ *
+ * If reference results are available, the parallel efficiency relative
+ * to the reference is also computed, as the ratio of reference to current
+ * time multiplied by the number of ranks and divided by the number of
+ * cells. This applies both to strong scaling (same mesh) and weak scaling
+ * (same number of cells per rank) studies.
+ *
+ * parameters:
+ *   f      <-> results file, or NULL
+ *   r      <-- reference results, or NULL
+ *   name   <-- operation name
+ *   n_runs <-- number of runs
+ *   wt     <-- wall-clock time for all runs
+ *----------------------------------------------------------------------------*/
+
+static void
+_record(FILE                    *f,
+        const _benchmark_ref_t  *r,
+        const char              *name,
+        int                      n_runs,
+        double                   wt)
+{
+  double t_min = wt / n_runs, t_max = t_min, t_mean = t_min;
+
+  cs_parall_min(1, CS_DOUBLE, &t_min);
+  cs_parall_max(1, CS_DOUBLE, &t_max);
+  cs_parall_sum(1, CS_DOUBLE, &t_mean);
+  t_mean /= cs_glob_n_ranks;
+
+  const cs_gnum_t n_g_cells = cs_glob_mesh->n_g_cells;
+
+  double eff = -1;
+  if (r != NULL && t_mean > 0) {
+    for (int i = 0; i < r->n_ops; i++) {
+      if (strcmp(r->name[i], name) == 0) {
+        eff = r->cost[i] * n_g_cells / (t_mean * cs_glob_n_ranks);
+        break;
+      }
+    }
+  }
+
+  char eff_str[16] = "";
+  if (eff >= 0)
+    snprintf(eff_str, 16, "%.4f", eff);
+
+  if (r != NULL)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-36s %6d %12.5e %12.5e %12.5e %8s\n",
+                  name, n_runs, t_mean, t_min, t_max,
+                  (eff >= 0) ? eff_str : "-");
+  else
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-36s %6d %12.5e %12.5e %12.5e\n",
+                  name, n_runs, t_mean, t_min, t_max);
+
+  if (f != NULL)
+    fprintf(f, "%s,%llu,%d,%d,%.6e,%.6e,%.6e,%s\n",
+            name, (unsigned long long)n_g_cells,
+            cs_glob_n_ranks, n_runs, t_mean, t_min, t_max, eff_str);
+}
+
+/*----------------------------------------------------------------------------
+ * Measure performance of elementary finite volume operators.
+ *
+ * Dot products, halo synchronization, gradients (for all gradient types),
+ * convection-diffusion balance, and multigrid setup and solve are timed
+ * on the current mesh, using homogeneous Neumann boundary conditions.
+ *
+ * parameters:
+ *   n_time_runs <-- number of timing runs for each operation
+ *----------------------------------------------------------------------------*/
+
+static void
+_operators_benchmark(int  n_time_runs)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_lnum_t *b_face_cells = m->b_face_cells;
+
+  const cs_real_3_t *cell_cen = (const cs_real_3_t *)mq->cell_cen;
+  const cs_real_3_t *i_face_normal = (const cs_real_3_t *)mq->i_face_normal;
+  const cs_real_3_t *b_face_normal = (const cs_real_3_t *)mq->b_face_normal;
+
+  /* Reference results are read (and needed) on rank 0 only;
+     they are read before opening the results file, which may
+     have the same name */
+
+  _benchmark_ref_t _ref = {0, NULL, NULL};
+  _benchmark_ref_t *r = NULL;
+
+  if (_ref_file_name != NULL) {
+    if (cs_glob_rank_id < 1)
+      _ref_load(_ref_file_name, &_ref);
+    r = &_ref;
+  }
+
+  FILE *f = NULL;
+  if (cs_glob_rank_id < 1) {
+    f = fopen(_RESULTS_FILE_NAME, "w");
+    if (f == NULL)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error opening file: \"%s\""), _RESULTS_FILE_NAME);
+    fprintf(f, "operation,n_g_cells,n_ranks,n_runs,"
+            "t_mean,t_min,t_max,efficiency\n");
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "\n"
+                "Timing for elementary operators\n"
+                "===============================\n\n");
+
+  if (r != NULL)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  Efficiency relative to: %s\n\n"
+                  "  %-36s %6s %12s %12s %12s %8s\n",
+                  _ref_file_name,
+                  "operation", "runs", "mean (s)", "min (s)", "max (s)",
+                  "eff.");
+  else
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-36s %6s %12s %12s %12s\n",
+                  "operation", "runs", "mean (s)", "min (s)", "max (s)");
+
+  /* Working arrays */
+
+  cs_real_t *x, *y, *rhs;
+  cs_real_3_t *grad;
+  BFT_MALLOC(x, n_cells_ext, cs_real_t);
+  BFT_MALLOC(y, n_cells_ext, cs_real_t);
+  BFT_MALLOC(rhs, n_cells_ext, cs_real_t);
+  BFT_MALLOC(grad, n_cells_ext, cs_real_3_t);
+
+  for (cs_lnum_t i = 0; i < n_cells_ext; i++) {
+    x[i] = cell_cen[i][0] + 2.*cell_cen[i][1] - cell_cen[i][2];
+    y[i] = 1.;
+  }
+
+  /* Homogeneous Neumann boundary conditions */
+
+  cs_field_bc_coeffs_t bc_coeffs;
+  cs_field_bc_coeffs_init(&bc_coeffs);
+
+  BFT_MALLOC(bc_coeffs.a, n_b_faces, cs_real_t);
+  BFT_MALLOC(bc_coeffs.b, n_b_faces, cs_real_t);
+  BFT_MALLOC(bc_coeffs.af, n_b_faces, cs_real_t);
+  BFT_MALLOC(bc_coeffs.bf, n_b_faces, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+    bc_coeffs.a[i] = 0.;
+    bc_coeffs.b[i] = 1.;
+    bc_coeffs.af[i] = 0.;
+    bc_coeffs.bf[i] = 0.;
+  }
+
+  /* Boundary condition types are not defined in benchmark mode,
+     so use walls if needed */
+
+  int *bc_type = NULL;
+  if (cs_glob_bc_type == NULL) {
+    BFT_MALLOC(bc_type, n_b_faces, int);
+    for (cs_lnum_t i = 0; i < n_b_faces; i++)
+      bc_type[i] = CS_SMOOTHWALL;
+    cs_glob_bc_type = bc_type;
+  }
+
+  double t0, wt;
+  double test_sum = 0.;
+
+  /* Dot products */
+
+  t0 = cs_timer_wtime();
+  for (int run_id = 0; run_id < n_time_runs; run_id++)
+    test_sum += cs_dot(n_cells, x, y);
+  _record(f, r, "local dot product", n_time_runs, cs_timer_wtime() - t0);
+
+  t0 = cs_timer_wtime();
+  for (int run_id = 0; run_id < n_time_runs; run_id++)
+    test_sum += cs_gdot(n_cells, x, y);
+  _record(f, r, "global dot product", n_time_runs, cs_timer_wtime() - t0);
+
+  /* Halo synchronization */
+
+  int have_halo = (m->halo != NULL) ? 1 : 0;
+  cs_parall_max(1, CS_INT_TYPE, &have_halo);
+
+  if (have_halo) {
+    t0 = cs_timer_wtime();
+    for (int run_id = 0; run_id < n_time_runs; run_id++) {
+      if (m->halo != NULL)
+        cs_halo_sync_var(m->halo, CS_HALO_STANDARD, x);
+    }
+    _record(f, r, "halo synchronization", n_time_runs,
+            cs_timer_wtime() - t0);
+  }
+
+  /* Gradients */
+
+  const cs_gradient_type_t gradient_type[]
+    = {CS_GRADIENT_GREEN_ITER, CS_GRADIENT_LSQ, CS_GRADIENT_GREEN_LSQ,
+       CS_GRADIENT_GREEN_VTX, CS_GRADIENT_GREEN_R};
+  const char *gradient_name[]
+    = {"gradient (green_iter)", "gradient (lsq)", "gradient (green_lsq)",
+       "gradient (green_vtx)", "gradient (green_r)"};
+
+  for (int g_id = 0; g_id < 5; g_id++) {
+
+    /* First call outside timing, to build cached quantities */
+
+    for (int run_id = -1; run_id < n_time_runs; run_id++) {
+      if (run_id == 0)
+        t0 = cs_timer_wtime();
+      cs_gradient_scalar("benchmark",
+                         gradient_type[g_id],
+                         CS_HALO_STANDARD,
+                         1,       /* inc */
+                         100,     /* n_r_sweeps */
+                         0,       /* hyd_p_flag */
+                         1,       /* w_stride */
+                         0,       /* verbosity */
+                         CS_GRADIENT_LIMIT_NONE,
+                         1e-5,    /* epsilon */
+                         1.5,     /* clip_coeff */
+                         NULL,    /* f_ext */
+                         &bc_coeffs,
+                         x,
+                         NULL,    /* c_weight */
+                         NULL,    /* cpl */
+                         grad);
+    }
+    wt = cs_timer_wtime() - t0;
+    test_sum += grad[0][0];
+
+    _record(f, r, gradient_name[g_id], n_time_runs, wt);
+
+  }
+
+  /* Convection-diffusion balance (centered scheme with reconstruction) */
+
+  {
+    cs_field_pointer_ensure_init();
+
+    cs_real_t *i_massflux, *b_massflux, *i_visc, *b_visc;
+    BFT_MALLOC(i_massflux, n_i_faces, cs_real_t);
+    BFT_MALLOC(b_massflux, n_b_faces, cs_real_t);
+    BFT_MALLOC(i_visc, n_i_faces, cs_real_t);
+    BFT_MALLOC(b_visc, n_b_faces, cs_real_t);
+
+    for (cs_lnum_t i = 0; i < n_i_faces; i++) {
+      i_massflux[i] = i_face_normal[i][0];
+      i_visc[i] = mq->i_face_surf[i];
+    }
+    for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+      b_massflux[i] = 0.;
+      b_visc[i] = 0.;
+    }
+
+    cs_equation_param_t eqp = cs_parameters_equation_param_default();
+    eqp.iconv = 1;
+    eqp.idiff = 1;
+    eqp.ischcv = 1;
+    eqp.blencv = 1.;
+    eqp.nswrgr = 1;
+    eqp.imrgra = 0;
+    eqp.ircflu = 1;
+
+    t0 = cs_timer_wtime();
+    for (int run_id = 0; run_id < n_time_runs; run_id++) {
+      for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+        rhs[i] = 0.;
+      cs_convection_diffusion_scalar(0,       /* idtvar */
+                                     -1,      /* f_id */
+                                     eqp,
+                                     0,       /* icvflb */
+                                     1,       /* inc */
+                                     1,       /* imasac */
+                                     x,
+                                     x,
+                                     NULL,    /* icvfli */
+                                     &bc_coeffs,
+                                     i_massflux,
+                                     b_massflux,
+                                     i_visc,
+                                     b_visc,
+                                     rhs);
+    }
+    wt = cs_timer_wtime() - t0;
+    test_sum += rhs[0];
+
+    _record(f, r, "convection-diffusion balance", n_time_runs, wt);
+
+    BFT_FREE(b_visc);
+    BFT_FREE(i_visc);
+    BFT_FREE(b_massflux);
+    BFT_FREE(i_massflux);
+  }
+
+  /* Multigrid setup and solve (Laplacian with Dirichlet boundaries) */
+
+  {
+    cs_real_t *da, *xa;
+    BFT_MALLOC(da, n_cells_ext, cs_real_t);
+    BFT_MALLOC(xa, n_i_faces, cs_real_t);
+
+    for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+      da[i] = 0.;
+    for (cs_lnum_t i = 0; i < n_i_faces; i++) {
+      xa[i] = -1.;
+      da[i_face_cells[i][0]] += 1.;
+      da[i_face_cells[i][1]] += 1.;
+    }
+    for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+      if (b_face_normal[i][0] < 0)
+        da[b_face_cells[i]] += 2.;
+    }
+
+    cs_matrix_t *a = cs_matrix_msr(true, 1, 1);
+    cs_matrix_set_coefficients(a, true, 1, 1, n_i_faces, i_face_cells,
+                               da, xa);
+
+    const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+    if (ma->cell_i_faces == NULL)
+      cs_mesh_adjacencies_update_cell_i_faces();
+
+    cs_matrix_set_mesh_association(a,
+                                   ma->cell_cells_idx,
+                                   ma->cell_i_faces,
+                                   ma->cell_i_faces_sgn,
+                                   cell_cen,
+                                   (const cs_real_t *)mq->cell_vol,
+                                   i_face_normal);
+
+    const char sles_name[] = "benchmark_multigrid";
+    cs_multigrid_define(-1, sles_name, CS_MULTIGRID_V_CYCLE);
+    cs_sles_t *sles = cs_sles_find_or_add(-1, sles_name);
+
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      rhs[i] = mq->cell_vol[i];
+
+    double r_norm = sqrt(cs_gdot(n_cells, rhs, rhs));
+    int n_iter = 0;
+    double residual = 0.;
+
+    int n_mg_runs = CS_MAX(n_time_runs / 10, 1);
+    double wt_setup = 0., wt_solve = 0.;
+
+    for (int run_id = 0; run_id < n_mg_runs; run_id++) {
+      for (cs_lnum_t i = 0; i < n_cells_ext; i++)
+        y[i] = 0.;
+      t0 = cs_timer_wtime();
+      cs_sles_setup(sles, a);
+      double t1 = cs_timer_wtime();
+      cs_sles_solve(sles, a, 1e-8, r_norm, &n_iter, &residual,
+                    rhs, y, 0, NULL);
+      double t2 = cs_timer_wtime();
+      cs_sles_free(sles);
+      wt_setup += t1 - t0;
+      wt_solve += t2 - t1;
+    }
+
+    _record(f, r, "multigrid setup", n_mg_runs, wt_setup);
+    _record(f, r, "multigrid solve", n_mg_runs, wt_solve);
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  (multigrid iterations: %d)\n", n_iter);
+
+    cs_matrix_release_coefficients(a);
+
+    BFT_FREE(xa);
+    BFT_FREE(da);
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                "  (test sum: %12.5g)\n", test_sum);
+
+  if (bc_type != NULL) {
+    cs_glob_bc_type = NULL;
+    BFT_FREE(bc_type);
+  }
+
+  BFT_FREE(bc_coeffs.bf);
+  BFT_FREE(bc_coeffs.af);
+  BFT_FREE(bc_coeffs.b);
+  BFT_FREE(bc_coeffs.a);
+
+  BFT_FREE(grad);
+  BFT_FREE(rhs);
+  BFT_FREE(y);
+  BFT_FREE(x);
+
+  if (f != NULL) {
+    if (fclose(f) != 0)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error closing file: \"%s\""), _RESULTS_FILE_NAME);
+  }
+
+  _ref_free(&_ref);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Define a reference benchmark results file, used to compute the parallel
+ * efficiency of elementary operators.
+ *
+ * parameters:
+ *   path <-- path to reference "benchmark.csv" file, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_benchmark_set_reference(const char  *path)
+{
+  BFT_FREE(_ref_file_name);
+
+  if (path != NULL) {
+    BFT_MALLOC(_ref_file_name, strlen(path) + 1, char);
+    strcpy(_ref_file_name, path);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Run simple benchmarks.
  *
@@ -1267,6 +1802,10 @@ cs_benchmark(int  mpi_trace_mode)
                            x,
                            y);
 
+  /* Time elementary operators */
+
+  _operators_benchmark(n_time_runs);
+
   cs_matrix_finalize();
 
   cs_mesh_adjacencies_finalize();
@@ -1285,6 +1824,8 @@ cs_benchmark(int  mpi_trace_mode)
 
   CS_FREE_HD(da);
   CS_FREE_HD(xa);
+
+  BFT_FREE(_ref_file_name);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -49,6 +49,17 @@ BEGIN_C_DECLS
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Define a reference benchmark results file, used to compute the parallel
+ * efficiency of elementary operators.
+ *
+ * parameters:
+ *   path  --> path to reference "benchmark.csv" file, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_benchmark_set_reference(const char  *path);
+
 /*----------------------------------------------------------------------------
  * Run simple benchmarks.
  *
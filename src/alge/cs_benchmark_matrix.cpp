@@ -688,6 +688,36 @@ _variant_build_list(int                             n_fill_types,
 
   }
 
+  if (type_filter[CS_MATRIX_SELL]) {
+
+    _variant_add("SELL-C-sigma",
+                 NULL,
+                 CS_MATRIX_SELL,
+                 n_fill_types,
+                 fill_types,
+                 op_flag_ae,
+                 "default",
+                 "default",
+                 "default",
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+    _variant_add("SELL-C-sigma, MSR kernel",
+                 NULL,
+                 CS_MATRIX_SELL,
+                 n_fill_types,
+                 fill_types,
+                 op_flag_ae,
+                 "msr",
+                 NULL,
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+  }
+
   n_variants_max = *n_variants;
   BFT_REALLOC(*m_variant, *n_variants, cs_matrix_timing_variant_t);
 }
@@ -1671,6 +1701,7 @@ cs_benchmark_matrix(int                    n_time_runs,
   int  t_id, f_id, v_id, ed_flag;
 
   bool                   type_filter[CS_MATRIX_N_BUILTIN_TYPES] = {true,
+                                                                   true,
                                                                    true,
                                                                    true,
                                                                    true};
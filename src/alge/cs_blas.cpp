@@ -74,6 +74,13 @@ BEGIN_C_DECLS
   \var CS_BLAS_REDUCE_KAHAN
        Reduction based on Kahan's compensated summation, described in
        \cite Kahan:1965
+
+  \var CS_BLAS_REDUCE_REPRODUCIBLE
+       Reduction based on exact fixed-point accumulators, so that results
+       are bitwise identical independently of the number of threads
+       and ranks (see \ref cs_exact_sum.h). Parallel sums of double
+       precision values using \ref cs_parall_sum are also made exact
+       in this mode.
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -1250,6 +1257,384 @@ _cs_gres_kahan(cs_lnum_t         n,
   return dot;
 }
 
+END_C_DECLS /* templates require C++ linkage */
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute sums of n_dots local contributions using exact
+ *        accumulators.
+ *
+ * Since accumulators are summed using integer arithmetic, the result
+ * does not depend on the number of threads or the reduction order.
+ *
+ * \tparam n_dots  number of simultaneous sums
+ * \tparam F       function (or lambda) computing contributions for
+ *                 a given element: f(i, v[n_dots])
+ *
+ * \param[in]   n    number of elements
+ * \param[in]   f    function computing contributions
+ * \param[out]  acc  resulting accumulators (size: n_dots)
+ */
+/*----------------------------------------------------------------------------*/
+
+template <int n_dots, typename F>
+static void
+_dot_exact(cs_lnum_t        n,
+           F                f,
+           cs_exact_sum_t   acc[])
+{
+  for (int k = 0; k < n_dots; k++)
+    cs_exact_sum_init(acc + k);
+
+# pragma omp parallel if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    cs_parall_thread_range(n, sizeof(cs_real_t), &s_id, &e_id);
+
+    cs_exact_sum_t t_acc[n_dots];
+    for (int k = 0; k < n_dots; k++)
+      cs_exact_sum_init(t_acc + k);
+
+    /* Process by chunks small enough that carries need not be
+       propagated inside a chunk, so as to avoid per-element checks */
+
+    for (cs_lnum_t c_id = s_id; c_id < e_id; c_id += CS_EXACT_SUM_MAX_ADD) {
+      cs_lnum_t c_e_id = CS_MIN(e_id, c_id + CS_EXACT_SUM_MAX_ADD);
+
+      for (cs_lnum_t i = c_id; i < c_e_id; i++) {
+        double v[n_dots];
+        f(i, v);
+        for (int k = 0; k < n_dots; k++) {
+          int64_t a[3];
+          int d_id = cs_exact_sum_split(v[k], a);
+          if (d_id >= 0 && d_id < CS_EXACT_SUM_N_DIGITS) {
+            t_acc[k].d[d_id]   += a[0];
+            t_acc[k].d[d_id+1] += a[1];
+            t_acc[k].d[d_id+2] += a[2];
+          }
+          else if (d_id >= CS_EXACT_SUM_N_DIGITS)
+            t_acc[k].nf[d_id - CS_EXACT_SUM_N_DIGITS] += 1;
+        }
+      }
+
+      for (int k = 0; k < n_dots; k++)
+        cs_exact_sum_normalize(t_acc + k);
+    }
+
+#   pragma omp critical
+    {
+      for (int k = 0; k < n_dots; k++)
+        cs_exact_sum_merge(acc + k, t_acc + k);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute dot products of n_dots vector pairs using exact
+ *        accumulators.
+ *
+ * \tparam n_dots  number of simultaneous dot products
+ *
+ * \param[in]   n    size of arrays
+ * \param[in]   x    first vector for each product
+ * \param[in]   y    second vector for each product
+ * \param[out]  acc  resulting accumulators (size: n_dots)
+ */
+/*----------------------------------------------------------------------------*/
+
+template <int n_dots>
+static void
+_dot_exact_pairs(cs_lnum_t         n,
+                 const cs_real_t  *x[],
+                 const cs_real_t  *y[],
+                 cs_exact_sum_t    acc[])
+{
+  _dot_exact<n_dots>(n,
+                     [=] (cs_lnum_t i, double v[]) {
+                       for (int k = 0; k < n_dots; k++)
+                         v[k] = x[k][i] * y[k][i];
+                     },
+                     acc);
+}
+
+BEGIN_C_DECLS
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sum exact accumulators on all ranks of the default communicator.
+ *
+ * \param[in]       n    number of accumulators
+ * \param[in, out]  acc  accumulators
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_parall_sum_exact(int              n,
+                  cs_exact_sum_t   acc[])
+{
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    cs_parall_sum_exact_acc(cs_glob_mpi_comm, n, acc);
+#else
+  CS_UNUSED(n);
+  CS_UNUSED(acc);
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the dot product of 2 vectors: x.y
+ *        using exact accumulators.
+ *
+ * \param[in]  n  size of arrays x and y
+ * \param[in]  x  array of floating-point values
+ * \param[in]  y  array of floating-point values
+ *
+ * \return  dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_cs_dot_repro(cs_lnum_t         n,
+              const cs_real_t  *x,
+              const cs_real_t  *y)
+{
+  cs_exact_sum_t acc[1];
+  const cs_real_t *_x[1] = {x}, *_y[1] = {y};
+
+  _dot_exact_pairs<1>(n, _x, _y, acc);
+
+  return cs_exact_sum_to_double(acc);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the dot product of a vector with itself: x.x
+ *        using exact accumulators.
+ *
+ * \param[in]  n  size of array x
+ * \param[in]  x  array of floating-point values
+ *
+ * \return  dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_cs_dot_xx_repro(cs_lnum_t         n,
+                 const cs_real_t  *x)
+{
+  return _cs_dot_repro(n, x, x);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 2 dot products of 2 vectors: x.x, and x.y
+ *        using exact accumulators.
+ *
+ * \param[in]   n   size of arrays x and y
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[out]  xx  x.x dot product
+ * \param[out]  xy  x.y dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xx_xy_repro(cs_lnum_t                    n,
+                    const cs_real_t  *restrict   x,
+                    const cs_real_t  *restrict   y,
+                    double                      *xx,
+                    double                      *xy)
+{
+  cs_exact_sum_t acc[2];
+  const cs_real_t *_x[2] = {x, x}, *_y[2] = {x, y};
+
+  _dot_exact_pairs<2>(n, _x, _y, acc);
+
+  *xx = cs_exact_sum_to_double(acc);
+  *xy = cs_exact_sum_to_double(acc + 1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 2 dot products of 3 vectors: x.y, and y.z
+ *        using exact accumulators.
+ *
+ * \param[in]   n   size of arrays x and y
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xy  x.y dot product
+ * \param[out]  yz  y.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xy_yz_repro(cs_lnum_t                    n,
+                    const cs_real_t  *restrict   x,
+                    const cs_real_t  *restrict   y,
+                    const cs_real_t  *restrict   z,
+                    double                      *xy,
+                    double                      *yz)
+{
+  cs_exact_sum_t acc[2];
+  const cs_real_t *_x[2] = {x, y}, *_y[2] = {y, z};
+
+  _dot_exact_pairs<2>(n, _x, _y, acc);
+
+  *xy = cs_exact_sum_to_double(acc);
+  *yz = cs_exact_sum_to_double(acc + 1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 3 dot products of 3 vectors: x.x, x.y, and y.z
+ *        using exact accumulators.
+ *
+ * \param[in]   n   size of arrays x and y
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xx  x.x dot product
+ * \param[out]  xy  x.y dot product
+ * \param[out]  yz  y.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xx_xy_yz_repro(cs_lnum_t                    n,
+                       const cs_real_t  *restrict   x,
+                       const cs_real_t  *restrict   y,
+                       const cs_real_t  *restrict   z,
+                       double                      *xx,
+                       double                      *xy,
+                       double                      *yz)
+{
+  cs_exact_sum_t acc[3];
+  const cs_real_t *_x[3] = {x, x, y}, *_y[3] = {x, y, z};
+
+  _dot_exact_pairs<3>(n, _x, _y, acc);
+
+  *xx = cs_exact_sum_to_double(acc);
+  *xy = cs_exact_sum_to_double(acc + 1);
+  *yz = cs_exact_sum_to_double(acc + 2);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return 5 dot products of 3 vectors: x.x, y.y, x.y, x.z, and y.z
+ *        using exact accumulators.
+ *
+ * \param[in]   n   size of arrays x and y
+ * \param[in]   x   array of floating-point values
+ * \param[in]   y   array of floating-point values
+ * \param[in]   z   array of floating-point values
+ * \param[out]  xx  x.x dot product
+ * \param[out]  yy  y.y dot product
+ * \param[out]  xy  x.y dot product
+ * \param[out]  xz  x.z dot product
+ * \param[out]  yz  y.z dot product
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cs_dot_xx_yy_xy_xz_yz_repro(cs_lnum_t                    n,
+                             const cs_real_t  *restrict   x,
+                             const cs_real_t  *restrict   y,
+                             const cs_real_t  *restrict   z,
+                             double                      *xx,
+                             double                      *yy,
+                             double                      *xy,
+                             double                      *xz,
+                             double                      *yz)
+{
+  cs_exact_sum_t acc[5];
+  const cs_real_t *_x[5] = {x, y, x, x, y}, *_y[5] = {x, y, y, z, z};
+
+  _dot_exact_pairs<5>(n, _x, _y, acc);
+
+  *xx = cs_exact_sum_to_double(acc);
+  *yy = cs_exact_sum_to_double(acc + 1);
+  *xy = cs_exact_sum_to_double(acc + 2);
+  *xz = cs_exact_sum_to_double(acc + 3);
+  *yz = cs_exact_sum_to_double(acc + 4);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the global residual of 2 intensive vectors:
+ *        1/sum(vol) . sum(x.y.vol)
+ *        using exact accumulators.
+ *
+ * In parallel mode, the local accumulators are summed on the default
+ * global communicator, so the result does not depend on the partitioning.
+ *
+ * \param[in]  n    size of arrays x and y
+ * \param[in]  vol  array of floating-point values
+ * \param[in]  x    array of floating-point values
+ * \param[in]  y    array of floating-point values
+ *
+ * \return  global residual
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_cs_gres_repro(cs_lnum_t         n,
+               const cs_real_t  *vol,
+               const cs_real_t  *x,
+               const cs_real_t  *y)
+{
+  cs_exact_sum_t acc[2];
+
+  _dot_exact<2>(n,
+                [=] (cs_lnum_t i, double v[]) {
+                  v[0] = x[i] * y[i] * vol[i];
+                  v[1] = vol[i];
+                },
+                acc);
+
+  _parall_sum_exact(2, acc);
+
+  return cs_exact_sum_to_double(acc) / cs_exact_sum_to_double(acc + 1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the global spatial mean of an intensive vector:
+ *        1/sum(vol) . sum(x.vol)
+ *        using exact accumulators.
+ *
+ * In parallel mode, the local accumulators are summed on the default
+ * global communicator, so the result does not depend on the partitioning.
+ *
+ * \param[in]  n    size of arrays x
+ * \param[in]  vol  array of floating-point values
+ * \param[in]  x    array of floating-point values
+ *
+ * \return  global mean
+ */
+/*----------------------------------------------------------------------------*/
+
+static double
+_cs_gmean_repro(cs_lnum_t         n,
+                const cs_real_t  *vol,
+                const cs_real_t  *x)
+{
+  cs_exact_sum_t acc[2];
+
+  _dot_exact<2>(n,
+                [=] (cs_lnum_t i, double v[]) {
+                  v[0] = x[i] * vol[i];
+                  v[1] = vol[i];
+                },
+                acc);
+
+  _parall_sum_exact(2, acc);
+
+  return cs_exact_sum_to_double(acc) / cs_exact_sum_to_double(acc + 1);
+}
+
 /*============================================================================
  * Static global function pointers
  *============================================================================*/
@@ -1266,6 +1651,8 @@ static cs_dot_xx_yy_xy_xz_yz_t  *_cs_glob_dot_xx_yy_xy_xz_yz
 static cs_gres_t      *_cs_glob_gres      = _cs_gres_superblock;
 static cs_dot_t *_cs_glob_gmean = _cs_gmean_superblock;
 
+static cs_blas_reduce_t  _cs_glob_reduce_mode = CS_BLAS_REDUCE_SUPERBLOCK;
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1304,6 +1691,11 @@ cs_blas_library_info(cs_log_t  log_type)
  * This may not be enforced for all algorithms, though it should at least
  * be enforced for the most general functions such as \ref cs_dot.
  *
+ * Selecting \ref CS_BLAS_REDUCE_REPRODUCIBLE also sets
+ * \ref cs_glob_parall_exact_sum, so that parallel sums of double
+ * precision values are also independent of the reduction order;
+ * selecting another mode unsets it.
+ *
  * \param[in]  mode   BLAS mode to use
  */
 /*----------------------------------------------------------------------------*/
@@ -1321,6 +1713,7 @@ cs_blas_set_reduce_algorithm(cs_blas_reduce_t  mode)
         _cs_glob_dot_xx_xy_yz = _cs_dot_xx_xy_yz_superblock;
         _cs_glob_dot_xx_yy_xy_xz_yz = _cs_dot_xx_yy_xy_xz_yz_superblock;
         _cs_glob_gres = _cs_gres_superblock;
+        _cs_glob_gmean = _cs_gmean_superblock;
       }
       break;
     case CS_BLAS_REDUCE_KAHAN:
@@ -1332,9 +1725,39 @@ cs_blas_set_reduce_algorithm(cs_blas_reduce_t  mode)
         _cs_glob_dot_xx_xy_yz = _cs_dot_xx_xy_yz_kahan;
         _cs_glob_dot_xx_yy_xy_xz_yz = _cs_dot_xx_yy_xy_xz_yz_kahan;
         _cs_glob_gres = _cs_gres_kahan;
+        _cs_glob_gmean = _cs_gmean_superblock;
+      }
+      break;
+    case CS_BLAS_REDUCE_REPRODUCIBLE:
+      {
+        _cs_glob_dot    = _cs_dot_repro;
+        _cs_glob_dot_xx = _cs_dot_xx_repro;
+        _cs_glob_dot_xx_xy = _cs_dot_xx_xy_repro;
+        _cs_glob_dot_xy_yz = _cs_dot_xy_yz_repro;
+        _cs_glob_dot_xx_xy_yz = _cs_dot_xx_xy_yz_repro;
+        _cs_glob_dot_xx_yy_xy_xz_yz = _cs_dot_xx_yy_xy_xz_yz_repro;
+        _cs_glob_gres = _cs_gres_repro;
+        _cs_glob_gmean = _cs_gmean_repro;
       }
       break;
   }
+
+  _cs_glob_reduce_mode = mode;
+  cs_glob_parall_exact_sum = (mode == CS_BLAS_REDUCE_REPRODUCIBLE);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the current BLAS reduction algorithm family.
+ *
+ * \return  current reduction algorithm family
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_blas_reduce_t
+cs_blas_get_reduce_algorithm(void)
+{
+  return _cs_glob_reduce_mode;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1384,6 +1807,12 @@ double
 cs_sum(cs_lnum_t         n,
        const cs_real_t  *x)
 {
+  if (_cs_glob_reduce_mode == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    cs_exact_sum_t acc[1];
+    _dot_exact<1>(n, [=] (cs_lnum_t i, double v[]) {v[0] = x[i];}, acc);
+    return cs_exact_sum_to_double(acc);
+  }
+
   double sum = 0.0;
 
 # pragma omp parallel reduction(+:sum) if (n > CS_THR_MIN)
@@ -1439,6 +1868,13 @@ cs_weighted_sum(cs_lnum_t         n,
                 const cs_real_t  *w,
                 const cs_real_t  *x)
 {
+  if (_cs_glob_reduce_mode == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    const cs_real_t *_x[1] = {x}, *_w[1] = {w};
+    cs_exact_sum_t acc[1];
+    _dot_exact_pairs<1>(n, _w, _x, acc);
+    return cs_exact_sum_to_double(acc);
+  }
+
   double wsum = 0.0;
 
 # pragma omp parallel reduction(+:wsum) if (n > CS_THR_MIN)
@@ -1694,6 +2130,53 @@ cs_dot_xx_yy_xy_xz_yz(cs_lnum_t                    n,
   _cs_glob_dot_xx_yy_xy_xz_yz(n, x, y, z, xx, yy, xy, xz, yz);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute several dot products of vector pairs: x[k].y[k]
+ *        using exact (order-independent) accumulators.
+ *
+ * No parallel reduction is done here; accumulators may be summed across
+ * ranks using \ref cs_parall_sum_exact_acc, and converted to double
+ * precision values using \ref cs_exact_sum_to_double.
+ *
+ * \param[in]   n        size of arrays
+ * \param[in]   n_pairs  number of dot products
+ * \param[in]   x        first vector for each product (size: n_pairs)
+ * \param[in]   y        second vector for each product (size: n_pairs)
+ * \param[out]  acc      associated accumulators (size: n_pairs)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_dot_exact(cs_lnum_t         n,
+             int               n_pairs,
+             const cs_real_t  *x[],
+             const cs_real_t  *y[],
+             cs_exact_sum_t    acc[])
+{
+  /* Process pairs by packets of at most 5 */
+
+  for (int s_id = 0; s_id < n_pairs; s_id += 5) {
+    int n_p = CS_MIN(n_pairs - s_id, 5);
+    switch(n_p) {
+    case 1:
+      _dot_exact_pairs<1>(n, x + s_id, y + s_id, acc + s_id);
+      break;
+    case 2:
+      _dot_exact_pairs<2>(n, x + s_id, y + s_id, acc + s_id);
+      break;
+    case 3:
+      _dot_exact_pairs<3>(n, x + s_id, y + s_id, acc + s_id);
+      break;
+    case 4:
+      _dot_exact_pairs<4>(n, x + s_id, y + s_id, acc + s_id);
+      break;
+    default:
+      _dot_exact_pairs<5>(n, x + s_id, y + s_id, acc + s_id);
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return the global dot product of 2 vectors: x.y
@@ -1716,6 +2199,13 @@ cs_gdot(cs_lnum_t         n,
         const cs_real_t  *x,
         const cs_real_t  *y)
 {
+  if (_cs_glob_reduce_mode == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    cs_exact_sum_t acc[1];
+    cs_dot_exact(n, 1, &x, &y, acc);
+    _parall_sum_exact(1, acc);
+    return cs_exact_sum_to_double(acc);
+  }
+
   double retval = cs_dot(n, x, y);
 
   cs_parall_sum(1, CS_DOUBLE, &retval);
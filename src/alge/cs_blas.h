@@ -38,6 +38,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_base.h"
+#include "cs_exact_sum.h"
 #include "cs_log.h"
 
 /*----------------------------------------------------------------------------*/
@@ -57,7 +58,8 @@ BEGIN_C_DECLS
 typedef enum {
 
   CS_BLAS_REDUCE_SUPERBLOCK,
-  CS_BLAS_REDUCE_KAHAN
+  CS_BLAS_REDUCE_KAHAN,
+  CS_BLAS_REDUCE_REPRODUCIBLE
 
 } cs_blas_reduce_t;
 
@@ -90,6 +92,17 @@ cs_blas_library_info(cs_log_t  log_type);
 void
 cs_blas_set_reduce_algorithm(cs_blas_reduce_t  mode);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Return the current BLAS reduction algorithm family.
+ *
+ * \return  current reduction algorithm family
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_blas_reduce_t
+cs_blas_get_reduce_algorithm(void);
+
 /*----------------------------------------------------------------------------
  * Constant times a vector plus a vector: y <-- ax + y
  *
@@ -291,6 +304,30 @@ cs_dot_xx_yy_xy_xz_yz(cs_lnum_t         n,
                       double           *xz,
                       double           *yz);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute several dot products of vector pairs: x[k].y[k]
+ *        using exact (order-independent) accumulators.
+ *
+ * No parallel reduction is done here; accumulators may be summed across
+ * ranks using \ref cs_parall_sum_exact_acc, and converted to double
+ * precision values using \ref cs_exact_sum_to_double.
+ *
+ * \param[in]   n        size of arrays
+ * \param[in]   n_pairs  number of dot products
+ * \param[in]   x        first vector for each product (size: n_pairs)
+ * \param[in]   y        second vector for each product (size: n_pairs)
+ * \param[out]  acc      associated accumulators (size: n_pairs)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_dot_exact(cs_lnum_t         n,
+             int               n_pairs,
+             const cs_real_t  *x[],
+             const cs_real_t  *y[],
+             cs_exact_sum_t    acc[]);
+
 /*----------------------------------------------------------------------------
  * Return the global dot product of 2 vectors: x.y
  *
@@ -80,6 +80,8 @@ static double  *_r_grid = nullptr;
 static unsigned int  _r_grid_size = 0;
 static unsigned int  _r_tuple_size = 0;
 
+static unsigned long long  *_r_exact = nullptr;
+
 #if defined(HAVE_CUBLAS)
 
 static bool            _prefer_cublas = false;
@@ -164,6 +166,63 @@ _dot_xy_stage_1_of_2(cs_lnum_t    n,
   cs_blas_cuda_block_reduce_sum<blockSize, 1>(stmp, tid, b_res);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute dot product x.y, summing result in an exact accumulator.
+ *
+ * Digits are first summed in shared memory, then in global memory,
+ * using integer atomic operations, so the result does not depend
+ * on the order of operations. As each value contributes at most
+ * 2^32 to a given digit, no carry propagation is needed for n < 2^31.
+ *
+ * \param[in]       n      array size
+ * \param[in]       x      x vector
+ * \param[in]       y      y vector
+ * \param[in, out]  g_acc  accumulator digits, followed by non-finite
+ *                         value counters (zero-initialized)
+ */
+/*----------------------------------------------------------------------------*/
+
+__global__ static void
+_dot_xy_exact(cs_lnum_t             n,
+              const cs_real_t      *x,
+              const cs_real_t      *y,
+              unsigned long long   *g_acc)
+{
+  const int n_acc = CS_EXACT_SUM_N_DIGITS + 3;
+
+  __shared__ unsigned long long s_acc[CS_EXACT_SUM_N_DIGITS + 3];
+
+  for (int j = threadIdx.x; j < n_acc; j += blockDim.x)
+    s_acc[j] = 0;
+
+  __syncthreads();
+
+  size_t grid_size = blockDim.x*gridDim.x;
+
+  for (cs_lnum_t i = blockIdx.x*(blockDim.x) + threadIdx.x;
+       i < n;
+       i += grid_size) {
+    int64_t a[3];
+    int d_id = cs_exact_sum_split(x[i] * y[i], a);
+    if (d_id >= CS_EXACT_SUM_N_DIGITS)
+      atomicAdd(s_acc + d_id, 1ULL);
+    else if (d_id >= 0) {
+      for (int k = 0; k < 3; k++) {
+        if (a[k] != 0)
+          atomicAdd(s_acc + d_id + k, (unsigned long long)a[k]);
+      }
+    }
+  }
+
+  __syncthreads();
+
+  for (int j = threadIdx.x; j < n_acc; j += blockDim.x) {
+    if (s_acc[j] != 0)
+      atomicAdd(g_acc + j, s_acc[j]);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute dot product x.x, summing result over all threads of a block.
@@ -337,6 +396,7 @@ cs_blas_cuda_finalize(void)
 {
   CS_FREE_HD(_r_reduce);
   CS_FREE_HD(_r_grid);
+  CS_FREE_HD(_r_exact);
   _r_grid_size = 0;
 
 #if defined(HAVE_CUBLAS)
@@ -486,6 +546,50 @@ cs_blas_cuda_dot(cs_lnum_t        n,
   return _r_reduce[0];
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the dot product of 2 vectors: x.y using CUDA,
+ *        with an exact (order-independent) accumulator.
+ *
+ * \param[in]   n    size of arrays x and y
+ * \param[in]   x    array of floating-point values (on device)
+ * \param[in]   y    array of floating-point values (on device)
+ * \param[out]  acc  resulting accumulator (on host)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_blas_cuda_dot_exact(cs_lnum_t         n,
+                       const cs_real_t   x[],
+                       const cs_real_t   y[],
+                       cs_exact_sum_t   *acc)
+{
+  const int n_acc = CS_EXACT_SUM_N_DIGITS + 3;
+
+  const unsigned int block_size = 256;
+  unsigned int grid_size = _grid_size(n, block_size);
+
+  if (_r_exact == nullptr)
+    CS_MALLOC_HD(_r_exact, n_acc, unsigned long long,
+                 CS_ALLOC_HOST_DEVICE_SHARED);
+
+  cudaMemsetAsync(_r_exact, 0, n_acc*sizeof(unsigned long long), _stream);
+
+  _dot_xy_exact<<<grid_size, block_size, 0, _stream>>>(n, x, y, _r_exact);
+
+  /* Need to synchronize stream in all cases so as to
+     have up-to-date values in _r_exact */
+
+  cudaStreamSynchronize(_stream);
+
+  cs_exact_sum_init(acc);
+  for (int j = 0; j < CS_EXACT_SUM_N_DIGITS; j++)
+    acc->d[j] = (int64_t)_r_exact[j];
+  for (int j = 0; j < 3; j++)
+    acc->nf[j] = (int64_t)_r_exact[CS_EXACT_SUM_N_DIGITS + j];
+  acc->n_add = 1;
+}
+
 #if defined(HAVE_CUBLAS)
 
 /*----------------------------------------------------------------------------*/
@@ -39,6 +39,7 @@
 
 #include "cs_base.h"
 #include "cs_base_cuda.h"
+#include "cs_exact_sum.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -416,6 +417,24 @@ cs_blas_cuda_dot(cs_lnum_t        n,
                  const cs_real_t  x[],
                  const cs_real_t  y[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the dot product of 2 vectors: x.y using CUDA,
+ *        with an exact (order-independent) accumulator.
+ *
+ * \param[in]   n    size of arrays x and y
+ * \param[in]   x    array of floating-point values (on device)
+ * \param[in]   y    array of floating-point values (on device)
+ * \param[out]  acc  resulting accumulator (on host)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_blas_cuda_dot_exact(cs_lnum_t         n,
+                       const cs_real_t   x[],
+                       const cs_real_t   y[],
+                       cs_exact_sum_t   *acc);
+
 #if defined(HAVE_CUBLAS)
 
 /*----------------------------------------------------------------------------*/
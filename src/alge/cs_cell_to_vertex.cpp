@@ -50,7 +50,9 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_base_accel.h"
 #include "cs_blas.h"
+#include "cs_dispatch.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
 #include "cs_log.h"
@@ -142,7 +144,7 @@ _cell_to_vertex_w_unweighted(int tr_ignore)
 
   cs_weight_t *w = _weights[CS_CELL_TO_VERTEX_UNWEIGHTED][0];
   int *w_sum;
-  BFT_REALLOC(w, n_vertices, cs_weight_t);
+  CS_REALLOC_HD(w, n_vertices, cs_weight_t, cs_alloc_mode_read_mostly);
   BFT_MALLOC(w_sum, n_vertices, int);
 
   _set[CS_CELL_TO_VERTEX_UNWEIGHTED] = true;
@@ -177,6 +179,8 @@ _cell_to_vertex_w_unweighted(int tr_ignore)
   for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++)
     w[v_id] = 1. / w_sum[v_id];
 
+  cs_mem_advise_set_read_mostly(w);
+
   BFT_FREE(w_sum);
 }
 
@@ -209,8 +213,9 @@ _cell_to_vertex_w_inv_distance(int  tr_ignore)
   cs_weight_t *w = _weights[CS_CELL_TO_VERTEX_SHEPARD][0];
   cs_weight_t *wb = _weights[CS_CELL_TO_VERTEX_SHEPARD][1];
   cs_real_t   *w_sum;
-  BFT_REALLOC(w, c2v_idx[n_cells], cs_weight_t);
-  BFT_REALLOC(wb, f2v_idx[n_b_faces], cs_weight_t);
+  CS_REALLOC_HD(w, c2v_idx[n_cells], cs_weight_t, cs_alloc_mode_read_mostly);
+  CS_REALLOC_HD(wb, f2v_idx[n_b_faces], cs_weight_t,
+                cs_alloc_mode_read_mostly);
   BFT_MALLOC(w_sum, n_vertices, cs_real_t);
 
   _set[CS_CELL_TO_VERTEX_SHEPARD] = true;
@@ -302,6 +307,9 @@ _cell_to_vertex_w_inv_distance(int  tr_ignore)
 
   }
 
+  cs_mem_advise_set_read_mostly(w);
+  cs_mem_advise_set_read_mostly(wb);
+
   BFT_FREE(w_sum);
 }
 
@@ -334,7 +342,7 @@ _cell_to_vertex_f_lsq(int  tr_ignore)
   cs_lnum_t  w_size = n_vertices*10;
 
   cs_weight_t *w = _weights[CS_CELL_TO_VERTEX_LR][0];
-  BFT_MALLOC(w, w_size, cs_real_t);
+  CS_REALLOC_HD(w, w_size, cs_weight_t, cs_alloc_mode_read_mostly);
 
   _set[CS_CELL_TO_VERTEX_LR] = true;
   _weights[CS_CELL_TO_VERTEX_LR][0] = w;
@@ -401,6 +409,75 @@ _cell_to_vertex_f_lsq(int  tr_ignore)
 # pragma omp parallel for if(n_vertices > CS_THR_MIN)
   for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++)
     cs_math_sym_44_factor_ldlt(w + v_id*10);
+
+  cs_mem_advise_set_read_mostly(w);
+
+  /* As only the last element of the solution is used for scalars, and it
+     depends linearly on the right-hand side, the contribution of each
+     cell (or boundary face) to its vertices' values may be precomputed. */
+
+  cs_weight_t *wl = _weights[CS_CELL_TO_VERTEX_LR][1];
+  CS_REALLOC_HD(wl, c2v_idx[n_cells] + f2v_idx[n_b_faces], cs_weight_t,
+                cs_alloc_mode_read_mostly);
+  _weights[CS_CELL_TO_VERTEX_LR][1] = wl;
+
+  cs_weight_t *wlb = wl + c2v_idx[n_cells];
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_real_t *c_coo = mq->cell_cen + c_id*3;
+    cs_lnum_t s_id = c2v_idx[c_id];
+    cs_lnum_t e_id = c2v_idx[c_id+1];
+    for (cs_lnum_t j = s_id; j < e_id; j++) {
+      cs_lnum_t v_id = c2v_ids[j];
+      const cs_real_t *v_coo = m->vtx_coord + v_id*3;
+      cs_real_t r_coo[4]
+        = {c_coo[0]-v_coo[0], c_coo[1]-v_coo[1], c_coo[2]-v_coo[2], 1.};
+      wl[j] = cs_math_sym_44_partial_solve_ldlt(w + v_id*10, r_coo);
+    }
+  }
+
+# pragma omp parallel for if(n_b_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    const cs_real_t *f_coo = mq->b_face_cog + f_id*3;
+    cs_lnum_t s_id = f2v_idx[f_id];
+    cs_lnum_t e_id = f2v_idx[f_id+1];
+    for (cs_lnum_t j = s_id; j < e_id; j++) {
+      cs_lnum_t v_id = f2v_ids[j];
+      const cs_real_t *v_coo = m->vtx_coord + v_id*3;
+      cs_real_t r_coo[4]
+        = {f_coo[0]-v_coo[0], f_coo[1]-v_coo[1], f_coo[2]-v_coo[2], 1.};
+      wlb[j] = cs_math_sym_44_partial_solve_ldlt(w + v_id*10, r_coo);
+    }
+  }
+
+  cs_mem_advise_set_read_mostly(wl);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if the connectivity used for cell to vertex interpolation
+ *         is available on device.
+ *
+ * \param[in]  c2v  cell to vertex adjacency
+ *
+ * \return  true if all required connectivity arrays are device-accessible
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_connect_on_device(const cs_adjacency_t  *c2v)
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+
+  if (   cs_check_device_ptr(c2v->idx) == CS_ALLOC_HOST
+      || cs_check_device_ptr(c2v->ids) == CS_ALLOC_HOST
+      || cs_check_device_ptr(m->b_face_vtx_idx) == CS_ALLOC_HOST
+      || cs_check_device_ptr(m->b_face_vtx_lst) == CS_ALLOC_HOST
+      || cs_check_device_ptr(m->b_face_cells) == CS_ALLOC_HOST)
+    return false;
+
+  return true;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -430,7 +507,6 @@ _cell_to_vertex_scalar(cs_cell_to_vertex_type_t method,
   CS_UNUSED(verbosity);
 
   const cs_mesh_t  *m = cs_glob_mesh;
-  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
   const cs_adjacency_t  *c2v = cs_mesh_adjacencies_cell_vertices();
 
   const cs_lnum_t n_vertices = m->n_vertices;
@@ -443,9 +519,11 @@ _cell_to_vertex_scalar(cs_cell_to_vertex_type_t method,
   const cs_lnum_t *f2v_idx = m->b_face_vtx_idx;
   const cs_lnum_t *f2v_ids = m->b_face_vtx_lst;
 
-# pragma omp parallel for if(n_vertices > CS_THR_MIN)
-  for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++)
-    v_var[v_id] = 0;
+  if (method != CS_CELL_TO_VERTEX_LR) {
+#   pragma omp parallel for if(n_vertices > CS_THR_MIN)
+    for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++)
+      v_var[v_id] = 0;
+  }
 
   switch(method) {
 
@@ -641,89 +719,67 @@ _cell_to_vertex_scalar(cs_cell_to_vertex_type_t method,
       if (! _set[CS_CELL_TO_VERTEX_LR])
         _cell_to_vertex_f_lsq(tr_ignore);
 
-      cs_real_t  *rhs;
-      cs_lnum_t  rhs_size = n_vertices*4;
-      BFT_MALLOC(rhs, rhs_size, cs_real_t);
-      for (cs_lnum_t i = 0; i < rhs_size; i++)
-        rhs[i] = 0;
+      /* Run on device when all arrays are accessible there; the
+         interpolation weights are kept there between calls. */
 
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        const cs_real_t *c_coo = mq->cell_cen + c_id*3;
-        cs_real_t _c_var = c_var[c_id];
-        cs_lnum_t s_id = c2v_idx[c_id];
-        cs_lnum_t e_id = c2v_idx[c_id+1];
-        for (cs_lnum_t j = s_id; j < e_id; j++) {
-          cs_lnum_t v_id = c2v_ids[j];
-          const cs_real_t *v_coo = m->vtx_coord + v_id*3;
-          cs_real_t r_coo[3]
-            = {c_coo[0]-v_coo[0], c_coo[1]-v_coo[1], c_coo[2]-v_coo[2]};
-          cs_real_t  *_rhs = rhs + v_id*4;
-          _rhs[0] += r_coo[0] * _c_var;
-          _rhs[1] += r_coo[1] * _c_var;
-          _rhs[2] += r_coo[2] * _c_var;
-          _rhs[3] += c_var[c_id];
-        }
-      }
+      cs_dispatch_context ctx;
 
-      if (b_var == nullptr) {
-        for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-          const cs_real_t *f_coo = mq->b_face_cog + f_id*3;
-          cs_lnum_t c_id = m->b_face_cells[f_id];
-          cs_real_t _b_var = c_var[c_id];
-          cs_lnum_t s_id = f2v_idx[f_id];
-          cs_lnum_t e_id = f2v_idx[f_id+1];
-          for (cs_lnum_t j = s_id; j < e_id; j++) {
-            cs_lnum_t v_id = f2v_ids[j];
-            const cs_real_t *v_coo = m->vtx_coord + v_id*3;
-            cs_real_t r_coo[3]
-              = {f_coo[0]-v_coo[0], f_coo[1]-v_coo[1], f_coo[2]-v_coo[2]};
-            cs_real_t  *_rhs = rhs + v_id*4;
-            _rhs[0] += r_coo[0] * _b_var;
-            _rhs[1] += r_coo[1] * _b_var;
-            _rhs[2] += r_coo[2] * _b_var;
-            _rhs[3] += _b_var;
-          }
-        }
-      }
-      else {
-        for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
-          const cs_real_t *f_coo = mq->b_face_cog + f_id*3;
-          cs_real_t _b_var = b_var[f_id];
-          cs_lnum_t s_id = f2v_idx[f_id];
-          cs_lnum_t e_id = f2v_idx[f_id+1];
-          for (cs_lnum_t j = s_id; j < e_id; j++) {
-            cs_lnum_t v_id = f2v_ids[j];
-            const cs_real_t *v_coo = m->vtx_coord + v_id*3;
-            cs_real_t r_coo[3]
-              = {f_coo[0]-v_coo[0], f_coo[1]-v_coo[1], f_coo[2]-v_coo[2]};
-            cs_real_t  *_rhs = rhs + v_id*4;
-            _rhs[0] += r_coo[0] * _b_var;
-            _rhs[1] += r_coo[1] * _b_var;
-            _rhs[2] += r_coo[2] * _b_var;
-            _rhs[3] += _b_var;
-          }
-        }
+      if (   _connect_on_device(c2v) == false
+          || cs_check_device_ptr(c_var) == CS_ALLOC_HOST
+          || cs_check_device_ptr(v_var) == CS_ALLOC_HOST
+          || (b_var != nullptr && cs_check_device_ptr(b_var) == CS_ALLOC_HOST))
+        ctx.set_use_gpu(false);
+
+      const cs_lnum_t *b_face_cells = m->b_face_cells;
+      const cs_weight_t *w = _weights[CS_CELL_TO_VERTEX_LR][1];
+      const cs_weight_t *wb = w + c2v_idx[n_cells];
+
+      ctx.parallel_for(n_vertices, [=] CS_F_HOST_DEVICE (cs_lnum_t v_id) {
+        v_var[v_id] = 0;
+      });
+
+      /* Scatter to vertices uses atomic sums on device; on the host,
+         it remains serial so that results do not depend on threading. */
+
+      cs_dispatch_sum_type_t sum_type = CS_DISPATCH_SUM_ATOMIC;
+      if (ctx.use_gpu() == false) {
+        sum_type = CS_DISPATCH_SUM_SIMPLE;
+        ctx.set_n_min_for_cpu_threads(CS_MAX(n_cells, n_b_faces) + 1);
       }
 
-      if (m->vtx_interfaces != nullptr)
+      ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+        const cs_real_t _c_var = c_var[c_id];
+        const cs_lnum_t s_id = c2v_idx[c_id];
+        const cs_lnum_t e_id = c2v_idx[c_id+1];
+        for (cs_lnum_t j = s_id; j < e_id; j++)
+          cs_dispatch_sum(&v_var[c2v_ids[j]], w[j]*_c_var, sum_type);
+      });
+
+      ctx.parallel_for(n_b_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_id) {
+        const cs_real_t _b_var
+          = (b_var != nullptr) ? b_var[f_id] : c_var[b_face_cells[f_id]];
+        const cs_lnum_t s_id = f2v_idx[f_id];
+        const cs_lnum_t e_id = f2v_idx[f_id+1];
+        for (cs_lnum_t j = s_id; j < e_id; j++)
+          cs_dispatch_sum(&v_var[f2v_ids[j]], wb[j]*_b_var, sum_type);
+      });
+
+      ctx.set_n_min_for_cpu_threads(CS_THR_MIN);
+      ctx.wait();
+
+      if (m->vtx_interfaces != nullptr) {
+        if (ctx.use_gpu())
+          cs_sync_d2h(v_var);
         cs_interface_set_sum_tr(m->vtx_interfaces,
                                 m->n_vertices,
-                                4,
+                                1,
                                 true,
                                 CS_REAL_TYPE,
                                 tr_ignore,
-                                rhs);
-
-      const cs_weight_t *ldlt = _weights[CS_CELL_TO_VERTEX_LR][0];
-
-#     pragma omp parallel for if(n_vertices > CS_THR_MIN)
-      for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
-        const cs_real_t  *_ldlt = ldlt + v_id*10;
-        const cs_real_t  *_rhs = rhs + v_id*4;
-        v_var[v_id] = cs_math_sym_44_partial_solve_ldlt(_ldlt, _rhs);
+                                v_var);
+        if (ctx.use_gpu())
+          cs_sync_h2d(v_var);
       }
-
-      BFT_FREE(rhs);
     }
     break;
   default:
@@ -1106,7 +1162,8 @@ cs_cell_to_vertex_free(void)
 {
   for (int i = 0; i < 3; i++) {
     for (int j = 0; j < 2; j++)
-    BFT_FREE(_weights[i][j]);
+      CS_FREE_HD(_weights[i][j]);
+    _set[i] = false;
   }
 }
 
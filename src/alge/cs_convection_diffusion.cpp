@@ -65,6 +65,7 @@
 #include "cs_internal_coupling.h"
 #include "cs_math.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_field.h"
 #include "cs_field_default.h"
 #include "cs_field_operator.h"
@@ -109,6 +110,16 @@
  * Local type definitions
  *============================================================================*/
 
+/*============================================================================
+ *  Global variables
+ *============================================================================*/
+
+/* Interior faces assembly algorithm by kernel */
+
+static cs_i_faces_assembly_t
+_i_faces_assembly[CS_CONVECTION_DIFFUSION_N_KERNELS]
+  = {CS_I_FACES_ASSEMBLY_SCATTER};
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -138,6 +149,66 @@ _calc_heq(cs_real_t h1,
   return heq;
 }
 
+/*----------------------------------------------------------------------------
+ * Loop over interior faces on the host, overlapping the synchronization
+ * of a cell variable's ghost values with the handling of faces not
+ * adjacent to ghost cells.
+ *
+ * Faces are visited in the same order as with
+ * cs_host_context::parallel_for_i_faces, so results are identical.
+ *
+ * parameters:
+ *   m    <-- pointer to mesh
+ *   hs   <-- halo state of pending synchronization of var
+ *   var  <-> cell variable being synchronized
+ *   f    <-- function applied to each interior face
+ *----------------------------------------------------------------------------*/
+
+template <class F>
+static void
+_i_faces_halo_overlap(const cs_mesh_t  *m,
+                      cs_halo_state_t  *hs,
+                      cs_real_t        *var,
+                      F&&               f)
+{
+  const cs_numbering_t *i_numbering = m->i_face_numbering;
+  const int n_i_groups  = i_numbering->n_groups;
+  const int n_i_threads = i_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = i_numbering->group_index;
+
+  /* Thread groups not adjacent to halo, or faces with a single thread */
+
+  int n_nh_groups = (n_i_threads > 1) ? i_numbering->n_no_adj_halo_groups : 0;
+  cs_lnum_t n_nh_faces
+    = (n_i_threads > 1) ? 0 : i_numbering->n_no_adj_halo_elts;
+
+  for (int pass = 0; pass < 2; pass++) {
+
+    if (pass == 1)
+      cs_halo_sync_wait(m->halo, var, hs);
+
+    int g_s_id = (pass == 0) ? 0 : n_nh_groups;
+    int g_e_id = (pass == 0 && n_i_threads > 1) ? n_nh_groups : n_i_groups;
+
+    for (int g_id = g_s_id; g_id < g_e_id; g_id++) {
+      #pragma omp parallel for if (n_i_threads > 1)
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+        cs_lnum_t s_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+        cs_lnum_t e_id = i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+        if (n_i_threads == 1) {
+          if (pass == 0)
+            e_id = CS_MIN(e_id, n_nh_faces);
+          else
+            s_id = CS_MAX(s_id, n_nh_faces);
+        }
+        for (cs_lnum_t f_id = s_id; f_id < e_id; f_id++)
+          f(f_id);
+      }
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Return the denominator to build the beta blending coefficient of the
  * beta limiter (ensuring preservation of a given min/max pair of values).
@@ -591,6 +662,87 @@ _beta_limiter_num(cs_field_t                 *f,
   ctx.wait();
 }
 
+/*----------------------------------------------------------------------------
+ * Return whether reconstruction gradients of a field should be stored
+ * in single precision in face loops.
+ *
+ * parameters:
+ *   f              <-- pointer to field, or nullptr
+ *
+ * returns:
+ *   true for single precision storage, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_gradient_single_precision(const cs_field_t  *f)
+{
+  if (f == nullptr)
+    return false;
+
+  static int k_id = -1;
+  if (k_id < 0)
+    k_id = cs_field_key_id("gradient_single_precision");
+
+  return (cs_field_get_key_int(f, k_id) > 0) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Switch a cell gradient to the storage type used in face loops.
+ *
+ * For single precision storage, values are copied to a new array and the
+ * initial array is freed, so that face loops move half the bytes.
+ * For double precision storage, the initial array is simply transferred.
+ *
+ * template parameters:
+ *   T             gradient storage type (cs_real_t or float)
+ *
+ * parameters:
+ *   ctx            <-> reference to dispatch context
+ *   n_elts         <-- number of elements
+ *   grad           <-> computed gradient (set to nullptr on exit)
+ *   grad_s         --> gradient in storage type
+ *----------------------------------------------------------------------------*/
+
+template <typename T>
+static void
+_gradient_to_storage(cs_dispatch_context   &ctx,
+                     cs_lnum_t              n_elts,
+                     cs_real_3_t          *&grad,
+                     T                    (**grad_s)[3])
+{
+  typedef T t_3_t[3];
+
+  t_3_t *_grad_s;
+  CS_MALLOC_HD(_grad_s, n_elts, t_3_t, cs_alloc_mode);
+
+  const cs_real_3_t *_grad = grad;
+
+  ctx.parallel_for(n_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    _grad_s[c_id][0] = _grad[c_id][0];
+    _grad_s[c_id][1] = _grad[c_id][1];
+    _grad_s[c_id][2] = _grad[c_id][2];
+  });
+
+  ctx.wait();
+
+  CS_FREE_HD(grad);
+  *grad_s = _grad_s;
+}
+
+template <>
+void
+_gradient_to_storage(cs_dispatch_context   &ctx,
+                     cs_lnum_t              n_elts,
+                     cs_real_3_t          *&grad,
+                     cs_real_t            (**grad_s)[3])
+{
+  CS_UNUSED(ctx);
+  CS_UNUSED(n_elts);
+
+  *grad_s = grad;
+  grad = nullptr;
+}
+
 /*----------------------------------------------------------------------------
  * Synchronize strided gradient ghost cell values.
  *
@@ -2993,109 +3145,73 @@ _face_convection_scalar_steady(const cs_field_t           *f,
   BFT_FREE(courant);
 }
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Add the explicit part of the convection/diffusion terms of a
- * standard transport equation of a scalar field \f$ \varia \f$.
- *
- * More precisely, the right hand side \f$ Rhs \f$ is updated as
- * follows:
- * \f[
- * Rhs = Rhs - \sum_{\fij \in \Facei{\celli}}      \left(
- *        \dot{m}_\ij \left( \varia_\fij - \varia_\celli \right)
- *      - \mu_\fij \gradv_\fij \varia \cdot \vect{S}_\ij  \right)
- * \f]
+/*----------------------------------------------------------------------------
+ * Add interior face contributions of the explicit convection/diffusion
+ * terms of a scalar, with no slope test (or with a beta limiter).
  *
- * Warning:
- * - \f$ Rhs \f$ has already been initialized before calling bilsc2!
- * - mind the sign minus
+ * The convection scheme being a template parameter, branches on it are
+ * resolved at compile time, so the face loop body is specialized for
+ * each scheme.
  *
- * Please refer to the
- * <a href="../../theory.pdf#bilsc2"><b>bilsc2</b></a> section of the
- * theory guide for more informations.
+ * template parameters:
+ *   is_thermal    true for the thermal variable (weighted by xcpp)
+ *   T             gradient storage type (cs_real_t or float)
+ *   ischcp        convection scheme (eqp.ischcv)
  *
- * \param[in]     f             pointer to field
- * \param[in]     eqp           equation parameters
- * \param[in]     icvflb        global indicator of boundary convection flux
- *                               - 0 upwind scheme at all boundary faces
- *                               - 1 imposed flux at some boundary faces
- * \param[in]     inc           indicator
- *                               - 0 when solving an increment
- *                               - 1 otherwise
- * \param[in]     imasac        take mass accumulation into account?
- * \param[in]     pvar          solved variable (current time step)
- * \param[in]     pvara         solved variable (previous time step)
- * \param[in]     icvfli        boundary face indicator array of convection flux
- *                               - 0 upwind scheme
- *                               - 1 imposed flux
- * \param[in]     bc_coeffs     boundary condition structure for the variable
- * \param[in]     i_massflux    mass flux at interior faces
- * \param[in]     b_massflux    mass flux at boundary faces
- * \param[in]     i_visc        \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
- *                               at interior faces for the r.h.s.
- * \param[in]     b_visc        \f$ \mu_\fib \dfrac{S_\fib}{\ipf \centf} \f$
- *                               at border faces for the r.h.s.
- * \param[in]     xcpp          array of specific heat (\f$ C_p \f$), or NULL
- * \param[in,out] rhs           right hand side \f$ \vect{Rhs} \f$
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   ctx            <-> reference to dispatch context
+ *   m              <-- pointer to mesh
+ *   fvq            <-- pointer to finite volume quantities
+ *   eqp            <-- equation parameters
+ *   imasac         <-- take mass accumulation into account?
+ *   limiter_choice <-- NVD limiter type (if ischcp = 4)
+ *   pvar           <-- variable
+ *   grad           <-- reconstruction gradient
+ *   gradup         <-- upwind gradient (if ischcp = 2), or nullptr
+ *   xcpp           <-- specific heat (if is_thermal), or nullptr
+ *   i_massflux     <-- mass flux at interior faces
+ *   i_visc         <-- diffusion coefficient at interior faces
+ *   cv_limiter     <-- convection limiter (if isstpp = 2), or nullptr
+ *   df_limiter     <-- diffusion limiter, or nullptr
+ *   courant        <-- cell Courant number (VOF NVD schemes), or nullptr
+ *   local_max      <-- local maximum of variable (if ischcp = 4)
+ *   local_min      <-- local minimum of variable (if ischcp = 4)
+ *   rhs            <-> right hand side
+ *----------------------------------------------------------------------------*/
 
-template <bool is_thermal>
+template <bool is_thermal, typename T, int ischcp>
 static void
-_convection_diffusion_scalar_unsteady
-  (const cs_field_t           *f,
-   const cs_equation_param_t  &eqp,
-   bool                        icvflb,
-   int                         inc,
-   int                         imasac,
-   cs_real_t         *restrict pvar,
-   const cs_real_t   *restrict pvara,
-   const int                   icvfli[],
-   const cs_field_bc_coeffs_t *bc_coeffs,
-   const cs_real_t             i_massflux[],
-   const cs_real_t             b_massflux[],
-   const cs_real_t             i_visc[],
-   const cs_real_t             b_visc[],
-   const cs_real_t             xcpp[],
-   cs_real_t         *restrict rhs)
+_i_faces_cd_scalar_unsteady(cs_dispatch_context         &ctx,
+                            const cs_mesh_t             *m,
+                            const cs_mesh_quantities_t  *fvq,
+                            const cs_equation_param_t   &eqp,
+                            int                          imasac,
+                            cs_nvd_type_t                limiter_choice,
+                            const cs_real_t    *restrict pvar,
+                            const T          (*restrict grad)[3],
+                            const cs_real_t  (*restrict gradup)[3],
+                            const cs_real_t              xcpp[],
+                            const cs_real_t              i_massflux[],
+                            const cs_real_t              i_visc[],
+                            const cs_real_t              cv_limiter[],
+                            const cs_real_t              df_limiter[],
+                            const cs_real_t              courant[],
+                            const cs_real_t              local_max[],
+                            const cs_real_t              local_min[],
+                            cs_real_t          *restrict rhs)
 {
-  const cs_real_t *coefap = bc_coeffs->a;
-  const cs_real_t *coefbp = bc_coeffs->b;
-  const cs_real_t *cofafp = bc_coeffs->af;
-  const cs_real_t *cofbfp = bc_coeffs->bf;
-
   const int iconvp = eqp.iconv;
   const int idiffp = eqp.idiff;
-  const int nswrgp = eqp.nswrgr;
-  const int imrgra = eqp.imrgra;
-  const cs_gradient_limit_t imligp = (cs_gradient_limit_t)(eqp.imligr);
   const int ircflp = eqp.ircflu;
-  const int ischcp = eqp.ischcv;
   const int isstpp = eqp.isstpc;
-  const int iwarnp = eqp.verbosity;
-  const int icoupl = eqp.icoupl;
-  cs_nvd_type_t limiter_choice = CS_NVD_N_TYPES;
   const double blencp = eqp.blencv;
-  const double blend_st = eqp.blend_st;
-  const double epsrgp = eqp.epsrgr;
-  const double climgp = eqp.climgr;
   const double thetap = eqp.theta;
 
-  const cs_mesh_t  *m = cs_glob_mesh;
-  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
-
   const cs_lnum_t n_cells = m->n_cells;
-  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
-  const int n_i_faces = m->n_i_faces;
 
   const cs_lnum_2_t *restrict i_face_cells
     = (const cs_lnum_2_t *)m->i_face_cells;
-  const cs_lnum_t *restrict b_face_cells
-    = (const cs_lnum_t *)m->b_face_cells;
   const cs_real_t *restrict weight = fvq->weight;
-  const cs_real_t *restrict i_dist = fvq->i_dist;
-  const cs_real_t *restrict b_face_surf = fvq->b_face_surf;
-  const cs_real_t *restrict cell_vol = fvq->cell_vol;
   const cs_real_3_t *restrict cell_cen
     = (const cs_real_3_t *)fvq->cell_cen;
   const cs_real_3_t *restrict i_face_u_normal
@@ -3106,745 +3222,992 @@ _convection_diffusion_scalar_unsteady
     = (const cs_real_3_t *)fvq->diipf;
   const cs_real_3_t *restrict djjpf
     = (const cs_real_3_t *)fvq->djjpf;
-  const cs_real_3_t *restrict diipb
-    = (const cs_real_3_t *)fvq->diipb;
-
-  const int *bc_type = cs_glob_bc_type;
 
-  /* Parallel or device dispatch */
-  cs_dispatch_context ctx;
   cs_dispatch_sum_type_t i_sum_type = ctx.get_parallel_for_i_faces_sum_type(m);
-  cs_dispatch_sum_type_t b_sum_type = ctx.get_parallel_for_b_faces_sum_type(m);
-
-  /* Local variables */
 
-  char var_name[64];
-  const int f_id = (f != nullptr) ? f->id : -1;
+  const cs_real_t *hybrid_blend = nullptr;
+  if (CS_F_(hybrid_blend) != NULL)
+    hybrid_blend = CS_F_(hybrid_blend)->val;
 
-  int w_stride = 1;
+  ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
 
-  bool pure_upwind = (blencp > 0.) ? false : true;
-  cs_real_t *coface = NULL, *cofbce = NULL;
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
 
-  cs_real_3_t *grad;
-  cs_real_3_t *gradup = NULL;
-  cs_real_3_t *gradst = NULL;
+    cs_real_t cpi = 1.0, cpj = 1.0;
+    if (is_thermal) {
+      cpi = xcpp[ii];
+      cpj = xcpp[jj];
+    }
 
-  cs_real_t *local_min = NULL;
-  cs_real_t *local_max = NULL;
-  cs_real_t *courant = NULL;
+    cs_real_t beta = blencp;
 
-  cs_real_t *cv_limiter = NULL;
-  cs_real_t *df_limiter = NULL;
+    cs_real_t pif, pjf;
+    cs_real_t pip, pjp;
 
-  cs_real_t *gweight = NULL;
+#if defined(__INTEL_LLVM_COMPILER)
+    // Silence unitialized variables warning due do compiler ignoring
+    // initializations in inlined functions.
+    pif = 0., pjf = 0.;
+#endif
 
-  const int key_lim_choice = cs_field_key_id("limiter_choice");
+    /* Beta blending coefficient ensuring positivity of the scalar */
+    if (isstpp == 2) {
+      beta = cs_math_fmax(cs_math_fmin(cv_limiter[ii], cv_limiter[jj]),
+                          0.);
+    }
 
-  cs_real_t  *v_slope_test = cs_get_v_slope_test(f_id,  eqp);
+    cs_real_t fluxi = 0., fluxj = 0.;
 
-  /* Internal coupling variables */
-  cs_real_t *pvar_local = NULL;
-  cs_real_t *pvar_distant = NULL;
-  cs_real_t *df_limiter_local = NULL;
-  int coupling_id = -1;
-  cs_lnum_t n_local = 0, n_distant = 0;
-  const cs_lnum_t *faces_local = NULL, *faces_distant = NULL;
-  cs_internal_coupling_t *cpl = NULL;
+    if (ircflp == 1) {
+      cs_real_t bldfrp = 1.;
+      if (df_limiter != NULL)  /* Local limiter of the reconstruction */
+        bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
+                              0.);
 
-  /* Initialization */
+      cs_real_t recoi, recoj;
+      cs_i_compute_quantities(bldfrp,
+                              diipf[face_id], djjpf[face_id],
+                              grad[ii], grad[jj],
+                              pvar[ii], pvar[jj],
+                              &recoi, &recoj,
+                              &pip, &pjp);
+    }
+    else {
+      pip = pvar[ii];
+      pjp = pvar[jj];
+    }
 
-  /* Allocate work arrays */
+    const cs_real_t *cell_ceni = cell_cen[ii];
+    const cs_real_t *cell_cenj = cell_cen[jj];
+    const cs_real_t w_f = weight[face_id];
 
-  CS_MALLOC_HD(grad, n_cells_ext, cs_real_3_t, cs_alloc_mode);
+    if (ischcp != 4) {
 
-  /* Choose gradient type */
+      if (ischcp == 0) {
 
-  cs_halo_type_t halo_type = CS_HALO_STANDARD;
-  cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
+        /* Legacy SOLU
+           -----------*/
 
-  cs_gradient_type_by_imrgra(imrgra,
-                             &gradient_type,
-                             &halo_type);
+        cs_solu_f_val(cell_ceni,
+                      i_face_cog[face_id],
+                      grad[ii],
+                      pvar[ii],
+                      &pif);
+        cs_solu_f_val(cell_cenj,
+                      i_face_cog[face_id],
+                      grad[jj],
+                      pvar[jj],
+                      &pjf);
+      }
+      else if (ischcp == 1) {
 
-  /* Handle cases where only the previous values (already synchronized)
-     or current values are provided */
+        /* Centered
+           --------*/
 
-  if (pvar != NULL)
-    cs_sync_scalar_halo(m, halo_type, pvar);
-  if (pvara == NULL)
-    pvara = (const cs_real_t *)pvar;
+        pif = w_f*pip + (1.-w_f)*pjp;
+        pjf = pif;
 
-  const cs_real_t  *restrict _pvar = (pvar != NULL) ? pvar : pvara;
+      }
+      else if (ischcp == 2) {
 
-  /* Limiters */
+        /* SOLU
+           ---- */
 
-  if (f != NULL) {
+        cs_solu_f_val(cell_ceni,
+                      i_face_cog[face_id],
+                      gradup[ii],
+                      pvar[ii],
+                      &pif);
+        cs_solu_f_val(cell_cenj,
+                      i_face_cog[face_id],
+                      gradup[jj],
+                      pvar[jj],
+                      &pjf);
 
-    /* NVD/TVD limiters */
-    if (ischcp == 4) {
-      limiter_choice = (cs_nvd_type_t)(cs_field_get_key_int(f, key_lim_choice));
-      CS_MALLOC_HD(local_max, n_cells_ext, cs_real_t, cs_alloc_mode);
-      CS_MALLOC_HD(local_min, n_cells_ext, cs_real_t, cs_alloc_mode);
-      cs_field_local_extrema_scalar(f_id,
-                                    halo_type,
-                                    local_max,
-                                    local_min);
-      if (is_thermal) {
-        assert(limiter_choice < CS_NVD_VOF_HRIC); /* VOF scheme forbidden here */
-      }
-      else if (limiter_choice >= CS_NVD_VOF_HRIC) {
-        CS_MALLOC_HD(courant, n_cells_ext, cs_real_t, cs_alloc_mode);
-        cs_cell_courant_number(f, ctx, courant);
       }
-    }
+      else if (ischcp == 3) {
 
-    int cv_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("convection_limiter_id"));
-    if (cv_limiter_id > -1)
-      cv_limiter = cs_field_by_id(cv_limiter_id)->val;
+        /* Centered
+           -------- */
 
-    int df_limiter_id =
-      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
-    if (df_limiter_id > -1)
-      df_limiter = cs_field_by_id(df_limiter_id)->val;
+        pif = w_f*pip + (1.-w_f)*pjp;
+        pjf = pif;
 
-    snprintf(var_name, 63, "%s", f->name);
-  }
-  else if (isstpp > 1) {
-    bft_error(__FILE__, __LINE__, 0,
-              _("invalid value of isstpp for a work array"));
-  }
-  else {
-    strncpy(var_name, "[scalar convection-diffusion]", 63);
-  }
-  var_name[63] = '\0';
+        /* Legacy SOLU
+           -----------*/
+        cs_real_t pif_up, pjf_up;
 
-  if (iwarnp >= 2) {
-    if (ischcp == 1) {
-      bft_printf(
-        _(" %s: Convection in centered blending with %f percent of upwind\n"),
-        var_name, (1.-blencp)*100.);
-    }
-    else {
-      bft_printf(
-        _(" %s: Convection in 2nd order blending with %f percent of upwind\n"),
-        var_name, (1.-blencp)*100.);
-    }
-  }
+        cs_solu_f_val(cell_ceni,
+                      i_face_cog[face_id],
+                      grad[ii],
+                      pvar[ii],
+                      &pif_up);
 
-  if (icoupl > 0) {
-    assert(f_id != -1);
-    const int coupling_key_id = cs_field_key_id("coupling_entity");
-    coupling_id = cs_field_get_key_int(f, coupling_key_id);
-    cpl = cs_internal_coupling_by_id(coupling_id);
-    cs_internal_coupling_coupled_faces(cpl,
-                                       &n_local,
-                                       &faces_local,
-                                       &n_distant,
-                                       &faces_distant);
-  }
+        cs_solu_f_val(cell_cenj,
+                      i_face_cog[face_id],
+                      grad[jj],
+                      pvar[jj],
+                      &pjf_up);
 
-  /* Compute the balance with reconstruction */
+        cs_real_t hybrid_blend_interp
+          = cs_math_fmin(hybrid_blend[ii], hybrid_blend[jj]);
 
-  /* Compute the gradient of the variable */
+        pif = hybrid_blend_interp*pif + (1. - hybrid_blend_interp)*pif_up;
+        pjf = hybrid_blend_interp*pjf + (1. - hybrid_blend_interp)*pjf_up;
 
-  /* The gradient (grad) is used in the flux reconstruction and the slope test.
-     Thus we must compute it:
-         - when we have diffusion and we reconstruct the fluxes,
-         - when the convection scheme is the legacy SOLU,
-         - when we have convection, we are not in pure upwind
-           and we reconstruct the fluxes,
-         - when we have convection, we are not in pure upwind
-           and we have not shunted the slope test,
-         - when we use NVD / TVD schemes.
-  */
+      }
 
-  bool is_ischcp
-    = (   (is_thermal && ischcp == 0)
-       || (is_thermal == false && (ischcp == 0 || ischcp == 3 || ischcp == 4)));
+      /* Blending
+         -------- */
 
-  if (   (idiffp != 0 && ircflp == 1)
-      || (   iconvp != 0 && pure_upwind == false
-          && (ircflp == 1 || isstpp == 0 || is_ischcp))) {
+      pif = beta * pif + (1. - beta) * pvar[ii];
+      pjf = beta * pjf + (1. - beta) * pvar[jj];
 
-    if (f != NULL) {
-      /* Get the calculation option from the field */
-      if (f->type & CS_FIELD_VARIABLE && eqp.iwgrec == 1) {
-        if (eqp.idiff > 0) {
-          int key_id = cs_field_key_id("gradient_weighting_id");
-          int diff_id = cs_field_get_key_int(f, key_id);
-          if (diff_id > -1) {
-            cs_field_t *weight_f = cs_field_by_id(diff_id);
-            gweight = weight_f->val;
-            w_stride = weight_f->dim;
-            cs_field_synchronize(weight_f, halo_type);
-          }
-        }
-      }
     }
+    else if (ischcp == 4) {
 
-    cs_gradient_scalar_synced_input(var_name,
-                                    gradient_type,
-                                    halo_type,
-                                    inc,
-                                    nswrgp,
-                                    0, /* hyd_p_flag */
-                                    w_stride,
-                                    iwarnp,
-                                    imligp,
-                                    epsrgp,
-                                    climgp,
-                                    NULL, /* f_ext exterior force */
-                                    bc_coeffs,
-                                    _pvar,
-                                    gweight, /* Weighted gradient */
-                                    cpl,
-                                    grad);
+      /* NVD/TVD family of high accuracy schemes */
 
-  }
-  else {
+      cs_lnum_t ic, id;
 
-    ctx.parallel_for(n_cells_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t cell_id) {
-      grad[cell_id][0] = 0.;
-      grad[cell_id][1] = 0.;
-      grad[cell_id][2] = 0.;
-    });
-    ctx.wait();
-  }
+      /* Determine central and downwind sides w.r.t. current face */
+      if (i_massflux[face_id] >= 0.) {
+        ic = ii;
+        id = jj;
+      } else {
+        ic = jj;
+        id = ii;
+      }
 
-  /* Compute gradients used in convection schemes */
+      cs_real_t courant_c = -1.;
+      if (courant != NULL && is_thermal == false)
+        courant_c = courant[ic];
 
-  if (iconvp > 0 && pure_upwind == false) {
+      cs_i_cd_unsteady_nvd(limiter_choice,
+                           beta,
+                           cell_cen[ic],
+                           cell_cen[id],
+                           i_face_u_normal[face_id],
+                           i_face_cog[face_id],
+                           grad[ic],
+                           pvar[ic],
+                           pvar[id],
+                           local_max[ic],
+                           local_min[ic],
+                           courant_c,
+                           &pif,
+                           &pjf);
 
-    /* Compute cell gradient used in slope test */
-    if (isstpp == 0) {
+    }
 
-      CS_MALLOC_HD(gradst, n_cells_ext, cs_real_3_t, cs_alloc_mode);
+    // Convective flux
 
-      ctx.parallel_for(n_cells_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t cell_id) {
-        gradst[cell_id][0] = 0.;
-        gradst[cell_id][1] = 0.;
-        gradst[cell_id][2] = 0.;
-      });
+    if (iconvp == 1) {
+      cs_real_t _i_massflux = i_massflux[face_id];
+      cs_real_t flui = 0.5*(_i_massflux + cs_math_fabs(_i_massflux));
+      cs_real_t fluj = 0.5*(_i_massflux - cs_math_fabs(_i_massflux));
 
-      ctx.wait();
+      fluxi += cpi*(  thetap*(flui*pif + fluj*pjf)
+                    - imasac*_i_massflux*pvar[ii]);
 
-      cs_slope_test_gradient(f_id,
-                             ctx,
-                             inc,
-                             halo_type,
-                             (const cs_real_3_t *)grad,
-                             gradst,
-                             _pvar,
-                             bc_coeffs,
-                             i_massflux);
+      fluxj += cpj*(  thetap*(flui*pif + fluj*pjf)
+                    - imasac*_i_massflux*pvar[jj]);
 
     }
 
-    /* Pure SOLU scheme */
-    if (ischcp == 2 || (is_thermal && ischcp == 4)) {
+    // Diffusive flux (no relaxation)
 
-      CS_MALLOC_HD(gradup, n_cells_ext, cs_real_3_t, cs_alloc_mode);
+    cs_real_t diff_contrib = idiffp*thetap*i_visc[face_id]*(pip - pjp);
+    fluxi += diff_contrib;
+    fluxj += diff_contrib;
 
-      ctx.parallel_for(n_cells_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t cell_id) {
-        gradup[cell_id][0] = 0.;
-        gradup[cell_id][1] = 0.;
-        gradup[cell_id][2] = 0.;
-      });
+    if (ii < n_cells)
+      cs_dispatch_sum(&rhs[ii], -fluxi, i_sum_type);
+    if (jj < n_cells)
+      cs_dispatch_sum(&rhs[jj],  fluxj, i_sum_type);
 
-      ctx.wait();
+  });
+}
 
-      cs_upwind_gradient(f_id,
-                         ctx,
-                         inc,
-                         halo_type,
-                         bc_coeffs,
-                         i_massflux,
-                         b_massflux,
-                         _pvar,
-                         gradup);
+/*----------------------------------------------------------------------------
+ * Add interior face contributions of the explicit convection/diffusion
+ * terms of a scalar, with a slope test.
+ *
+ * The convection scheme being a template parameter, branches on it are
+ * resolved at compile time.
+ *
+ * template parameters:
+ *   is_thermal    true for the thermal variable (weighted by xcpp)
+ *   T             gradient storage type (cs_real_t or float)
+ *   ischcp        convection scheme (eqp.ischcv)
+ *
+ * parameters:
+ *   ctx            <-> reference to dispatch context
+ *   m              <-- pointer to mesh
+ *   fvq            <-- pointer to finite volume quantities
+ *   eqp            <-- equation parameters
+ *   imasac         <-- take mass accumulation into account?
+ *   pvar           <-- variable
+ *   grad           <-- reconstruction gradient
+ *   gradup         <-- upwind gradient (if ischcp = 2), or nullptr
+ *   gradst         <-- slope test gradient
+ *   xcpp           <-- specific heat (if is_thermal), or nullptr
+ *   i_massflux     <-- mass flux at interior faces
+ *   i_visc         <-- diffusion coefficient at interior faces
+ *   df_limiter     <-- diffusion limiter, or nullptr
+ *   v_slope_test   <-> slope test activation, or nullptr
+ *   i_upwind       <-> upwind switch flag at faces, or nullptr
+ *   rhs            <-> right hand side
+ *----------------------------------------------------------------------------*/
+
+template <bool is_thermal, typename T, int ischcp>
+static void
+_i_faces_cd_scalar_unsteady_slope_test
+  (cs_dispatch_context         &ctx,
+   const cs_mesh_t             *m,
+   const cs_mesh_quantities_t  *fvq,
+   const cs_equation_param_t   &eqp,
+   int                          imasac,
+   const cs_real_t    *restrict pvar,
+   const T          (*restrict grad)[3],
+   const cs_real_t  (*restrict gradup)[3],
+   const cs_real_t  (*restrict gradst)[3],
+   const cs_real_t              xcpp[],
+   const cs_real_t              i_massflux[],
+   const cs_real_t              i_visc[],
+   const cs_real_t              df_limiter[],
+   cs_real_t          *restrict v_slope_test,
+   short              *restrict i_upwind,
+   cs_real_t          *restrict rhs)
+{
+  const int iconvp = eqp.iconv;
+  const int idiffp = eqp.idiff;
+  const int ircflp = eqp.ircflu;
+  const double blencp = eqp.blencv;
+  const double blend_st = eqp.blend_st;
+  const double thetap = eqp.theta;
+
+  const cs_lnum_t n_cells = m->n_cells;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict i_dist = fvq->i_dist;
+  const cs_real_t *restrict cell_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_u_normal
+    = (const cs_real_3_t *)fvq->i_face_u_normal;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *)fvq->i_face_cog;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *)fvq->djjpf;
+
+  cs_dispatch_sum_type_t i_sum_type = ctx.get_parallel_for_i_faces_sum_type(m);
+
+  ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
 
+    cs_lnum_t ii = i_face_cells[face_id][0];
+    cs_lnum_t jj = i_face_cells[face_id][1];
+
+    cs_real_t cpi = 1., cpj = 1.;
+    if (is_thermal) {
+      cpi = xcpp[ii];
+      cpj = xcpp[jj];
     }
 
-  }
+    bool upwind_switch = false;
 
-  /* ======================================================================
-    ---> Contribution from interior faces
-    ======================================================================*/
+    cs_real_t fluxi = 0., fluxj = 0.;
 
-  short *i_upwind = nullptr;
-  if (eqp.verbosity >= 2 && iconvp == 1 && pure_upwind == false) {
-    CS_MALLOC_HD(i_upwind, n_i_faces, short, cs_alloc_mode);
-    ctx.parallel_for(n_i_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t face_id) {
-      i_upwind[face_id] = 0;
-    });
-    ctx.wait();
-  }
+    cs_real_t pif, pjf;
+    cs_real_t pip, pjp;
 
-  /* --> Pure upwind flux
-     =====================*/
+    if (ircflp == 1) {
+      cs_real_t bldfrp = 1.;
+      if (df_limiter != NULL)  /* Local limiter */
+        bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
+                              0.);
 
-  if (pure_upwind) {
+      cs_real_t recoi, recoj;
+      cs_i_compute_quantities(bldfrp,
+                              diipf[face_id], djjpf[face_id],
+                              grad[ii], grad[jj],
+                              pvar[ii], pvar[jj],
+                              &recoi, &recoj,
+                              &pip, &pjp);
+    }
+    else {
+      pip = pvar[ii];
+      pjp = pvar[jj];
+    }
 
-    ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
+    const cs_real_t *cell_ceni = cell_cen[ii];
+    const cs_real_t *cell_cenj = cell_cen[jj];
+    const cs_real_t w_f = weight[face_id];
 
-      cs_lnum_t ii = i_face_cells[face_id][0];
-      cs_lnum_t jj = i_face_cells[face_id][1];
+    /* Slope test is needed with convection */
+    if (iconvp > 0) {
+      cs_real_t testij, tesqck;
 
-      cs_real_t cpi = 1.0, cpj = 1.0;
-      if (is_thermal) {
-        cpi = xcpp[ii];
-        cpj = xcpp[jj];
+      cs_slope_test(pvar[ii],
+                    pvar[jj],
+                    i_dist[face_id],
+                    i_face_u_normal[face_id],
+                    grad[ii],
+                    grad[jj],
+                    gradst[ii],
+                    gradst[jj],
+                    i_massflux[face_id],
+                    &testij,
+                    &tesqck);
+
+      if (ischcp == 0) {
+
+        /* Original SOLU
+           --------------*/
+
+        cs_solu_f_val(cell_ceni,
+                      i_face_cog[face_id],
+                      grad[ii],
+                      pvar[ii],
+                      &pif);
+        cs_solu_f_val(cell_cenj,
+                      i_face_cog[face_id],
+                      grad[jj],
+                      pvar[jj],
+                      &pjf);
       }
+      else if (ischcp == 1) {
 
-      cs_real_t fluxi = 0., fluxj = 0.;
-      cs_real_t pip, pjp;
+        /* Centered
+           --------*/
 
-      if (ircflp == 1) {
-        cs_real_t bldfrp = 1.;
-        /* Local limitation of the reconstruction */
-        if (df_limiter != NULL && ircflp > 0)
-          bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
-                                0.);
+        pif = w_f*pip + (1.-w_f)*pjp;
+        pjf = pif;
 
-        cs_real_t recoi, recoj;
-        cs_i_compute_quantities(bldfrp,
-                                diipf[face_id], djjpf[face_id],
-                                grad[ii], grad[jj],
-                                _pvar[ii], _pvar[jj],
-                                &recoi, &recoj,
-                                &pip, &pjp);
       }
       else {
-        pip = _pvar[ii];
-        pjp = _pvar[jj];
+
+        /* SOLU
+           -----*/
+
+        cs_solu_f_val(cell_ceni,
+                      i_face_cog[face_id],
+                      gradup[ii],
+                      pvar[ii],
+                      &pif);
+        cs_solu_f_val(cell_cenj,
+                      i_face_cog[face_id],
+                      gradup[jj],
+                      pvar[jj],
+                      &pjf);
+
       }
 
-      /* No relaxation in following expressions (pipr = pip, pjpr = pjp) */
+      /* Slope test: percentage of upwind
+         -------------------------------- */
 
-      /* Convective flux (as we are upwind, pif == _pvar[ii],
-                                            pjf == _pvar[jj] */
+      if (tesqck <= 0. || testij <= 0.) {
 
-      if (iconvp == 1) {
-        cs_real_t _i_massflux = i_massflux[face_id];
-        cs_real_t flui = 0.5*(_i_massflux + cs_math_fabs(_i_massflux));
-        cs_real_t fluj = 0.5*(_i_massflux - cs_math_fabs(_i_massflux));
+        cs_blend_f_val(blend_st, pvar[ii], &pif);
+        cs_blend_f_val(blend_st, pvar[jj], &pjf);
 
-        fluxi += cpi*(  thetap * (flui*_pvar[ii] + fluj*_pvar[jj])
-                      - imasac * _i_massflux*_pvar[ii]);
+        upwind_switch = true;
 
-        fluxj += cpj*(  thetap * (flui*_pvar[ii] + fluj*_pvar[jj])
-                      - imasac *  _i_massflux*_pvar[jj]);
       }
 
-      /* Diffusive flux */
+      /* Blending
+         -------- */
 
-      cs_real_t diff_contrib = idiffp*thetap*i_visc[face_id]*(pip - pjp);
-      fluxi += diff_contrib;
-      fluxj += diff_contrib;
+      cs_blend_f_val(blencp, pvar[ii], &pif);
+      cs_blend_f_val(blencp, pvar[jj], &pjf);
 
-      if (ii < n_cells)
-        cs_dispatch_sum(&rhs[ii], -fluxi, i_sum_type);
-      if (jj < n_cells)
-        cs_dispatch_sum(&rhs[jj],  fluxj, i_sum_type);
+    }
+    else { /* If iconv=0 p*fr* are useless */
 
-    });
-  } /* End pure upwind */
+      pif = pvar[ii];
+      pjf = pvar[jj];
 
-  /* Flux with no slope test or Min/Max Beta limiter
-     =============================================== */
+    } /* End for slope test */
 
-  else if (isstpp == 1 || isstpp == 2) {
+    // Convective flux
 
-    if (ischcp < 0 || ischcp > 4) {
-      bft_error(__FILE__, __LINE__, 0,
-                _("invalid value of ischcv"));
+    if (iconvp == 1) {
+      cs_real_t _i_massflux = i_massflux[face_id];
+      cs_real_t flui = 0.5*(_i_massflux + cs_math_fabs(_i_massflux));
+      cs_real_t fluj = 0.5*(_i_massflux - cs_math_fabs(_i_massflux));
+
+      fluxi += cpi*(  thetap*(flui*pif + fluj*pjf)
+                    - imasac*_i_massflux*pvar[ii]);
+
+      fluxj += cpj*(  thetap*(flui*pif + fluj*pjf)
+                    - imasac*_i_massflux*pvar[jj]);
     }
 
-    const cs_real_t *hybrid_blend = nullptr;
-    if (CS_F_(hybrid_blend) != NULL)
-      hybrid_blend = CS_F_(hybrid_blend)->val;
+    // Diffusive flux (no relaxation)
 
-    ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
+    cs_real_t diff_contrib = idiffp*thetap*i_visc[face_id]*(pip - pjp);
+    fluxi += diff_contrib;
+    fluxj += diff_contrib;
 
-      cs_lnum_t ii = i_face_cells[face_id][0];
-      cs_lnum_t jj = i_face_cells[face_id][1];
+    if (upwind_switch) {
+      /* in parallel, face will be counted by one and only one rank */
+      if (i_upwind != nullptr && ii < n_cells)
+        i_upwind[face_id] = 1;
 
-      cs_real_t cpi = 1.0, cpj = 1.0;
-      if (is_thermal) {
-        cpi = xcpp[ii];
-        cpj = xcpp[jj];
+      if (v_slope_test != NULL) {
+        cs_dispatch_sum(&v_slope_test[ii],
+                        cs_math_fabs(i_massflux[face_id]) / cell_vol[ii],
+                        i_sum_type);
+        cs_dispatch_sum(&v_slope_test[jj],
+                        cs_math_fabs(i_massflux[face_id]) / cell_vol[jj],
+                        i_sum_type);
       }
 
-      cs_real_t beta = blencp;
-
-      cs_real_t pif, pjf;
-      cs_real_t pip, pjp;
+    }
 
-#if defined(__INTEL_LLVM_COMPILER)
-      // Silence unitialized variables warning due do compiler ignoring
-      // initializations in inlined functions.
-      pif = 0., pjf = 0.;
-#endif
+    if (ii < n_cells)
+      cs_dispatch_sum(&rhs[ii], -fluxi, i_sum_type);
+    if (jj < n_cells)
+      cs_dispatch_sum(&rhs[jj],  fluxj, i_sum_type);
 
-      /* Beta blending coefficient ensuring positivity of the scalar */
-      if (isstpp == 2) {
-        beta = cs_math_fmax(cs_math_fmin(cv_limiter[ii], cv_limiter[jj]),
-                            0.);
-      }
+  });
+}
 
-      cs_real_t fluxi = 0., fluxj = 0.;
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the explicit part of the convection/diffusion terms of a
+ * standard transport equation of a scalar field \f$ \varia \f$.
+ *
+ * More precisely, the right hand side \f$ Rhs \f$ is updated as
+ * follows:
+ * \f[
+ * Rhs = Rhs - \sum_{\fij \in \Facei{\celli}}      \left(
+ *        \dot{m}_\ij \left( \varia_\fij - \varia_\celli \right)
+ *      - \mu_\fij \gradv_\fij \varia \cdot \vect{S}_\ij  \right)
+ * \f]
+ *
+ * Warning:
+ * - \f$ Rhs \f$ has already been initialized before calling bilsc2!
+ * - mind the sign minus
+ *
+ * Please refer to the
+ * <a href="../../theory.pdf#bilsc2"><b>bilsc2</b></a> section of the
+ * theory guide for more informations.
+ *
+ * template parameters:
+ *   is_thermal    true for the thermal variable (weighted by xcpp)
+ *   T             storage type of the reconstruction gradient in face
+ *                 loops (cs_real_t or float)
+ *
+ * \param[in]     f             pointer to field
+ * \param[in]     eqp           equation parameters
+ * \param[in]     icvflb        global indicator of boundary convection flux
+ *                               - 0 upwind scheme at all boundary faces
+ *                               - 1 imposed flux at some boundary faces
+ * \param[in]     inc           indicator
+ *                               - 0 when solving an increment
+ *                               - 1 otherwise
+ * \param[in]     imasac        take mass accumulation into account?
+ * \param[in]     pvar          solved variable (current time step)
+ * \param[in]     pvara         solved variable (previous time step)
+ * \param[in]     icvfli        boundary face indicator array of convection flux
+ *                               - 0 upwind scheme
+ *                               - 1 imposed flux
+ * \param[in]     bc_coeffs     boundary condition structure for the variable
+ * \param[in]     i_massflux    mass flux at interior faces
+ * \param[in]     b_massflux    mass flux at boundary faces
+ * \param[in]     i_visc        \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                               at interior faces for the r.h.s.
+ * \param[in]     b_visc        \f$ \mu_\fib \dfrac{S_\fib}{\ipf \centf} \f$
+ *                               at border faces for the r.h.s.
+ * \param[in]     xcpp          array of specific heat (\f$ C_p \f$), or NULL
+ * \param[in,out] rhs           right hand side \f$ \vect{Rhs} \f$
+ */
+/*----------------------------------------------------------------------------*/
 
-      if (ircflp == 1) {
-        cs_real_t bldfrp = 1.;
-        if (df_limiter != NULL)  /* Local limiter of the reconstruction */
-          bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
-                                0.);
+template <bool is_thermal, typename T>
+static void
+_convection_diffusion_scalar_unsteady
+  (const cs_field_t           *f,
+   const cs_equation_param_t  &eqp,
+   bool                        icvflb,
+   int                         inc,
+   int                         imasac,
+   cs_real_t         *restrict pvar,
+   const cs_real_t   *restrict pvara,
+   const int                   icvfli[],
+   const cs_field_bc_coeffs_t *bc_coeffs,
+   const cs_real_t             i_massflux[],
+   const cs_real_t             b_massflux[],
+   const cs_real_t             i_visc[],
+   const cs_real_t             b_visc[],
+   const cs_real_t             xcpp[],
+   cs_real_t         *restrict rhs)
+{
+  const cs_real_t *coefap = bc_coeffs->a;
+  const cs_real_t *coefbp = bc_coeffs->b;
+  const cs_real_t *cofafp = bc_coeffs->af;
+  const cs_real_t *cofbfp = bc_coeffs->bf;
 
-        cs_real_t recoi, recoj;
-        cs_i_compute_quantities(bldfrp,
-                                diipf[face_id], djjpf[face_id],
-                                grad[ii], grad[jj],
-                                _pvar[ii], _pvar[jj],
-                                &recoi, &recoj,
-                                &pip, &pjp);
-      }
-      else {
-        pip = _pvar[ii];
-        pjp = _pvar[jj];
-      }
+  const int iconvp = eqp.iconv;
+  const int idiffp = eqp.idiff;
+  const int nswrgp = eqp.nswrgr;
+  const int imrgra = eqp.imrgra;
+  const cs_gradient_limit_t imligp = (cs_gradient_limit_t)(eqp.imligr);
+  const int ircflp = eqp.ircflu;
+  const int ischcp = eqp.ischcv;
+  const int isstpp = eqp.isstpc;
+  const int iwarnp = eqp.verbosity;
+  const int icoupl = eqp.icoupl;
+  cs_nvd_type_t limiter_choice = CS_NVD_N_TYPES;
+  const double blencp = eqp.blencv;
+  const double epsrgp = eqp.epsrgr;
+  const double climgp = eqp.climgr;
+  const double thetap = eqp.theta;
 
-      const cs_real_t *cell_ceni = cell_cen[ii];
-      const cs_real_t *cell_cenj = cell_cen[jj];
-      const cs_real_t w_f = weight[face_id];
+  const cs_mesh_t  *m = cs_glob_mesh;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
 
-      if (ischcp != 4) {
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_faces = m->n_i_faces;
 
-        if (ischcp == 0) {
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *)m->b_face_cells;
+  const cs_real_t *restrict b_face_surf = fvq->b_face_surf;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *)fvq->djjpf;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *)fvq->diipb;
 
-          /* Legacy SOLU
-             -----------*/
+  const int *bc_type = cs_glob_bc_type;
 
-          cs_solu_f_val(cell_ceni,
-                        i_face_cog[face_id],
-                        grad[ii],
-                        _pvar[ii],
-                        &pif);
-          cs_solu_f_val(cell_cenj,
-                        i_face_cog[face_id],
-                        grad[jj],
-                        _pvar[jj],
-                        &pjf);
-        }
-        else if (ischcp == 1) {
+  /* Parallel or device dispatch */
+  cs_dispatch_context ctx;
+  cs_dispatch_sum_type_t i_sum_type = ctx.get_parallel_for_i_faces_sum_type(m);
+  cs_dispatch_sum_type_t b_sum_type = ctx.get_parallel_for_b_faces_sum_type(m);
 
-          /* Centered
-             --------*/
+  /* Local variables */
 
-          pif = w_f*pip + (1.-w_f)*pjp;
-          pjf = pif;
+  char var_name[64];
+  const int f_id = (f != nullptr) ? f->id : -1;
 
-        }
-        else if (ischcp == 2) {
+  int w_stride = 1;
 
-          /* SOLU
-             ---- */
+  bool pure_upwind = (blencp > 0.) ? false : true;
+  cs_real_t *coface = NULL, *cofbce = NULL;
 
-          cs_solu_f_val(cell_ceni,
-                        i_face_cog[face_id],
-                        gradup[ii],
-                        _pvar[ii],
-                        &pif);
-          cs_solu_f_val(cell_cenj,
-                        i_face_cog[face_id],
-                        gradup[jj],
-                        _pvar[jj],
-                        &pjf);
+  cs_real_3_t *_grad;
+  T (*grad)[3] = nullptr;
+  cs_real_3_t *gradup = NULL;
+  cs_real_3_t *gradst = NULL;
 
-        }
-        else if (ischcp == 3) {
+  cs_real_t *local_min = NULL;
+  cs_real_t *local_max = NULL;
+  cs_real_t *courant = NULL;
 
-          /* Centered
-             -------- */
+  cs_real_t *cv_limiter = NULL;
+  cs_real_t *df_limiter = NULL;
 
-          pif = w_f*pip + (1.-w_f)*pjp;
-          pjf = pif;
+  cs_real_t *gweight = NULL;
 
-          /* Legacy SOLU
-             -----------*/
-          cs_real_t pif_up, pjf_up;
+  const int key_lim_choice = cs_field_key_id("limiter_choice");
 
-          cs_solu_f_val(cell_ceni,
-                        i_face_cog[face_id],
-                        grad[ii],
-                        _pvar[ii],
-                        &pif_up);
+  cs_real_t  *v_slope_test = cs_get_v_slope_test(f_id,  eqp);
 
-          cs_solu_f_val(cell_cenj,
-                        i_face_cog[face_id],
-                        grad[jj],
-                        _pvar[jj],
-                        &pjf_up);
+  /* Internal coupling variables */
+  cs_real_t *pvar_local = NULL;
+  cs_real_t *pvar_distant = NULL;
+  cs_real_t *df_limiter_local = NULL;
+  int coupling_id = -1;
+  cs_lnum_t n_local = 0, n_distant = 0;
+  const cs_lnum_t *faces_local = NULL, *faces_distant = NULL;
+  cs_internal_coupling_t *cpl = NULL;
 
-          cs_real_t hybrid_blend_interp
-            = cs_math_fmin(hybrid_blend[ii], hybrid_blend[jj]);
+  /* Initialization */
 
-          pif = hybrid_blend_interp*pif + (1. - hybrid_blend_interp)*pif_up;
-          pjf = hybrid_blend_interp*pjf + (1. - hybrid_blend_interp)*pjf_up;
+  /* Allocate work arrays */
 
-        }
+  CS_MALLOC_HD(_grad, n_cells_ext, cs_real_3_t, cs_alloc_mode);
 
-        /* Blending
-           -------- */
+  /* Choose gradient type */
 
-        pif = beta * pif + (1. - beta) * _pvar[ii];
-        pjf = beta * pjf + (1. - beta) * _pvar[jj];
+  cs_halo_type_t halo_type = CS_HALO_STANDARD;
+  cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
 
-      }
-      else if (ischcp == 4) {
+  cs_gradient_type_by_imrgra(imrgra,
+                             &gradient_type,
+                             &halo_type);
 
-        /* NVD/TVD family of high accuracy schemes */
+  /* Handle cases where only the previous values (already synchronized)
+     or current values are provided */
 
-        cs_lnum_t ic, id;
+  if (pvar != NULL)
+    cs_sync_scalar_halo(m, halo_type, pvar);
+  if (pvara == NULL)
+    pvara = (const cs_real_t *)pvar;
 
-        /* Determine central and downwind sides w.r.t. current face */
-        if (i_massflux[face_id] >= 0.) {
-          ic = ii;
-          id = jj;
-        } else {
-          ic = jj;
-          id = ii;
-        }
+  const cs_real_t  *restrict _pvar = (pvar != NULL) ? pvar : pvara;
 
-        cs_real_t courant_c = -1.;
-        if (courant != NULL && is_thermal == false)
-          courant_c = courant[ic];
+  /* Limiters */
 
-        cs_i_cd_unsteady_nvd(limiter_choice,
-                             beta,
-                             cell_cen[ic],
-                             cell_cen[id],
-                             i_face_u_normal[face_id],
-                             i_face_cog[face_id],
-                             grad[ic],
-                             _pvar[ic],
-                             _pvar[id],
-                             local_max[ic],
-                             local_min[ic],
-                             courant_c,
-                             &pif,
-                             &pjf);
+  if (f != NULL) {
 
+    /* NVD/TVD limiters */
+    if (ischcp == 4) {
+      limiter_choice = (cs_nvd_type_t)(cs_field_get_key_int(f, key_lim_choice));
+      CS_MALLOC_HD(local_max, n_cells_ext, cs_real_t, cs_alloc_mode);
+      CS_MALLOC_HD(local_min, n_cells_ext, cs_real_t, cs_alloc_mode);
+      cs_field_local_extrema_scalar(f_id,
+                                    halo_type,
+                                    local_max,
+                                    local_min);
+      if (is_thermal) {
+        assert(limiter_choice < CS_NVD_VOF_HRIC); /* VOF scheme forbidden here */
       }
-
-      // Convective flux
-
-      if (iconvp == 1) {
-        cs_real_t _i_massflux = i_massflux[face_id];
-        cs_real_t flui = 0.5*(_i_massflux + cs_math_fabs(_i_massflux));
-        cs_real_t fluj = 0.5*(_i_massflux - cs_math_fabs(_i_massflux));
-
-        fluxi += cpi*(  thetap*(flui*pif + fluj*pjf)
-                      - imasac*_i_massflux*_pvar[ii]);
-
-        fluxj += cpj*(  thetap*(flui*pif + fluj*pjf)
-                      - imasac*_i_massflux*_pvar[jj]);
-
+      else if (limiter_choice >= CS_NVD_VOF_HRIC) {
+        CS_MALLOC_HD(courant, n_cells_ext, cs_real_t, cs_alloc_mode);
+        cs_cell_courant_number(f, ctx, courant);
       }
+    }
 
-      // Diffusive flux (no relaxation)
-
-      cs_real_t diff_contrib = idiffp*thetap*i_visc[face_id]*(pip - pjp);
-      fluxi += diff_contrib;
-      fluxj += diff_contrib;
+    int cv_limiter_id =
+      cs_field_get_key_int(f, cs_field_key_id("convection_limiter_id"));
+    if (cv_limiter_id > -1)
+      cv_limiter = cs_field_by_id(cv_limiter_id)->val;
 
-      if (ii < n_cells)
-        cs_dispatch_sum(&rhs[ii], -fluxi, i_sum_type);
-      if (jj < n_cells)
-        cs_dispatch_sum(&rhs[jj],  fluxj, i_sum_type);
+    int df_limiter_id =
+      cs_field_get_key_int(f, cs_field_key_id("diffusion_limiter_id"));
+    if (df_limiter_id > -1)
+      df_limiter = cs_field_by_id(df_limiter_id)->val;
 
-    });
+    snprintf(var_name, 63, "%s", f->name);
+  }
+  else if (isstpp > 1) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("invalid value of isstpp for a work array"));
+  }
+  else {
+    strncpy(var_name, "[scalar convection-diffusion]", 63);
+  }
+  var_name[63] = '\0';
 
-  /* --> Flux with slope test
-     ============================================*/
+  if (iwarnp >= 2) {
+    if (ischcp == 1) {
+      bft_printf(
+        _(" %s: Convection in centered blending with %f percent of upwind\n"),
+        var_name, (1.-blencp)*100.);
+    }
+    else {
+      bft_printf(
+        _(" %s: Convection in 2nd order blending with %f percent of upwind\n"),
+        var_name, (1.-blencp)*100.);
+    }
+  }
 
+  if (icoupl > 0) {
+    assert(f_id != -1);
+    const int coupling_key_id = cs_field_key_id("coupling_entity");
+    coupling_id = cs_field_get_key_int(f, coupling_key_id);
+    cpl = cs_internal_coupling_by_id(coupling_id);
+    cs_internal_coupling_coupled_faces(cpl,
+                                       &n_local,
+                                       &faces_local,
+                                       &n_distant,
+                                       &faces_distant);
   }
-  else { /* isstpp = 0 */
 
-    if (ischcp < 0 || ischcp > 2) {
-      bft_error(__FILE__, __LINE__, 0,
-                _("invalid value of ischcv"));
-    }
+  /* Compute the balance with reconstruction */
 
-    ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
+  /* Compute the gradient of the variable */
 
-      cs_lnum_t ii = i_face_cells[face_id][0];
-      cs_lnum_t jj = i_face_cells[face_id][1];
+  /* The gradient (grad) is used in the flux reconstruction and the slope test.
+     Thus we must compute it:
+         - when we have diffusion and we reconstruct the fluxes,
+         - when the convection scheme is the legacy SOLU,
+         - when we have convection, we are not in pure upwind
+           and we reconstruct the fluxes,
+         - when we have convection, we are not in pure upwind
+           and we have not shunted the slope test,
+         - when we use NVD / TVD schemes.
+  */
 
-      cs_real_t cpi = 1., cpj = 1.;
-      if (is_thermal) {
-        cpi = xcpp[ii];
-        cpj = xcpp[jj];
+  bool is_ischcp
+    = (   (is_thermal && ischcp == 0)
+       || (is_thermal == false && (ischcp == 0 || ischcp == 3 || ischcp == 4)));
+
+  if (   (idiffp != 0 && ircflp == 1)
+      || (   iconvp != 0 && pure_upwind == false
+          && (ircflp == 1 || isstpp == 0 || is_ischcp))) {
+
+    if (f != NULL) {
+      /* Get the calculation option from the field */
+      if (f->type & CS_FIELD_VARIABLE && eqp.iwgrec == 1) {
+        if (eqp.idiff > 0) {
+          int key_id = cs_field_key_id("gradient_weighting_id");
+          int diff_id = cs_field_get_key_int(f, key_id);
+          if (diff_id > -1) {
+            cs_field_t *weight_f = cs_field_by_id(diff_id);
+            gweight = weight_f->val;
+            w_stride = weight_f->dim;
+            cs_field_synchronize(weight_f, halo_type);
+          }
+        }
       }
+    }
 
-      bool upwind_switch = false;
+    cs_gradient_scalar_synced_input(var_name,
+                                    gradient_type,
+                                    halo_type,
+                                    inc,
+                                    nswrgp,
+                                    0, /* hyd_p_flag */
+                                    w_stride,
+                                    iwarnp,
+                                    imligp,
+                                    epsrgp,
+                                    climgp,
+                                    NULL, /* f_ext exterior force */
+                                    bc_coeffs,
+                                    _pvar,
+                                    gweight, /* Weighted gradient */
+                                    cpl,
+                                    _grad);
 
-      cs_real_t fluxi = 0., fluxj = 0.;
+  }
+  else {
 
-      cs_real_t pif, pjf;
-      cs_real_t pip, pjp;
+    ctx.parallel_for(n_cells_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t cell_id) {
+      _grad[cell_id][0] = 0.;
+      _grad[cell_id][1] = 0.;
+      _grad[cell_id][2] = 0.;
+    });
+    ctx.wait();
+  }
 
-      if (ircflp == 1) {
-        cs_real_t bldfrp = 1.;
-        if (df_limiter != NULL)  /* Local limiter */
-          bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
-                                0.);
+  /* Compute gradients used in convection schemes */
 
-        cs_real_t recoi, recoj;
-        cs_i_compute_quantities(bldfrp,
-                                diipf[face_id], djjpf[face_id],
-                                grad[ii], grad[jj],
-                                _pvar[ii], _pvar[jj],
-                                &recoi, &recoj,
-                                &pip, &pjp);
-      }
-      else {
-        pip = _pvar[ii];
-        pjp = _pvar[jj];
-      }
+  if (iconvp > 0 && pure_upwind == false) {
 
-      const cs_real_t *cell_ceni = cell_cen[ii];
-      const cs_real_t *cell_cenj = cell_cen[jj];
-      const cs_real_t w_f = weight[face_id];
+    /* Compute cell gradient used in slope test */
+    if (isstpp == 0) {
 
-      /* Slope test is needed with convection */
-      if (iconvp > 0) {
-        cs_real_t testij, tesqck;
+      CS_MALLOC_HD(gradst, n_cells_ext, cs_real_3_t, cs_alloc_mode);
 
-        cs_slope_test(_pvar[ii],
-                      _pvar[jj],
-                      i_dist[face_id],
-                      i_face_u_normal[face_id],
-                      grad[ii],
-                      grad[jj],
-                      gradst[ii],
-                      gradst[jj],
-                      i_massflux[face_id],
-                      &testij,
-                      &tesqck);
+      ctx.parallel_for(n_cells_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t cell_id) {
+        gradst[cell_id][0] = 0.;
+        gradst[cell_id][1] = 0.;
+        gradst[cell_id][2] = 0.;
+      });
 
-        if (ischcp == 0) {
+      ctx.wait();
 
-          /* Original SOLU
-             --------------*/
+      cs_slope_test_gradient(f_id,
+                             ctx,
+                             inc,
+                             halo_type,
+                             (const cs_real_3_t *)_grad,
+                             gradst,
+                             _pvar,
+                             bc_coeffs,
+                             i_massflux);
 
-          cs_solu_f_val(cell_ceni,
-                        i_face_cog[face_id],
-                        grad[ii],
-                        _pvar[ii],
-                        &pif);
-          cs_solu_f_val(cell_cenj,
-                        i_face_cog[face_id],
-                        grad[jj],
-                        _pvar[jj],
-                        &pjf);
-        }
-        else if (ischcp == 1) {
+    }
 
-          /* Centered
-             --------*/
+    /* Pure SOLU scheme */
+    if (ischcp == 2 || (is_thermal && ischcp == 4)) {
 
-          pif = w_f*pip + (1.-w_f)*pjp;
-          pjf = pif;
+      CS_MALLOC_HD(gradup, n_cells_ext, cs_real_3_t, cs_alloc_mode);
 
-        }
-        else {
+      ctx.parallel_for(n_cells_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t cell_id) {
+        gradup[cell_id][0] = 0.;
+        gradup[cell_id][1] = 0.;
+        gradup[cell_id][2] = 0.;
+      });
 
-          /* SOLU
-             -----*/
+      ctx.wait();
 
-          cs_solu_f_val(cell_ceni,
-                        i_face_cog[face_id],
-                        gradup[ii],
-                        _pvar[ii],
-                        &pif);
-          cs_solu_f_val(cell_cenj,
-                        i_face_cog[face_id],
-                        gradup[jj],
-                        _pvar[jj],
-                        &pjf);
+      cs_upwind_gradient(f_id,
+                         ctx,
+                         inc,
+                         halo_type,
+                         bc_coeffs,
+                         i_massflux,
+                         b_massflux,
+                         _pvar,
+                         gradup);
 
-        }
+    }
 
-        /* Slope test: percentage of upwind
-           -------------------------------- */
+  }
 
-        if (tesqck <= 0. || testij <= 0.) {
+  /* Switch to gradient storage type used in face loops */
 
-          cs_blend_f_val(blend_st, _pvar[ii], &pif);
-          cs_blend_f_val(blend_st, _pvar[jj], &pjf);
+  _gradient_to_storage(ctx, n_cells_ext, _grad, &grad);
 
-          upwind_switch = true;
+  /* ======================================================================
+    ---> Contribution from interior faces
+    ======================================================================*/
 
-        }
+  short *i_upwind = nullptr;
+  if (eqp.verbosity >= 2 && iconvp == 1 && pure_upwind == false) {
+    CS_MALLOC_HD(i_upwind, n_i_faces, short, cs_alloc_mode);
+    ctx.parallel_for(n_i_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t face_id) {
+      i_upwind[face_id] = 0;
+    });
+    ctx.wait();
+  }
 
-        /* Blending
-           -------- */
+  /* --> Pure upwind flux
+     =====================*/
 
-        cs_blend_f_val(blencp, _pvar[ii], &pif);
-        cs_blend_f_val(blencp, _pvar[jj], &pjf);
+  if (pure_upwind) {
+
+    ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  face_id) {
+
+      cs_lnum_t ii = i_face_cells[face_id][0];
+      cs_lnum_t jj = i_face_cells[face_id][1];
 
+      cs_real_t cpi = 1.0, cpj = 1.0;
+      if (is_thermal) {
+        cpi = xcpp[ii];
+        cpj = xcpp[jj];
       }
-      else { /* If iconv=0 p*fr* are useless */
 
-        pif = _pvar[ii];
-        pjf = _pvar[jj];
+      cs_real_t fluxi = 0., fluxj = 0.;
+      cs_real_t pip, pjp;
 
-      } /* End for slope test */
+      if (ircflp == 1) {
+        cs_real_t bldfrp = 1.;
+        /* Local limitation of the reconstruction */
+        if (df_limiter != NULL && ircflp > 0)
+          bldfrp = cs_math_fmax(cs_math_fmin(df_limiter[ii], df_limiter[jj]),
+                                0.);
 
-      // Convective flux
+        cs_real_t recoi, recoj;
+        cs_i_compute_quantities(bldfrp,
+                                diipf[face_id], djjpf[face_id],
+                                grad[ii], grad[jj],
+                                _pvar[ii], _pvar[jj],
+                                &recoi, &recoj,
+                                &pip, &pjp);
+      }
+      else {
+        pip = _pvar[ii];
+        pjp = _pvar[jj];
+      }
+
+      /* No relaxation in following expressions (pipr = pip, pjpr = pjp) */
+
+      /* Convective flux (as we are upwind, pif == _pvar[ii],
+                                            pjf == _pvar[jj] */
 
       if (iconvp == 1) {
         cs_real_t _i_massflux = i_massflux[face_id];
         cs_real_t flui = 0.5*(_i_massflux + cs_math_fabs(_i_massflux));
         cs_real_t fluj = 0.5*(_i_massflux - cs_math_fabs(_i_massflux));
 
-        fluxi += cpi*(  thetap*(flui*pif + fluj*pjf)
-                      - imasac*_i_massflux*_pvar[ii]);
+        fluxi += cpi*(  thetap * (flui*_pvar[ii] + fluj*_pvar[jj])
+                      - imasac * _i_massflux*_pvar[ii]);
 
-        fluxj += cpj*(  thetap*(flui*pif + fluj*pjf)
-                      - imasac*_i_massflux*_pvar[jj]);
+        fluxj += cpj*(  thetap * (flui*_pvar[ii] + fluj*_pvar[jj])
+                      - imasac *  _i_massflux*_pvar[jj]);
       }
 
-      // Diffusive flux (no relaxation)
+      /* Diffusive flux */
 
       cs_real_t diff_contrib = idiffp*thetap*i_visc[face_id]*(pip - pjp);
       fluxi += diff_contrib;
       fluxj += diff_contrib;
 
-      if (upwind_switch) {
-        /* in parallel, face will be counted by one and only one rank */
-        if (i_upwind != nullptr && ii < n_cells)
-          i_upwind[face_id] = 1;
-
-        if (v_slope_test != NULL) {
-          cs_dispatch_sum(&v_slope_test[ii],
-                          cs_math_fabs(i_massflux[face_id]) / cell_vol[ii],
-                          i_sum_type);
-          cs_dispatch_sum(&v_slope_test[jj],
-                          cs_math_fabs(i_massflux[face_id]) / cell_vol[jj],
-                          i_sum_type);
-        }
-
-      }
-
       if (ii < n_cells)
         cs_dispatch_sum(&rhs[ii], -fluxi, i_sum_type);
       if (jj < n_cells)
         cs_dispatch_sum(&rhs[jj],  fluxj, i_sum_type);
 
     });
+  } /* End pure upwind */
+
+  /* Flux with no slope test or Min/Max Beta limiter
+     =============================================== */
+
+  else if (isstpp == 1 || isstpp == 2) {
+
+    if (ischcp < 0 || ischcp > 4) {
+      bft_error(__FILE__, __LINE__, 0,
+                _("invalid value of ischcv"));
+    }
+
+    /* Select face loop specialized for the convection scheme */
+
+    decltype(&_i_faces_cd_scalar_unsteady<is_thermal, T, 0>) i_faces_cd
+      = nullptr;
+
+    switch (ischcp) {
+    case 0:
+      i_faces_cd = _i_faces_cd_scalar_unsteady<is_thermal, T, 0>;
+      break;
+    case 1:
+      i_faces_cd = _i_faces_cd_scalar_unsteady<is_thermal, T, 1>;
+      break;
+    case 2:
+      i_faces_cd = _i_faces_cd_scalar_unsteady<is_thermal, T, 2>;
+      break;
+    case 3:
+      i_faces_cd = _i_faces_cd_scalar_unsteady<is_thermal, T, 3>;
+      break;
+    default:
+      i_faces_cd = _i_faces_cd_scalar_unsteady<is_thermal, T, 4>;
+    }
+
+    i_faces_cd(ctx, m, fvq, eqp, imasac, limiter_choice,
+               _pvar, grad, gradup,
+               xcpp, i_massflux, i_visc,
+               cv_limiter, df_limiter,
+               courant, local_max, local_min,
+               rhs);
+
+  /* --> Flux with slope test
+     ============================================*/
+
+  }
+  else { /* isstpp = 0 */
+
+    if (ischcp < 0 || ischcp > 2) {
+      bft_error(__FILE__, __LINE__, 0,
+                _("invalid value of ischcv"));
+    }
+
+    /* Select face loop specialized for the convection scheme */
+
+    decltype(&_i_faces_cd_scalar_unsteady_slope_test<is_thermal, T, 0>)
+      i_faces_cd = nullptr;
+
+    switch (ischcp) {
+    case 0:
+      i_faces_cd = _i_faces_cd_scalar_unsteady_slope_test<is_thermal, T, 0>;
+      break;
+    case 1:
+      i_faces_cd = _i_faces_cd_scalar_unsteady_slope_test<is_thermal, T, 1>;
+      break;
+    default:
+      i_faces_cd = _i_faces_cd_scalar_unsteady_slope_test<is_thermal, T, 2>;
+    }
+
+    i_faces_cd(ctx, m, fvq, eqp, imasac,
+               _pvar, grad, gradup, gradst,
+               xcpp, i_massflux, i_visc,
+               df_limiter, v_slope_test, i_upwind,
+               rhs);
   } /* pure upwind, without slope test, with slope test */
 
   ctx.wait();
@@ -7490,6 +7853,55 @@ BEGIN_C_DECLS
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select the assembly algorithm for interior face contributions
+ *        of a given operator kernel.
+ *
+ * With \ref CS_I_FACES_ASSEMBLY_GATHER, the cell -> interior faces
+ * adjacency of the global mesh adjacencies is used, so that each cell
+ * sums contributions of its own faces; this avoids atomic operations on
+ * device and makes results independent of thread scheduling.
+ *
+ * \param[in]  kernel    operator kernel
+ * \param[in]  assembly  interior faces assembly algorithm
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_set_i_faces_assembly
+  (cs_convection_diffusion_kernel_t  kernel,
+   cs_i_faces_assembly_t             assembly)
+{
+  if (kernel < 0 || kernel >= CS_CONVECTION_DIFFUSION_N_KERNELS)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: invalid kernel id (%d)."), __func__, (int)kernel);
+
+  _i_faces_assembly[kernel] = assembly;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the assembly algorithm for interior face contributions
+ *        of a given operator kernel.
+ *
+ * \param[in]  kernel    operator kernel
+ *
+ * \return  interior faces assembly algorithm
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_i_faces_assembly_t
+cs_convection_diffusion_get_i_faces_assembly
+  (cs_convection_diffusion_kernel_t  kernel)
+{
+  if (kernel < 0 || kernel >= CS_CONVECTION_DIFFUSION_N_KERNELS)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: invalid kernel id (%d)."), __func__, (int)kernel);
+
+  return _i_faces_assembly[kernel];
+}
+
 /*----------------------------------------------------------------------------
  * Return pointer to slope test indicator field values if active.
  *
@@ -7715,14 +8127,24 @@ cs_convection_diffusion_scalar(int                         idtvar,
     f = cs_field_by_id(f_id);
 
   if (idtvar >= 0) {
-    _convection_diffusion_scalar_unsteady<false>
-      (f, eqp, icvflb, inc, imasac,
-       pvar, pvara,
-       icvfli,
-       bc_coeffs,
-       i_massflux, b_massflux,
-       i_visc, b_visc,
-       nullptr, rhs);
+    if (_gradient_single_precision(f))
+      _convection_diffusion_scalar_unsteady<false, float>
+        (f, eqp, icvflb, inc, imasac,
+         pvar, pvara,
+         icvfli,
+         bc_coeffs,
+         i_massflux, b_massflux,
+         i_visc, b_visc,
+         nullptr, rhs);
+    else
+      _convection_diffusion_scalar_unsteady<false, cs_real_t>
+        (f, eqp, icvflb, inc, imasac,
+         pvar, pvara,
+         icvfli,
+         bc_coeffs,
+         i_massflux, b_massflux,
+         i_visc, b_visc,
+         nullptr, rhs);
   }
   else {
 
@@ -8508,16 +8930,28 @@ cs_convection_diffusion_thermal(int                         idtvar,
     f = cs_field_by_id(f_id);
 
   if (idtvar >= 0) {
-    _convection_diffusion_scalar_unsteady<true>
-      (f, eqp,
-       false, /* icvflb */
-       inc, imasac,
-       pvar, pvara,
-       nullptr, /* icvfli */
-       bc_coeffs,
-       i_massflux, b_massflux,
-       i_visc, b_visc,
-       xcpp, rhs);
+    if (_gradient_single_precision(f))
+      _convection_diffusion_scalar_unsteady<true, float>
+        (f, eqp,
+         false, /* icvflb */
+         inc, imasac,
+         pvar, pvara,
+         nullptr, /* icvfli */
+         bc_coeffs,
+         i_massflux, b_massflux,
+         i_visc, b_visc,
+         xcpp, rhs);
+    else
+      _convection_diffusion_scalar_unsteady<true, cs_real_t>
+        (f, eqp,
+         false, /* icvflb */
+         inc, imasac,
+         pvar, pvara,
+         nullptr, /* icvfli */
+         bc_coeffs,
+         i_massflux, b_massflux,
+         i_visc, b_visc,
+         xcpp, rhs);
     return;
   }
 
@@ -11948,10 +12382,31 @@ cs_diffusion_potential(const int                   f_id,
   int w_stride = 1;
 
   cs_real_3_t *grad;
-  cs_field_t *f;
+  cs_field_t *f = NULL;
 
   cs_real_t *gweight = NULL;
 
+  /* Interior faces contributions may be gathered by cells
+     (only if cells are not adjacent through multiple faces) */
+
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+
+  const cs_i_faces_assembly_t i_assembly
+    = _i_faces_assembly[CS_CONVECTION_DIFFUSION_KERNEL_DIFFUSION_POTENTIAL];
+
+  const bool i_gather = (   i_assembly == CS_I_FACES_ASSEMBLY_GATHER
+                         && ma->single_faces_to_cells);
+
+  const cs_lnum_t *c2c_idx = nullptr, *c2f = nullptr;
+  const short int *c2f_sgn = nullptr;
+
+  if (i_gather) {
+    cs_mesh_adjacencies_update_cell_i_faces();
+    c2c_idx = ma->cell_cells_idx;
+    c2f = ma->cell_i_faces;
+    c2f_sgn = ma->cell_i_faces_sgn;
+  }
+
   /*==========================================================================
     1. Initialization
     ==========================================================================*/
@@ -11985,10 +12440,21 @@ cs_diffusion_potential(const int                   f_id,
     strncpy(var_name, "[cell mass flux divergence update]", 63);
   var_name[63] = '\0';
 
-  /* Handle parallelism and periodicity */
+  /* Handle parallelism and periodicity; without reconstruction on the host,
+     the exchange is overlapped with the handling of interior faces
+     not adjacent to ghost cells */
 
-  if (halo != NULL)
-    cs_halo_sync_var(halo, halo_type, pvar);
+  cs_halo_state_t *hs = NULL;
+
+  if (halo != NULL) {
+    if (nswrgp <= 1 && cs_get_device_id() < 0 && i_gather == false) {
+      hs = cs_halo_state_get_default();
+      cs_halo_sync_pack(halo, halo_type, CS_REAL_TYPE, 1, pvar, NULL, hs);
+      cs_halo_sync_start(halo, pvar, hs);
+    }
+    else
+      cs_halo_sync_var(halo, halo_type, pvar);
+  }
 
   /*==========================================================================
     2. Update mass flux without reconstruction techniques
@@ -11998,19 +12464,51 @@ cs_diffusion_potential(const int                   f_id,
 
     /* Mass flow through interior faces */
 
-    ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t face_id) {
+    auto i_face_flux = [=] CS_F_HOST_DEVICE (cs_lnum_t face_id) {
 
       cs_lnum_t ii = i_face_cells[face_id][0];
       cs_lnum_t jj = i_face_cells[face_id][1];
 
-      cs_real_t i_massflux = i_visc[face_id]*(pvar[ii] - pvar[jj]);
+      return i_visc[face_id]*(pvar[ii] - pvar[jj]);
 
-      if (ii < n_cells)
-        cs_dispatch_sum(&diverg[ii],  i_massflux, i_sum_type);
-      if (jj < n_cells)
-        cs_dispatch_sum(&diverg[jj], -i_massflux, i_sum_type);
+    };
 
-    });
+    if (i_gather) {
+
+      ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+
+        cs_real_t c_sum = 0;
+
+        for (cs_lnum_t cidx = c2c_idx[c_id]; cidx < c2c_idx[c_id+1]; cidx++)
+          c_sum += c2f_sgn[cidx] * i_face_flux(c2f[cidx]);
+
+        diverg[c_id] += c_sum;
+
+      });
+
+    }
+    else {
+
+      auto i_face_scatter = [=] CS_F_HOST_DEVICE (cs_lnum_t face_id) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        cs_real_t i_massflux = i_face_flux(face_id);
+
+        if (ii < n_cells)
+          cs_dispatch_sum(&diverg[ii],  i_massflux, i_sum_type);
+        if (jj < n_cells)
+          cs_dispatch_sum(&diverg[jj], -i_massflux, i_sum_type);
+
+      };
+
+      if (hs != NULL)
+        _i_faces_halo_overlap(m, hs, pvar, i_face_scatter);
+      else
+        ctx.parallel_for_i_faces(m, i_face_scatter);
+
+    }
 
     /* Mass flow through boundary faces */
 
@@ -12097,7 +12595,7 @@ cs_diffusion_potential(const int                   f_id,
 
     /* Mass flow through interior faces */
 
-    ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t face_id) {
+    auto i_face_flux = [=] CS_F_HOST_DEVICE (cs_lnum_t face_id) {
 
       cs_lnum_t ii = i_face_cells[face_id][0];
       cs_lnum_t jj = i_face_cells[face_id][1];
@@ -12126,12 +12624,41 @@ cs_diffusion_potential(const int                   f_id,
                          - cs_math_3_dot_product(grad[jj], djjpf[face_id]));
       }
 
-      if (ii < n_cells)
-        cs_dispatch_sum(&diverg[ii],  i_massflux, i_sum_type);
-      if (jj < n_cells)
-        cs_dispatch_sum(&diverg[jj], -i_massflux, i_sum_type);
+      return i_massflux;
 
-    });
+    };
+
+    if (i_gather) {
+
+      ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+
+        cs_real_t c_sum = 0;
+
+        for (cs_lnum_t cidx = c2c_idx[c_id]; cidx < c2c_idx[c_id+1]; cidx++)
+          c_sum += c2f_sgn[cidx] * i_face_flux(c2f[cidx]);
+
+        diverg[c_id] += c_sum;
+
+      });
+
+    }
+    else {
+
+      ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t face_id) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        cs_real_t i_massflux = i_face_flux(face_id);
+
+        if (ii < n_cells)
+          cs_dispatch_sum(&diverg[ii],  i_massflux, i_sum_type);
+        if (jj < n_cells)
+          cs_dispatch_sum(&diverg[jj], -i_massflux, i_sum_type);
+
+      });
+
+    }
 
     /* Mass flow through boundary faces */
 
@@ -77,6 +77,34 @@ typedef enum {
 
 } cs_nvd_type_t;
 
+/*----------------------------------------------------------------------------
+ * Operator kernels with selectable interior faces assembly
+ *----------------------------------------------------------------------------*/
+
+typedef enum {
+
+  CS_CONVECTION_DIFFUSION_KERNEL_DIFFUSION_POTENTIAL,  /* cs_diffusion_potential
+                                                          interior faces */
+  CS_CONVECTION_DIFFUSION_N_KERNELS
+
+} cs_convection_diffusion_kernel_t;
+
+/*----------------------------------------------------------------------------
+ * Assembly of interior face contributions to cells
+ *----------------------------------------------------------------------------*/
+
+typedef enum {
+
+  CS_I_FACES_ASSEMBLY_SCATTER,  /* loop on faces, contributions added to
+                                   both adjacent cells (using atomic sums
+                                   on device) */
+  CS_I_FACES_ASSEMBLY_GATHER    /* loop on cells, each summing contributions
+                                   of its adjacent faces (no atomic sums,
+                                   deterministic, but face values are
+                                   computed twice) */
+
+} cs_i_faces_assembly_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -89,6 +117,36 @@ typedef enum {
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select the assembly algorithm for interior face contributions
+ *        of a given operator kernel.
+ *
+ * \param[in]  kernel    operator kernel
+ * \param[in]  assembly  interior faces assembly algorithm
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_convection_diffusion_set_i_faces_assembly
+  (cs_convection_diffusion_kernel_t  kernel,
+   cs_i_faces_assembly_t             assembly);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the assembly algorithm for interior face contributions
+ *        of a given operator kernel.
+ *
+ * \param[in]  kernel    operator kernel
+ *
+ * \return  interior faces assembly algorithm
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_i_faces_assembly_t
+cs_convection_diffusion_get_i_faces_assembly
+  (cs_convection_diffusion_kernel_t  kernel);
+
 /*----------------------------------------------------------------------------
  * Return pointer to slope test indicator field values if active.
  *
@@ -389,6 +389,9 @@ cs_nvd_vof_scheme_scalar(cs_nvd_type_t    limiter,
 /*!
  * \brief Compute slope test criteria at internal face between cell i and j.
  *
+ * template parameters:
+ *   T             gradient storage type (cs_real_t or float)
+ *
  * \param[in]     pi                value at cell i
  * \param[in]     pj                value at cell j
  * \param[in]     distf             distance IJ.Nij
@@ -403,13 +406,14 @@ cs_nvd_vof_scheme_scalar(cs_nvd_type_t    limiter,
  */
 /*----------------------------------------------------------------------------*/
 
+template <typename T>
 CS_F_HOST_DEVICE inline static void
 cs_slope_test(const cs_real_t   pi,
               const cs_real_t   pj,
               const cs_real_t   distf,
               const cs_real_t   i_face_u_normal[3],
-              const cs_real_t   gradi[3],
-              const cs_real_t   gradj[3],
+              const T           gradi[3],
+              const T           gradj[3],
               const cs_real_t   grdpai[3],
               const cs_real_t   grdpaj[3],
               const cs_real_t   i_massflux,
@@ -520,6 +524,9 @@ cs_slope_test_strided(const cs_real_t   pi[stride],
 /*!
  * \brief Reconstruct values in I' and J'.
  *
+ * template parameters:
+ *   T             gradient storage type (cs_real_t or float)
+ *
  * \param[in]     bldfrp       reconstruction blending factor
  * \param[in]     diipf        distance II'
  * \param[in]     djjpf        distance JJ'
@@ -534,12 +541,13 @@ cs_slope_test_strided(const cs_real_t   pi[stride],
  */
 /*----------------------------------------------------------------------------*/
 
+template <typename T>
 CS_F_HOST_DEVICE inline static void
 cs_i_compute_quantities(const cs_real_t    bldfrp,
                         const cs_real_3_t  diipf,
                         const cs_real_3_t  djjpf,
-                        const cs_real_3_t  gradi,
-                        const cs_real_3_t  gradj,
+                        const T            gradi[3],
+                        const T            gradj[3],
                         const cs_real_t    pi,
                         const cs_real_t    pj,
                         cs_real_t         *recoi,
@@ -782,6 +790,9 @@ cs_centered_f_val_strided(double           pnd,
 /*!
  * \brief Prepare value at face ij by using a Second Order Linear Upwind scheme.
  *
+ * template parameters:
+ *   T             gradient storage type (cs_real_t or float)
+ *
  * \param[in]     cell_cen     center of gravity coordinates of cell
  * \param[in]     i_face_cog   center of gravity coordinates of face
  * \param[in]     grad         gradient at cell
@@ -790,10 +801,11 @@ cs_centered_f_val_strided(double           pnd,
  */
 /*----------------------------------------------------------------------------*/
 
+template <typename T>
 CS_F_HOST_DEVICE inline static void
 cs_solu_f_val(const cs_real_t   cell_cen[3],
               const cs_real_t   i_face_cog[3],
-              const cs_real_t   grad[3],
+              const T           grad[3],
               const cs_real_t   p,
               cs_real_t        *pf)
 {
@@ -803,7 +815,7 @@ cs_solu_f_val(const cs_real_t   cell_cen[3],
   df[1] = i_face_cog[1] - cell_cen[1];
   df[2] = i_face_cog[2] - cell_cen[2];
 
-  *pf = p + cs_math_3_dot_product(df, grad);
+  *pf = p + df[0]*grad[0] + df[1]*grad[1] + df[2]*grad[2];
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2596,6 +2608,9 @@ cs_central_downwind_cells(const cs_lnum_t    ii,
  * \brief Handle preparation of internal face values for the convection flux
  *        computation in case of an unsteady algorithm and using NVD schemes.
  *
+ * template parameters:
+ *   T             gradient storage type (cs_real_t or float)
+ *
  * \param[in]     limiter         choice of the NVD scheme
  * \param[in]     beta            proportion of second order scheme,
  *                                (1-blencp) is the proportion of upwind.
@@ -2614,6 +2629,7 @@ cs_central_downwind_cells(const cs_lnum_t    ii,
  */
 /*----------------------------------------------------------------------------*/
 
+template <typename T>
 CS_F_HOST_DEVICE inline static void
 cs_i_cd_unsteady_nvd(const cs_nvd_type_t  limiter,
                      const double         beta,
@@ -2621,7 +2637,7 @@ cs_i_cd_unsteady_nvd(const cs_nvd_type_t  limiter,
                      const cs_real_3_t    cell_cen_d,
                      const cs_real_3_t    i_face_u_normal,
                      const cs_real_3_t    i_face_cog,
-                     const cs_real_3_t    gradv_c,
+                     const T              gradv_c[3],
                      const cs_real_t      p_c,
                      const cs_real_t      p_d,
                      const cs_real_t      local_max_c,
@@ -2630,7 +2646,8 @@ cs_i_cd_unsteady_nvd(const cs_nvd_type_t  limiter,
                      cs_real_t           *pif,
                      cs_real_t           *pjf)
 {
-  /* distance between face center and central cell center */
+  const cs_real_t _gradv_c[3] = {gradv_c[0], gradv_c[1], gradv_c[2]};
+
   /* Distance between face center and central cell center */
   cs_real_t dist_fc = cs_math_3_distance(cell_cen_c, i_face_cog);
 
@@ -2654,7 +2671,7 @@ cs_i_cd_unsteady_nvd(const cs_nvd_type_t  limiter,
 
   /* Compute the property on the upwind assuming a parabolic
      variation of the property between the two cells */
-  const cs_real_t gradc = cs_math_3_dot_product(gradv_c, ndc);
+  const cs_real_t gradc = cs_math_3_dot_product(_gradv_c, ndc);
 
   const cs_real_t grad2c = ((p_d - p_c)/dist_dc - gradc)/dist_dc;
 
@@ -2689,7 +2706,7 @@ cs_i_cd_unsteady_nvd(const cs_nvd_type_t  limiter,
                                            nvf_p_c,
                                            nvf_r_f,
                                            nvf_r_c,
-                                           gradv_c,
+                                           _gradv_c,
                                            courant_c);
       } else { /* Regular NVD scheme */
         nvf_p_f = cs_nvd_scheme_scalar(limiter,
@@ -2876,6 +2893,9 @@ cs_i_cd_unsteady_slope_test_strided(bool             *upwind_switch,
 /*!
  * \brief Reconstruct values in I' at boundary cell i.
  *
+ * template parameters:
+ *   T             gradient storage type (cs_real_t or float)
+ *
  * \param[in]     diipb    distance I'I'
  * \param[in]     gradi    gradient at cell i
  * \param[in]     bldfrp   reconstruction blending factor
@@ -2883,9 +2903,10 @@ cs_i_cd_unsteady_slope_test_strided(bool             *upwind_switch,
  */
 /*----------------------------------------------------------------------------*/
 
+template <typename T>
 CS_F_HOST_DEVICE inline static void
 cs_b_compute_quantities(const cs_real_3_t  diipb,
-                        const cs_real_3_t  gradi,
+                        const T            gradi[3],
                         const cs_real_t    bldfrp,
                         cs_real_t         *recoi)
 {
@@ -3410,6 +3431,9 @@ cs_b_cd_steady_strided(cs_real_t        bldfrp,
  * \brief Handle preparation of boundary face values for the flux computation in
  * case of an unsteady algorithm.
  *
+ * template parameters:
+ *   T             gradient storage type (cs_real_t or float)
+ *
  * \param[in]     bldfrp   reconstruction blending factor
  * \param[in]     diipb    distance I'I'
  * \param[in]     gradi    gradient at cell i
@@ -3418,10 +3442,11 @@ cs_b_cd_steady_strided(cs_real_t        bldfrp,
  */
 /*----------------------------------------------------------------------------*/
 
+template <typename T>
 CS_F_HOST_DEVICE inline static void
 cs_b_cd_unsteady(const cs_real_t    bldfrp,
                  const cs_real_3_t  diipb,
-                 const cs_real_3_t  gradi,
+                 const T            gradi[3],
                  const cs_real_t    pi,
                  cs_real_t         *pip)
 {
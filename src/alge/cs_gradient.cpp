@@ -59,6 +59,7 @@
 #include "cs_blas.h"
 #include "cs_boundary_conditions.h"
 #include "cs_cell_to_vertex.h"
+#include "cs_dispatch.h"
 #include "cs_ext_neighborhood.h"
 #include "cs_field.h"
 #include "cs_field_pointer.h"
@@ -72,6 +73,7 @@
 #include "cs_mesh_adjacencies.h"
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
+#include "cs_perf_summary.h"
 #include "cs_porous_model.h"
 #include "cs_prototypes.h"
 #include "cs_timer.h"
@@ -135,6 +137,25 @@ typedef struct {
   cs_cocg_6_t   *cocg_lsq_ext;     /* Interleaved cocg matrix for least
                                       squares gradients with ext. neighbors */
 
+  /* Cache state: arrays are kept allocated (possibly on device) when the
+     mesh moves, and only recomputed when used after an invalidation. */
+
+  cs_lnum_t      n_cells_ext;      /* number of cells (with ghosts) and */
+  cs_lnum_t      n_b_cells;        /* boundary cells for which arrays
+                                      are sized */
+
+  const cs_lnum_t  *cell_cells_lst;  /* extended neighborhood for which
+                                        cocg_lsq_ext was computed */
+
+  bool           it_valid;         /* is cocg_it up to date ? */
+  bool           lsq_valid[2];     /* are cocg_lsq and cocg_lsq_ext
+                                      up to date ? */
+  bool           lsq_on_device[2]; /* are device copies of cocg_lsq and
+                                      cocg_lsq_ext (and matching cocgb)
+                                      up to date ? */
+
+  unsigned       n_builds;         /* number of cocg computations */
+
 } cs_gradient_quantities_t;
 
 /* Basic per gradient computation options and logging */
@@ -193,6 +214,10 @@ const cs_e2n_sum_t _e2n_sum_type = CS_E2N_SUM_SCATTER;
 
 static int _use_legacy_strided_lsq_gradient = false;
 
+/* Halo state for variable synchronization overlapped with computation */
+
+static cs_halo_state_t *_gradient_halo_state = nullptr;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -253,6 +278,16 @@ _gradient_quantities_get(int  id)
       gq->cocg_lsq = nullptr;
       gq->cocgb_s_lsq_ext = nullptr;
       gq->cocg_lsq_ext = nullptr;
+
+      gq->n_cells_ext = 0;
+      gq->n_b_cells = 0;
+      gq->cell_cells_lst = nullptr;
+      gq->it_valid = false;
+      for (int j = 0; j < 2; j++) {
+        gq->lsq_valid[j] = false;
+        gq->lsq_on_device[j] = false;
+      }
+      gq->n_builds = 0;
     }
 
     _n_gradient_quantities = id+1;
@@ -275,11 +310,11 @@ _gradient_quantities_destroy(void)
 
     cs_gradient_quantities_t  *gq = _gradient_quantities + i;
 
-    BFT_FREE(gq->cocg_it);
-    BFT_FREE(gq->cocgb_s_lsq);
-    BFT_FREE(gq->cocg_lsq);
-    BFT_FREE(gq->cocgb_s_lsq_ext);
-    BFT_FREE(gq->cocg_lsq_ext);
+    CS_FREE_HD(gq->cocg_it);
+    CS_FREE_HD(gq->cocgb_s_lsq);
+    CS_FREE_HD(gq->cocg_lsq);
+    CS_FREE_HD(gq->cocgb_s_lsq_ext);
+    CS_FREE_HD(gq->cocg_lsq_ext);
 
   }
 
@@ -287,6 +322,86 @@ _gradient_quantities_destroy(void)
   _n_gradient_quantities = 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Free arrays of a gradient quantities structure if the mesh
+ *         size changed since they were allocated.
+ *
+ * Arrays are otherwise kept, so that mesh motion does not require
+ * reallocation (and arrays may stay resident on device).
+ *
+ * \param[in]       m   pointer to mesh
+ * \param[in, out]  gq  pointer to gradient quantities structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_gradient_quantities_check_size(const cs_mesh_t           *m,
+                                cs_gradient_quantities_t  *gq)
+{
+  if (   gq->n_cells_ext == m->n_cells_with_ghosts
+      && gq->n_b_cells == m->n_b_cells)
+    return;
+
+  CS_FREE_HD(gq->cocg_it);
+  CS_FREE_HD(gq->cocgb_s_lsq);
+  CS_FREE_HD(gq->cocg_lsq);
+  CS_FREE_HD(gq->cocgb_s_lsq_ext);
+  CS_FREE_HD(gq->cocg_lsq_ext);
+
+  gq->n_cells_ext = m->n_cells_with_ghosts;
+  gq->n_b_cells = m->n_b_cells;
+  gq->cell_cells_lst = nullptr;
+  gq->it_valid = false;
+  for (int j = 0; j < 2; j++) {
+    gq->lsq_valid[j] = false;
+    gq->lsq_on_device[j] = false;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Log footprint and number of computations of cached gradient
+ *         quantities.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_gradient_quantities_log(void)
+{
+  unsigned long long n_builds = 0;
+  double n_bytes = 0;
+
+  for (int i = 0; i < _n_gradient_quantities; i++) {
+
+    const cs_gradient_quantities_t  *gq = _gradient_quantities + i;
+
+    n_builds += gq->n_builds;
+
+    if (gq->cocg_it != nullptr)
+      n_bytes += gq->n_cells_ext * sizeof(cs_real_33_t);
+    if (gq->cocg_lsq != nullptr)
+      n_bytes +=   gq->n_cells_ext * sizeof(cs_cocg_6_t)
+                 + gq->n_b_cells * sizeof(cs_cocg_6_t);
+    if (gq->cocg_lsq_ext != nullptr)
+      n_bytes +=   gq->n_cells_ext * sizeof(cs_cocg_6_t)
+                 + gq->n_b_cells * sizeof(cs_cocg_6_t);
+
+  }
+
+  cs_parall_max(1, CS_DOUBLE, &n_bytes);
+
+  if (n_builds == 0)
+    return;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Gradient geometric quantities:\n"
+                  "  number of computations:            %llu\n"
+                  "  cache footprint (max per rank):    %.3f MiB\n"),
+                n_builds, n_bytes / (1024.*1024.));
+}
+
 /*----------------------------------------------------------------------------
  * Factorize dense p*p symmetric matrices.
  * Only the lower triangular part is stored and the factorization is performed
@@ -1705,11 +1820,17 @@ _compute_cell_cocg_it(const cs_mesh_t               *m,
   cs_real_t  pfac, vecfac;
   cs_real_t  dvol1, dvol2;
 
+  _gradient_quantities_check_size(m, gq);
+  cocg = gq->cocg_it;
+
   if (cocg == nullptr) {
     CS_MALLOC_HD(cocg, n_cells_with_ghosts, cs_real_33_t, cs_alloc_mode);
     gq->cocg_it = cocg;
   }
 
+  gq->it_valid = true;
+  gq->n_builds += 1;
+
   /* compute the dimensionless matrix COCG for each cell*/
 
   for (cell_id = 0; cell_id < n_cells_with_ghosts; cell_id++) {
@@ -1863,7 +1984,7 @@ _iterative_scalar_gradient(const cs_mesh_t                *m,
   cs_gradient_quantities_t  *gq = _gradient_quantities_get(gq_id);
 
   cs_real_33_t *restrict cocg = gq->cocg_it;
-  if (cocg == nullptr)
+  if (cocg == nullptr || gq->it_valid == false)
     cocg = _compute_cell_cocg_it(m, fvq, cpl, gq);
 
   cs_lnum_t   cpl_stride = 0;
@@ -2401,6 +2522,8 @@ _compute_cell_cocg_lsq(const cs_mesh_t               *m,
 
   /* Map cocg/cocgb to correct structure, reallocate if needed */
 
+  _gradient_quantities_check_size(m, gq);
+
   if (extended) {
     cocg = gq->cocg_lsq_ext;
     cocgb = gq->cocgb_s_lsq_ext;
@@ -2428,6 +2551,14 @@ _compute_cell_cocg_lsq(const cs_mesh_t               *m,
 
   }
 
+  const int e_id = (extended) ? 1 : 0;
+
+  gq->lsq_valid[e_id] = true;
+  gq->lsq_on_device[e_id] = false;
+  if (extended)
+    gq->cell_cells_lst = m->cell_cells_lst;
+  gq->n_builds += 1;
+
   /* Initialization */
 
 # pragma omp parallel
@@ -2589,20 +2720,24 @@ _get_cell_cocg_lsq(const cs_mesh_t               *m,
   bool extended = (   halo_type == CS_HALO_EXTENDED
                    && m->cell_cells_idx) ? true : false;
 
+  const int e_id = (extended) ? 1 : 0;
+
   if (extended) {
     _cocg = gq->cocg_lsq_ext;
+    if (gq->cell_cells_lst != m->cell_cells_lst)
+      gq->lsq_valid[e_id] = false;
   }
   else {
     _cocg = gq->cocg_lsq;
   }
 
-  /* Compute if not present yet.
+  /* Compute if not present yet or invalidated by a mesh update.
    *
    * TODO: when using accelerators, this implies a first computation will be
    *       run on the host. This will usually be amortized, but could be
    *       further improved. */
 
-  if (_cocg == nullptr)
+  if (_cocg == nullptr || gq->lsq_valid[e_id] == false)
     _compute_cell_cocg_lsq(m, extended, fvq, gq);
 
   /* If used on accelerator, ensure arrays are available there */
@@ -2640,18 +2775,30 @@ _get_cell_cocg_lsq(const cs_mesh_t               *m,
       *cocgb = gq->cocgb_s_lsq;
   }
 
-  /* If used on accelerator, copy/prefetch values and switch to
-     device pointers */
+  /* If used on accelerator, copy/prefetch values (only once after each
+     computation, as arrays then stay resident on the device) and switch
+     to device pointers */
 
   if (accel) {
-    cs_sync_h2d(*cocg);
+    if (gq->lsq_on_device[e_id] == false) {
+      cs_sync_h2d(*cocg);
+      if (extended)
+        cs_sync_h2d(gq->cocgb_s_lsq_ext);
+      else
+        cs_sync_h2d(gq->cocgb_s_lsq);
+      gq->lsq_on_device[e_id] = true;
+    }
+
     *cocg = (cs_cocg_6_t *)cs_get_device_ptr(*cocg);
 
-    if (cocgb != nullptr) {
-      cs_sync_h2d(*cocgb);
+    if (cocgb != nullptr)
       *cocgb = (cs_cocg_6_t *)cs_get_device_ptr(*cocgb);
-    }
   }
+
+  /* Host callers may update boundary values of cocg in place */
+
+  else
+    gq->lsq_on_device[e_id] = false;
 }
 
 /*----------------------------------------------------------------------------
@@ -2735,6 +2882,8 @@ _recompute_lsq_scalar_cocg(const cs_mesh_t                *m,
  *   pvar           <-- variable
  *   c_weight       <-- weighted gradient coefficient variable,
  *                      or NULL
+ *   pvar_hs        <-- halo state for pending synchronization of pvar,
+ *                      or NULL
  *   grad           --> gradient of pvar (halo prepared for periodicity
  *                      of rotation)
  *----------------------------------------------------------------------------*/
@@ -2748,6 +2897,7 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
                      const cs_field_bc_coeffs_t     *bc_coeffs,
                      const cs_real_t                 pvar[],
                      const cs_real_t       *restrict c_weight,
+                     cs_halo_state_t                *pvar_hs,
                      cs_real_3_t           *restrict grad)
 {
   const cs_real_t *coefap = bc_coeffs->a;
@@ -2796,6 +2946,9 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 #if defined(HAVE_CUDA)
 
   if (accel) {
+    if (pvar_hs != nullptr)
+      cs_halo_sync_wait(m->halo, const_cast<cs_real_t *>(pvar), pvar_hs);
+
     cs_gradient_scalar_lsq_cuda(m,
                                 fvq,
                                 halo_type,
@@ -2831,8 +2984,14 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
   cs_real_4_t  *restrict rhsv;
   BFT_MALLOC(rhsv, n_cells_ext, cs_real_4_t);
 
+  /* If pvar's ghost values are still being exchanged, faces
+     not adjacent to ghost cells are handled first; the face
+     order (and thus results) is the same in both cases. */
+
+  const cs_lnum_t n_c_ini = (pvar_hs != nullptr) ? n_cells : n_cells_ext;
+
 # pragma omp parallel for
-  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+  for (cs_lnum_t c_id = 0; c_id < n_c_ini; c_id++) {
     rhsv[c_id][0] = 0.0;
     rhsv[c_id][1] = 0.0;
     rhsv[c_id][2] = 0.0;
@@ -2841,62 +3000,97 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
   /* Contribution from interior faces */
 
-  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+  int g_range[2][2] = {{0, 0}, {0, n_i_groups}};
+  cs_lnum_t f_range[2][2] = {{0, 0}, {0, m->n_i_faces}};
 
-#   pragma omp parallel for
-    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+  if (pvar_hs != nullptr) {
+    const cs_numbering_t *i_numbering = m->i_face_numbering;
+    if (n_i_threads > 1) {
+      g_range[0][1] = i_numbering->n_no_adj_halo_groups;
+      g_range[1][0] = i_numbering->n_no_adj_halo_groups;
+    }
+    else {
+      f_range[0][1] = i_numbering->n_no_adj_halo_elts;
+      f_range[1][0] = i_numbering->n_no_adj_halo_elts;
+    }
+  }
 
-      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-           f_id++) {
+  for (int pass = 0; pass < 2; pass++) {
 
-        cs_lnum_t ii = i_face_cells[f_id][0];
-        cs_lnum_t jj = i_face_cells[f_id][1];
+    if (pass == 1 && pvar_hs != nullptr) {
+      cs_halo_sync_wait(m->halo, const_cast<cs_real_t *>(pvar), pvar_hs);
 
-        cs_real_t pond = weight[f_id];
+      for (cs_lnum_t c_id = n_cells; c_id < n_cells_ext; c_id++) {
+        rhsv[c_id][0] = 0.0;
+        rhsv[c_id][1] = 0.0;
+        rhsv[c_id][2] = 0.0;
+        rhsv[c_id][3] = pvar[c_id];
+      }
+    }
 
-        cs_real_t pfac, dc[3], fctb[4];
+    for (int g_id = g_range[pass][0]; g_id < g_range[pass][1]; g_id++) {
 
-        for (cs_lnum_t ll = 0; ll < 3; ll++)
-          dc[ll] = cell_f_cen[jj][ll] - cell_f_cen[ii][ll];
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-        if (c_weight != nullptr) {
-          /* (P_j - P_i) / ||d||^2 */
-          pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                 / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+        cs_lnum_t s_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+        cs_lnum_t e_id = i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+        if (n_i_threads == 1) {
+          s_id = CS_MAX(s_id, f_range[pass][0]);
+          e_id = CS_MIN(e_id, f_range[pass][1]);
+        }
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            fctb[ll] = dc[ll] * pfac;
+        for (cs_lnum_t f_id = s_id; f_id < e_id; f_id++) {
 
-          cs_real_t denom = 1. / (  pond       *c_weight[ii]
-                                  + (1. - pond)*c_weight[jj]);
+          cs_lnum_t ii = i_face_cells[f_id][0];
+          cs_lnum_t jj = i_face_cells[f_id][1];
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            rhsv[ii][ll] +=  c_weight[jj] * denom * fctb[ll];
+          cs_real_t pond = weight[f_id];
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            rhsv[jj][ll] +=  c_weight[ii] * denom * fctb[ll];
-        }
-        else {
-          /* (P_j - P_i) / ||d||^2 */
-          pfac =   (rhsv[jj][3] - rhsv[ii][3])
-                 / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+          cs_real_t pfac, dc[3], fctb[4];
 
           for (cs_lnum_t ll = 0; ll < 3; ll++)
-            fctb[ll] = dc[ll] * pfac;
+            dc[ll] = cell_f_cen[jj][ll] - cell_f_cen[ii][ll];
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            rhsv[ii][ll] += fctb[ll];
+          if (c_weight != nullptr) {
+            /* (P_j - P_i) / ||d||^2 */
+            pfac =   (rhsv[jj][3] - rhsv[ii][3])
+                   / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-          for (cs_lnum_t ll = 0; ll < 3; ll++)
-            rhsv[jj][ll] += fctb[ll];
-        }
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              fctb[ll] = dc[ll] * pfac;
 
-      } /* loop on faces */
+            cs_real_t denom = 1. / (  pond       *c_weight[ii]
+                                    + (1. - pond)*c_weight[jj]);
 
-    } /* loop on threads */
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              rhsv[ii][ll] +=  c_weight[jj] * denom * fctb[ll];
 
-  } /* loop on thread groups */
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              rhsv[jj][ll] +=  c_weight[ii] * denom * fctb[ll];
+          }
+          else {
+            /* (P_j - P_i) / ||d||^2 */
+            pfac =   (rhsv[jj][3] - rhsv[ii][3])
+                   / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              fctb[ll] = dc[ll] * pfac;
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              rhsv[ii][ll] += fctb[ll];
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              rhsv[jj][ll] += fctb[ll];
+          }
+
+        } /* loop on faces */
+
+      } /* loop on threads */
+
+    } /* loop on thread groups */
+
+  } /* loop on passes */
 
   /* Contribution from extended neighborhood */
 
@@ -2982,6 +3176,297 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
   BFT_FREE(rhsv);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of several scalar fields using least-squares
+ * reconstruction, in a single pass over faces.
+ *
+ * Geometric quantities and face->cell connectivity are loaded once per
+ * face for all fields. Boundary cell cocg values are rebuilt locally for
+ * each field (as they depend on its B.C. coefficients), so the shared
+ * cocg array is not modified, and results are identical to those of
+ * separate calls to _lsq_scalar_gradient with recompute_cocg = true.
+ *
+ * Ghost cell values of pvar are assumed to be synchronized.
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   halo_type      <-- halo type (extended or not)
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   n_fields       <-- number of fields
+ *   bc_coeffs      <-- B.C. structure for each field
+ *   pvar           <-- values of each field
+ *   grad           --> gradient of each field (halo prepared for
+ *                      periodicity of rotation)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_gradient_multi(const cs_mesh_t                *m,
+                           const cs_mesh_quantities_t     *fvq,
+                           cs_halo_type_t                  halo_type,
+                           cs_real_t                       inc,
+                           int                             n_fields,
+                           const cs_field_bc_coeffs_t     *bc_coeffs[],
+                           const cs_real_t                *pvar[],
+                           cs_real_3_t                    *grad[])
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *)m->b_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *)m->cell_cells_lst;
+
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+  const cs_lnum_t *restrict cell_b_faces_idx
+    = (const cs_lnum_t *)ma->cell_b_faces_idx;
+  const cs_lnum_t *restrict cell_b_faces
+    = (const cs_lnum_t *)ma->cell_b_faces;
+
+  const cs_real_3_t *restrict cell_f_cen
+    = (const cs_real_3_t *)fvq->cell_f_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *)fvq->b_face_normal;
+  const cs_real_3_t *restrict b_face_u_normal
+    = (const cs_real_3_t *)fvq->b_face_u_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *)fvq->b_dist;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *)fvq->diipb;
+
+  const cs_lnum_t n = n_fields;
+
+  cs_cocg_6_t  *restrict cocgb = nullptr;
+  cs_cocg_6_t  *restrict cocg = nullptr;
+
+  _get_cell_cocg_lsq(m, halo_type, false, fvq, &cocg, &cocgb);
+
+  /* Compute Right-Hand Side, interlaced by field */
+  /*----------------------------------------------*/
+
+  cs_real_3_t  *restrict rhsv;
+  BFT_MALLOC(rhsv, n_cells_ext*n, cs_real_3_t);
+
+# pragma omp parallel for
+  for (cs_lnum_t i = 0; i < n_cells_ext*n; i++) {
+    rhsv[i][0] = 0.0;
+    rhsv[i][1] = 0.0;
+    rhsv[i][2] = 0.0;
+  }
+
+  /* Contribution from interior faces */
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
+
+        cs_lnum_t ii = i_face_cells[f_id][0];
+        cs_lnum_t jj = i_face_cells[f_id][1];
+
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_f_cen[jj][ll] - cell_f_cen[ii][ll];
+
+        cs_real_t ddc = dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2];
+
+        for (cs_lnum_t k = 0; k < n; k++) {
+          /* (P_j - P_i) / ||d||^2 */
+          cs_real_t pfac = (pvar[k][jj] - pvar[k][ii]) / ddc;
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++) {
+            cs_real_t fctb = dc[ll] * pfac;
+            rhsv[ii*n + k][ll] += fctb;
+            rhsv[jj*n + k][ll] += fctb;
+          }
+        }
+
+      } /* loop on faces */
+
+    } /* loop on threads */
+
+  } /* loop on thread groups */
+
+  /* Contribution from extended neighborhood */
+
+  if (halo_type == CS_HALO_EXTENDED && cell_cells_idx != nullptr) {
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      for (cs_lnum_t cidx = cell_cells_idx[ii];
+           cidx < cell_cells_idx[ii+1];
+           cidx++) {
+
+        cs_lnum_t jj = cell_cells_lst[cidx];
+
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_f_cen[jj][ll] - cell_f_cen[ii][ll];
+
+        cs_real_t ddc = dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2];
+
+        for (cs_lnum_t k = 0; k < n; k++) {
+          cs_real_t pfac = (pvar[k][jj] - pvar[k][ii]) / ddc;
+
+          for (cs_lnum_t ll = 0; ll < 3; ll++)
+            rhsv[ii*n + k][ll] += dc[ll] * pfac;
+        }
+
+      }
+    }
+
+  } /* End for extended neighborhood */
+
+  /* Contribution from boundary faces */
+
+# pragma omp parallel for
+  for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+    for (cs_lnum_t f_id = b_group_index[t_id*2];
+         f_id < b_group_index[t_id*2 + 1];
+         f_id++) {
+
+      cs_lnum_t ii = b_face_cells[f_id];
+
+      cs_real_t unddij = 1. / b_dist[f_id];
+      cs_real_t udbfs = 1. / b_face_surf[f_id];
+
+      for (cs_lnum_t k = 0; k < n; k++) {
+
+        const cs_real_t coefap = bc_coeffs[k]->a[f_id];
+        const cs_real_t coefbp = bc_coeffs[k]->b[f_id];
+
+        cs_real_t umcbdd = (1. - coefbp) * unddij;
+
+        cs_real_t pfac =   (coefap*inc + (coefbp -1.)
+                         * pvar[k][ii]) * unddij;
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          rhsv[ii*n + k][ll] +=   (  udbfs * b_face_normal[f_id][ll]
+                                   + umcbdd*diipb[f_id][ll]) * pfac;
+
+      }
+
+    } /* loop on faces */
+
+  } /* loop on threads */
+
+  /* Compute gradient */
+  /*------------------*/
+
+# pragma omp parallel for
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (cs_lnum_t k = 0; k < n; k++) {
+      const cs_real_t *r = rhsv[c_id*n + k];
+      grad[k][c_id][0] =   cocg[c_id][0] *r[0]
+                         + cocg[c_id][3] *r[1]
+                         + cocg[c_id][5] *r[2];
+      grad[k][c_id][1] =   cocg[c_id][3] *r[0]
+                         + cocg[c_id][1] *r[1]
+                         + cocg[c_id][4] *r[2];
+      grad[k][c_id][2] =   cocg[c_id][5] *r[0]
+                         + cocg[c_id][4] *r[1]
+                         + cocg[c_id][2] *r[2];
+    }
+  }
+
+  /* Boundary cells: cocg depends on each field's B.C. coefficients */
+
+# pragma omp parallel for
+  for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
+    cs_lnum_t c_id = m->b_cells[ii];
+
+    cs_lnum_t s_id = cell_b_faces_idx[c_id];
+    cs_lnum_t e_id = cell_b_faces_idx[c_id+1];
+
+    for (cs_lnum_t k = 0; k < n; k++) {
+
+      const cs_real_t *coefbp = bc_coeffs[k]->b;
+
+      cs_cocg_t _cocg[6];
+      for (cs_lnum_t ll = 0; ll < 6; ll++)
+        _cocg[ll] = cocgb[ii][ll];
+
+      for (cs_lnum_t i = s_id; i < e_id; i++) { /* loop on boundary faces */
+
+        cs_lnum_t f_id = cell_b_faces[i];
+
+        cs_real_t umcbdd = (1. - coefbp[f_id]) / b_dist[f_id];
+
+        cs_real_t dddij[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dddij[ll] =   b_face_u_normal[f_id][ll]
+                      + umcbdd * diipb[f_id][ll];
+
+        _cocg[0] += dddij[0]*dddij[0];
+        _cocg[1] += dddij[1]*dddij[1];
+        _cocg[2] += dddij[2]*dddij[2];
+        _cocg[3] += dddij[0]*dddij[1];
+        _cocg[4] += dddij[1]*dddij[2];
+        _cocg[5] += dddij[0]*dddij[2];
+
+      } /* loop on boundary faces */
+
+      _math_6_inv_cramer_sym_in_place(_cocg);
+
+      const cs_real_t *r = rhsv[c_id*n + k];
+      grad[k][c_id][0] = _cocg[0]*r[0] + _cocg[3]*r[1] + _cocg[5]*r[2];
+      grad[k][c_id][1] = _cocg[3]*r[0] + _cocg[1]*r[1] + _cocg[4]*r[2];
+      grad[k][c_id][2] = _cocg[5]*r[0] + _cocg[4]*r[1] + _cocg[2]*r[2];
+
+    }
+
+  } /* loop on boundary cells */
+
+  BFT_FREE(rhsv);
+
+  /* Synchronize halos, in a single exchange round */
+
+  if (m->halo != nullptr) {
+    cs_datatype_t *g_type;
+    int *g_stride;
+    void **g_val;
+    BFT_MALLOC(g_type, n_fields, cs_datatype_t);
+    BFT_MALLOC(g_stride, n_fields, int);
+    BFT_MALLOC(g_val, n_fields, void *);
+
+    for (int k = 0; k < n_fields; k++) {
+      g_type[k] = CS_REAL_TYPE;
+      g_stride[k] = 3;
+      g_val[k] = grad[k];
+    }
+
+    cs_halo_sync_multi(m->halo, CS_HALO_STANDARD,
+                       n_fields, g_type, g_stride, g_val);
+
+    if (m->have_rotation_perio) {
+      for (int k = 0; k < n_fields; k++)
+        cs_halo_perio_sync_var_vect
+          (m->halo, CS_HALO_STANDARD, (cs_real_t *)grad[k], 3);
+    }
+
+    BFT_FREE(g_val);
+    BFT_FREE(g_stride);
+    BFT_FREE(g_type);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient by least-squares reconstruction with a volume force
  * generating a hydrostatic pressure component.
@@ -4525,17 +5010,15 @@ _fv_vtx_based_scalar_gradient(const cs_mesh_t                *m,
 
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
   const cs_lnum_t n_cells = m->n_cells;
-  const int n_i_groups = m->i_face_numbering->n_groups;
-  const int n_i_threads = m->i_face_numbering->n_threads;
-  const int n_b_groups = m->b_face_numbering->n_groups;
-  const int n_b_threads = m->b_face_numbering->n_threads;
-  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
-  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
 
   const cs_lnum_2_t *restrict i_face_cells
     = (const cs_lnum_2_t *)m->i_face_cells;
   const cs_lnum_t *restrict b_face_cells
     = (const cs_lnum_t *)m->b_face_cells;
+  const cs_lnum_t *restrict i_f2v_idx = m->i_face_vtx_idx;
+  const cs_lnum_t *restrict i_f2v_ids = m->i_face_vtx_lst;
+  const cs_lnum_t *restrict b_f2v_idx = m->b_face_vtx_idx;
+  const cs_lnum_t *restrict b_f2v_ids = m->b_face_vtx_lst;
 
   const int *restrict c_disable_flag = fvq->c_disable_flag;
   cs_lnum_t has_dc = fvq->has_disable_flag; /* Has cells disabled? */
@@ -4567,311 +5050,208 @@ _fv_vtx_based_scalar_gradient(const cs_mesh_t                *m,
 
   /* Additional terms due to porosity */
 
-  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
-
-  cs_real_t *i_poro_duq_0;
-  cs_real_t *i_poro_duq_1;
-  cs_real_t *b_poro_duq;
-  cs_real_t _f_ext = 0.;
-
-  cs_lnum_t is_porous = 0;
-  if (f_i_poro_duq_0 != nullptr) {
-    is_porous = 1;
-    i_poro_duq_0 = f_i_poro_duq_0->val;
-    i_poro_duq_1 = cs_field_by_name_try("i_poro_duq_1")->val;
-    b_poro_duq = cs_field_by_name_try("b_poro_duq")->val;
-  } else {
-    i_poro_duq_0 = &_f_ext;
-    i_poro_duq_1 = &_f_ext;
-    b_poro_duq = &_f_ext;
-  }
-
-  /* Initialize gradient
-     ------------------- */
-
-# pragma omp parallel for
-  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-    for (cs_lnum_t j = 0; j < 3; j++)
-      grad[c_id][j] = 0.0;
-  }
-
-  /* Pre-compute values at boundary using least squares */
-
-  cs_real_t *b_f_var;
-  BFT_MALLOC(b_f_var, m->n_b_faces, cs_real_t);
-
-  if (hyd_p_flag == 1)
-    _lsq_scalar_b_face_val_phyd(m,
-                                fvq,
-                                CS_HALO_STANDARD,
-                                inc,
-                                f_ext,
-                                bc_coeffs,
-                                c_var,
-                                c_weight,
-                                b_f_var);
-  else
-    _lsq_scalar_b_face_val(m,
-                           fvq,
-                           CS_HALO_STANDARD,
-                           inc,
-                           bc_coeffs,
-                           c_var,
-                           c_weight,
-                           b_f_var);
-
-  /* Compute vertex-based values
-     --------------------------- */
-
-  cs_real_t *v_var;
-  BFT_MALLOC(v_var, m->n_vertices, cs_real_t);
-
-  cs_cell_to_vertex(CS_CELL_TO_VERTEX_LR,
-                    0, /* verbosity */
-                    1, /* var_dim */
-                    0, /* tr_dim */
-                    c_weight,
-                    c_var,
-                    b_f_var,
-                    v_var);
-
-  /* Interpolate to face-based values
-     -------------------------------- */
-
-  cs_real_t *i_f_var;
-  BFT_MALLOC(i_f_var, m->n_i_faces, cs_real_t);
-
-  for (int f_t = 0; f_t < 2; f_t++) {
-
-    const cs_lnum_t n_faces = (f_t == 0) ? m->n_i_faces : m->n_b_faces;
-    const cs_lnum_t *f2v_idx= nullptr, *f2v_ids = nullptr;
-    cs_real_t *f_var = nullptr;
-
-    if (f_t == 0) {
-      f2v_idx = m->i_face_vtx_idx;
-      f2v_ids = m->i_face_vtx_lst;
-      f_var = i_f_var;
-    }
-    else {
-      f2v_idx = m->b_face_vtx_idx;
-      f2v_ids = m->b_face_vtx_lst;
-      f_var = b_f_var;
-    }
-
-#   pragma omp parallel for if (n_faces > CS_THR_MIN)
-    for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
-      cs_lnum_t s_id = f2v_idx[f_id];
-      cs_lnum_t e_id = f2v_idx[f_id+1];
-      cs_real_t s = 0;
-      for (cs_lnum_t i = s_id; i < e_id; i++)
-        s += v_var[f2v_ids[i]];
-      f_var[f_id] = s / (e_id-s_id);
-    }
-
-  }
-
-  /* Vertex values are not needed after this stage */
-
-  cs_real_t mean[4] = {0, 0, 0, 0};
-  for (cs_lnum_t i = 0; i < n_cells; i++)
-    mean[0] += c_var[i];
-  mean[0] /= n_cells;
-  for (cs_lnum_t i = 0; i < m->n_vertices; i++)
-    mean[1] += v_var[i];
-  mean[1] /= m->n_vertices;
-  for (cs_lnum_t i = 0; i < m->n_i_faces; i++)
-    mean[2] += i_f_var[i];
-  mean[2] /= m->n_i_faces;
-  for (cs_lnum_t i = 0; i < m->n_b_faces; i++)
-    mean[3] += b_f_var[i];
-  mean[3] /= m->n_b_faces;
-
-  BFT_FREE(v_var);
-
-  /* Case with hydrostatic pressure
-     ------------------------------ */
-
-  if (hyd_p_flag == 1) {
-
-    /* Contribution from interior faces */
-
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
-
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
-
-        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             f_id++) {
-
-          cs_lnum_t ii = i_face_cells[f_id][0];
-          cs_lnum_t jj = i_face_cells[f_id][1];
-
-          cs_real_t ktpond = weight[f_id]; /* no cell weighting */
-          /* if cell weighting is active */
-          if (c_weight_s != nullptr) {
-            ktpond =   weight[f_id] * c_weight_s[ii]
-                     / (       weight[f_id] * c_weight_s[ii]
-                        + (1.0-weight[f_id])* c_weight_s[jj]);
-          }
-          else if (c_weight_t != nullptr) {
-            cs_real_t sum[6], inv_sum[6];
-
-            for (cs_lnum_t kk = 0; kk < 6; kk++)
-              sum[kk] =        weight[f_id]*c_weight_t[ii][kk]
-                        + (1.0-weight[f_id])*c_weight_t[jj][kk];
-
-            cs_math_sym_33_inv_cramer(sum, inv_sum);
-
-            ktpond =   weight[f_id] / 3.0
-                     * (  inv_sum[0]*c_weight_t[ii][0]
-                        + inv_sum[1]*c_weight_t[ii][1]
-                        + inv_sum[2]*c_weight_t[ii][2]
-                        + 2.0 * (  inv_sum[3]*c_weight_t[ii][3]
-                                 + inv_sum[4]*c_weight_t[ii][4]
-                                 + inv_sum[5]*c_weight_t[ii][5]));
-          }
-
-          cs_real_2_t poro = {
-            i_poro_duq_0[is_porous*f_id],
-            i_poro_duq_1[is_porous*f_id]
-          };
-
-          cs_real_t pfaci
-            =  ktpond
-                 * (  (i_f_face_cog[f_id][0] - cell_f_cen[ii][0])*f_ext[ii][0]
-                    + (i_f_face_cog[f_id][1] - cell_f_cen[ii][1])*f_ext[ii][1]
-                    + (i_f_face_cog[f_id][2] - cell_f_cen[ii][2])*f_ext[ii][2]
-                    + poro[0])
-            +  (1.0 - ktpond)
-                 * (  (i_f_face_cog[f_id][0] - cell_f_cen[jj][0])*f_ext[jj][0]
-                    + (i_f_face_cog[f_id][1] - cell_f_cen[jj][1])*f_ext[jj][1]
-                    + (i_f_face_cog[f_id][2] - cell_f_cen[jj][2])*f_ext[jj][2]
-                    + poro[1]);
-          cs_real_t pfacj = pfaci;
-
-          pfaci += i_f_var[f_id] - c_var[ii];
-          pfacj += i_f_var[f_id] - c_var[jj];
-
-          for (cs_lnum_t j = 0; j < 3; j++) {
-            grad[ii][j] += pfaci * i_f_face_normal[f_id][j];
-            grad[jj][j] -= pfacj * i_f_face_normal[f_id][j];
-          }
-
-        } /* loop on faces */
-
-      } /* loop on threads */
-
-    } /* loop on thread groups */
+  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
 
-    /* Contribution from boundary faces */
+  const cs_real_t *i_poro_duq_0 = nullptr;
+  const cs_real_t *i_poro_duq_1 = nullptr;
+  const cs_real_t *b_poro_duq = nullptr;
 
-    for (int g_id = 0; g_id < n_b_groups; g_id++) {
+  if (f_i_poro_duq_0 != nullptr) {
+    i_poro_duq_0 = f_i_poro_duq_0->val;
+    i_poro_duq_1 = cs_field_by_name_try("i_poro_duq_1")->val;
+    b_poro_duq = cs_field_by_name_try("b_poro_duq")->val;
+  }
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_b_threads; t_id++) {
+  /* Face loops are run on device when all arrays are accessible there;
+     boundary face values are computed on the host. */
 
-        for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
-             f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
-             f_id++) {
+  cs_dispatch_context ctx;
 
-          cs_lnum_t c_id = b_face_cells[f_id];
+  if (   cs_check_device_ptr(c_var) == CS_ALLOC_HOST
+      || cs_check_device_ptr(grad) == CS_ALLOC_HOST
+      || cs_check_device_ptr(i_f2v_ids) == CS_ALLOC_HOST
+      || cs_check_device_ptr(b_f2v_ids) == CS_ALLOC_HOST
+      || (c_weight != nullptr && cs_check_device_ptr(c_weight) == CS_ALLOC_HOST)
+      || (hyd_p_flag == 1 && cs_check_device_ptr(f_ext) == CS_ALLOC_HOST)
+      || (   i_poro_duq_0 != nullptr
+          && cs_check_device_ptr(i_poro_duq_0) == CS_ALLOC_HOST))
+    ctx.set_use_gpu(false);
 
-          cs_real_t poro = b_poro_duq[is_porous*f_id];
+  cs_dispatch_sum_type_t i_sum_type = ctx.get_parallel_for_i_faces_sum_type(m);
+  cs_dispatch_sum_type_t b_sum_type = ctx.get_parallel_for_b_faces_sum_type(m);
 
-          /*
-            Remark: for the cell \f$ \celli \f$ we remove
-                    \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
-          */
+  /* Initialize gradient
+     ------------------- */
 
-          cs_real_t pfac = b_f_var[f_id] - c_var[c_id];
+  ctx.parallel_for(n_cells_ext, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    for (cs_lnum_t j = 0; j < 3; j++)
+      grad[c_id][j] = 0.0;
+  });
 
-          pfac +=  bc_coeff_b[f_id]
-                  * (  cs_math_3_distance_dot_product(cell_f_cen[c_id],
-                                                      b_f_face_cog[f_id],
-                                                      f_ext[c_id])
-                     + poro);
+  /* Pre-compute values at boundary using least squares */
 
-          for (cs_lnum_t j = 0; j < 3; j++)
-            grad[c_id][j] += pfac * b_f_face_normal[f_id][j];
+  cs_real_t *b_f_var;
+  CS_MALLOC_HD(b_f_var, m->n_b_faces, cs_real_t, cs_alloc_mode);
 
-        } /* loop on faces */
+  if (hyd_p_flag == 1)
+    _lsq_scalar_b_face_val_phyd(m,
+                                fvq,
+                                CS_HALO_STANDARD,
+                                inc,
+                                f_ext,
+                                bc_coeffs,
+                                c_var,
+                                c_weight,
+                                b_f_var);
+  else
+    _lsq_scalar_b_face_val(m,
+                           fvq,
+                           CS_HALO_STANDARD,
+                           inc,
+                           bc_coeffs,
+                           c_var,
+                           c_weight,
+                           b_f_var);
 
-      } /* loop on threads */
+  if (ctx.use_gpu())
+    cs_sync_h2d(b_f_var);
 
-    } /* loop on thread groups */
+  /* Compute vertex-based values
+     --------------------------- */
 
-  } /* End of test on hydrostatic pressure */
+  cs_real_t *v_var;
+  CS_MALLOC_HD(v_var, m->n_vertices, cs_real_t, cs_alloc_mode);
 
-  /* Standard case, without hydrostatic pressure
-     ------------------------------------------- */
+  cs_cell_to_vertex(CS_CELL_TO_VERTEX_LR,
+                    0, /* verbosity */
+                    1, /* var_dim */
+                    0, /* tr_dim */
+                    c_weight,
+                    c_var,
+                    b_f_var,
+                    v_var);
 
-  else {
+  /* Contribution from interior faces, with face values interpolated
+     from vertex values on the fly
+     --------------------------------------------------------------- */
 
-    /* Contribution from interior faces */
+  ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  f_id) {
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+    cs_lnum_t ii = i_face_cells[f_id][0];
+    cs_lnum_t jj = i_face_cells[f_id][1];
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+    cs_lnum_t s_id = i_f2v_idx[f_id];
+    cs_lnum_t e_id = i_f2v_idx[f_id+1];
+    cs_real_t f_var = 0;
+    for (cs_lnum_t i = s_id; i < e_id; i++)
+      f_var += v_var[i_f2v_ids[i]];
+    f_var /= (e_id-s_id);
 
-        for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             f_id++) {
+    cs_real_t pfaci = f_var - c_var[ii];
+    cs_real_t pfacj = f_var - c_var[jj];
 
-          cs_lnum_t ii = i_face_cells[f_id][0];
-          cs_lnum_t jj = i_face_cells[f_id][1];
+    /* Case with hydrostatic pressure */
 
-          cs_real_t pfaci = i_f_var[f_id] - c_var[ii];
-          cs_real_t pfacj = i_f_var[f_id] - c_var[jj];
+    if (hyd_p_flag == 1) {
 
-          for (cs_lnum_t j = 0; j < 3; j++) {
-            grad[ii][j] += pfaci * i_f_face_normal[f_id][j];
-            grad[jj][j] -= pfacj * i_f_face_normal[f_id][j];
-          }
+      cs_real_t ktpond = weight[f_id]; /* no cell weighting */
+      /* if cell weighting is active */
+      if (c_weight_s != nullptr) {
+        ktpond =   weight[f_id] * c_weight_s[ii]
+                 / (       weight[f_id] * c_weight_s[ii]
+                    + (1.0-weight[f_id])* c_weight_s[jj]);
+      }
+      else if (c_weight_t != nullptr) {
+        cs_real_t sum[6], inv_sum[6];
+
+        for (cs_lnum_t kk = 0; kk < 6; kk++)
+          sum[kk] =        weight[f_id]*c_weight_t[ii][kk]
+                    + (1.0-weight[f_id])*c_weight_t[jj][kk];
+
+        cs_math_sym_33_inv_cramer(sum, inv_sum);
+
+        ktpond =   weight[f_id] / 3.0
+                 * (  inv_sum[0]*c_weight_t[ii][0]
+                    + inv_sum[1]*c_weight_t[ii][1]
+                    + inv_sum[2]*c_weight_t[ii][2]
+                    + 2.0 * (  inv_sum[3]*c_weight_t[ii][3]
+                             + inv_sum[4]*c_weight_t[ii][4]
+                             + inv_sum[5]*c_weight_t[ii][5]));
+      }
 
-        } /* loop on faces */
+      cs_real_2_t poro = {0., 0.};
+      if (i_poro_duq_0 != nullptr) {
+        poro[0] = i_poro_duq_0[f_id];
+        poro[1] = i_poro_duq_1[f_id];
+      }
 
-      } /* loop on threads */
+      cs_real_t pfac
+        =  ktpond
+             * (  (i_f_face_cog[f_id][0] - cell_f_cen[ii][0])*f_ext[ii][0]
+                + (i_f_face_cog[f_id][1] - cell_f_cen[ii][1])*f_ext[ii][1]
+                + (i_f_face_cog[f_id][2] - cell_f_cen[ii][2])*f_ext[ii][2]
+                + poro[0])
+        +  (1.0 - ktpond)
+             * (  (i_f_face_cog[f_id][0] - cell_f_cen[jj][0])*f_ext[jj][0]
+                + (i_f_face_cog[f_id][1] - cell_f_cen[jj][1])*f_ext[jj][1]
+                + (i_f_face_cog[f_id][2] - cell_f_cen[jj][2])*f_ext[jj][2]
+                + poro[1]);
+
+      pfaci += pfac;
+      pfacj += pfac;
 
-    } /* loop on thread groups */
+    }
 
-    /* Contribution from boundary faces */
+    cs_real_t fctb_i[3], fctb_j[3];
+    for (cs_lnum_t j = 0; j < 3; j++) {
+      fctb_i[j] =  pfaci * i_f_face_normal[f_id][j];
+      fctb_j[j] = -pfacj * i_f_face_normal[f_id][j];
+    }
 
-    for (int g_id = 0; g_id < n_b_groups; g_id++) {
+    cs_dispatch_sum<3>(grad[ii], fctb_i, i_sum_type);
+    cs_dispatch_sum<3>(grad[jj], fctb_j, i_sum_type);
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_b_threads; t_id++) {
+  });
 
-        for (cs_lnum_t f_id = b_group_index[(t_id*n_b_groups + g_id)*2];
-             f_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
-             f_id++) {
+  /* Contribution from boundary faces
+     -------------------------------- */
 
-          cs_lnum_t ii = b_face_cells[f_id];
+  ctx.parallel_for_b_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  f_id) {
 
-          /*
-            Remark: for the cell \f$ \celli \f$ we remove
-                    \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
-          */
+    cs_lnum_t c_id = b_face_cells[f_id];
 
-          cs_real_t pfac = b_f_var[f_id] - c_var[ii];
+    cs_lnum_t s_id = b_f2v_idx[f_id];
+    cs_lnum_t e_id = b_f2v_idx[f_id+1];
+    cs_real_t f_var = 0;
+    for (cs_lnum_t i = s_id; i < e_id; i++)
+      f_var += v_var[b_f2v_ids[i]];
+    f_var /= (e_id-s_id);
 
-          for (cs_lnum_t j = 0; j < 3; j++)
-            grad[ii][j] += pfac * b_f_face_normal[f_id][j];
+    /*
+      Remark: for the cell \f$ \celli \f$ we remove
+              \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
+    */
 
-        } /* loop on faces */
+    cs_real_t pfac = f_var - c_var[c_id];
 
-      } /* loop on threads */
+    if (hyd_p_flag == 1) {
+      cs_real_t poro = (b_poro_duq != nullptr) ? b_poro_duq[f_id] : 0.;
+      pfac +=  bc_coeff_b[f_id]
+              * (  cs_math_3_distance_dot_product(cell_f_cen[c_id],
+                                                  b_f_face_cog[f_id],
+                                                  f_ext[c_id])
+                 + poro);
+    }
 
-    } /* loop on thread groups */
+    cs_real_t fctb[3];
+    for (cs_lnum_t j = 0; j < 3; j++)
+      fctb[j] = pfac * b_f_face_normal[f_id][j];
 
-  }
+    cs_dispatch_sum<3>(grad[c_id], fctb, b_sum_type);
 
-  BFT_FREE(i_f_var);
-  BFT_FREE(b_f_var);
+  });
 
-# pragma omp parallel for
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
     cs_real_t dvol;
     /* Is the cell disabled (for solid or porous)? Not the case if coupled */
     if (has_dc * c_disable_flag[has_dc * c_id] == 0)
@@ -4881,10 +5261,18 @@ _fv_vtx_based_scalar_gradient(const cs_mesh_t                *m,
 
     for (cs_lnum_t j = 0; j < 3; j++)
       grad[c_id][j] *= dvol;
-  }
+  });
+
+  ctx.wait();
+
+  CS_FREE_HD(v_var);
+  CS_FREE_HD(b_f_var);
 
   /* Synchronize halos */
 
+  if (ctx.use_gpu())
+    cs_sync_d2h(grad);
+
   _sync_scalar_gradient_halo(m, CS_HALO_EXTENDED, grad);
 }
 
@@ -5832,7 +6220,7 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
   cs_gradient_quantities_t  *gq = _gradient_quantities_get(gq_id);
 
   cs_real_33_t *restrict cocg = gq->cocg_it;
-  if (cocg == nullptr)
+  if (cocg == nullptr || gq->it_valid == false)
     cocg = _compute_cell_cocg_it(m, fvq, cpl, gq);
 
   cs_lnum_t   cpl_stride = 0;
@@ -6121,7 +6509,7 @@ _iterative_tensor_gradient(const cs_mesh_t              *m,
   cs_gradient_quantities_t  *gq = _gradient_quantities_get(0);
 
   cs_real_33_t *restrict cocg = gq->cocg_it;
-  if (cocg == nullptr)
+  if (cocg == nullptr || gq->it_valid == false)
     cocg = _compute_cell_cocg_it(m, fvq, nullptr, gq);
 
   BFT_MALLOC(rhs, n_cells_ext, cs_real_63_t);
@@ -8534,6 +8922,8 @@ _initialize_tensor_gradient(const cs_mesh_t              *m,
  *                                 the hydrostatic pressure
  * \param[in]     bc_coeffs        boundary condition structure of the variable
  * \param[in]     var              gradient's base variable
+ * \param[in]     var_hs           halo state for pending synchronization
+ *                                 of var, or NULL
  * \param[in]     c_weight         weighted gradient coefficient variable,
  *                                 or NULL
  * \param[in]     cpl              structure associated with internal coupling,
@@ -8559,6 +8949,7 @@ _gradient_scalar(const char                    *var_name,
                  const cs_real_3_t             *f_ext,
                  const cs_field_bc_coeffs_t    *bc_coeffs,
                  const cs_real_t                var[],
+                 cs_halo_state_t               *var_hs,
                  const cs_real_t                c_weight[],
                  const cs_internal_coupling_t  *cpl,
                  cs_real_t           (*restrict grad)[3])
@@ -8662,6 +9053,20 @@ _gradient_scalar(const char                    *var_name,
 
   }
 
+  /* Complete pending synchronization of variable if it is not
+     overlapped with computation by the selected algorithm */
+
+  if (var_hs != nullptr) {
+    bool overlap = (   (   gradient_type == CS_GRADIENT_LSQ
+                        || gradient_type == CS_GRADIENT_GREEN_LSQ)
+                    && hyd_p_flag == 0
+                    && !(w_stride == 6 && c_weight != nullptr));
+    if (!overlap) {
+      cs_halo_sync_wait(mesh->halo, const_cast<cs_real_t *>(var), var_hs);
+      var_hs = nullptr;
+    }
+  }
+
   /* Allocate work arrays */
 
   /* Compute gradient */
@@ -8805,6 +9210,7 @@ _gradient_scalar(const char                    *var_name,
                              bc_coeffs,
                              var,
                              c_weight,
+                             var_hs,
                              r_grad);
 
       if (gradient_type == CS_GRADIENT_GREEN_LSQ) {
@@ -9896,8 +10302,12 @@ cs_gradient_initialize(void)
 void
 cs_gradient_finalize(void)
 {
+  _gradient_quantities_log();
   _gradient_quantities_destroy();
 
+  if (_gradient_halo_state != nullptr)
+    cs_halo_state_destroy(&_gradient_halo_state);
+
   cs_log_printf(CS_LOG_PERFORMANCE,
                 _("\n"
                   "Total elapsed time for all gradient computations:  %.3f s\n"),
@@ -9935,11 +10345,47 @@ cs_gradient_free_quantities(void)
 
     cs_gradient_quantities_t  *gq = _gradient_quantities + i;
 
-    BFT_FREE(gq->cocg_it);
-    BFT_FREE(gq->cocgb_s_lsq);
-    BFT_FREE(gq->cocg_lsq);
-    BFT_FREE(gq->cocgb_s_lsq_ext);
-    BFT_FREE(gq->cocg_lsq_ext);
+    CS_FREE_HD(gq->cocg_it);
+    CS_FREE_HD(gq->cocgb_s_lsq);
+    CS_FREE_HD(gq->cocg_lsq);
+    CS_FREE_HD(gq->cocgb_s_lsq_ext);
+    CS_FREE_HD(gq->cocg_lsq_ext);
+
+    gq->n_cells_ext = 0;
+    gq->n_b_cells = 0;
+    gq->cell_cells_lst = nullptr;
+    gq->it_valid = false;
+    for (int j = 0; j < 2; j++) {
+      gq->lsq_valid[j] = false;
+      gq->lsq_on_device[j] = false;
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Mark saved gradient quantities as outdated.
+ *
+ * This is required when the mesh geometry changes but not its topology
+ * (i.e. mesh motion), so that the on-demand computation will be updated.
+ * Contrary to \ref cs_gradient_free_quantities, arrays are kept allocated
+ * (and resident on device), and are only recomputed when next used.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_invalidate_quantities(void)
+{
+  for (int i = 0; i < _n_gradient_quantities; i++) {
+
+    cs_gradient_quantities_t  *gq = _gradient_quantities + i;
+
+    gq->it_valid = false;
+    for (int j = 0; j < 2; j++) {
+      gq->lsq_valid[j] = false;
+      gq->lsq_on_device[j] = false;
+    }
 
   }
 }
@@ -10001,25 +10447,78 @@ cs_gradient_scalar(const char                    *var_name,
   if (update_stats == true)
     gradient_info = _find_or_add_system(var_name, gradient_type);
 
-  /* Synchronize variable */
+  /* Synchronize variable; with the least-squares gradient, this is
+     overlapped with contributions of interior faces not adjacent to
+     ghost cells */
+
+  cs_halo_state_t *var_hs = nullptr;
 
   if (mesh->halo != nullptr) {
 
-    cs_halo_sync_var(mesh->halo, halo_type, var);
+    bool overlap = (   (   gradient_type == CS_GRADIENT_LSQ
+                        || gradient_type == CS_GRADIENT_GREEN_LSQ)
+                    && halo_type == CS_HALO_STANDARD
+                    && hyd_p_flag == 0
+                    && c_weight == nullptr
+                    && cpl == nullptr);
+#if defined(HAVE_CUDA)
+    if (cs_get_device_id() > -1)
+      overlap = false;
+#endif
+
+    if (overlap) {
+      if (_gradient_halo_state == nullptr)
+        _gradient_halo_state = cs_halo_state_create();
+      var_hs = _gradient_halo_state;
+      cs_halo_sync_pack(mesh->halo, halo_type, CS_REAL_TYPE, 1,
+                        var, nullptr, var_hs);
+      cs_halo_sync_start(mesh->halo, var, var_hs);
+    }
+    else {
+
+      /* Exchange variable and associated weight and external force
+         arrays in a single round (on host) */
+
+      bool on_host = true;
+#if defined(HAVE_CUDA)
+      if (cs_get_device_id() > -1)
+        on_host = false;
+#endif
+
+      int n_vars = 1;
+      cs_datatype_t v_type[3] = {CS_REAL_TYPE, CS_REAL_TYPE, CS_REAL_TYPE};
+      int v_stride[3] = {1, 1, 1};
+      void *v_val[3] = {var, nullptr, nullptr};
 
-    if (c_weight != nullptr) {
-      if (w_stride == 6) {
-        cs_halo_sync_var_strided(mesh->halo, halo_type, c_weight, 6);
-        cs_halo_perio_sync_var_sym_tens(mesh->halo, halo_type, c_weight);
+      if (on_host) {
+        if (c_weight != nullptr) {
+          v_stride[n_vars] = (w_stride == 6) ? 6 : 1;
+          v_val[n_vars++] = c_weight;
+        }
+        if (hyd_p_flag == 1) {
+          v_stride[n_vars] = 3;
+          v_val[n_vars++] = f_ext;
+        }
+        cs_halo_sync_multi(mesh->halo, halo_type,
+                           n_vars, v_type, v_stride, v_val);
       }
-      else
-        cs_halo_sync_var(mesh->halo, halo_type, c_weight);
+      else {
+        cs_halo_sync_var(mesh->halo, halo_type, var);
+        if (c_weight != nullptr)
+          cs_halo_sync_var_strided(mesh->halo, halo_type, c_weight,
+                                   (w_stride == 6) ? 6 : 1);
+        if (hyd_p_flag == 1)
+          cs_halo_sync_var_strided(mesh->halo, halo_type,
+                                   (cs_real_t *)f_ext, 3);
+      }
+
     }
 
-    if (hyd_p_flag == 1) {
-      cs_halo_sync_var_strided(mesh->halo, halo_type, (cs_real_t *)f_ext, 3);
+    if (c_weight != nullptr && w_stride == 6)
+      cs_halo_perio_sync_var_sym_tens(mesh->halo, halo_type, c_weight);
+
+    if (hyd_p_flag == 1)
       cs_halo_perio_sync_var_vect(mesh->halo, halo_type, (cs_real_t *)f_ext, 3);
-    }
 
   }
 
@@ -10039,6 +10538,7 @@ cs_gradient_scalar(const char                    *var_name,
                    f_ext,
                    bc_coeffs,
                    var,
+                   var_hs,
                    c_weight,
                    cpl,
                    grad);
@@ -10050,6 +10550,8 @@ cs_gradient_scalar(const char                    *var_name,
   if (update_stats == true) {
     gradient_info->n_calls += 1;
     cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
+    cs_perf_summary_add_diff(gradient_info->name, CS_PERF_SUMMARY_GRADIENT,
+                             &t0, &t1);
   }
 
   if (_gradient_stat_id > -1)
@@ -10147,6 +10649,8 @@ cs_gradient_vector(const char                    *var_name,
   if (update_stats == true) {
     gradient_info->n_calls += 1;
     cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
+    cs_perf_summary_add_diff(gradient_info->name, CS_PERF_SUMMARY_GRADIENT,
+                             &t0, &t1);
   }
 
   if (_gradient_stat_id > -1)
@@ -10233,8 +10737,318 @@ cs_gradient_tensor(const char                  *var_name,
   if (update_stats == true) {
     gradient_info->n_calls += 1;
     cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
+    cs_perf_summary_add_diff(gradient_info->name, CS_PERF_SUMMARY_GRADIENT,
+                             &t0, &t1);
+  }
+
+  if (_gradient_stat_id > -1)
+    cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of several fields of mixed dimension.
+ *
+ * Ghost cell values of all fields are exchanged in a single round.
+ * Scalar fields using a least-squares based gradient are then handled
+ * together, in a single pass over interior and boundary faces, so that
+ * geometric weights and face->cells connectivity are loaded only once
+ * for all those fields. Other fields (vectors, tensors, or scalars with
+ * other gradient types or on accelerated devices) are handled as with
+ * \ref cs_gradient_scalar, \ref cs_gradient_vector, or
+ * \ref cs_gradient_tensor.
+ *
+ * Gradients of fields of dimension 1, 3, and 6 are respectively
+ * of type cs_real_3_t, cs_real_33_t, and cs_real_63_t.
+ *
+ * \param[in]       n_fields       number of fields
+ * \param[in]       var_name       variable name for each field
+ * \param[in]       gradient_type  gradient type
+ * \param[in]       halo_type      halo type
+ * \param[in]       inc            if 0, solve on increment; 1 otherwise
+ * \param[in]       n_r_sweeps     if > 1, number of reconstruction sweeps
+ *                                 (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity      verbosity level
+ * \param[in]       clip_mode      clipping mode
+ * \param[in]       epsilon        precision for iterative gradient calculation
+ * \param[in]       clip_coeff     clipping coefficient
+ * \param[in]       dim            dimension of each field (1, 3, or 6)
+ * \param[in]       bc_coeffs      boundary condition structure
+ *                                 for each field
+ * \param[in, out]  var            gradient's base variable for each field
+ * \param[out]      grad           gradient of each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_multi(int                            n_fields,
+                  const char                    *var_name[],
+                  cs_gradient_type_t             gradient_type,
+                  cs_halo_type_t                 halo_type,
+                  int                            inc,
+                  int                            n_r_sweeps,
+                  int                            verbosity,
+                  cs_gradient_limit_t            clip_mode,
+                  double                         epsilon,
+                  double                         clip_coeff,
+                  const int                      dim[],
+                  const cs_field_bc_coeffs_t    *bc_coeffs[],
+                  cs_real_t                     *var[],
+                  cs_real_t                     *grad[])
+{
+  if (n_fields < 1)
+    return;
+
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+  cs_timer_t t0, t1;
+
+  t0 = cs_timer_time();
+
+  for (int i = 0; i < n_fields; i++) {
+    if (dim[i] != 1 && dim[i] != 3 && dim[i] != 6)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: field \"%s\" has dimension %d\n"
+                  "(only 1, 3, or 6 are handled)."),
+                __func__, var_name[i], dim[i]);
+  }
+
+  /* Synchronize all variables in a single exchange round */
+
+  if (mesh->halo != nullptr) {
+
+    bool on_host = true;
+#if defined(HAVE_CUDA)
+    if (cs_get_device_id() > -1)
+      on_host = false;
+#endif
+
+    if (on_host) {
+      cs_datatype_t *v_type;
+      BFT_MALLOC(v_type, n_fields, cs_datatype_t);
+      for (int i = 0; i < n_fields; i++)
+        v_type[i] = CS_REAL_TYPE;
+
+      cs_halo_sync_multi(mesh->halo, halo_type,
+                         n_fields, v_type, dim, (void **)var);
+
+      BFT_FREE(v_type);
+    }
+    else {
+      for (int i = 0; i < n_fields; i++)
+        cs_halo_sync_var_strided(mesh->halo, halo_type, var[i], dim[i]);
+    }
+
+    if (mesh->have_rotation_perio) {
+      for (int i = 0; i < n_fields; i++) {
+        if (dim[i] == 3)
+          cs_halo_perio_sync_var_vect(mesh->halo, halo_type, var[i], 3);
+        else if (dim[i] == 6)
+          cs_halo_perio_sync_var_sym_tens(mesh->halo, halo_type, var[i]);
+      }
+    }
+
+  }
+
+  /* Select scalar fields which may be handled in a single pass */
+
+  int n_multi = 0;
+  int *multi_id;
+  BFT_MALLOC(multi_id, n_fields, int);
+
+  bool fuse = (   gradient_type == CS_GRADIENT_LSQ
+               || gradient_type == CS_GRADIENT_GREEN_LSQ);
+#if defined(HAVE_CUDA)
+  if (cs_get_device_id() > -1)
+    fuse = false;
+#endif
+
+  if (fuse) {
+    for (int i = 0; i < n_fields; i++) {
+      if (   dim[i] == 1 && bc_coeffs[i] != nullptr
+          && bc_coeffs[i]->b != nullptr)
+        multi_id[n_multi++] = i;
+    }
+    if (n_multi < 2)
+      n_multi = 0;
+  }
+
+  /* Handle other fields separately */
+
+  cs_timer_t t_f0 = t0;
+
+  for (int i = 0, j = 0; i < n_fields; i++) {
+
+    if (j < n_multi && multi_id[j] == i) {
+      j++;
+      continue;
+    }
+
+    cs_gradient_info_t *gradient_info
+      = _find_or_add_system(var_name[i], gradient_type);
+
+    if (dim[i] == 1)
+      _gradient_scalar(var_name[i],
+                       gradient_info,
+                       gradient_type,
+                       halo_type,
+                       inc,
+                       false, /* Do not use previous cocg at boundary */
+                       n_r_sweeps,
+                       0,     /* hyd_p_flag */
+                       1,     /* w_stride */
+                       verbosity,
+                       clip_mode,
+                       epsilon,
+                       clip_coeff,
+                       nullptr,
+                       bc_coeffs[i],
+                       var[i],
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       (cs_real_3_t *)grad[i]);
+
+    else if (dim[i] == 3)
+      _gradient_vector(var_name[i],
+                       gradient_info,
+                       gradient_type,
+                       halo_type,
+                       inc,
+                       n_r_sweeps,
+                       verbosity,
+                       clip_mode,
+                       epsilon,
+                       clip_coeff,
+                       bc_coeffs[i],
+                       (const cs_real_3_t *)var[i],
+                       nullptr,
+                       nullptr,
+                       (cs_real_33_t *)grad[i]);
+
+    else
+      _gradient_tensor(var_name[i],
+                       gradient_info,
+                       gradient_type,
+                       halo_type,
+                       inc,
+                       n_r_sweeps,
+                       verbosity,
+                       clip_mode,
+                       epsilon,
+                       clip_coeff,
+                       bc_coeffs[i],
+                       (const cs_real_6_t *)var[i],
+                       (cs_real_63_t *)grad[i]);
+
+    cs_timer_t t_f1 = cs_timer_time();
+
+    gradient_info->n_calls += 1;
+    cs_timer_counter_add_diff(&(gradient_info->t_tot), &t_f0, &t_f1);
+    cs_perf_summary_add_diff(gradient_info->name, CS_PERF_SUMMARY_GRADIENT,
+                             &t_f0, &t_f1);
+
+    t_f0 = t_f1;
+  }
+
+  /* Handle selected scalar fields together */
+
+  if (n_multi > 0) {
+
+    const cs_field_bc_coeffs_t **m_bc_coeffs;
+    const cs_real_t **m_var;
+    cs_real_3_t **m_grad;
+    BFT_MALLOC(m_bc_coeffs, n_multi, const cs_field_bc_coeffs_t *);
+    BFT_MALLOC(m_var, n_multi, const cs_real_t *);
+    BFT_MALLOC(m_grad, n_multi, cs_real_3_t *);
+
+    for (int j = 0; j < n_multi; j++) {
+      int i = multi_id[j];
+      m_bc_coeffs[j] = bc_coeffs[i];
+      m_var[j] = var[i];
+      m_grad[j] = (cs_real_3_t *)grad[i];
+    }
+
+    /* For the Green-LSQ variant, the least-squares gradient is only
+       used as a predictor */
+
+    if (gradient_type == CS_GRADIENT_GREEN_LSQ) {
+      for (int j = 0; j < n_multi; j++)
+        BFT_MALLOC(m_grad[j], mesh->n_cells_with_ghosts, cs_real_3_t);
+    }
+
+    _lsq_scalar_gradient_multi(mesh,
+                               fvq,
+                               halo_type,
+                               inc,
+                               n_multi,
+                               m_bc_coeffs,
+                               m_var,
+                               m_grad);
+
+    for (int j = 0; j < n_multi; j++) {
+      int i = multi_id[j];
+
+      if (gradient_type == CS_GRADIENT_GREEN_LSQ) {
+        _reconstruct_scalar_gradient(mesh,
+                                     fvq,
+                                     1,     /* w_stride */
+                                     0,     /* hyd_p_flag */
+                                     inc,
+                                     nullptr,
+                                     bc_coeffs[i],
+                                     nullptr,
+                                     var[i],
+                                     m_grad[j],
+                                     (cs_real_3_t *)grad[i]);
+        BFT_FREE(m_grad[j]);
+      }
+
+      _scalar_gradient_clipping(mesh,
+                                fvq,
+                                cs_glob_mesh_adjacencies,
+                                halo_type,
+                                clip_mode,
+                                verbosity,
+                                clip_coeff,
+                                var_name[i],
+                                var[i],
+                                (cs_real_3_t *)grad[i]);
+
+      if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
+        cs_bad_cells_regularisation_vector((cs_real_3_t *)grad[i], 0);
+    }
+
+    BFT_FREE(m_grad);
+    BFT_FREE(m_var);
+    BFT_FREE(m_bc_coeffs);
+
+    /* Share elapsed time between fields handled together */
+
+    cs_timer_t t_f1 = cs_timer_time();
+    cs_timer_counter_t dt;
+    CS_TIMER_COUNTER_INIT(dt);
+    cs_timer_counter_add_diff(&dt, &t_f0, &t_f1);
+
+    for (int j = 0; j < n_multi; j++) {
+      cs_gradient_info_t *gradient_info
+        = _find_or_add_system(var_name[multi_id[j]], gradient_type);
+      gradient_info->n_calls += 1;
+      gradient_info->t_tot.nsec += dt.nsec / n_multi;
+      cs_timer_counter_t dt_f;
+      dt_f.nsec = dt.nsec / n_multi;
+      cs_perf_summary_add_counter(gradient_info->name,
+                                  CS_PERF_SUMMARY_GRADIENT, &dt_f);
+    }
+
   }
 
+  BFT_FREE(multi_id);
+
+  t1 = cs_timer_time();
+
+  cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
+
   if (_gradient_stat_id > -1)
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
@@ -10328,6 +11142,7 @@ cs_gradient_scalar_synced_input(const char                 *var_name,
                    f_ext,
                    bc_coeffs,
                    var,
+                   nullptr,
                    c_weight,
                    cpl,
                    grad);
@@ -10339,6 +11154,8 @@ cs_gradient_scalar_synced_input(const char                 *var_name,
   if (update_stats == true) {
     gradient_info->n_calls += 1;
     cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
+    cs_perf_summary_add_diff(gradient_info->name, CS_PERF_SUMMARY_GRADIENT,
+                             &t0, &t1);
   }
 
   if (_gradient_stat_id > -1)
@@ -10423,6 +11240,8 @@ cs_gradient_vector_synced_input(const char                 *var_name,
   if (update_stats == true) {
     gradient_info->n_calls += 1;
     cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
+    cs_perf_summary_add_diff(gradient_info->name, CS_PERF_SUMMARY_GRADIENT,
+                             &t0, &t1);
   }
 
   if (_gradient_stat_id > -1)
@@ -10501,6 +11320,8 @@ cs_gradient_tensor_synced_input(const char                  *var_name,
   if (update_stats == true) {
     gradient_info->n_calls += 1;
     cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
+    cs_perf_summary_add_diff(gradient_info->name, CS_PERF_SUMMARY_GRADIENT,
+                             &t0, &t1);
   }
 
   if (_gradient_stat_id > -1)
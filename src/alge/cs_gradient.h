@@ -120,6 +120,20 @@ cs_gradient_finalize(void);
 void
 cs_gradient_free_quantities(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Mark saved gradient quantities as outdated.
+ *
+ * This is required when the mesh geometry changes but not its topology
+ * (i.e. mesh motion), so that the on-demand computation will be updated.
+ * Contrary to \ref cs_gradient_free_quantities, arrays are kept allocated
+ * (and resident on device), and are only recomputed when next used.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_invalidate_quantities(void);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -240,6 +254,57 @@ cs_gradient_tensor(const char                  *var_name,
                    cs_real_6_t                 *var,
                    cs_real_63_t                *grad);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief  Compute cell gradients of several fields of mixed dimension.
+ *
+ * Ghost cell values of all fields are exchanged in a single round.
+ * Scalar fields using a least-squares based gradient are then handled
+ * together, in a single pass over interior and boundary faces, so that
+ * geometric weights and face->cells connectivity are loaded only once
+ * for all those fields. Other fields (vectors, tensors, or scalars with
+ * other gradient types or on accelerated devices) are handled as with
+ * \ref cs_gradient_scalar, \ref cs_gradient_vector, or
+ * \ref cs_gradient_tensor.
+ *
+ * Gradients of fields of dimension 1, 3, and 6 are respectively
+ * of type cs_real_3_t, cs_real_33_t, and cs_real_63_t.
+ *
+ * \param[in]       n_fields       number of fields
+ * \param[in]       var_name       variable name for each field
+ * \param[in]       gradient_type  gradient type
+ * \param[in]       halo_type      halo type
+ * \param[in]       inc            if 0, solve on increment; 1 otherwise
+ * \param[in]       n_r_sweeps     if > 1, number of reconstruction sweeps
+ *                                 (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity      verbosity level
+ * \param[in]       clip_mode      clipping mode
+ * \param[in]       epsilon        precision for iterative gradient calculation
+ * \param[in]       clip_coeff     clipping coefficient
+ * \param[in]       dim            dimension of each field (1, 3, or 6)
+ * \param[in]       bc_coeffs      boundary condition structure
+ *                                 for each field
+ * \param[in, out]  var            gradient's base variable for each field
+ * \param[out]      grad           gradient of each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_multi(int                            n_fields,
+                  const char                    *var_name[],
+                  cs_gradient_type_t             gradient_type,
+                  cs_halo_type_t                 halo_type,
+                  int                            inc,
+                  int                            n_r_sweeps,
+                  int                            verbosity,
+                  cs_gradient_limit_t            clip_mode,
+                  double                         epsilon,
+                  double                         clip_coeff,
+                  const int                      dim[],
+                  const cs_field_bc_coeffs_t    *bc_coeffs[],
+                  cs_real_t                     *var[],
+                  cs_real_t                     *grad[]);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -202,6 +202,12 @@ struct _cs_grid_t {
   const cs_matrix_t       *matrix;         /* Associated matrix (shared) */
   cs_matrix_t             *_matrix;        /* Associated matrix (private) */
 
+  bool                     msr_galerkin;   /* True if matrix coefficients
+                                              were only built from those of
+                                              the parent MSR matrix, so
+                                              they may be updated using
+                                              the same aggregation */
+
 #if defined(HAVE_MPI)
 
   /* Additional fields to allow merging grids */
@@ -289,7 +295,7 @@ static cs_matrix_variant_t **_grid_tune_variant = NULL;
  */
 /*----------------------------------------------------------------------------*/
 
-static inline cs_lnum_t
+static inline CS_F_HOST_DEVICE cs_lnum_t
 _l_id_binary_search(cs_lnum_t        l_id_array_size,
                     cs_lnum_t        l_id,
                     const cs_lnum_t  l_id_array[])
@@ -417,6 +423,8 @@ _create_grid(void)
   g->matrix = NULL;
   g->_matrix = NULL;
 
+  g->msr_galerkin = false;
+
 #if defined(HAVE_MPI)
 
   g->merge_sub_root = 0;
@@ -6191,22 +6199,32 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
 
   /* Coarse matrix elements in the MSR format */
 
-  /* Build structure
+  /* Build structure (or use existing one when updating coefficients)
      --------------- */
 
-  cs_lnum_t *c_row_index,  *c_col_id;
+  cs_lnum_t *_c_row_index = nullptr, *_c_col_id = nullptr;
+  const cs_lnum_t *c_row_index, *c_col_id;
 
-  _coarse_msr_struct(f_n_rows,
-                     c_n_rows,
-                     coarse_grid->alloc_mode,
-                     f_row_index,
-                     f_col_id,
-                     f_c_row,
-                     c_f_row_index,
-                     c_f_row_ids,
-                     c_row_index_0,
-                     &c_row_index,
-                     &c_col_id);
+  if (coarse_grid->matrix != nullptr)
+    cs_matrix_get_msr_arrays(coarse_grid->matrix,
+                             &c_row_index, &c_col_id,
+                             nullptr, nullptr);
+
+  else {
+    _coarse_msr_struct(f_n_rows,
+                       c_n_rows,
+                       coarse_grid->alloc_mode,
+                       f_row_index,
+                       f_col_id,
+                       f_c_row,
+                       c_f_row_index,
+                       c_f_row_ids,
+                       c_row_index_0,
+                       &_c_row_index,
+                       &_c_col_id);
+    c_row_index = _c_row_index;
+    c_col_id = _c_col_id;
+  }
 
   /* Assign values
      ------------- */
@@ -6217,19 +6235,28 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
   CS_MALLOC_HD(c_d_val, c_n_rows*db_stride, cs_real_t, coarse_grid->alloc_mode);
   CS_MALLOC_HD(c_x_val, c_nnz*eb_stride, cs_real_t, coarse_grid->alloc_mode);
 
+  /* Values may be computed on the device when all arrays are accessible
+     from it, avoiding a round trip to the host at each coarsening step */
+
+  cs_dispatch_context ctx;
+  if (   coarse_grid->alloc_mode < CS_ALLOC_HOST_DEVICE_SHARED
+      || cs_check_device_ptr(f_x_val) < CS_ALLOC_HOST_DEVICE_SHARED
+      || cs_check_device_ptr(c_col_id) < CS_ALLOC_HOST_DEVICE_SHARED)
+    ctx.set_use_gpu(false);
+  ctx.set_n_min_for_cpu_threads(CS_THR_MIN);
+
   /* Scalar case */
 
   if (db_size == 1) {
 
-    #pragma omp parallel for num_threads(n_f_threads)
-    for (cs_lnum_t ic = 0; ic < c_n_rows; ic++) {
+    ctx.parallel_for(c_n_rows, [=] CS_F_HOST_DEVICE (cs_lnum_t ic) {
 
       const cs_lnum_t s_id = c_row_index[ic];
       const cs_lnum_t n_cols = c_row_index[ic+1] - s_id;
       const cs_lnum_t n_vals = n_cols;
       cs_real_t *restrict row_x_vals = c_x_val + s_id;
 
-      c_d_val[ic] = 0;
+      cs_real_t d_val = 0;
       for (cs_lnum_t ll = 0; ll < n_vals; ll++)
         row_x_vals[ll] = 0;
 
@@ -6240,7 +6267,7 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
 
         /* Diagonal term */
 
-        c_d_val[ic] += f_d_val[ii];
+        d_val += f_d_val[ii];
 
         /* Extra-diagonal terms */
 
@@ -6255,13 +6282,15 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
               row_x_vals[k] += f_x_val[jj];
             }
             else { /* ic == jc */
-              c_d_val[ic] += f_x_val[jj];
+              d_val += f_x_val[jj];
             }
           } /* If fine row has matching coarse row */
         } /* Loop in fine columns */
       } /* Loop on fine rows */
 
-    } /* OpenMP loop on coarse rows */
+      c_d_val[ic] = d_val;
+
+    }); /* Loop on coarse rows */
 
   }
 
@@ -6269,8 +6298,7 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
 
   else {
 
-    #pragma omp parallel for num_threads(n_f_threads)
-    for (cs_lnum_t ic = 0; ic < c_n_rows; ic++) {
+    ctx.parallel_for(c_n_rows, [=] CS_F_HOST_DEVICE (cs_lnum_t ic) {
 
       const cs_lnum_t s_id = c_row_index[ic];
       const cs_lnum_t n_cols = c_row_index[ic+1] - s_id;
@@ -6327,15 +6355,29 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
         } /* Loop in fine columns */
       } /* Loop on fine rows */
 
-    } /* OPenMP loop on coarse rows */
+    }); /* Loop on coarse rows */
 
   }
 
-  /* Now build matrix */
+  ctx.wait();
 
-  _build_coarse_matrix_msr(coarse_grid, fine_grid->symmetric,
-                           c_row_index, c_col_id,
-                           c_d_val, c_x_val);
+  /* Now build or update matrix */
+
+  if (coarse_grid->matrix != nullptr) {
+    cs_real_t *_c_d_val = c_d_val, *_c_x_val = c_x_val;
+    cs_matrix_transfer_coefficients_msr(coarse_grid->_matrix,
+                                        fine_grid->symmetric,
+                                        db_size,
+                                        eb_size,
+                                        c_row_index,
+                                        c_col_id,
+                                        &_c_d_val,
+                                        &_c_x_val);
+  }
+  else
+    _build_coarse_matrix_msr(coarse_grid, fine_grid->symmetric,
+                             _c_row_index, _c_col_id,
+                             c_d_val, c_x_val);
 
   /* Free working arrays */
 
@@ -7486,6 +7528,28 @@ cs_grid_get_matrix(const cs_grid_t  *g)
   return m;
 }
 
+/*----------------------------------------------------------------------------
+ * Set the floating-point type used to store a grid's matrix
+ * extra-diagonal coefficients.
+ *
+ * This only applies to grids owning their matrix (i.e. coarse grids);
+ * see cs_matrix_set_coefficients_type() for restrictions.
+ *
+ * parameters:
+ *   g        <-> Grid structure
+ *   datatype <-- CS_DOUBLE or CS_FLOAT
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_matrix_coefficients_type(cs_grid_t      *g,
+                                     cs_datatype_t   datatype)
+{
+  assert(g != NULL);
+
+  if (g->_matrix != NULL)
+    cs_matrix_set_coefficients_type(g->_matrix, datatype);
+}
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -7767,6 +7831,7 @@ cs_grid_coarsen(const cs_grid_t      *f,
   if (fine_matrix_type == CS_MATRIX_MSR && c->relaxation <= 0) {
 
    _compute_coarse_quantities_msr(f, c);
+   c->msr_galerkin = true;
 
   }
 
@@ -7876,6 +7941,10 @@ cs_grid_coarsen(const cs_grid_t      *f,
     cc->level -=1;
     cc->parent = f;
 
+    /* Galerkin coefficients with the projected aggregation are identical
+       to those built through the intermediate grid */
+    cc->msr_galerkin = (cc->msr_galerkin && c->msr_galerkin);
+
     assert(cc->parent == c->parent);
 
     cs_grid_destroy(&c);
@@ -7894,6 +7963,7 @@ cs_grid_coarsen(const cs_grid_t      *f,
       if (c->_xa == NULL && c->n_faces > 0)
         _native_from_msr(c);
       _merge_grids(c, merge_stride, verbosity);
+      c->msr_galerkin = false;
       if (c->_matrix != nullptr) {
         cs_matrix_type_t cm_type = cs_matrix_get_type(c->matrix);
         cs_matrix_destroy(&(c->_matrix));
@@ -7937,6 +8007,47 @@ cs_grid_coarsen(const cs_grid_t      *f,
   return c;
 }
 
+/*----------------------------------------------------------------------------
+ * Update a coarse grid's matrix coefficients from those of a fine grid,
+ * keeping the existing aggregation and coarse matrix structure.
+ *
+ * This is only possible if the coarse grid's coefficients were built
+ * directly from the parent's MSR matrix (i.e. with no P0/P1 relaxation,
+ * recursive aggregation, or rank merging), and the fine grid has the
+ * same block sizes as the one used to build the coarse grid. Checking
+ * that the fine grid's structure is unchanged is the caller's
+ * responsibility.
+ *
+ * parameters:
+ *   f <-- Fine grid structure
+ *   c <-> Coarse grid structure
+ *
+ * returns:
+ *   true if coefficients were updated, false if the coarse grid needs
+ *   to be rebuilt.
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_update_coarse_coefficients(const cs_grid_t  *f,
+                                   cs_grid_t        *c)
+{
+  assert(f != NULL && c != NULL);
+
+  if (   c->msr_galerkin == false
+      || cs_matrix_get_type(f->matrix) != CS_MATRIX_MSR
+      || c->level != f->level + 1
+      || c->symmetric != f->symmetric
+      || c->db_size != f->db_size
+      || c->eb_size != f->eb_size)
+    return false;
+
+  c->parent = f;
+
+  _compute_coarse_quantities_msr(f, c);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Create coarse grid with only one row per rank from fine grid.
  *
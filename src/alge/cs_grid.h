@@ -260,6 +260,22 @@ cs_grid_get_n_g_rows(const cs_grid_t  *g);
 const cs_matrix_t *
 cs_grid_get_matrix(const cs_grid_t  *g);
 
+/*----------------------------------------------------------------------------
+ * Set the floating-point type used to store a grid's matrix
+ * extra-diagonal coefficients.
+ *
+ * This only applies to grids owning their matrix (i.e. coarse grids);
+ * see cs_matrix_set_coefficients_type() for restrictions.
+ *
+ * parameters:
+ *   g        <-> Grid structure
+ *   datatype <-- CS_DOUBLE or CS_FLOAT
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_matrix_coefficients_type(cs_grid_t      *g,
+                                     cs_datatype_t   datatype);
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -323,6 +339,30 @@ cs_grid_coarsen(const cs_grid_t      *f,
                 cs_gnum_t             merge_rows_glob_threshold,
                 double                relaxation_parameter);
 
+/*----------------------------------------------------------------------------
+ * Update a coarse grid's matrix coefficients from those of a fine grid,
+ * keeping the existing aggregation and coarse matrix structure.
+ *
+ * This is only possible if the coarse grid's coefficients were built
+ * directly from the parent's MSR matrix (i.e. with no P0/P1 relaxation,
+ * recursive aggregation, or rank merging), and the fine grid has the
+ * same block sizes as the one used to build the coarse grid. Checking
+ * that the fine grid's structure is unchanged is the caller's
+ * responsibility.
+ *
+ * parameters:
+ *   f <-- Fine grid structure
+ *   c <-> Coarse grid structure
+ *
+ * returns:
+ *   true if coefficients were updated, false if the coarse grid needs
+ *   to be rebuilt.
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_update_coarse_coefficients(const cs_grid_t  *f,
+                                   cs_grid_t        *c);
+
 /*----------------------------------------------------------------------------
  * Create coarse grid with only one row per rank from fine grid.
  *
@@ -138,6 +138,15 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Default slice size for SELL-C-sigma matrices on host
+   (number of double precision values in a SIMD register) */
+
+#if defined(__AVX512F__)
+#  define CS_MATRIX_SELL_HOST_SLICE_SIZE 8
+#else
+#  define CS_MATRIX_SELL_HOST_SLICE_SIZE 4
+#endif
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -155,6 +164,7 @@ static const char  *_matrix_type_name[] = {N_("native"),
                                            N_("CSR"),
                                            N_("MSR"),
                                            N_("distributed"),
+                                           N_("SELL"),
                                            N_("external")};
 
 /* Full names for matrix types */
@@ -164,6 +174,7 @@ static const char
                             N_("Compressed Sparse Row"),
                             N_("Modified Compressed Sparse Row"),
                             N_("Distributed (D+E+H)"),
+                            N_("Sliced ELLPACK (SELL-C-sigma)"),
                             N_("External")};
 
 /* Fill type names for matrices */
@@ -184,6 +195,11 @@ const char  *cs_matrix_spmv_type_name[] = {"y ← A.x",
 
 cs_lnum_t _base_assembler_thr_min = 128;
 
+/* SELL-C-sigma parameters (0 for automatic) */
+
+static cs_lnum_t _sell_slice_size = 0;
+static cs_lnum_t _sell_sigma = 0;
+
 /*============================================================================
  * Private function definitions
 - *============================================================================*/
@@ -425,6 +441,7 @@ _set_coeffs_native(cs_matrix_t *matrix,
 
   CS_FREE(mc->_d_val);
   CS_FREE(mc->_e_val);
+  BFT_FREE(mc->f_op);
 
   /* Map or copy values */
 
@@ -462,6 +479,8 @@ _set_coeffs_native(cs_matrix_t *matrix,
       mc->e_val = xa;
 
   }
+  else
+    mc->e_val = nullptr;
 }
 
 /*----------------------------------------------------------------------------
@@ -481,7 +500,8 @@ _copy_diagonal_separate(const cs_matrix_t *matrix, cs_real_t *restrict da)
     _d_val = mc->d_val;
   }
   else if (   matrix->type == CS_MATRIX_MSR
-           || matrix->type == CS_MATRIX_DIST) {
+           || matrix->type == CS_MATRIX_DIST
+           || matrix->type == CS_MATRIX_SELL) {
     auto mc = static_cast<const cs_matrix_coeff_dist_t *>(matrix->coeffs);
     _d_val = mc->d_val;
   }
@@ -2201,6 +2221,8 @@ _set_coeffs_msr(cs_matrix_t         *matrix,
 
   mc->eb_size = matrix->eb_size;
 
+  BFT_FREE(mc->_e_val_f);
+
   const cs_lnum_t eb_size = mc->eb_size;
   const cs_lnum_t eb_size_2 = eb_size * eb_size;
 
@@ -2269,6 +2291,8 @@ _set_coeffs_msr_from_msr(cs_matrix_t       *matrix,
 
   bool d_transferred = false, x_transferred = false;
 
+  BFT_FREE(mc->_e_val_f);
+
   /* TODO: we should use metadata or check that the row_index and
      column id values are consistent, which should be true as long
      as columns are ordered in an identical manner */
@@ -3537,6 +3561,11 @@ _create_coeff_dist(void)
 
   mc->d_idx = nullptr;
 
+  mc->_s_val = nullptr;
+  mc->_e_val_f = nullptr;
+
+  mc->f_op = nullptr;
+
   return mc;
 }
 
@@ -3557,6 +3586,9 @@ _destroy_coeff_dist(cs_matrix_t  *m)
     CS_FREE(mc->_e_val);
     CS_FREE(mc->_d_val);
     CS_FREE_HD(mc->d_idx);
+    CS_FREE_HD(mc->_s_val);
+    BFT_FREE(mc->_e_val_f);
+    BFT_FREE(mc->f_op);
 
     BFT_FREE(m->coeffs);
   }
@@ -3861,6 +3893,288 @@ _get_diagonal_dist(const cs_matrix_t  *matrix)
   return diag;
 }
 
+/*----------------------------------------------------------------------------
+ * Create a sliced ELLPACK (SELL-C-sigma) matrix structure from an MSR
+ * matrix structure.
+ *
+ * The MSR structure is moved to the base of the SELL-C-sigma structure,
+ * so the given structure pointer is freed and set to nullptr.
+ *
+ * parameters:
+ *   alloc_mode  <-- allocation mode
+ *   ms_msr      <-> pointer to MSR structure pointer (transferred)
+ *
+ * returns:
+ *   pointer to allocated SELL-C-sigma matrix structure.
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_struct_sell_t *
+_create_struct_sell(cs_alloc_mode_t            alloc_mode,
+                    cs_matrix_struct_dist_t  **ms_msr)
+{
+  cs_matrix_struct_sell_t  *ms;
+
+  BFT_MALLOC(ms, 1, cs_matrix_struct_sell_t);
+
+  memcpy(&(ms->msr), *ms_msr, sizeof(cs_matrix_struct_dist_t));
+  BFT_FREE(*ms_msr);
+
+  const cs_lnum_t  n_rows = ms->msr.n_rows;
+  const cs_lnum_t  *e_row_index = ms->msr.e.row_index;
+  const cs_lnum_t  *e_col_id = ms->msr.e.col_id;
+
+  /* Slice size and sorting scope */
+
+  cs_lnum_t c = _sell_slice_size;
+  if (c < 1)
+    c = (cs_get_device_id() > -1) ? 32 : CS_MATRIX_SELL_HOST_SLICE_SIZE;
+
+  cs_lnum_t sigma = _sell_sigma;
+  if (sigma < 1)
+    sigma = 16*c;
+  sigma = ((sigma + c - 1) / c) * c;
+
+  ms->slice_size = c;
+  ms->sigma = sigma;
+  ms->n_slices = (n_rows + c - 1) / c;
+
+  const cs_lnum_t  n_slices = ms->n_slices;
+
+  CS_MALLOC_HD(ms->slice_index, n_slices + 1, cs_lnum_t, alloc_mode);
+  CS_MALLOC_HD(ms->row_id, n_rows, cs_lnum_t, alloc_mode);
+
+  /* Sort rows by decreasing length inside each sorting window
+     (counting sort, as row lengths are small) */
+
+  cs_lnum_t max_len = 0;
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    cs_lnum_t n_cols = e_row_index[i+1] - e_row_index[i];
+    if (n_cols > max_len)
+      max_len = n_cols;
+  }
+
+  cs_lnum_t *l_count;
+  BFT_MALLOC(l_count, max_len + 2, cs_lnum_t);
+
+  for (cs_lnum_t s_id = 0; s_id < n_rows; s_id += sigma) {
+
+    cs_lnum_t e_id = CS_MIN(s_id + sigma, n_rows);
+
+    for (cs_lnum_t k = 0; k < max_len + 2; k++)
+      l_count[k] = 0;
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      cs_lnum_t n_cols = e_row_index[i+1] - e_row_index[i];
+      l_count[max_len - n_cols + 1] += 1;
+    }
+    for (cs_lnum_t k = 0; k < max_len + 1; k++)
+      l_count[k+1] += l_count[k];
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      cs_lnum_t n_cols = e_row_index[i+1] - e_row_index[i];
+      ms->row_id[s_id + l_count[max_len - n_cols]] = i;
+      l_count[max_len - n_cols] += 1;
+    }
+
+  }
+
+  BFT_FREE(l_count);
+
+  /* Build slice index */
+
+  ms->slice_index[0] = 0;
+  for (cs_lnum_t s = 0; s < n_slices; s++) {
+    cs_lnum_t s_width = 0;
+    cs_lnum_t l_end = CS_MIN(c, n_rows - s*c);
+    for (cs_lnum_t l = 0; l < l_end; l++) {
+      cs_lnum_t i = ms->row_id[s*c + l];
+      cs_lnum_t n_cols = e_row_index[i+1] - e_row_index[i];
+      if (n_cols > s_width)
+        s_width = n_cols;
+    }
+    ms->slice_index[s+1] = ms->slice_index[s] + s_width*c;
+  }
+
+  const cs_lnum_t  n_ents = ms->slice_index[n_slices];
+
+  CS_MALLOC_HD(ms->col_id, n_ents, cs_lnum_t, alloc_mode);
+  BFT_MALLOC(ms->src_id, n_ents, cs_lnum_t);
+
+  /* Column ids (padding refers to the row itself, or to the
+     last row of the slice for lanes beyond the last row) */
+
+# pragma omp parallel for  if(n_slices*c > CS_THR_MIN)
+  for (cs_lnum_t s = 0; s < n_slices; s++) {
+    const cs_lnum_t s_start = ms->slice_index[s];
+    const cs_lnum_t s_width = (ms->slice_index[s+1] - s_start) / c;
+    cs_lnum_t l_end = CS_MIN(c, n_rows - s*c);
+    for (cs_lnum_t l = 0; l < c; l++) {
+      cs_lnum_t i = ms->row_id[s*c + CS_MIN(l, l_end - 1)];
+      cs_lnum_t r_start = e_row_index[i];
+      cs_lnum_t n_cols = (l < l_end) ? e_row_index[i+1] - r_start : 0;
+      for (cs_lnum_t j = 0; j < n_cols; j++) {
+        ms->col_id[s_start + j*c + l] = e_col_id[r_start + j];
+        ms->src_id[s_start + j*c + l] = r_start + j;
+      }
+      for (cs_lnum_t j = n_cols; j < s_width; j++) {
+        ms->col_id[s_start + j*c + l] = i;
+        ms->src_id[s_start + j*c + l] = -1;
+      }
+    }
+  }
+
+  return ms;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a sliced ELLPACK (SELL-C-sigma) matrix structure.
+ *
+ * parameters:
+ *   ms  <->  pointer to SELL-C-sigma matrix structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_struct_sell(void  **ms)
+{
+  if (ms != nullptr && *ms !=nullptr) {
+    auto _ms = static_cast<cs_matrix_struct_sell_t *>(*ms);
+
+    CS_FREE_HD(_ms->slice_index);
+    CS_FREE_HD(_ms->row_id);
+    CS_FREE_HD(_ms->col_id);
+    BFT_FREE(_ms->src_id);
+
+    /* Base MSR structure is the first member, and
+       freeing it also frees the SELL-C-sigma structure */
+
+    _destroy_struct_dist(ms);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update sliced (SELL-C-sigma) extra-diagonal matrix coefficients based
+ * on MSR extra-diagonal coefficients.
+ *
+ * Only scalar extra-diagonal blocks are sliced; in other cases, the
+ * sliced coefficients are freed, and MSR coefficients are used directly.
+ *
+ * parameters:
+ *   matrix  <->  pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_coeffs_sell(cs_matrix_t  *matrix)
+{
+  auto ms = static_cast<const cs_matrix_struct_sell_t *>(matrix->structure);
+  auto mc = static_cast<cs_matrix_coeff_dist_t *>(matrix->coeffs);
+
+  if (mc->eb_size != 1 || mc->e_val == nullptr) {
+    CS_FREE_HD(mc->_s_val);
+    return;
+  }
+
+  const cs_lnum_t  n_ents = ms->slice_index[ms->n_slices];
+  const cs_lnum_t  *src_id = ms->src_id;
+  const cs_real_t  *e_val = mc->e_val;
+
+  if (mc->_s_val == nullptr)
+    CS_MALLOC_HD(mc->_s_val, n_ents, cs_real_t, matrix->alloc_mode);
+
+  cs_real_t  *s_val = mc->_s_val;
+
+# pragma omp parallel for  if(n_ents > CS_THR_MIN)
+  for (cs_lnum_t k = 0; k < n_ents; k++)
+    s_val[k] = (src_id[k] > -1) ? e_val[src_id[k]] : 0.;
+
+  cs_sync_h2d(mc->_s_val);
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL-C-sigma matrix coefficients.
+ *
+ * parameters:
+ *   matrix      <-> pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   copy        <-- indicates if coefficients should be copied
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   da          <-- diagonal values (nullptr if all zero)
+ *   xa          <-- extradiagonal values (nullptr if all zero)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs_sell(cs_matrix_t         *matrix,
+                 bool                 symmetric,
+                 bool                 copy,
+                 cs_lnum_t            n_edges,
+                 const cs_lnum_2_t  *restrict edges,
+                 const cs_real_t    *restrict da,
+                 const cs_real_t    *restrict xa)
+{
+  _set_coeffs_msr(matrix, symmetric, copy, n_edges, edges, da, xa);
+
+  _update_coeffs_sell(matrix);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Function for finalization of SELL-C-sigma matrix coefficients
+ *        assembly.
+ *
+ * Values are assembled in MSR form, and sliced once assembly is complete.
+ *
+ * \param[in, out]  matrix_p  untyped pointer to matrix description structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_sell_assembler_values_end(void  *matrix_p)
+{
+  cs_matrix_t  *matrix = (cs_matrix_t *)matrix_p;
+
+  _update_coeffs_sell(matrix);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create and initialize a SELL-C-sigma matrix assembler values
+ *        structure.
+ *
+ * The associated matrix's structure must have been created using
+ * \ref cs_matrix_structure_create_from_assembler.
+ *
+ * Block sizes are defined by an optional array of 4 values:
+ *   0: useful block size, 1: vector block extents,
+ *   2: matrix line extents,  3: matrix line*column extents
+ *
+ * \param[in, out]  matrix                 pointer to matrix structure
+ * \param[in]       diag_block_size        block sizes for diagonal
+ * \param[in]       extra_diag_block_size  block sizes for extra diagonal
+ *
+ * \return  pointer to initialized matrix assembler values structure;
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_matrix_assembler_values_t *
+_assembler_values_create_sell(cs_matrix_t      *matrix,
+                              const cs_lnum_t   diag_block_size,
+                              const cs_lnum_t   extra_diag_block_size)
+{
+  cs_matrix_assembler_values_t *mav
+    = cs_matrix_assembler_values_create(matrix->assembler,
+                                        true,
+                                        diag_block_size,
+                                        extra_diag_block_size,
+                                        (void *)matrix,
+                                        _msr_assembler_values_init,
+                                        _msr_assembler_values_add,
+                                        nullptr,
+                                        nullptr,
+                                        _sell_assembler_values_end);
+
+  return mav;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create matrix structure internals using a matrix assembler.
@@ -3947,6 +4261,26 @@ _structure_from_assembler(cs_matrix_type_t        type,
     }
     break;
 
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_dist_t *ms_msr = nullptr;
+      if (ma_sep_diag == true)
+        ms_msr = _create_struct_msr_from_shared(false, /* for safety */
+                                                n_rows,
+                                                n_cols_ext,
+                                                row_index,
+                                                col_id);
+      else
+        ms_msr = _create_struct_msr_from_csr(true,
+                                             alloc_mode,
+                                             n_rows,
+                                             n_cols_ext,
+                                             row_index,
+                                             col_id);
+      structure = _create_struct_sell(alloc_mode, &ms_msr);
+    }
+    break;
+
   case CS_MATRIX_DIST:
     if (ma_sep_diag == true)
       structure = _create_struct_dist_from_msr(false, /* for safety */
@@ -4009,6 +4343,9 @@ _structure_destroy(cs_matrix_type_t   type,
   case CS_MATRIX_DIST:
     _destroy_struct_dist(structure);
     break;
+  case CS_MATRIX_SELL:
+    _destroy_struct_sell(structure);
+    break;
   default:
     assert(0);
     break;
@@ -4092,6 +4429,9 @@ _matrix_create(cs_matrix_type_t  type)
   case CS_MATRIX_DIST:
     m->coeffs = _create_coeff_dist();
     break;
+  case CS_MATRIX_SELL:
+    m->coeffs = _create_coeff_dist();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -4164,6 +4504,16 @@ _matrix_create(cs_matrix_type_t  type)
     m->assembler_values_create = _assembler_values_create_dist;
     break;
 
+  case CS_MATRIX_SELL:
+    m->set_coefficients = _set_coeffs_sell;
+    m->release_coefficients = _release_coeffs_dist;
+    m->copy_diagonal = _copy_diagonal_separate;
+    m->get_diagonal = _get_diagonal_dist;
+    m->destroy_structure = _destroy_struct_sell;
+    m->destroy_coefficients = _destroy_coeff_dist;
+    m->assembler_values_create = _assembler_values_create_sell;
+    break;
+
   default:
     assert(0);
     break;
@@ -4272,6 +4622,16 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
                                         n_edges,
                                         edges);
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_dist_t *ms_msr = _create_struct_msr(ms->alloc_mode,
+                                                           n_rows,
+                                                           n_cols_ext,
+                                                           n_edges,
+                                                           edges);
+      ms->structure = _create_struct_sell(ms->alloc_mode, &ms_msr);
+    }
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -4362,6 +4722,18 @@ cs_matrix_structure_create_msr(cs_matrix_type_t        type,
                                                 row_index,
                                                 col_id);
     break;
+  case CS_MATRIX_SELL:
+    {
+      cs_matrix_struct_dist_t *ms_msr
+        = _create_struct_msr_from_msr(transfer,
+                                      false,
+                                      n_rows,
+                                      n_cols_ext,
+                                      row_index,
+                                      col_id);
+      ms->structure = _create_struct_sell(ms->alloc_mode, &ms_msr);
+    }
+    break;
   default:
     if (type >= 0 && type < CS_MATRIX_N_BUILTIN_TYPES)
       bft_error(__FILE__, __LINE__, 0,
@@ -4516,6 +4888,29 @@ cs_matrix_structure_destroy(cs_matrix_structure_t  **ms)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set parameters for sliced ELLPACK (SELL-C-sigma) matrix structures.
+ *
+ * These parameters apply to structures built after this call.
+ *
+ * \param[in]  slice_size  number of rows per slice (C), or 0 for automatic
+ *                         (SIMD width on host, warp size when a device
+ *                         is used)
+ * \param[in]  sigma       size of row windows inside which rows are sorted
+ *                         by decreasing length (rounded to a multiple of
+ *                         slice_size), or 0 for automatic
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_sell_parameters(cs_lnum_t  slice_size,
+                              cs_lnum_t  sigma)
+{
+  _sell_slice_size = CS_MAX(slice_size, 0);
+  _sell_sigma = CS_MAX(sigma, 0);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create a matrix container using a given structure.
@@ -4634,6 +5029,9 @@ cs_matrix_create_by_copy(cs_matrix_t   *src)
   case CS_MATRIX_DIST:
     m->coeffs = _create_coeff_dist();
     break;
+  case CS_MATRIX_SELL:
+    m->coeffs = _create_coeff_dist();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -4880,6 +5278,8 @@ cs_matrix_get_n_entries(const cs_matrix_t  *matrix)
     }
     break;
   case CS_MATRIX_MSR:
+    [[fallthrough]];
+  case CS_MATRIX_SELL:
     {
     auto ms = static_cast<const cs_matrix_struct_dist_t *>(matrix->structure);
     retval  = ms->e.row_index[ms->n_rows] + ms->n_rows;
@@ -5125,6 +5525,81 @@ cs_matrix_set_coefficients(cs_matrix_t        *matrix,
        cs_matrix_fill_type_name[matrix->fill_type]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set matrix coefficients for a matrix-free face-based operator.
+ *
+ * Only the diagonal is mapped. The extra-diagonal coefficients of the
+ * upwind convection / non-reconstructed diffusion operator (as built by
+ * \ref cs_matrix_wrapper_scalar) are recomputed from the face mass flux
+ * and viscosity at each matrix.vector product, so no per-face
+ * coefficients are stored.
+ *
+ * This is only available for scalar matrices in native format.
+ * As the extra-diagonal coefficients are not available, such matrices
+ * may not be used to build multigrid hierarchies or to be converted
+ * to other formats. The shared arrays must remain valid as long as
+ * the coefficients are used.
+ *
+ * \param[in, out]  matrix      pointer to matrix structure
+ * \param[in]       symmetric   indicates if matrix coefficients
+ *                              are symmetric
+ * \param[in]       da          diagonal values
+ * \param[in]       iconvp      1 for convection, 0 otherwise
+ *                              (must be 0 if symmetric)
+ * \param[in]       idiffp      1 for diffusion, 0 otherwise
+ * \param[in]       thetap      theta-scheme weighting coefficient
+ * \param[in]       i_massflux  mass flux at interior faces
+ *                              (may be nullptr if iconvp = 0)
+ * \param[in]       i_visc      face viscosity at interior faces
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_face_operator(cs_matrix_t      *matrix,
+                                         bool              symmetric,
+                                         const cs_real_t  *da,
+                                         int               iconvp,
+                                         int               idiffp,
+                                         cs_real_t         thetap,
+                                         const cs_real_t  *i_massflux,
+                                         const cs_real_t  *i_visc)
+{
+  if (matrix == nullptr)
+    bft_error(__FILE__, __LINE__, 0, _("The matrix is not defined."));
+
+  if (matrix->type != CS_MATRIX_NATIVE)
+    bft_error
+      (__FILE__, __LINE__, 0,
+       _("Matrix format %s does not handle matrix-free face-based operators."),
+       matrix->type_name);
+
+  if (symmetric && iconvp)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: a convection operator may not be symmetric."),
+              __func__);
+
+  if (iconvp && i_massflux == nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: mass flux required for convection operator."),
+              __func__);
+
+  auto ms = static_cast<const cs_matrix_struct_native_t *>(matrix->structure);
+
+  cs_matrix_set_coefficients(matrix, symmetric, 1, 1,
+                             ms->n_edges, ms->edges, da, nullptr);
+
+  auto mc = static_cast<cs_matrix_coeff_dist_t *>(matrix->coeffs);
+
+  BFT_MALLOC(mc->f_op, 1, cs_matrix_face_operator_t);
+
+  mc->f_op->iconvp = iconvp;
+  mc->f_op->idiffp = idiffp;
+  mc->f_op->thetap = thetap;
+  mc->f_op->i_massflux = (iconvp) ? i_massflux : nullptr;
+  mc->f_op->i_visc = i_visc;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set matrix coefficients, copying values to private arrays.
@@ -5247,6 +5722,18 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
                              x_val);
     break;
 
+  case CS_MATRIX_SELL:
+    _set_coeffs_msr_from_msr(matrix,
+                             false, /* ignored in case of transfer */
+                             row_index,
+                             col_id,
+                             d_val_p,
+                             d_val,
+                             x_val_p,
+                             x_val);
+    _update_coeffs_sell(matrix);
+    break;
+
   default:
     bft_error
       (__FILE__, __LINE__, 0,
@@ -5556,9 +6043,13 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
     break;
 
   case CS_MATRIX_MSR:
+    [[fallthrough]];
+  case CS_MATRIX_SELL:
     {
       const cs_lnum_t _row_id = row_id / b_size;
-      auto ms = static_cast<const cs_matrix_struct_csr_t *>(matrix->structure);
+      auto ms_d
+        = static_cast<const cs_matrix_struct_dist_t *>(matrix->structure);
+      const cs_matrix_struct_csr_t *ms = &(ms_d->e);
       auto mc = static_cast<const cs_matrix_coeff_dist_t *>(matrix->coeffs);
       const cs_lnum_t n_ed_cols =   ms->row_index[_row_id+1]
                                   - ms->row_index[_row_id];
@@ -5575,7 +6066,20 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
       }
       cs_lnum_t ii = 0, jj = 0;
       const cs_lnum_t *restrict c_id = ms->col_id + ms->row_index[_row_id];
-      if (b_size == 1) {
+      if (b_size == 1 && mc->_e_val_f != nullptr) {
+        const float *m_row = mc->_e_val_f + ms->row_index[_row_id];
+        for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
+          r->_col_id[ii] = c_id[jj];
+          r->_vals[ii++] = m_row[jj];
+        }
+        r->_col_id[ii] = _row_id;
+        r->_vals[ii++] = mc->d_val[_row_id];
+        for (; jj < n_ed_cols; jj++) {
+          r->_col_id[ii] = c_id[jj];
+          r->_vals[ii++] = m_row[jj];
+        }
+      }
+      else if (b_size == 1) {
         const cs_real_t *m_row = mc->e_val + ms->row_index[_row_id];
         for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
           r->_col_id[ii] = c_id[jj];
@@ -5660,7 +6164,20 @@ cs_matrix_get_row(const cs_matrix_t     *matrix,
       /* Local elements (including diagonal) */
 
       const cs_lnum_t *restrict c_id = ms->e.col_id + ms->e.row_index[_row_id];
-      if (b_size == 1) {
+      if (b_size == 1 && mc->_e_val_f != nullptr) {
+        const float *m_row = mc->_e_val_f + ms->e.row_index[_row_id];
+        for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
+          r->_col_id[ii] = c_id[jj];
+          r->_vals[ii++] = m_row[jj];
+        }
+        r->_col_id[ii] = _row_id;
+        r->_vals[ii++] = mc->d_val[_row_id];
+        for (; jj < n_ed_cols; jj++) {
+          r->_col_id[ii] = c_id[jj];
+          r->_vals[ii++] = m_row[jj];
+        }
+      }
+      else if (b_size == 1) {
         const cs_real_t *m_row = mc->e_val + ms->e.row_index[_row_id];
         for (jj = 0; jj < n_ed_cols && c_id[jj] < _row_id; jj++) {
           r->_col_id[ii] = c_id[jj];
@@ -5893,7 +6410,7 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
   if (x_val != nullptr)
     *x_val = nullptr;
 
-  if (matrix->type == CS_MATRIX_MSR) {
+  if (matrix->type == CS_MATRIX_MSR || matrix->type == CS_MATRIX_SELL) {
     auto ms = static_cast<const cs_matrix_struct_dist_t *>(matrix->structure);
     auto mc = static_cast<const cs_matrix_coeff_dist_t *>(matrix->coeffs);
     if (row_index != nullptr)
@@ -5914,6 +6431,146 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
        __func__, matrix->type_name);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get arrays describing a matrix in MSR format, with single-precision
+ *        extra-diagonal values.
+ *
+ * This function is similar to \ref cs_matrix_get_msr_arrays, for matrices
+ * whose extra-diagonal values have been converted to single precision
+ * using \ref cs_matrix_set_coefficients_type. For other MSR matrices,
+ * x_val is set to nullptr.
+ *
+ * \param[in]   matrix     pointer to matrix structure
+ * \param[out]  row_index  MSR row index
+ * \param[out]  col_id     MSR column id
+ * \param[out]  d_val      diagonal values
+ * \param[out]  x_val      single-precision extra-diagonal values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_get_msr_arrays_f(const cs_matrix_t   *matrix,
+                           const cs_lnum_t    **row_index,
+                           const cs_lnum_t    **col_id,
+                           const cs_real_t    **d_val,
+                           const float        **x_val)
+{
+  const cs_real_t *_x_val = nullptr;
+
+  cs_matrix_get_msr_arrays(matrix, row_index, col_id, d_val, &_x_val);
+
+  if (x_val != nullptr) {
+    *x_val = nullptr;
+    auto mc = static_cast<const cs_matrix_coeff_dist_t *>(matrix->coeffs);
+    if (mc != nullptr)
+      *x_val = mc->_e_val_f;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the floating-point type used to store a matrix's
+ *        extra-diagonal coefficients.
+ *
+ * \param[in]  matrix  pointer to matrix structure
+ *
+ * \return  CS_FLOAT if single precision storage is used, CS_DOUBLE otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_datatype_t
+cs_matrix_get_coefficients_type(const cs_matrix_t  *matrix)
+{
+  cs_datatype_t retval = CS_DOUBLE;
+
+  if (matrix->type == CS_MATRIX_MSR && matrix->coeffs != nullptr) {
+    auto mc = static_cast<const cs_matrix_coeff_dist_t *>(matrix->coeffs);
+    if (mc->_e_val_f != nullptr)
+      retval = CS_FLOAT;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the floating-point type used to store a matrix's
+ *        extra-diagonal coefficients.
+ *
+ * Only scalar MSR matrices with host-based coefficients may currently
+ * be switched to single precision (CS_FLOAT); this function has no effect
+ * for other matrices.
+ *
+ * Values are converted in place, and the double-precision array is freed,
+ * so \ref cs_matrix_get_msr_arrays will return nullptr extra-diagonal
+ * values. Diagonal values are kept in double precision, and vectors
+ * remain in double precision, so only the storage and memory bandwidth
+ * of the matrix coefficients is reduced. Coefficients are restored to
+ * double precision when new values are assigned to the matrix.
+ *
+ * \param[in, out]  matrix    pointer to matrix structure
+ * \param[in]       datatype  CS_FLOAT or CS_DOUBLE
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_type(cs_matrix_t    *matrix,
+                                cs_datatype_t   datatype)
+{
+  if (matrix == nullptr || matrix->coeffs == nullptr)
+    return;
+
+  if (   matrix->type != CS_MATRIX_MSR
+      || matrix->db_size != 1 || matrix->eb_size != 1
+      || matrix->alloc_mode > CS_ALLOC_HOST)
+    return;
+
+  auto ms = static_cast<const cs_matrix_struct_dist_t *>(matrix->structure);
+  auto mc = static_cast<cs_matrix_coeff_dist_t *>(matrix->coeffs);
+
+  const cs_lnum_t n_vals = ms->e.row_index[ms->n_rows];
+
+  if (datatype == CS_FLOAT && mc->e_val != nullptr) {
+
+    BFT_MALLOC(mc->_e_val_f, n_vals, float);
+
+    const cs_real_t *e_val = mc->e_val;
+    float *e_val_f = mc->_e_val_f;
+
+#   pragma omp parallel for  if(n_vals > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_vals; i++)
+      e_val_f[i] = (float)e_val[i];
+
+    CS_FREE(mc->_e_val);
+    mc->e_val = nullptr;
+
+  }
+
+  else if (datatype == CS_DOUBLE && mc->_e_val_f != nullptr) {
+
+    CS_MALLOC_HD(mc->_e_val, n_vals, cs_real_t, matrix->alloc_mode);
+
+    const float *e_val_f = mc->_e_val_f;
+    cs_real_t *e_val = mc->_e_val;
+
+#   pragma omp parallel for  if(n_vals > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_vals; i++)
+      e_val[i] = e_val_f[i];
+
+    mc->e_val = mc->_e_val;
+    BFT_FREE(mc->_e_val_f);
+
+  }
+
+  else
+    return;
+
+  /* Only the default SpMV functions handle single-precision coefficients */
+
+  cs_matrix_spmv_set_defaults(matrix);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Associate mesh information with a matrix.
@@ -6293,6 +6950,27 @@ cs_matrix_vector_multiply_partial_d(const cs_matrix_t      *matrix,
               cs_matrix_fill_type_name[matrix->fill_type]);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if a device matrix.vector product is available for a
+ *        given operation type with the current matrix fill type.
+ *
+ * \param[in]  matrix   pointer to matrix structure
+ * \param[in]  op_type  SpMV operation type
+ *
+ * \return  true if the matching device SpMV function is defined
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_vector_multiply_d_is_available(const cs_matrix_t      *matrix,
+                                         cs_matrix_spmv_type_t   op_type)
+{
+  assert(matrix != nullptr);
+
+  return (matrix->vector_multiply_d[matrix->fill_type][op_type] != nullptr);
+}
+
 #endif /* defined(HAVE_ACCEL) */
 
 /*----------------------------------------------------------------------------*/
@@ -6549,6 +7227,52 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
 
   }
 
+  if (m->type == CS_MATRIX_SELL) {
+
+    _variant_add(_("SELL-C-sigma"),
+                 m->type,
+                 m->fill_type,
+                 m->numbering,
+                 "default",
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+    _variant_add(_("SELL-C-sigma, MSR kernel"),
+                 m->type,
+                 m->fill_type,
+                 m->numbering,
+                 "msr",
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#if defined(HAVE_CUDA)
+
+    if (cs_get_device_id() > -1) {
+      _variant_add(_("SELL-C-sigma, CUDA"),
+                   m->type,
+                   m->fill_type,
+                   m->numbering,
+                   "cuda",
+                   n_variants,
+                   &n_variants_max,
+                   m_variant);
+
+      _variant_add(_("SELL-C-sigma, MSR CUDA kernel"),
+                   m->type,
+                   m->fill_type,
+                   m->numbering,
+                   "msr_cuda",
+                   n_variants,
+                   &n_variants_max,
+                   m_variant);
+    }
+
+#endif /* defined(HAVE_CUDA) */
+
+  }
+
   n_variants_max = *n_variants;
   BFT_REALLOC(*m_variant, *n_variants, cs_matrix_variant_t);
 }
@@ -60,6 +60,9 @@ typedef enum {
   CS_MATRIX_DIST,             /*!< Distributed matrix storage
                                    (separate diagonal, off-diagonal, and
                                    distant coefficients) */
+  CS_MATRIX_SELL,             /*!< Sliced ELLPACK (SELL-C-sigma) storage
+                                   (separate diagonal, MSR-compatible
+                                   row access) */
 
   CS_MATRIX_N_BUILTIN_TYPES,  /*!< Number of known and built-in matrix types */
 
@@ -276,6 +279,23 @@ cs_matrix_structure_create_from_assembler(cs_matrix_type_t        type,
 void
 cs_matrix_structure_destroy(cs_matrix_structure_t  **ms);
 
+/*----------------------------------------------------------------------------
+ * Set parameters for sliced ELLPACK (SELL-C-sigma) matrix structures.
+ *
+ * These parameters apply to structures built after this call.
+ *
+ * parameters:
+ *   slice_size <-- number of rows per slice (C), or 0 for automatic
+ *                  (SIMD width on host, warp size when a device is used)
+ *   sigma      <-- size of row windows inside which rows are sorted
+ *                  by decreasing length (rounded to a multiple of
+ *                  slice_size), or 0 for automatic
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_sell_parameters(cs_lnum_t  slice_size,
+                              cs_lnum_t  sigma);
+
 /*----------------------------------------------------------------------------
  * Create a matrix container using a given structure.
  *
@@ -559,6 +579,46 @@ cs_matrix_set_coefficients(cs_matrix_t        *matrix,
                            const cs_real_t    *da,
                            const cs_real_t    *xa);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set matrix coefficients for a matrix-free face-based operator.
+ *
+ * Only the diagonal is mapped. The extra-diagonal coefficients of the
+ * upwind convection / non-reconstructed diffusion operator (as built by
+ * \ref cs_matrix_wrapper_scalar) are recomputed from the face mass flux
+ * and viscosity at each matrix.vector product, so no per-face
+ * coefficients are stored.
+ *
+ * This is only available for scalar matrices in native format.
+ * As the extra-diagonal coefficients are not available, such matrices
+ * may not be used to build multigrid hierarchies or to be converted
+ * to other formats. The shared arrays must remain valid as long as
+ * the coefficients are used.
+ *
+ * \param[in, out]  matrix      pointer to matrix structure
+ * \param[in]       symmetric   indicates if matrix coefficients
+ *                              are symmetric
+ * \param[in]       da          diagonal values
+ * \param[in]       iconvp      1 for convection, 0 otherwise
+ *                              (must be 0 if symmetric)
+ * \param[in]       idiffp      1 for diffusion, 0 otherwise
+ * \param[in]       thetap      theta-scheme weighting coefficient
+ * \param[in]       i_massflux  mass flux at interior faces
+ *                              (may be nullptr if iconvp = 0)
+ * \param[in]       i_visc      face viscosity at interior faces
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_face_operator(cs_matrix_t      *matrix,
+                                         bool              symmetric,
+                                         const cs_real_t  *da,
+                                         int               iconvp,
+                                         int               idiffp,
+                                         cs_real_t         thetap,
+                                         const cs_real_t  *i_massflux,
+                                         const cs_real_t  *i_visc);
+
 /*----------------------------------------------------------------------------
  * Set matrix coefficients, copying values to private arrays.
  *
@@ -831,7 +891,8 @@ cs_matrix_get_csr_arrays(const cs_matrix_t   *matrix,
  * Get arrays describing a matrix in MSR format.
  *
  * This function only works for an MSR matrix (i.e. there is
- * no automatic conversion from another matrix type).
+ * no automatic conversion from another matrix type), or for a
+ * SELL-C-sigma matrix, which also maintains an MSR representation.
  *
  * Matrix block sizes can be obtained by cs_matrix_get_diag_block_size()
  * and cs_matrix_get_extra_diag_block_size().
@@ -851,6 +912,70 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
                          const cs_real_t    **d_val,
                          const cs_real_t    **x_val);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get arrays describing a matrix in MSR format, with single-precision
+ *        extra-diagonal values.
+ *
+ * This function is similar to \ref cs_matrix_get_msr_arrays, for matrices
+ * whose extra-diagonal values have been converted to single precision
+ * using \ref cs_matrix_set_coefficients_type. For other MSR matrices,
+ * x_val is set to nullptr.
+ *
+ * \param[in]   matrix     pointer to matrix structure
+ * \param[out]  row_index  MSR row index
+ * \param[out]  col_id     MSR column id
+ * \param[out]  d_val      diagonal values
+ * \param[out]  x_val      single-precision extra-diagonal values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_get_msr_arrays_f(const cs_matrix_t   *matrix,
+                           const cs_lnum_t    **row_index,
+                           const cs_lnum_t    **col_id,
+                           const cs_real_t    **d_val,
+                           const float        **x_val);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the floating-point type used to store a matrix's
+ *        extra-diagonal coefficients.
+ *
+ * \param[in]  matrix  pointer to matrix structure
+ *
+ * \return  CS_FLOAT if single precision storage is used, CS_DOUBLE otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_datatype_t
+cs_matrix_get_coefficients_type(const cs_matrix_t  *matrix);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the floating-point type used to store a matrix's
+ *        extra-diagonal coefficients.
+ *
+ * Only scalar MSR matrices with host-based coefficients may currently
+ * be switched to single precision (CS_FLOAT); this function has no effect
+ * for other matrices.
+ *
+ * Values are converted in place, and the double-precision array is freed,
+ * so \ref cs_matrix_get_msr_arrays will return nullptr extra-diagonal
+ * values. Diagonal values are kept in double precision, and vectors
+ * remain in double precision, so only the storage and memory bandwidth
+ * of the matrix coefficients is reduced. Coefficients are restored to
+ * double precision when new values are assigned to the matrix.
+ *
+ * \param[in, out]  matrix    pointer to matrix structure
+ * \param[in]       datatype  CS_FLOAT or CS_DOUBLE
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_coefficients_type(cs_matrix_t    *matrix,
+                                cs_datatype_t   datatype);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Associate mesh information with a matrix.
@@ -1029,6 +1154,22 @@ cs_matrix_vector_multiply_partial_d(const cs_matrix_t      *matrix,
                                     cs_real_t              *x,
                                     cs_real_t              *y);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if a device matrix.vector product is available for a
+ *        given operation type with the current matrix fill type.
+ *
+ * \param[in]  matrix   pointer to matrix structure
+ * \param[in]  op_type  SpMV operation type
+ *
+ * \return  true if the matching device SpMV function is defined
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_vector_multiply_d_is_available(const cs_matrix_t      *matrix,
+                                         cs_matrix_spmv_type_t   op_type);
+
 #endif /* defined(HAVE_ACCEL) */
 
 /*----------------------------------------------------------------------------
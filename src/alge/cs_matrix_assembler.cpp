@@ -3489,6 +3489,256 @@ cs_matrix_assembler_values_add_g(cs_matrix_assembler_values_t  *mav,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Resolve global row and column ids to coefficient slots.
+ *
+ * For a given matrix assembler structure, the slots only depend on the
+ * matrix structure, so they may be computed once and reused for each
+ * assembly of values, using \ref cs_matrix_assembler_values_add_slots,
+ * thus avoiding the searches done at each call of
+ * \ref cs_matrix_assembler_values_add_g.
+ *
+ * For rows assigned to the local rank, the slot is defined by the local
+ * row id and the column index in that row. For rows assigned to other
+ * ranks, the row part is set to -1, and the column part is the index in
+ * the assembler's coefficient send buffer.
+ *
+ * This function may be called by different threads.
+ *
+ * \param[in]   ma        pointer to matrix assembler structure
+ * \param[in]   n         number of entries
+ * \param[in]   row_g_id  global row ids associated with entries
+ * \param[in]   col_g_id  global column ids associated with entries
+ * \param[out]  slot_row  local row id (or -1) of slot for entries
+ * \param[out]  slot_col  column (or send buffer) index of slot for entries
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_get_slots(const cs_matrix_assembler_t  *ma,
+                              cs_lnum_t                     n,
+                              const cs_gnum_t               row_g_id[],
+                              const cs_gnum_t               col_g_id[],
+                              cs_lnum_t                     slot_row[],
+                              cs_lnum_t                     slot_col[])
+{
+  for (cs_lnum_t k = 0; k < n; k++) {
+
+    cs_gnum_t g_r_id = row_g_id[k];
+    cs_gnum_t g_c_id = col_g_id[k];
+
+#if defined(HAVE_MPI)
+
+    /* Case where coefficient is handled by other rank */
+
+    if (g_r_id < ma->l_range[0] || g_r_id >= ma->l_range[1]) {
+
+      cs_lnum_t e_r_id = _g_id_binary_find(ma->coeff_send_n_rows,
+                                           g_r_id,
+                                           ma->coeff_send_row_g_id);
+
+      cs_lnum_t r_start = ma->coeff_send_index[e_r_id];
+      cs_lnum_t n_e_rows = ma->coeff_send_index[e_r_id+1] - r_start;
+
+      slot_row[k] = -1;
+      slot_col[k] =   r_start
+                    + _g_id_binary_find(n_e_rows,
+                                        g_c_id,
+                                        ma->coeff_send_col_g_id + r_start);
+
+      continue;
+    }
+
+#endif /* HAVE_MPI */
+
+    cs_lnum_t l_r_id = g_r_id - ma->l_range[0];
+
+    slot_row[k] = l_r_id;
+
+    cs_lnum_t n_l_cols = ma->r_idx[l_r_id+1] - ma->r_idx[l_r_id];
+    if (ma->d_r_idx != nullptr)
+      n_l_cols -= ma->d_r_idx[l_r_id+1] - ma->d_r_idx[l_r_id];
+
+    /* Local part */
+
+    if (g_c_id >= ma->l_range[0] && g_c_id < ma->l_range[1]) {
+
+      cs_lnum_t l_c_id = g_c_id - ma->l_range[0];
+
+      slot_col[k] = _l_id_binary_search(n_l_cols,
+                                        l_c_id,
+                                        ma->c_id + ma->r_idx[l_r_id]);
+
+      assert(slot_col[k] > -1 || (ma->separate_diag && l_c_id == l_r_id));
+
+    }
+
+    /* Distant part */
+
+    else {
+
+      assert(ma->d_r_idx != nullptr);
+
+      cs_lnum_t n_cols = ma->d_r_idx[l_r_id+1] - ma->d_r_idx[l_r_id];
+
+      cs_lnum_t d_c_idx = _g_id_binary_find(n_cols,
+                                            g_c_id,
+                                            ma->d_g_c_id + ma->d_r_idx[l_r_id]);
+
+      /* column ids start and end of local row, so add n_l_cols */
+      slot_col[k] = d_c_idx + n_l_cols;
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add values to a matrix assembler values structure using
+ *        coefficient slots.
+ *
+ * The slots must have been computed using \ref cs_matrix_assembler_get_slots
+ * with the matrix assembler structure associated with this matrix
+ * assembler values structure. The same rules as for
+ * \ref cs_matrix_assembler_values_add_g apply regarding block sizes
+ * and diagonal coefficients.
+ *
+ * This function may be called by different threads, as long those threads
+ * do not add contributions to the same rows (assuming caution is taken
+ * in the case of external libraries so that their builder functions
+ * have the same property).
+ *
+ * \param[in, out]  mav       pointer to matrix assembler values structure
+ * \param[in]       n         number of entries
+ * \param[in]       slot_row  local row id (or -1) of slot for entries
+ * \param[in]       slot_col  column (or send buffer) index of slot for entries
+ * \param[in]       val       values associated with entries
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_values_add_slots(cs_matrix_assembler_values_t  *mav,
+                                     cs_lnum_t                      n,
+                                     const cs_lnum_t                slot_row[],
+                                     const cs_lnum_t                slot_col[],
+                                     const cs_real_t                val[])
+{
+  const cs_matrix_assembler_t  *ma = mav->ma;
+
+  if (n < 1)
+    return;
+
+  /* Base stride on first type of value encountered; values for distant
+     rows are extra-diagonal when block sizes differ */
+
+  cs_lnum_t stride = mav->eb_size * mav->eb_size;
+
+  if (slot_row[0] > -1) {
+    cs_lnum_t l_r_id = slot_row[0];
+    if (   slot_col[0] < 0
+        || ma->c_id[ma->r_idx[l_r_id] + slot_col[0]] == l_r_id)
+      stride = mav->db_size * mav->db_size;
+  }
+
+  cs_lnum_t s_row_id[COEFF_GROUP_SIZE];
+  cs_lnum_t s_col_idx[COEFF_GROUP_SIZE];
+  cs_gnum_t s_g_row_id[COEFF_GROUP_SIZE];
+  cs_gnum_t s_g_col_id[COEFF_GROUP_SIZE];
+
+  for (cs_lnum_t i = 0; i < n; i+= COEFF_GROUP_SIZE) {
+
+    cs_lnum_t b_size = COEFF_GROUP_SIZE;
+    if (i + COEFF_GROUP_SIZE > n)
+      b_size = n - i;
+
+    for (cs_lnum_t j = 0; j < b_size; j++) {
+
+      cs_lnum_t k = i+j;
+
+      /* Case where coefficient is handled by other rank */
+
+      if (slot_row[k] < 0) {
+
+#if defined(HAVE_MPI)
+        cs_lnum_t e_id = slot_col[k];
+        for (cs_lnum_t l = 0; l < stride; l++)
+#         pragma omp atomic
+          mav->coeff_send[e_id*stride + l] += val[k*stride + l];
+#endif
+
+        s_row_id[j] = -1;
+        s_col_idx[j] = -1;
+
+      }
+
+      /* Standard case */
+
+      else {
+        s_row_id[j] = slot_row[k];
+        s_col_idx[j] = slot_col[k];
+      }
+
+    }
+
+    if (mav->add_values_g != nullptr) { /* global id-based function */
+
+      for (cs_lnum_t j = 0; j < b_size; j++) {
+
+        cs_lnum_t l_r_id = s_row_id[j];
+
+        if (l_r_id < 0) { /* filter other-rank values */
+          s_g_row_id[j] = ma->l_range[1];
+          s_g_col_id[j] = 0;
+          continue;
+        }
+
+        cs_lnum_t c_idx = s_col_idx[j];
+
+        cs_lnum_t n_l_cols = ma->r_idx[l_r_id+1] - ma->r_idx[l_r_id];
+        if (ma->d_r_idx != nullptr)
+          n_l_cols -= ma->d_r_idx[l_r_id+1] - ma->d_r_idx[l_r_id];
+
+        s_g_row_id[j] = ma->l_range[0] + l_r_id;
+
+        if (c_idx < 0) /* separate diagonal */
+          s_g_col_id[j] = s_g_row_id[j];
+        else if (c_idx < n_l_cols)
+          s_g_col_id[j] = ma->l_range[0] + ma->c_id[ma->r_idx[l_r_id] + c_idx];
+        else
+          s_g_col_id[j] = ma->d_g_c_id[ma->d_r_idx[l_r_id] + c_idx - n_l_cols];
+
+      }
+
+      mav->add_values_g(mav->matrix,
+                        b_size,
+                        stride,
+                        s_g_row_id,
+                        s_g_col_id,
+                        val + (i*stride));
+
+    }
+
+    else if (ma->separate_diag == mav->separate_diag)
+      mav->add_values(mav->matrix,
+                      b_size,
+                      stride,
+                      s_row_id,
+                      s_col_idx,
+                      val + (i*stride));
+
+    else
+      _matrix_assembler_values_add_cnv_idx(mav,
+                                           b_size,
+                                           stride,
+                                           s_row_id,
+                                           s_col_idx,
+                                           val + (i*stride));
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Start assembly of matrix values structure.
@@ -649,6 +649,71 @@ cs_matrix_assembler_values_add_g(cs_matrix_assembler_values_t  *mav,
                                  const cs_gnum_t                col_g_id[],
                                  const cs_real_t                val[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Resolve global row and column ids to coefficient slots.
+ *
+ * For a given matrix assembler structure, the slots only depend on the
+ * matrix structure, so they may be computed once and reused for each
+ * assembly of values, using \ref cs_matrix_assembler_values_add_slots,
+ * thus avoiding the searches done at each call of
+ * \ref cs_matrix_assembler_values_add_g.
+ *
+ * For rows assigned to the local rank, the slot is defined by the local
+ * row id and the column index in that row. For rows assigned to other
+ * ranks, the row part is set to -1, and the column part is the index in
+ * the assembler's coefficient send buffer.
+ *
+ * This function may be called by different threads.
+ *
+ * \param[in]   ma        pointer to matrix assembler structure
+ * \param[in]   n         number of entries
+ * \param[in]   row_g_id  global row ids associated with entries
+ * \param[in]   col_g_id  global column ids associated with entries
+ * \param[out]  slot_row  local row id (or -1) of slot for entries
+ * \param[out]  slot_col  column (or send buffer) index of slot for entries
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_get_slots(const cs_matrix_assembler_t  *ma,
+                              cs_lnum_t                     n,
+                              const cs_gnum_t               row_g_id[],
+                              const cs_gnum_t               col_g_id[],
+                              cs_lnum_t                     slot_row[],
+                              cs_lnum_t                     slot_col[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add values to a matrix assembler values structure using
+ *        coefficient slots.
+ *
+ * The slots must have been computed using \ref cs_matrix_assembler_get_slots
+ * with the matrix assembler structure associated with this matrix
+ * assembler values structure. The same rules as for
+ * \ref cs_matrix_assembler_values_add_g apply regarding block sizes
+ * and diagonal coefficients.
+ *
+ * This function may be called by different threads, as long those threads
+ * do not add contributions to the same rows (assuming caution is taken
+ * in the case of external libraries so that their builder functions
+ * have the same property).
+ *
+ * \param[in, out]  mav       pointer to matrix assembler values structure
+ * \param[in]       n         number of entries
+ * \param[in]       slot_row  local row id (or -1) of slot for entries
+ * \param[in]       slot_col  column (or send buffer) index of slot for entries
+ * \param[in]       val       values associated with entries
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_assembler_values_add_slots(cs_matrix_assembler_values_t  *mav,
+                                     cs_lnum_t                      n,
+                                     const cs_lnum_t                slot_row[],
+                                     const cs_lnum_t                slot_col[],
+                                     const cs_real_t                val[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Start assembly of matrix values structure.
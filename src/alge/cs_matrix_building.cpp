@@ -49,6 +49,8 @@
 #include "bft_printf.h"
 
 #include "cs_blas.h"
+#include "cs_boundary_conditions.h"
+#include "cs_convection_diffusion_priv.h"
 #include "cs_dispatch.h"
 #include "cs_halo.h"
 #include "cs_halo_perio.h"
@@ -126,6 +128,7 @@
  *                               at border faces for the matrix
  * \param[out]    da            diagonal part of the matrix
  * \param[out]    xa            extra diagonal part of the matrix
+ *                               (or nullptr)
  */
 /*----------------------------------------------------------------------------*/
 
@@ -168,18 +171,21 @@ _sym_matrix_scalar(const cs_mesh_t            *m,
       cs_lnum_t ii = i_face_cells[f_id][0];
       cs_lnum_t jj = i_face_cells[f_id][1];
 
-      xa[f_id] = -thetap*i_visc[f_id];
+      cs_real_t xa_f = -thetap*i_visc[f_id];
+
+      if (xa != nullptr)
+        xa[f_id] = xa_f;
 
       if (ii < n_cells)
-        cs_dispatch_sum(&da[ii], -xa[f_id], i_sum_type);
+        cs_dispatch_sum(&da[ii], -xa_f, i_sum_type);
       if (jj < n_cells)
-        cs_dispatch_sum(&da[jj], -xa[f_id], i_sum_type);
+        cs_dispatch_sum(&da[jj], -xa_f, i_sum_type);
 
     });
 
   }
 
-  else {
+  else if (xa != nullptr) {
 
     ctx.parallel_for(n_i_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_id) {
       xa[f_id] = 0.;
@@ -246,6 +252,7 @@ _sym_matrix_scalar(const cs_mesh_t            *m,
  * \param[in]     xcpp          array of specific heat (Cp)
  * \param[out]    da            diagonal part of the matrix
  * \param[out]    xa            extra interleaved diagonal part of the matrix
+ *                               (or nullptr)
  */
 /*----------------------------------------------------------------------------*/
 
@@ -304,8 +311,13 @@ _matrix_scalar(const cs_mesh_t            *m,
 
     /* Computation of extradiagonal terms */
 
-    xa[f_id][0] = thetap*(iconvp*cpi*flui -idiffp*i_visc[f_id]);
-    xa[f_id][1] = thetap*(iconvp*cpj*fluj -idiffp*i_visc[f_id]);
+    cs_real_t xa_ij = thetap*(iconvp*cpi*flui -idiffp*i_visc[f_id]);
+    cs_real_t xa_ji = thetap*(iconvp*cpj*fluj -idiffp*i_visc[f_id]);
+
+    if (xa != nullptr) {
+      xa[f_id][0] = xa_ij;
+      xa[f_id][1] = xa_ji;
+    }
 
     /* D_ii =  theta (m_ij)^+ - m_ij
      *      = -X_ij - (1-theta)*m_ij
@@ -313,8 +325,8 @@ _matrix_scalar(const cs_mesh_t            *m,
      *      = -X_ji + (1-theta)*m_ij
      */
 
-    cs_real_t ifac = xa[f_id][0] + iconvp * (1.-thetap) * cpi * _i_massflux;
-    cs_real_t jfac = xa[f_id][1] - iconvp * (1.-thetap) * cpj * _i_massflux;
+    cs_real_t ifac = xa_ij + iconvp * (1.-thetap) * cpi * _i_massflux;
+    cs_real_t jfac = xa_ji - iconvp * (1.-thetap) * cpj * _i_massflux;
 
     if (ii < n_cells)
       cs_dispatch_sum(&da[ii], -ifac, i_sum_type);
@@ -354,6 +366,191 @@ _matrix_scalar(const cs_mesh_t            *m,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the advection/diffusion matrix for a scalar field and add
+ * the associated explicit balance of the previous time step values to the
+ * right-hand side, in a single sweep over faces.
+ *
+ * Both the advection and the explicit balance are upwind, and the
+ * diffusion is not reconstructed, so that the matrix and the right-hand
+ * side contributions share the same face loops. The explicit balance
+ * matches the one computed by \ref cs_balance_scalar with imasac = 0 and
+ * inc = 1 in this case.
+ *
+ * \param[in]     m             pointer to mesh structure
+ * \param[in]     iconvp        indicator
+ *                               - 1 advection
+ *                               - 0 otherwise
+ * \param[in]     idiffp        indicator
+ *                               - 1 diffusion
+ *                               - 0 otherwise
+ * \param[in]     isym          indicator
+ *                               - 1 symmetric matrix
+ *                               - 2 non symmmetric matrix
+ * \param[in]     thetap        weighting coefficient for the theta-scheme
+ *                               (implicit part)
+ * \param[in]     thetex        weighting coefficient for the explicit part
+ * \param[in]     bc_coeffs     boundary condition structure for the variable
+ * \param[in]     rovsdt        working array
+ * \param[in]     i_massflux    mass flux at interior faces
+ * \param[in]     b_massflux    mass flux at border faces
+ * \param[in]     i_viscm       \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                               at interior faces for the matrix
+ * \param[in]     b_viscm       \f$ S_\fib \f$
+ *                               at border faces for the matrix
+ * \param[in]     i_visc        \f$ \mu_\fij \dfrac{S_\fij}{\ipf \jpf} \f$
+ *                               at interior faces for the r.h.s.
+ * \param[in]     b_visc        \f$ S_\fib \f$
+ *                               at border faces for the r.h.s.
+ * \param[in]     pvara         variable at the previous time step
+ *                               (synchronized)
+ * \param[out]    da            diagonal part of the matrix
+ * \param[out]    xa            extra diagonal part of the matrix
+ *                               (or nullptr)
+ * \param[in,out] rhs           right hand side
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_matrix_scalar_upwind_rhs(const cs_mesh_t            *m,
+                          int                         iconvp,
+                          int                         idiffp,
+                          int                         isym,
+                          double                      thetap,
+                          double                      thetex,
+                          const cs_field_bc_coeffs_t *bc_coeffs,
+                          const cs_real_t             rovsdt[],
+                          const cs_real_t             i_massflux[],
+                          const cs_real_t             b_massflux[],
+                          const cs_real_t             i_viscm[],
+                          const cs_real_t             b_viscm[],
+                          const cs_real_t             i_visc[],
+                          const cs_real_t             b_visc[],
+                          const cs_real_t             pvara[],
+                          cs_real_t         *restrict da,
+                          cs_real_t         *restrict xa,
+                          cs_real_t         *restrict rhs)
+{
+  const cs_real_t *coefap = bc_coeffs->a;
+  const cs_real_t *coefbp = bc_coeffs->b;
+  const cs_real_t *cofafp = bc_coeffs->af;
+  const cs_real_t *cofbfp = bc_coeffs->bf;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *)m->b_face_cells;
+
+  const int *bc_type = cs_glob_bc_type;
+
+  cs_real_2_t *restrict xa2 = (isym == 2) ? (cs_real_2_t *)xa : nullptr;
+
+  cs_dispatch_context ctx;
+  cs_dispatch_sum_type_t i_sum_type = ctx.get_parallel_for_i_faces_sum_type(m);
+  cs_dispatch_sum_type_t b_sum_type = ctx.get_parallel_for_b_faces_sum_type(m);
+
+  /* Initialization */
+
+  ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    da[c_id] = rovsdt[c_id];
+  });
+
+  /* Interior faces: extra-diagonal terms, contribution to the diagonal,
+     and explicit upwind balance */
+
+  ctx.parallel_for_i_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  f_id) {
+
+    cs_lnum_t ii = i_face_cells[f_id][0];
+    cs_lnum_t jj = i_face_cells[f_id][1];
+
+    cs_real_t _i_massflux = i_massflux[f_id];
+    cs_real_t flui =  0.5*(_i_massflux - cs_math_fabs(_i_massflux));
+    cs_real_t fluj = -0.5*(_i_massflux + cs_math_fabs(_i_massflux));
+
+    cs_real_t xa_ij = thetap*(iconvp*flui -idiffp*i_viscm[f_id]);
+    cs_real_t xa_ji = thetap*(iconvp*fluj -idiffp*i_viscm[f_id]);
+
+    if (xa2 != nullptr) {
+      xa2[f_id][0] = xa_ij;
+      xa2[f_id][1] = xa_ji;
+    }
+    else if (xa != nullptr)
+      xa[f_id] = xa_ij;
+
+    cs_real_t ifac = xa_ij + iconvp * (1.-thetap) * _i_massflux;
+    cs_real_t jfac = xa_ji - iconvp * (1.-thetap) * _i_massflux;
+
+    /* Explicit part; as we are upwind, the face values are
+       pvara[ii] or pvara[jj] */
+
+    cs_real_t flux = 0.;
+
+    if (iconvp == 1)
+      flux += thetex * (- fluj*pvara[ii] + flui*pvara[jj]);
+
+    flux += idiffp*thetex*i_visc[f_id]*(pvara[ii] - pvara[jj]);
+
+    if (ii < n_cells) {
+      cs_dispatch_sum(&da[ii], -ifac, i_sum_type);
+      cs_dispatch_sum(&rhs[ii], -flux, i_sum_type);
+    }
+    if (jj < n_cells) {
+      cs_dispatch_sum(&da[jj], -jfac, i_sum_type);
+      cs_dispatch_sum(&rhs[jj], flux, i_sum_type);
+    }
+
+  });
+
+  /* Boundary faces: contribution to the diagonal and explicit
+     upwind balance */
+
+  ctx.parallel_for_b_faces(m, [=] CS_F_HOST_DEVICE (cs_lnum_t  f_id) {
+
+    cs_lnum_t ii = b_face_cells[f_id];
+
+    cs_real_t _b_massflux = b_massflux[f_id];
+    cs_real_t flui = 0.5*(_b_massflux - cs_math_fabs(_b_massflux));
+
+    cs_real_t bfac = iconvp *(  flui * thetap * (coefbp[f_id] - 1.)
+                              - (1. - thetap) * _b_massflux)
+                   + idiffp * thetap * b_viscm[f_id] * cofbfp[f_id];
+
+    cs_real_t pi = pvara[ii];
+    cs_real_t flux = 0.;
+
+    cs_b_upwind_flux(iconvp,
+                     thetex,
+                     0, /* imasac */
+                     1, /* inc */
+                     bc_type[f_id],
+                     pi,
+                     pi,
+                     pi,
+                     coefap[f_id],
+                     coefbp[f_id],
+                     _b_massflux,
+                     1.,
+                     &flux);
+
+    cs_b_diff_flux(idiffp,
+                   thetex,
+                   1, /* inc */
+                   pi,
+                   cofafp[f_id],
+                   cofbfp[f_id],
+                   b_visc[f_id],
+                   &flux);
+
+    cs_dispatch_sum(&da[ii], bfac, b_sum_type);
+    cs_dispatch_sum(&rhs[ii], -flux, b_sum_type);
+
+  });
+
+  ctx.wait();
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Build the diffusion matrix for a vector field
@@ -1165,6 +1362,9 @@ BEGIN_C_DECLS
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_scalar (or its counterpart for
  * symmetric matrices)
+ *
+ * If xa is nullptr, only the diagonal is computed, for use with
+ * cs_matrix_set_coefficients_face_operator (matrix-free operator).
  *----------------------------------------------------------------------------*/
 
 void
@@ -1195,6 +1395,11 @@ cs_matrix_wrapper_scalar(int                         iconvp,
               _("invalid value of isym"));
   }
 
+  if (xa == nullptr && isym == 2 && imucpp != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: matrix-free operator not available with imucpp = 1"),
+              __func__);
+
   /* Symmetric matrix */
   if (isym == 1) {
     _sym_matrix_scalar(m,
@@ -1266,6 +1471,94 @@ cs_matrix_wrapper_scalar(int                         iconvp,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Build the matrix of a scalar convection/diffusion equation, and add the
+ * explicit part of the balance of the previous time step values to the
+ * right-hand side, with a single sweep over faces.
+ *
+ * This combined building is restricted to pure upwind advection, without
+ * diffusive flux reconstruction, Cp multiplier, imposed boundary convective
+ * flux or internal coupling (this is checked by
+ * cs_equation_iterative_solve_scalar before calling it). The matrix is the
+ * same as the one obtained with cs_matrix_wrapper_scalar, and the
+ * right-hand side update the same as the one of cs_balance_scalar with
+ * theta = thetex, imasac = 0 and inc = 1.
+ *
+ * If xa is nullptr, only the diagonal is computed, for use with
+ * cs_matrix_set_coefficients_face_operator (matrix-free operator).
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_wrapper_scalar_upwind_rhs(int                         iconvp,
+                                    int                         idiffp,
+                                    int                         ndircp,
+                                    int                         isym,
+                                    double                      thetap,
+                                    double                      thetex,
+                                    const cs_field_bc_coeffs_t *bc_coeffs,
+                                    const cs_real_t             rovsdt[],
+                                    const cs_real_t             i_massflux[],
+                                    const cs_real_t             b_massflux[],
+                                    const cs_real_t             i_viscm[],
+                                    const cs_real_t             b_viscm[],
+                                    const cs_real_t             i_visc[],
+                                    const cs_real_t             b_visc[],
+                                    const cs_real_t             pvara[],
+                                    cs_real_t                   da[],
+                                    cs_real_t                   xa[],
+                                    cs_real_t                   rhs[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t n_cells = m->n_cells;
+
+  cs_dispatch_context ctx;
+
+  if (isym != 1 && isym != 2) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("invalid value of isym"));
+  }
+
+  _matrix_scalar_upwind_rhs(m,
+                            iconvp,
+                            idiffp,
+                            isym,
+                            thetap,
+                            thetex,
+                            bc_coeffs,
+                            rovsdt,
+                            i_massflux,
+                            b_massflux,
+                            i_viscm,
+                            b_viscm,
+                            i_visc,
+                            b_visc,
+                            pvara,
+                            da,
+                            xa,
+                            rhs);
+
+  /* Penalization if non invertible matrix (see cs_matrix_wrapper_scalar) */
+
+  if (ndircp <= 0) {
+    const cs_real_t epsi = 1.e-7;
+
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+      da[c_id] *= (1. + epsi);
+    });
+  }
+
+  /* If a whole line of the matrix is 0, the diagonal is set to 1 */
+  if (mq->has_disable_flag == 1) {
+    int *c_disable_flag = mq->c_disable_flag;
+
+    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+      da[c_id] += (cs_real_t)c_disable_flag[c_id];
+    });
+  }
+  ctx.wait();
+}
+
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_vector (or its counterpart for
  * symmetric matrices)
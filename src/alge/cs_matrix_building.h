@@ -65,6 +65,9 @@ BEGIN_C_DECLS
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_scalar (or its counterpart for
  * symmetric matrices)
+ *
+ * If xa is nullptr, only the diagonal is computed, for use with
+ * cs_matrix_set_coefficients_face_operator (matrix-free operator).
  *----------------------------------------------------------------------------*/
 
 void
@@ -84,6 +87,43 @@ cs_matrix_wrapper_scalar(int                         iconvp,
                          cs_real_t                   da[],
                          cs_real_t                   xa[]);
 
+/*----------------------------------------------------------------------------
+ * Build the matrix of a scalar convection/diffusion equation, and add the
+ * explicit part of the balance of the previous time step values to the
+ * right-hand side, with a single sweep over faces.
+ *
+ * This combined building is restricted to pure upwind advection, without
+ * diffusive flux reconstruction, Cp multiplier, imposed boundary convective
+ * flux or internal coupling (this is checked by
+ * cs_equation_iterative_solve_scalar before calling it). The matrix is the
+ * same as the one obtained with cs_matrix_wrapper_scalar, and the
+ * right-hand side update the same as the one of cs_balance_scalar with
+ * theta = thetex, imasac = 0 and inc = 1.
+ *
+ * If xa is nullptr, only the diagonal is computed, for use with
+ * cs_matrix_set_coefficients_face_operator (matrix-free operator).
+ *----------------------------------------------------------------------------*/
+
+void
+cs_matrix_wrapper_scalar_upwind_rhs(int                         iconvp,
+                                    int                         idiffp,
+                                    int                         ndircp,
+                                    int                         isym,
+                                    double                      thetap,
+                                    double                      thetex,
+                                    const cs_field_bc_coeffs_t *bc_coeffs,
+                                    const cs_real_t             rovsdt[],
+                                    const cs_real_t             i_massflux[],
+                                    const cs_real_t             b_massflux[],
+                                    const cs_real_t             i_viscm[],
+                                    const cs_real_t             b_viscm[],
+                                    const cs_real_t             i_visc[],
+                                    const cs_real_t             b_visc[],
+                                    const cs_real_t             pvara[],
+                                    cs_real_t                   da[],
+                                    cs_real_t                   xa[],
+                                    cs_real_t                   rhs[]);
+
 /*----------------------------------------------------------------------------
  * Wrapper to cs_matrix_vector (or its counterpart for
  * symmetric matrices)
@@ -872,6 +872,12 @@ cs_matrix_get_tuning_runs(void)
 /*!
  * \brief Set default matrix type for a given fill type.
  *
+ * SpMV tuning only compares variants of a given matrix type, so this is
+ * also how sliced ELLPACK storage is selected: setting \ref CS_MATRIX_SELL
+ * for a scalar fill type makes it used for iterative solvers (including
+ * those forced to MSR on accelerated devices or for Gauss-Seidel).
+ * Multigrid solvers and preconditioners keep using MSR matrices.
+ *
  * \param[in] fill type  Fill type for which tuning behavior is set
  * \param[in] type       Matrix type to use
  */
@@ -884,6 +890,22 @@ cs_matrix_default_set_type(cs_matrix_fill_type_t  fill_type,
   _default_type[fill_type] = type;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return default matrix type for a given fill type.
+ *
+ * \param[in] fill type  Fill type queried
+ *
+ * \return  default matrix type for this fill type
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_type_t
+cs_matrix_default_get_type(cs_matrix_fill_type_t  fill_type)
+{
+  return _default_type[fill_type];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return a (0-based) global block row numbering for a given matrix.
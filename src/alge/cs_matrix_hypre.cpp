@@ -607,6 +607,70 @@ _setup_coeffs(cs_matrix_t  *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Destroy HYPRE matrix and vectors associated with a coefficients handler.
+ *
+ * parameters:
+ *   coeffs <-> pointer to HYPRE matrix coefficients handler
+ *----------------------------------------------------------------------------*/
+
+static void
+_destroy_hypre_ij(cs_matrix_coeffs_hypre_t  *coeffs)
+{
+  if (coeffs->matrix_state > 0) {
+    HYPRE_IJMatrixDestroy(coeffs->hm);
+
+    HYPRE_IJVectorDestroy(coeffs->hx);
+    HYPRE_IJVectorDestroy(coeffs->hy);
+
+    CS_FREE_HD(coeffs->row_buf); /* precaution; usually done earlier */
+    CS_FREE_HD(coeffs->col_buf); /* precaution; usually done earlier */
+    CS_FREE_HD(coeffs->val_buf);
+
+    coeffs->matrix_state = 0;
+    coeffs->src_structure = nullptr;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Prepare reuse of an existing HYPRE matrix for new coefficients.
+ *
+ * If the source structure (or assembler) has changed, the HYPRE matrix
+ * is destroyed, so that it will be rebuilt. Otherwise, the current
+ * coefficients are reset to zero and the matrix is re-initialized,
+ * so that new values may be added to the existing sparsity pattern,
+ * avoiding the creation and sizing of a new matrix.
+ *
+ * parameters:
+ *   coeffs        <-> pointer to HYPRE matrix coefficients handler
+ *   src_structure <-- associated structure or assembler
+ *----------------------------------------------------------------------------*/
+
+static void
+_reuse_hypre_ij(cs_matrix_coeffs_hypre_t  *coeffs,
+                const void                *src_structure)
+{
+  if (coeffs->matrix_state == 0)
+    return;
+
+  if (coeffs->src_structure != src_structure) {
+    _destroy_hypre_ij(coeffs);
+    return;
+  }
+
+  cs_alloc_mode_t  amode = CS_ALLOC_HOST;
+  if (coeffs->memory_location != HYPRE_MEMORY_HOST)
+    amode = CS_ALLOC_HOST_DEVICE_SHARED;
+
+  CS_MALLOC_HD(coeffs->row_buf, coeffs->max_chunk_size, HYPRE_BigInt, amode);
+  CS_MALLOC_HD(coeffs->col_buf, coeffs->max_chunk_size, HYPRE_BigInt, amode);
+  if (coeffs->val_buf == nullptr)
+    CS_MALLOC_HD(coeffs->val_buf, coeffs->max_chunk_size, HYPRE_Real, amode);
+
+  HYPRE_IJMatrixSetConstantValues(coeffs->hm, 0.);
+  HYPRE_IJMatrixInitialize_v2(coeffs->hm, coeffs->memory_location);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Function for initialization of HYPRE matrix coefficients using
@@ -639,12 +703,16 @@ _assembler_values_init(void        *matrix_p,
 
   auto coeffs = static_cast<cs_matrix_coeffs_hypre_t *>(matrix->coeffs);
 
-  /* Create HYPRE matrix */
+  /* Reuse or create HYPRE matrix */
+
+  _reuse_hypre_ij(coeffs, ma);
 
   HYPRE_IJMatrix hm = coeffs->hm;
 
   if (coeffs->matrix_state == 0) {
 
+    coeffs->src_structure = ma;
+
     cs_alloc_mode_t  amode = CS_ALLOC_HOST;
     if (coeffs->memory_location != HYPRE_MEMORY_HOST)
       amode = CS_ALLOC_HOST_DEVICE_SHARED;
@@ -1051,10 +1119,10 @@ _assembler_values_end(void  *matrix_p)
 
   HYPRE_IJMatrixAssemble(hm);
 
-  if (coeffs->matrix_state == 0) {
+  CS_FREE_HD(coeffs->row_buf);
+  CS_FREE_HD(coeffs->col_buf);
 
-    CS_FREE_HD(coeffs->row_buf);
-    CS_FREE_HD(coeffs->col_buf);
+  if (coeffs->matrix_state == 0) {
 
     MPI_Comm comm = cs_glob_mpi_comm;
     if (comm == MPI_COMM_NULL)
@@ -1535,7 +1603,9 @@ _set_coeffs_ij(cs_matrix_t *matrix,
 
   auto coeffs = static_cast<cs_matrix_coeffs_hypre_t *>(matrix->coeffs);
 
-  /* Create HYPRE matrix */
+  /* Reuse or create HYPRE matrix */
+
+  _reuse_hypre_ij(coeffs, matrix->structure);
 
   HYPRE_IJMatrix hm = coeffs->hm;
 
@@ -1555,6 +1625,8 @@ _set_coeffs_ij(cs_matrix_t *matrix,
 
   if (coeffs->matrix_state == 0) {
 
+    coeffs->src_structure = matrix->structure;
+
     cs_alloc_mode_t  amode = CS_ALLOC_HOST;
     if (coeffs->memory_location != HYPRE_MEMORY_HOST)
       amode = CS_ALLOC_HOST_DEVICE_SHARED;
@@ -1779,19 +1851,18 @@ _release_coeffs_ij(cs_matrix_t  *matrix)
 {
   auto coeffs = static_cast<cs_matrix_coeffs_hypre_t *>(matrix->coeffs);
 
+  /* The HYPRE matrix and vectors are kept, so that their structure may be
+     reused if coefficients are set again for the same matrix structure;
+     only the values buffer is freed. */
+
   if (matrix->coeffs != nullptr) {
 
     if (coeffs->matrix_state > 0) {
-      HYPRE_IJMatrixDestroy(coeffs->hm);
-
-      HYPRE_IJVectorDestroy(coeffs->hx);
-      HYPRE_IJVectorDestroy(coeffs->hy);
-
       CS_FREE_HD(coeffs->row_buf); /* precaution; usually done earlier */
       CS_FREE_HD(coeffs->col_buf); /* precaution; usually done earlier */
-      CS_FREE_HD(coeffs->val_buf); /* only done here */
+      CS_FREE_HD(coeffs->val_buf);
 
-      coeffs->matrix_state = 0;
+      coeffs->matrix_state = 2;
     }
   }
 }
@@ -1816,7 +1887,8 @@ static void
 _destroy_coeffs_ij(cs_matrix_t  *matrix)
 {
   if (matrix->coeffs != nullptr) {
-    _release_coeffs_ij(matrix);
+    auto coeffs = static_cast<cs_matrix_coeffs_hypre_t *>(matrix->coeffs);
+    _destroy_hypre_ij(coeffs);
     BFT_FREE(matrix->coeffs);
   }
 }
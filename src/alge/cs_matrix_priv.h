@@ -54,6 +54,8 @@ BEGIN_C_DECLS
  *  - Native
  *  - Compressed Sparse Row (CSR)
  *  - Modified Compressed Sparse Row (MSR), with separate diagonal
+ *  - Distributed (D+E+H)
+ *  - Sliced ELLPACK (SELL-C-sigma), with separate diagonal
  */
 
 /*----------------------------------------------------------------------------
@@ -200,6 +202,41 @@ typedef struct _cs_matrix_struct_dist_t {
 
 } cs_matrix_struct_dist_t;
 
+/* Sliced ELLPACK (SELL-C-sigma) matrix structure representation */
+/*---------------------------------------------------------------*/
+
+/* Rows are grouped in slices of C (slice_size) consecutive rows, each slice
+   being padded to the length of its longest row and stored column-major
+   (entry j of lane l of slice s is at slice_index[s] + j*C + l), so that
+   SpMV operations are performed on all lanes of a slice simultaneously.
+
+   To reduce padding, rows are sorted by decreasing length inside windows
+   of sigma rows, so row_id[s*C + l] provides the matching matrix row.
+   Padding entries refer to the lane's row, and have zero coefficients.
+
+   The base MSR structure is kept as the first member, so that functions
+   requiring row-based access (matrix coefficient assignment or assembly,
+   row extraction, Gauss-Seidel smoothers, coarsening) may operate on
+   this structure as on an MSR structure. */
+
+typedef struct _cs_matrix_struct_sell_t {
+
+  cs_matrix_struct_dist_t  msr;       /* Base MSR structure (must be
+                                         first member) */
+
+  cs_lnum_t         slice_size;       /* Number of rows per slice (C) */
+  cs_lnum_t         sigma;            /* Sorting window size */
+  cs_lnum_t         n_slices;         /* Number of slices */
+
+  cs_lnum_t        *slice_index;      /* Slice start index (n_slices + 1) */
+  cs_lnum_t        *row_id;           /* Row id matching each lane
+                                         (n_rows) */
+  cs_lnum_t        *col_id;           /* Column ids (padded) */
+  cs_lnum_t        *src_id;           /* Matching id in MSR extra-diagonal
+                                         values, or -1 for padding */
+
+} cs_matrix_struct_sell_t;
+
 /* CSR matrix coefficients representation */
 /*----------------------------------------*/
 
@@ -222,6 +259,26 @@ typedef struct _cs_matrix_coeff_csr_t {
 
 } cs_matrix_coeff_csr_t;
 
+/* Face-based operator definition for matrix-free products */
+/*---------------------------------------------------------*/
+
+/* Extra-diagonal coefficients of the upwind convection / non-reconstructed
+   diffusion operator are recomputed from face values at each product
+   instead of being stored (native matrices only). */
+
+typedef struct _cs_matrix_face_operator_t {
+
+  int               iconvp;           /* 1 for convection, 0 otherwise */
+  int               idiffp;           /* 1 for diffusion, 0 otherwise */
+  cs_real_t         thetap;           /* Theta-scheme weighting coefficient */
+
+  const cs_real_t  *i_massflux;       /* Mass flux at interior faces
+                                         (shared, nullptr if iconvp = 0) */
+  const cs_real_t  *i_visc;           /* Face viscosity at interior faces
+                                         (shared) */
+
+} cs_matrix_face_operator_t;
+
 /* Distributed matrix coefficients representation */
 /*------------------------------------------------*/
 
@@ -257,6 +314,16 @@ typedef struct _cs_matrix_coeff_dist_t {
   cs_lnum_t        *d_idx;           /* Index for diagonal matrix coefficients
                                         in case of multiple block sizes */
 
+  cs_real_t        *_s_val;          /* Sliced (SELL-C-sigma) copy of E
+                                        coefficients, if used */
+
+  float            *_e_val_f;        /* Single-precision E coefficients, if
+                                        used (e_val is nullptr in this case) */
+
+  cs_matrix_face_operator_t  *f_op;  /* Face-based operator definition, if
+                                        matrix-free (native only; e_val is
+                                        nullptr in this case) */
+
 } cs_matrix_coeff_dist_t;
 
 /* Matrix structure (representation-independent part) */
@@ -412,6 +479,42 @@ struct _cs_matrix_variant_t {
  * Semi-private function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Compute extra-diagonal coefficients of a face-based operator for a face.
+ *
+ * This matches the coefficients built by cs_matrix_wrapper_scalar()
+ * for the upwind convection / non-reconstructed diffusion operator.
+ *
+ * parameters:
+ *   iconvp     <-- 1 for convection, 0 otherwise
+ *   idiffp     <-- 1 for diffusion, 0 otherwise
+ *   thetap     <-- theta-scheme weighting coefficient
+ *   massflux   <-- face mass flux (ignored if iconvp = 0)
+ *   visc       <-- face viscosity
+ *   xa_ij      --> coefficient for row i (first face cell), column j
+ *   xa_ji      --> coefficient for row j (second face cell), column i
+ *----------------------------------------------------------------------------*/
+
+static inline CS_F_HOST_DEVICE void
+cs_matrix_face_operator_coeffs(int         iconvp,
+                               int         idiffp,
+                               cs_real_t   thetap,
+                               cs_real_t   massflux,
+                               cs_real_t   visc,
+                               cs_real_t  *xa_ij,
+                               cs_real_t  *xa_ji)
+{
+  cs_real_t flui = 0., fluj = 0.;
+  if (iconvp) {
+    cs_real_t a_massflux = (massflux < 0) ? -massflux : massflux;
+    flui =  0.5*(massflux - a_massflux);
+    fluj = -0.5*(massflux + a_massflux);
+  }
+
+  *xa_ij = thetap*(flui - idiffp*visc);
+  *xa_ji = thetap*(fluj - idiffp*visc);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
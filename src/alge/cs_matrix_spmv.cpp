@@ -988,6 +988,183 @@ _pre_vector_multiply_sync_x_end(const cs_matrix_t   *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Range of native matrix edges handled in a given pass of a matrix.vector
+ * product with computation/communication overlap.
+ *
+ * Edges not adjacent to ghost cells are numbered first (see
+ * cs_numbering_t n_no_adj_halo_elts), so the first pass (before halo
+ * synchronization is complete) handles those, and the second pass the
+ * remaining ones. If no exchange is pending, all edges are handled in
+ * the second pass.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   hs     <-- halo state for pending exchange, or NULL
+ *   pass   <-- 0 for edges independent of halo, 1 for others
+ *   s_id   --> start edge id
+ *   e_id   --> past-the-end edge id
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_native_edge_pass_range(const cs_matrix_t      *matrix,
+                        const cs_halo_state_t  *hs,
+                        int                     pass,
+                        cs_lnum_t              *s_id,
+                        cs_lnum_t              *e_id)
+{
+  const cs_matrix_struct_native_t  *ms
+    = (const cs_matrix_struct_native_t *)matrix->structure;
+  const cs_numbering_t *numbering = matrix->numbering;
+
+  cs_lnum_t n_nh = 0;
+  if (hs != NULL && numbering != NULL) {
+    if (numbering->n_no_adj_halo_elts <= ms->n_edges)
+      n_nh = numbering->n_no_adj_halo_elts;
+  }
+
+  *s_id = (pass == 0) ? 0 : n_nh;
+  *e_id = (pass == 0) ? n_nh : ms->n_edges;
+}
+
+/*----------------------------------------------------------------------------
+ * Range of thread groups handled in a given pass of a matrix.vector
+ * product with computation/communication overlap (threaded numbering).
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   hs     <-- halo state for pending exchange, or NULL
+ *   pass   <-- 0 for groups independent of halo, 1 for others
+ *   s_id   --> start group id
+ *   e_id   --> past-the-end group id
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_native_group_pass_range(const cs_matrix_t      *matrix,
+                         const cs_halo_state_t  *hs,
+                         int                     pass,
+                         int                    *s_id,
+                         int                    *e_id)
+{
+  const cs_numbering_t *numbering = matrix->numbering;
+  const int n_groups = numbering->n_groups;
+
+  int n_nh = 0;
+  if (hs != NULL && numbering->n_no_adj_halo_groups <= n_groups)
+    n_nh = numbering->n_no_adj_halo_groups;
+
+  *s_id = (pass == 0) ? 0 : n_nh;
+  *e_id = (pass == 0) ? n_nh : n_groups;
+}
+
+/*----------------------------------------------------------------------------
+ * Add extra-diagonal terms of a matrix-free face-based operator to a
+ * matrix.vector product y = A.x with native matrix.
+ *
+ * parameters:
+ *   matrix <-- pointer to matrix structure
+ *   hs     <-- halo state for pending exchange, or NULL
+ *   pass   <-- 0 for faces independent of halo, 1 for others
+ *   x      <-- multipliying vector values
+ *   y      <-> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_native_f_op_exdiag(const cs_matrix_t      *matrix,
+                    const cs_halo_state_t  *hs,
+                    int                     pass,
+                    const cs_real_t        *restrict x,
+                    cs_real_t              *restrict y)
+{
+  const cs_matrix_struct_native_t  *ms
+    = (const cs_matrix_struct_native_t *)matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+  const cs_matrix_face_operator_t  *f_op = mc->f_op;
+
+  const int iconvp = f_op->iconvp;
+  const int idiffp = f_op->idiffp;
+  const cs_real_t thetap = f_op->thetap;
+  const cs_real_t *restrict i_massflux = f_op->i_massflux;
+  const cs_real_t *restrict i_visc = f_op->i_visc;
+
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+  cs_lnum_t s_id, e_id;
+  _native_edge_pass_range(matrix, hs, pass, &s_id, &e_id);
+
+#if defined(HAVE_OPENMP)
+
+  const cs_numbering_t *numbering = matrix->numbering;
+
+  if (numbering != NULL && numbering->type == CS_NUMBERING_THREADS) {
+
+    const int n_threads = numbering->n_threads;
+    const int n_groups = numbering->n_groups;
+    const cs_lnum_t *group_index = numbering->group_index;
+
+    int g_s_id, g_e_id;
+    _native_group_pass_range(matrix, hs, pass, &g_s_id, &g_e_id);
+
+    for (int g_id = g_s_id; g_id < g_e_id; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_threads; t_id++) {
+
+        for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+             face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+             face_id++) {
+          cs_lnum_t ii = face_cel_p[face_id][0];
+          cs_lnum_t jj = face_cel_p[face_id][1];
+          cs_real_t m_f = (iconvp) ? i_massflux[face_id] : 0.;
+          cs_real_t xa_ij, xa_ji;
+          cs_matrix_face_operator_coeffs(iconvp, idiffp, thetap,
+                                         m_f, i_visc[face_id],
+                                         &xa_ij, &xa_ji);
+          y[ii] += xa_ij * x[jj];
+          y[jj] += xa_ji * x[ii];
+        }
+      }
+    }
+
+    return;
+  }
+
+  if (cs_glob_n_threads > 1) {
+
+#   pragma omp parallel for
+    for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
+      cs_lnum_t ii = face_cel_p[face_id][0];
+      cs_lnum_t jj = face_cel_p[face_id][1];
+      cs_real_t m_f = (iconvp) ? i_massflux[face_id] : 0.;
+      cs_real_t xa_ij, xa_ji;
+      cs_matrix_face_operator_coeffs(iconvp, idiffp, thetap,
+                                     m_f, i_visc[face_id],
+                                     &xa_ij, &xa_ji);
+#     pragma omp atomic
+      y[ii] += xa_ij * x[jj];
+#     pragma omp atomic
+      y[jj] += xa_ji * x[ii];
+    }
+
+    return;
+  }
+
+#endif /* defined(HAVE_OPENMP) */
+
+  for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
+    cs_lnum_t ii = face_cel_p[face_id][0];
+    cs_lnum_t jj = face_cel_p[face_id][1];
+    cs_real_t m_f = (iconvp) ? i_massflux[face_id] : 0.;
+    cs_real_t xa_ij, xa_ji;
+    cs_matrix_face_operator_coeffs(iconvp, idiffp, thetap,
+                                   m_f, i_visc[face_id],
+                                   &xa_ij, &xa_ji);
+    y[ii] += xa_ij * x[jj];
+    y[jj] += xa_ji * x[ii];
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x with native matrix.
  *
@@ -1029,37 +1206,45 @@ _mat_vec_p_l_native(cs_matrix_t  *matrix,
   else
     _zero_range(y, 0, ms->n_cols_ext);
 
-  /* Finalize ghost cell comunication if overlap used */
+  /* Non-diagonal terms; those not adjacent to ghost cells are handled
+     first, while ghost cell communication is in progress */
 
-  if (hs != NULL)
-    cs_halo_sync_wait(matrix->halo, x, hs);
+  for (int pass = 0; pass < 2; pass++) {
 
-  /* non-diagonal terms */
+    if (pass == 1 && hs != NULL)
+      cs_halo_sync_wait(matrix->halo, x, hs);
 
-  if (mc->e_val != NULL) {
+    cs_lnum_t s_id, e_id;
+    _native_edge_pass_range(matrix, hs, pass, &s_id, &e_id);
 
-    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+    if (mc->e_val != NULL) {
 
-    if (mc->symmetric) {
+      const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+
+      if (mc->symmetric) {
+
+        for (face_id = s_id; face_id < e_id; face_id++) {
+          ii = face_cel_p[face_id][0];
+          jj = face_cel_p[face_id][1];
+          y[ii] += xa[face_id] * x[jj];
+          y[jj] += xa[face_id] * x[ii];
+        }
 
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        y[ii] += xa[face_id] * x[jj];
-        y[jj] += xa[face_id] * x[ii];
       }
+      else {
 
-    }
-    else {
+        for (face_id = s_id; face_id < e_id; face_id++) {
+          ii = face_cel_p[face_id][0];
+          jj = face_cel_p[face_id][1];
+          y[ii] += xa[2*face_id] * x[jj];
+          y[jj] += xa[2*face_id + 1] * x[ii];
+        }
 
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        y[ii] += xa[2*face_id] * x[jj];
-        y[jj] += xa[2*face_id + 1] * x[ii];
       }
 
     }
+    else if (mc->f_op != NULL)
+      _native_f_op_exdiag(matrix, hs, pass, x, y);
 
   }
 }
@@ -1468,53 +1653,61 @@ _mat_vec_p_l_native_omp(cs_matrix_t  *matrix,
   else
     _zero_range(y, 0, ms->n_cols_ext);
 
-  /* Finalize ghost cell comunication if overlap used */
+  /* Non-diagonal terms; those not adjacent to ghost cells are handled
+     first, while ghost cell communication is in progress */
 
-  if (hs != NULL)
-    cs_halo_sync_wait(matrix->halo, x, hs);
+  for (int pass = 0; pass < 2; pass++) {
 
-  /* non-diagonal terms */
+    if (pass == 1 && hs != NULL)
+      cs_halo_sync_wait(matrix->halo, x, hs);
 
-  if (mc->e_val != NULL) {
+    int s_id, e_id;
+    _native_group_pass_range(matrix, hs, pass, &s_id, &e_id);
 
-    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+    if (mc->e_val != NULL) {
 
-    if (mc->symmetric) {
+      const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
-      for (int g_id = 0; g_id < n_groups; g_id++) {
+      if (mc->symmetric) {
 
-#       pragma omp parallel for
-        for (int t_id = 0; t_id < n_threads; t_id++) {
+        for (int g_id = s_id; g_id < e_id; g_id++) {
 
-          for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
-               face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
-               face_id++) {
-            cs_lnum_t ii = face_cel_p[face_id][0];
-            cs_lnum_t jj = face_cel_p[face_id][1];
-            y[ii] += xa[face_id] * x[jj];
-            y[jj] += xa[face_id] * x[ii];
+#         pragma omp parallel for
+          for (int t_id = 0; t_id < n_threads; t_id++) {
+
+            for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+                 face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+                 face_id++) {
+              cs_lnum_t ii = face_cel_p[face_id][0];
+              cs_lnum_t jj = face_cel_p[face_id][1];
+              y[ii] += xa[face_id] * x[jj];
+              y[jj] += xa[face_id] * x[ii];
+            }
           }
         }
       }
-    }
-    else {
+      else {
 
-      for (int g_id = 0; g_id < n_groups; g_id++) {
+        for (int g_id = s_id; g_id < e_id; g_id++) {
 
-#       pragma omp parallel for
-        for (int t_id = 0; t_id < n_threads; t_id++) {
+#         pragma omp parallel for
+          for (int t_id = 0; t_id < n_threads; t_id++) {
 
-          for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
-               face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
-               face_id++) {
-            cs_lnum_t ii = face_cel_p[face_id][0];
-            cs_lnum_t jj = face_cel_p[face_id][1];
-            y[ii] += xa[2*face_id] * x[jj];
-            y[jj] += xa[2*face_id + 1] * x[ii];
+            for (cs_lnum_t face_id = group_index[(t_id*n_groups + g_id)*2];
+                 face_id < group_index[(t_id*n_groups + g_id)*2 + 1];
+                 face_id++) {
+              cs_lnum_t ii = face_cel_p[face_id][0];
+              cs_lnum_t jj = face_cel_p[face_id][1];
+              y[ii] += xa[2*face_id] * x[jj];
+              y[jj] += xa[2*face_id + 1] * x[ii];
+            }
           }
         }
       }
+
     }
+    else if (mc->f_op != NULL)
+      _native_f_op_exdiag(matrix, hs, pass, x, y);
 
   }
 }
@@ -1660,41 +1853,49 @@ _mat_vec_p_l_native_omp_atomic(cs_matrix_t  *matrix,
   else
     _zero_range(y, 0, ms->n_cols_ext);
 
-  /* Finalize ghost cell comunication if overlap used */
+  /* Non-diagonal terms; those not adjacent to ghost cells are handled
+     first, while ghost cell communication is in progress */
 
-  if (hs != NULL)
-    cs_halo_sync_wait(matrix->halo, x, hs);
+  for (int pass = 0; pass < 2; pass++) {
 
-  /* non-diagonal terms */
+    if (pass == 1 && hs != NULL)
+      cs_halo_sync_wait(matrix->halo, x, hs);
 
-  if (mc->e_val != NULL) {
+    cs_lnum_t s_id, e_id;
+    _native_edge_pass_range(matrix, hs, pass, &s_id, &e_id);
 
-    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+    if (mc->e_val != NULL) {
 
-    if (mc->symmetric) {
+      const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
-#     pragma omp parallel for
-      for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
-        cs_lnum_t ii = face_cel_p[face_id][0];
-        cs_lnum_t jj = face_cel_p[face_id][1];
-#       pragma omp atomic
-        y[ii] += xa[face_id] * x[jj];
-#       pragma omp atomic
-        y[jj] += xa[face_id] * x[ii];
+      if (mc->symmetric) {
+
+#       pragma omp parallel for
+        for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
+          cs_lnum_t ii = face_cel_p[face_id][0];
+          cs_lnum_t jj = face_cel_p[face_id][1];
+#         pragma omp atomic
+          y[ii] += xa[face_id] * x[jj];
+#         pragma omp atomic
+          y[jj] += xa[face_id] * x[ii];
+        }
       }
-    }
-    else {
+      else {
 
-#     pragma omp parallel for
-      for (cs_lnum_t face_id = 0; face_id < ms->n_edges; face_id++) {
-        cs_lnum_t ii = face_cel_p[face_id][0];
-        cs_lnum_t jj = face_cel_p[face_id][1];
-#       pragma omp atomic
-        y[ii] += xa[2*face_id] * x[jj];
-#       pragma omp atomic
-        y[jj] += xa[2*face_id + 1] * x[ii];
+#       pragma omp parallel for
+        for (cs_lnum_t face_id = s_id; face_id < e_id; face_id++) {
+          cs_lnum_t ii = face_cel_p[face_id][0];
+          cs_lnum_t jj = face_cel_p[face_id][1];
+#         pragma omp atomic
+          y[ii] += xa[2*face_id] * x[jj];
+#         pragma omp atomic
+          y[jj] += xa[2*face_id + 1] * x[ii];
+        }
       }
+
     }
+    else if (mc->f_op != NULL)
+      _native_f_op_exdiag(matrix, hs, pass, x, y);
 
   }
 }
@@ -1827,51 +2028,59 @@ _mat_vec_p_l_native_vector(cs_matrix_t  *matrix,
   else
     _zero_range(y, 0, ms->n_cols_ext);
 
-  /* Finalize ghost cell comunication if overlap used */
+  /* Non-diagonal terms; those not adjacent to ghost cells are handled
+     first, while ghost cell communication is in progress */
 
-  if (hs != NULL)
-    cs_halo_sync_wait(matrix->halo, x, hs);
+  for (int pass = 0; pass < 2; pass++) {
 
-  /* non-diagonal terms */
+    if (pass == 1 && hs != NULL)
+      cs_halo_sync_wait(matrix->halo, x, hs);
 
-  if (mc->e_val != NULL) {
+    cs_lnum_t s_id, e_id;
+    _native_edge_pass_range(matrix, hs, pass, &s_id, &e_id);
 
-    const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+    if (mc->e_val != NULL) {
 
-    if (mc->symmetric) {
+      const cs_lnum_2_t *restrict face_cel_p = ms->edges;
 
-#     if defined(HAVE_OPENMP_SIMD)
-#       pragma omp simd safelen(CS_NUMBERING_SIMD_SIZE)
-#     else
-#       pragma dir nodep
-#       pragma GCC ivdep
-#       pragma _NEC ivdep
-#     endif
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        y[ii] += xa[face_id] * x[jj];
-        y[jj] += xa[face_id] * x[ii];
-      }
+      if (mc->symmetric) {
 
-    }
-    else {
+#       if defined(HAVE_OPENMP_SIMD)
+#         pragma omp simd safelen(CS_NUMBERING_SIMD_SIZE)
+#       else
+#         pragma dir nodep
+#         pragma GCC ivdep
+#         pragma _NEC ivdep
+#       endif
+        for (face_id = s_id; face_id < e_id; face_id++) {
+          ii = face_cel_p[face_id][0];
+          jj = face_cel_p[face_id][1];
+          y[ii] += xa[face_id] * x[jj];
+          y[jj] += xa[face_id] * x[ii];
+        }
+
+      }
+      else {
+
+#       if defined(HAVE_OPENMP_SIMD)
+#         pragma omp simd safelen(CS_NUMBERING_SIMD_SIZE)
+#       else
+#         pragma dir nodep
+#         pragma GCC ivdep
+#         pragma _NEC ivdep
+#       endif
+        for (face_id = s_id; face_id < e_id; face_id++) {
+          ii = face_cel_p[face_id][0];
+          jj = face_cel_p[face_id][1];
+          y[ii] += xa[2*face_id] * x[jj];
+          y[jj] += xa[2*face_id + 1] * x[ii];
+        }
 
-#     if defined(HAVE_OPENMP_SIMD)
-#       pragma omp simd safelen(CS_NUMBERING_SIMD_SIZE)
-#     else
-#       pragma dir nodep
-#       pragma GCC ivdep
-#       pragma _NEC ivdep
-#     endif
-      for (face_id = 0; face_id < ms->n_edges; face_id++) {
-        ii = face_cel_p[face_id][0];
-        jj = face_cel_p[face_id][1];
-        y[ii] += xa[2*face_id] * x[jj];
-        y[jj] += xa[2*face_id + 1] * x[ii];
       }
 
     }
+    else if (mc->f_op != NULL)
+      _native_f_op_exdiag(matrix, hs, pass, x, y);
 
   }
 }
@@ -2088,6 +2297,64 @@ _mat_vec_p_l_csr_mkl_sycl(cs_matrix_t  *matrix,
 
 #endif /* defined (HAVE_MKL_SPARSE_IE) */
 
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with MSR matrix and single-precision
+ * extra-diagonal coefficients.
+ *
+ * Products and sums are computed in double precision.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_f(cs_matrix_t  *matrix,
+                   bool          exclude_diag,
+                   bool          sync,
+                   cs_real_t    *restrict x,
+                   cs_real_t    *restrict y)
+{
+  const cs_matrix_struct_dist_t  *ms
+    = static_cast<const cs_matrix_struct_dist_t *>(matrix->structure);
+  const cs_matrix_coeff_dist_t  *mc
+    = static_cast<const cs_matrix_coeff_dist_t *>(matrix->coeffs);
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  const cs_lnum_t  *e_col_id = ms->e.col_id;
+  const cs_lnum_t  *e_row_index = ms->e.row_index;
+  const cs_real_t  *d_val = (exclude_diag) ? nullptr : mc->d_val;
+
+  /* Ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : nullptr;
+  if (hs != nullptr)
+    cs_halo_sync_wait(matrix->halo, x, hs);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+    const float *restrict m_row = mc->_e_val_f + e_row_index[ii];
+    cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+    cs_real_t sii = 0.0;
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      sii += static_cast<cs_real_t>(m_row[jj])*x[col_id[jj]];
+
+    if (d_val != nullptr)
+      sii += d_val[ii]*x[ii];
+
+    y[ii] = sii;
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x with MSR matrix.
  *
@@ -2111,6 +2378,11 @@ _mat_vec_p_l_msr(cs_matrix_t  *matrix,
   const cs_matrix_coeff_dist_t  *mc
     = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
 
+  if (mc->e_val == nullptr && mc->_e_val_f != nullptr) {
+    _mat_vec_p_l_msr_f(matrix, exclude_diag, sync, x, y);
+    return;
+  }
+
   const cs_lnum_t  n_rows = ms->n_rows;
 
   const cs_lnum_t  *e_col_id = ms->e.col_id;
@@ -2293,6 +2565,194 @@ _mat_vec_p_l_msr_omp_sched(cs_matrix_t  *matrix,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix, for a given
+ * (compile-time) slice size.
+ *
+ * Lanes of a given slice are processed together, so the inner loop
+ * on lanes has a fixed trip count and contiguous matrix coefficients,
+ * allowing SIMD vectorization (using gather instructions for x values
+ * where available).
+ *
+ * parameters:
+ *   n_rows      <-- number of local rows
+ *   n_slices    <-- number of slices
+ *   slice_index <-- slice start index
+ *   row_id      <-- row id matching each lane
+ *   col_id      <-- column ids
+ *   s_val       <-- sliced extradiagonal values
+ *   d_val       <-- diagonal values, or nullptr to exclude diagonal
+ *   x           <-- multipliying vector values
+ *   y           --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+END_C_DECLS /* templates require C++ linkage */
+
+template <cs_lnum_t C>
+static void
+_sell_spmv(cs_lnum_t                   n_rows,
+           cs_lnum_t                   n_slices,
+           const cs_lnum_t  *restrict  slice_index,
+           const cs_lnum_t  *restrict  row_id,
+           const cs_lnum_t  *restrict  col_id,
+           const cs_real_t  *restrict  s_val,
+           const cs_real_t  *restrict  d_val,
+           const cs_real_t  *restrict  x,
+           cs_real_t        *restrict  y)
+{
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t s = 0; s < n_slices; s++) {
+
+    const cs_lnum_t s_start = slice_index[s];
+    const cs_lnum_t s_width = (slice_index[s+1] - s_start) / C;
+    const cs_lnum_t *restrict s_col_id = col_id + s_start;
+    const cs_real_t *restrict s_row = s_val + s_start;
+
+    cs_real_t sl[C];
+    for (cs_lnum_t l = 0; l < C; l++)
+      sl[l] = 0.;
+
+    for (cs_lnum_t j = 0; j < s_width; j++) {
+#     if defined(HAVE_OPENMP_SIMD)
+#       pragma omp simd
+#     endif
+      for (cs_lnum_t l = 0; l < C; l++)
+        sl[l] += s_row[j*C + l] * x[s_col_id[j*C + l]];
+    }
+
+    const cs_lnum_t *restrict s_row_id = row_id + s*C;
+    const cs_lnum_t l_end = CS_MIN(C, n_rows - s*C);
+
+    if (d_val != nullptr) {
+      for (cs_lnum_t l = 0; l < l_end; l++) {
+        cs_lnum_t ii = s_row_id[l];
+        y[ii] = sl[l] + d_val[ii]*x[ii];
+      }
+    }
+    else {
+      for (cs_lnum_t l = 0; l < l_end; l++)
+        y[s_row_id[l]] = sl[l];
+    }
+
+  }
+}
+
+BEGIN_C_DECLS
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with SELL-C-sigma matrix,
+ * generic slice size.
+ *
+ * parameters:
+ *   c           <-- slice size
+ *   n_rows      <-- number of local rows
+ *   n_slices    <-- number of slices
+ *   slice_index <-- slice start index
+ *   row_id      <-- row id matching each lane
+ *   col_id      <-- column ids
+ *   s_val       <-- sliced extradiagonal values
+ *   d_val       <-- diagonal values, or nullptr to exclude diagonal
+ *   x           <-- multipliying vector values
+ *   y           --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_sell_spmv_generic(cs_lnum_t                   c,
+                   cs_lnum_t                   n_rows,
+                   cs_lnum_t                   n_slices,
+                   const cs_lnum_t  *restrict  slice_index,
+                   const cs_lnum_t  *restrict  row_id,
+                   const cs_lnum_t  *restrict  col_id,
+                   const cs_real_t  *restrict  s_val,
+                   const cs_real_t  *restrict  d_val,
+                   const cs_real_t  *restrict  x,
+                   cs_real_t        *restrict  y)
+{
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t s = 0; s < n_slices; s++) {
+
+    const cs_lnum_t s_start = slice_index[s];
+    const cs_lnum_t s_width = (slice_index[s+1] - s_start) / c;
+    const cs_lnum_t *restrict s_row_id = row_id + s*c;
+    const cs_lnum_t l_end = CS_MIN(c, n_rows - s*c);
+
+    for (cs_lnum_t l = 0; l < l_end; l++) {
+      const cs_lnum_t ii = s_row_id[l];
+      cs_real_t sii = 0.;
+      for (cs_lnum_t j = 0; j < s_width; j++)
+        sii += s_val[s_start + j*c + l] * x[col_id[s_start + j*c + l]];
+      if (d_val != nullptr)
+        sii += d_val[ii]*x[ii];
+      y[ii] = sii;
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with SELL-C-sigma matrix.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_sell(cs_matrix_t  *matrix,
+                  bool          exclude_diag,
+                  bool          sync,
+                  cs_real_t    *restrict x,
+                  cs_real_t    *restrict y)
+{
+  const cs_matrix_struct_sell_t  *ms
+    = static_cast<const cs_matrix_struct_sell_t *>(matrix->structure);
+  const cs_matrix_coeff_dist_t  *mc
+    = static_cast<const cs_matrix_coeff_dist_t *>(matrix->coeffs);
+
+  /* Sliced coefficients are only built for scalar extradiagonal
+     coefficients; use base MSR representation otherwise */
+
+  if (mc->_s_val == nullptr) {
+    _mat_vec_p_l_msr(matrix, exclude_diag, sync, x, y);
+    return;
+  }
+
+  /* Ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : nullptr;
+  if (hs != nullptr)
+    cs_halo_sync_wait(matrix->halo, x, hs);
+
+  const cs_real_t *d_val = (exclude_diag) ? nullptr : mc->d_val;
+
+  switch(ms->slice_size) {
+  case 4:
+    _sell_spmv<4>(ms->msr.n_rows, ms->n_slices, ms->slice_index, ms->row_id,
+                  ms->col_id, mc->_s_val, d_val, x, y);
+    break;
+  case 8:
+    _sell_spmv<8>(ms->msr.n_rows, ms->n_slices, ms->slice_index, ms->row_id,
+                  ms->col_id, mc->_s_val, d_val, x, y);
+    break;
+  case 16:
+    _sell_spmv<16>(ms->msr.n_rows, ms->n_slices, ms->slice_index, ms->row_id,
+                   ms->col_id, mc->_s_val, d_val, x, y);
+    break;
+  case 32:
+    _sell_spmv<32>(ms->msr.n_rows, ms->n_slices, ms->slice_index, ms->row_id,
+                   ms->col_id, mc->_s_val, d_val, x, y);
+    break;
+  default:
+    _sell_spmv_generic(ms->slice_size, ms->msr.n_rows, ms->n_slices,
+                       ms->slice_index, ms->row_id, ms->col_id, mc->_s_val,
+                       d_val, x, y);
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x with MSR matrix, blocked version.
  *
@@ -2511,13 +2971,30 @@ _b_mat_vec_p_l_msr_6(cs_matrix_t  *matrix,
       const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
       cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
-      _dense_6_6_ax(ii, mc->d_val, x, y);
+      /* Accumulate in registers, storing the row block only once */
+
+      cs_real_t sii[6];
+      const cs_real_t *restrict d_row = mc->d_val + ii*36;
+      const cs_real_t *restrict x_ii = x + ii*6;
+
+      for (cs_lnum_t kk = 0; kk < 6; kk++)
+        sii[kk] =   d_row[kk*6]     * x_ii[0]
+                  + d_row[kk*6 + 1] * x_ii[1]
+                  + d_row[kk*6 + 2] * x_ii[2]
+                  + d_row[kk*6 + 3] * x_ii[3]
+                  + d_row[kk*6 + 4] * x_ii[4]
+                  + d_row[kk*6 + 5] * x_ii[5];
 
       for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t m_jj = m_row[jj];
+        const cs_real_t *restrict x_jj = x + col_id[jj]*6;
         for (cs_lnum_t kk = 0; kk < 6; kk++)
-          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
+          sii[kk] += m_jj*x_jj[kk];
       }
 
+      for (cs_lnum_t kk = 0; kk < 6; kk++)
+        y[ii*6 + kk] = sii[kk];
+
     }
 
   }
@@ -2533,14 +3010,18 @@ _b_mat_vec_p_l_msr_6(cs_matrix_t  *matrix,
       const cs_real_t *restrict m_row = mc->e_val + e_row_index[ii];
       cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
 
-      for (cs_lnum_t kk = 0; kk < 6; kk++)
-        y[ii*6 + kk] = 0.;
+      cs_real_t sii[6] = {0., 0., 0., 0., 0., 0.};
 
       for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t m_jj = m_row[jj];
+        const cs_real_t *restrict x_jj = x + col_id[jj]*6;
         for (cs_lnum_t kk = 0; kk < 6; kk++)
-          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
+          sii[kk] += m_jj*x_jj[kk];
       }
 
+      for (cs_lnum_t kk = 0; kk < 6; kk++)
+        y[ii*6 + kk] = sii[kk];
+
     }
   }
 
@@ -3402,11 +3883,18 @@ _b_mat_vec_p_l_dist_6(cs_matrix_t  *matrix,
       const cs_real_t *restrict m_row = mc->h_val + h_row_index[ii];
       cs_lnum_t n_cols = h_row_index[ii+1] - h_row_index[ii];
 
+      cs_real_t sii[6] = {0., 0., 0., 0., 0., 0.};
+
       for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+        const cs_real_t m_jj = m_row[jj];
+        const cs_real_t *restrict x_jj = x + col_id[jj]*6;
         for (cs_lnum_t kk = 0; kk < 6; kk++)
-          y[ii*6 + kk] += (m_row[jj]*x[col_id[jj]*6 + kk]);
+          sii[kk] += m_jj*x_jj[kk];
       }
 
+      for (cs_lnum_t kk = 0; kk < 6; kk++)
+        y[ii*6 + kk] += sii[kk];
+
     }
 
   }
@@ -3757,6 +4245,155 @@ _mat_vec_p_l_dist_mkl_sycl(cs_matrix_t  *matrix,
 
 #endif /* defined (HAVE_MKL_SPARSE_IE) */
 
+/*----------------------------------------------------------------------------
+ * Synchronize ghost values of interleaved vectors prior to
+ * matrix.vectors product.
+ *
+ * parameters:
+ *   matrix        <-- pointer to matrix structure
+ *   n_vecs        <-- number of interleaved vectors
+ *   x             <-> multipliying vectors values (ghost values updated)
+ *----------------------------------------------------------------------------*/
+
+static void
+_pre_vectors_multiply_sync_x(const cs_matrix_t   *matrix,
+                             cs_lnum_t            n_vecs,
+                             cs_real_t           *restrict x)
+{
+  if (matrix->halo == NULL)
+    return;
+
+  /* Only scalar matrices are handled here, so no rotation-type periodicity
+     transformation is required */
+
+  cs_halo_state_t *hs = cs_halo_state_get_default();
+
+  cs_halo_sync_pack(matrix->halo,
+                    CS_HALO_STANDARD,
+                    CS_REAL_TYPE,
+                    n_vecs,
+                    x,
+                    NULL,
+                    hs);
+
+  cs_halo_sync_start(matrix->halo, x, hs);
+  cs_halo_sync_wait(matrix->halo, x, hs);
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vectors product Y = A.X with scalar CSR matrix and interleaved
+ * vectors (value of vector k for row i at i*n_vecs + k).
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   n_vecs       <-- number of interleaved vectors
+ *   x            <-- multipliying vectors values
+ *   y            --> resulting vectors
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vecs_p_l_csr(const cs_matrix_t  *matrix,
+                  cs_lnum_t           n_vecs,
+                  const cs_real_t    *restrict x,
+                  cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_csr_t  *ms
+    = (const cs_matrix_struct_csr_t *)matrix->structure;
+  const cs_matrix_coeff_csr_t  *mc
+    = (const cs_matrix_coeff_csr_t *)matrix->coeffs;
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+# pragma omp parallel for  if(n_rows*n_vecs > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = ms->col_id + ms->row_index[ii];
+    const cs_real_t *restrict m_row = mc->val + ms->row_index[ii];
+    cs_lnum_t n_cols = ms->row_index[ii+1] - ms->row_index[ii];
+    cs_real_t *restrict _y = y + ii*n_vecs;
+
+    for (cs_lnum_t kk = 0; kk < n_vecs; kk++)
+      _y[kk] = 0.;
+
+    /* Each matrix coefficient is loaded once for all vectors */
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_real_t a_ij = m_row[jj];
+      const cs_real_t *restrict _x = x + col_id[jj]*n_vecs;
+      for (cs_lnum_t kk = 0; kk < n_vecs; kk++)
+        _y[kk] += a_ij*_x[kk];
+    }
+
+  }
+}
+
+END_C_DECLS /* templates require C++ linkage */
+
+/*----------------------------------------------------------------------------
+ * Matrix.vectors product Y = A.X with scalar MSR matrix and interleaved
+ * vectors (value of vector k for row i at i*n_vecs + k).
+ *
+ * template parameters:
+ *   T            extra-diagonal coefficients type
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   e_val        <-- extra-diagonal coefficients
+ *   n_vecs       <-- number of interleaved vectors
+ *   x            <-- multipliying vectors values
+ *   y            --> resulting vectors
+ *----------------------------------------------------------------------------*/
+
+template <typename T>
+static void
+_mat_vecs_p_l_msr(const cs_matrix_t  *matrix,
+                  const T            *restrict e_val,
+                  cs_lnum_t           n_vecs,
+                  const cs_real_t    *restrict x,
+                  cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_dist_t  *ms
+    = (const cs_matrix_struct_dist_t *)matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  const cs_lnum_t  *e_col_id = ms->e.col_id;
+  const cs_lnum_t  *e_row_index = ms->e.row_index;
+  const cs_real_t  *restrict d_val = mc->d_val;
+
+# pragma omp parallel for  if(n_rows*n_vecs > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+    const T *restrict m_row = e_val + e_row_index[ii];
+    cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+    const cs_real_t *restrict x_ii = x + ii*n_vecs;
+    cs_real_t *restrict _y = y + ii*n_vecs;
+
+    if (d_val != NULL) {
+      for (cs_lnum_t kk = 0; kk < n_vecs; kk++)
+        _y[kk] = d_val[ii]*x_ii[kk];
+    }
+    else {
+      for (cs_lnum_t kk = 0; kk < n_vecs; kk++)
+        _y[kk] = 0.;
+    }
+
+    /* Each matrix coefficient is loaded once for all vectors */
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_real_t a_ij = (cs_real_t)m_row[jj];
+      const cs_real_t *restrict _x = x + col_id[jj]*n_vecs;
+      for (cs_lnum_t kk = 0; kk < n_vecs; kk++)
+        _y[kk] += a_ij*_x[kk];
+    }
+
+  }
+}
+
+BEGIN_C_DECLS
+
 #if defined(HAVE_ACCEL)
 
 /*----------------------------------------------------------------------------
@@ -3941,6 +4578,12 @@ cs_matrix_spmv_set_defaults(cs_matrix_t  *m)
  *     mkl             (with MKL)
  *     mkl_sycl        (with MKL, using SYCL offload)
  *
+ *   CS_MATRIX_SELL
+ *     default
+ *     msr             (MSR kernel on base structure, for CS_MATRIX_SCALAR*)
+ *     cuda            (CUDA-accelerated)
+ *     msr_cuda        (CUDA-accelerated MSR kernel, for CS_MATRIX_SCALAR*)
+ *
  * parameters:
  *   m_type      <--  Matrix type
  *   fill type   <--  matrix fill type to merge from
@@ -4414,6 +5057,95 @@ cs_matrix_spmv_set_func(cs_matrix_type_t             m_type,
 
     break;
 
+  /* SELL-C-sigma
+     ------------ */
+
+  case CS_MATRIX_SELL:
+
+    if (standard > 0) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+        [[fallthrough]];
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = _mat_vec_p_l_sell;
+        _spmv[1] = _mat_vec_p_l_sell;
+        break;
+      case CS_MATRIX_BLOCK_D:
+        [[fallthrough]];
+      case CS_MATRIX_BLOCK_D_66:
+        [[fallthrough]];
+      case CS_MATRIX_BLOCK_D_SYM:
+        _spmv[0] = _b_mat_vec_p_l_msr;
+        _spmv[1] = _b_mat_vec_p_l_msr;
+        break;
+      case CS_MATRIX_BLOCK:
+        _spmv[0] = _bb_mat_vec_p_l_msr;
+        _spmv[1] = _bb_mat_vec_p_l_msr;
+        break;
+      default:
+        break;
+      }
+    }
+
+    else if (!strcmp(func_name, "msr")) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+        [[fallthrough]];
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = _mat_vec_p_l_msr;
+        _spmv[1] = _mat_vec_p_l_msr;
+        break;
+      default:
+        break;
+      }
+    }
+
+    else if (!strcmp(func_name, "cuda")) {
+#if defined(HAVE_CUDA)
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = cs_matrix_spmv_cuda_sell;
+        _spmv[1] = cs_matrix_spmv_cuda_sell;
+        _spmv_xy_hd[0] = 'd';
+        _spmv_xy_hd[1] = 'd';
+        break;
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        _spmv[0] = cs_matrix_spmv_cuda_msr_b;
+        _spmv[1] = cs_matrix_spmv_cuda_msr_b;
+        _spmv_xy_hd[0] = 'd';
+        _spmv_xy_hd[1] = 'd';
+        break;
+      default:
+        break;
+      }
+#else
+      retcode = 2;
+#endif
+    }
+
+    else if (!strcmp(func_name, "msr_cuda")) {
+#if defined(HAVE_CUDA)
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = cs_matrix_spmv_cuda_msr;
+        _spmv[1] = cs_matrix_spmv_cuda_msr;
+        _spmv_xy_hd[0] = 'd';
+        _spmv_xy_hd[1] = 'd';
+        break;
+      default:
+        break;
+      }
+#else
+      retcode = 2;
+#endif
+    }
+
+    break;
+
   default:
     break;
   }
@@ -4438,6 +5170,107 @@ cs_matrix_spmv_set_func(cs_matrix_type_t             m_type,
   return retcode;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Matrix.vectors product Y = A.X for multiple interleaved vectors.
+ *
+ * The value of vector k for row (or block component) i is located
+ * at x[i*n_vecs + k], so x and y should be sized (at least)
+ * n_vecs * n_cols_ext * diag_block_size.
+ *
+ * For scalar CSR and MSR matrices on host, the matrix coefficients are
+ * streamed only once for all vectors. Other cases fall back to a
+ * series of cs_matrix_vector_multiply calls.
+ *
+ * This function includes a halo update of x prior to multiplication by A.
+ *
+ * \param[in]       matrix  pointer to matrix structure
+ * \param[in]       n_vecs  number of interleaved vectors
+ * \param[in, out]  x       multiplying vectors values
+ *                          (ghost values updated)
+ * \param[out]      y       resulting vectors
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_multiply_multi(const cs_matrix_t  *matrix,
+                                cs_lnum_t           n_vecs,
+                                cs_real_t          *restrict x,
+                                cs_real_t          *restrict y)
+{
+  assert(matrix != NULL);
+
+  bool multi_kernel = false;
+
+  if (   matrix->db_size == 1
+      && matrix->eb_size == 1
+      && matrix->coeffs != NULL
+      && matrix->alloc_mode <= CS_ALLOC_HOST
+      && (   matrix->type == CS_MATRIX_CSR
+          || matrix->type == CS_MATRIX_MSR))
+    multi_kernel = true;
+
+  if (n_vecs == 1)
+    multi_kernel = false;
+
+  if (multi_kernel) {
+
+    _pre_vectors_multiply_sync_x(matrix, n_vecs, x);
+
+    if (matrix->type == CS_MATRIX_CSR)
+      _mat_vecs_p_l_csr(matrix, n_vecs, x, y);
+
+    else {
+      const cs_matrix_coeff_dist_t  *mc
+        = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+      if (mc->e_val == NULL && mc->_e_val_f != NULL)
+        _mat_vecs_p_l_msr<float>(matrix, mc->_e_val_f, n_vecs, x, y);
+      else
+        _mat_vecs_p_l_msr<cs_real_t>(matrix, mc->e_val, n_vecs, x, y);
+    }
+
+    return;
+  }
+
+  /* Fallback: deinterleave vectors and multiply them one by one */
+
+  if (n_vecs == 1) {
+    cs_matrix_vector_multiply(matrix, x, y);
+    return;
+  }
+
+  const cs_lnum_t n_vals = matrix->n_rows * matrix->db_size;
+  const cs_lnum_t n_vals_ext = matrix->n_cols_ext * matrix->db_size;
+
+  cs_real_t *_x, *_y;
+  BFT_MALLOC(_x, n_vals_ext, cs_real_t);
+  BFT_MALLOC(_y, n_vals_ext, cs_real_t);
+
+  for (cs_lnum_t kk = 0; kk < n_vecs; kk++) {
+
+#   pragma omp parallel for  if(n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      _x[ii] = x[ii*n_vecs + kk];
+
+    cs_matrix_vector_multiply(matrix, _x, _y);
+
+#   pragma omp parallel if(n_vals_ext > CS_THR_MIN)
+    {
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+        y[ii*n_vecs + kk] = _y[ii];
+
+#     pragma omp for nowait
+      for (cs_lnum_t ii = n_vals; ii < n_vals_ext; ii++)
+        x[ii*n_vecs + kk] = _x[ii];
+    }
+
+  }
+
+  BFT_FREE(_y);
+  BFT_FREE(_x);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -103,6 +103,12 @@ cs_matrix_spmv_set_defaults(cs_matrix_t  *m);
  *     mkl             (with MKL)
  *     mkl_sycl        (with MKL, using SYCL offload)
  *
+ *   CS_MATRIX_SELL
+ *     default
+ *     msr             (MSR kernel on base structure, for CS_MATRIX_SCALAR*)
+ *     cuda            (CUDA-accelerated)
+ *     msr_cuda        (CUDA-accelerated MSR kernel, for CS_MATRIX_SCALAR*)
+ *
  * parameters:
  *   m_type      <--  Matrix type
  *   fill type   <--  matrix fill type to merge from
@@ -131,6 +137,34 @@ cs_matrix_spmv_set_func(cs_matrix_type_t             m_type,
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Matrix.vectors product Y = A.X for multiple interleaved vectors.
+ *
+ * The value of vector k for row (or block component) i is located
+ * at x[i*n_vecs + k], so x and y should be sized (at least)
+ * n_vecs * n_cols_ext * diag_block_size.
+ *
+ * For scalar CSR and MSR matrices on host, the matrix coefficients are
+ * streamed only once for all vectors. Other cases fall back to a
+ * series of cs_matrix_vector_multiply calls.
+ *
+ * This function includes a halo update of x prior to multiplication by A.
+ *
+ * \param[in]       matrix  pointer to matrix structure
+ * \param[in]       n_vecs  number of interleaved vectors
+ * \param[in, out]  x       multiplying vectors values
+ *                          (ghost values updated)
+ * \param[out]      y       resulting vectors
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_vector_multiply_multi(const cs_matrix_t  *matrix,
+                                cs_lnum_t           n_vecs,
+                                cs_real_t          *restrict x,
+                                cs_real_t          *restrict y);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -263,6 +263,50 @@ _mat_vect_p_l_native_exdiag_sym(cs_lnum_t           n_edges,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * SpMV extradiagonal terms using a matrix-free face-based operator and
+ * scatter approach, handling conflicts through atomic add.
+ *
+ * parameters:
+ *   n_edges     <-- local number of internal graph edges (mesh faces)
+ *   edges       <-- edges (mesh face -> cells) connectivity
+ *   iconvp      <-- 1 for convection, 0 otherwise
+ *   idiffp      <-- 1 for diffusion, 0 otherwise
+ *   thetap      <-- theta-scheme weighting coefficient
+ *   i_massflux  <-- mass flux at interior faces (nullptr if iconvp = 0)
+ *   i_visc      <-- face viscosity at interior faces
+ *   x           <-- vector
+ *   y           <-> vector
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_mat_vect_p_l_native_exdiag_f_op(cs_lnum_t           n_edges,
+                                 const cs_lnum_2_t  *__restrict__ edges,
+                                 int                 iconvp,
+                                 int                 idiffp,
+                                 cs_real_t           thetap,
+                                 const cs_real_t    *__restrict__ i_massflux,
+                                 const cs_real_t    *__restrict__ i_visc,
+                                 const cs_real_t    *__restrict__ x,
+                                 cs_real_t          *__restrict__ y)
+{
+  cs_lnum_t edge_id = blockIdx.x * blockDim.x + threadIdx.x;
+
+  if (edge_id < n_edges) {
+    cs_lnum_t ii = edges[edge_id][0];
+    cs_lnum_t jj = edges[edge_id][1];
+    cs_real_t m_f = (iconvp) ? i_massflux[edge_id] : 0.;
+    cs_real_t xa_ij, xa_ji;
+    cs_matrix_face_operator_coeffs(iconvp, idiffp, thetap,
+                                   m_f, i_visc[edge_id],
+                                   &xa_ij, &xa_ji);
+    cs_real_t x_ii = __ldg(x + ii);
+    cs_real_t x_jj = __ldg(x + jj);
+    atomicAdd(&y[ii], xa_ij * x_jj);
+    atomicAdd(&y[jj], xa_ji * x_ii);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /* \brief Local matrix.vector product y = A.x with CSR matrix arrays.
  *
@@ -438,6 +482,59 @@ _mat_vect_p_l_msr_diag(cs_lnum_t         n_rows,
     y[ii] = d_val[ii] * x[ii];
 }
 
+/*----------------------------------------------------------------------------*/
+/* \brief Local matrix.vector product y = A.x with SELL-C-sigma matrix.
+ *
+ * Each thread handles one lane of a slice; as slices are stored
+ * column-major, neighboring threads access contiguous coefficients.
+ *
+ * \param[in]   n_rows       number of local rows
+ * \param[in]   slice_size   number of rows per slice
+ * \param[in]   slice_index  slice start index
+ * \param[in]   row_id       row id matching each lane
+ * \param[in]   col_id       pointer to (padded) column id
+ * \param[in]   d_val        pointer to diagonal matrix values, or NULL
+ * \param[in]   s_val        pointer to sliced extradiagonal matrix values
+ * \param[in]   x            multipliying vector values
+ * \param[out]  y            resulting vector
+ */
+/*----------------------------------------------------------------------------*/
+
+__global__ static void
+_mat_vect_p_l_sell(cs_lnum_t         n_rows,
+                   cs_lnum_t         slice_size,
+                   const cs_lnum_t  *__restrict__ slice_index,
+                   const cs_lnum_t  *__restrict__ row_id,
+                   const cs_lnum_t  *__restrict__ col_id,
+                   const cs_real_t  *__restrict__ d_val,
+                   const cs_real_t  *__restrict__ s_val,
+                   const cs_real_t  *__restrict__ x,
+                   cs_real_t        *__restrict__ y)
+{
+  cs_lnum_t k = blockIdx.x * blockDim.x + threadIdx.x;
+
+  if (k < n_rows) {
+    cs_lnum_t s = k / slice_size;
+    cs_lnum_t l = k - s*slice_size;
+    cs_lnum_t s_start = slice_index[s];
+    cs_lnum_t s_width = (slice_index[s+1] - s_start) / slice_size;
+
+    const cs_lnum_t *__restrict__ _col_id = col_id + s_start + l;
+    const cs_real_t *__restrict__ m_row  = s_val + s_start + l;
+
+    cs_real_t sii = 0.0;
+
+    for (cs_lnum_t jj = 0; jj < s_width; jj++)
+      sii += m_row[jj*slice_size] * __ldg(x + _col_id[jj*slice_size]);
+
+    cs_lnum_t ii = row_id[k];
+    if (d_val != NULL)
+      sii += d_val[ii] * x[ii];
+
+    y[ii] = sii;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /* \brief Local matrix.vector product y = A.x with MSR matrix,
  *        3x3 blocked diagonal version.
@@ -1280,6 +1377,27 @@ cs_matrix_spmv_cuda_native(const cs_matrix_t  *matrix,
 #endif
   }
 
+  else if (mc->f_op != NULL) {
+    const cs_matrix_face_operator_t *f_op = mc->f_op;
+
+    gridsize = cs_cuda_grid_size(ms->n_edges, blocksize);
+
+    const cs_lnum_2_t *restrict edges
+      = (const cs_lnum_2_t *)cs_get_device_ptr_const_pf
+                               (const_cast<cs_lnum_2_t *>(ms->edges));
+    const cs_real_t *__restrict__ i_massflux = NULL;
+    if (f_op->iconvp)
+      i_massflux = (const cs_real_t *)cs_get_device_ptr_const_pf
+                     (const_cast<cs_real_t *>(f_op->i_massflux));
+    const cs_real_t *__restrict__ i_visc
+      = (const cs_real_t *)cs_get_device_ptr_const_pf
+                             (const_cast<cs_real_t *>(f_op->i_visc));
+
+    _mat_vect_p_l_native_exdiag_f_op<<<gridsize, blocksize, 0, _stream>>>
+      (ms->n_edges, edges, f_op->iconvp, f_op->idiffp, f_op->thetap,
+       i_massflux, i_visc, d_x, d_y);
+  }
+
   cudaStreamSynchronize(_stream);
 
   if (_stream == 0) {
@@ -1565,6 +1683,78 @@ cs_matrix_spmv_cuda_msr(cs_matrix_t  *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Matrix.vector product y = A.x with SELL-C-sigma matrix,
+ *        scalar CUDA version.
+ *
+ * \param[in]   matrix        pointer to matrix structure
+ * \param[in]   exclude_diag  exclude diagonal if true,
+ * \param[in]   sync          synchronize ghost cells if true
+ * \param[in]   d_x           multipliying vector values (on device)
+ * \param[out]  d_y           resulting vector (on device)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_spmv_cuda_sell(cs_matrix_t  *matrix,
+                         bool          exclude_diag,
+                         bool          sync,
+                         cs_real_t     d_x[],
+                         cs_real_t     d_y[])
+{
+  const cs_matrix_struct_sell_t *ms
+    = (const cs_matrix_struct_sell_t *)matrix->structure;
+  const cs_matrix_coeff_dist_t *mc
+    = (const cs_matrix_coeff_dist_t *)matrix->coeffs;
+
+  /* Sliced coefficients are only built for scalar extradiagonal
+     coefficients; use base MSR representation otherwise */
+
+  if (mc->_s_val == NULL) {
+    cs_matrix_spmv_cuda_msr(matrix, exclude_diag, sync, d_x, d_y);
+    return;
+  }
+
+  const cs_lnum_t *__restrict__ slice_index
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(ms->slice_index);
+  const cs_lnum_t *__restrict__ row_id
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(ms->row_id);
+  const cs_lnum_t *__restrict__ col_id
+    = (const cs_lnum_t *)cs_get_device_ptr_const_pf(ms->col_id);
+
+  const cs_real_t *__restrict__ d_val = NULL;
+  if (!exclude_diag)
+    d_val = (const cs_real_t *)cs_get_device_ptr_const_pf
+                                 (const_cast<cs_real_t *>(mc->d_val));
+  const cs_real_t *__restrict__ s_val
+    = (const cs_real_t *)cs_get_device_ptr_const_pf(mc->_s_val);
+
+  /* Ghost cell communication */
+
+  if (sync) {
+    cs_halo_state_t *hs = _pre_vector_multiply_sync_x_start(matrix, d_x);
+    cs_halo_sync_wait(matrix->halo, d_x, hs);
+  }
+
+  /* Compute SpMV */
+
+  const cs_lnum_t n_rows = ms->msr.n_rows;
+
+  unsigned int blocksize = 256;
+  unsigned int gridsize
+    = (unsigned int)ceil((double)n_rows / blocksize);
+
+  _mat_vect_p_l_sell<<<gridsize, blocksize, 0, _stream>>>
+    (n_rows, ms->slice_size, slice_index, row_id, col_id, d_val, s_val,
+     d_x, d_y);
+
+  if (_stream == 0) {
+    cudaStreamSynchronize(0);
+    CS_CUDA_CHECK(cudaGetLastError());
+  }
+}
+
 #if defined(HAVE_CUSPARSE)
 
 /*----------------------------------------------------------------------------*/
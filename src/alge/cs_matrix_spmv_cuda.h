@@ -174,6 +174,26 @@ cs_matrix_spmv_cuda_msr(cs_matrix_t  *matrix,
                         cs_real_t     d_x[],
                         cs_real_t     d_y[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Matrix.vector product y = A.x with SELL-C-sigma matrix,
+ *        scalar CUDA version.
+ *
+ * \param[in]   matrix        pointer to matrix structure
+ * \param[in]   exclude_diag  exclude diagonal if true,
+ * \param[in]   sync          synchronize ghost cells if true
+ * \param[in]   d_x           multipliying vector values (on device)
+ * \param[out]  d_y           resulting vector (on device)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_spmv_cuda_sell(cs_matrix_t  *matrix,
+                         bool          exclude_diag,
+                         bool          sync,
+                         cs_real_t     d_x[],
+                         cs_real_t     d_y[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Matrix.vector product y = A.x with MSR matrix, scalar cuSPARSE version.
@@ -108,6 +108,41 @@ BEGIN_C_DECLS
 /* Note that most types are declared in cs_matrix_priv.h.
    only those only handled here are declared here. */
 
+/* Online SpMV tuning state */
+
+struct _cs_matrix_tuner_t {
+
+  int                    n_tune_calls;  /* Number of calls over which
+                                           measures are spread */
+  int                    n_measure;     /* Number of measuring runs
+                                           per call */
+  int                    n_calls;       /* Number of measured calls */
+
+  cs_matrix_type_t       type;          /* Matrix type tuned for */
+  const char            *type_name;     /* Matrix type name */
+  cs_matrix_fill_type_t  fill_type;     /* Matrix fill type tuned for */
+
+  int                    n_variants;    /* Number of candidate variants */
+  cs_matrix_variant_t   *m_variant;     /* Candidate variants */
+  double                *spmv_cost;     /* Accumulated SpMV costs */
+
+  int                    n_r_variants;  /* Number of selected variants */
+  cs_matrix_variant_t   *r_variant;     /* Selected variants, or nullptr
+                                           while tuning is in progress */
+  double                 speedup[CS_MATRIX_SPMV_N_TYPES];
+
+  bool                   applied;       /* Is selection currently applied ? */
+
+  /* Saved matrix function pointers */
+
+  cs_matrix_vector_product_t  *vector_multiply[CS_MATRIX_SPMV_N_TYPES];
+#if defined(HAVE_ACCEL)
+  cs_matrix_vector_product_t  *vector_multiply_h[CS_MATRIX_SPMV_N_TYPES];
+  cs_matrix_vector_product_t  *vector_multiply_d[CS_MATRIX_SPMV_N_TYPES];
+#endif
+
+};
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -444,6 +479,292 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
   return r_variant;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a structure for online tuning of matrix.vector products.
+ *
+ * Rather than timing all variants at matrix creation, measures are
+ * spread over the first calls to \ref cs_matrix_tuner_apply, using the
+ * matrix actually passed to the solver, so the overhead is amortized
+ * over the run. The best variant is then kept for subsequent calls.
+ *
+ * \param[in]  n_tune_calls  number of calls over which measures are spread
+ * \param[in]  n_measure     number of measuring runs per call
+ *
+ * \returns  pointer to tuner structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_tuner_t *
+cs_matrix_tuner_create(int  n_tune_calls,
+                       int  n_measure)
+{
+  cs_matrix_tuner_t *t;
+  BFT_MALLOC(t, 1, cs_matrix_tuner_t);
+
+  t->n_tune_calls = CS_MAX(n_tune_calls, 1);
+  t->n_measure = CS_MAX(n_measure, 1);
+  t->n_calls = 0;
+
+  t->type = CS_MATRIX_N_TYPES;
+  t->type_name = nullptr;
+  t->fill_type = CS_MATRIX_N_FILL_TYPES;
+
+  t->n_variants = 0;
+  t->m_variant = nullptr;
+  t->spmv_cost = nullptr;
+
+  t->n_r_variants = (cs_get_device_id() > -1) ? 3 : 1;
+  t->r_variant = nullptr;
+
+  for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++) {
+    t->speedup[j] = -1;
+    t->vector_multiply[j] = nullptr;
+#if defined(HAVE_ACCEL)
+    t->vector_multiply_h[j] = nullptr;
+    t->vector_multiply_d[j] = nullptr;
+#endif
+  }
+
+  t->applied = false;
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a matrix.vector product tuning structure.
+ *
+ * \param[in, out]  t  pointer to tuner structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuner_destroy(cs_matrix_tuner_t  **t)
+{
+  if (t == nullptr || *t == nullptr)
+    return;
+
+  cs_matrix_tuner_t *_t = *t;
+
+  BFT_FREE(_t->m_variant);
+  BFT_FREE(_t->spmv_cost);
+  BFT_FREE(_t->r_variant);
+
+  BFT_FREE(*t);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Measure or apply tuned matrix.vector product variants.
+ *
+ * While tuning is in progress, this function times the available SpMV
+ * variants for the given matrix; once the required number of calls is
+ * reached, the best variants are selected. After selection, they are
+ * applied to the matrix, whose previous function pointers are saved,
+ * so that \ref cs_matrix_tuner_restore should be called once the
+ * matrix is not used by the caller anymore (as matrices may be
+ * shared between systems).
+ *
+ * If the matrix type or fill type changes, tuning restarts.
+ *
+ * This function is collective when measures are made.
+ *
+ * \param[in, out]  t  pointer to tuner structure
+ * \param[in]       m  associated matrix
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuner_apply(cs_matrix_tuner_t  *t,
+                      const cs_matrix_t  *m)
+{
+  if (t == nullptr || m == nullptr || t->applied)
+    return;
+
+  if (m->type != t->type || m->fill_type != t->fill_type) {
+    BFT_FREE(t->m_variant);
+    BFT_FREE(t->spmv_cost);
+    BFT_FREE(t->r_variant);
+    t->n_variants = 0;
+    t->n_calls = 0;
+    for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++)
+      t->speedup[j] = -1;
+    t->type = m->type;
+    t->type_name = cs_matrix_get_type_name(m);
+    t->fill_type = m->fill_type;
+  }
+
+  /* Measure during first calls */
+
+  if (t->n_calls < t->n_tune_calls) {
+
+    if (t->m_variant == nullptr) {
+      cs_matrix_variant_build_list(m, &(t->n_variants), &(t->m_variant));
+      BFT_MALLOC(t->spmv_cost, t->n_variants*CS_MATRIX_SPMV_N_TYPES, double);
+      for (int i = 0; i < t->n_variants*CS_MATRIX_SPMV_N_TYPES; i++)
+        t->spmv_cost[i] = 0;
+    }
+
+    /* Nothing to choose from */
+
+    if (t->n_variants < 2) {
+      t->n_calls = t->n_tune_calls;
+      return;
+    }
+
+    int n_c = t->n_variants*CS_MATRIX_SPMV_N_TYPES;
+    double *spmv_cost;
+    BFT_MALLOC(spmv_cost, n_c, double);
+
+    _matrix_tune_test(m, t->n_measure, t->n_variants, t->m_variant, spmv_cost);
+
+    /* Negative costs mark unavailable variants */
+
+    for (int i = 0; i < n_c; i++) {
+      if (spmv_cost[i] < 0 || t->spmv_cost[i] < 0)
+        t->spmv_cost[i] = -1;
+      else
+        t->spmv_cost[i] += spmv_cost[i];
+    }
+
+    BFT_FREE(spmv_cost);
+
+    t->n_calls += 1;
+
+    if (t->n_calls < t->n_tune_calls)
+      return;
+
+    /* Select best variants; unselected entries default to first variant */
+
+    BFT_MALLOC(t->r_variant, t->n_r_variants, cs_matrix_variant_t);
+    for (int k = 0; k < t->n_r_variants; k++)
+      memcpy(t->r_variant + k, t->m_variant, sizeof(cs_matrix_variant_t));
+
+    _matrix_tune_spmv_select(m,
+                             0,
+                             t->n_variants,
+                             t->n_r_variants,
+                             t->m_variant,
+                             t->r_variant,
+                             t->spmv_cost);
+
+    for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++) {
+      double c_min = -1;
+      for (int i = 0; i < t->n_variants; i++) {
+        double c = t->spmv_cost[i*CS_MATRIX_SPMV_N_TYPES + j];
+        if (c > 0 && (c_min < 0 || c < c_min))
+          c_min = c;
+      }
+      if (c_min > 0 && t->spmv_cost[j] > 0)
+        t->speedup[j] = t->spmv_cost[j] / c_min;
+    }
+
+    BFT_FREE(t->spmv_cost);
+  }
+
+  if (t->r_variant == nullptr)
+    return;
+
+  /* Save current functions and apply selection */
+
+  cs_matrix_t *_m = const_cast<cs_matrix_t *>(m);
+
+  for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++) {
+    t->vector_multiply[j] = _m->vector_multiply[m->fill_type][j];
+#if defined(HAVE_ACCEL)
+    t->vector_multiply_h[j] = _m->vector_multiply_h[m->fill_type][j];
+    t->vector_multiply_d[j] = _m->vector_multiply_d[m->fill_type][j];
+#endif
+  }
+
+  cs_matrix_variant_apply_tuned(_m, t->r_variant);
+
+  t->applied = true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Restore matrix.vector product functions saved by a previous
+ *        call to \ref cs_matrix_tuner_apply.
+ *
+ * \param[in, out]  t  pointer to tuner structure
+ * \param[in]       m  associated matrix
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuner_restore(cs_matrix_tuner_t  *t,
+                        const cs_matrix_t  *m)
+{
+  if (t == nullptr || m == nullptr || t->applied == false)
+    return;
+
+  cs_matrix_t *_m = const_cast<cs_matrix_t *>(m);
+
+  if (_m->destroy_adaptor != nullptr)
+    _m->destroy_adaptor(_m);
+
+  for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++) {
+    _m->vector_multiply[m->fill_type][j] = t->vector_multiply[j];
+#if defined(HAVE_ACCEL)
+    _m->vector_multiply_h[m->fill_type][j] = t->vector_multiply_h[j];
+    _m->vector_multiply_d[m->fill_type][j] = t->vector_multiply_d[j];
+#endif
+  }
+
+  t->applied = false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log matrix.vector product tuning info.
+ *
+ * \param[in]  t         pointer to tuner structure
+ * \param[in]  log_type  log type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuner_log(const cs_matrix_tuner_t  *t,
+                    cs_log_t                  log_type)
+{
+  if (t == nullptr || t->type == CS_MATRIX_N_TYPES)
+    return;
+
+  if (t->r_variant == nullptr) {
+    if (t->n_variants > 1)
+      cs_log_printf(log_type,
+                    _("\n"
+                      "  SpMV tuning: %d of %d solves measured\n"),
+                    t->n_calls, t->n_tune_calls);
+    return;
+  }
+
+  const char *op_name[] = {"y <= A.x", "y <= (A-D).x"};
+  const char *hd_type[] = {"", "host ", "device "};
+
+  cs_log_printf(log_type,
+                _("\n"
+                  "  SpMV tuning for matrix of type %s and fill %s:\n"),
+                _(t->type_name),
+                _(cs_matrix_fill_type_name[t->fill_type]));
+
+  for (int k = 0; k < t->n_r_variants; k++) {
+    const cs_matrix_variant_t *v = t->r_variant + k;
+    for (int j = 0; j < CS_MATRIX_SPMV_N_TYPES; j++) {
+      if (k == 0 && t->speedup[j] > 0)
+        cs_log_printf(log_type,
+                      _("    %s%-14s %-32s (speedup: %6.2f)\n"),
+                      hd_type[k], op_name[j], v->name[j], t->speedup[j]);
+      else
+        cs_log_printf(log_type,
+                      _("    %s%-14s %s\n"),
+                      hd_type[k], op_name[j], v->name[j]);
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -34,6 +34,8 @@
 #include "cs_defs.h"
 
 #include "cs_halo.h"
+#include "cs_log.h"
+#include "cs_matrix.h"
 #include "cs_numbering.h"
 #include "cs_halo_perio.h"
 
@@ -49,6 +51,10 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Online matrix.vector product tuning structure */
+
+typedef struct _cs_matrix_tuner_t  cs_matrix_tuner_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -80,6 +86,89 @@ cs_matrix_variant_tuned(const cs_matrix_t  *m,
                         int                 verbosity,
                         int                 n_measure);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a structure for online tuning of matrix.vector products.
+ *
+ * Rather than timing all variants at matrix creation, measures are
+ * spread over the first calls to \ref cs_matrix_tuner_apply, using the
+ * matrix actually passed to the solver, so the overhead is amortized
+ * over the run. The best variant is then kept for subsequent calls.
+ *
+ * \param[in]  n_tune_calls  number of calls over which measures are spread
+ * \param[in]  n_measure     number of measuring runs per call
+ *
+ * \returns  pointer to tuner structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_matrix_tuner_t *
+cs_matrix_tuner_create(int  n_tune_calls,
+                       int  n_measure);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a matrix.vector product tuning structure.
+ *
+ * \param[in, out]  t  pointer to tuner structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuner_destroy(cs_matrix_tuner_t  **t);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Measure or apply tuned matrix.vector product variants.
+ *
+ * While tuning is in progress, this function times the available SpMV
+ * variants for the given matrix; once the required number of calls is
+ * reached, the best variants are selected. After selection, they are
+ * applied to the matrix, whose previous function pointers are saved,
+ * so that \ref cs_matrix_tuner_restore should be called once the
+ * matrix is not used by the caller anymore (as matrices may be
+ * shared between systems).
+ *
+ * If the matrix type or fill type changes, tuning restarts.
+ *
+ * This function is collective when measures are made.
+ *
+ * \param[in, out]  t  pointer to tuner structure
+ * \param[in]       m  associated matrix
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuner_apply(cs_matrix_tuner_t  *t,
+                      const cs_matrix_t  *m);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Restore matrix.vector product functions saved by a previous
+ *        call to \ref cs_matrix_tuner_apply.
+ *
+ * \param[in, out]  t  pointer to tuner structure
+ * \param[in]       m  associated matrix
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuner_restore(cs_matrix_tuner_t  *t,
+                        const cs_matrix_t  *m);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log matrix.vector product tuning info.
+ *
+ * \param[in]  t         pointer to tuner structure
+ * \param[in]  log_type  log type
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_tuner_log(const cs_matrix_tuner_t  *t,
+                    cs_log_t                  log_type);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
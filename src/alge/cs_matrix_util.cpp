@@ -517,6 +517,21 @@ _diag_dom_dist(const cs_matrix_t  *matrix,
       dd[ii] += sii;
     }
 
+  }
+  else if (mc->_e_val_f != nullptr) {
+
+    const cs_matrix_struct_csr_t  *ms_e = &(ms->e);
+
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      const float *restrict m_row = mc->_e_val_f + ms_e->row_index[ii];
+      cs_lnum_t n_cols = ms_e->row_index[ii+1] - ms_e->row_index[ii];
+      cs_real_t sii = 0.0;
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii -= fabs(m_row[jj]);
+      dd[ii] += sii;
+    }
+
   }
 
   if (mc->h_val != nullptr) {
@@ -1248,6 +1263,7 @@ _prepare_matrix_dump_data(const cs_matrix_t   *m,
     _n_entries = _pre_dump_csr(m, g_coo_num, &_m_coords, &_m_vals);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     if (m->db_size == 1)
       _n_entries = _pre_dump_msr(m, g_coo_num, &_m_coords, &_m_vals);
     else
@@ -1725,6 +1741,7 @@ _frobenius_norm(const cs_matrix_t  *m)
     break;
 
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     {
       cs_lnum_t  d_stride = m->db_size * m->db_size;
       cs_lnum_t  e_stride = m->eb_size * m->eb_size;
@@ -1803,6 +1820,7 @@ cs_matrix_diag_dominance(const cs_matrix_t  *matrix,
     _diag_dom_csr(matrix, dd);
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     if (matrix->db_size == 1)
       _diag_dom_dist(matrix, dd);
     else
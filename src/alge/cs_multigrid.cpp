@@ -35,6 +35,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <assert.h>
+#include <limits.h>
 #include <math.h>
 
 #if defined(HAVE_MPI)
@@ -142,6 +143,34 @@ typedef struct _cs_mg_sles_t {
 
 } cs_mg_sles_t;
 
+/* Direct solver context for coarsest level (dense LU factorization,
+   replicated on all ranks of the coarsest grid) */
+/*------------------------------------------------------------------*/
+
+typedef struct _cs_multigrid_coarse_lu_t {
+
+  cs_lnum_t    n_rows;            /* Number of local (scalar) rows */
+  cs_lnum_t    n_g_rows;          /* Number of global (scalar) rows,
+                                     i.e. size of replicated system */
+  cs_lnum_t    row_shift;         /* Position of local rows in
+                                     replicated system */
+
+  cs_real_t   *lu;                /* LU factorization (row major,
+                                     unit lower part implicit) */
+  cs_lnum_t   *pivot;             /* Row permutations */
+  cs_real_t   *rhs_g;             /* Replicated right-hand side */
+
+#if defined(HAVE_MPI)
+
+  MPI_Comm     comm;              /* Associated communicator */
+  int          n_ranks;           /* Number of ranks in communicator */
+  int         *counts;            /* Number of rows per rank */
+  int         *displs;            /* Row displacements per rank */
+
+#endif
+
+} cs_multigrid_coarse_lu_t;
+
 /* Basic per linear system options and logging */
 /*---------------------------------------------*/
 
@@ -166,6 +195,10 @@ typedef struct _cs_multigrid_info_t {
   double               precision_mult[3];   /* solver precision multiplier
                                                (descent/ascent/coarse) */
 
+  cs_datatype_t        coarse_coeffs_type;  /* coarse levels matrix
+                                               coefficients storage type
+                                               (CS_DOUBLE or CS_FLOAT) */
+
   /* Logging */
 
   unsigned             n_calls[2];          /* Number of times grids built
@@ -299,6 +332,19 @@ struct _cs_multigrid_t {
   double     p0p1_relax;         /* p0/p1 relaxation_parameter */
   double     k_cycle_threshold;  /* threshold for k cycle */
 
+  int        reuse_max;          /* Maximum number of successive setups
+                                    reusing the coarse grids aggregation
+                                    (0: no reuse, < 0: unlimited) */
+  double     reuse_rebuild_ratio;  /* Force rebuild of aggregation when
+                                      the number of cycles between setups
+                                      exceeds this ratio times the number
+                                      of cycles following the last build */
+
+  cs_gnum_t  coarse_lu_n_g_rows_max;  /* Global number of (scalar) rows
+                                         on coarsest grid under which it is
+                                         solved using a replicated direct
+                                         LU factorization (0: not used) */
+
   /* Setting for use as a preconditioner */
 
   double     pc_precision;       /* preconditioner precision */
@@ -349,6 +395,22 @@ struct _cs_multigrid_t {
 
   cs_multigrid_setup_data_t  *setup_data;   /* setup data */
 
+  /* Coarse grids kept between setups for aggregation reuse */
+
+  unsigned                    n_reuse_grids;     /* number of kept levels */
+  cs_grid_t                 **reuse_grids;       /* kept coarse grids
+                                                    (level 0 not kept) */
+  cs_lnum_t                   reuse_f_size[3];   /* fine grid number of rows,
+                                                    columns, and entries */
+  int                         n_reuse;           /* number of successive
+                                                    setups with reuse */
+  unsigned long long          n_reuse_tot;       /* total number of
+                                                    setups with reuse */
+  unsigned                    reuse_n_cycles;    /* number of cycles since
+                                                    last setup */
+  unsigned                    reuse_n_cycles_ref; /* number of cycles after
+                                                     last full build */
+
   cs_time_plot_t             *cycle_plot;       /* plotting of cycles */
   int                         plot_time_stamp;  /* plotting time stamp;
                                                    if < 0, use wall clock */
@@ -444,6 +506,8 @@ _multigrid_info_init(cs_multigrid_info_t *info)
   info->precision_mult[1] = -1.;
   info->precision_mult[2] = 1.;
 
+  info->coarse_coeffs_type = CS_DOUBLE;
+
   /* Counting and timing */
 
   for (i = 0; i < 2; i++)
@@ -554,6 +618,24 @@ _multigrid_setup_log(const cs_multigrid_t *mg)
                 _("  Cycle type:                        %s\n"),
                 _(cs_multigrid_type_name[mg->type]));
 
+  cs_log_printf(CS_LOG_SETUP,
+                _("  Coarse levels coefficients:        %s\n"),
+                (mg->info.coarse_coeffs_type == CS_FLOAT) ?
+                _("single precision") : _("double precision"));
+
+  if (mg->reuse_max != 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarse grids aggregation reuse:\n"
+                    "    Max. successive reuses:          %d\n"
+                    "    Rebuild cycles ratio:            %g\n"),
+                  mg->reuse_max, mg->reuse_rebuild_ratio);
+
+  if (mg->coarse_lu_n_g_rows_max > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarsest grid direct solve:\n"
+                    "    Max. global rows:                %llu\n"),
+                  (unsigned long long)(mg->coarse_lu_n_g_rows_max));
+
   const char *stage_name[] = {"Descent smoother",
                               "Ascent smoother",
                               "Coarsest level solver"};
@@ -703,6 +785,13 @@ _multigrid_performance_log(const cs_multigrid_t *mg)
                 tmp_s[1], n_cy_mean,
                 (int)(mg->info.n_cycles[0]), (int)(mg->info.n_cycles[1]));
 
+  if (mg->n_reuse_tot > 0) {
+    cs_log_strpad(tmp_s[0], _("Setups reusing aggregation:"), 36, 64);
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %s %12llu\n\n",
+                  tmp_s[0], mg->n_reuse_tot);
+  }
+
   cs_log_timer_array_header(CS_LOG_PERFORMANCE,
                             2,                  /* indent, */
                             "",                 /* header title */
@@ -1954,6 +2043,409 @@ _multigrid_setup_sles_k_cycle_bottom(cs_multigrid_t  *mg,
   cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------
+ * Create coarsest level direct solver context.
+ *
+ * parameters:
+ *   g <-- pointer to coarsest grid
+ *
+ * returns:
+ *   pointer to newly created direct solver context
+ *----------------------------------------------------------------------------*/
+
+static cs_multigrid_coarse_lu_t *
+_coarse_lu_create(const cs_grid_t  *g)
+{
+  cs_multigrid_coarse_lu_t *c;
+  BFT_MALLOC(c, 1, cs_multigrid_coarse_lu_t);
+
+  c->n_rows = 0;
+  c->n_g_rows = 0;
+  c->row_shift = 0;
+
+  c->lu = nullptr;
+  c->pivot = nullptr;
+  c->rhs_g = nullptr;
+
+#if defined(HAVE_MPI)
+
+  c->comm = cs_grid_get_comm(g);
+  c->n_ranks = 1;
+  c->counts = nullptr;
+  c->displs = nullptr;
+
+  if (c->comm != MPI_COMM_NULL) {
+    MPI_Comm_size(c->comm, &(c->n_ranks));
+    if (c->n_ranks < 2)
+      c->comm = MPI_COMM_NULL;
+    else {
+      BFT_MALLOC(c->counts, c->n_ranks, int);
+      BFT_MALLOC(c->displs, c->n_ranks + 1, int);
+    }
+  }
+
+#else
+
+  CS_UNUSED(g);
+
+#endif
+
+  return c;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy coarsest level direct solver context.
+ *
+ * parameters:
+ *   context <-> pointer to direct solver context pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_coarse_lu_destroy(void  **context)
+{
+  cs_multigrid_coarse_lu_t *c
+    = static_cast<cs_multigrid_coarse_lu_t *>(*context);
+
+  if (c == nullptr)
+    return;
+
+  BFT_FREE(c->lu);
+  BFT_FREE(c->pivot);
+  BFT_FREE(c->rhs_g);
+
+#if defined(HAVE_MPI)
+  BFT_FREE(c->counts);
+  BFT_FREE(c->displs);
+#endif
+
+  BFT_FREE(c);
+  *context = nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute in-place LU factorization with partial pivoting of a dense
+ * (row major) matrix.
+ *
+ * Pivots which are negligible relative to the largest diagonal value
+ * are set to zero, so that the associated unknowns are simply set to
+ * zero at solve time. This allows handling the singular (but consistent)
+ * coarse systems arising from pure Neumann problems.
+ *
+ * parameters:
+ *   n     <-- matrix size
+ *   lu    <-> matrix values in, factorization out
+ *   pivot --> row permutations
+ *----------------------------------------------------------------------------*/
+
+static void
+_coarse_lu_factorize(cs_lnum_t   n,
+                     cs_real_t   lu[],
+                     cs_lnum_t   pivot[])
+{
+  cs_real_t d_max = 0;
+  for (cs_lnum_t i = 0; i < n; i++)
+    d_max = CS_MAX(d_max, fabs(lu[(size_t)i*n + i]));
+
+  const cs_real_t eps = d_max * 1e-12;
+
+  for (cs_lnum_t k = 0; k < n; k++) {
+
+    /* Partial pivoting */
+
+    cs_lnum_t p = k;
+    cs_real_t p_max = fabs(lu[(size_t)k*n + k]);
+    for (cs_lnum_t i = k+1; i < n; i++) {
+      if (fabs(lu[(size_t)i*n + k]) > p_max) {
+        p = i;
+        p_max = fabs(lu[(size_t)i*n + k]);
+      }
+    }
+
+    pivot[k] = p;
+
+    if (p != k) {
+      cs_real_t *restrict r_k = lu + (size_t)k*n;
+      cs_real_t *restrict r_p = lu + (size_t)p*n;
+      for (cs_lnum_t j = 0; j < n; j++) {
+        cs_real_t t = r_k[j];
+        r_k[j] = r_p[j];
+        r_p[j] = t;
+      }
+    }
+
+    const cs_real_t *restrict r_k = lu + (size_t)k*n;
+
+    if (p_max <= eps) {
+      lu[(size_t)k*n + k] = 0;
+      for (cs_lnum_t i = k+1; i < n; i++)
+        lu[(size_t)i*n + k] = 0;
+      continue;
+    }
+
+    const cs_real_t d_inv = 1. / r_k[k];
+
+#   pragma omp parallel for if(n - k > CS_THR_MIN)
+    for (cs_lnum_t i = k+1; i < n; i++) {
+      cs_real_t *restrict r_i = lu + (size_t)i*n;
+      const cs_real_t l = r_i[k] * d_inv;
+      r_i[k] = l;
+      if (fabs(l) > 0) {
+        for (cs_lnum_t j = k+1; j < n; j++)
+          r_i[j] -= l*r_k[j];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Setup coarsest level direct solver.
+ *
+ * The local rows of the matrix are assembled in a dense matrix
+ * replicated an all ranks of the coarsest grid, which is then factorized.
+ *
+ * parameters:
+ *   context   <-> pointer to direct solver context
+ *   name      <-- pointer to name of linear system
+ *   a         <-- associated matrix
+ *   verbosity <-- associated verbosity
+ *----------------------------------------------------------------------------*/
+
+static void
+_coarse_lu_setup(void               *context,
+                 const char         *name,
+                 const cs_matrix_t  *a,
+                 int                 verbosity)
+{
+  cs_multigrid_coarse_lu_t *c
+    = static_cast<cs_multigrid_coarse_lu_t *>(context);
+
+  const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
+  const cs_lnum_t n_b_rows = cs_matrix_get_n_rows(a);
+  const cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+
+  c->n_rows = n_b_rows*db_size;
+  c->n_g_rows = c->n_rows;
+  c->row_shift = 0;
+
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL) {
+    int rank_id, n_rows = c->n_rows;
+    MPI_Comm_rank(c->comm, &rank_id);
+    MPI_Allgather(&n_rows, 1, MPI_INT, c->counts, 1, MPI_INT, c->comm);
+    c->displs[0] = 0;
+    for (int i = 0; i < c->n_ranks; i++)
+      c->displs[i+1] = c->displs[i] + c->counts[i];
+    c->n_g_rows = c->displs[c->n_ranks];
+    c->row_shift = c->displs[rank_id];
+  }
+
+#endif
+
+  const cs_lnum_t n = c->n_g_rows;
+
+  BFT_REALLOC(c->lu, (size_t)n*n, cs_real_t);
+  BFT_REALLOC(c->pivot, n, cs_lnum_t);
+  BFT_REALLOC(c->rhs_g, n, cs_real_t);
+
+  /* Global (block) column ids */
+
+  cs_gnum_t *g_col_id;
+  BFT_MALLOC(g_col_id, n_cols_ext, cs_gnum_t);
+
+  const cs_gnum_t b_row_shift = c->row_shift / db_size;
+  for (cs_lnum_t i = 0; i < n_b_rows; i++)
+    g_col_id[i] = b_row_shift + i;
+
+  if (halo != nullptr)
+    cs_halo_sync(halo, CS_HALO_STANDARD, CS_GNUM_TYPE, 1, g_col_id);
+
+  /* Assemble local rows in place */
+
+  cs_real_t *a_l = c->lu + (size_t)(c->row_shift)*n;
+  memset(a_l, 0, (size_t)(c->n_rows)*n*sizeof(cs_real_t));
+
+  cs_matrix_row_info_t r;
+  cs_matrix_row_init(&r);
+
+  for (cs_lnum_t ii = 0; ii < c->n_rows; ii++) {
+    cs_matrix_get_row(a, ii, &r);
+    cs_real_t *restrict row = a_l + (size_t)ii*n;
+    for (cs_lnum_t jj = 0; jj < r.row_size; jj++) {
+      const cs_lnum_t c_id = r.col_id[jj];
+      const cs_gnum_t g_id =   g_col_id[c_id/db_size]*db_size
+                             + c_id%db_size;
+      row[g_id] += r.vals[jj];
+    }
+  }
+
+  cs_matrix_row_finalize(&r);
+
+  BFT_FREE(g_col_id);
+
+  /* Replicate matrix */
+
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL) {
+    int *counts, *displs;
+    BFT_MALLOC(counts, c->n_ranks*2, int);
+    displs = counts + c->n_ranks;
+    for (int i = 0; i < c->n_ranks; i++) {
+      counts[i] = c->counts[i]*n;
+      displs[i] = c->displs[i]*n;
+    }
+    MPI_Allgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
+                   c->lu, counts, displs, CS_MPI_REAL, c->comm);
+    BFT_FREE(counts);
+  }
+
+#endif
+
+  _coarse_lu_factorize(n, c->lu, c->pivot);
+
+  if (verbosity > 1)
+    bft_printf(_("  %s: dense LU factorization of %d rows\n"),
+               name, (int)n);
+}
+
+/*----------------------------------------------------------------------------
+ * Call coarsest level direct solver.
+ *
+ * parameters:
+ *   context       <-> pointer to direct solver context
+ *   name          <-- pointer to name of linear system
+ *   a             <-- matrix
+ *   verbosity     <-- associated verbosity
+ *   precision     <-- solver precision
+ *   r_norm        <-- residual normalization
+ *   n_iter        --> number of "iterations"
+ *   residual      --> residual
+ *   rhs           <-- right hand side
+ *   vx_ini        <-- initial system solution
+ *                     (vx if nonzero, nullptr if zero)
+ *   vx            --> system solution
+ *   aux_size      <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors   --- optional working area
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_coarse_lu_solve(void                *context,
+                 const char          *name,
+                 const cs_matrix_t   *a,
+                 int                  verbosity,
+                 double               precision,
+                 double               r_norm,
+                 int                 *n_iter,
+                 double              *residual,
+                 const cs_real_t     *rhs,
+                 cs_real_t           *vx_ini,
+                 cs_real_t           *vx,
+                 size_t               aux_size,
+                 void                *aux_vectors)
+{
+  CS_UNUSED(precision);
+  CS_UNUSED(vx_ini);
+
+  cs_multigrid_coarse_lu_t *c
+    = static_cast<cs_multigrid_coarse_lu_t *>(context);
+
+  const cs_lnum_t n = c->n_g_rows;
+  const cs_real_t *restrict lu = c->lu;
+  cs_real_t *restrict x = c->rhs_g;
+
+  /* Gather right-hand side */
+
+#if defined(HAVE_MPI)
+  if (c->comm != MPI_COMM_NULL)
+    MPI_Allgatherv(rhs, c->n_rows, CS_MPI_REAL,
+                   x, c->counts, c->displs, CS_MPI_REAL, c->comm);
+  else
+#endif
+    memcpy(x, rhs, c->n_rows*sizeof(cs_real_t));
+
+  /* Forward and backward substitution */
+
+  for (cs_lnum_t k = 0; k < n; k++) {
+    const cs_lnum_t p = c->pivot[k];
+    if (p != k) {
+      cs_real_t t = x[k];
+      x[k] = x[p];
+      x[p] = t;
+    }
+  }
+
+  for (cs_lnum_t i = 1; i < n; i++) {
+    const cs_real_t *restrict r_i = lu + (size_t)i*n;
+    cs_real_t s = x[i];
+    for (cs_lnum_t j = 0; j < i; j++)
+      s -= r_i[j]*x[j];
+    x[i] = s;
+  }
+
+  for (cs_lnum_t i = n-1; i > -1; i--) {
+    const cs_real_t *restrict r_i = lu + (size_t)i*n;
+    if (fabs(r_i[i]) > 0) {
+      cs_real_t s = x[i];
+      for (cs_lnum_t j = i+1; j < n; j++)
+        s -= r_i[j]*x[j];
+      x[i] = s / r_i[i];
+    }
+    else
+      x[i] = 0;
+  }
+
+  /* Extract local part */
+
+  memcpy(vx, x + c->row_shift, c->n_rows*sizeof(cs_real_t));
+
+  /* Compute true residual, as round-off errors or null pivots
+     (for singular systems) may lead to a nonzero value */
+
+  const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a)*db_size;
+
+  cs_real_t *_aux_vectors = nullptr;
+  cs_real_t *restrict w = static_cast<cs_real_t *>(aux_vectors);
+  if (w == nullptr || aux_size/sizeof(cs_real_t) < (size_t)n_cols) {
+    BFT_MALLOC(_aux_vectors, n_cols, cs_real_t);
+    w = _aux_vectors;
+  }
+
+  cs_matrix_vector_multiply(a, vx, w);
+
+  const cs_lnum_t n_rows = c->n_rows;
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    w[ii] = rhs[ii] - w[ii];
+
+  double r2 = cs_dot_xx(n_rows, w);
+
+#if defined(HAVE_MPI)
+  if (c->comm != MPI_COMM_NULL) {
+    double _r2 = r2;
+    MPI_Allreduce(&_r2, &r2, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+  }
+#endif
+
+  BFT_FREE(_aux_vectors);
+
+  *n_iter = 1;
+  *residual = sqrt(r2);
+
+  if (verbosity > 1 && r_norm > 0)
+    bft_printf(_("  %s: direct solve, normalized residual: %12.5e\n"),
+               name, *residual / r_norm);
+
+  return CS_SLES_CONVERGED;
+}
+
 /*----------------------------------------------------------------------------
  * Setup multigrid sparse linear equation solvers on existing hierarchy.
  *
@@ -2120,7 +2612,41 @@ _multigrid_setup_sles(cs_multigrid_t  *mg,
     cs_mg_sles_t  *mg_sles = &(mgd->sles_hierarchy[i*2]);
 
     mg_sles->context = nullptr;
-    if (mg->info.precision_mult[2] < 0) {
+
+    /* Use replicated direct solver if coarsest grid is small enough
+       (host only, as the dense solve is not ported to devices) */
+
+    bool on_device = (k > 0);
+    if (cs_matrix_get_alloc_mode(m) > CS_ALLOC_HOST)
+      on_device = true;
+
+    bool use_lu = false;
+    if (mg->coarse_lu_n_g_rows_max > 0 && on_device == false) {
+      cs_lnum_t db_size = 1;
+      cs_gnum_t n_g_rows = 0;
+      cs_grid_get_info(g, nullptr, nullptr, &db_size, nullptr, nullptr,
+                       nullptr, nullptr, nullptr, &n_g_rows);
+      n_g_rows *= db_size;
+#if defined(HAVE_MPI)
+      if (mg->comm != MPI_COMM_NULL) {
+        cs_gnum_t _n_g_rows = n_g_rows;
+        MPI_Allreduce(&_n_g_rows, &n_g_rows, 1, CS_MPI_GNUM, MPI_MAX,
+                      mg->comm);
+      }
+#endif
+      if (   n_g_rows <= mg->coarse_lu_n_g_rows_max
+          && n_g_rows*n_g_rows < (cs_gnum_t)INT_MAX
+          && cs_matrix_get_type(m) != CS_MATRIX_NATIVE)
+        use_lu = true;
+    }
+
+    if (use_lu) {
+      mg_sles->context = _coarse_lu_create(g);
+      mg_sles->setup_func = _coarse_lu_setup;
+      mg_sles->solve_func = _coarse_lu_solve;
+      mg_sles->destroy_func = _coarse_lu_destroy;
+    }
+    else if (mg->info.precision_mult[2] < 0) {
       mg_sles->context
         = cs_multigrid_smoother_create(mg->info.type[2+k],
                                        mg->info.poly_degree[2+k],
@@ -2142,13 +2668,13 @@ _multigrid_setup_sles(cs_multigrid_t  *mg,
       mg_sles->destroy_func = cs_sles_it_destroy;
     }
 
-    if (mg->lv_mg[2] != nullptr) {
+    if (mg->lv_mg[2] != nullptr && use_lu == false) {
       cs_sles_pc_t *pc = _pc_create_from_mg_sub(mg->lv_mg[2]);
       cs_sles_it_transfer_pc((cs_sles_it_t *)mg_sles->context, &pc);
     }
 
 #if defined(HAVE_MPI)
-    {
+    if (use_lu == false) {
       cs_sles_it_t  *context = (cs_sles_it_t *)mg_sles->context;
       cs_sles_it_set_mpi_reduce_comm(context,
                                      cs_grid_get_comm(mgd->grid_hierarchy[i]),
@@ -2264,6 +2790,98 @@ _level_names_init(const char                 *name,
   mgd->lv_names = const_cast<const char **>(_lv_names);
 }
 
+/*----------------------------------------------------------------------------
+ * Free coarse grids kept for aggregation reuse.
+ *
+ * parameters:
+ *   mg <-> pointer to multigrid solver info and context
+ *----------------------------------------------------------------------------*/
+
+static void
+_reuse_grids_free(cs_multigrid_t  *mg)
+{
+  if (mg->reuse_grids == nullptr)
+    return;
+
+  for (int i = mg->n_reuse_grids - 1; i > 0; i--) {
+    if (mg->reuse_grids[i] != nullptr)
+      cs_grid_destroy(mg->reuse_grids + i);
+  }
+  BFT_FREE(mg->reuse_grids);
+
+  mg->n_reuse_grids = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether coarse grids kept from the previous setup may be reused
+ * for a new fine grid, and free them otherwise.
+ *
+ * The aggregation is rebuilt if the fine grid's structure has changed,
+ * if the maximum number of successive reuses is reached, or if the number
+ * of cycles since the previous setup exceeds the allowed ratio of the
+ * number of cycles following the last full build.
+ *
+ * parameters:
+ *   mg <-> pointer to multigrid solver info and context
+ *   f  <-- fine grid
+ *----------------------------------------------------------------------------*/
+
+static void
+_reuse_grids_check(cs_multigrid_t   *mg,
+                   const cs_grid_t  *f)
+{
+  unsigned n_cycles = mg->reuse_n_cycles;
+  mg->reuse_n_cycles = 0;
+
+  if (mg->reuse_grids == nullptr) {
+    mg->n_reuse = 0;
+    return;
+  }
+
+  int rebuild = 0;
+
+  cs_lnum_t f_size[3];
+  cs_grid_get_info(f,
+                   nullptr,
+                   nullptr,
+                   nullptr,
+                   nullptr,
+                   nullptr,
+                   f_size,
+                   f_size + 1,
+                   f_size + 2,
+                   nullptr);
+
+  for (int i = 0; i < 3; i++) {
+    if (f_size[i] != mg->reuse_f_size[i])
+      rebuild = 1;
+  }
+
+  if (mg->n_reuse == 0)
+    mg->reuse_n_cycles_ref = n_cycles;
+  else if (mg->reuse_rebuild_ratio > 0) {
+    double n_ref = CS_MAX(mg->reuse_n_cycles_ref, 1);
+    if (n_cycles > mg->reuse_rebuild_ratio * n_ref)
+      rebuild = 1;
+  }
+
+  if (mg->reuse_max > 0 && mg->n_reuse >= mg->reuse_max)
+    rebuild = 1;
+
+#if defined(HAVE_MPI)
+  if (mg->caller_n_ranks > 1)
+    MPI_Allreduce(MPI_IN_PLACE, &rebuild, 1, MPI_INT, MPI_MAX,
+                  mg->caller_comm);
+#endif
+
+  if (rebuild) {
+    _reuse_grids_free(mg);
+    mg->n_reuse = 0;
+  }
+  else
+    mg->n_reuse += 1;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Setup multigrid sparse linear equation solver.
@@ -2297,6 +2915,8 @@ _setup_hierarchy(void             *context,
 
   cs_grid_t *g = f;
 
+  unsigned n_reused = 0;
+
   t0 = cs_timer_time();
 
   /* Initialization */
@@ -2335,16 +2955,46 @@ _setup_hierarchy(void             *context,
     if ((int)(mg->setup_data->n_levels) >= mg->n_levels_max)
       break;
 
+    /* Reuse coarse grid from previous setup if possible,
+       updating only its coefficients */
+
+    cs_grid_t *g_r = nullptr;
+
+    if (mg->reuse_grids != nullptr) {
+      unsigned lv = mg->setup_data->n_levels;
+      if (lv >= mg->n_reuse_grids) {  /* All previous levels reused */
+        _reuse_grids_free(mg);
+        break;
+      }
+      g_r = mg->reuse_grids[lv];
+      mg->reuse_grids[lv] = nullptr;
+      if (cs_grid_update_coarse_coefficients(g, g_r) == false) {
+        cs_grid_destroy(&g_r);
+        _reuse_grids_free(mg);
+      }
+    }
+
     /* Build coarser grid from previous grid */
 
-    if (verbosity > 2)
-      bft_printf(_("\n   building level %2u grid\n"), mg->setup_data->n_levels);
+    if (verbosity > 2) {
+      if (g_r != nullptr)
+        bft_printf(_("\n   updating level %2u grid\n"),
+                   mg->setup_data->n_levels);
+      else
+        bft_printf(_("\n   building level %2u grid\n"),
+                   mg->setup_data->n_levels);
+    }
 
     cs_alloc_mode_t amode = cs_grid_get_alloc_mode(g);
     if (mg->setup_data->n_levels > _grid_max_level_for_device)
       amode = CS_ALLOC_HOST;
 
-    if (mg->subtype == CS_MULTIGRID_BOTTOM)
+    if (g_r != nullptr) {
+      g = g_r;
+      n_reused++;
+    }
+
+    else if (mg->subtype == CS_MULTIGRID_BOTTOM)
       g = cs_grid_coarsen_to_single(g, amode, mg->merge_stride, verbosity);
 
     else {
@@ -2391,7 +3041,7 @@ _setup_hierarchy(void             *context,
 
     /* If too few rows were grouped, we stop at this level */
 
-    if (mg->setup_data->n_levels > 1) {
+    if (mg->setup_data->n_levels > 1 && g_r == nullptr) {
       if (   (n_g_rows < mg->n_g_rows_min)
           || (   n_g_rows > (0.8 * n_g_rows_prev)
               && n_coarse_ranks == n_coarse_ranks_prev)) {
@@ -2455,13 +3105,25 @@ _setup_hierarchy(void             *context,
 
   }
 
+  _reuse_grids_free(mg);
+
+  if (n_reused > 0)
+    mg->n_reuse_tot += 1;
+  else
+    mg->n_reuse = 0;
+
   /* Print final info */
 
-  if (verbosity > 1)
+  if (verbosity > 1) {
     bft_printf
       (_("   number of grid levels:           %u\n"
-         "   number of rows in coarsest grid: %llu\n\n"),
+         "   number of rows in coarsest grid: %llu\n"),
        mg->setup_data->n_levels, (unsigned long long)n_g_rows);
+    if (n_reused > 0)
+      bft_printf
+        (_("   number of reused coarse grids:   %u\n"), n_reused);
+    bft_printf("\n");
+  }
 
   /* Initialize names for later logging */
 
@@ -2569,6 +3231,16 @@ _setup_hierarchy(void             *context,
   for (unsigned i = 0; i < mg->setup_data->n_levels; i++)
     cs_grid_free_quantities(mg->setup_data->grid_hierarchy[i]);
 
+  /* Store coarse level coefficients in single precision if requested
+     (this must be done after the full hierarchy is built, as coarsening
+     uses the fine level coefficients) */
+
+  if (mg->info.coarse_coeffs_type != CS_DOUBLE) {
+    for (unsigned i = 1; i < mg->setup_data->n_levels; i++)
+      cs_grid_set_matrix_coefficients_type(mg->setup_data->grid_hierarchy[i],
+                                           mg->info.coarse_coeffs_type);
+  }
+
   /* Setup solvers */
 
   if (mg->subtype == CS_MULTIGRID_BOTTOM)
@@ -4541,6 +5213,11 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
   mg->p0p1_relax = 0.;
   mg->k_cycle_threshold = 0;
 
+  mg->reuse_max = 0;
+  mg->reuse_rebuild_ratio = 1.5;
+
+  mg->coarse_lu_n_g_rows_max = 0;
+
   _multigrid_info_init(&(mg->info));
   for (int i = 0; i < 3; i++)
     mg->lv_mg[i] = nullptr;
@@ -4575,6 +5252,15 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
 
   mg->setup_data = nullptr;
 
+  mg->n_reuse_grids = 0;
+  mg->reuse_grids = nullptr;
+  for (int i = 0; i < 3; i++)
+    mg->reuse_f_size[i] = 0;
+  mg->n_reuse = 0;
+  mg->n_reuse_tot = 0;
+  mg->reuse_n_cycles = 0;
+  mg->reuse_n_cycles_ref = 0;
+
   BFT_MALLOC(mg->lv_info, mg->n_levels_max, cs_multigrid_level_info_t);
 
   for (ii = 0; ii < mg->n_levels_max; ii++)
@@ -4632,6 +5318,8 @@ cs_multigrid_destroy(void  **context)
   if (mg == nullptr)
     return;
 
+  _reuse_grids_free(mg);
+
   BFT_FREE(mg->lv_info);
 
   if (mg->post_row_num != nullptr) {
@@ -4915,6 +5603,7 @@ cs_multigrid_set_solver_options(cs_multigrid_t     *mg,
     case CS_SLES_JACOBI:
     case CS_SLES_P_GAUSS_SEIDEL:
     case CS_SLES_P_SYM_GAUSS_SEIDEL:
+    case CS_SLES_CHEBYSHEV:
       info->poly_degree[i] = -1;
       break;
     default:
@@ -4982,6 +5671,7 @@ cs_multigrid_set_solver_options_d(cs_multigrid_t     *mg,
     case CS_SLES_JACOBI:
     case CS_SLES_P_GAUSS_SEIDEL:
     case CS_SLES_P_SYM_GAUSS_SEIDEL:
+    case CS_SLES_CHEBYSHEV:
       info->poly_degree[i+3] = -1;
       break;
     default:
@@ -5011,6 +5701,112 @@ cs_multigrid_set_max_cycles(cs_multigrid_t     *mg,
   info->n_max_cycles = n_max_cycles;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the floating-point type used to store coarse level
+ *        matrix coefficients.
+ *
+ * Storing coarse level coefficients in single precision (CS_FLOAT)
+ * halves the memory and bandwidth used by those coefficients, while
+ * the finest level, the residuals and all vectors remain in double
+ * precision, so the outer iteration is not affected.
+ *
+ * This currently only applies to scalar MSR coarse matrices on the host;
+ * other coarse matrices are kept in double precision.
+ *
+ * \param[in, out]  mg                  pointer to multigrid info and context
+ * \param[in]       coarse_coeffs_type  CS_DOUBLE (default) or CS_FLOAT
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_coeffs_type(cs_multigrid_t  *mg,
+                                    cs_datatype_t    coarse_coeffs_type)
+{
+  if (mg == nullptr)
+    return;
+
+  mg->info.coarse_coeffs_type = coarse_coeffs_type;
+
+  for (int i = 0; i < 3; i++)
+    cs_multigrid_set_coarse_coeffs_type(mg->lv_mg[i], coarse_coeffs_type);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set coarse grids aggregation reuse options.
+ *
+ * When active, the coarse grids of a given setup are kept when the
+ * solver's setup data is freed, and on the next setup, the existing
+ * aggregation and coarse matrix structures are reused, with only the
+ * coarse matrix coefficients being recomputed (Galerkin projection)
+ * from the new fine matrix.
+ *
+ * A full rebuild is done when the fine matrix structure changes, when
+ * the maximum number of successive reuses is reached, or when the
+ * number of cycles (or preconditioner applications) between two setups
+ * exceeds \p rebuild_ratio times the number observed after the last
+ * full build.
+ *
+ * Reuse only applies to coarse levels whose coefficients are built
+ * directly from the parent MSR matrix (i.e. with no P0/P1 relaxation
+ * or rank merging); other levels are always rebuilt.
+ *
+ * \param[in, out]  mg             pointer to multigrid info and context
+ * \param[in]       max_reuse      maximum number of successive setups
+ *                                 reusing a given aggregation
+ *                                 (0: no reuse (default), < 0: unlimited)
+ * \param[in]       rebuild_ratio  cycles ratio above which a rebuild
+ *                                 is forced (ignored if <= 0)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_aggregation_reuse(cs_multigrid_t  *mg,
+                                   int              max_reuse,
+                                   double           rebuild_ratio)
+{
+  if (mg == nullptr)
+    return;
+
+  mg->reuse_max = max_reuse;
+  mg->reuse_rebuild_ratio = rebuild_ratio;
+
+  if (max_reuse == 0)
+    _reuse_grids_free(mg);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid coarsest level direct solve parameters.
+ *
+ * When the global number of (scalar) rows of the coarsest grid is
+ * lower or equal to \p n_g_rows_max, the coarsest grid matrix is
+ * gathered and replicated on all ranks of that grid, and factorized
+ * using a dense LU factorization at setup. Each coarse solve then
+ * only requires a gather of the right-hand side, replacing the
+ * reductions required by each iteration of the coarse iterative
+ * solver.
+ *
+ * This is ignored for coarse levels handled on an accelerator device.
+ *
+ * \param[in, out]  mg            pointer to multigrid info and context
+ * \param[in]       n_g_rows_max  maximum global number of coarsest
+ *                                grid rows for direct solve
+ *                                (0: not used (default))
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_direct_solve(cs_multigrid_t  *mg,
+                                     cs_gnum_t        n_g_rows_max)
+{
+  if (mg == nullptr)
+    return;
+
+  mg->coarse_lu_n_g_rows_max = n_g_rows_max;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Indicate if a multigrid solver requires an MSR matrix input.
@@ -5129,6 +5925,8 @@ cs_multigrid_setup_conv_diff(void               *context,
                                  a,
                                  conv_diff);
 
+  _reuse_grids_check(mg, f);
+
   cs_multigrid_level_info_t *mg_lv_info = mg->lv_info;
 
   cs_timer_t t1 = cs_timer_time();
@@ -5386,6 +6184,10 @@ cs_multigrid_solve(void                *context,
     mg_info->n_cycles[1] = n_cycles;
   }
 
+  /* Single cycle for preconditioning counted as one */
+
+  mg->reuse_n_cycles += CS_MAX(n_cycles, 1);
+
   /* Update number of resolutions and timing data */
 
   mg_info->n_calls[1] += 1;
@@ -5445,9 +6247,35 @@ cs_multigrid_free(void  *context)
     }
     BFT_FREE(mgd->sles_hierarchy);
 
-    /* Destroy grid hierarchy */
+    /* Destroy grid hierarchy, keeping coarse grids if
+       aggregation reuse is active (the finest grid is based
+       on the caller's matrix, so it is always destroyed) */
+
+    int n_lv_destroy = mgd->n_levels;
+
+    if (mg->reuse_max != 0 && mgd->n_levels > 1) {
+      _reuse_grids_free(mg);
+      mg->n_reuse_grids = mgd->n_levels;
+      BFT_MALLOC(mg->reuse_grids, mg->n_reuse_grids, cs_grid_t *);
+      mg->reuse_grids[0] = nullptr;
+      for (unsigned i = 1; i < mgd->n_levels; i++) {
+        mg->reuse_grids[i] = mgd->grid_hierarchy[i];
+        mgd->grid_hierarchy[i] = nullptr;
+      }
+      cs_grid_get_info(mgd->grid_hierarchy[0],
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       nullptr,
+                       mg->reuse_f_size,
+                       mg->reuse_f_size + 1,
+                       mg->reuse_f_size + 2,
+                       nullptr);
+      n_lv_destroy = 1;
+    }
 
-    for (int i = mgd->n_levels - 1; i > -1; i--)
+    for (int i = n_lv_destroy - 1; i > -1; i--)
       cs_grid_destroy(mgd->grid_hierarchy + i);
     BFT_FREE(mgd->grid_hierarchy);
 
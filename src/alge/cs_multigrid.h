@@ -313,6 +313,87 @@ void
 cs_multigrid_set_max_cycles(cs_multigrid_t     *mg,
                             int                 n_max_cycles);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the floating-point type used to store coarse level
+ *        matrix coefficients.
+ *
+ * Storing coarse level coefficients in single precision (CS_FLOAT)
+ * halves the memory and bandwidth used by those coefficients, while
+ * the finest level, the residuals and all vectors remain in double
+ * precision, so the outer iteration is not affected.
+ *
+ * This currently only applies to scalar MSR coarse matrices on the host;
+ * other coarse matrices are kept in double precision.
+ *
+ * \param[in, out]  mg                  pointer to multigrid info and context
+ * \param[in]       coarse_coeffs_type  CS_DOUBLE (default) or CS_FLOAT
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_coeffs_type(cs_multigrid_t  *mg,
+                                    cs_datatype_t    coarse_coeffs_type);
+
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Set coarse grids aggregation reuse options.
+ *
+ * When active, the coarse grids of a given setup are kept when the
+ * solver's setup data is freed, and on the next setup, the existing
+ * aggregation and coarse matrix structures are reused, with only the
+ * coarse matrix coefficients being recomputed (Galerkin projection)
+ * from the new fine matrix.
+ *
+ * A full rebuild is done when the fine matrix structure changes, when
+ * the maximum number of successive reuses is reached, or when the
+ * number of cycles (or preconditioner applications) between two setups
+ * exceeds \p rebuild_ratio times the number observed after the last
+ * full build.
+ *
+ * Reuse only applies to coarse levels whose coefficients are built
+ * directly from the parent MSR matrix (i.e. with no P0/P1 relaxation
+ * or rank merging); other levels are always rebuilt.
+ *
+ * \param[in, out]  mg             pointer to multigrid info and context
+ * \param[in]       max_reuse      maximum number of successive setups
+ *                                 reusing a given aggregation
+ *                                 (0: no reuse (default), < 0: unlimited)
+ * \param[in]       rebuild_ratio  cycles ratio above which a rebuild
+ *                                 is forced (ignored if <= 0)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_aggregation_reuse(cs_multigrid_t  *mg,
+                                   int              max_reuse,
+                                   double           rebuild_ratio);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid coarsest level direct solve parameters.
+ *
+ * When the global number of (scalar) rows of the coarsest grid is
+ * lower or equal to \p n_g_rows_max, the coarsest grid matrix is
+ * gathered and replicated on all ranks of that grid, and factorized
+ * using a dense LU factorization at setup. Each coarse solve then
+ * only requires a gather of the right-hand side, replacing the
+ * reductions required by each iteration of the coarse iterative
+ * solver.
+ *
+ * This is ignored for coarse levels handled on an accelerator device.
+ *
+ * \param[in, out]  mg            pointer to multigrid info and context
+ * \param[in]       n_g_rows_max  maximum global number of coarsest
+ *                                grid rows for direct solve
+ *                                (0: not used (default))
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_coarse_direct_solve(cs_multigrid_t  *mg,
+                                     cs_gnum_t        n_g_rows_max);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief Indicate if a multigrid solver requires an MSR matrix input.
@@ -105,6 +105,13 @@ static int _thread_debug = 0;
 
 static cs_lnum_t _pcg_sr_threshold = 512;
 
+/* Chebyshev smoother: number of power iterations for the eigenvalue
+   estimate, and smoothing interval bounds relative to that estimate */
+
+static int _chebyshev_n_power_iter = 10;
+static double _chebyshev_ev_lower_ratio = 0.3;
+static double _chebyshev_ev_upper_ratio = 1.1;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -1310,6 +1317,38 @@ _block_jacobi(cs_sles_it_t              *c,
   return CS_SLES_MAX_ITERATION;
 }
 
+END_C_DECLS /* templates require C++ linkage */
+
+/*----------------------------------------------------------------------------
+ * Get arrays describing an MSR matrix, with extra-diagonal values
+ * in double precision.
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_get_msr_arrays(const cs_matrix_t   *a,
+                const cs_lnum_t    **row_index,
+                const cs_lnum_t    **col_id,
+                const cs_real_t    **d_val,
+                const cs_real_t    **x_val)
+{
+  cs_matrix_get_msr_arrays(a, row_index, col_id, d_val, x_val);
+}
+
+/*----------------------------------------------------------------------------
+ * Get arrays describing an MSR matrix, with extra-diagonal values
+ * in single precision.
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_get_msr_arrays(const cs_matrix_t   *a,
+                const cs_lnum_t    **row_index,
+                const cs_lnum_t    **col_id,
+                const cs_real_t    **d_val,
+                const float        **x_val)
+{
+  cs_matrix_get_msr_arrays_f(a, row_index, col_id, d_val, x_val);
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Process-local Gauss-Seidel.
  *
@@ -1329,6 +1368,7 @@ _block_jacobi(cs_sles_it_t              *c,
  *   convergence state
  *----------------------------------------------------------------------------*/
 
+template <typename T>
 static cs_sles_convergence_state_t
 _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
                             const cs_matrix_t         *a,
@@ -1345,11 +1385,12 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
   const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
 
   const cs_lnum_t  *a_row_index, *a_col_id;
-  const cs_real_t  *a_d_val, *a_x_val;
+  const cs_real_t  *a_d_val;
+  const T          *a_x_val;
 
   const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
 
-  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  _get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
 
   const cs_lnum_t  *order = c->add_data->order;
 
@@ -1380,7 +1421,7 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
         cs_lnum_t ii = order[ll];
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0 = rhs[ii];
@@ -1404,7 +1445,7 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
         cs_lnum_t ii = order[ll];
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -1454,6 +1495,7 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
  *   convergence state
  *----------------------------------------------------------------------------*/
 
+template <typename T>
 static cs_sles_convergence_state_t
 _p_gauss_seidel_msr(cs_sles_it_t              *c,
                     const cs_matrix_t         *a,
@@ -1470,10 +1512,11 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
   const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
 
   const cs_lnum_t  *a_row_index, *a_col_id;
-  const cs_real_t  *a_d_val, *a_x_val;
+  const cs_real_t  *a_d_val;
+  const T          *a_x_val;
 
   const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
-  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  _get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
 
   /* Current iteration */
   /*-------------------*/
@@ -1500,7 +1543,7 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0 = rhs[ii];
@@ -1522,7 +1565,7 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -1575,6 +1618,7 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
  *   convergence state
  *----------------------------------------------------------------------------*/
 
+template <typename T>
 static cs_sles_convergence_state_t
 _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
                         const cs_matrix_t         *a,
@@ -1591,7 +1635,8 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
 
   /* Check matrix storage type */
 
-  if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+  if (   cs_matrix_get_type(a) != CS_MATRIX_MSR
+      && cs_matrix_get_type(a) != CS_MATRIX_SELL)
     bft_error
       (__FILE__, __LINE__, 0,
        _("Symmetric Gauss-Seidel Jacobi hybrid solver only supported with a\n"
@@ -1605,10 +1650,11 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
   const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
 
   const cs_lnum_t  *a_row_index, *a_col_id;
-  const cs_real_t  *a_d_val, *a_x_val;
+  const cs_real_t  *a_d_val;
+  const T          *a_x_val;
 
   const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
-  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  _get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
 
   /* Current iteration */
   /*-------------------*/
@@ -1635,7 +1681,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0 = rhs[ii];
@@ -1656,7 +1702,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -1694,7 +1740,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = n_rows - 1; ii > - 1; ii--) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0 = rhs[ii];
@@ -1716,7 +1762,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = n_rows - 1; ii > - 1; ii--) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -1770,6 +1816,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
  *   convergence state
  *----------------------------------------------------------------------------*/
 
+template <typename T>
 static cs_sles_convergence_state_t
 _ts_f_gauss_seidel_msr(cs_sles_it_t                *c,
                        const cs_matrix_t           *a,
@@ -1790,10 +1837,11 @@ _ts_f_gauss_seidel_msr(cs_sles_it_t                *c,
   const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
 
   const cs_lnum_t  *a_row_index, *a_col_id;
-  const cs_real_t  *a_d_val, *a_x_val;
+  const cs_real_t  *a_d_val;
+  const T          *a_x_val;
 
   const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
-  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  _get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
 
   /* Single iteration */
   /*------------------*/
@@ -1814,7 +1862,7 @@ _ts_f_gauss_seidel_msr(cs_sles_it_t                *c,
     for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
       const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-      const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+      const T *restrict m_row = a_x_val + a_row_index[ii];
       const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
       cs_real_t vx0 = rhs[ii];
@@ -1838,7 +1886,7 @@ _ts_f_gauss_seidel_msr(cs_sles_it_t                *c,
     for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
       const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-      const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+      const T *restrict m_row = a_x_val + a_row_index[ii];
       const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
       cs_real_t vx0[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -1893,6 +1941,7 @@ _ts_f_gauss_seidel_msr(cs_sles_it_t                *c,
  *   convergence state
  *----------------------------------------------------------------------------*/
 
+template <typename T>
 static cs_sles_convergence_state_t
 _ts_b_gauss_seidel_msr(cs_sles_it_t              *c,
                        const cs_matrix_t         *a,
@@ -1913,10 +1962,11 @@ _ts_b_gauss_seidel_msr(cs_sles_it_t              *c,
   const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
 
   const cs_lnum_t  *a_row_index, *a_col_id;
-  const cs_real_t  *a_d_val, *a_x_val;
+  const cs_real_t  *a_d_val;
+  const T          *a_x_val;
 
   const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
-  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  _get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
 
   /* Single iteration */
   /*------------------*/
@@ -1937,7 +1987,7 @@ _ts_b_gauss_seidel_msr(cs_sles_it_t              *c,
     for (cs_lnum_t ii = n_rows - 1; ii > - 1; ii--) {
 
       const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-      const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+      const T *restrict m_row = a_x_val + a_row_index[ii];
       const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
       cs_real_t vx0 = rhs[ii];
@@ -1961,7 +2011,7 @@ _ts_b_gauss_seidel_msr(cs_sles_it_t              *c,
     for (cs_lnum_t ii = n_rows - 1; ii > - 1; ii--) {
 
       const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-      const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+      const T *restrict m_row = a_x_val + a_row_index[ii];
       const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
       cs_real_t vx0[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -1994,6 +2044,8 @@ _ts_b_gauss_seidel_msr(cs_sles_it_t              *c,
   return CS_SLES_MAX_ITERATION;
 }
 
+BEGIN_C_DECLS
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Process-local symmetric Gauss-Seidel.
  *
@@ -2033,7 +2085,8 @@ _p_gauss_seidel(cs_sles_it_t              *c,
 
   /* Check matrix storage type */
 
-  if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+  if (   cs_matrix_get_type(a) != CS_MATRIX_MSR
+      && cs_matrix_get_type(a) != CS_MATRIX_SELL)
     bft_error
       (__FILE__, __LINE__, 0,
        _("Gauss-Seidel Jacobi hybrid solver only supported with a\n"
@@ -2052,27 +2105,246 @@ _p_gauss_seidel(cs_sles_it_t              *c,
   if (c->add_data != NULL)
     order = c->add_data->order;
 
-  if (order != NULL)
-    cvg = _p_ordered_gauss_seidel_msr(c,
-                                      a,
-                                      diag_block_size,
-                                      convergence,
-                                      rhs,
-                                      vx_ini,
-                                      vx);
-
-  else
-    cvg = _p_gauss_seidel_msr(c,
-                              a,
-                              diag_block_size,
-                              convergence,
-                              rhs,
-                              vx_ini,
-                              vx);
+  const cs_datatype_t coeffs_type = cs_matrix_get_coefficients_type(a);
+
+  if (order != NULL) {
+    if (coeffs_type == CS_FLOAT)
+      cvg = _p_ordered_gauss_seidel_msr<float>(c, a, diag_block_size,
+                                               convergence, rhs, vx_ini, vx);
+    else
+      cvg = _p_ordered_gauss_seidel_msr<cs_real_t>(c, a, diag_block_size,
+                                                   convergence,
+                                                   rhs, vx_ini, vx);
+  }
+
+  else {
+    if (coeffs_type == CS_FLOAT)
+      cvg = _p_gauss_seidel_msr<float>(c, a, diag_block_size,
+                                       convergence, rhs, vx_ini, vx);
+    else
+      cvg = _p_gauss_seidel_msr<cs_real_t>(c, a, diag_block_size,
+                                           convergence, rhs, vx_ini, vx);
+  }
 
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Estimate eigenvalue bounds of D^-1.A for the Chebyshev smoother.
+ *
+ * The largest eigenvalue is estimated using a few power iterations
+ * (with a Rayleigh quotient in the D-norm), and the smoothing interval
+ * is based on this estimate.
+ *
+ * parameters:
+ *   c          <-> pointer to solver context info
+ *   a          <-- matrix
+ *   verbosity  <-- associated verbosity
+ *----------------------------------------------------------------------------*/
+
+static void
+_chebyshev_setup(cs_sles_it_t       *c,
+                 const cs_matrix_t  *a,
+                 int                 verbosity)
+{
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  cs_real_t *v, *w;
+  BFT_MALLOC(v, n_cols, cs_real_t);
+  BFT_MALLOC(w, n_cols, cs_real_t);
+
+  /* Non-smooth deterministic starting vector */
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    v[ii] = 1. + 0.5*sin((double)(ii+1));
+
+  double ev_max = 0.;
+
+  for (int iter = 0; iter < _chebyshev_n_power_iter; iter++) {
+
+    cs_matrix_vector_multiply(a, v, w);
+
+    /* Rayleigh quotient (v.A.v)/(v.D.v) */
+
+    double s0 = 0., s1 = 0.;
+
+#   pragma omp parallel for reduction(+:s0, s1) if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      s0 += v[ii]*w[ii];
+      s1 += v[ii]*v[ii]/ad_inv[ii];
+    }
+
+    double s[2] = {s0, s1};
+
+#if defined(HAVE_MPI)
+    if (c->comm != MPI_COMM_NULL)
+      MPI_Allreduce(MPI_IN_PLACE, s, 2, MPI_DOUBLE, MPI_SUM, c->comm);
+#endif
+
+    if (s[1] <= 0.)
+      break;
+
+    ev_max = s[0] / s[1];
+
+    /* Next iterate v = D^-1.A.v, scaled to unit D-norm of previous one */
+
+    const double scale = 1. / sqrt(s[1]);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      v[ii] = scale * ad_inv[ii] * w[ii];
+
+  }
+
+  BFT_FREE(w);
+  BFT_FREE(v);
+
+  /* The power method underestimates the largest eigenvalue, so add
+     a safety margin; smooth the upper part of the spectrum only. */
+
+  if (ev_max <= 0.)
+    ev_max = 1.;
+
+  c->setup_data->ev_bounds[0] = _chebyshev_ev_lower_ratio * ev_max;
+  c->setup_data->ev_bounds[1] = _chebyshev_ev_upper_ratio * ev_max;
+
+  if (verbosity > 1)
+    bft_printf(_("  Chebyshev smoother: estimated max. eigenvalue %11.4e\n"
+                 "    (smoothing interval: [%11.4e, %11.4e])\n"),
+               ev_max,
+               c->setup_data->ev_bounds[0], c->setup_data->ev_bounds[1]);
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using a Jacobi-preconditioned Chebyshev
+ * polynomial smoother.
+ *
+ * The number of iterations is the polynomial degree; only matrix.vector
+ * products and vector updates are used, with no global reduction.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size (unused here)
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_chebyshev(cs_sles_it_t              *c,
+           const cs_matrix_t         *a,
+           cs_lnum_t                  diag_block_size,
+           cs_sles_it_convergence_t  *convergence,
+           const cs_real_t           *rhs,
+           cs_real_t                 *restrict vx_ini,
+           cs_real_t                 *restrict vx,
+           size_t                     aux_size,
+           void                      *aux_vectors)
+{
+  cs_real_t *_aux_vectors;
+  cs_real_t *restrict rk, *restrict dk, *restrict wk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 3;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = (cs_real_t *)aux_vectors;
+
+    rk = _aux_vectors;
+    dk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+  }
+
+  const double l_min = c->setup_data->ev_bounds[0];
+  const double l_max = c->setup_data->ev_bounds[1];
+  const double theta = 0.5*(l_max + l_min);
+  const double delta = 0.5*(l_max - l_min);
+  const double sigma = theta / delta;
+
+  double rho = 1./sigma;
+
+  /* Initialize residual and first update */
+  /*--------------------------------------*/
+
+  const cs_real_t theta_inv = 1./theta;
+
+  if (vx_ini == vx) {
+    cs_matrix_vector_multiply(a, vx, rk);  /* rk = A.x0 */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      rk[ii] = rhs[ii] - rk[ii];
+      dk[ii] = theta_inv * ad_inv[ii] * rk[ii];
+      vx[ii] += dk[ii];
+    }
+  }
+  else {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      rk[ii] = rhs[ii];
+      dk[ii] = theta_inv * ad_inv[ii] * rhs[ii];
+      vx[ii] = dk[ii];
+    }
+  }
+
+  /* Current iteration */
+  /*-------------------*/
+
+  for (n_iter = 1; n_iter < convergence->n_iterations_max; n_iter++) {
+
+    cs_matrix_vector_multiply(a, dk, wk);
+
+    const double rho_n = 1. / (2.*sigma - rho);
+    const cs_real_t c1 = rho_n * rho;
+    const cs_real_t c2 = 2. * rho_n / delta;
+    rho = rho_n;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      rk[ii] -= wk[ii];
+      dk[ii] = c1 * dk[ii] + c2 * ad_inv[ii] * rk[ii];
+      vx[ii] += dk[ii];
+    }
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  convergence->n_iterations = n_iter;
+
+  return CS_SLES_MAX_ITERATION;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -2125,6 +2397,7 @@ cs_multigrid_smoother_create(cs_sles_it_type_t    smoother_type,
   case CS_SLES_P_SYM_GAUSS_SEIDEL:
   case CS_SLES_TS_F_GAUSS_SEIDEL:
   case CS_SLES_TS_B_GAUSS_SEIDEL:
+  case CS_SLES_CHEBYSHEV:
     break;
 
   case CS_SLES_PCG:
@@ -2233,7 +2506,8 @@ cs_multigrid_smoother_setup(void               *context,
       || (   c->type >= CS_SLES_P_GAUSS_SEIDEL
           && c->type <= CS_SLES_P_SYM_GAUSS_SEIDEL)) {
     /* Force to Jacobi in case matrix type is not adapted */
-    if (cs_matrix_get_type(a) != CS_MATRIX_MSR) {
+    if (   cs_matrix_get_type(a) != CS_MATRIX_MSR
+        && cs_matrix_get_type(a) != CS_MATRIX_SELL) {
       c->type = CS_SLES_JACOBI;
     }
     block_nn_inverse = true;
@@ -2242,13 +2516,21 @@ cs_multigrid_smoother_setup(void               *context,
   else if (   c->type == CS_SLES_TS_F_GAUSS_SEIDEL
            || c->type == CS_SLES_TS_B_GAUSS_SEIDEL) {
     /* Force to closest Jacobi type in case matrix type is not adapted */
-    if (cs_matrix_get_type(a) != CS_MATRIX_MSR) {
+    if (   cs_matrix_get_type(a) != CS_MATRIX_MSR
+        && cs_matrix_get_type(a) != CS_MATRIX_SELL) {
       c->type = CS_SLES_JACOBI;
       c->n_max_iter = 2;
     }
     block_nn_inverse = true;
   }
 
+  else if (c->type == CS_SLES_CHEBYSHEV) {
+    /* Only scalar diagonal scaling is handled */
+    if (diag_block_size > 1)
+      c->type = CS_SLES_JACOBI;
+    block_nn_inverse = true;
+  }
+
   switch (c->type) {
 
   case CS_SLES_PCG:
@@ -2330,14 +2612,33 @@ cs_multigrid_smoother_setup(void               *context,
     c->solve = _p_gauss_seidel;
     break;
   case CS_SLES_P_SYM_GAUSS_SEIDEL:
-    c->solve = _p_sym_gauss_seidel_msr;
+    if (cs_matrix_get_coefficients_type(a) == CS_FLOAT)
+      c->solve = _p_sym_gauss_seidel_msr<float>;
+    else
+      c->solve = _p_sym_gauss_seidel_msr<cs_real_t>;
     break;
 
   case CS_SLES_TS_F_GAUSS_SEIDEL:
-    c->solve = _ts_f_gauss_seidel_msr;
+    if (cs_matrix_get_coefficients_type(a) == CS_FLOAT)
+      c->solve = _ts_f_gauss_seidel_msr<float>;
+    else
+      c->solve = _ts_f_gauss_seidel_msr<cs_real_t>;
     break;
   case CS_SLES_TS_B_GAUSS_SEIDEL:
-    c->solve = _ts_b_gauss_seidel_msr;
+    if (cs_matrix_get_coefficients_type(a) == CS_FLOAT)
+      c->solve = _ts_b_gauss_seidel_msr<float>;
+    else
+      c->solve = _ts_b_gauss_seidel_msr<cs_real_t>;
+    break;
+
+  case CS_SLES_CHEBYSHEV:
+    c->solve = _chebyshev;
+#if defined(HAVE_CUDA)
+    if (on_device) {
+      c->on_device = true;
+      c->solve = cs_sles_it_cuda_chebyshev;
+    }
+#endif
     break;
 
   default:
@@ -2354,6 +2655,9 @@ cs_multigrid_smoother_setup(void               *context,
   cs_sles_it_setup_priv(c, name, a, verbosity, diag_block_size,
                         block_nn_inverse);
 
+  if (c->type == CS_SLES_CHEBYSHEV)
+    _chebyshev_setup(c, a, verbosity);
+
   /* Now finish */
   assert(c->update_stats == false);
 }
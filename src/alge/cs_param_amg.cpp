@@ -438,6 +438,8 @@ cs_param_amg_inhouse_create(bool  used_as_solver,
   amgp->coarse_poly_degree = 0;
   amgp->coarse_solver = CS_PARAM_AMG_INHOUSE_CG;
 
+  amgp->coarse_single_prec = false;
+
   /* Down smoother options */
 
   amgp->down_poly_degree = 0;
@@ -533,6 +535,7 @@ cs_param_amg_inhouse_copy(const cs_param_amg_inhouse_t  *amgp)
   cpy->coarse_max_iter = amgp->coarse_max_iter;
   cpy->coarse_poly_degree = amgp->coarse_poly_degree;
   cpy->coarse_rtol_mult = amgp->coarse_rtol_mult;
+  cpy->coarse_single_prec = amgp->coarse_single_prec;
 
   cpy->n_down_iter = amgp->n_down_iter;
   cpy->down_smoother = amgp->down_smoother;
@@ -660,6 +663,8 @@ cs_param_amg_inhouse_log(const char                    *name,
                 prefix, amgp->p0p1_relax);
   cs_log_printf(CS_LOG_SETUP, "%s   aggregation_limit:      %d\n",
                 prefix, amgp->aggreg_limit);
+  cs_log_printf(CS_LOG_SETUP, "%s   coarse_precision:       %s\n",
+                prefix, (amgp->coarse_single_prec) ? "single" : "double");
 
   BFT_FREE(prefix);
 }
@@ -258,6 +258,10 @@ typedef struct {
   cs_param_amg_inhouse_solver_t   coarse_solver;
   int                             coarse_poly_degree;
 
+  /* Storage of coarse level matrices */
+
+  bool                            coarse_single_prec; /* advanced settings */
+
 } cs_param_amg_inhouse_t;
 
 /*============================================================================
@@ -639,6 +639,9 @@ cs_param_saddle_create(void)
     .dtol       = 1e3,   /* divergence tolerance */
     .n_max_iter = 100,
   };
+
+  saddlep->block21_matrix_free = false; /* stored (2,1)-block by default */
+
   /* saddlep->block11_sles_param is shared and thus is only set if a
      saddle-point problem is solved */
 
@@ -924,6 +927,29 @@ cs_param_saddle_set_precond(const char          *keyval,
     if (saddlep->schur_approx == CS_PARAM_SADDLE_SCHUR_NONE)
       saddlep->schur_approx = CS_PARAM_SADDLE_SCHUR_MASS_SCALED;
 
+  }
+  else if (strcmp(keyval, "simple") == 0) {
+
+    saddlep->precond = CS_PARAM_SADDLE_PRECOND_SIMPLE;
+
+    /* The velocity update relies on the inverse of the diagonal of the
+       (1,1)-block, which is only available with these approximations */
+
+    switch (saddlep->schur_approx) {
+
+    case CS_PARAM_SADDLE_SCHUR_DIAG_INVERSE:
+    case CS_PARAM_SADDLE_SCHUR_LUMPED_INVERSE:
+    case CS_PARAM_SADDLE_SCHUR_MASS_SCALED_DIAG_INVERSE:
+    case CS_PARAM_SADDLE_SCHUR_MASS_SCALED_LUMPED_INVERSE:
+      break;
+
+    default:
+      saddlep->schur_approx = CS_PARAM_SADDLE_SCHUR_DIAG_INVERSE;
+      _init_schur_slesp(saddlep);
+      break;
+
+    }
+
   }
   else
     return ierr;
@@ -1321,6 +1347,8 @@ cs_param_saddle_copy(const cs_param_saddle_t  *ref,
   dest->cvg_param.dtol = ref->cvg_param.dtol;
   dest->cvg_param.n_max_iter = ref->cvg_param.n_max_iter;
 
+  dest->block21_matrix_free = ref->block21_matrix_free;
+
   /* Shared pointer */
 
   dest->block11_sles_param = ref->block11_sles_param;
@@ -1587,6 +1615,11 @@ cs_param_saddle_log(const cs_param_saddle_t  *saddlep)
     cs_log_printf(CS_LOG_SETUP, "%s Precond: Uzawa-like\n", prefix);
     break;
 
+  case CS_PARAM_SADDLE_PRECOND_SIMPLE:
+    cs_log_printf(CS_LOG_SETUP, "%s Precond: SIMPLE-like block LDU\n",
+                  prefix);
+    break;
+
   default:
     cs_log_printf(CS_LOG_SETUP, "%s Precond: Undefined\n", prefix);
     break;
@@ -1607,6 +1640,9 @@ cs_param_saddle_log(const cs_param_saddle_t  *saddlep)
 
   }
 
+  cs_log_printf(CS_LOG_SETUP, "%s Matrix-free (2,1)-block: %s\n",
+                prefix, cs_base_strtf(saddlep->block21_matrix_free));
+
   /* Schur complement */
   /* ---------------- */
 
@@ -95,6 +95,12 @@ BEGIN_C_DECLS
  *
  * \var CS_PARAM_SADDLE_PRECOND_UZAWA
  * An Uzawa-like 2x2 block preconditioner. One needs a Schur approximation.
+ *
+ * \var CS_PARAM_SADDLE_PRECOND_SIMPLE
+ * A SIMPLE-like approximate block LDU factorization. The (1,1)-block is
+ * solved once as for the lower triangular preconditioner, then the velocity
+ * update relies on the inverse of the diagonal of the (1,1)-block. One needs
+ * a Schur approximation based on this diagonal (diagonal or lumped inverse).
  */
 
 typedef enum {
@@ -105,6 +111,7 @@ typedef enum {
   CS_PARAM_SADDLE_PRECOND_SGS,
   CS_PARAM_SADDLE_PRECOND_UPPER,
   CS_PARAM_SADDLE_PRECOND_UZAWA,
+  CS_PARAM_SADDLE_PRECOND_SIMPLE,
 
   CS_PARAM_SADDLE_N_PRECOND
 
@@ -327,6 +334,14 @@ typedef struct {
 
   cs_param_convergence_t      cvg_param;
 
+  /*! \var block21_matrix_free
+   *  If true, the (2,1)- and (1,2)-blocks are not stored but applied on the
+   *  fly from the mesh connectivities and quantities when this is possible
+   *  for the given solver (false by default).
+   */
+
+  bool                        block21_matrix_free;
+
   /*! @} */
 
   /*! \var block11_sles_param
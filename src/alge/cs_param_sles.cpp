@@ -1475,6 +1475,34 @@ cs_param_sles_amg_inhouse_advanced(cs_param_sles_t  *slesp,
     amgp->coarse_rtol_mult = coarse_rtol_mult;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the precision used to store the coarse level matrices of the
+ *        in-house AMG (advanced setting).
+ *
+ * Using single precision halves the memory footprint and bandwidth of the
+ * coarse level matrix coefficients; the finest level and the outer
+ * iterations remain in double precision.
+ *
+ * \param[in, out] slesp        pointer to a cs_param_sles_t structure
+ * \param[in]      single_prec  true to use single precision on coarse levels
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_param_sles_amg_inhouse_coarse_precision(cs_param_sles_t  *slesp,
+                                           bool              single_prec)
+{
+  if (slesp == nullptr)
+    return;
+
+  assert(slesp->context_param != nullptr);
+  cs_param_amg_inhouse_t *amgp =
+    static_cast<cs_param_amg_inhouse_t *>(slesp->context_param);
+
+  amgp->coarse_single_prec = single_prec;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Allocate and initialize a new context structure for the boomerAMG
@@ -348,6 +348,24 @@ cs_param_sles_amg_inhouse_advanced(cs_param_sles_t  *slesp,
                                    int               coarse_max_iter,
                                    double            coarse_rtol_mult);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the precision used to store the coarse level matrices of the
+ *        in-house AMG (advanced setting).
+ *
+ * Using single precision halves the memory footprint and bandwidth of the
+ * coarse level matrix coefficients; the finest level and the outer
+ * iterations remain in double precision.
+ *
+ * \param[in, out] slesp        pointer to a cs_param_sles_t structure
+ * \param[in]      single_prec  true to use single precision on coarse levels
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_param_sles_amg_inhouse_coarse_precision(cs_param_sles_t  *slesp,
+                                           bool              single_prec);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Allocate and initialize a new context structure for the boomerAMG
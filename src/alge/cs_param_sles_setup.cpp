@@ -1853,6 +1853,9 @@ _set_saturne_amg_solver(const char             *sles_name,
                                       amgp->p0p1_relax,
                                       0);   /* postprocess */
 
+  if (amgp->coarse_single_prec)
+    cs_multigrid_set_coarse_coeffs_type(mg, CS_FLOAT);
+
   return mg;
 }
 
@@ -1934,6 +1937,9 @@ _set_saturne_amg_precond(const cs_param_sles_t  *slesp,
                                       amgp->min_n_g_rows,
                                       amgp->p0p1_relax,
                                       0);   /* postprocess */
+
+  if (amgp->coarse_single_prec)
+    cs_multigrid_set_coarse_coeffs_type(mg, CS_FLOAT);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -53,8 +53,10 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_array.h"
+#include "cs_base_accel.h"
 #include "cs_blas.h"
 #include "cs_cdo_solve.h"
+#include "cs_dispatch.h"
 #include "cs_log.h"
 #include "cs_parameters.h"
 #include "cs_saddle_system.h"
@@ -153,6 +155,31 @@ _get_id(int  m,
   return j + i*m - (i*(i + 1))/2;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Run a dispatch context on the host if one of the given arrays is
+ *        not accessible from the device
+ *
+ * \param[in]      n_arrays  number of arrays to check
+ * \param[in]      arrays    list of arrays (nullptr entries are skipped)
+ * \param[in, out] dctx      dispatch context to update
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_set_dispatch_location(int                   n_arrays,
+                       const void           *arrays[],
+                       cs_dispatch_context  &dctx)
+{
+  for (int i = 0; i < n_arrays; i++) {
+    if (   arrays[i] != nullptr
+        && cs_check_device_ptr(arrays[i]) == CS_ALLOC_HOST) {
+      dctx.set_use_gpu(false);
+      return;
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute the scalar multiplication of a vector split into the x1 and
@@ -1478,6 +1505,120 @@ _uza_schur_pc_apply(cs_saddle_solver_t                   *solver,
   return n_iter;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply a SIMPLE-like approximate block LDU factorization.
+ *        Compute z such that P_simple z = r
+ *
+ *        This is the symmetric Gauss-Seidel block preconditioner where the
+ *        second solve with the (1,1)-block is replaced by the inverse of its
+ *        diagonal, so that only one solve of the (1,1)-block is needed.
+ *
+ *        This prototype complies with the cs_saddle_solver_pc_apply_t function
+ *        pointer
+ *
+ * \param[in]      solver  pointer to a saddle-point solver structure
+ * \param[in]      ctx     context pointer for block preconditioner
+ * \param[in]      r       rhs of the preconditioning system
+ * \param[in, out] z       array to compute
+ * \param[in, out] pc_wsp  work space related to the preconditioner
+ *
+ * \return the number of iterations performed for this step of preconditioning
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_simple_schur_pc_apply(cs_saddle_solver_t                   *solver,
+                       cs_saddle_solver_context_block_pcd_t *ctx,
+                       cs_real_t                            *r,
+                       cs_real_t                            *z,
+                       cs_real_t                            *pc_wsp)
+{
+  if (z == nullptr)
+    return 0;
+
+  assert(solver != nullptr && ctx != nullptr && r != nullptr);
+  assert(pc_wsp != nullptr);
+  assert(ctx->m11_inv_diag != nullptr);
+
+  const cs_lnum_t  n2_elts = solver->n2_scatter_dofs;
+  const cs_range_set_t  *rset = ctx->b11_range_set;
+
+  /* 1. Solve m11 z1_hat = r1
+     ======================== */
+
+  int  n_iter = _solve_m11_approximation(solver, ctx,
+                                         r, true,  /* = scatter r */
+                                         z, true); /* = scatter z */
+
+  /* 2. Build r2_hat = m21.z1_hat - r2
+     ================================= */
+
+  cs_real_t  *r2_hat = pc_wsp + ctx->b11_max_size; /* x2_size */
+
+  ctx->m21_vector_multiply(n2_elts, z, ctx->m21_adj, ctx->m21_val,
+                           r2_hat);
+
+  const cs_real_t  *r2 = r + ctx->b11_max_size;
+
+# pragma omp parallel for if (n2_elts > CS_THR_MIN)
+  for (cs_lnum_t i2 = 0; i2 < n2_elts; i2++)
+    r2_hat[i2] = r2_hat[i2] - r2[i2];
+
+  /* 3. Solve S z2 = r2_hat (S -> Schur approximation for the m22 block)
+     =================================================================== */
+
+  cs_real_t  *z2 = z + ctx->b11_max_size;
+
+  n_iter += _solve_schur_approximation(solver,
+                                       ctx->schur_sles,
+                                       ctx->schur_matrix,
+                                       ctx->m22_mass_diag,  /* inv_m22 */
+                                       ctx->schur_scaling,
+                                       r2_hat,              /* r_schur */
+                                       z2);                 /* z_schur */
+
+  /* 4. Build w1 = m12.z2
+     ==================== */
+
+  cs_real_t  *w1 = pc_wsp; /* x1_size */
+
+  cs_array_real_fill_zero(ctx->b11_max_size, w1);
+  ctx->m12_vector_multiply(n2_elts, z2, ctx->m21_adj, ctx->m21_val, w1);
+
+  if (rset->ifs != nullptr)
+    cs_interface_set_sum(rset->ifs,
+                         solver->n1_scatter_dofs,
+                         1, false, CS_REAL_TYPE, /* stride, interlaced */
+                         w1);
+
+  /* 5. Update z1 = z1_hat - diag(m11)^-1.w1
+     ======================================= */
+
+  /* The inverse of the diagonal is stored in a gather view */
+
+  cs_range_set_gather(rset, CS_REAL_TYPE, 1, /* stride */
+                      w1,   /* in:  size=n1_scatter_elts */
+                      w1);  /* out: size=n1_gather_elts */
+  cs_range_set_gather(rset, CS_REAL_TYPE, 1, /* stride */
+                      z,    /* in:  size=n1_scatter_elts */
+                      z);   /* out: size=n1_gather_elts */
+
+  const cs_real_t  *m11_inv = ctx->m11_inv_diag;
+
+# pragma omp parallel for if (rset->n_elts[0] > CS_THR_MIN)
+  for (cs_lnum_t i1 = 0; i1 < rset->n_elts[0]; i1++)
+    z[i1] -= m11_inv[i1]*w1[i1];
+
+  /* Move back: gather --> scatter view */
+
+  cs_range_set_scatter(rset, CS_REAL_TYPE, 1, /* type and stride */
+                       z,
+                       z);
+
+  return n_iter;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Apply a block diagonal preconditioning: Compute z s.t. P_d z = r
@@ -1582,6 +1723,19 @@ _set_pc_by_block(const cs_saddle_solver_t                   *solver,
 
     return _uza_schur_pc_apply;
 
+  case CS_PARAM_SADDLE_PRECOND_SIMPLE:
+    if (ctx->m11_inv_diag == nullptr)
+      bft_error(__FILE__, __LINE__, 0,
+                "%s: The SIMPLE-like block preconditioner needs a Schur\n"
+                " approximation based on the diagonal of the (1,1)-block.\n"
+                " Please use a diagonal or lumped inverse approximation.",
+                __func__);
+
+    *wsp_size = ctx->b11_max_size + ctx->b22_max_size;
+    BFT_MALLOC(*p_wsp, *wsp_size, cs_real_t);
+
+    return _simple_schur_pc_apply;
+
   default:
     bft_error(__FILE__, __LINE__, 0,
               "%s: Invalid block preconditioner", __func__);
@@ -1742,6 +1896,36 @@ _gkb_block22_weighted_norm(const cs_lnum_t   n2_dofs,
   return sqrt(beta2);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define where the vector operations of the GKB algorithm are run.
+ *        The device is used only if all the arrays are accessible from it.
+ *
+ * \param[in]      solver  pointer to a saddle_point solver structure
+ * \param[in]      ctx     pointer to the GKB context structure
+ * \param[in]      x1      array for the first part
+ * \param[in]      x2      array for the second part
+ * \param[in, out] dctx    dispatch context to update
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_gkb_set_dispatch_location(const cs_saddle_solver_t              *solver,
+                           const cs_saddle_solver_context_gkb_t  *ctx,
+                           const cs_real_t                       *x1,
+                           const cs_real_t                       *x2,
+                           cs_dispatch_context                   &dctx)
+{
+  const cs_cdo_system_helper_t  *sh = solver->system_helper;
+
+  const void  *arrays[] = {x1, x2, sh->rhs_array[0], sh->rhs_array[1],
+                           ctx->q, ctx->d, ctx->m21v, ctx->inv_m22,
+                           ctx->w, ctx->v, ctx->m12q, ctx->x1_tilda,
+                           ctx->rhs_tilda};
+
+  _set_dispatch_location(13, arrays, dctx);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Transform the initial saddle-point problem. The x1 unknown is
@@ -1775,8 +1959,16 @@ _gkb_transform_system(cs_saddle_solver_t             *solver,
 
   /* Transformation of the initial saddle-point system or copy */
 
-  cs_real_t  *rhs1 = sh->rhs_array[0];
-  cs_real_t  *rhs2 = sh->rhs_array[1];
+  const cs_real_t  *rhs1 = sh->rhs_array[0];
+  const cs_real_t  *rhs2 = sh->rhs_array[1];
+
+  const cs_real_t  *inv_m22 = ctx->inv_m22;
+  cs_real_t  *q = ctx->q, *m12q = ctx->m12q, *m21v = ctx->m21v;
+  cs_real_t  *v = ctx->v, *x1_tilda = ctx->x1_tilda;
+  cs_real_t  *rhs_tilda = ctx->rhs_tilda;
+
+  cs_dispatch_context  dctx;
+  _gkb_set_dispatch_location(solver, ctx, x1, nullptr, dctx);
 
   /* Compute rhs_tilda = rhs1 + gamma.M12.M22^-1.rhs2 */
 
@@ -1784,21 +1976,27 @@ _gkb_transform_system(cs_saddle_solver_t             *solver,
 
     /* Store temporary inside q = gamma * rhs2 * inv_m22 */
 
-#   pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-    for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++)
-      ctx->q[i2] = rhs2[i2]*ctx->inv_m22[i2];
+    dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
+      q[i2] = rhs2[i2]*inv_m22[i2];
+    });
+
+    dctx.parallel_for(n1_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i1) {
+      m12q[i1] = 0.;
+    });
+
+    dctx.wait();
 
     /* Build m12q = M12.rhs_tilda */
 
-    cs_array_real_fill_zero(n1_dofs, ctx->m12q);
-    ctx->m12_vector_multiply(n2_dofs, ctx->q, ctx->m21_adj, ctx->m21_val,
-                             ctx->m12q);
+    ctx->m12_vector_multiply(n2_dofs, q, ctx->m21_adj, ctx->m21_val, m12q);
 
     /* RHS reduction is delayed */
 
-#   pragma omp parallel for if (n1_dofs > CS_THR_MIN)
-    for (cs_lnum_t i1 = 0; i1 < n1_dofs; i1++)
-      ctx->rhs_tilda[i1] = rhs1[i1] + gamma*ctx->m12q[i1];
+    dctx.parallel_for(n1_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i1) {
+      rhs_tilda[i1] = rhs1[i1] + gamma*m12q[i1];
+    });
+
+    dctx.wait();
 
   }
   else
@@ -1830,18 +2028,19 @@ _gkb_transform_system(cs_saddle_solver_t             *solver,
 
   /* Compute x1_tilda := x1 - v */
 
-# pragma omp parallel for if (n1_dofs > CS_THR_MIN)
-  for (cs_lnum_t i1 = 0; i1 < n1_dofs; i1++)
-    ctx->x1_tilda[i1] = x1[i1] - ctx->v[i1];
+  dctx.parallel_for(n1_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i1) {
+    x1_tilda[i1] = x1[i1] - v[i1];
+  });
 
   /* Compute rhs_tilda := rhs2 - M21.v */
 
-  ctx->m21_vector_multiply(n2_dofs, ctx->v, ctx->m21_adj, ctx->m21_val,
-                           ctx->m21v);
+  ctx->m21_vector_multiply(n2_dofs, v, ctx->m21_adj, ctx->m21_val, m21v);
 
-# pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++)
-    ctx->rhs_tilda[i2] = rhs2[i2] - ctx->m21v[i2];
+  dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
+    rhs_tilda[i2] = rhs2[i2] - m21v[i2];
+  });
+
+  dctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1869,6 +2068,13 @@ _gkb_init_solution(cs_saddle_solver_t             *solver,
   const cs_range_set_t  *rset = cs_cdo_system_get_range_set(sh, 0);
   const cs_matrix_t  *m11 = cs_cdo_system_get_matrix(sh, 0);
 
+  const cs_real_t  *inv_m22 = ctx->inv_m22;
+  cs_real_t  *q = ctx->q, *d = ctx->d, *w = ctx->w, *v = ctx->v;
+  cs_real_t  *x1_tilda = ctx->x1_tilda, *rhs_tilda = ctx->rhs_tilda;
+
+  cs_dispatch_context  dctx;
+  _gkb_set_dispatch_location(solver, ctx, nullptr, x2, dctx);
+
   /* Compute the two following quantities:
    *  beta := ||rhs_tilta||_{M22^-1}
    *  q := {M22^-1}(rhs_tilda)/beta */
@@ -1888,11 +2094,12 @@ _gkb_init_solution(cs_saddle_solver_t             *solver,
   else {
 
     const double  scaling = 1./ctx->beta;
-#   pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-    for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++)
-      ctx->q[i2] = scaling * ctx->rhs_tilda[i2] * ctx->inv_m22[i2];
+    dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
+      q[i2] = scaling * rhs_tilda[i2] * inv_m22[i2];
+    });
+    dctx.wait();
 
-    cs_array_real_copy(n1_dofs, ctx->v, ctx->rhs_tilda);
+    cs_array_real_copy(n1_dofs, v, rhs_tilda);
 
   }
 
@@ -1934,20 +2141,22 @@ _gkb_init_solution(cs_saddle_solver_t             *solver,
 
   ctx->zeta = ctx->beta * ov_alpha;
 
+  const double  zeta = ctx->zeta;
+
   /* Initialize auxiliary vectors and first update of the solution vectors */
 
-# pragma omp parallel for if (n1_dofs > CS_THR_MIN)
-  for (cs_lnum_t i1 = 0; i1 < n1_dofs; i1++) {
-    ctx->w[i1] *= ov_alpha; /* = M11.v */
-    ctx->v[i1] *= ov_alpha;
-    ctx->x1_tilda[i1] = ctx->zeta * ctx->v[i1];
-  }
+  dctx.parallel_for(n1_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i1) {
+    w[i1] *= ov_alpha; /* = M11.v */
+    v[i1] *= ov_alpha;
+    x1_tilda[i1] = zeta * v[i1];
+  });
 
-# pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++) {
-    ctx->d[i2] = ctx->q[i2] * ov_alpha;
-    x2[i2] = -ctx->zeta * ctx->d[i2];
-  }
+  dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
+    d[i2] = q[i2] * ov_alpha;
+    x2[i2] = -zeta * d[i2];
+  });
+
+  dctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2512,25 +2721,32 @@ cs_saddle_solver_m12_multiply_vector(cs_lnum_t              n2_dofs,
 {
   assert(n2_dofs == m21_adj->n_elts);
 
-# pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++) {
+  const cs_lnum_t  *adj_idx = m21_adj->idx;
+  const cs_lnum_t  *adj_ids = m21_adj->ids;
+
+  cs_dispatch_context  dctx;
+  const void  *arrays[] = {x2, adj_idx, adj_ids, m21_val, m12x2};
+  _set_dispatch_location(5, arrays, dctx);
+
+  const cs_dispatch_sum_type_t  sum_type = CS_DISPATCH_SUM_ATOMIC;
+
+  dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
 
     const cs_real_t  _x2 = x2[i2];
-    for (cs_lnum_t j = m21_adj->idx[i2]; j < m21_adj->idx[i2+1]; j++) {
+    for (cs_lnum_t j = adj_idx[i2]; j < adj_idx[i2+1]; j++) {
 
       const cs_real_t  *m21_vals = m21_val + 3*j;
-      cs_real_t  *_m12x2 = m12x2 + 3*m21_adj->ids[j];
+      const cs_real_t  contrib[3] = {m21_vals[0] * _x2,
+                                     m21_vals[1] * _x2,
+                                     m21_vals[2] * _x2};
 
-#     pragma omp critical
-      {
-        _m12x2[0] += m21_vals[0] * _x2;
-        _m12x2[1] += m21_vals[1] * _x2;
-        _m12x2[2] += m21_vals[2] * _x2;
-      }
+      cs_dispatch_sum<3>(m12x2 + 3*adj_ids[j], contrib, sum_type);
 
     } /* Loop on x1 elements associated to a given x2 DoF */
 
-  } /* Loop on x2 DoFs */
+  }); /* Loop on x2 DoFs */
+
+  dctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2559,15 +2775,24 @@ cs_saddle_solver_m12_multiply_scalar(cs_lnum_t              n2_elts,
 {
   assert(n2_elts == m21_adj->n_elts);
 
-# pragma omp parallel for if (n2_elts > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_elts; i2++) {
+  const cs_lnum_t  *adj_idx = m21_adj->idx;
+  const cs_lnum_t  *adj_ids = m21_adj->ids;
+
+  cs_dispatch_context  dctx;
+  const void  *arrays[] = {x2, adj_idx, adj_ids, m21_val, m12x2};
+  _set_dispatch_location(5, arrays, dctx);
+
+  const cs_dispatch_sum_type_t  sum_type = CS_DISPATCH_SUM_ATOMIC;
+
+  dctx.parallel_for(n2_elts, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
 
     const cs_real_t  _x2 = x2[i2];
-    for (cs_lnum_t j = m21_adj->idx[i2]; j < m21_adj->idx[i2+1]; j++)
-#     pragma omp atomic
-      m12x2[m21_adj->ids[j]] += _x2 * m21_val[j];
+    for (cs_lnum_t j = adj_idx[i2]; j < adj_idx[i2+1]; j++)
+      cs_dispatch_sum(m12x2 + adj_ids[j], _x2 * m21_val[j], sum_type);
 
-  } /* Loop on x2 DoFs */
+  }); /* Loop on x2 DoFs */
+
+  dctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2593,16 +2818,24 @@ cs_saddle_solver_m21_multiply_vector(cs_lnum_t              n2_dofs,
 {
   assert(n2_dofs == m21_adj->n_elts);
 
-# pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++) {
+  const cs_lnum_t  *adj_idx = m21_adj->idx;
+  const cs_lnum_t  *adj_ids = m21_adj->ids;
+
+  cs_dispatch_context  dctx;
+  const void  *arrays[] = {x1, adj_idx, adj_ids, m21_val, m21x1};
+  _set_dispatch_location(5, arrays, dctx);
+
+  dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
 
     cs_real_t  _m21x1 = 0.;
-    for (cs_lnum_t j = m21_adj->idx[i2]; j < m21_adj->idx[i2+1]; j++)
-      _m21x1 += cs_math_3_dot_product(m21_val + 3*j, x1 + 3*m21_adj->ids[j]);
+    for (cs_lnum_t j = adj_idx[i2]; j < adj_idx[i2+1]; j++)
+      _m21x1 += cs_math_3_dot_product(m21_val + 3*j, x1 + 3*adj_ids[j]);
 
     m21x1[i2] = _m21x1;
 
-  } /* Loop on x2 elements */
+  }); /* Loop on x2 elements */
+
+  dctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2628,16 +2861,24 @@ cs_saddle_solver_m21_multiply_scalar(cs_lnum_t              n2_dofs,
 {
   assert(n2_dofs == m21_adj->n_elts);
 
-# pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++) {
+  const cs_lnum_t  *adj_idx = m21_adj->idx;
+  const cs_lnum_t  *adj_ids = m21_adj->ids;
+
+  cs_dispatch_context  dctx;
+  const void  *arrays[] = {x1, adj_idx, adj_ids, m21_val, m21x1};
+  _set_dispatch_location(5, arrays, dctx);
+
+  dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
 
     cs_real_t  _m21x1 = 0.;
-    for (cs_lnum_t j = m21_adj->idx[i2]; j < m21_adj->idx[i2+1]; j++)
-      _m21x1 += m21_val[j] * x1[m21_adj->ids[j]];
+    for (cs_lnum_t j = adj_idx[i2]; j < adj_idx[i2+1]; j++)
+      _m21x1 += m21_val[j] * x1[adj_ids[j]];
 
     m21x1[i2] = _m21x1;
 
-  } /* Loop on x2 elements */
+  }); /* Loop on x2 elements */
+
+  dctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2879,7 +3120,7 @@ cs_saddle_solver_context_block_pcd_clean(
 
   BFT_FREE(ctx->schur_diag);
   BFT_FREE(ctx->schur_xtra);
-  BFT_FREE(ctx->m22_mass_diag);
+  CS_FREE_HD(ctx->m22_mass_diag);
   BFT_FREE(ctx->m11_inv_diag);
 }
 
@@ -3008,17 +3249,17 @@ cs_saddle_solver_context_gkb_clean(cs_saddle_solver_context_gkb_t *ctx)
   ctx->zeta_square_sum = 0;
 
   BFT_FREE(ctx->zeta_array);
-  BFT_FREE(ctx->q);
-  BFT_FREE(ctx->d);
-  BFT_FREE(ctx->m21v);
-  BFT_FREE(ctx->inv_m22);
+  CS_FREE_HD(ctx->q);
+  CS_FREE_HD(ctx->d);
+  CS_FREE_HD(ctx->m21v);
+  CS_FREE_HD(ctx->inv_m22);
 
-  BFT_FREE(ctx->w);
-  BFT_FREE(ctx->v);
-  BFT_FREE(ctx->m12q);
-  BFT_FREE(ctx->x1_tilda);
+  CS_FREE_HD(ctx->w);
+  CS_FREE_HD(ctx->v);
+  CS_FREE_HD(ctx->m12q);
+  CS_FREE_HD(ctx->x1_tilda);
 
-  BFT_FREE(ctx->rhs_tilda);
+  CS_FREE_HD(ctx->rhs_tilda);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3226,12 +3467,12 @@ cs_saddle_solver_context_uzawa_cg_clean(
   if (ctx == nullptr)
     return;
 
-  BFT_FREE(ctx->res2);
-  BFT_FREE(ctx->m21x1);
-  BFT_FREE(ctx->gk);
-  BFT_FREE(ctx->b1_tilda);
-  BFT_FREE(ctx->dzk);
-  BFT_FREE(ctx->rhs);
+  CS_FREE_HD(ctx->res2);
+  CS_FREE_HD(ctx->m21x1);
+  CS_FREE_HD(ctx->gk);
+  CS_FREE_HD(ctx->b1_tilda);
+  CS_FREE_HD(ctx->dzk);
+  CS_FREE_HD(ctx->rhs);
 
   /* Remove the setup data in SLES. The pointer to the following SLES will be
      still valid */
@@ -3243,7 +3484,7 @@ cs_saddle_solver_context_uzawa_cg_clean(
   BFT_FREE(ctx->schur_diag);
   BFT_FREE(ctx->schur_xtra);
   BFT_FREE(ctx->m11_inv_diag);
-  BFT_FREE(ctx->inv_m22);
+  CS_FREE_HD(ctx->inv_m22);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4391,6 +4632,14 @@ cs_saddle_solver_gkb_inhouse(cs_saddle_solver_t  *solver,
 
   _gkb_init_solution(solver, ctx, x2);
 
+  const cs_real_t  *inv_m22 = ctx->inv_m22;
+  cs_real_t  *q = ctx->q, *d = ctx->d, *m21v = ctx->m21v, *m12q = ctx->m12q;
+  cs_real_t  *w = ctx->w, *v = ctx->v, *x1_tilda = ctx->x1_tilda;
+  const cs_real_t  *rhs_tilda = ctx->rhs_tilda;
+
+  cs_dispatch_context  dctx;
+  _gkb_set_dispatch_location(solver, ctx, x1, x2, dctx);
+
   /* Main loop */
   /* ========= */
 
@@ -4400,25 +4649,32 @@ cs_saddle_solver_gkb_inhouse(cs_saddle_solver_t  *solver,
      *         beta = (g, M22.g)
      */
 
-    ctx->m21_vector_multiply(n2_dofs, ctx->v, ctx->m21_adj, ctx->m21_val,
-                             ctx->m21v);
+    ctx->m21_vector_multiply(n2_dofs, v, ctx->m21_adj, ctx->m21_val, m21v);
 
-#   pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-    for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++) {
-      ctx->m21v[i2] *= ctx->inv_m22[i2];
-      ctx->m21v[i2] -= ctx->alpha * ctx->q[i2];
-    }
+    const double  alpha = ctx->alpha;
+    dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
+      m21v[i2] *= inv_m22[i2];
+      m21v[i2] -= alpha * q[i2];
+    });
+    dctx.wait();
 
     /* Update beta */
 
-    ctx->beta = _gkb_block22_weighted_norm(n2_dofs, ctx->m22, ctx->m21v);
+    ctx->beta = _gkb_block22_weighted_norm(n2_dofs, ctx->m22, m21v);
 
-    const double  scaling = 1./ctx->beta;
-#   pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-    for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++)
-      ctx->q[i2] = scaling * ctx->m21v[i2];
+    const double  beta = ctx->beta;
+    const double  scaling = 1./beta;
+    dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
+      q[i2] = scaling * m21v[i2];
+    });
+
+    dctx.parallel_for(n1_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i1) {
+      m12q[i1] = 0.;
+    });
 
-    if (fabs(ctx->beta) < FLT_MIN) {
+    dctx.wait();
+
+    if (fabs(beta) < FLT_MIN) {
       cs_iter_algo_set_cvg_status(algo, CS_SLES_CONVERGED);
       break;
     }
@@ -4426,21 +4682,19 @@ cs_saddle_solver_gkb_inhouse(cs_saddle_solver_t  *solver,
     /* Solve M11.v = w = M12.q
      * M12.q is updated in the next function */
 
-    cs_array_real_fill_zero(n1_dofs, ctx->m12q);
-    ctx->m12_vector_multiply(n2_elts, ctx->q, ctx->m21_adj, ctx->m21_val,
-                             ctx->m12q);
+    ctx->m12_vector_multiply(n2_elts, q, ctx->m21_adj, ctx->m21_val, m12q);
 
     if (rset->ifs != nullptr)
       cs_interface_set_sum(rset->ifs,
                            /* n_elts, stride, interlaced */
                            n1_dofs, 1, false, CS_REAL_TYPE,
-                           ctx->m12q);
+                           m12q);
 
-#   pragma omp parallel for if (n1_dofs > CS_THR_MIN)
-    for (cs_lnum_t i1 = 0; i1 < n1_dofs; i1++) {
-      ctx->w[i1] *= -ctx->beta;
-      ctx->w[i1] += ctx->m12q[i1];
-    }
+    dctx.parallel_for(n1_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i1) {
+      w[i1] *= -beta;
+      w[i1] += m12q[i1];
+    });
+    dctx.wait();
 
     cs_real_t  normalization = ctx->alpha;
 
@@ -4468,25 +4722,27 @@ cs_saddle_solver_gkb_inhouse(cs_saddle_solver_t  *solver,
 
     /* zeta(k+1) = -beta/alpha * zeta(k) */
 
-    ctx->zeta *= -ctx->beta * ov_alpha;
+    ctx->zeta *= -beta * ov_alpha;
+
+    const double  zeta = ctx->zeta;
 
     /* Update vectors and solutions */
 
-#   pragma omp parallel for if (n1_dofs > CS_THR_MIN)
-    for (cs_lnum_t i1 = 0; i1 < n1_dofs; i1++) {
-      ctx->v[i1] *= ov_alpha;
-      ctx->x1_tilda[i1] += ctx->zeta * ctx->v[i1];
+    dctx.parallel_for(n1_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i1) {
+      v[i1] *= ov_alpha;
+      x1_tilda[i1] += zeta * v[i1];
 
       /* Last step: w(k+1) = 1/alpha(k+1) * (M12.q - beta*w(k)) */
 
-      ctx->w[i1] *= ov_alpha;
-    }
+      w[i1] *= ov_alpha;
+    });
 
-#   pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-    for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++) {
-      ctx->d[i2] = ov_alpha * (ctx->q[i2] - ctx->beta*ctx->d[i2]);
-      x2[i2] -= ctx->zeta * ctx->d[i2];
-    }
+    dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
+      d[i2] = ov_alpha * (q[i2] - beta*d[i2]);
+      x2[i2] -= zeta * d[i2];
+    });
+
+    dctx.wait();
 
   } /* End of the main loop on the GKB algorithm */
 
@@ -4494,9 +4750,11 @@ cs_saddle_solver_gkb_inhouse(cs_saddle_solver_t  *solver,
    * x1 : = x1_tilda + M11^-1.(rhs1 + gamma.M12.M22^-1.rhs2)
    * where M11^-1.(rhs1 + gamma.M12.M22^-1.rhs2) is stored in rhs_tilda */
 
-# pragma omp parallel for if (n1_dofs > CS_THR_MIN)
-  for (cs_lnum_t i1 = 0; i1 < n1_dofs; i1++)
-    x1[i1] = ctx->x1_tilda[i1] + ctx->rhs_tilda[i1];
+  dctx.parallel_for(n1_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i1) {
+    x1[i1] = x1_tilda[i1] + rhs_tilda[i1];
+  });
+
+  dctx.wait();
 
   /* --- ALGO END --- */
   /* ---------------- */
@@ -4693,7 +4951,24 @@ cs_saddle_solver_uzawa_cg(cs_saddle_solver_t  *solver,
   const cs_matrix_t  *m11 = ctx->m11;
 
   cs_real_t  *rhs1 = sh->rhs_array[0];
-  cs_real_t  *rhs2 = sh->rhs_array[1];
+  const cs_real_t  *rhs2 = sh->rhs_array[1];
+
+  const cs_real_t  *inv_m22 = ctx->inv_m22;
+  const double  alpha = ctx->alpha;
+
+  /* Set pointers used in this algorithm */
+
+  cs_real_t  *gk = ctx->gk;
+  cs_real_t  *dk = ctx->res2;
+  cs_real_t  *rk = ctx->m21x1;
+  cs_real_t  *wk = ctx->b1_tilda;
+  cs_real_t  *dwk = ctx->dzk;
+  cs_real_t  *zk = ctx->rhs;
+
+  cs_dispatch_context  dctx;
+  const void  *arrays[] = {x1, x2, rhs1, rhs2, inv_m22,
+                           gk, dk, rk, wk, dwk, zk};
+  _set_dispatch_location(11, arrays, dctx);
 
   /* Compute the first RHS: A.u0 = rhs = b_f - B^t.p_0 to solve */
 
@@ -4715,9 +4990,10 @@ cs_saddle_solver_uzawa_cg(cs_saddle_solver_t  *solver,
 
   }
 
-# pragma omp parallel for if (n1_dofs > CS_THR_MIN)
-  for (cs_lnum_t i1 = 0; i1 < n1_dofs; i1++)
-    ctx->rhs[i1] = rhs1[i1] - ctx->rhs[i1];
+  dctx.parallel_for(n1_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i1) {
+    zk[i1] = rhs1[i1] - zk[i1];
+  });
+  dctx.wait();
 
   /* Initial normalization from the newly computed rhs */
 
@@ -4748,22 +5024,14 @@ cs_saddle_solver_uzawa_cg(cs_saddle_solver_t  *solver,
   cs_dbg_binary_dump_system(saddlep->xtra_sles_param->name, m11, ctx->rhs, x1);
 #endif
 
-  /* Set pointers used in this algorithm */
-
-  cs_real_t  *gk = ctx->gk;
-  cs_real_t  *dk = ctx->res2;
-  cs_real_t  *rk = ctx->m21x1;
-  cs_real_t  *wk = ctx->b1_tilda;
-  cs_real_t  *dwk = ctx->dzk;
-  cs_real_t  *zk = ctx->rhs;
-
   /* Compute the first residual rk0 (in fact the velocity divergence) */
 
   ctx->m21_vector_multiply(n2_dofs, x1, ctx->m21_adj, ctx->m21_val, rk);
 
-# pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++)
+  dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
     rk[i2] = rhs2[i2] - rk[i2];
+  });
+  dctx.wait();
 
   /* Solve S.zk = rk */
 
@@ -4777,15 +5045,13 @@ cs_saddle_solver_uzawa_cg(cs_saddle_solver_t  *solver,
 
   cs_iter_algo_update_inner_iters(algo, n_iter);
 
-  /* Compute g0 s.t. g0 = alpha zk + nu Mp^-1 r0 */
+  /* Compute g0 s.t. g0 = alpha zk + nu Mp^-1 r0 and dk0 <-- gk0 */
 
-# pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-  for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++)
-    gk[i2] = ctx->alpha*zk[i2] + ctx->inv_m22[i2]*rk[i2];
-
-  /* dk0 <-- gk0 */
-
-  cs_array_real_copy(n2_dofs, gk, dk);
+  dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
+    gk[i2] = alpha*zk[i2] + inv_m22[i2]*rk[i2];
+    dk[i2] = gk[i2];
+  });
+  dctx.wait();
 
   double  beta_denum = cs_gdot(n2_dofs, rk, gk);
   double  res_norm =  sqrt(fabs(beta_denum));
@@ -4850,9 +5116,10 @@ cs_saddle_solver_uzawa_cg(cs_saddle_solver_t  *solver,
 
     cs_iter_algo_update_inner_iters(algo, n_iter);
 
-#   pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-    for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++)
-      zk[i2] = ctx->alpha*zk[i2] + ctx->inv_m22[i2]*dwk[i2];
+    dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
+      zk[i2] = alpha*zk[i2] + inv_m22[i2]*dwk[i2];
+    });
+    dctx.wait();
 
     /* Updates
      *  - Compute the rho_factor = <rk,gk> / <gk, dwk>
@@ -4865,16 +5132,17 @@ cs_saddle_solver_uzawa_cg(cs_saddle_solver_t  *solver,
     assert(fabs(denum) > 0);
     const double  rho_factor = cs_gdot(n2_dofs, rk, gk) / denum;
 
-#   pragma omp parallel for if (n1_dofs > CS_THR_MIN)
-    for (cs_lnum_t i1 = 0; i1 < n1_dofs; i1++)
+    dctx.parallel_for(n1_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i1) {
       x1[i1] += rho_factor * wk[i1]; /* --wk */
+    });
 
-#   pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-    for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++) {
+    dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
       x2[i2] -= rho_factor * dk[i2];
       gk[i2] -= rho_factor * zk[i2];
       rk[i2] -= rho_factor * dwk[i2];
-    }
+    });
+
+    dctx.wait();
 
     /* Conjugate gradient direction: update d(k+1) */
 
@@ -4886,9 +5154,10 @@ cs_saddle_solver_uzawa_cg(cs_saddle_solver_t  *solver,
 
     /* dk <-- gk + beta_factor * dk */
 
-#   pragma omp parallel for if (n2_dofs > CS_THR_MIN)
-    for (cs_lnum_t i2 = 0; i2 < n2_dofs; i2++)
+    dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
       dk[i2] = gk[i2] + beta_factor*dk[i2];
+    });
+    dctx.wait();
 
   } /* End of main loop */
 
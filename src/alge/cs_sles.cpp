@@ -59,8 +59,10 @@
 #include "cs_mesh_location.h"
 #include "cs_matrix.h"
 #include "cs_matrix_default.h"
+#include "cs_matrix_tuning.h"
 #include "cs_matrix_util.h"
 #include "cs_parall.h"
+#include "cs_perf_summary.h"
 #include "cs_post.h"
 #include "cs_timer.h"
 #include "cs_timer_stats.h"
@@ -169,6 +171,30 @@ BEGIN_C_DECLS
 
   \return  convergence status
 
+  \typedef  cs_sles_solve_multi_t
+
+  \brief  Function pointer for resolution of a linear system with
+          multiple right-hand sides.
+
+  Right-hand sides and solutions are interleaved, so that the value
+  for right-hand side k and row (or block component) i is located at
+  i*n_rhs + k. Solutions are used as initial values.
+
+  \param[in, out]  context        pointer to solver context
+  \param[in]       name           pointer to name of linear system
+  \param[in]       a              matrix
+  \param[in]       verbosity      associated verbosity
+  \param[in]       n_rhs          number of right-hand sides
+  \param[in]       precision      solver precision
+  \param[in]       r_norm         residual normalization, per right-hand side
+  \param[out]      n_iter         number of "equivalent" iterations,
+                                  per right-hand side
+  \param[out]      residual       residual, per right-hand side
+  \param[in]       rhs            interleaved right hand sides
+  \param[in, out]  vx             interleaved system solutions
+
+  \return  convergence status (worst over all right-hand sides)
+
   \typedef  cs_sles_free_t
 
   \brief  Function pointer for freeing of a linear system's context data.
@@ -280,6 +306,10 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Maximum number of previous solutions used for initial guess projection */
+
+#define CS_SLES_PROJECTION_N_MAX 32
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
@@ -299,6 +329,27 @@ typedef struct {
 
 } cs_sles_post_t;
 
+/* Projection of the initial guess on previous solutions */
+/*-------------------------------------------------------*/
+
+typedef struct {
+
+  int                       n_max;         /* maximum number of vectors */
+  int                       n;             /* current number of vectors */
+
+  cs_lnum_t                 n_vals;        /* number of values per vector */
+  cs_lnum_t                 n_vals_ext;    /* n_vals, including ghosts */
+
+  cs_real_t                *x;             /* A-orthonormal basis of
+                                              previous solutions */
+  cs_real_t                *ax;            /* matching A.x products */
+  cs_real_t                *w;             /* work array (with ghosts) */
+
+  unsigned long long        n_projections; /* number of projected initial
+                                              guesses */
+
+} cs_sles_projection_t;
+
 /* Basic per linear system options and logging */
 /*---------------------------------------------*/
 
@@ -326,6 +377,8 @@ struct _cs_sles_t {
 
   cs_sles_setup_t          *setup_func;    /* solver setup function */
   cs_sles_solve_t          *solve_func;    /* solve function */
+  cs_sles_solve_multi_t    *solve_multi_func; /* multiple right-hand side
+                                                 solve function, or nullptr */
   cs_sles_free_t           *free_func;     /* free setup function */
 
   cs_sles_log_t            *log_func;      /* logging function */
@@ -338,6 +391,12 @@ struct _cs_sles_t {
 
   cs_sles_post_t           *post_info;     /* postprocessing info */
 
+  cs_matrix_tuner_t        *spmv_tuner;    /* online SpMV tuning,
+                                              or nullptr */
+
+  cs_sles_projection_t     *projection;    /* initial guess projection,
+                                              or nullptr */
+
 };
 
 /*============================================================================
@@ -371,6 +430,12 @@ static int _sles_stat_id = -1;
 
 static double _cs_sles_epzero = 1e-12;
 
+/* Online SpMV variant tuning (number of solves over which measures are
+   spread, 0 if inactive, and number of measuring runs per solve) */
+
+static int _cs_sles_spmv_tune_n_solves = 0;
+static int _cs_sles_spmv_tune_n_measure = 10;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -417,6 +482,7 @@ _sles_create(int          f_id,
   sles->context = nullptr;
   sles->setup_func = nullptr;
   sles->solve_func = nullptr;
+  sles->solve_multi_func = nullptr;
   sles->free_func = nullptr;
   sles->log_func = nullptr;
   sles->copy_func = nullptr;
@@ -428,6 +494,8 @@ _sles_create(int          f_id,
   sles->allow_no_op = false;
 
   sles->post_info = nullptr;
+  sles->spmv_tuner = nullptr;
+  sles->projection = nullptr;
 
   return sles;
 }
@@ -593,6 +661,8 @@ _save_system_info(cs_sles_t  *s)
   memcpy(s_old, s, sizeof(cs_sles_t));
 
   s_old->_name = nullptr; /* still points to new name */
+  s_old->spmv_tuner = nullptr; /* tuning kept with current system */
+  s_old->projection = nullptr; /* projection kept with current system */
   s->context = nullptr;   /* old context now only available through s_old */
 
   _cs_sles_systems[2][i] = s_old;
@@ -653,6 +723,223 @@ _residual(cs_lnum_t            n_vals,
 #endif
 }
 
+/*----------------------------------------------------------------------------
+ * Compute y = A.x, handling device association of host arrays if needed.
+ *
+ * parameters:
+ *   a <-- matrix
+ *   x <-> input vector (with ghost values, synchronized here)
+ *   y --> result
+ *----------------------------------------------------------------------------*/
+
+static void
+_matrix_vector(const cs_matrix_t  *a,
+               cs_real_t           x[],
+               cs_real_t           y[])
+{
+#if defined(HAVE_ACCEL)
+
+  bool ddp_x = false, ddp_y = false;
+
+  if (cs_matrix_get_alloc_mode(a) > CS_ALLOC_HOST) {
+    cs_lnum_t _n_vals =   cs_matrix_get_n_columns(a)
+                        * cs_matrix_get_diag_block_size(a);
+    if (cs_check_device_ptr(x) == CS_ALLOC_HOST) {
+      cs_associate_device_ptr(x, _n_vals, sizeof(cs_real_t));
+      ddp_x = true;
+    }
+    if (cs_check_device_ptr(y) == CS_ALLOC_HOST) {
+      cs_associate_device_ptr(y, _n_vals, sizeof(cs_real_t));
+      ddp_y = true;
+    }
+  }
+
+#endif
+
+  cs_matrix_vector_multiply(a, x, y);
+
+#if defined(HAVE_ACCEL)
+
+  if (ddp_x)
+    cs_disassociate_device_ptr(x);
+  if (ddp_y)
+    cs_disassociate_device_ptr(y);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy initial guess projection structure.
+ *
+ * parameters:
+ *   p <-> pointer to projection structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_projection_destroy(cs_sles_projection_t  **p)
+{
+  cs_sles_projection_t *_p = *p;
+
+  if (_p != nullptr) {
+    BFT_FREE(_p->x);
+    BFT_FREE(_p->ax);
+    BFT_FREE(_p->w);
+    BFT_FREE(*p);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Improve the initial guess of a system using the previous solutions.
+ *
+ * The correction minimizing the A-norm of the error over the span of the
+ * stored vectors is added to the initial guess (Fischer's method). As the
+ * basis is A-orthonormal, this only requires one dot product per vector.
+ *
+ * parameters:
+ *   p   <-> pointer to projection structure
+ *   a   <-- matrix
+ *   rhs <-- right-hand side
+ *   vx  <-> initial guess
+ *----------------------------------------------------------------------------*/
+
+static void
+_projection_initial_guess(cs_sles_projection_t  *p,
+                          const cs_matrix_t     *a,
+                          const cs_real_t        rhs[],
+                          cs_real_t              vx[])
+{
+  const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
+  const cs_lnum_t n_vals = cs_matrix_get_n_rows(a) * db_size;
+  const cs_lnum_t n_vals_ext = cs_matrix_get_n_columns(a) * db_size;
+
+  /* Reset in case of size change (such as after remeshing) */
+
+  if (n_vals != p->n_vals || n_vals_ext != p->n_vals_ext) {
+    p->n = 0;
+    p->n_vals = n_vals;
+    p->n_vals_ext = n_vals_ext;
+    BFT_REALLOC(p->x, (size_t)(p->n_max)*n_vals, cs_real_t);
+    BFT_REALLOC(p->ax, (size_t)(p->n_max)*n_vals, cs_real_t);
+    BFT_REALLOC(p->w, n_vals_ext, cs_real_t);
+  }
+
+  if (p->n < 1)
+    return;
+
+  /* Residual of the initial guess (rhs if solving by increments) */
+
+  cs_real_t *r = p->w;
+  const cs_real_t *_r = rhs;
+
+  if (cs_gdot(n_vals, vx, vx) > 0) {
+    _matrix_vector(a, vx, r);
+#   pragma omp parallel for if(n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      r[ii] = rhs[ii] - r[ii];
+    _r = r;
+  }
+
+  double alpha[CS_SLES_PROJECTION_N_MAX];
+
+  for (int k = 0; k < p->n; k++)
+    alpha[k] = cs_dot(n_vals, p->x + (size_t)k*n_vals, _r);
+
+  cs_parall_sum(p->n, CS_DOUBLE, alpha);
+
+  for (int k = 0; k < p->n; k++) {
+    const cs_real_t *x_k = p->x + (size_t)k*n_vals;
+    const cs_real_t alpha_k = alpha[k];
+#   pragma omp parallel for if(n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      vx[ii] += alpha_k*x_k[ii];
+  }
+
+  p->n_projections += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Add a solution to the basis used for initial guess projection.
+ *
+ * The solution is A-orthonormalized against the current basis (which
+ * assumes a symmetric matrix). When the basis is full, it is restarted
+ * from the current solution only.
+ *
+ * parameters:
+ *   p   <-> pointer to projection structure
+ *   a   <-- matrix
+ *   vx  <-- system solution
+ *----------------------------------------------------------------------------*/
+
+static void
+_projection_update(cs_sles_projection_t  *p,
+                   const cs_matrix_t     *a,
+                   const cs_real_t        vx[])
+{
+  const cs_lnum_t n_vals = p->n_vals;
+
+  if (p->n >= p->n_max)
+    p->n = 0;
+
+  int k_new = p->n;
+  cs_real_t *x_n = p->x + (size_t)k_new*n_vals;
+  cs_real_t *ax_n = p->ax + (size_t)k_new*n_vals;
+
+  /* Compute A.x for the new vector (using the work array for ghosts) */
+
+  cs_real_t *w = p->w;
+
+# pragma omp parallel for if(n_vals > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+    w[ii] = vx[ii];
+
+  _matrix_vector(a, w, ax_n);
+
+# pragma omp parallel for if(n_vals > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+    x_n[ii] = w[ii];
+
+  /* A-orthogonalization against previous vectors */
+
+  double beta[CS_SLES_PROJECTION_N_MAX + 1];
+
+  for (int k = 0; k < k_new; k++)
+    beta[k] = cs_dot(n_vals, p->x + (size_t)k*n_vals, ax_n);
+  beta[k_new] = cs_dot(n_vals, x_n, ax_n);
+
+  cs_parall_sum(k_new + 1, CS_DOUBLE, beta);
+
+  const double x_norm2 = beta[k_new];
+
+  for (int k = 0; k < k_new; k++) {
+    const cs_real_t *x_k = p->x + (size_t)k*n_vals;
+    const cs_real_t *ax_k = p->ax + (size_t)k*n_vals;
+    const cs_real_t beta_k = beta[k];
+#   pragma omp parallel for if(n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++) {
+      x_n[ii] -= beta_k*x_k[ii];
+      ax_n[ii] -= beta_k*ax_k[ii];
+    }
+  }
+
+  /* Normalization; the vector is dropped if it is (numerically)
+     in the span of the current basis */
+
+  double xa_norm2 = cs_gdot(n_vals, x_n, ax_n);
+
+  if (xa_norm2 <= _cs_sles_epzero*fabs(x_norm2) || xa_norm2 <= 0)
+    return;
+
+  const cs_real_t s = 1. / sqrt(xa_norm2);
+
+# pragma omp parallel for if(n_vals > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_vals; ii++) {
+    x_n[ii] *= s;
+    ax_n[ii] *= s;
+  }
+
+  p->n += 1;
+}
+
 /*----------------------------------------------------------------------------
  * Test if a general sparse linear system needs solving or if the right-hand
  * side is already zero within convergence criteria.
@@ -891,6 +1178,74 @@ _post_function(void                  *sles_p,
   BFT_FREE(sp->row_residual);
 }
 
+/*----------------------------------------------------------------------------
+ * Solve a linear system with multiple interleaved right-hand sides,
+ * one right-hand side at a time.
+ *
+ * parameters:
+ *   sles      <-> pointer to solver object
+ *   a         <-- matrix
+ *   n_rhs     <-- number of right-hand sides
+ *   precision <-- solver precision
+ *   r_norm    <-- residual normalization, per right-hand side
+ *   n_iter    --> number of "equivalent" iterations, per right-hand side
+ *   residual  --> residual, per right-hand side
+ *   rhs       <-- interleaved right hand sides
+ *   vx        <-> interleaved system solutions
+ *
+ * returns:
+ *   convergence state (worst over all right-hand sides)
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_solve_multi_by_rhs(cs_sles_t           *sles,
+                    const cs_matrix_t   *a,
+                    int                  n_rhs,
+                    double               precision,
+                    const double         r_norm[],
+                    int                  n_iter[],
+                    double               residual[],
+                    const cs_real_t     *rhs,
+                    cs_real_t           *vx)
+{
+  cs_sles_convergence_state_t state = CS_SLES_CONVERGED;
+
+  const cs_lnum_t block_size = cs_matrix_get_diag_block_size(a);
+  const cs_lnum_t n_vals_ext = cs_matrix_get_n_columns(a) * block_size;
+  const cs_lnum_t n_vals = cs_matrix_get_n_rows(a) * block_size;
+
+  cs_real_t *_rhs, *_vx;
+  BFT_MALLOC(_rhs, n_vals_ext, cs_real_t);
+  BFT_MALLOC(_vx, n_vals_ext, cs_real_t);
+
+  for (int k = 0; k < n_rhs; k++) {
+
+#   pragma omp parallel for if(n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++) {
+      _rhs[ii] = rhs[ii*n_rhs + k];
+      _vx[ii] = vx[ii*n_rhs + k];
+    }
+
+    cs_sles_convergence_state_t k_state
+      = cs_sles_solve(sles, a, precision, r_norm[k],
+                      n_iter + k, residual + k,
+                      _rhs, _vx, 0, nullptr);
+
+#   pragma omp parallel for if(n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      vx[ii*n_rhs + k] = _vx[ii];
+
+    if (k_state < state)
+      state = k_state;
+
+  }
+
+  BFT_FREE(_vx);
+  BFT_FREE(_rhs);
+
+  return state;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -913,6 +1268,30 @@ cs_sles_set_epzero(double  new_value)
   _cs_sles_epzero = new_value;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate online tuning of the matrix.vector product variant
+ *        used by linear solvers.
+ *
+ * For each system, the available SpMV variants for the matrix type and
+ * fill type (OpenMP, vectorized, atomic, or accelerated variants) are
+ * timed during the first solves, using the solver's actual matrix, and the
+ * fastest one is used for subsequent solves.
+ *
+ * \param[in]  n_solves   number of solves over which measures are spread
+ *                        (0 to deactivate)
+ * \param[in]  n_measure  number of measuring runs per variant and solve
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_spmv_tuning(int  n_solves,
+                        int  n_measure)
+{
+  _cs_sles_spmv_tune_n_solves = CS_MAX(n_solves, 0);
+  _cs_sles_spmv_tune_n_measure = CS_MAX(n_measure, 1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get the current threshold value used in the detection of immediate
@@ -971,6 +1350,8 @@ cs_sles_finalize(void)
           BFT_FREE(sles->post_info->row_residual);
           BFT_FREE(sles->post_info);
         }
+        cs_matrix_tuner_destroy(&(sles->spmv_tuner));
+        _projection_destroy(&(sles->projection));
         BFT_FREE(sles->_name);
         BFT_FREE(_cs_sles_systems[i][j]);
       }
@@ -1133,6 +1514,11 @@ cs_sles_log(cs_log_t  log_type)
               (log_type,
                _("  Residual postprocessing writer id: %d\n"),
                sles->post_info->writer_id);
+          if (sles->projection != nullptr)
+            cs_log_printf
+              (log_type,
+               _("  Initial guess projection on previous solutions: %d\n"),
+               sles->projection->n_max);
           break;
 
         case CS_LOG_PERFORMANCE:
@@ -1141,6 +1527,12 @@ cs_sles_log(cs_log_t  log_type)
               (log_type,
                _("\n"
                  "  Number of immediate solve exits: %d\n"), sles->n_no_op);
+          if (sles->projection != nullptr)
+            cs_log_printf
+              (log_type,
+               _("  Number of projected initial guesses: %llu\n"),
+               sles->projection->n_projections);
+          cs_matrix_tuner_log(sles->spmv_tuner, log_type);
           break;
 
         default:
@@ -1390,6 +1782,7 @@ cs_sles_define(int                 f_id,
   sles->context = context;
   sles->setup_func = setup_func;
   sles->solve_func = solve_func;
+  sles->solve_multi_func = nullptr;
   sles->free_func = free_func;
   sles->log_func = log_func;
   sles->copy_func = copy_func;
@@ -1609,6 +2002,84 @@ cs_sles_set_allow_no_op(cs_sles_t  *sles,
   sles->allow_no_op = allow_no_op;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the maximum number of previous solutions used to build
+ *        the initial guess of a given linear equation solver.
+ *
+ * \param[in]  sles  pointer to solver object
+ *
+ * \return  maximum number of stored solutions, or 0 if the initial guess
+ *          provided to \ref cs_sles_solve is used as is
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_sles_get_initial_guess_projection(const cs_sles_t  *sles)
+{
+  int retval = 0;
+
+  if (sles->projection != nullptr)
+    retval = sles->projection->n_max;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum number of previous solutions used to build
+ *        the initial guess of a given linear equation solver.
+ *
+ * When active, the initial guess provided to \ref cs_sles_solve is
+ * improved by adding the correction minimizing the error (in the norm
+ * associated with the matrix) over the span of the previous solutions
+ * (Fischer's projection method). This is intended for symmetric positive
+ * definite systems solved repeatedly with slowly varying right-hand
+ * sides, such as the pressure system of transient incompressible flows.
+ *
+ * The stored solutions are kept A-orthonormal, so each projection only
+ * requires one dot product per stored solution, and possibly a
+ * matrix-vector product to compute the residual of a non-zero initial
+ * guess. Each converged solve adds its solution to the stored set, at the
+ * cost of one additional matrix-vector product; when the maximum number
+ * is reached, the set is restarted from the latest solution.
+ *
+ * \param[in, out]  sles       pointer to solver object
+ * \param[in]       n_vectors  maximum number of stored solutions
+ *                             (at most 32), or 0 to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_initial_guess_projection(cs_sles_t  *sles,
+                                     int         n_vectors)
+{
+  if (n_vectors > CS_SLES_PROJECTION_N_MAX)
+    n_vectors = CS_SLES_PROJECTION_N_MAX;
+
+  if (n_vectors < 1) {
+    _projection_destroy(&(sles->projection));
+    return;
+  }
+
+  if (sles->projection == nullptr) {
+    BFT_MALLOC(sles->projection, 1, cs_sles_projection_t);
+    cs_sles_projection_t *p = sles->projection;
+    p->n_vals = 0;
+    p->n_vals_ext = 0;
+    p->x = nullptr;
+    p->ax = nullptr;
+    p->w = nullptr;
+    p->n_projections = 0;
+  }
+
+  /* Force reallocation and reset at next solve */
+
+  sles->projection->n_max = n_vectors;
+  sles->projection->n = 0;
+  sles->projection->n_vals = -1;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Setup sparse linear equation solver.
@@ -1659,6 +2130,9 @@ cs_sles_setup(cs_sles_t          *sles,
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(&_sles_t_tot, &t0, &t1);
+
+  cs_perf_summary_add_diff(cs_sles_base_name(sles->f_id, sles->name),
+                           CS_PERF_SUMMARY_SETUP, &t0, &t1);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1748,6 +2222,24 @@ cs_sles_solve(cs_sles_t           *sles,
     }
   }
 
+  /* Online SpMV tuning: measure variants during the first solves,
+     then apply the selected variant during each solve */
+
+  if (do_solve && _cs_sles_spmv_tune_n_solves > 0) {
+    if (sles->spmv_tuner == nullptr)
+      sles->spmv_tuner
+        = cs_matrix_tuner_create(_cs_sles_spmv_tune_n_solves,
+                                 _cs_sles_spmv_tune_n_measure);
+    cs_matrix_tuner_apply(sles->spmv_tuner, a);
+  }
+
+  /* Projection of the initial guess on previous solutions */
+
+  bool use_projection = (do_solve && sles->projection != nullptr);
+
+  if (use_projection)
+    _projection_initial_guess(sles->projection, a, rhs, vx);
+
   while (do_solve) {
 
     state = sles->solve_func(sles->context,
@@ -1775,6 +2267,11 @@ cs_sles_solve(cs_sles_t           *sles,
 
   }
 
+  cs_matrix_tuner_restore(sles->spmv_tuner, a);
+
+  if (use_projection && state == CS_SLES_CONVERGED)
+    _projection_update(sles->projection, a, vx);
+
   /* Prepare postprocessing if needed */
 
   if (sles->post_info != nullptr) {
@@ -1818,6 +2315,117 @@ cs_sles_solve(cs_sles_t           *sles,
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(&_sles_t_tot, &t0, &t1);
 
+  cs_perf_summary_add_diff(sles_name, CS_PERF_SUMMARY_SOLVE, &t0, &t1);
+
+  return state;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve a linear system with multiple right-hand sides.
+ *
+ * Right-hand sides and solutions are interleaved, so that the value
+ * for right-hand side k and row (or block component) i is located at
+ * i*n_rhs + k. Solution arrays must be sized (at least) for
+ * n_rhs * n_cols_ext * diag_block_size values.
+ *
+ * If the associated solver provides a \ref cs_sles_solve_multi_t function,
+ * all systems are solved simultaneously, so that the matrix is streamed
+ * only once per iteration for all right-hand sides. Otherwise, or if
+ * that solve fails, each system is solved in turn using \ref cs_sles_solve.
+ *
+ * \param[in, out]  sles           pointer to solver object
+ * \param[in]       a              matrix
+ * \param[in]       n_rhs          number of right-hand sides
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residual normalization, per right-hand side
+ * \param[out]      n_iter         number of "equivalent" iterations,
+ *                                 per right-hand side
+ * \param[out]      residual       residual, per right-hand side
+ * \param[in]       rhs            interleaved right hand sides
+ * \param[in, out]  vx             interleaved system solutions
+ *
+ * \return  convergence state (worst over all right-hand sides)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_multi(cs_sles_t           *sles,
+                    const cs_matrix_t   *a,
+                    int                  n_rhs,
+                    double               precision,
+                    const double         r_norm[],
+                    int                  n_iter[],
+                    double               residual[],
+                    const cs_real_t     *rhs,
+                    cs_real_t           *vx)
+{
+  if (sles->context == nullptr)
+    _cs_sles_define_default(sles->f_id, sles->name, a);
+
+  /* Simultaneous solve only if available and no per-system
+     checks or postprocessing are required */
+
+  bool multi_solve = (sles->solve_multi_func != nullptr && n_rhs > 1);
+
+  if (sles->allow_no_op || sles->post_info != nullptr)
+    multi_solve = false;
+
+  for (int k = 0; k < n_rhs; k++) {
+    if (r_norm[k] <= 0.)
+      multi_solve = false;
+  }
+
+  if (multi_solve == false)
+    return _solve_multi_by_rhs(sles, a, n_rhs, precision, r_norm,
+                               n_iter, residual, rhs, vx);
+
+  cs_timer_t t0 = cs_timer_time();
+
+  int t_top_id = cs_timer_stats_switch(_sles_stat_id);
+
+  sles->n_calls += 1;
+
+  const char  *sles_name = cs_sles_base_name(sles->f_id, sles->name);
+
+  cs_sles_convergence_state_t state
+    = sles->solve_multi_func(sles->context,
+                             sles_name,
+                             a,
+                             sles->verbosity,
+                             n_rhs,
+                             precision,
+                             r_norm,
+                             n_iter,
+                             residual,
+                             rhs,
+                             vx);
+
+  cs_timer_stats_switch(t_top_id);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&_sles_t_tot, &t0, &t1);
+
+  cs_perf_summary_add_diff(sles_name, CS_PERF_SUMMARY_SOLVE, &t0, &t1);
+
+  /* In case of failure, solve systems separately so that the usual
+     fallback and error handling mechanisms are used; systems which
+     have already converged exit immediately. */
+
+  if (state < CS_SLES_ITERATING) {
+    int *n_iter_m;
+    BFT_MALLOC(n_iter_m, n_rhs, int);
+    for (int k = 0; k < n_rhs; k++)
+      n_iter_m[k] = n_iter[k];
+
+    state = _solve_multi_by_rhs(sles, a, n_rhs, precision, r_norm,
+                                n_iter, residual, rhs, vx);
+
+    for (int k = 0; k < n_rhs; k++)
+      n_iter[k] += n_iter_m[k];
+    BFT_FREE(n_iter_m);
+  }
+
   return state;
 }
 
@@ -1894,6 +2502,7 @@ cs_sles_copy(cs_sles_t        *dest,
   dest->context = src->copy_func(src->context);
   dest->setup_func = src->setup_func;
   dest->solve_func = src->solve_func;
+  dest->solve_multi_func = src->solve_multi_func;
   dest->free_func = src->free_func;
   dest->log_func = src->log_func;
   dest->copy_func = src->copy_func;
@@ -1930,6 +2539,28 @@ cs_sles_set_error_handler(cs_sles_t                *sles,
     sles->error_func = error_handler_func;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Associate a multiple right-hand side solve function to a sparse
+ *        linear equation solver.
+ *
+ * The association will only be successful if the matching solver
+ * has already been defined, and is reset by \ref cs_sles_define.
+ *
+ * \param[in, out]  sles              pointer to solver object
+ * \param[in]       solve_multi_func  pointer to multiple right-hand side
+ *                                    solve function, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_solve_multi_func(cs_sles_t              *sles,
+                             cs_sles_solve_multi_t  *solve_multi_func)
+{
+  if (sles != nullptr)
+    sles->solve_multi_func = solve_multi_func;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return pointer to default sparse linear solver definition function.
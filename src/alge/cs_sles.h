@@ -142,6 +142,46 @@ typedef cs_sles_convergence_state_t
                    size_t               aux_size,
                    void                *aux_vectors);
 
+/*----------------------------------------------------------------------------
+ * Function pointer for resolution of a linear system with multiple
+ * right-hand sides.
+ *
+ * Right-hand sides and solutions are interleaved, so that the value
+ * for right-hand side k and row (or block component) i is located at
+ * i*n_rhs + k. Solution arrays must be sized (at least) for
+ * n_rhs * n_cols_ext * diag_block_size values, and are used as the
+ * initial solutions.
+ *
+ * parameters:
+ *   context       <-> pointer to solver context
+ *   name          <-- pointer to name of linear system
+ *   a             <-- matrix
+ *   verbosity     <-- associated verbosity
+ *   n_rhs         <-- number of right-hand sides
+ *   precision     <-- solver precision
+ *   r_norm        <-- residual normalization, per right-hand side
+ *   n_iter        --> number of "equivalent" iterations, per right-hand side
+ *   residual      --> residual, per right-hand side
+ *   rhs           <-- interleaved right hand sides
+ *   vx            <-> interleaved system solutions
+ *
+ * returns:
+ *   convergence status (worst over all right-hand sides)
+ *----------------------------------------------------------------------------*/
+
+typedef cs_sles_convergence_state_t
+(cs_sles_solve_multi_t) (void                *context,
+                         const char          *name,
+                         const cs_matrix_t   *a,
+                         int                  verbosity,
+                         int                  n_rhs,
+                         double               precision,
+                         const double         r_norm[],
+                         int                  n_iter[],
+                         double               residual[],
+                         const cs_real_t     *rhs,
+                         cs_real_t           *vx);
+
 /*----------------------------------------------------------------------------
  * Function pointer for freeing of a linear system's context data.
  *
@@ -306,6 +346,26 @@ typedef int
 void
 cs_sles_set_epzero(double  new_value);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate online tuning of the matrix.vector product variant
+ *        used by linear solvers.
+ *
+ * For each system, the available SpMV variants for the matrix type and
+ * fill type (OpenMP, vectorized, atomic, or accelerated variants) are
+ * timed during the first solves, using the solver's actual matrix, and the
+ * fastest one is used for subsequent solves.
+ *
+ * \param[in]  n_solves   number of solves over which measures are spread
+ *                        (0 to deactivate)
+ * \param[in]  n_measure  number of measuring runs per variant and solve
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_spmv_tuning(int  n_solves,
+                        int  n_measure);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get the current threshold value used in the detection of immediate
@@ -633,6 +693,42 @@ void
 cs_sles_set_allow_no_op(cs_sles_t  *sles,
                         bool        allow_no_op);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Return the maximum number of previous solutions used to build
+ *        the initial guess of a given linear equation solver.
+ *
+ * \param[in]  sles  pointer to solver object
+ *
+ * \return  maximum number of stored solutions, or 0 if the initial guess
+ *          provided to \ref cs_sles_solve is used as is
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_sles_get_initial_guess_projection(const cs_sles_t  *sles);
+
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Set the maximum number of previous solutions used to build
+ *        the initial guess of a given linear equation solver.
+ *
+ * When active, the initial guess provided to \ref cs_sles_solve is
+ * improved by adding the correction minimizing the error (in the norm
+ * associated with the matrix) over the span of the previous solutions
+ * (Fischer's projection method), which is intended for symmetric positive
+ * definite systems with slowly varying right-hand sides.
+ *
+ * \param[in, out]  sles       pointer to solver object
+ * \param[in]       n_vectors  maximum number of stored solutions
+ *                             (at most 32), or 0 to deactivate
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_initial_guess_projection(cs_sles_t  *sles,
+                                     int         n_vectors);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief Setup sparse linear equation solver.
@@ -697,6 +793,46 @@ cs_sles_solve(cs_sles_t           *sles,
               size_t               aux_size,
               void                *aux_vectors);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Solve a linear system with multiple right-hand sides.
+ *
+ * Right-hand sides and solutions are interleaved, so that the value
+ * for right-hand side k and row (or block component) i is located at
+ * i*n_rhs + k. Solution arrays must be sized (at least) for
+ * n_rhs * n_cols_ext * diag_block_size values.
+ *
+ * If the associated solver provides a \ref cs_sles_solve_multi_t function,
+ * all systems are solved simultaneously, so that the matrix is streamed
+ * only once per iteration for all right-hand sides. Otherwise, or if
+ * that solve fails, each system is solved in turn using \ref cs_sles_solve.
+ *
+ * \param[in, out]  sles           pointer to solver object
+ * \param[in]       a              matrix
+ * \param[in]       n_rhs          number of right-hand sides
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residual normalization, per right-hand side
+ * \param[out]      n_iter         number of "equivalent" iterations,
+ *                                 per right-hand side
+ * \param[out]      residual       residual, per right-hand side
+ * \param[in]       rhs            interleaved right hand sides
+ * \param[in, out]  vx             interleaved system solutions
+ *
+ * \return  convergence state (worst over all right-hand sides)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_multi(cs_sles_t           *sles,
+                    const cs_matrix_t   *a,
+                    int                  n_rhs,
+                    double               precision,
+                    const double         r_norm[],
+                    int                  n_iter[],
+                    double               residual[],
+                    const cs_real_t     *rhs,
+                    cs_real_t           *vx);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief Free sparse linear equation solver setup.
@@ -760,6 +896,24 @@ void
 cs_sles_set_error_handler(cs_sles_t                *sles,
                           cs_sles_error_handler_t  *error_handler_func);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Associate a multiple right-hand side solve function to a sparse
+ *        linear equation solver.
+ *
+ * The association will only be successful if the matching solver
+ * has already been defined, and is reset by \ref cs_sles_define.
+ *
+ * \param[in, out]  sles              pointer to solver object
+ * \param[in]       solve_multi_func  pointer to multiple right-hand side
+ *                                    solve function, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_solve_multi_func(cs_sles_t              *sles,
+                             cs_sles_solve_multi_t  *solve_multi_func);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief Return pointer to default sparse linear solver definition function.
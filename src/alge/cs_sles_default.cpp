@@ -134,6 +134,8 @@ _sles_default_native(int                f_id,
                      bool               symmetric)
 {
   int multigrid = 0;
+  bool aggregation_reuse = false;
+  int n_ig_proj = 0;
   cs_sles_it_type_t sles_it_type = CS_SLES_N_IT_TYPES;
   int n_max_iter = _n_max_iter_default;
 
@@ -163,7 +165,25 @@ _sles_default_native(int                f_id,
       sles_it_type = CS_SLES_P_SYM_GAUSS_SEIDEL;
     }
     else if (!strcmp(name, "PoissonL")) { /* _lageqp */
+      /* Copy from pressure if possible; the system is solved at each
+         Lagrangian time step on the same matrix structure, so keep the
+         multigrid coarse grids from one solve to the next */
+      cs_field_t *cvar_p = (cs_field_by_name_try("pressure"));
+      cs_sles_t *src = nullptr;
+      if (cvar_p != nullptr) {
+        if (cvar_p->type & CS_FIELD_VARIABLE)
+          src = cs_sles_find_or_add(cvar_p->id, nullptr);
+      }
+      if (src != nullptr) {
+        cs_sles_t *dest = cs_sles_find_or_add(-1, name);
+        if (cs_sles_copy(dest, src) == 0) { /* Copy OK, we are done */
+          cs_sles_default_aggregation_reuse(dest);
+          return;
+        }
+      }
       sles_it_type = CS_SLES_FCG;
+      multigrid = 1;
+      aggregation_reuse = true;
       n_max_iter = 1000;
     }
     else if (!strcmp(name, "radiation_p1")) { /* cs_rad_transfer_pun */
@@ -191,6 +211,40 @@ _sles_default_native(int                f_id,
       sles_it_type = CS_SLES_FCG;
       multigrid = 2;
     }
+    /* ALE mesh velocity (cs_ale.cpp): solved at each time step on a
+       fixed mesh connectivity, so keep the multigrid coarse grids */
+    else if (!strcmp(f->name, "mesh_velocity") && symmetric) {
+      sles_it_type = CS_SLES_FCG;
+      multigrid = 1;
+      aggregation_reuse = true;
+    }
+    /* Electric potentials (cs_elec_model.cpp): diffusion systems solved
+       at each time step with slowly varying conductivity, so keep the
+       multigrid coarse grids and project the initial guess on previous
+       solutions. The imaginary potential has the same matrix structure
+       and diffusivity as the real potential, so use the same settings. */
+    else if (   !strcmp(f->name, "elec_pot_r")
+             || !strcmp(f->name, "elec_pot_i")
+             || !strcmp(f->name, "vec_potential")) {
+      if (!strcmp(f->name, "elec_pot_i")) {
+        cs_field_t *f_r = cs_field_by_name_try("elec_pot_r");
+        cs_sles_t *src = nullptr;
+        if (f_r != nullptr)
+          src = cs_sles_find(f_r->id, nullptr);
+        if (src != nullptr) {
+          cs_sles_t *dest = cs_sles_find_or_add(f_id, nullptr);
+          if (cs_sles_copy(dest, src) == 0) { /* Copy OK, we are done */
+            cs_sles_default_aggregation_reuse(dest);
+            cs_sles_set_initial_guess_projection(dest, 4);
+            return;
+          }
+        }
+      }
+      sles_it_type = CS_SLES_FCG;
+      multigrid = 1;
+      aggregation_reuse = true;
+      n_ig_proj = 4;
+    }
   }
 
   /* Final default */
@@ -271,6 +325,13 @@ _sles_default_native(int                f_id,
     }
 
   }
+
+  if (multigrid > 0 && aggregation_reuse)
+    cs_sles_default_aggregation_reuse(cs_sles_find(f_id, name));
+
+  if (n_ig_proj > 0)
+    cs_sles_set_initial_guess_projection(cs_sles_find(f_id, name),
+                                         n_ig_proj);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -397,6 +458,17 @@ _sles_setup_matrix_native(int                  f_id,
   if (need_external == false && cs_get_device_id() > -1)
     need_msr = true;
 
+  /* SELL-C-sigma matrices also provide MSR-type operations, so may be used
+     instead when selected as default, except with multigrid. */
+
+  if (need_msr && mg == nullptr) {
+    cs_matrix_fill_type_t mft = cs_matrix_get_fill_type(symmetric,
+                                                        db_size,
+                                                        eb_size);
+    if (cs_matrix_default_get_type(mft) == CS_MATRIX_SELL)
+      need_msr = false;
+  }
+
   if (need_msr)
     a = cs_matrix_msr(symmetric,
                       db_size,
@@ -508,6 +580,99 @@ _sles_setup_matrix_by_assembler(int               f_id,
   _matrix_setup[setup_id][1] = a; /* so it is freed later */
 }
 
+/*----------------------------------------------------------------------------
+ * Return the setup id associated with a given solver, setting up the
+ * matrix based on native arrays if not already done.
+ *
+ * parameters:
+ *   f_id                  <-- associated field id, or < 0
+ *   name                  <-- associated name if f_id < 0, or nullptr
+ *   sc                    <-- associated solver
+ *   symmetric             <-- indicates if matrix coefficients are symmetric
+ *   diag_block_size       <-- block sizes for diagonal
+ *   extra_diag_block_size <-- block sizes for extra diagonal
+ *   da                    <-- diagonal values (nullptr if zero)
+ *   xa                    <-- extradiagonal values (nullptr if zero)
+ *
+ * returns:
+ *   setup id
+ *----------------------------------------------------------------------------*/
+
+static int
+_sles_setup_native(int                  f_id,
+                   const char          *name,
+                   cs_sles_t           *sc,
+                   bool                 symmetric,
+                   cs_lnum_t            diag_block_size,
+                   cs_lnum_t            extra_diag_block_size,
+                   const cs_real_t     *da,
+                   const cs_real_t     *xa)
+{
+  /* Check if this system has already been setup */
+
+  int setup_id = 0;
+  while (setup_id < _n_setups) {
+    if (_sles_setup[setup_id] == sc)
+      break;
+    else
+      setup_id++;
+  }
+
+  if (setup_id >= _n_setups) {
+
+    _n_setups += 1;
+
+    if (_n_setups > CS_SLES_DEFAULT_N_SETUPS)
+      bft_error
+        (__FILE__, __LINE__, 0,
+         "Too many linear systems solved without calling cs_sles_free_native\n"
+         "  maximum number of systems: %d\n"
+         "If this is not an error, increase CS_SLES_DEFAULT_N_SETUPS\n"
+         "  in file %s.", CS_SLES_DEFAULT_N_SETUPS, __FILE__);
+
+    /* Check if we need to used a matrix assembler */
+
+    bool need_matrix_assembler = false;
+
+    if (f_id > -1) {
+      const cs_field_t *f = cs_field_by_id(f_id);
+      int coupling_id
+        = cs_field_get_key_int(f, cs_field_key_id("coupling_entity"));
+      if (coupling_id > -1)
+        need_matrix_assembler = true;
+    }
+    const char *sles_type = cs_sles_get_type(sc);
+    if (strcmp(sles_type, "cs_sles_amgx_t") == 0) {
+      need_matrix_assembler = true;
+    }
+
+    if (need_matrix_assembler)
+      _sles_setup_matrix_by_assembler(f_id,
+                                      setup_id,
+                                      sc,
+                                      symmetric,
+                                      diag_block_size,
+                                      extra_diag_block_size,
+                                      da,
+                                      xa);
+
+    else
+      _sles_setup_matrix_native(f_id,
+                                name,
+                                setup_id,
+                                sc,
+                                symmetric,
+                                diag_block_size,
+                                extra_diag_block_size,
+                                da,
+                                xa);
+
+    _sles_setup[setup_id] = sc;
+  }
+
+  return setup_id;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -610,6 +775,45 @@ cs_sles_default_finalize(void)
   cs_sles_finalize();
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allow reuse of multigrid coarse grid aggregation for a solver.
+ *
+ * The multigrid may be used either as solver or as preconditioner;
+ * nothing is done if no multigrid is associated with the solver.
+ *
+ * Coarse grids are then kept from one setup to the next, which is
+ * useful for systems solved repeatedly on a fixed mesh connectivity.
+ *
+ * \param[in, out]  sc  pointer to solver object, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_aggregation_reuse(cs_sles_t  *sc)
+{
+  cs_multigrid_t *mg = nullptr;
+
+  if (sc == nullptr)
+    return;
+
+  if (strcmp(cs_sles_get_type(sc), "cs_sles_it_t") == 0) {
+    cs_sles_it_t *c = static_cast<cs_sles_it_t *>(cs_sles_get_context(sc));
+    cs_sles_pc_t *pc = cs_sles_it_get_pc(c);
+    if (pc != nullptr) {
+      if (strcmp(cs_sles_pc_get_type(pc), "multigrid") == 0)
+        mg = static_cast<cs_multigrid_t *>(cs_sles_pc_get_context(pc));
+    }
+  }
+  else if (strcmp(cs_sles_get_type(sc), "cs_multigrid_t") == 0)
+    mg = static_cast<cs_multigrid_t *>(cs_sles_get_context(sc));
+
+  if (mg != nullptr)
+    cs_multigrid_set_aggregation_reuse(mg,
+                                       -1,   /* unlimited reuse */
+                                       2.);  /* rebuild if cycles double */
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return default verbosity associated to a field id, name couple.
@@ -800,65 +1004,9 @@ cs_sles_solve_native(int                  f_id,
 
   cs_sles_t *sc = cs_sles_find_or_add(f_id, name);
 
-  int setup_id = 0;
-  while (setup_id < _n_setups) {
-    if (_sles_setup[setup_id] == sc)
-      break;
-    else
-      setup_id++;
-  }
-
-  if (setup_id >= _n_setups) {
-
-    _n_setups += 1;
-
-    if (_n_setups > CS_SLES_DEFAULT_N_SETUPS)
-      bft_error
-        (__FILE__, __LINE__, 0,
-         "Too many linear systems solved without calling cs_sles_free_native\n"
-         "  maximum number of systems: %d\n"
-         "If this is not an error, increase CS_SLES_DEFAULT_N_SETUPS\n"
-         "  in file %s.", CS_SLES_DEFAULT_N_SETUPS, __FILE__);
-
-    /* Check if we need to used a matrix assembler */
-
-    bool need_matrix_assembler = false;
-
-    if (f_id > -1) {
-      const cs_field_t *f = cs_field_by_id(f_id);
-      int coupling_id
-        = cs_field_get_key_int(f, cs_field_key_id("coupling_entity"));
-      if (coupling_id > -1)
-        need_matrix_assembler = true;
-    }
-    const char *sles_type = cs_sles_get_type(sc);
-    if (strcmp(sles_type, "cs_sles_amgx_t") == 0) {
-      need_matrix_assembler = true;
-    }
-
-    if (need_matrix_assembler)
-      _sles_setup_matrix_by_assembler(f_id,
-                                      setup_id,
-                                      sc,
-                                      symmetric,
-                                      diag_block_size,
-                                      extra_diag_block_size,
-                                      da,
-                                      xa);
-
-    else
-      _sles_setup_matrix_native(f_id,
-                                name,
-                                setup_id,
-                                sc,
-                                symmetric,
-                                diag_block_size,
-                                extra_diag_block_size,
-                                da,
-                                xa);
-
-    _sles_setup[setup_id] = sc;
-  }
+  int setup_id = _sles_setup_native(f_id, name, sc, symmetric,
+                                    diag_block_size, extra_diag_block_size,
+                                    da, xa);
 
   a = _matrix_setup[setup_id][0];
 
@@ -916,6 +1064,117 @@ cs_sles_solve_native(int                  f_id,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call sparse linear equation solver using native matrix arrays,
+ *        for multiple right-hand sides sharing the same matrix.
+ *
+ * This is intended for ensembles of variants of a same case (for example
+ * with different boundary condition or source term values), for which
+ * the matrix, its structure and the solver setup (such as a multigrid
+ * hierarchy) are shared by all members. Right-hand sides and solutions
+ * are interleaved, as for \ref cs_sles_solve_multi.
+ *
+ * \param[in]       f_id                   associated field id, or < 0
+ * \param[in]       name                   associated name if f_id < 0, or nullptr
+ * \param[in]       symmetric              indicates if matrix coefficients
+ *                                         are symmetric
+ * \param[in]       diag_block_size        block sizes for diagonal
+ * \param[in]       extra_diag_block_size  block sizes for extra diagonal
+ * \param[in]       da                     diagonal values (nullptr if zero)
+ * \param[in]       xa                     extradiagonal values (nullptr if zero)
+ * \param[in]       n_rhs                  number of right-hand sides
+ * \param[in]       precision              solver precision
+ * \param[in]       r_norm                 residual normalization,
+ *                                         per right-hand side
+ * \param[out]      n_iter                 number of "equivalent" iterations,
+ *                                         per right-hand side
+ * \param[out]      residual               residual, per right-hand side
+ * \param[in]       rhs                    interleaved right hand sides
+ * \param[in, out]  vx                     interleaved system solutions
+ *                                         (sized for n_rhs * n_cells_ext
+ *                                         * diag_block_size values)
+ *
+ * \return  convergence state (worst over all right-hand sides)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_native_multi(int                  f_id,
+                           const char          *name,
+                           bool                 symmetric,
+                           cs_lnum_t            diag_block_size,
+                           cs_lnum_t            extra_diag_block_size,
+                           const cs_real_t     *da,
+                           const cs_real_t     *xa,
+                           int                  n_rhs,
+                           double               precision,
+                           const double         r_norm[],
+                           int                  n_iter[],
+                           double               residual[],
+                           const cs_real_t     *rhs,
+                           cs_real_t           *vx)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  cs_sles_t *sc = cs_sles_find_or_add(f_id, name);
+
+  int setup_id = _sles_setup_native(f_id, name, sc, symmetric,
+                                    diag_block_size, extra_diag_block_size,
+                                    da, xa);
+
+  cs_matrix_t *a = _matrix_setup[setup_id][0];
+
+  /* If system uses specific halo, allocate specific buffers
+     and synchronize right hand sides. */
+
+  cs_real_t *_vx = vx, *_rhs = nullptr;
+  const cs_real_t *rhs_p = rhs;
+
+  const int stride = diag_block_size*n_rhs;
+  const cs_lnum_t _n_rows = cs_matrix_get_n_rows(a)*stride;
+
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+  if (halo != nullptr && halo != m->halo) {
+
+    cs_lnum_t n_cols_ext = cs_matrix_get_n_columns(a);
+    BFT_MALLOC(_rhs, n_cols_ext*stride, cs_real_t);
+    BFT_MALLOC(_vx, n_cols_ext*stride, cs_real_t);
+#   pragma omp parallel for  if(_n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < _n_rows; i++) {
+      _rhs[i] = rhs[i];
+      _vx[i] = vx[i];
+    }
+    cs_halo_sync_var_strided(halo, CS_HALO_STANDARD, _rhs, stride);
+    rhs_p = _rhs;
+
+  }
+
+  /* Solve systems */
+
+  cvg = cs_sles_solve_multi(sc,
+                            a,
+                            n_rhs,
+                            precision,
+                            r_norm,
+                            n_iter,
+                            residual,
+                            rhs_p,
+                            _vx);
+
+  BFT_FREE(_rhs);
+  if (_vx != vx) {
+#   pragma omp parallel for  if(_n_rows > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < _n_rows; i++)
+      vx[i] = _vx[i];
+    BFT_FREE(_vx);
+  }
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free sparse linear equation solver setup using native matrix arrays.
@@ -86,6 +86,19 @@ cs_sles_default(int                 f_id,
 void
 cs_sles_default_setup(void);
 
+/*----------------------------------------------------------------------------
+ * Allow reuse of multigrid coarse grid aggregation for a solver.
+ *
+ * The multigrid may be used either as solver or as preconditioner;
+ * nothing is done if no multigrid is associated with the solver.
+ *
+ * parameters:
+ *   sc <-> pointer to solver object, or NULL
+ *----------------------------------------------------------------------------*/
+
+void
+cs_sles_default_aggregation_reuse(cs_sles_t  *sc);
+
 /*----------------------------------------------------------------------------
  * Return default verbosity associated to a field id, name couple.
  *
@@ -171,6 +184,50 @@ cs_sles_solve_native(int                  f_id,
                      const cs_real_t     *rhs,
                      cs_real_t           *vx);
 
+/*----------------------------------------------------------------------------
+ * Call sparse linear equation solver using native matrix arrays,
+ * for multiple right-hand sides sharing the same matrix.
+ *
+ * This is intended for ensembles of variants of a same case, for which
+ * the matrix and solver setup are shared by all members. Right-hand sides
+ * and solutions are interleaved, as for cs_sles_solve_multi.
+ *
+ * parameters:
+ *   f_id                   <-- associated field id, or < 0
+ *   name                   <-- associated name if f_id < 0, or NULL
+ *   symmetric              <-- indicates if matrix coefficients are symmetric
+ *   diag_block_size        <-- block sizes for diagonal
+ *   extra_diag_block_size  <-- block sizes for extra diagonal
+ *   da                     <-- diagonal values (NULL if zero)
+ *   xa                     <-- extradiagonal values (NULL if zero)
+ *   n_rhs                  <-- number of right-hand sides
+ *   precision              <-- precision
+ *   r_norm                 <-- residual normalization, per right-hand side
+ *   n_iter                 --> number of iterations, per right-hand side
+ *   residual               --> residual, per right-hand side
+ *   rhs                    <-- interleaved right hand sides
+ *   vx                     <-> interleaved system solutions
+ *
+ * returns:
+ *   convergence state (worst over all right-hand sides)
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_solve_native_multi(int                  f_id,
+                           const char          *name,
+                           bool                 symmetric,
+                           cs_lnum_t            diag_block_size,
+                           cs_lnum_t            extra_diag_block_size,
+                           const cs_real_t     *da,
+                           const cs_real_t     *xa,
+                           int                  n_rhs,
+                           double               precision,
+                           const double         r_norm[],
+                           int                  n_iter[],
+                           double               residual[],
+                           const cs_real_t     *rhs,
+                           cs_real_t           *vx);
+
 /*----------------------------------------------------------------------------
  * Free sparse linear equation solver setup using native matrix arrays.
  *
@@ -46,6 +46,7 @@
  * Local headers
  *----------------------------------------------------------------------------*/
 
+#include "cs_matrix_spmv.h"
 #include "cs_parall.h"
 
 /*----------------------------------------------------------------------------
@@ -111,6 +112,11 @@ BEGIN_C_DECLS
 
 #define CS_SIMD_SIZE(s) (((s-1)/16+1)*16)
 
+/* Maximum dimension of the subspace (deflation vectors and harvested
+   search directions) used by deflated conjugate gradient */
+
+#define CS_SLES_IT_DEFLATION_DIM_MAX 48
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
@@ -143,10 +149,13 @@ const char *cs_sles_it_type_name[]
      N_("Gauss-Seidel"),
      N_("Symmetric Gauss-Seidel"),
      N_("3-layer conjugate residual"),
+     N_("Pipelined Conjugate Gradient"),
+     N_("Deflated Conjugate Gradient"),
      N_("User-defined iterative solver"),
      N_("None"), /* Smoothers beyond this */
      N_("Truncated forward Gauss-Seidel"),
      N_("Truncated backwards Gauss-Seidel"),
+     N_("Chebyshev polynomial"),
 };
 
 /*=============================================================================
@@ -1529,14 +1538,76 @@ _conjugate_gradient_npc_sr(cs_sles_it_t              *c,
 }
 
 /*----------------------------------------------------------------------------
- * Solution of A.vx = Rhs using preconditioned 3-layer conjugate residual.
+ * Start computation of 3 dot products for pipelined conjugate gradient,
+ * summing result over all ranks.
+ *
+ * The global sum is started using a non-blocking reduction when possible,
+ * so that it may be overlapped with the preconditioning and matrix.vector
+ * product; _dot_products_pipelined_end must be called before using the
+ * results.
+ *
+ * parameters:
+ *   c       <-- pointer to solver context info
+ *   r       <-- residual
+ *   u       <-- preconditioned residual
+ *   w       <-- matrix.vector product of preconditioned residual
+ *   s       --> s[0] = r.r, s[1] = r.u, s[2] = u.w
+ *   request --> associated request (MPI_REQUEST_NULL if completed)
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+inline static void
+_dot_products_pipelined_start(const cs_sles_it_t  *c,
+                              const cs_real_t     *r,
+                              const cs_real_t     *u,
+                              const cs_real_t     *w,
+                              double               s[3],
+                              MPI_Request         *request)
+{
+  cs_dot_xx_xy_yz(c->setup_data->n_rows, r, u, w, s, s+1, s+2);
+
+  *request = MPI_REQUEST_NULL;
+
+  if (c->comm != MPI_COMM_NULL) {
+#if (MPI_VERSION >= 3)
+    MPI_Iallreduce(MPI_IN_PLACE, s, 3, MPI_DOUBLE, MPI_SUM, c->comm, request);
+#else
+    MPI_Allreduce(MPI_IN_PLACE, s, 3, MPI_DOUBLE, MPI_SUM, c->comm);
+#endif
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Complete computation of 3 dot products for pipelined conjugate gradient.
+ *
+ * parameters:
+ *   request <-> associated request
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_dot_products_pipelined_end(MPI_Request  *request)
+{
+  if (*request != MPI_REQUEST_NULL)
+    MPI_Wait(request, MPI_STATUS_IGNORE);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned conjugate gradient.
+ *
+ * This variant, described in \cite Ghysels:2014, requires a single global
+ * reduction per iteration, which is overlapped with the preconditioning
+ * and matrix.vector product, at the cost of additional vector updates
+ * and slightly reduced numerical stability compared to standard PCG.
  *
  * On entry, vx is considered initialized.
  *
  * parameters:
  *   c               <-- pointer to solver context info
  *   a               <-- matrix
- *   diag_block_size <-- block size of element ii, ii
+ *   diag_block_size <-- diagonal block size
  *   convergence     <-- convergence information structure
  *   rhs             <-- right hand side
  *   vx_ini          <-- initial system solution
@@ -1550,24 +1621,22 @@ _conjugate_gradient_npc_sr(cs_sles_it_t              *c,
  *----------------------------------------------------------------------------*/
 
 static cs_sles_convergence_state_t
-_conjugate_residual_3(cs_sles_it_t              *c,
-                      const cs_matrix_t         *a,
-                      cs_lnum_t                  diag_block_size,
-                      cs_sles_it_convergence_t  *convergence,
-                      const cs_real_t           *rhs,
-                      cs_real_t                 *restrict vx_ini,
-                      cs_real_t                 *restrict vx,
-                      size_t                     aux_size,
-                      void                      *aux_vectors)
+_conjugate_gradient_pipelined(cs_sles_it_t              *c,
+                              const cs_matrix_t         *a,
+                              cs_lnum_t                  diag_block_size,
+                              cs_sles_it_convergence_t  *convergence,
+                              const cs_real_t           *rhs,
+                              cs_real_t                 *restrict vx_ini,
+                              cs_real_t                 *restrict vx,
+                              size_t                     aux_size,
+                              void                      *aux_vectors)
 {
-  cs_sles_convergence_state_t cvg;
-  double  residual;
-  double  ak, bk, ck, dk, ek, denom, alpha, tau;
-  cs_real_t *_aux_vectors;
-  cs_real_t  *restrict vxm1;
-  cs_real_t  *restrict rk, *restrict rkm1;
-  cs_real_t  *restrict wk, *restrict zk;
-  cs_real_t  *restrict tmp;
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  double  gamma_km1 = 0, alpha_km1 = 0;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict uk, *restrict wk, *restrict mk;
+  cs_real_t  *restrict nk, *restrict zk, *restrict qk, *restrict sk;
+  cs_real_t  *restrict pk;
 
   unsigned n_iter = 0;
 
@@ -1580,7 +1649,7 @@ _conjugate_residual_3(cs_sles_it_t              *c,
 
   {
     const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
-    const size_t n_wa = 6;
+    const size_t n_wa = 9;
     const size_t wa_size = CS_SIMD_SIZE(n_cols);
 
     if (aux_vectors == nullptr || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
@@ -1588,115 +1657,1467 @@ _conjugate_residual_3(cs_sles_it_t              *c,
     else
       _aux_vectors = static_cast<cs_real_t *>(aux_vectors);
 
-    vxm1 = _aux_vectors;
-    rk = _aux_vectors + wa_size;
-    rkm1 = _aux_vectors + wa_size*2;
-    tmp = _aux_vectors + wa_size*3;
-    wk = _aux_vectors + wa_size*4;
+    rk = _aux_vectors;
+    uk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    mk = _aux_vectors + wa_size*3;
+    nk = _aux_vectors + wa_size*4;
     zk = _aux_vectors + wa_size*5;
-
-#   pragma omp parallel for if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-      vxm1[ii] = vx[ii];
-      rkm1[ii] = 0.0;
-    }
+    qk = _aux_vectors + wa_size*6;
+    sk = _aux_vectors + wa_size*7;
+    pk = _aux_vectors + wa_size*8;
   }
 
   /* Initialize iterative calculation */
   /*----------------------------------*/
 
-  /* Residual */
+  /* Residual rk = b - A.x0 */
 
   if (vx_ini == vx) {
     cs_matrix_vector_multiply(a, vx, rk);  /* rk = A.x0 */
 
 #   pragma omp parallel for if(n_rows > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-      rk[ii] -= rhs[ii];
+      rk[ii] = rhs[ii] - rk[ii];
   }
   else {
 #   pragma omp parallel for if(n_rows > CS_THR_MIN)
     for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-      rk[ii] = -rhs[ii];
+      rk[ii] = rhs[ii];
       vx[ii] = 0.;
     }
   }
 
-  residual = _dot_product(c, rk, rk);
-  residual = sqrt(residual);
+  /* Preconditioning and matrix.vector product */
 
-  /* If no solving required, finish here */
+  c->setup_data->pc_apply(c->setup_data->pc_context, rk, uk);
 
-  c->setup_data->initial_residual = residual;
-  cvg = _convergence_test(c, n_iter, residual, convergence);
+  cs_matrix_vector_multiply(a, uk, wk);
 
-  /* Current Iteration */
+  /* Current iteration */
   /*-------------------*/
 
   while (cvg == CS_SLES_ITERATING) {
 
-    /* Preconditionning */
+    double s[3];
 
-    c->setup_data->pc_apply(c->setup_data->pc_context, rk, wk);
+    /* Start global reduction of rk.rk, rk.uk and uk.wk */
 
-    cs_matrix_vector_multiply(a, wk, zk);
+#if defined(HAVE_MPI)
+    MPI_Request request;
+    _dot_products_pipelined_start(c, rk, uk, wk, s, &request);
+#else
+    cs_dot_xx_xy_yz(n_rows, rk, uk, wk, s, s+1, s+2);
+#endif
 
-    _dot_products_xy_yz(c, rk, zk, rkm1, &ak, &bk);
+    /* Overlap with preconditioning and matrix.vector product */
 
-#   pragma omp parallel for if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
-      tmp[ii] = rk[ii] - rkm1[ii];
+    c->setup_data->pc_apply(c->setup_data->pc_context, wk, mk);
 
-    _dot_products_xy_yz(c, rk, tmp, rkm1, &ck, &dk);
+    cs_matrix_vector_multiply(a, mk, nk);
 
-    ek = _dot_product_xx(c, zk);
+#if defined(HAVE_MPI)
+    _dot_products_pipelined_end(&request);
+#endif
 
-    denom = (ck-dk)*ek - ((ak-bk)*(ak-bk));
+    double residual = sqrt(s[0]);
+    double gamma_k = s[1], delta_k = s[2];
 
-    if (fabs(denom) < 1.e-30)
-      alpha = 1.0;
-    else
-      alpha = ((ak-bk)*bk - dk*ek)/denom;
+    /* Convergence test for end of previous iteration */
 
-    if (fabs(alpha) < 1.e-30 || fabs(alpha - 1.) < 1.e-30) {
-      alpha = 1.0;
-      tau = ak/ek;
+    if (n_iter == 0)
+      c->setup_data->initial_residual = residual;
+
+    cvg = _convergence_test(c, n_iter, residual, convergence);
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    /* Descent parameters */
+
+    double beta_k = 0, alpha_k = 0;
+
+    if (n_iter > 0) {
+      beta_k = (CS_ABS(gamma_km1) > DBL_MIN) ? gamma_k / gamma_km1 : 0.;
+      double d = delta_k;
+      if (CS_ABS(alpha_km1) > DBL_MIN)
+        d -= beta_k * gamma_k / alpha_km1;
+      alpha_k = (CS_ABS(d) > DBL_MIN) ? gamma_k / d : 0.;
     }
     else
-      tau = ak/ek + ((1 - alpha)/alpha) * bk/ek;
+      alpha_k = (CS_ABS(delta_k) > DBL_MIN) ? gamma_k / delta_k : 0.;
 
-    cs_real_t c0 = (1 - alpha);
-    cs_real_t c1 = -alpha*tau;
+    gamma_km1 = gamma_k;
+    alpha_km1 = alpha_k;
 
-#   pragma omp parallel firstprivate(alpha, tau, c0, c1) if(n_rows > CS_THR_MIN)
-    {
-#     pragma omp for nowait
+    /* Update recurrences */
+
+    if (n_iter > 0) {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-        cs_real_t trk = rk[ii];
-        rk[ii] = alpha*rk[ii] + c0*rkm1[ii] + c1*zk[ii];
-        rkm1[ii] = trk;
+        zk[ii] = nk[ii] + beta_k * zk[ii];
+        qk[ii] = mk[ii] + beta_k * qk[ii];
+        sk[ii] = wk[ii] + beta_k * sk[ii];
+        pk[ii] = uk[ii] + beta_k * pk[ii];
+        vx[ii] += alpha_k * pk[ii];
+        rk[ii] -= alpha_k * sk[ii];
+        uk[ii] -= alpha_k * qk[ii];
+        wk[ii] -= alpha_k * zk[ii];
+      }
+    }
+    else {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        zk[ii] = nk[ii];
+        qk[ii] = mk[ii];
+        sk[ii] = wk[ii];
+        pk[ii] = uk[ii];
+        vx[ii] += alpha_k * pk[ii];
+        rk[ii] -= alpha_k * sk[ii];
+        uk[ii] -= alpha_k * qk[ii];
+        wk[ii] -= alpha_k * zk[ii];
+      }
+    }
+
+    n_iter += 1;
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Cholesky factorization of a small dense symmetric matrix.
+ *
+ * The lower triangular factor replaces the lower part of the matrix.
+ *
+ * parameters:
+ *   n  <-- matrix size
+ *   a  <-> matrix (row-major), replaced by factor
+ *
+ * returns:
+ *   true if factorization succeeded, false if matrix is not
+ *   (numerically) positive definite
+ *----------------------------------------------------------------------------*/
+
+static bool
+_deflation_cholesky(int      n,
+                    double  *a)
+{
+  for (int j = 0; j < n; j++) {
+    double d = a[j*n + j];
+    for (int k = 0; k < j; k++)
+      d -= a[j*n + k]*a[j*n + k];
+    if (d <= DBL_EPSILON*CS_ABS(a[j*n + j]) || d <= 0)
+      return false;
+    d = sqrt(d);
+    a[j*n + j] = d;
+    for (int i = j+1; i < n; i++) {
+      double s = a[i*n + j];
+      for (int k = 0; k < j; k++)
+        s -= a[i*n + k]*a[j*n + k];
+      a[i*n + j] = s / d;
+    }
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Solve L.L^t.x = b using a Cholesky factor.
+ *
+ * parameters:
+ *   n  <-- matrix size
+ *   l  <-- Cholesky factor (lower part, row-major)
+ *   x  <-> right-hand side in, solution out
+ *----------------------------------------------------------------------------*/
+
+static void
+_deflation_cholesky_solve(int            n,
+                          const double  *l,
+                          double        *x)
+{
+  for (int i = 0; i < n; i++) {
+    for (int k = 0; k < i; k++)
+      x[i] -= l[i*n + k]*x[k];
+    x[i] /= l[i*n + i];
+  }
+  for (int i = n-1; i >= 0; i--) {
+    for (int k = i+1; k < n; k++)
+      x[i] -= l[k*n + i]*x[k];
+    x[i] /= l[i*n + i];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Eigenvalues and eigenvectors of a small dense symmetric matrix,
+ * using the cyclic Jacobi method.
+ *
+ * parameters:
+ *   n   <-- matrix size
+ *   a   <-> matrix (row-major), destroyed
+ *   v   --> eigenvectors (column j for eigenvalue j, row-major)
+ *   ev  --> eigenvalues
+ *----------------------------------------------------------------------------*/
+
+static void
+_deflation_sym_eigen(int      n,
+                     double  *a,
+                     double  *v,
+                     double  *ev)
+{
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++)
+      v[i*n + j] = (i == j) ? 1. : 0.;
+  }
+
+  for (int sweep = 0; sweep < 50; sweep++) {
+
+    double off = 0, diag = 0;
+    for (int i = 0; i < n; i++) {
+      diag += a[i*n + i]*a[i*n + i];
+      for (int j = i+1; j < n; j++)
+        off += a[i*n + j]*a[i*n + j];
+    }
+    if (off <= 1e-30*diag || off <= DBL_MIN)
+      break;
+
+    for (int p = 0; p < n; p++) {
+      for (int q = p+1; q < n; q++) {
+        double apq = a[p*n + q];
+        if (CS_ABS(apq) <= DBL_MIN)
+          continue;
+        double theta = 0.5*(a[q*n + q] - a[p*n + p]) / apq;
+        double t = 1. / (CS_ABS(theta) + sqrt(theta*theta + 1.));
+        if (theta < 0)
+          t = -t;
+        double cs = 1. / sqrt(t*t + 1.), sn = t*cs;
+        for (int k = 0; k < n; k++) {
+          double akp = a[k*n + p], akq = a[k*n + q];
+          a[k*n + p] = cs*akp - sn*akq;
+          a[k*n + q] = sn*akp + cs*akq;
+        }
+        for (int k = 0; k < n; k++) {
+          double apk = a[p*n + k], aqk = a[q*n + k];
+          a[p*n + k] = cs*apk - sn*aqk;
+          a[q*n + k] = sn*apk + cs*aqk;
+        }
+        for (int k = 0; k < n; k++) {
+          double vkp = v[k*n + p], vkq = v[k*n + q];
+          v[k*n + p] = cs*vkp - sn*vkq;
+          v[k*n + q] = sn*vkp + cs*vkq;
+        }
+      }
+    }
+
+  }
+
+  for (int i = 0; i < n; i++)
+    ev[i] = a[i*n + i];
+}
+
+/*----------------------------------------------------------------------------
+ * Sum an array of values over all ranks.
+ *
+ * parameters:
+ *   c  <-- pointer to solver context info
+ *   n  <-- number of values
+ *   s  <-> values
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_deflation_sum(const cs_sles_it_t  *c,
+               int                  n,
+               double               s[])
+{
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL)
+    MPI_Allreduce(MPI_IN_PLACE, s, n, MPI_DOUBLE, MPI_SUM, c->comm);
+
+#else
+
+  CS_UNUSED(c);
+  CS_UNUSED(n);
+  CS_UNUSED(s);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Update the deflation space using a Rayleigh-Ritz procedure.
+ *
+ * Given the subspace S spanned by the current deflation vectors and the
+ * search directions harvested during a solve, the Ritz vectors associated
+ * with the smallest Ritz values of A on S replace the deflation vectors.
+ *
+ * As search directions are A-conjugate (and A-orthogonal to the deflation
+ * vectors), S^t.A.S is close to diagonal, so the generalized eigenproblem
+ * S^t.S.y = lambda S^t.A.S.y is solved for the largest values of
+ * lambda = 1/theta, which is better conditioned than using S^t.S.
+ *
+ * parameters:
+ *   c       <-- pointer to solver context info
+ *   n_rows  <-- number of rows
+ *   n_s     <-- number of subspace vectors
+ *   sv      <-- subspace vectors (the n_vecs first are deflation vectors)
+ *   asv     <-- matching matrix.vector products
+ *----------------------------------------------------------------------------*/
+
+static void
+_deflation_update(cs_sles_it_t        *c,
+                  cs_lnum_t            n_rows,
+                  int                  n_s,
+                  const cs_real_t     *sv[],
+                  const cs_real_t     *asv[])
+{
+  cs_sles_it_deflation_t *d = c->deflation;
+
+  const int n_pairs = n_s*(n_s+1)/2;
+  const cs_lnum_t block_size = 128;
+  const cs_lnum_t n_blocks = (n_rows + block_size - 1) / block_size;
+
+  double *gf;
+  BFT_MALLOC(gf, 2*n_pairs, double);
+  for (int i = 0; i < 2*n_pairs; i++)
+    gf[i] = 0;
+
+  /* Compute upper parts of S^t.A.S and S^t.S (blocked for cache reuse) */
+
+# pragma omp parallel if(n_rows > CS_THR_MIN)
+  {
+    double _gf[CS_SLES_IT_DEFLATION_DIM_MAX*(CS_SLES_IT_DEFLATION_DIM_MAX+1)];
+    for (int i = 0; i < 2*n_pairs; i++)
+      _gf[i] = 0;
+
+#   pragma omp for
+    for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+      cs_lnum_t s_id = b_id*block_size;
+      cs_lnum_t e_id = CS_MIN(s_id + block_size, n_rows);
+      int k = 0;
+      for (int i = 0; i < n_s; i++) {
+        const cs_real_t *si = sv[i];
+        for (int j = i; j < n_s; j++) {
+          const cs_real_t *sj = sv[j], *asj = asv[j];
+          double sg = 0, sf = 0;
+          for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+            sg += si[ii]*asj[ii];
+            sf += si[ii]*sj[ii];
+          }
+          _gf[k] += sg;
+          _gf[n_pairs + k] += sf;
+          k++;
+        }
+      }
+    }
+
+#   pragma omp critical
+    for (int i = 0; i < 2*n_pairs; i++)
+      gf[i] += _gf[i];
+  }
+
+  _deflation_sum(c, 2*n_pairs, gf);
+
+  /* Build symmetric matrices with diagonal scaling of S^t.A.S */
+
+  double *g, *f, *v, *ev, *scale;
+  BFT_MALLOC(g, n_s*n_s, double);
+  BFT_MALLOC(f, n_s*n_s, double);
+  BFT_MALLOC(v, n_s*n_s, double);
+  BFT_MALLOC(ev, n_s, double);
+  BFT_MALLOC(scale, n_s, double);
+
+  {
+    int k = 0;
+    for (int i = 0; i < n_s; i++) {
+      for (int j = i; j < n_s; j++) {
+        g[i*n_s + j] = gf[k];
+        g[j*n_s + i] = gf[k];
+        f[i*n_s + j] = gf[n_pairs + k];
+        f[j*n_s + i] = gf[n_pairs + k];
+        k++;
+      }
+    }
+  }
+
+  BFT_FREE(gf);
+
+  bool valid = true;
+
+  for (int i = 0; i < n_s; i++) {
+    if (g[i*n_s + i] <= DBL_MIN) {
+      valid = false;
+      break;
+    }
+    scale[i] = 1. / sqrt(g[i*n_s + i]);
+  }
+
+  if (valid) {
+    for (int i = 0; i < n_s; i++) {
+      for (int j = 0; j < n_s; j++) {
+        g[i*n_s + j] *= scale[i]*scale[j];
+        f[i*n_s + j] *= scale[i]*scale[j];
+      }
+    }
+    valid = _deflation_cholesky(n_s, g);
+  }
+
+  /* If S^t.A.S is not positive definite, keep previous deflation space */
+
+  if (valid) {
+
+    /* C = L^-1.F.L^-t, computed in place in f */
+
+    for (int j = 0; j < n_s; j++) {          /* columns: F <- L^-1.F */
+      for (int i = 0; i < n_s; i++) {
+        for (int k = 0; k < i; k++)
+          f[i*n_s + j] -= g[i*n_s + k]*f[k*n_s + j];
+        f[i*n_s + j] /= g[i*n_s + i];
+      }
+    }
+    for (int i = 0; i < n_s; i++) {          /* rows: F <- F.L^-t */
+      for (int j = 0; j < n_s; j++) {
+        for (int k = 0; k < j; k++)
+          f[i*n_s + j] -= g[j*n_s + k]*f[i*n_s + k];
+        f[i*n_s + j] /= g[j*n_s + j];
+      }
+    }
+    for (int i = 0; i < n_s; i++) {
+      for (int j = i+1; j < n_s; j++) {
+        double m = 0.5*(f[i*n_s + j] + f[j*n_s + i]);
+        f[i*n_s + j] = m;
+        f[j*n_s + i] = m;
+      }
+    }
+
+    _deflation_sym_eigen(n_s, f, v, ev);
+
+    /* Select largest lambda (smallest Ritz values), and compute
+       y = D.L^-t.v / sqrt(lambda) so that Ritz vectors have unit norm */
+
+    int n_w = CS_MIN(d->n_max_vecs, n_s);
+    int *sel;
+    double *y;
+    BFT_MALLOC(sel, n_w, int);
+    BFT_MALLOC(y, n_s*n_w, double);
+
+    int n_sel = 0;
+    for (int l = 0; l < n_w; l++) {
+      int i_max = -1;
+      for (int i = 0; i < n_s; i++) {
+        bool used = false;
+        for (int k = 0; k < n_sel; k++) {
+          if (sel[k] == i)
+            used = true;
+        }
+        if (!used && ev[i] > 0 && (i_max < 0 || ev[i] > ev[i_max]))
+          i_max = i;
+      }
+      if (i_max < 0 || (n_sel > 0 && ev[i_max] < 1e-12*ev[sel[0]]))
+        break;
+      sel[n_sel] = i_max;
+
+      double *yl = y + n_sel*n_s;
+      for (int i = n_s-1; i >= 0; i--) {
+        double s = v[i*n_s + i_max];
+        for (int k = i+1; k < n_s; k++)
+          s -= g[k*n_s + i]*yl[k];
+        yl[i] = s / g[i*n_s + i];
+      }
+      double r_scale = 1. / sqrt(ev[i_max]);
+      for (int i = 0; i < n_s; i++)
+        yl[i] *= scale[i]*r_scale;
+
+      n_sel++;
+    }
+
+    /* Compute new deflation vectors W = S.Y row by row, so as to allow
+       the previous deflation vectors to be overwritten */
+
+    const cs_lnum_t w_stride = d->stride;
+    cs_real_t *w = d->w;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      double t[CS_SLES_IT_DEFLATION_DIM_MAX];
+      for (int l = 0; l < n_sel; l++) {
+        const double *yl = y + l*n_s;
+        t[l] = 0;
+        for (int i = 0; i < n_s; i++)
+          t[l] += sv[i][ii]*yl[i];
+      }
+      for (int l = 0; l < n_sel; l++)
+        w[l*w_stride + ii] = t[l];
+    }
+
+    d->n_vecs = n_sel;
+
+    BFT_FREE(y);
+    BFT_FREE(sel);
+  }
+
+  BFT_FREE(scale);
+  BFT_FREE(ev);
+  BFT_FREE(v);
+  BFT_FREE(f);
+  BFT_FREE(g);
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using deflated preconditioned conjugate gradient
+ * with a recycled subspace.
+ *
+ * This variant, based on \cite Saad:2000, uses a set of approximate
+ * eigenvectors W associated with the smallest eigenvalues of A, kept
+ * between successive calls for the same system. The initial guess is
+ * corrected so that the residual is orthogonal to W, and search directions
+ * are kept A-orthogonal to W, removing the associated part of the spectrum
+ * from the convergence. The first search directions of each solve are
+ * then used to update W through a Rayleigh-Ritz procedure, so that the
+ * deflation space improves over successive similar solves (such as
+ * pressure solves at successive time steps). Matrix coefficients may
+ * vary between solves, as W^t.A.W is recomputed for each solve.
+ *
+ * The additional dot products required by the projection are grouped with
+ * those of the residual, so the number of global reductions per iteration
+ * is the same as for standard PCG, at the cost of one additional
+ * preconditioning for the last iteration.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_conjugate_gradient_deflated(cs_sles_it_t              *c,
+                             const cs_matrix_t         *a,
+                             cs_lnum_t                  diag_block_size,
+                             cs_sles_it_convergence_t  *convergence,
+                             const cs_real_t           *rhs,
+                             cs_real_t                 *restrict vx_ini,
+                             cs_real_t                 *restrict vx,
+                             size_t                     aux_size,
+                             void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg;
+  double  ro_0, ro_1, alpha, beta, residual, rk_gkm1 = 0;
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict dk, *restrict gk, *restrict zk;
+  cs_real_t  *aw, *hp, *hq;
+
+  unsigned n_iter = 0;
+
+  assert(c->setup_data != nullptr && c->deflation != nullptr);
+
+  cs_sles_it_deflation_t *d = c->deflation;
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+  const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+  /* Deflation vectors are dropped if the system size changed */
+
+  if (   d->w != nullptr
+      && (d->n_rows != n_rows || d->stride != (cs_lnum_t)wa_size)) {
+    BFT_FREE(d->w);
+    d->n_vecs = 0;
+  }
+  if (d->w == nullptr) {
+    BFT_MALLOC(d->w, wa_size*d->n_max_vecs, cs_real_t);
+    d->n_rows = n_rows;
+    d->stride = wa_size;
+    d->n_vecs = 0;
+  }
+
+  const int n_max_vecs = d->n_max_vecs;
+  const int n_harvest = d->n_harvest;
+  int n_vecs = d->n_vecs;
+  cs_real_t *w = d->w;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  {
+    const size_t n_wa = 4 + n_max_vecs + 2*n_harvest;
+
+    if (aux_vectors == nullptr || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = static_cast<cs_real_t *>(aux_vectors);
+
+    rk = _aux_vectors;
+    dk = _aux_vectors + wa_size;
+    gk = _aux_vectors + wa_size*2;
+    zk = _aux_vectors + wa_size*3;
+    aw = _aux_vectors + wa_size*4;
+    hp = aw + wa_size*n_max_vecs;
+    hq = hp + wa_size*n_harvest;
+  }
+
+  double e[CS_SLES_IT_DEFLATION_DIM_MAX*CS_SLES_IT_DEFLATION_DIM_MAX];
+  double s[2 + CS_SLES_IT_DEFLATION_DIM_MAX];
+
+  /* Setup coarse operator E = W^t.A.W */
+  /*-----------------------------------*/
+
+  if (n_vecs > 0) {
+
+    for (int j = 0; j < n_vecs; j++)
+      cs_matrix_vector_multiply(a, w + j*wa_size, aw + j*wa_size);
+
+    for (int i = 0; i < n_vecs; i++) {
+      for (int j = i; j < n_vecs; j++)
+        e[i*n_vecs + j] = cs_dot(n_rows, w + i*wa_size, aw + j*wa_size);
+    }
+    _deflation_sum(c, n_vecs*n_vecs, e);
+    for (int i = 0; i < n_vecs; i++) {
+      for (int j = i+1; j < n_vecs; j++)
+        e[j*n_vecs + i] = e[i*n_vecs + j];
+    }
+
+    if (_deflation_cholesky(n_vecs, e) == false) {
+      n_vecs = 0;
+      d->n_vecs = 0;
+    }
+
+  }
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Residual */
+
+  if (vx_ini == vx) {
+    cs_matrix_vector_multiply(a, vx, rk);  /* rk = A.x0 */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      rk[ii] -= rhs[ii];
+  }
+  else {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      rk[ii] = -rhs[ii];
+      vx[ii] = 0.;
+    }
+  }
+
+  /* Deflated initial guess: x -= W.E^-1.W^t.r, r -= A.W.E^-1.W^t.r */
+
+  if (n_vecs > 0) {
+
+    for (int j = 0; j < n_vecs; j++)
+      s[j] = cs_dot(n_rows, w + j*wa_size, rk);
+    _deflation_sum(c, n_vecs, s);
+    _deflation_cholesky_solve(n_vecs, e, s);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      for (int j = 0; j < n_vecs; j++) {
+        vx[ii] -= s[j]*w[j*wa_size + ii];
+        rk[ii] -= s[j]*aw[j*wa_size + ii];
+      }
+    }
+
+  }
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  while (true) {
+
+    /* Preconditioning */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context, rk, gk);
+
+    /* Residual, descent parameter, and projection dot products */
+
+    cs_dot_xx_xy(n_rows, rk, gk, s, s+1);
+    for (int j = 0; j < n_vecs; j++)
+      s[2+j] = cs_dot(n_rows, aw + j*wa_size, gk);
+    _deflation_sum(c, 2 + n_vecs, s);
+
+    residual = sqrt(s[0]);
+
+    if (n_iter == 0)
+      c->setup_data->initial_residual = residual;
+
+    cvg = _convergence_test(c, n_iter, residual, convergence);
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    n_iter += 1;
+
+    /* Descent direction, A-orthogonal to W */
+
+    beta = (n_iter > 1 && CS_ABS(rk_gkm1) > DBL_MIN) ? s[1] / rk_gkm1 : 0.;
+    rk_gkm1 = s[1];
+
+    double *mu = s + 2;
+    if (n_vecs > 0)
+      _deflation_cholesky_solve(n_vecs, e, mu);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      double dki = gk[ii] + (beta * dk[ii]);
+      for (int j = 0; j < n_vecs; j++)
+        dki -= mu[j]*w[j*wa_size + ii];
+      dk[ii] = dki;
+    }
+
+    cs_matrix_vector_multiply(a, dk, zk);
+
+    _dot_products_xy_yz(c, rk, dk, zk, &ro_0, &ro_1);
+
+    cs_real_t d_ro_1 = (CS_ABS(ro_1) > DBL_MIN) ? 1. / ro_1 : 0.;
+    alpha =  - ro_0 * d_ro_1;
+
+#   pragma omp parallel if(n_rows > CS_THR_MIN)
+    {
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        vx[ii] += (alpha * dk[ii]);
+
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        rk[ii] += (alpha * zk[ii]);
+    }
+
+    /* Harvest first search directions */
+
+    if ((int)n_iter <= n_harvest) {
+      cs_real_t *hp_k = hp + (n_iter-1)*wa_size;
+      cs_real_t *hq_k = hq + (n_iter-1)*wa_size;
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        hp_k[ii] = dk[ii];
+        hq_k[ii] = zk[ii];
+      }
+    }
+
+  }
+
+  /* Update deflation space */
+
+  int n_h = CS_MIN((int)n_iter, n_harvest);
+
+  if (cvg >= CS_SLES_MAX_ITERATION && n_h > 0) {
+    const cs_real_t *sv[CS_SLES_IT_DEFLATION_DIM_MAX];
+    const cs_real_t *asv[CS_SLES_IT_DEFLATION_DIM_MAX];
+    int n_s = 0;
+    for (int j = 0; j < n_vecs; j++) {
+      sv[n_s] = w + j*wa_size;
+      asv[n_s] = aw + j*wa_size;
+      n_s++;
+    }
+    for (int j = 0; j < n_h; j++) {
+      sv[n_s] = hp + j*wa_size;
+      asv[n_s] = hq + j*wa_size;
+      n_s++;
+    }
+    _deflation_update(c, n_rows, n_s, sv, asv);
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute dot products of pairs of interleaved vectors, summing result
+ * over all ranks.
+ *
+ * parameters:
+ *   c       <-- pointer to solver context info
+ *   n_rhs   <-- number of interleaved vectors
+ *   n_pairs <-- number of vector pairs
+ *   x       <-- first interleaved vectors of each pair
+ *   y       <-- second interleaved vectors of each pair
+ *   s       --> dot products (s[p*n_rhs + k] for pair p and vector k)
+ *----------------------------------------------------------------------------*/
+
+static void
+_dot_products_multi(const cs_sles_it_t  *c,
+                    int                  n_rhs,
+                    int                  n_pairs,
+                    const cs_real_t     *x[],
+                    const cs_real_t     *y[],
+                    double               s[])
+{
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const int n_s = n_rhs*n_pairs;
+  const int n_threads = cs_parall_n_threads(n_rows, CS_THR_MIN);
+
+  double *t_s;
+  BFT_MALLOC(t_s, n_s*n_threads, double);
+
+  for (int i = 0; i < n_s*n_threads; i++)
+    t_s[i] = 0.;
+
+  /* Per-thread partial sums, so that each vector is read only once */
+
+# pragma omp parallel num_threads(n_threads)
+  {
+#if defined(HAVE_OPENMP)
+    double *restrict _s = t_s + omp_get_thread_num()*n_s;
+#else
+    double *restrict _s = t_s;
+#endif
+
+    cs_lnum_t s_id, e_id;
+    cs_parall_thread_range(n_rows, sizeof(cs_real_t), &s_id, &e_id);
+
+    for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+      for (int p = 0; p < n_pairs; p++) {
+        const cs_real_t *restrict _x = x[p] + ii*n_rhs;
+        const cs_real_t *restrict _y = y[p] + ii*n_rhs;
+        double *restrict _sp = _s + p*n_rhs;
+        for (int k = 0; k < n_rhs; k++)
+          _sp[k] += _x[k]*_y[k];
+      }
+    }
+  }
+
+  for (int i = 0; i < n_s; i++) {
+    s[i] = t_s[i];
+    for (int t_id = 1; t_id < n_threads; t_id++)
+      s[i] += t_s[t_id*n_s + i];
+  }
+
+  BFT_FREE(t_s);
+
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL)
+    MPI_Allreduce(MPI_IN_PLACE, s, n_s, MPI_DOUBLE, MPI_SUM, c->comm);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Apply preconditioner to interleaved vectors, for systems which
+ * are still iterating.
+ *
+ * parameters:
+ *   c      <-- pointer to solver context info
+ *   n_rhs  <-- number of interleaved vectors
+ *   cvg    <-- convergence state for each vector
+ *   rk     <-- interleaved residuals
+ *   gk     --> interleaved preconditioned residuals
+ *   pr     --- work array of size n_cols_ext
+ *   pg     --- work array of size n_cols_ext
+ *----------------------------------------------------------------------------*/
+
+static void
+_pc_apply_multi(cs_sles_it_t                       *c,
+                int                                 n_rhs,
+                const cs_sles_convergence_state_t   cvg[],
+                const cs_real_t                    *restrict rk,
+                cs_real_t                          *restrict gk,
+                cs_real_t                          *restrict pr,
+                cs_real_t                          *restrict pg)
+{
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  if (c->setup_data->pc_apply == nullptr) {
+    const cs_lnum_t n_vals = n_rows * n_rhs;
+#   pragma omp parallel for if(n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      gk[ii] = rk[ii];
+    return;
+  }
+
+  for (int k = 0; k < n_rhs; k++) {
+
+    if (cvg[k] != CS_SLES_ITERATING)
+      continue;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      pr[ii] = rk[ii*n_rhs + k];
+
+    c->setup_data->pc_apply(c->setup_data->pc_context, pr, pg);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      gk[ii*n_rhs + k] = pg[ii];
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.VX = RHS for multiple interleaved right-hand sides using
+ * preconditioned conjugate gradient.
+ *
+ * Each system uses its own recurrence coefficients, but all systems share
+ * the same matrix.vectors products and grouped reductions, so the matrix
+ * is streamed only once per iteration. Systems which have converged are
+ * frozen until all have converged. For flexible conjugate gradient, the
+ * Polak-Ribiere formula is used for the descent parameter.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   n_rhs           <-- number of right-hand sides
+ *   convergence     <-- convergence information structure for each system
+ *   cvg             --> convergence state for each system
+ *   rhs             <-- interleaved right hand sides
+ *   vx              <-> interleaved system solutions
+ *
+ * returns:
+ *   convergence state (worst over all systems)
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_conjugate_gradient_multi(cs_sles_it_t                 *c,
+                          const cs_matrix_t            *a,
+                          int                           n_rhs,
+                          cs_sles_it_convergence_t     *convergence,
+                          cs_sles_convergence_state_t   cvg[],
+                          const cs_real_t              *rhs,
+                          cs_real_t                    *restrict vx)
+{
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict dk, *restrict gk, *restrict zk;
+  cs_real_t  *restrict pr, *restrict pg;
+
+  const bool flexible = (c->type == CS_SLES_FCG) ? true : false;
+
+  /* Allocate work arrays */
+  /*----------------------*/
+
+  assert(c->setup_data != nullptr);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a);
+    const size_t wa_size = CS_SIMD_SIZE(n_cols * n_rhs);
+    const size_t wa_size_1 = CS_SIMD_SIZE(n_cols);
+
+    BFT_MALLOC(_aux_vectors, wa_size*4 + wa_size_1*2, cs_real_t);
+
+    rk = _aux_vectors;
+    dk = _aux_vectors + wa_size;
+    gk = _aux_vectors + wa_size*2;
+    zk = _aux_vectors + wa_size*3;
+    pr = _aux_vectors + wa_size*4;
+    pg = _aux_vectors + wa_size*4 + wa_size_1;
+  }
+
+  double *s, *alpha, *rho, *res_ini;
+  BFT_MALLOC(s, n_rhs*6, double);
+  alpha = s + n_rhs*3;
+  rho = s + n_rhs*4;
+  res_ini = s + n_rhs*5;
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  cs_matrix_vector_multiply_multi(a, n_rhs, vx, rk);  /* rk = A.x0 */
+
+# pragma omp parallel for if(n_rows*n_rhs > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows*n_rhs; ii++)
+    rk[ii] -= rhs[ii];
+
+  for (int k = 0; k < n_rhs; k++)
+    cvg[k] = CS_SLES_ITERATING;
+
+  _pc_apply_multi(c, n_rhs, cvg, rk, gk, pr, pg);
+
+# pragma omp parallel for if(n_rows*n_rhs > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows*n_rhs; ii++)
+    dk[ii] = gk[ii];
+
+  {
+    const cs_real_t *x[2] = {rk, rk}, *y[2] = {rk, gk};
+    _dot_products_multi(c, n_rhs, 2, x, y, s);
+  }
+
+  int n_active = 0;
+
+  for (int k = 0; k < n_rhs; k++) {
+    double residual = sqrt(s[k]);
+    rho[k] = s[n_rhs + k];
+    res_ini[k] = residual;
+    c->setup_data->initial_residual = residual;
+    cvg[k] = _convergence_test(c, 0, residual, convergence + k);
+    if (cvg[k] == CS_SLES_ITERATING)
+      n_active += 1;
+  }
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  unsigned n_iter = 0;
+
+  while (n_active > 0) {
+
+    n_iter += 1;
+
+    cs_matrix_vector_multiply_multi(a, n_rhs, dk, zk);
+
+    /* Descent parameters (zero for converged systems) */
+
+    {
+      const cs_real_t *x[1] = {dk}, *y[1] = {zk};
+      _dot_products_multi(c, n_rhs, 1, x, y, s);
+    }
+
+    for (int k = 0; k < n_rhs; k++) {
+      if (cvg[k] == CS_SLES_ITERATING && CS_ABS(s[k]) > DBL_MIN)
+        alpha[k] = - rho[k] / s[k];
+      else
+        alpha[k] = 0.;
+    }
+
+#   pragma omp parallel for if(n_rows*n_rhs > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      for (int k = 0; k < n_rhs; k++) {
+        const cs_lnum_t l = ii*n_rhs + k;
+        vx[l] += alpha[k] * dk[l];
+        rk[l] += alpha[k] * zk[l];
+      }
+    }
+
+    /* Preconditioning */
+
+    _pc_apply_multi(c, n_rhs, cvg, rk, gk, pr, pg);
+
+    /* Compute residuals and prepare descent parameters */
+
+    {
+      const cs_real_t *x[3] = {rk, rk, gk}, *y[3] = {rk, gk, zk};
+      _dot_products_multi(c, n_rhs, (flexible) ? 3 : 2, x, y, s);
+    }
+
+    n_active = 0;
+
+    for (int k = 0; k < n_rhs; k++) {
+
+      double beta = 0.;
+
+      if (cvg[k] == CS_SLES_ITERATING) {
+
+        double residual = sqrt(s[k]);
+        c->setup_data->initial_residual = res_ini[k];
+        cvg[k] = _convergence_test(c, n_iter, residual, convergence + k);
+
+        if (cvg[k] == CS_SLES_ITERATING) {
+          /* g_k+1.(r_k+1 - r_k) = alpha_k g_k+1.z_k */
+          double rk_gk = s[n_rhs + k];
+          double num = (flexible) ? alpha[k]*s[2*n_rhs + k] : rk_gk;
+          beta = (CS_ABS(rho[k]) > DBL_MIN) ? num / rho[k] : 0.;
+          rho[k] = rk_gk;
+          n_active += 1;
+        }
+
+      }
+
+      alpha[k] = beta; /* reuse array for beta */
+    }
+
+    if (n_active == 0)
+      break;
+
+#   pragma omp parallel for if(n_rows*n_rhs > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      for (int k = 0; k < n_rhs; k++) {
+        const cs_lnum_t l = ii*n_rhs + k;
+        dk[l] = gk[l] + (alpha[k] * dk[l]);
+      }
+    }
+
+  }
+
+  BFT_FREE(s);
+  BFT_FREE(_aux_vectors);
+
+  cs_sles_convergence_state_t retval = CS_SLES_CONVERGED;
+  for (int k = 0; k < n_rhs; k++) {
+    if (cvg[k] < retval)
+      retval = cvg[k];
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using preconditioned 3-layer conjugate residual.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- block size of element ii, ii
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_conjugate_residual_3(cs_sles_it_t              *c,
+                      const cs_matrix_t         *a,
+                      cs_lnum_t                  diag_block_size,
+                      cs_sles_it_convergence_t  *convergence,
+                      const cs_real_t           *rhs,
+                      cs_real_t                 *restrict vx_ini,
+                      cs_real_t                 *restrict vx,
+                      size_t                     aux_size,
+                      void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg;
+  double  residual;
+  double  ak, bk, ck, dk, ek, denom, alpha, tau;
+  cs_real_t *_aux_vectors;
+  cs_real_t  *restrict vxm1;
+  cs_real_t  *restrict rk, *restrict rkm1;
+  cs_real_t  *restrict wk, *restrict zk;
+  cs_real_t  *restrict tmp;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != nullptr);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 6;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == nullptr || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = static_cast<cs_real_t *>(aux_vectors);
+
+    vxm1 = _aux_vectors;
+    rk = _aux_vectors + wa_size;
+    rkm1 = _aux_vectors + wa_size*2;
+    tmp = _aux_vectors + wa_size*3;
+    wk = _aux_vectors + wa_size*4;
+    zk = _aux_vectors + wa_size*5;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      vxm1[ii] = vx[ii];
+      rkm1[ii] = 0.0;
+    }
+  }
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  /* Residual */
+
+  if (vx_ini == vx) {
+    cs_matrix_vector_multiply(a, vx, rk);  /* rk = A.x0 */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      rk[ii] -= rhs[ii];
+  }
+  else {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      rk[ii] = -rhs[ii];
+      vx[ii] = 0.;
+    }
+  }
+
+  residual = _dot_product(c, rk, rk);
+  residual = sqrt(residual);
+
+  /* If no solving required, finish here */
+
+  c->setup_data->initial_residual = residual;
+  cvg = _convergence_test(c, n_iter, residual, convergence);
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Preconditionning */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context, rk, wk);
+
+    cs_matrix_vector_multiply(a, wk, zk);
+
+    _dot_products_xy_yz(c, rk, zk, rkm1, &ak, &bk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      tmp[ii] = rk[ii] - rkm1[ii];
+
+    _dot_products_xy_yz(c, rk, tmp, rkm1, &ck, &dk);
+
+    ek = _dot_product_xx(c, zk);
+
+    denom = (ck-dk)*ek - ((ak-bk)*(ak-bk));
+
+    if (fabs(denom) < 1.e-30)
+      alpha = 1.0;
+    else
+      alpha = ((ak-bk)*bk - dk*ek)/denom;
+
+    if (fabs(alpha) < 1.e-30 || fabs(alpha - 1.) < 1.e-30) {
+      alpha = 1.0;
+      tau = ak/ek;
+    }
+    else
+      tau = ak/ek + ((1 - alpha)/alpha) * bk/ek;
+
+    cs_real_t c0 = (1 - alpha);
+    cs_real_t c1 = -alpha*tau;
+
+#   pragma omp parallel firstprivate(alpha, tau, c0, c1) if(n_rows > CS_THR_MIN)
+    {
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        cs_real_t trk = rk[ii];
+        rk[ii] = alpha*rk[ii] + c0*rkm1[ii] + c1*zk[ii];
+        rkm1[ii] = trk;
+      }
+#     pragma omp for nowait
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        cs_real_t tvx = vx[ii];
+        vx[ii] = alpha*vx[ii] + c0*vxm1[ii] + c1*wk[ii];
+        vxm1[ii] = tvx;
+      }
+    }
+
+    /* Compute residual */
+
+    residual = sqrt(_dot_product(c, rk, rk));
+
+    /* Convergence test for end of previous iteration */
+
+    if (n_iter > 1)
+      cvg = _convergence_test(c, n_iter, residual, convergence);
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    n_iter += 1;
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Jacobi.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_jacobi(cs_sles_it_t              *c,
+        const cs_matrix_t         *a,
+        cs_lnum_t                  diag_block_size,
+        cs_sles_it_convergence_t  *convergence,
+        const cs_real_t           *rhs,
+        cs_real_t                 *restrict vx_ini,
+        cs_real_t                 *restrict vx,
+        size_t                     aux_size,
+        void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg;
+  cs_real_t *_aux_vectors;
+  cs_real_t *restrict rk;
+
+  double residual = -1;
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != nullptr);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 1;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == nullptr || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = static_cast<cs_real_t *>(aux_vectors);
+
+    rk = _aux_vectors;
+  }
+
+  const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
+
+  cvg = CS_SLES_ITERATING;
+
+  /* First iteration simplified if vx == 0
+     ------------------------------------- */
+
+  if (vx_ini != vx) {
+    assert(vx_ini == nullptr);
+    n_iter += 1;
+
+    double  res2 = 0.0;
+
+    if (convergence->precision > 0. || c->plot != nullptr) {
+
+#     pragma omp parallel for reduction(+:res2) if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        vx[ii] = rhs[ii]*ad_inv[ii];
+        double r = rhs[ii];
+        res2 += (r*r);
+        rk[ii] = vx[ii];
+      }
+
+#if defined(HAVE_MPI)
+
+      if (c->comm != MPI_COMM_NULL) {
+        double _sum;
+        MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+        res2 = _sum;
+      }
+
+#endif /* defined(HAVE_MPI) */
+
+      residual = sqrt(res2); /* Actually, residual of previous iteration */
+
+    }
+    else {
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        vx[ii] = rhs[ii]*ad_inv[ii];
+        rk[ii] = vx[ii];
+      }
+
+    }
+
+    /* Convergence test */
+
+    if (n_iter == 1)
+      c->setup_data->initial_residual = residual;
+
+    cvg = _convergence_test(c, n_iter, residual, convergence);
+
+  }
+
+  /* Case with vx != 0
+     ----------------- */
+
+  else {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      rk[ii] = vx[ii];
+    }
+  }
+
+  /* Current iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    n_iter += 1;
+
+    /* Compute Vx <- Vx - (A-diag).Rk and residual. */
+
+    cs_matrix_vector_multiply_partial(a, CS_MATRIX_SPMV_E, rk, vx);
+
+    double  res2 = 0.0;
+
+    if (convergence->precision > 0. || c->plot != nullptr) {
+
+#     pragma omp parallel for reduction(+:res2) if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        vx[ii] = (rhs[ii]-vx[ii])*ad_inv[ii];
+        double r = ad[ii] * (vx[ii]-rk[ii]);
+        res2 += (r*r);
+        rk[ii] = vx[ii];
       }
-#     pragma omp for nowait
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
-        cs_real_t tvx = vx[ii];
-        vx[ii] = alpha*vx[ii] + c0*vxm1[ii] + c1*wk[ii];
-        vxm1[ii] = tvx;
+
+#if defined(HAVE_MPI)
+
+      if (c->comm != MPI_COMM_NULL) {
+        double _sum;
+        MPI_Allreduce(&res2, &_sum, 1, MPI_DOUBLE, MPI_SUM, c->comm);
+        res2 = _sum;
       }
-    }
 
-    /* Compute residual */
+#endif /* defined(HAVE_MPI) */
 
-    residual = sqrt(_dot_product(c, rk, rk));
+      residual = sqrt(res2); /* Actually, residual of previous iteration */
 
-    /* Convergence test for end of previous iteration */
+    }
+    else {
 
-    if (n_iter > 1)
-      cvg = _convergence_test(c, n_iter, residual, convergence);
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        vx[ii] = (rhs[ii]-vx[ii])*ad_inv[ii];
+        rk[ii] = vx[ii];
+      }
 
-    if (cvg != CS_SLES_ITERATING)
-      break;
+    }
 
-    n_iter += 1;
+    /* Convergence test */
+
+    if (n_iter == 1)
+      c->setup_data->initial_residual = residual;
+
+    cvg = _convergence_test(c, n_iter, residual, convergence);
 
   }
 
@@ -1706,8 +3127,14 @@ _conjugate_residual_3(cs_sles_it_t              *c,
   return cvg;
 }
 
+#if defined(SYCL_LANGUAGE_VERSION) && !defined(HAVE_CUDA)
+
 /*----------------------------------------------------------------------------
- * Solution of A.vx = Rhs using Jacobi.
+ * Solution of A.vx = Rhs using Jacobi, with a device dispatch context.
+ *
+ * This is the portable counterpart of cs_sles_it_cuda_jacobi, used
+ * with the SYCL device backend. It requires a device partial SpMV
+ * for the matrix fill type.
  *
  * On entry, vx is considered initialized.
  *
@@ -1728,48 +3155,53 @@ _conjugate_residual_3(cs_sles_it_t              *c,
  *----------------------------------------------------------------------------*/
 
 static cs_sles_convergence_state_t
-_jacobi(cs_sles_it_t              *c,
-        const cs_matrix_t         *a,
-        cs_lnum_t                  diag_block_size,
-        cs_sles_it_convergence_t  *convergence,
-        const cs_real_t           *rhs,
-        cs_real_t                 *restrict vx_ini,
-        cs_real_t                 *restrict vx,
-        size_t                     aux_size,
-        void                      *aux_vectors)
+_jacobi_dispatch(cs_sles_it_t              *c,
+                 const cs_matrix_t         *a,
+                 cs_lnum_t                  diag_block_size,
+                 cs_sles_it_convergence_t  *convergence,
+                 const cs_real_t           *rhs,
+                 cs_real_t                 *restrict vx_ini,
+                 cs_real_t                 *restrict vx,
+                 size_t                     aux_size,
+                 void                      *aux_vectors)
 {
-  cs_sles_convergence_state_t cvg;
-  cs_real_t *_aux_vectors;
-  cs_real_t *restrict rk;
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
 
   double residual = -1;
   unsigned n_iter = 0;
 
+  cs_dispatch_context ctx;
+
   /* Allocate or map work arrays */
   /*-----------------------------*/
 
   assert(c->setup_data != nullptr);
 
-  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+  const cs_real_t  *restrict ad_inv
+    = cs_get_device_ptr_const(c->setup_data->ad_inv);
+  const cs_real_t  *restrict ad
+    = cs_get_device_ptr_const(cs_matrix_get_diagonal(a));
 
   const cs_lnum_t n_rows = c->setup_data->n_rows;
 
+  cs_real_t *_aux_vectors = nullptr;
   {
     const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
     const size_t n_wa = 1;
     const size_t wa_size = CS_SIMD_SIZE(n_cols);
 
-    if (aux_vectors == nullptr || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
-      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    if (   aux_vectors == nullptr
+        || cs_check_device_ptr(aux_vectors) == CS_ALLOC_HOST
+        || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      CS_MALLOC_HD(_aux_vectors, wa_size * n_wa, cs_real_t,
+                   ctx.alloc_mode());
     else
       _aux_vectors = static_cast<cs_real_t *>(aux_vectors);
-
-    rk = _aux_vectors;
   }
 
-  const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
+  cs_real_t *restrict rk = _aux_vectors;
 
-  cvg = CS_SLES_ITERATING;
+  const bool c_res = (convergence->precision > 0. || c->plot != nullptr);
 
   /* First iteration simplified if vx == 0
      ------------------------------------- */
@@ -1778,17 +3210,15 @@ _jacobi(cs_sles_it_t              *c,
     assert(vx_ini == nullptr);
     n_iter += 1;
 
-    double  res2 = 0.0;
-
-    if (convergence->precision > 0. || c->plot != nullptr) {
-
-#     pragma omp parallel for reduction(+:res2) if(n_rows > CS_THR_MIN)
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    if (c_res) {
+      double res2 = 0.0;
+      ctx.parallel_for_reduce_sum
+        (n_rows, res2, [=] CS_F_HOST_DEVICE
+         (cs_lnum_t ii, CS_DISPATCH_SUM_DOUBLE &sum) {
         vx[ii] = rhs[ii]*ad_inv[ii];
-        double r = rhs[ii];
-        res2 += (r*r);
         rk[ii] = vx[ii];
-      }
+        sum += rhs[ii]*rhs[ii];
+      });
 
 #if defined(HAVE_MPI)
 
@@ -1801,16 +3231,13 @@ _jacobi(cs_sles_it_t              *c,
 #endif /* defined(HAVE_MPI) */
 
       residual = sqrt(res2); /* Actually, residual of previous iteration */
-
     }
     else {
-
-#     pragma omp parallel for if(n_rows > CS_THR_MIN)
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      ctx.parallel_for(n_rows, [=] CS_F_HOST_DEVICE (cs_lnum_t ii) {
         vx[ii] = rhs[ii]*ad_inv[ii];
         rk[ii] = vx[ii];
-      }
-
+      });
+      ctx.wait();
     }
 
     /* Convergence test */
@@ -1826,10 +3253,10 @@ _jacobi(cs_sles_it_t              *c,
      ----------------- */
 
   else {
-#   pragma omp parallel for if(n_rows > CS_THR_MIN)
-    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    ctx.parallel_for(n_rows, [=] CS_F_HOST_DEVICE (cs_lnum_t ii) {
       rk[ii] = vx[ii];
-    }
+    });
+    ctx.wait();
   }
 
   /* Current iteration */
@@ -1841,19 +3268,18 @@ _jacobi(cs_sles_it_t              *c,
 
     /* Compute Vx <- Vx - (A-diag).Rk and residual. */
 
-    cs_matrix_vector_multiply_partial(a, CS_MATRIX_SPMV_E, rk, vx);
-
-    double  res2 = 0.0;
-
-    if (convergence->precision > 0. || c->plot != nullptr) {
+    cs_matrix_vector_multiply_partial_d(a, CS_MATRIX_SPMV_E, rk, vx);
 
-#     pragma omp parallel for reduction(+:res2) if(n_rows > CS_THR_MIN)
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    if (c_res) {
+      double res2 = 0.0;
+      ctx.parallel_for_reduce_sum
+        (n_rows, res2, [=] CS_F_HOST_DEVICE
+         (cs_lnum_t ii, CS_DISPATCH_SUM_DOUBLE &sum) {
         vx[ii] = (rhs[ii]-vx[ii])*ad_inv[ii];
         double r = ad[ii] * (vx[ii]-rk[ii]);
-        res2 += (r*r);
         rk[ii] = vx[ii];
-      }
+        sum += r*r;
+      });
 
 #if defined(HAVE_MPI)
 
@@ -1866,16 +3292,13 @@ _jacobi(cs_sles_it_t              *c,
 #endif /* defined(HAVE_MPI) */
 
       residual = sqrt(res2); /* Actually, residual of previous iteration */
-
     }
     else {
-
-#     pragma omp parallel for if(n_rows > CS_THR_MIN)
-      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      ctx.parallel_for(n_rows, [=] CS_F_HOST_DEVICE (cs_lnum_t ii) {
         vx[ii] = (rhs[ii]-vx[ii])*ad_inv[ii];
         rk[ii] = vx[ii];
-      }
-
+      });
+      ctx.wait();
     }
 
     /* Convergence test */
@@ -1888,11 +3311,13 @@ _jacobi(cs_sles_it_t              *c,
   }
 
   if (_aux_vectors != aux_vectors)
-    BFT_FREE(_aux_vectors);
+    CS_FREE_HD(_aux_vectors);
 
   return cvg;
 }
 
+#endif /* defined(SYCL_LANGUAGE_VERSION) && !defined(HAVE_CUDA) */
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using block Jacobi.
  *
@@ -3365,6 +4790,38 @@ _gmres(cs_sles_it_t              *c,
   return cvg;
 }
 
+END_C_DECLS /* templates require C++ linkage */
+
+/*----------------------------------------------------------------------------
+ * Get arrays describing an MSR matrix, with extra-diagonal values
+ * in double precision.
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_get_msr_arrays(const cs_matrix_t   *a,
+                const cs_lnum_t    **row_index,
+                const cs_lnum_t    **col_id,
+                const cs_real_t    **d_val,
+                const cs_real_t    **x_val)
+{
+  cs_matrix_get_msr_arrays(a, row_index, col_id, d_val, x_val);
+}
+
+/*----------------------------------------------------------------------------
+ * Get arrays describing an MSR matrix, with extra-diagonal values
+ * in single precision.
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_get_msr_arrays(const cs_matrix_t   *a,
+                const cs_lnum_t    **row_index,
+                const cs_lnum_t    **col_id,
+                const cs_real_t    **d_val,
+                const float        **x_val)
+{
+  cs_matrix_get_msr_arrays_f(a, row_index, col_id, d_val, x_val);
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Process-local Gauss-Seidel.
  *
@@ -3386,6 +4843,7 @@ _gmres(cs_sles_it_t              *c,
  *   convergence state
  *----------------------------------------------------------------------------*/
 
+template <typename T>
 static cs_sles_convergence_state_t
 _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
                             const cs_matrix_t         *a,
@@ -3409,12 +4867,13 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
   const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
 
   const cs_lnum_t  *a_row_index, *a_col_id;
-  const cs_real_t  *a_d_val, *a_x_val;
+  const cs_real_t  *a_d_val;
+  const T          *a_x_val;
 
   const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
   const cs_lnum_t db_size_2 = db_size * db_size;
 
-  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  _get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
 
   const cs_lnum_t  *order = c->add_data->order;
 
@@ -3454,7 +4913,7 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
         cs_lnum_t ii = order[ll];
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vxm1 = vx[ii];
@@ -3482,7 +4941,7 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
         cs_lnum_t ii = order[ll];
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0[DB_SIZE_MAX], vxm1[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -3559,6 +5018,7 @@ _p_ordered_gauss_seidel_msr(cs_sles_it_t              *c,
  *   convergence state
  *----------------------------------------------------------------------------*/
 
+template <typename T>
 static cs_sles_convergence_state_t
 _p_gauss_seidel_msr(cs_sles_it_t              *c,
                     const cs_matrix_t         *a,
@@ -3582,12 +5042,13 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
   const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
 
   const cs_lnum_t  *a_row_index, *a_col_id;
-  const cs_real_t  *a_d_val, *a_x_val;
+  const cs_real_t  *a_d_val;
+  const T          *a_x_val;
 
   const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
   const cs_lnum_t db_size_2 = db_size * db_size;
 
-  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  _get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
 
   cvg = CS_SLES_ITERATING;
 
@@ -3621,7 +5082,7 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vxm1 = vx[ii];
@@ -3646,7 +5107,7 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0[DB_SIZE_MAX], vxm1[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -3731,6 +5192,7 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
  *   convergence state
  *----------------------------------------------------------------------------*/
 
+template <typename T>
 static cs_sles_convergence_state_t
 _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
                         const cs_matrix_t         *a,
@@ -3750,7 +5212,8 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
 
   /* Check matrix storage type */
 
-  if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+  if (   cs_matrix_get_type(a) != CS_MATRIX_MSR
+      && cs_matrix_get_type(a) != CS_MATRIX_SELL)
     bft_error
       (__FILE__, __LINE__, 0,
        _("Symmetric Gauss-Seidel Jacobi hybrid solver only supported with a\n"
@@ -3768,12 +5231,13 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
   const cs_real_t  *restrict ad = cs_matrix_get_diagonal(a);
 
   const cs_lnum_t  *a_row_index, *a_col_id;
-  const cs_real_t  *a_d_val, *a_x_val;
+  const cs_real_t  *a_d_val;
+  const T          *a_x_val;
 
   const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
   const cs_lnum_t db_size_2 = db_size * db_size;
 
-  cs_matrix_get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+  _get_msr_arrays(a, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
 
   cvg = CS_SLES_ITERATING;
 
@@ -3804,7 +5268,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0 = rhs[ii];
@@ -3823,7 +5287,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -3864,7 +5328,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = n_rows - 1; ii > - 1; ii--) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vxm1 = vx[ii];
@@ -3889,7 +5353,7 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
       for (cs_lnum_t ii = n_rows - 1; ii > - 1; ii--) {
 
         const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
-        const cs_real_t *restrict m_row = a_x_val + a_row_index[ii];
+        const T *restrict m_row = a_x_val + a_row_index[ii];
         const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
 
         cs_real_t vx0[DB_SIZE_MAX], vxm1[DB_SIZE_MAX], _vx[DB_SIZE_MAX];
@@ -3953,6 +5417,8 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
   return cvg;
 }
 
+BEGIN_C_DECLS
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Process-local symmetric Gauss-Seidel.
  *
@@ -3992,7 +5458,8 @@ _p_gauss_seidel(cs_sles_it_t              *c,
 
   /* Check matrix storage type */
 
-  if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+  if (   cs_matrix_get_type(a) != CS_MATRIX_MSR
+      && cs_matrix_get_type(a) != CS_MATRIX_SELL)
     bft_error
       (__FILE__, __LINE__, 0,
        _("Gauss-Seidel Jacobi hybrid solver only supported with a\n"
@@ -4011,23 +5478,26 @@ _p_gauss_seidel(cs_sles_it_t              *c,
   if (c->add_data != nullptr)
     order = c->add_data->order;
 
-  if (order != nullptr)
-    cvg = _p_ordered_gauss_seidel_msr(c,
-                                      a,
-                                      diag_block_size,
-                                      convergence,
-                                      rhs,
-                                      vx_ini,
-                                      vx);
+  const cs_datatype_t coeffs_type = cs_matrix_get_coefficients_type(a);
 
-  else
-    cvg = _p_gauss_seidel_msr(c,
-                              a,
-                              diag_block_size,
-                              convergence,
-                              rhs,
-                              vx_ini,
-                              vx);
+  if (order != nullptr) {
+    if (coeffs_type == CS_FLOAT)
+      cvg = _p_ordered_gauss_seidel_msr<float>(c, a, diag_block_size,
+                                               convergence, rhs, vx_ini, vx);
+    else
+      cvg = _p_ordered_gauss_seidel_msr<cs_real_t>(c, a, diag_block_size,
+                                                   convergence,
+                                                   rhs, vx_ini, vx);
+  }
+
+  else {
+    if (coeffs_type == CS_FLOAT)
+      cvg = _p_gauss_seidel_msr<float>(c, a, diag_block_size,
+                                       convergence, rhs, vx_ini, vx);
+    else
+      cvg = _p_gauss_seidel_msr<cs_real_t>(c, a, diag_block_size,
+                                           convergence, rhs, vx_ini, vx);
+  }
 
   return cvg;
 }
@@ -4244,6 +5714,7 @@ cs_sles_it_define(int                 f_id,
                                  cs_sles_it_destroy);
 
   cs_sles_set_error_handler(sc, cs_sles_it_error_post_and_abort);
+  cs_sles_set_solve_multi_func(sc, cs_sles_it_solve_multi);
 
   return c;
 }
@@ -4335,6 +5806,20 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
   c->add_data = nullptr;
   c->shared = nullptr;
 
+  c->deflation = nullptr;
+  if (c->type == CS_SLES_DEFLATED_CG) {
+    BFT_MALLOC(c->deflation, 1, cs_sles_it_deflation_t);
+    c->deflation->n_max_vecs = 8;
+    c->deflation->n_harvest = 16;
+    c->deflation->n_vecs = 0;
+    c->deflation->n_rows = 0;
+    c->deflation->stride = 0;
+    c->deflation->w = nullptr;
+  }
+
+  c->graph.key = 0;
+  c->graph.exec = nullptr;
+
   /* Fallback mechanism */
 
   switch(c->type) {
@@ -4382,6 +5867,11 @@ cs_sles_it_destroy(void **context)
       BFT_FREE(c->add_data->order);
       BFT_FREE(c->add_data);
     }
+    if (c->deflation != nullptr) {
+      BFT_FREE(c->deflation->w);
+      BFT_FREE(c->deflation);
+    }
+    cs_dispatch_graph_destroy(c->graph);
     BFT_FREE(c);
     *context = c;
   }
@@ -4424,6 +5914,12 @@ cs_sles_it_copy(const void  *context)
     if (c->type == CS_SLES_GMRES || c->type == CS_SLES_GCR)
       d->restart_interval = c->restart_interval;
 
+    /* Copy deflation settings (not the deflation vectors) */
+    if (c->deflation != nullptr)
+      cs_sles_it_set_deflation(d,
+                               c->deflation->n_max_vecs,
+                               c->deflation->n_harvest);
+
 #if defined(HAVE_MPI)
     d->comm = c->comm;
 #endif
@@ -4461,6 +5957,11 @@ cs_sles_it_log(const void  *context,
       cs_log_printf(log_type,
                     "  Restart interval:                  %d\n",
                     c->restart_interval);
+    if (c->deflation != nullptr)
+      cs_log_printf(log_type,
+                    _("  Deflation vectors:                 %d\n"
+                      "  Harvested search directions:       %d\n"),
+                    c->deflation->n_max_vecs, c->deflation->n_harvest);
     cs_log_printf(log_type,
                   _("  Maximum number of iterations:      %d\n"),
                   c->n_max_iter);
@@ -4506,6 +6007,11 @@ cs_sles_it_log(const void  *context,
                     c->t_setup.nsec*1e-9,
                     c->t_solve.nsec*1e-9);
 
+      if (c->deflation != nullptr)
+        cs_log_printf(log_type,
+                      _("  Current deflation vectors:     %12d\n"),
+                      c->deflation->n_vecs);
+
       if (c->fallback != nullptr) {
 
         n_calls = c->fallback->n_solves;
@@ -4587,7 +6093,8 @@ cs_sles_it_setup(void               *context,
       || (   c->type >= CS_SLES_P_GAUSS_SEIDEL
           && c->type <= CS_SLES_P_SYM_GAUSS_SEIDEL)) {
     /* Force to Jacobi in case matrix type is not adapted */
-    if (cs_matrix_get_type(a) != CS_MATRIX_MSR) {
+    if (   cs_matrix_get_type(a) != CS_MATRIX_MSR
+        && cs_matrix_get_type(a) != CS_MATRIX_SELL) {
       c->type = CS_SLES_JACOBI;
     }
     block_nn_inverse = true;
@@ -4647,6 +6154,20 @@ cs_sles_it_setup(void               *context,
     c->solve = _conjugate_gradient_ip;
     break;
 
+  case CS_SLES_PIPELINED_CG:
+    c->solve = _conjugate_gradient_pipelined;
+#if defined(HAVE_CUDA)
+    if (on_device) {
+      c->on_device = true;
+      c->solve = cs_sles_it_cuda_pipelined_cg;
+    }
+#endif
+    break;
+
+  case CS_SLES_DEFLATED_CG:
+    c->solve = _conjugate_gradient_deflated;
+    break;
+
   case CS_SLES_JACOBI:
     if (diag_block_size == 1)
       c->solve = _jacobi;
@@ -4663,6 +6184,14 @@ cs_sles_it_setup(void               *context,
       else
         c->solve = cs_sles_it_cuda_block_jacobi;
     }
+#elif defined(SYCL_LANGUAGE_VERSION)
+    /* Dispatch context device kernels and a device SpMV are needed;
+       otherwise, keep the host solver */
+    if (   on_device && diag_block_size == 1
+        && cs_matrix_vector_multiply_d_is_available(a, CS_MATRIX_SPMV_E)) {
+      c->on_device = true;
+      c->solve = _jacobi_dispatch;
+    }
 #endif
 
     break;
@@ -4696,7 +6225,10 @@ cs_sles_it_setup(void               *context,
     c->solve = _p_gauss_seidel;
     break;
   case CS_SLES_P_SYM_GAUSS_SEIDEL:
-    c->solve = _p_sym_gauss_seidel_msr;
+    if (cs_matrix_get_coefficients_type(a) == CS_FLOAT)
+      c->solve = _p_sym_gauss_seidel_msr<float>;
+    else
+      c->solve = _p_sym_gauss_seidel_msr<cs_real_t>;
     break;
 
   case CS_SLES_USER_DEFINED:
@@ -4978,6 +6510,213 @@ cs_sles_it_solve(void                *context,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Call iterative sparse linear equation solver for multiple
+ *        right-hand sides.
+ *
+ * Right-hand sides and solutions are interleaved, so that the value
+ * for right-hand side k and row i is located at i*n_rhs + k.
+ *
+ * For scalar systems on host solved with a conjugate gradient variant,
+ * all systems are solved simultaneously using shared matrix.vectors
+ * products. Otherwise, systems are solved one after the other.
+ *
+ * \param[in, out]  context        pointer to iterative solver info and context
+ *                                 (actual type: cs_sles_it_t  *)
+ * \param[in]       name           pointer to system name
+ * \param[in]       a              matrix
+ * \param[in]       verbosity      associated verbosity
+ * \param[in]       n_rhs          number of right-hand sides
+ * \param[in]       precision      solver precision
+ * \param[in]       r_norm         residual normalization, per right-hand side
+ * \param[out]      n_iter         number of "equivalent" iterations,
+ *                                 per right-hand side
+ * \param[out]      residual       residual, per right-hand side
+ * \param[in]       rhs            interleaved right hand sides
+ * \param[in, out]  vx             interleaved system solutions
+ *
+ * \return  convergence state (worst over all right-hand sides)
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_solve_multi(void                *context,
+                       const char          *name,
+                       const cs_matrix_t   *a,
+                       int                  verbosity,
+                       int                  n_rhs,
+                       double               precision,
+                       const double         r_norm[],
+                       int                  n_iter[],
+                       double               residual[],
+                       const cs_real_t     *rhs,
+                       cs_real_t           *vx)
+{
+  cs_sles_it_t *c = static_cast<cs_sles_it_t *>(context);
+
+  cs_sles_convergence_state_t cvg = CS_SLES_CONVERGED;
+
+  /* Setup if not already done */
+
+  if (c->setup_data == nullptr)
+    cs_sles_it_setup(c, name, a, verbosity);
+
+  const cs_lnum_t diag_block_size = cs_matrix_get_diag_block_size(a);
+
+  bool multi_solve = (diag_block_size == 1 && c->on_device == false);
+
+  if (   c->type != CS_SLES_PCG
+      && c->type != CS_SLES_FCG
+      && c->type != CS_SLES_IPCG
+      && c->type != CS_SLES_PIPELINED_CG)
+    multi_solve = false;
+
+  /* Solve systems one after the other if no fused variant is available */
+
+  if (multi_solve == false) {
+
+    const cs_lnum_t n_vals_ext = cs_matrix_get_n_columns(a) * diag_block_size;
+    const cs_lnum_t n_vals = cs_matrix_get_n_rows(a) * diag_block_size;
+
+    cs_real_t *_rhs, *_vx;
+    BFT_MALLOC(_rhs, n_vals_ext, cs_real_t);
+    BFT_MALLOC(_vx, n_vals_ext, cs_real_t);
+
+    for (int k = 0; k < n_rhs; k++) {
+
+#     pragma omp parallel for if(n_vals > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_vals; ii++) {
+        _rhs[ii] = rhs[ii*n_rhs + k];
+        _vx[ii] = vx[ii*n_rhs + k];
+      }
+
+      cs_sles_convergence_state_t k_cvg
+        = cs_sles_it_solve(c, name, a, verbosity, precision, r_norm[k],
+                           n_iter + k, residual + k,
+                           _rhs, _vx, _vx, 0, nullptr);
+
+#     pragma omp parallel for if(n_vals > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+        vx[ii*n_rhs + k] = _vx[ii];
+
+      if (k_cvg < cvg)
+        cvg = k_cvg;
+
+    }
+
+    BFT_FREE(_vx);
+    BFT_FREE(_rhs);
+
+    return cvg;
+  }
+
+  cs_timer_t t0 = {0, 0}, t1;
+
+  if (c->update_stats == true)
+    t0 = cs_timer_time();
+
+  /* Preconditioner tolerance based on strictest system */
+
+  if (c->pc != nullptr) {
+    double r_norm_min = r_norm[0];
+    for (int k = 1; k < n_rhs; k++)
+      r_norm_min = CS_MIN(r_norm_min, r_norm[k]);
+    cs_sles_pc_set_tolerance(c->pc, precision, r_norm_min);
+  }
+
+  cs_sles_it_convergence_t  *convergence;
+  cs_sles_convergence_state_t  *k_cvg;
+  BFT_MALLOC(convergence, n_rhs, cs_sles_it_convergence_t);
+  BFT_MALLOC(k_cvg, n_rhs, cs_sles_convergence_state_t);
+
+  for (int k = 0; k < n_rhs; k++) {
+    cs_sles_it_convergence_init(convergence + k,
+                                name,
+                                verbosity,
+                                c->n_max_iter,
+                                precision,
+                                r_norm[k],
+                                residual + k);
+    k_cvg[k] = CS_SLES_CONVERGED;
+  }
+
+  c->setup_data->initial_residual = -1;
+
+  /* Only call solver for "active" ranks */
+
+  bool local_solve = true;
+#if defined(HAVE_MPI)
+  if (c->comm == MPI_COMM_NULL) {
+    cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+    if (n_rows == 0)
+      local_solve = false;
+  }
+#endif
+
+  if (local_solve)
+    cvg = _conjugate_gradient_multi(c, a, n_rhs, convergence, k_cvg,
+                                    rhs, vx);
+
+  /* Broadcast convergence info from "active" ranks to others*/
+
+#if defined(HAVE_MPI)
+  if (c->comm != c->caller_comm && c->ignore_convergence == false) {
+    for (int k = 0; k < n_rhs; k++) {
+      /* cvg is signed, so shift (with some margin) before copy to unsigned. */
+      unsigned buf[2] = {(unsigned)k_cvg[k]+10, convergence[k].n_iterations};
+      MPI_Bcast(buf, 2, MPI_UNSIGNED, 0, c->caller_comm);
+      MPI_Bcast(&(convergence[k].residual), 1, MPI_DOUBLE, 0, c->caller_comm);
+      k_cvg[k] = (cs_sles_convergence_state_t)(buf[0] - 10);
+      convergence[k].n_iterations = buf[1];
+    }
+    cvg = CS_SLES_CONVERGED;
+    for (int k = 0; k < n_rhs; k++) {
+      if (k_cvg[k] < cvg)
+        cvg = k_cvg[k];
+    }
+  }
+#endif
+
+  /* Update return values */
+
+  for (int k = 0; k < n_rhs; k++) {
+    n_iter[k] = convergence[k].n_iterations;
+    residual[k] = convergence[k].residual;
+  }
+
+  if (c->update_stats == true) {
+
+    t1 = cs_timer_time();
+
+    for (int k = 0; k < n_rhs; k++) {
+
+      unsigned _n_iter = convergence[k].n_iterations;
+
+      if (c->n_iterations_tot == 0)
+        c->n_iterations_min = _n_iter;
+      else if (c->n_iterations_min > _n_iter)
+        c->n_iterations_min = _n_iter;
+      if (c->n_iterations_max < _n_iter)
+        c->n_iterations_max = _n_iter;
+
+      c->n_iterations_last = _n_iter;
+      c->n_iterations_tot += _n_iter;
+
+      c->n_solves += 1;
+
+    }
+
+    cs_timer_counter_add_diff(&(c->t_solve), &t0, &t1);
+
+  }
+
+  BFT_FREE(k_cvg);
+  BFT_FREE(convergence);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Free iterative sparse linear equation solver setup context.
@@ -5365,6 +7104,48 @@ cs_sles_it_set_restart_interval(cs_sles_it_t  *context,
   context->restart_interval = interval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the size of the recycled subspace used by the deflated
+ *        conjugate gradient solver (\ref CS_SLES_DEFLATED_CG).
+ *
+ * Deflation vectors are kept between successive solves of the same system,
+ * and updated after each solve using the first search directions.
+ * Changing these settings resets the deflation space. This setting is
+ * ignored for other solver types.
+ *
+ * \param[in, out]  context    pointer to iterative solver info and context
+ * \param[in]       n_vecs     maximum number of deflation vectors
+ * \param[in]       n_harvest  number of search directions used to update
+ *                             the deflation space after each solve
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_deflation(cs_sles_it_t  *context,
+                         int            n_vecs,
+                         int            n_harvest)
+{
+  if (context == nullptr || context->deflation == nullptr)
+    return;
+
+  cs_sles_it_deflation_t *d = context->deflation;
+
+  n_vecs = CS_MAX(n_vecs, 0);
+  n_harvest = CS_MAX(n_harvest, 1);
+  if (n_vecs + n_harvest > CS_SLES_IT_DEFLATION_DIM_MAX) {
+    n_vecs = CS_MIN(n_vecs, CS_SLES_IT_DEFLATION_DIM_MAX/2);
+    n_harvest = CS_SLES_IT_DEFLATION_DIM_MAX - n_vecs;
+  }
+
+  if (n_vecs != d->n_max_vecs || n_harvest != d->n_harvest) {
+    d->n_max_vecs = n_vecs;
+    d->n_harvest = n_harvest;
+    d->n_vecs = 0;
+    BFT_FREE(d->w);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define the max. number of iterations before stopping the algorithm
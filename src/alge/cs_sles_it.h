@@ -68,6 +68,14 @@ typedef enum {
   CS_SLES_P_GAUSS_SEIDEL,      /*!< Process-local Gauss-Seidel */
   CS_SLES_P_SYM_GAUSS_SEIDEL,  /*!< Process-local symmetric Gauss-Seidel */
   CS_SLES_PCR3,                /*!< 3-layer conjugate residual */
+  CS_SLES_PIPELINED_CG,        /*!< Pipelined preconditioned conjugate
+                                    gradient, overlapping global reductions
+                                    with preconditioning and matrix.vector
+                                    product */
+  CS_SLES_DEFLATED_CG,         /*!< Deflated preconditioned conjugate
+                                    gradient, recycling approximate
+                                    eigenvectors between successive solves
+                                    (described in \cite Saad:2000) */
   CS_SLES_USER_DEFINED,        /*!< User-defined iterative solver */
 
   CS_SLES_N_IT_TYPES,          /*!< Number of resolution algorithms
@@ -75,6 +83,9 @@ typedef enum {
 
   CS_SLES_TS_F_GAUSS_SEIDEL,   /*!< Truncated forward Gauss-Seidel smoother */
   CS_SLES_TS_B_GAUSS_SEIDEL,   /*!< Truncated backward Gauss-Seidel smoother */
+  CS_SLES_CHEBYSHEV,           /*!< Jacobi-preconditioned Chebyshev polynomial
+                                    smoother (degree given by the number
+                                    of iterations) */
 
   CS_SLES_N_SMOOTHER_TYPES     /*!< Number of resolution algorithms
                                     including smoother only */
@@ -274,6 +285,47 @@ cs_sles_it_solve(void                *context,
                  size_t               aux_size,
                  void                *aux_vectors);
 
+/*----------------------------------------------------------------------------
+ * Call iterative sparse linear equation solver for multiple right-hand sides.
+ *
+ * Right-hand sides and solutions are interleaved, so that the value
+ * for right-hand side k and row i is located at i*n_rhs + k.
+ *
+ * For scalar systems on host solved with a conjugate gradient variant,
+ * all systems are solved simultaneously using shared matrix.vectors
+ * products. Otherwise, systems are solved one after the other.
+ *
+ * parameters:
+ *   context       <-> pointer to iterative sparse linear solver info
+ *                     (actual type: cs_sles_it_t  *)
+ *   name          <-- pointer to system name
+ *   a             <-- matrix
+ *   verbosity     <-- verbosity level
+ *   n_rhs         <-- number of right-hand sides
+ *   precision     <-- solver precision
+ *   r_norm        <-- residual normalization, per right-hand side
+ *   n_iter        --> number of iterations, per right-hand side
+ *   residual      --> residual, per right-hand side
+ *   rhs           <-- interleaved right hand sides
+ *   vx            <-> interleaved system solutions
+ *
+ * returns:
+ *   convergence state (worst over all right-hand sides)
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_solve_multi(void                *context,
+                       const char          *name,
+                       const cs_matrix_t   *a,
+                       int                  verbosity,
+                       int                  n_rhs,
+                       double               precision,
+                       const double         r_norm[],
+                       int                  n_iter[],
+                       double               residual[],
+                       const cs_real_t     *rhs,
+                       cs_real_t           *vx);
+
 /*----------------------------------------------------------------------------
  * Free iterative sparse linear equation solver setup context.
  *
@@ -517,6 +569,28 @@ void
 cs_sles_it_set_restart_interval(cs_sles_it_t  *context,
                                 int            interval);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the size of the recycled subspace used by the deflated
+ *        conjugate gradient solver (\ref CS_SLES_DEFLATED_CG).
+ *
+ * Deflation vectors are kept between successive solves of the same system,
+ * and updated after each solve using the first search directions.
+ * Changing these settings resets the deflation space. This setting is
+ * ignored for other solver types.
+ *
+ * \param[in, out]  context    pointer to iterative solver info and context
+ * \param[in]       n_vecs     maximum number of deflation vectors
+ * \param[in]       n_harvest  number of search directions used to update
+ *                             the deflation space after each solve
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_it_set_deflation(cs_sles_it_t  *context,
+                         int            n_vecs,
+                         int            n_harvest);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define the max. number of iterations before stopping the algorithm
@@ -706,6 +706,107 @@ _fcg_update_0(cs_lnum_t                      n,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Pipelined CG initialization: rk <- rhs - rk.
+ *
+ * parameters:
+ *   n         <-- number of elements
+ *   rhs       <-- vector of elements
+ *   rk        <-> vector of elements
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_pipelined_cg_init(cs_lnum_t                      n,
+                   const cs_real_t  *__restrict__ rhs,
+                   cs_real_t        *__restrict__ rk)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n)
+    rk[ii] = rhs[ii] - rk[ii];
+}
+
+/*----------------------------------------------------------------------------
+ * Pipelined CG initialization when inital solution is zero:
+ * vx <- 0; rk <- rhs.
+ *
+ * parameters:
+ *   n         <-- number of elements
+ *   rhs       <-- vector of elements
+ *   vx        --> vector of elements
+ *   rk        --> vector of elements
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_pipelined_cg_init_vx0(cs_lnum_t                      n,
+                       const cs_real_t  *__restrict__ rhs,
+                       cs_real_t        *__restrict__ vx,
+                       cs_real_t        *__restrict__ rk)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n) {
+    vx[ii] = 0.;
+    rk[ii] = rhs[ii];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Pipelined CG update of auxiliary vectors, solution and residual.
+ *
+ * For the first iteration, beta should be 0.
+ *
+ * parameters:
+ *   n       <-- number of elements
+ *   alpha   <-- descent parameter
+ *   beta    <-- conjugation parameter
+ *   mk      <-- preconditioned wk
+ *   nk      <-- A.mk
+ *   zk      <-> vector of elements
+ *   qk      <-> vector of elements
+ *   sk      <-> vector of elements
+ *   pk      <-> descent direction
+ *   vx      <-> solution
+ *   rk      <-> residual
+ *   uk      <-> preconditioned residual
+ *   wk      <-> A.uk
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_pipelined_cg_update(cs_lnum_t                      n,
+                     cs_real_t                      alpha,
+                     cs_real_t                      beta,
+                     const cs_real_t  *__restrict__ mk,
+                     const cs_real_t  *__restrict__ nk,
+                     cs_real_t        *__restrict__ zk,
+                     cs_real_t        *__restrict__ qk,
+                     cs_real_t        *__restrict__ sk,
+                     cs_real_t        *__restrict__ pk,
+                     cs_real_t        *__restrict__ vx,
+                     cs_real_t        *__restrict__ rk,
+                     cs_real_t        *__restrict__ uk,
+                     cs_real_t        *__restrict__ wk)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n) {
+    cs_real_t _zk = nk[ii] + beta * zk[ii];
+    cs_real_t _qk = mk[ii] + beta * qk[ii];
+    cs_real_t _sk = wk[ii] + beta * sk[ii];
+    cs_real_t _pk = uk[ii] + beta * pk[ii];
+
+    vx[ii] += alpha * _pk;
+    rk[ii] -= alpha * _sk;
+    uk[ii] -= alpha * _qk;
+    wk[ii] -= alpha * _zk;
+
+    zk[ii] = _zk;
+    qk[ii] = _qk;
+    sk[ii] = _sk;
+    pk[ii] = _pk;
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute y <- y - x and stage 1 of resulting y.y.
  *
@@ -1041,6 +1142,18 @@ _dot_product(const cs_sles_it_t  *c,
 {
   double s;
 
+  /* Reproducible mode */
+
+  if (cs_blas_get_reduce_algorithm() == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    cs_exact_sum_t acc;
+    cs_blas_cuda_dot_exact(c->setup_data->n_rows, x, y, &acc);
+#if defined(HAVE_MPI)
+    if (c->comm != MPI_COMM_NULL)
+      cs_parall_sum_exact_acc(c->comm, 1, &acc);
+#endif
+    return cs_exact_sum_to_double(&acc);
+  }
+
   /* Alternatives */
 
   if (_use_cublas == false)
@@ -1190,10 +1303,250 @@ _dot_products_vr_vw_vq_rr(const cs_sles_it_t  *c,
   *s4 = s[3];
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute dot products r.r, r.u and u.w, summing result over all
+ *        threads of a block.
+ *
+ * blockSize must be a power of 2.
+ *
+ * \param[in]   n      array size
+ * \param[in]   r      r vector
+ * \param[in]   u      u vector
+ * \param[in]   w      w vector
+ * \param[out]  b_res  result of s = (r.r, r.u, u.w)
+ */
+/*----------------------------------------------------------------------------*/
+
+template <size_t blockSize, typename T>
+__global__ static void
+_dot_products_rr_ru_uw_stage_1_of_2(cs_lnum_t    n,
+                                    const T     *r,
+                                    const T     *u,
+                                    const T     *w,
+                                    double      *b_res)
+{
+  __shared__ double stmp[blockSize*3];
+
+  cs_lnum_t tid = threadIdx.x;
+  size_t grid_size = blockDim.x*gridDim.x;
+
+  stmp[tid*3] = 0.;
+  stmp[tid*3 + 1] = 0.;
+  stmp[tid*3 + 2] = 0.;
+
+  for (cs_lnum_t i = blockIdx.x*(blockDim.x) + tid;
+       i < n;
+       i += grid_size) {
+    stmp[tid*3]     += static_cast<double>(r[i] * r[i]);
+    stmp[tid*3 + 1] += static_cast<double>(r[i] * u[i]);
+    stmp[tid*3 + 2] += static_cast<double>(u[i] * w[i]);
+  }
+
+  // Output: b_res for this block
+
+  cs_blas_cuda_block_reduce_sum<blockSize, 3>(stmp, tid, b_res);
+}
+
+/*----------------------------------------------------------------------------
+ * Start computation of 3 dot products for pipelined conjugate gradient,
+ * summing result over all ranks.
+ *
+ * Local contributions are computed on the device; the global sum is then
+ * started using a non-blocking reduction when possible, so that it
+ * may be overlapped with the preconditioning and matrix.vector product.
+ * _dot_products_pipelined_end must be called before using the results.
+ *
+ * parameters:
+ *   c       <-- pointer to solver context info
+ *   stream  <-- associated stream
+ *   r       <-- residual
+ *   u       <-- preconditioned residual
+ *   w       <-- matrix.vector product of preconditioned residual
+ *   s       --> s[0] = r.r, s[1] = r.u, s[2] = u.w (host)
+ *   request --> associated request (MPI_REQUEST_NULL if completed)
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+static void
+_dot_products_pipelined_start(const cs_sles_it_t  *c,
+                              cudaStream_t         stream,
+                              const cs_real_t     *r,
+                              const cs_real_t     *u,
+                              const cs_real_t     *w,
+                              double               s[3],
+                              MPI_Request         *request)
+
+#else
+
+static void
+_dot_products_pipelined_start(const cs_sles_it_t  *c,
+                              cudaStream_t         stream,
+                              const cs_real_t     *r,
+                              const cs_real_t     *u,
+                              const cs_real_t     *w,
+                              double               s[3])
+
+#endif
+{
+  cs_lnum_t n = c->setup_data->n_rows;
+
+  const unsigned int block_size = 256;
+  unsigned int grid_size = cs_cuda_grid_size(n, block_size);
+
+  double *sum_block, *_s;
+  cs_blas_cuda_get_2_stage_reduce_buffers(n, 3, grid_size, sum_block, _s);
+
+  _dot_products_rr_ru_uw_stage_1_of_2
+    <block_size><<<grid_size, block_size, 0, stream>>>
+    (n, r, u, w, sum_block);
+  cs_blas_cuda_reduce_single_block<block_size, 3><<<1, block_size, 0, stream>>>
+    (grid_size, sum_block, _s);
+
+  cudaStreamSynchronize(stream);
+
+  /* Copy to private buffer, as reduction buffers may be reused
+     by the preconditioner while the global reduction is pending. */
+
+  for (int i = 0; i < 3; i++)
+    s[i] = _s[i];
+
+#if defined(HAVE_MPI)
+
+  *request = MPI_REQUEST_NULL;
+
+  if (c->comm != MPI_COMM_NULL) {
+#if (MPI_VERSION >= 3)
+    MPI_Iallreduce(MPI_IN_PLACE, s, 3, MPI_DOUBLE, MPI_SUM, c->comm, request);
+#else
+    MPI_Allreduce(MPI_IN_PLACE, s, 3, MPI_DOUBLE, MPI_SUM, c->comm);
+#endif
+  }
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Complete computation of 3 dot products for pipelined conjugate gradient.
+ *
+ * parameters:
+ *   request <-> associated request
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+static void
+_dot_products_pipelined_end(MPI_Request  *request)
+{
+  if (*request != MPI_REQUEST_NULL)
+    MPI_Wait(request, MPI_STATUS_IGNORE);
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------*/
 
 BEGIN_C_DECLS
 
+/*----------------------------------------------------------------------------
+ * Chebyshev smoother initialization and first update:
+ * rk <- rhs - rk; dk <- ad_inv.rk / theta; vx <- vx + dk.
+ *
+ * parameters:
+ *   n         <-- number of elements
+ *   theta_inv <-- inverse of eigenvalue interval center
+ *   ad_inv    <-- inverse of diagonal
+ *   rhs       <-- right hand side
+ *   rk        <-> residual
+ *   dk        --> update direction
+ *   vx        <-> solution
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_chebyshev_init(cs_lnum_t                      n,
+                cs_real_t                      theta_inv,
+                const cs_real_t  *__restrict__ ad_inv,
+                const cs_real_t  *__restrict__ rhs,
+                cs_real_t        *__restrict__ rk,
+                cs_real_t        *__restrict__ dk,
+                cs_real_t        *__restrict__ vx)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n) {
+    rk[ii] = rhs[ii] - rk[ii];
+    dk[ii] = theta_inv * ad_inv[ii] * rk[ii];
+    vx[ii] += dk[ii];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Chebyshev smoother initialization and first update when inital solution
+ * is zero: rk <- rhs; dk <- ad_inv.rk / theta; vx <- dk.
+ *
+ * parameters:
+ *   n         <-- number of elements
+ *   theta_inv <-- inverse of eigenvalue interval center
+ *   ad_inv    <-- inverse of diagonal
+ *   rhs       <-- right hand side
+ *   rk        --> residual
+ *   dk        --> update direction
+ *   vx        --> solution
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_chebyshev_init_vx0(cs_lnum_t                      n,
+                    cs_real_t                      theta_inv,
+                    const cs_real_t  *__restrict__ ad_inv,
+                    const cs_real_t  *__restrict__ rhs,
+                    cs_real_t        *__restrict__ rk,
+                    cs_real_t        *__restrict__ dk,
+                    cs_real_t        *__restrict__ vx)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n) {
+    rk[ii] = rhs[ii];
+    dk[ii] = theta_inv * ad_inv[ii] * rhs[ii];
+    vx[ii] = dk[ii];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Chebyshev smoother update:
+ * rk <- rk - wk; dk <- c1.dk + c2.ad_inv.rk; vx <- vx + dk.
+ *
+ * parameters:
+ *   n         <-- number of elements
+ *   c1        <-- previous direction coefficient
+ *   c2        <-- preconditioned residual coefficient
+ *   ad_inv    <-- inverse of diagonal
+ *   wk        <-- A.dk
+ *   rk        <-> residual
+ *   dk        <-> update direction
+ *   vx        <-> solution
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_chebyshev_update(cs_lnum_t                      n,
+                  cs_real_t                      c1,
+                  cs_real_t                      c2,
+                  const cs_real_t  *__restrict__ ad_inv,
+                  const cs_real_t  *__restrict__ wk,
+                  cs_real_t        *__restrict__ rk,
+                  cs_real_t        *__restrict__ dk,
+                  cs_real_t        *__restrict__ vx)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+
+  if (ii < n) {
+    rk[ii] -= wk[ii];
+    dk[ii] = c1 * dk[ii] + c2 * ad_inv[ii] * rk[ii];
+    vx[ii] += dk[ii];
+  }
+}
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -1341,37 +1694,16 @@ cs_sles_it_cuda_jacobi(cs_sles_it_t              *c,
     cudaMemcpyAsync(rk, vx, n_rows*sizeof(cs_real_t),
                     cudaMemcpyDeviceToDevice, stream);
 
-#if HAVE_GRAPH_CAPTURE > 0
-
-  cudaGraph_t graph;
-  cudaGraphExec_t graph_exec = NULL;
+  /* A portion of the kernels used here is captured as a graph, kept with
+     the solver context, and replayed by later iterations and solves
+     as long as the arguments are unchanged. */
 
-  /* Capture graph for a portion of kernels used here. */
+  const bool c_res = (convergence->precision > 0. || c->plot != NULL);
 
-  if (cs_glob_cuda_allow_graph) {
-    cudaGraphNode_t graph_node;
-    cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal);
-
-    /* Compute Vx <- Vx - (A-diag).Rk and residual. */
-
-    if (convergence->precision > 0. || c->plot != NULL) {
-      _jacobi_compute_vx_and_residual<blocksize><<<gridsize, blocksize, 0, stream>>>
-        (n_rows, ad_inv, ad, rhs, vx, rk, sum_block);
-      cs_blas_cuda_reduce_single_block<blocksize, 1><<<1, blocksize, 0, stream>>>
-        (gridsize, sum_block, res);
-    }
-    else {
-      _jacobi_compute_vx<blocksize><<<gridsize, blocksize, 0, stream>>>
-        (n_rows, ad_inv, rhs, vx, rk);
-    }
-
-    cudaStreamEndCapture(stream, &graph);
-    cudaError_t status = cudaGraphInstantiate(&graph_exec, graph, &graph_node,
-                                              nullptr, 0);
-    assert(status == cudaSuccess);
-  }
-
-#endif // HAVE_GRAPH_CAPTURE > 0
+  cs_device_context ctx(stream);
+  unsigned long long graph_key
+    = cs_dispatch_graph_key(ad_inv, ad, rhs, vx, rk, sum_block, res,
+                            n_rows, gridsize, c_res);
 
   /* Current iteration
      ----------------- */
@@ -1387,14 +1719,11 @@ cs_sles_it_cuda_jacobi(cs_sles_it_t              *c,
 
     /* Compute Vx <- Vx - (A-diag).Rk and residual. */
 
+    if (ctx.graph_replay(c->graph, graph_key) == false) {
 #if HAVE_GRAPH_CAPTURE > 0
-    if (cs_glob_cuda_allow_graph)
-      cudaGraphLaunch(graph_exec, stream);
-
-    else
-#endif // HAVE_GRAPH_CAPTURE > 0
-    {
-      if (convergence->precision > 0. || c->plot != NULL) {
+      ctx.graph_capture_begin();
+#endif
+      if (c_res) {
         _jacobi_compute_vx_and_residual<blocksize><<<gridsize, blocksize, 0, stream>>>
           (n_rows, ad_inv, ad, rhs, vx, rk, sum_block);
         cs_blas_cuda_reduce_single_block<blocksize, 1><<<1, blocksize, 0, stream>>>
@@ -1403,6 +1732,8 @@ cs_sles_it_cuda_jacobi(cs_sles_it_t              *c,
       else
         _jacobi_compute_vx<blocksize><<<gridsize, blocksize, 0, stream>>>
           (n_rows, ad_inv, rhs, vx, rk);
+
+      ctx.graph_capture_end(c->graph, graph_key);
     }
 
     if (convergence->precision > 0. || c->plot != NULL) {
@@ -1419,13 +1750,6 @@ cs_sles_it_cuda_jacobi(cs_sles_it_t              *c,
 
   }
 
-#if HAVE_GRAPH_CAPTURE > 0
-  if (cs_glob_cuda_allow_graph) {
-    cudaGraphDestroy(graph);
-    cudaGraphExecDestroy(graph_exec);
-  }
-#endif // HAVE_GRAPH_CAPTURE > 0
-
   if (_aux_vectors != (cs_real_t *)aux_vectors)
     cudaFree(_aux_vectors);
 
@@ -1585,40 +1909,16 @@ cs_sles_it_cuda_block_jacobi(cs_sles_it_t              *c,
     cudaMemcpyAsync(rk, vx, n_rows*sizeof(cs_real_t),
                     cudaMemcpyDeviceToDevice, stream);
 
-#if HAVE_GRAPH_CAPTURE > 0
-
-  cudaGraph_t graph;
-  cudaGraphExec_t graph_exec = NULL;
+  /* A portion of the kernels used here is captured as a graph, kept with
+     the solver context, and replayed by later iterations and solves
+     as long as the arguments are unchanged. */
 
-  /* Capture graph for a portion of kernels used here. */
+  const bool c_res = (convergence->precision > 0. || c->plot != NULL);
 
-  if (cs_glob_cuda_allow_graph) {
-    cudaGraphNode_t graph_node;
-    cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal);
-
-    /* Compute Vx <- Vx - (A-diag).Rk and residual. */
-
-    if (diag_block_size == 3)
-      _block_3_jacobi_compute_vx_and_residual
-        <blocksize><<<gridsize, blocksize, 0, stream>>>
-        (n_b_rows, ad_inv, ad, rhs, vx, rk, sum_block);
-    else
-      _block_jacobi_compute_vx_and_residual
-        <blocksize><<<gridsize, blocksize, 0, stream>>>
-        (n_b_rows, diag_block_size, ad_inv, ad, rhs, vx, rk, sum_block);
-
-    if (convergence->precision > 0. || c->plot != NULL) {
-      cs_blas_cuda_reduce_single_block<blocksize, 1><<<1, blocksize, 0, stream>>>
-        (gridsize, sum_block, res);
-    }
-
-    cudaStreamEndCapture(stream, &graph);
-    cudaError_t status = cudaGraphInstantiate(&graph_exec, graph, &graph_node,
-                                              nullptr, 0);
-    assert(status == cudaSuccess);
-  }
-
-#endif // HAVE_GRAPH_CAPTURE > 0
+  cs_device_context ctx(stream);
+  unsigned long long graph_key
+    = cs_dispatch_graph_key(ad_inv, ad, rhs, vx, rk, sum_block, res,
+                            n_b_rows, diag_block_size, gridsize, c_res);
 
   /* Current iteration
      ----------------- */
@@ -1634,13 +1934,10 @@ cs_sles_it_cuda_block_jacobi(cs_sles_it_t              *c,
 
     /* Compute Vx <- Vx - (A-diag).Rk and residual. */
 
+    if (ctx.graph_replay(c->graph, graph_key) == false) {
 #if HAVE_GRAPH_CAPTURE > 0
-    if (cs_glob_cuda_allow_graph)
-      cudaGraphLaunch(graph_exec, stream);
-
-    else
-#endif // HAVE_GRAPH_CAPTURE > 0
-    {
+      ctx.graph_capture_begin();
+#endif
       if (diag_block_size == 3)
         _block_3_jacobi_compute_vx_and_residual
           <blocksize><<<gridsize, blocksize, 0, stream>>>
@@ -1650,10 +1947,12 @@ cs_sles_it_cuda_block_jacobi(cs_sles_it_t              *c,
           <blocksize><<<gridsize, blocksize, 0, stream>>>
           (n_b_rows, diag_block_size, ad_inv, ad, rhs, vx, rk, sum_block);
 
-      if (convergence->precision > 0. || c->plot != NULL) {
+      if (c_res) {
         cs_blas_cuda_reduce_single_block<blocksize, 1><<<1, blocksize, 0, stream>>>
           (gridsize, sum_block, res);
       }
+
+      ctx.graph_capture_end(c->graph, graph_key);
     }
 
     if (convergence->precision > 0. || c->plot != NULL) {
@@ -1670,13 +1969,6 @@ cs_sles_it_cuda_block_jacobi(cs_sles_it_t              *c,
 
   }
 
-#if HAVE_GRAPH_CAPTURE > 0
-  if (cs_glob_cuda_allow_graph) {
-    cudaGraphDestroy(graph);
-    cudaGraphExecDestroy(graph_exec);
-  }
-#endif // HAVE_GRAPH_CAPTURE > 0
-
   if (_aux_vectors != (cs_real_t *)aux_vectors)
     cudaFree(_aux_vectors);
 
@@ -1888,6 +2180,365 @@ cs_sles_it_cuda_fcg(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned conjugate gradient
+ * (CUDA version).
+ *
+ * This variant, described in \cite Ghysels:2014, requires a single global
+ * reduction per iteration, which is overlapped with the preconditioning
+ * and matrix.vector product.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_cuda_pipelined_cg(cs_sles_it_t              *c,
+                             const cs_matrix_t         *a,
+                             cs_lnum_t                  diag_block_size,
+                             cs_sles_it_convergence_t  *convergence,
+                             const cs_real_t           *rhs,
+                             cs_real_t                 *restrict vx_ini,
+                             cs_real_t                 *restrict vx,
+                             size_t                     aux_size,
+                             void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+
+  bool local_stream = false;
+  cudaStream_t stream;
+  stream = cs_matrix_spmv_cuda_get_stream();
+  if (stream == 0) {
+    local_stream = true;
+    cudaStreamCreate(&stream);
+  }
+
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *__restrict__ rk, *__restrict__ uk, *__restrict__ wk;
+  cs_real_t  *__restrict__ mk, *__restrict__ nk, *__restrict__ zk;
+  cs_real_t  *__restrict__ qk, *__restrict__ sk, *__restrict__ pk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+
+  size_t vec_size = n_cols * sizeof(cs_real_t);
+
+  /* Prefetch in case it is needed (see cs_sles_it_cuda_fcg) */
+  {
+    cs_alloc_mode_t amode_vx = cs_check_device_ptr(vx);
+    cs_alloc_mode_t amode_rhs = cs_check_device_ptr(rhs);
+
+    if (amode_vx == CS_ALLOC_HOST_DEVICE_SHARED && vx_ini == vx)
+      cs_cuda_prefetch_h2d(vx, vec_size);
+
+    if (amode_rhs == CS_ALLOC_HOST_DEVICE_SHARED)
+      cs_cuda_prefetch_h2d(rhs, vec_size);
+  }
+
+  {
+    const size_t n_wa = 9;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (   aux_vectors == nullptr
+        || cs_cuda_is_device_ptr(aux_vectors) == false
+        || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+       CS_MALLOC_HD(_aux_vectors, wa_size * n_wa, cs_real_t,
+                    CS_ALLOC_HOST_DEVICE_SHARED);
+    else
+      _aux_vectors = (cs_real_t *)aux_vectors;
+
+    rk = _aux_vectors;
+    uk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    mk = _aux_vectors + wa_size*3;
+    nk = _aux_vectors + wa_size*4;
+    zk = _aux_vectors + wa_size*5;
+    qk = _aux_vectors + wa_size*6;
+    sk = _aux_vectors + wa_size*7;
+    pk = _aux_vectors + wa_size*8;
+  }
+
+  const unsigned int blocksize = CS_BLOCKSIZE;
+
+  unsigned int gridsize = cs_cuda_grid_size(n_rows, blocksize);
+
+  cs_blas_cuda_set_stream(stream);
+  if (local_stream)
+    cs_matrix_spmv_cuda_set_stream(stream);
+
+  /* Initialize iterative calculation */
+  /*----------------------------------*/
+
+  if (vx_ini == vx) {
+    cs_matrix_vector_multiply_d(a, vx, rk);  /* rk = A.x0 */
+
+    _pipelined_cg_init<<<gridsize, blocksize, 0, stream>>>
+      (n_rows, rhs, rk);
+  }
+  else
+    _pipelined_cg_init_vx0<<<gridsize, blocksize, 0, stream>>>
+      (n_rows, rhs, vx, rk);
+
+  cudaStreamSynchronize(stream);
+
+  c->setup_data->pc_apply(c->setup_data->pc_context, rk, uk);
+
+  cs_matrix_vector_multiply_d(a, uk, wk);
+
+  double gamma_km1 = 0, alpha_km1 = 0;
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    double s[3];
+
+    /* Start global reduction of rk.rk, rk.uk and uk.wk */
+
+#if defined(HAVE_MPI)
+    MPI_Request request;
+    _dot_products_pipelined_start(c, stream, rk, uk, wk, s, &request);
+#else
+    _dot_products_pipelined_start(c, stream, rk, uk, wk, s);
+#endif
+
+    /* Overlap with preconditioning and matrix.vector product */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context, wk, mk);
+
+    cs_matrix_vector_multiply_d(a, mk, nk);
+
+#if defined(HAVE_MPI)
+    _dot_products_pipelined_end(&request);
+#endif
+
+    double residual = sqrt(s[0]);
+    double gamma_k = s[1], delta_k = s[2];
+
+    /* Convergence test for end of previous iteration */
+
+    if (n_iter == 0)
+      c->setup_data->initial_residual = residual;
+
+    cvg = cs_sles_it_convergence_test(c, n_iter, residual, convergence);
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    /* Descent parameters */
+
+    double beta_k = 0, alpha_k = 0;
+
+    if (n_iter > 0) {
+      beta_k = (abs(gamma_km1) > DBL_MIN) ? gamma_k / gamma_km1 : 0.;
+      double d = delta_k;
+      if (abs(alpha_km1) > DBL_MIN)
+        d -= beta_k * gamma_k / alpha_km1;
+      alpha_k = (abs(d) > DBL_MIN) ? gamma_k / d : 0.;
+    }
+    else
+      alpha_k = (abs(delta_k) > DBL_MIN) ? gamma_k / delta_k : 0.;
+
+    gamma_km1 = gamma_k;
+    alpha_km1 = alpha_k;
+
+    _pipelined_cg_update<<<gridsize, blocksize, 0, stream>>>
+      (n_rows, alpha_k, beta_k, mk, nk, zk, qk, sk, pk, vx, rk, uk, wk);
+
+    n_iter += 1;
+
+  } /* Needs iterating */
+
+  cudaStreamSynchronize(stream);
+
+  if (_aux_vectors != aux_vectors)
+    CS_FREE_HD(_aux_vectors);
+
+  cs_blas_cuda_set_stream(0);
+  if (local_stream) {
+    cs_matrix_spmv_cuda_set_stream(0);
+    cudaStreamDestroy(stream);
+  }
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using a Jacobi-preconditioned Chebyshev polynomial
+ * smoother (CUDA version).
+ *
+ * The number of iterations is the polynomial degree; the eigenvalue bounds
+ * of D^-1.A are those estimated at setup.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size (unused here)
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_cuda_chebyshev(cs_sles_it_t              *c,
+                          const cs_matrix_t         *a,
+                          cs_lnum_t                  diag_block_size,
+                          cs_sles_it_convergence_t  *convergence,
+                          const cs_real_t           *rhs,
+                          cs_real_t                 *restrict vx_ini,
+                          cs_real_t                 *restrict vx,
+                          size_t                     aux_size,
+                          void                      *aux_vectors)
+{
+  bool local_stream = false;
+  cudaStream_t stream;
+  stream = cs_matrix_spmv_cuda_get_stream();
+  if (stream == 0) {
+    local_stream = true;
+    cudaStreamCreate(&stream);
+  }
+
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *__restrict__ rk, *__restrict__ dk, *__restrict__ wk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+
+  size_t vec_size = n_cols * sizeof(cs_real_t);
+
+  /* Prefetch in case it is needed (see cs_sles_it_cuda_fcg) */
+  {
+    cs_alloc_mode_t amode_vx = cs_check_device_ptr(vx);
+    cs_alloc_mode_t amode_rhs = cs_check_device_ptr(rhs);
+
+    if (amode_vx == CS_ALLOC_HOST_DEVICE_SHARED && vx_ini == vx)
+      cs_cuda_prefetch_h2d(vx, vec_size);
+
+    if (amode_rhs == CS_ALLOC_HOST_DEVICE_SHARED)
+      cs_cuda_prefetch_h2d(rhs, vec_size);
+  }
+
+  {
+    const size_t n_wa = 3;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (   aux_vectors == nullptr
+        || cs_cuda_is_device_ptr(aux_vectors) == false
+        || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+       CS_MALLOC_HD(_aux_vectors, wa_size * n_wa, cs_real_t,
+                    CS_ALLOC_HOST_DEVICE_SHARED);
+    else
+      _aux_vectors = (cs_real_t *)aux_vectors;
+
+    rk = _aux_vectors;
+    dk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+  }
+
+  const cs_real_t *__restrict__ ad_inv
+    = cs_get_device_ptr_const(c->setup_data->ad_inv);
+
+  const double l_min = c->setup_data->ev_bounds[0];
+  const double l_max = c->setup_data->ev_bounds[1];
+  const double theta = 0.5*(l_max + l_min);
+  const double delta = 0.5*(l_max - l_min);
+  const double sigma = theta / delta;
+
+  double rho = 1./sigma;
+
+  const unsigned int blocksize = CS_BLOCKSIZE;
+
+  unsigned int gridsize = cs_cuda_grid_size(n_rows, blocksize);
+
+  if (local_stream)
+    cs_matrix_spmv_cuda_set_stream(stream);
+
+  /* Initialize iterative calculation and first update */
+  /*---------------------------------------------------*/
+
+  if (vx_ini == vx) {
+    cs_matrix_vector_multiply_d(a, vx, rk);  /* rk = A.x0 */
+
+    _chebyshev_init<<<gridsize, blocksize, 0, stream>>>
+      (n_rows, 1./theta, ad_inv, rhs, rk, dk, vx);
+  }
+  else
+    _chebyshev_init_vx0<<<gridsize, blocksize, 0, stream>>>
+      (n_rows, 1./theta, ad_inv, rhs, rk, dk, vx);
+
+  n_iter = 1;
+
+  /* Current iteration */
+  /*-------------------*/
+
+  while (n_iter < convergence->n_iterations_max) {
+
+    cudaStreamSynchronize(stream);
+
+    cs_matrix_vector_multiply_d(a, dk, wk);
+
+    double rho_n = 1. / (2.*sigma - rho);
+    cs_real_t c1 = rho_n * rho;
+    cs_real_t c2 = 2. * rho_n / delta;
+    rho = rho_n;
+
+    _chebyshev_update<<<gridsize, blocksize, 0, stream>>>
+      (n_rows, c1, c2, ad_inv, wk, rk, dk, vx);
+
+    n_iter += 1;
+
+  }
+
+  cudaStreamSynchronize(stream);
+
+  if (_aux_vectors != aux_vectors)
+    CS_FREE_HD(_aux_vectors);
+
+  if (local_stream) {
+    cs_matrix_spmv_cuda_set_stream(0);
+    cudaStreamDestroy(stream);
+  }
+
+  convergence->n_iterations = n_iter;
+
+  return CS_SLES_MAX_ITERATION;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using optimised preconditioned GCR (CUDA version).
  *
@@ -163,6 +163,79 @@ cs_sles_it_cuda_fcg(cs_sles_it_t              *c,
                     size_t                     aux_size,
                     void                      *aux_vectors);
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned conjugate gradient
+ * (CUDA version).
+ *
+ * This variant, described in \cite Ghysels:2014, requires a single global
+ * reduction per iteration, which is overlapped with the preconditioning
+ * and matrix.vector product.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_cuda_pipelined_cg(cs_sles_it_t              *c,
+                             const cs_matrix_t         *a,
+                             cs_lnum_t                  diag_block_size,
+                             cs_sles_it_convergence_t  *convergence,
+                             const cs_real_t           *rhs,
+                             cs_real_t                 *vx_ini,
+                             cs_real_t                 *vx,
+                             size_t                     aux_size,
+                             void                      *aux_vectors);
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using a Jacobi-preconditioned Chebyshev polynomial
+ * smoother (CUDA version).
+ *
+ * The number of iterations is the polynomial degree; the eigenvalue bounds
+ * of D^-1.A are those estimated at setup.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size (unused here)
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx_ini          <-- initial system solution
+ *                       (vx if nonzero, nullptr if zero)
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+cs_sles_convergence_state_t
+cs_sles_it_cuda_chebyshev(cs_sles_it_t              *c,
+                          const cs_matrix_t         *a,
+                          cs_lnum_t                  diag_block_size,
+                          cs_sles_it_convergence_t  *convergence,
+                          const cs_real_t           *rhs,
+                          cs_real_t                 *vx_ini,
+                          cs_real_t                 *vx,
+                          size_t                     aux_size,
+                          void                      *aux_vectors);
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using optimised preconditioned GCR (CUDA version).
  *
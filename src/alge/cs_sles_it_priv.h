@@ -54,10 +54,12 @@
 
 #include "cs_base.h"
 #include "cs_blas.h"
+#include "cs_dispatch.h"
 #include "cs_file.h"
 #include "cs_log.h"
 #include "cs_halo.h"
 #include "cs_mesh.h"
+#include "cs_parall.h"
 #include "cs_matrix.h"
 #include "cs_matrix_default.h"
 #include "cs_matrix_util.h"
@@ -138,6 +140,9 @@ typedef struct _cs_sles_it_setup_t {
   void                *pc_context;       /* preconditioner context */
   cs_sles_pc_apply_t  *pc_apply;         /* preconditioner apply */
 
+  double               ev_bounds[2];     /* eigenvalue bounds of D^-1.A
+                                            used by polynomial smoothers */
+
 } cs_sles_it_setup_t;
 
 /* Solver additional data */
@@ -149,6 +154,26 @@ typedef struct _cs_sles_it_add_t {
 
 } cs_sles_it_add_t;
 
+/* Deflation (recycled subspace) data */
+/*-------------------------------------*/
+
+typedef struct _cs_sles_it_deflation_t {
+
+  int                  n_max_vecs;       /* maximum number of deflation
+                                            vectors */
+  int                  n_harvest;        /* number of search directions
+                                            kept to update deflation space */
+  int                  n_vecs;           /* current number of deflation
+                                            vectors */
+
+  cs_lnum_t            n_rows;           /* number of associated rows */
+  cs_lnum_t            stride;           /* allocated size of each vector */
+
+  cs_real_t           *w;                /* deflation vectors, kept
+                                            between successive solves */
+
+} cs_sles_it_deflation_t;
+
 /* Basic per linear system options and logging */
 /*---------------------------------------------*/
 
@@ -218,6 +243,13 @@ struct _cs_sles_it_t {
 
   cs_sles_it_add_t            *add_data;   /* additional data */
 
+  cs_sles_it_deflation_t      *deflation;  /* deflation data, or NULL */
+
+  cs_dispatch_graph_t          graph;      /* captured device kernels,
+                                              kept across solves (only
+                                              used by CUDA Jacobi
+                                              variants) */
+
   cs_sles_it_setup_t          *setup_data; /* setup data */
 
   /* Alternative solvers (fallback or heuristics) */
@@ -254,6 +286,45 @@ struct _cs_sles_it_convergence_t {
  * Inline static function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Compute dot products of vector pairs using exact accumulators,
+ * summing result over all ranks.
+ *
+ * This is used when the CS_BLAS_REDUCE_REPRODUCIBLE reduction mode is
+ * active, so that results do not depend on the partitioning.
+ *
+ * parameters:
+ *   c       <-- pointer to solver context info
+ *   n_pairs <-- number of dot products
+ *   x       <-- first vector for each product
+ *   y       <-- second vector for each product
+ *   s       --> resulting dot products
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_dot_products_exact(const cs_sles_it_t  *c,
+                    int                  n_pairs,
+                    const cs_real_t     *x[],
+                    const cs_real_t     *y[],
+                    double               s[])
+{
+  cs_exact_sum_t acc[5];
+
+  assert(n_pairs <= 5);
+
+  cs_dot_exact(c->setup_data->n_rows, n_pairs, x, y, acc);
+
+#if defined(HAVE_MPI)
+
+  if (c->comm != MPI_COMM_NULL)
+    cs_parall_sum_exact_acc(c->comm, n_pairs, acc);
+
+#endif /* defined(HAVE_MPI) */
+
+  for (int i = 0; i < n_pairs; i++)
+    s[i] = cs_exact_sum_to_double(acc + i);
+}
+
 /*----------------------------------------------------------------------------
  * Compute dot product, summing result over all ranks.
  *
@@ -271,6 +342,12 @@ _dot_product(const cs_sles_it_t  *c,
              const cs_real_t     *x,
              const cs_real_t     *y)
 {
+  if (cs_blas_get_reduce_algorithm() == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    double s;
+    _dot_products_exact(c, 1, &x, &y, &s);
+    return s;
+  }
+
   double s = cs_dot(c->setup_data->n_rows, x, y);
 
 #if defined(HAVE_MPI)
@@ -303,6 +380,11 @@ _dot_product_xx(const cs_sles_it_t  *c,
 {
   double s;
 
+  if (cs_blas_get_reduce_algorithm() == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    _dot_products_exact(c, 1, &x, &x, &s);
+    return s;
+  }
+
   s = cs_dot_xx(c->setup_data->n_rows, x);
 
 #if defined(HAVE_MPI)
@@ -338,6 +420,14 @@ _dot_products_xx_xy(const cs_sles_it_t  *c,
 {
   double s[2];
 
+  if (cs_blas_get_reduce_algorithm() == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    const cs_real_t *_x[2] = {x, x}, *_y[2] = {x, y};
+    _dot_products_exact(c, 2, _x, _y, s);
+    *s1 = s[0];
+    *s2 = s[1];
+    return;
+  }
+
   cs_dot_xx_xy(c->setup_data->n_rows, x, y, s, s+1);
 
 #if defined(HAVE_MPI)
@@ -377,6 +467,14 @@ _dot_products_xy_yz(const cs_sles_it_t  *c,
 {
   double s[2];
 
+  if (cs_blas_get_reduce_algorithm() == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    const cs_real_t *_x[2] = {x, y}, *_y[2] = {y, z};
+    _dot_products_exact(c, 2, _x, _y, s);
+    *s1 = s[0];
+    *s2 = s[1];
+    return;
+  }
+
   cs_dot_xy_yz(c->setup_data->n_rows, x, y, z, s, s+1);
 
 #if defined(HAVE_MPI)
@@ -418,6 +516,15 @@ _dot_products_xx_xy_yz(const cs_sles_it_t  *c,
 {
   double s[3];
 
+  if (cs_blas_get_reduce_algorithm() == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    const cs_real_t *_x[3] = {x, x, y}, *_y[3] = {x, y, z};
+    _dot_products_exact(c, 3, _x, _y, s);
+    *s1 = s[0];
+    *s2 = s[1];
+    *s3 = s[2];
+    return;
+  }
+
   cs_dot_xx_xy_yz(c->setup_data->n_rows, x, y, z, s, s+1, s+2);
 
 #if defined(HAVE_MPI)
@@ -466,18 +573,27 @@ _dot_products_xx_yy_xy_xz_yz(const cs_sles_it_t  *c,
 {
   double s[5];
 
-  cs_dot_xx_yy_xy_xz_yz(c->setup_data->n_rows, x, y, z, s, s+1, s+2, s+3, s+4);
+  if (cs_blas_get_reduce_algorithm() == CS_BLAS_REDUCE_REPRODUCIBLE) {
+    const cs_real_t *_x[5] = {x, y, x, x, y}, *_y[5] = {x, y, y, z, z};
+    _dot_products_exact(c, 5, _x, _y, s);
+  }
+  else {
+
+    cs_dot_xx_yy_xy_xz_yz(c->setup_data->n_rows, x, y, z,
+                          s, s+1, s+2, s+3, s+4);
 
 #if defined(HAVE_MPI)
 
-  if (c->comm != MPI_COMM_NULL) {
-    double _sum[5];
-    MPI_Allreduce(s, _sum, 5, MPI_DOUBLE, MPI_SUM, c->comm);
-    memcpy(s, _sum, 5*sizeof(double));
-  }
+    if (c->comm != MPI_COMM_NULL) {
+      double _sum[5];
+      MPI_Allreduce(s, _sum, 5, MPI_DOUBLE, MPI_SUM, c->comm);
+      memcpy(s, _sum, 5*sizeof(double));
+    }
 
 #endif /* defined(HAVE_MPI) */
 
+  }
+
   *xx = s[0];
   *yy = s[1];
   *xy = s[2];
@@ -57,6 +57,7 @@
 #include "cs_matrix.h"
 #include "cs_matrix_default.h"
 #include "cs_matrix_util.h"
+#include "cs_parall.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -248,6 +249,11 @@ BEGIN_C_DECLS
 
 #define CS_SIMD_SIZE(s) (((s-1)/16+1)*16)
 
+/* Relative threshold for ILU(0) pivots, relative to the largest
+   (absolute) coefficient of the matching row */
+
+#define CS_SLES_PC_ILU0_PIVOT_RTOL  1.49e-8  /* ~ sqrt(DBL_EPSILON) */
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
@@ -274,6 +280,19 @@ struct _cs_sles_pc_t {
 
 };
 
+/* Block Jacobi preconditioner */
+/*-----------------------------*/
+
+typedef struct {
+
+  cs_lnum_t            n_blocks;          /* Number of diagonal blocks */
+  cs_lnum_t            db_size;           /* Diagonal block size */
+
+  cs_real_t           *ad_lu;             /* LU factorization of
+                                             diagonal blocks */
+
+} cs_sles_pc_block_jacobi_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -678,6 +697,755 @@ _sles_pc_poly_destroy (void  **context)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Function returning the type name of block Jacobi preconditioner context.
+ *
+ * parameters:
+ *   context   <-- pointer to preconditioner context
+ *   logging   <-- if true, logging description; if false, canonical name
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_sles_pc_block_jacobi_get_type(const void  *context,
+                               bool         logging)
+{
+  CS_UNUSED(context);
+
+  if (logging == false)
+    return "block_jacobi";
+  else
+    return _("block Jacobi");
+}
+
+/*----------------------------------------------------------------------------
+ * Function for setup of a block Jacobi preconditioner context.
+ *
+ * Each diagonal block is factored (LU, without pivoting, as for the
+ * block Jacobi iterative solver), with L having a unit diagonal.
+ *
+ * parameters:
+ *   context   <-> pointer to preconditioner context
+ *   name      <-- pointer to name of associated linear system
+ *   a         <-- matrix
+ *   accel     <-- use accelerator version ?
+ *   verbosity <-- associated verbosity
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_block_jacobi_setup(void               *context,
+                            const char         *name,
+                            const cs_matrix_t  *a,
+                            bool                accel,
+                            int                 verbosity)
+{
+  CS_UNUSED(name);
+  CS_UNUSED(accel);
+  CS_UNUSED(verbosity);
+
+  cs_sles_pc_block_jacobi_t *c
+    = static_cast<cs_sles_pc_block_jacobi_t *>(context);
+
+  const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
+  const cs_lnum_t db_size_2 = db_size*db_size;
+  const cs_lnum_t n_blocks = cs_matrix_get_n_rows(a);
+
+  if (n_blocks*db_size_2 > c->n_blocks*c->db_size*c->db_size)
+    BFT_REALLOC(c->ad_lu, n_blocks*db_size_2, cs_real_t);
+
+  c->n_blocks = n_blocks;
+  c->db_size = db_size;
+
+  const cs_real_t *restrict ad = cs_matrix_get_diagonal(a);
+
+# pragma omp parallel for if(n_blocks > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_blocks; i++) {
+
+    cs_real_t *restrict lu = c->ad_lu + db_size_2*i;
+
+    for (cs_lnum_t k = 0; k < db_size_2; k++)
+      lu[k] = ad[db_size_2*i + k];
+
+    for (cs_lnum_t k = 0; k < db_size; k++) {
+      for (cs_lnum_t ii = k + 1; ii < db_size; ii++) {
+        lu[ii*db_size + k] /= lu[k*db_size + k];
+        for (cs_lnum_t jj = k + 1; jj < db_size; jj++)
+          lu[ii*db_size + jj] -= lu[ii*db_size + k] * lu[k*db_size + jj];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Function for application of a block Jacobi preconditioner.
+ *
+ * In cases where it is desired that the preconditioner modify a vector
+ * "in place", x_in should be set to nullptr, and x_out contain the vector to
+ * be modified (\f$x_{out} \leftarrow M^{-1}x_{out})\f$).
+ *
+ * parameters:
+ *   context       <-> pointer to preconditioner context
+ *   x_in          <-- input vector
+ *   x_out         <-> input/output vector
+ *
+ * returns:
+ *   preconditioner application status
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_state_t
+_sles_pc_block_jacobi_apply(void                *context,
+                            const cs_real_t     *x_in,
+                            cs_real_t           *x_out)
+{
+  cs_sles_pc_block_jacobi_t *c
+    = static_cast<cs_sles_pc_block_jacobi_t *>(context);
+
+  const cs_lnum_t n_blocks = c->n_blocks;
+  const cs_lnum_t db_size = c->db_size;
+  const cs_lnum_t db_size_2 = db_size*db_size;
+
+  if (x_in != nullptr) {
+#   pragma omp parallel for if(n_blocks*db_size > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_blocks*db_size; ii++)
+      x_out[ii] = x_in[ii];
+  }
+
+# pragma omp parallel for if(n_blocks > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_blocks; i++) {
+
+    const cs_real_t *restrict lu = c->ad_lu + db_size_2*i;
+    cs_real_t *restrict x = x_out + db_size*i;
+
+    /* forward */
+    for (cs_lnum_t ii = 1; ii < db_size; ii++) {
+      for (cs_lnum_t jj = 0; jj < ii; jj++)
+        x[ii] -= lu[ii*db_size + jj] * x[jj];
+    }
+
+    /* backward */
+    for (cs_lnum_t ii = db_size - 1; ii >= 0; ii--) {
+      for (cs_lnum_t jj = ii + 1; jj < db_size; jj++)
+        x[ii] -= lu[ii*db_size + jj] * x[jj];
+      x[ii] /= lu[ii*db_size + ii];
+    }
+
+  }
+
+  return CS_SLES_PC_CONVERGED;
+}
+
+/*----------------------------------------------------------------------------
+ * Function for freeing of a block Jacobi preconditioner's context data.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_block_jacobi_free(void  *context)
+{
+  cs_sles_pc_block_jacobi_t *c
+    = static_cast<cs_sles_pc_block_jacobi_t *>(context);
+
+  c->n_blocks = 0;
+  c->db_size = 0;
+
+  BFT_FREE(c->ad_lu);
+}
+
+/*----------------------------------------------------------------------------
+ * Function for creation of a block Jacobi preconditioner context based on
+ * the copy of another.
+ *
+ * parameters:
+ *   context  <-- context to clone
+ *
+ * returns:
+ *   pointer to newly created context
+ *----------------------------------------------------------------------------*/
+
+static void *
+_sles_pc_block_jacobi_clone(const void  *context)
+{
+  CS_UNUSED(context);
+
+  cs_sles_pc_block_jacobi_t *pc;
+  BFT_MALLOC(pc, 1, cs_sles_pc_block_jacobi_t);
+
+  pc->n_blocks = 0;
+  pc->db_size = 0;
+  pc->ad_lu = nullptr;
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------
+ * Function pointer for destruction of a block Jacobi preconditioner context.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_block_jacobi_destroy(void  **context)
+{
+  if (context != nullptr) {
+    _sles_pc_block_jacobi_free(*context);
+    BFT_FREE(*context);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Function returning the type name of ILU(0) preconditioner context.
+ *
+ * parameters:
+ *   context   <-- pointer to preconditioner context
+ *   logging   <-- if true, logging description; if false, canonical name
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_sles_pc_ilu0_get_type(const void  *context,
+                       bool         logging)
+{
+  CS_UNUSED(context);
+
+  if (logging == false)
+    return "ilu0";
+  else
+    return _("block Jacobi ILU(0)");
+}
+
+/*----------------------------------------------------------------------------
+ * Build substitution levels of a triangular factor.
+ *
+ * Rows of a same level only depend on rows of previous levels, so they
+ * may be processed in parallel.
+ *
+ * parameters:
+ *   n_rows      <-- number of rows
+ *   row_index   <-- CSR row index
+ *   col_id      <-- CSR column ids
+ *   diag_id     <-- position of diagonal in rows
+ *   upper       <-- true for the upper factor, false for the lower one
+ *   amode       <-- allocation mode
+ *   n_levels    --> number of levels
+ *   level_index --> rows index by level
+ *   level_rows  --> rows ordered by level
+ *----------------------------------------------------------------------------*/
+
+static void
+_ilu0_levels(cs_lnum_t          n_rows,
+             const cs_lnum_t    row_index[],
+             const cs_lnum_t    col_id[],
+             const cs_lnum_t    diag_id[],
+             bool               upper,
+             cs_alloc_mode_t    amode,
+             int               *n_levels,
+             cs_lnum_t        **level_index,
+             cs_lnum_t        **level_rows)
+{
+  cs_lnum_t *level, *rows;
+  BFT_MALLOC(level, n_rows, cs_lnum_t);
+
+  cs_lnum_t l_max = -1;
+
+  for (cs_lnum_t k = 0; k < n_rows; k++) {
+    cs_lnum_t i = (upper) ? n_rows - 1 - k : k;
+    cs_lnum_t s_id = (upper) ? diag_id[i] + 1 : row_index[i];
+    cs_lnum_t e_id = (upper) ? row_index[i+1] : diag_id[i];
+    cs_lnum_t l = 0;
+    for (cs_lnum_t p = s_id; p < e_id; p++) {
+      if (level[col_id[p]] >= l)
+        l = level[col_id[p]] + 1;
+    }
+    level[i] = l;
+    if (l > l_max)
+      l_max = l;
+  }
+
+  int _n_levels = l_max + 1;
+
+  cs_lnum_t *_level_index;
+  CS_MALLOC_HD(_level_index, _n_levels + 1, cs_lnum_t, amode);
+  CS_MALLOC_HD(rows, n_rows, cs_lnum_t, amode);
+
+  for (int l = 0; l < _n_levels + 1; l++)
+    _level_index[l] = 0;
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    _level_index[level[i] + 1] += 1;
+  for (int l = 0; l < _n_levels; l++)
+    _level_index[l+1] += _level_index[l];
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    cs_lnum_t l = level[i];
+    rows[_level_index[l]] = i;
+    _level_index[l] += 1;
+  }
+  for (int l = _n_levels; l > 0; l--)
+    _level_index[l] = _level_index[l-1];
+  _level_index[0] = 0;
+
+  BFT_FREE(level);
+
+  *n_levels = _n_levels;
+  *level_index = _level_index;
+  *level_rows = rows;
+}
+
+/*----------------------------------------------------------------------------
+ * Function for freeing of an ILU(0) preconditioner's context data.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu0_free(void  *context)
+{
+  cs_sles_pc_ilu0_t *c = static_cast<cs_sles_pc_ilu0_t *>(context);
+
+  c->n_rows = 0;
+  c->n_l_levels = 0;
+  c->n_u_levels = 0;
+  c->n_aux = 0;
+
+  CS_FREE_HD(c->row_index);
+  CS_FREE_HD(c->col_id);
+  CS_FREE_HD(c->diag_id);
+  CS_FREE_HD(c->val);
+  CS_FREE_HD(c->l_level_index);
+  CS_FREE_HD(c->l_rows);
+  CS_FREE_HD(c->u_level_index);
+  CS_FREE_HD(c->u_rows);
+  CS_FREE_HD(c->aux);
+}
+
+/*----------------------------------------------------------------------------
+ * Function for setup of an ILU(0) preconditioner context.
+ *
+ * The rank-local part of the matrix (excluding couplings with ghost
+ * values) is copied in CSR form and factored in place, with the
+ * sparsity pattern of the matrix, and no pivoting.
+ *
+ * Pivots whose absolute value is below CS_SLES_PC_ILU0_PIVOT_RTOL times
+ * the largest absolute coefficient of the row are shifted to that value
+ * (keeping their sign), so that the factors remain usable; a row with
+ * only zero coefficients is an error.
+ *
+ * parameters:
+ *   context   <-> pointer to preconditioner context
+ *   name      <-- pointer to name of associated linear system
+ *   a         <-- matrix
+ *   accel     <-- use accelerator version ?
+ *   verbosity <-- associated verbosity
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu0_setup(void               *context,
+                    const char         *name,
+                    const cs_matrix_t  *a,
+                    bool                accel,
+                    int                 verbosity)
+{
+  cs_sles_pc_ilu0_t *c = static_cast<cs_sles_pc_ilu0_t *>(context);
+
+  _sles_pc_ilu0_free(c);
+
+#if defined(HAVE_ACCEL)
+  c->accelerated = accel;
+  cs_alloc_mode_t amode = (c->accelerated) ?
+    CS_ALLOC_HOST_DEVICE_SHARED : CS_ALLOC_HOST;
+#else
+  CS_UNUSED(accel);
+  cs_alloc_mode_t amode = CS_ALLOC_HOST;
+#endif
+
+  const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a)*db_size;
+
+  c->n_rows = n_rows;
+
+  /* Copy local part of matrix */
+
+  cs_matrix_row_info_t r;
+  cs_matrix_row_init(&r);
+
+  cs_lnum_t *row_index;
+  CS_MALLOC_HD(row_index, n_rows + 1, cs_lnum_t, amode);
+
+  row_index[0] = 0;
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    cs_matrix_get_row(a, i, &r);
+    cs_lnum_t n = 0;
+    for (cs_lnum_t k = 0; k < r.row_size; k++) {
+      if (r.col_id[k] < n_rows)
+        n++;
+    }
+    row_index[i+1] = row_index[i] + n;
+  }
+
+  cs_lnum_t *col_id, *diag_id;
+  cs_real_t *val, *r_max;
+  CS_MALLOC_HD(col_id, row_index[n_rows], cs_lnum_t, amode);
+  CS_MALLOC_HD(val, row_index[n_rows], cs_real_t, amode);
+  CS_MALLOC_HD(diag_id, n_rows, cs_lnum_t, amode);
+  BFT_MALLOC(r_max, n_rows, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+
+    cs_matrix_get_row(a, i, &r);
+
+    cs_lnum_t s_id = row_index[i];
+    cs_lnum_t n = 0;
+
+    r_max[i] = 0;
+
+    /* Copy and sort (insertion sort, as rows are short) */
+
+    for (cs_lnum_t k = 0; k < r.row_size; k++) {
+      cs_lnum_t j = r.col_id[k];
+      if (j >= n_rows)
+        continue;
+      cs_real_t v = r.vals[k];
+      r_max[i] = CS_MAX(r_max[i], fabs(v));
+      cs_lnum_t p = s_id + n;
+      while (p > s_id && col_id[p-1] > j) {
+        col_id[p] = col_id[p-1];
+        val[p] = val[p-1];
+        p--;
+      }
+      col_id[p] = j;
+      val[p] = v;
+      n++;
+    }
+
+    diag_id[i] = -1;
+    for (cs_lnum_t p = s_id; p < row_index[i+1]; p++) {
+      if (col_id[p] == i) {
+        diag_id[i] = p;
+        break;
+      }
+    }
+    if (diag_id[i] < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s (%s):\n"
+                  "  row %ld of the matrix has no diagonal entry."),
+                __func__, name, (long)i);
+
+  }
+
+  cs_matrix_row_finalize(&r);
+
+  /* Factorization (IKJ variant, restricted to the matrix pattern) */
+
+  cs_lnum_t *iw;
+  BFT_MALLOC(iw, n_rows, cs_lnum_t);
+  for (cs_lnum_t j = 0; j < n_rows; j++)
+    iw[j] = -1;
+
+  cs_gnum_t n_shifted = 0;
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+
+    const cs_lnum_t s_id = row_index[i], e_id = row_index[i+1];
+
+    for (cs_lnum_t p = s_id; p < e_id; p++)
+      iw[col_id[p]] = p;
+
+    for (cs_lnum_t p = s_id; p < diag_id[i]; p++) {
+      cs_lnum_t k = col_id[p];
+      cs_real_t l_ik = val[p] / val[diag_id[k]];
+      val[p] = l_ik;
+      for (cs_lnum_t q = diag_id[k] + 1; q < row_index[k+1]; q++) {
+        cs_lnum_t q_i = iw[col_id[q]];
+        if (q_i > -1)
+          val[q_i] -= l_ik*val[q];
+      }
+    }
+
+    /* Row i of U is now final; check its pivot */
+
+    const cs_real_t tau = CS_SLES_PC_ILU0_PIVOT_RTOL * r_max[i];
+    cs_real_t *u_ii = val + diag_id[i];
+
+    if (fabs(*u_ii) <= tau) {
+      if (r_max[i] <= 0)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("%s (%s):\n"
+                    "  row %ld of the matrix has only zero coefficients."),
+                  __func__, name, (long)i);
+      *u_ii = (*u_ii < 0) ? -tau : tau;
+      n_shifted++;
+    }
+
+    for (cs_lnum_t p = s_id; p < e_id; p++)
+      iw[col_id[p]] = -1;
+
+  }
+
+  BFT_FREE(iw);
+  BFT_FREE(r_max);
+
+  if (verbosity > 0) {
+    cs_parall_counter(&n_shifted, 1);
+    if (n_shifted > 0)
+      cs_log_printf(CS_LOG_DEFAULT,
+                    _("  %s: ILU(0) factorization: %llu small pivots "
+                      "shifted\n"),
+                    name, (unsigned long long)n_shifted);
+  }
+
+  c->row_index = row_index;
+  c->col_id = col_id;
+  c->diag_id = diag_id;
+  c->val = val;
+
+  /* Substitution levels for exact triangular solves */
+
+  if (c->n_sweeps < 1) {
+    _ilu0_levels(n_rows, row_index, col_id, diag_id, false, amode,
+                 &(c->n_l_levels), &(c->l_level_index), &(c->l_rows));
+    _ilu0_levels(n_rows, row_index, col_id, diag_id, true, amode,
+                 &(c->n_u_levels), &(c->u_level_index), &(c->u_rows));
+  }
+
+#if defined(HAVE_ACCEL)
+  if (c->accelerated) {
+    cs_sync_h2d_future(c->row_index);
+    cs_sync_h2d_future(c->col_id);
+    cs_sync_h2d_future(c->diag_id);
+    cs_sync_h2d_future(c->val);
+  }
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Function for application of an ILU(0) preconditioner.
+ *
+ * In cases where it is desired that the preconditioner modify a vector
+ * "in place", x_in should be set to nullptr, and x_out contain the vector to
+ * be modified (\f$x_{out} \leftarrow M^{-1}x_{out})\f$).
+ *
+ * parameters:
+ *   context       <-> pointer to preconditioner context
+ *   x_in          <-- input vector
+ *   x_out         <-> input/output vector
+ *
+ * returns:
+ *   preconditioner application status
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_state_t
+_sles_pc_ilu0_apply(void                *context,
+                    const cs_real_t     *x_in,
+                    cs_real_t           *x_out)
+{
+  cs_sles_pc_ilu0_t *c = static_cast<cs_sles_pc_ilu0_t *>(context);
+
+#if defined(HAVE_CUDA)
+  if (c->accelerated)
+    return cs_sles_pc_cuda_apply_ilu0(context, x_in, x_out);
+#endif
+
+  const cs_lnum_t n_rows = c->n_rows;
+  const cs_lnum_t *restrict row_index = c->row_index;
+  const cs_lnum_t *restrict col_id = c->col_id;
+  const cs_lnum_t *restrict diag_id = c->diag_id;
+  const cs_real_t *restrict val = c->val;
+
+  /* Level-scheduled substitutions, in place */
+
+  if (c->n_sweeps < 1) {
+
+    cs_real_t *restrict x = x_out;
+
+    if (x_in != nullptr) {
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        x[ii] = x_in[ii];
+    }
+
+    for (int l = 0; l < c->n_l_levels; l++) {
+      const cs_lnum_t s_id = c->l_level_index[l];
+      const cs_lnum_t e_id = c->l_level_index[l+1];
+#     pragma omp parallel for if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t k = s_id; k < e_id; k++) {
+        cs_lnum_t ii = c->l_rows[k];
+        cs_real_t s = x[ii];
+        for (cs_lnum_t p = row_index[ii]; p < diag_id[ii]; p++)
+          s -= val[p]*x[col_id[p]];
+        x[ii] = s;
+      }
+    }
+
+    for (int l = 0; l < c->n_u_levels; l++) {
+      const cs_lnum_t s_id = c->u_level_index[l];
+      const cs_lnum_t e_id = c->u_level_index[l+1];
+#     pragma omp parallel for if(e_id - s_id > CS_THR_MIN)
+      for (cs_lnum_t k = s_id; k < e_id; k++) {
+        cs_lnum_t ii = c->u_rows[k];
+        cs_real_t s = x[ii];
+        for (cs_lnum_t p = diag_id[ii] + 1; p < row_index[ii+1]; p++)
+          s -= val[p]*x[col_id[p]];
+        x[ii] = s / val[diag_id[ii]];
+      }
+    }
+
+    return CS_SLES_PC_CONVERGED;
+  }
+
+  /* Jacobi sweeps for triangular solves */
+
+  if (c->n_aux < 3*n_rows) {
+    c->n_aux = 3*n_rows;
+    CS_FREE_HD(c->aux);
+    CS_MALLOC_HD(c->aux, c->n_aux, cs_real_t, CS_ALLOC_HOST);
+  }
+
+  const cs_real_t *restrict b = x_in;
+  cs_real_t *restrict w0 = c->aux;
+  cs_real_t *restrict w1 = c->aux + n_rows;
+  cs_real_t *restrict w2 = c->aux + 2*n_rows;
+
+  if (x_in == nullptr) {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      w0[ii] = x_out[ii];
+    b = w0;
+  }
+
+  /* Forward: y = b - L.y */
+
+  cs_real_t *restrict y = w1, *restrict y_n = w2;
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    y[ii] = b[ii];
+
+  for (int s_id = 0; s_id < c->n_sweeps; s_id++) {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      cs_real_t s = b[ii];
+      for (cs_lnum_t p = row_index[ii]; p < diag_id[ii]; p++)
+        s -= val[p]*y[col_id[p]];
+      y_n[ii] = s;
+    }
+    cs_real_t *t = y; y = y_n; y_n = t;
+  }
+
+  /* Backward: x = D^-1.(y - U.x), using the remaining work array
+     and x_out so as to end in x_out */
+
+  cs_real_t *restrict x = (c->n_sweeps % 2 == 0) ? x_out : y_n;
+  cs_real_t *restrict x_n = (c->n_sweeps % 2 == 0) ? y_n : x_out;
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    x[ii] = y[ii] / val[diag_id[ii]];
+
+  for (int s_id = 0; s_id < c->n_sweeps; s_id++) {
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      cs_real_t s = y[ii];
+      for (cs_lnum_t p = diag_id[ii] + 1; p < row_index[ii+1]; p++)
+        s -= val[p]*x[col_id[p]];
+      x_n[ii] = s / val[diag_id[ii]];
+    }
+    cs_real_t *t = x; x = x_n; x_n = t;
+  }
+
+  assert(x == x_out);
+
+  return CS_SLES_PC_CONVERGED;
+}
+
+/*----------------------------------------------------------------------------
+ * Log ILU(0) preconditioner info.
+ *
+ * parameters:
+ *   context  <-- pointer to preconditioner context
+ *   log_type <-- log type
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu0_log(const void  *context,
+                  cs_log_t     log_type)
+{
+  const cs_sles_pc_ilu0_t *c
+    = static_cast<const cs_sles_pc_ilu0_t *>(context);
+
+  if (log_type == CS_LOG_SETUP) {
+    if (c->n_sweeps > 0)
+      cs_log_printf(log_type,
+                    _("    Triangular solves:           %d Jacobi sweeps\n"),
+                    c->n_sweeps);
+    else
+      cs_log_printf(log_type,
+                    _("    Triangular solves:           level-scheduled\n"));
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Function for creation of an ILU(0) preconditioner context based on
+ * the copy of another.
+ *
+ * parameters:
+ *   context  <-- context to clone
+ *
+ * returns:
+ *   pointer to newly created context
+ *----------------------------------------------------------------------------*/
+
+static void *
+_sles_pc_ilu0_clone(const void  *context)
+{
+  const cs_sles_pc_ilu0_t *src
+    = static_cast<const cs_sles_pc_ilu0_t *>(context);
+
+  cs_sles_pc_ilu0_t *pc;
+  BFT_MALLOC(pc, 1, cs_sles_pc_ilu0_t);
+
+#if defined(HAVE_ACCEL)
+  pc->accelerated = false;
+#endif
+
+  pc->n_sweeps = (src != nullptr) ? src->n_sweeps : 0;
+
+  pc->n_rows = 0;
+  pc->row_index = nullptr;
+  pc->col_id = nullptr;
+  pc->diag_id = nullptr;
+  pc->val = nullptr;
+
+  pc->n_l_levels = 0;
+  pc->n_u_levels = 0;
+  pc->l_level_index = nullptr;
+  pc->l_rows = nullptr;
+  pc->u_level_index = nullptr;
+  pc->u_rows = nullptr;
+
+  pc->n_aux = 0;
+  pc->aux = nullptr;
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------
+ * Function pointer for destruction of an ILU(0) preconditioner context.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu0_destroy(void  **context)
+{
+  if (context != nullptr) {
+    _sles_pc_ilu0_free(*context);
+    BFT_FREE(*context);
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1139,6 +1907,92 @@ cs_sles_pc_poly_2_create(void)
   return pc;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a block Jacobi preconditioner.
+ *
+ * For matrices with a diagonal block size greater than 1, the complete
+ * diagonal blocks are inverted, so that couplings between the components
+ * of an unknown are accounted for (unlike the Jacobi preconditioner, which
+ * only uses the true diagonal). For scalar matrices, this is equivalent
+ * to the Jacobi preconditioner.
+ *
+ * The matrix type must provide access to the complete block diagonal
+ * (see \ref cs_matrix_get_diagonal).
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_block_jacobi_create(void)
+{
+  cs_sles_pc_block_jacobi_t *pcb
+    = static_cast<cs_sles_pc_block_jacobi_t *>
+        (_sles_pc_block_jacobi_clone(nullptr));
+
+  cs_sles_pc_t *pc = cs_sles_pc_define(pcb,
+                                       _sles_pc_block_jacobi_get_type,
+                                       _sles_pc_block_jacobi_setup,
+                                       nullptr,
+                                       _sles_pc_block_jacobi_apply,
+                                       _sles_pc_block_jacobi_free,
+                                       nullptr,
+                                       _sles_pc_block_jacobi_clone,
+                                       _sles_pc_block_jacobi_destroy);
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a block Jacobi ILU(0) preconditioner.
+ *
+ * The rank-local part of the matrix (couplings with ghost values being
+ * ignored, as for a block Jacobi method) is factored using an incomplete
+ * LU factorization with the sparsity pattern of the matrix (ILU(0)).
+ * For block matrices, the factorization is based on the true
+ * (non-blocked) matrix. No pivoting is done.
+ *
+ * For symmetric matrices, the upper factor is the transpose of the lower
+ * one scaled by the diagonal (LDL^T form, equivalent to IC(0)), so that the
+ * preconditioner remains symmetric and may be used with conjugate gradient
+ * methods, including when triangular solves use Jacobi sweeps.
+ *
+ * Triangular solves may either be exact, using level scheduling so that
+ * rows of a same level are processed in parallel, or approximated using
+ * a fixed number of Jacobi sweeps, which are better suited to many-core
+ * architectures. On GPU, Jacobi sweeps are always used (2 if \p n_sweeps
+ * is 0).
+ *
+ * \param[in]  n_sweeps  number of Jacobi sweeps for triangular solves,
+ *                       or 0 for exact level-scheduled solves
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_ilu0_create(int  n_sweeps)
+{
+  cs_sles_pc_ilu0_t *pci
+    = static_cast<cs_sles_pc_ilu0_t *>(_sles_pc_ilu0_clone(nullptr));
+
+  pci->n_sweeps = (n_sweeps > 0) ? n_sweeps : 0;
+
+  cs_sles_pc_t *pc = cs_sles_pc_define(pci,
+                                       _sles_pc_ilu0_get_type,
+                                       _sles_pc_ilu0_setup,
+                                       nullptr,
+                                       _sles_pc_ilu0_apply,
+                                       _sles_pc_ilu0_free,
+                                       _sles_pc_ilu0_log,
+                                       _sles_pc_ilu0_clone,
+                                       _sles_pc_ilu0_destroy);
+
+  return pc;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
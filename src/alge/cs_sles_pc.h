@@ -508,6 +508,40 @@ cs_sles_pc_poly_1_create(void);
 cs_sles_pc_t *
 cs_sles_pc_poly_2_create(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a block Jacobi preconditioner.
+ *
+ * For matrices with a diagonal block size greater than 1, the complete
+ * diagonal blocks are inverted; for scalar matrices, this is equivalent
+ * to the Jacobi preconditioner.
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_block_jacobi_create(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a block Jacobi ILU(0) preconditioner.
+ *
+ * The rank-local part of the matrix is factored using an incomplete LU
+ * factorization with the sparsity pattern of the matrix; for symmetric
+ * matrices, this is equivalent to IC(0). Triangular solves are either
+ * level-scheduled or approximated by Jacobi sweeps (always on GPU).
+ *
+ * \param[in]  n_sweeps  number of Jacobi sweeps for triangular solves,
+ *                       or 0 for exact level-scheduled solves
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_ilu0_create(int  n_sweeps);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
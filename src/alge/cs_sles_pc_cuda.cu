@@ -174,6 +174,84 @@ _pc_poly_finalize(cs_lnum_t                      n,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Jacobi sweep for the lower triangular solve of an ILU(0) preconditioner
+ * (unit diagonal): y_n = b - L.y
+ *
+ * parameters:
+ *   n         <-- number of rows
+ *   row_index <-- CSR row index
+ *   col_id    <-- CSR column ids
+ *   diag_id   <-- position of diagonal in rows
+ *   val       <-- factor values
+ *   b         <-- right-hand side
+ *   y         <-- previous iterate
+ *   y_n       --> new iterate
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_pc_ilu0_l_sweep(cs_lnum_t                      n,
+                 const cs_lnum_t  *__restrict__ row_index,
+                 const cs_lnum_t  *__restrict__ col_id,
+                 const cs_lnum_t  *__restrict__ diag_id,
+                 const cs_real_t  *__restrict__ val,
+                 const cs_real_t  *__restrict__ b,
+                 const cs_real_t  *__restrict__ y,
+                 cs_real_t        *__restrict__ y_n)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+  size_t grid_size = blockDim.x*gridDim.x;
+
+  while (ii < n) {
+    cs_real_t s = b[ii];
+    for (cs_lnum_t p = row_index[ii]; p < diag_id[ii]; p++)
+      s -= val[p]*y[col_id[p]];
+    y_n[ii] = s;
+    ii += grid_size;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Jacobi sweep for the upper triangular solve of an ILU(0) preconditioner:
+ * x_n = D^-1.(y - U.x), with U excluding the diagonal D.
+ *
+ * If x is NULL, the initial iterate x_n = D^-1.y is computed.
+ *
+ * parameters:
+ *   n         <-- number of rows
+ *   row_index <-- CSR row index
+ *   col_id    <-- CSR column ids
+ *   diag_id   <-- position of diagonal in rows
+ *   val       <-- factor values
+ *   y         <-- right-hand side
+ *   x         <-- previous iterate, or NULL
+ *   x_n       --> new iterate
+ *----------------------------------------------------------------------------*/
+
+__global__ static void
+_pc_ilu0_u_sweep(cs_lnum_t                      n,
+                 const cs_lnum_t  *__restrict__ row_index,
+                 const cs_lnum_t  *__restrict__ col_id,
+                 const cs_lnum_t  *__restrict__ diag_id,
+                 const cs_real_t  *__restrict__ val,
+                 const cs_real_t  *__restrict__ y,
+                 const cs_real_t  *__restrict__ x,
+                 cs_real_t        *__restrict__ x_n)
+{
+  cs_lnum_t ii = blockIdx.x*blockDim.x + threadIdx.x;
+  size_t grid_size = blockDim.x*gridDim.x;
+
+  while (ii < n) {
+    cs_real_t s = y[ii];
+    if (x != NULL) {
+      for (cs_lnum_t p = diag_id[ii] + 1; p < row_index[ii+1]; p++)
+        s -= val[p]*x[col_id[p]];
+    }
+    x_n[ii] = s / val[diag_id[ii]];
+    ii += grid_size;
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -326,6 +404,91 @@ cs_sles_pc_cuda_apply_poly(void                *context,
   return CS_SLES_PC_CONVERGED;
 }
 
+/*----------------------------------------------------------------------------
+ * Function for application of an ILU(0) preconditioner.
+ *
+ * Triangular solves are approximated using Jacobi sweeps.
+ *
+ * In cases where it is desired that the preconditioner modify a vector
+ * "in place", x_in should be set to NULL, and x_out contain the vector to
+ * be modified (\f$x_{out} \leftarrow M^{-1}x_{out})\f$).
+ *
+ * parameters:
+ *   context       <-> pointer to preconditioner context
+ *   x_in          <-- input vector
+ *   x_out         <-> input/output vector
+ *
+ * returns:
+ *   preconditioner application status
+ *----------------------------------------------------------------------------*/
+
+cs_sles_pc_state_t
+cs_sles_pc_cuda_apply_ilu0(void                *context,
+                           const cs_real_t     *x_in,
+                           cs_real_t           *x_out)
+{
+  cs_sles_pc_ilu0_t  *c = (cs_sles_pc_ilu0_t *)context;
+
+  const cs_lnum_t n_rows = c->n_rows;
+  const int n_sweeps = (c->n_sweeps > 0) ? c->n_sweeps : 2;
+
+  if (c->n_aux < 3*n_rows) {
+    c->n_aux = 3*n_rows;
+    cs_alloc_mode_t amode = cs_check_device_ptr(c->val);
+    CS_FREE_HD(c->aux);
+    CS_MALLOC_HD(c->aux, c->n_aux, cs_real_t, amode);
+  }
+
+  const cs_lnum_t *row_index = c->row_index;
+  const cs_lnum_t *col_id = c->col_id;
+  const cs_lnum_t *diag_id = c->diag_id;
+  const cs_real_t *val = c->val;
+
+  const cs_real_t *b = x_in;
+  cs_real_t *w0 = c->aux, *w1 = c->aux + n_rows, *w2 = c->aux + 2*n_rows;
+
+  if (x_in == NULL) {
+    cudaMemcpy(w0, x_out, n_rows*sizeof(cs_real_t), cudaMemcpyDeviceToDevice);
+    b = w0;
+  }
+
+  cudaStream_t stream = cs_matrix_spmv_cuda_get_stream();
+
+  const unsigned int blocksize = 256;
+  unsigned int gridsize = cs_cuda_grid_size(n_rows, blocksize);
+
+  /* Forward: y = b - L.y, starting from y = b */
+
+  const cs_real_t *y = b;
+  cs_real_t *y_n = w1;
+
+  for (int s_id = 0; s_id < n_sweeps; s_id++) {
+    _pc_ilu0_l_sweep<<<gridsize, blocksize, 0, stream>>>
+      (n_rows, row_index, col_id, diag_id, val, b, y, y_n);
+    y = y_n;
+    y_n = (y_n == w1) ? w2 : w1;
+  }
+
+  /* Backward: x = D^-1.(y - U.x), starting from x = D^-1.y,
+     alternating buffers so as to end in x_out */
+
+  cs_real_t *x = (n_sweeps % 2 == 0) ? x_out : y_n;
+  cs_real_t *x_n = (n_sweeps % 2 == 0) ? y_n : x_out;
+
+  _pc_ilu0_u_sweep<<<gridsize, blocksize, 0, stream>>>
+    (n_rows, row_index, col_id, diag_id, val, y, NULL, x);
+
+  for (int s_id = 0; s_id < n_sweeps; s_id++) {
+    _pc_ilu0_u_sweep<<<gridsize, blocksize, 0, stream>>>
+      (n_rows, row_index, col_id, diag_id, val, y, x, x_n);
+    cs_real_t *t = x; x = x_n; x_n = t;
+  }
+
+  assert(x == x_out);
+
+  return CS_SLES_PC_CONVERGED;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -123,6 +123,29 @@ cs_sles_pc_cuda_apply_poly(void                *context,
                            const cs_real_t     *x_in,
                            cs_real_t           *x_out);
 
+/*----------------------------------------------------------------------------
+ * Function for application of an ILU(0) preconditioner.
+ *
+ * Triangular solves are approximated using Jacobi sweeps.
+ *
+ * In cases where it is desired that the preconditioner modify a vector
+ * "in place", x_in should be set to NULL, and x_out contain the vector to
+ * be modified (\f$x_{out} \leftarrow M^{-1}x_{out})\f$).
+ *
+ * parameters:
+ *   context       <-> pointer to preconditioner context
+ *   x_in          <-- input vector
+ *   x_out         <-> input/output vector
+ *
+ * returns:
+ *   preconditioner application status
+ *----------------------------------------------------------------------------*/
+
+cs_sles_pc_state_t
+cs_sles_pc_cuda_apply_ilu0(void                *context,
+                           const cs_real_t     *x_in,
+                           cs_real_t           *x_out);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -75,6 +75,41 @@ typedef struct {
 
 } cs_sles_pc_poly_t;
 
+/* Structure for rank-local ILU(0) preconditioner */
+/*------------------------------------------------*/
+
+typedef struct {
+
+#if defined(HAVE_ACCEL)
+  bool                 accelerated;       /* Use accelerated version ? */
+#endif
+
+  int                  n_sweeps;          /* Number of Jacobi sweeps for
+                                             triangular solves, or 0 for
+                                             level-scheduled solves */
+
+  cs_lnum_t            n_rows;            /* Number of associated rows */
+
+  cs_lnum_t           *row_index;         /* CSR row index of local part */
+  cs_lnum_t           *col_id;            /* CSR column ids (sorted) */
+  cs_lnum_t           *diag_id;           /* Position of diagonal in rows */
+  cs_real_t           *val;               /* L (unit diagonal, not stored)
+                                             and U factors */
+
+  int                  n_l_levels;        /* Number of levels for forward
+                                             substitution */
+  int                  n_u_levels;        /* Number of levels for backward
+                                             substitution */
+  cs_lnum_t           *l_level_index;     /* Rows index by forward level */
+  cs_lnum_t           *l_rows;            /* Rows by forward level */
+  cs_lnum_t           *u_level_index;     /* Rows index by backward level */
+  cs_lnum_t           *u_rows;            /* Rows by backward level */
+
+  cs_lnum_t            n_aux;             /* Size of auxiliary data */
+  cs_real_t           *aux;               /* Auxiliary data */
+
+} cs_sles_pc_ilu0_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
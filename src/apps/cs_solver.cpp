@@ -60,9 +60,11 @@
 #include "cs_coupling.h"
 #include "cs_ctwr.h"
 #include "cs_domain_setup.h"
+#include "cs_equation_iterative_solve.h"
 #include "cs_ext_library_info.h"
 #include "cs_fan.h"
 #include "cs_field.h"
+#include "cs_field_operator.h"
 #include "cs_field_pointer.h"
 #include "cs_file.h"
 #include "cs_fp_exception.h"
@@ -80,6 +82,7 @@
 #include "cs_ibm.h"
 #include "cs_io.h"
 #include "cs_join.h"
+#include "cs_les_filter.h"
 #include "cs_les_inflow.h"
 #include "cs_log.h"
 #include "cs_log_iteration.h"
@@ -88,6 +91,7 @@
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_mesh_bad_cells.h"
+#include "cs_mesh_cartesian.h"
 #include "cs_mesh_coherency.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quality.h"
@@ -99,6 +103,7 @@
 #include "cs_param_cdo.h"
 #include "cs_paramedmem_coupling.h"
 #include "cs_parameters.h"
+#include "cs_perf_summary.h"
 #include "cs_physical_properties.h"
 #include "cs_post.h"
 #include "cs_post_default.h"
@@ -119,6 +124,7 @@
 #include "cs_sys_coupling.h"
 #include "cs_system_info.h"
 #include "cs_time_moment.h"
+#include "cs_time_step_compute.h"
 #include "cs_time_stepping.h"
 #include "cs_time_table.h"
 #include "cs_timer.h"
@@ -259,6 +265,14 @@ _run(void)
   cs_boundary_zone_initialize();
   cs_volume_zone_initialize();
 
+  /* Generated mesh for benchmark, defined before other mesh definitions
+     are finalized */
+
+  if (opts.benchmark > 0 && opts.benchmark_mesh[0] > 0) {
+    cs_real_t xyz[6] = {0., 0., 0., 1., 1., 1.};
+    cs_mesh_cartesian_define_simple("benchmark", opts.benchmark_mesh, xyz);
+  }
+
   cs_preprocess_mesh_define();
 
   cs_turbomachinery_define();
@@ -350,6 +364,10 @@ _run(void)
 
   if (opts.app_name != nullptr)
     BFT_FREE(opts.app_name);
+  if (opts.benchmark_ref != nullptr) {
+    cs_benchmark_set_reference(opts.benchmark_ref);
+    BFT_FREE(opts.benchmark_ref);
+  }
 
   /* Initialize couplings and communication if necessary */
 
@@ -536,10 +554,15 @@ _run(void)
 
     cs_les_inflow_finalize();
 
+    /* Finalize LES filters */
+
+    cs_les_filter_finalize();
+
   }
 
   /* Finalize linear system resolution */
 
+  cs_equation_iterative_solve_finalize();
   cs_sles_default_finalize();
 
   /* Finalize matrix API */
@@ -560,6 +583,7 @@ _run(void)
   /* Free the boundary conditions face type and face zone arrays */
 
   cs_boundary_conditions_free();
+  cs_local_time_step_classes_free();
 
   /* Final stage for CDO/HHO/MAC schemes */
 
@@ -624,6 +648,7 @@ _run(void)
   cs_probe_finalize();
   cs_post_finalize();
   cs_log_iteration_destroy_all();
+  cs_perf_summary_finalize();
 
   cs_function_destroy_all();
 
@@ -640,6 +665,7 @@ _run(void)
   cs_time_table_destroy_all();
 
   cs_field_pointer_destroy_all();
+  cs_field_gradient_cache_free_all();
   cs_field_destroy_all();
   cs_field_destroy_all_keys();
 
@@ -49,6 +49,7 @@ use field
 use atincl
 use atsoil
 use cs_c_bindings
+use radiat, only: cs_rad_time_is_active
 use, intrinsic :: iso_c_binding
 
 !===============================================================================
@@ -64,6 +65,9 @@ integer ifac, isol
 integer ico2,imer1
 integer ideb, icompt
 integer ktamp
+integer f_id
+
+logical distrib
 
 double precision heuray, albedo, emis, foir, fos
 double precision xvert, yvert
@@ -311,10 +315,45 @@ if (mod(ntcabs,nfatr1).eq.0.or.ideb.eq.0) then
     enddo
   endif
 
+  ! --- Distribution of verticals
+
+  ! When the fluxes are not coupled with the 3D radiative model, verticals
+  ! are independent, so each is computed by a single rank (instead of all
+  ! ranks), and results are then summed over ranks.
+
+  call field_get_id_try("spectral_rad_incident_flux", f_id)
+
+  distrib = .false.
+  if (irangp.ge.0) then
+    if (f_id.lt.0) then
+      distrib = .true.
+    else if (.not. cs_rad_time_is_active()) then
+      distrib = .true.
+    endif
+  endif
+
+  if (distrib) then
+    do ii = 1, nvert
+      if (mod(ii-1, nrangp).eq.irangp) cycle
+      do k = 1, kmx
+        rayi(k, ii) = 0.d0
+        rayst(k, ii) = 0.d0
+        iru(k, ii) = 0.d0
+        ird(k, ii) = 0.d0
+        solu(k, ii) = 0.d0
+        sold(k, ii) = 0.d0
+      enddo
+    enddo
+  endif
+
   ! --- Loop on the vertical array:
 
   do ii = 1, nvert
 
+    if (distrib) then
+      if (mod(ii-1, nrangp).ne.irangp) cycle
+    endif
+
     ! FIXME the x, y position plays no role...
     ! interpolation must be reviewed
     xvert = xyvert(ii,1)
@@ -463,6 +502,15 @@ if (mod(ntcabs,nfatr1).eq.0.or.ideb.eq.0) then
 
   enddo
 
+  if (distrib) then
+    call parrsm(kmx*nvert, rayi)
+    call parrsm(kmx*nvert, rayst)
+    call parrsm(kmx*nvert, iru)
+    call parrsm(kmx*nvert, ird)
+    call parrsm(kmx*nvert, solu)
+    call parrsm(kmx*nvert, sold)
+  endif
+
   do ii = 1, kmx*nvert
     cressm(ii) = 1
     interp(ii) = 1
@@ -68,6 +68,35 @@ implicit none
 
 procedure() :: fexchem_1, fexchem_2, fexchem_3, fexchem_4, chem_roschem
 
+interface
+
+  function cs_atmo_chemistry_tab_is_active() result(is_active)  &
+    bind(C, name='cs_atmo_chemistry_tab_is_active')
+    use, intrinsic :: iso_c_binding
+    implicit none
+    logical(c_bool) :: is_active
+  end function cs_atmo_chemistry_tab_is_active
+
+  function cs_atmo_chemistry_tab_retrieve(n_x, x, n_y, y) result(found)  &
+    bind(C, name='cs_atmo_chemistry_tab_retrieve')
+    use, intrinsic :: iso_c_binding
+    implicit none
+    integer(c_int), value :: n_x, n_y
+    real(c_double), dimension(*), intent(in) :: x
+    real(c_double), dimension(*), intent(out) :: y
+    logical(c_bool) :: found
+  end function cs_atmo_chemistry_tab_retrieve
+
+  subroutine cs_atmo_chemistry_tab_add(n_x, x, n_y, y)  &
+    bind(C, name='cs_atmo_chemistry_tab_add')
+    use, intrinsic :: iso_c_binding
+    implicit none
+    integer(c_int), value :: n_x, n_y
+    real(c_double), dimension(*), intent(in) :: x, y
+  end subroutine cs_atmo_chemistry_tab_add
+
+end interface
+
 ! Arguments
 
 real(c_double), dimension(*), intent(in) :: dt
@@ -87,6 +116,11 @@ double precision dtc
 integer ncycle
 double precision dtrest
 
+!  Variables used for tabulation
+logical use_tab, found
+integer(c_int) ntab
+double precision xtab(2*nespg+nrg+2)
+
 double precision, dimension(:), pointer :: crom
 type(pmapper_double_r1), dimension(:), allocatable :: cvar_espg, cvara_espg
 
@@ -103,6 +137,18 @@ do ii = 1, nespg
   call field_get_val_prev_s(ivarfl(isca(isca_chem(ii))), cvara_espg(ii)%p)
 enddo
 
+! State used for tabulation: concentrations, source terms,
+! kinetic rates, density, and time step
+use_tab = cs_atmo_chemistry_tab_is_active()
+ntab = 2*nespg + nrg + 2
+
+! Cells are independent; the user-defined (SSH) scheme is not assumed
+! to be thread-safe, so is handled serially, as is the shared tabulation.
+
+!$omp parallel do private(ii, dtc, rom, rk, dlconc, source, dchema,  &
+!$omp                     conv_factor, ncycle, dtrest, xtab, found)  &
+!$omp             schedule(dynamic, 64)                              &
+!$omp             if (ichemistry .le. 3 .and. .not. use_tab)
 do iel = 1, ncel
 
   ! time step
@@ -162,18 +208,38 @@ do iel = 1, ncel
 
   endif ! End test isepchemistry
 
+  ! Reuse a tabulated integration if available
+
+  found = .false.
+  if (use_tab) then
+    xtab(1:nespg) = dlconc(1:nespg)
+    xtab(nespg+1:2*nespg) = source(1:nespg)
+    xtab(2*nespg+1:2*nespg+nrg) = rk(1:nrg)
+    xtab(2*nespg+nrg+1) = rom
+    xtab(2*nespg+nrg+2) = dtc
+    found = cs_atmo_chemistry_tab_retrieve(ntab, xtab, nespg, dlconc)
+  endif
+
   ! Rosenbrock resoluion
 
-  ! The maximum time step used for chemistry resolution is dtchemmax
-  if (dtc.le.dtchemmax) then
-    call chem_roschem (dlconc,source,source,conv_factor,dtc,rk,rk)
-  else
-    ncycle = int(dtc/dtchemmax)
-    dtrest = mod(dtc,dtchemmax)
-    do ii = 1, ncycle
-      call chem_roschem (dlconc,source,source,conv_factor,dtchemmax,rk,rk)
-    enddo
-    call chem_roschem (dlconc,source,source,conv_factor,dtrest,rk,rk)
+  if (.not. found) then
+
+    ! The maximum time step used for chemistry resolution is dtchemmax
+    if (dtc.le.dtchemmax) then
+      call chem_roschem (dlconc,source,source,conv_factor,dtc,rk,rk)
+    else
+      ncycle = int(dtc/dtchemmax)
+      dtrest = mod(dtc,dtchemmax)
+      do ii = 1, ncycle
+        call chem_roschem (dlconc,source,source,conv_factor,dtchemmax,rk,rk)
+      enddo
+      call chem_roschem (dlconc,source,source,conv_factor,dtrest,rk,rk)
+    endif
+
+    if (use_tab) then
+      call cs_atmo_chemistry_tab_add(ntab, xtab, nespg, dlconc)
+    endif
+
   endif
 
   ! Update of values at current time step
@@ -182,6 +248,7 @@ do iel = 1, ncel
   enddo
 
 enddo
+!$omp end parallel do
 
 deallocate(cvar_espg, cvara_espg)
 
@@ -476,6 +476,10 @@ cs_at_data_assim_log(cs_measures_set_t     *ms,
   bft_printf("  Influence radii of observations (m, used for Model covariance "
              "error matrix) : %.2f %.2f\n",
              oi->ir[0], oi->ir[1]);
+  if (oi->cov_model == CS_AT_OPT_INTERP_COV_GASPARI_COHN)
+    bft_printf("  Model covariance function : Gaspari-Cohn\n");
+  else
+    bft_printf("  Model covariance function : SOAR\n");
   for (int kk = 0; kk < f->dim; kk++) {
     bft_printf("  Relaxation factor (1/s) for comp. %i: %.1e\n",
                kk, oi->relax[kk]);
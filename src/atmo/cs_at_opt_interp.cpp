@@ -415,38 +415,186 @@ _p1_projection(cs_measures_set_t  *ms,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute the Gaspari-Cohn 5th order piecewise rational function.
+ *
+ * This function approximates a gaussian, but has compact support,
+ * being zero for z >= 2.
+ *
+ * parameters:
+ *   z <-- normalized distance
+ *----------------------------------------------------------------------------*/
+
+inline static cs_real_t
+_gaspari_cohn(cs_real_t  z)
+{
+  if (z >= 2.)
+    return 0.;
+
+  cs_real_t z2 = z*z;
+  cs_real_t z3 = z2*z;
+
+  if (z <= 1.)
+    return (((-0.25*z + 0.5)*z + 0.625)*z3 - 5./3.*z2 + 1.);
+
+  return (  (((1./12.*z - 0.5)*z + 0.625)*z3 + 5./3.*z2)
+          - 5.*z + 4. - 2./(3.*z));
+}
+
 /*----------------------------------------------------------------------------
  * Compute coefficient bij of model covariance matrix (B)
  * of size n_cells*n_cells.
  *
  * parameters:
- *   xi     <-- x coordinate of point I
- *   yi     <-- y coordinate of point I
- *   zi     <-- z coordinate of point I
- *   xj     <-- x coordinate of point J
- *   yj     <-- y coordinate of point J
- *   zj     <-- z coordinate of point J
- *   ir_xy2 <-- square of influence radius with respect to x and y
- *   ir_z2  <-- square of influence radius with respect to z
+ *   xi        <-- x coordinate of point I
+ *   yi        <-- y coordinate of point I
+ *   zi        <-- z coordinate of point I
+ *   xj        <-- x coordinate of point J
+ *   yj        <-- y coordinate of point J
+ *   zj        <-- z coordinate of point J
+ *   ir_xy2    <-- square of influence radius with respect to x and y
+ *   ir_z2     <-- square of influence radius with respect to z
+ *   cov_model <-- model covariance function type
  *----------------------------------------------------------------------------*/
 
 inline static cs_real_t
-_b_matrix(cs_real_t  xi,
-          cs_real_t  yi,
-          cs_real_t  zi,
-          cs_real_t  xj,
-          cs_real_t  yj,
-          cs_real_t  zj,
-          cs_real_t  ir_xy2,
-          cs_real_t  ir_z2)
+_b_matrix(cs_real_t               xi,
+          cs_real_t               yi,
+          cs_real_t               zi,
+          cs_real_t               xj,
+          cs_real_t               yj,
+          cs_real_t               zj,
+          cs_real_t               ir_xy2,
+          cs_real_t               ir_z2,
+          cs_at_opt_interp_cov_t  cov_model)
 {
   cs_real_t dist = sqrt( ( cs_math_sq(xi - xj)
                          + cs_math_sq(yi - yj) )/ir_xy2
                        + cs_math_sq(zi - zj)/ir_z2);
 
+  if (cov_model == CS_AT_OPT_INTERP_COV_GASPARI_COHN)
+    return _gaspari_cohn(dist);
+
   return (1. + dist) * exp(-dist);
 }
 
+/*----------------------------------------------------------------------------
+ * Build a uniform bucket grid over points, so that only points in buckets
+ * neighboring a given location need to be visited when the covariance
+ * function has compact support.
+ *
+ * Points are renumbered by bucket, so that coordinates and coefficients
+ * of points in a same bucket are contiguous.
+ *
+ * Buckets are at least of size 2 (the support of the Gaspari-Cohn
+ * function in normalized coordinates), and are enlarged if needed
+ * so that their number remains proportional to that of points.
+ *
+ * parameters:
+ *   n_pts     <-- number of points
+ *   pt_coords <-> normalized point coordinates (renumbered on output)
+ *   pt_coefs  <-> point coefficients (renumbered on output)
+ *   b_min     --> bucket grid lower bounds
+ *   b_size    --> bucket size
+ *   b_dims    --> number of buckets in each direction
+ *   b_idx     --> bucket to points index (size: n_buckets + 1)
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_bucket_grid(cs_lnum_t     n_pts,
+                   cs_real_3_t   pt_coords[],
+                   cs_real_t     pt_coefs[],
+                   cs_real_t     b_min[3],
+                   cs_real_t    *b_size,
+                   cs_lnum_t     b_dims[3],
+                   cs_lnum_t   **b_idx)
+{
+  cs_real_t b_max[3];
+
+  for (int k = 0; k < 3; k++) {
+    b_min[k] = (n_pts > 0) ? pt_coords[0][k] : 0.;
+    b_max[k] = b_min[k];
+  }
+  for (cs_lnum_t i = 1; i < n_pts; i++) {
+    for (int k = 0; k < 3; k++) {
+      b_min[k] = CS_MIN(b_min[k], pt_coords[i][k]);
+      b_max[k] = CS_MAX(b_max[k], pt_coords[i][k]);
+    }
+  }
+
+  const cs_real_t n_b_max = 4.*n_pts + 64.;
+
+  cs_real_t h = 2.;
+
+  while (true) {
+    cs_real_t _n_b = 1.;
+    for (int k = 0; k < 3; k++)
+      _n_b *= floor((b_max[k] - b_min[k]) / h) + 1.;
+    if (_n_b <= n_b_max)
+      break;
+    h *= 2.;
+  }
+
+  cs_lnum_t n_b = 1;
+  for (int k = 0; k < 3; k++) {
+    b_dims[k] = (cs_lnum_t)((b_max[k] - b_min[k]) / h) + 1;
+    n_b *= b_dims[k];
+  }
+
+  *b_size = h;
+
+  /* Count points per bucket */
+
+  cs_lnum_t *_b_idx, *b_id;
+  BFT_MALLOC(_b_idx, n_b + 1, cs_lnum_t);
+  BFT_MALLOC(b_id, n_pts, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_b + 1; i++)
+    _b_idx[i] = 0;
+
+  for (cs_lnum_t i = 0; i < n_pts; i++) {
+    cs_lnum_t b_ijk[3];
+    for (int k = 0; k < 3; k++) {
+      b_ijk[k] = (cs_lnum_t)((pt_coords[i][k] - b_min[k]) / h);
+      if (b_ijk[k] >= b_dims[k])
+        b_ijk[k] = b_dims[k] - 1;
+    }
+    b_id[i] = (b_ijk[2]*b_dims[1] + b_ijk[1])*b_dims[0] + b_ijk[0];
+    _b_idx[b_id[i] + 1] += 1;
+  }
+
+  for (cs_lnum_t i = 0; i < n_b; i++)
+    _b_idx[i+1] += _b_idx[i];
+
+  /* Renumber points */
+
+  cs_real_3_t *r_coords;
+  cs_real_t *r_coefs;
+  BFT_MALLOC(r_coords, n_pts, cs_real_3_t);
+  BFT_MALLOC(r_coefs, n_pts, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_pts; i++) {
+    cs_lnum_t j = _b_idx[b_id[i]];
+    _b_idx[b_id[i]] += 1;
+    for (int k = 0; k < 3; k++)
+      r_coords[j][k] = pt_coords[i][k];
+    r_coefs[j] = pt_coefs[i];
+  }
+
+  for (cs_lnum_t i = n_b; i > 0; i--)
+    _b_idx[i] = _b_idx[i-1];
+  _b_idx[0] = 0;
+
+  memcpy(pt_coords, r_coords, n_pts*sizeof(cs_real_3_t));
+  memcpy(pt_coefs, r_coefs, n_pts*sizeof(cs_real_t));
+
+  BFT_FREE(r_coefs);
+  BFT_FREE(r_coords);
+  BFT_FREE(b_id);
+
+  *b_idx = _b_idx;
+}
+
 /*----------------------------------------------------------------------------
  * Assemble full matrix HB(H)t+R.
  *----------------------------------------------------------------------------*/
@@ -714,6 +862,7 @@ cs_at_opt_interp_read_file(char const           filename[50],
   oi->nb_times = 0;
   oi->ir[0] = 100.;
   oi->ir[1] = 100.;
+  oi->cov_model = CS_AT_OPT_INTERP_COV_SOAR;
   oi->n_log_data = 10;
   oi->interp_type = CS_AT_OPT_INTERP_P0;
   oi->steady = -1;
@@ -881,6 +1030,25 @@ cs_at_opt_interp_read_file(char const           filename[50],
       }
     }
 
+    /* Reading model covariance function type */
+    if (strncmp(line, "_cov_", 5) == 0) {
+      fgets(line, MAX_LINE_SIZE, fh);
+      if (strncmp(line, "SOAR", 4) == 0)
+        oi->cov_model = CS_AT_OPT_INTERP_COV_SOAR;
+      else if (strncmp(line, "GC", 2) == 0)
+        oi->cov_model = CS_AT_OPT_INTERP_COV_GASPARI_COHN;
+      else {
+        bft_error(__FILE__, __LINE__, 0,
+                  _("File %s. Section _cov_: wrong key"
+                    " (admissible keys: SOAR, GC)."), filename);
+      }
+
+#if _OI_DEBUG_
+      bft_printf("   * Reading _cov_ : %s\n",
+                 (oi->cov_model == CS_AT_OPT_INTERP_COV_SOAR) ? "SOAR" : "GC");
+#endif
+    }
+
     /* Reading relaxation time */
     if (strncmp(line, "_t_", 3) == 0) {
       cs_real_t *tau = NULL;
@@ -1377,8 +1545,12 @@ cs_at_opt_interp_project_model_covariance(cs_measures_set_t  *ms,
   const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
   const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
 
+  const cs_at_opt_interp_cov_t cov_model = oi->cov_model;
+
+  /* B is symmetric, so only compute the upper triangle of HB(H)t */
+
   for (cs_lnum_t ii = 0; ii < n_obs; ii++) {
-    for (cs_lnum_t jj = 0; jj < n_obs; jj++) {
+    for (cs_lnum_t jj = ii; jj < n_obs; jj++) {
       for (int pp = 0; pp < dim; pp++)
         b_proj[dim*(ii*n_obs + jj) + pp] = 0;
 
@@ -1392,13 +1564,17 @@ cs_at_opt_interp_project_model_covariance(cs_measures_set_t  *ms,
           cs_real_t y2 = (proj + ll*stride)[dim+1];
           cs_real_t z2 = (proj + ll*stride)[dim+2];
 
-          cs_real_t influ = _b_matrix(x1, y1, z1, x2, y2, z2, ir_xy2, ir_z2);
+          cs_real_t influ = _b_matrix(x1, y1, z1, x2, y2, z2,
+                                      ir_xy2, ir_z2, cov_model);
 
           for (int pp = 0; pp < dim; pp++)
             b_proj[dim*(ii*n_obs + jj) + pp] += (proj + kk*stride)[pp] * (proj + ll*stride)[pp]
                                               * influ;
         }
       }
+
+      for (int pp = 0; pp < dim; pp++)
+        b_proj[dim*(jj*n_obs + ii) + pp] = b_proj[dim*(ii*n_obs + jj) + pp];
     }
   }
 }
@@ -1639,6 +1815,8 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
     int r_id0 = 0;
     if (cs_glob_rank_id > -1) r_id0 = ig->rank_connect[obs_id];
 
+    inc[ii] = 0.;
+
     if (cs_glob_rank_id < 0 || cs_glob_rank_id == r_id0) {
       inc[ii] = ms->measures[oi->active_time[m_dim*obs_id+mc_id]];
 
@@ -1650,15 +1828,11 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
     }
   }
 
-  /* exchange innovation */
+  /* exchange innovation; each observation is handled by a single rank,
+     and is zero on others, so a single sum replaces one broadcast per
+     observation */
 
-  if (cs_glob_rank_id > -1) {
-    for (int ii = 0; ii < n_active_obs; ii++) {
-      int obs_id = ao_idx[ii];
-      int r_id0 = ig->rank_connect[obs_id];
-      cs_parall_bcast(r_id0, 1, CS_DOUBLE, &(inc[ii]));
-    }
-  }
+  cs_parall_sum(n_active_obs, CS_REAL_TYPE, inc);
 
 #if _OI_DEBUG_
   bft_printf("\n   * Observation increments\n    ");
@@ -1708,30 +1882,116 @@ cs_at_opt_interp_compute_analysis(cs_field_t         *f,
   BFT_FREE(alu);
   BFT_FREE(inc);
 
-  const cs_real_t ir_xy2 = cs_math_sq(oi->ir[0]);
-  const cs_real_t ir_z2 = cs_math_sq(oi->ir[1]);
+  /* Gather all active observation points in a single batch, with
+     coordinates normalized by the influence radii */
+
+  const cs_real_t ir_xy = oi->ir[0];
+  const cs_real_t ir_z = oi->ir[1];
+
+  cs_lnum_t n_pts = 0;
+  for (int ll = 0; ll < n_active_obs; ll++)
+    n_pts += proj_idx[ao_idx[ll]+1] - proj_idx[ao_idx[ll]];
+
+  cs_real_3_t *pt_coords;
+  cs_real_t *pt_coefs;
+  BFT_MALLOC(pt_coords, n_pts, cs_real_3_t);
+  BFT_MALLOC(pt_coefs, n_pts, cs_real_t);
+
+  n_pts = 0;
+  for (int ll = 0; ll < n_active_obs; ll++) {
+    for (int mm = proj_idx[ao_idx[ll]];
+         mm < proj_idx[ao_idx[ll]+1];
+         mm++) {
+      pt_coords[n_pts][0] = (proj + mm*stride)[m_dim  ] / ir_xy;
+      pt_coords[n_pts][1] = (proj + mm*stride)[m_dim+1] / ir_xy;
+      pt_coords[n_pts][2] = (proj + mm*stride)[m_dim+2] / ir_z;
+      pt_coefs[n_pts] = (proj + mm*stride)[mc_id] * vect[ll];
+      n_pts++;
+    }
+  }
+
+  BFT_FREE(vect);
 
-  for (cs_lnum_t ii = 0; ii < mesh->n_cells; ii++) {
-    f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] =
-      f->val_pre[ii*f_dim+ms->comp_ids[mc_id]];
-
-    for (int ll = 0; ll < n_active_obs; ll++) {
-      for (int mm = proj_idx[ao_idx[ll]];
-           mm < proj_idx[ao_idx[ll]+1];
-           mm++) {
-        cs_real_t x = (proj + mm*stride)[m_dim  ];
-        cs_real_t y = (proj + mm*stride)[m_dim+1];
-        cs_real_t z = (proj + mm*stride)[m_dim+2];
-        f_oia->val[ii*f_dim+ms->comp_ids[mc_id]] +=  (proj + mm*stride)[mc_id] * vect[ll]
-                                                   * _b_matrix(cell_cen[ii][0],
-                                                               cell_cen[ii][1],
-                                                               cell_cen[ii][2],
-                                                               x, y, z, ir_xy2, ir_z2);
+  const int c_id = ms->comp_ids[mc_id];
+  const cs_real_t *val_pre = f->val_pre;
+  cs_real_t *val = f_oia->val;
+
+  if (oi->cov_model == CS_AT_OPT_INTERP_COV_GASPARI_COHN) {
+
+    /* Compact support: only visit points in neighboring buckets */
+
+    cs_real_t b_min[3], h;
+    cs_lnum_t b_dims[3];
+    cs_lnum_t *b_idx = NULL;
+
+    _build_bucket_grid(n_pts, pt_coords, pt_coefs,
+                       b_min, &h, b_dims, &b_idx);
+
+#   pragma omp parallel for if (mesh->n_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < mesh->n_cells; ii++) {
+      const cs_real_t c_coo[3] = {cell_cen[ii][0] / ir_xy,
+                                  cell_cen[ii][1] / ir_xy,
+                                  cell_cen[ii][2] / ir_z};
+
+      cs_real_t v = val_pre[ii*f_dim + c_id];
+
+      cs_lnum_t b_s[3], b_e[3];
+      bool in_range = (n_pts > 0);
+      for (int k = 0; k < 3; k++) {
+        b_s[k] = CS_MAX((cs_lnum_t)floor((c_coo[k] - 2. - b_min[k])/h), 0);
+        b_e[k] = CS_MIN((cs_lnum_t)floor((c_coo[k] + 2. - b_min[k])/h),
+                        b_dims[k] - 1);
+        if (b_e[k] < b_s[k])
+          in_range = false;
       }
+
+      if (in_range) {
+        for (cs_lnum_t bk = b_s[2]; bk <= b_e[2]; bk++) {
+          for (cs_lnum_t bj = b_s[1]; bj <= b_e[1]; bj++) {
+            for (cs_lnum_t bi = b_s[0]; bi <= b_e[0]; bi++) {
+              cs_lnum_t b_id = (bk*b_dims[1] + bj)*b_dims[0] + bi;
+              for (cs_lnum_t mm = b_idx[b_id]; mm < b_idx[b_id+1]; mm++) {
+                const cs_real_t *p_coo = pt_coords[mm];
+                cs_real_t dist = sqrt(  cs_math_sq(c_coo[0] - p_coo[0])
+                                      + cs_math_sq(c_coo[1] - p_coo[1])
+                                      + cs_math_sq(c_coo[2] - p_coo[2]));
+                v += pt_coefs[mm] * _gaspari_cohn(dist);
+              }
+            }
+          }
+        }
+      }
+
+      val[ii*f_dim + c_id] = v;
     }
+
+    BFT_FREE(b_idx);
+
   }
+  else {
 
-  BFT_FREE(vect);
+#   pragma omp parallel for if (mesh->n_cells > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < mesh->n_cells; ii++) {
+      const cs_real_t c_coo[3] = {cell_cen[ii][0] / ir_xy,
+                                  cell_cen[ii][1] / ir_xy,
+                                  cell_cen[ii][2] / ir_z};
+
+      cs_real_t v = val_pre[ii*f_dim + c_id];
+
+      for (cs_lnum_t mm = 0; mm < n_pts; mm++) {
+        cs_real_t dist = sqrt(  cs_math_sq(c_coo[0] - pt_coords[mm][0])
+                              + cs_math_sq(c_coo[1] - pt_coords[mm][1])
+                              + cs_math_sq(c_coo[2] - pt_coords[mm][2]));
+        v += pt_coefs[mm] * (1. + dist) * exp(-dist);
+      }
+
+      val[ii*f_dim + c_id] = v;
+    }
+
+  }
+
+  BFT_FREE(pt_coefs);
+  BFT_FREE(pt_coords);
 }
 
 /*----------------------------------------------------------------------------*/
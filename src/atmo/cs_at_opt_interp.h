@@ -59,6 +59,16 @@ typedef enum {
 
 } cs_at_opt_interp_type_t;
 
+typedef enum {
+
+  CS_AT_OPT_INTERP_COV_SOAR,          /* Second order auto-regressive
+                                         function (global support) */
+  CS_AT_OPT_INTERP_COV_GASPARI_COHN   /* Gaspari-Cohn function (compact
+                                         support of twice the influence
+                                         radius) */
+
+} cs_at_opt_interp_cov_t;
+
 typedef struct _cs_at_opt_interp_t {
 
   const char              *name;                /* Name */
@@ -72,6 +82,7 @@ typedef struct _cs_at_opt_interp_t {
   cs_lnum_t               *model_to_obs_proj_c_ids;
   cs_real_t               *b_proj;
   cs_real_t                ir[2];
+  cs_at_opt_interp_cov_t   cov_model;
   cs_real_t               *relax;
   int                      nb_times;
   int                     *measures_idx;
@@ -101,6 +101,7 @@
 
 #include "cs_atmo.h"
 #include "cs_atmo_aerosol.h"
+#include "cs_atmo_chemistry_tab.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -283,6 +284,7 @@ static cs_atmo_chemistry_t _atmo_chem = {
   .n_reactions = 0,
   .chemistry_sep_mode = 2,
   .chemistry_with_photolysis = true,
+  .tabulation_rtol = 0.,
   .aerosol_model = CS_ATMO_AEROSOL_OFF,
   .frozen_gas_chem = false,
   .init_gas_with_lib = false,
@@ -2304,6 +2306,8 @@ cs_f_atmo_chem_finalize(void)
   if (_atmo_chem.aerosol_model != CS_ATMO_AEROSOL_OFF)
     cs_atmo_aerosol_finalize();
 
+  cs_atmo_chemistry_tab_finalize();
+
   BFT_FREE(_atmo_chem.reacnum);
   BFT_FREE(_atmo_chem.species_to_scalar_id);
   BFT_FREE(_atmo_chem.species_to_field_id);
@@ -4803,12 +4807,14 @@ cs_atmo_chemistry_log_setup(void)
          "      n_species: %18d (Number of species)\n"
          "      n_reactions: %16d (Number of reactions)\n"
          "      photolysis: %17s\n"
-         "      frozen_gas_chem: %12s\n\n"),
+         "      frozen_gas_chem: %12s\n"
+         "      tabulation_rtol: %12.5e\n\n"),
        cs_glob_atmo_chemistry->model,
        cs_glob_atmo_chemistry->n_species,
        cs_glob_atmo_chemistry->n_reactions,
        cs_glob_atmo_chemistry->chemistry_with_photolysis ? "Yes": "No",
-       cs_glob_atmo_chemistry->frozen_gas_chem ? "Yes": "No");
+       cs_glob_atmo_chemistry->frozen_gas_chem ? "Yes": "No",
+       cs_glob_atmo_chemistry->tabulation_rtol);
 
   }
   else if (cs_glob_atmo_chemistry->model == 4) {
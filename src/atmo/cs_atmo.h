@@ -519,6 +519,10 @@ typedef struct {
   /* Flag to deactivate photolysis */
   bool chemistry_with_photolysis;
 
+  /*! Relative tolerance for in-situ tabulation of gaseous chemistry
+    (0 if disabled) */
+  cs_real_t tabulation_rtol;
+
   /*! Choice of the aerosol model
        - CS_ATMO_AEROSOL_OFF ---> no aerosol model
        - CS_ATMO_AEROSOL_SSH ---> external library SSH-aerosol */
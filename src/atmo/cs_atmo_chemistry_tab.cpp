@@ -0,0 +1,421 @@
+/*============================================================================
+ * In-situ tabulation of atmospheric gaseous chemistry
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_atmo.h"
+#include "cs_log.h"
+#include "cs_parall.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_atmo_chemistry_tab.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_atmo_chemistry_tab.cpp
+
+  In-situ tabulation of atmospheric gaseous chemistry.
+
+  Many cells often share nearly identical chemical states. For each
+  integrated state (concentrations, source terms, kinetic rates, density,
+  and time step), the resulting concentration increment is stored in a
+  per-rank table, so that cells whose state matches a record within the
+  relative tolerance may reuse it instead of integrating the stiff system
+  again (i.e. using a local linear approximation with unit sensitivity).
+
+  States are binned on a logarithmic scale with a bin width matching the
+  tolerance, and records are found through a hash of the bin indices,
+  so all components of a matching record are within the tolerance.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+typedef struct {
+
+  int          n_x;            /* State size */
+  int          n_y;            /* Number of concentrations */
+
+  cs_lnum_t    n_records;      /* Number of records */
+  cs_lnum_t    n_max_records;  /* Maximum number of records */
+  cs_lnum_t    hash_mask;      /* Hash table size - 1 */
+
+  cs_lnum_t   *h_to_r;         /* Record id per hash slot, or -1 */
+  uint64_t    *key;            /* Key per record */
+  cs_real_t   *x;              /* State per record */
+  cs_real_t   *dy;             /* Concentration increment per record */
+
+} _chem_tab_t;
+
+/*=============================================================================
+ * Local static variables
+ *============================================================================*/
+
+/* Values below this threshold (in absolute value) are considered equal */
+
+static const double _x_min = 1e-30;
+
+/* Memory budget for tabulation (in bytes) */
+
+static const size_t _max_size = 32*1024*1024;
+
+static _chem_tab_t  *_tab = nullptr;
+
+static cs_gnum_t  _n_queries = 0;
+static cs_gnum_t  _n_hits = 0;
+static cs_gnum_t  _n_resets = 0;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Compute the key associated with a state.
+ *
+ * parameters:
+ *   n_x    <-- size of state
+ *   x      <-- state
+ *   l_tol  <-- log(1 + relative tolerance)
+ *
+ * returns:
+ *   key based on state bins
+ *----------------------------------------------------------------------------*/
+
+static uint64_t
+_state_key(int              n_x,
+           const cs_real_t  x[],
+           double           l_tol)
+{
+  uint64_t h = 14695981039346656037ULL;  /* FNV-1a offset basis */
+
+  for (int i = 0; i < n_x; i++) {
+    int64_t q = 0;
+    double a = fabs(x[i]);
+    if (a > _x_min) {
+      q = (int64_t)floor(log(a / _x_min) / l_tol) + 1;
+      if (x[i] < 0)
+        q = -q;
+    }
+    h = (h ^ (uint64_t)q) * 1099511628211ULL;  /* FNV prime */
+  }
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Check if all components of a state are within tolerance of a record's.
+ *
+ * parameters:
+ *   n_x    <-- size of state
+ *   x      <-- state
+ *   x_r    <-- record state
+ *   r_tol  <-- relative tolerance
+ *
+ * returns:
+ *   true if states match
+ *----------------------------------------------------------------------------*/
+
+static bool
+_state_match(int              n_x,
+             const cs_real_t  x[],
+             const cs_real_t  x_r[],
+             double           r_tol)
+{
+  for (int i = 0; i < n_x; i++) {
+    double m = fmax(fabs(x[i]), fabs(x_r[i]));
+    if (m > _x_min && fabs(x[i] - x_r[i]) > r_tol*m)
+      return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Create tabulation for given state and concentration sizes.
+ *
+ * parameters:
+ *   n_x  <-- size of state
+ *   n_y  <-- number of concentrations
+ *
+ * returns:
+ *   pointer to tabulation structure
+ *----------------------------------------------------------------------------*/
+
+static _chem_tab_t *
+_chem_tab_create(int  n_x,
+                 int  n_y)
+{
+  _chem_tab_t *t;
+  BFT_MALLOC(t, 1, _chem_tab_t);
+
+  size_t r_size = (n_x + n_y)*sizeof(cs_real_t) + sizeof(uint64_t);
+
+  t->n_x = n_x;
+  t->n_y = n_y;
+  t->n_records = 0;
+  t->n_max_records = CS_MAX(_max_size / r_size, 1024);
+
+  cs_lnum_t h_size = 1;
+  while (h_size < 2*t->n_max_records)
+    h_size *= 2;
+  t->hash_mask = h_size - 1;
+
+  BFT_MALLOC(t->h_to_r, h_size, cs_lnum_t);
+  BFT_MALLOC(t->key, t->n_max_records, uint64_t);
+  BFT_MALLOC(t->x, (size_t)(t->n_max_records)*n_x, cs_real_t);
+  BFT_MALLOC(t->dy, (size_t)(t->n_max_records)*n_y, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < h_size; i++)
+    t->h_to_r[i] = -1;
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy tabulation.
+ *
+ * parameters:
+ *   t  <-> pointer to tabulation structure pointer
+ *----------------------------------------------------------------------------*/
+
+static void
+_chem_tab_destroy(_chem_tab_t  **t)
+{
+  _chem_tab_t *_t = *t;
+
+  if (_t != nullptr) {
+    BFT_FREE(_t->h_to_r);
+    BFT_FREE(_t->key);
+    BFT_FREE(_t->x);
+    BFT_FREE(_t->dy);
+    BFT_FREE(*t);
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if in-situ tabulation of gaseous chemistry is active.
+ *
+ * \return  true if \ref cs_atmo_chemistry_t::tabulation_rtol > 0
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_atmo_chemistry_tab_is_active(void)
+{
+  return (cs_glob_atmo_chemistry->tabulation_rtol > 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Retrieve the result of a chemistry integration from the
+ *        tabulation, if a record matches the given state.
+ *
+ * A record matches if each state component differs from the record's by
+ * less than the relative tolerance defined by
+ * \ref cs_atmo_chemistry_t::tabulation_rtol. The concentration increment
+ * of the record is then applied to the given concentrations.
+ *
+ * \param[in]   n_x  size of state
+ * \param[in]   x    state (concentrations first, then other parameters)
+ * \param[in]   n_y  number of concentrations
+ * \param[out]  y    concentrations after integration, if found
+ *
+ * \return  true if a matching record was found, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_atmo_chemistry_tab_retrieve(int              n_x,
+                               const cs_real_t  x[],
+                               int              n_y,
+                               cs_real_t        y[])
+{
+  const double r_tol = cs_glob_atmo_chemistry->tabulation_rtol;
+
+  _n_queries += 1;
+
+  if (_tab == nullptr || r_tol <= 0)
+    return false;
+
+  assert(n_x == _tab->n_x && n_y == _tab->n_y);
+
+  uint64_t k = _state_key(n_x, x, log1p(r_tol));
+
+  cs_lnum_t s_id = k & _tab->hash_mask;
+
+  while (_tab->h_to_r[s_id] > -1) {
+    cs_lnum_t r_id = _tab->h_to_r[s_id];
+    if (   _tab->key[r_id] == k
+        && _state_match(n_x, x, _tab->x + (size_t)r_id*n_x, r_tol)) {
+      const cs_real_t *dy = _tab->dy + (size_t)r_id*n_y;
+      for (int i = 0; i < n_y; i++)
+        y[i] = fmax(x[i] + dy[i], 0.);
+      _n_hits += 1;
+      return true;
+    }
+    s_id = (s_id + 1) & _tab->hash_mask;
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the result of a chemistry integration to the tabulation.
+ *
+ * When the tabulation is full, it is emptied before adding the record.
+ *
+ * \param[in]  n_x  size of state
+ * \param[in]  x    state (concentrations first, then other parameters)
+ * \param[in]  n_y  number of concentrations
+ * \param[in]  y    concentrations after integration
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chemistry_tab_add(int              n_x,
+                          const cs_real_t  x[],
+                          int              n_y,
+                          const cs_real_t  y[])
+{
+  const double r_tol = cs_glob_atmo_chemistry->tabulation_rtol;
+
+  if (r_tol <= 0)
+    return;
+
+  if (_tab == nullptr)
+    _tab = _chem_tab_create(n_x, n_y);
+
+  if (n_x != _tab->n_x || n_y != _tab->n_y)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: state sizes (%d, %d) differ from those of the\n"
+                "existing tabulation (%d, %d)."),
+              __func__, n_x, n_y, _tab->n_x, _tab->n_y);
+
+  /* Empty table when full */
+
+  if (_tab->n_records >= _tab->n_max_records) {
+    for (cs_lnum_t i = 0; i <= _tab->hash_mask; i++)
+      _tab->h_to_r[i] = -1;
+    _tab->n_records = 0;
+    _n_resets += 1;
+  }
+
+  cs_lnum_t r_id = _tab->n_records;
+  _tab->n_records += 1;
+
+  uint64_t k = _state_key(n_x, x, log1p(r_tol));
+
+  _tab->key[r_id] = k;
+
+  cs_real_t *x_r = _tab->x + (size_t)r_id*n_x;
+  cs_real_t *dy = _tab->dy + (size_t)r_id*n_y;
+
+  memcpy(x_r, x, n_x*sizeof(cs_real_t));
+  for (int i = 0; i < n_y; i++)
+    dy[i] = y[i] - x[i];
+
+  cs_lnum_t s_id = k & _tab->hash_mask;
+  while (_tab->h_to_r[s_id] > -1)
+    s_id = (s_id + 1) & _tab->hash_mask;
+
+  _tab->h_to_r[s_id] = r_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log tabulation statistics and free the tabulation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chemistry_tab_finalize(void)
+{
+  if (cs_glob_atmo_chemistry->tabulation_rtol > 0) {
+
+    cs_gnum_t n[3] = {_n_queries, _n_hits, _n_resets};
+    cs_parall_counter(n, 3);
+
+    if (n[0] > 0)
+      cs_log_printf
+        (CS_LOG_PERFORMANCE,
+         _("\n"
+           "Gaseous chemistry tabulation:\n\n"
+           "  Number of queries:     %12llu\n"
+           "  Number of retrievals:  %12llu (%5.1f %%)\n"
+           "  Number of table resets: %11llu\n"),
+         (unsigned long long)n[0], (unsigned long long)n[1],
+         100. * (double)n[1] / (double)n[0],
+         (unsigned long long)n[2]);
+
+  }
+
+  _chem_tab_destroy(&_tab);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,113 @@
+#ifndef __CS_ATMO_CHEMISTRY_TAB_H__
+#define __CS_ATMO_CHEMISTRY_TAB_H__
+
+/*============================================================================
+ * In-situ tabulation of atmospheric gaseous chemistry
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if in-situ tabulation of gaseous chemistry is active.
+ *
+ * \return  true if \ref cs_atmo_chemistry_t::tabulation_rtol > 0
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_atmo_chemistry_tab_is_active(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Retrieve the result of a chemistry integration from the
+ *        tabulation, if a record matches the given state.
+ *
+ * A record matches if each state component differs from the record's by
+ * less than the relative tolerance defined by
+ * \ref cs_atmo_chemistry_t::tabulation_rtol. The concentration increment
+ * of the record is then applied to the given concentrations.
+ *
+ * \param[in]   n_x  size of state
+ * \param[in]   x    state (concentrations first, then other parameters)
+ * \param[in]   n_y  number of concentrations
+ * \param[out]  y    concentrations after integration, if found
+ *
+ * \return  true if a matching record was found, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_atmo_chemistry_tab_retrieve(int              n_x,
+                               const cs_real_t  x[],
+                               int              n_y,
+                               cs_real_t        y[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the result of a chemistry integration to the tabulation.
+ *
+ * When the tabulation is full, it is emptied before adding the record.
+ *
+ * \param[in]  n_x  size of state
+ * \param[in]  x    state (concentrations first, then other parameters)
+ * \param[in]  n_y  number of concentrations
+ * \param[in]  y    concentrations after integration
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chemistry_tab_add(int              n_x,
+                          const cs_real_t  x[],
+                          int              n_y,
+                          const cs_real_t  y[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log tabulation statistics and free the tabulation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_atmo_chemistry_tab_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_ATMO_CHEMISTRY_TAB_H__ */
@@ -33,6 +33,7 @@
 #include "cs_at_data_assim.h"
 #include "cs_atmo_aerosol.h"
 #include "cs_atmo_aerosol_ssh.h"
+#include "cs_atmo_chemistry_tab.h"
 #include "cs_at_opt_interp.h"
 #include "cs_atmo.h"
 #include "cs_atmo_profile_std.h"
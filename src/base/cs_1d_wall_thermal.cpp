@@ -181,6 +181,10 @@ const cs_1d_wall_thermal_t *cs_glob_1d_wall_thermal = &_1d_wall_thermal;
 
 static cs_restart_t *cs_glob_tpar1d_suite = nullptr;
 
+/* Number of faces solved simultaneously */
+
+static const cs_lnum_t _block_size = 8;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -232,6 +236,235 @@ _1d_wall_thermal_local_models_init(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve the 1D equation for a block of faces.
+ *
+ * The tridiagonal systems of the block's faces are stored in an interlaced
+ * (structure of arrays) layout, padded with identity rows up to the
+ * largest number of points, so that the Thomas algorithm is applied to
+ * all faces of the block simultaneously.
+ *
+ * \param[in]   n_b   number of faces in block (<= _block_size)
+ * \param[in]   ids   local model ids
+ * \param[in]   tf    fluid temperature at the boundary, for each face
+ * \param[in]   hf    exchange coefficient for the fluid, for each face
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_solve_block(cs_lnum_t        n_b,
+             const cs_lnum_t  ids[],
+             const cs_real_t  tf[],
+             const cs_real_t  hf[])
+{
+  const cs_lnum_t bs = _block_size;
+
+  cs_1d_wall_thermal_local_model_t *lm = _1d_wall_thermal.local_models;
+
+  const bool rad_coupling
+    = (cs_glob_lagr_extra_module->radiative_model >= 1) ? true : false;
+
+  cs_lnum_t n_max = 0;
+  for (cs_lnum_t j = 0; j < n_b; j++)
+    n_max = CS_MAX(n_max, lm[ids[j]].nppt1d);
+
+  cs_real_t _w[4*32*_block_size];
+  cs_real_t *w = _w;
+
+  if (n_max > 32)
+    BFT_MALLOC(w, 4*n_max*bs, cs_real_t);
+
+  /* Identity rows by default (padding) */
+
+  for (cs_lnum_t i = 0; i < 4*n_max*bs; i++)
+    w[i] = 0.;
+  for (cs_lnum_t i = n_max*bs; i < 2*n_max*bs; i++)
+    w[i] = 1.;
+
+  /* Build the tri-diagonal matrix of each face */
+
+  for (cs_lnum_t j = 0; j < n_b; j++) {
+
+    const cs_lnum_t ii = ids[j];
+    const cs_lnum_t ifac = _1d_wall_thermal.ifpt1d[ii] - 1;
+
+    cs_real_t qinc = 0., eps = 0.;
+    if (rad_coupling) {
+      /* coupling with radiative module, qinc and qeps != 0 */
+      /* incident radiative flux at the boundary at the boundary */
+      qinc = CS_F_(qinci)->val[ifac];
+
+      /* emissivity */
+      eps = CS_F_(emissivity)->val[ifac];
+    }
+
+    /* thermal diffusivity */
+    const cs_real_t xlmbt1 = lm[ii].xlmbt1;
+
+    /* volumetric heat capacity of the wall */
+    const cs_real_t rcp = lm[ii].rcpt1d;
+
+    /* exchange coefficient on the exterior wall */
+    const cs_real_t hept1d = lm[ii].hept1d;
+
+    /* flux on the exterior wall */
+    const cs_real_t fept1d = lm[ii].fept1d;
+
+    /* thickness of the 1D wall */
+    const cs_real_t eppt1d = lm[ii].eppt1d;
+
+    /* temperature on the exterior boundary */
+    const cs_real_t tept1d = lm[ii].tept1d;
+
+    /* time-step for the solid resolution */
+    const cs_real_t dtpt1d = lm[ii].dtpt1d;
+
+    /* type of exterior boundary condition */
+    const int iclt1d = lm[ii].iclt1d;
+
+    cs_real_t a1; /* extrapolation coefficient for temperature1 */
+    cs_real_t h2; /* thermal exchange coefficient on T(1) */
+    cs_real_t f3; /* thermal flux on Tfluide */
+    cs_real_t a4; /* extrapolation coefficient for temperature4 */
+
+    cs_real_t h5 = 0.; /* thermal exchange coefficient on T(n) */
+    cs_real_t f6 = 0.; /* thermal flux on Text */
+
+    cs_real_t m;
+
+    /* Interlaced coefficients for this face: row kk at index kk*bs */
+
+    cs_real_t *al = w + j;
+    cs_real_t *bl = w + n_max*bs + j;
+    cs_real_t *cl = w + 2*n_max*bs + j;
+    cs_real_t *dl = w + 3*n_max*bs + j;
+
+    const cs_lnum_t n = lm[ii].nppt1d;
+    const cs_real_t *zz = lm[ii].z;
+    const cs_real_t *t = lm[ii].t;
+
+    /* Boundary conditions on the fluid side: flux conservation */
+    /*   flux in the fluid = flux in the solid = f3 + h2*T1 */
+
+    a1 = 1./hf[j] + zz[0]/xlmbt1;
+    h2 = -1./a1; // TAKE CARE TO THE MINUS !
+    f3 = -h2*tf[j] + qinc;
+
+    /* Boundary conditions on the exterior */
+    /*   flux in the fluid = flux in the solid = f6 + h5*T(n-1) */
+
+    /* Dirichlet condition */
+    if (iclt1d == 1) {
+      a4 = 1./hept1d + (eppt1d - zz[n-1])/xlmbt1;
+      h5 = -1./a4;
+      f6 = -h5*tept1d;
+    }
+    /* Forced flux condition */
+    else if (iclt1d == 3) {
+      h5 = 0.;
+      f6 = fept1d;
+    }
+
+    /* Mesh interior points */
+    for (cs_lnum_t kk = 1; kk <= n-1; kk++) {
+      al[kk*bs] = -xlmbt1/(zz[kk]-zz[kk-1]);
+    }
+
+    m = 2*zz[0];
+    for (cs_lnum_t kk = 1; kk <= n-2; kk++) {
+      m = 2*(zz[kk]-zz[kk-1])-m;
+      bl[kk*bs] =   rcp/dtpt1d*m + xlmbt1/(zz[kk+1]-zz[kk])
+                  + xlmbt1/(zz[kk]-zz[kk-1]);
+    }
+
+    for (cs_lnum_t kk = 0; kk <= n-2; kk++) {
+      cl[kk*bs] =  -xlmbt1/(zz[kk+1]-zz[kk]);
+    }
+
+    m = 2*zz[0];
+    dl[0] = rcp/dtpt1d*m*t[0];
+
+    for (cs_lnum_t kk = 1; kk <= n-1; kk++) {
+      m = 2*(zz[kk]-zz[kk-1])-m;
+      dl[kk*bs] = rcp/dtpt1d*m*t[kk];
+    }
+
+    /* Boundary points */
+    /* bl[0] and bl[n-1] are initialized here and set later,
+       in the case where 0 = n-1 */
+    bl[0] = 0.;
+    bl[(n-1)*bs] = 0.;
+    al[0] = 0.;
+    bl[0] += rcp/dtpt1d*2*zz[0] + xlmbt1/(zz[1]-zz[0]) - h2
+           + eps*cs_physical_constants_stephan
+           * pow(t[0], 3.);
+    dl[0] += f3;
+    bl[(n-1)*bs] +=   rcp/dtpt1d*2*(eppt1d-zz[n-1])
+                    + xlmbt1/(zz[n-1]-zz[n-2]) - h5;
+    cl[(n-1)*bs] = 0.;
+    dl[(n-1)*bs] += f6;
+  }
+
+  /* System resolution by a Cholesky method ("dual-scan"),
+     vectorized across the faces of the block */
+
+  cs_real_t *al = w;
+  cs_real_t *bl = w + n_max*bs;
+  cs_real_t *cl = w + 2*n_max*bs;
+  cs_real_t *dl = w + 3*n_max*bs;
+
+  for (cs_lnum_t kk = 1; kk <= n_max-1; kk++) {
+#   pragma omp simd
+    for (cs_lnum_t j = 0; j < bs; j++) {
+      const cs_lnum_t k0 = (kk-1)*bs + j, k1 = kk*bs + j;
+      bl[k1] -= al[k1]*cl[k0]/bl[k0];
+      dl[k1] -= al[k1]*dl[k0]/bl[k0];
+    }
+  }
+
+  /* Solution is stored in dl */
+
+  if (n_max > 0) {
+#   pragma omp simd
+    for (cs_lnum_t j = 0; j < bs; j++) {
+      const cs_lnum_t k = (n_max-1)*bs + j;
+      dl[k] = dl[k]/bl[k];
+    }
+  }
+
+  for (cs_lnum_t kk = n_max-2; kk >= 0; kk--) {
+#   pragma omp simd
+    for (cs_lnum_t j = 0; j < bs; j++) {
+      const cs_lnum_t k0 = kk*bs + j, k1 = (kk+1)*bs + j;
+      dl[k0] = (dl[k0] - cl[k0]*dl[k1])/bl[k0];
+    }
+  }
+
+  /* Update temperatures and compute the new value of tp */
+
+  for (cs_lnum_t j = 0; j < n_b; j++) {
+
+    const cs_lnum_t ii = ids[j];
+    const cs_lnum_t n = lm[ii].nppt1d;
+    const cs_real_t xlmbt1 = lm[ii].xlmbt1;
+    const cs_real_t *zz = lm[ii].z;
+    cs_real_t *t = lm[ii].t;
+
+    for (cs_lnum_t kk = 0; kk < n; kk++)
+      t[kk] = dl[kk*bs + j];
+
+    _1d_wall_thermal.tppt1d[ii] = hf[j] + xlmbt1/zz[0];
+    _1d_wall_thermal.tppt1d[ii]
+      = 1./_1d_wall_thermal.tppt1d[ii]
+           *(xlmbt1*t[0]/zz[0] + hf[j]*tf[j]);
+
+  }
+
+  if (w != _w)
+    BFT_FREE(w);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -366,160 +599,56 @@ cs_1d_wall_thermal_solve(cs_lnum_t ii,
                          cs_real_t tf,
                          cs_real_t hf)
 {
-  cs_lnum_t kk;
-  cs_real_t qinc, eps;
-  cs_lnum_t ifac = _1d_wall_thermal.ifpt1d[ii] - 1;
-
-  if (cs_glob_lagr_extra_module->radiative_model >= 1) {
-    /* coupling with radiative module, qinc and qeps != 0 */
-    /* incident radiative flux at the boundary at the boundary */
-    qinc = CS_F_(qinci)->val[ifac];
-
-    /* emissivity */
-    eps = CS_F_(emissivity)->val[ifac];
-  } else {
-    /* without coupling with radiative module */
-    qinc = 0.;
-    eps = 0.;
-  }
-
-  /* thermal diffusivity */
-  cs_real_t xlmbt1 = _1d_wall_thermal.local_models[ii].xlmbt1;
-
-  /* volumetric heat capacity of the wall */
-  cs_real_t rcp = _1d_wall_thermal.local_models[ii].rcpt1d;
-
-  /* exchange coefficient on the exterior wall */
-  cs_real_t hept1d = _1d_wall_thermal.local_models[ii].hept1d;
-
-  /* flux on the exterior wall */
-  cs_real_t fept1d = _1d_wall_thermal.local_models[ii].fept1d;
-
-  /* thickness of the 1D wall */
-  cs_real_t eppt1d = _1d_wall_thermal.local_models[ii].eppt1d;
-
-  /* temperature on the exterior boundary */
-  cs_real_t tept1d = _1d_wall_thermal.local_models[ii].tept1d;
-
-  /* time-step for the solid resolution */
-  cs_real_t dtpt1d = _1d_wall_thermal.local_models[ii].dtpt1d;
-
-  /* type of exterior boundary condition */
-  int iclt1d = _1d_wall_thermal.local_models[ii].iclt1d;
-
-  cs_real_t a1; /* extrapolation coefficient for temperature1 */
-  cs_real_t h2; /* thermal exchange coefficient on T(1) */
-  cs_real_t f3; /* thermal flux on Tfluide */
-  cs_real_t a4; /* extrapolation coefficient for temperature4 */
-
-  cs_real_t h5 = 0.; /* thermal exchange coefficient on T(n) */
-  cs_real_t f6 = 0.; /* thermal flux on Text */
-
-  cs_real_t m;
-
-  cs_real_t _al[128];
-  cs_real_t *al, *bl, *cl, *dl;
-  cs_real_t *zz;
-  cs_lnum_t n;
-
-  n = _1d_wall_thermal.local_models[ii].nppt1d;
-
-  if (n > 32)
-    BFT_MALLOC(al, 4*n, cs_real_t);
-  else
-    al = _al;
-
-  bl = al+n;
-  cl = bl+n;
-  dl = cl+n;
-
-  zz = _1d_wall_thermal.local_models[ii].z;
-
-  /* Build the tri-diagonal matrix */
-
-  /* Boundary conditions on the fluid side: flux conservation */
-  /*   flux in the fluid = flux in the solid = f3 + h2*T1 */
-
-  a1 = 1./hf + zz[0]/xlmbt1;
-  h2 = -1./a1; // TAKE CARE TO THE MINUS !
-  f3 = -h2*tf + qinc;
-
-  /* Boundary conditions on the exterior */
-  /*   flux in the fluid = flux in the solid = f6 + h5*T(n-1) */
+  _solve_block(1, &ii, &tf, &hf);
+}
 
-  /* Dirichlet condition */
-  if (iclt1d == 1) {
-    a4 = 1./hept1d + (eppt1d - zz[n-1])/xlmbt1;
-    h5 = -1./a4;
-    f6 = -h5*tept1d;
-  }
-  /* Forced flux condition */
-  else if (iclt1d == 3) {
-    h5 = 0.;
-    f6 = fept1d;
-  }
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve the 1D equation for a set of coupled faces.
+ *
+ * Faces are processed by blocks, the tridiagonal systems of each block
+ * being solved simultaneously.
+ *
+ * \param[in]   n_elts   number of coupled faces to solve
+ * \param[in]   elt_ids  ids of coupled faces (0 to nfpt1d-1),
+ *                       or nullptr for all
+ * \param[in]   tf       fluid temperature at the boundary,
+ *                       for all boundary faces
+ * \param[in]   hf       exchange coefficient for the fluid,
+ *                       for all boundary faces
+ */
+/*----------------------------------------------------------------------------*/
 
-  /* Mesh interior points */
-  for (kk = 1; kk <= n-1; kk++) {
-    al[kk] = -xlmbt1/(zz[kk]-zz[kk-1]);
-  }
+void
+cs_1d_wall_thermal_solve_list(cs_lnum_t        n_elts,
+                              const cs_lnum_t  elt_ids[],
+                              const cs_real_t  tf[],
+                              const cs_real_t  hf[])
+{
+  const cs_lnum_t bs = _block_size;
+  const cs_lnum_t n_blocks = (n_elts + bs - 1) / bs;
 
-  m = 2*zz[0];
-  for (kk = 1; kk <= n-2; kk++) {
-    m = 2*(zz[kk]-zz[kk-1])-m;
-    bl[kk] = rcp/dtpt1d*m + xlmbt1/(zz[kk+1]-zz[kk]) + xlmbt1/(zz[kk]-zz[kk-1]);
-  }
+  const cs_lnum_t *ifpt1d = _1d_wall_thermal.ifpt1d;
 
-  for (kk = 0; kk <= n-2; kk++) {
-    cl[kk] =  -xlmbt1/(zz[kk+1]-zz[kk]);
-  }
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
 
-  m = 2*zz[0];
-  dl[0] = rcp/dtpt1d*m*(_1d_wall_thermal.local_models[ii].t)[0];
+    cs_lnum_t s_id = b_id*bs;
+    cs_lnum_t n_b = CS_MIN(bs, n_elts - s_id);
 
-  for (kk = 1; kk <= n-1; kk++) {
-    m = 2*(zz[kk]-zz[kk-1])-m;
-    dl[kk] = rcp/dtpt1d*m*(_1d_wall_thermal.local_models[ii].t)[kk];
-  }
+    cs_lnum_t ids[_block_size];
+    cs_real_t b_tf[_block_size], b_hf[_block_size];
 
-  /* Boundary points */
-  /* bl[0] and bl[n-1] are initialized here and set later,
-     in the case where 0 = n-1 */
-  bl[0] = 0.;
-  bl[n-1] = 0.;
-  al[0] = 0.;
-  bl[0] += rcp/dtpt1d*2*zz[0] + xlmbt1/(zz[1]-zz[0]) - h2
-         + eps*cs_physical_constants_stephan
-         * pow(_1d_wall_thermal.local_models[ii].t[0],3.);
-  dl[0] += f3;
-  bl[n-1] += rcp/dtpt1d*2*(_1d_wall_thermal.local_models[ii].eppt1d-zz[n-1])
-           + xlmbt1/(zz[n-1]-zz[n-2]) - h5;
-  cl[n-1] = 0.;
-  dl[n-1] += f6;
-
-  /* System resolution by a Cholesky method ("dual-scan") */
-  for (kk = 1; kk <= n-1; kk++) {
-    bl[kk] -= al[kk]*cl[kk-1]/bl[kk-1];
-    dl[kk] -= al[kk]*dl[kk-1]/bl[kk-1];
-  }
+    for (cs_lnum_t j = 0; j < n_b; j++) {
+      ids[j] = (elt_ids != nullptr) ? elt_ids[s_id + j] : s_id + j;
+      cs_lnum_t face_id = ifpt1d[ids[j]] - 1;
+      b_tf[j] = tf[face_id];
+      b_hf[j] = hf[face_id];
+    }
 
-  _1d_wall_thermal.local_models[ii].t[n-1] = dl[n-1]/bl[n-1];
+    _solve_block(n_b, ids, b_tf, b_hf);
 
-  for (kk=n-2; kk>=0; kk--) {
-    _1d_wall_thermal.local_models[ii].t[kk] =
-       (dl[kk] - cl[kk]*_1d_wall_thermal.local_models[ii].t[kk+1])/bl[kk];
   }
-
-  /* Compute the new value of tp */
-  _1d_wall_thermal.tppt1d[ii] = hf + xlmbt1/zz[0];
-  _1d_wall_thermal.tppt1d[ii]
-    = 1./_1d_wall_thermal.tppt1d[ii]
-         *(xlmbt1*_1d_wall_thermal.local_models[ii].t[0]/zz[0]
-           + hf*tf);
-
-  if (al != _al)
-    BFT_FREE(al);
-
 }
 
 /*----------------------------------------------------------------------------*/
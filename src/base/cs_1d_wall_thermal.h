@@ -182,6 +182,29 @@ cs_1d_wall_thermal_solve(cs_lnum_t ii,
                          cs_real_t tf,
                          cs_real_t hf);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve the 1D equation for a set of coupled faces.
+ *
+ * Faces are processed by blocks, the tridiagonal systems of each block
+ * being solved simultaneously.
+ *
+ * \param[in]   n_elts   number of coupled faces to solve
+ * \param[in]   elt_ids  ids of coupled faces (0 to nfpt1d-1),
+ *                       or NULL for all
+ * \param[in]   tf       fluid temperature at the boundary,
+ *                       for all boundary faces
+ * \param[in]   hf       exchange coefficient for the fluid,
+ *                       for all boundary faces
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_1d_wall_thermal_solve_list(cs_lnum_t        n_elts,
+                              const cs_lnum_t  elt_ids[],
+                              const cs_real_t  tf[],
+                              const cs_real_t  hf[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read the restart file of the 1D-wall thermal module.
@@ -46,6 +46,7 @@
 #include "cs_cdo_quantities.h"
 #include "cs_cdo_connect.h"
 #include "cs_cdo_main.h"
+#include "cs_dispatch.h"
 #include "cs_domain.h"
 #include "cs_domain_setup.h"
 #include "cs_equation.h"
@@ -67,6 +68,8 @@
 #include "cs_post.h"
 #include "cs_restart.h"
 #include "cs_restart_default.h"
+#include "cs_sles.h"
+#include "cs_sles_default.h"
 #include "cs_time_step.h"
 
 /*----------------------------------------------------------------------------
@@ -134,10 +137,82 @@ static cs_ale_cdo_bc_t  *_cdo_bc = nullptr;
 
 static bool cs_ale_active = false;
 
+static bool _cdo_sles_reuse_set = false;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set vertex coordinates from reference coordinates and a
+ *        displacement, and flag vertices whose coordinates changed.
+ *
+ * The update runs on the device when all arrays are accessible there.
+ *
+ * \param[in, out]  m           pointer to mesh (coordinates updated)
+ * \param[in]       vtx_coord0  reference vertex coordinates
+ * \param[in]       disp        vertex displacement, or nullptr for none
+ * \param[out]      vtx_moved   flag for moved vertices
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_update_vtx_coords(const cs_mesh_t    *m,
+                   const cs_real_3_t   vtx_coord0[],
+                   const cs_real_3_t   disp[],
+                   bool                vtx_moved[])
+{
+  const cs_lnum_t n_vertices = m->n_vertices;
+  cs_real_3_t *vtx_coord = (cs_real_3_t *)m->vtx_coord;
+
+  cs_dispatch_context ctx;
+
+  bool use_gpu = (cs_get_device_id() > -1);
+  const void *ptrs[] = {vtx_coord, vtx_coord0, disp, vtx_moved};
+  for (int i = 0; i < 4; i++) {
+    if (   ptrs[i] != nullptr
+        && cs_check_device_ptr(ptrs[i]) != CS_ALLOC_HOST_DEVICE_SHARED)
+      use_gpu = false;
+  }
+  ctx.set_use_gpu(use_gpu);
+
+  ctx.parallel_for(n_vertices, [=] CS_F_HOST_DEVICE (cs_lnum_t v_id) {
+    bool moved = false;
+    for (cs_lnum_t idim = 0; idim < 3; idim++) {
+      cs_real_t coo = vtx_coord0[v_id][idim];
+      if (disp != nullptr)
+        coo += disp[v_id][idim];
+      if (fabs(coo - vtx_coord[v_id][idim]) > 0.)
+        moved = true;
+      vtx_coord[v_id][idim] = coo;
+    }
+    vtx_moved[v_id] = moved;
+  });
+
+  ctx.wait();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update mesh quantities and bad cells after a vertex displacement.
+ *
+ * \param[in]  vtx_moved  flag for moved vertices, or nullptr if unknown
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_update_mesh_quantities(const bool  vtx_moved[])
+{
+  cs_mesh_t *m = cs_glob_mesh;
+  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+
+  cs_gradient_invalidate_quantities();
+  cs_cell_to_vertex_free();
+  cs_mesh_quantities_update_moved(m, mq, vtx_moved);
+  cs_mesh_bad_cells_detect(m, mq);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Update the values of mesh vertices lying on a free surface boundary
@@ -817,20 +892,28 @@ _ale_solve_poisson_cdo(const cs_domain_t  *domain,
 
   /* Compute the Poisson equation on the original mesh */
 
-  cs_real_3_t *vtx_coord = (cs_real_3_t *)m->vtx_coord;
-  cs_real_3_t *vtx_coord0 = (cs_real_3_t *)(cs_field_by_name("vtx_coord0")->val);
+  const cs_real_3_t *vtx_coord0
+    = (const cs_real_3_t *)(cs_field_by_name("vtx_coord0")->val);
   const cs_lnum_t n_vertices = m->n_vertices;
-  cs_mesh_quantities_t *mq = domain->mesh_quantities;
 
-  /* Back to original mesh */
+  bool *vtx_moved;
+  BFT_MALLOC(vtx_moved, n_vertices, bool);
 
-  for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
-    for (cs_lnum_t idim = 0; idim < 3; idim++) {
-      vtx_coord[v_id][idim] = vtx_coord0[v_id][idim];
-    }
-  }
+  /* Back to original mesh; only the quantities of the moving part
+     of the mesh are updated */
 
-  cs_ale_update_mesh_quantities(&(mq->min_vol), &(mq->max_vol), &(mq->tot_vol));
+  _update_vtx_coords(m, vtx_coord0, nullptr, vtx_moved);
+  _update_mesh_quantities(vtx_moved);
+
+  /* The system is always solved on the original mesh, so keep the
+     multigrid coarse grids from one time step to the next */
+
+  if (_cdo_sles_reuse_set == false) {
+    const cs_equation_param_t *eqp = cs_equation_get_param(eq);
+    cs_sles_default_aggregation_reuse
+      (cs_sles_find(eqp->sles_param->field_id, nullptr));
+    _cdo_sles_reuse_set = true;
+  }
 
   /* Solve the algebraic system */
 
@@ -845,13 +928,10 @@ _ale_solve_poisson_cdo(const cs_domain_t  *domain,
 
   /* Back to mesh at time n */
 
-  for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
-    for (cs_lnum_t idim = 0; idim < 3; idim++) {
-      vtx_coord[v_id][idim] = vtx_coord0[v_id][idim] + disale[v_id][idim];
-    }
-  }
+  _update_vtx_coords(m, vtx_coord0, disale, vtx_moved);
+  _update_mesh_quantities(vtx_moved);
 
-  cs_ale_update_mesh_quantities(&(mq->min_vol), &(mq->max_vol), &(mq->tot_vol));
+  BFT_FREE(vtx_moved);
 
   for (cs_lnum_t v = 0; v < m->n_vertices; v++) {
     if (impale[v] == 0) {
@@ -1139,13 +1219,9 @@ cs_ale_update_mesh_quantities(cs_real_t  *min_vol,
                               cs_real_t  *max_vol,
                               cs_real_t  *tot_vol)
 {
-  cs_mesh_t *m = cs_glob_mesh;
-  cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  _update_mesh_quantities(nullptr);
 
-  cs_gradient_free_quantities();
-  cs_cell_to_vertex_free();
-  cs_mesh_quantities_compute(m, mq);
-  cs_mesh_bad_cells_detect(m, mq);
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
 
   *min_vol = mq->min_vol;
   *max_vol = mq->max_vol;
@@ -1414,14 +1490,21 @@ cs_ale_update_mesh(int  itrale)
 
   /* Update geometry */
 
+  bool *vtx_moved;
+  BFT_MALLOC(vtx_moved, n_vertices, bool);
+
+  _update_vtx_coords(cs_glob_mesh, xyzno0, disale, vtx_moved);
+
   for (cs_lnum_t v_id = 0; v_id < n_vertices; v_id++) {
-    for (cs_lnum_t idim = 0; idim < ndim; idim++) {
-      vtx_coord[v_id][idim] = xyzno0[v_id][idim] + disale[v_id][idim];
+    for (cs_lnum_t idim = 0; idim < ndim; idim++)
       disala[v_id][idim] = vtx_coord[v_id][idim] - xyzno0[v_id][idim];
-    }
   }
 
-  cs_ale_update_mesh_quantities(&(mq->min_vol), &(mq->max_vol), &(mq->tot_vol));
+  /* Only the quantities of the moving part of the mesh are updated */
+
+  _update_mesh_quantities(vtx_moved);
+
+  BFT_FREE(vtx_moved);
 
   /* Abort at the end of the current time-step if there is a negative volume */
 
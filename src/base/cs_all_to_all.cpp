@@ -32,6 +32,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -278,6 +279,23 @@ static int        _n_trace_max = 0;
 static uint64_t  *_all_to_all_trace = nullptr;
 static FILE      *_all_to_all_trace_bt_log = nullptr;
 
+/* Node-level aggregation for MPI_Alltoallv-based data exchanges:
+   used when the mean message size is below the given threshold (in bytes)
+   and ranks exchange with more ranks than there are ranks per node */
+
+static const size_t  _node_aggregation_max_msg_size = 4096;
+
+static MPI_Comm   _node_base_comm = MPI_COMM_NULL;  /* associated comm */
+static MPI_Comm   _node_comm = MPI_COMM_NULL;       /* ranks on same node */
+static MPI_Comm   _node_leader_comm = MPI_COMM_NULL;  /* first rank of each
+                                                         node, or null */
+static int        _n_nodes = 0;
+static int        _node_max_ranks = 0;     /* max. ranks per node */
+static int       *_node_rank_idx = nullptr;  /* node -> ranks index */
+static int       *_node_ranks = nullptr;     /* ranks, grouped by node */
+
+static size_t     _all_to_all_node_calls = 0;
+
 #endif /* defined(HAVE_MPI) */
 
 /*============================================================================
@@ -943,6 +961,371 @@ _alltoall_caller_exchange_meta(_mpi_all_to_all_caller_t  *dc,
   dc->recv_size = _compute_displ(dc->n_ranks, dc->recv_count, dc->recv_displ);
 }
 
+/*----------------------------------------------------------------------------
+ * Free node-level aggregation communicators and mappings.
+ *---------------------------------------------------------------------------*/
+
+static void
+_node_info_free(void)
+{
+  if (_node_leader_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&_node_leader_comm);
+  if (_node_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&_node_comm);
+
+  _node_base_comm = MPI_COMM_NULL;
+  _n_nodes = 0;
+  _node_max_ranks = 0;
+
+  BFT_FREE(_node_rank_idx);
+  BFT_FREE(_node_ranks);
+}
+
+/*----------------------------------------------------------------------------
+ * Build node-level aggregation communicators and mappings for a given
+ * communicator, if not already done.
+ *
+ * This is a collective operation on the given communicator.
+ *
+ * parameters:
+ *   comm <-- associated MPI communicator
+ *---------------------------------------------------------------------------*/
+
+static void
+_node_info_build(MPI_Comm  comm)
+{
+  if (comm == _node_base_comm)
+    return;
+
+  _node_info_free();
+
+#if MPI_VERSION >= 3
+
+  int rank_id, n_ranks, node_rank_id;
+  MPI_Comm_rank(comm, &rank_id);
+  MPI_Comm_size(comm, &n_ranks);
+
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, rank_id, MPI_INFO_NULL,
+                      &_node_comm);
+  MPI_Comm_rank(_node_comm, &node_rank_id);
+
+  MPI_Comm_split(comm, (node_rank_id == 0) ? 0 : MPI_UNDEFINED, rank_id,
+                 &_node_leader_comm);
+
+  int node_id = 0;
+  if (_node_leader_comm != MPI_COMM_NULL)
+    MPI_Comm_rank(_node_leader_comm, &node_id);
+  MPI_Bcast(&node_id, 1, MPI_INT, 0, _node_comm);
+
+  int *rank_node_id;
+  BFT_MALLOC(rank_node_id, n_ranks, int);
+  MPI_Allgather(&node_id, 1, MPI_INT, rank_node_id, 1, MPI_INT, comm);
+
+  _n_nodes = 0;
+  for (int i = 0; i < n_ranks; i++)
+    _n_nodes = CS_MAX(_n_nodes, rank_node_id[i] + 1);
+
+  BFT_MALLOC(_node_rank_idx, _n_nodes + 1, int);
+  BFT_MALLOC(_node_ranks, n_ranks, int);
+
+  for (int i = 0; i < _n_nodes + 1; i++)
+    _node_rank_idx[i] = 0;
+  for (int i = 0; i < n_ranks; i++)
+    _node_rank_idx[rank_node_id[i] + 1] += 1;
+
+  _node_max_ranks = 0;
+  for (int i = 0; i < _n_nodes; i++) {
+    _node_max_ranks = CS_MAX(_node_max_ranks, _node_rank_idx[i+1]);
+    _node_rank_idx[i+1] += _node_rank_idx[i];
+  }
+
+  /* Ranks are added in increasing order, which is also the local
+     order in the node communicator */
+
+  int *shift;
+  BFT_MALLOC(shift, _n_nodes, int);
+  for (int i = 0; i < _n_nodes; i++)
+    shift[i] = _node_rank_idx[i];
+  for (int i = 0; i < n_ranks; i++)
+    _node_ranks[shift[rank_node_id[i]]++] = i;
+
+  BFT_FREE(shift);
+  BFT_FREE(rank_node_id);
+
+#endif /* MPI_VERSION >= 3 */
+
+  _node_base_comm = comm;
+}
+
+/*----------------------------------------------------------------------------
+ * Determine whether node-level aggregation should be used for the
+ * data exchange with a MPI_Alltoall(v) caller.
+ *
+ * Aggregation is used when messages are small and each rank communicates
+ * with more ranks than there are ranks per node, so that replacing
+ * messages between ranks by messages between nodes reduces latency costs.
+ *
+ * This is a collective operation.
+ *
+ * parameters:
+ *   dc <-- associated MPI_Alltoall(v) caller structure
+ *
+ * returns:
+ *   true if node-level aggregation should be used
+ *---------------------------------------------------------------------------*/
+
+static bool
+_node_aggregation_is_needed(const _mpi_all_to_all_caller_t  *dc)
+{
+  _node_info_build(dc->comm);
+
+  if (_n_nodes < 2 || _node_max_ranks < 2)
+    return false;
+
+  /* Local statistics: number of messages, message size, non-contiguous
+     buffers, and risk of count overflow on node leaders */
+
+  double l_stats[4] = {0, 0, 0, 0}, g_stats[4];
+
+  size_t send_size = 0, recv_size = 0;
+  for (int i = 0; i < dc->n_ranks; i++) {
+    if (dc->send_count[i] > 0)
+      l_stats[0] += 1;
+    if (   dc->send_displ[i] != (int)send_size
+        || dc->recv_displ[i] != (int)recv_size)
+      l_stats[2] = 1;
+    send_size += dc->send_count[i];
+    recv_size += dc->recv_count[i];
+  }
+  l_stats[1] = send_size*dc->comp_size;
+  if (   (double)CS_MAX(send_size, recv_size)*_node_max_ranks
+      >= (double)INT_MAX)
+    l_stats[3] = 1;
+
+  MPI_Allreduce(l_stats, g_stats, 4, MPI_DOUBLE, MPI_SUM, dc->comm);
+
+  if (g_stats[2] > 0 || g_stats[3] > 0 || g_stats[0] < 1)
+    return false;
+
+  double mean_msg_size = g_stats[1] / g_stats[0];
+  double mean_n_dest = g_stats[0] / dc->n_ranks;
+
+  if (   mean_msg_size < _node_aggregation_max_msg_size
+      && mean_n_dest > _node_max_ranks)
+    return true;
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Exchange data with a MPI_Alltoall(v) caller using node-level aggregation.
+ *
+ * Data is gathered on the first rank of each node, exchanged between
+ * those node leaders, and scattered to the destination ranks of each node.
+ * Received data is ordered by source rank, as with MPI_Alltoallv.
+ *
+ * Send and receive buffers must be contiguous (i.e. displacements match
+ * the cumulative counts).
+ *
+ * parameters:
+ *   dc        <-- associated MPI_Alltoall(v) caller structure
+ *   send_buf  <-- send buffer
+ *   recv_buf  --> receive buffer
+ *---------------------------------------------------------------------------*/
+
+static void
+_node_alltoallv(const _mpi_all_to_all_caller_t  *dc,
+                const void                      *send_buf,
+                void                            *recv_buf)
+{
+  const int n_ranks = dc->n_ranks;
+  const size_t es = dc->comp_size;
+
+  int n_l_ranks, l_rank_id;
+  MPI_Comm_size(_node_comm, &n_l_ranks);
+  MPI_Comm_rank(_node_comm, &l_rank_id);
+
+  const bool leader = (l_rank_id == 0) ? true : false;
+
+  int send_size = 0, recv_size = 0;
+  for (int i = 0; i < n_ranks; i++) {
+    send_size += dc->send_count[i];
+    recv_size += dc->recv_count[i];
+  }
+
+  /* Gather counts and send data on node leader */
+
+  int *s_count = nullptr, *r_count = nullptr;
+  int *l_count = nullptr, *l_displ = nullptr;
+  unsigned char *g_buf = nullptr;
+
+  if (leader) {
+    BFT_MALLOC(s_count, (size_t)n_l_ranks*n_ranks, int);
+    BFT_MALLOC(r_count, (size_t)n_l_ranks*n_ranks, int);
+    BFT_MALLOC(l_count, n_l_ranks, int);
+    BFT_MALLOC(l_displ, n_l_ranks + 1, int);
+  }
+
+  MPI_Gather(dc->send_count, n_ranks, MPI_INT,
+             s_count, n_ranks, MPI_INT, 0, _node_comm);
+  MPI_Gather(dc->recv_count, n_ranks, MPI_INT,
+             r_count, n_ranks, MPI_INT, 0, _node_comm);
+
+  if (leader) {
+    for (int l = 0; l < n_l_ranks; l++) {
+      l_count[l] = 0;
+      for (int i = 0; i < n_ranks; i++)
+        l_count[l] += s_count[(size_t)l*n_ranks + i];
+    }
+    _compute_displ(n_l_ranks, l_count, l_displ);
+    BFT_MALLOC(g_buf, l_displ[n_l_ranks]*es, unsigned char);
+  }
+
+  MPI_Gatherv(send_buf, send_size, dc->comp_type,
+              g_buf, l_count, l_displ, dc->comp_type, 0, _node_comm);
+
+  /* Exchange between node leaders */
+
+  unsigned char *n_recv_buf = nullptr;
+
+  if (leader) {
+
+    int *s_displ, *n_s_count, *n_s_displ, *n_r_count, *n_r_displ;
+    BFT_MALLOC(s_displ, (size_t)n_l_ranks*n_ranks, int);
+    BFT_MALLOC(n_s_count, _n_nodes, int);
+    BFT_MALLOC(n_s_displ, _n_nodes + 1, int);
+    BFT_MALLOC(n_r_count, _n_nodes, int);
+    BFT_MALLOC(n_r_displ, _n_nodes + 1, int);
+
+    /* Position of data from local rank l to rank i in gathered buffer */
+
+    for (int l = 0; l < n_l_ranks; l++) {
+      int k = l_displ[l];
+      for (int i = 0; i < n_ranks; i++) {
+        s_displ[(size_t)l*n_ranks + i] = k;
+        k += s_count[(size_t)l*n_ranks + i];
+      }
+    }
+
+    for (int n = 0; n < _n_nodes; n++) {
+      n_s_count[n] = 0;
+      n_r_count[n] = 0;
+      for (int j = _node_rank_idx[n]; j < _node_rank_idx[n+1]; j++) {
+        int i = _node_ranks[j];
+        for (int l = 0; l < n_l_ranks; l++) {
+          n_s_count[n] += s_count[(size_t)l*n_ranks + i];
+          n_r_count[n] += r_count[(size_t)l*n_ranks + i];
+        }
+      }
+    }
+
+    _compute_displ(_n_nodes, n_s_count, n_s_displ);
+    _compute_displ(_n_nodes, n_r_count, n_r_displ);
+
+    /* Pack by destination node, then destination rank, then source rank */
+
+    unsigned char *n_send_buf;
+    BFT_MALLOC(n_send_buf, n_s_displ[_n_nodes]*es, unsigned char);
+
+    size_t k = 0;
+    for (int n = 0; n < _n_nodes; n++) {
+      for (int j = _node_rank_idx[n]; j < _node_rank_idx[n+1]; j++) {
+        int i = _node_ranks[j];
+        for (int l = 0; l < n_l_ranks; l++) {
+          size_t c = s_count[(size_t)l*n_ranks + i];
+          memcpy(n_send_buf + k*es,
+                 g_buf + (size_t)s_displ[(size_t)l*n_ranks + i]*es,
+                 c*es);
+          k += c;
+        }
+      }
+    }
+
+    BFT_MALLOC(n_recv_buf, n_r_displ[_n_nodes]*es, unsigned char);
+
+    MPI_Alltoallv(n_send_buf, n_s_count, n_s_displ, dc->comp_type,
+                  n_recv_buf, n_r_count, n_r_displ, dc->comp_type,
+                  _node_leader_comm);
+
+    BFT_FREE(n_send_buf);
+
+    /* Unpack by destination rank, ordered by source rank */
+
+    for (int l = 0; l < n_l_ranks; l++) {
+      l_count[l] = 0;
+      for (int i = 0; i < n_ranks; i++)
+        l_count[l] += r_count[(size_t)l*n_ranks + i];
+    }
+    _compute_displ(n_l_ranks, l_count, l_displ);
+
+    for (int l = 0; l < n_l_ranks; l++) {
+      int k_r = l_displ[l];
+      for (int i = 0; i < n_ranks; i++) {
+        s_displ[(size_t)l*n_ranks + i] = k_r;
+        k_r += r_count[(size_t)l*n_ranks + i];
+      }
+    }
+
+    BFT_REALLOC(g_buf, l_displ[n_l_ranks]*es, unsigned char);
+
+    k = 0;
+    for (int n = 0; n < _n_nodes; n++) {
+      for (int l = 0; l < n_l_ranks; l++) {
+        for (int j = _node_rank_idx[n]; j < _node_rank_idx[n+1]; j++) {
+          int i = _node_ranks[j];
+          size_t c = r_count[(size_t)l*n_ranks + i];
+          memcpy(g_buf + (size_t)s_displ[(size_t)l*n_ranks + i]*es,
+                 n_recv_buf + k*es,
+                 c*es);
+          k += c;
+        }
+      }
+    }
+
+    BFT_FREE(n_recv_buf);
+    BFT_FREE(n_r_displ);
+    BFT_FREE(n_r_count);
+    BFT_FREE(n_s_displ);
+    BFT_FREE(n_s_count);
+    BFT_FREE(s_displ);
+  }
+
+  /* Scatter to destination ranks */
+
+  MPI_Scatterv(g_buf, l_count, l_displ, dc->comp_type,
+               recv_buf, recv_size, dc->comp_type, 0, _node_comm);
+
+  BFT_FREE(g_buf);
+  BFT_FREE(l_displ);
+  BFT_FREE(l_count);
+  BFT_FREE(r_count);
+  BFT_FREE(s_count);
+}
+
+/*----------------------------------------------------------------------------
+ * Exchange data with a MPI_Alltoall(v) caller, with either MPI_Alltoallv
+ * or node-level aggregation.
+ *
+ * parameters:
+ *   dc        <-- associated MPI_Alltoall(v) caller structure
+ *   recv_buf  --> receive buffer
+ *---------------------------------------------------------------------------*/
+
+static void
+_alltoall_caller_alltoallv(const _mpi_all_to_all_caller_t  *dc,
+                           void                            *recv_buf)
+{
+  if (_node_aggregation_is_needed(dc)) {
+    _node_alltoallv(dc, dc->send_buffer, recv_buf);
+    _all_to_all_node_calls += 1;
+  }
+  else
+    MPI_Alltoallv(dc->send_buffer, dc->send_count, dc->send_displ,
+                  dc->comp_type,
+                  recv_buf, dc->recv_count, dc->recv_displ, dc->comp_type,
+                  dc->comm);
+}
+
 /*----------------------------------------------------------------------------
  * Exchange strided data with a MPI_Alltoall(v) caller.
  *
@@ -1004,9 +1387,7 @@ _alltoall_caller_exchange_s(cs_all_to_all_t           *d,
     _n_trace += 1;
   }
 
-  MPI_Alltoallv(dc->send_buffer, dc->send_count, dc->send_displ, dc->comp_type,
-                _recv_data, dc->recv_count, dc->recv_displ, dc->comp_type,
-                dc->comm);
+  _alltoall_caller_alltoallv(dc, _recv_data);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_EXCHANGE,
@@ -1164,9 +1545,7 @@ _alltoall_caller_exchange_i(cs_all_to_all_t           *d,
     _n_trace += 1;
   }
 
-  MPI_Alltoallv(dc->send_buffer, dc->send_count, dc->send_displ, dc->comp_type,
-                _recv_data, dc->recv_count, dc->recv_displ, dc->comp_type,
-                dc->comm);
+  _alltoall_caller_alltoallv(dc, _recv_data);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_all_to_all_timers + CS_ALL_TO_ALL_TIME_EXCHANGE,
@@ -3629,6 +4008,13 @@ cs_all_to_all_log_finalize(void)
      wtimes_mean[2], wtimes_min[2], wtimes_max[2],
      (unsigned long)(_all_to_all_calls[2]));
 
+  if (_all_to_all_node_calls > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  Data exchanges with node-level aggregation: %lu\n"
+                    "  (%d nodes, up to %d ranks per node)\n\n"),
+                  (unsigned long)_all_to_all_node_calls,
+                  _n_nodes, _node_max_ranks);
+
   cs_log_separator(CS_LOG_PERFORMANCE);
 
   if (cs_glob_n_ranks > 1 && _n_trace > 0) {
@@ -3684,6 +4070,7 @@ cs_all_to_all_log_finalize(void)
     BFT_FREE(_all_to_all_trace);
   }
 
+  _node_info_free();
 
 #endif /* defined(HAVE_MPI) */
 }
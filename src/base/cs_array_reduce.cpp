@@ -104,6 +104,57 @@ _sbloc_sizes(cs_lnum_t   n,
   *blocks_in_sblocks = (n + n_b - 1) / n_b;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute (weighted) sum of a 1-dimensional array using exact accumulators.
+ *
+ * This is used when exact parallel sums are requested (see
+ * cs_glob_parall_exact_sum), so that the result does not depend on the
+ * number of threads.
+ *
+ * parameters:
+ *   n        <-- local number of elements
+ *   vl       <-- pointer to element list, or NULL
+ *   wl       <-- pointer to weights list, or NULL (vl used if non-NULL)
+ *   v        <-- pointer to values (size: n)
+ *   w        <-- pointer to weights (size: n), or NULL
+ *
+ * returns:
+ *   resulting sum
+ *----------------------------------------------------------------------------*/
+
+static double
+_cs_real_wsum_1d_exact(cs_lnum_t        n,
+                       const cs_lnum_t  vl[],
+                       const cs_lnum_t  wl[],
+                       const cs_real_t  v[],
+                       const cs_real_t  w[])
+{
+  cs_exact_sum_t acc;
+  cs_exact_sum_init(&acc);
+
+# pragma omp parallel if (n > CS_THR_MIN)
+  {
+    cs_lnum_t s_id, e_id;
+    cs_parall_thread_range(n, sizeof(cs_real_t), &s_id, &e_id);
+
+    cs_exact_sum_t t_acc;
+    cs_exact_sum_init(&t_acc);
+
+    for (cs_lnum_t li = s_id; li < e_id; li++) {
+      cs_lnum_t i = (vl != nullptr) ? vl[li] : li;
+      double c = v[i];
+      if (w != nullptr)
+        c *= w[(wl != nullptr) ? wl[li] : i];
+      cs_exact_sum_add(&t_acc, c);
+    }
+
+#   pragma omp critical
+    cs_exact_sum_merge(&acc, &t_acc);
+  }
+
+  return cs_exact_sum_to_double(&acc);
+}
+
 /*----------------------------------------------------------------------------
  * Compute sum of a 1-dimensional array.
  *
@@ -121,6 +172,9 @@ static double
 _cs_real_sum_1d(cs_lnum_t        n,
                 const cs_real_t  v[])
 {
+  if (cs_glob_parall_exact_sum)
+    return _cs_real_wsum_1d_exact(n, nullptr, nullptr, v, nullptr);
+
   double v_sum = 0.;
 
 # pragma omp parallel reduction(+:v_sum) if (n > CS_THR_MIN)
@@ -179,6 +233,9 @@ _cs_real_sum_1d_iv(cs_lnum_t        n,
                    const cs_lnum_t  vl[],
                    const cs_real_t  v[])
 {
+  if (cs_glob_parall_exact_sum)
+    return _cs_real_wsum_1d_exact(n, vl, nullptr, v, nullptr);
+
   double v_sum = 0.;
 
 # pragma omp parallel reduction(+:v_sum) if (n > CS_THR_MIN)
@@ -238,6 +295,9 @@ _cs_real_wsum_1d(cs_lnum_t        n,
                  const cs_real_t  v[],
                  const cs_real_t  w[])
 {
+  if (cs_glob_parall_exact_sum)
+    return _cs_real_wsum_1d_exact(n, nullptr, nullptr, v, w);
+
   double v_w_sum = 0.;
 
 #pragma omp parallel reduction(+:v_w_sum) if (n > CS_THR_MIN)
@@ -301,6 +361,9 @@ _cs_real_wsum_1d_iw(cs_lnum_t        n,
                     const cs_real_t  v[],
                     const cs_real_t  w[])
 {
+  if (cs_glob_parall_exact_sum)
+    return _cs_real_wsum_1d_exact(n, nullptr, wl, v, w);
+
   double v_w_sum = 0.;
 
 #pragma omp parallel reduction(+:v_w_sum) if (n > CS_THR_MIN)
@@ -362,6 +425,9 @@ _cs_real_wsum_1d_iv(cs_lnum_t        n,
                     const cs_real_t  v[],
                     const cs_real_t  w[])
 {
+  if (cs_glob_parall_exact_sum)
+    return _cs_real_wsum_1d_exact(n, vl, nullptr, v, w);
+
   double v_w_sum = 0.;
 
 #pragma omp parallel reduction(+:v_w_sum) if (n > CS_THR_MIN)
@@ -150,6 +150,27 @@ struct _cs_ast_coupling_t {
   double  *foaas;      /* Fluid forces at previous sub-iteration */
   double  *fopas;      /* Predicted fluid forces */
 
+  /* Sub-iteration relaxation */
+
+  cs_ast_coupling_relax_t  relax_type;  /* Relaxation type */
+
+  double   omega;      /* Relaxation factor (initial for Aitken) */
+  double   omega_k;    /* Current dynamic relaxation factor */
+
+  int      r_s_it_id;  /* Sub-iteration id of saved residual, or -1 */
+  double  *r_prev;     /* Interface residual at previous sub-iteration */
+  double  *xast_prev;  /* Received displacement at previous sub-iteration */
+
+  int      iqn_n_max;    /* Maximum number of IQN-ILS vectors */
+  int      iqn_n_reuse;  /* Number of previous time steps whose
+                            IQN-ILS vectors are reused */
+  int      iqn_n;        /* Current number of IQN-ILS vectors */
+  int     *iqn_it;       /* Coupling iteration at which each vector
+                            was added (newest first) */
+  double  *iqn_v;        /* Residual differences (newest first) */
+  double  *iqn_w;        /* Received displacement differences
+                            (newest first) */
+
 };
 
 /*============================================================================
@@ -167,6 +188,11 @@ static const char _name_m_v[] = "mesh_velocity";
 static int _verbosity = 1;
 static int _visualization = 1;
 
+static cs_ast_coupling_relax_t  _relax_type = CS_AST_COUPLING_RELAX_FIXED;
+static double _relax_omega = 0.5;
+static int _iqn_n_max = 20;
+static int _iqn_n_reuse = 2;
+
 /*============================================================================
  * Global variables
  *============================================================================*/
@@ -475,6 +501,291 @@ _val_ant(cs_ast_coupling_t  *ast_cpl)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Sum values over all ranks.
+ *
+ * parameters:
+ *   n    <-- number of values
+ *   vals <-> local values in, global sums out
+ *----------------------------------------------------------------------------*/
+
+static void
+_sum_values(int      n,
+            double  *vals)
+{
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Allreduce(MPI_IN_PLACE, vals, n, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+#else
+  CS_UNUSED(n);
+  CS_UNUSED(vals);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Add IQN-ILS vectors from the current and previous sub-iteration
+ * residuals and received displacements, and remove vectors which are
+ * too old or in excess.
+ *
+ * parameters:
+ *   cpl <-> code_aster coupling structure
+ *   r   <-- current interface residual
+ *----------------------------------------------------------------------------*/
+
+static void
+_iqn_update_vectors(cs_ast_coupling_t  *cpl,
+                    const double       *r)
+{
+  const cs_lnum_t n3 = cpl->n_vertices*3;
+
+  /* Remove vectors from time steps which are too old */
+
+  while (   cpl->iqn_n > 0
+         && cpl->iqn_it[cpl->iqn_n - 1] < cpl->iteration - cpl->iqn_n_reuse)
+    cpl->iqn_n -= 1;
+
+  if (cpl->r_s_it_id != cpl->s_it_id - 1)
+    return;
+
+  /* Shift older vectors so the newest is first, dropping the oldest
+     if the maximum number is reached */
+
+  if (cpl->iqn_n >= cpl->iqn_n_max)
+    cpl->iqn_n = cpl->iqn_n_max - 1;
+
+  if (cpl->iqn_n < 0)
+    return;
+
+  for (int j = cpl->iqn_n; j > 0; j--) {
+    cpl->iqn_it[j] = cpl->iqn_it[j-1];
+    memcpy(cpl->iqn_v + j*n3, cpl->iqn_v + (j-1)*n3, n3*sizeof(double));
+    memcpy(cpl->iqn_w + j*n3, cpl->iqn_w + (j-1)*n3, n3*sizeof(double));
+  }
+
+  cpl->iqn_it[0] = cpl->iteration;
+  for (cs_lnum_t i = 0; i < n3; i++) {
+    cpl->iqn_v[i] = r[i] - cpl->r_prev[i];
+    cpl->iqn_w[i] = cpl->xast[i] - cpl->xast_prev[i];
+  }
+
+  cpl->iqn_n += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute IQN-ILS correction coefficients.
+ *
+ * The least-squares problem min ||V.c + r|| is solved using the normal
+ * equations with a Cholesky factorization; the oldest vectors are
+ * dropped in case of (near) linear dependency.
+ *
+ * parameters:
+ *   cpl <-> code_aster coupling structure
+ *   r   <-- current interface residual
+ *   c   --> coefficients (size: cpl->iqn_n on output)
+ *----------------------------------------------------------------------------*/
+
+static void
+_iqn_coefficients(cs_ast_coupling_t  *cpl,
+                  const double       *r,
+                  double             *c)
+{
+  const cs_lnum_t n3 = cpl->n_vertices*3;
+  const int m = cpl->iqn_n;
+
+  /* Gram matrix (lower part) and right-hand side, reduced together */
+
+  int n_sums = m*(m+1)/2 + m;
+  double *sums;
+  BFT_MALLOC(sums, n_sums, double);
+
+  int k = 0;
+  for (int j0 = 0; j0 < m; j0++) {
+    const double *v0 = cpl->iqn_v + j0*n3;
+    for (int j1 = 0; j1 <= j0; j1++) {
+      const double *v1 = cpl->iqn_v + j1*n3;
+      double s = 0;
+      for (cs_lnum_t i = 0; i < n3; i++)
+        s += v0[i]*v1[i];
+      sums[k++] = s;
+    }
+  }
+  for (int j = 0; j < m; j++) {
+    const double *v = cpl->iqn_v + j*n3;
+    double s = 0;
+    for (cs_lnum_t i = 0; i < n3; i++)
+      s -= v[i]*r[i];
+    sums[k++] = s;
+  }
+
+  _sum_values(n_sums, sums);
+
+  const double *g = sums;
+  const double *b = sums + m*(m+1)/2;
+
+  /* Cholesky factorization; as vectors are ordered newest first, a
+     failure at column j leads to using only the j newest vectors. */
+
+  double *l;
+  BFT_MALLOC(l, m*(m+1)/2, double);
+
+  int m_ok = 0;
+  for (int j0 = 0; j0 < m; j0++) {
+    const int r0 = j0*(j0+1)/2;
+    for (int j1 = 0; j1 < j0; j1++) {
+      const int r1 = j1*(j1+1)/2;
+      double s = g[r0 + j1];
+      for (int j2 = 0; j2 < j1; j2++)
+        s -= l[r0 + j2]*l[r1 + j2];
+      l[r0 + j1] = s / l[r1 + j1];
+    }
+    double s = g[r0 + j0];
+    for (int j2 = 0; j2 < j0; j2++)
+      s -= l[r0 + j2]*l[r0 + j2];
+    if (s <= 1e-12*g[r0 + j0])
+      break;
+    l[r0 + j0] = sqrt(s);
+    m_ok = j0 + 1;
+  }
+
+  /* Forward and backward substitution */
+
+  for (int j0 = 0; j0 < m_ok; j0++) {
+    const int r0 = j0*(j0+1)/2;
+    double s = b[j0];
+    for (int j1 = 0; j1 < j0; j1++)
+      s -= l[r0 + j1]*c[j1];
+    c[j0] = s / l[r0 + j0];
+  }
+  for (int j0 = m_ok - 1; j0 >= 0; j0--) {
+    double s = c[j0];
+    for (int j1 = j0 + 1; j1 < m_ok; j1++)
+      s -= l[j1*(j1+1)/2 + j0]*c[j1];
+    c[j0] = s / l[j0*(j0+1)/2 + j0];
+  }
+
+  cpl->iqn_n = m_ok;
+
+  BFT_FREE(l);
+  BFT_FREE(sums);
+}
+
+/*----------------------------------------------------------------------------
+ * Update displacement prediction at a sub-iteration, based on the
+ * selected relaxation type.
+ *
+ * The interface residual is the difference between the displacement
+ * received from code_aster and the one imposed at the previous
+ * sub-iteration.
+ *
+ * parameters:
+ *   cpl <-> code_aster coupling structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_relax_displacement(cs_ast_coupling_t  *cpl)
+{
+  const cs_lnum_t n3 = cpl->n_vertices*3;
+
+  int verbosity = (cs_log_default_is_active()) ? cpl->verbosity : 0;
+
+  if (cpl->r_prev == nullptr) {
+    BFT_MALLOC(cpl->r_prev, n3, double);
+    BFT_MALLOC(cpl->xast_prev, n3, double);
+    if (cpl->relax_type == CS_AST_COUPLING_RELAX_IQN_ILS) {
+      BFT_MALLOC(cpl->iqn_it, cpl->iqn_n_max, int);
+      BFT_MALLOC(cpl->iqn_v, (size_t)(cpl->iqn_n_max)*n3, double);
+      BFT_MALLOC(cpl->iqn_w, (size_t)(cpl->iqn_n_max)*n3, double);
+    }
+  }
+
+  double *r;
+  BFT_MALLOC(r, n3, double);
+
+  for (cs_lnum_t i = 0; i < n3; i++)
+    r[i] = cpl->xast[i] - cpl->xastp[i];
+
+  bool use_omega = true;
+
+  if (cpl->relax_type == CS_AST_COUPLING_RELAX_AITKEN) {
+
+    if (cpl->r_s_it_id == cpl->s_it_id - 1) {
+      double s[2] = {0, 0};
+      for (cs_lnum_t i = 0; i < n3; i++) {
+        double dr = r[i] - cpl->r_prev[i];
+        s[0] += cpl->r_prev[i]*dr;
+        s[1] += dr*dr;
+      }
+      _sum_values(2, s);
+      if (s[1] > 0)
+        cpl->omega_k = - cpl->omega_k * s[0] / s[1];
+    }
+    else
+      cpl->omega_k = cpl->omega;
+
+    if (verbosity > 0)
+      bft_printf("--------------------------------------------\n"
+                 "Aitken relaxation factor: %4.2le\n"
+                 "--------------------------------------------\n\n",
+                 cpl->omega_k);
+
+  }
+
+  else if (cpl->relax_type == CS_AST_COUPLING_RELAX_IQN_ILS) {
+
+    _iqn_update_vectors(cpl, r);
+
+    if (cpl->iqn_n > 0) {
+
+      double *c;
+      BFT_MALLOC(c, cpl->iqn_n, double);
+
+      _iqn_coefficients(cpl, r, c);
+
+      if (cpl->iqn_n > 0) {
+
+        /* x_{k+1} = H(x_k) + W.c */
+
+        for (cs_lnum_t i = 0; i < n3; i++) {
+          double s = cpl->xast[i];
+          for (int j = 0; j < cpl->iqn_n; j++)
+            s += cpl->iqn_w[j*n3 + i]*c[j];
+          cpl->xastp[i] = s;
+        }
+        use_omega = false;
+
+      }
+
+      BFT_FREE(c);
+    }
+
+    if (verbosity > 0)
+      bft_printf("--------------------------------------------\n"
+                 "IQN-ILS vectors used: %d\n"
+                 "--------------------------------------------\n\n",
+                 (use_omega) ? 0 : cpl->iqn_n);
+
+    cpl->omega_k = cpl->omega;
+
+  }
+
+  else
+    cpl->omega_k = cpl->omega;
+
+  if (use_omega) {
+    for (cs_lnum_t i = 0; i < n3; i++)
+      cpl->xastp[i] += cpl->omega_k * r[i];
+  }
+
+  /* Save values for next sub-iteration */
+
+  memcpy(cpl->r_prev, r, n3*sizeof(double));
+  memcpy(cpl->xast_prev, cpl->xast, n3*sizeof(double));
+  cpl->r_s_it_id = cpl->s_it_id;
+
+  BFT_FREE(r);
+}
+
 /*----------------------------------------------------------------------------
  * Post process variables associated with code_aster couplings
  *
@@ -655,6 +966,21 @@ cs_ast_coupling_add(void)
   cpl->foaas = nullptr;
   cpl->fopas = nullptr;
 
+  cpl->relax_type = _relax_type;
+  cpl->omega = _relax_omega;
+  cpl->omega_k = _relax_omega;
+
+  cpl->r_s_it_id = -1;
+  cpl->r_prev = nullptr;
+  cpl->xast_prev = nullptr;
+
+  cpl->iqn_n_max = _iqn_n_max;
+  cpl->iqn_n_reuse = _iqn_n_reuse;
+  cpl->iqn_n = 0;
+  cpl->iqn_it = nullptr;
+  cpl->iqn_v = nullptr;
+  cpl->iqn_w = nullptr;
+
   cs_glob_ast_coupling = cpl;
 
   cs_calcium_set_verbosity(cpl->verbosity);
@@ -802,6 +1128,13 @@ cs_ast_coupling_finalize(void)
   BFT_FREE(cpl->foaas);
   BFT_FREE(cpl->fopas);
 
+  BFT_FREE(cpl->r_prev);
+  BFT_FREE(cpl->xast_prev);
+
+  BFT_FREE(cpl->iqn_it);
+  BFT_FREE(cpl->iqn_v);
+  BFT_FREE(cpl->iqn_w);
+
   if (cpl->post_mesh != nullptr)
     cpl->post_mesh = fvm_nodal_destroy(cpl->post_mesh);
 
@@ -1226,7 +1559,7 @@ cs_ast_coupling_compute_displacement(cs_real_t  disp[][3])
 
   /* Predict displacements */
 
-  cs_real_t c1, c2, c3, alpha, beta;
+  cs_real_t c1 = 0, c2 = 0, c3 = 0, alpha, beta;
 
   /* separate prediction for explicit/implicit cases */
   if (cpl->s_it_id == 0) {
@@ -1244,8 +1577,8 @@ cs_ast_coupling_compute_displacement(cs_real_t  disp[][3])
           c3,
           nb_dyn);
   }
-  else { /* if (cpl->s_it_id > 0) */
-    alpha = 0.5;
+  else if (cpl->relax_type == CS_AST_COUPLING_RELAX_FIXED) {
+    alpha = cpl->omega;
     c1    = alpha;
     c2    = 1. - alpha;
     c3    = 0.;
@@ -1261,13 +1594,19 @@ cs_ast_coupling_compute_displacement(cs_real_t  disp[][3])
 
   int verbosity = (cs_log_default_is_active()) ? cpl->verbosity : 0;
 
-  if (verbosity > 0) {
-
+  if (verbosity > 0)
     bft_printf("*********************************\n"
                "*     sub - iteration %i        *\n"
                "*********************************\n\n",
                cpl->s_it_id);
 
+  /* Dynamic relaxation for sub-iterations */
+
+  if (cpl->s_it_id > 0 && cpl->relax_type != CS_AST_COUPLING_RELAX_FIXED)
+    _relax_displacement(cpl);
+
+  else if (verbosity > 0) {
+
     bft_printf("--------------------------------------------\n"
                "Displacement prediction coefficients\n"
                " C1: %4.2le\n"
@@ -1399,6 +1738,56 @@ cs_ast_coupling_set_visualization(int   visualization)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set relaxation of the structure displacement between
+ *        code_aster coupling sub-iterations.
+ *
+ * With \ref CS_AST_COUPLING_RELAX_FIXED (the default), the relaxation
+ * factor is constant. With \ref CS_AST_COUPLING_RELAX_AITKEN, it is
+ * used for the first sub-iteration of each time step, and dynamically
+ * updated afterwards. With \ref CS_AST_COUPLING_RELAX_IQN_ILS, it is
+ * used only when no quasi-Newton information is available.
+ *
+ * For the IQN-ILS algorithm, the differences of interface residuals and
+ * displacements from previous sub-iterations are kept (up to the given
+ * maximum number), including those from a given number of preceding
+ * time steps, so the interface Jacobian model is improved across
+ * time steps.
+ *
+ * \param[in]  relax_type     relaxation type
+ * \param[in]  omega          (initial) relaxation factor
+ * \param[in]  n_max_vectors  maximum number of IQN-ILS vectors
+ * \param[in]  n_reuse_steps  number of previous time steps whose
+ *                            IQN-ILS vectors are reused
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_ast_coupling_set_relaxation(cs_ast_coupling_relax_t  relax_type,
+                               double                   omega,
+                               int                      n_max_vectors,
+                               int                      n_reuse_steps)
+{
+  _relax_type = relax_type;
+  _relax_omega = omega;
+  _iqn_n_max = CS_MAX(n_max_vectors, 1);
+  _iqn_n_reuse = CS_MAX(n_reuse_steps, 0);
+
+  cs_ast_coupling_t *cpl = cs_glob_ast_coupling;
+  if (cpl != nullptr) {
+    if (cpl->r_prev != nullptr)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: relaxation may not be modified once sub-iterations "
+                  "have started."), __func__);
+    cpl->relax_type = _relax_type;
+    cpl->omega = _relax_omega;
+    cpl->omega_k = _relax_omega;
+    cpl->iqn_n_max = _iqn_n_max;
+    cpl->iqn_n_reuse = _iqn_n_reuse;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -51,6 +51,17 @@ BEGIN_C_DECLS
 
 typedef struct _cs_ast_coupling_t  cs_ast_coupling_t;
 
+/* Relaxation of the structure displacement between sub-iterations */
+
+typedef enum {
+
+  CS_AST_COUPLING_RELAX_FIXED,    /*!< constant relaxation factor */
+  CS_AST_COUPLING_RELAX_AITKEN,   /*!< Aitken dynamic relaxation */
+  CS_AST_COUPLING_RELAX_IQN_ILS   /*!< interface quasi-Newton with inverse
+                                       Jacobian from a least-squares model */
+
+} cs_ast_coupling_relax_t;
+
 /*============================================================================
  * Global variable definitions
  *============================================================================*/
@@ -235,6 +246,37 @@ cs_ast_coupling_get_visualization(void);
 void
 cs_ast_coupling_set_visualization(int  visualization);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set relaxation of the structure displacement between
+ *        code_aster coupling sub-iterations.
+ *
+ * With \ref CS_AST_COUPLING_RELAX_FIXED (the default), the relaxation
+ * factor is constant. With \ref CS_AST_COUPLING_RELAX_AITKEN, it is
+ * used for the first sub-iteration of each time step, and dynamically
+ * updated afterwards. With \ref CS_AST_COUPLING_RELAX_IQN_ILS, it is
+ * used only when no quasi-Newton information is available.
+ *
+ * For the IQN-ILS algorithm, the differences of interface residuals and
+ * displacements from previous sub-iterations are kept (up to the given
+ * maximum number), including those from a given number of preceding
+ * time steps, so the interface Jacobian model is improved across
+ * time steps.
+ *
+ * \param[in]  relax_type     relaxation type
+ * \param[in]  omega          (initial) relaxation factor
+ * \param[in]  n_max_vectors  maximum number of IQN-ILS vectors
+ * \param[in]  n_reuse_steps  number of previous time steps whose
+ *                            IQN-ILS vectors are reused
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_ast_coupling_set_relaxation(cs_ast_coupling_relax_t  relax_type,
+                               double                   omega,
+                               int                      n_max_vectors,
+                               int                      n_reuse_steps);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -74,6 +74,7 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_base_accel.h"
 #include "cs_file.h"
 #include "cs_fp_exception.h"
 #include "cs_log.h"
@@ -1676,6 +1677,11 @@ cs_base_mem_init(void)
 
     }
 
+    else if (getenv("CS_MEM_STATS") != NULL) {
+      bft_mem_init(NULL);
+      bft_mem_enable_tracking();
+    }
+
 #if defined(HAVE_ACCEL)
     else
       bft_mem_init(NULL);
@@ -1686,6 +1692,155 @@ cs_base_mem_init(void)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Log memory use by subsystem.
+ *
+ * Memory is accounted by subsystem only when allocations are tracked
+ * (i.e. when the CS_MEM_LOG or CS_MEM_STATS environment variables are
+ * defined, or with accelerator support). Current, maximum, and current
+ * phase maximum sizes are logged, using the maximum over ranks.
+ *
+ * This is a collective operation.
+ *
+ * parameters:
+ *   log_id    <-- log file type
+ *   new_phase <-- if true, start a new phase for maximum sizes
+ *----------------------------------------------------------------------------*/
+
+void
+cs_base_mem_log_subsystems(cs_log_t  log_id,
+                           bool      new_phase)
+{
+  int n_l = bft_mem_n_subsystems();
+
+  /* Serialize local names */
+
+  size_t l_size = 0;
+  for (int i = 0; i < n_l; i++)
+    l_size += strlen(bft_mem_subsystem_info(i, NULL, NULL, NULL)) + 1;
+
+  char *g_buf = NULL;
+  int g_size = l_size;
+
+  BFT_MALLOC(g_buf, l_size + 1, char);
+  l_size = 0;
+  for (int i = 0; i < n_l; i++) {
+    const char *name = bft_mem_subsystem_info(i, NULL, NULL, NULL);
+    strcpy(g_buf + l_size, name);
+    l_size += strlen(name) + 1;
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    int _l_size = l_size;
+    int *count, *displ;
+    BFT_MALLOC(count, cs_glob_n_ranks, int);
+    BFT_MALLOC(displ, cs_glob_n_ranks, int);
+    MPI_Allgather(&_l_size, 1, MPI_INT, count, 1, MPI_INT, cs_glob_mpi_comm);
+    g_size = 0;
+    for (int i = 0; i < cs_glob_n_ranks; i++) {
+      displ[i] = g_size;
+      g_size += count[i];
+    }
+    char *l_buf = g_buf;
+    BFT_MALLOC(g_buf, g_size + 1, char);
+    MPI_Allgatherv(l_buf, _l_size, MPI_CHAR, g_buf, count, displ, MPI_CHAR,
+                   cs_glob_mpi_comm);
+    BFT_FREE(l_buf);
+    BFT_FREE(displ);
+    BFT_FREE(count);
+  }
+#endif
+
+  /* Build list of unique names (the same on all ranks, in alphabetical
+     order), and matching sizes */
+
+  int n_g = 0;
+  const char **g_name = NULL;
+  for (int i = 0; i < g_size; i += strlen(g_buf + i) + 1)
+    n_g++;
+  BFT_MALLOC(g_name, n_g, const char *);
+  n_g = 0;
+  for (int i = 0; i < g_size; i += strlen(g_buf + i) + 1) {
+    int j;
+    for (j = 0; j < n_g && strcmp(g_name[j], g_buf + i) < 0; j++);
+    if (j < n_g && strcmp(g_name[j], g_buf + i) == 0)
+      continue;
+    for (int k = n_g; k > j; k--)
+      g_name[k] = g_name[k-1];
+    g_name[j] = g_buf + i;
+    n_g++;
+  }
+
+  if (n_g == 0) {
+    BFT_FREE(g_name);
+    BFT_FREE(g_buf);
+    return;
+  }
+
+  double *val;
+  BFT_MALLOC(val, n_g*6, double);
+  for (int j = 0; j < n_g*6; j++)
+    val[j] = 0;
+
+  for (int i = 0; i < n_l; i++) {
+    size_t s_cur[2], s_max[2], s_phase[2];
+    const char *name = bft_mem_subsystem_info(i, s_cur, s_max, s_phase);
+    int j;
+    for (j = 0; j < n_g && strcmp(g_name[j], name) != 0; j++);
+    for (int k = 0; k < 2; k++) {
+      val[j*6 + k*3]     = s_cur[k];
+      val[j*6 + k*3 + 1] = s_max[k];
+      val[j*6 + k*3 + 2] = s_phase[k];
+    }
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Allreduce(MPI_IN_PLACE, val, n_g*6, MPI_DOUBLE, MPI_MAX,
+                  cs_glob_mpi_comm);
+#endif
+
+  /* Print to log */
+
+  const double mib = 1024.*1024.;
+
+#if defined(HAVE_ACCEL)
+  const int n_types = 2;
+#else
+  const int n_types = 1;
+#endif
+
+  cs_log_printf(log_id,
+                _("\nMemory use by subsystem (MiB, maximum over ranks):\n\n"
+                  "  %-16s"), _("subsystem"));
+  for (int k = 0; k < n_types; k++) {
+    const char *type_name = (k == 0) ? "host" : "device";
+    char h[3][16];
+    snprintf(h[0], 16, "%s cur", type_name);
+    snprintf(h[1], 16, "%s max", type_name);
+    snprintf(h[2], 16, "%s phase", type_name);
+    cs_log_printf(log_id, " %12s %12s %12s", h[0], h[1], h[2]);
+  }
+  cs_log_printf(log_id, "\n");
+
+  for (int j = 0; j < n_g; j++) {
+    cs_log_printf(log_id, "  %-16s", g_name[j]);
+    for (int k = 0; k < n_types; k++)
+      cs_log_printf(log_id, " %12.3f %12.3f %12.3f",
+                    val[j*6 + k*3] / mib, val[j*6 + k*3 + 1] / mib,
+                    val[j*6 + k*3 + 2] / mib);
+    cs_log_printf(log_id, "\n");
+  }
+
+  BFT_FREE(val);
+  BFT_FREE(g_name);
+  BFT_FREE(g_buf);
+
+  if (new_phase)
+    bft_mem_subsystem_phase_start();
+}
+
 /*----------------------------------------------------------------------------
  * Finalize management of memory allocated through BFT.
  *
@@ -1841,6 +1996,51 @@ cs_base_mem_finalize(void)
 
   }
 
+  /* Host/device memory pool statistics */
+
+  {
+    size_t pool_counts[4], pool_sizes[2];
+    cs_mem_pool_get_stats(pool_counts, pool_sizes);
+
+    unsigned long long pool_c[5] = {pool_counts[0], pool_counts[1],
+                                    pool_counts[2], pool_counts[3],
+                                    pool_sizes[1]};
+
+#if defined(HAVE_MPI)
+    if (cs_glob_n_ranks > 1) {
+      unsigned long long pool_c_l[5];
+      for (int i = 0; i < 5; i++)
+        pool_c_l[i] = pool_c[i];
+      MPI_Reduce(pool_c_l, pool_c, 4, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                 0, cs_glob_mpi_comm);
+      MPI_Reduce(pool_c_l + 4, pool_c + 4, 1, MPI_UNSIGNED_LONG_LONG,
+                 MPI_MAX, 0, cs_glob_mpi_comm);
+    }
+#endif
+
+    if (pool_c[0] > 0) {
+      double max_cached = (double)pool_c[4] / 1024.;
+      for (itot = 0; max_cached > 1024. && itot < 7; itot++)
+        max_cached /= 1024.;
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("\n  Host/device memory pool:\n"
+                      "    allocation requests:                 %12llu\n"
+                      "    reused cached blocks:                %12llu\n"
+                      "    actual allocations:                  %12llu\n"
+                      "    device synchronizations for reuse:   %12llu\n"
+                      "    maximum local cached size:           "
+                      "%12.3f %ciB\n"),
+                    pool_c[0], pool_c[1], pool_c[2], pool_c[3],
+                    max_cached, unit[itot]);
+    }
+  }
+
+  cs_mem_pool_release();
+
+  /* Per-subsystem memory use */
+
+  cs_base_mem_log_subsystems(CS_LOG_PERFORMANCE, false);
+
   cs_log_printf(CS_LOG_PERFORMANCE, "\n");
   cs_log_separator(CS_LOG_PERFORMANCE);
 
@@ -39,6 +39,8 @@
  *  Local headers
  *----------------------------------------------------------------------------*/
 
+#include "cs_log.h"
+
 /*=============================================================================
  * Macro definitions
  *============================================================================*/
@@ -224,6 +226,25 @@ cs_base_error_init(bool  signal_defaults);
 void
 cs_base_mem_init(void);
 
+/*----------------------------------------------------------------------------
+ * Log memory use by subsystem.
+ *
+ * Memory is accounted by subsystem only when allocations are tracked
+ * (i.e. when the CS_MEM_LOG or CS_MEM_STATS environment variables are
+ * defined, or with accelerator support). Current, maximum, and current
+ * phase maximum sizes are logged, using the maximum over ranks.
+ *
+ * This is a collective operation.
+ *
+ * parameters:
+ *   log_id    <-- log file type
+ *   new_phase <-- if true, start a new phase for maximum sizes
+ *----------------------------------------------------------------------------*/
+
+void
+cs_base_mem_log_subsystems(cs_log_t  log_id,
+                           bool      new_phase);
+
 /*----------------------------------------------------------------------------
  * Finalize management of memory allocated through BFT.
  *
@@ -39,6 +39,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <map>
+#include <vector>
 
 #if defined(SYCL_LANGUAGE_VERSION)
 #include <sycl/sycl.hpp>
@@ -69,10 +70,35 @@
  * Local Macro Definitions
  *============================================================================*/
 
+/* Memory pool size classes: minimum size, and number of classes
+   per power of 2 range */
+
+#define CS_MEM_POOL_MIN_SIZE       512
+#define CS_MEM_POOL_N_SUB_CLASSES    4
+
 /*============================================================================
  * Local Type Definitions
  *============================================================================*/
 
+/* Cached (unused) memory pool block */
+
+typedef struct {
+
+  void      *ptr;      /* Pointer to block */
+  unsigned   sync_id;  /* Device synchronization counter at release */
+
+} cs_mem_pool_block_t;
+
+/* Info on memory pool block in use */
+
+typedef struct {
+
+  cs_alloc_mode_t  mode;         /* Allocation mode */
+  size_t           size;         /* Size of block (size class) */
+  bool             read_mostly;  /* Has read-mostly advice been set ? */
+
+} cs_mem_pool_use_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -84,6 +110,25 @@
 static bool _initialized = false;
 static bool _ignore_prefetch = false;
 
+/* Host/device memory pool (caching allocator): cached blocks for
+   pinned, shared, and device allocations, by size class, and
+   blocks in use */
+
+static bool    _pool_active = true;
+static size_t  _pool_max_cached = SIZE_MAX;
+
+static std::map<size_t, std::vector<cs_mem_pool_block_t>>  _pool_free[3];
+static std::map<const void *, cs_mem_pool_use_t>  _pool_used;
+
+static unsigned  _pool_sync_id = 0;
+
+static size_t  _pool_n_requests = 0;
+static size_t  _pool_n_hits = 0;
+static size_t  _pool_n_allocs = 0;
+static size_t  _pool_n_syncs = 0;
+static size_t  _pool_cached_size = 0;
+static size_t  _pool_cached_size_max = 0;
+
 /*! Default "host+device" allocation mode */
 /*----------------------------------------*/
 
@@ -182,6 +227,13 @@ _initialize(void)
     if (i > 0)
       _ignore_prefetch = true;
   }
+
+  const char s_pool[] = "CS_HD_MEM_POOL";
+  if (getenv(s_pool) != NULL) {
+    int i = atoi(getenv(s_pool));
+    if (i < 1)
+      _pool_active = false;
+  }
 }
 
 #if defined(SYCL_LANGUAGE_VERSION)
@@ -430,6 +482,337 @@ _omp_target_mem_malloc_managed(size_t        n,
 
 #endif /* defined(HAVE_OPENMP_TARGET) */
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate memory using the backend matching a given mode.
+ *
+ * Only modes requiring device-related allocation functions are handled
+ * here (CS_ALLOC_HOST_DEVICE_PINNED, CS_ALLOC_HOST_DEVICE_SHARED,
+ * and CS_ALLOC_DEVICE).
+ *
+ * \param [in]  mode       allocation mode
+ * \param [in]  n          size to allocate, in bytes
+ * \param [in]  var_name   allocated variable name string
+ * \param [in]  file_name  name of calling source file
+ * \param [in]  line_num   line number in calling source file
+ *
+ * \returns pointer to allocated memory.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void *
+_backend_malloc(cs_alloc_mode_t   mode,
+                size_t            n,
+                const char       *var_name,
+                const char       *file_name,
+                int               line_num)
+{
+  void *ptr = nullptr;
+
+#if defined(HAVE_CUDA)
+
+  if (mode == CS_ALLOC_HOST_DEVICE_PINNED)
+    ptr = cs_cuda_mem_malloc_host(n, var_name, file_name, line_num);
+  else if (mode == CS_ALLOC_HOST_DEVICE_SHARED)
+    ptr = cs_cuda_mem_malloc_managed(n, var_name, file_name, line_num);
+  else if (mode == CS_ALLOC_DEVICE)
+    ptr = cs_cuda_mem_malloc_device(n, var_name, file_name, line_num);
+
+#elif defined(SYCL_LANGUAGE_VERSION)
+
+  if (mode == CS_ALLOC_HOST_DEVICE_PINNED)
+    ptr = _sycl_mem_malloc_host(n, var_name, file_name, line_num);
+  else if (mode == CS_ALLOC_HOST_DEVICE_SHARED)
+    ptr = _sycl_mem_malloc_shared(n, var_name, file_name, line_num);
+  else if (mode == CS_ALLOC_DEVICE)
+    ptr = _sycl_mem_malloc_device(n, var_name, file_name, line_num);
+
+#elif defined(HAVE_OPENMP_TARGET)
+
+  if (mode == CS_ALLOC_HOST_DEVICE_PINNED)
+    ptr = _omp_target_mem_malloc_host(n, var_name, file_name, line_num);
+  else if (mode == CS_ALLOC_HOST_DEVICE_SHARED)
+    ptr = _omp_target_mem_malloc_managed(n, var_name, file_name, line_num);
+  else if (mode == CS_ALLOC_DEVICE)
+    ptr = _omp_target_mem_malloc_device(n, var_name, file_name, line_num);
+
+#endif
+
+  return ptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free memory using the backend matching a given mode.
+ *
+ * \param [in]  mode       allocation mode
+ * \param [in]  ptr        pointer to free
+ * \param [in]  var_name   allocated variable name string
+ * \param [in]  file_name  name of calling source file
+ * \param [in]  line_num   line number in calling source file
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_backend_free(cs_alloc_mode_t   mode,
+              void             *ptr,
+              const char       *var_name,
+              const char       *file_name,
+              int               line_num)
+{
+#if defined(HAVE_CUDA)
+
+  if (mode == CS_ALLOC_HOST_DEVICE_PINNED)
+    cs_cuda_mem_free_host(ptr, var_name, file_name, line_num);
+  else
+    cs_cuda_mem_free(ptr, var_name, file_name, line_num);
+
+#else
+
+  CS_UNUSED(mode);
+  CS_UNUSED(var_name);
+  CS_UNUSED(file_name);
+  CS_UNUSED(line_num);
+
+#if defined(SYCL_LANGUAGE_VERSION)
+  sycl::free(ptr, cs_glob_sycl_queue);
+#elif defined(HAVE_OPENMP_TARGET)
+  omp_target_free(ptr, cs_glob_omp_target_device_id);
+#endif
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for completion of all work queued on the device.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_device_synchronize(void)
+{
+#if defined(HAVE_CUDA)
+  cs_cuda_device_synchronize();
+#elif defined(SYCL_LANGUAGE_VERSION)
+  cs_glob_sycl_queue.wait();
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the memory pool size class matching a given size.
+ *
+ * Each power of 2 range is split in CS_MEM_POOL_N_SUB_CLASSES classes,
+ * so the allocated size exceeds the requested size by less than 25%.
+ *
+ * \param [in]  size  requested size, in bytes
+ *
+ * \returns size of matching class, in bytes.
+ */
+/*----------------------------------------------------------------------------*/
+
+static size_t
+_pool_class_size(size_t  size)
+{
+  if (size <= CS_MEM_POOL_MIN_SIZE)
+    return CS_MEM_POOL_MIN_SIZE;
+
+  size_t p2 = CS_MEM_POOL_MIN_SIZE;
+  while (p2 < size)
+    p2 *= 2;
+
+  size_t step = p2 / (2*CS_MEM_POOL_N_SUB_CLASSES);
+
+  return ((size + step - 1) / step) * step;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate memory for a given mode, reusing a cached block
+ *        from the memory pool if available.
+ *
+ * Blocks released since the last device synchronization may still be
+ * used by queued work; they are reused only after synchronizing the
+ * device, which is done only when no other block of the required class
+ * is available.
+ *
+ * \param [in]  mode       allocation mode
+ * \param [in]  n          size to allocate, in bytes
+ * \param [in]  var_name   allocated variable name string
+ * \param [in]  file_name  name of calling source file
+ * \param [in]  line_num   line number in calling source file
+ *
+ * \returns pointer to allocated memory.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void *
+_pool_malloc(cs_alloc_mode_t   mode,
+             size_t            n,
+             const char       *var_name,
+             const char       *file_name,
+             int               line_num)
+{
+  if (_pool_active == false)
+    return _backend_malloc(mode, n, var_name, file_name, line_num);
+
+  void *ptr = nullptr;
+  size_t c_size = _pool_class_size(n);
+
+  #pragma omp critical(cs_mem_pool)
+  {
+    _pool_n_requests += 1;
+
+    auto it = _pool_free[mode - CS_ALLOC_HOST_DEVICE_PINNED].find(c_size);
+
+    if (it != _pool_free[mode - CS_ALLOC_HOST_DEVICE_PINNED].end()) {
+      std::vector<cs_mem_pool_block_t> &blocks = it->second;
+
+      /* Prefer the most recently released block which is known to be
+         idle; otherwise, synchronize so that all blocks are idle */
+
+      size_t b_id = blocks.size();
+      for (size_t i = blocks.size(); i > 0; i--) {
+        if (blocks[i-1].sync_id != _pool_sync_id) {
+          b_id = i-1;
+          break;
+        }
+      }
+      if (b_id == blocks.size() && blocks.size() > 0) {
+        _device_synchronize();
+        _pool_sync_id += 1;
+        _pool_n_syncs += 1;
+        b_id = blocks.size() - 1;
+      }
+
+      if (b_id < blocks.size()) {
+        ptr = blocks[b_id].ptr;
+        blocks.erase(blocks.begin() + b_id);
+        _pool_cached_size -= c_size;
+        _pool_n_hits += 1;
+      }
+    }
+  }
+
+  if (ptr == nullptr) {
+    ptr = _backend_malloc(mode, c_size, var_name, file_name, line_num);
+    #pragma omp atomic
+    _pool_n_allocs += 1;
+  }
+
+  #pragma omp critical(cs_mem_pool)
+  {
+    cs_mem_pool_use_t u = {.mode = mode,
+                           .size = c_size,
+                           .read_mostly = false};
+    _pool_used[ptr] = u;
+  }
+
+  return ptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free memory, or release it to the memory pool if it was
+ *        allocated through the pool.
+ *
+ * \param [in]  mode       allocation mode
+ * \param [in]  ptr        pointer to free
+ * \param [in]  var_name   allocated variable name string
+ * \param [in]  file_name  name of calling source file
+ * \param [in]  line_num   line number in calling source file
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_pool_free_block(cs_alloc_mode_t   mode,
+                 void             *ptr,
+                 const char       *var_name,
+                 const char       *file_name,
+                 int               line_num)
+{
+  bool cached = false;
+  cs_mem_pool_use_t u = {.mode = mode, .size = 0, .read_mostly = false};
+
+  #pragma omp critical(cs_mem_pool)
+  {
+    auto it = _pool_used.find(ptr);
+    if (it != _pool_used.end()) {
+      u = it->second;
+      _pool_used.erase(it);
+
+      if (_pool_active && _pool_cached_size + u.size <= _pool_max_cached) {
+        cs_mem_pool_block_t b = {.ptr = ptr, .sync_id = _pool_sync_id};
+        _pool_free[u.mode - CS_ALLOC_HOST_DEVICE_PINNED][u.size].push_back(b);
+        _pool_cached_size += u.size;
+        if (_pool_cached_size > _pool_cached_size_max)
+          _pool_cached_size_max = _pool_cached_size;
+        cached = true;
+      }
+    }
+  }
+
+#if defined(HAVE_CUDA)
+  if (u.read_mostly)
+    cs_cuda_mem_unset_advise_read_mostly(ptr, u.size);
+#endif
+
+  if (cached == false)
+    _backend_free(u.mode, ptr, var_name, file_name, line_num);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Mark or unmark a block allocated through the memory pool as
+ *        having read-mostly advice.
+ *
+ * \param [in]  ptr          pointer to block
+ * \param [in]  read_mostly  true if read-mostly advice is set
+ */
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_CUDA)
+
+static void
+_pool_set_read_mostly(const void  *ptr,
+                      bool         read_mostly)
+{
+  #pragma omp critical(cs_mem_pool)
+  {
+    auto it = _pool_used.find(ptr);
+    if (it != _pool_used.end())
+      it->second.read_mostly = read_mostly;
+  }
+}
+
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the size of a block allocated through the memory pool.
+ *
+ * \param [in]  ptr  pointer to block
+ *
+ * \returns size of block (size class), or 0 if not allocated by the pool.
+ */
+/*----------------------------------------------------------------------------*/
+
+static size_t
+_pool_block_size(const void  *ptr)
+{
+  size_t size = 0;
+
+  #pragma omp critical(cs_mem_pool)
+  {
+    auto it = _pool_used.find(ptr);
+    if (it != _pool_used.end())
+      size = it->second.size;
+  }
+
+  return size;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 BEGIN_C_DECLS
@@ -517,73 +900,16 @@ cs_malloc_hd(cs_alloc_mode_t   mode,
   // cs_get_device_ptr. This applies for CS_ALLOC_HOST_DEVICE
   // and CS_ALLOC_HOST_DEVICE_PINNED modes
 
-#if defined(HAVE_CUDA)
-
   else if (mode == CS_ALLOC_HOST_DEVICE_PINNED)
-    me.host_ptr = cs_cuda_mem_malloc_host(me.size,
-                                          var_name,
-                                          file_name,
-                                          line_num);
+    me.host_ptr = _pool_malloc(mode, me.size, var_name, file_name, line_num);
 
   else if (mode == CS_ALLOC_HOST_DEVICE_SHARED) {
-    me.host_ptr = cs_cuda_mem_malloc_managed(me.size,
-                                             var_name,
-                                             file_name,
-                                             line_num);
+    me.host_ptr = _pool_malloc(mode, me.size, var_name, file_name, line_num);
     me.device_ptr = me.host_ptr;
   }
 
   else if (mode == CS_ALLOC_DEVICE)
-    me.device_ptr = cs_cuda_mem_malloc_device(me.size,
-                                              var_name,
-                                              file_name,
-                                              line_num);
-
-#elif defined(SYCL_LANGUAGE_VERSION)
-
-  else if (mode == CS_ALLOC_HOST_DEVICE_PINNED)
-    me.host_ptr = _sycl_mem_malloc_host(me.size,
-                                        var_name,
-                                        file_name,
-                                        line_num);
-
-  else if (mode == CS_ALLOC_HOST_DEVICE_SHARED) {
-    me.host_ptr = _sycl_mem_malloc_shared(me.size,
-                                          var_name,
-                                          file_name,
-                                          line_num);
-    me.device_ptr = me.host_ptr;
-  }
-
-  else if (mode == CS_ALLOC_DEVICE)
-    me.device_ptr = _sycl_mem_malloc_device(me.size,
-                                            var_name,
-                                            file_name,
-                                            line_num);
-
-#elif defined(HAVE_OPENMP_TARGET)
-
-  else if (mode == CS_ALLOC_HOST_DEVICE_PINNED)
-    me.host_ptr = _omp_target_mem_malloc_host(me.size,
-                                              var_name,
-                                              file_name,
-                                              line_num);
-
-  else if (mode == CS_ALLOC_HOST_DEVICE_SHARED) {
-    me.host_ptr = _omp_target_mem_malloc_managed(me.size,
-                                                 var_name,
-                                                 file_name,
-                                                 line_num);
-    me.device_ptr = me.host_ptr;
-  }
-
-  else if (mode == CS_ALLOC_DEVICE)
-    me.device_ptr = _omp_target_mem_malloc_device(me.size,
-                                                  var_name,
-                                                  file_name,
-                                                  line_num);
-
-#endif
+    me.device_ptr = _pool_malloc(mode, me.size, var_name, file_name, line_num);
 
   if (file_name != nullptr)
     bft_mem_update_block_info(var_name, file_name, line_num,
@@ -670,13 +996,22 @@ cs_realloc_hd(void            *ptr,
     ret_ptr = me.host_ptr;
 
     if (me.device_ptr != nullptr) {
-#if defined(HAVE_CUDA)
-      cs_cuda_mem_free(me.device_ptr, var_name, file_name, line_num);
-#elif defined(SYCL_LANGUAGE_VERSION)
-      sycl::free(me.device_ptr, cs_glob_sycl_queue);
-#elif defined(HAVE_OPENMP_TARGET)
-      omp_target_free(me.device_ptr, cs_glob_omp_target_device_id);
-#endif
+      _pool_free_block(CS_ALLOC_DEVICE, me.device_ptr,
+                       var_name, file_name, line_num);
+      me.device_ptr = nullptr;
+    }
+  }
+
+  /* Pooled block whose size class is unchanged: keep it */
+
+  else if (   me_old.mode == me.mode
+           && me.mode >= CS_ALLOC_HOST_DEVICE_PINNED
+           && _pool_block_size(ptr) == _pool_class_size(new_size)) {
+    me.size = new_size;
+
+    if (me.mode == CS_ALLOC_HOST_DEVICE_PINNED && me.device_ptr != nullptr) {
+      _pool_free_block(CS_ALLOC_DEVICE, me.device_ptr,
+                       var_name, file_name, line_num);
       me.device_ptr = nullptr;
     }
   }
@@ -750,44 +1085,12 @@ cs_free_hd(void        *ptr,
   if (me.mode < CS_ALLOC_HOST_DEVICE_PINNED)
     bft_mem_free(me.host_ptr, var_name, nullptr, 0);
 
-  else if (me.host_ptr != nullptr) {
-
-#if defined(HAVE_CUDA)
-
-    if (me.mode == CS_ALLOC_HOST_DEVICE_SHARED)
-      cs_cuda_mem_free(me.host_ptr, var_name, file_name, line_num);
-    else
-      cs_cuda_mem_free_host(me.host_ptr, var_name, file_name, line_num);
+  else if (me.host_ptr != nullptr)
+    _pool_free_block(me.mode, me.host_ptr, var_name, file_name, line_num);
 
-#elif defined(SYCL_LANGUAGE_VERSION)
-
-    sycl::free(me.host_ptr, cs_glob_sycl_queue);
-
-#elif defined(HAVE_OPENMP_TARGET)
-
-    omp_target_free(me.host_ptr, cs_glob_omp_target_device_id);
-
-#endif
-
-  }
-
-  if (me.device_ptr != nullptr && me.device_ptr != me.host_ptr) {
-
-#if defined(HAVE_CUDA)
-
-    cs_cuda_mem_free(me.device_ptr, var_name, file_name, line_num);
-
-#elif defined(SYCL_LANGUAGE_VERSION)
-
-    sycl::free(me.device_ptr, cs_glob_sycl_queue);
-
-#elif defined(HAVE_OPENMP_TARGET)
-
-    omp_target_free(me.device_ptr, cs_glob_omp_target_device_id);
-
-#endif
-
-  }
+  if (me.device_ptr != nullptr && me.device_ptr != me.host_ptr)
+    _pool_free_block(CS_ALLOC_DEVICE, me.device_ptr,
+                     var_name, file_name, line_num);
 
   if (file_name != nullptr)
     bft_mem_update_block_info(var_name, file_name, line_num,
@@ -831,26 +1134,13 @@ cs_get_device_ptr(void  *ptr)
 
       cs_mem_block_t me_old = me;
 
-#if defined(HAVE_CUDA)
-
-      me.device_ptr = cs_cuda_mem_malloc_device(me.size,
-                                                "me.device_ptr",
-                                                __FILE__,
-                                                __LINE__);
-
-#elif defined(SYCL_LANGUAGE_VERSION)
-
-      me.device_ptr = _sycl_mem_malloc_device(me.size,
-                                              "me.device_ptr",
-                                              __FILE__,
-                                              __LINE__);
+      me.device_ptr = _pool_malloc(CS_ALLOC_DEVICE,
+                                   me.size,
+                                   "me.device_ptr",
+                                   __FILE__,
+                                   __LINE__);
 
-#elif defined(HAVE_OPENMP_TARGET)
-
-      me.device_ptr = _omp_target_mem_malloc_device(me.size,
-                                                    "me.device_ptr",
-                                                    __FILE__,
-                                                    __LINE__);
+#if defined(HAVE_OPENMP_TARGET)
 
       if (omp_target_associate_ptr(me.host_ptr, me.device_ptr, me.size, 0,
                                    cs_glob_omp_target_device_id))
@@ -905,28 +1195,11 @@ cs_get_device_ptr_const(const void  *ptr)
 
       cs_mem_block_t me_old = me;
 
-#if defined(HAVE_CUDA)
-
-      me.device_ptr = cs_cuda_mem_malloc_device(me.size,
-                                                "me.device_ptr",
-                                                __FILE__,
-                                                __LINE__);
-
-#elif defined(SYCL_LANGUAGE_VERSION)
-
-      me.device_ptr = _sycl_mem_malloc_device(me.size,
-                                              "me.device_ptr",
-                                              __FILE__,
-                                              __LINE__);
-
-#elif defined(HAVE_OPENMP_TARGET)
-
-      me.device_ptr = _omp_target_mem_malloc_device(me.size,
-                                                    "me.device_ptr",
-                                                    __FILE__,
-                                                    __LINE__);
-
-#endif
+      me.device_ptr = _pool_malloc(CS_ALLOC_DEVICE,
+                                   me.size,
+                                   "me.device_ptr",
+                                   __FILE__,
+                                   __LINE__);
 
       bft_mem_update_block_info("me.device_ptr", __FILE__, __LINE__,
                                 &me_old, &me);
@@ -976,28 +1249,11 @@ cs_get_device_ptr_const_pf(const void  *ptr)
 
       cs_mem_block_t me_old = me;
 
-#if defined(HAVE_CUDA)
-
-      me.device_ptr = cs_cuda_mem_malloc_device(me.size,
-                                                "me.device_ptr",
-                                                __FILE__,
-                                                __LINE__);
-
-#elif defined(SYCL_LANGUAGE_VERSION)
-
-      me.device_ptr = _sycl_mem_malloc_device(me.size,
-                                              "me.device_ptr",
-                                              __FILE__,
-                                              __LINE__);
-
-#elif defined(HAVE_OPENMP_TARGET)
-
-      me.device_ptr = _omp_target_mem_malloc_device(me.size,
-                                                    "me.device_ptr",
-                                                    __FILE__,
-                                                    __LINE__);
-
-#endif
+      me.device_ptr = _pool_malloc(CS_ALLOC_DEVICE,
+                                   me.size,
+                                   "me.device_ptr",
+                                   __FILE__,
+                                   __LINE__);
 
       bft_mem_update_block_info("me.device_ptr", __FILE__, __LINE__,
                                 &me_old, &me);
@@ -1096,21 +1352,13 @@ cs_disassociate_device_ptr(void  *host_ptr)
 
     cs_mem_block_t me_old = me;
 
-#if defined(HAVE_CUDA)
-
-    cs_cuda_mem_free(me.device_ptr, "me.device_ptr", __FILE__, __LINE__);
-
-#elif defined(SYCL_LANGUAGE_VERSION)
-
-    sycl::free(me.device_ptr, cs_glob_sycl_queue);
-
-#elif defined(HAVE_OPENMP_TARGET)
-
+#if defined(HAVE_OPENMP_TARGET)
     omp_target_disassociate_ptr(me.host_ptr, cs_glob_omp_target_device_id);
-    omp_target_free(me.device_ptr, cs_glob_omp_target_device_id);
-
 #endif
 
+    _pool_free_block(CS_ALLOC_DEVICE, me.device_ptr,
+                     "me.device_ptr", __FILE__, __LINE__);
+
     me.device_ptr = nullptr;
 
     bft_mem_update_block_info("me.device_ptr", __FILE__, __LINE__,
@@ -1201,6 +1449,7 @@ cs_mem_advise_set_read_mostly(void  *ptr)
 #if defined(HAVE_CUDA)
 
     cs_cuda_mem_set_advise_read_mostly(me.device_ptr, me.size);
+    _pool_set_read_mostly(me.device_ptr, true);
 
 #endif
 
@@ -1228,12 +1477,117 @@ cs_mem_advise_unset_read_mostly(void  *ptr)
 #if defined(HAVE_CUDA)
 
     cs_cuda_mem_unset_advise_read_mostly(me.device_ptr, me.size);
+    _pool_set_read_mostly(me.device_ptr, false);
 
 #endif
 
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate the host/device memory pool.
+ *
+ * The memory pool caches pinned host, shared, and device allocations
+ * upon release, so that they may be reused by subsequent allocations
+ * of a similar size, avoiding costly (and often synchronizing) calls to
+ * the device runtime allocation functions. It is active by default,
+ * unless the CS_HD_MEM_POOL environment variable is set to 0.
+ *
+ * When the pool is deactivated, cached blocks are freed.
+ *
+ * \param [in]  active  true to activate the pool, false to deactivate it
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_pool_set_active(bool  active)
+{
+  if (_initialized == false)
+   _initialize();
+
+  _pool_active = active;
+
+  if (active == false)
+    cs_mem_pool_release();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum size of unused blocks cached by the memory pool.
+ *
+ * Blocks released when this size would be exceeded are freed.
+ *
+ * \param [in]  max_size  maximum cached size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_pool_set_max_cached(size_t  max_size)
+{
+  _pool_max_cached = max_size;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free all unused blocks cached by the memory pool.
+ *
+ * Blocks currently in use are not affected, and will be cached again
+ * upon release if the pool is active.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_pool_release(void)
+{
+  #pragma omp critical(cs_mem_pool)
+  {
+    if (_pool_cached_size > 0)
+      _device_synchronize();
+
+    for (int i = 0; i < 3; i++) {
+      cs_alloc_mode_t mode = (cs_alloc_mode_t)(CS_ALLOC_HOST_DEVICE_PINNED + i);
+      for (auto &c : _pool_free[i]) {
+        for (auto &b : c.second)
+          _backend_free(mode, b.ptr, "pool block", __FILE__, __LINE__);
+      }
+      _pool_free[i].clear();
+    }
+
+    _pool_cached_size = 0;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return memory pool statistics.
+ *
+ * Counts are those of allocation requests handled by the pool, of
+ * requests satisfied by a cached block, of actual allocations, and of
+ * device synchronizations required before reusing a recently released
+ * block. Sizes are the current and maximum size of unused cached blocks.
+ *
+ * \param [out]  counts  number of requests, hits, allocations,
+ *                       and synchronizations
+ * \param [out]  sizes   current and maximum cached size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mem_pool_get_stats(size_t  counts[4],
+                      size_t  sizes[2])
+{
+  #pragma omp critical(cs_mem_pool)
+  {
+    counts[0] = _pool_n_requests;
+    counts[1] = _pool_n_hits;
+    counts[2] = _pool_n_allocs;
+    counts[3] = _pool_n_syncs;
+    sizes[0] = _pool_cached_size;
+    sizes[1] = _pool_cached_size_max;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Synchronize data from host to device.
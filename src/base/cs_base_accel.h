@@ -617,6 +617,109 @@ cs_mem_advise_unset_read_mostly(void  *ptr);
 
 #endif
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate the host/device memory pool.
+ *
+ * The memory pool caches pinned host, shared, and device allocations
+ * upon release, so that they may be reused by subsequent allocations
+ * of a similar size, avoiding costly (and often synchronizing) calls to
+ * the device runtime allocation functions. It is active by default,
+ * unless the CS_HD_MEM_POOL environment variable is set to 0.
+ *
+ * When the pool is deactivated, cached blocks are freed.
+ *
+ * \param [in]  active  true to activate the pool, false to deactivate it
+ */
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_ACCEL)
+
+void
+cs_mem_pool_set_active(bool  active);
+
+#else
+
+#define cs_mem_pool_set_active(active);
+
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum size of unused blocks cached by the memory pool.
+ *
+ * Blocks released when this size would be exceeded are freed.
+ *
+ * \param [in]  max_size  maximum cached size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_ACCEL)
+
+void
+cs_mem_pool_set_max_cached(size_t  max_size);
+
+#else
+
+#define cs_mem_pool_set_max_cached(max_size);
+
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free all unused blocks cached by the memory pool.
+ *
+ * Blocks currently in use are not affected, and will be cached again
+ * upon release if the pool is active.
+ */
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_ACCEL)
+
+void
+cs_mem_pool_release(void);
+
+#else
+
+#define cs_mem_pool_release();
+
+#endif
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return memory pool statistics.
+ *
+ * Counts are those of allocation requests handled by the pool, of
+ * requests satisfied by a cached block, of actual allocations, and of
+ * device synchronizations required before reusing a recently released
+ * block. Sizes are the current and maximum size of unused cached blocks.
+ *
+ * \param [out]  counts  number of requests, hits, allocations,
+ *                       and synchronizations
+ * \param [out]  sizes   current and maximum cached size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_ACCEL)
+
+void
+cs_mem_pool_get_stats(size_t  counts[4],
+                      size_t  sizes[2]);
+
+#else
+
+static inline void
+cs_mem_pool_get_stats(size_t  counts[4],
+                      size_t  sizes[2])
+{
+  for (int i = 0; i < 4; i++)
+    counts[i] = 0;
+  sizes[0] = 0;
+  sizes[1] = 0;
+}
+
+#endif
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Synchronize data from host to device.
@@ -30,6 +30,9 @@
  * Standard C and C++ library headers
  *----------------------------------------------------------------------------*/
 
+#include <stdlib.h>
+#include <string.h>
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -112,6 +115,44 @@ finalize_streams_(void)
   _cs_glob_cuda_n_streams = 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return device id assigned to a given node-local rank by a
+ *        comma-separated device map.
+ *
+ * \param[in]  device_map    comma-separated list of device ids
+ * \param[in]  node_rank_id  rank id on node
+ *
+ * \return  device id, or -1 if the map is empty or ill-formed
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_device_from_map(const char  *device_map,
+                 int          node_rank_id)
+{
+  int n_entries = 0;
+  for (const char *p = device_map; *p != '\0'; p++) {
+    if (*p == ',')
+      n_entries++;
+  }
+  n_entries++;
+
+  int entry_id = node_rank_id % n_entries;
+
+  const char *p = device_map;
+  for (int i = 0; i < entry_id; i++)
+    p = strchr(p, ',') + 1;
+
+  char *e = nullptr;
+  long device_id = strtol(p, &e, 10);
+
+  if (e == p || (*e != ',' && *e != '\0'))
+    return -1;
+
+  return (int)device_id;
+}
+
 /*============================================================================
  * Semi-private function prototypes
  *
@@ -560,6 +601,84 @@ cs_cuda_mem_unset_advise_read_mostly(const void  *ptr,
                               cs_glob_cuda_device_id))
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for completion of all work queued on the current device.
+ *
+ * This is simply a wrapper over cudaDeviceSynchronize, with a safety check.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cuda_device_synchronize(void)
+{
+  CS_CUDA_CHECK(cudaDeviceSynchronize());
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get an interprocess memory handle for a device allocation.
+ *
+ * The pointer must be the base of an allocation made with
+ * cs_cuda_mem_malloc_device (i.e. cudaMalloc).
+ *
+ * \param [in]   ptr     pointer to device allocation
+ * \param [out]  handle  associated handle (size: CS_CUDA_IPC_HANDLE_SIZE)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cuda_ipc_get_mem_handle(void           *ptr,
+                           unsigned char   handle[])
+{
+  static_assert(sizeof(cudaIpcMemHandle_t) == CS_CUDA_IPC_HANDLE_SIZE,
+                "Unexpected cudaIpcMemHandle_t size");
+
+  cudaIpcMemHandle_t h;
+  CS_CUDA_CHECK(cudaIpcGetMemHandle(&h, ptr));
+  memcpy(handle, &h, CS_CUDA_IPC_HANDLE_SIZE);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Map a device allocation exported by another process on the
+ *        same node into the current process.
+ *
+ * Peer access between devices is enabled if needed.
+ *
+ * \param [in]  handle  handle from cs_cuda_ipc_get_mem_handle
+ *
+ * \return  pointer to mapped device memory
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_cuda_ipc_open_mem_handle(const unsigned char  handle[])
+{
+  cudaIpcMemHandle_t h;
+  memcpy(&h, handle, CS_CUDA_IPC_HANDLE_SIZE);
+
+  void *ptr = nullptr;
+  CS_CUDA_CHECK(cudaIpcOpenMemHandle(&ptr, h,
+                                     cudaIpcMemLazyEnablePeerAccess));
+
+  return ptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Unmap a device allocation mapped by cs_cuda_ipc_open_mem_handle.
+ *
+ * \param [in]  ptr  pointer to mapped device memory
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cuda_ipc_close_mem_handle(void  *ptr)
+{
+  CS_CUDA_CHECK(cudaIpcCloseMemHandle(ptr));
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 END_C_DECLS
@@ -746,7 +865,27 @@ cs_base_cuda_select_default_device(void)
     return -1;
   }
 
-  if (cs_glob_rank_id > -1 && n_devices > 1) {
+  /* An explicit node-local rank to device map may be given, as a
+     comma-separated list of device ids; node-local rank i uses the
+     device at position (i modulo list size) */
+
+  const char *device_map = getenv("CS_CUDA_DEVICE_MAP");
+
+  if (device_map != nullptr && cs_glob_rank_id > -1) {
+    device_id = _device_from_map(device_map, cs_glob_node_rank_id);
+    if (device_id < 0 || device_id >= n_devices) {
+      cs_base_warn(__FILE__, __LINE__);
+      bft_printf(_("CS_CUDA_DEVICE_MAP (\"%s\") assigns device %d to\n"
+                   "node-local rank %d, but only %d devices are available;\n"
+                   "using default mapping.\n"),
+                 device_map, device_id, cs_glob_node_rank_id, n_devices);
+      device_map = nullptr;
+    }
+  }
+  else
+    device_map = nullptr;
+
+  if (device_map == nullptr && cs_glob_rank_id > -1 && n_devices > 1) {
 
     device_id = cs_glob_node_rank_id*n_devices / cs_glob_node_n_ranks;
 
@@ -820,3 +959,21 @@ cs_base_cuda_get_device(void)
 }
 
 /*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy an executable CUDA graph.
+ *
+ * This function is intended for code which holds a graph handle without
+ * being compiled with nvcc (see \ref cs_dispatch_graph_destroy).
+ *
+ * \param[in]  exec  pointer to executable graph (cudaGraphExec_t)
+ */
+/*----------------------------------------------------------------------------*/
+
+extern "C" void
+cs_cuda_graph_exec_destroy(void  *exec)
+{
+  if (exec != nullptr)
+    CS_CUDA_CHECK(cudaGraphExecDestroy((cudaGraphExec_t)exec));
+}
+
+/*----------------------------------------------------------------------------*/
@@ -70,6 +70,10 @@
 
 #define CS_CUDA_WARP_SIZE 32
 
+/* Size of CUDA interprocess memory handles */
+
+#define CS_CUDA_IPC_HANDLE_SIZE 64
+
 /*----------------------------------------------------------------------------*/
 
 BEGIN_C_DECLS
@@ -435,6 +439,60 @@ void
 cs_cuda_mem_unset_advise_read_mostly(const void  *ptr,
                                    size_t       size);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Wait for completion of all work queued on the current device.
+ *
+ * This is simply a wrapper over cudaDeviceSynchronize, with a safety check.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cuda_device_synchronize(void);
+
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Get an interprocess memory handle for a device allocation.
+ *
+ * The pointer must be the base of an allocation made with
+ * cs_cuda_mem_malloc_device (i.e. cudaMalloc).
+ *
+ * \param [in]   ptr     pointer to device allocation
+ * \param [out]  handle  associated handle (size: CS_CUDA_IPC_HANDLE_SIZE)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cuda_ipc_get_mem_handle(void           *ptr,
+                           unsigned char   handle[]);
+
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Map a device allocation exported by another process on the
+ *        same node into the current process.
+ *
+ * Peer access between devices is enabled if needed.
+ *
+ * \param [in]  handle  handle from cs_cuda_ipc_get_mem_handle
+ *
+ * \return  pointer to mapped device memory
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_cuda_ipc_open_mem_handle(const unsigned char  handle[]);
+
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Unmap a device allocation mapped by cs_cuda_ipc_open_mem_handle.
+ *
+ * \param [in]  ptr  pointer to mapped device memory
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cuda_ipc_close_mem_handle(void  *ptr);
+
 /*=============================================================================
  * Inline function prototypes
  *============================================================================*/
@@ -604,6 +662,20 @@ cs_base_cuda_select_default_device(void);
 int
 cs_base_cuda_get_device(void);
 
+/*----------------------------------------------------------------------------*/
+/*
+ * \brief Destroy an executable CUDA graph.
+ *
+ * This function is intended for code which holds a graph handle without
+ * being compiled with nvcc (see \ref cs_dispatch_graph_destroy).
+ *
+ * \param[in]  exec  pointer to executable graph (cudaGraphExec_t)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cuda_graph_exec_destroy(void  *exec);
+
 #endif  /* CS_HAVE_CUDA */
 
 /*----------------------------------------------------------------------------*/
@@ -56,6 +56,7 @@
 #include "cs_base_accel.h"
 #include "cs_blas.h"
 #include "cs_boundary.h"
+#include "cs_boundary_conditions_set_coeffs.h"
 #include "cs_cf_thermo.h"
 #include "cs_coupling.h"
 #include "cs_equation.h"
@@ -1465,7 +1466,6 @@ _standard_turbulence_bcs(void)
   const cs_mesh_t *m = cs_glob_mesh;
   const cs_mesh_quantities_t  *mq = cs_glob_mesh_quantities;
   const cs_lnum_t n_b_faces = m->n_b_faces;
-  const cs_lnum_t *b_face_cells = m->b_face_cells;
 
   const cs_real_t *b_rho = CS_F_(rho_b)->val;
   const cs_real_t *c_mu = CS_F_(mu)->val;
@@ -1512,10 +1512,12 @@ _standard_turbulence_bcs(void)
 
       /* Now compute BC values at zone's faces */
 
+      const cs_lnum_t *z_cell_ids = cs_boundary_zone_face_cell_ids(z->id);
+
       for (cs_lnum_t i = 0; i < z->n_elts; i++) {
 
         cs_lnum_t face_id = z->elt_ids[i];
-        cs_lnum_t cell_id = b_face_cells[face_id];
+        cs_lnum_t cell_id = z_cell_ids[i];
 
         cs_real_t vel[3] = {_rcodcl_v[0][face_id],
                             _rcodcl_v[1][face_id],
@@ -1538,7 +1540,7 @@ _standard_turbulence_bcs(void)
           if (w_dist != NULL) {
             cs_gradient_scalar_cell(m,
                                     mq,
-                                    b_face_cells[face_id],
+                                    cell_id,
                                     halo_type,
                                     w_dist->bc_coeffs,
                                     w_dist->val,
@@ -2474,6 +2476,8 @@ cs_boundary_conditions_free(void)
   }
 
   BFT_FREE(_b_head_loss);
+
+  cs_boundary_conditions_set_coeffs_free_cache();
 }
 
 /*----------------------------------------------------------------------------*/
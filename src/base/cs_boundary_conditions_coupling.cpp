@@ -226,6 +226,10 @@ cs_boundary_conditions_coupling_t_out(cs_real_t  hbord[],
 
   // Coupling with radiative transfer
   if (cs_glob_rad_transfer_params->type > 0) {
+    cs_lnum_t n_walls = 0;
+    cs_lnum_t *wall_ids = nullptr;
+    BFT_MALLOC(wall_ids, nfpt1d, cs_lnum_t);
+
     for (cs_lnum_t ii = 0; ii < nfpt1d; ii++) {
       const cs_lnum_t face_id = ifpt1d[ii] - 1;
 
@@ -233,17 +237,16 @@ cs_boundary_conditions_coupling_t_out(cs_real_t  hbord[],
           && cs_glob_bc_type[face_id] != CS_ROUGHWALL)
         continue;
 
-      cs_1d_wall_thermal_solve(ii, tbord[face_id], hbord[face_id]);
-    }
-  }
-  // Without coupling with radiative transfer
-  else {
-    for (cs_lnum_t ii = 0; ii < nfpt1d; ii++) {
-      const cs_lnum_t face_id = ifpt1d[ii] - 1;
-      cs_1d_wall_thermal_solve(ii, tbord[face_id], hbord[face_id]);
+      wall_ids[n_walls++] = ii;
     }
 
+    cs_1d_wall_thermal_solve_list(n_walls, wall_ids, tbord, hbord);
+
+    BFT_FREE(wall_ids);
   }
+  // Without coupling with radiative transfer
+  else
+    cs_1d_wall_thermal_solve_list(nfpt1d, nullptr, tbord, hbord);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -61,6 +61,7 @@
 #include "cs_boundary_conditions_set_coeffs_symmetry.h"
 #include "cs_boundary_conditions_set_coeffs_turb.h"
 #include "cs_boundary_conditions_type.h"
+#include "cs_boundary_zone.h"
 #include "cs_cf_boundary_conditions.h"
 #include "cs_coupling.h"
 #include "cs_field.h"
@@ -80,6 +81,7 @@
 #include "cs_mobile_structures.h"
 #include "cs_parall.h"
 #include "cs_parameters.h"
+#include "cs_perf_summary.h"
 #include "cs_physical_constants.h"
 #include "cs_physical_model.h"
 #include "cs_prototypes.h"
@@ -89,6 +91,7 @@
 #include "cs_syr_coupling.h"
 #include "cs_thermal_model.h"
 #include "cs_time_step.h"
+#include "cs_timer.h"
 #include "cs_turbulence_model.h"
 #include "cs_turbomachinery.h"
 #include "cs_velocity_pressure.h"
@@ -147,10 +150,156 @@ cs_f_user_boundary_conditions_wrapper(int              itypfb[],
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Boundary condition inputs used for the last coefficients update
+   of a given scalar field */
+
+typedef struct {
+
+  int        *icodcl;    /* boundary condition codes */
+  cs_real_t  *rcodcl;    /* rcodcl1, rcodcl2 and rcodcl3 values,
+                            interleaved */
+  cs_real_t   visls_0;   /* reference diffusivity */
+  cs_real_t   sigmas;    /* turbulent Schmidt number */
+
+} cs_bc_coeffs_cache_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static int                     _n_coeffs_cache = 0;
+static cs_lnum_t               _coeffs_cache_n_b_faces = 0;
+static cs_bc_coeffs_cache_t  **_coeffs_cache = nullptr;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Compare boundary condition inputs of a scalar field with those used for
+ * its previous coefficients update, and flag zones whose coefficients
+ * may be kept.
+ *
+ * Coefficients of a zone may be kept if the zone is not time-varying, its
+ * inputs (codes and values) have not changed, and the diffusive exchange
+ * coefficient either is constant in time or is not used by the zone's
+ * conditions (for example homogeneous Neumann conditions on adiabatic
+ * walls).
+ *
+ * The cached inputs are updated.
+ *
+ * parameters:
+ *   f           <-- pointer to scalar field
+ *   visls_0     <-- reference diffusivity
+ *   sigmas      <-- turbulent Schmidt number
+ *   hint_static <-- is the exchange coefficient constant in time ?
+ *
+ * returns:
+ *   array of flags indicating for each boundary zone whether its
+ *   coefficients may be kept (to be freed by caller), or nullptr
+ *----------------------------------------------------------------------------*/
+
+static bool *
+_coeffs_cache_update(const cs_field_t  *f,
+                     cs_real_t          visls_0,
+                     cs_real_t          sigmas,
+                     bool               hint_static)
+{
+  const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
+  const int *face_zone_id = cs_boundary_zone_face_zone_id();
+
+  if (face_zone_id == nullptr)
+    return nullptr;
+
+  /* Discard cached values if the mesh changed */
+
+  if (_coeffs_cache_n_b_faces != n_b_faces) {
+    cs_boundary_conditions_set_coeffs_free_cache();
+    _coeffs_cache_n_b_faces = n_b_faces;
+  }
+
+  if (f->id >= _n_coeffs_cache) {
+    int n_prev = _n_coeffs_cache;
+    _n_coeffs_cache = cs_field_n_fields();
+    BFT_REALLOC(_coeffs_cache, _n_coeffs_cache, cs_bc_coeffs_cache_t *);
+    for (int i = n_prev; i < _n_coeffs_cache; i++)
+      _coeffs_cache[i] = nullptr;
+  }
+
+  bool all_changed = false;
+
+  cs_bc_coeffs_cache_t *c = _coeffs_cache[f->id];
+  if (c == nullptr) {
+    BFT_MALLOC(c, 1, cs_bc_coeffs_cache_t);
+    BFT_MALLOC(c->icodcl, n_b_faces, int);
+    BFT_MALLOC(c->rcodcl, n_b_faces*3, cs_real_t);
+    _coeffs_cache[f->id] = c;
+    all_changed = true;
+  }
+  else if (   cs_math_fabs(c->visls_0 - visls_0) > 0.
+           || cs_math_fabs(c->sigmas - sigmas) > 0.)
+    all_changed = true;
+
+  c->visls_0 = visls_0;
+  c->sigmas = sigmas;
+
+  const int n_zones = cs_boundary_zone_n_zones();
+
+  bool *changed, *hint_dep;
+  BFT_MALLOC(changed, n_zones, bool);
+  BFT_MALLOC(hint_dep, n_zones, bool);
+  for (int z_id = 0; z_id < n_zones; z_id++) {
+    changed[z_id] = all_changed;
+    hint_dep[z_id] = false;
+  }
+
+  const int *icodcl = f->bc_coeffs->icodcl;
+  const cs_real_t *rcodcl1 = f->bc_coeffs->rcodcl1;
+  const cs_real_t *rcodcl2 = f->bc_coeffs->rcodcl2;
+  const cs_real_t *rcodcl3 = f->bc_coeffs->rcodcl3;
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+
+    const int z_id = face_zone_id[f_id];
+    cs_real_t *rc = c->rcodcl + f_id*3;
+
+    if (   icodcl[f_id] != c->icodcl[f_id]
+        || memcmp(rc, rcodcl1 + f_id, sizeof(cs_real_t)) != 0
+        || memcmp(rc + 1, rcodcl2 + f_id, sizeof(cs_real_t)) != 0
+        || memcmp(rc + 2, rcodcl3 + f_id, sizeof(cs_real_t)) != 0) {
+      changed[z_id] = true;
+      c->icodcl[f_id] = icodcl[f_id];
+      rc[0] = rcodcl1[f_id];
+      rc[1] = rcodcl2[f_id];
+      rc[2] = rcodcl3[f_id];
+    }
+
+    /* Dirichlet, convective outlet and non-homogeneous Neumann
+       conditions use the exchange coefficient */
+
+    if (   icodcl[f_id] == 1 || icodcl[f_id] == 2
+        || (icodcl[f_id] == 3 && cs_math_fabs(rcodcl3[f_id]) > 0.))
+      hint_dep[z_id] = true;
+
+  }
+
+  bool *keep = changed;
+  for (int z_id = 0; z_id < n_zones; z_id++) {
+    const cs_zone_t *z = cs_boundary_zone_by_id(z_id);
+    keep[z_id] = (   !changed[z_id] && !z->time_varying
+                  && (hint_static || !hint_dep[z_id]));
+  }
+
+  BFT_FREE(hint_dep);
+
+  return keep;
+}
+
+
 /*----------------------------------------------------------------------------
  * Compute boundary condition code for mobile meshes in rotor/stator coupling
  *----------------------------------------------------------------------------*/
@@ -812,6 +961,8 @@ cs_boundary_conditions_set_coeffs(int        nvar,
                                   cs_real_t  theipb[],
                                   int        nftcdt)
 {
+  cs_timer_t t0 = cs_timer_time();
+
   const cs_mesh_t  *mesh = cs_glob_mesh;
   const cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
   const cs_fluid_properties_t *fluid_props = cs_glob_fluid_properties;
@@ -2697,6 +2848,15 @@ cs_boundary_conditions_set_coeffs(int        nvar,
     if (fluid_props->icp >= 0)
       cpro_cp = CS_F_(cp)->val;
 
+    /* Coefficients may be kept from the previous update only for
+       fixed meshes and when no other operator modifies them */
+
+    const bool cache_coeffs
+      = (   cs_glob_ale == CS_ALE_NONE
+         && cs_turbomachinery_get_model() == CS_TURBOMACHINERY_NONE
+         && cs_glob_physical_model_flag[CS_PHYSICAL_MODEL_FLAG] < 1
+         && nftcdt == 0);
+
     cs_field_t *f_id_cv = cs_field_by_name_try("isobaric_heat_capacity");
     if (f_id_cv != nullptr)
       cpro_cv = f_id_cv->val;
@@ -2823,11 +2983,36 @@ cs_boundary_conditions_set_coeffs(int        nvar,
         if (f_scal_b != nullptr)
           bvar_s = f_scal_b->val;
 
+        /* Coefficients of zones whose inputs did not change since the
+           previous update may be kept. This is restricted to cases where
+           no other operator modifies them, and where the exchange
+           coefficient is not needed otherwise. */
+
+        bool *zone_keep = nullptr;
+        const int *face_zone_id = cs_boundary_zone_face_zone_id();
+
+        if (   cache_coeffs
+            && turb_flux_model_type != 3
+            && isvhbl < 0
+            && !(cs_glob_rad_transfer_params->type >= 1 && f_th == f_scal)
+            && eqp_sc->icoupl < 0) {
+          bool hint_static = (   (eqp_sc->idften & CS_ISOTROPIC_DIFFUSION)
+                              && ifcvsl < 0 && ihcp <= 1
+                              && (   eqp_sc->idifft == 0
+                                  || iturb == CS_TURB_NONE));
+          zone_keep = _coeffs_cache_update(f_scal, visls_0, turb_schmidt,
+                                           hint_static);
+        }
+
         for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
 
           const cs_lnum_t c_id = b_face_cells[f_id];
           const cs_real_t surf = b_face_surf[f_id];
 
+          /* Keep cached coefficients ? */
+          const bool keep
+            = (zone_keep != nullptr) ? zone_keep[face_zone_id[f_id]] : false;
+
           /* Physical Properties */
           const cs_real_t visctc = visct[c_id];
           const cs_real_t visclc = viscl[c_id];
@@ -2861,7 +3046,9 @@ cs_boundary_conditions_set_coeffs(int        nvar,
             rkl = viscls[c_id];
 
           /* Scalar diffusivity */
-          if (eqp_sc->idften & CS_ISOTROPIC_DIFFUSION)
+          if (keep)
+            hint = 0.;
+          else if (eqp_sc->idften & CS_ISOTROPIC_DIFFUSION)
             hint = (rkl+eqp_sc->idifft*cpp*visctc/turb_schmidt)/distbf;
 
           /* Symmetric tensor diffusivity */
@@ -2913,11 +3100,12 @@ cs_boundary_conditions_set_coeffs(int        nvar,
             const cs_real_t pimp = rcodcl1_sc[f_id];
             const cs_real_t hext = rcodcl2_sc[f_id];
 
-            cs_boundary_conditions_set_dirichlet_scalar(f_id,
-                                                        f_scal->bc_coeffs,
-                                                        pimp,
-                                                        hint,
-                                                        hext);
+            if (!keep)
+              cs_boundary_conditions_set_dirichlet_scalar(f_id,
+                                                          f_scal->bc_coeffs,
+                                                          pimp,
+                                                          hint,
+                                                          hext);
 
             /* Store boundary value */
             if (f_scal_b != nullptr)
@@ -2931,10 +3119,11 @@ cs_boundary_conditions_set_coeffs(int        nvar,
 
             const cs_real_t dimp = rcodcl3_sc[f_id];
 
-            cs_boundary_conditions_set_neumann_scalar(f_id,
-                                                      f_scal->bc_coeffs,
-                                                      dimp,
-                                                      hint);
+            if (!keep)
+              cs_boundary_conditions_set_neumann_scalar(f_id,
+                                                        f_scal->bc_coeffs,
+                                                        dimp,
+                                                        hint);
 
             /* Store boundary value only for faces
                for which it was not previously computed
@@ -2953,8 +3142,9 @@ cs_boundary_conditions_set_coeffs(int        nvar,
             const cs_real_t pimp = rcodcl1_sc[f_id];
             const cs_real_t cfl  = rcodcl2_sc[f_id];
 
-            cs_boundary_conditions_set_convective_outlet_scalar
-              (f_id, f_scal->bc_coeffs, pimp, cfl, hint);
+            if (!keep)
+              cs_boundary_conditions_set_convective_outlet_scalar
+                (f_id, f_scal->bc_coeffs, pimp, cfl, hint);
 
             /* Store boundary value */
             if (f_scal_b != nullptr)
@@ -2969,10 +3159,11 @@ cs_boundary_conditions_set_coeffs(int        nvar,
             const cs_real_t hext = rcodcl2_sc[f_id];
             const cs_real_t dimp = rcodcl3_sc[f_id];
 
-            cs_boundary_conditions_set_total_flux(f_id,
-                                                  f_scal->bc_coeffs,
-                                                  hext,
-                                                  dimp);
+            if (!keep)
+              cs_boundary_conditions_set_total_flux(f_id,
+                                                    f_scal->bc_coeffs,
+                                                    hext,
+                                                    dimp);
 
             /* Store boundary value */
             if (f_scal_b != nullptr)
@@ -2988,8 +3179,9 @@ cs_boundary_conditions_set_coeffs(int        nvar,
             const cs_real_t pimp = rcodcl1_sc[f_id];
             const cs_real_t dimp = rcodcl3_sc[f_id];
 
-            cs_boundary_conditions_set_dirichlet_conv_neumann_diff_scalar
-              (f_id, f_scal->bc_coeffs, pimp, dimp);
+            if (!keep)
+              cs_boundary_conditions_set_dirichlet_conv_neumann_diff_scalar
+                (f_id, f_scal->bc_coeffs, pimp, dimp);
 
             /* Store boundary value */
             if (f_scal_b != nullptr)
@@ -3147,6 +3339,9 @@ cs_boundary_conditions_set_coeffs(int        nvar,
             }
           }
         } /* end f_id < n_b_faces */
+
+        BFT_FREE(zone_keep);
+
       }/* end if f->dim = 1 */
 
       /* Vector transported quantity (dimension may be greater than 3) */
@@ -3646,6 +3841,12 @@ cs_boundary_conditions_set_coeffs(int        nvar,
     BFT_FREE(lbt2h);
     BFT_FREE(vbt2h);
   }
+
+  /* Boundary condition coefficients are handled for all variables here */
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_perf_summary_add_diff("boundary_conditions", CS_PERF_SUMMARY_BC_UPDATE,
+                           &t0, &t1);
 }
 
 /*---------------------------------------------------------------------------- */
@@ -3673,6 +3874,8 @@ cs_boundary_conditions_set_coeffs_init(void)
   int *impale = cs_glob_ale_data->impale;
   int *ale_bc_type = cs_glob_ale_data->bc_type;
 
+  cs_boundary_conditions_set_coeffs_free_cache();
+
   cs_field_build_bc_codes_all();
 
   cs_boundary_conditions_reset();
@@ -3798,6 +4001,34 @@ cs_boundary_conditions_set_coeffs_init(void)
   cs_field_free_bc_codes_all();
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free boundary condition inputs cached for the update of
+ *        coefficients.
+ *
+ * Cached inputs allow keeping the coefficients of boundary zones whose
+ * definitions did not change since the previous update. Freeing them
+ * forces the next update to recompute all coefficients.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_set_coeffs_free_cache(void)
+{
+  for (int i = 0; i < _n_coeffs_cache; i++) {
+    cs_bc_coeffs_cache_t *c = _coeffs_cache[i];
+    if (c != nullptr) {
+      BFT_FREE(c->icodcl);
+      BFT_FREE(c->rcodcl);
+      BFT_FREE(c);
+    }
+  }
+
+  BFT_FREE(_coeffs_cache);
+  _n_coeffs_cache = 0;
+  _coeffs_cache_n_b_faces = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set convective oulet boundary condition for a scalar.
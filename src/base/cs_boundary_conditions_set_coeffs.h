@@ -147,6 +147,20 @@ cs_boundary_conditions_set_coeffs(int        nvar,
 void
 cs_boundary_conditions_set_coeffs_init(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free boundary condition inputs cached for the update of
+ *        coefficients.
+ *
+ * Cached inputs allow keeping the coefficients of boundary zones whose
+ * definitions did not change since the previous update. Freeing them
+ * forces the next update to recompute all coefficients.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_boundary_conditions_set_coeffs_free_cache(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set Neumann BC for a scalar for a given face.
@@ -2113,6 +2113,171 @@ cs_boundary_conditions_set_coeffs_turb(int        isvhb,
     cs_turbomachinery_get_wall_bc_coeffs(&coftur, &hfltur);
   }
 
+  /* Batch evaluation of smooth wall functions
+     ----------------------------------------- */
+
+  /* Wall function inputs only depend on the cell values, so they may
+     be gathered and the wall laws evaluated for all smooth wall faces
+     at once, except in LES with Van Driest damping, where the turbulent
+     viscosity is updated in the faces loop. */
+
+  const bool wf_batch
+    = !(type == CS_TURB_LES && cs_glob_turb_les_model->idries == 1);
+
+  cs_lnum_t n_wf = 0, n_wf_disabled = 0;
+  cs_lnum_t *wf_ids = nullptr;
+  int *wf_iuntur = nullptr;
+  cs_real_t *wf_buf = nullptr;
+  cs_real_t *wf_xnuii = nullptr, *wf_xnuit = nullptr, *wf_utau = nullptr;
+  cs_real_t *wf_dist = nullptr, *wf_rough = nullptr, *wf_rnnb = nullptr;
+  cs_real_t *wf_ek = nullptr, *wf_uet = nullptr, *wf_uk = nullptr;
+  cs_real_t *wf_yplus = nullptr, *wf_ypup = nullptr, *wf_cofimp = nullptr;
+  cs_real_t *wf_dplus = nullptr;
+
+  if (wf_batch) {
+
+    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+      if (icodcl_vel[f_id] == 5)
+        n_wf++;
+    }
+
+    BFT_MALLOC(wf_ids, n_wf, cs_lnum_t);
+    BFT_MALLOC(wf_iuntur, n_wf, int);
+    BFT_MALLOC(wf_buf, 13*n_wf, cs_real_t);
+
+    wf_xnuii = wf_buf;
+    wf_xnuit = wf_buf + n_wf;
+    wf_utau = wf_buf + 2*n_wf;
+    wf_dist = wf_buf + 3*n_wf;
+    wf_rough = wf_buf + 4*n_wf;
+    wf_rnnb = wf_buf + 5*n_wf;
+    wf_ek = wf_buf + 6*n_wf;
+    wf_uet = wf_buf + 7*n_wf;
+    wf_uk = wf_buf + 8*n_wf;
+    wf_yplus = wf_buf + 9*n_wf;
+    wf_ypup = wf_buf + 10*n_wf;
+    wf_cofimp = wf_buf + 11*n_wf;
+    wf_dplus = wf_buf + 12*n_wf;
+
+    /* Gather inputs in faces order (same computation as in the faces
+       loop below); faces of disabled cells are listed at the end
+       of wf_ids */
+
+    const bool project_rcodcl
+      = (   cs_glob_ale == CS_ALE_NONE
+         && cs_turbomachinery_get_model() == CS_TURBOMACHINERY_NONE);
+
+    cs_lnum_t w_id = 0;
+
+    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+
+      if (icodcl_vel[f_id] != 5)
+        continue;
+
+      const cs_lnum_t c_id = b_face_cells[f_id];
+      const cs_real_t *n = b_face_u_normal[f_id];
+
+      cs_real_t rcodcxyz[3] = {rcodcl1_vel[n_b_faces*0 + f_id],
+                               rcodcl1_vel[n_b_faces*1 + f_id],
+                               rcodcl1_vel[n_b_faces*2 + f_id]};
+
+      if (project_rcodcl) {
+        const cs_real_t rcodcn = cs_math_3_dot_product(rcodcxyz, n);
+        rcodcxyz[0] = rcodcxyz[0] - rcodcn * n[0];
+        rcodcxyz[1] = rcodcxyz[1] - rcodcn * n[1];
+        rcodcxyz[2] = rcodcxyz[2] - rcodcn * n[2];
+      }
+
+      const cs_real_t upxyz[3] = {velipb[f_id][0] - rcodcxyz[0],
+                                  velipb[f_id][1] - rcodcxyz[1],
+                                  velipb[f_id][2] - rcodcxyz[2]};
+
+      const cs_real_t usn = cs_math_3_dot_product(upxyz, n);
+
+      const cs_real_t txyz[3] = {upxyz[0] - usn*n[0],
+                                 upxyz[1] - usn*n[1],
+                                 upxyz[2] - usn*n[2]};
+
+      cs_real_t w_utau = cs_math_3_norm(txyz);
+      if (cs_math_fabs(w_utau) < cs_math_epzero)
+        w_utau = cs_math_epzero;
+
+      cs_real_t w_ek = 0, w_rnnb = 0;
+      if (cvar_k != nullptr) {
+        w_ek = cvar_k[c_id];
+        w_rnnb = (2./3.) * w_ek;
+      }
+      else if (   turb_model->order == CS_TURB_SECOND_ORDER
+               && turb_model->type  == CS_TURB_RANS) {
+        w_ek = 0.5 * (cvar_rij[c_id][0] + cvar_rij[c_id][1]
+                      + cvar_rij[c_id][2]);
+        w_rnnb = cs_math_3_sym_33_3_dot_product(n, cvar_rij[c_id], n);
+      }
+
+      wf_xnuii[w_id] = viscl[c_id] / crom[c_id];
+      wf_xnuit[w_id] = visct[c_id] / crom[c_id];
+      wf_utau[w_id] = w_utau;
+      wf_dist[w_id] = b_dist[f_id];
+      wf_rough[w_id] = (rough != nullptr) ? bpro_rough[f_id] : 0;
+      wf_rnnb[w_id] = w_rnnb;
+      wf_ek[w_id] = w_ek;
+
+      if (fvq->has_disable_flag && fvq->c_disable_flag[c_id]) {
+        n_wf_disabled++;
+        wf_ids[n_wf - n_wf_disabled] = w_id;
+      }
+      else
+        wf_ids[w_id - n_wf_disabled] = w_id;
+
+      w_id++;
+    }
+
+    const cs_lnum_t n_wf_regular = n_wf - n_wf_disabled;
+
+    cs_wall_functions_velocity_batch(cs_glob_wall_functions->iwallf,
+                                     n_wf_regular,
+                                     wf_ids,
+                                     wf_xnuii,
+                                     wf_xnuit,
+                                     wf_utau,
+                                     wf_dist,
+                                     wf_rough,
+                                     wf_rnnb,
+                                     wf_ek,
+                                     wf_iuntur,
+                                     &nsubla,
+                                     &nlogla,
+                                     wf_uet,
+                                     wf_uk,
+                                     wf_yplus,
+                                     wf_ypup,
+                                     wf_cofimp,
+                                     wf_dplus);
+
+    cs_wall_functions_velocity_batch(CS_WALL_F_DISABLED,
+                                     n_wf_disabled,
+                                     wf_ids + n_wf_regular,
+                                     wf_xnuii,
+                                     wf_xnuit,
+                                     wf_utau,
+                                     wf_dist,
+                                     wf_rough,
+                                     wf_rnnb,
+                                     wf_ek,
+                                     wf_iuntur,
+                                     &nsubla,
+                                     &nlogla,
+                                     wf_uet,
+                                     wf_uk,
+                                     wf_yplus,
+                                     wf_ypup,
+                                     wf_cofimp,
+                                     wf_dplus);
+
+  }
+
+  cs_lnum_t w_id = 0;
+
   /* Loop on boundary faces
      ----------------------*/
 
@@ -2250,7 +2415,20 @@ cs_boundary_conditions_set_coeffs_turb(int        isvhb,
     int iuntur;
     cs_real_t uk, ypup, dplus, yplus;
 
-    if (icodcl_vel[f_id] == 5) {
+    if (icodcl_vel[f_id] == 5 && wf_batch) {
+
+      iuntur = wf_iuntur[w_id];
+      uet = wf_uet[w_id];
+      uk = wf_uk[w_id];
+      yplus = wf_yplus[w_id];
+      ypup = wf_ypup[w_id];
+      cofimp = wf_cofimp[w_id];
+      dplus = wf_dplus[w_id];
+
+      w_id++;
+
+    }
+    else if (icodcl_vel[f_id] == 5) {
 
       cs_wall_f_type_t iwallf_loc = cs_glob_wall_functions->iwallf;
       if (fvq->has_disable_flag) {
@@ -3830,6 +4008,9 @@ cs_boundary_conditions_set_coeffs_turb(int        isvhb,
     }
   }
 
+  BFT_FREE(wf_ids);
+  BFT_FREE(wf_iuntur);
+  BFT_FREE(wf_buf);
   BFT_FREE(byplus);
   BFT_FREE(_buk);
   BFT_FREE(buet);
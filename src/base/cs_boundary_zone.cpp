@@ -53,6 +53,7 @@
 #include "bft_printf.h"
 
 #include "cs_base.h"
+#include "cs_base_accel.h"
 #include "cs_flag_check.h"
 #include "cs_log.h"
 #include "cs_map.h"
@@ -122,6 +123,11 @@ static int *_zone_id = nullptr;
 static int  _max_zone_class_id = -1;
 static int *_zone_class_id = nullptr;
 
+/* Optional adjacent cell ids of each zone's faces (gather lists),
+   built on demand */
+
+static cs_lnum_t **_zone_cell_ids = nullptr;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -203,6 +209,9 @@ _zone_define(const char  *name)
     else
       _n_zones_max *= 2;
     BFT_REALLOC(_zones, _n_zones_max, cs_zone_t *);
+    BFT_REALLOC(_zone_cell_ids, _n_zones_max, cs_lnum_t *);
+    for (int i = zone_id; i < _n_zones_max; i++)
+      _zone_cell_ids[i] = nullptr;
   }
 
   /* Allocate zones descriptor block if necessary
@@ -403,6 +412,10 @@ cs_boundary_zone_finalize(void)
   BFT_FREE(_zone_class_id);
   BFT_FREE(_zone_id);
 
+  for (int i = 0; i < _n_zones; i++)
+    CS_FREE_HD(_zone_cell_ids[i]);
+  BFT_FREE(_zone_cell_ids);
+
   for (int i = 0; i < _n_zones; i++) {
     if (i % _CS_ZONE_S_ALLOC_SIZE == 0)
       BFT_FREE(_zones[i]);
@@ -475,6 +488,8 @@ cs_boundary_zone_build_private(int  id)
 
   z->n_elts = cs_mesh_location_get_n_elts(z->location_id)[0];
   z->elt_ids = cs_mesh_location_get_elt_ids(z->location_id);
+
+  CS_FREE_HD(_zone_cell_ids[id]);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -504,6 +519,8 @@ cs_boundary_zone_build_all(bool  mesh_modified)
     }
     z->n_elts = cs_mesh_location_get_n_elts(z->location_id)[0];
     z->elt_ids = cs_mesh_location_get_elt_ids(z->location_id);
+    if (z->time_varying || mesh_modified)
+      CS_FREE_HD(_zone_cell_ids[i]);
   }
 
   /* Assign maximum zone id and check for overlap errors
@@ -847,6 +864,62 @@ cs_boundary_zone_face_zone_id(void)
   return (const int *)_zone_id;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return pointer to the ids of cells adjacent to a given zone's faces.
+ *
+ * For a face of rank i in the zone's element ids, the adjacent cell id
+ * is given at rank i of the returned array, so that zone-restricted loops
+ * may gather cell values contiguously, without indirection through the
+ * mesh's boundary face -> cell connectivity.
+ *
+ * The array is built on first call, using the default host/device
+ * allocation mode, and kept until the zone or mesh changes.
+ *
+ * \param[in]  id  zone id
+ *
+ * \return  pointer to adjacent cell ids, or nullptr if the zone is empty
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_boundary_zone_face_cell_ids(int  id)
+{
+  if (id < 0 || id >= _n_zones)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Boundary zone with id %d is not defined."), id);
+
+  const cs_zone_t *z = _zones[id];
+
+  if (_zone_cell_ids[id] == nullptr && z->n_elts > 0) {
+
+    const cs_lnum_t n_elts = z->n_elts;
+    const cs_lnum_t *elt_ids = z->elt_ids;
+    const cs_lnum_t *b_face_cells = cs_glob_mesh->b_face_cells;
+
+    cs_lnum_t *c_ids;
+    CS_MALLOC_HD(c_ids, n_elts, cs_lnum_t, cs_alloc_mode);
+
+    if (elt_ids != nullptr) {
+#     pragma omp parallel for if (n_elts > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_elts; i++)
+        c_ids[i] = b_face_cells[elt_ids[i]];
+    }
+    else {
+#     pragma omp parallel for if (n_elts > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_elts; i++)
+        c_ids[i] = b_face_cells[i];
+    }
+
+    cs_sync_h2d(c_ids);
+
+    _zone_cell_ids[id] = c_ids;
+
+  }
+
+  return _zone_cell_ids[id];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Print info relative to a given boundary zone to log file.
@@ -306,6 +306,25 @@ cs_boundary_zone_set_overlay(int   id,
 const int *
 cs_boundary_zone_face_zone_id(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return pointer to the ids of cells adjacent to a given zone's faces.
+ *
+ * For a face of rank i in the zone's element ids, the adjacent cell id
+ * is given at rank i of the returned array.
+ *
+ * The array is built on first call, using the default host/device
+ * allocation mode, and kept until the zone or mesh changes.
+ *
+ * \param[in]  id  zone id
+ *
+ * \return  pointer to adjacent cell ids, or nullptr if the zone is empty
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_boundary_zone_face_cell_ids(int  id);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Print info relative to a given boundary zone to log file.
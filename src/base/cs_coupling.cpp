@@ -532,9 +532,10 @@ cs_coupling_is_sync_active(void)
  *                                 element extents) to compute, or -1 to query
  * \param[in]       tolerance      addition to local extents of each element:
  *                                 extent = base_extent * (1 + tolerance)
- * \param[in, out]  extents        extents associated with mesh:
- *                                 x_min, y_min, ..., x_max, y_max, ...
- *                                 (size: 2*dim)
+ * \param[in, out]  extents        extents associated with mesh or mesh
+ *                                 subdivisions: x_min_0, y_min_0, ...,
+ *                                 x_max_i, y_max_i, ...
+ *                                 (size: 2*dim*n_max_extents)
  *
  * \return  the number of extents computed
  */
@@ -553,18 +554,27 @@ cs_coupling_mesh_extents(const void  *mesh,
     return 0;
 
   /* In query mode, return maximum extents available
-     (currently limited to 1) */
+     (at most one per element) */
 
-  if (n_max_extents < 0)
-    retval = 1;
+  if (n_max_extents < 0) {
+    int max_dim = fvm_nodal_get_max_entity_dim(m);
+    retval = fvm_nodal_get_n_entities(m, max_dim);
+    if (retval < 1)
+      retval = 1;
+  }
 
-  /* If n_max_extents > 0 return global mesh extents */
+  /* If n_max_extents == 1 return global mesh extents */
 
-  else if (n_max_extents > 0) {
+  else if (n_max_extents == 1) {
     fvm_nodal_extents(m, tolerance, extents);
     retval = 1;
   }
 
+  /* Otherwise, return extents of mesh subdivisions */
+
+  else if (n_max_extents > 1)
+    retval = fvm_nodal_sub_extents(m, tolerance, n_max_extents, extents);
+
   return retval;
 }
 
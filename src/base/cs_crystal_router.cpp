@@ -686,6 +686,41 @@ _dump(const cs_crystal_router_t  *cr,
 
 #endif /* _dump functions for debugging */
 
+/*----------------------------------------------------------------------------
+ * Ensure a crystal router buffer is large enough for a given size.
+ *
+ * Buffers are only grown during an exchange, so that they are reused
+ * (with no reallocation or copy) from one stage to the next.
+ *
+ * parameters:
+ *   cr        <-> associated crystal router structure
+ *   buf_id    <-- buffer id (0 or 1)
+ *   min_size  <-- required buffer size
+ *---------------------------------------------------------------------------*/
+
+static void
+_crystal_reserve(cs_crystal_router_t  *cr,
+                 int                   buf_id,
+                 size_t                min_size)
+{
+  if (min_size <= cr->buffer_size[buf_id])
+    return;
+
+  /* Grow with some margin, to avoid a reallocation at each stage */
+
+  size_t new_size = cr->buffer_size[buf_id] + cr->buffer_size[buf_id]/4;
+  if (new_size < min_size)
+    new_size = min_size;
+
+  cr->buffer_size[buf_id] = new_size;
+  BFT_REALLOC(cr->buffer[buf_id], cr->buffer_size[buf_id], unsigned char);
+  if (cr->buffer_size[buf_id] > cr->buffer_size_max[buf_id])
+    cr->buffer_size_max[buf_id] = cr->buffer_size[buf_id];
+  size_t alloc_tot = cr->buffer_size[0] + cr->buffer_size[1];
+  if (alloc_tot > cr->alloc_tot_max)
+    cr->alloc_tot_max = alloc_tot;
+}
+
 /*----------------------------------------------------------------------------
  * Partition strided data for exchange with a crystal router.
  *
@@ -711,17 +746,17 @@ _crystal_partition_strided(cs_crystal_router_t  *cr,
 
   assert(send_id == 0 || send_id == 1);
 
-  if (   cr->buffer_size[1] < cr->buffer_size[0]
-      || cr->buffer_size[1] > cr->buffer_size[0]*_realloc_f_threshold) {
-    cr->buffer_size[1] = cr->buffer_size[0];
-    BFT_REALLOC(cr->buffer[1], cr->buffer_size[1], unsigned char);
-    if (cr->buffer_size[1] > cr->buffer_size_max[1])
-      cr->buffer_size_max[1] = cr->buffer_size[1];
-    size_t alloc_tot = cr->buffer_size[0] + cr->buffer_size[1];
-    if (alloc_tot > cr->alloc_tot_max)
-      cr->alloc_tot_max = alloc_tot;
+  /* Count elements to move to buffer 1, so as to size it exactly */
+
+  cs_lnum_t n_b1 = 0;
+  for (i = 0; i < n; i++) {
+    const int *r = (const int *)(cr->buffer[0] + i*comp_size);
+    if ((r[0] < cutoff) == (id0 == 1))
+      n_b1++;
   }
 
+  _crystal_reserve(cr, 1, n_b1*comp_size);
+
   if (id0 == 0) {
     for (i = 0; i < n; i++) {
       unsigned char *src = cr->buffer[0] + i*comp_size;
@@ -845,13 +880,7 @@ _crystal_partition_indexed(cs_crystal_router_t  *cr,
     src += sub_size;
   }
 
-  cr->buffer_size[1] = (id0 == 0) ? r1_end : r0_end;
-  BFT_REALLOC(cr->buffer[1], cr->buffer_size[1], unsigned char);
-  if (cr->buffer_size[1] > cr->buffer_size_max[1])
-    cr->buffer_size_max[1] = cr->buffer_size[1];
-  size_t alloc_tot = cr->buffer_size[0] + cr->buffer_size[1];
-  if (alloc_tot > cr->alloc_tot_max)
-    cr->alloc_tot_max = alloc_tot;
+  _crystal_reserve(cr, 1, (id0 == 0) ? r1_end : r0_end);
 
   i = i_start;
   src = src_start;
@@ -908,8 +937,11 @@ _crystal_sendrecv(cs_crystal_router_t  *cr,
   cs_lnum_t send_size[2];
   uint64_t test_size;
 
-  MPI_Status status[3];
-  MPI_Request request[3] = {MPI_REQUEST_NULL,
+  MPI_Status status[6];
+  MPI_Request request[6] = {MPI_REQUEST_NULL,
+                            MPI_REQUEST_NULL,
+                            MPI_REQUEST_NULL,
+                            MPI_REQUEST_NULL,
                             MPI_REQUEST_NULL,
                             MPI_REQUEST_NULL};
   cs_lnum_t recv_size[4] = {0, 0, 0, 0};
@@ -927,31 +959,27 @@ _crystal_sendrecv(cs_crystal_router_t  *cr,
               "  Message to send would have size too large for C int: %llu",
               (unsigned long long)test_size);
 
+  /* The data is sent right after its size, so that it is already in
+     transit while the receiving buffer is sized (messages with the same
+     source and tag are matched in order, so the size is received first) */
+
   MPI_Isend(&send_size, 2, CS_MPI_LNUM, target, cr->rank_id,
             cr->comm, &request[0]);
 
+  MPI_Isend(cr->buffer[1], send_size[1], cr->mpi_type,
+            target, cr->rank_id, cr->comm, &request[1]);
+
   for (int i = 0; i < n_recv; i++)
     MPI_Irecv(recv_size+i*2, 2, CS_MPI_LNUM, target+i, target+i,
-              cr->comm, request+i+1);
+              cr->comm, request+i+2);
 
-  MPI_Waitall(n_recv + 1, request, status);
+  MPI_Waitall(n_recv, request + 2, status + 2);
 
   size_t loc_size = _data_size(cr, cr->n_elts[0], cr->n_vals[0]);
   for (int i = 0; i < n_recv; i++)
     loc_size += _data_size(cr, recv_size[i*2], recv_size[i*2+1]);
-  if (   loc_size > cr->buffer_size[0]
-      || loc_size < cr->buffer_size[0]*_realloc_f_threshold) {
-    cr->buffer_size[0] = loc_size;
-    BFT_REALLOC(cr->buffer[0], cr->buffer_size[0], unsigned char);
-    if (cr->buffer_size[0] > cr->buffer_size_max[0])
-      cr->buffer_size_max[0] = cr->buffer_size[0];
-    size_t alloc_tot = cr->buffer_size[0] + cr->buffer_size[1];
-    if (alloc_tot > cr->alloc_tot_max)
-      cr->alloc_tot_max = alloc_tot;
-  }
 
-  MPI_Isend(cr->buffer[1], send_size[1], cr->mpi_type,
-            target, cr->rank_id, cr->comm, request);
+  _crystal_reserve(cr, 0, loc_size);
 
   cr->n_elts[1] = 0;
 
@@ -961,7 +989,7 @@ _crystal_sendrecv(cs_crystal_router_t  *cr,
                            + _data_size(cr, cr->n_elts[0], cr->n_vals[0]);
 
     MPI_Irecv(r_ptr, recv_size[i*2 + 1], cr->mpi_type,
-              target+i, target+i, cr->comm, request+1+i);
+              target+i, target+i, cr->comm, request+4+i);
 
     cr->n_elts[0] += recv_size[i*2];
     cr->n_vals[0] += _comm_type_count_to_n_vals(cr,
@@ -970,7 +998,7 @@ _crystal_sendrecv(cs_crystal_router_t  *cr,
 
   }
 
-  MPI_Waitall(n_recv+1, request, status);
+  MPI_Waitall(6, request, status);
 
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_cr_timers + 1, &t0, &t1);
@@ -1909,6 +1937,15 @@ cs_crystal_router_exchange(cs_crystal_router_t  *cr)
   cr->buffer_size[1] = 0;
   BFT_FREE(cr->buffer[1]);
 
+  /* Buffers are only grown during the exchange stages; trim the received
+     data buffer if it is significantly larger than needed. */
+
+  size_t data_size = _data_size(cr, cr->n_elts[0], cr->n_vals[0]);
+  if (data_size < cr->buffer_size[0]*_realloc_f_threshold) {
+    cr->buffer_size[0] = data_size;
+    BFT_REALLOC(cr->buffer[0], cr->buffer_size[0], unsigned char);
+  }
+
   cs_timer_t t1 = cs_timer_time();
   cs_timer_counter_add_diff(_cr_timers, &t0, &t1);
 }
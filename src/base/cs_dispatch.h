@@ -37,6 +37,7 @@
  * Standard C++ library headers
  *----------------------------------------------------------------------------*/
 
+#include <cmath>
 #include <utility>
 
 #if defined(SYCL_LANGUAGE_VERSION)
@@ -50,8 +51,11 @@
 #include "cs_assert.h"
 #include "cs_mesh.h"
 
-#ifdef __NVCC__
+#if defined(HAVE_CUDA)
 #include "cs_base_cuda.h"
+#endif
+
+#ifdef __NVCC__
 #include "cs_blas_cuda.h"
 #include "cs_alge_cuda.cuh"
 #endif
@@ -85,6 +89,85 @@ typedef enum {
 
 } cs_dispatch_sum_type_t;
 
+/*! Captured sequence of device kernel launches (CUDA graph), which may be
+  replayed instead of relaunching the kernels as long as their arguments
+  are unchanged. */
+
+typedef struct {
+
+  unsigned long long  key;   /*!< key identifying launch arguments */
+  void               *exec;  /*!< instantiated executable graph
+                                  (cudaGraphExec_t), or nullptr */
+
+} cs_dispatch_graph_t;
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the bytes of a value to a graph key (FNV-1a hash).
+ *
+ * \param[in, out]  h     key to update
+ * \param[in]       v     pointer to value
+ * \param[in]       size  size of value, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+cs_dispatch_graph_key_add(unsigned long long  &h,
+                          const void          *v,
+                          size_t               size)
+{
+  const unsigned char *b = (const unsigned char *)v;
+  for (size_t i = 0; i < size; i++) {
+    h ^= b[i];
+    h *= 1099511628211ULL;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build a key identifying the launch arguments of a graph.
+ *
+ * Arguments should be scalars or pointers (usually the arrays and sizes
+ * used by the captured kernels, and any setting changing the captured
+ * launch sequence).
+ *
+ * \param[in]  args  values identifying the captured sequence
+ *
+ * \return  associated key
+ */
+/*----------------------------------------------------------------------------*/
+
+template <class... Args>
+static inline unsigned long long
+cs_dispatch_graph_key(const Args&...  args)
+{
+  unsigned long long h = 14695981039346656037ULL;
+  [[maybe_unused]] decltype(nullptr) add_arg[] = {
+    (cs_dispatch_graph_key_add(h, &args, sizeof(Args)), nullptr)...
+  };
+  return h;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free a captured graph.
+ *
+ * \param[in, out]  g  graph to free
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+cs_dispatch_graph_destroy(cs_dispatch_graph_t  &g)
+{
+#if defined(HAVE_CUDA)
+  if (g.exec != nullptr)
+    cs_cuda_graph_exec_destroy(g.exec);
+#endif
+
+  g.key = 0;
+  g.exec = nullptr;
+}
+
 /*!
  * Provide default implementations of a cs_context based on parallel_for
  * function. This class is a mixin that use CRTP (Curiously Recurring
@@ -122,6 +205,20 @@ public:
   parallel_for_reduce_sum
     (cs_lnum_t n, double& sum, F&& f, Args&&... args) = delete;
 
+  // Parallel minimum of values returned by f(i, args...).
+  // Must be redefined by the child class
+  template <class F, class... Args>
+  decltype(auto)
+  parallel_for_reduce_min
+    (cs_lnum_t n, double& min, F&& f, Args&&... args) = delete;
+
+  // Parallel maximum of values returned by f(i, args...).
+  // Must be redefined by the child class
+  template <class F, class... Args>
+  decltype(auto)
+  parallel_for_reduce_max
+    (cs_lnum_t n, double& max, F&& f, Args&&... args) = delete;
+
   // Query sum type for assembly loop over all interior faces
   // Must be redefined by the child class
   bool
@@ -273,6 +370,40 @@ public:
     return true;
   }
 
+  //! Plain OpenMP parallel minimum of values returned by the functor.
+  template <class F, class... Args>
+  bool
+  parallel_for_reduce_min(cs_lnum_t n,
+                          double&   min,
+                          F&&       f,
+                          Args&&... args) {
+    min = HUGE_VAL;
+#   pragma omp parallel for reduction(min:min) if (n >= n_min_for_threads)
+    for (cs_lnum_t i = 0; i < n; ++i) {
+      double v = f(i, args...);
+      if (v < min)
+        min = v;
+    }
+    return true;
+  }
+
+  //! Plain OpenMP parallel maximum of values returned by the functor.
+  template <class F, class... Args>
+  bool
+  parallel_for_reduce_max(cs_lnum_t n,
+                          double&   max,
+                          F&&       f,
+                          Args&&... args) {
+    max = -HUGE_VAL;
+#   pragma omp parallel for reduction(max:max) if (n >= n_min_for_threads)
+    for (cs_lnum_t i = 0; i < n; ++i) {
+      double v = f(i, args...);
+      if (v > max)
+        max = v;
+    }
+    return true;
+  }
+
   // Get interior faces sum type associated with this context
   bool
   try_get_parallel_for_i_faces_sum_type([[maybe_unused]]const cs_mesh_t*  m,
@@ -349,6 +480,75 @@ cs_cuda_kernel_parallel_for_reduce_sum(cs_lnum_t   n,
   }
 }
 
+/* Kernel computing the minimum or maximum of values returned by a
+   device functor over an integer range, with one result per block.
+   Block results may then be reduced by
+   cs_cuda_kernel_reduce_min_max_single_block.
+   All arguments *must* be passed by value to avoid passing CPU references
+   to the GPU. */
+
+template <bool is_max, class F, class... Args>
+__global__ void
+cs_cuda_kernel_parallel_for_reduce_min_max(cs_lnum_t   n,
+                                           double     *b_res,
+                                           F           f,
+                                           Args...     args) {
+  extern double __shared__ stmp[];
+  const cs_lnum_t tid = threadIdx.x;
+
+  double r = (is_max) ? -HUGE_VAL : HUGE_VAL;
+
+  // grid_size-stride loop
+  for (cs_lnum_t id = blockIdx.x * blockDim.x + threadIdx.x; id < n;
+       id += blockDim.x * gridDim.x) {
+    double v = f(id, args...);
+    r = (is_max) ? fmax(r, v) : fmin(r, v);
+  }
+
+  stmp[tid] = r;
+  __syncthreads();
+
+  for (unsigned int s = blockDim.x/2; s > 0; s >>= 1) {
+    if (tid < s)
+      stmp[tid] = (is_max) ? fmax(stmp[tid], stmp[tid + s])
+                           : fmin(stmp[tid], stmp[tid + s]);
+    __syncthreads();
+  }
+
+  if (tid == 0)
+    b_res[blockIdx.x] = stmp[0];
+}
+
+/* Kernel reducing per-block minima or maxima to a single value,
+   using a single block. */
+
+template <bool is_max>
+__global__ void
+cs_cuda_kernel_reduce_min_max_single_block(cs_lnum_t      n,
+                                           const double  *g_res,
+                                           double        *res) {
+  extern double __shared__ stmp[];
+  const cs_lnum_t tid = threadIdx.x;
+
+  double r = (is_max) ? -HUGE_VAL : HUGE_VAL;
+
+  for (cs_lnum_t id = tid; id < n; id += blockDim.x)
+    r = (is_max) ? fmax(r, g_res[id]) : fmin(r, g_res[id]);
+
+  stmp[tid] = r;
+  __syncthreads();
+
+  for (unsigned int s = blockDim.x/2; s > 0; s >>= 1) {
+    if (tid < s)
+      stmp[tid] = (is_max) ? fmax(stmp[tid], stmp[tid + s])
+                           : fmin(stmp[tid], stmp[tid + s]);
+    __syncthreads();
+  }
+
+  if (tid == 0)
+    res[0] = stmp[0];
+}
+
 /*!
  * Context to execute loops with CUDA on the device
  */
@@ -365,6 +565,7 @@ private:
   int           device_;      /*!< Associated CUDA device id */
 
   bool          use_gpu_;     /*!< Run on GPU if available */
+  bool          capture_;     /*!< Are launches being captured ? */
 
 public:
 
@@ -372,7 +573,7 @@ public:
 
   cs_device_context(void)
     : grid_size_(0), block_size_(256), stream_(cs_cuda_get_stream(0)),
-      device_(0), use_gpu_(true)
+      device_(0), use_gpu_(true), capture_(false)
   {
     device_ = cs_base_cuda_get_device();
   }
@@ -382,14 +583,14 @@ public:
                     cudaStream_t  stream,
                     int           device)
     : grid_size_(grid_size), block_size_(block_size), stream_(stream),
-      device_(device), use_gpu_(true)
+      device_(device), use_gpu_(true), capture_(false)
   {}
 
   cs_device_context(long          grid_size,
                     long          block_size,
                     cudaStream_t  stream)
     : grid_size_(grid_size), block_size_(block_size), stream_(stream),
-      device_(0), use_gpu_(true)
+      device_(0), use_gpu_(true), capture_(false)
   {
     device_ = cs_base_cuda_get_device();
   }
@@ -397,14 +598,15 @@ public:
   cs_device_context(long  grid_size,
                     long  block_size)
     : grid_size_(grid_size), block_size_(block_size),
-       stream_(cs_cuda_get_stream(0)), device_(0), use_gpu_(true)
+       stream_(cs_cuda_get_stream(0)), device_(0), use_gpu_(true),
+       capture_(false)
   {
     device_ = cs_base_cuda_get_device();
   }
 
   cs_device_context(cudaStream_t  stream)
     : grid_size_(0), block_size_(256), stream_(stream), device_(0),
-      use_gpu_(true)
+      use_gpu_(true), capture_(false)
   {
     device_ = cs_base_cuda_get_device();
   }
@@ -550,6 +752,8 @@ public:
     cs_blas_cuda_get_2_stage_reduce_buffers
       (n, 1, l_grid_size, r_grid_, r_reduce_);
 
+    assert(capture_ == false);  /* reductions synchronize the stream */
+
     int smem_size = block_size_ * sizeof(double);
     cs_cuda_kernel_parallel_for_reduce_sum
       <<<l_grid_size, block_size_, smem_size, stream_>>>
@@ -586,13 +790,159 @@ public:
     return true;
   }
 
-  //! Synchronize associated stream
+  //! Launch kernel on the GPU with minimum or maximum reduction
+  //! of values returned by the functor.
+  //! The reduction involves an implicit wait().
+  template <bool is_max, class F, class... Args>
+  bool
+  parallel_for_reduce_min_max(cs_lnum_t n,
+                              double&   res,
+                              F&&       f,
+                              Args&&... args) {
+    res = (is_max) ? -HUGE_VAL : HUGE_VAL;
+    if (device_ < 0 || use_gpu_ == false) {
+      return false;
+    }
+
+    long l_grid_size = grid_size_;
+    if (l_grid_size < 1) {
+      l_grid_size = (n % block_size_) ? n/block_size_ + 1 : n/block_size_;
+    }
+    if (n == 0) {
+      return true;
+    }
+
+    double *r_grid_, *r_reduce_;
+    cs_blas_cuda_get_2_stage_reduce_buffers
+      (n, 1, l_grid_size, r_grid_, r_reduce_);
+
+    assert(capture_ == false);  /* reductions synchronize the stream */
+
+    int smem_size = block_size_ * sizeof(double);
+    cs_cuda_kernel_parallel_for_reduce_min_max<is_max>
+      <<<l_grid_size, block_size_, smem_size, stream_>>>
+      (n, r_grid_, static_cast<F&&>(f), static_cast<Args&&>(args)...);
+
+    cs_cuda_kernel_reduce_min_max_single_block<is_max>
+      <<<1, block_size_, smem_size, stream_>>>
+      (l_grid_size, r_grid_, r_reduce_);
+
+    cudaStreamSynchronize(stream_);
+    res = r_reduce_[0];
+
+    return true;
+  }
+
+  //! Launch kernel on the GPU with minimum reduction.
+  //! The reduction involves an implicit wait().
+  template <class F, class... Args>
+  bool
+  parallel_for_reduce_min(cs_lnum_t n,
+                          double&   min,
+                          F&&       f,
+                          Args&&... args) {
+    return parallel_for_reduce_min_max<false>
+             (n, min, static_cast<F&&>(f), static_cast<Args&&>(args)...);
+  }
+
+  //! Launch kernel on the GPU with maximum reduction.
+  //! The reduction involves an implicit wait().
+  template <class F, class... Args>
+  bool
+  parallel_for_reduce_max(cs_lnum_t n,
+                          double&   max,
+                          F&&       f,
+                          Args&&... args) {
+    return parallel_for_reduce_min_max<true>
+             (n, max, static_cast<F&&>(f), static_cast<Args&&>(args)...);
+  }
+
+  //! Synchronize associated stream (ignored during graph capture)
   void
   wait(void) {
-    if (device_ > -1 && use_gpu_)
+    if (device_ > -1 && use_gpu_ && capture_ == false)
       cudaStreamSynchronize(stream_);
   }
 
+  //! Replay a captured graph if it matches the given key.
+  //! Return true if the graph was launched.
+  bool
+  graph_replay(cs_dispatch_graph_t  &g,
+               unsigned long long    key) {
+    if (   device_ < 0 || use_gpu_ == false || cs_glob_cuda_allow_graph == false
+        || g.exec == nullptr || g.key != key)
+      return false;
+
+    cudaGraphLaunch((cudaGraphExec_t)g.exec, stream_);
+    return true;
+  }
+
+  //! Start capturing kernel launches on the associated stream.
+  //! Launches are not executed until graph_capture_end is called;
+  //! reductions and host/device synchronizations are not allowed
+  //! in between. Return false (so that launches are executed directly)
+  //! if capture is not possible.
+  bool
+  graph_capture_begin(void) {
+    if (device_ < 0 || use_gpu_ == false || cs_glob_cuda_allow_graph == false)
+      return false;
+
+    if (cudaStreamBeginCapture(stream_, cudaStreamCaptureModeThreadLocal)
+        != cudaSuccess)
+      return false;
+
+    capture_ = true;
+    return true;
+  }
+
+  //! End capture, update or instantiate the given graph, and launch it.
+  void
+  graph_capture_end(cs_dispatch_graph_t  &g,
+                    unsigned long long    key) {
+    if (capture_ == false)
+      return;
+    capture_ = false;
+
+    cudaGraph_t graph;
+    CS_CUDA_CHECK(cudaStreamEndCapture(stream_, &graph));
+
+    /* Try updating an existing executable graph first, which is much
+       cheaper than instantiating a new one if only arguments changed */
+
+    cudaGraphExec_t exec = (cudaGraphExec_t)g.exec;
+
+    if (exec != nullptr) {
+#if (CUDART_VERSION >= 12000)
+      cudaGraphExecUpdateResultInfo info;
+      if (cudaGraphExecUpdate(exec, graph, &info) != cudaSuccess) {
+#else
+      cudaGraphNode_t e_node;
+      cudaGraphExecUpdateResult e_result;
+      if (cudaGraphExecUpdate(exec, graph, &e_node, &e_result)
+          != cudaSuccess) {
+#endif
+        cudaGetLastError();  /* reset error state */
+        cudaGraphExecDestroy(exec);
+        exec = nullptr;
+      }
+    }
+
+    if (exec == nullptr) {
+#if (CUDART_VERSION >= 12000)
+      CS_CUDA_CHECK(cudaGraphInstantiate(&exec, graph, 0));
+#else
+      CS_CUDA_CHECK(cudaGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+#endif
+    }
+
+    cudaGraphDestroy(graph);
+
+    g.key = key;
+    g.exec = exec;
+
+    cudaGraphLaunch(exec, stream_);
+  }
+
   // Get interior faces sum type associated with this context
   bool
   try_get_parallel_for_i_faces_sum_type(const cs_mesh_t         *m,
@@ -703,6 +1053,20 @@ public:
     return true;
   }
 
+  //! Try to launch on the GPU and return false if not available
+  template <class F, class... Args>
+  bool
+  parallel_for_b_faces(const cs_mesh_t* m, F&& f, Args&&... args) {
+    const cs_lnum_t n = m->n_b_faces;
+    if (is_gpu == false || use_gpu_ == false) {
+      return false;
+    }
+
+    queue_.parallel_for(n, static_cast<F&&>(f), static_cast<Args&&>(args)...);
+
+    return true;
+  }
+
   //! Launch kernel with simple sum reduction.
   template <class F, class... Args>
   bool
@@ -715,9 +1079,14 @@ public:
       return false;
     }
 
-    // TODO: use persistent allocation as we do in CUDA BLAS to avoid
-    //       excess allocation/deallocation.
-    double *sum_ptr = (double *)sycl::malloc_shared(sizeof(double), queue_);
+    // Use persistent allocation as we do in CUDA BLAS to avoid
+    // excess allocation/deallocation.
+    static double *sum_ptr = nullptr;
+    if (sum_ptr == nullptr)
+      sum_ptr = (double *)sycl::malloc_shared(sizeof(double), queue_);
+
+    // The reduction combines with the initial value.
+    sum_ptr[0] = 0.;
 
     queue_.parallel_for(n,
                         sycl::reduction(sum_ptr, 0., sycl::plus<double>()),
@@ -726,7 +1095,65 @@ public:
 
     sum_ = sum_ptr[0];
 
-    sycl::free((void *)sum_ptr, queue_);
+    return true;
+  }
+
+  //! Launch kernel with minimum reduction of values returned by f.
+  template <class F, class... Args>
+  bool
+  parallel_for_reduce_min(cs_lnum_t n,
+                          double&   min_,
+                          F&&       f,
+                          Args&&... args) {
+    min_ = HUGE_VAL;
+    if (is_gpu == false || use_gpu_ == false) {
+      return false;
+    }
+
+    static double *min_ptr = nullptr;
+    if (min_ptr == nullptr)
+      min_ptr = (double *)sycl::malloc_shared(sizeof(double), queue_);
+
+    min_ptr[0] = HUGE_VAL;
+
+    queue_.parallel_for(n,
+                        sycl::reduction(min_ptr, HUGE_VAL,
+                                        sycl::minimum<double>()),
+                        [=](sycl::id<1> i, auto &r) {
+                          r.combine(f(cs_lnum_t(i[0]), args...));
+                        }).wait();
+
+    min_ = min_ptr[0];
+
+    return true;
+  }
+
+  //! Launch kernel with maximum reduction of values returned by f.
+  template <class F, class... Args>
+  bool
+  parallel_for_reduce_max(cs_lnum_t n,
+                          double&   max_,
+                          F&&       f,
+                          Args&&... args) {
+    max_ = -HUGE_VAL;
+    if (is_gpu == false || use_gpu_ == false) {
+      return false;
+    }
+
+    static double *max_ptr = nullptr;
+    if (max_ptr == nullptr)
+      max_ptr = (double *)sycl::malloc_shared(sizeof(double), queue_);
+
+    max_ptr[0] = -HUGE_VAL;
+
+    queue_.parallel_for(n,
+                        sycl::reduction(max_ptr, -HUGE_VAL,
+                                        sycl::maximum<double>()),
+                        [=](sycl::id<1> i, auto &r) {
+                          r.combine(f(cs_lnum_t(i[0]), args...));
+                        }).wait();
+
+    max_ = max_ptr[0];
 
     return true;
   }
@@ -801,6 +1228,25 @@ public:
   set_cuda_device([[maybe_unused]] int  device_id) {
   }
 
+  /* Fill-in for graph capture methods; launches are never captured,
+     so are executed directly. */
+
+  bool
+  graph_replay([[maybe_unused]] cs_dispatch_graph_t  &g,
+               [[maybe_unused]] unsigned long long    key) {
+    return false;
+  }
+
+  bool
+  graph_capture_begin(void) {
+    return false;
+  }
+
+  void
+  graph_capture_end([[maybe_unused]] cs_dispatch_graph_t  &g,
+                    [[maybe_unused]] unsigned long long    key) {
+  }
+
 #endif  // __NVCC__
 
 #if !defined(__NVCC__) && !defined(SYCL_LANGUAGE_VERSION)
@@ -857,6 +1303,26 @@ public:
     return false;
   }
 
+  // Abort execution if no execution method is available.
+  template <class F, class... Args>
+  bool parallel_for_reduce_min([[maybe_unused]] cs_lnum_t  n,
+                               [[maybe_unused]] double&    min,
+                               [[maybe_unused]] F&&        f,
+                               [[maybe_unused]] Args&&...  args) {
+    cs_assert(0);
+    return false;
+  }
+
+  // Abort execution if no execution method is available.
+  template <class F, class... Args>
+  bool parallel_for_reduce_max([[maybe_unused]] cs_lnum_t  n,
+                               [[maybe_unused]] double&    max,
+                               [[maybe_unused]] F&&        f,
+                               [[maybe_unused]] Args&&...  args) {
+    cs_assert(0);
+    return false;
+  }
+
 };
 
 /*!
@@ -918,6 +1384,28 @@ public:
     };
   }
 
+  template <class F, class... Args>
+  auto parallel_for_reduce_min
+    (cs_lnum_t n, double& min, F&& f, Args&&... args) {
+    bool launched = false;
+    [[maybe_unused]] decltype(nullptr) try_execute[] = {
+      (   launched = launched
+       || Contexts::parallel_for_reduce_min(n, min, f, args...),
+          nullptr)...
+    };
+  }
+
+  template <class F, class... Args>
+  auto parallel_for_reduce_max
+    (cs_lnum_t n, double& max, F&& f, Args&&... args) {
+    bool launched = false;
+    [[maybe_unused]] decltype(nullptr) try_execute[] = {
+      (   launched = launched
+       || Contexts::parallel_for_reduce_max(n, max, f, args...),
+          nullptr)...
+    };
+  }
+
   cs_dispatch_sum_type_t
   get_parallel_for_i_faces_sum_type(const cs_mesh_t* m) {
     cs_dispatch_sum_type_t sum_type = CS_DISPATCH_SUM_ATOMIC;
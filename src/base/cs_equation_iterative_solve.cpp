@@ -67,6 +67,7 @@
 #include "cs_gradient.h"
 #include "cs_mesh_quantities.h"
 #include "cs_parameters.h"
+#include "cs_perf_summary.h"
 #include "cs_porous_model.h"
 #include "cs_prototypes.h"
 #include "cs_timer.h"
@@ -84,10 +85,107 @@
 
 /*----------------------------------------------------------------------------*/
 
+/*============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Persistent work arrays, reused from one solve to the next */
+
+typedef enum {
+
+  _WS_DAM,
+  _WS_XAM,
+  _WS_SMBINI,
+  _WS_DPVAR,
+  _WS_ADXK,
+  _WS_ADXKM1,
+  _WS_DPVARM1,
+  _WS_RHS0,
+  _WS_W1,
+  _WS_W2,
+
+  _WS_N_ARRAYS
+
+} _workspace_id_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static unsigned char    *_ws_ptr[_WS_N_ARRAYS];
+static size_t            _ws_size[_WS_N_ARRAYS];
+static cs_alloc_mode_t   _ws_mode[_WS_N_ARRAYS];
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Return a persistent work array of at least a given size.
+ *
+ * The array is reallocated only if it is too small or if the allocation
+ * mode changes, so that the allocations are done at the first time step
+ * (or after a mesh modification) only. Contents are not preserved.
+ *
+ * parameters:
+ *   ws_id   <-- work array id
+ *   n_elts  <-- number of elements
+ *   size    <-- element size
+ *   amode   <-- allocation mode
+ *
+ * returns:
+ *   pointer to work array
+ *----------------------------------------------------------------------------*/
+
+static void *
+_workspace(_workspace_id_t   ws_id,
+           cs_lnum_t         n_elts,
+           size_t            size,
+           cs_alloc_mode_t   amode)
+{
+  size_t n_bytes = (size_t)n_elts * size;
+
+  if (_ws_size[ws_id] < n_bytes || _ws_mode[ws_id] != amode) {
+    CS_FREE_HD(_ws_ptr[ws_id]);
+    CS_MALLOC_HD(_ws_ptr[ws_id], n_bytes, unsigned char, amode);
+    _ws_size[ws_id] = n_bytes;
+    _ws_mode[ws_id] = amode;
+  }
+
+  return _ws_ptr[ws_id];
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether the increment of a reconstruction sweep is small enough
+ * for the right-hand side not to be reconstructed again.
+ *
+ * parameters:
+ *   n        <-- number of values
+ *   epsinc   <-- relative precision on the increment
+ *   dx_scale <-- scaling factor applied to the increment
+ *   dpvar    <-- increment
+ *   pvar     <-- variable
+ *
+ * returns:
+ *   true if ||dx_scale.dpvar|| <= epsinc.||pvar||, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_sweep_increment_is_small(cs_lnum_t         n,
+                          double            epsinc,
+                          cs_real_t         dx_scale,
+                          const cs_real_t  *dpvar,
+                          const cs_real_t  *pvar)
+{
+  if (epsinc <= 0.)
+    return false;
+
+  double s[2] = {cs_dot_xx(n, dpvar), cs_dot_xx(n, pvar)};
+  cs_parall_sum(2, CS_DOUBLE, s);
+
+  return (cs_math_fabs(dx_scale)*sqrt(s[0]) <= epsinc*sqrt(s[1]));
+}
+
 #ifdef __cplusplus
 
 /*----------------------------------------------------------------------------*/
@@ -285,18 +383,20 @@ _equation_iterative_solve_strided(int                   idtvar,
   cs_alloc_mode_t amode = ctx.alloc_mode(true);
 
   /* Allocate temporary arrays */
-  m_t *dam;
-  var_t *smbini, *dpvar;
-  CS_MALLOC_HD(dam, n_cells_ext, m_t, amode);
-  CS_MALLOC_HD(smbini, n_cells_ext, var_t, amode);
-  CS_MALLOC_HD(dpvar, n_cells_ext, var_t, amode);
+  m_t *dam
+    = (m_t *)_workspace(_WS_DAM, n_cells_ext, sizeof(m_t), amode);
+  var_t *smbini
+    = (var_t *)_workspace(_WS_SMBINI, n_cells_ext, sizeof(var_t), amode);
+  var_t *dpvar
+    = (var_t *)_workspace(_WS_DPVAR, n_cells_ext, sizeof(var_t), amode);
 
   var_t *adxk = nullptr, *adxkm1 = nullptr, *dpvarm1 = nullptr, *rhs0 = nullptr;
   if (iswdyp >= 1) {
-   CS_MALLOC_HD(adxk, n_cells_ext, var_t, amode);
-   CS_MALLOC_HD(adxkm1, n_cells_ext, var_t, amode);
-   CS_MALLOC_HD(dpvarm1, n_cells_ext, var_t, amode);
-   CS_MALLOC_HD(rhs0, n_cells_ext, var_t, amode);
+    const size_t v_size = sizeof(var_t);
+    adxk = (var_t *)_workspace(_WS_ADXK, n_cells_ext, v_size, amode);
+    adxkm1 = (var_t *)_workspace(_WS_ADXKM1, n_cells_ext, v_size, amode);
+    dpvarm1 = (var_t *)_workspace(_WS_DPVARM1, n_cells_ext, v_size, amode);
+    rhs0 = (var_t *)_workspace(_WS_RHS0, n_cells_ext, v_size, amode);
   }
 
   var_t *i_pvar = nullptr;
@@ -347,8 +447,10 @@ _equation_iterative_solve_strided(int                   idtvar,
   /*  be careful here, xam is interleaved*/
 
   cs_lnum_t eb_stride = eb_size*eb_size;
-  cs_real_t *xam;
-  CS_MALLOC_HD(xam, eb_stride*isym*n_faces, cs_real_t, amode);
+  cs_real_t *xam = (cs_real_t *)_workspace(_WS_XAM,
+                                           eb_stride*isym*n_faces,
+                                           sizeof(cs_real_t),
+                                           amode);
 
   /*==========================================================================
    * Building of the "simplified" matrix
@@ -359,6 +461,8 @@ _equation_iterative_solve_strided(int                   idtvar,
   if (idftnp & CS_ANISOTROPIC_LEFT_DIFFUSION)
     tensorial_diffusion = 2;
 
+  cs_timer_t t_mb0 = cs_timer_time();
+
   if (stride == 3)
     cs_matrix_wrapper_vector(iconvp,
                              idiffp,
@@ -391,6 +495,10 @@ _equation_iterative_solve_strided(int                   idtvar,
                              (cs_real_66_t *)dam,
                              xam);
 
+  cs_timer_t t_mb1 = cs_timer_time();
+  cs_perf_summary_add_diff(var_name, CS_PERF_SUMMARY_MATRIX_BUILD,
+                           &t_mb0, &t_mb1);
+
   /* Precaution if diagonal is 0, which may happen is all surrounding cells
    * are disabled
    * If a whole line of the matrix is 0, the diagonal is set to 1 */
@@ -584,9 +692,15 @@ _equation_iterative_solve_strided(int                   idtvar,
     }
   }
 
-  /* Dynamic relaxation*/
+  /* Dynamic relaxation; the right hand side residual is computed
+     in the same pass */
+
+  double residu2 = 0.;
+
   if (iswdyp >= 1) {
-    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    ctx.parallel_for_reduce_sum
+      (n_cells, residu2, [=] CS_F_HOST_DEVICE
+       (cs_lnum_t c_id, CS_DISPATCH_SUM_DOUBLE &sum) {
       for (cs_lnum_t isou = 0; isou < stride; isou++) {
         rhs0[c_id][isou] = smbrp[c_id][isou];
 
@@ -596,6 +710,7 @@ _equation_iterative_solve_strided(int                   idtvar,
 
         smbini[c_id][isou] -= diff;
         smbrp[c_id][isou] += smbini[c_id][isou];
+        sum += smbrp[c_id][isou]*smbrp[c_id][isou];
 
         adxkm1[c_id][isou] = 0.;
         adxk[c_id][isou] = 0.;
@@ -607,7 +722,9 @@ _equation_iterative_solve_strided(int                   idtvar,
     nadxk = 0.;
   }
   else {
-    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    ctx.parallel_for_reduce_sum
+      (n_cells, residu2, [=] CS_F_HOST_DEVICE
+       (cs_lnum_t c_id, CS_DISPATCH_SUM_DOUBLE &sum) {
       for (cs_lnum_t isou = 0; isou < stride; isou++) {
 
         cs_real_t diff = 0.;
@@ -617,6 +734,7 @@ _equation_iterative_solve_strided(int                   idtvar,
         smbini[c_id][isou] -= diff;
 
         smbrp[c_id][isou] += smbini[c_id][isou];
+        sum += smbrp[c_id][isou]*smbrp[c_id][isou];
       }
     });
   }
@@ -624,7 +742,8 @@ _equation_iterative_solve_strided(int                   idtvar,
   ctx.wait();
 
   /* --- Right hand side residual */
-  residu = sqrt(cs_gdot(stride*n_cells, (cs_real_t *)smbrp, (cs_real_t *)smbrp));
+  cs_parall_sum(1, CS_DOUBLE, &residu2);
+  residu = sqrt(residu2);
 
   /* Normalization residual
      (L2-norm of B.C. + source terms + non-orthogonality terms)
@@ -634,9 +753,10 @@ _equation_iterative_solve_strided(int                   idtvar,
      for ghost values. */
 
   /* Allocate a temporary array */
-  var_t *w1, *w2;
-  CS_MALLOC_HD(w1, n_cells_ext, var_t, amode);
-  CS_MALLOC_HD(w2, n_cells_ext, var_t, amode);
+  var_t *w1
+    = (var_t *)_workspace(_WS_W1, n_cells_ext, sizeof(var_t), amode);
+  var_t *w2
+    = (var_t *)_workspace(_WS_W2, n_cells_ext, sizeof(var_t), amode);
 
   cs_real_t *pvar_i;
   CS_MALLOC_HD(pvar_i, n_cells_ext, cs_real_t, amode);
@@ -702,9 +822,6 @@ _equation_iterative_solve_strided(int                   idtvar,
   cs_real_t rnorm2 = cs_gdot(stride*n_cells, (cs_real_t *)w1, (cs_real_t *)w1);
   cs_real_t rnorm = sqrt(rnorm2);
 
-  CS_FREE_HD(w1);
-  CS_FREE_HD(w2);
-
   sinfo.rhs_norm = rnorm;
 
   /* Warning: for Weight Matrix, one and only one sweep is done. */
@@ -718,6 +835,10 @@ _equation_iterative_solve_strided(int                   idtvar,
     sinfo.n_it = 0;
 
   while ((isweep <= nswmod && residu > epsrsp*rnorm) || isweep == 1) {
+
+    /* Residual before this sweep, to estimate its contribution */
+    cs_real_t residu_prev = residu;
+
     /* --- Solving on the increment dpvar */
 
     /*  Dynamic relaxation of the system */
@@ -950,6 +1071,26 @@ _equation_iterative_solve_strided(int                   idtvar,
 
     ctx.wait();
 
+    /* If the increment is negligible, the reconstructed right hand side
+       would barely change, so skip its computation (including gradients),
+       and estimate the residual by that of the linear solver.
+       Face values must be updated by the balance, so are not handled. */
+
+    if (   i_vf == nullptr
+        && _sweep_increment_is_small(stride*n_cells,
+                                     eqp->epsinc,
+                                     (iswdyp >= 1) ? alph : 1.,
+                                     (const cs_real_t *)dpvar,
+                                     (const cs_real_t *)pvar)) {
+      residu = ressol;
+      sinfo.n_it = sinfo.n_it + niterf;
+      if (iwarnp >= 2)
+        bft_printf("%s: sweep %d, negligible increment; "
+                   "reconstruction stopped\n", var_name, isweep);
+      isweep++;
+      break;
+    }
+
     /* Increment face value with theta * face_value at current time step
      * if needed
      * Reinit the previous value before */
@@ -1025,6 +1166,19 @@ _equation_iterative_solve_strided(int                   idtvar,
     }
 
     isweep++;
+
+    /* Stop if this sweep did not reduce the residual enough for
+       further sweeps to be worthwhile */
+
+    if (   eqp->epsrsm_red > 0. && residu > epsrsp*rnorm
+        && residu > (1. - eqp->epsrsm_red)*residu_prev) {
+      if (iwarnp >= 2)
+        bft_printf("%s: residual reduction %12.5e below %12.5e; "
+                   "reconstruction stopped\n", var_name,
+                   1. - residu/cs_math_fmax(residu_prev, cs_math_epzero),
+                   eqp->epsrsm_red);
+      break;
+    }
   }
 
   /* --- Reconstruction loop (end) */
@@ -1132,18 +1286,6 @@ _equation_iterative_solve_strided(int                   idtvar,
 
   ctx.wait();
 
-  /* Free memory */
-  CS_FREE_HD(dam);
-  CS_FREE_HD(xam);
-  CS_FREE_HD(smbini);
-  CS_FREE_HD(dpvar);
-  if (iswdyp >= 1) {
-    CS_FREE_HD(adxk);
-    CS_FREE_HD(adxkm1);
-    CS_FREE_HD(dpvarm1);
-    CS_FREE_HD(rhs0);
-  }
-
 }
 
 #endif /* cplusplus */
@@ -1359,11 +1501,17 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   cs_real_t *adxk = nullptr, *adxkm1 = nullptr;
   cs_real_t *dpvarm1 = nullptr, *rhs0 = nullptr;
 
+  const size_t r_size = sizeof(cs_real_t);
+
   if (iswdyp >= 1) {
-    CS_MALLOC_HD(adxk, n_cells_ext, cs_real_t, cs_alloc_mode);
-    CS_MALLOC_HD(adxkm1, n_cells_ext, cs_real_t, cs_alloc_mode);
-    CS_MALLOC_HD(dpvarm1, n_cells_ext, cs_real_t, cs_alloc_mode);
-    CS_MALLOC_HD(rhs0, n_cells_ext, cs_real_t, cs_alloc_mode);
+    adxk = (cs_real_t *)_workspace(_WS_ADXK, n_cells_ext, r_size,
+                                   cs_alloc_mode);
+    adxkm1 = (cs_real_t *)_workspace(_WS_ADXKM1, n_cells_ext, r_size,
+                                     cs_alloc_mode);
+    dpvarm1 = (cs_real_t *)_workspace(_WS_DPVARM1, n_cells_ext, r_size,
+                                      cs_alloc_mode);
+    rhs0 = (cs_real_t *)_workspace(_WS_RHS0, n_cells_ext, r_size,
+                                   cs_alloc_mode);
   }
 
   /* Symmetric matrix, except if advection */
@@ -1381,24 +1529,67 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
    * 1.  Building of the "simplified" matrix
    *==========================================================================*/
 
-  CS_MALLOC_HD(dam, n_cells_ext, cs_real_t, cs_alloc_mode);
-  CS_MALLOC_HD(xam, isym*n_i_faces, cs_real_t, cs_alloc_mode);
-
-  cs_matrix_wrapper_scalar(iconvp,
-                           idiffp,
-                           ndircp,
-                           isym,
-                           thetap,
-                           imucpp,
-                           bc_coeffs,
-                           rovsdt,
-                           i_massflux,
-                           b_massflux,
-                           i_viscm,
-                           b_viscm,
-                           xcpp,
-                           dam,
-                           xam);
+  dam = (cs_real_t *)_workspace(_WS_DAM, n_cells_ext, r_size,
+                                cs_alloc_mode);
+  xam = (cs_real_t *)_workspace(_WS_XAM, isym*n_i_faces, r_size,
+                                cs_alloc_mode);
+
+  /* Explicit part of the theta-scheme */
+  thetex = 1. - thetap;
+
+  /* With pure upwind advection and no diffusive flux reconstruction, the
+     explicit balance (see below) is built in the same face loops as
+     the matrix */
+
+  bool fused_rhs = (   idtvar >= 0 && imucpp == 0
+                    && icvflb == 0 && eqp->icoupl <= 0
+                    && (eqp->idften & CS_ISOTROPIC_DIFFUSION)
+                    && (iconvp == 0 || eqp->blencv <= 0.)
+                    && (idiffp == 0 || eqp->ircflu == 0)
+                    && fabs(thetex) > cs_math_epzero);
+
+  cs_timer_t t_mb0 = cs_timer_time();
+
+  if (fused_rhs)
+    cs_matrix_wrapper_scalar_upwind_rhs(iconvp,
+                                        idiffp,
+                                        ndircp,
+                                        isym,
+                                        thetap,
+                                        thetex,
+                                        bc_coeffs,
+                                        rovsdt,
+                                        i_massflux,
+                                        b_massflux,
+                                        i_viscm,
+                                        b_viscm,
+                                        i_visc,
+                                        b_visc,
+                                        pvara,
+                                        dam,
+                                        xam,
+                                        smbrp);
+
+  else
+    cs_matrix_wrapper_scalar(iconvp,
+                             idiffp,
+                             ndircp,
+                             isym,
+                             thetap,
+                             imucpp,
+                             bc_coeffs,
+                             rovsdt,
+                             i_massflux,
+                             b_massflux,
+                             i_viscm,
+                             b_viscm,
+                             xcpp,
+                             dam,
+                             xam);
+
+  cs_timer_t t_mb1 = cs_timer_time();
+  cs_perf_summary_add_diff(var_name, CS_PERF_SUMMARY_MATRIX_BUILD,
+                           &t_mb0, &t_mb1);
 
   /* Precaution if diagonal is 0, which may happen is all surrounding cells
    * are disabled
@@ -1425,7 +1616,6 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   /* Application of the theta-scheme */
 
   /* On calcule le bilan explicite total */
-  thetex = 1. - thetap;
 
   /* Compute the min/ max limiter */
   inc = 1;
@@ -1433,8 +1623,9 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   if (f_id > -1)
     cs_beta_limiter_building(f_id, inc, rovsdt);
 
-  /* If thetex = 0, no need to do more */
-  if (fabs(thetex) > cs_math_epzero) {
+  /* If thetex = 0, no need to do more (nor if already done
+     with the matrix) */
+  if (fabs(thetex) > cs_math_epzero && fused_rhs == false) {
     inc = 1;
 
     /* The added convective scalar mass flux is:
@@ -1472,7 +1663,8 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
   /* Before looping, the RHS without reconstruction is stored in smbini */
 
-  CS_MALLOC_HD(smbini, n_cells_ext, cs_real_t, cs_alloc_mode);
+  smbini = (cs_real_t *)_workspace(_WS_SMBINI, n_cells_ext, r_size,
+                                   cs_alloc_mode);
 
   cs_lnum_t has_dc = mq->has_disable_flag;
 
@@ -1563,11 +1755,12 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
        which is not "by increments" and is assumed initialized, including
        for ghost values. */
 
-    /* Allocate a temporary array */
-    CS_MALLOC_HD(w1, n_cells_ext, cs_real_t, cs_alloc_mode);
+    /* Temporary arrays */
+    w1 = (cs_real_t *)_workspace(_WS_W1, n_cells_ext, r_size,
+                                 cs_alloc_mode);
 
-    cs_real_t *w2;
-    CS_MALLOC_HD(w2, n_cells_ext, cs_real_t, cs_alloc_mode);
+    cs_real_t *w2 = (cs_real_t *)_workspace(_WS_W2, n_cells_ext, r_size,
+                                            cs_alloc_mode);
 
     cs_real_t p_mean = cs_gmean(n_cells, mq->cell_vol, pvar);
 
@@ -1589,8 +1782,6 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
                                      w2,
                                      w1);
 
-    CS_FREE_HD(w2);
-
     if (iwarnp >= 2) {
       bft_printf("L2 norm ||AX^n|| = %f\n", sqrt(cs_gdot(n_cells, w1, w1)));
       bft_printf("L2 norm ||B^n|| = %f\n", sqrt(cs_gdot(n_cells, smbrp, smbrp)));
@@ -1610,9 +1801,6 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
   sinfo.rhs_norm = rnorm;
 
-  /* Free memory */
-  CS_FREE_HD(w1);
-
   /* Warning: for weight matrix, one and only one sweep is done. */
   int nswmod = CS_MAX(eqp->nswrsm, 1);
 
@@ -1624,6 +1812,9 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
   while ((isweep <= nswmod && residu > epsrsp*rnorm) || isweep == 1) {
 
+    /* Residual before this sweep, to estimate its contribution */
+    cs_real_t residu_prev = residu;
+
     /* Solving on the increment: dpvar */
 
     if (iswdyp >= 1) {
@@ -1800,6 +1991,24 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
       cs_mesh_sync_var_scal(pvar);
     }
 
+    /* If the increment is negligible, the reconstructed right hand side
+       would barely change, so skip its computation (including gradients),
+       and estimate the residual by that of the linear solver. */
+
+    if (_sweep_increment_is_small(n_cells,
+                                  eqp->epsinc,
+                                  (iswdyp >= 1) ? alph : 1.,
+                                  dpvar,
+                                  pvar)) {
+      residu = ressol;
+      sinfo.n_it = sinfo.n_it + niterf;
+      if (iwarnp >= 2)
+        bft_printf("%s: sweep %d, negligible increment; "
+                   "reconstruction stopped\n", var_name, isweep);
+      isweep++;
+      break;
+    }
+
     /* Compute the beta (min/max) limiter */
     if (f_id > -1)
       cs_beta_limiter_building(f_id, inc, rovsdt);
@@ -1849,6 +2058,19 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
 
     isweep++;
 
+    /* Stop if this sweep did not reduce the residual enough for
+       further sweeps to be worthwhile */
+
+    if (   eqp->epsrsm_red > 0. && residu > epsrsp*rnorm
+        && residu > (1. - eqp->epsrsm_red)*residu_prev) {
+      if (iwarnp >= 2)
+        bft_printf("%s: residual reduction %12.5e below %12.5e; "
+                   "reconstruction stopped\n", var_name,
+                   1. - residu/cs_math_fmax(residu_prev, cs_math_epzero),
+                   eqp->epsrsm_red);
+      break;
+    }
+
   }
   /* --- Reconstruction loop (end) */
 
@@ -2054,18 +2276,6 @@ cs_equation_iterative_solve_scalar(int                   idtvar,
   cs_sles_free_native(f_id, var_name);
 
   ctx.wait();
-
-  /*  Free memory */
-  CS_FREE_HD(dam);
-  CS_FREE_HD(xam);
-  CS_FREE_HD(smbini);
-
-  if (iswdyp >= 1) {
-    CS_FREE_HD(adxk);
-    CS_FREE_HD(adxkm1);
-    CS_FREE_HD(dpvarm1);
-    CS_FREE_HD(rhs0);
-  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2360,6 +2570,24 @@ cs_equation_iterative_solve_tensor(int                         idtvar,
                                        nullptr); // eswork
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free work arrays shared by the equation solvers.
+ *
+ * Those arrays are kept from one call of the solvers to the next,
+ * so as to avoid allocations at each time step.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_iterative_solve_finalize(void)
+{
+  for (int i = 0; i < _WS_N_ARRAYS; i++) {
+    CS_FREE_HD(_ws_ptr[i]);
+    _ws_size[i] = 0;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -405,6 +405,18 @@ cs_equation_iterative_solve_tensor(int                         idtvar,
                                    cs_real_t                   smbrp[][6],
                                    cs_real_t                   pvar[][6]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free work arrays shared by the equation solvers.
+ *
+ * Those arrays are kept from one call of the solvers to the next,
+ * so as to avoid allocations at each time step.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_equation_iterative_solve_finalize(void);
+
 END_C_DECLS
 
 #endif /* __CS_EQUATION_ITERATIVE_SOLVE_H__ */
@@ -0,0 +1,289 @@
+#ifndef __CS_EXACT_SUM_H__
+#define __CS_EXACT_SUM_H__
+
+/*============================================================================
+ * Exact (order-independent) summation of floating-point values.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ *  Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*
+ * Values are accumulated in a fixed-point representation covering the
+ * whole double precision range, using base 2^32 digits stored in 64-bit
+ * integers (so up to 2^31 digits may be added before carries need to be
+ * propagated). The least significant bit of digit 0 represents 2^-1074.
+ */
+
+#define CS_EXACT_SUM_N_DIGITS  68
+
+/* Number of additions after which carries are propagated */
+
+#define CS_EXACT_SUM_MAX_ADD   (1 << 29)
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Exact sum accumulator */
+
+typedef struct {
+
+  int64_t  d[CS_EXACT_SUM_N_DIGITS];  /*!< base 2^32 digits */
+  int64_t  nf[3];                     /*!< number of added +Inf, -Inf,
+                                        and NaN values */
+  int      n_add;                     /*!< number of additions since
+                                        last carry propagation */
+
+} cs_exact_sum_t;
+
+/*=============================================================================
+ * Inline functions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize an exact sum accumulator to zero.
+ *
+ * \param[out]  s  pointer to accumulator
+ */
+/*----------------------------------------------------------------------------*/
+
+CS_F_HOST_DEVICE static inline void
+cs_exact_sum_init(cs_exact_sum_t  *s)
+{
+  for (int i = 0; i < CS_EXACT_SUM_N_DIGITS; i++)
+    s->d[i] = 0;
+  for (int i = 0; i < 3; i++)
+    s->nf[i] = 0;
+  s->n_add = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Propagate carries in an exact sum accumulator.
+ *
+ * After this operation, all digits except the last one are in the
+ * [0, 2^32[ range, and the sign of the last digit is that of the sum.
+ *
+ * \param[in, out]  s  pointer to accumulator
+ */
+/*----------------------------------------------------------------------------*/
+
+CS_F_HOST_DEVICE static inline void
+cs_exact_sum_normalize(cs_exact_sum_t  *s)
+{
+  for (int i = 0; i < CS_EXACT_SUM_N_DIGITS - 1; i++) {
+    int64_t c = s->d[i] >> 32;
+    s->d[i] -= c * ((int64_t)1 << 32);
+    s->d[i+1] += c;
+  }
+  s->n_add = 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Split a value into the digits which should be added to an
+ *        exact sum accumulator.
+ *
+ * For a finite non-zero value, the returned id is that of the first of
+ * 3 consecutive digits to which a[0], a[1], and a[2] should be added.
+ * For a zero value, -1 is returned. For +Inf, -Inf, or NaN, the returned
+ * id is CS_EXACT_SUM_N_DIGITS + k, with k the matching non-finite value
+ * counter id.
+ *
+ * \param[in]   v  value to split
+ * \param[out]  a  digit contributions
+ *
+ * \return  id of first digit
+ */
+/*----------------------------------------------------------------------------*/
+
+CS_F_HOST_DEVICE static inline int
+cs_exact_sum_split(double   v,
+                   int64_t  a[3])
+{
+  uint64_t u;
+  memcpy(&u, &v, sizeof(double));
+
+  int e_bits = (int)((u >> 52) & 0x7ff);
+  uint64_t mant = u & (((uint64_t)1 << 52) - 1);
+
+  if (e_bits == 0x7ff) {        /* Infinity or NaN */
+    if (mant != 0)
+      return CS_EXACT_SUM_N_DIGITS + 2;
+    else
+      return CS_EXACT_SUM_N_DIGITS + (int)(u >> 63);
+  }
+
+  int pos = 0;                  /* Position of least significant bit */
+  if (e_bits > 0) {
+    mant |= ((uint64_t)1 << 52);
+    pos = e_bits - 1;
+  }
+  else if (mant == 0)
+    return -1;
+
+  int d_id = pos >> 5;
+  int shift = pos & 31;
+
+  uint64_t m0 = (mant & ((((uint64_t)1) << (32 - shift)) - 1)) << shift;
+  uint64_t m_h = mant >> (32 - shift);
+
+  a[0] = (int64_t)m0;
+  a[1] = (int64_t)(m_h & 0xffffffff);
+  a[2] = (int64_t)(m_h >> 32);
+
+  if (u >> 63) {
+    for (int i = 0; i < 3; i++)
+      a[i] = -a[i];
+  }
+
+  return d_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a value to an exact sum accumulator.
+ *
+ * \param[in, out]  s  pointer to accumulator
+ * \param[in]       v  value to add
+ */
+/*----------------------------------------------------------------------------*/
+
+CS_F_HOST_DEVICE static inline void
+cs_exact_sum_add(cs_exact_sum_t  *s,
+                 double           v)
+{
+  int64_t a[3];
+  int d_id = cs_exact_sum_split(v, a);
+
+  if (d_id < 0)
+    return;
+  else if (d_id >= CS_EXACT_SUM_N_DIGITS) {
+    s->nf[d_id - CS_EXACT_SUM_N_DIGITS] += 1;
+    return;
+  }
+
+  s->d[d_id]   += a[0];
+  s->d[d_id+1] += a[1];
+  s->d[d_id+2] += a[2];
+
+  s->n_add += 1;
+  if (s->n_add >= CS_EXACT_SUM_MAX_ADD)
+    cs_exact_sum_normalize(s);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add an exact sum accumulator to another.
+ *
+ * \param[in, out]  s  pointer to accumulator
+ * \param[in]       a  pointer to accumulator to add
+ */
+/*----------------------------------------------------------------------------*/
+
+CS_F_HOST_DEVICE static inline void
+cs_exact_sum_merge(cs_exact_sum_t        *s,
+                   const cs_exact_sum_t  *a)
+{
+  for (int i = 0; i < CS_EXACT_SUM_N_DIGITS; i++)
+    s->d[i] += a->d[i];
+  for (int i = 0; i < 3; i++)
+    s->nf[i] += a->nf[i];
+
+  s->n_add += a->n_add;
+  if (s->n_add >= CS_EXACT_SUM_MAX_ADD)
+    cs_exact_sum_normalize(s);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Convert an exact sum accumulator to a double precision value.
+ *
+ * The result depends only on the exact sum, not on the order in which
+ * values were added.
+ *
+ * \param[in]  s  pointer to accumulator
+ *
+ * \return  rounded sum
+ */
+/*----------------------------------------------------------------------------*/
+
+CS_F_HOST_DEVICE static inline double
+cs_exact_sum_to_double(const cs_exact_sum_t  *s)
+{
+  if (s->nf[2] > 0 || (s->nf[0] > 0 && s->nf[1] > 0))
+    return NAN;
+  else if (s->nf[0] > 0)
+    return INFINITY;
+  else if (s->nf[1] > 0)
+    return -INFINITY;
+
+  cs_exact_sum_t t = *s;
+  cs_exact_sum_normalize(&t);
+
+  double sign = 1.;
+  if (t.d[CS_EXACT_SUM_N_DIGITS - 1] < 0) {
+    for (int i = 0; i < CS_EXACT_SUM_N_DIGITS; i++)
+      t.d[i] = -t.d[i];
+    cs_exact_sum_normalize(&t);
+    sign = -1.;
+  }
+
+  /* Sum from least to most significant digits */
+
+  double r = 0.;
+  for (int i = 0; i < CS_EXACT_SUM_N_DIGITS; i++) {
+    if (t.d[i] != 0)
+      r += ldexp((double)t.d[i], 32*i - 1074);
+  }
+
+  return sign*r;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_EXACT_SUM_H__ */
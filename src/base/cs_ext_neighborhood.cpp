@@ -2236,6 +2236,24 @@ cs_ext_neighborhood_reduce(cs_mesh_t             *mesh,
        (unsigned long long)n_n_sum[1], n_n_mean[1],
        (int)n_n_min[1], (int)n_n_max[1]);
 
+    /* Memory used by the connectivity list, and gain (the index
+       size is unchanged) */
+
+    double mem[2];
+    for (int i = 0; i < 2; i++)
+      mem[i] = (double)(n_n_sum[i]*sizeof(cs_lnum_t)) / 1048576.;
+
+    double gain = 0.;
+    if (n_n_sum[0] > 0)
+      gain = 100. * (1. - (double)n_n_sum[1] / (double)n_n_sum[0]);
+
+    bft_printf
+      (_("\n"
+         " Extended connectivity list memory (all ranks):\n"
+         "   complete: %12.3f MiB\n"
+         "   reduced:  %12.3f MiB (%5.1f %% saved)\n"),
+       mem[0], mem[1], gain);
+
   }
 
 #if 0 /* For debugging purposes */
@@ -203,6 +203,19 @@ typedef struct {
 
 } cs_field_key_val_t;
 
+/* Group of fields whose values are allocated in a common block */
+
+typedef struct {
+
+  int          n_fields;   /* Number of fields in group */
+  int         *field_id;   /* Ids of fields in group */
+  cs_lnum_t   *n_vals;     /* Number of values of each field
+                              (for each time value) */
+  cs_real_t   *block;      /* Common values block, or NULL if the
+                              values are not grouped currently */
+
+} cs_field_values_group_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -214,6 +227,11 @@ static int  _n_fields_max = 0;
 static cs_field_t  **_fields = NULL;
 static cs_map_name_to_id_t  *_field_map = NULL;
 
+/* Groups of fields with values in a common block */
+
+static int  _n_groups = 0;
+static cs_field_values_group_t  *_groups = NULL;
+
 /* Key definitions */
 
 static int  _n_keys = 0;
@@ -547,6 +565,142 @@ _add_val(cs_lnum_t   n_elts,
   return val;
 }
 
+/*----------------------------------------------------------------------------
+ * Return the id of the allocated values group containing a given field.
+ *
+ * parameters:
+ *   f_id <-- field id
+ *
+ * returns:
+ *   id of the group whose common block contains the field's values, or -1
+ *----------------------------------------------------------------------------*/
+
+static int
+_values_group_id(int  f_id)
+{
+  for (int g_id = 0; g_id < _n_groups; g_id++) {
+    const cs_field_values_group_t *g = _groups + g_id;
+    if (g->block == NULL)
+      continue;
+    for (int i = 0; i < g->n_fields; i++) {
+      if (g->field_id[i] == f_id)
+        return g_id;
+    }
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Move the values of a group's fields from separate arrays to a common
+ * block.
+ *
+ * The values of each field (for each time value) are placed one after
+ * the other, aligned on cache line boundaries.
+ *
+ * parameters:
+ *   g <-> pointer to values group
+ *----------------------------------------------------------------------------*/
+
+static void
+_values_group_allocate(cs_field_values_group_t  *g)
+{
+  if (g->block != NULL)
+    return;
+
+  const cs_lnum_t align = CS_CL_SIZE / sizeof(cs_real_t);
+
+  size_t block_size = 0;
+  for (int i = 0; i < g->n_fields; i++) {
+    const cs_field_t *f = _fields[g->field_id[i]];
+    if (!f->is_owner)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Field \"%s\" is part of a values group,\n"
+                  "but its values are mapped."), f->name);
+    const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
+    g->n_vals[i] = n_elts[2] * f->dim;
+    block_size += cs_align(g->n_vals[i], align) * f->n_time_vals;
+  }
+
+  CS_MALLOC_HD(g->block, block_size, cs_real_t, cs_alloc_mode);
+
+  cs_real_t *v = g->block;
+
+  for (int i = 0; i < g->n_fields; i++) {
+    cs_field_t *f = _fields[g->field_id[i]];
+    const cs_lnum_t n_vals = g->n_vals[i];
+    for (int kk = 0; kk < f->n_time_vals; kk++) {
+      const cs_real_t *v_src = f->vals[kk];
+      if (v_src != NULL) {
+#       pragma omp parallel for if (n_vals > CS_THR_MIN)
+        for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+          v[ii] = v_src[ii];
+        CS_FREE_HD(f->vals[kk]);
+      }
+      else {
+#       pragma omp parallel for if (n_vals > CS_THR_MIN)
+        for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+          v[ii] = 0.0;
+      }
+      f->vals[kk] = v;
+      v += cs_align(n_vals, align);
+    }
+    f->val = f->vals[0];
+    if (f->n_time_vals > 1)
+      f->val_pre = f->vals[1];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Move the values of a group's fields from the common block to separate
+ * arrays.
+ *
+ * parameters:
+ *   g <-> pointer to values group
+ *----------------------------------------------------------------------------*/
+
+static void
+_values_group_release(cs_field_values_group_t  *g)
+{
+  if (g->block == NULL)
+    return;
+
+  for (int i = 0; i < g->n_fields; i++) {
+    cs_field_t *f = _fields[g->field_id[i]];
+    const cs_lnum_t n_vals = g->n_vals[i];
+    for (int kk = 0; kk < f->n_time_vals; kk++) {
+      const cs_real_t *v_src = f->vals[kk];
+      cs_real_t *v = NULL;
+      CS_MALLOC_HD(v, n_vals, cs_real_t, cs_alloc_mode);
+#     pragma omp parallel for if (n_vals > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+        v[ii] = v_src[ii];
+      f->vals[kk] = v;
+    }
+    f->val = f->vals[0];
+    if (f->n_time_vals > 1)
+      f->val_pre = f->vals[1];
+  }
+
+  CS_FREE_HD(g->block);
+}
+
+/*----------------------------------------------------------------------------
+ * Move the values of a field back to separate arrays if they are
+ * currently in a group's common block.
+ *
+ * parameters:
+ *   f <-- pointer to field structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_values_ungroup_field(const cs_field_t  *f)
+{
+  int g_id = _values_group_id(f->id);
+  if (g_id > -1)
+    _values_group_release(_groups + g_id);
+}
+
 /*----------------------------------------------------------------------------
  * Find an id matching a key or define a new key and associated id.
  *
@@ -1789,6 +1943,8 @@ cs_field_set_n_time_vals(cs_field_t  *f,
   if (_n_time_vals == n_time_vals_ini)
     return;
 
+  _values_ungroup_field(f);
+
   /* Update number of time values */
 
   f->n_time_vals = _n_time_vals;
@@ -1831,6 +1987,8 @@ cs_field_allocate_values(cs_field_t  *f)
 
   if (f->is_owner) {
 
+    _values_ungroup_field(f);
+
     const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
     int ii;
 
@@ -1865,6 +2023,7 @@ cs_field_map_values(cs_field_t   *f,
     return;
 
   if (f->is_owner) {
+    _values_ungroup_field(f);
     BFT_FREE(f->val);
     BFT_FREE(f->val_pre);
     f->is_owner = false;
@@ -2372,6 +2531,22 @@ cs_field_current_to_previous(cs_field_t  *f)
 void
 cs_field_destroy_all(void)
 {
+  for (int g_id = 0; g_id < _n_groups; g_id++) {
+    cs_field_values_group_t *g = _groups + g_id;
+    if (g->block != NULL) {
+      for (int i = 0; i < g->n_fields; i++) {
+        cs_field_t *f = _fields[g->field_id[i]];
+        for (int kk = 0; kk < f->n_time_vals; kk++)
+          f->vals[kk] = NULL;
+      }
+      CS_FREE_HD(g->block);
+    }
+    BFT_FREE(g->field_id);
+    BFT_FREE(g->n_vals);
+  }
+  BFT_FREE(_groups);
+  _n_groups = 0;
+
   for (int i = 0; i < _n_fields; i++) {
     cs_field_t  *f = _fields[i];
     if (f->is_owner) {
@@ -2447,6 +2622,119 @@ cs_field_allocate_or_map_all(void)
                   f->name);
     }
   }
+
+  cs_field_group_values_all();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a group of fields whose values are allocated in a common
+ *        block.
+ *
+ * Values of the grouped fields (including previous time values) are placed
+ * one after the other in a single contiguous block, aligned on cache line
+ * boundaries, so that kernels which access these fields together make
+ * better use of prefetching and of the TLB. Each field's values remain
+ * accessible through \ref cs_field_t::val and the other usual members.
+ *
+ * Grouped fields must own their values and share the same location.
+ * Values are grouped when all fields are allocated (or by
+ * \ref cs_field_group_values_all). They are moved back to separate arrays
+ * if the number of time values or the mapping of a grouped field is
+ * changed.
+ *
+ * \param[in]  n_fields   number of fields in group
+ * \param[in]  field_ids  ids of fields in group
+ *
+ * \return  id of the new group
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_field_define_values_group(int        n_fields,
+                             const int  field_ids[])
+{
+  for (int i = 0; i < n_fields; i++) {
+    const cs_field_t *f = cs_field_by_id(field_ids[i]);
+    const cs_field_t *f0 = cs_field_by_id(field_ids[0]);
+    if (f->location_id != f0->location_id)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: fields \"%s\" and \"%s\" in a values group\n"
+                  "must have the same location."),
+                __func__, f0->name, f->name);
+    for (int g_id = 0; g_id < _n_groups; g_id++) {
+      for (int j = 0; j < _groups[g_id].n_fields; j++) {
+        if (_groups[g_id].field_id[j] == f->id)
+          bft_error(__FILE__, __LINE__, 0,
+                    _("%s: field \"%s\" is already in values group %d."),
+                    __func__, f->name, g_id);
+      }
+    }
+    for (int j = 0; j < i; j++) {
+      if (field_ids[j] == f->id)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("%s: field \"%s\" appears twice in values group."),
+                  __func__, f->name);
+    }
+  }
+
+  int g_id = _n_groups;
+  _n_groups += 1;
+  BFT_REALLOC(_groups, _n_groups, cs_field_values_group_t);
+
+  cs_field_values_group_t *g = _groups + g_id;
+
+  g->n_fields = n_fields;
+  BFT_MALLOC(g->field_id, n_fields, int);
+  BFT_MALLOC(g->n_vals, n_fields, cs_lnum_t);
+  for (int i = 0; i < n_fields; i++) {
+    g->field_id[i] = field_ids[i];
+    g->n_vals[i] = 0;
+  }
+  g->block = NULL;
+
+  /* Group immediately if values are already allocated */
+
+  bool allocated = true;
+  for (int i = 0; i < n_fields; i++) {
+    if (_fields[field_ids[i]]->val == NULL)
+      allocated = false;
+  }
+  if (allocated && n_fields > 0)
+    _values_group_allocate(g);
+
+  return g_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Place values of fields in defined groups in their common blocks.
+ *
+ * Values of fields which are already grouped are not moved.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_group_values_all(void)
+{
+  for (int g_id = 0; g_id < _n_groups; g_id++)
+    _values_group_allocate(_groups + g_id);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Move values of fields in defined groups to separate arrays.
+ *
+ * This is needed before reallocating the values of individual fields,
+ * for example when the number of elements of their location changes.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_ungroup_values_all(void)
+{
+  for (int g_id = 0; g_id < _n_groups; g_id++)
+    _values_group_release(_groups + g_id);
 }
 
 /*----------------------------------------------------------------------------*/
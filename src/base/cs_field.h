@@ -456,6 +456,44 @@ cs_field_destroy_all(void);
 void
 cs_field_allocate_or_map_all(void);
 
+/*----------------------------------------------------------------------------
+ * Define a group of fields whose values are allocated in a common block.
+ *
+ * Values of the grouped fields (including previous time values) are placed
+ * one after the other in a single contiguous block, aligned on cache line
+ * boundaries. Each field's values remain accessible through the usual
+ * members. Grouped fields must own their values and share the same location.
+ *
+ * parameters:
+ *   n_fields  <-- number of fields in group
+ *   field_ids <-- ids of fields in group
+ *
+ * returns:
+ *   id of the new group
+ *----------------------------------------------------------------------------*/
+
+int
+cs_field_define_values_group(int        n_fields,
+                             const int  field_ids[]);
+
+/*----------------------------------------------------------------------------
+ * Place values of fields in defined groups in their common blocks.
+ *
+ * Values of fields which are already grouped are not moved.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_group_values_all(void);
+
+/*----------------------------------------------------------------------------
+ * Move values of fields in defined groups to separate arrays.
+ *
+ * This is needed before reallocating the values of individual fields.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_ungroup_values_all(void);
+
 /*----------------------------------------------------------------------------
  * Return a pointer to a field based on its id.
  *
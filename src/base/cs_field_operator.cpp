@@ -57,11 +57,13 @@
 #include "cs_map.h"
 #include "cs_parameters.h"
 #include "cs_parall.h"
+#include "cs_porous_model.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
 #include "cs_internal_coupling.h"
+#include "cs_time_step.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -101,10 +103,55 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Settings of a cached scalar gradient computation */
+
+typedef struct {
+
+  int          gradient_type;  /* gradient type */
+  int          halo_type;      /* halo type */
+  int          inc;            /* 0 if solving on increment, 1 otherwise */
+  int          hyd_p_flag;     /* flag for hydrostatic pressure */
+  int          w_stride;       /* weighting stride */
+  int          nswrgr;         /* max. number of reconstruction sweeps */
+  int          imligr;         /* gradient limitation type */
+  double       epsrgr;         /* reconstruction sweeps precision */
+  double       climgr;         /* gradient limitation factor */
+
+  const void  *bc_coeffs;      /* boundary condition structure */
+  const void  *f_ext;          /* exterior force */
+  const void  *c_weight;       /* weighting coefficients */
+  const void  *cpl;            /* internal coupling structure */
+
+} cs_field_gradient_key_t;
+
+/* Cached scalar gradient and copy of its inputs */
+
+typedef struct {
+
+  int                      nt_cur;       /* time step of computation */
+  cs_lnum_t                n_cells_ext;  /* number of cells with ghosts */
+
+  cs_field_gradient_key_t  key;          /* gradient settings */
+
+  cs_real_t               *var;          /* copy of base variable */
+  cs_real_t               *bc_a;         /* copy of BC "a" coefficients */
+  cs_real_t               *bc_b;         /* copy of BC "b" coefficients */
+  cs_real_t               *f_ext;        /* copy of exterior force */
+  cs_real_t               *c_weight;     /* copy of weighting */
+
+  cs_real_3_t             *grad;         /* gradient */
+
+} cs_field_gradient_cache_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
 
+/* Gradient cache, with 2 entries (current and previous values) per field */
+
+static int                         _n_gradient_cache = 0;
+static cs_field_gradient_cache_t  *_gradient_cache = nullptr;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -342,6 +389,255 @@ _local_extrema_scalar(const cs_real_t *restrict pvar,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Return a pointer to the gradient cache entry associated with a field,
+ * or nullptr if the field's gradient is not cached.
+ *
+ * parameters:
+ *   f              <-- pointer to field
+ *   use_previous_t <-- are values from the previous time step used ?
+ *
+ * returns:
+ *   pointer to cache entry, or nullptr
+ *----------------------------------------------------------------------------*/
+
+static cs_field_gradient_cache_t *
+_gradient_cache_entry(const cs_field_t  *f,
+                      bool               use_previous_t)
+{
+  if (f->location_id != CS_MESH_LOCATION_CELLS || f->dim != 1)
+    return nullptr;
+
+  /* Porosity balance terms may be updated between calls, and are not
+     part of the checked inputs */
+
+  if (cs_glob_porous_model == 3)
+    return nullptr;
+
+  static int k_id = -1;
+  if (k_id < 0)
+    k_id = cs_field_key_id("gradient_cache");
+
+  if (cs_field_get_key_int(f, k_id) < 1)
+    return nullptr;
+
+  int n_fields = cs_field_n_fields();
+
+  if (_n_gradient_cache < 2*n_fields) {
+    BFT_REALLOC(_gradient_cache, 2*n_fields, cs_field_gradient_cache_t);
+    for (int i = _n_gradient_cache; i < 2*n_fields; i++) {
+      cs_field_gradient_cache_t *gc = _gradient_cache + i;
+      memset(gc, 0, sizeof(cs_field_gradient_cache_t));
+      gc->nt_cur = -1;
+    }
+    _n_gradient_cache = 2*n_fields;
+  }
+
+  return _gradient_cache + 2*f->id + ((use_previous_t) ? 1 : 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Build the settings key of a scalar gradient computation.
+ *
+ * parameters:
+ *   key           --> gradient settings key
+ *   gradient_type <-- gradient type
+ *   halo_type     <-- halo type
+ *   inc           <-- if 0, solve on increment; 1 otherwise
+ *   hyd_p_flag    <-- flag for hydrostatic pressure
+ *   w_stride      <-- weighting stride
+ *   eqp           <-- associated equation parameters
+ *   bc_coeffs     <-- boundary condition structure, or nullptr
+ *   f_ext         <-- exterior force, or nullptr
+ *   c_weight      <-- weighting coefficients, or nullptr
+ *   cpl           <-- internal coupling structure, or nullptr
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_key_init(cs_field_gradient_key_t     *key,
+                   cs_gradient_type_t           gradient_type,
+                   cs_halo_type_t               halo_type,
+                   int                          inc,
+                   int                          hyd_p_flag,
+                   int                          w_stride,
+                   const cs_equation_param_t   *eqp,
+                   const cs_field_bc_coeffs_t  *bc_coeffs,
+                   const void                  *f_ext,
+                   const void                  *c_weight,
+                   const void                  *cpl)
+{
+  /* Zero padding bytes, as keys are compared using memcmp */
+  memset(key, 0, sizeof(cs_field_gradient_key_t));
+
+  key->gradient_type = gradient_type;
+  key->halo_type = halo_type;
+  key->inc = inc;
+  key->hyd_p_flag = hyd_p_flag;
+  key->w_stride = w_stride;
+  key->nswrgr = eqp->nswrgr;
+  key->imligr = eqp->imligr;
+  key->epsrgr = eqp->epsrgr;
+  key->climgr = eqp->climgr;
+  key->bc_coeffs = bc_coeffs;
+  key->f_ext = f_ext;
+  key->c_weight = c_weight;
+  key->cpl = cpl;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare values with a saved copy.
+ *
+ * parameters:
+ *   n    <-- number of values
+ *   vals <-- values, or nullptr
+ *   copy <-- copy of values, or nullptr
+ *
+ * returns:
+ *   true if values are identical to the copy, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_gradient_cache_check_vals(cs_lnum_t         n,
+                           const cs_real_t  *vals,
+                           const cs_real_t  *copy)
+{
+  if (vals == nullptr)
+    return true;
+
+  if (copy == nullptr)
+    return false;
+
+  return (memcmp(vals, copy, n*sizeof(cs_real_t)) == 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Save a copy of values.
+ *
+ * parameters:
+ *   n    <-- number of values
+ *   vals <-- values, or nullptr
+ *   copy <-> pointer to copy of values (freed if vals is nullptr)
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_cache_save_vals(cs_lnum_t         n,
+                          const cs_real_t  *vals,
+                          cs_real_t       **copy)
+{
+  if (vals == nullptr)
+    BFT_FREE(*copy);
+  else {
+    BFT_REALLOC(*copy, n, cs_real_t);
+    memcpy(*copy, vals, n*sizeof(cs_real_t));
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Try to obtain a scalar gradient from the cache.
+ *
+ * The inputs of the gradient computation are compared with those saved
+ * with the cached gradient. This is a collective operation, so that all
+ * ranks either use the cached gradient or compute it.
+ *
+ * parameters:
+ *   gc       <-> pointer to cache entry
+ *   key      <-- gradient settings
+ *   var      <-- gradient's base variable
+ *   bc_a     <-- boundary condition "a" coefficients, or nullptr
+ *   bc_b     <-- boundary condition "b" coefficients, or nullptr
+ *   f_ext    <-- exterior force, or nullptr
+ *   c_weight <-- weighting coefficients, or nullptr
+ *   w_stride <-- weighting stride
+ *   grad     --> gradient (if found)
+ *
+ * returns:
+ *   true if the gradient was found in the cache, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_gradient_cache_get(cs_field_gradient_cache_t      *gc,
+                    const cs_field_gradient_key_t  *key,
+                    const cs_real_t                 var[],
+                    const cs_real_t                *bc_a,
+                    const cs_real_t                *bc_b,
+                    const cs_real_t                *f_ext,
+                    const cs_real_t                *c_weight,
+                    int                             w_stride,
+                    cs_real_3_t           *restrict grad)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  int miss = 0;
+
+  if (   gc->grad == nullptr
+      || gc->nt_cur != cs_glob_time_step->nt_cur
+      || gc->n_cells_ext != n_cells_ext
+      || memcmp(&(gc->key), key, sizeof(cs_field_gradient_key_t)) != 0)
+    miss = 1;
+
+  else if (   !_gradient_cache_check_vals(n_cells, var, gc->var)
+           || !_gradient_cache_check_vals(n_b_faces, bc_a, gc->bc_a)
+           || !_gradient_cache_check_vals(n_b_faces, bc_b, gc->bc_b)
+           || !_gradient_cache_check_vals(3*n_cells, f_ext, gc->f_ext)
+           || !_gradient_cache_check_vals(w_stride*n_cells, c_weight,
+                                          gc->c_weight))
+    miss = 1;
+
+  cs_parall_max(1, CS_INT_TYPE, &miss);
+
+  if (miss == 0)
+    memcpy(grad, gc->grad, 3*n_cells_ext*sizeof(cs_real_t));
+
+  return (miss == 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Save a scalar gradient and its inputs in the cache.
+ *
+ * parameters:
+ *   gc       <-> pointer to cache entry
+ *   key      <-- gradient settings
+ *   var      <-- gradient's base variable
+ *   bc_a     <-- boundary condition "a" coefficients, or nullptr
+ *   bc_b     <-- boundary condition "b" coefficients, or nullptr
+ *   f_ext    <-- exterior force, or nullptr
+ *   c_weight <-- weighting coefficients, or nullptr
+ *   w_stride <-- weighting stride
+ *   grad     <-- gradient
+ *----------------------------------------------------------------------------*/
+
+static void
+_gradient_cache_set(cs_field_gradient_cache_t      *gc,
+                    const cs_field_gradient_key_t  *key,
+                    const cs_real_t                 var[],
+                    const cs_real_t                *bc_a,
+                    const cs_real_t                *bc_b,
+                    const cs_real_t                *f_ext,
+                    const cs_real_t                *c_weight,
+                    int                             w_stride,
+                    const cs_real_3_t              *grad)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  gc->nt_cur = cs_glob_time_step->nt_cur;
+  gc->n_cells_ext = n_cells_ext;
+  memcpy(&(gc->key), key, sizeof(cs_field_gradient_key_t));
+
+  _gradient_cache_save_vals(n_cells, var, &(gc->var));
+  _gradient_cache_save_vals(n_b_faces, bc_a, &(gc->bc_a));
+  _gradient_cache_save_vals(n_b_faces, bc_b, &(gc->bc_b));
+  _gradient_cache_save_vals(3*n_cells, f_ext, &(gc->f_ext));
+  _gradient_cache_save_vals(w_stride*n_cells, c_weight, &(gc->c_weight));
+  _gradient_cache_save_vals(3*n_cells_ext, (const cs_real_t *)grad,
+                            (cs_real_t **)&(gc->grad));
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -541,6 +837,24 @@ cs_field_gradient_scalar(const cs_field_t          *f,
     bc_coeffs = f->bc_coeffs;
   }
 
+  /* Reuse the cached gradient if its inputs did not change */
+
+  cs_field_gradient_cache_t *gc = _gradient_cache_entry(f, use_previous_t);
+  cs_field_gradient_key_t gk;
+  const cs_real_t *bc_a = (bc_coeffs != NULL) ? bc_coeffs->a : NULL;
+  const cs_real_t *bc_b = (bc_coeffs != NULL) ? bc_coeffs->b : NULL;
+
+  if (gc != nullptr) {
+    _gradient_key_init(&gk, gradient_type, halo_type, inc, 0, w_stride,
+                       eqp, bc_coeffs, nullptr, c_weight, cpl);
+    if (_gradient_cache_get(gc, &gk, var, bc_a, bc_b, nullptr,
+                            c_weight, w_stride, grad)) {
+      if (cs_glob_mesh->halo != NULL)
+        cs_halo_sync_var(cs_glob_mesh->halo, halo_type, var);
+      return;
+    }
+  }
+
   cs_gradient_scalar(f->name,
                      gradient_type,
                      halo_type,
@@ -558,6 +872,133 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                      c_weight,
                      cpl, /* internal coupling */
                      grad);
+
+  if (gc != nullptr)
+    _gradient_cache_set(gc, &gk, var, bc_a, bc_b, nullptr,
+                        c_weight, w_stride, grad);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute cell gradients of several scalar fields.
+ *
+ * When all fields share the same gradient options, without weighting,
+ * internal coupling or gradient caching, gradients are computed together
+ * using \ref cs_gradient_multi, so that ghost values are exchanged in a
+ * single round and least-squares face loops are shared; otherwise,
+ * this is equivalent to successive calls to \ref cs_field_gradient_scalar.
+ *
+ * \param[in]   n_fields        number of fields
+ * \param[in]   f               pointers to fields
+ * \param[in]   use_previous_t  should we use values from the previous
+ *                              time step ?
+ * \param[in]   inc             if 0, solve on increment; 1 otherwise
+ * \param[out]  grad            gradient of each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_scalars(int                n_fields,
+                          const cs_field_t  *f[],
+                          bool               use_previous_t,
+                          int                inc,
+                          cs_real_3_t       *grad[])
+{
+  bool grouped = (n_fields > 1);
+
+  const cs_equation_param_t *eqp_0 = nullptr;
+  int verbosity = 0;
+
+  for (int i = 0; i < n_fields && grouped; i++) {
+
+    const cs_field_t *parent_f = f[i];
+    const int f_parent_id
+      = cs_field_get_key_int(f[i], cs_field_key_id("parent_field_id"));
+    if (f_parent_id > -1)
+      parent_f = cs_field_by_id(f_parent_id);
+
+    const cs_equation_param_t
+      *eqp = cs_field_get_equation_param_const(parent_f);
+
+    if (   eqp == nullptr
+        || f[i]->dim != 1
+        || f[i]->bc_coeffs == nullptr
+        || (use_previous_t && f[i]->n_time_vals < 2)
+        || _gradient_cache_entry(f[i], use_previous_t) != nullptr) {
+      grouped = false;
+      break;
+    }
+
+    if (parent_f->type & CS_FIELD_VARIABLE && eqp->idiff > 0) {
+      if (eqp->iwgrec == 1)
+        grouped = false;
+      int key_id = cs_field_key_id_try("coupling_entity");
+      if (key_id > -1) {
+        if (cs_field_get_key_int(parent_f, key_id) > -1)
+          grouped = false;
+      }
+    }
+
+    if (eqp_0 == nullptr)
+      eqp_0 = eqp;
+    else if (   eqp->imrgra != eqp_0->imrgra
+             || eqp->nswrgr != eqp_0->nswrgr
+             || eqp->imligr != eqp_0->imligr
+             || fabs(eqp->epsrgr - eqp_0->epsrgr) > 0
+             || fabs(eqp->climgr - eqp_0->climgr) > 0)
+      grouped = false;
+
+    verbosity = CS_MAX(verbosity, eqp->verbosity);
+  }
+
+  if (!grouped) {
+    for (int i = 0; i < n_fields; i++)
+      cs_field_gradient_scalar(f[i], use_previous_t, inc, grad[i]);
+    return;
+  }
+
+  cs_halo_type_t halo_type = CS_HALO_STANDARD;
+  cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
+
+  cs_gradient_type_by_imrgra(eqp_0->imrgra,
+                             &gradient_type,
+                             &halo_type);
+
+  const char **var_name;
+  int *dim;
+  const cs_field_bc_coeffs_t **bc_coeffs;
+  cs_real_t **var;
+  BFT_MALLOC(var_name, n_fields, const char *);
+  BFT_MALLOC(dim, n_fields, int);
+  BFT_MALLOC(bc_coeffs, n_fields, const cs_field_bc_coeffs_t *);
+  BFT_MALLOC(var, n_fields, cs_real_t *);
+
+  for (int i = 0; i < n_fields; i++) {
+    var_name[i] = f[i]->name;
+    dim[i] = 1;
+    bc_coeffs[i] = f[i]->bc_coeffs;
+    var[i] = (use_previous_t) ? f[i]->val_pre : f[i]->val;
+  }
+
+  cs_gradient_multi(n_fields,
+                    var_name,
+                    gradient_type,
+                    halo_type,
+                    inc,
+                    eqp_0->nswrgr,
+                    verbosity,
+                    static_cast<cs_gradient_limit_t>(eqp_0->imligr),
+                    eqp_0->epsrgr,
+                    eqp_0->climgr,
+                    dim,
+                    bc_coeffs,
+                    var,
+                    reinterpret_cast<cs_real_t **>(grad));
+
+  BFT_FREE(var_name);
+  BFT_FREE(dim);
+  BFT_FREE(bc_coeffs);
+  BFT_FREE(var);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -719,6 +1160,26 @@ cs_field_gradient_potential(const cs_field_t          *f,
   if (hyd_p_flag == 2)
     hyd_p_flag = 0;
 
+  /* Reuse the cached gradient if its inputs did not change */
+
+  cs_field_gradient_cache_t *gc = _gradient_cache_entry(f, use_previous_t);
+  cs_field_gradient_key_t gk;
+  const cs_real_t *bc_a = (bc_coeffs != NULL) ? bc_coeffs->a : NULL;
+  const cs_real_t *bc_b = (bc_coeffs != NULL) ? bc_coeffs->b : NULL;
+  const cs_real_t *_f_ext
+    = (hyd_p_flag == 1) ? (const cs_real_t *)f_ext : nullptr;
+
+  if (gc != nullptr) {
+    _gradient_key_init(&gk, gradient_type, halo_type, inc, hyd_p_flag,
+                       w_stride, eqp, bc_coeffs, _f_ext, c_weight, cpl);
+    if (_gradient_cache_get(gc, &gk, var, bc_a, bc_b, _f_ext,
+                            c_weight, w_stride, grad)) {
+      if (cs_glob_mesh->halo != NULL)
+        cs_halo_sync_var(cs_glob_mesh->halo, halo_type, var);
+      return;
+    }
+  }
+
   cs_gradient_scalar(f->name,
                      gradient_type,
                      halo_type,
@@ -736,6 +1197,10 @@ cs_field_gradient_potential(const cs_field_t          *f,
                      c_weight,
                      cpl, /* internal coupling */
                      grad);
+
+  if (gc != nullptr)
+    _gradient_cache_set(gc, &gk, var, bc_a, bc_b, _f_ext,
+                        c_weight, w_stride, grad);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1552,6 +2017,34 @@ cs_field_synchronize(cs_field_t      *f,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free cached field gradients.
+ *
+ * Gradients of fields with the "gradient_cache" keyword set are kept
+ * with a copy of their inputs (values, boundary condition coefficients,
+ * exterior force and weighting), and reused during the same time step
+ * when those inputs did not change.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_free_all(void)
+{
+  for (int i = 0; i < _n_gradient_cache; i++) {
+    cs_field_gradient_cache_t *gc = _gradient_cache + i;
+    BFT_FREE(gc->var);
+    BFT_FREE(gc->bc_a);
+    BFT_FREE(gc->bc_b);
+    BFT_FREE(gc->f_ext);
+    BFT_FREE(gc->c_weight);
+    BFT_FREE(gc->grad);
+  }
+
+  BFT_FREE(_gradient_cache);
+  _n_gradient_cache = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -79,6 +79,29 @@ cs_field_gradient_scalar(const cs_field_t  *f,
                          int                inc,
                          cs_real_3_t       *grad);
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of several scalar fields.
+ *
+ * When all fields share the same gradient options, without weighting,
+ * internal coupling or gradient caching, gradients are computed together
+ * using cs_gradient_multi; otherwise, this is equivalent to successive
+ * calls to cs_field_gradient_scalar.
+ *
+ * parameters:
+ *   n_fields       <-- number of fields
+ *   f              <-- pointers to fields
+ *   use_previous_t <-- should we use values from the previous time step ?
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   grad           --> gradient of each field
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_scalars(int                n_fields,
+                          const cs_field_t  *f[],
+                          bool               use_previous_t,
+                          int                inc,
+                          cs_real_3_t       *grad[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar array using parameters associated
@@ -281,6 +304,15 @@ void
 cs_field_synchronize(cs_field_t      *f,
                      cs_halo_type_t   halo_type);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free cached field gradients.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_cache_free_all(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
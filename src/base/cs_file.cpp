@@ -69,10 +69,26 @@
 #include <dirent.h>
 #endif
 
+#if    defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H) \
+    && defined(HAVE_FCNTL_H) && defined(HAVE_SYS_STAT_H)
+#define CS_FILE_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#endif
+
 #if defined(WIN32) || defined(_WIN32)
 #include <io.h>
 #endif
 
+/*----------------------------------------------------------------------------
+ * Standard C++ library headers
+ *----------------------------------------------------------------------------*/
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #if defined(HAVE_MPI_IO)
 #include <limits.h>
 #endif
@@ -155,6 +171,9 @@ BEGIN_C_DECLS
        Collective MPI-IO
   \var CS_FILE_IN_MEMORY_SERIAL
        Buffer in rank 0 memory (serialized in parallel)
+  \var CS_FILE_MMAP
+       Per-process memory-mapped file access (for reading only;
+       standard C IO is used for writing)
 
   \enum cs_file_mpi_positioning_t
 
@@ -222,8 +241,67 @@ struct _cs_file_t {
   size_t             in_mem_max_size; /* Max size in memory */
   unsigned char     *in_mem_data;     /* Data in memory */
 
+  char              *async_name;   /* File name reference for asynchronous
+                                      writes, or nullptr */
+  cs_file_off_t      async_offset; /* Logical position for asynchronous
+                                      writes */
+  cs_file_off_t      async_end;    /* Logical end of file for asynchronous
+                                      writes */
+  char              *staged_name;  /* Path of staged (node-local) copy
+                                      of the file, or nullptr */
+
+  unsigned char     *map_data;     /* Memory-mapped file data, or nullptr */
+  size_t             map_size;     /* Size of memory-mapped file */
+
 };
 
+/* Asynchronous write operation types */
+
+typedef enum {
+
+  CS_FILE_ASYNC_WRITE,
+  CS_FILE_ASYNC_SEEK,
+  CS_FILE_ASYNC_CLOSE,
+  CS_FILE_ASYNC_COPY
+
+} _async_op_type_t;
+
+/* Asynchronous write operation */
+
+typedef struct {
+
+  _async_op_type_t   type;         /* Operation type */
+  FILE              *sh;           /* Serial file handle */
+  char              *name;         /* File name reference (owned by
+                                      the close and copy operations) */
+  char              *path;         /* Staged file path (owned), or nullptr */
+  bool               stage_in;     /* Copy from name to path (prefetch)
+                                      rather than from path to name */
+  unsigned char     *data;         /* Data to write (owned) */
+  size_t             size;         /* Number of bytes to write */
+  cs_file_off_t      offset;       /* Seek offset */
+  int                whence;       /* Seek origin */
+
+} _async_op_t;
+
+/* Asynchronous writer (operations are applied in order by a single
+   helper thread, so that the caller may proceed with computations) */
+
+typedef struct {
+
+  std::mutex                mutex;     /* Queue access mutex */
+  std::condition_variable   cv;        /* Queue state change notification */
+  std::deque<_async_op_t>   queue;     /* Queued operations */
+  std::thread               thread;    /* Helper thread */
+
+  size_t                    size;      /* Queued (or in progress) bytes */
+  const char               *busy_name; /* Name of file being handled */
+  bool                      busy;      /* Is an operation in progress ? */
+  bool                      stop;      /* Stop request */
+  char                     *error;     /* First error message, or nullptr */
+
+} _async_writer_t;
+
 /* Associated typedef documentation (for cs_file.h) */
 
 /*!
@@ -326,6 +404,17 @@ static cs_gztell_t  *_cs_gztell = (cs_gztell_t *)gztell;
 
 #endif /* HAVE_ZLIB */
 
+/* Asynchronous writes */
+
+static size_t            _async_max_size = 256*1024*1024;
+static _async_writer_t  *_async_writer = nullptr;
+
+/* Staging (burst buffer) directory and prefetched files */
+
+static char             *_staging_dir = nullptr;
+static int               _n_prefetched = 0;
+static char            **_prefetched = nullptr;
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -340,7 +429,9 @@ const char  *cs_file_access_name[]
      N_("standard input and output, parallel access"),
      N_("non-collective MPI-IO, independent file open/close"),
      N_("non-collective MPI-IO, collective file open/close"),
-     N_("collective MPI-IO")};
+     N_("collective MPI-IO"),
+     N_("in memory, serial access"),
+     N_("memory-mapped, parallel access")};
 
 /* names associated with MPI-IO positioning */
 
@@ -375,6 +466,16 @@ _access_method(cs_file_access_t  m,
   if (_m == CS_FILE_IN_MEMORY_SERIAL)
     return _m;
 
+  /* Memory-mapped access is only used for reading */
+
+  if (_m == CS_FILE_MMAP) {
+#if defined(CS_FILE_USE_MMAP)
+    if (!w)
+      return _m;
+#endif
+    _m = CS_FILE_STDIO_PARALLEL;
+  }
+
   /* Handle default */
 
   if (_m == CS_FILE_DEFAULT) {
@@ -573,6 +674,468 @@ _swap_endian(void        *dest,
     memcpy(dest, src, ni);
 }
 
+/*----------------------------------------------------------------------------
+ * Copy a file using standard C IO.
+ *
+ * As this function may be called by the asynchronous writer's helper
+ * thread, it uses the standard C library allocators and does not
+ * handle errors itself.
+ *
+ * parameters:
+ *   src  <-- source file path
+ *   dest <-- destination file path
+ *
+ * returns:
+ *   0 in case of success, error number in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_copy_file(const char  *src,
+           const char  *dest)
+{
+  int retval = 0;
+
+  FILE *sh_src = fopen(src, "rb");
+  if (sh_src == nullptr)
+    return errno;
+
+  FILE *sh_dest = fopen(dest, "wb");
+  if (sh_dest == nullptr) {
+    retval = errno;
+    fclose(sh_src);
+    return retval;
+  }
+
+  const size_t buf_size = 8*1024*1024;
+  unsigned char *buf = (unsigned char *)malloc(buf_size);
+
+  if (buf == nullptr)
+    retval = ENOMEM;
+
+  while (retval == 0) {
+    size_t n = fread(buf, 1, buf_size, sh_src);
+    if (n > 0 && fwrite(buf, 1, n, sh_dest) != n)
+      retval = (ferror(sh_dest) != 0) ? errno : -1;
+    if (n < buf_size) {
+      if (ferror(sh_src) != 0)
+        retval = errno;
+      break;
+    }
+  }
+
+  free(buf);
+
+  fclose(sh_src);
+  if (fclose(sh_dest) != 0 && retval == 0)
+    retval = errno;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Apply an asynchronous write operation.
+ *
+ * This function is called by the asynchronous writer's helper thread only.
+ *
+ * parameters:
+ *   op <-- pointer to operation
+ *
+ * returns:
+ *   0 in case of success, error number in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_async_apply(const _async_op_t  *op)
+{
+  int retval = 0;
+
+  switch(op->type) {
+
+  case CS_FILE_ASYNC_WRITE:
+    if (fwrite(op->data, 1, op->size, op->sh) != op->size)
+      retval = (ferror(op->sh) != 0) ? errno : -1;
+    break;
+
+  case CS_FILE_ASYNC_SEEK:
+#if (SIZEOF_LONG < 8) && defined(HAVE_FSEEKO) && (_FILE_OFFSET_BITS == 64)
+    if (fseeko(op->sh, (off_t)(op->offset), op->whence) != 0)
+      retval = errno;
+#else
+    if (fseek(op->sh, (long)(op->offset), op->whence) != 0)
+      retval = errno;
+#endif
+    break;
+
+  case CS_FILE_ASYNC_CLOSE:
+    if (fclose(op->sh) != 0)
+      retval = errno;
+    break;
+
+  case CS_FILE_ASYNC_COPY:
+    if (op->stage_in)
+      retval = _copy_file(op->name, op->path);
+    else {
+      retval = _copy_file(op->path, op->name);
+      if (retval == 0)
+        remove(op->path);
+    }
+    break;
+
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Main loop of the asynchronous writer's helper thread.
+ *
+ * As the memory management functions are not thread-safe, data and
+ * names handled by this thread use the standard C library allocators.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_worker(void)
+{
+  _async_writer_t *w = _async_writer;
+
+  std::unique_lock<std::mutex> lock(w->mutex);
+
+  while (true) {
+
+    w->cv.wait(lock, [w]{ return w->stop || !w->queue.empty(); });
+
+    if (w->queue.empty())
+      break;
+
+    _async_op_t op = w->queue.front();
+    w->queue.pop_front();
+    w->busy = true;
+    w->busy_name = op.name;
+
+    lock.unlock();
+
+    int errcode = _async_apply(&op);
+
+    lock.lock();
+
+    if (errcode != 0 && w->error == nullptr) {
+      const char *err_str = (errcode > 0) ? strerror(errcode) : "";
+      size_t l = strlen(op.name) + strlen(err_str) + 64;
+      w->error = (char *)malloc(l);
+      if (w->error != nullptr)
+        snprintf(w->error, l, "Error writing file \"%s\":\n\n  %s",
+                 op.name, err_str);
+    }
+
+    w->size -= op.size;
+    w->busy = false;
+    w->busy_name = nullptr;
+
+    free(op.data);
+    free(op.path);
+    if (op.type == CS_FILE_ASYNC_CLOSE || op.type == CS_FILE_ASYNC_COPY)
+      free(op.name);
+
+    w->cv.notify_all();
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Check for errors reported by the asynchronous writer.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_check_error(void)
+{
+  _async_writer_t *w = _async_writer;
+
+  if (w == nullptr)
+    return;
+
+  char *error = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(w->mutex);
+    error = w->error;
+    w->error = nullptr;
+  }
+
+  if (error != nullptr)
+    bft_error(__FILE__, __LINE__, 0, "%s", error);
+}
+
+/*----------------------------------------------------------------------------
+ * Check if asynchronous operations relative to a given file are pending.
+ *
+ * The writer's mutex must be locked by the caller.
+ *
+ * parameters:
+ *   name <-- file name, or nullptr for all files
+ *
+ * returns:
+ *   true if operations are pending
+ *----------------------------------------------------------------------------*/
+
+static bool
+_async_pending(const char  *name)
+{
+  _async_writer_t *w = _async_writer;
+
+  if (name == nullptr)
+    return (w->busy || !w->queue.empty());
+
+  if (w->busy && strcmp(w->busy_name, name) == 0)
+    return true;
+
+  for (const _async_op_t &op : w->queue) {
+    if (strcmp(op.name, name) == 0)
+      return true;
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of asynchronous operations relative to a given file.
+ *
+ * parameters:
+ *   name <-- file name, or nullptr for all files
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_wait(const char  *name)
+{
+  _async_writer_t *w = _async_writer;
+
+  if (w == nullptr)
+    return;
+
+  {
+    std::unique_lock<std::mutex> lock(w->mutex);
+    w->cv.wait(lock, [name]{ return !_async_pending(name); });
+  }
+
+  _async_check_error();
+}
+
+/*----------------------------------------------------------------------------
+ * Append an operation to the asynchronous writer's queue.
+ *
+ * The helper thread is started if not already running. If the queued
+ * data size would exceed the allowed maximum, this function waits for
+ * previous operations to complete first.
+ *
+ * parameters:
+ *   op <-- operation to append (ownership of data and names is transferred)
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_queue(const _async_op_t  &op)
+{
+  if (_async_writer == nullptr) {
+    _async_writer = new _async_writer_t;
+    _async_writer->size = 0;
+    _async_writer->busy_name = nullptr;
+    _async_writer->busy = false;
+    _async_writer->stop = false;
+    _async_writer->error = nullptr;
+    _async_writer->thread = std::thread(_async_worker);
+  }
+
+  _async_writer_t *w = _async_writer;
+  size_t size = op.size;
+
+  {
+    std::unique_lock<std::mutex> lock(w->mutex);
+    w->cv.wait(lock, [w, size]{ return (   w->size == 0
+                                        || w->size + size <= _async_max_size);
+                              });
+    w->size += size;
+    w->queue.push_back(op);
+  }
+
+  w->cv.notify_all();
+}
+
+/*----------------------------------------------------------------------------
+ * Queue an asynchronous write operation.
+ *
+ * If the queued data size would exceed the allowed maximum, this function
+ * waits for previous operations to complete first.
+ *
+ * parameters:
+ *   f    <-- pointer to file handler
+ *   type <-- operation type
+ *   data <-- data to write (copied), or nullptr
+ *   size <-- size of data to write, in bytes
+ *   offset <-- seek offset
+ *   whence <-- seek origin
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_push(cs_file_t         *f,
+            _async_op_type_t   type,
+            const void        *data,
+            size_t             size,
+            cs_file_off_t      offset,
+            int                whence)
+{
+  _async_check_error();
+
+  _async_op_t op;
+  op.type = type;
+  op.sh = f->sh;
+  op.name = f->async_name;
+  op.path = nullptr;
+  op.stage_in = false;
+  op.data = nullptr;
+  op.size = 0;
+  op.offset = offset;
+  op.whence = whence;
+
+  if (size > 0) {
+    op.data = (unsigned char *)malloc(size);
+    if (op.data == nullptr)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Failure to allocate %llu bytes for asynchronous write\n"
+                  "of file \"%s\"."),
+                (unsigned long long)size, f->name);
+    memcpy(op.data, data, size);
+    op.size = size;
+  }
+
+  _async_queue(op);
+}
+
+/*----------------------------------------------------------------------------
+ * Queue an asynchronous copy between a file and its staged copy.
+ *
+ * parameters:
+ *   name     <-- final file name (copied)
+ *   path     <-- staged file path (ownership transferred)
+ *   stage_in <-- if true, copy name to path (prefetch); otherwise,
+ *                copy path to name and remove path (drain)
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_push_copy(const char  *name,
+                 char        *path,
+                 bool         stage_in)
+{
+  _async_check_error();
+
+  _async_op_t op;
+  op.type = CS_FILE_ASYNC_COPY;
+  op.sh = nullptr;
+  op.name = (char *)malloc(strlen(name) + 1);
+  strcpy(op.name, name);
+  op.path = path;
+  op.stage_in = stage_in;
+  op.data = nullptr;
+  op.size = 0;
+  op.offset = 0;
+  op.whence = 0;
+
+  _async_queue(op);
+}
+
+/*----------------------------------------------------------------------------
+ * Build the path of the staged copy of a file.
+ *
+ * Directory separators in the file name are replaced, so that all staged
+ * files are placed directly in the staging directory.
+ *
+ * parameters:
+ *   name <-- file name
+ *
+ * returns:
+ *   staged file path, allocated with malloc()
+ *----------------------------------------------------------------------------*/
+
+static char *
+_staged_path(const char  *name)
+{
+  size_t l_dir = strlen(_staging_dir);
+  size_t l = strlen(name);
+
+  char *path = (char *)malloc(l_dir + l + 2);
+  strcpy(path, _staging_dir);
+  path[l_dir] = '/';
+  for (size_t i = 0; i < l; i++)
+    path[l_dir + 1 + i] = (name[i] == '/') ? '+' : name[i];
+  path[l_dir + 1 + l] = '\0';
+
+  return path;
+}
+
+/*----------------------------------------------------------------------------
+ * Return id of a prefetched file in the matching list.
+ *
+ * parameters:
+ *   name <-- file name
+ *
+ * returns:
+ *   id of file in list, or -1 if not prefetched
+ *----------------------------------------------------------------------------*/
+
+static int
+_prefetched_id(const char  *name)
+{
+  for (int i = 0; i < _n_prefetched; i++) {
+    if (strcmp(_prefetched[i], name) == 0)
+      return i;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Remove a file from the prefetched files list, and remove its staged copy.
+ *
+ * parameters:
+ *   id <-- id of file in list
+ *----------------------------------------------------------------------------*/
+
+static void
+_prefetched_remove(int  id)
+{
+  char *path = _staged_path(_prefetched[id]);
+  remove(path);
+  free(path);
+
+  BFT_FREE(_prefetched[id]);
+  for (int i = id + 1; i < _n_prefetched; i++)
+    _prefetched[i-1] = _prefetched[i];
+  _n_prefetched -= 1;
+
+  if (_n_prefetched == 0)
+    BFT_FREE(_prefetched);
+}
+
+/*----------------------------------------------------------------------------
+ * Complete pending asynchronous operations and stop the helper thread.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_finalize(void)
+{
+  _async_writer_t *w = _async_writer;
+
+  if (w == nullptr)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(w->mutex);
+    w->stop = true;
+  }
+  w->cv.notify_all();
+  w->thread.join();
+
+  _async_check_error();
+
+  _async_writer = nullptr;
+  delete w;
+}
+
 /*----------------------------------------------------------------------------
  * Open a file using standard C IO.
  *
@@ -593,6 +1156,28 @@ _file_open(cs_file_t  *f)
   if (f->sh != nullptr)
     return 0;
 
+  /* Complete pending asynchronous writes to the same file, if present */
+
+  _async_wait(f->name);
+
+  /* Use a staged (node-local) copy ? This is only done for the serial
+     method, for which only the writing or reading rank accesses the file */
+
+  const char *open_name = f->name;
+
+  if (_staging_dir != nullptr && f->method == CS_FILE_STDIO_SERIAL) {
+    int p_id = _prefetched_id(f->name);
+    if (f->mode == CS_FILE_MODE_WRITE) {
+      if (p_id > -1)
+        _prefetched_remove(p_id);
+      f->staged_name = _staged_path(f->name);
+    }
+    else if (f->mode == CS_FILE_MODE_READ && p_id > -1)
+      f->staged_name = _staged_path(f->name);
+    if (f->staged_name != nullptr)
+      open_name = f->staged_name;
+  }
+
   /* Compressed with gzip ? (currently for reading only) */
 
 #if defined(HAVE_ZLIB)
@@ -609,7 +1194,7 @@ _file_open(cs_file_t  *f)
       gzipped = true;
 
     if (gzipped) {
-      f->gzh = gzopen(f->name, "r");
+      f->gzh = gzopen(open_name, "r");
 
       if (f->gzh == nullptr) {
         const char *err_str
@@ -637,69 +1222,216 @@ _file_open(cs_file_t  *f)
     break;
   case CS_FILE_MODE_WRITE:
     if (f->rank == 0)
-      f->sh = fopen(f->name, "wb");
+      f->sh = fopen(open_name, "wb");
     else
       f->sh = fopen(f->name, "a+b");
     break;
   default:
     assert(f->mode == CS_FILE_MODE_READ);
-    f->sh = fopen(f->name, "rb");
+    f->sh = fopen(open_name, "rb");
   }
 
   if (f->sh == nullptr) {
     bft_error(__FILE__, __LINE__, 0,
               _("Error opening file \"%s\":\n\n"
+                "  %s"), open_name, strerror(errno));
+    retval = errno;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Close a file using standard C IO.
+ *
+ * parameters:
+ *   f <-> pointer to file handler
+ *
+ * returns:
+ *   0 in case of success, -1 in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_file_close(cs_file_t  *f)
+{
+  int retval = 0;
+
+  if (f->async_name != nullptr) {
+    _async_push(f, CS_FILE_ASYNC_CLOSE, nullptr, 0, 0, 0);
+    f->async_name = nullptr;
+    f->sh = nullptr;
+    retval = 0;
+  }
+
+  else if (f->sh != nullptr)
+    retval = fclose(f->sh);
+
+  /* Compressed with gzip ? (currently for reading only) */
+
+#if defined(HAVE_ZLIB)
+
+  else if (f->gzh != nullptr) {
+    retval = gzclose(f->gzh);
+    if (retval != 0) {
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error closing file \"%s\":\n\n"
+                  "  %s"), f->name, gzerror(f->gzh, &retval));
+      return retval;
+    }
+    f->gzh = nullptr;
+  }
+
+#endif
+
+  if (retval != 0) {
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error closing file \"%s\":\n\n"
                 "  %s"), f->name, strerror(errno));
     retval = errno;
   }
+  f->sh = nullptr;
+
+  /* Drain staged file to its final destination, or remove
+     prefetched copy once read */
+
+  if (f->staged_name != nullptr) {
+    if (f->mode == CS_FILE_MODE_READ) {
+      free(f->staged_name);
+      int p_id = _prefetched_id(f->name);
+      if (p_id > -1)
+        _prefetched_remove(p_id);
+    }
+    else
+      _async_push_copy(f->name, f->staged_name, false);
+    f->staged_name = nullptr;
+  }
 
   return retval;
 }
 
 /*----------------------------------------------------------------------------
- * Close a file using standard C IO.
+ * Map a file to memory (read mode only).
  *
  * parameters:
- *   f <-> pointer to file handler
+ *   f    <-- pointer to file handler
  *
  * returns:
- *   0 in case of success, -1 in case of failure
+ *   0 in case of success, error number in case of failure
  *----------------------------------------------------------------------------*/
 
 static int
-_file_close(cs_file_t  *f)
+_file_open_mmap(cs_file_t  *f)
 {
   int retval = 0;
 
-  if (f->sh != nullptr)
-    retval = fclose(f->sh);
+  assert(f != nullptr && f->mode == CS_FILE_MODE_READ);
 
-  /* Compressed with gzip ? (currently for reading only) */
+  /* Complete pending asynchronous writes to the same file, if present */
 
-#if defined(HAVE_ZLIB)
+  _async_wait(f->name);
 
-  else if (f->gzh != nullptr) {
-    retval = gzclose(f->gzh);
-    if (retval != 0) {
+#if defined(CS_FILE_USE_MMAP)
+
+  int fd = open(f->name, O_RDONLY);
+  struct stat buf;
+
+  if (fd < 0 || fstat(fd, &buf) != 0) {
+    retval = errno;
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error opening file \"%s\":\n\n"
+                "  %s"), f->name, strerror(errno));
+    if (fd > -1)
+      close(fd);
+    return retval;
+  }
+
+  f->map_size = buf.st_size;
+
+  if (f->map_size > 0) {
+    void *p = mmap(nullptr, f->map_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) {
+      retval = errno;
       bft_error(__FILE__, __LINE__, 0,
-                _("Error closing file \"%s\":\n\n"
-                  "  %s"), f->name, gzerror(f->gzh, &retval));
-      return retval;
+                _("Error mapping file \"%s\" to memory:\n\n"
+                  "  %s"), f->name, strerror(errno));
     }
-    f->gzh = nullptr;
+    else
+      f->map_data = (unsigned char *)p;
   }
 
+  close(fd);
+
+#endif /* defined(CS_FILE_USE_MMAP) */
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Unmap a memory-mapped file.
+ *
+ * parameters:
+ *   f <-> pointer to file handler
+ *----------------------------------------------------------------------------*/
+
+static void
+_file_close_mmap(cs_file_t  *f)
+{
+#if defined(CS_FILE_USE_MMAP)
+  if (f->map_data != nullptr)
+    munmap(f->map_data, f->map_size);
 #endif
 
-  if (retval != 0) {
-    bft_error(__FILE__, __LINE__, 0,
-              _("Error closing file \"%s\":\n\n"
-                "  %s"), f->name, strerror(errno));
-    retval = errno;
+  f->map_data = nullptr;
+  f->map_size = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Read data to a buffer from a memory-mapped file.
+ *
+ * parameters:
+ *   f      <-- cs_file_t descriptor
+ *   offset <-- position of data in file
+ *   buf    --> pointer to location receiving data
+ *   size   <-- size of each item of data in bytes
+ *   ni     <-- number of items to read
+ *
+ * returns:
+ *   the (local) number of items (not bytes) sucessfully read;
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_file_read_mmap(cs_file_t      *f,
+                cs_file_off_t   offset,
+                void           *buf,
+                size_t          size,
+                size_t          ni)
+{
+  size_t  nb = size*ni;
+
+  if (offset + nb > f->map_size) {
+    if (f->allow_eof) {
+      if (offset < (cs_file_off_t)f->map_size)
+        nb = f->map_size - offset;
+      else
+        nb = 0;
+      ni = nb/size;
+    }
+    else
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error reading from memory-mapped file \"%s\":\n\n"
+                  "  File size:          %llu\n"
+                  "  Current offset:     %llu\n"
+                  "  Required read size: %llu"),
+                f->name,
+                (unsigned long long)f->map_size,
+                (unsigned long long)offset,
+                (unsigned long long)nb);
   }
-  f->sh = nullptr;
 
-  return retval;
+  if (nb > 0)
+    memcpy(buf, f->map_data + offset, nb);
+
+  return ni;
 }
 
 /*----------------------------------------------------------------------------
@@ -775,6 +1507,9 @@ _file_read(cs_file_t  *f,
 {
   size_t retval = 0;
 
+  if (f->async_name != nullptr)
+    _async_wait(f->async_name);
+
   if (f->sh != nullptr) {
 
     if (ni != 0)
@@ -905,6 +1640,16 @@ _file_write(cs_file_t   *f,
 {
   size_t retval = 0;
 
+  if (f->async_name != nullptr) {
+    if (ni != 0) {
+      _async_push(f, CS_FILE_ASYNC_WRITE, buf, size*ni, 0, 0);
+      f->async_offset += (cs_file_off_t)(size*ni);
+      if (f->async_end < f->async_offset)
+        f->async_end = f->async_offset;
+    }
+    return ni;
+  }
+
   if (f->sh != nullptr) {
 
     if (ni != 0)
@@ -974,6 +1719,19 @@ _file_seek(cs_file_t       *f,
 
   assert(f != nullptr);
 
+  if (f->async_name != nullptr) {
+    _async_push(f, CS_FILE_ASYNC_SEEK, nullptr, 0, offset, _whence);
+    if (_whence == SEEK_SET)
+      f->async_offset = offset;
+    else if (_whence == SEEK_CUR)
+      f->async_offset += offset;
+    else
+      f->async_offset = f->async_end + offset;
+    if (f->async_end < f->async_offset)
+      f->async_end = f->async_offset;
+    return 0;
+  }
+
   if (f->sh != nullptr) {
 
 #if (SIZEOF_LONG < 8)
@@ -1060,6 +1818,12 @@ _file_tell(cs_file_t  *f)
 
   assert(f != nullptr);
 
+  /* With asynchronous writes, the position is tracked logically,
+     so as to avoid waiting for queued data */
+
+  if (f->async_name != nullptr)
+    return f->async_offset;
+
   if (f->sh != nullptr) {
 
     /* For 32-bit systems, large file support may be necessary */
@@ -2590,6 +3354,14 @@ cs_file_open(const char        *name,
   f->in_mem_max_size = 0;
   f->in_mem_data = nullptr;
 
+  f->async_name = nullptr;
+  f->async_offset = 0;
+  f->async_end = 0;
+  f->staged_name = nullptr;
+
+  f->map_data = nullptr;
+  f->map_size = 0;
+
   BFT_MALLOC(f->name, strlen(name) + 1, char);
   strcpy(f->name, name);
 
@@ -2634,6 +3406,10 @@ cs_file_open(const char        *name,
     if (f->n_ranks % n_io_ranks)
       f->rank_step += 1;
 
+    /* With memory mapping, each rank accesses its own block */
+    if (f->method == CS_FILE_MMAP)
+      f->rank_step = 1;
+
     f->block_size = nullptr;
     if (f->rank_step > 1) {
       if (f->io_comm != MPI_COMM_NULL)
@@ -2643,11 +3419,12 @@ cs_file_open(const char        *name,
     }
 
     if (   f->comm == MPI_COMM_NULL
-        && method != CS_FILE_IN_MEMORY_SERIAL)
+        && method != CS_FILE_IN_MEMORY_SERIAL
+        && f->method != CS_FILE_MMAP)
       f->method = CS_FILE_STDIO_SERIAL;
   }
 #else
-  if (method != CS_FILE_IN_MEMORY_SERIAL)
+  if (method != CS_FILE_IN_MEMORY_SERIAL && f->method != CS_FILE_MMAP)
     f->method = CS_FILE_STDIO_SERIAL;
 #endif
 
@@ -2668,6 +3445,9 @@ cs_file_open(const char        *name,
   if (f->method <= CS_FILE_STDIO_PARALLEL && f->rank == 0)
     errcode = _file_open(f);
 
+  else if (f->method == CS_FILE_MMAP)
+    errcode = _file_open_mmap(f);
+
 #if defined(HAVE_MPI_IO)
   if (f->method == CS_FILE_MPI_INDEPENDENT) {
     f->io_comm = MPI_COMM_SELF;
@@ -2675,7 +3455,7 @@ cs_file_open(const char        *name,
       errcode = _mpi_file_open(f, f->mode);
   }
   else if (   f->method > CS_FILE_MPI_INDEPENDENT
-           && f->method != CS_FILE_IN_MEMORY_SERIAL)
+           && f->method < CS_FILE_IN_MEMORY_SERIAL)
     errcode = _mpi_file_open(f, f->mode);
 #endif
 
@@ -2793,6 +3573,9 @@ cs_file_free(cs_file_t  *f)
   if (_f->sh != nullptr)
     _file_close(_f);
 
+  else if (_f->method == CS_FILE_MMAP)
+    _file_close_mmap(_f);
+
 #if defined(HAVE_MPI)
 #if defined(HAVE_MPI_IO)
   else if (_f->fh != MPI_FILE_NULL)
@@ -2956,6 +3739,184 @@ cs_file_set_swap_endian(cs_file_t  *f,
   f->swap_endian = swap;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable asynchronous writes for a file.
+ *
+ * Data written to the file is then copied to a queue, and the actual
+ * output is done by a helper thread, so that the calling code may
+ * continue computations while data is written.
+ *
+ * This is only possible for files opened in write or append mode using
+ * the CS_FILE_STDIO_SERIAL access method (so that only the rank actually
+ * writing data accesses the file). In other cases, this function has
+ * no effect.
+ *
+ * Errors encountered by the helper thread are reported at the next
+ * synchronization point (i.e. reopening the same file, or calling
+ * \ref cs_file_wait_async_writes).
+ *
+ * \param[in, out]  f  cs_file_t descriptor
+ *
+ * \return  true if asynchronous writes are enabled, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_file_set_async_write(cs_file_t  *f)
+{
+  assert(f != nullptr);
+
+  if (f->async_name != nullptr)
+    return true;
+
+  if (   _async_max_size == 0
+      || f->mode == CS_FILE_MODE_READ
+      || f->method != CS_FILE_STDIO_SERIAL)
+    return false;
+
+  /* Ranks not accessing the file have nothing to write */
+
+  if (f->sh == nullptr)
+    return false;
+
+  f->async_offset = _file_tell(f);
+  f->async_end = f->async_offset;
+  if (fseek(f->sh, 0, SEEK_END) == 0) {
+    f->async_end = _file_tell(f);
+    _file_seek(f, f->async_offset, CS_FILE_SEEK_SET);
+  }
+
+  f->async_name = (char *)malloc(strlen(f->name) + 1);
+  strcpy(f->async_name, f->name);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum size of data queued for asynchronous writes.
+ *
+ * When this size is reached, writes block until enough queued data is
+ * written. A size of 0 disables asynchronous writes.
+ *
+ * \param[in]  max_size  maximum queued data size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_async_write_max_size(size_t  max_size)
+{
+  _async_max_size = max_size;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for completion of all pending asynchronous writes.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_wait_async_writes(void)
+{
+  _async_wait(nullptr);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for completion of pending asynchronous writes to a given file.
+ *
+ * This should be called before renaming or removing a file which may
+ * have been written asynchronously.
+ *
+ * \param[in]  name  file name
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_wait_async_writes_to(const char  *name)
+{
+  if (name != nullptr)
+    _async_wait(name);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a staging directory for files using the serial stdio method.
+ *
+ * This directory is intended to be on node-local storage (such as tmpfs
+ * or NVMe, used as a burst buffer). When defined, files opened in write
+ * mode using the CS_FILE_STDIO_SERIAL access method are written to
+ * this directory first, at local storage bandwidth, and copied to
+ * their final location by the asynchronous writer's helper thread
+ * once closed. Other accesses to the same file name (reopening,
+ * \ref cs_file_wait_async_writes_to) wait for this copy to complete.
+ *
+ * Files prefetched using \ref cs_file_prefetch are also copied to
+ * this directory, and read from there.
+ *
+ * This function should be called only when no file is open, and with the
+ * same arguments on all ranks (though only the rank accessing files
+ * actually uses the directory).
+ *
+ * \param[in]  path  staging directory path, or nullptr to disable staging
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_staging_dir(const char  *path)
+{
+  _async_wait(nullptr);
+
+  while (_n_prefetched > 0)
+    _prefetched_remove(_n_prefetched - 1);
+
+  BFT_FREE(_staging_dir);
+
+  if (path != nullptr) {
+    BFT_MALLOC(_staging_dir, strlen(path) + 1, char);
+    strcpy(_staging_dir, path);
+    if (cs_glob_rank_id < 1)
+      cs_file_mkdir_default(_staging_dir);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Prefetch a file to the staging directory.
+ *
+ * The file is copied to the staging directory defined by
+ * \ref cs_file_set_staging_dir by the asynchronous writer's helper
+ * thread, so that computations may proceed in the meantime. When the
+ * file is later opened in read mode with the CS_FILE_STDIO_SERIAL access
+ * method, the staged copy is read instead (waiting for the copy to
+ * complete if needed), and removed when the file is closed.
+ *
+ * This function is local, and only has an effect on rank 0 (which is the
+ * only rank reading files with the serial method). If no staging
+ * directory is defined or the file does not exist, it has no effect.
+ *
+ * \param[in]  name  name of file to prefetch
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_prefetch(const char  *name)
+{
+  if (   _staging_dir == nullptr || cs_glob_rank_id > 0
+      || _prefetched_id(name) > -1 || cs_file_isreg(name) == 0)
+    return;
+
+  _async_wait(name);
+
+  BFT_REALLOC(_prefetched, _n_prefetched + 1, char *);
+  BFT_MALLOC(_prefetched[_n_prefetched], strlen(name) + 1, char);
+  strcpy(_prefetched[_n_prefetched], name);
+  _n_prefetched += 1;
+
+  _async_push_copy(name, _staged_path(name), true);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read global data from a file, distributing it to all processes
@@ -2989,6 +3950,13 @@ cs_file_read_global(cs_file_t  *f,
     }
   }
 
+  /* With memory mapping, each rank reads the data directly */
+
+  else if (f->method == CS_FILE_MMAP) {
+    retval = _file_read_mmap(f, f->offset, buf, size, ni);
+    ni = retval;
+  }
+
 #if defined(HAVE_MPI_IO)
 
   else if ((f->method > CS_FILE_STDIO_PARALLEL)) {
@@ -3036,7 +4004,7 @@ cs_file_read_global(cs_file_t  *f,
 #endif /* defined(HAVE_MPI_IO) */
 
 #if defined(HAVE_MPI)
-  if (f->comm != MPI_COMM_NULL) {
+  if (f->comm != MPI_COMM_NULL && f->method != CS_FILE_MMAP) {
     long _retval = retval;
     MPI_Bcast(buf, size*ni, MPI_BYTE, 0, f->comm);
     MPI_Bcast(&_retval, 1, MPI_LONG, 0, f->comm);
@@ -3256,6 +4224,14 @@ cs_file_read_block(cs_file_t  *f,
                                 _global_num_end);
     break;
 
+  case CS_FILE_MMAP:
+    retval = _file_read_mmap(f,
+                             f->offset + (_global_num_start - 1)*size,
+                             _buf,
+                             size,
+                             _global_num_end - _global_num_start);
+    break;
+
 #if defined(HAVE_MPI_IO)
 
   case CS_FILE_MPI_INDEPENDENT:
@@ -3314,6 +4290,121 @@ cs_file_read_block(cs_file_t  *f,
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return a view of global data in a memory-mapped file.
+ *
+ * If the file is memory-mapped (using the CS_FILE_MMAP access method),
+ * no endianness conversion is required, and the data position is
+ * aligned with its item size, a pointer to the mapped data is returned,
+ * and the file position is updated as with \ref cs_file_read_global.
+ * Otherwise, nullptr is returned and the file position is unchanged,
+ * so that the caller may fall back to \ref cs_file_read_global.
+ *
+ * As this decision depends only on global values, all ranks take the
+ * same path. The returned pointer remains valid until the file is closed.
+ *
+ * \param[in]  f     cs_file_t descriptor
+ * \param[in]  size  size of each item of data in bytes
+ * \param[in]  ni    number of items to read
+ *
+ * \return pointer to mapped data, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+const void *
+cs_file_read_global_view(cs_file_t  *f,
+                         size_t      size,
+                         size_t      ni)
+{
+  if (   f->method != CS_FILE_MMAP
+      || (f->swap_endian == true && size > 1)
+      || f->offset % size != 0)
+    return nullptr;
+
+  cs_file_off_t offset = f->offset;
+
+  if (offset + size*ni > f->map_size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error reading from memory-mapped file \"%s\":\n\n"
+                "  File size:          %llu\n"
+                "  Current offset:     %llu\n"
+                "  Required read size: %llu"),
+              f->name,
+              (unsigned long long)f->map_size,
+              (unsigned long long)offset,
+              (unsigned long long)(size*ni));
+
+  f->offset += (cs_file_off_t)ni * (cs_file_off_t)size;
+
+  return f->map_data + offset;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return a view of a process's block of data in a memory-mapped file.
+ *
+ * This function is similar to \ref cs_file_read_global_view, and
+ * falls back in the same manner; when a view is returned, the file position
+ * is updated as with \ref cs_file_read_block.
+ *
+ * This function is collective.
+ *
+ * \param[in]  f                 cs_file_t descriptor
+ * \param[in]  size              size of each item of data in bytes
+ * \param[in]  stride            number of (interlaced) values per block item
+ * \param[in]  global_num_start  global number of first block item
+ *                               (1 to n numbering)
+ * \param[in]  global_num_end    global number of past-the end block item
+ *                               (1 to n numbering)
+ *
+ * \return pointer to mapped data, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+const void *
+cs_file_read_block_view(cs_file_t  *f,
+                        size_t      size,
+                        size_t      stride,
+                        cs_gnum_t   global_num_start,
+                        cs_gnum_t   global_num_end)
+{
+  if (   f->method != CS_FILE_MMAP
+      || (f->swap_endian == true && size > 1)
+      || f->offset % size != 0)
+    return nullptr;
+
+  assert(global_num_end >= global_num_start);
+
+  cs_gnum_t global_num_end_last = global_num_end;
+
+  cs_file_off_t offset
+    = f->offset + (cs_file_off_t)((global_num_start - 1) * size * stride);
+  size_t nb = (global_num_end - global_num_start) * size * stride;
+
+  if (nb > 0 && offset + nb > f->map_size)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error reading from memory-mapped file \"%s\":\n\n"
+                "  File size:          %llu\n"
+                "  Current offset:     %llu\n"
+                "  Required read size: %llu"),
+              f->name,
+              (unsigned long long)f->map_size,
+              (unsigned long long)offset,
+              (unsigned long long)nb);
+
+  /* Update offset */
+
+#if defined(HAVE_MPI)
+  if (f->n_ranks > 1)
+    MPI_Bcast(&global_num_end_last, 1, CS_MPI_GNUM, f->n_ranks-1, f->comm);
+#endif
+
+  f->offset += ((global_num_end_last - 1) * size * stride);
+
+  return f->map_data + offset;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Write data to a file, each associated process providing a
@@ -3615,6 +4706,9 @@ cs_file_seek(cs_file_t       *f,
     if (f->sh != nullptr)
       f->offset = cs_file_tell(f) + offset;
 
+    else if (f->method == CS_FILE_MMAP)
+      f->offset = f->map_size + offset;
+
 #if defined(HAVE_MPI_IO)
     if (f->fh != MPI_FILE_NULL) {
       MPI_Offset f_size = 0;
@@ -3842,6 +4936,12 @@ cs_file_dump(const cs_file_t  *f)
 void
 cs_file_free_defaults(void)
 {
+  _async_finalize();
+
+  while (_n_prefetched > 0)
+    _prefetched_remove(_n_prefetched - 1);
+  BFT_FREE(_staging_dir);
+
   _mpi_io_positioning = CS_FILE_MPI_EXPLICIT_OFFSETS;
 
   _default_access_r = CS_FILE_DEFAULT;
@@ -4272,7 +5372,7 @@ cs_file_defaults_info(void)
                                &hints);
 
 #if defined(HAVE_MPI_IO)
-    if (method > CS_FILE_STDIO_PARALLEL) {
+    if (method > CS_FILE_STDIO_PARALLEL && method < CS_FILE_IN_MEMORY_SERIAL) {
       for (log_id = 0; log_id < 2; log_id++)
         cs_log_printf(logs[log_id],
                       _(fmt[mode + 2]),
@@ -4280,7 +5380,8 @@ cs_file_defaults_info(void)
                       _(cs_file_mpi_positioning_name[_mpi_io_positioning]));
     }
 #endif
-    if (method <= CS_FILE_STDIO_PARALLEL) {
+    if (   method <= CS_FILE_STDIO_PARALLEL
+        || method >= CS_FILE_IN_MEMORY_SERIAL) {
       for (log_id = 0; log_id < 2; log_id++)
         cs_log_printf(logs[log_id],
                       _(fmt[mode]), _(cs_file_access_name[method]));
@@ -4320,6 +5421,12 @@ cs_file_defaults_info(void)
                     _("  I/O rank step:        %d\n"), block_rank_step);
   }
 
+  if (_staging_dir != nullptr) {
+    for (log_id = 0; log_id < 2; log_id++)
+      cs_log_printf(logs[log_id],
+                    _("  I/O staging dir.:     %s\n"), _staging_dir);
+  }
+
   cs_log_printf(CS_LOG_PERFORMANCE, "\n");
   cs_log_separator(CS_LOG_PERFORMANCE);
 
@@ -89,7 +89,8 @@ typedef enum {
   CS_FILE_MPI_INDEPENDENT,
   CS_FILE_MPI_NON_COLLECTIVE,
   CS_FILE_MPI_COLLECTIVE,
-  CS_FILE_IN_MEMORY_SERIAL
+  CS_FILE_IN_MEMORY_SERIAL,
+  CS_FILE_MMAP
 
 } cs_file_access_t;
 
@@ -315,6 +316,100 @@ void
 cs_file_set_swap_endian(cs_file_t  *f,
                         int         swap);
 
+/*----------------------------------------------------------------------------
+ * Enable asynchronous writes for a file.
+ *
+ * Data written to the file is then copied to a queue, and the actual
+ * output is done by a helper thread, so that the calling code may
+ * continue computations while data is written.
+ *
+ * This is only possible for files opened in write or append mode using
+ * the CS_FILE_STDIO_SERIAL access method (so that only the rank actually
+ * writing data accesses the file). In other cases, this function has
+ * no effect.
+ *
+ * Errors encountered by the helper thread are reported at the next
+ * synchronization point (i.e. reopening the same file, or calling
+ * cs_file_wait_async_writes()).
+ *
+ * parameters:
+ *   f <-> cs_file_t descriptor
+ *
+ * returns:
+ *   true if asynchronous writes are enabled, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_file_set_async_write(cs_file_t  *f);
+
+/*----------------------------------------------------------------------------
+ * Set the maximum size of data queued for asynchronous writes.
+ *
+ * When this size is reached, writes block until enough queued data is
+ * written. A size of 0 disables asynchronous writes.
+ *
+ * parameters:
+ *   max_size <-- maximum queued data size, in bytes
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_async_write_max_size(size_t  max_size);
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of all pending asynchronous writes.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_wait_async_writes(void);
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of pending asynchronous writes to a given file.
+ *
+ * This should be called before renaming or removing a file which may
+ * have been written asynchronously.
+ *
+ * parameters:
+ *   name <-- file name
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_wait_async_writes_to(const char  *name);
+
+/*----------------------------------------------------------------------------
+ * Define a staging directory for files using the serial stdio method.
+ *
+ * This directory is intended to be on node-local storage (such as tmpfs
+ * or NVMe, used as a burst buffer). When defined, files opened in write
+ * mode using the CS_FILE_STDIO_SERIAL access method are written to
+ * this directory first, and copied to their final location by the
+ * asynchronous writer's helper thread once closed.
+ *
+ * Files prefetched using cs_file_prefetch() are also copied to
+ * this directory, and read from there.
+ *
+ * parameters:
+ *   path <-- staging directory path, or NULL to disable staging
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_staging_dir(const char  *path);
+
+/*----------------------------------------------------------------------------
+ * Prefetch a file to the staging directory.
+ *
+ * The file is copied in the background; when it is later opened in read
+ * mode with the CS_FILE_STDIO_SERIAL access method, the staged copy is
+ * read instead, and removed when the file is closed.
+ *
+ * This function is local, and only has an effect on rank 0.
+ *
+ * parameters:
+ *   name <-- name of file to prefetch
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_prefetch(const char  *name);
+
 /*----------------------------------------------------------------------------
  * Read global data from a file, distributing it to all processes
  * associated with that file.
@@ -392,6 +487,55 @@ cs_file_read_block(cs_file_t  *f,
                    cs_gnum_t   global_num_start,
                    cs_gnum_t   global_num_end);
 
+/*----------------------------------------------------------------------------
+ * Return a view of global data in a memory-mapped file.
+ *
+ * If the file is memory-mapped (using the CS_FILE_MMAP access method),
+ * no endianness conversion is required, and the data position is
+ * aligned with its item size, a pointer to the mapped data is returned,
+ * and the file position is updated as with cs_file_read_global().
+ * Otherwise, NULL is returned and the file position is unchanged.
+ *
+ * parameters:
+ *   f    <-- cs_file_t descriptor
+ *   size <-- size of each item of data in bytes
+ *   ni   <-- number of items to read
+ *
+ * returns:
+ *   pointer to mapped data, or NULL
+ *----------------------------------------------------------------------------*/
+
+const void *
+cs_file_read_global_view(cs_file_t  *f,
+                         size_t      size,
+                         size_t      ni);
+
+/*----------------------------------------------------------------------------
+ * Return a view of a process's block of data in a memory-mapped file.
+ *
+ * This function is similar to cs_file_read_global_view(), and falls back
+ * in the same manner; when a view is returned, the file position is
+ * updated as with cs_file_read_block().
+ *
+ * parameters:
+ *   f                <-- cs_file_t descriptor
+ *   size             <-- size of each item of data in bytes
+ *   stride           <-- number of (interlaced) values per block item
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *
+ * returns:
+ *   pointer to mapped data, or NULL
+ *----------------------------------------------------------------------------*/
+
+const void *
+cs_file_read_block_view(cs_file_t  *f,
+                        size_t      size,
+                        size_t      stride,
+                        cs_gnum_t   global_num_start,
+                        cs_gnum_t   global_num_end);
+
 /*----------------------------------------------------------------------------
  * Write data to a file, each associated process providing a contiguous part
  * of this data.
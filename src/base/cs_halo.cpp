@@ -62,6 +62,8 @@
 
 #if defined(HAVE_CUDA)
 #include "cs_halo_cuda.h"
+#elif defined(SYCL_LANGUAGE_VERSION)
+#include "cs_dispatch.h"
 #endif
 
 /*----------------------------------------------------------------------------*/
@@ -87,16 +89,91 @@ BEGIN_C_DECLS
  * some publications report better performance with RMA for large data,
  * and better performance with P2P for small data, so in uses such
  * as multigrid solvers, either may be preferred for different levels.
+ *
+ * The persistent point-to-point mode caches MPI_Send_init/MPI_Recv_init
+ * requests in each halo state, for a given halo, datatype, stride and
+ * send buffer. As requests are bound to their receive addresses,
+ * ghost values are received in a buffer maintained by the state, and
+ * copied to the updated array upon completion.
+ *
+ * The node-local peer mode replaces MPI messages between ranks on the
+ * same node by direct device-to-device copies for data on device:
+ * the packed send buffer is copied to a device allocation exported
+ * through CUDA IPC, whose handle (and a generation number, so that
+ * mappings can be cached) is sent to peer ranks in place of the data.
+ * Receiving ranks then copy their ghost values directly from the peer's
+ * buffer (using NVLink or PCIe peer transfers when available), and
+ * notify the owner with an empty message, so that the buffer is not
+ * overwritten before all peers are done.
 */
 
 /*=============================================================================
  * Local macro definitions
  *============================================================================*/
 
+/* Maximum number of cached persistent request sets per halo state */
+
+#define CS_HALO_N_PERSISTENT_MAX 16
+
+/* Number of cached node-local peer buffer mappings per peer rank */
+
+#define CS_HALO_N_PEER_CACHE 4
+
+/* Size of device memory handles exchanged with node-local peers */
+
+#define CS_HALO_PEER_HANDLE_SIZE 64
+
 /*=============================================================================
  * Local type definitions
  *============================================================================*/
 
+#if defined(HAVE_MPI)
+
+/* Set of persistent requests for a given exchange pattern */
+
+typedef struct {
+
+  const cs_halo_t  *halo;          /* Associated halo */
+  cs_halo_type_t    sync_mode;     /* Standard or extended */
+  cs_datatype_t     data_type;     /* Datatype */
+  int               stride;        /* Number of values per location */
+
+  const void       *send_buffer;   /* Associated send buffer */
+  const void       *recv_buffer;   /* Associated receive buffer */
+
+  int               n_requests;    /* Number of MPI requests */
+  MPI_Request      *request;       /* Array of persistent MPI requests */
+
+  unsigned long     last_use;      /* Use counter when last started */
+
+} cs_halo_persistent_t;
+
+#endif
+
+#if defined(HAVE_MPI)
+
+/* Info on a device buffer exported to node-local peers */
+
+typedef struct {
+
+  unsigned long long  gen;      /* Generation number (unique for a
+                                   given rank and allocation) */
+  unsigned char       handle[CS_HALO_PEER_HANDLE_SIZE];  /* Memory handle */
+
+} cs_halo_peer_info_t;
+
+/* Cached mappings of buffers of a given node-local peer */
+
+typedef struct {
+
+  unsigned long long  gen[CS_HALO_N_PEER_CACHE];       /* Generation */
+  void               *ptr[CS_HALO_N_PEER_CACHE];       /* Mapped pointer */
+  unsigned long       last_use[CS_HALO_N_PEER_CACHE];  /* Use counter */
+
+} cs_halo_peer_cache_t;
+
+#endif
+
 /* Structure to maintain halo exchange state */
 
 struct _cs_halo_state_t {
@@ -134,6 +211,34 @@ struct _cs_halo_state_t {
 
   MPI_Win       win;              /* MPI-3 RMA window */
 
+  /* Persistent requests (for CS_HALO_COMM_P2P_PERSISTENT mode) */
+
+  int           n_p_sets;         /* Number of cached request sets */
+  int           p_set_cur;        /* Id of active set, or -1 */
+  unsigned long p_use_count;      /* Counter for set replacement */
+
+  cs_halo_persistent_t  p_sets[CS_HALO_N_PERSISTENT_MAX];
+
+  size_t           p_recv_buffer_size;      /* Size of persistent receive
+                                               buffer, in bytes */
+  cs_alloc_mode_t  p_recv_buffer_location;  /* Allocation mode for
+                                               persistent receive buffer */
+  void            *p_recv_buffer;           /* Persistent receive buffer,
+                                               or nullptr */
+  void            *p_recv_dest;             /* Destination of values received
+                                               in persistent buffer, if used */
+
+  /* Node-local peer copies (for CS_HALO_COMM_P2P_NODE_PEER mode) */
+
+  bool                  use_peers;         /* Use peer copies for current
+                                              exchange ? */
+  size_t                peer_buffer_size;  /* Size of exported buffer,
+                                              in bytes */
+  void                 *peer_buffer;       /* Exported device buffer */
+  cs_halo_peer_info_t   peer_info;         /* Info on exported buffer */
+  int                   peer_recv_size;    /* Size of peer_recv_info */
+  cs_halo_peer_info_t  *peer_recv_info;    /* Info received from peers */
+
 #endif
 
 };
@@ -159,9 +264,28 @@ static int _halo_use_barrier = false;
 /* Default halo state handler */
 static cs_halo_state_t *_halo_state = nullptr;
 
+/* Created halo states, so that cached persistent requests can be
+   purged when a halo is destroyed */
+static int               _n_halo_states = 0;
+static cs_halo_state_t **_halo_states = nullptr;
+
 /* Halo communications mode */
 static cs_halo_comm_mode_t _halo_comm_mode = CS_HALO_COMM_P2P;
 
+#if defined(HAVE_MPI)
+
+/* Node-local communicator and cached peer buffer mappings
+   (for CS_HALO_COMM_P2P_NODE_PEER mode) */
+static MPI_Comm               _node_comm = MPI_COMM_NULL;
+static int                    _node_n_ranks = 0;
+static cs_halo_peer_cache_t  *_peer_cache = nullptr;
+static unsigned long          _peer_use_count = 0;
+#if defined(HAVE_CUDA)
+static unsigned long long     _peer_buffer_gen = 0;
+#endif
+
+#endif
+
 END_C_DECLS
 
 /*============================================================================
@@ -236,6 +360,259 @@ _update_requests(const cs_halo_t  *halo,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Free a set of persistent requests.
+ *
+ * parameters:
+ *   ps <-> pointer to persistent requests set
+ *---------------------------------------------------------------------------*/
+
+static void
+_persistent_set_free(cs_halo_persistent_t  *ps)
+{
+  for (int i = 0; i < ps->n_requests; i++) {
+    if (ps->request[i] != MPI_REQUEST_NULL)
+      MPI_Request_free(&(ps->request[i]));
+  }
+  BFT_FREE(ps->request);
+
+  ps->halo = nullptr;
+  ps->n_requests = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Purge persistent requests associated with a given halo (or all
+ * requests if halo is null) from a halo state.
+ *
+ * parameters:
+ *   hs   <-> pointer to halo state structure
+ *   halo <-- pointer to associated halo, or nullptr for all
+ *---------------------------------------------------------------------------*/
+
+static void
+_persistent_purge(cs_halo_state_t  *hs,
+                  const cs_halo_t  *halo)
+{
+  int j = 0;
+  for (int i = 0; i < hs->n_p_sets; i++) {
+    if (halo == nullptr || hs->p_sets[i].halo == halo)
+      _persistent_set_free(hs->p_sets + i);
+    else
+      hs->p_sets[j++] = hs->p_sets[i];
+  }
+  hs->n_p_sets = j;
+  hs->p_set_cur = -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Start halo exchange using persistent requests, building them first
+ * if no matching cached set is available.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   send_buf  <-- pointer to packed send buffer (device or host)
+ *   val_dest  <-- pointer to ghost section of updated array
+ *   recv_dest <-- pointer to destination of received values (ghost section
+ *                 of updated array, or state-owned staging buffer)
+ *   hs        <-> pointer to halo state structure
+ *---------------------------------------------------------------------------*/
+
+static void
+_halo_sync_start_persistent(const cs_halo_t  *halo,
+                            unsigned char    *send_buf,
+                            unsigned char    *val_dest,
+                            unsigned char    *recv_dest,
+                            cs_halo_state_t  *hs)
+{
+  cs_lnum_t end_shift = (hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+  cs_lnum_t stride = hs->stride;
+  size_t elt_size = cs_datatype_size[hs->data_type] * stride;
+
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  /* Requests are bound to their receive addresses, so values are received
+     in a state-owned buffer when the array itself is the destination */
+
+  unsigned char *recv_buf = recv_dest;
+  hs->p_recv_dest = nullptr;
+
+  if (recv_dest == val_dest) {
+    size_t recv_size = halo->n_elts[CS_HALO_EXTENDED] * elt_size;
+    cs_alloc_mode_t recv_location = CS_ALLOC_HOST;
+#if defined(HAVE_ACCEL)
+    if (hs->var_location > CS_ALLOC_HOST && cs_mpi_device_support)
+      recv_location = CS_ALLOC_DEVICE;
+#endif
+    if (   recv_size > hs->p_recv_buffer_size
+        || recv_location != hs->p_recv_buffer_location) {
+      hs->p_recv_buffer_size = CS_MAX(recv_size, hs->p_recv_buffer_size);
+      hs->p_recv_buffer_location = recv_location;
+      CS_FREE_HD(hs->p_recv_buffer);
+      CS_MALLOC_HD(hs->p_recv_buffer, hs->p_recv_buffer_size, unsigned char,
+                   recv_location);
+    }
+    recv_buf = (unsigned char *)hs->p_recv_buffer;
+    hs->p_recv_dest = val_dest;
+  }
+
+  /* Look for matching set of requests */
+
+  int set_id = -1;
+
+  for (int i = 0; i < hs->n_p_sets; i++) {
+    const cs_halo_persistent_t *ps = hs->p_sets + i;
+    if (   ps->halo == halo
+        && ps->sync_mode == hs->sync_mode
+        && ps->data_type == hs->data_type
+        && ps->stride == stride
+        && ps->send_buffer == send_buf
+        && ps->recv_buffer == recv_buf) {
+      set_id = i;
+      break;
+    }
+  }
+
+  /* Build new set if needed, replacing the least recently used one
+     if the cache is full */
+
+  if (set_id < 0) {
+
+    if (hs->n_p_sets < CS_HALO_N_PERSISTENT_MAX)
+      set_id = hs->n_p_sets++;
+    else {
+      set_id = 0;
+      for (int i = 1; i < hs->n_p_sets; i++) {
+        if (hs->p_sets[i].last_use < hs->p_sets[set_id].last_use)
+          set_id = i;
+      }
+      _persistent_set_free(hs->p_sets + set_id);
+    }
+
+    cs_halo_persistent_t *ps = hs->p_sets + set_id;
+
+    ps->halo = halo;
+    ps->sync_mode = hs->sync_mode;
+    ps->data_type = hs->data_type;
+    ps->stride = stride;
+    ps->send_buffer = send_buf;
+    ps->recv_buffer = recv_buf;
+    ps->n_requests = 0;
+    BFT_MALLOC(ps->request, halo->n_c_domains*2, MPI_Request);
+
+    MPI_Datatype mpi_datatype = cs_datatype_to_mpi[hs->data_type];
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      cs_lnum_t length = (  halo->index[2*rank_id + end_shift]
+                          - halo->index[2*rank_id]) * stride;
+
+      if (halo->c_domain_rank[rank_id] != local_rank && length > 0) {
+        size_t start = (size_t)(halo->index[2*rank_id]);
+        MPI_Recv_init(recv_buf + start*elt_size,
+                      length,
+                      mpi_datatype,
+                      halo->c_domain_rank[rank_id],
+                      halo->c_domain_rank[rank_id],
+                      cs_glob_mpi_comm,
+                      &(ps->request[ps->n_requests++]));
+      }
+
+    }
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      cs_lnum_t start = halo->send_index[2*rank_id]*elt_size;
+      cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
+                          - halo->send_index[2*rank_id]);
+
+      if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
+        MPI_Send_init(send_buf + start,
+                      length*stride,
+                      mpi_datatype,
+                      halo->c_domain_rank[rank_id],
+                      local_rank,
+                      cs_glob_mpi_comm,
+                      &(ps->request[ps->n_requests++]));
+
+    }
+
+  }
+
+  /* Start exchange */
+
+  cs_halo_persistent_t *ps = hs->p_sets + set_id;
+
+  ps->last_use = hs->p_use_count++;
+  hs->p_set_cur = set_id;
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+    if (halo->c_domain_rank[rank_id] == local_rank)
+      hs->local_rank_id = rank_id;
+  }
+
+  if (_halo_use_barrier)
+    MPI_Barrier(cs_glob_mpi_comm);
+
+  if (ps->n_requests > 0)
+    MPI_Startall(ps->n_requests, ps->request);
+}
+
+/*----------------------------------------------------------------------------
+ * Complete halo exchange using persistent requests.
+ *
+ * parameters:
+ *   halo <-- pointer to halo structure
+ *   hs   <-> pointer to halo state structure
+ *---------------------------------------------------------------------------*/
+
+static void
+_halo_sync_wait_persistent(const cs_halo_t  *halo,
+                           cs_halo_state_t  *hs)
+{
+  cs_halo_persistent_t *ps = hs->p_sets + hs->p_set_cur;
+
+  if (ps->n_requests > 0)
+    MPI_Waitall(ps->n_requests, ps->request, hs->status);
+
+  hs->p_set_cur = -1;
+
+  if (hs->p_recv_dest == nullptr)
+    return;
+
+  /* Copy from receive buffer to ghost section of array */
+
+  cs_lnum_t end_shift = (hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+  size_t elt_size = cs_datatype_size[hs->data_type] * hs->stride;
+
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  unsigned char *dest = (unsigned char *)hs->p_recv_dest;
+  const unsigned char *src = (const unsigned char *)hs->p_recv_buffer;
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    if (halo->c_domain_rank[rank_id] == local_rank)
+      continue;
+
+    size_t start = (size_t)(halo->index[2*rank_id]) * elt_size;
+    size_t n_bytes = (  halo->index[2*rank_id + end_shift]
+                      - halo->index[2*rank_id]) * elt_size;
+
+    if (n_bytes == 0)
+      continue;
+
+    if (hs->p_recv_buffer_location == CS_ALLOC_HOST)
+      memcpy(dest + start, src + start, n_bytes);
+#if defined(HAVE_ACCEL)
+    else
+      cs_copy_d2d(dest + start, src + start, n_bytes);
+#endif
+
+  }
+
+  hs->p_recv_dest = nullptr;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Exchange send shift in send buffer for one-sided get.
@@ -288,6 +665,267 @@ _exchange_send_shift(cs_halo_t  *halo)
   BFT_FREE(status);
 }
 
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize node-local communicator and peer mapping cache.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_node_comm_init(void)
+{
+  if (_node_comm != MPI_COMM_NULL || cs_glob_n_ranks < 2)
+    return;
+
+#if (MPI_VERSION >= 3)
+  MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED, 0,
+                      MPI_INFO_NULL, &_node_comm);
+  MPI_Comm_size(_node_comm, &_node_n_ranks);
+
+  BFT_MALLOC(_peer_cache, _node_n_ranks, cs_halo_peer_cache_t);
+  for (int i = 0; i < _node_n_ranks; i++) {
+    for (int j = 0; j < CS_HALO_N_PEER_CACHE; j++) {
+      _peer_cache[i].gen[j] = 0;
+      _peer_cache[i].ptr[j] = nullptr;
+      _peer_cache[i].last_use[j] = 0;
+    }
+  }
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free node-local communicator and peer mapping cache.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_node_comm_finalize(void)
+{
+  if (_node_comm == MPI_COMM_NULL)
+    return;
+
+#if defined(HAVE_CUDA)
+  for (int i = 0; i < _node_n_ranks; i++) {
+    for (int j = 0; j < CS_HALO_N_PEER_CACHE; j++) {
+      if (_peer_cache[i].ptr[j] != nullptr)
+        cs_cuda_ipc_close_mem_handle(_peer_cache[i].ptr[j]);
+    }
+  }
+#endif
+
+  BFT_FREE(_peer_cache);
+  _node_n_ranks = 0;
+  _peer_use_count = 0;
+
+  MPI_Comm_free(&_node_comm);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build ranks of communicating domains in node-local communicator.
+ *
+ * Ranks not on the same node (or the local rank, handled through local
+ * copies) are set to -1.
+ *
+ * \param[in, out]  halo  halo structure to update
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_build_node_ranks(cs_halo_t  *halo)
+{
+  _node_comm_init();
+
+  if (_node_comm == MPI_COMM_NULL)
+    return;
+
+  BFT_REALLOC(halo->c_domain_node_rank, halo->n_c_domains, int);
+
+  MPI_Group glob_group, node_group;
+  MPI_Comm_group(cs_glob_mpi_comm, &glob_group);
+  MPI_Comm_group(_node_comm, &node_group);
+
+  MPI_Group_translate_ranks(glob_group,
+                            halo->n_c_domains,
+                            halo->c_domain_rank,
+                            node_group,
+                            halo->c_domain_node_rank);
+
+  MPI_Group_free(&node_group);
+  MPI_Group_free(&glob_group);
+
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  for (int i = 0; i < halo->n_c_domains; i++) {
+    if (   halo->c_domain_node_rank[i] == MPI_UNDEFINED
+        || halo->c_domain_rank[i] == local_rank)
+      halo->c_domain_node_rank[i] = -1;
+  }
+}
+
+#if defined(HAVE_CUDA)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Map a buffer exported by a node-local peer.
+ *
+ * Mappings are cached per peer rank, and the least recently used one
+ * replaced when needed.
+ *
+ * \param[in]  node_rank  rank of peer in node-local communicator
+ * \param[in]  info       info on exported buffer
+ *
+ * \return  mapped device pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+static void *
+_peer_map(int                         node_rank,
+          const cs_halo_peer_info_t  *info)
+{
+  cs_halo_peer_cache_t *pc = _peer_cache + node_rank;
+
+  _peer_use_count += 1;
+
+  int j_min = 0;
+  for (int j = 0; j < CS_HALO_N_PEER_CACHE; j++) {
+    if (pc->ptr[j] != nullptr && pc->gen[j] == info->gen) {
+      pc->last_use[j] = _peer_use_count;
+      return pc->ptr[j];
+    }
+    if (pc->last_use[j] < pc->last_use[j_min])
+      j_min = j;
+  }
+
+  if (pc->ptr[j_min] != nullptr)
+    cs_cuda_ipc_close_mem_handle(pc->ptr[j_min]);
+
+  pc->ptr[j_min] = cs_cuda_ipc_open_mem_handle(info->handle);
+  pc->gen[j_min] = info->gen;
+  pc->last_use[j_min] = _peer_use_count;
+
+  return pc->ptr[j_min];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy packed send data to device buffer exported to node-local peers.
+ *
+ * \param[in, out]  hs             pointer to halo state
+ * \param[in]       d_send_buffer  packed send data (on device)
+ * \param[in]       size           size of packed data, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_peer_export(cs_halo_state_t  *hs,
+             const void       *d_send_buffer,
+             size_t            size)
+{
+  if (hs->peer_buffer_size < size || hs->peer_buffer == nullptr) {
+    CS_FREE_HD(hs->peer_buffer);
+    hs->peer_buffer_size = CS_MAX(size, 1);
+    unsigned char *_peer_buffer;
+    CS_MALLOC_HD(_peer_buffer, hs->peer_buffer_size, unsigned char,
+                 CS_ALLOC_DEVICE);
+    hs->peer_buffer = _peer_buffer;
+
+    _peer_buffer_gen += 1;
+    hs->peer_info.gen = _peer_buffer_gen;
+    cs_cuda_ipc_get_mem_handle(hs->peer_buffer, hs->peer_info.handle);
+  }
+
+  if (size > 0)
+    cs_copy_d2d(hs->peer_buffer, d_send_buffer, size);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Copy ghost values from node-local peers' exported buffers.
+ *
+ * Peers are then notified that their buffer may be reused, and
+ * notifications from peers reading the local buffer are awaited.
+ *
+ * \param[in]       halo  pointer to halo structure
+ * \param[in, out]  val   pointer to variable value array
+ * \param[in, out]  hs    pointer to halo state
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_halo_sync_wait_peers(const cs_halo_t  *halo,
+                      void             *val,
+                      cs_halo_state_t  *hs)
+{
+  cs_lnum_t end_shift = (hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+  size_t elt_size = cs_datatype_size[hs->data_type] * hs->stride;
+  size_t n_loc_elts = halo->n_local_elts;
+
+  const int *node_rank = halo->c_domain_node_rank;
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  unsigned char *_val = (unsigned char *)cs_get_device_ptr(val);
+  unsigned char *_val_dest = _val + n_loc_elts*elt_size;
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    size_t length = (  halo->index[2*rank_id + end_shift]
+                     - halo->index[2*rank_id]) * elt_size;
+
+    if (length > 0 && node_rank[rank_id] > -1) {
+      const unsigned char *src
+        = (const unsigned char *)_peer_map(node_rank[rank_id],
+                                           hs->peer_recv_info + rank_id);
+      src += (size_t)(halo->c_domain_s_shift[rank_id]) * elt_size;
+      size_t start = (size_t)(halo->index[2*rank_id]) * elt_size;
+
+      cs_copy_d2d(_val_dest + start, src, length);
+    }
+
+  }
+
+  /* Copies are synchronous, so peers may be notified now */
+
+  int request_count = 0;
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t length = (  halo->index[2*rank_id + end_shift]
+                        - halo->index[2*rank_id]);
+
+    if (length > 0 && node_rank[rank_id] > -1)
+      MPI_Isend(nullptr, 0, MPI_BYTE,
+                halo->c_domain_rank[rank_id],
+                local_rank,
+                cs_glob_mpi_comm,
+                &(hs->request[request_count++]));
+
+  }
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
+                        - halo->send_index[2*rank_id]);
+
+    if (length > 0 && node_rank[rank_id] > -1)
+      MPI_Irecv(nullptr, 0, MPI_BYTE,
+                halo->c_domain_rank[rank_id],
+                halo->c_domain_rank[rank_id],
+                cs_glob_mpi_comm,
+                &(hs->request[request_count++]));
+
+  }
+
+  if (request_count > 0)
+    MPI_Waitall(request_count, hs->request, hs->status);
+
+  hs->use_peers = false;
+}
+
+#endif /* defined(HAVE_CUDA) */
+
 #endif /* HAVE_MPI */
 
 /*----------------------------------------------------------------------------
@@ -448,34 +1086,95 @@ _halo_sync_start_one_sided(const cs_halo_t  *halo,
 /*----------------------------------------------------------------------------*/
 
 static void
-_halo_sync_complete_one_sided(const cs_halo_t  *halo,
-                              void             *val,
-                              cs_halo_state_t  *hs)
+_halo_sync_complete_one_sided(const cs_halo_t  *halo,
+                              void             *val,
+                              cs_halo_state_t  *hs)
+{
+  /* Use active target synchronization */
+
+  /* Access Epoch */
+  if (halo->c_domain_group != MPI_GROUP_NULL) {
+    MPI_Win_complete(hs->win);
+
+    /* Complete RMA exposure epoch */
+    MPI_Win_wait(hs->win);
+  }
+  else {
+    MPI_Win_fence(0, hs->win);
+  }
+
+  /* Copy local values in case of periodicity */
+
+  if (hs->local_rank_id > -1) {
+    size_t elt_size = cs_datatype_size[hs->data_type] * hs->stride;
+    _sync_local(halo, hs->local_rank_id, hs->sync_mode, elt_size,
+                hs->var_location, hs->send_buffer_cur, val);
+  }
+}
+
+#endif /* (MPI_VERSION >= 3) */
+#endif /* defined(HAVE_MPI) */
+
+#if defined(SYCL_LANGUAGE_VERSION)
+
+/*----------------------------------------------------------------------------
+ * Pack halo data to send into dense buffer, using a device dispatch context.
+ *
+ * This is the portable counterpart of cs_halo_cuda_pack_send_buffer.
+ * The whole send list is gathered, even for standard synchronizations,
+ * so that a single flat loop is needed (extended values are not sent).
+ *
+ * parameters:
+ *   halo        <-- pointer to halo structure
+ *   data_type   <-- data type
+ *   stride      <-- number of (interlaced) values by entity
+ *   val         <-- pointer to value array (device)
+ *   send_buffer --> pointer to send buffer (device)
+ *----------------------------------------------------------------------------*/
+
+static void
+_pack_send_buffer_dispatch(const cs_halo_t  *halo,
+                           cs_datatype_t     data_type,
+                           cs_lnum_t         stride,
+                           const void       *val,
+                           void             *send_buffer)
 {
-  /* Use active target synchronization */
+  const cs_lnum_t n_send = halo->n_send_elts[1];
+  const cs_lnum_t *send_list = cs_get_device_ptr_const(halo->send_list);
 
-  /* Access Epoch */
-  if (halo->c_domain_group != MPI_GROUP_NULL) {
-    MPI_Win_complete(hs->win);
+  cs_dispatch_context ctx;
+
+  if (data_type == CS_REAL_TYPE) {
+
+    cs_real_t *buffer = (cs_real_t *)send_buffer;
+    const cs_real_t *var = (const cs_real_t *)val;
+
+    ctx.parallel_for(n_send, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+      const cs_lnum_t j = send_list[i];
+      for (cs_lnum_t k = 0; k < stride; k++)
+        buffer[i*stride + k] = var[j*stride + k];
+    });
 
-    /* Complete RMA exposure epoch */
-    MPI_Win_wait(hs->win);
   }
   else {
-    MPI_Win_fence(0, hs->win);
-  }
 
-  /* Copy local values in case of periodicity */
+    unsigned char *buffer = (unsigned char *)send_buffer;
+    const unsigned char *var = (const unsigned char *)val;
+
+    const cs_lnum_t elt_size = cs_datatype_size[data_type] * stride;
+
+    ctx.parallel_for(n_send, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+      const cs_lnum_t j = send_list[i];
+      for (cs_lnum_t k = 0; k < elt_size; k++)
+        buffer[i*elt_size + k] = var[j*elt_size + k];
+    });
 
-  if (hs->local_rank_id > -1) {
-    size_t elt_size = cs_datatype_size[hs->data_type] * hs->stride;
-    _sync_local(halo, hs->local_rank_id, hs->sync_mode, elt_size,
-                hs->var_location, hs->send_buffer_cur, val);
   }
+
+  ctx.wait();
 }
 
-#endif /* (MPI_VERSION >= 3) */
-#endif /* defined(HAVE_MPI) */
+#endif /* defined(SYCL_LANGUAGE_VERSION) */
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
@@ -617,6 +1316,7 @@ cs_halo_create(const cs_interface_set_t  *ifs)
 #if defined(HAVE_MPI)
   halo->c_domain_group = MPI_GROUP_NULL;
   halo->c_domain_s_shift = nullptr;
+  halo->c_domain_node_rank = nullptr;
 #endif
 
   _n_halos += 1;
@@ -650,7 +1350,7 @@ cs_halo_create_complete(cs_halo_t  *halo)
   }
 
   /* Create group for one-sided communication */
-  if (_halo_comm_mode > CS_HALO_COMM_P2P) {
+  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET) {
     const int local_rank = CS_MAX(cs_glob_rank_id, 0);
     int n_group_ranks = 0;
     int *group_ranks = nullptr;
@@ -684,6 +1384,12 @@ cs_halo_create_complete(cs_halo_t  *halo)
   if (_halo_comm_mode == CS_HALO_COMM_RMA_GET)
     _exchange_send_shift(halo);
 
+  /* Exchange shifts and identify node-local peers for peer copies */
+  if (_halo_comm_mode == CS_HALO_COMM_P2P_NODE_PEER) {
+    _exchange_send_shift(halo);
+    _build_node_ranks(halo);
+  }
+
   /* Build block send info for packing of standard exchange
      (not needed if the halo only has a standard component,
      as we can use the whole send list in that case) */
@@ -805,6 +1511,96 @@ cs_halo_create_from_ref(const cs_halo_t  *ref)
 #if defined(HAVE_MPI)
   halo->c_domain_group = MPI_GROUP_NULL;
   halo->c_domain_s_shift = nullptr;
+  halo->c_domain_node_rank = nullptr;
+#endif
+
+  _n_halos += 1;
+
+  cs_halo_create_complete(halo);
+
+  return halo;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a halo structure from its send and receive indexes.
+ *
+ * This allows rebuilding a halo saved from a previous run using the
+ * same partitioning. Periodicity is not handled.
+ *
+ * \param[in]  n_c_domains    number of communicating domains
+ * \param[in]  c_domain_rank  communicating ranks (size: n_c_domains)
+ * \param[in]  n_local_elts   number of local elements
+ * \param[in]  send_index     index on send_list (size: 2*n_c_domains + 1)
+ * \param[in]  send_list      local elements in distant halos
+ * \param[in]  index          index on halo sections
+ *                            (size: 2*n_c_domains + 1)
+ *
+ * \return  pointer to created cs_halo_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_t *
+cs_halo_create_from_index(int              n_c_domains,
+                          const int        c_domain_rank[],
+                          cs_lnum_t        n_local_elts,
+                          const cs_lnum_t  send_index[],
+                          const cs_lnum_t  send_list[],
+                          const cs_lnum_t  index[])
+{
+  cs_halo_t  *halo = nullptr;
+
+  BFT_MALLOC(halo, 1, cs_halo_t);
+
+  halo->n_c_domains = n_c_domains;
+  halo->n_transforms = 0;
+
+  halo->periodicity = nullptr;
+  halo->n_rotations = 0;
+
+  halo->n_local_elts = n_local_elts;
+
+  BFT_MALLOC(halo->c_domain_rank, n_c_domains, int);
+  CS_MALLOC_HD(halo->send_index, 2*n_c_domains + 1, cs_lnum_t,
+               _halo_buffer_alloc_mode);
+  BFT_MALLOC(halo->index, 2*n_c_domains + 1, cs_lnum_t);
+
+  for (int i = 0; i < n_c_domains; i++)
+    halo->c_domain_rank[i] = c_domain_rank[i];
+
+  for (int i = 0; i < 2*n_c_domains + 1; i++) {
+    halo->send_index[i] = send_index[i];
+    halo->index[i] = index[i];
+  }
+
+  /* Count standard and extended elements */
+
+  halo->n_send_elts[0] = 0;
+  halo->n_elts[0] = 0;
+  for (int i = 0; i < n_c_domains; i++) {
+    halo->n_send_elts[0] += send_index[2*i+1] - send_index[2*i];
+    halo->n_elts[0] += index[2*i+1] - index[2*i];
+  }
+  halo->n_send_elts[1] = send_index[2*n_c_domains];
+  halo->n_elts[1] = index[2*n_c_domains];
+
+  CS_MALLOC_HD(halo->send_list, halo->n_send_elts[1], cs_lnum_t,
+               _halo_buffer_alloc_mode);
+  memcpy(halo->send_list,
+         send_list,
+         halo->n_send_elts[1]*sizeof(cs_lnum_t));
+
+  halo->send_perio_lst = nullptr;
+  halo->perio_lst = nullptr;
+
+  halo->std_send_block_size = 256;  /* Fixed size for now */
+  halo->n_std_send_blocks   = 0;
+  halo->std_send_blocks = nullptr;
+
+#if defined(HAVE_MPI)
+  halo->c_domain_group = MPI_GROUP_NULL;
+  halo->c_domain_s_shift = nullptr;
+  halo->c_domain_node_rank = nullptr;
 #endif
 
   _n_halos += 1;
@@ -865,6 +1661,7 @@ cs_halo_create_from_rank_neighbors(const cs_rank_neighbors_t  *rn,
 #if defined(HAVE_MPI)
   halo->c_domain_group = MPI_GROUP_NULL;
   halo->c_domain_s_shift = nullptr;
+  halo->c_domain_node_rank = nullptr;
 #endif
 
   halo->n_local_elts = n_local_elts;
@@ -1082,10 +1879,14 @@ cs_halo_destroy(cs_halo_t  **halo)
   cs_halo_t  *_halo = *halo;
 
 #if defined(HAVE_MPI)
+  for (int i = 0; i < _n_halo_states; i++)
+    _persistent_purge(_halo_states[i], _halo);
+
   if (_halo->c_domain_group != MPI_GROUP_NULL)
     MPI_Group_free(&(_halo->c_domain_group));
 
   BFT_FREE(_halo->c_domain_s_shift);
+  BFT_FREE(_halo->c_domain_node_rank);
 #endif
 
   BFT_FREE(_halo->c_domain_rank);
@@ -1105,8 +1906,12 @@ cs_halo_destroy(cs_halo_t  **halo)
 
   /* Delete default state if no halo remains */
 
-  if (_n_halos == 0)
+  if (_n_halos == 0) {
     cs_halo_state_destroy(&_halo_state);
+#if defined(HAVE_MPI)
+    _node_comm_finalize();
+#endif
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1141,13 +1946,30 @@ cs_halo_state_create(void)
     .request_size = 0,
     .request = nullptr,
     .status = nullptr,
-    .win = MPI_WIN_NULL
+    .win = MPI_WIN_NULL,
+    .n_p_sets = 0,
+    .p_set_cur = -1,
+    .p_use_count = 0,
+    .p_sets = {},
+    .p_recv_buffer_size = 0,
+    .p_recv_buffer_location = CS_ALLOC_HOST,
+    .p_recv_buffer = nullptr,
+    .p_recv_dest = nullptr,
+    .use_peers = false,
+    .peer_buffer_size = 0,
+    .peer_buffer = nullptr,
+    .peer_info = {},
+    .peer_recv_size = 0,
+    .peer_recv_info = nullptr
 
 #endif
   };
 
   *hs = hs_ini;
 
+  BFT_REALLOC(_halo_states, _n_halo_states + 1, cs_halo_state_t *);
+  _halo_states[_n_halo_states++] = hs;
+
   return hs;
 }
 
@@ -1166,7 +1988,24 @@ cs_halo_state_destroy(cs_halo_state_t  **halo_state)
   if (halo_state != nullptr) {
     cs_halo_state_t *hs = *halo_state;
 
+    if (hs == nullptr)
+      return;
+
+    int j = 0;
+    for (int i = 0; i < _n_halo_states; i++) {
+      if (_halo_states[i] != hs)
+        _halo_states[j++] = _halo_states[i];
+    }
+    _n_halo_states = j;
+    if (_n_halo_states == 0)
+      BFT_FREE(_halo_states);
+
 #if defined(HAVE_MPI)
+    _persistent_purge(hs, nullptr);
+    CS_FREE_HD(hs->p_recv_buffer);
+    CS_FREE_HD(hs->peer_buffer);
+    BFT_FREE(hs->peer_recv_info);
+
 #if (MPI_VERSION >= 3)
     if (hs->win != MPI_WIN_NULL) {
       MPI_Win_free(&(hs->win));
@@ -1658,6 +2497,20 @@ cs_halo_sync_pack_d(const cs_halo_t  *halo,
   if (val_host_ptr != val && val != nullptr)
     _hs->var_location = CS_ALLOC_DEVICE;
 
+#elif defined(SYCL_LANGUAGE_VERSION)
+
+  CS_UNUSED(sync_mode);
+
+  _pack_send_buffer_dispatch(halo,
+                             data_type,
+                             stride,
+                             val,
+                             cs_get_device_ptr(_send_buf));
+
+  _hs->var_location = cs_check_device_ptr(val);
+  if (_hs->var_location != CS_ALLOC_HOST_DEVICE_SHARED)
+    _hs->var_location = CS_ALLOC_DEVICE;
+
 #else // defined(HAVE_CUDA)
 
   cs_halo_sync_pack(halo,
@@ -1710,7 +2563,7 @@ cs_halo_sync_start(const cs_halo_t  *halo,
   cs_halo_state_t  *_hs = (hs != nullptr) ? hs : _halo_state;
 
 #if (MPI_VERSION >= 3)
-  if (_halo_comm_mode > CS_HALO_COMM_P2P) {
+  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET) {
     _halo_sync_start_one_sided(halo, val, _hs);
     return;
   }
@@ -1771,11 +2624,49 @@ cs_halo_sync_start(const cs_halo_t  *halo,
 
   _update_requests(halo, _hs);
 
+  if (_halo_comm_mode == CS_HALO_COMM_P2P_PERSISTENT) {
+    _halo_sync_start_persistent(halo,
+                                buffer,
+                                _val + n_loc_elts*elt_size,
+                                _val_dest,
+                                _hs);
+    return;
+  }
+
   MPI_Datatype mpi_datatype = cs_datatype_to_mpi[_hs->data_type];
 
   int request_count = 0;
   const int local_rank = CS_MAX(cs_glob_rank_id, 0);
 
+  /* For data on device, node-local peers exchange buffer info only,
+     and copy values directly in cs_halo_sync_wait */
+
+  const int *node_rank = nullptr;
+
+#if defined(HAVE_CUDA)
+
+  _hs->use_peers = false;
+
+  if (   _halo_comm_mode == CS_HALO_COMM_P2P_NODE_PEER
+      && halo->c_domain_node_rank != nullptr
+      && _hs->var_location > CS_ALLOC_HOST) {
+
+    _hs->use_peers = true;
+    node_rank = halo->c_domain_node_rank;
+
+    size_t pack_size = halo->n_send_elts[CS_HALO_EXTENDED] * elt_size;
+    _peer_export(_hs, cs_get_device_ptr(_hs->send_buffer_cur), pack_size);
+
+    if (_hs->peer_recv_size < halo->n_c_domains) {
+      _hs->peer_recv_size = halo->n_c_domains;
+      BFT_REALLOC(_hs->peer_recv_info, _hs->peer_recv_size,
+                  cs_halo_peer_info_t);
+    }
+
+  }
+
+#endif /* defined(HAVE_CUDA) */
+
   /* Receive data from distant ranks */
 
   for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
@@ -1785,7 +2676,16 @@ cs_halo_sync_start(const cs_halo_t  *halo,
 
     if (halo->c_domain_rank[rank_id] != local_rank) {
 
-      if (length > 0) {
+      if (length > 0 && node_rank != nullptr && node_rank[rank_id] > -1)
+        MPI_Irecv(_hs->peer_recv_info + rank_id,
+                  sizeof(cs_halo_peer_info_t),
+                  MPI_BYTE,
+                  halo->c_domain_rank[rank_id],
+                  halo->c_domain_rank[rank_id],
+                  cs_glob_mpi_comm,
+                  &(_hs->request[request_count++]));
+
+      else if (length > 0) {
         size_t start = (size_t)(halo->index[2*rank_id]);
         unsigned char *dest = _val_dest + start*elt_size;
 
@@ -1816,7 +2716,17 @@ cs_halo_sync_start(const cs_halo_t  *halo,
     cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
                         - halo->send_index[2*rank_id]);
 
-    if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
+    if (   halo->c_domain_rank[rank_id] != local_rank && length > 0
+        && node_rank != nullptr && node_rank[rank_id] > -1)
+      MPI_Isend(&(_hs->peer_info),
+                sizeof(cs_halo_peer_info_t),
+                MPI_BYTE,
+                halo->c_domain_rank[rank_id],
+                local_rank,
+                cs_glob_mpi_comm,
+                &(_hs->request[request_count++]));
+
+    else if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
       MPI_Isend(buffer + start,
                 length*stride,
                 mpi_datatype,
@@ -1872,7 +2782,7 @@ cs_halo_sync_wait(const cs_halo_t  *halo,
   cs_halo_state_t  *_hs = (hs != nullptr) ? hs : _halo_state;
 
 #if (MPI_VERSION >= 3)
-  if (_halo_comm_mode > CS_HALO_COMM_P2P) {
+  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET) {
     _halo_sync_complete_one_sided(halo, val, _hs);
     return;
   }
@@ -1885,6 +2795,9 @@ cs_halo_sync_wait(const cs_halo_t  *halo,
   if (_hs->n_requests > 0)
     MPI_Waitall(_hs->n_requests, _hs->request, _hs->status);
 
+  if (_hs->p_set_cur > -1)
+    _halo_sync_wait_persistent(halo, _hs);
+
 #endif /* defined(HAVE_MPI) */
 
 #if defined(HAVE_ACCEL)
@@ -1912,6 +2825,15 @@ cs_halo_sync_wait(const cs_halo_t  *halo,
 
 #endif /* defined(HAVE_ACCEL) */
 
+#if defined(HAVE_MPI) && defined(HAVE_CUDA)
+
+  /* Copy values directly from node-local peers' buffers */
+
+  if (_hs->use_peers)
+    _halo_sync_wait_peers(halo, val, _hs);
+
+#endif
+
   /* Copy local values in case of periodicity */
 
   if (_hs->local_rank_id > -1) {
@@ -1969,6 +2891,181 @@ cs_halo_sync(const cs_halo_t  *halo,
   cs_halo_sync_wait(halo, val, nullptr);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update several arrays of values in case of parallelism
+ *        or periodicity, using a single exchange round.
+ *
+ * Values of all arrays are packed in a single buffer per communicating
+ * rank, so only one message is sent to (and received from) each
+ * neighbor rank, instead of one per array. Arrays may have different
+ * data types and strides. Only host arrays are handled.
+ *
+ * As with \ref cs_halo_sync, periodicity of rotation is not handled here.
+ *
+ * \param[in]       halo        pointer to halo structure
+ * \param[in]       sync_mode   synchronization mode (standard or extended)
+ * \param[in]       n_vars      number of arrays to update
+ * \param[in]       data_type   data type of each array (size: n_vars)
+ * \param[in]       stride      number of (interlaced) values by entity
+ *                              for each array (size: n_vars)
+ * \param[in, out]  val         pointers to arrays of values (size: n_vars)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_multi(const cs_halo_t      *halo,
+                   cs_halo_type_t        sync_mode,
+                   int                   n_vars,
+                   const cs_datatype_t   data_type[],
+                   const int             stride[],
+                   void                 *val[])
+{
+  if (halo == nullptr || n_vars < 1)
+    return;
+
+  if (n_vars == 1) {
+    cs_halo_sync(halo, sync_mode, data_type[0], stride[0], val[0]);
+    return;
+  }
+
+  cs_halo_state_t  *_hs = _halo_state;
+
+  cs_lnum_t end_shift = (sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+  const size_t n_loc_elts = halo->n_local_elts;
+
+  /* Combined size of values for each entity; packed buffers contain,
+     for each rank, the contiguous values of each array in turn */
+
+  size_t *elt_size;
+  BFT_MALLOC(elt_size, n_vars, size_t);
+
+  size_t tot_elt_size = 0;
+  for (int v_id = 0; v_id < n_vars; v_id++) {
+    elt_size[v_id] = cs_datatype_size[data_type[v_id]] * stride[v_id];
+    tot_elt_size += elt_size[v_id];
+  }
+
+  unsigned char *send_buf
+    = (unsigned char *)cs_halo_sync_pack_init_state(halo,
+                                                    sync_mode,
+                                                    CS_CHAR,
+                                                    tot_elt_size,
+                                                    nullptr,
+                                                    _hs);
+
+  size_t recv_size = halo->n_elts[CS_HALO_EXTENDED] * tot_elt_size;
+  if (_hs->recv_buffer_size < recv_size) {
+    _hs->recv_buffer_size = recv_size;
+    CS_FREE_HD(_hs->recv_buffer);
+    CS_MALLOC_HD(_hs->recv_buffer, _hs->recv_buffer_size, unsigned char,
+                 CS_ALLOC_HOST_DEVICE_PINNED);
+  }
+  unsigned char *recv_buf = (unsigned char *)_hs->recv_buffer;
+
+  /* Pack values */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t s_id = halo->send_index[2*rank_id];
+    cs_lnum_t n_r_elts = halo->send_index[2*rank_id + end_shift] - s_id;
+
+    unsigned char *_send_buf = send_buf + s_id*tot_elt_size;
+
+    for (int v_id = 0; v_id < n_vars; v_id++) {
+      const size_t e_size = elt_size[v_id];
+      const unsigned char *_val = (const unsigned char *)val[v_id];
+      const cs_lnum_t *_send_list = halo->send_list + s_id;
+
+#     pragma omp parallel for if (n_r_elts > CS_THR_MIN)
+      for (cs_lnum_t i = 0; i < n_r_elts; i++)
+        memcpy(_send_buf + i*e_size, _val + _send_list[i]*e_size, e_size);
+
+      _send_buf += n_r_elts*e_size;
+    }
+
+  }
+
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+#if defined(HAVE_MPI)
+
+  _update_requests(halo, _hs);
+
+  int request_count = 0;
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t s_id = halo->index[2*rank_id];
+    cs_lnum_t n_r_elts = halo->index[2*rank_id + end_shift] - s_id;
+
+    if (halo->c_domain_rank[rank_id] != local_rank && n_r_elts > 0)
+      MPI_Irecv(recv_buf + s_id*tot_elt_size,
+                n_r_elts*tot_elt_size,
+                MPI_BYTE,
+                halo->c_domain_rank[rank_id],
+                halo->c_domain_rank[rank_id],
+                cs_glob_mpi_comm,
+                &(_hs->request[request_count++]));
+
+  }
+
+  if (_halo_use_barrier)
+    MPI_Barrier(cs_glob_mpi_comm);
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t s_id = halo->send_index[2*rank_id];
+    cs_lnum_t n_r_elts = halo->send_index[2*rank_id + end_shift] - s_id;
+
+    if (halo->c_domain_rank[rank_id] != local_rank && n_r_elts > 0)
+      MPI_Isend(send_buf + s_id*tot_elt_size,
+                n_r_elts*tot_elt_size,
+                MPI_BYTE,
+                halo->c_domain_rank[rank_id],
+                local_rank,
+                cs_glob_mpi_comm,
+                &(_hs->request[request_count++]));
+
+  }
+
+  if (request_count > 0)
+    MPI_Waitall(request_count, _hs->request, _hs->status);
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Unpack values; for the local rank (periodicity), values are
+     copied directly from the send buffer */
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    cs_lnum_t s_id = halo->index[2*rank_id];
+    cs_lnum_t n_r_elts = halo->index[2*rank_id + end_shift] - s_id;
+
+    const unsigned char *_recv_buf = recv_buf + s_id*tot_elt_size;
+    if (halo->c_domain_rank[rank_id] == local_rank)
+      _recv_buf = send_buf + halo->send_index[2*rank_id]*tot_elt_size;
+
+    for (int v_id = 0; v_id < n_vars; v_id++) {
+      const size_t e_size = elt_size[v_id];
+      unsigned char *_val_dest
+        = (unsigned char *)val[v_id] + (n_loc_elts + s_id)*e_size;
+      memcpy(_val_dest, _recv_buf, n_r_elts*e_size);
+      _recv_buf += n_r_elts*e_size;
+    }
+
+  }
+
+  /* Cleanup */
+
+  _hs->sync_mode = CS_HALO_STANDARD;
+  _hs->data_type = CS_DATATYPE_NULL;
+  _hs->stride = 0;
+  _hs->send_buffer_cur = nullptr;
+
+  BFT_FREE(elt_size);
+}
+
 #if defined(HAVE_ACCEL)
 
 /*----------------------------------------------------------------------------*/
@@ -2163,7 +3260,7 @@ cs_halo_get_comm_mode(void)
 void
 cs_halo_set_comm_mode(cs_halo_comm_mode_t  mode)
 {
-  if (mode >= CS_HALO_COMM_P2P && mode <= CS_HALO_COMM_RMA_GET)
+  if (mode >= CS_HALO_COMM_P2P && mode <= CS_HALO_COMM_P2P_NODE_PEER)
     _halo_comm_mode = mode;
 }
 
@@ -2195,6 +3292,77 @@ cs_halo_set_buffer_alloc_mode(cs_alloc_mode_t  mode)
   _halo_buffer_alloc_mode = mode;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Count halo elements and communicating ranks on the same compute
+ *        node and on other nodes.
+ *
+ * Elements associated with the local rank (i.e. periodicity) are not
+ * counted.
+ *
+ * This function is collective on cs_glob_mpi_comm the first time it is
+ * called (or if no node-based communicator was built previously).
+ *
+ * \param[in]   halo     pointer to halo structure, or null
+ * \param[out]  n_elts   number of halo elements received from ranks on
+ *                       the same node (0) and on other nodes (1)
+ * \param[out]  n_ranks  number of communicating ranks on the same node (0)
+ *                       and on other nodes (1)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_count_by_node(const cs_halo_t  *halo,
+                      cs_lnum_t         n_elts[2],
+                      int               n_ranks[2])
+{
+  for (int i = 0; i < 2; i++) {
+    n_elts[i] = 0;
+    n_ranks[i] = 0;
+  }
+
+#if defined(HAVE_MPI)
+
+  _node_comm_init();
+
+  if (halo == nullptr || _node_comm == MPI_COMM_NULL)
+    return;
+
+  int *node_rank;
+  BFT_MALLOC(node_rank, halo->n_c_domains, int);
+
+  MPI_Group glob_group, node_group;
+  MPI_Comm_group(cs_glob_mpi_comm, &glob_group);
+  MPI_Comm_group(_node_comm, &node_group);
+
+  MPI_Group_translate_ranks(glob_group,
+                            halo->n_c_domains,
+                            halo->c_domain_rank,
+                            node_group,
+                            node_rank);
+
+  MPI_Group_free(&node_group);
+  MPI_Group_free(&glob_group);
+
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  for (int i = 0; i < halo->n_c_domains; i++) {
+    if (halo->c_domain_rank[i] == local_rank)
+      continue;
+    int j = (node_rank[i] == MPI_UNDEFINED) ? 1 : 0;
+    n_elts[j] += halo->index[2*i+2] - halo->index[2*i];
+    n_ranks[j] += 1;
+  }
+
+  BFT_FREE(node_rank);
+
+#else
+
+  CS_UNUSED(halo);
+
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
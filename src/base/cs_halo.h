@@ -66,8 +66,15 @@ typedef enum {
 typedef enum {
 
   CS_HALO_COMM_P2P,      /*!< non-blocking point-to-point communication */
-  CS_HALO_COMM_RMA_GET   /*!< MPI-3 one-sided with get semantics and
+  CS_HALO_COMM_RMA_GET,  /*!< MPI-3 one-sided with get semantics and
                            active target synchronization */
+  CS_HALO_COMM_P2P_PERSISTENT, /*!< point-to-point communication with
+                                 persistent requests built once per halo
+                                 and buffer (MPI_Send_init/MPI_Recv_init) */
+  CS_HALO_COMM_P2P_NODE_PEER   /*!< point-to-point communication, with
+                                 direct device-to-device copies (CUDA IPC)
+                                 instead of MPI messages for device data
+                                 exchanged with ranks on the same node */
 
 } cs_halo_comm_mode_t;
 
@@ -169,6 +176,10 @@ typedef struct {
   MPI_Group   c_domain_group;    /* Group of connected domains */
   cs_lnum_t  *c_domain_s_shift;  /* Target buffer shift for distant
                                     ranks using one-sided get */
+  int        *c_domain_node_rank;  /* Rank in node communicator for
+                                      communicating ranks on the same node,
+                                      -1 for others (only built for
+                                      node-local peer copies) */
 #endif
 
 } cs_halo_t;
@@ -228,6 +239,33 @@ cs_halo_create_complete(cs_halo_t  *halo);
 cs_halo_t *
 cs_halo_create_from_ref(const cs_halo_t  *ref);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a halo structure from its send and receive indexes.
+ *
+ * This allows rebuilding a halo saved from a previous run using the
+ * same partitioning. Periodicity is not handled.
+ *
+ * \param[in]  n_c_domains    number of communicating domains
+ * \param[in]  c_domain_rank  communicating ranks (size: n_c_domains)
+ * \param[in]  n_local_elts   number of local elements
+ * \param[in]  send_index     index on send_list (size: 2*n_c_domains + 1)
+ * \param[in]  send_list      local elements in distant halos
+ * \param[in]  index          index on halo sections
+ *                            (size: 2*n_c_domains + 1)
+ *
+ * \return  pointer to created cs_halo_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_halo_t *
+cs_halo_create_from_index(int              n_c_domains,
+                          const int        c_domain_rank[],
+                          cs_lnum_t        n_local_elts,
+                          const cs_lnum_t  send_index[],
+                          const cs_lnum_t  send_list[],
+                          const cs_lnum_t  index[]);
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------*/
@@ -551,6 +589,36 @@ cs_halo_sync_d(const cs_halo_t  *halo,
 
 #endif /* defined(HAVE_ACCEL) */
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update several arrays of values in case of parallelism
+ *        or periodicity, using a single exchange round.
+ *
+ * Values of all arrays are packed in a single buffer per communicating
+ * rank, so only one message is sent to (and received from) each
+ * neighbor rank, instead of one per array. Arrays may have different
+ * data types and strides. Only host arrays are handled.
+ *
+ * As with \ref cs_halo_sync, periodicity of rotation is not handled here.
+ *
+ * \param[in]       halo        pointer to halo structure
+ * \param[in]       sync_mode   synchronization mode (standard or extended)
+ * \param[in]       n_vars      number of arrays to update
+ * \param[in]       data_type   data type of each array (size: n_vars)
+ * \param[in]       stride      number of (interlaced) values by entity
+ *                              for each array (size: n_vars)
+ * \param[in, out]  val         pointers to arrays of values (size: n_vars)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_sync_multi(const cs_halo_t      *halo,
+                   cs_halo_type_t        sync_mode,
+                   int                   n_vars,
+                   const cs_datatype_t   data_type[],
+                   const int             stride[],
+                   void                 *val[]);
+
 /*----------------------------------------------------------------------------
  * Update array of any type of halo values in case of parallelism or
  * periodicity.
@@ -701,6 +769,30 @@ cs_halo_get_buffer_alloc_mode(void);
 void
 cs_halo_set_buffer_alloc_mode(cs_alloc_mode_t  mode);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Count halo elements and communicating ranks on the same compute
+ *        node and on other nodes.
+ *
+ * Elements associated with the local rank (i.e. periodicity) are not
+ * counted.
+ *
+ * This function is collective on cs_glob_mpi_comm the first time it is
+ * called (or if no node-based communicator was built previously).
+ *
+ * \param[in]   halo     pointer to halo structure, or null
+ * \param[out]  n_elts   number of halo elements received from ranks on
+ *                       the same node (0) and on other nodes (1)
+ * \param[out]  n_ranks  number of communicating ranks on the same node (0)
+ *                       and on other nodes (1)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_count_by_node(const cs_halo_t  *halo,
+                      cs_lnum_t         n_elts[2],
+                      int               n_ranks[2]);
+
 /*----------------------------------------------------------------------------
  * Dump a cs_halo_t structure.
  *
@@ -46,6 +46,7 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "cs_array.h"
 #include "cs_field_pointer.h"
 #include "cs_gui.h"
 #include "cs_log.h"
@@ -150,10 +151,7 @@ cs_head_losses_compute(cs_real_6_t cku[])
 
       /* Initialize */
 
-      for (cs_lnum_t j = 0; j < n_z_cells; j++) {
-        for (cs_lnum_t k = 0; k < 6; k++)
-          _cku[j][k] = 0.;
-      }
+      cs_array_real_fill_zero(6*n_z_cells, (cs_real_t *)_cku);
 
       /* GUI definitions go first, then user function definitions */
 
@@ -893,6 +893,79 @@ _interfaces_from_flat_equiv(cs_interface_set_t  *ifs,
   BFT_FREE(interface_id);
 }
 
+/*----------------------------------------------------------------------------
+ * Determine hashed rendezvous ranks for global numbers, if the block
+ * distribution of global numbers would lead to unbalanced block loads.
+ *
+ * When global numbers are sparse or clustered (for example for a subset
+ * of the mesh entities), most elements may fall in a few blocks; ranks
+ * chosen by hashing the global number equilibrate the matching work.
+ *
+ * parameters:
+ *   n_elts     <-- local number of elements
+ *   global_num <-- global number (id) associated with each element
+ *   bi         <-- block distribution info for global numbers
+ *   comm       <-- associated MPI communicator
+ *
+ * returns:
+ *   destination rank for each element, or nullptr if the block
+ *   distribution is balanced enough
+ *----------------------------------------------------------------------------*/
+
+static int *
+_hashed_rendezvous_ranks(cs_lnum_t              n_elts,
+                         const cs_gnum_t        global_num[],
+                         cs_block_dist_info_t   bi,
+                         MPI_Comm               comm)
+{
+  int n_ranks;
+  MPI_Comm_size(comm, &n_ranks);
+
+  /* Count elements per block */
+
+  cs_gnum_t *block_count;
+  BFT_MALLOC(block_count, n_ranks, cs_gnum_t);
+  for (int i = 0; i < n_ranks; i++)
+    block_count[i] = 0;
+
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    cs_gnum_t b_rank = ((global_num[i] - 1) / bi.block_size) * bi.rank_step;
+    block_count[b_rank] += 1;
+  }
+
+  cs_gnum_t block_load = 0;
+  MPI_Reduce_scatter_block(block_count, &block_load, 1, CS_MPI_GNUM,
+                           MPI_SUM, comm);
+
+  BFT_FREE(block_count);
+
+  cs_gnum_t loads[2] = {block_load, (cs_gnum_t)n_elts}, g_loads[2];
+  MPI_Allreduce(loads, g_loads, 1, CS_MPI_GNUM, MPI_MAX, comm);
+  MPI_Allreduce(loads + 1, g_loads + 1, 1, CS_MPI_GNUM, MPI_SUM, comm);
+
+  /* Keep block distribution if the maximum load is less than
+     twice the mean load */
+
+  if (g_loads[0]*n_ranks <= 2*g_loads[1] + n_ranks)
+    return nullptr;
+
+  int *dest_rank;
+  BFT_MALLOC(dest_rank, n_elts, int);
+
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    uint64_t h = global_num[i];
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    dest_rank[i] = h % (uint64_t)n_ranks;
+  }
+
+  return dest_rank;
+}
+
 /*----------------------------------------------------------------------------
  * Creation of a list of interfaces between elements of a same type.
  *
@@ -932,12 +1005,28 @@ _add_global_equiv(cs_interface_set_t  *ifs,
 
   int flags = CS_ALL_TO_ALL_ORDER_BY_SRC_RANK;
 
-  cs_all_to_all_t
-    *d = cs_all_to_all_create_from_block(n_elts,
-                                         flags,
-                                         global_num,
-                                         bi,
-                                         comm);
+  /* Equivalent elements are matched on a rendezvous rank: the rank
+     handling the block of their global number, or a rank based on
+     a hash of that number if blocks are unbalanced */
+
+  cs_all_to_all_t *d = nullptr;
+
+  int *dest_rank = _hashed_rendezvous_ranks(n_elts, global_num, bi, comm);
+
+  if (dest_rank != nullptr) {
+    d = cs_all_to_all_create(n_elts,
+                             flags,
+                             nullptr,
+                             dest_rank,
+                             comm);
+    cs_all_to_all_transfer_dest_rank(d, &dest_rank);
+  }
+  else
+    d = cs_all_to_all_create_from_block(n_elts,
+                                        flags,
+                                        global_num,
+                                        bi,
+                                        comm);
 
   cs_gnum_t *recv_global_num = cs_all_to_all_copy_array(d,
                                                         1,
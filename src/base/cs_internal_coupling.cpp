@@ -51,6 +51,8 @@
 #include "fvm_selector.h"
 
 #include "cs_defs.h"
+#include "cs_base_accel.h"
+#include "cs_dispatch.h"
 #include "cs_math.h"
 #include "cs_sort.h"
 #include "cs_search.h"
@@ -250,6 +252,10 @@ _destroy_entity(cs_internal_coupling_t  *cpl)
   BFT_FREE(cpl->interior_faces_group_name);
   BFT_FREE(cpl->exterior_faces_group_name);
   BFT_FREE(cpl->volume_zone_ids);
+  CS_FREE_HD(cpl->cells_distant);
+  CS_FREE_HD(cpl->packed_ids);
+  CS_FREE_HD(cpl->local_src_ids);
+  CS_FREE_HD(cpl->local_src_cells);
   ple_locator_destroy(cpl->locator);
 }
 
@@ -523,6 +529,255 @@ _cpl_initialize(cs_internal_coupling_t *cpl)
   cpl->g_weight = NULL;
   cpl->ci_cj_vect = NULL;
   cpl->offset_vect = NULL;
+
+  cpl->device_exchange = false;
+  cpl->cells_distant = NULL;
+  cpl->packed_ids = NULL;
+
+  cpl->local_src_ids = NULL;
+  cpl->local_src_cells = NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize device-accessible lists used to exchange device-resident
+ * values, when an accelerator device is available.
+ *
+ * parameters:
+ *   m    <-- pointer to mesh structure
+ *   cpl  <-> pointer to coupling structure to modify
+ *----------------------------------------------------------------------------*/
+
+static void
+_device_exchange_initialize(const cs_mesh_t         *m,
+                            cs_internal_coupling_t  *cpl)
+{
+  cpl->device_exchange = false;
+
+  if (cs_get_device_id() < 0)
+    return;
+
+  const cs_lnum_t n_distant = cpl->n_distant;
+  const cs_lnum_t n_interior = ple_locator_get_n_interior(cpl->locator);
+  const ple_lnum_t *packed_ids = ple_locator_get_packed_ids(cpl->locator);
+
+  CS_MALLOC_HD(cpl->cells_distant, n_distant, cs_lnum_t,
+               cs_alloc_mode_read_mostly);
+  for (cs_lnum_t i = 0; i < n_distant; i++)
+    cpl->cells_distant[i] = m->b_face_cells[cpl->faces_distant[i]];
+  cs_sync_h2d(cpl->cells_distant);
+
+  if (packed_ids != NULL) {
+    CS_MALLOC_HD(cpl->packed_ids, n_interior, cs_lnum_t,
+                 cs_alloc_mode_read_mostly);
+    for (cs_lnum_t i = 0; i < n_interior; i++)
+      cpl->packed_ids[i] = packed_ids[i];
+    cs_sync_h2d(cpl->packed_ids);
+  }
+
+  cpl->device_exchange = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize rank-local exchange maps if all coupled faces are paired
+ * with faces on the same rank.
+ *
+ * The rank and distant list id of each distant face are exchanged once
+ * through the locator; if all are local on all ranks, later exchanges
+ * reduce to a gather through the resulting permutation.
+ *
+ * parameters:
+ *   m    <-- pointer to mesh structure
+ *   cpl  <-> pointer to coupling structure to modify
+ *----------------------------------------------------------------------------*/
+
+static void
+_local_map_initialize(const cs_mesh_t         *m,
+                      cs_internal_coupling_t  *cpl)
+{
+  const cs_lnum_t n_distant = cpl->n_distant;
+  const cs_lnum_t n_local = cpl->n_local;
+  const int rank_id = CS_MAX(cs_glob_rank_id, 0);
+
+  int *d_src, *l_src;
+  BFT_MALLOC(d_src, n_distant*2, int);
+  BFT_MALLOC(l_src, n_local*2, int);
+
+  for (cs_lnum_t i = 0; i < n_distant; i++) {
+    d_src[i*2] = rank_id;
+    d_src[i*2 + 1] = i;
+  }
+  for (cs_lnum_t i = 0; i < n_local*2; i++)
+    l_src[i] = -1;
+
+  ple_locator_exchange_point_var(cpl->locator,
+                                 d_src,
+                                 l_src,
+                                 NULL,
+                                 sizeof(int),
+                                 2,
+                                 0);
+
+  int all_local = 1;
+  for (cs_lnum_t i = 0; i < n_local; i++) {
+    if (l_src[i*2] > -1 && l_src[i*2] != rank_id)
+      all_local = 0;
+  }
+
+  cs_parall_min(1, CS_INT_TYPE, &all_local);
+
+  if (all_local) {
+
+    CS_MALLOC_HD(cpl->local_src_ids, n_local, cs_lnum_t,
+                 cs_alloc_mode_read_mostly);
+    CS_MALLOC_HD(cpl->local_src_cells, n_local, cs_lnum_t,
+                 cs_alloc_mode_read_mostly);
+
+    for (cs_lnum_t i = 0; i < n_local; i++) {
+      const cs_lnum_t j = l_src[i*2 + 1];
+      cpl->local_src_ids[i] = j;
+      cpl->local_src_cells[i]
+        = (j > -1) ? m->b_face_cells[cpl->faces_distant[j]] : -1;
+    }
+
+    cs_sync_h2d(cpl->local_src_ids);
+    cs_sync_h2d(cpl->local_src_cells);
+
+  }
+
+  BFT_FREE(l_src);
+  BFT_FREE(d_src);
+}
+
+/*----------------------------------------------------------------------------
+ * Gather values for a rank-local coupling.
+ *
+ * The gather is done on device if both arrays are allocated on shared
+ * host and device memory.
+ *
+ * parameters:
+ *   n_local  <-- number of local values
+ *   src_ids  <-- id of source value for each local value, or -1
+ *   stride   <-- number of values per entity
+ *   src      <-- source values
+ *   local    <-> local values
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_local(cs_lnum_t         n_local,
+                const cs_lnum_t   src_ids[],
+                int               stride,
+                const cs_real_t   src[],
+                cs_real_t         local[])
+{
+  cs_dispatch_context ctx;
+
+  if (   cs_check_device_ptr(src) != CS_ALLOC_HOST_DEVICE_SHARED
+      || cs_check_device_ptr(local) != CS_ALLOC_HOST_DEVICE_SHARED)
+    ctx.set_use_gpu(false);
+
+  ctx.parallel_for(n_local, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    const cs_lnum_t j = src_ids[i];
+    if (j > -1) {
+      for (cs_lnum_t k = 0; k < stride; k++)
+        local[i*stride + k] = src[j*stride + k];
+    }
+  });
+
+  ctx.wait();
+}
+
+/*----------------------------------------------------------------------------
+ * Check whether an exchange may be done on device.
+ *
+ * This requires device-accessible lists, and arrays allocated on shared
+ * host and device memory, so that values are usable on the host once
+ * the exchange is done.
+ *
+ * parameters:
+ *   cpl      <-- pointer to coupling entity
+ *   ctx      <-- reference to dispatch context
+ *   distant  <-- distant (sent) values
+ *   local    <-- local (received) values
+ *
+ * returns:
+ *   true if values may be exchanged and reordered on device
+ *----------------------------------------------------------------------------*/
+
+static bool
+_exchange_on_device(const cs_internal_coupling_t  *cpl,
+                    cs_dispatch_context           &ctx,
+                    const void                    *distant,
+                    const void                    *local)
+{
+  if (cpl->device_exchange == false || ctx.use_gpu() == false)
+    return false;
+
+  if (   cs_check_device_ptr(distant) != CS_ALLOC_HOST_DEVICE_SHARED
+      || cs_check_device_ptr(local) != CS_ALLOC_HOST_DEVICE_SHARED)
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Exchange device-resident quantities from distant to local.
+ *
+ * Values are received in exchange order and reordered on device, so that
+ * with device-aware MPI, no copy to the host is required.
+ *
+ * parameters:
+ *   cpl      <-- pointer to coupling entity
+ *   ctx      <-> reference to dispatch context
+ *   stride   <-- number of values per entity
+ *   distant  <-- distant values, size coupling->n_distant
+ *   local    --> local values, size coupling->n_local
+ *----------------------------------------------------------------------------*/
+
+static void
+_exchange_var_device(const cs_internal_coupling_t  *cpl,
+                     cs_dispatch_context           &ctx,
+                     int                            stride,
+                     cs_real_t                      distant[],
+                     cs_real_t                      local[])
+{
+  const cs_lnum_t n_interior = ple_locator_get_n_interior(cpl->locator);
+  const size_t n_vals = (size_t)n_interior * stride;
+
+  const cs_lnum_t *packed_ids = cpl->packed_ids;
+
+  cs_real_t *packed = local;
+  if (packed_ids != NULL)
+    CS_MALLOC_HD(packed, n_vals, cs_real_t, CS_ALLOC_HOST_DEVICE_SHARED);
+
+  /* With host-based MPI, values are exchanged through host memory */
+
+#if defined(HAVE_ACCEL)
+  if (cs_mpi_device_support == 0)
+    cs_prefetch_d2h(distant, cpl->n_distant*stride*sizeof(cs_real_t));
+#endif
+
+  ple_locator_exchange_point_var_packed(cpl->locator,
+                                        distant,
+                                        packed,
+                                        sizeof(cs_real_t),
+                                        stride,
+                                        0);
+
+#if defined(HAVE_ACCEL)
+  if (cs_mpi_device_support == 0)
+    cs_prefetch_h2d(packed, n_vals*sizeof(cs_real_t));
+#endif
+
+  if (packed_ids != NULL) {
+    ctx.parallel_for(n_interior, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+      const cs_lnum_t j = packed_ids[i];
+      for (cs_lnum_t k = 0; k < stride; k++)
+        local[j*stride + k] = packed[i*stride + k];
+    });
+    ctx.wait();
+
+    CS_FREE_HD(packed);
+  }
 }
 
 /*----------------------------------------------------------------------------
@@ -855,6 +1110,9 @@ _locator_initialize(cs_mesh_t               *m,
   for (cs_lnum_t i = 0; i < cpl->n_distant; i++)
     cpl->faces_distant[i] = faces_distant_num[i] - 1;
 
+  _device_exchange_initialize(m, cpl);
+  _local_map_initialize(m, cpl);
+
   /* Geometric quantities */
 
   BFT_MALLOC(cpl->g_weight, cpl->n_local, cs_real_t);
@@ -1909,6 +2167,18 @@ cs_internal_coupling_exchange_var(const cs_internal_coupling_t  *cpl,
                                   cs_real_t                      distant[],
                                   cs_real_t                      local[])
 {
+  if (cpl->local_src_ids != NULL) {
+    _exchange_local(cpl->n_local, cpl->local_src_ids, stride, distant, local);
+    return;
+  }
+
+  cs_dispatch_context ctx;
+
+  if (_exchange_on_device(cpl, ctx, distant, local)) {
+    _exchange_var_device(cpl, ctx, stride, distant, local);
+    return;
+  }
+
   ple_locator_exchange_point_var(cpl->locator,
                                  distant,
                                  local,
@@ -1946,6 +2216,38 @@ cs_internal_coupling_exchange_by_cell_id(const cs_internal_coupling_t  *cpl,
   const cs_lnum_t *restrict b_face_cells
     = (const cs_lnum_t *)m->b_face_cells;
 
+  /* For rank-local couplings, gather directly from cell values */
+
+  if (cpl->local_src_cells != NULL) {
+    _exchange_local(cpl->n_local, cpl->local_src_cells, stride, tab, local);
+    return;
+  }
+
+  /* Gather and exchange values on device if possible */
+
+  cs_dispatch_context ctx;
+
+  if (_exchange_on_device(cpl, ctx, tab, local)) {
+
+    const cs_lnum_t *cells_distant = cpl->cells_distant;
+
+    cs_real_t *distant = NULL;
+    CS_MALLOC_HD(distant, n_distant*stride, cs_real_t,
+                 CS_ALLOC_HOST_DEVICE_SHARED);
+
+    ctx.parallel_for(n_distant, [=] CS_F_HOST_DEVICE (cs_lnum_t ii) {
+      const cs_lnum_t c_id = cells_distant[ii];
+      for (cs_lnum_t k = 0; k < stride; k++)
+        distant[stride * ii + k] = tab[stride * c_id + k];
+    });
+    ctx.wait();
+
+    _exchange_var_device(cpl, ctx, stride, distant, local);
+
+    CS_FREE_HD(distant);
+    return;
+  }
+
   /* Initialize distant array */
 
   cs_real_t *distant = NULL;
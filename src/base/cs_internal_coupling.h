@@ -99,6 +99,19 @@ typedef struct {
   /* OF vectors  */
   cs_real_3_t *offset_vect;
 
+  /* Device-accessible exchange lists (if device_exchange is true) */
+  bool        device_exchange;
+  cs_lnum_t  *cells_distant;  /* Cells adjacent to faces_distant */
+  cs_lnum_t  *packed_ids;     /* Local value ids in locator exchange order,
+                                 or NULL for identity */
+
+  /* Rank-local exchange maps (non-NULL only if all coupled faces
+     are on the same rank on all ranks, so no locator exchange is needed) */
+  cs_lnum_t  *local_src_ids;    /* Id in distant list of value coupled to
+                                   each local face, or -1 if unlocated */
+  cs_lnum_t  *local_src_cells;  /* Cell adjacent to the face coupled to
+                                   each local face, or -1 if unlocated */
+
 } cs_internal_coupling_t;
 
 /*============================================================================
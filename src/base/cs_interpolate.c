@@ -363,7 +363,7 @@ cs_interpolate_from_location_p1(void                *input,
           }
         }
         else {
-          for (cs_lnum_t j = 0; j < 6; j++)
+          for (cs_lnum_t j = 0; j < 3; j++)
             p_vals[i][j] = 0;
         }
       }
@@ -1536,6 +1536,122 @@ _cs_io_read_body(const cs_io_sec_header_t  *header,
   return _elts;
 }
 
+/*----------------------------------------------------------------------------
+ * Read a message body, returning a view of the data in a memory-mapped
+ * file when possible.
+ *
+ * A view is returned when the file is memory-mapped, the data type
+ * does not need conversion, and alignment and endianness allow it;
+ * in this case, *buffer is set to nullptr. Otherwise, data is read into
+ * a newly allocated array, to which *buffer is set, and which the
+ * caller must free.
+ *
+ * parameters:
+ *   header           <-- header structure
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *   buffer           --> pointer to allocated array, or nullptr
+ *   inp              --> input kernel IO structure
+ *
+ * returns:
+ *   pointer to data
+ *----------------------------------------------------------------------------*/
+
+static const void *
+_cs_io_read_body_view(const cs_io_sec_header_t  *header,
+                      cs_gnum_t                  global_num_start,
+                      cs_gnum_t                  global_num_end,
+                      void                     **buffer,
+                      cs_io_t                   *inp)
+{
+  const void *retval = nullptr;
+
+  *buffer = nullptr;
+
+  /* Strings need a terminating null character, and converted or
+     embedded data may not be viewed */
+
+  if (   inp->data == nullptr
+      && header->elt_type == header->type_read
+      && (header->elt_type != CS_CHAR || header->location_id != 0)) {
+
+    double t_start = 0.;
+    cs_io_log_t  *log = nullptr;
+
+    if (inp->log_id > -1) {
+      log = _cs_io_log[inp->mode] + inp->log_id;
+      t_start = cs_timer_wtime();
+    }
+
+    size_t stride = 1;
+    if (header->n_location_vals > 1)
+      stride = header->n_location_vals;
+
+    size_t type_size = cs_datatype_size[header->type_read];
+
+    /* Position read pointer if necessary */
+
+    if (inp->body_align > 0) {
+      cs_file_off_t offset = cs_file_tell(inp->f);
+      size_t ba = inp->body_align;
+      offset += (ba - (offset % ba)) % ba;
+      cs_file_seek(inp->f, offset, CS_FILE_SEEK_SET);
+    }
+
+    if (global_num_start > 0 && global_num_end > 0) {
+      retval = cs_file_read_block_view(inp->f,
+                                       type_size,
+                                       stride,
+                                       global_num_start,
+                                       global_num_end);
+      if (retval != nullptr && log != nullptr)
+        log->data_size[1] += (global_num_end - global_num_start)*type_size;
+    }
+    else {
+      retval = cs_file_read_global_view(inp->f,
+                                        type_size,
+                                        inp->n_vals);
+      if (retval != nullptr && log != nullptr)
+        log->data_size[0] += inp->n_vals*type_size;
+    }
+
+    if (retval != nullptr) {
+
+      if (log != nullptr) {
+        double t_end = cs_timer_wtime();
+        int t_id = (global_num_start > 0 && global_num_end > 0) ? 1 : 0;
+        log->wtimes[t_id] += t_end - t_start;
+      }
+
+      if (header->n_vals != 0 && inp->echo > CS_IO_ECHO_HEADERS) {
+        cs_file_off_t n_vals = inp->n_vals;
+        if (global_num_start > 0 && global_num_end > 0)
+          n_vals = (global_num_end - global_num_start)*stride;
+        _echo_data(inp->echo,
+                   n_vals,
+                   (global_num_start-1)*stride + 1,
+                   (global_num_end-1)*stride + 1,
+                   header->elt_type,
+                   retval);
+      }
+
+      return retval;
+    }
+
+  }
+
+  /* Fall back to regular read */
+
+  *buffer = _cs_io_read_body(header,
+                             global_num_start,
+                             global_num_end,
+                             nullptr,
+                             inp);
+
+  return *buffer;
+}
+
 /*----------------------------------------------------------------------------
  * Build an index for a kernel IO file structure in read mode.
  *
@@ -2325,6 +2441,31 @@ cs_io_get_echo(const cs_io_t  *cs_io)
   return (size_t)(cs_io->echo);
 }
 
+/*----------------------------------------------------------------------------
+ * Enable asynchronous writes for a kernel IO structure opened in write mode.
+ *
+ * Subsequent data is copied to a staging queue and written by a helper
+ * thread (see cs_file_set_async_write()), which is only possible with
+ * the CS_FILE_STDIO_SERIAL access method.
+ *
+ * parameters:
+ *   cs_io <-> kernel IO structure
+ *
+ * returns:
+ *   true if asynchronous writes are enabled, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_set_async_write(cs_io_t  *cs_io)
+{
+  assert(cs_io != nullptr);
+
+  if (cs_io->mode != CS_IO_MODE_WRITE || cs_io->f == nullptr)
+    return false;
+
+  return cs_file_set_async_write(cs_io->f);
+}
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief  Access raw restart data serialized in memory.
@@ -2832,6 +2973,70 @@ cs_io_read_block(const cs_io_sec_header_t  *header,
                           cs_io);
 }
 
+/*----------------------------------------------------------------------------
+ * Read a message body and replicate it to all processors, returning
+ * a view of the data in a memory-mapped file when possible.
+ *
+ * When the file was opened using the CS_FILE_MMAP access method, the data
+ * type does not need conversion, and alignment and endianness allow it,
+ * a pointer to the mapped data is returned, valid until the file is
+ * closed, and *buffer is set to nullptr. Otherwise, data is read into a
+ * newly allocated array, to which *buffer is set, and which the caller
+ * must free (in both cases, BFT_FREE(*buffer) may be called).
+ *
+ * parameters:
+ *   header <-- header structure
+ *   buffer --> pointer to allocated array, or nullptr
+ *   cs_io  --> kernel IO structure
+ *
+ * returns:
+ *   pointer to data
+ *----------------------------------------------------------------------------*/
+
+const void *
+cs_io_read_global_view(const cs_io_sec_header_t  *header,
+                       void                     **buffer,
+                       cs_io_t                   *cs_io)
+{
+  return _cs_io_read_body_view(header, 0, 0, buffer, cs_io);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a message body, assigning a different block to each processor,
+ * and returning a view of the data in a memory-mapped file when possible.
+ *
+ * This function is similar to cs_io_read_block(), with the same handling
+ * of views and fallback as cs_io_read_global_view().
+ *
+ * parameters:
+ *   header           <-- header structure
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *   buffer           --> pointer to allocated array, or nullptr
+ *   cs_io            --> kernel IO structure
+ *
+ * returns:
+ *   pointer to data
+ *----------------------------------------------------------------------------*/
+
+const void *
+cs_io_read_block_view(const cs_io_sec_header_t  *header,
+                      cs_gnum_t                  global_num_start,
+                      cs_gnum_t                  global_num_end,
+                      void                     **buffer,
+                      cs_io_t                   *cs_io)
+{
+  assert(global_num_start > 0);
+  assert(global_num_end >= global_num_start);
+
+  return _cs_io_read_body_view(header,
+                               global_num_start,
+                               global_num_end,
+                               buffer,
+                               cs_io);
+}
+
 /*----------------------------------------------------------------------------
  * Read a section body, assigning a different block to each processor,
  * when the body corresponds to an index.
@@ -302,6 +302,23 @@ cs_io_get_indexed_sec_header(const cs_io_t  *inp,
 size_t
 cs_io_get_echo(const cs_io_t  *pp_io);
 
+/*----------------------------------------------------------------------------
+ * Enable asynchronous writes for a kernel IO structure opened in write mode.
+ *
+ * Subsequent data is copied to a staging queue and written by a helper
+ * thread (see cs_file_set_async_write()), which is only possible with
+ * the CS_FILE_STDIO_SERIAL access method.
+ *
+ * parameters:
+ *   cs_io <-> kernel IO structure
+ *
+ * returns:
+ *   true if asynchronous writes are enabled, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_io_set_async_write(cs_io_t  *cs_io);
+
 /*----------------------------------------------------------------------------*/
 /*
  * \brief  Access raw restart data serialized in memory.
@@ -462,6 +479,57 @@ cs_io_read_block(const cs_io_sec_header_t  *header,
                  void                      *elts,
                  cs_io_t                   *pp_io);
 
+/*----------------------------------------------------------------------------
+ * Read a message body and replicate it to all processors, returning
+ * a view of the data in a memory-mapped file when possible.
+ *
+ * When the file was opened using the CS_FILE_MMAP access method, the data
+ * type does not need conversion, and alignment and endianness allow it,
+ * a pointer to the mapped data is returned, valid until the file is
+ * closed, and *buffer is set to NULL. Otherwise, data is read into a
+ * newly allocated array, to which *buffer is set, and which the caller
+ * must free (in both cases, BFT_FREE(*buffer) may be called).
+ *
+ * parameters:
+ *   header <-- header structure
+ *   buffer --> pointer to allocated array, or NULL
+ *   cs_io  --> kernel IO structure
+ *
+ * returns:
+ *   pointer to data
+ *----------------------------------------------------------------------------*/
+
+const void *
+cs_io_read_global_view(const cs_io_sec_header_t  *header,
+                       void                     **buffer,
+                       cs_io_t                   *cs_io);
+
+/*----------------------------------------------------------------------------
+ * Read a message body, assigning a different block to each processor,
+ * and returning a view of the data in a memory-mapped file when possible.
+ *
+ * This function is similar to cs_io_read_block(), with the same handling
+ * of views and fallback as cs_io_read_global_view().
+ *
+ * parameters:
+ *   header           <-- header structure
+ *   global_num_start <-- global number of first block item (1 to n numbering)
+ *   global_num_end   <-- global number of past-the end block item
+ *                        (1 to n numbering)
+ *   buffer           --> pointer to allocated array, or NULL
+ *   cs_io            --> kernel IO structure
+ *
+ * returns:
+ *   pointer to data
+ *----------------------------------------------------------------------------*/
+
+const void *
+cs_io_read_block_view(const cs_io_sec_header_t  *header,
+                      cs_gnum_t                  global_num_start,
+                      cs_gnum_t                  global_num_end,
+                      void                     **buffer,
+                      cs_io_t                   *cs_io);
+
 /*----------------------------------------------------------------------------
  * Read a message body, assigning a different block to each processor,
  * when the body corresponds to an index.
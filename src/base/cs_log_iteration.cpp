@@ -59,6 +59,7 @@
 #include "cs_notebook.h"
 #include "cs_parall.h"
 #include "cs_parameters.h"
+#include "cs_perf_summary.h"
 #include "cs_physical_model.h"
 #include "cs_prototypes.h"
 #include "cs_range_set.h"
@@ -720,16 +721,49 @@ _log_fields_and_functions(void)
     }
   }
 
-  /* Loop on locations */
+  /* First loop on locations: compute local statistics */
+  /*----------------------------------------------------*/
+
+  /* Statistics of all locations are stored contiguously, so that they
+     may be reduced with a few grouped MPI operations, rather than with
+     separate operations for each location. */
+
+  int *loc_shift;
+  cs_lnum_t *loc_have_weight;
+  bool *loc_weight_reduce;
+  double *loc_weight;
+  cs_gnum_t *loc_n_g_elts, *loc_n_l_elts;
+  size_t *loc_name_width;
+
+  BFT_MALLOC(loc_shift, n_locations + 1, int);
+  BFT_MALLOC(loc_have_weight, n_locations, cs_lnum_t);
+  BFT_MALLOC(loc_weight_reduce, n_locations, bool);
+  BFT_MALLOC(loc_weight, n_locations, double);
+  BFT_MALLOC(loc_n_g_elts, n_locations, cs_gnum_t);
+  BFT_MALLOC(loc_n_l_elts, n_locations, cs_gnum_t);
+  BFT_MALLOC(loc_name_width, n_locations, size_t);
+
+  for (int f_id = 0; f_id < n_ff; f_id++)
+    log_id[f_id] = -1;
+
+  log_count = 0;
 
   for (int loc_id = 0; loc_id < n_locations; loc_id++) {
 
+    loc_shift[loc_id] = log_count;
+    loc_have_weight[loc_id] = 0;
+    loc_weight_reduce[loc_id] = false;
+    loc_weight[loc_id] = -1;
+    loc_n_g_elts[loc_id] = 0;
+    loc_n_l_elts[loc_id] = 0;
+    loc_name_width[loc_id] = cs_log_strlen(_("field"));
+
     if (location_log[loc_id] == false)
       continue;
 
-    size_t max_name_width = cs_log_strlen(_("field"));
     cs_lnum_t have_weight = 0;
     double total_weight = -1;
+    bool weight_reduce = false, count_reduce = false;
     cs_gnum_t n_g_elts = 0;
     cs_real_t *gather_array = nullptr; /* only if CS_MESH_LOCATION_VERTICES */
     const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(loc_id);
@@ -752,7 +786,7 @@ _log_fields_and_functions(void)
         n_g_elts = m->n_g_i_faces;
         weight = mq->i_face_surf;
         cs_array_reduce_sum_l(_n_elts, 1, nullptr, weight, &total_weight);
-        cs_parall_sum(1, CS_DOUBLE, &total_weight);
+        weight_reduce = true;
         have_weight = 1;
         break;
 
@@ -760,7 +794,7 @@ _log_fields_and_functions(void)
         n_g_elts = m->n_g_b_faces;
         weight = mq->b_face_surf;
         cs_array_reduce_sum_l(_n_elts, 1, nullptr, weight, &total_weight);
-        cs_parall_sum(1, CS_DOUBLE, &total_weight);
+        weight_reduce = true;
         have_weight = 1;
         break;
 
@@ -778,9 +812,10 @@ _log_fields_and_functions(void)
           elt_ids = cs_mesh_location_get_elt_ids_try(loc_id);
 
           /* FIXME: using sum is correct for cells and boundary faces,
-           *        would need range set for interior faces and vertices. */
-          n_g_elts = _n_elts;
-          cs_parall_counter(&n_g_elts, 1);
+           *        would need range set for interior faces and vertices.
+           *        The sum is grouped with those of other locations. */
+          loc_n_l_elts[loc_id] = _n_elts;
+          count_reduce = true;
 
           switch(loc_type) {
           case CS_MESH_LOCATION_CELLS:
@@ -801,26 +836,29 @@ _log_fields_and_functions(void)
 
           if (have_weight) {
             cs_array_reduce_sum_l(_n_elts, 1, elt_ids, weight, &total_weight);
-            cs_parall_sum(1, CS_DOUBLE, &total_weight);
+            weight_reduce = true;
           }
         }
         break;
       }
     }
 
-    if (n_g_elts == 0)
+    if (n_g_elts == 0 && count_reduce == false)
       continue;
 
-    log_count = 0;
+    loc_n_g_elts[loc_id] = n_g_elts;
+    loc_have_weight[loc_id] = have_weight;
+    loc_weight_reduce[loc_id] = weight_reduce;
+    loc_weight[loc_id] = total_weight;
 
-    /* First loop on fields and functions */
+    size_t max_name_width = loc_name_width[loc_id];
+
+    /* Loop on fields and functions */
 
     for (int f_id = 0; f_id < n_ff; f_id++) {
 
-      if (f_location_id[f_id] != loc_id) {
-        log_id[f_id] = -1;
+      if (f_location_id[f_id] != loc_id)
         continue;
-      }
 
       bool use_weight = false;
 
@@ -964,10 +1002,8 @@ _log_fields_and_functions(void)
                                        vmax + log_count,
                                        vsum + log_count);
 
-        if (have_weight) {
-          for (c_id = 0; c_id < _dim; c_id++)
-            wsum[log_count + c_id] = 0.;
-        }
+        for (c_id = 0; c_id < _dim; c_id++)
+          wsum[log_count + c_id] = 0.;
       }
 
       BFT_FREE(_f_val);
@@ -976,27 +1012,77 @@ _log_fields_and_functions(void)
 
     } /* End of first loop on fields */
 
+    loc_name_width[loc_id] = max_name_width;
+
     if (gather_array != nullptr)
       BFT_FREE(gather_array);
 
-    if (log_count < 1)
-      continue;
+  } /* End of first loop on mesh locations */
+
+  loc_shift[n_locations] = log_count;
+
+  /* Group MPI operations for all locations */
+  /*----------------------------------------*/
+
+  /* Minima are reduced as negated maxima, and the weight flags are
+     appended to the maxima, while total weights (when not already
+     known globally) are appended to the sums. */
+
+  {
+    const int n_r = 2*log_count + n_locations;
+
+    double *r_max, *r_sum;
+    BFT_MALLOC(r_max, n_r, double);
+    BFT_MALLOC(r_sum, n_r, double);
 
-    /* Group MPI operations if required */
+    for (int i = 0; i < log_count; i++) {
+      r_max[i] = -vmin[i];
+      r_max[log_count + i] = vmax[i];
+      r_sum[i] = vsum[i];
+      r_sum[log_count + i] = wsum[i];
+    }
+    for (int loc_id = 0; loc_id < n_locations; loc_id++) {
+      r_max[2*log_count + loc_id] = loc_have_weight[loc_id];
+      r_sum[2*log_count + loc_id]
+        = (loc_weight_reduce[loc_id]) ? loc_weight[loc_id] : 0;
+    }
+
+    cs_parall_max(n_r, CS_DOUBLE, r_max);
+    cs_parall_sum(n_r, CS_DOUBLE, r_sum);
+    cs_parall_counter(loc_n_l_elts, n_locations);
+
+    for (int i = 0; i < log_count; i++) {
+      vmin[i] = -r_max[i];
+      vmax[i] = r_max[log_count + i];
+      vsum[i] = r_sum[i];
+      wsum[i] = r_sum[log_count + i];
+    }
+    for (int loc_id = 0; loc_id < n_locations; loc_id++) {
+      loc_have_weight[loc_id] = (r_max[2*log_count + loc_id] > 0) ? 1 : 0;
+      if (loc_weight_reduce[loc_id])
+        loc_weight[loc_id] = r_sum[2*log_count + loc_id];
+      loc_n_g_elts[loc_id] += loc_n_l_elts[loc_id];
+    }
+
+    BFT_FREE(r_sum);
+    BFT_FREE(r_max);
+  }
 
-    cs_parall_min(log_count, CS_DOUBLE, vmin);
-    cs_parall_max(log_count, CS_DOUBLE, vmax);
-    cs_parall_sum(log_count, CS_DOUBLE, vsum);
+  /* Second loop on locations: print statistics */
+  /*--------------------------------------------*/
+
+  for (int loc_id = 0; loc_id < n_locations; loc_id++) {
 
-#   if defined(HAVE_MPI)
-    cs_parall_counter_max(&have_weight, 1);
-    if (have_weight)
-      cs_parall_sum(log_count, CS_DOUBLE, wsum);
-#   endif
+    const cs_gnum_t n_g_elts = loc_n_g_elts[loc_id];
+    const cs_lnum_t have_weight = loc_have_weight[loc_id];
+    const double total_weight = loc_weight[loc_id];
+
+    if (n_g_elts == 0 || loc_shift[loc_id + 1] <= loc_shift[loc_id])
+      continue;
 
     /* Print headers */
 
-    max_name_width = CS_MIN(max_name_width, 63);
+    size_t max_name_width = CS_MIN(loc_name_width[loc_id], 63);
 
     const char *loc_name = _(cs_mesh_location_get_name(loc_id));
     size_t loc_name_w = cs_log_strlen(loc_name);
@@ -1045,11 +1131,9 @@ _log_fields_and_functions(void)
 
     /* Second loop on fields and functions */
 
-    log_count = 0;
-
     for (int f_id = 0; f_id < n_ff; f_id++) {
 
-      if (log_id[f_id] < 0)
+      if (f_location_id[f_id] != loc_id || log_id[f_id] < 0)
         continue;
 
       const char *name;
@@ -1084,10 +1168,10 @@ _log_fields_and_functions(void)
         prefix[0] = 'f';
       }
 
-      int _dim = (f_dim == 3) ? 4 : f_dim;
-
       /* Position in log */
 
+      log_count = log_id[f_id];
+
       _log_array_info(prefix,
                       name,
                       max_name_width,
@@ -1100,8 +1184,6 @@ _log_fields_and_functions(void)
                       wsum + log_count,
                       &fpe_flag);
 
-      log_count += _dim;
-
     } /* End of loop on fields */
 
   } /* End of loop on mesh locations */
@@ -1111,6 +1193,14 @@ _log_fields_and_functions(void)
     bft_error(__FILE__, __LINE__, 0,
                 _("Invalid (not-a-number) values detected for a field."));
 
+  BFT_FREE(loc_name_width);
+  BFT_FREE(loc_n_l_elts);
+  BFT_FREE(loc_n_g_elts);
+  BFT_FREE(loc_weight);
+  BFT_FREE(loc_weight_reduce);
+  BFT_FREE(loc_have_weight);
+  BFT_FREE(loc_shift);
+
   BFT_FREE(moment_id);
   BFT_FREE(wsum);
   BFT_FREE(vsum);
@@ -1702,6 +1792,8 @@ cs_log_iteration(void)
   cs_ctwr_log_balance();
 
   cs_notebook_log();
+
+  cs_perf_summary_log_iteration();
 }
 
 /*----------------------------------------------------------------------------*/
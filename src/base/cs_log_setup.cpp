@@ -243,6 +243,10 @@ _log_global_model_options(void)
       cs_log_printf(CS_LOG_SETUP,
                     _(" (brute force, serial only)"));
       break;
+    case 3:
+      cs_log_printf(CS_LOG_SETUP,
+                    _(" (closest wall point propagation)"));
+      break;
     }
     cs_log_printf(CS_LOG_SETUP, "\n");
   }
@@ -0,0 +1,1243 @@
+/*============================================================================
+ * Interpreted evaluation of mathematical expressions over arrays.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_fp_exception.h"
+#include "cs_map.h"
+#include "cs_math.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_math_expr.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_math_expr.cpp
+        Interpreted evaluation of mathematical expressions over arrays.
+
+  Expressions are parsed once and compiled to a simple stack-based bytecode.
+  Evaluation processes elements by blocks, each instruction being applied
+  to a whole block, so that the cost of interpretation is amortized over
+  the block and the inner loops may be vectorized by the compiler.
+
+  Both branches of conditional ("if ... else") blocks are evaluated, and
+  assignments are masked, so that floating-point exception traps are
+  disabled during the evaluation.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Number of elements processed by each instruction */
+
+#define CS_MATH_EXPR_BLOCK_SIZE 128
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Bytecode operators */
+
+typedef enum {
+
+  CS_MATH_EXPR_CONST,       /* push constant */
+  CS_MATH_EXPR_INPUT,       /* push input */
+  CS_MATH_EXPR_VAR,         /* push variable */
+  CS_MATH_EXPR_STORE,       /* pop to variable (masked if in conditional) */
+
+  CS_MATH_EXPR_MASK_PUSH,   /* pop condition and enter conditional block */
+  CS_MATH_EXPR_MASK_ELSE,   /* switch to "else" block */
+  CS_MATH_EXPR_MASK_POP,    /* leave conditional block */
+
+  CS_MATH_EXPR_NEG,
+  CS_MATH_EXPR_NOT,
+
+  CS_MATH_EXPR_ADD,
+  CS_MATH_EXPR_SUB,
+  CS_MATH_EXPR_MUL,
+  CS_MATH_EXPR_DIV,
+  CS_MATH_EXPR_MOD,
+  CS_MATH_EXPR_POW,
+  CS_MATH_EXPR_LT,
+  CS_MATH_EXPR_GT,
+  CS_MATH_EXPR_LE,
+  CS_MATH_EXPR_GE,
+  CS_MATH_EXPR_EQ,
+  CS_MATH_EXPR_NE,
+  CS_MATH_EXPR_AND,
+  CS_MATH_EXPR_OR,
+  CS_MATH_EXPR_MIN,
+  CS_MATH_EXPR_MAX,
+  CS_MATH_EXPR_ATAN2,
+
+  CS_MATH_EXPR_ABS,
+  CS_MATH_EXPR_SQRT,
+  CS_MATH_EXPR_CBRT,
+  CS_MATH_EXPR_EXP,
+  CS_MATH_EXPR_LOG,
+  CS_MATH_EXPR_LOG10,
+  CS_MATH_EXPR_SIN,
+  CS_MATH_EXPR_COS,
+  CS_MATH_EXPR_TAN,
+  CS_MATH_EXPR_ASIN,
+  CS_MATH_EXPR_ACOS,
+  CS_MATH_EXPR_ATAN,
+  CS_MATH_EXPR_SINH,
+  CS_MATH_EXPR_COSH,
+  CS_MATH_EXPR_TANH,
+  CS_MATH_EXPR_FLOOR,
+  CS_MATH_EXPR_CEIL
+
+} _op_t;
+
+/* Bytecode instruction */
+
+typedef struct {
+
+  _op_t  op;    /* operator */
+  int    id;    /* constant, input, or variable id */
+  int    comp;  /* input component */
+
+} _instr_t;
+
+/* Compiled expression */
+
+struct _cs_math_expr_t {
+
+  int         n_instr;      /* number of instructions */
+  int         n_max_instr;  /* size of instructions array */
+  _instr_t   *instr;        /* instructions */
+
+  int         n_consts;     /* number of constants */
+  int         n_max_consts; /* size of constants array */
+  cs_real_t  *consts;       /* constants */
+
+  int         n_symbols;    /* number of input symbols */
+  bool       *sym_used;     /* is a given input used */
+
+  int         n_vars;       /* number of variables */
+  int         n_outputs;    /* number of outputs */
+  int        *output_var;   /* variable id matching each output */
+
+  int         stack_size;   /* maximum stack depth */
+  int         mask_size;    /* maximum conditional depth */
+
+};
+
+/* Token types */
+
+typedef enum {
+
+  _TOKEN_END,
+  _TOKEN_NUMBER,
+  _TOKEN_NAME,
+  _TOKEN_OP
+
+} _token_type_t;
+
+/* Parser state */
+
+typedef struct {
+
+  const char         *s;            /* expression text */
+  size_t              pos;          /* current position */
+  int                 line;         /* current line */
+
+  _token_type_t       type;         /* current token type */
+  char                token[64];    /* current token text */
+  double              value;        /* current token value if number */
+
+  int                 n_symbols;    /* number of input symbols */
+  const char        **symbols;      /* input symbol names */
+  cs_map_name_to_id_t *vars;        /* variable names */
+
+  int                 depth;        /* current stack depth */
+  int                 mask_depth;   /* current conditional depth */
+
+  bool                failed;       /* error status */
+  char                err[256];     /* error message */
+
+  cs_math_expr_t     *e;            /* expression being compiled */
+
+} _parser_t;
+
+/* Built-in function definition */
+
+typedef struct {
+
+  const char  *name;    /* function name */
+  _op_t        op;      /* matching operator */
+  int          n_args;  /* number of arguments */
+
+} _func_def_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const _func_def_t _funcs[]
+  = {{"abs", CS_MATH_EXPR_ABS, 1},
+     {"fabs", CS_MATH_EXPR_ABS, 1},
+     {"sqrt", CS_MATH_EXPR_SQRT, 1},
+     {"cbrt", CS_MATH_EXPR_CBRT, 1},
+     {"exp", CS_MATH_EXPR_EXP, 1},
+     {"log", CS_MATH_EXPR_LOG, 1},
+     {"log10", CS_MATH_EXPR_LOG10, 1},
+     {"sin", CS_MATH_EXPR_SIN, 1},
+     {"cos", CS_MATH_EXPR_COS, 1},
+     {"tan", CS_MATH_EXPR_TAN, 1},
+     {"asin", CS_MATH_EXPR_ASIN, 1},
+     {"acos", CS_MATH_EXPR_ACOS, 1},
+     {"atan", CS_MATH_EXPR_ATAN, 1},
+     {"sinh", CS_MATH_EXPR_SINH, 1},
+     {"cosh", CS_MATH_EXPR_COSH, 1},
+     {"tanh", CS_MATH_EXPR_TANH, 1},
+     {"floor", CS_MATH_EXPR_FLOOR, 1},
+     {"ceil", CS_MATH_EXPR_CEIL, 1},
+     {"min", CS_MATH_EXPR_MIN, 2},
+     {"max", CS_MATH_EXPR_MAX, 2},
+     {"mod", CS_MATH_EXPR_MOD, 2},
+     {"pow", CS_MATH_EXPR_POW, 2},
+     {"atan2", CS_MATH_EXPR_ATAN2, 2}};
+
+static const int _n_funcs = sizeof(_funcs) / sizeof(_funcs[0]);
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Set parser error status and message, if not already set.
+ *
+ * parameters:
+ *   p      <-> parser state
+ *   format <-- format string, followed by arguments
+ *----------------------------------------------------------------------------*/
+
+static void
+_error(_parser_t   *p,
+       const char  *format,
+       ...)
+{
+  if (p->failed)
+    return;
+
+  p->failed = true;
+
+  int l = snprintf(p->err, 255, _("line %d: "), p->line);
+
+  va_list  arg_ptr;
+  va_start(arg_ptr, format);
+  vsnprintf(p->err + l, 255 - l, format, arg_ptr);
+  va_end(arg_ptr);
+
+  p->err[255] = '\0';
+
+  p->type = _TOKEN_END;
+}
+
+/*----------------------------------------------------------------------------
+ * Read next token.
+ *
+ * parameters:
+ *   p <-> parser state
+ *----------------------------------------------------------------------------*/
+
+static void
+_next_token(_parser_t  *p)
+{
+  const char *s = p->s;
+
+  p->token[0] = '\0';
+
+  if (p->failed)
+    return;
+
+  /* Skip white space and comments */
+
+  while (s[p->pos] != '\0') {
+    if (s[p->pos] == '\n') {
+      p->line += 1;
+      p->pos += 1;
+    }
+    else if (isspace(s[p->pos]))
+      p->pos += 1;
+    else if (s[p->pos] == '#' || strncmp(s + p->pos, "//", 2) == 0) {
+      while (s[p->pos] != '\0' && s[p->pos] != '\n')
+        p->pos += 1;
+    }
+    else if (strncmp(s + p->pos, "/*", 2) == 0) {
+      p->pos += 2;
+      while (s[p->pos] != '\0' && strncmp(s + p->pos, "*/", 2) != 0) {
+        if (s[p->pos] == '\n')
+          p->line += 1;
+        p->pos += 1;
+      }
+      if (s[p->pos] != '\0')
+        p->pos += 2;
+    }
+    else
+      break;
+  }
+
+  const char *c = s + p->pos;
+
+  if (*c == '\0') {
+    p->type = _TOKEN_END;
+    return;
+  }
+
+  /* Number */
+
+  if (isdigit(*c) || (*c == '.' && isdigit(*(c+1)))) {
+    char *end = nullptr;
+    p->value = strtod(c, &end);
+    size_t l = end - c;
+    if (l > 63)
+      l = 63;
+    memcpy(p->token, c, l);
+    p->token[l] = '\0';
+    p->pos += end - c;
+    p->type = _TOKEN_NUMBER;
+    return;
+  }
+
+  /* Name */
+
+  if (isalpha(*c) || *c == '_') {
+    size_t l = 0;
+    while (isalnum(c[l]) || c[l] == '_')
+      l++;
+    if (l > 63) {
+      _error(p, _("name too long: \"%.32s...\""), c);
+      return;
+    }
+    memcpy(p->token, c, l);
+    p->token[l] = '\0';
+    p->pos += l;
+    p->type = _TOKEN_NAME;
+    return;
+  }
+
+  /* Operator */
+
+  const char *ops2[] = {"**", "<=", ">=", "==", "!=", "&&", "||"};
+  for (int i = 0; i < 7; i++) {
+    if (strncmp(c, ops2[i], 2) == 0) {
+      strcpy(p->token, ops2[i]);
+      p->pos += 2;
+      p->type = _TOKEN_OP;
+      return;
+    }
+  }
+
+  if (strchr("+-*/%^()[]{},;=<>!", *c) != nullptr) {
+    p->token[0] = *c;
+    p->token[1] = '\0';
+    p->pos += 1;
+    p->type = _TOKEN_OP;
+    return;
+  }
+
+  _error(p, _("unexpected character: '%c'"), *c);
+}
+
+/*----------------------------------------------------------------------------
+ * Check if the current token is a given operator.
+ *
+ * parameters:
+ *   p  <-- parser state
+ *   op <-- operator string
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_is_op(const _parser_t  *p,
+       const char       *op)
+{
+  return (p->type == _TOKEN_OP && strcmp(p->token, op) == 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Skip a required operator.
+ *
+ * parameters:
+ *   p  <-> parser state
+ *   op <-- operator string
+ *----------------------------------------------------------------------------*/
+
+static void
+_expect(_parser_t   *p,
+        const char  *op)
+{
+  if (_is_op(p, op))
+    _next_token(p);
+  else if (p->type == _TOKEN_END)
+    _error(p, _("expected \"%s\" before end of expression"), op);
+  else
+    _error(p, _("expected \"%s\" before \"%s\""), op, p->token);
+}
+
+/*----------------------------------------------------------------------------
+ * Append an instruction.
+ *
+ * parameters:
+ *   p       <-> parser state
+ *   op      <-- operator
+ *   id      <-- constant, input, or variable id
+ *   comp    <-- input component
+ *   d_depth <-- variation of stack depth
+ *----------------------------------------------------------------------------*/
+
+static void
+_emit(_parser_t  *p,
+      _op_t       op,
+      int         id,
+      int         comp,
+      int         d_depth)
+{
+  cs_math_expr_t *e = p->e;
+
+  if (e->n_instr >= e->n_max_instr) {
+    e->n_max_instr = CS_MAX(16, e->n_max_instr*2);
+    BFT_REALLOC(e->instr, e->n_max_instr, _instr_t);
+  }
+
+  e->instr[e->n_instr].op = op;
+  e->instr[e->n_instr].id = id;
+  e->instr[e->n_instr].comp = comp;
+  e->n_instr += 1;
+
+  p->depth += d_depth;
+  e->stack_size = CS_MAX(e->stack_size, p->depth);
+}
+
+/*----------------------------------------------------------------------------
+ * Append a constant push instruction.
+ *
+ * parameters:
+ *   p <-> parser state
+ *   v <-- constant value
+ *----------------------------------------------------------------------------*/
+
+static void
+_emit_const(_parser_t  *p,
+            cs_real_t   v)
+{
+  cs_math_expr_t *e = p->e;
+
+  if (e->n_consts >= e->n_max_consts) {
+    e->n_max_consts = CS_MAX(8, e->n_max_consts*2);
+    BFT_REALLOC(e->consts, e->n_max_consts, cs_real_t);
+  }
+
+  e->consts[e->n_consts] = v;
+  _emit(p, CS_MATH_EXPR_CONST, e->n_consts, 0, 1);
+  e->n_consts += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Parse an optional "[i]" component suffix.
+ *
+ * parameters:
+ *   p <-> parser state
+ *
+ * returns:
+ *   component id, or -1 if absent
+ *----------------------------------------------------------------------------*/
+
+static int
+_parse_component(_parser_t  *p)
+{
+  if (!_is_op(p, "["))
+    return -1;
+
+  _next_token(p);
+
+  int comp = -1;
+  if (p->type == _TOKEN_NUMBER && p->value >= 0 && p->value < 9
+      && p->value <= floor(p->value))
+    comp = (int)p->value;
+  else
+    _error(p, _("component index expected instead of \"%s\""), p->token);
+
+  _next_token(p);
+  _expect(p, "]");
+
+  return comp;
+}
+
+static void
+_parse_expr(_parser_t  *p);
+
+/*----------------------------------------------------------------------------
+ * Parse a name in an expression (function call, variable or input).
+ *
+ * parameters:
+ *   p <-> parser state
+ *----------------------------------------------------------------------------*/
+
+static void
+_parse_name(_parser_t  *p)
+{
+  char name[80];
+  strcpy(name, p->token);
+  _next_token(p);
+
+  /* Function call */
+
+  if (_is_op(p, "(")) {
+    int f_id = -1;
+    for (int i = 0; i < _n_funcs && f_id < 0; i++) {
+      if (strcmp(name, _funcs[i].name) == 0)
+        f_id = i;
+    }
+    if (f_id < 0) {
+      _error(p, _("unknown function: \"%s\""), name);
+      return;
+    }
+    _next_token(p);
+    for (int i = 0; i < _funcs[f_id].n_args; i++) {
+      if (i > 0)
+        _expect(p, ",");
+      _parse_expr(p);
+    }
+    _expect(p, ")");
+    _emit(p, _funcs[f_id].op, 0, 0, 1 - _funcs[f_id].n_args);
+    return;
+  }
+
+  int comp = _parse_component(p);
+
+  char c_name[80];
+  if (comp > -1)
+    snprintf(c_name, 80, "%.63s[%d]", name, comp);
+  else
+    strcpy(c_name, name);
+
+  /* Local variable */
+
+  int v_id = cs_map_name_to_id_try(p->vars, c_name);
+  if (v_id > -1) {
+    _emit(p, CS_MATH_EXPR_VAR, v_id, 0, 1);
+    return;
+  }
+
+  /* Input; a component may be given either as a separate symbol
+     or as a component of a multidimensional symbol */
+
+  for (int pass = 0; pass < 2; pass++) {
+    const char *s_name = (pass == 0) ? c_name : name;
+    int s_comp = (pass == 0) ? 0 : comp;
+    if (pass == 1 && comp < 0)
+      break;
+    for (int i = 0; i < p->n_symbols; i++) {
+      if (strcmp(s_name, p->symbols[i]) == 0) {
+        p->e->sym_used[i] = true;
+        _emit(p, CS_MATH_EXPR_INPUT, i, s_comp, 1);
+        return;
+      }
+    }
+  }
+
+  /* Built-in constants */
+
+  if (comp < 0 && strcmp(name, "pi") == 0)
+    _emit_const(p, cs_math_pi);
+  else if (comp < 0 && strcmp(name, "e") == 0)
+    _emit_const(p, exp(1.));
+  else
+    _error(p, _("unknown symbol: \"%s\""), c_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Parse a primary expression.
+ *
+ * parameters:
+ *   p <-> parser state
+ *----------------------------------------------------------------------------*/
+
+static void
+_parse_primary(_parser_t  *p)
+{
+  if (p->type == _TOKEN_NUMBER) {
+    _emit_const(p, p->value);
+    _next_token(p);
+  }
+  else if (p->type == _TOKEN_NAME)
+    _parse_name(p);
+  else if (_is_op(p, "(")) {
+    _next_token(p);
+    _parse_expr(p);
+    _expect(p, ")");
+  }
+  else if (p->type == _TOKEN_END)
+    _error(p, _("unexpected end of expression"));
+  else
+    _error(p, _("unexpected \"%s\""), p->token);
+}
+
+static void
+_parse_unary(_parser_t  *p);
+
+/*----------------------------------------------------------------------------
+ * Parse a power expression (right-associative).
+ *
+ * parameters:
+ *   p <-> parser state
+ *----------------------------------------------------------------------------*/
+
+static void
+_parse_power(_parser_t  *p)
+{
+  _parse_primary(p);
+
+  if (_is_op(p, "^") || _is_op(p, "**")) {
+    _next_token(p);
+    _parse_unary(p);
+    _emit(p, CS_MATH_EXPR_POW, 0, 0, -1);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Parse an unary expression.
+ *
+ * parameters:
+ *   p <-> parser state
+ *----------------------------------------------------------------------------*/
+
+static void
+_parse_unary(_parser_t  *p)
+{
+  if (_is_op(p, "-")) {
+    _next_token(p);
+    _parse_unary(p);
+    _emit(p, CS_MATH_EXPR_NEG, 0, 0, 0);
+  }
+  else if (_is_op(p, "!")) {
+    _next_token(p);
+    _parse_unary(p);
+    _emit(p, CS_MATH_EXPR_NOT, 0, 0, 0);
+  }
+  else if (_is_op(p, "+")) {
+    _next_token(p);
+    _parse_unary(p);
+  }
+  else
+    _parse_power(p);
+}
+
+/*----------------------------------------------------------------------------
+ * Parse a left-associative binary expression level.
+ *
+ * Levels are numbered from the lowest (0: "||") to the highest
+ * (5: "*", "/", "%") precedence.
+ *
+ * parameters:
+ *   p     <-> parser state
+ *   level <-- precedence level
+ *----------------------------------------------------------------------------*/
+
+static void
+_parse_binary(_parser_t  *p,
+              int         level)
+{
+  static const char *ops[6][4]
+    = {{"||", nullptr},
+       {"&&", nullptr},
+       {"==", "!=", nullptr},
+       {"<", ">", "<=", ">="},
+       {"+", "-", nullptr},
+       {"*", "/", "%", nullptr}};
+  static const _op_t codes[6][4]
+    = {{CS_MATH_EXPR_OR},
+       {CS_MATH_EXPR_AND},
+       {CS_MATH_EXPR_EQ, CS_MATH_EXPR_NE},
+       {CS_MATH_EXPR_LT, CS_MATH_EXPR_GT, CS_MATH_EXPR_LE, CS_MATH_EXPR_GE},
+       {CS_MATH_EXPR_ADD, CS_MATH_EXPR_SUB},
+       {CS_MATH_EXPR_MUL, CS_MATH_EXPR_DIV, CS_MATH_EXPR_MOD}};
+
+  if (level > 5) {
+    _parse_unary(p);
+    return;
+  }
+
+  _parse_binary(p, level + 1);
+
+  while (!p->failed) {
+    int j = -1;
+    for (int i = 0; i < 4 && ops[level][i] != nullptr && j < 0; i++) {
+      if (_is_op(p, ops[level][i]))
+        j = i;
+    }
+    if (j < 0)
+      break;
+    _next_token(p);
+    _parse_binary(p, level + 1);
+    _emit(p, codes[level][j], 0, 0, -1);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Parse an expression.
+ *
+ * parameters:
+ *   p <-> parser state
+ *----------------------------------------------------------------------------*/
+
+static void
+_parse_expr(_parser_t  *p)
+{
+  _parse_binary(p, 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Parse a statement.
+ *
+ * parameters:
+ *   p <-> parser state
+ *----------------------------------------------------------------------------*/
+
+static void
+_parse_statement(_parser_t  *p)
+{
+  if (_is_op(p, ";")) {
+    _next_token(p);
+  }
+
+  else if (_is_op(p, "{")) {
+    _next_token(p);
+    while (!p->failed && !_is_op(p, "}")) {
+      if (p->type == _TOKEN_END)
+        _error(p, _("expected \"}\" before end of expression"));
+      _parse_statement(p);
+    }
+    _next_token(p);
+  }
+
+  else if (p->type == _TOKEN_NAME && strcmp(p->token, "if") == 0) {
+    _next_token(p);
+    _expect(p, "(");
+    _parse_expr(p);
+    _expect(p, ")");
+    _emit(p, CS_MATH_EXPR_MASK_PUSH, 0, 0, -1);
+    p->mask_depth += 1;
+    p->e->mask_size = CS_MAX(p->e->mask_size, p->mask_depth);
+    _parse_statement(p);
+    if (p->type == _TOKEN_NAME && strcmp(p->token, "else") == 0) {
+      _next_token(p);
+      _emit(p, CS_MATH_EXPR_MASK_ELSE, 0, 0, 0);
+      _parse_statement(p);
+    }
+    _emit(p, CS_MATH_EXPR_MASK_POP, 0, 0, 0);
+    p->mask_depth -= 1;
+  }
+
+  else if (p->type == _TOKEN_NAME) {
+    char name[80];
+    strcpy(name, p->token);
+    _next_token(p);
+    int comp = _parse_component(p);
+    if (comp > -1) {
+      char c_name[64];
+      strcpy(c_name, name);
+      snprintf(name, 80, "%.63s[%d]", c_name, comp);
+    }
+    _expect(p, "=");
+    _parse_expr(p);
+    _expect(p, ";");
+    if (!p->failed) {
+      int v_id = cs_map_name_to_id(p->vars, name);
+      _emit(p, CS_MATH_EXPR_STORE, v_id, 0, -1);
+    }
+  }
+
+  else if (p->type == _TOKEN_END)
+    _error(p, _("unexpected end of expression"));
+  else
+    _error(p, _("unexpected \"%s\""), p->token);
+}
+
+/*----------------------------------------------------------------------------
+ * Apply an instruction to a block of values.
+ *
+ * parameters:
+ *   e       <-- pointer to compiled expression
+ *   ins     <-- instruction
+ *   s_id    <-- position of first element of block
+ *   n       <-- number of elements in block
+ *   idx     <-- input index of each element of block (or nullptr)
+ *   inputs  <-- input arrays
+ *   stack   <-> stack values
+ *   sp      <-> stack position
+ *   vars    <-> variable values
+ *   masks   <-> masks (condition and combined mask for each level)
+ *   mp      <-> mask position
+ *----------------------------------------------------------------------------*/
+
+static void
+_apply(const cs_math_expr_t         *e,
+       const _instr_t               *ins,
+       cs_lnum_t                     s_id,
+       cs_lnum_t                     n,
+       const cs_lnum_t               idx[],
+       const cs_math_expr_input_t    inputs[],
+       cs_real_t                    *stack,
+       int                          *sp,
+       cs_real_t                    *vars,
+       cs_real_t                    *masks,
+       int                          *mp)
+{
+  const cs_lnum_t b = CS_MATH_EXPR_BLOCK_SIZE;
+
+  cs_real_t *r = stack + (*sp - 1)*b;   /* top of stack */
+  cs_real_t *a = r - b;                 /* first operand of binary op. */
+
+  switch (ins->op) {
+
+  case CS_MATH_EXPR_CONST:
+    {
+      const cs_real_t c = e->consts[ins->id];
+      r += b;
+      for (cs_lnum_t i = 0; i < n; i++)
+        r[i] = c;
+      *sp += 1;
+    }
+    break;
+
+  case CS_MATH_EXPR_INPUT:
+    {
+      const cs_math_expr_input_t *in = inputs + ins->id;
+      const cs_lnum_t s = in->stride;
+      const cs_real_t *v = in->val + ins->comp;
+      r += b;
+      if (s == 0) {
+        for (cs_lnum_t i = 0; i < n; i++)
+          r[i] = v[0];
+      }
+      else if (in->indexed && idx != nullptr) {
+        for (cs_lnum_t i = 0; i < n; i++)
+          r[i] = v[idx[i]*s];
+      }
+      else {
+        for (cs_lnum_t i = 0; i < n; i++)
+          r[i] = v[(s_id + i)*s];
+      }
+      *sp += 1;
+    }
+    break;
+
+  case CS_MATH_EXPR_VAR:
+    memcpy(r + b, vars + ins->id*b, n*sizeof(cs_real_t));
+    *sp += 1;
+    break;
+
+  case CS_MATH_EXPR_STORE:
+    {
+      cs_real_t *v = vars + ins->id*b;
+      if (*mp > 0) {
+        const cs_real_t *m = masks + (2*(*mp) - 1)*b;
+        for (cs_lnum_t i = 0; i < n; i++)
+          v[i] = (m[i] > 0) ? r[i] : v[i];
+      }
+      else
+        memcpy(v, r, n*sizeof(cs_real_t));
+      *sp -= 1;
+    }
+    break;
+
+  case CS_MATH_EXPR_MASK_PUSH:
+    {
+      cs_real_t *c = masks + 2*(*mp)*b;
+      cs_real_t *m = c + b;
+      memcpy(c, r, n*sizeof(cs_real_t));
+      if (*mp > 0) {
+        const cs_real_t *m_p = c - b;
+        for (cs_lnum_t i = 0; i < n; i++)
+          m[i] = (m_p[i] > 0 && fabs(c[i]) > 0) ? 1 : 0;
+      }
+      else {
+        for (cs_lnum_t i = 0; i < n; i++)
+          m[i] = (fabs(c[i]) > 0) ? 1 : 0;
+      }
+      *sp -= 1;
+      *mp += 1;
+    }
+    break;
+
+  case CS_MATH_EXPR_MASK_ELSE:
+    {
+      cs_real_t *c = masks + 2*(*mp - 1)*b;
+      cs_real_t *m = c + b;
+      if (*mp > 1) {
+        const cs_real_t *m_p = c - b;
+        for (cs_lnum_t i = 0; i < n; i++)
+          m[i] = (m_p[i] > 0 && !(fabs(c[i]) > 0)) ? 1 : 0;
+      }
+      else {
+        for (cs_lnum_t i = 0; i < n; i++)
+          m[i] = (fabs(c[i]) > 0) ? 0 : 1;
+      }
+    }
+    break;
+
+  case CS_MATH_EXPR_MASK_POP:
+    *mp -= 1;
+    break;
+
+  case CS_MATH_EXPR_NEG:
+    for (cs_lnum_t i = 0; i < n; i++)
+      r[i] = -r[i];
+    break;
+
+  case CS_MATH_EXPR_NOT:
+    for (cs_lnum_t i = 0; i < n; i++)
+      r[i] = (fabs(r[i]) > 0) ? 0 : 1;
+    break;
+
+#define _BINARY_OP(_code, _expr) \
+  case _code: \
+    for (cs_lnum_t i = 0; i < n; i++) \
+      a[i] = _expr; \
+    *sp -= 1; \
+    break;
+
+  _BINARY_OP(CS_MATH_EXPR_ADD, a[i] + r[i])
+  _BINARY_OP(CS_MATH_EXPR_SUB, a[i] - r[i])
+  _BINARY_OP(CS_MATH_EXPR_MUL, a[i] * r[i])
+  _BINARY_OP(CS_MATH_EXPR_DIV, a[i] / r[i])
+  _BINARY_OP(CS_MATH_EXPR_MOD, fmod(a[i], r[i]))
+  _BINARY_OP(CS_MATH_EXPR_POW, pow(a[i], r[i]))
+  _BINARY_OP(CS_MATH_EXPR_LT, (a[i] < r[i]) ? 1 : 0)
+  _BINARY_OP(CS_MATH_EXPR_GT, (a[i] > r[i]) ? 1 : 0)
+  _BINARY_OP(CS_MATH_EXPR_LE, (a[i] <= r[i]) ? 1 : 0)
+  _BINARY_OP(CS_MATH_EXPR_GE, (a[i] >= r[i]) ? 1 : 0)
+  _BINARY_OP(CS_MATH_EXPR_EQ, (a[i] <= r[i] && a[i] >= r[i]) ? 1 : 0)
+  _BINARY_OP(CS_MATH_EXPR_NE, (a[i] < r[i] || a[i] > r[i]) ? 1 : 0)
+  _BINARY_OP(CS_MATH_EXPR_AND, (fabs(a[i]) > 0 && fabs(r[i]) > 0) ? 1 : 0)
+  _BINARY_OP(CS_MATH_EXPR_OR, (fabs(a[i]) > 0 || fabs(r[i]) > 0) ? 1 : 0)
+  _BINARY_OP(CS_MATH_EXPR_MIN, fmin(a[i], r[i]))
+  _BINARY_OP(CS_MATH_EXPR_MAX, fmax(a[i], r[i]))
+  _BINARY_OP(CS_MATH_EXPR_ATAN2, atan2(a[i], r[i]))
+
+#undef _BINARY_OP
+
+#define _UNARY_FUNC(_code, _func) \
+  case _code: \
+    for (cs_lnum_t i = 0; i < n; i++) \
+      r[i] = _func(r[i]); \
+    break;
+
+  _UNARY_FUNC(CS_MATH_EXPR_ABS, fabs)
+  _UNARY_FUNC(CS_MATH_EXPR_SQRT, sqrt)
+  _UNARY_FUNC(CS_MATH_EXPR_CBRT, cbrt)
+  _UNARY_FUNC(CS_MATH_EXPR_EXP, exp)
+  _UNARY_FUNC(CS_MATH_EXPR_LOG, log)
+  _UNARY_FUNC(CS_MATH_EXPR_LOG10, log10)
+  _UNARY_FUNC(CS_MATH_EXPR_SIN, sin)
+  _UNARY_FUNC(CS_MATH_EXPR_COS, cos)
+  _UNARY_FUNC(CS_MATH_EXPR_TAN, tan)
+  _UNARY_FUNC(CS_MATH_EXPR_ASIN, asin)
+  _UNARY_FUNC(CS_MATH_EXPR_ACOS, acos)
+  _UNARY_FUNC(CS_MATH_EXPR_ATAN, atan)
+  _UNARY_FUNC(CS_MATH_EXPR_SINH, sinh)
+  _UNARY_FUNC(CS_MATH_EXPR_COSH, cosh)
+  _UNARY_FUNC(CS_MATH_EXPR_TANH, tanh)
+  _UNARY_FUNC(CS_MATH_EXPR_FLOOR, floor)
+  _UNARY_FUNC(CS_MATH_EXPR_CEIL, ceil)
+
+#undef _UNARY_FUNC
+
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compile a mathematical expression.
+ *
+ * The expression uses the syntax of GUI formulas: a series of assignments
+ * ("a = <expression>;"), possibly in "if (...) ... else ..." blocks.
+ * Intermediate variables may be used freely.
+ *
+ * Identifiers which are not assigned must match one of the given input
+ * symbols, or the "pi" and "e" constants. Components of multidimensional
+ * inputs are accessed using the "name[i]" syntax.
+ *
+ * \param[in]  formula    expression text
+ * \param[in]  n_symbols  number of input symbols
+ * \param[in]  symbols    input symbol names
+ * \param[in]  n_outputs  number of outputs
+ * \param[in]  outputs    output names
+ * \param[in]  fatal      if true, errors are fatal; otherwise, nullptr is
+ *                        returned in case of error
+ *
+ * \return  pointer to compiled expression, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_math_expr_t *
+cs_math_expr_create(const char   *formula,
+                    int           n_symbols,
+                    const char   *symbols[],
+                    int           n_outputs,
+                    const char   *outputs[],
+                    bool          fatal)
+{
+  cs_math_expr_t *e = nullptr;
+  BFT_MALLOC(e, 1, cs_math_expr_t);
+
+  e->n_instr = 0;
+  e->n_max_instr = 0;
+  e->instr = nullptr;
+  e->n_consts = 0;
+  e->n_max_consts = 0;
+  e->consts = nullptr;
+  e->n_symbols = n_symbols;
+  BFT_MALLOC(e->sym_used, n_symbols, bool);
+  for (int i = 0; i < n_symbols; i++)
+    e->sym_used[i] = false;
+  e->n_vars = 0;
+  e->n_outputs = n_outputs;
+  BFT_MALLOC(e->output_var, n_outputs, int);
+  e->stack_size = 0;
+  e->mask_size = 0;
+
+  _parser_t p;
+  p.s = formula;
+  p.pos = 0;
+  p.line = 1;
+  p.n_symbols = n_symbols;
+  p.symbols = symbols;
+  p.vars = cs_map_name_to_id_create();
+  p.depth = 0;
+  p.mask_depth = 0;
+  p.failed = false;
+  p.err[0] = '\0';
+  p.e = e;
+
+  _next_token(&p);
+  while (p.type != _TOKEN_END)
+    _parse_statement(&p);
+
+  for (int i = 0; i < n_outputs && !p.failed; i++) {
+    e->output_var[i] = cs_map_name_to_id_try(p.vars, outputs[i]);
+    if (e->output_var[i] < 0)
+      _error(&p, _("output \"%s\" is not assigned"), outputs[i]);
+  }
+
+  e->n_vars = cs_map_name_to_id_size(p.vars);
+  cs_map_name_to_id_destroy(&(p.vars));
+
+  if (p.failed) {
+    if (fatal)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Error compiling expression:\n"
+                  "%s\n\n"
+                  "%s"), formula, p.err);
+    cs_math_expr_destroy(&e);
+  }
+
+  return e;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a compiled expression.
+ *
+ * \param[in, out]  e  pointer to compiled expression pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_math_expr_destroy(cs_math_expr_t  **e)
+{
+  cs_math_expr_t *_e = *e;
+
+  if (_e == nullptr)
+    return;
+
+  BFT_FREE(_e->instr);
+  BFT_FREE(_e->consts);
+  BFT_FREE(_e->sym_used);
+  BFT_FREE(_e->output_var);
+
+  BFT_FREE(*e);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query if a given input symbol is used by a compiled expression.
+ *
+ * \param[in]  e          pointer to compiled expression
+ * \param[in]  symbol_id  input symbol id
+ *
+ * \return  true if the input is used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_math_expr_uses_symbol(const cs_math_expr_t  *e,
+                         int                    symbol_id)
+{
+  if (symbol_id < 0 || symbol_id >= e->n_symbols)
+    return false;
+
+  return e->sym_used[symbol_id];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Evaluate a compiled expression over a set of elements.
+ *
+ * Elements are processed by blocks, each bytecode instruction being applied
+ * to all elements of a block in turn, so the inner loops are vectorizable.
+ *
+ * Entries of the inputs array which are not used by the expression
+ * (see \ref cs_math_expr_uses_symbol) may be left uninitialized.
+ *
+ * \param[in]       e        pointer to compiled expression
+ * \param[in]       n_elts   number of elements
+ * \param[in]       elt_ids  element ids, or nullptr
+ * \param[in]       inputs   input arrays, in symbols order
+ * \param[in, out]  outputs  output arrays, in outputs order
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_math_expr_evaluate(const cs_math_expr_t         *e,
+                      cs_lnum_t                     n_elts,
+                      const cs_lnum_t               elt_ids[],
+                      const cs_math_expr_input_t    inputs[],
+                      const cs_math_expr_output_t   outputs[])
+{
+  const cs_lnum_t b_size = CS_MATH_EXPR_BLOCK_SIZE;
+  const cs_lnum_t n_blocks = (n_elts + b_size - 1) / b_size;
+
+  /* Work arrays for the stack, variables and masks of each thread */
+
+  const size_t w_size = (e->stack_size + e->n_vars + 2*e->mask_size) * b_size;
+
+  int n_threads = 1;
+#if defined(HAVE_OPENMP)
+  n_threads = (n_blocks > 1) ? cs_glob_n_threads : 1;
+#endif
+
+  cs_real_t *_work;
+  BFT_MALLOC(_work, w_size*n_threads, cs_real_t);
+
+  /* Masked-out elements are also evaluated */
+
+  cs_fp_exception_disable_trap();
+
+# pragma omp parallel for num_threads(n_threads)
+  for (cs_lnum_t b_id = 0; b_id < n_blocks; b_id++) {
+
+    int t_id = 0;
+#if defined(HAVE_OPENMP)
+    t_id = omp_get_thread_num();
+#endif
+
+    cs_real_t *stack = _work + t_id*w_size;
+    cs_real_t *vars = stack + e->stack_size*b_size;
+    cs_real_t *masks = vars + e->n_vars*b_size;
+
+    const cs_lnum_t s_id = b_id*b_size;
+    const cs_lnum_t n = CS_MIN(b_size, n_elts - s_id);
+    const cs_lnum_t *idx = (elt_ids != nullptr) ? elt_ids + s_id : nullptr;
+
+    int sp = 0, mp = 0;
+
+    for (cs_lnum_t i = 0; i < e->n_vars*b_size; i++)
+      vars[i] = 0;
+
+    for (int j = 0; j < e->n_instr; j++)
+      _apply(e, e->instr + j, s_id, n, idx, inputs,
+             stack, &sp, vars, masks, &mp);
+
+    assert(sp == 0 && mp == 0);
+
+    for (int k = 0; k < e->n_outputs; k++) {
+      const cs_math_expr_output_t *out = outputs + k;
+      const cs_real_t *v = vars + e->output_var[k]*b_size;
+      const cs_lnum_t s = out->stride;
+      if (out->indexed && idx != nullptr) {
+        for (cs_lnum_t i = 0; i < n; i++)
+          out->val[idx[i]*s] = v[i];
+      }
+      else {
+        cs_real_t *o = out->val + s_id*s;
+        for (cs_lnum_t i = 0; i < n; i++)
+          o[i*s] = v[i];
+      }
+    }
+
+  }
+
+  cs_fp_exception_restore_trap();
+
+  BFT_FREE(_work);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
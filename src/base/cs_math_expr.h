@@ -0,0 +1,167 @@
+#ifndef __CS_MATH_EXPR_H__
+#define __CS_MATH_EXPR_H__
+
+/*============================================================================
+ * Interpreted evaluation of mathematical expressions over arrays.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Input array associated with an expression symbol */
+
+typedef struct {
+
+  const cs_real_t  *val;       /*!< values; for a strided array, value of
+                                    element i is val[i*stride] */
+  cs_lnum_t         stride;    /*!< values stride, or 0 for a uniform value */
+  bool              indexed;   /*!< if true, values are accessed through the
+                                    element ids list (if present); otherwise,
+                                    they are accessed by position in that
+                                    list */
+
+} cs_math_expr_input_t;
+
+/*! Output array associated with an expression result */
+
+typedef struct {
+
+  cs_real_t        *val;       /*!< values; for a strided array, value of
+                                    element i is val[i*stride] */
+  cs_lnum_t         stride;    /*!< values stride */
+  bool              indexed;   /*!< if true, values are accessed through the
+                                    element ids list (if present); otherwise,
+                                    they are accessed by position in that
+                                    list */
+
+} cs_math_expr_output_t;
+
+/*! Opaque compiled expression */
+
+typedef struct _cs_math_expr_t  cs_math_expr_t;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compile a mathematical expression.
+ *
+ * The expression uses the syntax of GUI formulas: a series of assignments
+ * ("a = <expression>;"), possibly in "if (...) ... else ..." blocks.
+ * Intermediate variables may be used freely.
+ *
+ * Identifiers which are not assigned must match one of the given input
+ * symbols, or the "pi" and "e" constants. Components of multidimensional
+ * inputs are accessed using the "name[i]" syntax.
+ *
+ * \param[in]  formula    expression text
+ * \param[in]  n_symbols  number of input symbols
+ * \param[in]  symbols    input symbol names
+ * \param[in]  n_outputs  number of outputs
+ * \param[in]  outputs    output names
+ * \param[in]  fatal      if true, errors are fatal; otherwise, nullptr is
+ *                        returned in case of error
+ *
+ * \return  pointer to compiled expression, or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_math_expr_t *
+cs_math_expr_create(const char   *formula,
+                    int           n_symbols,
+                    const char   *symbols[],
+                    int           n_outputs,
+                    const char   *outputs[],
+                    bool          fatal);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a compiled expression.
+ *
+ * \param[in, out]  e  pointer to compiled expression pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_math_expr_destroy(cs_math_expr_t  **e);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query if a given input symbol is used by a compiled expression.
+ *
+ * \param[in]  e          pointer to compiled expression
+ * \param[in]  symbol_id  input symbol id
+ *
+ * \return  true if the input is used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_math_expr_uses_symbol(const cs_math_expr_t  *e,
+                         int                    symbol_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Evaluate a compiled expression over a set of elements.
+ *
+ * Elements are processed by blocks, each bytecode instruction being applied
+ * to all elements of a block in turn, so the inner loops are vectorizable.
+ *
+ * Entries of the inputs array which are not used by the expression
+ * (see \ref cs_math_expr_uses_symbol) may be left uninitialized.
+ *
+ * \param[in]       e        pointer to compiled expression
+ * \param[in]       n_elts   number of elements
+ * \param[in]       elt_ids  element ids, or nullptr
+ * \param[in]       inputs   input arrays, in symbols order
+ * \param[in, out]  outputs  output arrays, in outputs order
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_math_expr_evaluate(const cs_math_expr_t         *e,
+                      cs_lnum_t                     n_elts,
+                      const cs_lnum_t               elt_ids[],
+                      const cs_math_expr_input_t    inputs[],
+                      const cs_math_expr_output_t   outputs[]);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MATH_EXPR_H__ */
@@ -49,6 +49,7 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_file.h"
 #include "cs_mesh.h"
 #include "cs_mesh_connect.h"
 #include "cs_parall.h"
@@ -125,6 +126,19 @@ struct _cs_medcoupling_remapper_t {
   void                     *remapper;
 #endif
 
+  /* Interpolation matrix stored by setup (CSR format, one row per target
+     element, columns referring to values of the complete source fields),
+     or NULL if values are interpolated by the MEDCoupling remapper */
+
+  cs_lnum_t                 n_matrix_rows;
+  cs_lnum_t                 n_matrix_src;     /* Number of source values */
+  cs_lnum_t                *matrix_index;
+  cs_lnum_t                *matrix_col_id;
+  cs_real_t                *matrix_coeff;
+
+  char                     *matrix_cache_dir; /* Optional directory in which
+                                                 matrices are saved */
+
 };
 
 /*============================================================================
@@ -137,6 +151,13 @@ static int                          _n_remappers = 0;
 
 static cs_medcoupling_remapper_t  **_remapper = NULL;
 
+static const char _matrix_cache_magic[32]
+  = "MEDCoupling remapper matrix 1.0";
+
+/* Size of interpolation matrix cache signature */
+
+#define CS_MEDCOUPLING_REMAPPER_N_SIG 18
+
 #endif
 
 /*============================================================================
@@ -302,6 +323,14 @@ _create_remapper(const char                        *name,
   r->bbox_source_mesh
     = dynamic_cast<MEDCouplingUMesh *>(r->source_fields[0]->getMesh());
 
+  r->n_matrix_rows = 0;
+  r->n_matrix_src = 0;
+  r->matrix_index = NULL;
+  r->matrix_col_id = NULL;
+  r->matrix_coeff = NULL;
+
+  r->matrix_cache_dir = NULL;
+
   return r;
 }
 
@@ -369,6 +398,352 @@ _add_remapper(const char   *name,
   _n_remappers++;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Free the interpolation matrix stored by a remapper
+ *
+ * \param[in, out] r  pointer to the cs_medcoupling_remapper_t struct
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_free_matrix(cs_medcoupling_remapper_t  *r)
+{
+  r->n_matrix_rows = 0;
+  r->n_matrix_src = 0;
+
+  BFT_FREE(r->matrix_index);
+  BFT_FREE(r->matrix_col_id);
+  BFT_FREE(r->matrix_coeff);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Store the interpolation matrix of the MEDCoupling remapper
+ *
+ * Coefficients are normalized by the sum of each row, which matches the
+ * interpolation of intensive fields.
+ *
+ * \param[in, out] r        pointer to the cs_medcoupling_remapper_t struct
+ * \param[in]      src_ids  ids of source elements in the complete source
+ *                          mesh for each element of the reduced source
+ *                          mesh, or NULL if not reduced
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_build_matrix(cs_medcoupling_remapper_t  *r,
+              const mcIdType             *src_ids)
+{
+  _free_matrix(r);
+
+  const std::vector<std::map<mcIdType, double> > &mat
+    = r->remapper->getCrudeMatrix();
+
+  const cs_lnum_t n_rows = mat.size();
+
+  r->n_matrix_rows = n_rows;
+  r->n_matrix_src = r->source_fields[0]->getArray()->getNumberOfTuples();
+
+  BFT_MALLOC(r->matrix_index, n_rows + 1, cs_lnum_t);
+
+  r->matrix_index[0] = 0;
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    r->matrix_index[i+1] = r->matrix_index[i] + mat[i].size();
+
+  const cs_lnum_t nnz = r->matrix_index[n_rows];
+
+  BFT_MALLOC(r->matrix_col_id, nnz, cs_lnum_t);
+  BFT_MALLOC(r->matrix_coeff, nnz, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+
+    cs_real_t row_sum = 0;
+    cs_lnum_t j = r->matrix_index[i];
+
+    for (std::map<mcIdType, double>::const_iterator it = mat[i].begin();
+         it != mat[i].end();
+         ++it, j++) {
+      r->matrix_col_id[j] = (src_ids != NULL) ? src_ids[it->first] : it->first;
+      r->matrix_coeff[j] = it->second;
+      row_sum += it->second;
+    }
+
+    /* Rows with no (or null) intersections get the default value */
+
+    if (row_sum > 0) {
+      for (j = r->matrix_index[i]; j < r->matrix_index[i+1]; j++)
+        r->matrix_coeff[j] /= row_sum;
+    }
+    else
+      r->matrix_index[i+1] = r->matrix_index[i];
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Compute the signature used to check the interpolation matrix cache
+ *
+ * \param[in]  r    pointer to the cs_medcoupling_remapper_t struct
+ * \param[out] sig  signature (counts and source and target bounding boxes)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_matrix_signature(cs_medcoupling_remapper_t  *r,
+                  double                      sig[])
+{
+  for (int i = 0; i < CS_MEDCOUPLING_REMAPPER_N_SIG; i++)
+    sig[i] = 0.;
+
+  const MEDCouplingMesh *src_mesh = r->source_fields[0]->getMesh();
+  const MEDCouplingUMesh *tgt_mesh = r->target_mesh->med_mesh;
+
+  sig[0] = cs_glob_n_ranks;
+  sig[1] = r->target_mesh->n_elts;
+  sig[2] = r->source_fields[0]->getArray()->getNumberOfTuples();
+  sig[3] = (strcmp(r->interp_method, "P0P0") == 0) ? 0 : 1;
+  sig[4] = src_mesh->getSpaceDimension();
+  sig[5] = tgt_mesh->getSpaceDimension();
+
+  if (sig[4] <= 3 && sig[5] <= 3) {
+    src_mesh->getBoundingBox(sig + 6);
+    tgt_mesh->getBoundingBox(sig + 12);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Build the name of the interpolation matrix cache file of a
+ *          remapper for the local rank
+ *
+ * \param[in] r  pointer to the cs_medcoupling_remapper_t struct
+ *
+ * \return  pointer to allocated file name
+ */
+/*----------------------------------------------------------------------------*/
+
+static char *
+_matrix_cache_file_name(const cs_medcoupling_remapper_t  *r)
+{
+  size_t l = strlen(r->matrix_cache_dir) + strlen(r->name) + 32;
+
+  char *name;
+  BFT_MALLOC(name, l, char);
+  snprintf(name, l, "%s/%s_r%05d.matrix",
+           r->matrix_cache_dir, r->name, CS_MAX(cs_glob_rank_id, 0));
+
+  return name;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Try to read the interpolation matrix of a remapper from its
+ *          cache file
+ *
+ * \param[in, out] r  pointer to the cs_medcoupling_remapper_t struct
+ *
+ * \return  true if the matrix was read, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_read_matrix_cache(cs_medcoupling_remapper_t  *r)
+{
+  if (r->matrix_cache_dir == NULL)
+    return false;
+
+  char *name = _matrix_cache_file_name(r);
+
+  FILE *f = fopen(name, "rb");
+  BFT_FREE(name);
+
+  if (f == NULL)
+    return false;
+
+  bool retval = false;
+
+  char magic[32];
+  double sig[CS_MEDCOUPLING_REMAPPER_N_SIG];
+  double ref_sig[CS_MEDCOUPLING_REMAPPER_N_SIG];
+  cs_lnum_t n_rows = 0;
+
+  _matrix_signature(r, ref_sig);
+
+  if (   fread(magic, 1, 32, f) == 32
+      && memcmp(magic, _matrix_cache_magic, 32) == 0
+      && fread(sig, sizeof(double), CS_MEDCOUPLING_REMAPPER_N_SIG, f)
+         == CS_MEDCOUPLING_REMAPPER_N_SIG
+      && memcmp(sig, ref_sig, sizeof(sig)) == 0
+      && fread(&n_rows, sizeof(cs_lnum_t), 1, f) == 1
+      && n_rows == r->target_mesh->n_elts) {
+
+    _free_matrix(r);
+
+    BFT_MALLOC(r->matrix_index, n_rows + 1, cs_lnum_t);
+
+    size_t n_read = fread(r->matrix_index, sizeof(cs_lnum_t), n_rows + 1, f);
+
+    if (n_read == (size_t)(n_rows + 1) && r->matrix_index[0] == 0) {
+      const size_t nnz = r->matrix_index[n_rows];
+      BFT_MALLOC(r->matrix_col_id, nnz, cs_lnum_t);
+      BFT_MALLOC(r->matrix_coeff, nnz, cs_real_t);
+      if (   fread(r->matrix_col_id, sizeof(cs_lnum_t), nnz, f) == nnz
+          && fread(r->matrix_coeff, sizeof(cs_real_t), nnz, f) == nnz) {
+        r->n_matrix_rows = n_rows;
+        r->n_matrix_src = (cs_lnum_t)sig[2];
+        retval = true;
+      }
+    }
+
+    if (retval == false)
+      _free_matrix(r);
+
+  }
+
+  fclose(f);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Write the interpolation matrix of a remapper to its cache file
+ *
+ * \param[in] r  pointer to the cs_medcoupling_remapper_t struct
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_write_matrix_cache(cs_medcoupling_remapper_t  *r)
+{
+  if (r->matrix_cache_dir == NULL || r->matrix_index == NULL)
+    return;
+
+  if (cs_file_mkdir_default(r->matrix_cache_dir) != 0) {
+    bft_printf(_("\nWarning: unable to create directory \"%s\";\n"
+                 "         remapper \"%s\" matrix is not saved.\n"),
+               r->matrix_cache_dir, r->name);
+    return;
+  }
+
+  char *name = _matrix_cache_file_name(r);
+
+  FILE *f = fopen(name, "wb");
+
+  if (f == NULL) {
+    bft_printf(_("\nWarning: unable to open file \"%s\";\n"
+                 "         remapper \"%s\" matrix is not saved.\n"),
+               name, r->name);
+    BFT_FREE(name);
+    return;
+  }
+
+  double sig[CS_MEDCOUPLING_REMAPPER_N_SIG];
+  _matrix_signature(r, sig);
+
+  const cs_lnum_t n_rows = r->n_matrix_rows;
+  const size_t nnz = r->matrix_index[n_rows];
+
+  size_t n_written = fwrite(_matrix_cache_magic, 1, 32, f);
+  n_written += fwrite(sig, sizeof(double), CS_MEDCOUPLING_REMAPPER_N_SIG, f);
+  n_written += fwrite(&n_rows, sizeof(cs_lnum_t), 1, f);
+  n_written += fwrite(r->matrix_index, sizeof(cs_lnum_t), n_rows + 1, f);
+  n_written += fwrite(r->matrix_col_id, sizeof(cs_lnum_t), nnz, f);
+  n_written += fwrite(r->matrix_coeff, sizeof(cs_real_t), nnz, f);
+
+  fclose(f);
+
+  if (n_written != 32 + CS_MEDCOUPLING_REMAPPER_N_SIG + n_rows + 2 + 2*nnz) {
+    bft_printf(_("\nWarning: error writing file \"%s\";\n"
+                 "         it is removed.\n"), name);
+    remove(name);
+  }
+
+  BFT_FREE(name);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Interpolate values for a given field using the stored matrix
+ *
+ * \param[in] r            pointer to the cs_medcoupling_remapper_t struct
+ * \param[in] field_id     id of the field to interpolate (in list given before)
+ * \param[in] default_val  value to apply for elements not intersected by
+ *                         source mesh
+ *
+ * \return  pointer to cs_real_t array containing new values
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_copy_values_from_matrix(cs_medcoupling_remapper_t  *r,
+                         int                         field_id,
+                         double                      default_val)
+{
+  cs_real_t *new_vals = NULL;
+
+  const cs_lnum_t n_rows = r->n_matrix_rows;
+
+  if (n_rows < 1)
+    return new_vals;
+
+  const DataArrayDouble *src_array = r->source_fields[field_id]->getArray();
+
+  if ((cs_lnum_t)(src_array->getNumberOfTuples()) != r->n_matrix_src)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Remapper \"%s\": field \"%s\" has %d values,\n"
+                "but the interpolation matrix was built for %d values."),
+              r->name, r->field_names[field_id],
+              (int)src_array->getNumberOfTuples(), (int)r->n_matrix_src);
+
+  const cs_lnum_t dim = src_array->getNumberOfComponents();
+  const double *src_vals = src_array->getConstPointer();
+
+  const cs_lnum_t *restrict m_index = r->matrix_index;
+  const cs_lnum_t *restrict m_col_id = r->matrix_col_id;
+  const cs_real_t *restrict m_coeff = r->matrix_coeff;
+
+  /* Output values are ordered as in the copy functions using the
+     MEDCoupling remapper */
+
+  const cs_lnum_t *r_new_connec = NULL;
+  cs_lnum_t n_vals = dim * n_rows;
+
+  if (r->target_mesh->elt_dim == 3) {
+    n_vals = dim * cs_glob_mesh->n_cells;
+    if (r->target_mesh->elt_list != NULL)
+      r_new_connec = r->target_mesh->new_to_old;
+  }
+
+  BFT_MALLOC(new_vals, n_vals, cs_real_t);
+  for (cs_lnum_t i = 0; i < n_vals; i++)
+    new_vals[i] = default_val;
+
+# pragma omp parallel for if (n_rows > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+
+    if (m_index[i+1] == m_index[i])
+      continue;
+
+    cs_lnum_t e_id = (r_new_connec != NULL) ? r_new_connec[i] : i;
+    cs_real_t *t_vals = new_vals + e_id*dim;
+
+    for (cs_lnum_t k = 0; k < dim; k++)
+      t_vals[k] = 0.;
+
+    for (cs_lnum_t j = m_index[i]; j < m_index[i+1]; j++) {
+      const double *s_vals = src_vals + m_col_id[j]*dim;
+      for (cs_lnum_t k = 0; k < dim; k++)
+        t_vals[k] += m_coeff[j] * s_vals[k];
+    }
+
+  }
+
+  return new_vals;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Interpolate values for a given field without using the reduced bbox
@@ -526,6 +901,8 @@ _setup_no_bbox(cs_medcoupling_remapper_t *r)
     r->remapper->prepare(source_field->getMesh(),
                          r->target_mesh->med_mesh,
                          r->interp_method);
+
+    _build_matrix(r, NULL);
   }
 }
 
@@ -560,6 +937,12 @@ _setup_with_bbox(cs_medcoupling_remapper_t  *r)
     r->remapper->prepare(source_field->getMesh(),
                          r->target_mesh->med_mesh,
                          r->interp_method);
+
+    /* Values on nodes of the reduced mesh are renumbered, so the matrix
+       is only stored for values on cells */
+
+    if (r->source_fields[0]->getTypeOfField() == MEDCoupling::ON_CELLS)
+      _build_matrix(r, subcells->getConstPointer());
   }
 }
 
@@ -587,6 +970,9 @@ _cs_medcoupling_remapper_destroy(cs_medcoupling_remapper_t *r)
   //r->bbox_source_mesh->decrRef();
   delete r->remapper;
 
+  _free_matrix(r);
+  BFT_FREE(r->matrix_cache_dir);
+
   // Mesh will deallocated afterwards since it can be shared
   r->target_mesh = NULL;
 
@@ -746,13 +1132,18 @@ cs_medcoupling_remapper_set_iteration(cs_medcoupling_remapper_t  *r,
  *
  * \param[in] r      pointer to the cs_medcoupling_remapper_t struct
  * \param[in] key    pointer to string representing key
- *                   currently handled: one of {Precision, IntersectionType}
+ *                   currently handled: one of {Precision, IntersectionType,
+ *                   MatrixCache}
  * \param[in] value  pointer to string representing value:
  *                   - for Precision: floating-point value (default: 1e-12)
  *                   - for IntersectionType: one of {Triangulation, Convex,
  *                     Geometric2D, PointLocator, Barycentric,
  *                     BarycentricGeo2D, MappedBarycentric}
  *                     (see MEDCoupling INTERP_KERNEL documentation)
+ *                   - for MatrixCache: directory in which interpolation
+ *                     matrices are saved by \ref cs_medcoupling_remapper_setup
+ *                     and reloaded in subsequent runs when source and
+ *                     target meshes match (empty string to disable)
  */
 /*----------------------------------------------------------------------------*/
 
@@ -802,6 +1193,14 @@ cs_medcoupling_remapper_set_options(cs_medcoupling_remapper_t  *r,
          value);
   }
 
+  else if (strcmp(key, "MatrixCache") == 0) {
+    BFT_FREE(r->matrix_cache_dir);
+    if (strlen(value) > 0) {
+      BFT_MALLOC(r->matrix_cache_dir, strlen(value) + 1, char);
+      strcpy(r->matrix_cache_dir, value);
+    }
+  }
+
   else
     bft_printf
       (_("\nWarning: unknown or unsupported MEDCoupling remapper option type\n"
@@ -814,6 +1213,12 @@ cs_medcoupling_remapper_set_options(cs_medcoupling_remapper_t  *r,
 /*!
  * \brief update the interpolation matrix of the remapper
  *
+ * The matrix is stored so that values of fields defined on the same source
+ * mesh (such as other time values) are interpolated by a simple
+ * matrix-vector product. If the "MatrixCache" option is set, the matrix
+ * is read from the matching file when source and target meshes are
+ * unchanged, or saved for subsequent runs otherwise.
+ *
  * \param[in] r            pointer to the cs_medcoupling_remapper_t struct
  */
 /*----------------------------------------------------------------------------*/
@@ -829,7 +1234,13 @@ cs_medcoupling_remapper_setup(cs_medcoupling_remapper_t  *r)
 #else
   cs_lnum_t n_elts = r->target_mesh->n_elts;
 
+  _free_matrix(r);
+
   if (n_elts > 0) {
+
+    if (_read_matrix_cache(r))
+      return;
+
     // List of subcells intersecting the local mesh bounding box
     const cs_real_t *rbbox = r->target_mesh->bbox;
 
@@ -840,6 +1251,8 @@ cs_medcoupling_remapper_setup(cs_medcoupling_remapper_t  *r)
       _setup_with_bbox(r);
     }
 
+    _write_matrix_cache(r);
+
   }
 #endif
 }
@@ -870,7 +1283,9 @@ cs_medcoupling_remapper_copy_values(cs_medcoupling_remapper_t  *r,
             _("Error: This function cannot be called without "
               "MEDCoupling support.\n"));
 #else
-  if (r->target_mesh->elt_dim == 2) {
+  if (r->matrix_index != NULL) {
+    new_vals = _copy_values_from_matrix(r, field_id, default_val);
+  } else if (r->target_mesh->elt_dim == 2) {
     new_vals = _copy_values_no_bbox(r, field_id, default_val);
   } else if (r->target_mesh->elt_dim == 3) {
     new_vals = _copy_values_with_bbox(r, field_id, default_val);
@@ -121,13 +121,18 @@ cs_medcoupling_remapper_set_iteration(cs_medcoupling_remapper_t  *r,
  *
  * \param[in] r      pointer to the cs_medcoupling_remapper_t struct
  * \param[in] key    pointer to string representing key
- *                   currently handled: one of {Precision, IntersectionType}
+ *                   currently handled: one of {Precision, IntersectionType,
+ *                   MatrixCache}
  * \param[in] value  pointer to string representing value:
  *                   - for Precision: floating-point value (default: 1e-12)
  *                   - for IntersectionType: one of {Triangulation, Convex,
  *                     Geometric2D, PointLocator, Barycentric,
  *                     BarycentricGeo2D, MappedBarycentric}
  *                     (see MEDCoupling INTERP_KERNEL documentation)
+ *                   - for MatrixCache: directory in which interpolation
+ *                     matrices are saved by \ref cs_medcoupling_remapper_setup
+ *                     and reloaded in subsequent runs when source and
+ *                     target meshes match (empty string to disable)
  */
 /*----------------------------------------------------------------------------*/
 
@@ -140,6 +145,12 @@ cs_medcoupling_remapper_set_options(cs_medcoupling_remapper_t  *r,
 /*!
  * \brief update the interpolation matrix of the remapper
  *
+ * The matrix is stored so that values of fields defined on the same source
+ * mesh (such as other time values) are interpolated by a simple
+ * matrix-vector product. If the "MatrixCache" option is set, the matrix
+ * is read from the matching file when source and target meshes are
+ * unchanged, or saved for subsequent runs otherwise.
+ *
  * \param[in] r            pointer to the cs_medcoupling_remapper_t struct
  */
 /*----------------------------------------------------------------------------*/
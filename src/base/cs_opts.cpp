@@ -114,6 +114,16 @@ _arg_env_help(const char  *name)
     (e, _(" --benchmark       elementary operations performance\n"
           "                   [--mpitrace] operations done only once\n"
           "                                for light MPI traces\n"));
+  fprintf
+    (e, _(" --benchmark-mesh  <nx>[,<ny>,<nz>] run benchmark on a generated\n"
+          "                   cartesian mesh of the unit cube, without\n"
+          "                   mesh input (implies --benchmark)\n"));
+  fprintf
+    (e, _(" --benchmark-weak  <nx>[,<ny>,<nz>] same, with the given number\n"
+          "                   of cells per rank, for weak scaling studies\n"));
+  fprintf
+    (e, _(" --benchmark-ref   <file> reference benchmark results file,\n"
+          "                   for parallel efficiency\n"));
   fprintf
     (e, _(" -h, --help        this help message\n\n"));
 
@@ -162,6 +172,44 @@ _print_version(void)
   printf(_("%s version %s\n"), CS_APP_NAME, CS_APP_VERSION);
 }
 
+/*----------------------------------------------------------------------------
+ * Scale a per-rank benchmark mesh block by the number of ranks.
+ *
+ * Prime factors of the number of ranks are assigned (largest first)
+ * to the direction with the smallest current number of cells, so that
+ * each rank has exactly the same number of cells and the global mesh
+ * remains as close to isotropic as possible.
+ *
+ * parameters:
+ *   n_ranks <-- number of ranks
+ *   n       <-> number of cells in each direction
+ *----------------------------------------------------------------------------*/
+
+static void
+_scale_benchmark_mesh(int  n_ranks,
+                      int  n[3])
+{
+  int n_factors = 0;
+  int factor[32];
+
+  int r = n_ranks;
+  for (int p = 2; p*p <= r; p++) {
+    while (r % p == 0) {
+      factor[n_factors++] = p;
+      r /= p;
+    }
+  }
+  if (r > 1)
+    factor[n_factors++] = r;
+
+  for (int i = n_factors - 1; i >= 0; i--) {
+    int j = 0;
+    if (n[1] < n[j]) j = 1;
+    if (n[2] < n[j]) j = 2;
+    n[j] *= factor[i];
+  }
+}
+
 /*============================================================================
  * Public function definitions for Fortran API
  *============================================================================*/
@@ -202,6 +250,10 @@ cs_opts_define(int         argc,
   opts->preprocess = false;
   opts->verif = false;
   opts->benchmark = 0;
+  for (int i = 0; i < 3; i++)
+    opts->benchmark_mesh[i] = 0;
+  opts->benchmark_weak = false;
+  opts->benchmark_ref = nullptr;
 
   /* Parse command line arguments */
 
@@ -227,6 +279,34 @@ cs_opts_define(int         argc,
       }
     }
 
+    else if (   strcmp(s, "--benchmark-mesh") == 0
+             || strcmp(s, "--benchmark-weak") == 0) {
+      if (arg_id + 1 < argc) {
+        opts->benchmark_weak = (strcmp(s, "--benchmark-weak") == 0);
+        int *n = opts->benchmark_mesh;
+        int n_read = sscanf(argv[++arg_id], "%d,%d,%d", n, n+1, n+2);
+        if (n_read == 1)
+          n[1] = n[0], n[2] = n[0];
+        if ((n_read != 1 && n_read != 3) || n[0] < 1 || n[1] < 1 || n[2] < 1)
+          argerr = 1;
+        if (opts->benchmark == 0)
+          opts->benchmark = 1;
+      }
+      else
+        argerr = 1;
+    }
+
+    else if (strcmp(s, "--benchmark-ref") == 0) {
+      if (arg_id + 1 < argc) {
+        BFT_FREE(opts->benchmark_ref);
+        BFT_MALLOC(opts->benchmark_ref, strlen(argv[arg_id + 1]) + 1, char);
+        strcpy(opts->benchmark_ref, argv[arg_id + 1]);
+        arg_id++;
+      }
+      else
+        argerr = 1;
+    }
+
 #if defined(HAVE_UNISTD_H)
 
     else if (strcmp(s, "-wdir") == 0 || strcmp(s, "--wdir") == 0) {
@@ -329,6 +409,12 @@ cs_opts_define(int         argc,
       cs_exit(EXIT_SUCCESS);
   }
 
+  /* For weak scaling, multiply the per-rank mesh block by a balanced
+     factorization of the number of ranks */
+
+  if (opts->benchmark_weak)
+    _scale_benchmark_mesh(cs_glob_n_ranks, opts->benchmark_mesh);
+
   /* If application name has not been defined, use working directory
      base name as default. */
 
@@ -72,6 +72,13 @@ typedef struct {
                                    0: not used;
                                    1: timing (CPU + Walltime) mode
                                    2: MPI trace-friendly mode */
+  int            benchmark_mesh[3];  /* Number of cells in each direction
+                                        of generated benchmark mesh,
+                                        or 0 to use mesh input */
+  bool           benchmark_weak;     /* Scale benchmark mesh with number
+                                        of ranks (weak scaling) */
+  char          *benchmark_ref;      /* Reference benchmark results file,
+                                        or NULL */
 
 } cs_opts_t;
 
@@ -41,6 +41,8 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_parall.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -57,10 +59,176 @@ BEGIN_C_DECLS
  * Local structure definitions
  *============================================================================*/
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Minimum number of entities for ordering by radix sort rather than
+   heap sort */
+
+static const size_t  _radix_min_ent = 1024;
+
 /*=============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Order an array of 64-bit unsigned keys using a thread-parallel
+ * least-significant digit radix sort.
+ *
+ * The sort is stable, so the resulting order does not depend on the
+ * number of threads. Digits on which all keys are equal are skipped.
+ *
+ * parameters:
+ *   key      <-> array of keys (overwritten)
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_u64_radix(uint64_t      key[],
+                 cs_lnum_t     order[],
+                 const size_t  nb_ent)
+{
+  const int n_t = cs_parall_n_threads(nb_ent, CS_THR_MIN);
+  const size_t t_n = (nb_ent + n_t - 1) / n_t;
+
+  uint64_t varying = 0;
+
+# pragma omp parallel for reduction(|:varying) num_threads(n_t)
+  for (size_t i = 0; i < nb_ent; i++) {
+    order[i] = i;
+    varying |= key[i] ^ key[0];
+  }
+
+  if (varying == 0)
+    return;
+
+  uint64_t *key_b;
+  cs_lnum_t *order_b;
+  size_t *count;
+  BFT_MALLOC(key_b, nb_ent, uint64_t);
+  BFT_MALLOC(order_b, nb_ent, cs_lnum_t);
+  BFT_MALLOC(count, (size_t)n_t*256, size_t);
+
+  uint64_t *k_s = key, *k_d = key_b;
+  cs_lnum_t *o_s = order, *o_d = order_b;
+
+  for (int shift = 0; shift < 64; shift += 8) {
+
+    if (((varying >> shift) & 0xff) == 0)
+      continue;
+
+    /* Per-thread digit histograms */
+
+#   pragma omp parallel for num_threads(n_t)
+    for (int t_id = 0; t_id < n_t; t_id++) {
+      size_t *_count = count + (size_t)t_id*256;
+      for (int j = 0; j < 256; j++)
+        _count[j] = 0;
+      const size_t e_id = CS_MIN(nb_ent, (t_id+1)*t_n);
+      for (size_t i = t_id*t_n; i < e_id; i++)
+        _count[(k_s[i] >> shift) & 0xff] += 1;
+    }
+
+    /* Start positions, by digit then thread */
+
+    size_t k = 0;
+    for (int j = 0; j < 256; j++) {
+      for (int t_id = 0; t_id < n_t; t_id++) {
+        size_t c = count[(size_t)t_id*256 + j];
+        count[(size_t)t_id*256 + j] = k;
+        k += c;
+      }
+    }
+
+    /* Stable scatter */
+
+#   pragma omp parallel for num_threads(n_t)
+    for (int t_id = 0; t_id < n_t; t_id++) {
+      size_t *_count = count + (size_t)t_id*256;
+      const size_t e_id = CS_MIN(nb_ent, (t_id+1)*t_n);
+      for (size_t i = t_id*t_n; i < e_id; i++) {
+        size_t p = _count[(k_s[i] >> shift) & 0xff]++;
+        k_d[p] = k_s[i];
+        o_d[p] = o_s[i];
+      }
+    }
+
+    uint64_t *k_t = k_s; k_s = k_d; k_d = k_t;
+    cs_lnum_t *o_t = o_s; o_s = o_d; o_d = o_t;
+
+  }
+
+  if (o_s != order)
+    memcpy(order, o_s, nb_ent*sizeof(cs_lnum_t));
+
+  BFT_FREE(count);
+  BFT_FREE(order_b);
+  BFT_FREE(key_b);
+}
+
+/*----------------------------------------------------------------------------
+ * Order an array of global numbers using a radix sort.
+ *
+ * parameters:
+ *   number   <-- array of entity numbers
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_gnum_radix(const cs_gnum_t   number[],
+                  cs_lnum_t         order[],
+                  const size_t      nb_ent)
+{
+  uint64_t *key;
+  BFT_MALLOC(key, nb_ent, uint64_t);
+
+# pragma omp parallel for if (nb_ent > CS_THR_MIN)
+  for (size_t i = 0; i < nb_ent; i++)
+    key[i] = number[i];
+
+  _order_u64_radix(key, order, nb_ent);
+
+  BFT_FREE(key);
+}
+
+/*----------------------------------------------------------------------------
+ * Order an array of real values using a radix sort.
+ *
+ * Values are mapped to unsigned keys with the same ordering (flipping
+ * all bits of negative values, and the sign bit of positive values).
+ *
+ * parameters:
+ *   value    <-- array of values
+ *   order    --> pre-allocated ordering table
+ *   nb_ent   <-- number of entities considered
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_real_radix(const cs_real_t   value[],
+                  cs_lnum_t         order[],
+                  const size_t      nb_ent)
+{
+  uint64_t *key;
+  BFT_MALLOC(key, nb_ent, uint64_t);
+
+  const uint64_t sign = (uint64_t)1 << 63;
+
+# pragma omp parallel for if (nb_ent > CS_THR_MIN)
+  for (size_t i = 0; i < nb_ent; i++) {
+    double v = value[i];
+    uint64_t k;
+    memcpy(&k, &v, sizeof(uint64_t));
+    key[i] = (k & sign) ? ~k : (k | sign);
+  }
+
+  _order_u64_radix(key, order, nb_ent);
+
+  BFT_FREE(key);
+}
+
 /*----------------------------------------------------------------------------
  * Descend binary tree for the ordering of a cs_gnum_t (integer) array.
  *
@@ -127,6 +295,11 @@ _order_gnum(const cs_gnum_t   number[],
   size_t i;
   cs_lnum_t o_save;
 
+  if (nb_ent >= _radix_min_ent) {
+    _order_gnum_radix(number, order, nb_ent);
+    return;
+  }
+
   /* Initialize ordering array */
 
   for (i = 0 ; i < nb_ent ; i++)
@@ -740,6 +913,11 @@ _order_real(const cs_real_t   value[],
   size_t i;
   cs_lnum_t o_save;
 
+  if (nb_ent >= _radix_min_ent && sizeof(cs_real_t) == sizeof(uint64_t)) {
+    _order_real_radix(value, order, nb_ent);
+    return;
+  }
+
   /* Initialize ordering array */
 
   for (i = 0 ; i < nb_ent ; i++)
@@ -152,6 +152,15 @@ typedef struct
 
 static size_t _cs_parall_min_coll_buf_size = 1024*1024;
 
+/* Node-local communicator and shared memory windows */
+
+static MPI_Comm   _node_comm = MPI_COMM_NULL;
+
+static int        _n_shared = 0;
+static int        _n_shared_max = 0;
+static void     **_shared_ptr = NULL;
+static MPI_Win   *_shared_win = NULL;
+
 #endif
 
 /*============================================================================
@@ -162,6 +171,10 @@ static size_t _cs_parall_min_coll_buf_size = 1024*1024;
 
 cs_e2n_sum_t cs_glob_e2n_sum_type = CS_E2N_SUM_SCATTER;
 
+/*! Use exact (reproducible) sums for floating-point values */
+
+bool cs_glob_parall_exact_sum = false;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -330,6 +343,28 @@ _cs_parall_allreduce(MPI_Comm        comm,
 
 #endif
 
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+
+/*----------------------------------------------------------------------------
+ * Return id of a node-shared allocation, or -1 if not found.
+ *
+ * parameters:
+ *   ptr <-- pointer to shared memory
+ *----------------------------------------------------------------------------*/
+
+static int
+_shared_id(const void  *ptr)
+{
+  for (int i = 0; i < _n_shared; i++) {
+    if (_shared_ptr[i] == ptr)
+      return i;
+  }
+
+  return -1;
+}
+
+#endif /* defined(HAVE_MPI) && (MPI_VERSION >= 3) */
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -654,6 +689,93 @@ cs_f_parall_barrier(void)
  * Public function definitions
  *============================================================================*/
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sum exact sum accumulators on all processes of a communicator.
+ *
+ * As accumulators are summed using integer operations, the result does
+ * not depend on the reduction order.
+ *
+ * \param[in]       comm  associated MPI communicator
+ * \param[in]       n     number of accumulators
+ * \param[in, out]  s     local accumulators input, global output (size: n)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_sum_exact_acc(MPI_Comm         comm,
+                        int              n,
+                        cs_exact_sum_t   s[])
+{
+  /* Digits are normalized first so that the global sum of
+     each digit may not overflow for any realistic number of ranks;
+     non-finite value counters are appended to the digits.  */
+
+  const int stride = CS_EXACT_SUM_N_DIGITS + 3;
+
+  int64_t *buf;
+  BFT_MALLOC(buf, 2*n*stride, int64_t);
+  int64_t *g_buf = buf + n*stride;
+
+  for (int i = 0; i < n; i++) {
+    cs_exact_sum_normalize(s + i);
+    int64_t *_buf = buf + i*stride;
+    for (int j = 0; j < CS_EXACT_SUM_N_DIGITS; j++)
+      _buf[j] = s[i].d[j];
+    for (int j = 0; j < 3; j++)
+      _buf[CS_EXACT_SUM_N_DIGITS + j] = s[i].nf[j];
+  }
+
+  MPI_Allreduce(buf, g_buf, n*stride, MPI_INT64_T, MPI_SUM, comm);
+
+  for (int i = 0; i < n; i++) {
+    const int64_t *_buf = g_buf + i*stride;
+    for (int j = 0; j < CS_EXACT_SUM_N_DIGITS; j++)
+      s[i].d[j] = _buf[j];
+    for (int j = 0; j < 3; j++)
+      s[i].nf[j] = _buf[CS_EXACT_SUM_N_DIGITS + j];
+    cs_exact_sum_normalize(s + i);
+  }
+
+  BFT_FREE(buf);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sum double precision values on all processes of a communicator,
+ *        with a result independent of the reduction order.
+ *
+ * \param[in]       comm  associated MPI communicator
+ * \param[in]       n     number of values
+ * \param[in, out]  val   local values input, global values output (size: n)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_sum_exact(MPI_Comm   comm,
+                    int        n,
+                    double     val[])
+{
+  cs_exact_sum_t *s;
+  BFT_MALLOC(s, n, cs_exact_sum_t);
+
+  for (int i = 0; i < n; i++) {
+    cs_exact_sum_init(s + i);
+    cs_exact_sum_add(s + i, val[i]);
+  }
+
+  cs_parall_sum_exact_acc(comm, n, s);
+
+  for (int i = 0; i < n; i++)
+    val[i] = cs_exact_sum_to_double(s + i);
+
+  BFT_FREE(s);
+}
+
+#endif /* defined(HAVE_MPI) */
+
 #if !defined(HAVE_MPI_IN_PLACE)
 
 void
@@ -707,8 +829,12 @@ cs_parall_sum(int             n,
               void           *val)
 {
 #if defined(HAVE_MPI)
-  if (cs_glob_n_ranks > 1)
-    _cs_parall_allreduce(cs_glob_mpi_comm, n, datatype, MPI_SUM, val);
+  if (cs_glob_n_ranks > 1) {
+    if (cs_glob_parall_exact_sum && datatype == CS_DOUBLE)
+      cs_parall_sum_exact(cs_glob_mpi_comm, n, (double *)val);
+    else
+      _cs_parall_allreduce(cs_glob_mpi_comm, n, datatype, MPI_SUM, val);
+  }
 #endif
 }
 
@@ -1357,6 +1483,181 @@ cs_parall_set_min_coll_buf_size(size_t buffer_size)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate a read-only array shared by all ranks of a node.
+ *
+ * When running on multiple ranks with MPI-3, the array is allocated in a
+ * node-level MPI shared memory window, so that a single copy is stored
+ * per node; only the first rank of each node (for which is_writer is
+ * set to true) should then initialize the array, followed by a call to
+ * \ref cs_parall_shared_sync. Otherwise, a private array is allocated,
+ * and is_writer is always true.
+ *
+ * This is a collective operation over all ranks.
+ *
+ * \param[in]   n_bytes    size of array, in bytes
+ * \param[out]  is_writer  true if array must be initialized by this rank
+ *
+ * \return  pointer to allocated array
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_parall_shared_malloc(size_t   n_bytes,
+                        bool    *is_writer)
+{
+  void *ptr = NULL;
+
+  *is_writer = true;
+
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+
+  if (cs_glob_n_ranks > 1) {
+
+    MPI_Comm node_comm = cs_parall_shared_comm();
+
+    int node_rank_id;
+    MPI_Comm_rank(node_comm, &node_rank_id);
+
+    /* Always allocate a non-empty window, so that pointers are distinct */
+
+    MPI_Aint w_size = 0;
+    if (node_rank_id == 0)
+      w_size = (n_bytes > 0) ? n_bytes : 1;
+
+    MPI_Win win;
+    MPI_Win_allocate_shared(w_size, 1, MPI_INFO_NULL,
+                            node_comm, &ptr, &win);
+
+    int disp_unit;
+    MPI_Win_shared_query(win, 0, &w_size, &disp_unit, &ptr);
+
+    if (_n_shared >= _n_shared_max) {
+      _n_shared_max = (_n_shared_max > 0) ? _n_shared_max*2 : 8;
+      BFT_REALLOC(_shared_ptr, _n_shared_max, void *);
+      BFT_REALLOC(_shared_win, _n_shared_max, MPI_Win);
+    }
+    _shared_ptr[_n_shared] = ptr;
+    _shared_win[_n_shared] = win;
+    _n_shared += 1;
+
+    *is_writer = (node_rank_id == 0);
+
+    return ptr;
+  }
+
+#endif
+
+  unsigned char *_ptr;
+  BFT_MALLOC(_ptr, n_bytes, unsigned char);
+  ptr = _ptr;
+
+  return ptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Synchronize a node-shared array once initialized by the
+ *        writer rank.
+ *
+ * This is a collective operation over all ranks of the node.
+ *
+ * \param[in]  ptr  pointer to array allocated by
+ *                  \ref cs_parall_shared_malloc
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_shared_sync(const void  *ptr)
+{
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+
+  int id = _shared_id(ptr);
+  if (id > -1)
+    MPI_Win_fence(0, _shared_win[id]);
+
+#else
+
+  CS_UNUSED(ptr);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free an array allocated by \ref cs_parall_shared_malloc.
+ *
+ * If the array is shared, this is a collective operation over all ranks
+ * of the node.
+ *
+ * \param[in]  ptr  pointer to array
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_shared_free(void  *ptr)
+{
+  if (ptr == NULL)
+    return;
+
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+
+  int id = _shared_id(ptr);
+
+  if (id > -1) {
+
+    MPI_Win_free(_shared_win + id);
+
+    _n_shared -= 1;
+    _shared_ptr[id] = _shared_ptr[_n_shared];
+    _shared_win[id] = _shared_win[_n_shared];
+
+    if (_n_shared == 0) {
+      BFT_FREE(_shared_ptr);
+      BFT_FREE(_shared_win);
+      _n_shared_max = 0;
+      MPI_Comm_free(&_node_comm);
+    }
+
+    return;
+  }
+
+#endif
+
+  BFT_FREE(ptr);
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the node-local communicator used for node-shared arrays.
+ *
+ * The communicator is built if needed, so this is a collective operation
+ * over all ranks.
+ *
+ * \return  node-local communicator, or MPI_COMM_NULL if node-shared
+ *          arrays are not available
+ */
+/*----------------------------------------------------------------------------*/
+
+MPI_Comm
+cs_parall_shared_comm(void)
+{
+#if (MPI_VERSION >= 3)
+
+  if (cs_glob_n_ranks > 1 && _node_comm == MPI_COMM_NULL)
+    MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED, 0,
+                        MPI_INFO_NULL, &_node_comm);
+
+#endif
+
+  return _node_comm;
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -1424,8 +1725,12 @@ cs_parall_sum(cs_execution_context  *ec,
               void                  *val)
 {
 #if defined(HAVE_MPI)
-  if (ec->use_mpi())
-    _cs_parall_allreduce(ec->comm(), n, datatype, MPI_SUM, val);
+  if (ec->use_mpi()) {
+    if (cs_glob_parall_exact_sum && datatype == CS_DOUBLE)
+      cs_parall_sum_exact(ec->comm(), n, (double *)val);
+    else
+      _cs_parall_allreduce(ec->comm(), n, datatype, MPI_SUM, val);
+  }
 #endif
 }
 
@@ -32,6 +32,7 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_defs.h"
+#include "cs_exact_sum.h"
 #include "cs_execution_context.h"
 
 /*----------------------------------------------------------------------------*/
@@ -69,6 +70,10 @@ typedef enum {
 
 extern cs_e2n_sum_t cs_glob_e2n_sum_type;
 
+/* Use exact (reproducible) sums for floating-point values */
+
+extern bool cs_glob_parall_exact_sum;
+
 /*=============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -131,6 +136,44 @@ cs_parall_counter_max(cs_lnum_t   cpt[],
 
 #endif
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sum exact sum accumulators on all processes of a communicator.
+ *
+ * As accumulators are summed using integer operations, the result does
+ * not depend on the reduction order.
+ *
+ * \param[in]       comm  associated MPI communicator
+ * \param[in]       n     number of accumulators
+ * \param[in, out]  s     local accumulators input, global output (size: n)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_sum_exact_acc(MPI_Comm         comm,
+                        int              n,
+                        cs_exact_sum_t   s[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Sum double precision values on all processes of a communicator,
+ *        with a result independent of the reduction order.
+ *
+ * \param[in]       comm  associated MPI communicator
+ * \param[in]       n     number of values
+ * \param[in, out]  val   local values input, global values output (size: n)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_sum_exact(MPI_Comm   comm,
+                    int        n,
+                    double     val[]);
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Sum values of a given datatype on all default communicator processes.
@@ -149,8 +192,11 @@ cs_parall_sum(int             n,
               void           *val)
 {
   if (cs_glob_n_ranks > 1) {
-    MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype], MPI_SUM,
-                  cs_glob_mpi_comm);
+    if (cs_glob_parall_exact_sum && datatype == CS_DOUBLE)
+      cs_parall_sum_exact(cs_glob_mpi_comm, n, (double *)val);
+    else
+      MPI_Allreduce(MPI_IN_PLACE, val, n, cs_datatype_to_mpi[datatype],
+                    MPI_SUM, cs_glob_mpi_comm);
   }
 }
 
@@ -539,6 +585,78 @@ cs_parall_get_min_coll_buf_size(void);
 void
 cs_parall_set_min_coll_buf_size(size_t buffer_size);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate a read-only array shared by all ranks of a node.
+ *
+ * When running on multiple ranks with MPI-3, the array is allocated in a
+ * node-level MPI shared memory window, so that a single copy is stored
+ * per node; only the first rank of each node (for which is_writer is
+ * set to true) should then initialize the array, followed by a call to
+ * \ref cs_parall_shared_sync. Otherwise, a private array is allocated,
+ * and is_writer is always true.
+ *
+ * This is a collective operation over all ranks.
+ *
+ * \param[in]   n_bytes    size of array, in bytes
+ * \param[out]  is_writer  true if array must be initialized by this rank
+ *
+ * \return  pointer to allocated array
+ */
+/*----------------------------------------------------------------------------*/
+
+void *
+cs_parall_shared_malloc(size_t   n_bytes,
+                        bool    *is_writer);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Synchronize a node-shared array once initialized by the
+ *        writer rank.
+ *
+ * This is a collective operation over all ranks of the node.
+ *
+ * \param[in]  ptr  pointer to array allocated by
+ *                  \ref cs_parall_shared_malloc
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_shared_sync(const void  *ptr);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free an array allocated by \ref cs_parall_shared_malloc.
+ *
+ * If the array is shared, this is a collective operation over all ranks
+ * of the node.
+ *
+ * \param[in]  ptr  pointer to array
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_parall_shared_free(void  *ptr);
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the node-local communicator used for node-shared arrays.
+ *
+ * The communicator is built if needed, so this is a collective operation
+ * over all ranks.
+ *
+ * \return  node-local communicator, or MPI_COMM_NULL if node-shared
+ *          arrays are not available
+ */
+/*----------------------------------------------------------------------------*/
+
+MPI_Comm
+cs_parall_shared_comm(void);
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute recommended number of threads for a section.
@@ -774,9 +892,12 @@ cs_parall_sum(cs_execution_context  *ec,
               void                  *val)
 {
   if (ec->use_mpi()) {
-    MPI_Allreduce(MPI_IN_PLACE, val, n,
-                  cs_datatype_to_mpi[datatype], MPI_SUM,
-                  ec->comm());
+    if (cs_glob_parall_exact_sum && datatype == CS_DOUBLE)
+      cs_parall_sum_exact(ec->comm(), n, (double *)val);
+    else
+      MPI_Allreduce(MPI_IN_PLACE, val, n,
+                    cs_datatype_to_mpi[datatype], MPI_SUM,
+                    ec->comm());
   }
 }
 
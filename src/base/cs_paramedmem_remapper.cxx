@@ -783,7 +783,11 @@ cs_paramedmem_remap_field(cs_paramedmem_remapper_t *r,
 
   }
 
-  r->synced = 0;
+  /* The interpolation matrix only depends on the meshes, so it is kept
+     for subsequent time values, unless the source mesh was transformed */
+
+  if (_n_transformations > 0)
+    r->synced = 0;
   _cs_paramedmem_reset_transformations();
 
 #endif
@@ -818,6 +822,7 @@ cs_paramedmem_remapper_translate(cs_paramedmem_remapper_t  *r,
     _cs_paramedmem_create_transformation(1, cen, translation, 0.);
 
   _n_transformations++;
+  r->synced = 0;
 #endif
 }
 
@@ -854,6 +859,7 @@ cs_paramedmem_remapper_rotate(cs_paramedmem_remapper_t  *r,
     _cs_paramedmem_create_transformation(0, invariant, axis, angle);
 
   _n_transformations++;
+  r->synced = 0;
 #endif
 
 }
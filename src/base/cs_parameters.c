@@ -432,6 +432,8 @@ static cs_equation_param_t _equation_param_default
    .blend_st = 0.,
    .epsilo = 1.e-5,
    .epsrsm = 1.e-4,
+   .epsrsm_red = 0.,
+   .epsinc = 0.,
    .epsrgr = 1.e-4,
    .climgr = 1.5,
    .relaxv = 1.,
@@ -633,6 +635,8 @@ _log_func_var_cal_opt(const void *t)
   cs_log_printf(CS_LOG_SETUP, fmt_r, "blend_st", _t->blend_st);
   cs_log_printf(CS_LOG_SETUP, fmt_r, "epsilo", _t->epsilo);
   cs_log_printf(CS_LOG_SETUP, fmt_r, "epsrsm", _t->epsrsm);
+  cs_log_printf(CS_LOG_SETUP, fmt_r, "epsrsm_red", _t->epsrsm_red);
+  cs_log_printf(CS_LOG_SETUP, fmt_r, "epsinc", _t->epsinc);
   cs_log_printf(CS_LOG_SETUP, fmt_r, "epsrgr", _t->epsrgr);
   cs_log_printf(CS_LOG_SETUP, fmt_r, "climgr", _t->climgr);
   cs_log_printf(CS_LOG_SETUP, fmt_r, "relaxv", _t->relaxv);
@@ -711,6 +715,11 @@ _log_func_default_var_cal_opt(const void *t)
                 _("Number of sweeps rhs reconstruction"));
   cs_log_printf(CS_LOG_SETUP, fmt_r, "epsrsm", _t->epsrsm,
                 _("Rhs reconstruction precision"));
+  cs_log_printf(CS_LOG_SETUP, fmt_r, "epsrsm_red", _t->epsrsm_red,
+                _("Minimum residual reduction per sweep (0: not used)"));
+  cs_log_printf(CS_LOG_SETUP, fmt_r, "epsinc", _t->epsinc,
+                _("Increment precision for rhs reconstruction "
+                  "(0: not used)"));
   cs_log_printf(CS_LOG_SETUP, fmt_i, "iswdyn", _t->iswdyn,
                 _("Dynamic relaxation type"));
 
@@ -1070,6 +1079,14 @@ cs_parameters_define_field_keys(void)
 
   cs_field_define_key_int("gradient_weighting_id", -1, CS_FIELD_VARIABLE);
 
+  /* Store reconstruction gradients in single precision in convection/
+     diffusion face loops (0: no, 1: yes) */
+  cs_field_define_key_int("gradient_single_precision", 0, CS_FIELD_VARIABLE);
+
+  /* Reuse cell gradients of scalar fields whose inputs did not change
+     during a time step (0: no, 1: yes) */
+  cs_field_define_key_int("gradient_cache", 0, CS_FIELD_VARIABLE);
+
   cs_field_define_key_int("diffusivity_tensor", 0, CS_FIELD_VARIABLE);
   cs_field_define_key_int("drift_scalar_model", 0, 0);
 
@@ -0,0 +1,425 @@
+/*============================================================================
+ * Per-equation performance summary.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_map.h"
+#include "cs_parall.h"
+#include "cs_time_step.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_perf_summary.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_perf_summary.cpp
+        Per-equation performance summary.
+
+  Elapsed times of the main phases of each equation's resolution
+  (gradients, matrix building, right-hand side assembly, boundary
+  condition coefficients update, linear solver setup and solve) are
+  accumulated by name, and written to a "performance_summary.json" file
+  with the minimum, maximum and mean values over ranks, so as to expose
+  load imbalance.
+
+  Phases may be nested (for example, gradients computed during the
+  right-hand side assembly are also included in the latter).
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Accumulated values for a given equation */
+
+typedef struct {
+
+  unsigned long long  n_calls[CS_PERF_SUMMARY_N_PHASES];  /* number of calls */
+  long long           nsec[CS_PERF_SUMMARY_N_PHASES];     /* elapsed time */
+
+} cs_perf_summary_entry_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static const char *_phase_name[] = {"gradient",
+                                    "matrix_build",
+                                    "rhs_assembly",
+                                    "bc_update",
+                                    "setup",
+                                    "solve"};
+
+static const char _file_name[] = "performance_summary.json";
+
+static int  _frequency = 0;
+
+static int  _n_entries = 0;
+static int  _n_max_entries = 0;
+static cs_perf_summary_entry_t  *_entries = nullptr;
+static cs_map_name_to_id_t  *_entry_map = nullptr;
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return pointer to the entry matching a given name, creating it if needed.
+ *
+ * parameters:
+ *   name <-- equation name
+ *
+ * returns:
+ *   pointer to entry
+ *----------------------------------------------------------------------------*/
+
+static cs_perf_summary_entry_t *
+_entry_by_name(const char  *name)
+{
+  if (_entry_map == nullptr)
+    _entry_map = cs_map_name_to_id_create();
+
+  int id = cs_map_name_to_id(_entry_map, name);
+
+  if (id >= _n_entries) {
+
+    if (id >= _n_max_entries) {
+      _n_max_entries = (_n_max_entries > 0) ? _n_max_entries*2 : 16;
+      BFT_REALLOC(_entries, _n_max_entries, cs_perf_summary_entry_t);
+    }
+
+    for (int i = _n_entries; i <= id; i++)
+      memset(_entries + i, 0, sizeof(cs_perf_summary_entry_t));
+
+    _n_entries = id + 1;
+
+  }
+
+  return _entries + id;
+}
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Ensure all ranks have the same set of entries.
+ *
+ * Entries are created on each rank when first used, so the names of all
+ * ranks are exchanged, and missing entries are added.
+ *----------------------------------------------------------------------------*/
+
+static void
+_sync_entries(void)
+{
+  int n_ranks = cs_glob_n_ranks;
+
+  /* Serialize local names */
+
+  int l_size = 0;
+  for (int i = 0; i < _n_entries; i++)
+    l_size += strlen(cs_map_name_to_id_reverse(_entry_map, i)) + 1;
+
+  char *l_buf;
+  BFT_MALLOC(l_buf, l_size + 1, char);
+
+  l_size = 0;
+  for (int i = 0; i < _n_entries; i++) {
+    const char *name = cs_map_name_to_id_reverse(_entry_map, i);
+    strcpy(l_buf + l_size, name);
+    l_size += strlen(name) + 1;
+  }
+
+  int *count, *displ;
+  BFT_MALLOC(count, n_ranks, int);
+  BFT_MALLOC(displ, n_ranks, int);
+
+  MPI_Allgather(&l_size, 1, MPI_INT, count, 1, MPI_INT, cs_glob_mpi_comm);
+
+  int g_size = 0;
+  for (int i = 0; i < n_ranks; i++) {
+    displ[i] = g_size;
+    g_size += count[i];
+  }
+
+  char *g_buf;
+  BFT_MALLOC(g_buf, g_size + 1, char);
+
+  MPI_Allgatherv(l_buf, l_size, MPI_CHAR, g_buf, count, displ, MPI_CHAR,
+                 cs_glob_mpi_comm);
+
+  /* Add missing entries */
+
+  for (int i = 0; i < g_size; i += strlen(g_buf + i) + 1)
+    _entry_by_name(g_buf + i);
+
+  BFT_FREE(g_buf);
+  BFT_FREE(displ);
+  BFT_FREE(count);
+  BFT_FREE(l_buf);
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the output frequency of the performance summary.
+ *
+ * The summary is always written at the end of the computation.
+ *
+ * \param[in]  frequency  output every n time steps, or 0 for end only
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_summary_set_frequency(int  frequency)
+{
+  _frequency = (frequency > 0) ? frequency : 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the difference between 2 timers to a given equation and phase.
+ *
+ * \param[in]  name   equation (or variable) name
+ * \param[in]  phase  associated phase
+ * \param[in]  t0     oldest timer value
+ * \param[in]  t1     most recent timer value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_summary_add_diff(const char               *name,
+                         cs_perf_summary_phase_t   phase,
+                         const cs_timer_t         *t0,
+                         const cs_timer_t         *t1)
+{
+  if (name == nullptr)
+    return;
+
+  cs_perf_summary_entry_t *e = _entry_by_name(name);
+
+  e->n_calls[phase] += 1;
+  e->nsec[phase] +=   (t1->sec - t0->sec) * (long long)1000000000
+                    + t1->nsec - t0->nsec;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a time counter to a given equation and phase.
+ *
+ * \param[in]  name   equation (or variable) name
+ * \param[in]  phase  associated phase
+ * \param[in]  dt     elapsed time counter
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_summary_add_counter(const char                *name,
+                            cs_perf_summary_phase_t    phase,
+                            const cs_timer_counter_t  *dt)
+{
+  if (name == nullptr)
+    return;
+
+  cs_perf_summary_entry_t *e = _entry_by_name(name);
+
+  e->n_calls[phase] += 1;
+  e->nsec[phase] += dt->nsec;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write the performance summary if required at the current
+ *        time step.
+ *
+ * This is a collective operation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_summary_log_iteration(void)
+{
+  if (_frequency > 0 && cs_glob_time_step->nt_cur % _frequency == 0)
+    cs_perf_summary_write();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write the performance summary.
+ *
+ * The "performance_summary.json" file is replaced at each call.
+ * The number of calls of each phase is the maximum over ranks.
+ *
+ * This is a collective operation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_summary_write(void)
+{
+  const int n_phases = CS_PERF_SUMMARY_N_PHASES;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    _sync_entries();
+#endif
+
+  int n = _n_entries * n_phases;
+
+  double *t_min, *t_max, *t_sum, *calls;
+  BFT_MALLOC(t_min, n, double);
+  BFT_MALLOC(t_max, n, double);
+  BFT_MALLOC(t_sum, n, double);
+  BFT_MALLOC(calls, n, double);
+
+  /* Use name order (the map's index order), which is the same
+     on all ranks */
+
+  for (int k = 0; k < _n_entries; k++) {
+    const char *name = cs_map_name_to_id_key(_entry_map, k);
+    const cs_perf_summary_entry_t *e
+      = _entries + cs_map_name_to_id_try(_entry_map, name);
+    for (int j = 0; j < n_phases; j++) {
+      t_min[k*n_phases + j] = e->nsec[j]*1e-9;
+      calls[k*n_phases + j] = e->n_calls[j];
+    }
+  }
+  memcpy(t_max, t_min, n*sizeof(double));
+  memcpy(t_sum, t_min, n*sizeof(double));
+
+  cs_parall_min(n, CS_DOUBLE, t_min);
+  cs_parall_max(n, CS_DOUBLE, t_max);
+  cs_parall_sum(n, CS_DOUBLE, t_sum);
+  cs_parall_max(n, CS_DOUBLE, calls);
+
+  if (cs_glob_rank_id < 1) {
+
+    FILE *f = fopen(_file_name, "w");
+    if (f == nullptr)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error opening file: \"%s\""), _file_name);
+
+    int n_ranks = cs_glob_n_ranks;
+
+    fprintf(f, "{\n  \"time_step\": %d,\n  \"n_ranks\": %d,\n"
+            "  \"equations\": [",
+            cs_glob_time_step->nt_cur, n_ranks);
+
+    for (int k = 0; k < _n_entries; k++) {
+
+      const char *name = cs_map_name_to_id_key(_entry_map, k);
+
+      fprintf(f, "%s\n    {\"name\": \"%s\"", (k > 0) ? "," : "", name);
+
+      for (int j = 0; j < n_phases; j++) {
+        int l = k*n_phases + j;
+        if (calls[l] <= 0)
+          continue;
+        fprintf(f, ",\n     \"%s\": {\"calls\": %llu, \"min\": %.6e,"
+                " \"max\": %.6e, \"mean\": %.6e}",
+                _phase_name[j], (unsigned long long)calls[l],
+                t_min[l], t_max[l], t_sum[l]/n_ranks);
+      }
+
+      fprintf(f, "}");
+
+    }
+
+    fprintf(f, "\n  ]\n}\n");
+
+    if (fclose(f) != 0)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error closing file: \"%s\""), _file_name);
+
+  }
+
+  BFT_FREE(calls);
+  BFT_FREE(t_sum);
+  BFT_FREE(t_max);
+  BFT_FREE(t_min);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write the final performance summary and free associated data.
+ *
+ * This is a collective operation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_summary_finalize(void)
+{
+  cs_perf_summary_write();
+
+  BFT_FREE(_entries);
+  _n_entries = 0;
+  _n_max_entries = 0;
+
+  if (_entry_map != nullptr)
+    cs_map_name_to_id_destroy(&_entry_map);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
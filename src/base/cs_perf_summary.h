@@ -0,0 +1,148 @@
+#ifndef __CS_PERF_SUMMARY_H__
+#define __CS_PERF_SUMMARY_H__
+
+/*============================================================================
+ * Per-equation performance summary.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Performance summary phases */
+
+typedef enum {
+
+  CS_PERF_SUMMARY_GRADIENT,       /*!< gradient computation */
+  CS_PERF_SUMMARY_MATRIX_BUILD,   /*!< matrix coefficients building */
+  CS_PERF_SUMMARY_RHS_ASSEMBLY,   /*!< right-hand side (balance) assembly */
+  CS_PERF_SUMMARY_BC_UPDATE,      /*!< boundary condition coefficients
+                                       update */
+  CS_PERF_SUMMARY_SETUP,          /*!< linear solver setup */
+  CS_PERF_SUMMARY_SOLVE,          /*!< linear solver solve */
+
+  CS_PERF_SUMMARY_N_PHASES
+
+} cs_perf_summary_phase_t;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the output frequency of the performance summary.
+ *
+ * The summary is always written at the end of the computation.
+ *
+ * \param[in]  frequency  output every n time steps, or 0 for end only
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_summary_set_frequency(int  frequency);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add the difference between 2 timers to a given equation and phase.
+ *
+ * \param[in]  name   equation (or variable) name
+ * \param[in]  phase  associated phase
+ * \param[in]  t0     oldest timer value
+ * \param[in]  t1     most recent timer value
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_summary_add_diff(const char               *name,
+                         cs_perf_summary_phase_t   phase,
+                         const cs_timer_t         *t0,
+                         const cs_timer_t         *t1);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a time counter to a given equation and phase.
+ *
+ * \param[in]  name   equation (or variable) name
+ * \param[in]  phase  associated phase
+ * \param[in]  dt     elapsed time counter
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_summary_add_counter(const char                *name,
+                            cs_perf_summary_phase_t    phase,
+                            const cs_timer_counter_t  *dt);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write the performance summary if required at the current
+ *        time step.
+ *
+ * This is a collective operation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_summary_log_iteration(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write the performance summary.
+ *
+ * This is a collective operation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_summary_write(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Write the final performance summary and free associated data.
+ *
+ * This is a collective operation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_perf_summary_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_PERF_SUMMARY_H__ */
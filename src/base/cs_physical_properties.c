@@ -45,6 +45,7 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 #include "cs_log.h"
+#include "cs_math.h"
 #include "cs_timer.h"
 
 #include "cs_property.h"
@@ -141,6 +142,20 @@ typedef void
 typedef void
 (cs_finalize_t)(void);
 
+/* Tabulated property over a (var1, var2) rectangle, with regular spacing */
+
+typedef struct {
+
+  int         n_nodes[2];            /* number of nodes along each axis */
+  cs_real_t   x_min[2];              /* lower bounds of tabulated range */
+  cs_real_t   x_max[2];              /* upper bounds of tabulated range */
+  cs_real_t  *val;                   /* node values (var1 index varies
+                                        fastest), or NULL if not built */
+
+} cs_phys_prop_tab_t;
+
+#define CS_PHYS_PROP_N_TYPES  (CS_PHYS_PROP_SPEED_OF_SOUND + 1)
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -150,6 +165,13 @@ cs_thermal_table_t *cs_glob_thermal_table = NULL;
 static cs_timer_counter_t   _physprop_lib_t_tot;   /* Total time in physical
                                                       property library calls */
 
+/* Optional tabulation of library properties (disabled if < 2 nodes) */
+
+static int                  _tab_n_nodes = 0;
+static cs_phys_prop_tab_t   _tabs[CS_PHYS_PROP_N_TYPES];
+static unsigned long long   _tab_n_builds = 0;
+static unsigned long long   _tab_n_interp = 0;
+
 #if defined(HAVE_DLOPEN) && defined(HAVE_EOS)
 
 static void                     *_cs_eos_dl_lib = NULL;
@@ -284,6 +306,177 @@ _physical_property_create(const char      *name,
   return pty;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute property values using the selected property library.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_library_compute(cs_phys_prop_type_t   property,
+                 cs_lnum_t             n_vals,
+                 const cs_real_t       var1[],
+                 const cs_real_t       var2[],
+                 cs_real_t             val[])
+{
+  cs_timer_t t0 = cs_timer_time();
+
+#if defined(HAVE_EOS) /* always a plugin */
+  if (cs_glob_thermal_table->type == CS_PHYS_PROP_TABLE_EOS) {
+    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
+                      property,
+                      n_vals,
+                      var1,
+                      var2,
+                      val);
+  }
+#endif
+#if defined(HAVE_COOLPROP)
+  if (cs_glob_thermal_table->type == CS_PHYS_PROP_TABLE_COOLPROP) {
+    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
+                           _cs_coolprop_backend,
+                           cs_glob_thermal_table->thermo_plane,
+                           property,
+                           n_vals,
+                           var1,
+                           var2,
+                           val);
+  }
+#endif
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&_physprop_lib_t_tot, &t0, &t1);
+
+#if !defined(HAVE_EOS) && !defined(HAVE_COOLPROP)
+  CS_UNUSED(property);
+  CS_UNUSED(n_vals);
+  CS_UNUSED(var1);
+  CS_UNUSED(var2);
+  CS_UNUSED(val);
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * (Re)build a property table so that it covers a given range.
+ *
+ * The previously tabulated range (if any) is kept, and extended by a
+ * margin so that slowly drifting states do not require a rebuild at
+ * each call. All table nodes are evaluated in a single library call.
+ *
+ * parameters:
+ *   tab      <-> pointer to property table
+ *   property <-- property queried
+ *   x_min    <-- lower bounds of range to cover
+ *   x_max    <-- upper bounds of range to cover
+ *----------------------------------------------------------------------------*/
+
+static void
+_tab_build(cs_phys_prop_tab_t   *tab,
+           cs_phys_prop_type_t   property,
+           const cs_real_t       x_min[2],
+           const cs_real_t       x_max[2])
+{
+  for (int j = 0; j < 2; j++) {
+    cs_real_t lo = x_min[j], hi = x_max[j];
+    if (tab->val != NULL) {
+      lo = cs_math_fmin(lo, tab->x_min[j]);
+      hi = cs_math_fmax(hi, tab->x_max[j]);
+    }
+    cs_real_t margin = 0.1*(hi - lo);
+    if (margin <= 0)
+      margin = 1e-6*cs_math_fmax(cs_math_fabs(lo), 1.);
+    tab->n_nodes[j] = _tab_n_nodes;
+    tab->x_min[j] = lo - margin;
+    tab->x_max[j] = hi + margin;
+  }
+
+  const int n0 = tab->n_nodes[0], n1 = tab->n_nodes[1];
+  const cs_lnum_t n_tab = (cs_lnum_t)n0 * n1;
+  const cs_real_t d0 = (tab->x_max[0] - tab->x_min[0]) / (n0 - 1);
+  const cs_real_t d1 = (tab->x_max[1] - tab->x_min[1]) / (n1 - 1);
+
+  cs_real_t *v1, *v2;
+  BFT_MALLOC(v1, n_tab, cs_real_t);
+  BFT_MALLOC(v2, n_tab, cs_real_t);
+
+  for (int j1 = 0; j1 < n1; j1++) {
+    for (int j0 = 0; j0 < n0; j0++) {
+      v1[j1*n0 + j0] = tab->x_min[0] + j0*d0;
+      v2[j1*n0 + j0] = tab->x_min[1] + j1*d1;
+    }
+  }
+
+  BFT_REALLOC(tab->val, n_tab, cs_real_t);
+  _library_compute(property, n_tab, v1, v2, tab->val);
+
+  BFT_FREE(v1);
+  BFT_FREE(v2);
+
+  _tab_n_builds += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute property values by bilinear interpolation in a table,
+ * building or extending the table first if needed.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_tab_compute(cs_phys_prop_type_t   property,
+             cs_lnum_t             n_vals,
+             const cs_real_t       var1[],
+             const cs_real_t       var2[],
+             cs_real_t             val[])
+{
+  cs_phys_prop_tab_t *tab = _tabs + property;
+
+  cs_real_t x_min[2] = {var1[0], var2[0]};
+  cs_real_t x_max[2] = {var1[0], var2[0]};
+
+  for (cs_lnum_t i = 1; i < n_vals; i++) {
+    x_min[0] = cs_math_fmin(x_min[0], var1[i]);
+    x_max[0] = cs_math_fmax(x_max[0], var1[i]);
+    x_min[1] = cs_math_fmin(x_min[1], var2[i]);
+    x_max[1] = cs_math_fmax(x_max[1], var2[i]);
+  }
+
+  if (   tab->val == NULL
+      || tab->n_nodes[0] != _tab_n_nodes
+      || x_min[0] < tab->x_min[0] || x_max[0] > tab->x_max[0]
+      || x_min[1] < tab->x_min[1] || x_max[1] > tab->x_max[1])
+    _tab_build(tab, property, x_min, x_max);
+
+  const int n0 = tab->n_nodes[0], n1 = tab->n_nodes[1];
+  const cs_real_t i_d0 = (n0 - 1) / (tab->x_max[0] - tab->x_min[0]);
+  const cs_real_t i_d1 = (n1 - 1) / (tab->x_max[1] - tab->x_min[1]);
+  const cs_real_t *t_val = tab->val;
+
+# pragma omp parallel for if (n_vals > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vals; i++) {
+    cs_real_t s0 = (var1[i] - tab->x_min[0]) * i_d0;
+    cs_real_t s1 = (var2[i] - tab->x_min[1]) * i_d1;
+    int j0 = CS_MIN(CS_MAX((int)s0, 0), n0 - 2);
+    int j1 = CS_MIN(CS_MAX((int)s1, 0), n1 - 2);
+    cs_real_t w0 = s0 - j0, w1 = s1 - j1;
+    const cs_real_t *t = t_val + j1*n0 + j0;
+    val[i] =   (1. - w1) * ((1. - w0)*t[0]  + w0*t[1])
+             +       w1  * ((1. - w0)*t[n0] + w0*t[n0+1]);
+  }
+
+  _tab_n_interp += n_vals;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -403,6 +596,17 @@ cs_thermal_table_finalize(void)
                     cs_glob_thermal_table->method,
                     _physprop_lib_t_tot.nsec*1e-9);
 
+    if (_tab_n_builds > 0)
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("  Tabulation (%d x %d nodes):\n"
+                      "    table builds:          %llu\n"
+                      "    interpolated values:   %llu\n"),
+                    _tab_n_nodes, _tab_n_nodes,
+                    _tab_n_builds, _tab_n_interp);
+
+    for (int i = 0; i < CS_PHYS_PROP_N_TYPES; i++)
+      BFT_FREE(_tabs[i].val);
+
 #if defined(HAVE_EOS) /* always a plugin */
     if (cs_glob_thermal_table->type == CS_PHYS_PROP_TABLE_EOS) {
       _cs_eos_destroy();
@@ -506,6 +710,35 @@ cs_physical_properties_set_coolprop_backend(const char  *backend)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate tabulation of physical properties.
+ *
+ * When active, properties provided by a property library (EOS or
+ * CoolProp) are not evaluated for each element, but interpolated
+ * (bilinearly) in a regular table of n_nodes x n_nodes library
+ * evaluations, built separately for each property. The table is built
+ * on first use over the range of thermodynamic states encountered, and
+ * rebuilt over an extended range when states outside that range appear,
+ * so that its cost does not depend on the number of elements.
+ *
+ * Node spacing is uniform, so the number of nodes should be large enough
+ * to resolve property variations over the observed range, especially
+ * close to saturation curves.
+ *
+ * \param[in]  n_nodes  number of nodes along each axis, or 0 to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_physical_properties_set_tabulation(int  n_nodes)
+{
+  if (n_nodes < 2)
+    n_nodes = 0;
+
+  _tab_n_nodes = n_nodes;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute a physical property.
@@ -578,35 +811,13 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
     }
   }
 
-  cs_timer_t t0 = cs_timer_time();
-
-  /* Compute proper */
+  /* Compute properties, using tabulation if activated */
 
-#if defined(HAVE_EOS) /* always a plugin */
-  if (cs_glob_thermal_table->type == CS_PHYS_PROP_TABLE_EOS) {
-    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
-                      property,
-                      _n_vals,
-                      var1_c,
-                      var2_c,
-                      val);
-  }
-#endif
-#if defined(HAVE_COOLPROP)
-  if (cs_glob_thermal_table->type == CS_PHYS_PROP_TABLE_COOLPROP) {
-    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
-                           _cs_coolprop_backend,
-                           cs_glob_thermal_table->thermo_plane,
-                           property,
-                           _n_vals,
-                           var1_c,
-                           var2_c,
-                           val);
-  }
-#endif
-
-  cs_timer_t t1 = cs_timer_time();
-  cs_timer_counter_add_diff(&_physprop_lib_t_tot, &t0, &t1);
+  if (   _tab_n_nodes > 1 && _n_vals > 1
+      && cs_glob_thermal_table->type != CS_PHYS_PROP_TABLE_USER)
+    _tab_compute(property, _n_vals, var1_c, var2_c, val);
+  else
+    _library_compute(property, _n_vals, var1_c, var2_c, val);
 
   BFT_FREE(_var1_c);
   BFT_FREE(_var2_c);
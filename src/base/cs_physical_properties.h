@@ -134,6 +134,21 @@ cs_physical_properties_get_coolprop_backend(void);
 void
 cs_physical_properties_set_coolprop_backend(const char  *backend);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate tabulation of physical properties.
+ *
+ * When active, properties provided by a property library (EOS or
+ * CoolProp) are interpolated in a table of library evaluations built
+ * over the range of states encountered, and extended lazily.
+ *
+ * \param[in]  n_nodes  number of nodes along each axis, or 0 to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_physical_properties_set_tabulation(int  n_nodes);
+
 /*----------------------------------------------------------------------------
  * Compute a physical property.
  *
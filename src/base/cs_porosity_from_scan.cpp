@@ -121,7 +121,8 @@ static cs_porosity_from_scan_opt_t _porosity_from_scan_opt = {
   .use_staircase = false,
   .eigenvalue_criteria = 1e-3,
   .use_restart = false,
-  .cog_location = CS_COG_FROM_FLUID_FACES
+  .cog_location = CS_COG_FROM_FLUID_FACES,
+  .n_points_per_chunk = 1000000
 };
 
 /*============================================================================
@@ -307,6 +308,321 @@ _solid_plane_from_points(const cs_mesh_t   *m,
   } // Loop over cells
 }
 
+/*----------------------------------------------------------------------------
+ * Read a chunk of points from a scan file.
+ *
+ * parameters:
+ *   file          <-- pointer to scan file
+ *   s_id          <-- id of first point to read in current scan (for logging)
+ *   n_points      <-- number of points to read
+ *   point_coords  --> transformed point coordinates
+ *   colors        --> point colors
+ *   min_vec       <-> minimum coordinates of points
+ *   max_vec       <-> maximum coordinates of points
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_scan_points(FILE         *file,
+                  long int      s_id,
+                  long int      n_points,
+                  cs_real_3_t   point_coords[],
+                  float         colors[],
+                  cs_real_t     min_vec[3],
+                  cs_real_t     max_vec[3])
+{
+  for (long int i = 0; i < n_points; i++ ) {
+    int num, green, red, blue;
+    cs_real_4_t xyz;
+    long int l_id = s_id + i;
+    for (int j = 0; j < 3; j++)
+      point_coords[i][j] = 0.;
+
+    if (fscanf(file, "%lf", &(xyz[0])) != 1)
+      bft_error
+        (__FILE__,__LINE__, 0,
+         _("Porosity from scan: Error while reading dataset. Line %ld\n"),
+         l_id);
+    if (fscanf(file, "%lf", &(xyz[1])) != 1)
+      bft_error
+        (__FILE__,__LINE__, 0,
+         _("Porosity from scan: Error while reading dataset."));
+    if (fscanf(file, "%lf", &(xyz[2])) != 1)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Error while reading dataset."));
+
+    /* Translation and rotation */
+    xyz[3] = 1.;
+    for (int j = 0; j < 3; j++) {
+      for (int k = 0; k < 4; k++)
+        point_coords[i][j]
+          += _porosity_from_scan_opt.transformation_matrix[j][k] * xyz[k];
+
+      /* Compute bounding box*/
+      min_vec[j] = CS_MIN(min_vec[j], point_coords[i][j]);
+      max_vec[j] = CS_MAX(max_vec[j], point_coords[i][j]);
+    }
+
+    /* Intensities */
+    if (fscanf(file, "%d", &num) != 1)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Error while reading dataset."));
+
+    /* Red */
+    if (fscanf(file, "%d", &red) != 1)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Error while reading dataset (red). "
+                  "npoints read %ld\n"), l_id);
+    /* Green */
+    if (fscanf(file, "%d", &green) != 1)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Error while reading dataset (green). "
+                  "npoints read %ld\n"), l_id);
+    /* Blue */
+    if (fscanf(file, "%d\n", &blue) != 1)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Error while reading dataset (blue). "
+                  "npoints read %ld\n"), l_id);
+
+    /* When colors are written as int, Paraview interprets them in [0, 255]
+     * when they are written as float, Paraview interprets them in [0., 1.]
+     * */
+    colors[3*i + 0] = red/255.;
+    colors[3*i + 1] = green/255.;
+    colors[3*i + 2] = blue/255.;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Export the points of a scan for post-processing.
+ *
+ * parameters:
+ *   f_name        <-- scan file name
+ *   n_scan        <-- scan id in file
+ *   n_points      <-- number of points (significant on rank 0 only)
+ *   point_coords  <-- point coordinates
+ *   colors        <-- point colors
+ *----------------------------------------------------------------------------*/
+
+static void
+_postprocess_scan_points(const char    *f_name,
+                         int            n_scan,
+                         cs_lnum_t      n_points,
+                         cs_real_3_t    point_coords[],
+                         float          colors[])
+{
+  char *fvm_name;
+  if (_porosity_from_scan_opt.output_name == nullptr) {
+    BFT_MALLOC(fvm_name,
+               strlen(f_name) + 3 + 1,
+               char);
+    strcpy(fvm_name, f_name);
+  }
+  else {
+    BFT_MALLOC(fvm_name,
+               strlen(_porosity_from_scan_opt.output_name) + 3 + 1,
+               char);
+    strcpy(fvm_name, _porosity_from_scan_opt.output_name);
+  }
+  char suffix[13];
+  sprintf(suffix, "_%02d", n_scan);
+  strcat(fvm_name, suffix);
+
+  /* Build FVM mesh from scanned points */
+  fvm_nodal_t *pts_mesh = fvm_nodal_create(fvm_name, 3);
+
+  /* Only the first rank writes points for now */
+  cs_gnum_t *vtx_gnum = nullptr;
+
+  if (cs_glob_rank_id < 1) {
+    /* Update the points set structure */
+    fvm_nodal_define_vertex_list(pts_mesh, n_points, nullptr);
+    fvm_nodal_set_shared_vertices(pts_mesh, (cs_coord_t *)point_coords);
+
+    BFT_MALLOC(vtx_gnum, n_points, cs_gnum_t);
+    for (cs_lnum_t i = 0; i < n_points; i++)
+      vtx_gnum[i] = i + 1;
+
+  }
+  fvm_nodal_init_io_num(pts_mesh, vtx_gnum, 0);
+
+  /* Free if allocated */
+  BFT_FREE(vtx_gnum);
+
+  /* Create default writer */
+  fvm_writer_t *writer
+    = fvm_writer_init(fvm_name,
+                      "postprocessing",
+                      cs_post_get_default_format(),
+                      cs_post_get_default_format_options(),
+                      FVM_WRITER_FIXED_MESH);
+
+  fvm_writer_export_nodal(writer, pts_mesh);
+
+  const void *var_ptr[1] = {nullptr};
+
+  var_ptr[0] = colors;
+
+  fvm_writer_export_field(writer,
+                          pts_mesh,
+                          "color",
+                          FVM_WRITER_PER_NODE,
+                          3,
+                          CS_INTERLACE,
+                          0,
+                          0,
+                          CS_FLOAT,
+                          -1,
+                          0.0,
+                          (const void * *)var_ptr);
+
+  /* Free and destroy */
+  fvm_writer_finalize(writer);
+  pts_mesh = fvm_nodal_destroy(pts_mesh);
+  BFT_FREE(fvm_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Locate a set of scan points in the mesh and accumulate cell-wise
+ * point statistics.
+ *
+ * Points are only provided by the first rank; the locator sends them
+ * to the ranks owning the containing cells.
+ *
+ * parameters:
+ *   m              <-- pointer to mesh
+ *   mq             <-- pointer to mesh quantities
+ *   location_mesh  <-- nodal mesh on which points are located
+ *   n_points       <-- number of points provided by this rank
+ *   point_coords   <-- point coordinates
+ *   colors         <-- point colors
+ *   cen_points     <-> sum of point offsets to cell centers
+ *   cell_color     <-> sum of point colors
+ *   c_w_face_rough <-> solid roughness
+ *   mom_mat        <-> incremental second moment matrix
+ *----------------------------------------------------------------------------*/
+
+static void
+_locate_scan_points(const cs_mesh_t             *m,
+                    const cs_mesh_quantities_t  *mq,
+                    fvm_nodal_t                 *location_mesh,
+                    cs_lnum_t                    n_points,
+                    cs_real_3_t                  point_coords[],
+                    float                        colors[],
+                    cs_real_t                    cen_points[],
+                    cs_real_t                    cell_color[],
+                    cs_real_t                    c_w_face_rough[],
+                    cs_real_33_t                 mom_mat[])
+{
+  cs_field_t *f_nb_scan = cs_field_by_name_try("nb_scan_points");
+
+  /* Now build locator
+   * Locate points on this location mesh */
+  /*-------------------------------------*/
+
+  int options[PLE_LOCATOR_N_OPTIONS];
+  for (int i = 0; i < PLE_LOCATOR_N_OPTIONS; i++)
+    options[i] = 0;
+  options[PLE_LOCATOR_NUMBERING] = 0; /* base 0 numbering */
+
+#if defined(PLE_HAVE_MPI)
+  _locator = ple_locator_create(cs_glob_mpi_comm,
+                                cs_glob_n_ranks,
+                                0);
+#else
+  _locator = ple_locator_create();
+#endif
+
+  ple_locator_set_mesh(_locator,
+                       location_mesh,
+                       options,
+                       0., /* tolerance_base */
+                       0.1, /* tolerance */
+                       3, /* dim */
+                       n_points,
+                       nullptr,
+                       nullptr, /* point_tag */
+                       (cs_real_t *)point_coords,
+                       nullptr, /* distance */
+                       cs_coupling_mesh_extents,
+                       cs_coupling_point_in_mesh_p);
+
+  /* Shift from 1-base to 0-based locations */
+  ple_locator_shift_locations(_locator, -1);
+
+  /* dump locator */
+#if 0
+  ple_locator_dump(_locator);
+#endif
+
+  /* Number of distant points located on local mesh. */
+  cs_lnum_t n_points_dist = ple_locator_get_n_dist_points(_locator);
+
+#if 0
+  bft_printf("ple_locator_get_n_dist_points = %d, n_points = %d\n",
+             n_points_dist, n_points);
+#endif
+
+  const cs_lnum_t *dist_loc = ple_locator_get_dist_locations(_locator);
+  const ple_coord_t *dist_coords = ple_locator_get_dist_coords(_locator);
+
+  float *dist_colors = nullptr;
+  BFT_MALLOC(dist_colors, 3*n_points_dist, float);
+
+  ple_locator_exchange_point_var(_locator,
+                                 dist_colors,
+                                 colors,
+                                 nullptr,
+                                 sizeof(float),
+                                 3,
+                                 1);
+
+  for (cs_lnum_t i = 0; i < n_points_dist; i++) {
+    cs_lnum_t c_id = dist_loc[i];
+    f_nb_scan->val[c_id] += 1.;
+    for (cs_lnum_t idim = 0; idim < 3; idim++) {
+      cen_points[c_id*3+idim]
+        += (dist_coords[i*3 + idim] - mq->cell_cen[c_id*3+idim]);
+
+      cell_color[c_id*3+idim] += dist_colors[i*3 + idim];
+    }
+  }
+
+  _incremental_solid_plane_from_points(m,
+                                       n_points_dist,
+                                       dist_loc,
+                                       (const cs_real_t   *)f_nb_scan->val,
+                                       (const cs_real_3_t *)mq->cell_cen,
+                                       (const cs_real_3_t *)dist_coords,
+                                       mom_mat);
+
+  BFT_FREE(dist_colors);
+
+  /* Solid face roughness from point cloud is computed as the RMS of points
+   *  distance to the reconstructed plane */
+  cs_real_t vec_w_point[3]  = {0., 0., 0.};
+  cs_real_t w_point_dist =  0.;
+
+  for (cs_lnum_t i = 0; i < n_points_dist; i++) {
+    cs_lnum_t c_id = dist_loc[i];
+
+    if (f_nb_scan->val[c_id] > 1.)  { // at least 2 points to compute distance
+
+      for (cs_lnum_t idim = 0; idim < 3; idim++)
+        vec_w_point[idim] = dist_coords[i*3 + idim]
+                          - cen_points[c_id*3+idim];
+      //TODO compute roughness incrementally
+      //w_point_dist = cs_math_3_dot_product(vec_w_point, c_w_face_normal[c_id]);
+
+      c_w_face_rough[c_id] += 2 * sqrt(w_point_dist * w_point_dist)
+                            / f_nb_scan->val[c_id];
+    }
+  }
+  //TODO compute the minimum distance between point to suggest a minimum resolution
+
+  /* Free memory */
+  _locator = ple_locator_destroy(_locator);
+}
+
 /*----------------------------------------------------------------------------
  * Prepare computation of porosity from scan points file.
  *
@@ -390,24 +706,32 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
     bft_printf(_("\n\n  Open file:\n"
           "    %s\n\n"),
         f_name);
-    FILE *file = fopen(f_name, "rt");
-    if (file == nullptr)
-      bft_error(__FILE__,__LINE__, 0,
-          _("Porosity from scan: Could not open file."));
+
+    /* Only the first rank reads the file; points are then sent
+       by the locator to the ranks owning the containing cells */
+
+    FILE *file = nullptr;
+    if (cs_glob_rank_id < 1) {
+      file = fopen(f_name, "rt");
+      if (file == nullptr)
+        bft_error(__FILE__,__LINE__, 0,
+            _("Porosity from scan: Could not open file."));
+    }
 
     /* next file to be read */
     tok = strtok(nullptr, sep);
-    long int n_read_points = 0;
-    long int n_points = 0;
-    if (fscanf(file, "%ld\n", &n_read_points) != 1)
-      bft_error(__FILE__,__LINE__, 0,
-                _("Porosity from scan: Could not read the number of lines."));
-
-    bft_printf(_("  Porosity from scan: %ld points to be read.\n\n"),
-               n_read_points);
+    cs_gnum_t n_read_points = 0;
+    if (cs_glob_rank_id < 1) {
+      long int _n_read_points = 0;
+      if (fscanf(file, "%ld\n", &_n_read_points) != 1)
+        bft_error(__FILE__,__LINE__, 0,
+                  _("Porosity from scan: Could not read the number of lines."));
+      n_read_points = _n_read_points;
+    }
+    cs_parall_bcast(0, 1, CS_GNUM_TYPE, &n_read_points);
 
-    /* Pointer to field */
-    cs_field_t *f_nb_scan = cs_field_by_name_try("nb_scan_points");
+    bft_printf(_("  Porosity from scan: %llu points to be read.\n\n"),
+               (unsigned long long)n_read_points);
 
     /* Location mesh where points will be localized */
     fvm_nodal_t *location_mesh =
@@ -423,85 +747,77 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
      * ------------------------ */
 
     for (int n_scan = 0; n_read_points > 0; n_scan++) {
-      n_points = n_read_points;
+      cs_gnum_t n_points = n_read_points;
       bft_printf(_("  Immersed boundary from scan: scan %d.\n"
-                   "                               %ld points to be read.\n\n"),
-                 n_scan, n_points);
-
-
-      cs_real_3_t *point_coords;
-      float *colors;
-      BFT_MALLOC(point_coords, n_points, cs_real_3_t);
-      BFT_MALLOC(colors, 3*n_points, float);
+                   "                               %llu points to be read."
+                   "\n\n"),
+                 n_scan, (unsigned long long)n_points);
+
+      /* Points are read and located by chunks of bounded size,
+         unless they are post-processed, which requires the whole scan */
+
+      cs_gnum_t n_chunk_max = n_points;
+      if (   !_porosity_from_scan_opt.postprocess_points
+          && _porosity_from_scan_opt.n_points_per_chunk > 0)
+        n_chunk_max = CS_MIN(n_points,
+                             (cs_gnum_t)(  _porosity_from_scan_opt
+                                         .n_points_per_chunk));
+
+      cs_real_3_t *point_coords = nullptr;
+      float *colors = nullptr;
+      if (cs_glob_rank_id < 1) {
+        BFT_MALLOC(point_coords, n_chunk_max, cs_real_3_t);
+        BFT_MALLOC(colors, 3*n_chunk_max, float);
+      }
 
       cs_real_3_t min_vec = { HUGE_VAL,  HUGE_VAL,  HUGE_VAL};
       cs_real_3_t max_vec = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
 
-      /* Read points */
-      for (int i = 0; i < n_points; i++ ) {
-        int num, green, red, blue;
-        cs_real_4_t xyz;
-        for (int j = 0; j < 3; j++)
-          point_coords[i][j] = 0.;
-
-        if (fscanf(file, "%lf", &(xyz[0])) != 1)
-          bft_error
-            (__FILE__,__LINE__, 0,
-             _("Porosity from scan: Error while reading dataset. Line %d\n"), i);
-        if (fscanf(file, "%lf", &(xyz[1])) != 1)
-          bft_error
-            (__FILE__,__LINE__, 0,
-             _("Porosity from scan: Error while reading dataset."));
-        if (fscanf(file, "%lf", &(xyz[2])) != 1)
-          bft_error(__FILE__,__LINE__, 0,
-                    _("Porosity from scan: Error while reading dataset."));
-
-        /* Translation and rotation */
-        xyz[3] = 1.;
-        for (int j = 0; j < 3; j++) {
-          for (int k = 0; k < 4; k++)
-            point_coords[i][j]
-              += _porosity_from_scan_opt.transformation_matrix[j][k] * xyz[k];
-
-          /* Compute bounding box*/
-          min_vec[j] = CS_MIN(min_vec[j], point_coords[i][j]);
-          max_vec[j] = CS_MAX(max_vec[j], point_coords[i][j]);
+      for (cs_gnum_t s_id = 0; s_id < n_points; s_id += n_chunk_max) {
+
+        cs_gnum_t n_chunk = CS_MIN(n_chunk_max, n_points - s_id);
+        cs_lnum_t _n_chunk = 0;
+
+        /* Read points */
+        if (cs_glob_rank_id < 1) {
+          _n_chunk = n_chunk;
+          _read_scan_points(file,
+                            s_id,
+                            n_chunk,
+                            point_coords,
+                            colors,
+                            min_vec,
+                            max_vec);
         }
 
-        /* Intensities */
-        if (fscanf(file, "%d", &num) != 1)
-          bft_error(__FILE__,__LINE__, 0,
-                    _("Porosity from scan: Error while reading dataset."));
-
-        /* Red */
-        if (fscanf(file, "%d", &red) != 1)
-          bft_error(__FILE__,__LINE__, 0,
-                    _("Porosity from scan: Error while reading dataset (red). "
-                      "npoints read %d\n"), i);
-        /* Green */
-        if (fscanf(file, "%d", &green) != 1)
-          bft_error(__FILE__,__LINE__, 0,
-                    _("Porosity from scan: Error while reading dataset (green). "
-                      "npoints read %d\n"), i);
-        /* Blue */
-        if (fscanf(file, "%d\n", &blue) != 1)
-          bft_error(__FILE__,__LINE__, 0,
-                    _("Porosity from scan: Error while reading dataset (blue). "
-                      "npoints read %d\n"), i);
-
-        /* When colors are written as int, Paraview interprets them in [0, 255]
-         * when they are written as float, Paraview interprets them in [0., 1.]
-         * */
-        colors[3*i + 0] = red/255.;
-        colors[3*i + 1] = green/255.;
-        colors[3*i + 2] = blue/255.;
+        /* FVM meshes for writers */
+        if (_porosity_from_scan_opt.postprocess_points)
+          _postprocess_scan_points(f_name,
+                                   n_scan,
+                                   _n_chunk,
+                                   point_coords,
+                                   colors);
+
+        _locate_scan_points(m,
+                            mq,
+                            location_mesh,
+                            _n_chunk,
+                            point_coords,
+                            colors,
+                            cen_points,
+                            cell_color,
+                            c_w_face_rough,
+                            mom_mat);
+
       }
 
       /* Check EOF was correctly reached */
-      if (fgets(line, sizeof(line), file) != nullptr)
-        n_read_points = strtol(line, nullptr, 10);
-      else
-        n_read_points = 0;
+      n_read_points = 0;
+      if (cs_glob_rank_id < 1) {
+        if (fgets(line, sizeof(line), file) != nullptr)
+          n_read_points = strtol(line, nullptr, 10);
+      }
+      cs_parall_bcast(0, 1, CS_GNUM_TYPE, &n_read_points);
 
       /* Bounding box*/
       bft_printf(_("  Bounding box [%f, %f, %f], [%f, %f, %f].\n\n"),
@@ -516,200 +832,21 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
 
       if (n_read_points > 0)
         bft_printf
-          (_("  Porosity from scan: %ld additional points to be read.\n\n"),
-           n_read_points);
-
-      /* FVM meshes for writers */
-      if (_porosity_from_scan_opt.postprocess_points) {
-        char *fvm_name;
-        if (_porosity_from_scan_opt.output_name == nullptr) {
-          BFT_MALLOC(fvm_name,
-                     strlen(f_name) + 3 + 1,
-                     char);
-          strcpy(fvm_name, f_name);
-        }
-        else {
-          BFT_MALLOC(fvm_name,
-                     strlen(_porosity_from_scan_opt.output_name) + 3 + 1,
-                     char);
-          strcpy(fvm_name, _porosity_from_scan_opt.output_name);
-        }
-        char suffix[13];
-        sprintf(suffix, "_%02d", n_scan);
-        strcat(fvm_name, suffix);
-
-        /* Build FVM mesh from scanned points */
-        fvm_nodal_t *pts_mesh = fvm_nodal_create(fvm_name, 3);
-
-        /* Only the first rank writes points for now */
-        cs_gnum_t *vtx_gnum = nullptr;
+          (_("  Porosity from scan: %llu additional points to be read.\n\n"),
+           (unsigned long long)n_read_points);
 
-        if (cs_glob_rank_id < 1) {
-          /* Update the points set structure */
-          fvm_nodal_define_vertex_list(pts_mesh, n_points, nullptr);
-          fvm_nodal_set_shared_vertices(pts_mesh, (cs_coord_t *)point_coords);
-
-          BFT_MALLOC(vtx_gnum, n_points, cs_gnum_t);
-          for (cs_lnum_t i = 0; i < n_points; i++)
-            vtx_gnum[i] = i + 1;
-
-        }
-        fvm_nodal_init_io_num(pts_mesh, vtx_gnum, 0);
-
-        /* Free if allocated */
-        BFT_FREE(vtx_gnum);
-
-        /* Create default writer */
-        fvm_writer_t *writer
-          = fvm_writer_init(fvm_name,
-                            "postprocessing",
-                            cs_post_get_default_format(),
-                            cs_post_get_default_format_options(),
-                            FVM_WRITER_FIXED_MESH);
-
-        fvm_writer_export_nodal(writer, pts_mesh);
-
-        const void *var_ptr[1] = {nullptr};
-
-        var_ptr[0] = colors;
-
-        fvm_writer_export_field(writer,
-                                pts_mesh,
-                                "color",
-                                FVM_WRITER_PER_NODE,
-                                3,
-                                CS_INTERLACE,
-                                0,
-                                0,
-                                CS_FLOAT,
-                                -1,
-                                0.0,
-                                (const void * *)var_ptr);
-
-        /* Free and destroy */
-        fvm_writer_finalize(writer);
-        pts_mesh = fvm_nodal_destroy(pts_mesh);
-        BFT_FREE(fvm_name);
-        BFT_FREE(f_name);
-      }
-
-      /* Now build locator
-       * Locate points on this location mesh */
-      /*-------------------------------------*/
-
-      int options[PLE_LOCATOR_N_OPTIONS];
-      for (int i = 0; i < PLE_LOCATOR_N_OPTIONS; i++)
-        options[i] = 0;
-      options[PLE_LOCATOR_NUMBERING] = 0; /* base 0 numbering */
-
-#if defined(PLE_HAVE_MPI)
-      _locator = ple_locator_create(cs_glob_mpi_comm,
-                                    cs_glob_n_ranks,
-                                    0);
-#else
-      _locator = ple_locator_create();
-#endif
-
-      cs_lnum_t _n_points = (cs_glob_rank_id < 1) ? n_points : 0;
-      cs_real_t *_point_coords = (cs_glob_rank_id < 1) ? (cs_real_t *)point_coords : nullptr;
-
-      ple_locator_set_mesh(_locator,
-                           location_mesh,
-                           options,
-                           0., /* tolerance_base */
-                           0.1, /* tolerance */
-                           3, /* dim */
-                           _n_points,
-                           nullptr,
-                           nullptr, /* point_tag */
-                           _point_coords,
-                           nullptr, /* distance */
-                           cs_coupling_mesh_extents,
-                           cs_coupling_point_in_mesh_p);
-
-      /* Shift from 1-base to 0-based locations */
-      ple_locator_shift_locations(_locator, -1);
-
-      /* dump locator */
-#if 0
-      ple_locator_dump(_locator);
-#endif
-
-      /* Number of distant points located on local mesh. */
-      cs_lnum_t n_points_dist = ple_locator_get_n_dist_points(_locator);
-
-#if 0
-      bft_printf("ple_locator_get_n_dist_points = %d, n_points = %ld\n",
-                 n_points_dist, n_points);
-#endif
-
-      const cs_lnum_t *dist_loc = ple_locator_get_dist_locations(_locator);
-      const ple_coord_t *dist_coords = ple_locator_get_dist_coords(_locator);
-
-      float *dist_colors = nullptr;
-      BFT_MALLOC(dist_colors, 3*n_points_dist, float);
-
-      ple_locator_exchange_point_var(_locator,
-                                     dist_colors,
-                                     colors,
-                                     nullptr,
-                                     sizeof(float),
-                                     3,
-                                     1);
-
-      for (cs_lnum_t i = 0; i < n_points_dist; i++) {
-        cs_lnum_t c_id = dist_loc[i];
-        f_nb_scan->val[c_id] += 1.;
-        for (cs_lnum_t idim = 0; idim < 3; idim++) {
-          cen_points[c_id*3+idim]
-            += (dist_coords[i*3 + idim] - mq->cell_cen[c_id*3+idim]);
-
-          cell_color[c_id*3+idim] += dist_colors[i*3 + idim];
-        }
-      }
-
-      _incremental_solid_plane_from_points(m,
-                                           n_points_dist,
-                                           dist_loc,
-                                           (const cs_real_t   *)f_nb_scan->val,
-                                           (const cs_real_3_t *)mq->cell_cen,
-                                           (const cs_real_3_t *)dist_coords,
-                                           mom_mat);
-
-      BFT_FREE(dist_colors);
-
-      /* Solid face roughness from point cloud is computed as the RMS of points
-       *  distance to the reconstructed plane */
-      cs_real_t vec_w_point[3]  = {0., 0., 0.};
-      cs_real_t w_point_dist =  0.;
-
-      for (cs_lnum_t i = 0; i < n_points_dist; i++) {
-        cs_lnum_t c_id = dist_loc[i];
-
-        if (f_nb_scan->val[c_id] > 1.)  { // at least 2 points to compute distance
-
-          for (cs_lnum_t idim = 0; idim < 3; idim++)
-            vec_w_point[idim] = dist_coords[i*3 + idim]
-                              - cen_points[c_id*3+idim];
-          //TODO compute roughness incrementally
-          //w_point_dist = cs_math_3_dot_product(vec_w_point, c_w_face_normal[c_id]);
-
-          c_w_face_rough[c_id] += 2 * sqrt(w_point_dist * w_point_dist)
-                                / f_nb_scan->val[c_id];
-        }
-      }
-      //TODO compute the minimum distance between point to suggest a minimum resolution
-
-      /* Free memory */
-      _locator = ple_locator_destroy(_locator);
       BFT_FREE(point_coords);
       BFT_FREE(colors);
 
     } /* End loop on multiple scans */
 
-    if (fclose(file) != 0)
-      bft_error(__FILE__,__LINE__, 0,
-                _("Porosity from scan: Could not close the file."));
+    if (file != nullptr) {
+      if (fclose(file) != 0)
+        bft_error(__FILE__,__LINE__, 0,
+                  _("Porosity from scan: Could not close the file."));
+    }
+
+    BFT_FREE(f_name);
 
     /* Nodal mesh is not needed anymore */
     location_mesh = fvm_nodal_destroy(location_mesh);
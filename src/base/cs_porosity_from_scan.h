@@ -96,6 +96,9 @@ typedef struct {
   cs_real_t eigenvalue_criteria;
   int       use_restart;
   cs_ibm_cog_location_t cog_location;
+  /*! Maximum number of scan points read and located at once when
+      points are not post-processed (0 or less: whole scan) */
+  cs_lnum_t n_points_per_chunk;
 
 } cs_porosity_from_scan_opt_t;
 
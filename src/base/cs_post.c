@@ -257,6 +257,10 @@ typedef struct {
 
   fvm_writer_t  *writer;        /* Associated FVM writer */
 
+  bool           reuse_meshes;  /* true if no associated mesh changed
+                                   since last output, so output of
+                                   time-dependent meshes may be skipped */
+
 } cs_post_writer_t;
 
 /* Post-processing mesh structure */
@@ -313,6 +317,9 @@ typedef struct {
                                             output (-2 before first output,
                                             -1 for time-indepedent output)
                                             for each associated writer */
+  int                     nt_mod;        /* Time step number at which the
+                                            exportable mesh was last
+                                            (re)defined or updated */
 
   cs_lnum_t               n_i_faces;     /* N. associated interior faces */
   cs_lnum_t               n_b_faces;     /* N. associated boundary faces */
@@ -334,8 +341,27 @@ typedef struct {
                                             associated writer id, field id,
                                             and component id */
 
+  int                     n_traj_steps;  /* Number of trajectory output
+                                            steps currently buffered */
+  int                     traj_nt_last;  /* Last buffered time step */
+  cs_lagr_particle_set_t *traj_p_set;    /* Buffered trajectory particles,
+                                            or NULL */
+
 } cs_post_mesh_t;
 
+/* Function values evaluated during a given output step */
+
+typedef struct {
+
+  const cs_function_t  *f;             /* Associated function */
+  int                   mesh_id;       /* Associated post-processing mesh id,
+                                          or 0 for the whole location */
+  bool                  time_dep;      /* Evaluated with time step info */
+  cs_lnum_t             n_elts;        /* Number of evaluated elements */
+  unsigned char        *vals;          /* Evaluated values */
+
+} cs_post_function_cache_t;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -353,6 +379,10 @@ fvm_writer_time_dep_t  _cs_post_mod_flag_min = FVM_WRITER_FIXED_MESH;
 
 static bool        _number_particles_by_coord = false;
 
+/* Number of output steps over which trajectories are buffered */
+
+static int         _trajectory_buffer_steps = 1;
+
 /* Array of exportable meshes associated with post-processing;
    free ids start under the last CS_POST_MESH_* definition,
    currently at -5) */
@@ -392,6 +422,13 @@ static const char  _cs_post_dirname[] = "postprocessing";
 
 static char *_field_sync = NULL;
 
+/* Function evaluations shared by meshes and writers during an output step */
+
+static bool                       _function_cache_active = false;
+static int                        _n_function_cache = 0;
+static int                        _n_function_cache_max = 0;
+static cs_post_function_cache_t  *_function_cache = NULL;
+
 /* Timer statistics */
 
 static int  _post_out_stat_id = -1;
@@ -490,6 +527,168 @@ _check_non_transient(const cs_post_writer_t  *writer,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Check if a post-processing mesh will output values using at least one of
+ * its associated writers for a given time step.
+ *
+ * This allows avoiding costly evaluations which would be discarded.
+ *
+ * parameters:
+ *   post_mesh <-- pointer to post-processing mesh
+ *   writer_id <-- id of specified associated writer,
+ *                 or CS_POST_WRITER_ALL_ASSOCIATED for all
+ *   ts        <-- time step status structure, or NULL
+ *
+ * returns:
+ *   true if output will occur, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_post_mesh_will_output(const cs_post_mesh_t  *post_mesh,
+                       int                    writer_id,
+                       const cs_time_step_t  *ts)
+{
+  for (int i = 0; i < post_mesh->n_writers; i++) {
+
+    const cs_post_writer_t *writer
+      = _cs_post_writers + post_mesh->writer_id[i];
+
+    if (writer->id != writer_id && writer_id != CS_POST_WRITER_ALL_ASSOCIATED)
+      continue;
+
+    if (writer->active == 1) {
+
+      int nt_cur = (ts != NULL) ? ts->nt_cur : -1;
+      double t_cur = (ts != NULL) ? ts->t_cur : 0.;
+
+      _check_non_transient(writer, &nt_cur, &t_cur);
+
+      if (nt_cur < 0 && writer->tc.last_nt > 0)
+        continue;
+
+      return true;
+
+    }
+
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Free function values cached during an output step.
+ *----------------------------------------------------------------------------*/
+
+static void
+_function_cache_free(void)
+{
+  for (int i = 0; i < _n_function_cache; i++)
+    BFT_FREE(_function_cache[i].vals);
+
+  BFT_FREE(_function_cache);
+  _n_function_cache = 0;
+  _n_function_cache_max = 0;
+  _function_cache_active = false;
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate a function on a given element list, reusing values already
+ * computed during the current output step when possible.
+ *
+ * When elt_ids is NULL, the function is evaluated on the whole location,
+ * and the returned array is sized for elements including ghosts.
+ *
+ * Inside an output step (see cs_post_time_step_output), the returned
+ * values are owned by the cache, and *vals_p is set to NULL. Otherwise,
+ * or if the values are a subset of those cached for the whole location,
+ * they are returned through *vals_p, which the caller must free.
+ *
+ * parameters:
+ *   f           <-- pointer to function object
+ *   ts          <-- time step status structure, or NULL
+ *   location_id <-- associated mesh location id
+ *   mesh_id     <-- associated post-processing mesh id, or 0 if
+ *                   evaluated on the whole location
+ *   n_elts      <-- number of elements
+ *   elt_ids     <-- element ids, or NULL for the whole location
+ *   vals_p      --> values to free by the caller, or NULL
+ *
+ * returns:
+ *   pointer to evaluated values
+ *----------------------------------------------------------------------------*/
+
+static const void *
+_function_values(const cs_function_t    *f,
+                 const cs_time_step_t   *ts,
+                 int                     location_id,
+                 int                     mesh_id,
+                 cs_lnum_t               n_elts,
+                 const cs_lnum_t        *elt_ids,
+                 unsigned char         **vals_p)
+{
+  const bool time_dep = (ts != NULL) ? true : false;
+  const size_t elt_size = cs_datatype_size[f->datatype] * f->dim;
+
+  *vals_p = NULL;
+
+  /* Search for matching or whole location values */
+
+  const cs_post_function_cache_t *c_loc = NULL;
+
+  if (_function_cache_active) {
+    for (int i = 0; i < _n_function_cache; i++) {
+      const cs_post_function_cache_t *c = _function_cache + i;
+      if (c->f != f || c->time_dep != time_dep)
+        continue;
+      if (c->mesh_id == mesh_id && c->n_elts == n_elts)
+        return c->vals;
+      else if (c->mesh_id == 0)
+        c_loc = c;
+    }
+  }
+
+  size_t n_alloc = n_elts;
+  if (elt_ids == NULL)
+    n_alloc = cs_mesh_location_get_n_elts(location_id)[2];
+
+  unsigned char *_vals = NULL;
+  BFT_MALLOC(_vals, n_alloc * elt_size, unsigned char);
+
+  /* Extract from whole location values if available */
+
+  if (c_loc != NULL && elt_ids != NULL) {
+    for (cs_lnum_t i = 0; i < n_elts; i++)
+      memcpy(_vals + i*elt_size, c_loc->vals + elt_ids[i]*elt_size, elt_size);
+    *vals_p = _vals;
+    return _vals;
+  }
+
+  cs_function_evaluate(f, ts, location_id, n_elts, elt_ids, _vals);
+
+  if (_function_cache_active == false) {
+    *vals_p = _vals;
+    return _vals;
+  }
+
+  if (_n_function_cache >= _n_function_cache_max) {
+    _n_function_cache_max = (_n_function_cache_max > 0) ?
+      _n_function_cache_max*2 : 8;
+    BFT_REALLOC(_function_cache, _n_function_cache_max,
+                cs_post_function_cache_t);
+  }
+
+  cs_post_function_cache_t *c = _function_cache + _n_function_cache;
+  _n_function_cache += 1;
+
+  c->f = f;
+  c->mesh_id = mesh_id;
+  c->time_dep = time_dep;
+  c->n_elts = n_elts;
+  c->vals = _vals;
+
+  return _vals;
+}
+
 /*----------------------------------------------------------------------------
  * Clear temporary writer definition information.
  *
@@ -1174,6 +1373,7 @@ _predefine_mesh(int        mesh_id,
   post_mesh->n_writers = 0;
   post_mesh->writer_id = NULL;
   post_mesh->nt_last = NULL;
+  post_mesh->nt_mod = -1;
 
   post_mesh->add_groups = false;
   post_mesh->post_domain = false;
@@ -1230,6 +1430,12 @@ _predefine_mesh(int        mesh_id,
   post_mesh->n_a_fields = 0;
   post_mesh->a_field_info = NULL;
 
+  /* Trajectory buffering */
+
+  post_mesh->n_traj_steps = 0;
+  post_mesh->traj_nt_last = -1;
+  post_mesh->traj_p_set = NULL;
+
   return post_mesh;
 }
 
@@ -1259,6 +1465,8 @@ _free_mesh(int _mesh_id)
   BFT_FREE(post_mesh->name);
   BFT_FREE(post_mesh->a_field_info);
 
+  cs_lagr_particle_set_destroy(&(post_mesh->traj_p_set));
+
   /* Shift remaining meshes */
 
   for (i = 0; i < _cs_post_n_meshes; i++) {
@@ -1475,6 +1683,58 @@ _define_export_mesh(cs_post_mesh_t  *post_mesh,
   post_mesh->_exp_mesh = exp_mesh;
 }
 
+/*----------------------------------------------------------------------------
+ * Buffer selected particles for trajectory output.
+ *
+ * Copies of the selected particles (including their previous time step
+ * values) are appended to the mesh's trajectory buffer, which is flushed
+ * every _trajectory_buffer_steps output steps, and on the last time step.
+ *
+ * parameters:
+ *   post_mesh     <-> pointer to trajectory post-processing mesh
+ *   n_particles   <-- number of selected particles
+ *   particle_list <-- list of selected particles (1 to n), or NULL
+ *   ts            <-- time step structure
+ *
+ * returns:
+ *   true if the buffer should be output at this step, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_buffer_trajectories(cs_post_mesh_t        *post_mesh,
+                     cs_lnum_t              n_particles,
+                     const cs_lnum_t        particle_list[],
+                     const cs_time_step_t  *ts)
+{
+  /* Already buffered at this time step */
+
+  if (post_mesh->traj_nt_last == ts->nt_cur)
+    return (post_mesh->n_traj_steps == 0);
+
+  /* Restart from an empty buffer after a flush */
+
+  if (post_mesh->n_traj_steps == 0 && post_mesh->traj_p_set != NULL)
+    post_mesh->traj_p_set->n_particles = 0;
+
+  cs_lagr_particle_set_append(&(post_mesh->traj_p_set),
+                              cs_lagr_get_particle_set(),
+                              n_particles,
+                              particle_list);
+
+  post_mesh->n_traj_steps += 1;
+  post_mesh->traj_nt_last = ts->nt_cur;
+
+  bool flush = false;
+  if (   post_mesh->n_traj_steps >= _trajectory_buffer_steps
+      || (ts->nt_max > 0 && ts->nt_cur >= ts->nt_max))
+    flush = true;
+
+  if (flush)
+    post_mesh->n_traj_steps = 0;
+
+  return flush;
+}
+
 /*----------------------------------------------------------------------------
  * Create a particles post-processing mesh;
  *
@@ -1509,6 +1769,20 @@ _define_particle_export_mesh(cs_post_mesh_t        *post_mesh,
     if (p_set == NULL)
       return;
 
+    /* Buffered trajectories: segments of several output steps are
+       built from the buffer when it is flushed, and nothing is output
+       (so no writer synchronization occurs) at other steps */
+
+    if (post_mesh->ent_flag[3] == 2 && _trajectory_buffer_steps > 1) {
+      if (_buffer_trajectories(post_mesh, n_particles, particle_list, ts)) {
+        p_set = post_mesh->traj_p_set;
+        n_particles = p_set->n_particles;
+        particle_list = NULL;
+      }
+      else
+        return;
+    }
+
     /* Particle positions */
 
     if (post_mesh->ent_flag[3] == 1) {
@@ -1929,6 +2203,8 @@ _define_mesh(cs_post_mesh_t        *post_mesh,
 
   else
     _define_regular_mesh(post_mesh);
+
+  post_mesh->nt_mod = (ts != NULL) ? ts->nt_cur : -1;
 }
 
 /*----------------------------------------------------------------------------
@@ -2238,6 +2514,45 @@ _cs_post_write_transient_zone_info(const cs_post_mesh_t  *post_mesh,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Check for each writer if associated meshes have not changed since
+ * their last output, so that their output may be skipped.
+ *----------------------------------------------------------------------------*/
+
+static void
+_check_writers_mesh_reuse(void)
+{
+  for (int i = 0; i < _cs_post_n_writers; i++) {
+    cs_post_writer_t  *writer = _cs_post_writers + i;
+    writer->reuse_meshes = false;
+    if (writer->writer != NULL)
+      writer->reuse_meshes = fvm_writer_allows_mesh_reuse(writer->writer);
+  }
+
+  /* Mesh coordinates may change at any time step */
+
+  if (cs_glob_mesh->time_dep >= CS_MESH_TRANSIENT_COORDS) {
+    for (int i = 0; i < _cs_post_n_writers; i++)
+      (_cs_post_writers + i)->reuse_meshes = false;
+    return;
+  }
+
+  for (int i = 0; i < _cs_post_n_meshes; i++) {
+
+    const cs_post_mesh_t  *post_mesh = _cs_post_meshes + i;
+
+    for (int j = 0; j < post_mesh->n_writers; j++) {
+      cs_post_writer_t  *writer = _cs_post_writers + post_mesh->writer_id[j];
+      if (   post_mesh->exp_mesh == NULL
+          || post_mesh->ent_flag[3] != 0
+          || post_mesh->nt_last[j] < 0
+          || post_mesh->nt_mod > post_mesh->nt_last[j])
+        writer->reuse_meshes = false;
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Output a post-processing mesh using associated writers.
  *
@@ -2287,7 +2602,33 @@ _cs_post_write_mesh(cs_post_mesh_t        *post_mesh,
         write_mesh = true;
     }
 
-    if (write_mesh == true) {
+    /* If no mesh associated with this writer has changed since the
+       last output, and the format allows it, the previous output
+       is reused */
+
+    if (   write_mesh == true
+        && time_dep != FVM_WRITER_FIXED_MESH
+        && writer->reuse_meshes) {
+
+      if (nt_cur >= 0) {
+        writer->tc.last_nt = nt_cur;
+        writer->tc.last_t = t_cur;
+      }
+
+      if (post_mesh->post_domain)
+        _cs_post_write_domain(writer->writer,
+                              post_mesh->exp_mesh,
+                              nt_cur,
+                              t_cur);
+
+      _cs_post_write_fixed_zone_info(writer->writer,
+                                     post_mesh,
+                                     nt_cur,
+                                     t_cur);
+
+    }
+
+    else if (write_mesh == true) {
 
       if (writer->writer == NULL)
         _init_writer(writer);
@@ -2445,10 +2786,19 @@ _update_meshes(const cs_time_step_t  *ts)
     if (active == false)
       continue;
 
-    /* Modifiable user mesh, active at this time step */
-
-    if (post_mesh->mod_flag_min == FVM_WRITER_TRANSIENT_CONNECT)
-      _redefine_mesh(post_mesh, ts);
+    /* Modifiable user mesh, active at this time step; if neither the
+       selection nor the computational mesh's connectivity may change,
+       the current definition is kept. */
+
+    if (post_mesh->mod_flag_min == FVM_WRITER_TRANSIENT_CONNECT) {
+      if (   post_mesh->time_varying
+          || post_mesh->exp_mesh == NULL
+          || post_mesh->edges_ref > -1
+          || post_mesh->ent_flag[3] != 0
+          || _cs_post_mod_flag_min == FVM_WRITER_TRANSIENT_CONNECT
+          || cs_glob_mesh->time_dep == CS_MESH_TRANSIENT_CONNECT)
+        _redefine_mesh(post_mesh, ts);
+    }
 
     else if (post_mesh->ent_flag[4] != 0) {
       bool time_varying;
@@ -2473,6 +2823,7 @@ _update_meshes(const cs_time_step_t  *ts)
           post_mesh->_exp_mesh = fvm_nodal_destroy(post_mesh->_exp_mesh);
         post_mesh->_exp_mesh = exp_mesh;
         post_mesh->exp_mesh = exp_mesh;
+        post_mesh->nt_mod = ts->nt_cur;
       }
     }
 
@@ -4116,6 +4467,8 @@ cs_f_post_write_var(int               mesh_id,
  * - \c \b EnSight \c \b Gold (\c \b EnSight also accepted)
  * - \c \b MED
  * - \c \b CGNS
+ * - \c \b HDF5 (compressed and chunked datasets, optionally split
+ *         in several subfiles)
  * - \c \b Catalyst (in-situ visualization)
  * - \c \b MEDCoupling (in-memory structure, to be used from other code)
  * - \c \b Melissa (in-situ statistics)
@@ -4151,6 +4504,21 @@ cs_f_post_write_var(int               mesh_id,
  *         pyramids), so that any post-processing tool can recognize them.
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
+ * - \c \b async to gather binary outputs on a single rank and write
+ *         them using a helper thread, so that output overlaps subsequent
+ *         computations (for \c \b EnSight).
+ * - \c \b aggregators=<n> to write distributed binary data blocks from
+ *         (at most) \c \b n aggregating ranks (for \c \b EnSight).
+ * - \c \b subfiles=<n> to write data from \c \b n aggregating ranks,
+ *         each to its own subfile (for \c \b HDF5).
+ * - \c \b deflate=<level> for the level of lossless (zlib) compression,
+ *         from 0 (none) to 9 (for \c \b HDF5).
+ * - \c \b tolerance=<value> for lossy compression of field values with
+ *         the given absolute error bound (for \c \b HDF5).
+ * - \c \b zfp to use the ZFP filter plugin for lossy compression if
+ *         available (for \c \b HDF5).
+ * - \c \b chunk_size=<n> for the number of entities per dataset chunk
+ *         (for \c \b HDF5).
  *
  * Note that the white-spaces in the beginning or in the end of the
  * character strings given as arguments here are suppressed automatically.
@@ -4296,6 +4664,7 @@ cs_post_define_writer(int                     writer_id,
   }
 
   w->writer = NULL;
+  w->reuse_meshes = false;
 
   /* If writer is the default writer, update defaults */
 
@@ -6070,6 +6439,8 @@ cs_post_write_meshes(const cs_time_step_t  *ts)
 
   int t_top_id = cs_timer_stats_switch(_post_out_stat_id);
 
+  _check_writers_mesh_reuse();
+
   /* First loop on meshes, for probes and profiles (which must not be
      "reduced" afer first output, as coordinates may be required for
      interpolation, and also and share volume or surface location meshes) */
@@ -6378,6 +6749,10 @@ cs_post_write_var(int                    mesh_id,
  * (such as interior and boundary faces when a postprocessing mesh contains
  * both) is possible, it is not handled yet, so such cases will be ignored.
  *
+ * The function is evaluated only on the elements of the post-processing
+ * mesh, and only if at least one of the selected writers is active.
+ * During a time step output, evaluations are shared between writers.
+ *
  * \param[in]  mesh_id    id of associated mesh
  * \param[in]  writer_id  id of specified associated writer,
  *                        or \ref CS_POST_WRITER_ALL_ASSOCIATED for all
@@ -6509,6 +6884,11 @@ cs_post_write_function(int                    mesh_id,
               __func__, m_name, f->name);
   }
 
+  /* Only evaluate the function if some writer will use it */
+
+  if (_post_mesh_will_output(post_mesh, writer_id, ts) == false)
+    return;
+
   cs_lnum_t n_elts = fvm_nodal_get_n_entities(post_mesh->exp_mesh, ent_dim);
 
   cs_lnum_t *elt_ids;
@@ -6521,20 +6901,17 @@ cs_post_write_function(int                    mesh_id,
   }
 
   unsigned char *_vals = NULL;
-  size_t elt_size = cs_datatype_size[f->datatype] * f->dim;
-  BFT_MALLOC(_vals, ((size_t)n_elts) * elt_size,  unsigned char);
 
-  cs_function_evaluate(f,
-                       ts,
-                       loc_type,
-                       n_elts,
-                       elt_ids,
-                       _vals);
+  var_ptr[0] = _function_values(f,
+                                ts,
+                                loc_type,
+                                post_mesh->id,
+                                n_elts,
+                                elt_ids,
+                                &_vals);
 
   BFT_FREE(elt_ids);
 
-  var_ptr[0] = _vals;
-
   const char *var_name = f->label;
   if (var_name == NULL)
     var_name = f->name;
@@ -6750,6 +7127,11 @@ cs_post_write_vertex_function(int                    mesh_id,
               __func__, m_name, f->name);
   }
 
+  /* Only evaluate the function if some writer will use it */
+
+  if (_post_mesh_will_output(post_mesh, writer_id, ts) == false)
+    return;
+
   cs_lnum_t n_elts = fvm_nodal_get_n_entities(post_mesh->exp_mesh, 0);
 
   cs_lnum_t *elt_ids;
@@ -6757,20 +7139,17 @@ cs_post_write_vertex_function(int                    mesh_id,
   fvm_nodal_get_parent_id(post_mesh->exp_mesh, 0, elt_ids);
 
   unsigned char *_vals = NULL;
-  size_t elt_size = cs_datatype_size[f->datatype] * f->dim;
-  BFT_MALLOC(_vals, ((size_t)n_elts) * elt_size,  unsigned char);
 
-  cs_function_evaluate(f,
-                       ts,
-                       CS_MESH_LOCATION_VERTICES,
-                       n_elts,
-                       elt_ids,
-                       _vals);
+  var_ptr[0] = _function_values(f,
+                                ts,
+                                CS_MESH_LOCATION_VERTICES,
+                                post_mesh->id,
+                                n_elts,
+                                elt_ids,
+                                &_vals);
 
   BFT_FREE(elt_ids);
 
-  var_ptr[0] = _vals;
-
   const char *var_name = f->label;
   if (var_name == NULL)
     var_name = f->name;
@@ -6882,6 +7261,13 @@ cs_post_write_particle_values(int                    mesh_id,
 
   assert(p_set != NULL);
 
+  /* Buffered trajectories are based on the buffer's particles */
+
+  if (post_mesh->ent_flag[3] == 2 && post_mesh->traj_p_set != NULL) {
+    p_set = post_mesh->traj_p_set;
+    n_particles = p_set->n_particles;
+  }
+
   /* Get attribute values info, returning if not present */
 
   cs_lagr_get_attr_info(p_set, 0, attr,
@@ -7157,13 +7543,16 @@ cs_post_write_probe_function(int                              mesh_id,
   cs_post_mesh_t *post_mesh = _cs_post_meshes + _mesh_id;
   cs_probe_set_t *pset = (cs_probe_set_t *)post_mesh->sel_input[4];
 
+  /* Only evaluate the function if some writer will use it */
+
+  if (_post_mesh_will_output(post_mesh, writer_id, ts) == false)
+    return;
+
   cs_coord_t *point_coords = NULL;
 
   const void *var_ptr[1] = {NULL};
   unsigned char *_vals = NULL;
 
-  cs_lnum_t _dim = f->dim;
-
   const char *var_name = f->label;
   if (var_name == NULL)
     var_name = f->name;
@@ -7198,15 +7587,17 @@ cs_post_write_probe_function(int                              mesh_id,
     if (_interpolate_func != NULL) {
       const cs_lnum_t *n_p_elts
         = cs_mesh_location_get_n_elts(parent_location_id);
-      cs_real_t *_p_vals;
-      BFT_MALLOC(_p_vals, n_p_elts[2]*_dim, cs_real_t);
 
-      cs_function_evaluate(f,
-                           ts,
-                           parent_location_id,
-                           n_p_elts[0],
-                           NULL,
-                           _p_vals);
+      /* Values on the whole location may be shared by several probe sets */
+
+      unsigned char *_p_vals = NULL;
+      const void *p_vals = _function_values(f,
+                                            ts,
+                                            parent_location_id,
+                                            0,
+                                            n_p_elts[0],
+                                            NULL,
+                                            &_p_vals);
 
       _interpolate_func(interpolate_input,
                         f->datatype,
@@ -7214,7 +7605,7 @@ cs_post_write_probe_function(int                              mesh_id,
                         n_points,
                         elt_ids,
                         (const cs_real_3_t *)point_coords,
-                        _p_vals,
+                        p_vals,
                         _vals);
 
       BFT_FREE(_p_vals);
@@ -7474,6 +7865,28 @@ cs_post_set_changing_connectivity(void)
   _cs_post_mod_flag_min = FVM_WRITER_TRANSIENT_CONNECT;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the number of output steps over which particle trajectory
+ *        segments are buffered before being written.
+ *
+ * With a value greater than 1, the particles selected for trajectory
+ * meshes are copied to a local buffer at each output step, and the
+ * matching segments are output together (as a single part) only every
+ * n_steps output steps or at the last time step, so writers do not
+ * need to gather data at other steps. Segments buffered when a
+ * computation stops before its planned last time step are not output.
+ *
+ * \param[in]  n_steps  number of buffered output steps (1 for none)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_set_trajectory_buffering(int  n_steps)
+{
+  _trajectory_buffer_steps = CS_MAX(n_steps, 1);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Initialize post-processing writers
@@ -7832,6 +8245,10 @@ cs_post_time_step_output(const cs_time_step_t  *ts)
   for (int f_id = 0; f_id < n_fields; f_id++)
     _field_sync[f_id] = 0;
 
+  /* Share function evaluations between meshes and writers */
+
+  _function_cache_active = true;
+
   /* Output of variables by registered function instances */
   /*------------------------------------------------------*/
 
@@ -8079,6 +8496,8 @@ cs_post_time_step_output(const cs_time_step_t  *ts)
   BFT_FREE(_field_sync);
   BFT_FREE(parent_ids);
 
+  _function_cache_free();
+
   cs_timer_stats_switch(t_top_id);
 }
 
@@ -233,6 +233,8 @@ typedef void
  * - \c \b EnSight \c \b Gold (\c \b EnSight also accepted)
  * - \c \b MED
  * - \c \b CGNS
+ * - \c \b HDF5 (compressed and chunked datasets, optionally split
+ *         in several subfiles)
  * - \c \b CCM (only for the full volume and boundary meshes)
  * - \c \b Catalyst (in-situ visualization)
  * - \c \b MEDCoupling (in-memory structure, to be used from other code)
@@ -266,6 +268,21 @@ typedef void
  *         pyramids), so that any post-processing tool can recognize them.
  * - \c \b separate_meshes to multiple meshes and associated fields to
  *         separate outputs.
+ * - \c \b async to gather binary outputs on a single rank and write
+ *         them using a helper thread, so that output overlaps subsequent
+ *         computations (for \c \b EnSight).
+ * - \c \b aggregators=<n> to write distributed binary data blocks from
+ *         (at most) \c \b n aggregating ranks (for \c \b EnSight).
+ * - \c \b subfiles=<n> to write data from \c \b n aggregating ranks,
+ *         each to its own subfile (for \c \b HDF5).
+ * - \c \b deflate=<level> for the level of lossless (zlib) compression,
+ *         from 0 (none) to 9 (for \c \b HDF5).
+ * - \c \b tolerance=<value> for lossy compression of field values with
+ *         the given absolute error bound (for \c \b HDF5).
+ * - \c \b zfp to use the ZFP filter plugin for lossy compression if
+ *         available (for \c \b HDF5).
+ * - \c \b chunk_size=<n> for the number of entities per dataset chunk
+ *         (for \c \b HDF5).
  *
  * Note that the white-spaces in the beginning or in the end of the
  * character strings given as arguments here are suppressed automatically.
@@ -1185,6 +1202,10 @@ cs_post_write_var(int                    mesh_id,
  * (such as interior and boundary faces when a postprocessing mesh contains
  * both) is possible, it is not handled yet, so such cases will be ignored.
  *
+ * The function is evaluated only on the elements of the post-processing
+ * mesh, and only if at least one of the selected writers is active.
+ * During a time step output, evaluations are shared between writers.
+ *
  * \param[in]  mesh_id    id of associated mesh
  * \param[in]  writer_id  id of specified associated writer,
  *                        or \ref CS_POST_WRITER_ALL_ASSOCIATED for all
@@ -1414,6 +1435,25 @@ cs_post_renum_faces(const cs_lnum_t  init_i_face_num[],
 void
 cs_post_set_changing_connectivity(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the number of output steps over which particle trajectory
+ *        segments are buffered before being written.
+ *
+ * With a value greater than 1, the particles selected for trajectory
+ * meshes are copied to a local buffer at each output step, and the
+ * matching segments are output together (as a single part) only every
+ * n_steps output steps or at the last time step, so writers do not
+ * need to gather data at other steps. Segments buffered when a
+ * computation stops before its planned last time step are not output.
+ *
+ * \param[in]  n_steps  number of buffered output steps (1 for none)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_post_set_trajectory_buffering(int  n_steps);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Initialize post-processing writers
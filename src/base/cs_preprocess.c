@@ -54,7 +54,9 @@
 #include "cs_log.h"
 #include "cs_map.h"
 #include "cs_mesh.h"
+#include "cs_mesh_cache.h"
 #include "cs_mesh_cartesian.h"
+#include "cs_mesh_element_blocks.h"
 #include "cs_mesh_from_builder.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
@@ -145,6 +147,129 @@ extern void cs_f_majgeo(const cs_lnum_t    *ncel,
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Read Preprocessor output and apply mesh modification, partitioning,
+ * and renumbering operations.
+ *
+ * parameters:
+ *   m            <-> pointer to mesh structure
+ *   mq           <-> pointer to mesh quantities structure
+ *   halo_type    <-- type of halo (standard or extended)
+ *   allow_modify <-- allow mesh modifications
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_mesh(cs_mesh_t             *m,
+            cs_mesh_quantities_t  *mq,
+            cs_halo_type_t         halo_type,
+            bool                   allow_modify)
+{
+  double  t1, t2;
+
+  /* Read Preprocessor output */
+
+  cs_preprocessor_data_read_mesh(m,
+                                 cs_glob_mesh_builder,
+                                 false);
+
+  if (allow_modify) {
+
+    /* Join meshes / build periodicity links if necessary */
+
+    cs_join_all(true);
+
+    /* Insert boundaries if necessary */
+
+    cs_gui_mesh_boundary(m);
+    cs_user_mesh_boundary(m);
+
+    cs_internal_coupling_preprocess(m);
+
+  }
+
+  /* Initialize extended connectivity, ghost cells and other remaining
+     parallelism-related structures */
+
+  cs_mesh_init_halo(m, cs_glob_mesh_builder, halo_type, m->verbosity, true);
+  cs_mesh_update_auxiliary(m);
+
+  if (allow_modify) {
+
+    /* Possible geometry modification */
+
+    cs_gui_mesh_extrude(m);
+    cs_user_mesh_modify(m);
+
+    /* Discard isolated faces if present */
+
+    cs_post_add_free_faces();
+    cs_mesh_discard_free_faces(m);
+
+    /* Smoothe mesh if required */
+
+    cs_gui_mesh_smoothe(m);
+    cs_user_mesh_smoothe(m);
+
+    /* Triangulate warped faces if necessary */
+
+    {
+      double  cwf_threshold = -1.0;
+      int  cwf_post = 0;
+
+      cs_mesh_warping_get_defaults(&cwf_threshold, &cwf_post);
+
+      if (cwf_threshold >= 0.0) {
+
+        t1 = cs_timer_wtime();
+        cs_mesh_warping_cut_faces(m, cwf_threshold, cwf_post);
+        t2 = cs_timer_wtime();
+
+        bft_printf(_("\n Cutting warped boundary faces (%.3g s)\n"), t2-t1);
+
+      }
+    }
+
+    /* Now that mesh modification is finished, save mesh if modified */
+
+    cs_gui_mesh_save_if_modified(m);
+    cs_user_mesh_save(m); /* Disable or force */
+  }
+
+  bool need_partition = cs_partition_get_preprocess();
+  if (m->modified & CS_MESH_MODIFIED_BALANCE)
+    need_partition = true;
+
+  bool need_save = false;
+  if (   (m->modified > 0 && m->save_if_modified > 0)
+      || m->save_if_modified > 1)
+    need_save = true;
+
+  if (need_partition) {
+    cs_mesh_quantities_free_all(mq);
+
+    if (need_save) {
+      cs_mesh_save(m, cs_glob_mesh_builder, NULL, "mesh_output.csm");
+      need_save = false;
+    }
+    else
+      cs_mesh_to_builder(m, cs_glob_mesh_builder, true, NULL);
+
+    cs_partition(m, cs_glob_mesh_builder, CS_PARTITION_MAIN);
+    cs_mesh_from_builder(m, cs_glob_mesh_builder);
+    cs_mesh_init_halo(m, cs_glob_mesh_builder, halo_type, m->verbosity, true);
+    cs_mesh_update_auxiliary(m);
+  }
+
+  else if (need_save)
+    cs_mesh_save(m, NULL, NULL, "mesh_output.csm");
+
+  /* Renumber mesh based on code options */
+
+  cs_user_numbering();
+
+  cs_renumber_mesh(m);
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -244,103 +369,18 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
     cs_user_partition();
   }
 
-  /* Read Preprocessor output */
-
-  cs_preprocessor_data_read_mesh(m,
-                                 cs_glob_mesh_builder,
-                                 false);
-
-  if (allow_modify) {
-
-    /* Join meshes / build periodicity links if necessary */
-
-    cs_join_all(true);
-
-    /* Insert boundaries if necessary */
-
-    cs_gui_mesh_boundary(m);
-    cs_user_mesh_boundary(m);
-
-    cs_internal_coupling_preprocess(m);
-
-  }
-
-  /* Initialize extended connectivity, ghost cells and other remaining
-     parallelism-related structures */
-
-  cs_mesh_init_halo(m, cs_glob_mesh_builder, halo_type, m->verbosity, true);
-  cs_mesh_update_auxiliary(m);
-
-  if (allow_modify) {
-
-    /* Possible geometry modification */
-
-    cs_gui_mesh_extrude(m);
-    cs_user_mesh_modify(m);
-
-    /* Discard isolated faces if present */
-
-    cs_post_add_free_faces();
-    cs_mesh_discard_free_faces(m);
-
-    /* Smoothe mesh if required */
-
-    cs_gui_mesh_smoothe(m);
-    cs_user_mesh_smoothe(m);
-
-    /* Triangulate warped faces if necessary */
-
-    {
-      double  cwf_threshold = -1.0;
-      int  cwf_post = 0;
-
-      cs_mesh_warping_get_defaults(&cwf_threshold, &cwf_post);
-
-      if (cwf_threshold >= 0.0) {
-
-        t1 = cs_timer_wtime();
-        cs_mesh_warping_cut_faces(m, cwf_threshold, cwf_post);
-        t2 = cs_timer_wtime();
-
-        bft_printf(_("\n Cutting warped boundary faces (%.3g s)\n"), t2-t1);
-
-      }
-    }
-
-    /* Now that mesh modification is finished, save mesh if modified */
-
-    cs_gui_mesh_save_if_modified(m);
-    cs_user_mesh_save(m); /* Disable or force */
-  }
-
-  bool need_partition = cs_partition_get_preprocess();
-  if (m->modified & CS_MESH_MODIFIED_BALANCE)
-    need_partition = true;
-
-  bool need_save = false;
-  if (   (m->modified > 0 && m->save_if_modified > 0)
-      || m->save_if_modified > 1)
-    need_save = true;
-
-  if (need_partition) {
-    cs_mesh_quantities_free_all(mq);
+  /* Read Preprocessor output and apply preprocessing operations,
+     unless the resulting mesh may be loaded from the partitioned
+     mesh cache */
 
-    if (need_save) {
-      cs_mesh_save(m, cs_glob_mesh_builder, NULL, "mesh_output.csm");
-      need_save = false;
-    }
-    else
-      cs_mesh_to_builder(m, cs_glob_mesh_builder, true, NULL);
+  if (cs_mesh_cache_read(m, cs_glob_mesh_builder, halo_type))
+    cs_preprocessor_data_discard();
 
-    cs_partition(m, cs_glob_mesh_builder, CS_PARTITION_MAIN);
-    cs_mesh_from_builder(m, cs_glob_mesh_builder);
-    cs_mesh_init_halo(m, cs_glob_mesh_builder, halo_type, m->verbosity, true);
-    cs_mesh_update_auxiliary(m);
+  else {
+    _build_mesh(m, mq, halo_type, allow_modify);
+    cs_mesh_cache_write(m);
   }
 
-  else if (need_save)
-    cs_mesh_save(m, NULL, NULL, "mesh_output.csm");
-
   m->n_b_faces_all = m->n_b_faces;
   m->n_g_b_faces_all = m->n_g_b_faces;
 
@@ -351,11 +391,8 @@ cs_preprocess_mesh(cs_halo_type_t   halo_type)
   /* Destroy cartesian mesh builder if necessary */
   cs_mesh_cartesian_params_destroy();
 
-  /* Renumber mesh based on code options */
-
-  cs_user_numbering();
-
-  cs_renumber_mesh(m);
+  /* Destroy element block definitions if necessary */
+  cs_mesh_element_blocks_destroy();
 
   /* Initialize group classes */
 
@@ -577,6 +614,22 @@ cs_preprocess_mesh_update_device()
     }
   }
 
+  /* Face -> vertices connectivity (used by vertex-based gradients) */
+
+  {
+    CS_REALLOC_HD(m->i_face_vtx_idx, n_i_faces+1, cs_lnum_t, alloc_mode);
+    CS_REALLOC_HD(m->i_face_vtx_lst, m->i_face_vtx_idx[n_i_faces], cs_lnum_t,
+                  alloc_mode);
+    cs_mem_advise_set_read_mostly(m->i_face_vtx_idx);
+    cs_mem_advise_set_read_mostly(m->i_face_vtx_lst);
+
+    CS_REALLOC_HD(m->b_face_vtx_idx, n_b_faces+1, cs_lnum_t, alloc_mode);
+    CS_REALLOC_HD(m->b_face_vtx_lst, m->b_face_vtx_idx[n_b_faces], cs_lnum_t,
+                  alloc_mode);
+    cs_mem_advise_set_read_mostly(m->b_face_vtx_idx);
+    cs_mem_advise_set_read_mostly(m->b_face_vtx_lst);
+  }
+
   if (m->cell_cells_idx != NULL) {
     CS_REALLOC_HD(m->cell_cells_idx, n_cells+1, cs_lnum_t, alloc_mode);
     cs_mem_advise_set_read_mostly(m->cell_cells_idx);
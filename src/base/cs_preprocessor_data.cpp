@@ -57,6 +57,7 @@
 #include "cs_interface.h"
 #include "cs_mesh.h"
 #include "cs_mesh_cartesian.h"
+#include "cs_mesh_element_blocks.h"
 #include "cs_mesh_from_builder.h"
 #include "cs_mesh_group.h"
 #include "cs_parall.h"
@@ -177,6 +178,62 @@ _align_size(size_t  min_size)
   return (min_size + (align-1) - ((min_size - 1) % align));
 }
 
+/*----------------------------------------------------------------------------
+ * Update a checksum with a given set of bytes (64-bit FNV-1a hash).
+ *
+ * parameters:
+ *   h      <-> checksum
+ *   p      <-- pointer to bytes
+ *   n      <-- number of bytes
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_checksum_add(uint64_t    *h,
+              const void  *p,
+              size_t       n)
+{
+  const unsigned char *b = static_cast<const unsigned char *>(p);
+  uint64_t _h = *h;
+  for (size_t i = 0; i < n; i++) {
+    _h ^= b[i];
+    _h *= 1099511628211ULL;
+  }
+  *h = _h;
+}
+
+/*----------------------------------------------------------------------------
+ * Update a checksum with the contents of a file.
+ *
+ * parameters:
+ *   h         <-> checksum
+ *   file_name <-- name of file
+ *----------------------------------------------------------------------------*/
+
+static void
+_checksum_add_file(uint64_t    *h,
+                   const char  *file_name)
+{
+  FILE *f = fopen(file_name, "rb");
+
+  if (f == nullptr) {
+    _checksum_add(h, file_name, strlen(file_name));
+    return;
+  }
+
+  const size_t block_size = 1 << 20;
+  unsigned char *buffer;
+  BFT_MALLOC(buffer, block_size, unsigned char);
+
+  size_t n = 0;
+  do {
+    n = fread(buffer, 1, block_size, f);
+    _checksum_add(h, buffer, n);
+  } while (n == block_size);
+
+  BFT_FREE(buffer);
+  fclose(f);
+}
+
 /*----------------------------------------------------------------------------
  * Check which inputs are present
  *
@@ -285,7 +342,8 @@ _set_default_input_if_needed(void)
   }
 
   if (   _n_mesh_files == 0
-      && cs_mesh_cartesian_need_build() == 0)
+      && cs_mesh_cartesian_need_build() == 0
+      && cs_mesh_element_blocks_need_build() == 0)
     bft_error(__FILE__, __LINE__, 0,
               _("No \"%s\" file or directory found."), _input_default);
 }
@@ -2395,9 +2453,15 @@ cs_preprocessor_data_read_headers(cs_mesh_t          *mesh,
 
   /* Initialize reading of Preprocessor output */
 
-  if (   _n_mesh_files == 0 && cs_mesh_cartesian_need_build()
+  if (   _n_mesh_files == 0 && cs_mesh_element_blocks_need_build()
       && !(ignore_cartesian)) {
 
+    cs_mesh_element_blocks_build_faces(mesh, mesh_builder);
+
+  }
+  else if (   _n_mesh_files == 0 && cs_mesh_cartesian_need_build()
+           && !(ignore_cartesian)) {
+
     int _n_cartesian_meshes = cs_mesh_cartesian_get_number_of_meshes();
     for (int m_id = 0; m_id < _n_cartesian_meshes; m_id++)
       _read_cartesian_dimensions(m_id, mesh, mesh_builder);
@@ -2508,7 +2572,12 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
   else
     _set_block_ranges(mesh, mesh_builder);
 
-  if (cs_mesh_cartesian_need_build() && !(ignore_cartesian) ) {
+  if (mr == nullptr && cs_mesh_element_blocks_need_build()
+      && !(ignore_cartesian)) {
+    cs_mesh_element_blocks_to_builder(mesh, mesh_builder);
+    mesh->modified |= CS_MESH_MODIFIED;
+  }
+  else if (cs_mesh_cartesian_need_build() && !(ignore_cartesian) ) {
     for (int m_id = 0; m_id < cs_mesh_cartesian_get_number_of_meshes(); m_id++)
       cs_mesh_cartesian_block_connectivity(m_id, mesh, mesh_builder, echo);
     mesh->modified |= CS_MESH_MODIFIED;
@@ -2544,6 +2613,75 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
   cs_mesh_clean_families(mesh);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute a checksum of mesh input read by cs_preprocessor_data_read_headers.
+ *
+ * The checksum is based on the contents of each mesh input file and
+ * on the associated coordinate transformation and group renaming options.
+ * Files are read on rank 0 only and the result is broadcast.
+ *
+ * This is a collective operation.
+ *
+ * returns:
+ *   checksum of mesh input, or 0 if no mesh input file is used
+ *   (for internally generated meshes)
+ *----------------------------------------------------------------------------*/
+
+uint64_t
+cs_preprocessor_data_input_checksum(void)
+{
+  const _mesh_reader_t *mr = _cs_glob_mesh_reader;
+
+  if (mr == nullptr)
+    return 0;
+
+  uint64_t h = 14695981039346656037ULL;
+
+  if (cs_glob_rank_id < 1) {
+
+    for (int i = 0; i < mr->n_files; i++) {
+      const _mesh_file_info_t *f = mr->file_info + i;
+
+      _checksum_add_file(&h, f->filename);
+      _checksum_add(&h, &(f->offset), sizeof(cs_file_off_t));
+      if (f->matrix != nullptr)
+        _checksum_add(&h, f->matrix, 12*sizeof(double));
+      for (size_t j = 0; j < f->n_group_renames; j++) {
+        _checksum_add(&h, f->old_group_names[j],
+                      strlen(f->old_group_names[j]) + 1);
+        if (f->new_group_names[j] != nullptr)
+          _checksum_add(&h, f->new_group_names[j],
+                        strlen(f->new_group_names[j]) + 1);
+      }
+    }
+
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    unsigned long long _h = h;
+    MPI_Bcast(&_h, 1, MPI_UNSIGNED_LONG_LONG, 0, cs_glob_mpi_comm);
+    h = _h;
+  }
+#endif
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Discard mesh input read by cs_preprocessor_data_read_headers.
+ *
+ * This is used when the mesh is obtained by other means once headers have
+ * been read, so that cs_preprocessor_data_read_mesh is not called.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_discard(void)
+{
+  if (_cs_glob_mesh_reader != nullptr)
+    _mesh_reader_destroy(&_cs_glob_mesh_reader);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
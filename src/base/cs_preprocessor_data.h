@@ -180,6 +180,33 @@ cs_preprocessor_data_read_mesh(cs_mesh_t          *mesh,
                                cs_mesh_builder_t  *mesh_builder,
                                bool                ignore_cartesian);
 
+/*----------------------------------------------------------------------------
+ * Compute a checksum of mesh input read by cs_preprocessor_data_read_headers.
+ *
+ * The checksum is based on the contents of each mesh input file and
+ * on the associated coordinate transformation and group renaming options.
+ * Files are read on rank 0 only and the result is broadcast.
+ *
+ * This is a collective operation.
+ *
+ * returns:
+ *   checksum of mesh input, or 0 if no mesh input file is used
+ *   (for internally generated meshes)
+ *----------------------------------------------------------------------------*/
+
+uint64_t
+cs_preprocessor_data_input_checksum(void);
+
+/*----------------------------------------------------------------------------
+ * Discard mesh input read by cs_preprocessor_data_read_headers.
+ *
+ * This is used when the mesh is obtained by other means once headers have
+ * been read, so that cs_preprocessor_data_read_mesh is not called.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_preprocessor_data_discard(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
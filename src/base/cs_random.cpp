@@ -171,6 +171,39 @@ _normal00(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Philox-4x32-10 counter-based block generator.
+ *
+ * Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC'11.
+ *
+ * \param[in]       key  2x32-bit key
+ * \param[in, out]  c    4x32-bit counter in, random block out
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_philox4x32_10(const uint32_t  key[2],
+               uint32_t        c[4])
+{
+  const uint64_t m0 = 0xD2511F53, m1 = 0xCD9E8D57;
+  const uint32_t w0 = 0x9E3779B9, w1 = 0xBB67AE85;
+
+  uint32_t k0 = key[0], k1 = key[1];
+
+  for (int r = 0; r < 10; r++) {
+    uint64_t p0 = m0 * c[0];
+    uint64_t p1 = m1 * c[2];
+    uint32_t n[4] = {(uint32_t)(p1 >> 32) ^ c[1] ^ k0,
+                     (uint32_t)p1,
+                     (uint32_t)(p0 >> 32) ^ c[3] ^ k1,
+                     (uint32_t)p0};
+    c[0] = n[0]; c[1] = n[1]; c[2] = n[2]; c[3] = n[3];
+    k0 += w0;
+    k1 += w1;
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -525,6 +558,44 @@ cs_random_poisson(cs_lnum_t  n,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based uniform distribution random number generator.
+ *
+ * Values are based on the Philox-4x32-10 generator, and depend only on
+ * the given key and counter, not on any global state, so this function
+ * may be called concurrently from multiple threads, and values associated
+ * with a given (key, counter) pair (such as an entity's global number)
+ * are independent of the calling order.
+ *
+ * \param[in]   key      generator key (stream selection)
+ * \param[in]   counter  counter (item selection)
+ * \param[in]   n        number of values to compute
+ * \param[out]  a        pseudo-random numbers following uniform
+ *                       distribution in ]0, 1[
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_uniform(uint64_t   key,
+                          uint64_t   counter,
+                          cs_lnum_t  n,
+                          cs_real_t  a[])
+{
+  const double scale = 1. / 4294967296.;
+
+  const uint32_t k[2] = {(uint32_t)key, (uint32_t)(key >> 32)};
+
+  for (cs_lnum_t s_id = 0; s_id < n; s_id += 4) {
+    uint32_t c[4] = {(uint32_t)counter, (uint32_t)(counter >> 32),
+                     (uint32_t)(s_id / 4), 0};
+    _philox4x32_10(k, c);
+    cs_lnum_t e_id = CS_MIN(s_id + 4, n);
+    for (cs_lnum_t i = s_id; i < e_id; i++)
+      a[i] = ((double)c[i - s_id] + 0.5) * scale;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Save static variables used by random number generator.
@@ -120,6 +120,30 @@ cs_random_poisson(cs_lnum_t  n,
                   cs_real_t  mu,
                   int        p[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Counter-based uniform distribution random number generator.
+ *
+ * Values are based on the Philox-4x32-10 generator, and depend only on
+ * the given key and counter, not on any global state, so this function
+ * may be called concurrently from multiple threads, and values associated
+ * with a given (key, counter) pair (such as an entity's global number)
+ * are independent of the calling order.
+ *
+ * \param[in]   key      generator key (stream selection)
+ * \param[in]   counter  counter (item selection)
+ * \param[in]   n        number of values to compute
+ * \param[out]  a        pseudo-random numbers following uniform
+ *                       distribution in ]0, 1[
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_random_counter_uniform(uint64_t   key,
+                          uint64_t   counter,
+                          cs_lnum_t  n,
+                          cs_real_t  a[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Save static variables used by random number generator.
@@ -137,6 +137,10 @@ BEGIN_C_DECLS
        Order cells using domain-local Hilbert space-filling curve.
   \var CS_RENUMBER_CELLS_RCM
        Order cells using domain-local reverse Cuthill-McKee algorithm.
+  \var CS_RENUMBER_CELLS_HILBERT_BLOCK
+       Order cells using domain-local Hilbert space-filling curve, then
+       sort cells inside device warp-sized blocks by lowest adjacent cell.
+       This is intended to be used with \ref CS_RENUMBER_I_FACES_DEVICE.
   \var CS_RENUMBER_CELLS_NONE
        No cells renumbering.
 
@@ -155,6 +159,10 @@ BEGIN_C_DECLS
   \var CS_RENUMBER_I_FACES_SIMD
        Renumber to allow SIMD operations in interior face->cell gather
        operations (such as SpMV products with native matrix representation).
+  \var CS_RENUMBER_I_FACES_DEVICE
+       Color faces so that no cell is shared inside a color, ordering
+       faces by adjacent cells inside each color so that consecutive
+       device threads access consecutive cells.
   \var CS_RENUMBER_I_FACES_NONE
        No interior face renumbering.
 
@@ -203,6 +211,9 @@ BEGIN_C_DECLS
 
 #define CS_RENUMBER_N_SUBS  5  /* Number of categories for histograms */
 
+#define CS_RENUMBER_DEVICE_BLOCK_SIZE  32  /* Device warp size */
+#define CS_RENUMBER_CACHE_LINE_SIZE    64  /* Cache line size, in bytes */
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -220,7 +231,7 @@ static cs_lnum_t  _min_b_subset_size = 256;
 
 static bool _renumber_ghost_cells = true;
 static bool _cells_adjacent_to_halo_last = false;
-static bool _i_faces_adjacent_to_halo_last = false;
+static bool _i_faces_adjacent_to_halo_last = true;
 static cs_renumber_ordering_t _i_faces_base_ordering = CS_RENUMBER_ADJACENT_LOW;
 
 static cs_renumber_cells_type_t _cells_algorithm[] = {CS_RENUMBER_CELLS_NONE,
@@ -254,12 +265,14 @@ static const char *_cell_renum_name[]
      N_("Morton curve in local bounding box"),
      N_("Hilbert curve in local bounding box"),
      N_("Reverse Cuthill-McKee"),
+     N_("Hilbert curve with device warp-sized blocks"),
      N_("no renumbering")};
 
 static const char *_i_face_renum_name[]
   = {N_("coloring, no shared cell in block"),
      N_("multipass"),
      N_("vectorizing"),
+     N_("device coalescing, colored"),
      N_("adjacent cells")};
 
 static const char *_b_face_renum_name[]
@@ -1408,7 +1421,7 @@ _order_i_faces_by_cell_adjacency(const cs_mesh_t         *mesh,
         cs_lnum_t c_id_1 = i_face_cells[f_id][1];
         if (c_id_0 >= n_cells)
           faces_keys[f_id*3] = halo_class[c_id_0 - n_cells];
-        else if (c_id_1 > n_cells)
+        else if (c_id_1 >= n_cells)
           faces_keys[f_id*3] = halo_class[c_id_1 - n_cells];
         else {
           faces_keys[f_id*3] = 0;
@@ -2588,6 +2601,143 @@ _renum_i_faces_no_share_cell_in_block(cs_mesh_t    *mesh,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute renumbering of interior faces for device (GPU) oriented execution.
+ *
+ * Starting from a lexicographical ordering by adjacent cells, faces are
+ * colored greedily so that no two faces of a given color share a cell,
+ * then ordered by color. Inside each color, the lexicographical order is
+ * kept, so consecutive threads touch consecutive cells, and the scatter
+ * of face contributions to cells is conflict-free.
+ *
+ * When faces adjacent to ghost cells should be placed last, they are
+ * colored separately, using colors following those of other faces.
+ *
+ * Each color defines a group; faces of a group are distributed between
+ * threads, as they are all independent.
+ *
+ * parameters:
+ *   mesh           <-> pointer to global mesh structure
+ *   n_i_threads    <-- number of threads required for interior faces
+ *   new_to_old_i   --> interior faces renumbering array
+ *   n_i_groups     --> number of groups of interior faces
+ *   i_group_index  --> group/thread index
+ *
+ * returns:
+ *   0 on success, -1 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_renum_i_faces_for_device(cs_mesh_t    *mesh,
+                          int           n_i_threads,
+                          cs_lnum_t     new_to_old_i[],
+                          int          *n_i_groups,
+                          cs_lnum_t   **i_group_index)
+{
+  const int n_colors_max = 64;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)mesh->i_face_cells;
+
+  int n_colors = 0;
+  int retval = 0;
+
+  uint64_t *cell_colors;
+  int *f_color;
+  BFT_MALLOC(cell_colors, mesh->n_cells_with_ghosts, uint64_t);
+  BFT_MALLOC(f_color, n_i_faces, int);
+
+  for (cs_lnum_t i = 0; i < mesh->n_cells_with_ghosts; i++)
+    cell_colors[i] = 0;
+
+  const bool halo_last = (   mesh->halo != nullptr
+                          && _i_faces_adjacent_to_halo_last);
+  const int n_passes = (halo_last) ? 2 : 1;
+
+  /* Greedy coloring, in current (lexicographical) order */
+
+  for (int pass = 0; pass < n_passes && retval == 0; pass++) {
+
+    int color_shift = n_colors;
+
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+
+      cs_lnum_t c_id_0 = i_face_cells[f_id][0];
+      cs_lnum_t c_id_1 = i_face_cells[f_id][1];
+
+      if (halo_last) {
+        bool adj_halo = (c_id_0 >= n_cells || c_id_1 >= n_cells);
+        if (adj_halo != (pass == 1))
+          continue;
+      }
+
+      uint64_t used = cell_colors[c_id_0] | cell_colors[c_id_1];
+      int c = color_shift;
+      while (c < n_colors_max && (used & ((uint64_t)1 << c)))
+        c++;
+
+      if (c >= n_colors_max) {
+        retval = -1;
+        break;
+      }
+
+      f_color[f_id] = c;
+      cell_colors[c_id_0] |= ((uint64_t)1 << c);
+      cell_colors[c_id_1] |= ((uint64_t)1 << c);
+      if (c >= n_colors)
+        n_colors = c + 1;
+
+    }
+
+  }
+
+  BFT_FREE(cell_colors);
+
+  if (retval != 0) {
+    BFT_FREE(f_color);
+    return retval;
+  }
+
+  /* Order faces by color, keeping prior order inside each color */
+
+  cs_lnum_t *group_size, *color_shift;
+  BFT_MALLOC(group_size, n_colors, cs_lnum_t);
+  BFT_MALLOC(color_shift, n_colors, cs_lnum_t);
+
+  for (int c = 0; c < n_colors; c++)
+    group_size[c] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++)
+    group_size[f_color[f_id]] += 1;
+
+  color_shift[0] = 0;
+  for (int c = 1; c < n_colors; c++)
+    color_shift[c] = color_shift[c-1] + group_size[c-1];
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++)
+    new_to_old_i[color_shift[f_color[f_id]]++] = f_id;
+
+  BFT_FREE(color_shift);
+  BFT_FREE(f_color);
+
+  *n_i_groups = n_colors;
+
+  BFT_MALLOC(*i_group_index, n_i_threads*n_colors*2, cs_lnum_t);
+
+  retval = _thread_bounds_by_group_size(n_i_faces,
+                                        n_colors,
+                                        n_i_threads,
+                                        group_size,
+                                        *i_group_index);
+
+  BFT_FREE(group_size);
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Compute renumbering of boundary faces for threads.
  *
@@ -3176,6 +3326,64 @@ _log_bandwidth_info(const cs_mesh_t  *mesh,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Log predicted cache line reuse for interior faces.
+ *
+ * Consecutive faces are assumed to be handled by consecutive threads of
+ * a device warp; for each warp, the number of distinct cache lines of
+ * a cell-based real array accessed through the face -> cells adjacency
+ * is counted. The reuse factor is the ratio of the number of accesses
+ * to the number of distinct cache lines.
+ *
+ * parameters:
+ *   mesh      <-- associated mesh
+ *----------------------------------------------------------------------------*/
+
+static void
+_log_i_faces_cache_reuse(const cs_mesh_t  *mesh)
+{
+  const cs_lnum_t warp_size = CS_RENUMBER_DEVICE_BLOCK_SIZE;
+  const cs_lnum_t line_size = CS_RENUMBER_CACHE_LINE_SIZE / sizeof(cs_real_t);
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)mesh->i_face_cells;
+
+  cs_lnum_t w_lines[2*CS_RENUMBER_DEVICE_BLOCK_SIZE];
+
+  cs_gnum_t counts[3] = {0, 0, 0}; /* warps, accesses, distinct lines */
+
+  for (cs_lnum_t s_id = 0; s_id < mesh->n_i_faces; s_id += warp_size) {
+    cs_lnum_t e_id = CS_MIN(s_id + warp_size, mesh->n_i_faces);
+    cs_lnum_t n = 0;
+    for (cs_lnum_t f_id = s_id; f_id < e_id; f_id++) {
+      w_lines[n++] = i_face_cells[f_id][0] / line_size;
+      w_lines[n++] = i_face_cells[f_id][1] / line_size;
+    }
+    cs_sort_lnum(w_lines, n);
+    cs_lnum_t n_distinct = 1;
+    for (cs_lnum_t i = 1; i < n; i++) {
+      if (w_lines[i] != w_lines[i-1])
+        n_distinct++;
+    }
+    counts[0] += 1;
+    counts[1] += n;
+    counts[2] += n_distinct;
+  }
+
+  cs_parall_counter(counts, 3);
+
+  if (counts[0] > 0)
+    bft_printf
+      (_("\n"
+         " Interior faces predicted cache line reuse\n"
+         "   (warps of %d faces, %d bytes per cache line):\n"
+         "     mean cache lines per warp:           %.2f\n"
+         "     mean accesses per cache line:        %.2f\n"),
+       (int)warp_size, (int)CS_RENUMBER_CACHE_LINE_SIZE,
+       (double)counts[2] / (double)counts[0],
+       (double)counts[1] / (double)counts[2]);
+}
+
 /*----------------------------------------------------------------------------
  * Compute local cell centers.
  *
@@ -3508,6 +3716,80 @@ _renum_cells_hilbert(const cs_mesh_t  *mesh,
   BFT_FREE(cell_center);
 }
 
+/*----------------------------------------------------------------------------
+ * Determine the cell renumbering array for device (GPU) oriented execution.
+ *
+ * Cells are first ordered along a Hilbert curve, then split into blocks
+ * matching the device warp (or wavefront) size. Inside each block, cells
+ * are sorted by their lowest adjacent cell id, so that consecutive threads
+ * of a given warp gather neighbor values in increasing address order.
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   new_to_old  --> new to old cell renumbering
+ *----------------------------------------------------------------------------*/
+
+static void
+_renum_cells_hilbert_block(const cs_mesh_t  *mesh,
+                           cs_lnum_t         new_to_old[])
+{
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t block_size = CS_RENUMBER_DEVICE_BLOCK_SIZE;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)mesh->i_face_cells;
+
+  _renum_cells_hilbert(mesh, new_to_old);
+
+  cs_lnum_t *old_to_new, *min_adj;
+  BFT_MALLOC(old_to_new, n_cells_ext, cs_lnum_t);
+  BFT_MALLOC(min_adj, n_cells, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    old_to_new[new_to_old[i]] = i;
+    min_adj[i] = n_cells_ext;
+  }
+  for (cs_lnum_t i = n_cells; i < n_cells_ext; i++)
+    old_to_new[i] = i;
+
+  for (cs_lnum_t f_id = 0; f_id < mesh->n_i_faces; f_id++) {
+    cs_lnum_t c_id_0 = old_to_new[i_face_cells[f_id][0]];
+    cs_lnum_t c_id_1 = old_to_new[i_face_cells[f_id][1]];
+    if (c_id_0 < n_cells && c_id_1 < min_adj[c_id_0])
+      min_adj[c_id_0] = c_id_1;
+    if (c_id_1 < n_cells && c_id_0 < min_adj[c_id_1])
+      min_adj[c_id_1] = c_id_0;
+  }
+
+  BFT_FREE(old_to_new);
+
+  /* Insertion sort inside each block (stable, so that Hilbert order
+     is kept for cells with identical keys) */
+
+  cs_lnum_t b_new_to_old[CS_RENUMBER_DEVICE_BLOCK_SIZE];
+  cs_lnum_t b_key[CS_RENUMBER_DEVICE_BLOCK_SIZE];
+
+  for (cs_lnum_t s_id = 0; s_id < n_cells; s_id += block_size) {
+    cs_lnum_t n = CS_MIN(block_size, n_cells - s_id);
+    for (cs_lnum_t i = 0; i < n; i++) {
+      cs_lnum_t key = min_adj[s_id + i];
+      cs_lnum_t j = i;
+      while (j > 0 && b_key[j-1] > key) {
+        b_key[j] = b_key[j-1];
+        b_new_to_old[j] = b_new_to_old[j-1];
+        j--;
+      }
+      b_key[j] = key;
+      b_new_to_old[j] = new_to_old[s_id + i];
+    }
+    for (cs_lnum_t i = 0; i < n; i++)
+      new_to_old[s_id + i] = b_new_to_old[i];
+  }
+
+  BFT_FREE(min_adj);
+}
+
 #if defined(HAVE_METIS) || defined(HAVE_PARMETIS)
 
 /*----------------------------------------------------------------------------
@@ -4551,6 +4833,10 @@ _cells_locality_renumbering(cs_mesh_t                 *mesh,
     _renum_cells_rcm(mesh, new_to_old_c);
     break;
 
+  case CS_RENUMBER_CELLS_HILBERT_BLOCK:
+    _renum_cells_hilbert_block(mesh, new_to_old_c);
+    break;
+
   case CS_RENUMBER_CELLS_NONE:
     retval = 1;
     break;
@@ -4925,6 +5211,82 @@ _renumber_cells(cs_mesh_t  *mesh)
   BFT_FREE(new_to_old_c);
 }
 
+/*----------------------------------------------------------------------------
+ * Determine the leading interior faces (or face groups) not adjacent
+ * to ghost cells, for computation/communication overlap.
+ *
+ * Faces (or groups) counted here may be processed before halo
+ * synchronization of cell values is complete.
+ *
+ * parameters:
+ *   mesh      <-- pointer to global mesh structure
+ *   numbering <-> pointer to interior faces numbering
+ *----------------------------------------------------------------------------*/
+
+static void
+_i_faces_update_no_adj_halo(const cs_mesh_t  *mesh,
+                            cs_numbering_t   *numbering)
+{
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_i_faces = mesh->n_i_faces;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)mesh->i_face_cells;
+
+  if (mesh->halo == nullptr) {
+    numbering->n_no_adj_halo_groups = numbering->n_groups;
+    numbering->n_no_adj_halo_elts = n_i_faces;
+    return;
+  }
+
+  /* Leading faces, in id order */
+
+  cs_lnum_t n_no_adj_halo_elts = n_i_faces;
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (   i_face_cells[f_id][0] >= n_cells
+        || i_face_cells[f_id][1] >= n_cells) {
+      n_no_adj_halo_elts = f_id;
+      break;
+    }
+  }
+
+  /* Keep vector blocks complete */
+
+  if (numbering->type == CS_NUMBERING_VECTORIZE) {
+    cs_lnum_t v_size = numbering->vector_size;
+    n_no_adj_halo_elts = (n_no_adj_halo_elts / v_size) * v_size;
+  }
+
+  numbering->n_no_adj_halo_elts = n_no_adj_halo_elts;
+
+  /* Leading groups, for all threads */
+
+  const int n_threads = numbering->n_threads;
+  const int n_groups = numbering->n_groups;
+  const cs_lnum_t *group_index = numbering->group_index;
+
+  int n_no_adj_halo_groups = 0;
+
+  for (int g_id = 0; g_id < n_groups; g_id++) {
+    bool adj_halo = false;
+    for (int t_id = 0; t_id < n_threads && !adj_halo; t_id++) {
+      cs_lnum_t s_id = group_index[(t_id*n_groups + g_id)*2];
+      cs_lnum_t e_id = group_index[(t_id*n_groups + g_id)*2 + 1];
+      for (cs_lnum_t f_id = s_id; f_id < e_id; f_id++) {
+        if (   i_face_cells[f_id][0] >= n_cells
+            || i_face_cells[f_id][1] >= n_cells) {
+          adj_halo = true;
+          break;
+        }
+      }
+    }
+    if (adj_halo)
+      break;
+    n_no_adj_halo_groups = g_id + 1;
+  }
+
+  numbering->n_no_adj_halo_groups = n_no_adj_halo_groups;
+}
+
 /*----------------------------------------------------------------------------
  * Try to apply renumbering of interior faces for multiple threads.
  *
@@ -5010,6 +5372,16 @@ _renumber_i_faces(cs_mesh_t  *mesh)
                                             new_to_old_i);
     break;
 
+  case CS_RENUMBER_I_FACES_DEVICE:
+    numbering_type = CS_NUMBERING_THREADS;
+    _renumber_i_faces_by_cell_adjacency(mesh);
+    retval = _renum_i_faces_for_device(mesh,
+                                       n_i_threads,
+                                       new_to_old_i,
+                                       &n_i_groups,
+                                       &i_group_index);
+    break;
+
   case CS_RENUMBER_I_FACES_NONE:
   default:
     _renumber_i_faces_by_cell_adjacency(mesh);
@@ -5050,10 +5422,14 @@ _renumber_i_faces(cs_mesh_t  *mesh)
     mesh->i_face_numbering
       = cs_numbering_create_default(mesh->n_i_faces);
 
-  if (mesh->verbosity > 0)
+  _i_faces_update_no_adj_halo(mesh, mesh->i_face_numbering);
+
+  if (mesh->verbosity > 0) {
     cs_numbering_log_info(CS_LOG_DEFAULT,
                           _("interior faces"),
                           mesh->i_face_numbering);
+    _log_i_faces_cache_reuse(mesh);
+  }
 
   /* Free memory */
 
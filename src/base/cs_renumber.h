@@ -57,6 +57,8 @@ typedef enum {
   CS_RENUMBER_CELLS_MORTON,          /* Morton space filling curve */
   CS_RENUMBER_CELLS_HILBERT,         /* Hilbert space filling curve */
   CS_RENUMBER_CELLS_RCM,             /* Reverse Cuthill-McKee */
+  CS_RENUMBER_CELLS_HILBERT_BLOCK,   /* Hilbert curve, with sorting inside
+                                        device warp-sized blocks */
   CS_RENUMBER_CELLS_NONE             /* No cells renumbering */
 
 } cs_renumber_cells_type_t;
@@ -66,6 +68,7 @@ typedef enum {
   CS_RENUMBER_I_FACES_BLOCK,         /* No shared cell in block */
   CS_RENUMBER_I_FACES_MULTIPASS,     /* Use multipass face numbering */
   CS_RENUMBER_I_FACES_SIMD,          /* Renumber for vector (SIMD) operations */
+  CS_RENUMBER_I_FACES_DEVICE,        /* Colored, coalesced for device (GPU) */
   CS_RENUMBER_I_FACES_NONE           /* No interior face numbering */
 
 } cs_renumber_i_faces_type_t;
@@ -32,6 +32,8 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <float.h>
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -128,6 +130,20 @@ struct _cs_restart_t {
 
   cs_restart_mode_t  mode;           /* Read or write */
 
+  double             lossy_tolerance; /* Absolute error bound for lossy
+                                         compression of real values on
+                                         mesh locations (0: lossless) */
+
+  int                block_loc_id;   /* Id of location whose local entities
+                                        are numbered contiguously by rank
+                                        (written directly by blocks), or 0 */
+  cs_gnum_t          block_range[2]; /* Matching local global number range */
+
+  int                read_d_loc_id;  /* Location id of cached read
+                                        distribution, or 0 */
+  cs_lnum_t          read_d_block_size; /* Block size of cached distribution */
+  cs_all_to_all_t   *read_d;         /* Cached read distribution, or nullptr */
+
 };
 
 typedef struct {
@@ -208,6 +224,9 @@ static double _checkpoint_wt_interval = -1.; /* wall-clock interval */
 static double _checkpoint_wt_next = -1.;     /* next forced wall-clock value */
 static double _checkpoint_wt_last = 0.;      /* wall-clock time of last
                                                 checkpointing */
+static double _checkpoint_lossy_tolerance = 0.; /* default error bound for
+                                                   lossy compression */
+static bool   _checkpoint_async = false;     /* asynchronous writes */
 /* Are we restarting from a NCFD file ? */
 
 static int    _restart_from_ncfd = 0;
@@ -387,6 +406,8 @@ _add_file(cs_restart_t  *r)
     }
     else {
       cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+      if (_checkpoint_async)
+        method = CS_FILE_STDIO_SERIAL;
       r->fh = cs_io_initialize(r->name,
                                magic_string,
                                CS_IO_MODE_WRITE,
@@ -395,6 +416,8 @@ _add_file(cs_restart_t  *r)
                                hints,
                                block_comm,
                                comm);
+      if (_checkpoint_async)
+        cs_io_set_async_write(r->fh);
     }
   }
 #else
@@ -414,6 +437,8 @@ _add_file(cs_restart_t  *r)
                                CS_IO_MODE_WRITE,
                                method,
                                echo);
+      if (_checkpoint_async)
+        cs_io_set_async_write(r->fh);
     }
   }
 #endif
@@ -429,9 +454,13 @@ _add_file(cs_restart_t  *r)
 /*----------------------------------------------------------------------------
  * Read variable values defined on a mesh location.
  *
+ * The distribution used is kept, so as to be reused by successive reads
+ * on the same location and block distribution (such as for particles).
+ *
  * parameters:
  *   r           <-> associated restart file pointer
  *   header          <-- header associated with current position in file
+ *   location_id     <-- id of corresponding location
  *   n_glob_ents     <-- global number of entities
  *   n_ents          <-- local number of entities
  *   ent_global_num  <-- global entity numbers (1 to n numbering)
@@ -443,6 +472,7 @@ _add_file(cs_restart_t  *r)
 static void
 _read_ent_values(cs_restart_t           *r,
                  cs_io_sec_header_t     *header,
+                 int                     location_id,
                  cs_gnum_t               n_glob_ents,
                  cs_lnum_t               n_ents,
                  const cs_gnum_t         ent_global_num[],
@@ -450,9 +480,7 @@ _read_ent_values(cs_restart_t           *r,
                  cs_restart_val_type_t   val_type,
                  cs_byte_t               vals[])
 {
-  cs_byte_t  *buffer = nullptr;
-
-  cs_lnum_t  block_buf_size = 0;
+  void  *buffer = nullptr;
 
   size_t  nbr_byte_ent;
 
@@ -485,25 +513,30 @@ _read_ent_values(cs_restart_t           *r,
                                   r->min_block_size / nbr_byte_ent,
                                   n_glob_ents);
 
-  cs_all_to_all_t *d
-    = cs_all_to_all_create_from_block(n_ents,
-                                      CS_ALL_TO_ALL_USE_DEST_ID,
-                                      ent_global_num,
-                                      bi,
-                                      cs_glob_mpi_comm);
+  if (   r->read_d != nullptr
+      && (   r->read_d_loc_id != location_id
+          || r->read_d_block_size != bi.block_size))
+    cs_all_to_all_destroy(&(r->read_d));
+
+  if (r->read_d == nullptr) {
+    r->read_d = cs_all_to_all_create_from_block(n_ents,
+                                                CS_ALL_TO_ALL_USE_DEST_ID,
+                                                ent_global_num,
+                                                bi,
+                                                cs_glob_mpi_comm);
+    r->read_d_loc_id = location_id;
+    r->read_d_block_size = bi.block_size;
+  }
 
-  /* Read blocks */
+  cs_all_to_all_t *d = r->read_d;
 
-  block_buf_size = (bi.gnum_range[1] - bi.gnum_range[0]) * nbr_byte_ent;
+  /* Read blocks (directly from memory-mapped files when possible) */
 
-  if (block_buf_size > 0)
-    BFT_MALLOC(buffer, block_buf_size, cs_byte_t);
-
-  cs_io_read_block(header,
-                   bi.gnum_range[0],
-                   bi.gnum_range[1],
-                   buffer,
-                   r->fh);
+  const void *block_vals = cs_io_read_block_view(header,
+                                                 bi.gnum_range[0],
+                                                 bi.gnum_range[1],
+                                                 &buffer,
+                                                 r->fh);
 
  /* Distribute blocks on ranks */
 
@@ -511,14 +544,12 @@ _read_ent_values(cs_restart_t           *r,
                            header->elt_type,
                            n_location_vals,
                            true,  /* reverse */
-                           buffer,
+                           block_vals,
                            vals);
 
   /* Free buffer */
 
   BFT_FREE(buffer);
-
-  cs_all_to_all_destroy(&d);
 }
 
 /*----------------------------------------------------------------------------
@@ -581,6 +612,34 @@ _write_ent_values(const cs_restart_t     *r,
     assert(0);
   }
 
+  /* Entities already numbered contiguously by rank are written
+     directly as blocks (a copy is used, as it may be byte-swapped) */
+
+  if (location_id == r->block_loc_id) {
+
+    block_buf_size = n_ents * nbr_byte_ent;
+
+    if (block_buf_size > 0) {
+      BFT_MALLOC(buffer, block_buf_size, cs_byte_t);
+      memcpy(buffer, vals, block_buf_size);
+    }
+
+    cs_io_write_block_buffer(sec_name,
+                             n_glob_ents,
+                             r->block_range[0],
+                             r->block_range[1],
+                             location_id,
+                             0,
+                             n_location_vals,
+                             elt_type,
+                             buffer,
+                             r->fh);
+
+    BFT_FREE(buffer);
+
+    return;
+  }
+
   bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
                                    cs_glob_n_ranks,
                                    r->rank_step,
@@ -1030,6 +1089,222 @@ _default_p_rank(cs_block_dist_info_t  *p_bi,
 
 #endif /* defined(HAVE_MPI) */
 
+/*----------------------------------------------------------------------------
+ * Build name of section describing quantization of an error-bounded
+ * real-valued section.
+ *
+ * parameters:
+ *   sec_name <-- name of associated section
+ *
+ * returns:
+ *   newly allocated name (to be freed by caller)
+ *----------------------------------------------------------------------------*/
+
+static char *
+_quantization_section_name(const char  *sec_name)
+{
+  const char suffix[] = ":quantization";
+
+  char *q_name = nullptr;
+  BFT_MALLOC(q_name, strlen(sec_name) + strlen(suffix) + 1, char);
+  strcpy(q_name, sec_name);
+  strcat(q_name, suffix);
+
+  return q_name;
+}
+
+/*----------------------------------------------------------------------------
+ * Write an error-bounded (lossy) section of real values.
+ *
+ * Values are quantized relative to the global minimum, with a step
+ * ensuring the absolute error is bounded by the file's tolerance, and the
+ * resulting codes are stored as little-endian bytes (using the smallest
+ * number of bytes allowing the global range) in a character section
+ * of the same name, so the usual block distribution is used. The
+ * quantization parameters are stored in an additional global section.
+ *
+ * If values are non-finite, or the range is too large relative to the
+ * tolerance, nothing is written so the section may be written without
+ * compression.
+ *
+ * parameters:
+ *   restart         <-- associated restart file pointer
+ *   context         <-> associated context
+ *   sec_name        <-- section name
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location (interlaced)
+ *   val             <-- array of values
+ *
+ * returns:
+ *   true if the section was written, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_write_quantized_section(cs_restart_t     *restart,
+                         void             *context,
+                         const char       *sec_name,
+                         int               location_id,
+                         int               n_location_vals,
+                         const cs_real_t  *val)
+{
+  const cs_lnum_t n_ents = (restart->location[location_id-1]).n_ents;
+  const size_t n_vals = (size_t)n_ents * (size_t)n_location_vals;
+
+  /* Global range */
+
+  double v_range[2] = {HUGE_VAL, -HUGE_VAL};
+  int n_non_finite = 0;
+
+  for (size_t i = 0; i < n_vals; i++) {
+    double v = val[i];
+    if (isfinite(v)) {
+      if (v < v_range[0])
+        v_range[0] = v;
+      if (v > v_range[1])
+        v_range[1] = v;
+    }
+    else
+      n_non_finite += 1;
+  }
+
+  cs_parall_min(1, CS_DOUBLE, v_range);
+  cs_parall_max(1, CS_DOUBLE, v_range + 1);
+  cs_parall_max(1, CS_INT_TYPE, &n_non_finite);
+
+  if (n_non_finite > 0 || v_range[0] > v_range[1])
+    return false;
+
+  /* Quantization step, with a small margin for rounding errors;
+     the bound cannot be guaranteed if the tolerance is close to
+     the precision of the values */
+
+  const double tol = restart->lossy_tolerance;
+  const double step = 1.998 * tol;
+
+  double v_abs_max = CS_MAX(fabs(v_range[0]), fabs(v_range[1]));
+  if (tol < 100*DBL_EPSILON*v_abs_max)
+    return false;
+
+  double n_steps = floor((v_range[1] - v_range[0]) / step + 0.5);
+  if (n_steps > 4294967295.)
+    return false;
+
+  int n_bytes = 1;
+  while (n_bytes < 4 && n_steps >= ldexp(1., 8*n_bytes))
+    n_bytes++;
+
+  /* Quantization info */
+
+  cs_real_t q[3] = {v_range[0], step, (cs_real_t)n_bytes};
+
+  char *q_name = _quantization_section_name(sec_name);
+
+  _write_section(restart, context, q_name, 0, 3, CS_TYPE_cs_real_t, q);
+
+  BFT_FREE(q_name);
+
+  /* Codes, independently for each rank's values */
+
+  unsigned char *codes = nullptr;
+  BFT_MALLOC(codes, n_vals*n_bytes, unsigned char);
+
+  const uint64_t c_max = (uint64_t)n_steps;
+
+# pragma omp parallel for if (n_vals > CS_THR_MIN)
+  for (size_t i = 0; i < n_vals; i++) {
+    uint64_t c = (uint64_t)((val[i] - v_range[0]) / step + 0.5);
+    if (c > c_max)
+      c = c_max;
+    for (int k = 0; k < n_bytes; k++)
+      codes[i*n_bytes + k] = (unsigned char)((c >> (8*k)) & 0xff);
+  }
+
+  _write_section(restart,
+                 context,
+                 sec_name,
+                 location_id,
+                 n_location_vals*n_bytes,
+                 CS_TYPE_char,
+                 codes);
+
+  BFT_FREE(codes);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Read an error-bounded (lossy) section of real values.
+ *
+ * parameters:
+ *   restart         <-- associated restart file pointer
+ *   context         <-> associated context
+ *   sec_name        <-- section name
+ *   location_id     <-- id of corresponding location
+ *   n_location_vals <-- number of values per location (interlaced)
+ *   val             --> array of values
+ *
+ * returns:
+ *   0 (CS_RESTART_SUCCESS) in case of success,
+ *   or error code (CS_RESTART_ERR_xxx) in case of error
+ *----------------------------------------------------------------------------*/
+
+static int
+_read_quantized_section(cs_restart_t  *restart,
+                        void          *context,
+                        const char    *sec_name,
+                        int            location_id,
+                        int            n_location_vals,
+                        cs_real_t     *val)
+{
+  cs_real_t q[3];
+
+  char *q_name = _quantization_section_name(sec_name);
+
+  int retcode = _read_section(restart, context, q_name,
+                              0, 3, CS_TYPE_cs_real_t, q);
+
+  BFT_FREE(q_name);
+
+  if (retcode != CS_RESTART_SUCCESS) {
+    bft_printf(_("  %s: section \"%s\" is not of floating-point type.\n"),
+               restart->name, sec_name);
+    return CS_RESTART_ERR_VAL_TYPE;
+  }
+
+  const int n_bytes = (int)q[2];
+  const cs_lnum_t n_ents = (restart->location[location_id-1]).n_ents;
+  const size_t n_vals = (size_t)n_ents * (size_t)n_location_vals;
+
+  unsigned char *codes = nullptr;
+  BFT_MALLOC(codes, n_vals*n_bytes, unsigned char);
+
+  retcode = _read_section(restart,
+                          context,
+                          sec_name,
+                          location_id,
+                          n_location_vals*n_bytes,
+                          CS_TYPE_char,
+                          codes);
+
+  if (retcode == CS_RESTART_SUCCESS) {
+
+    const double v_min = q[0], step = q[1];
+
+#   pragma omp parallel for if (n_vals > CS_THR_MIN)
+    for (size_t i = 0; i < n_vals; i++) {
+      uint64_t c = 0;
+      for (int k = 0; k < n_bytes; k++)
+        c |= ((uint64_t)codes[i*n_bytes + k]) << (8*k);
+      val[i] = v_min + (double)c * step;
+    }
+
+  }
+
+  BFT_FREE(codes);
+
+  return retcode;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Check the presence of a given section in a restart file.
@@ -1054,8 +1329,6 @@ _check_section(cs_restart_t           *restart,
                int                     n_location_vals,
                cs_restart_val_type_t   val_type)
 {
-  CS_UNUSED(context);
-
   cs_lnum_t n_ents;
   cs_gnum_t n_glob_ents;
 
@@ -1120,6 +1393,24 @@ _check_section(cs_restart_t           *restart,
       return CS_RESTART_ERR_LOCATION;
   }
 
+  /* Error-bounded real values are stored as bytes */
+
+  if (   header.elt_type == CS_CHAR
+      && val_type == CS_TYPE_cs_real_t
+      && location_id > 0) {
+    size_t n_bytes = header.n_location_vals / n_location_vals;
+    if (   header.n_location_vals != n_bytes*n_location_vals
+        || n_bytes < 1 || n_bytes > 4)
+      return CS_RESTART_ERR_N_VALS;
+    char *q_name = _quantization_section_name(sec_name);
+    int retcode = _check_section(restart, context, q_name,
+                                 0, 3, CS_TYPE_cs_real_t);
+    BFT_FREE(q_name);
+    if (retcode != CS_RESTART_SUCCESS)
+      return CS_RESTART_ERR_VAL_TYPE;
+    return CS_RESTART_SUCCESS;
+  }
+
   /* If the number of values per location does not match */
 
   if (   header.location_id > 0
@@ -1178,8 +1469,6 @@ _read_section(cs_restart_t           *restart,
               cs_restart_val_type_t   val_type,
               void                   *val)
 {
-  CS_UNUSED(context);
-
   cs_lnum_t n_ents;
   cs_gnum_t n_glob_ents;
 
@@ -1269,6 +1558,18 @@ _read_section(cs_restart_t           *restart,
     }
   }
 
+  /* Error-bounded real values are stored as bytes */
+
+  if (   header.elt_type == CS_CHAR
+      && val_type == CS_TYPE_cs_real_t
+      && location_id > 0)
+    return _read_quantized_section(restart,
+                                   context,
+                                   sec_name,
+                                   location_id,
+                                   n_location_vals,
+                                   (cs_real_t *)val);
+
   /* If the number of values per location does not match */
 
   if (   header.location_id > 0
@@ -1362,6 +1663,7 @@ _read_section(cs_restart_t           *restart,
   else if (n_glob_ents > 0)
     _read_ent_values(restart,
                      &header,
+                     location_id,
                      n_glob_ents,
                      n_ents,
                      ent_global_num,
@@ -1398,8 +1700,6 @@ _write_section(cs_restart_t           *restart,
                cs_restart_val_type_t   val_type,
                const void             *val)
 {
-  CS_UNUSED(context);
-
   cs_lnum_t        n_ents;
   cs_gnum_t        n_tot_vals, n_glob_ents;
   cs_datatype_t    elt_type = CS_DATATYPE_NULL;
@@ -1410,6 +1710,20 @@ _write_section(cs_restart_t           *restart,
 
   assert(restart != nullptr);
 
+  /* Error-bounded compression if requested and possible */
+
+  if (   restart->lossy_tolerance > 0
+      && val_type == CS_TYPE_cs_real_t
+      && location_id > 0) {
+    if (_write_quantized_section(restart,
+                                 context,
+                                 sec_name,
+                                 location_id,
+                                 n_location_vals,
+                                 (const cs_real_t *)val))
+      return;
+  }
+
   n_tot_vals = _compute_n_ents(restart, location_id, n_location_vals);
 
   /* Check associated location */
@@ -1859,6 +2173,57 @@ cs_restart_checkpoint_set_mesh_mode(int  mode)
   _checkpoint_mesh = mode;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define default error bound for lossy compression of checkpoints.
+ *
+ * When positive, real-valued sections defined on mesh locations and
+ * written to checkpoint files created afterwards are quantized so that
+ * the absolute error on each value is bounded by the given tolerance,
+ * using the smallest number of bytes per value allowing the section's
+ * global range. Such sections are read transparently by
+ * \ref cs_restart_read_section.
+ *
+ * Sections containing non-finite values, or whose range is too large
+ * relative to the tolerance, are written without compression.
+ *
+ * This is intended for frequent or "soft" checkpoints, for which full
+ * precision is not required.
+ *
+ * \param[in]  tolerance  absolute error bound, or 0 for lossless output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_lossy_tolerance(double  tolerance)
+{
+  _checkpoint_lossy_tolerance = CS_MAX(tolerance, 0.);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Enable or disable asynchronous writing of checkpoint files.
+ *
+ * When enabled, checkpoint files created afterwards are written using
+ * the serial stdio access method, with data copied to a host staging
+ * queue and written to disk by a helper thread, so that computations
+ * may resume as soon as data has been gathered on the writing rank.
+ *
+ * Pending writes to a given file are completed before that file is
+ * moved to a previous checkpoint directory (i.e. at the next checkpoint),
+ * and all pending writes are completed at the latest when file
+ * management is finalized.
+ *
+ * \param[in]  async  true to enable asynchronous writes, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async(bool  async)
+{
+  _checkpoint_async = async;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define last forced checkpoint time step.
@@ -2290,6 +2655,9 @@ cs_restart_create(const char         *name,
     int writer_id = _add_restart_multiwriter(name, _name);
     _restart_multiwriter_t *mw = _restart_multiwriter_by_id(writer_id);
 
+    /* Complete pending asynchronous writes from a previous checkpoint */
+    cs_file_wait_async_writes_to(_name);
+
     /* Rename an already existing file */
     if (cs_file_isreg(_name) && mw->n_prev_files > -1) {
 
@@ -2351,11 +2719,22 @@ cs_restart_create(const char         *name,
   restart->rank_step = 1;
   restart->min_block_size = 0;
 
+  restart->lossy_tolerance
+    = (mode == CS_RESTART_MODE_WRITE) ? _checkpoint_lossy_tolerance : 0.;
+
   /* Initialize location data */
 
   restart->n_locations = 0;
   restart->location = nullptr;
 
+  restart->block_loc_id = 0;
+  restart->block_range[0] = 0;
+  restart->block_range[1] = 0;
+
+  restart->read_d_loc_id = 0;
+  restart->read_d_block_size = 0;
+  restart->read_d = nullptr;
+
   /* Open associated file, and build an index of sections in read mode */
 
   if (mode == CS_RESTART_MODE_READ) {
@@ -2428,6 +2807,11 @@ cs_restart_destroy(cs_restart_t  **restart)
       && r->fh != _restart_serialized_memory)
     cs_io_finalize(&(r->fh));
 
+#if defined(HAVE_MPI)
+  if (r->read_d != nullptr)
+    cs_all_to_all_destroy(&(r->read_d));
+#endif
+
   /* Free locations array */
 
   if (r->n_locations > 0) {
@@ -2551,6 +2935,11 @@ cs_restart_add_location(cs_restart_t     *restart,
         (restart->location[loc_id]).ent_global_num = ent_global_num;
         (restart->location[loc_id])._ent_global_num = nullptr;
 
+#if defined(HAVE_MPI)
+        if (restart->read_d_loc_id == loc_id + 1)
+          cs_all_to_all_destroy(&(restart->read_d));
+#endif
+
         timing[1] = cs_timer_wtime();
         _restart_wtime[restart->mode] += timing[1] - timing[0];
 
@@ -2759,6 +3148,49 @@ cs_restart_set_write_section_func(cs_restart_write_section_t  *func)
   return p;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define error bound for lossy compression of real-valued
+ *         sections subsequently written to a restart file.
+ *
+ * This is ignored for files opened in read mode.
+ *
+ * \sa cs_restart_checkpoint_set_lossy_tolerance.
+ *
+ * \param[in, out]  restart    associated restart file pointer
+ * \param[in]       tolerance  absolute error bound, or 0 for lossless output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_lossy_tolerance(cs_restart_t  *restart,
+                               double         tolerance)
+{
+  assert(restart != nullptr);
+
+  if (restart->mode == CS_RESTART_MODE_WRITE)
+    restart->lossy_tolerance = CS_MAX(tolerance, 0.);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return error bound for lossy compression of real-valued
+ *         sections written to a restart file.
+ *
+ * \param[in]  restart  associated restart file pointer
+ *
+ * \return  absolute error bound, or 0 for lossless output
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_restart_get_lossy_tolerance(const cs_restart_t  *restart)
+{
+  assert(restart != nullptr);
+
+  return restart->lossy_tolerance;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Return name of restart file
@@ -3112,6 +3544,9 @@ cs_restart_read_particles_info(cs_restart_t  *restart,
     (restart->location[loc_id]).ent_global_num
       = (restart->location[loc_id])._ent_global_num;
 
+    if (restart->read_d_loc_id == loc_id + 1)
+      cs_all_to_all_destroy(&(restart->read_d));
+
     (restart->location[loc_id]).n_glob_ents = n_glob_particles;
     (restart->location[loc_id]).n_ents = n_part_ents;
 
@@ -3321,6 +3756,20 @@ cs_restart_write_particles(cs_restart_t     *restart,
   (restart->location[loc_id-1])._ent_global_num = global_particle_num;
   assert((restart->location[loc_id-1]).ent_global_num == global_particle_num);
 
+  /* With numbering based on local numbers, each rank's particles form
+     a contiguous block, so sections may be written without redistribution */
+
+#if defined(HAVE_MPI)
+  if (number_by_coords == false && cs_glob_n_ranks > 1) {
+    cs_gnum_t l_end = n_particles;
+    MPI_Scan(&l_end, restart->block_range + 1, 1, CS_MPI_GNUM, MPI_SUM,
+             cs_glob_mpi_comm);
+    restart->block_range[1] += 1;
+    restart->block_range[0] = restart->block_range[1] - n_particles;
+    restart->block_loc_id = loc_id;
+  }
+#endif
+
   /* Write particle coordinates */
 
   BFT_MALLOC(sec_name, strlen(name) + strlen(coords_postfix) + 1, char);
@@ -4100,6 +4549,15 @@ cs_restart_log_setup(void)
     cs_log_printf(CS_LOG_SETUP,
                   _("                      : every %g s (wall-clock time)\n"),
                   _checkpoint_wt_interval);
+
+  if (_checkpoint_lossy_tolerance > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Lossy compression:    absolute tolerance %g\n"),
+                  _checkpoint_lossy_tolerance);
+
+  if (_checkpoint_async)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Asynchronous writes:  yes\n"));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -253,6 +253,51 @@ cs_restart_checkpoint_set_interval(int     nt_interval,
 void
 cs_restart_checkpoint_set_mesh_mode(int  mode);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define default error bound for lossy compression of checkpoints.
+ *
+ * When positive, real-valued sections defined on mesh locations and
+ * written to checkpoint files created afterwards are quantized so that
+ * the absolute error on each value is bounded by the given tolerance,
+ * using the smallest number of bytes per value allowing the section's
+ * global range. Such sections are read transparently by
+ * \ref cs_restart_read_section.
+ *
+ * Sections containing non-finite values, or whose range is too large
+ * relative to the tolerance, are written without compression.
+ *
+ * This is intended for frequent or "soft" checkpoints, for which full
+ * precision is not required.
+ *
+ * \param[in]  tolerance  absolute error bound, or 0 for lossless output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_lossy_tolerance(double  tolerance);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Enable or disable asynchronous writing of checkpoint files.
+ *
+ * When enabled, checkpoint files created afterwards are written using
+ * the serial stdio access method, with data copied to a host staging
+ * queue and written to disk by a helper thread, so that computations
+ * may resume as soon as data has been gathered on the writing rank.
+ *
+ * Pending writes to a given file are completed before that file is
+ * moved to a previous checkpoint directory (i.e. at the next checkpoint),
+ * and all pending writes are completed at the latest when file
+ * management is finalized.
+ *
+ * \param[in]  async  true to enable asynchronous writes, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async(bool  async);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Define last forced checkpoint time step.
@@ -545,6 +590,38 @@ cs_restart_set_read_section_func(cs_restart_read_section_t  *func);
 cs_restart_write_section_t  *
 cs_restart_set_write_section_func(cs_restart_write_section_t  *func);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define error bound for lossy compression of real-valued
+ *         sections subsequently written to a restart file.
+ *
+ * This is ignored for files opened in read mode.
+ *
+ * \sa cs_restart_checkpoint_set_lossy_tolerance.
+ *
+ * \param[in, out]  restart    associated restart file pointer
+ * \param[in]       tolerance  absolute error bound, or 0 for lossless output
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_set_lossy_tolerance(cs_restart_t  *restart,
+                               double         tolerance);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return error bound for lossy compression of real-valued
+ *         sections written to a restart file.
+ *
+ * \param[in]  restart  associated restart file pointer
+ *
+ * \return  absolute error bound, or 0 for lossless output
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_restart_get_lossy_tolerance(const cs_restart_t  *restart);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Return name of restart file
@@ -48,10 +48,13 @@
 #include "bft_mem.h"
 #include "bft_error.h"
 #include "bft_printf.h"
+#include "cs_all_to_all.h"
 #include "cs_array.h"
 #include "cs_assert.h"
 #include "cs_base.h"
+#include "cs_block_dist.h"
 #include "cs_coupling.h"
+#include "cs_file.h"
 #include "cs_io.h"
 #include "cs_mesh.h"
 #include "cs_mesh_connect.h"
@@ -108,6 +111,23 @@ static  ple_locator_t  *_locator[4] = {nullptr, nullptr, nullptr, nullptr};
 
 fvm_nodal_t  *_nodal_src = nullptr;
 
+/* Optional file name used to save or reuse the cell mapping */
+
+static char *_cell_map_file_name = nullptr;
+
+/* Cell mapping read from file (replaces cell locator when present) */
+
+static cs_lnum_t   _n_mapped_cells = 0;          /* number of mapped cells */
+static cs_lnum_t  *_mapped_cell_id = nullptr;    /* ids of mapped cells */
+static cs_lnum_t   _n_cell_map_src = 0;          /* number of source values
+                                                    sent from this rank */
+static cs_lnum_t  *_cell_map_src_id = nullptr;   /* local (block) ids of
+                                                    source values sent */
+
+#if defined(HAVE_MPI)
+static cs_all_to_all_t  *_cell_map_d = nullptr;  /* associated distributor */
+#endif
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -253,6 +273,293 @@ _interpolate_vtx(ple_locator_t          *locator,
   BFT_FREE(send_var);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Use P0 interpolation (projection) from source to destination
+ *        cells using a cell mapping read from file.
+ *
+ * Source values are read using a block distribution, so the same
+ * precomputed distributor is used for all sections.
+ *
+ * \param[in]       n_location_vals  number of values per location (interlaced)
+ * \param[in]       val_type         value type
+ * \param[in]       val_src          array of source values
+ * \param[out]      val              array of values
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_interpolate_p0_cell_map(int                     n_location_vals,
+                         cs_restart_val_type_t   val_type,
+                         const void             *val_src,
+                         void                   *val)
+{
+  const unsigned char *_val_src = (const unsigned char *)val_src;
+  unsigned char *_val = (unsigned char *)val;
+
+  size_t type_size = _type_size(val_type);
+  size_t loc_size = type_size*n_location_vals;
+
+  /* Prepare and send data */
+
+  unsigned char  *send_var;
+  BFT_MALLOC(send_var, _n_cell_map_src*loc_size, unsigned char);
+
+  for (cs_lnum_t i = 0; i < _n_cell_map_src; i++)
+    memcpy(send_var + i*loc_size,
+           _val_src + _cell_map_src_id[i]*loc_size,
+           loc_size);
+
+  unsigned char  *recv_var = send_var;
+
+#if defined(HAVE_MPI)
+  if (_cell_map_d != nullptr)
+    recv_var = (unsigned char *)cs_all_to_all_copy_array(_cell_map_d,
+                                                         CS_CHAR,
+                                                         loc_size,
+                                                         true, /* reverse */
+                                                         send_var,
+                                                         nullptr);
+#endif
+
+  for (cs_lnum_t i = 0; i < _n_mapped_cells; i++)
+    memcpy(_val + _mapped_cell_id[i]*loc_size,
+           recv_var + i*loc_size,
+           loc_size);
+
+  if (recv_var != send_var)
+    BFT_FREE(recv_var);
+  BFT_FREE(send_var);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the cell mapping from the global number of the matching
+ *        source cell of each cell.
+ *
+ * Source entities are assigned to ranks using a block distribution, so
+ * the previous mesh does not need to be read.
+ *
+ * \param[in]  n_g_src       global number of source cells, interior faces,
+ *                           boundary faces, and vertices
+ * \param[in]  cell_src_num  global number of the matching source cell
+ *                           of each cell, or 0 if not located
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_build_cell_map(const cs_gnum_t  n_g_src[4],
+                const cs_gnum_t  cell_src_num[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  const int rank_id = CS_MAX(cs_glob_rank_id, 0);
+  const char *loc_name[] = {"cells", "interior_faces", "boundary_faces",
+                            "vertices"};
+
+  /* Set reference numbering for restart, using block distributions */
+
+  cs_block_dist_info_t  bi[4];
+
+  for (int i = 0; i < 4; i++) {
+    bi[i] = cs_block_dist_compute_sizes(rank_id,
+                                        cs_glob_n_ranks,
+                                        1,
+                                        0,
+                                        n_g_src[i]);
+
+    cs_lnum_t n_b_ents = bi[i].gnum_range[1] - bi[i].gnum_range[0];
+
+    cs_gnum_t *b_gnum;
+    BFT_MALLOC(b_gnum, n_b_ents, cs_gnum_t);
+    for (cs_lnum_t j = 0; j < n_b_ents; j++)
+      b_gnum[j] = bi[i].gnum_range[0] + (cs_gnum_t)j;
+
+    cs_restart_add_location_ref(loc_name[i], n_g_src[i], n_b_ents, b_gnum);
+
+    BFT_FREE(b_gnum);
+  }
+
+  /* List mapped cells */
+
+  _n_mapped_cells = 0;
+  for (cs_lnum_t i = 0; i < m->n_cells; i++) {
+    if (cell_src_num[i] > 0)
+      _n_mapped_cells += 1;
+  }
+
+  cs_gnum_t *src_num;
+  BFT_MALLOC(_mapped_cell_id, _n_mapped_cells, cs_lnum_t);
+  BFT_MALLOC(src_num, _n_mapped_cells, cs_gnum_t);
+
+  _n_mapped_cells = 0;
+  for (cs_lnum_t i = 0; i < m->n_cells; i++) {
+    if (cell_src_num[i] > 0) {
+      _mapped_cell_id[_n_mapped_cells] = i;
+      src_num[_n_mapped_cells] = cell_src_num[i];
+      _n_mapped_cells += 1;
+    }
+  }
+
+  /* Build distributor (source values are sent in reverse mode) */
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+
+    _cell_map_d = cs_all_to_all_create_from_block(_n_mapped_cells,
+                                                  0, /* flags */
+                                                  src_num,
+                                                  bi[0],
+                                                  cs_glob_mpi_comm);
+
+    cs_gnum_t *b_src_num = cs_all_to_all_copy_array(_cell_map_d,
+                                                    1,
+                                                    false, /* reverse */
+                                                    src_num);
+
+    BFT_FREE(src_num);
+    src_num = b_src_num;
+
+    _n_cell_map_src = cs_all_to_all_n_elts_dest(_cell_map_d);
+
+  }
+  else
+#endif
+    _n_cell_map_src = _n_mapped_cells;
+
+  BFT_MALLOC(_cell_map_src_id, _n_cell_map_src, cs_lnum_t);
+  for (cs_lnum_t i = 0; i < _n_cell_map_src; i++)
+    _cell_map_src_id[i] = src_num[i] - bi[0].gnum_range[0];
+
+  BFT_FREE(src_num);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Try to read the cell mapping from file.
+ *
+ * The mapping file is searched for in the restart directory; it is
+ * used only if it matches the current mesh.
+ *
+ * \return  true if the mapping was read, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_read_cell_map(void)
+{
+  int present = 0;
+
+  if (cs_glob_rank_id < 1) {
+    const char dir_name[] = "restart";
+    char *path;
+    BFT_MALLOC(path,
+               strlen(dir_name) + strlen(_cell_map_file_name) + 2,
+               char);
+    sprintf(path, "%s/%s", dir_name, _cell_map_file_name);
+    present = cs_file_isreg(path);
+    BFT_FREE(path);
+  }
+  cs_parall_bcast(0, 1, CS_INT_TYPE, &present);
+
+  if (present == 0)
+    return false;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  cs_restart_t *r = cs_restart_create(_cell_map_file_name,
+                                      nullptr,
+                                      CS_RESTART_MODE_READ);
+
+  cs_gnum_t n_g_src[4] = {0, 0, 0, 0};
+  cs_gnum_t *cell_src_num;
+  BFT_MALLOC(cell_src_num, m->n_cells, cs_gnum_t);
+
+  int retcode = cs_restart_read_section(r,
+                                        "restart_map:n_g_src_elts",
+                                        CS_MESH_LOCATION_NONE,
+                                        4,
+                                        CS_TYPE_cs_gnum_t,
+                                        n_g_src);
+
+  if (retcode == CS_RESTART_SUCCESS)
+    retcode = cs_restart_read_section(r,
+                                      "restart_map:cell_src_num",
+                                      CS_MESH_LOCATION_CELLS,
+                                      1,
+                                      CS_TYPE_cs_gnum_t,
+                                      cell_src_num);
+
+  cs_restart_destroy(&r);
+
+  if (retcode == CS_RESTART_SUCCESS) {
+    _build_cell_map(n_g_src, cell_src_num);
+    bft_printf(_("\n  Restart mapping of cells read from \"%s\".\n"),
+               _cell_map_file_name);
+  }
+  else {
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Restart mapping file \"%s\" does not match the\n"
+                 "current mesh; mapping will be recomputed.\n"),
+               _cell_map_file_name);
+  }
+
+  BFT_FREE(cell_src_num);
+
+  return (retcode == CS_RESTART_SUCCESS) ? true : false;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Save the cell mapping to file.
+ *
+ * \param[in]  n_g_src       global number of source cells, interior faces,
+ *                           boundary faces, and vertices
+ * \param[in]  src_cell_num  global number of each local source cell
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_write_cell_map(const cs_gnum_t  n_g_src[4],
+                const cs_gnum_t  src_cell_num[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  cs_gnum_t *cell_src_num;
+  BFT_MALLOC(cell_src_num, m->n_cells, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < m->n_cells; i++)
+    cell_src_num[i] = 0;
+
+  _interpolate_p0(_locator[0],
+                  1,
+                  CS_TYPE_cs_gnum_t,
+                  src_cell_num,
+                  cell_src_num);
+
+  cs_restart_t *r = cs_restart_create(_cell_map_file_name,
+                                      nullptr,
+                                      CS_RESTART_MODE_WRITE);
+
+  cs_restart_write_section(r,
+                           "restart_map:n_g_src_elts",
+                           CS_MESH_LOCATION_NONE,
+                           4,
+                           CS_TYPE_cs_gnum_t,
+                           n_g_src);
+
+  cs_restart_write_section(r,
+                           "restart_map:cell_src_num",
+                           CS_MESH_LOCATION_CELLS,
+                           1,
+                           CS_TYPE_cs_gnum_t,
+                           cell_src_num);
+
+  cs_restart_destroy(&r);
+
+  BFT_FREE(cell_src_num);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read a section with interpolation.
@@ -303,7 +610,10 @@ _read_section_interpolate(cs_restart_t           *restart,
     if (location_id < 5)
       locator = _locator[location_id - 1];
 
-    if (locator == nullptr)
+    bool use_cell_map = (   location_id == CS_MESH_LOCATION_CELLS
+                         && _cell_map_src_id != nullptr);
+
+    if (locator == nullptr && use_cell_map == false)
       return CS_RESTART_ERR_NO_MAP;
 
     const cs_lnum_t n_src_elts
@@ -325,7 +635,12 @@ _read_section_interpolate(cs_restart_t           *restart,
 
     if (retval == CS_RESTART_SUCCESS) {
 
-      if (location_id < CS_MESH_LOCATION_VERTICES)
+      if (use_cell_map)
+        _interpolate_p0_cell_map(n_location_vals,
+                                 val_type,
+                                 read_buffer,
+                                 val);
+      else if (location_id < CS_MESH_LOCATION_VERTICES)
         _interpolate_p0(locator,
                         n_location_vals,
                         val_type,
@@ -480,6 +795,39 @@ cs_restart_map_set_locations(bool map_cell_centers,
   _need_locator[3] = map_vertices;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate the mapping of cells should be saved to or reused
+ *         from a given file.
+ *
+ * If a file with this name is present in the restart directory and
+ * matches the current mesh, the cell mapping is read from it, so neither
+ * the previous mesh nor the location of cell centers are needed.
+ * Otherwise, the mapping is computed and saved to a file with this name
+ * in the checkpoint directory, so that it may be reused by following
+ * computations (such as in parameter studies).
+ *
+ * This is ignored if mapping at vertices is also required.
+ *
+ * \param[in]  file_name  cell mapping file name, or nullptr to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_map_set_cell_map_file(const char  *file_name)
+{
+  if (file_name == nullptr) {
+    BFT_FREE(_cell_map_file_name);
+    return;
+  }
+
+  size_t n = strlen(file_name);
+  BFT_REALLOC(_cell_map_file_name, n + 1, char);
+
+  strncpy(_cell_map_file_name, file_name, n + 1);
+  _cell_map_file_name[n] = '\0';
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build mapping of restart files to different mesh if defined.
@@ -497,6 +845,25 @@ cs_restart_map_build(void)
   int t_restart_id = cs_timer_stats_id_by_name("checkpoint_restart_stage");
   int t_top_id = cs_timer_stats_switch(t_restart_id);
 
+  /* Reuse saved cell mapping if available */
+
+  bool use_cell_map_file = (   _cell_map_file_name != nullptr
+                            && _need_locator[0] == true
+                            && _need_locator[3] == false);
+
+  if (use_cell_map_file) {
+    if (_read_cell_map()) {
+      if (_read_section_f == nullptr)
+        _read_section_f
+          = cs_restart_set_read_section_func(_read_section_interpolate);
+      cs_timer_stats_switch(t_top_id);
+      return;
+    }
+  }
+
+  cs_gnum_t n_g_src[4] = {0, 0, 0, 0};
+  cs_gnum_t *src_cell_num = nullptr;
+
   /* Stash (protect) mesh to read older mesh; should not be necessary
      for reading mesh, but required for older restart, and
      may be safer at this stage */
@@ -550,6 +917,19 @@ cs_restart_map_build(void)
     if (_apply_mesh_deformation)
       _read_mesh_deformation(m);
 
+    /* Keep global cell numbers of previous mesh if mapping is saved */
+
+    if (use_cell_map_file) {
+      n_g_src[0] = m->n_g_cells;
+      n_g_src[1] = m->n_g_i_faces;
+      n_g_src[2] = m->n_g_b_faces;
+      n_g_src[3] = m->n_g_vertices;
+      BFT_MALLOC(src_cell_num, m->n_cells, cs_gnum_t);
+      for (cs_lnum_t i = 0; i < m->n_cells; i++)
+        src_cell_num[i] = (m->global_cell_num != nullptr) ?
+          m->global_cell_num[i] : (cs_gnum_t)(i+1);
+    }
+
     /* Build FVM mesh from previous mesh */
 
     nm = cs_mesh_connect_cells_to_nodal(m,
@@ -621,6 +1001,13 @@ cs_restart_map_build(void)
 
   }
 
+  /* Save cell mapping if requested */
+
+  if (src_cell_num != nullptr) {
+    _write_cell_map(n_g_src, src_cell_num);
+    BFT_FREE(src_cell_num);
+  }
+
   /* Nodal mesh may not be needed anymore */
 
   if (_need_locator[3]) {
@@ -658,6 +1045,17 @@ cs_restart_map_free(void)
   if (_nodal_src != nullptr)
     _nodal_src = fvm_nodal_destroy(_nodal_src);
 
+  BFT_FREE(_cell_map_file_name);
+
+  _n_mapped_cells = 0;
+  _n_cell_map_src = 0;
+  BFT_FREE(_mapped_cell_id);
+  BFT_FREE(_cell_map_src_id);
+#if defined(HAVE_MPI)
+  if (_cell_map_d != nullptr)
+    cs_all_to_all_destroy(&_cell_map_d);
+#endif
+
   if (_read_section_f != nullptr) {
     (void)cs_restart_set_read_section_func(_read_section_f);
     _read_section_f = nullptr;
@@ -120,6 +120,27 @@ void
 cs_restart_map_set_locations(bool map_cell_centers,
                              bool map_vertices);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Indicate the mapping of cells should be saved to or reused
+ *         from a given file.
+ *
+ * If a file with this name is present in the restart directory and
+ * matches the current mesh, the cell mapping is read from it, so neither
+ * the previous mesh nor the location of cell centers are needed.
+ * Otherwise, the mapping is computed and saved to a file with this name
+ * in the checkpoint directory, so that it may be reused by following
+ * computations (such as in parameter studies).
+ *
+ * This is ignored if mapping at vertices is also required.
+ *
+ * \param[in]  file_name  cell mapping file name, or nullptr to disable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_map_set_cell_map_file(const char  *file_name);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Build mapping of restart files to different mesh if defined.
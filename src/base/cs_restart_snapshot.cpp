@@ -0,0 +1,416 @@
+/*============================================================================
+ * In-memory snapshots of the computation state.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_field.h"
+#include "cs_lagr.h"
+#include "cs_lagr_particle.h"
+#include "cs_les_inflow.h"
+#include "cs_mesh_location.h"
+#include "cs_time_moment.h"
+#include "cs_time_step.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_restart_snapshot.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_restart_snapshot.cpp
+        In-memory snapshots of the computation state.
+
+  A snapshot holds a copy of the current time step, values of all fields
+  (including previous time values), time moment accumulators, the main
+  Lagrangian particle set, and the LES inflow state, so that a computation
+  may be rolled back to that state without using checkpoint files
+  (for example in optimization or continuation loops).
+
+  Since the mesh partitioning does not change, each rank simply keeps a
+  copy of its local data, and neither snapshot creation nor rollback
+  require communication.
+
+  Boundary condition coefficients are recomputed at each time step, and
+  are not saved. Mesh coordinates are not saved either, so snapshots
+  should not be used with a deforming mesh. Fields, moments, or particle
+  attributes defined after a snapshot is created are left unchanged when
+  it is applied.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+struct _cs_restart_snapshot_t {
+
+  cs_time_step_t           ts;           /* time step status */
+
+  int                      n_fields;     /* number of fields at save time */
+  size_t                  *f_size;       /* number of saved values per field
+                                            (all time values) */
+  cs_real_t              **f_vals;       /* saved values per field */
+
+  size_t                   n_moment_vals;   /* size of moments buffer */
+  cs_real_t               *moment_vals;     /* time moments state */
+
+  size_t                   n_inflow_vals;   /* size of LES inflow buffer */
+  cs_real_t               *inflow_vals;     /* LES inflow state */
+
+  bool                     have_particles;  /* particle set is saved */
+  cs_lagr_particle_set_t   p_set;           /* particle set counters */
+  cs_lagr_time_step_t      lagr_ts;         /* Lagrangian time step status */
+  size_t                   p_size;          /* size of particle buffer */
+  unsigned char           *p_buffer;        /* particle data */
+
+};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+END_C_DECLS /* templates require C++ linkage */
+
+/*----------------------------------------------------------------------------
+ * Resize a snapshot buffer if needed.
+ *
+ * parameters:
+ *   n        <-- required number of values
+ *   n_prev   <-> current number of values
+ *   buf      <-> pointer to buffer
+ *----------------------------------------------------------------------------*/
+
+template <typename T>
+static void
+_resize_buffer(size_t    n,
+               size_t   *n_prev,
+               T       **buf)
+{
+  if (n != *n_prev) {
+    BFT_REALLOC(*buf, n, T);
+    *n_prev = n;
+  }
+}
+
+BEGIN_C_DECLS
+
+/*----------------------------------------------------------------------------
+ * Return number of values saved for a given field.
+ *
+ * Fields which do not own their values are handled through their owner.
+ *
+ * parameters:
+ *   f <-- pointer to field
+ *
+ * returns:
+ *   number of values for all time values, or 0
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_field_snapshot_size(const cs_field_t  *f)
+{
+  if (f->is_owner == false || f->vals == nullptr || f->val == nullptr)
+    return 0;
+
+  const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(f->location_id)[2];
+
+  return (size_t)(f->n_time_vals) * (size_t)n_elts * (size_t)(f->dim);
+}
+
+/*----------------------------------------------------------------------------
+ * Save computation state to a snapshot.
+ *
+ * parameters:
+ *   s <-> pointer to snapshot
+ *----------------------------------------------------------------------------*/
+
+static void
+_snapshot_save(cs_restart_snapshot_t  *s)
+{
+  s->ts = *cs_glob_time_step;
+
+  /* Fields */
+
+  const int n_fields = cs_field_n_fields();
+
+  if (n_fields > s->n_fields) {
+    BFT_REALLOC(s->f_size, n_fields, size_t);
+    BFT_REALLOC(s->f_vals, n_fields, cs_real_t *);
+    for (int f_id = s->n_fields; f_id < n_fields; f_id++) {
+      s->f_size[f_id] = 0;
+      s->f_vals[f_id] = nullptr;
+    }
+    s->n_fields = n_fields;
+  }
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+    const cs_field_t *f = cs_field_by_id(f_id);
+    size_t n = _field_snapshot_size(f);
+    _resize_buffer(n, s->f_size + f_id, s->f_vals + f_id);
+    if (n > 0) {
+      size_t n_t_vals = n / f->n_time_vals;
+      for (int t_id = 0; t_id < f->n_time_vals; t_id++)
+        memcpy(s->f_vals[f_id] + t_id*n_t_vals, f->vals[t_id],
+               n_t_vals*sizeof(cs_real_t));
+    }
+  }
+
+  /* Time moments and LES inflow */
+
+  _resize_buffer(cs_time_moment_snapshot_size(),
+                 &(s->n_moment_vals), &(s->moment_vals));
+  cs_time_moment_snapshot_save(s->moment_vals);
+
+  _resize_buffer(cs_les_inflow_snapshot_size(),
+                 &(s->n_inflow_vals), &(s->inflow_vals));
+  cs_les_inflow_snapshot_save(s->inflow_vals);
+
+  /* Lagrangian particles */
+
+  const cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
+
+  s->have_particles = (p_set != nullptr);
+
+  if (s->have_particles) {
+    s->p_set = *p_set;
+    s->lagr_ts = *cs_glob_lagr_time_step;
+    size_t n = p_set->n_particles * p_set->p_am->extents;
+    _resize_buffer(n, &(s->p_size), &(s->p_buffer));
+    memcpy(s->p_buffer, p_set->p_buffer, n);
+  }
+  else
+    _resize_buffer(0, &(s->p_size), &(s->p_buffer));
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a snapshot of the current computation state.
+ *
+ * \return  pointer to new snapshot
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_restart_snapshot_t *
+cs_restart_snapshot_create(void)
+{
+  cs_restart_snapshot_t *s;
+  BFT_MALLOC(s, 1, cs_restart_snapshot_t);
+
+  s->n_fields = 0;
+  s->f_size = nullptr;
+  s->f_vals = nullptr;
+
+  s->n_moment_vals = 0;
+  s->moment_vals = nullptr;
+
+  s->n_inflow_vals = 0;
+  s->inflow_vals = nullptr;
+
+  s->have_particles = false;
+  s->p_size = 0;
+  s->p_buffer = nullptr;
+
+  _snapshot_save(s);
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a computation state snapshot.
+ *
+ * \param[in, out]  s  pointer to snapshot pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_snapshot_destroy(cs_restart_snapshot_t  **s)
+{
+  cs_restart_snapshot_t *_s = *s;
+
+  if (_s == nullptr)
+    return;
+
+  for (int f_id = 0; f_id < _s->n_fields; f_id++)
+    BFT_FREE(_s->f_vals[f_id]);
+  BFT_FREE(_s->f_vals);
+  BFT_FREE(_s->f_size);
+
+  BFT_FREE(_s->moment_vals);
+  BFT_FREE(_s->inflow_vals);
+  BFT_FREE(_s->p_buffer);
+
+  BFT_FREE(*s);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Replace a snapshot's contents with the current computation state.
+ *
+ * Buffers are reused when their size does not change.
+ *
+ * \param[in, out]  s  pointer to snapshot
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_snapshot_update(cs_restart_snapshot_t  *s)
+{
+  _snapshot_save(s);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Roll back the computation state to that of a snapshot.
+ *
+ * The snapshot is not modified, so it may be applied several times.
+ *
+ * \param[in]  s  pointer to snapshot
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_snapshot_apply(const cs_restart_snapshot_t  *s)
+{
+  cs_time_step_t *ts = cs_get_glob_time_step();
+
+  ts->nt_cur = s->ts.nt_cur;
+  ts->t_cur = s->ts.t_cur;
+  for (int i = 0; i < 3; i++)
+    ts->dt[i] = s->ts.dt[i];
+  ts->dt_next = s->ts.dt_next;
+
+  /* Fields */
+
+  for (int f_id = 0; f_id < s->n_fields; f_id++) {
+    if (s->f_size[f_id] == 0)
+      continue;
+    cs_field_t *f = cs_field_by_id(f_id);
+    size_t n = _field_snapshot_size(f);
+    if (n != s->f_size[f_id])
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: size of field \"%s\" has changed since\n"
+                  "the snapshot was created (%llu values instead of %llu)."),
+                __func__, f->name,
+                (unsigned long long)n, (unsigned long long)s->f_size[f_id]);
+    size_t n_t_vals = n / f->n_time_vals;
+    for (int t_id = 0; t_id < f->n_time_vals; t_id++)
+      memcpy(f->vals[t_id], s->f_vals[f_id] + t_id*n_t_vals,
+             n_t_vals*sizeof(cs_real_t));
+  }
+
+  /* Time moments and LES inflow */
+
+  cs_time_moment_snapshot_restore(s->moment_vals);
+  cs_les_inflow_snapshot_restore(s->inflow_vals);
+
+  /* Lagrangian particles */
+
+  cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
+
+  if (s->have_particles && p_set != nullptr) {
+
+    const cs_lnum_t n_particles = s->p_set.n_particles;
+
+    cs_lagr_particle_set_resize(n_particles);
+    if (p_set->n_particles_max < n_particles)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: unable to resize particle set to %ld particles."),
+                __func__, (long)n_particles);
+
+    assert(s->p_size == n_particles * p_set->p_am->extents);
+    memcpy(p_set->p_buffer, s->p_buffer, s->p_size);
+
+    /* Restore counters, keeping current buffer information */
+
+    cs_lnum_t n_particles_max = p_set->n_particles_max;
+    const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+    unsigned char *p_buffer = p_set->p_buffer;
+
+    *p_set = s->p_set;
+
+    p_set->n_particles_max = n_particles_max;
+    p_set->p_am = p_am;
+    p_set->p_buffer = p_buffer;
+
+    *(cs_get_lagr_time_step()) = s->lagr_ts;
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the local memory size of a snapshot's buffers.
+ *
+ * \param[in]  s  pointer to snapshot
+ *
+ * \return  size of local snapshot buffers, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_restart_snapshot_get_size(const cs_restart_snapshot_t  *s)
+{
+  size_t n_vals = s->n_moment_vals + s->n_inflow_vals;
+  for (int f_id = 0; f_id < s->n_fields; f_id++)
+    n_vals += s->f_size[f_id];
+
+  return n_vals*sizeof(cs_real_t) + s->p_size;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
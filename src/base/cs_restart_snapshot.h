@@ -0,0 +1,117 @@
+#ifndef __CS_RESTART_SNAPSHOT_H__
+#define __CS_RESTART_SNAPSHOT_H__
+
+/*============================================================================
+ * In-memory snapshots of the computation state.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*! Opaque computation state snapshot */
+
+typedef struct _cs_restart_snapshot_t  cs_restart_snapshot_t;
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a snapshot of the current computation state.
+ *
+ * \return  pointer to new snapshot
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_restart_snapshot_t *
+cs_restart_snapshot_create(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a computation state snapshot.
+ *
+ * \param[in, out]  s  pointer to snapshot pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_snapshot_destroy(cs_restart_snapshot_t  **s);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Replace a snapshot's contents with the current computation state.
+ *
+ * Buffers are reused when their size does not change.
+ *
+ * \param[in, out]  s  pointer to snapshot
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_snapshot_update(cs_restart_snapshot_t  *s);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Roll back the computation state to that of a snapshot.
+ *
+ * The snapshot is not modified, so it may be applied several times.
+ *
+ * \param[in]  s  pointer to snapshot
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_snapshot_apply(const cs_restart_snapshot_t  *s);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the local memory size of a snapshot's buffers.
+ *
+ * \param[in]  s  pointer to snapshot
+ *
+ * \return  size of local snapshot buffers, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_restart_snapshot_get_size(const cs_restart_snapshot_t  *s);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_RESTART_SNAPSHOT_H__ */
@@ -723,15 +723,17 @@ _sat_coupling_interpolate(cs_sat_coupling_t  *cpl)
 
   }
 
-  /* Get the distant weighting coefficients (reverse = 1) */
-
-  ple_locator_exchange_point_var(cpl->localis_fbr,
-                                 cpl->distant_pond_fbr,
-                                 cpl->local_pond_fbr,
-                                 nullptr,
-                                 sizeof(cs_real_t),
-                                 1,
-                                 1); /* reverse */
+  /* Get the distant weighting coefficients (reverse = 1);
+     the exchange is completed once local OF distances are computed */
+
+  ple_locator_exchange_t *pond_ex
+    = ple_locator_exchange_point_var_start(cpl->localis_fbr,
+                                           cpl->distant_pond_fbr,
+                                           cpl->local_pond_fbr,
+                                           nullptr,
+                                           sizeof(cs_real_t),
+                                           1,
+                                           1); /* reverse */
 
   /* Calculation of the OF distance */
   /*--------------------------------*/
@@ -770,6 +772,8 @@ _sat_coupling_interpolate(cs_sat_coupling_t  *cpl)
     }
   }
 
+  ple_locator_exchange_point_var_wait(&pond_ex);
+
   ple_locator_exchange_point_var(cpl->localis_fbr,
                                  cpl->distant_of,
                                  cpl->local_of,
@@ -2175,7 +2179,10 @@ cs_sat_coupling_locate_all
     if (coupl->cell_loc_sel != nullptr) BFT_FREE(c_elt_list);
     if (coupl->face_loc_sel != nullptr) BFT_FREE(f_elt_list);
 
-    /* Build and initialize associated locator */
+    /* Build and initialize associated locator; if it already exists,
+       only update point locations, starting from previous ones */
+
+    const bool relocate = (coupl->localis_cel != nullptr);
 
   #if defined(PLE_HAVE_MPI)
 
@@ -2218,19 +2225,34 @@ cs_sat_coupling_locate_all
                       point_tag);
     }
 
-    ple_locator_set_mesh(coupl->localis_cel,
-                         coupl->cells_sup,
-                         locator_options,
-                         0.,
-                         coupl->tolerance,
-                         3,
-                         nbr_cel_cpl,
-                         c_elt_list,
-                         point_tag,
-                         mesh_quantities->cell_cen,
-                         nullptr,
-                         cs_coupling_mesh_extents,
-                         cs_coupling_point_in_mesh_p);
+    if (relocate)
+      ple_locator_relocate(coupl->localis_cel,
+                           coupl->cells_sup,
+                           locator_options,
+                           0.,
+                           coupl->tolerance,
+                           3,
+                           nbr_cel_cpl,
+                           c_elt_list,
+                           point_tag,
+                           mesh_quantities->cell_cen,
+                           nullptr,
+                           cs_coupling_mesh_extents,
+                           cs_coupling_point_in_mesh_p);
+    else
+      ple_locator_set_mesh(coupl->localis_cel,
+                           coupl->cells_sup,
+                           locator_options,
+                           0.,
+                           coupl->tolerance,
+                           3,
+                           nbr_cel_cpl,
+                           c_elt_list,
+                           point_tag,
+                           mesh_quantities->cell_cen,
+                           nullptr,
+                           cs_coupling_mesh_extents,
+                           cs_coupling_point_in_mesh_p);
 
     ple_locator_shift_locations(coupl->localis_cel, -1);
 
@@ -2262,19 +2284,34 @@ cs_sat_coupling_locate_all
                       point_tag);
     }
 
-    ple_locator_set_mesh(coupl->localis_fbr,
-                         support_fbr,
-                         locator_options,
-                         0.,
-                         coupl->tolerance,
-                         3,
-                         nbr_fbr_cpl,
-                         f_elt_list,
-                         point_tag,
-                         mesh_quantities->b_face_cog,
-                         nullptr,
-                         cs_coupling_mesh_extents,
-                         cs_coupling_point_in_mesh_p);
+    if (relocate)
+      ple_locator_relocate(coupl->localis_fbr,
+                           support_fbr,
+                           locator_options,
+                           0.,
+                           coupl->tolerance,
+                           3,
+                           nbr_fbr_cpl,
+                           f_elt_list,
+                           point_tag,
+                           mesh_quantities->b_face_cog,
+                           nullptr,
+                           cs_coupling_mesh_extents,
+                           cs_coupling_point_in_mesh_p);
+    else
+      ple_locator_set_mesh(coupl->localis_fbr,
+                           support_fbr,
+                           locator_options,
+                           0.,
+                           coupl->tolerance,
+                           3,
+                           nbr_fbr_cpl,
+                           f_elt_list,
+                           point_tag,
+                           mesh_quantities->b_face_cog,
+                           nullptr,
+                           cs_coupling_mesh_extents,
+                           cs_coupling_point_in_mesh_p);
 
     ple_locator_shift_locations(coupl->localis_fbr, -1);
 
@@ -470,6 +470,9 @@ _create_variable_fields(void)
     cs_field_t *f = _add_variable_field("pressure", "Pressure", 1);
     cs_field_pointer_map(CS_ENUMF_(p), f);
 
+    // reuse pressure gradient when the pressure did not change
+    cs_field_set_key_int(f, cs_field_key_id("gradient_cache"), 1);
+
     cs_equation_param_t *eqp = cs_field_get_equation_param(f);
 
     // elliptic equation
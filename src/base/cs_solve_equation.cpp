@@ -1338,21 +1338,29 @@ cs_solve_equation_scalar(cs_field_t        *f,
   if (iscacp == 1 || iscacp == 2)
     imucpp = 1;
 
+  /* Uniform values are also set on ghost cells, so no halo
+     synchronization is needed (which avoids one exchange per
+     passive scalar) */
+
+  const bool uniform_cpp = (imucpp == 0 || CS_F_(cp) == NULL);
+  const cs_lnum_t n_cpp = (uniform_cpp) ? n_cells_ext : n_cells;
+
   if (imucpp == 0) {
-    cs_array_set_value_real(n_cells, 1, 1., xcpp);
+    cs_array_set_value_real(n_cpp, 1, 1., xcpp);
   }
   else if (imucpp == 1) {
     if (CS_F_(cp) != NULL)
-      cs_array_real_copy(n_cells, CS_F_(cp)->val, xcpp);
+      cs_array_real_copy(n_cpp, CS_F_(cp)->val, xcpp);
     else
-      cs_array_set_value_real(n_cells, 1, fluid_props->cp0, xcpp);
+      cs_array_set_value_real(n_cpp, 1, fluid_props->cp0, xcpp);
     if (iscacp == 2) {
       cs_real_t rair = fluid_props->r_pg_cnst;
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      for (cs_lnum_t c_id = 0; c_id < n_cpp; c_id++)
         xcpp[c_id] -= rair;
     }
   }
-  cs_halo_sync_var(m->halo, CS_HALO_STANDARD, xcpp);
+  if (!uniform_cpp)
+    cs_halo_sync_var(m->halo, CS_HALO_STANDARD, xcpp);
 
   /* Lagrangien (couplage retour thermique)
    * Ordre 2 non pris en compte */
@@ -1745,8 +1745,14 @@ _log_norm(const cs_mesh_t                *m,
                   " -------------------------\n"));
   cs_real_t rnorm = -1.0, rnormt = -1.0;
 
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
-    rnorm = fmax(rnorm, fabs(cvar_pr[c_id]));
+  cs_dispatch_context ctx;
+
+  double pr_max = -1.0;
+  ctx.parallel_for_reduce_max
+    (n_cells, pr_max, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    return fabs(cvar_pr[c_id]);
+  });
+  rnorm = cs_math_fmax(pr_max, -1.0);
   cs_parall_max(1, CS_REAL_TYPE, &rnorm);
 
   bft_printf("Max. pressure, %12.4e, (max. absolute value)\n", rnorm);
@@ -0,0 +1,486 @@
+/*============================================================================
+ * Acceleration of steady-state outer iterations.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <limits.h>
+#include <math.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "cs_field.h"
+#include "cs_field_operator.h"
+#include "cs_field_pointer.h"
+#include "cs_iter_algo.h"
+#include "cs_log.h"
+#include "cs_mesh_location.h"
+#include "cs_parall.h"
+#include "cs_time_step.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_steady_accel.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Additional doxygen documentation
+ *============================================================================*/
+
+/*!
+  \file cs_steady_accel.cpp
+        Acceleration of steady-state outer iterations.
+
+  With the steady algorithm, each outer iteration of the segregated
+  velocity-pressure and turbulence solution may be seen as a fixed-point
+  map x_{k+1} = G(x_k), where the state x stacks the values of all solved
+  cell-based variables and the velocity mass fluxes (which drive the
+  convection at the next iteration).
+
+  Anderson acceleration (using the \ref cs_iter_algo_t mechanism) replaces
+  G(x_k) by a combination of the last iterates minimizing the fixed-point
+  residual. Each variable is weighted by the inverse of its mean square
+  value, so that variables with different units contribute similarly.
+
+  The following safeguards are applied:
+  - if the fixed-point residual grows by more than a given factor (or is
+    not finite), the acceleration history is dropped, and the plain
+    iterate is kept;
+  - for turbulence variables which must remain positive, values which
+    would be made non-positive by the extrapolation are replaced by the
+    plain iterate.
+*/
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local type definitions
+ *============================================================================*/
+
+/* Part of the stacked state associated with a given field */
+
+typedef struct {
+
+  cs_field_t  *f;          /* associated field */
+  cs_lnum_t    s_id;       /* start id in stacked state */
+  cs_lnum_t    n_vals;     /* number of local values */
+  double       w;          /* weight in dot products */
+  bool         positive;   /* values must remain positive */
+
+} cs_steady_accel_block_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static cs_iter_algo_param_aac_t  _aac_param = {0,       /* n_max_dir */
+                                                2,       /* starting_iter */
+                                                -1,      /* max_cond */
+                                                0.,      /* beta */
+                                                CS_PARAM_DOTPROD_EUCLIDEAN};
+
+static double  _dtol = 10.;
+
+static cs_iter_algo_t  *_algo = nullptr;
+
+static int  _n_blocks = 0;
+static cs_steady_accel_block_t  *_blocks = nullptr;
+
+static cs_lnum_t  _n_vals = 0;
+static cs_real_t  *_x_prev = nullptr;   /* state at start of iteration */
+static cs_real_t  *_g = nullptr;        /* state at end of iteration */
+static cs_real_t  *_g_ref = nullptr;    /* non-accelerated state */
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Weighted dot product of stacked states.
+ *
+ * parameters:
+ *   a <-- first state
+ *   b <-- second state
+ *
+ * returns:
+ *   global weighted dot product
+ *----------------------------------------------------------------------------*/
+
+static double
+_dotprod(const cs_real_t  *a,
+         const cs_real_t  *b)
+{
+  double s = 0.;
+
+  for (int b_id = 0; b_id < _n_blocks; b_id++) {
+    const cs_steady_accel_block_t *bl = _blocks + b_id;
+    const cs_real_t *_a = a + bl->s_id, *_b = b + bl->s_id;
+    double s_b = 0.;
+#   pragma omp parallel for reduction(+:s_b) if (bl->n_vals > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < bl->n_vals; i++)
+      s_b += _a[i]*_b[i];
+    s += bl->w * s_b;
+  }
+
+  cs_parall_sum(1, CS_DOUBLE, &s);
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------
+ * Weighted square norm of a stacked state.
+ *
+ * parameters:
+ *   a <-- state
+ *
+ * returns:
+ *   global weighted square norm
+ *----------------------------------------------------------------------------*/
+
+static double
+_square_norm(const cs_real_t  *a)
+{
+  return _dotprod(a, a);
+}
+
+/*----------------------------------------------------------------------------
+ * Add a field to the stacked state definition.
+ *
+ * parameters:
+ *   f        <-- pointer to field
+ *   positive <-- are values required to remain positive ?
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_block(cs_field_t  *f,
+           bool         positive)
+{
+  BFT_REALLOC(_blocks, _n_blocks + 1, cs_steady_accel_block_t);
+
+  cs_steady_accel_block_t *bl = _blocks + _n_blocks;
+
+  bl->f = f;
+  bl->s_id = _n_vals;
+  bl->n_vals = cs_mesh_location_get_n_elts(f->location_id)[0] * f->dim;
+  bl->w = 1.;
+  bl->positive = positive;
+
+  _n_vals += bl->n_vals;
+  _n_blocks += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Build the stacked state definition.
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_blocks(void)
+{
+  const int n_fields = cs_field_n_fields();
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+    cs_field_t *f = cs_field_by_id(f_id);
+    if (   !(f->type & CS_FIELD_VARIABLE) || (f->type & CS_FIELD_CDO)
+        || f->location_id != CS_MESH_LOCATION_CELLS)
+      continue;
+    bool positive = (   f == CS_F_(k) || f == CS_F_(eps)
+                     || f == CS_F_(omg) || f == CS_F_(nusa));
+    _add_block(f, positive);
+  }
+
+  /* Mass fluxes are part of the state, as they are not recomputed
+     from the velocity at the start of the next iteration */
+
+  if (CS_F_(vel) != nullptr) {
+    const int kimasf = cs_field_key_id("inner_mass_flux_id");
+    const int kbmasf = cs_field_key_id("boundary_mass_flux_id");
+    int mf_id[2] = {cs_field_get_key_int(CS_F_(vel), kimasf),
+                    cs_field_get_key_int(CS_F_(vel), kbmasf)};
+    for (int i = 0; i < 2; i++) {
+      if (mf_id[i] > -1)
+        _add_block(cs_field_by_id(mf_id[i]), false);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Copy field values to a stacked state.
+ *
+ * parameters:
+ *   x --> stacked state
+ *----------------------------------------------------------------------------*/
+
+static void
+_pack(cs_real_t  x[])
+{
+  for (int b_id = 0; b_id < _n_blocks; b_id++) {
+    const cs_steady_accel_block_t *bl = _blocks + b_id;
+    memcpy(x + bl->s_id, bl->f->val, bl->n_vals*sizeof(cs_real_t));
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Copy a stacked state to field values, and synchronize ghost cells.
+ *
+ * parameters:
+ *   x <-- stacked state
+ *----------------------------------------------------------------------------*/
+
+static void
+_unpack(const cs_real_t  x[])
+{
+  for (int b_id = 0; b_id < _n_blocks; b_id++) {
+    const cs_steady_accel_block_t *bl = _blocks + b_id;
+    memcpy(bl->f->val, x + bl->s_id, bl->n_vals*sizeof(cs_real_t));
+    if (bl->f->location_id == CS_MESH_LOCATION_CELLS)
+      cs_field_synchronize(bl->f, CS_HALO_EXTENDED);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set block weights based on the inverse of the mean square value
+ * of each field in a given state.
+ *
+ * parameters:
+ *   x <-- stacked state
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_weights(const cs_real_t  x[])
+{
+  double *s;
+  BFT_MALLOC(s, 2*_n_blocks, double);
+
+  for (int b_id = 0; b_id < _n_blocks; b_id++) {
+    const cs_steady_accel_block_t *bl = _blocks + b_id;
+    const cs_real_t *_x = x + bl->s_id;
+    double s_b = 0.;
+#   pragma omp parallel for reduction(+:s_b) if (bl->n_vals > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < bl->n_vals; i++)
+      s_b += _x[i]*_x[i];
+    s[b_id*2] = s_b;
+    s[b_id*2 + 1] = bl->n_vals;
+  }
+
+  cs_parall_sum(2*_n_blocks, CS_DOUBLE, s);
+
+  for (int b_id = 0; b_id < _n_blocks; b_id++) {
+    if (s[b_id*2] > 0.)
+      _blocks[b_id].w = s[b_id*2 + 1] / s[b_id*2];
+  }
+
+  BFT_FREE(s);
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize acceleration structures, and save the current state.
+ *----------------------------------------------------------------------------*/
+
+static void
+_initialize(void)
+{
+  _define_blocks();
+
+  BFT_MALLOC(_x_prev, _n_vals, cs_real_t);
+  BFT_MALLOC(_g, _n_vals, cs_real_t);
+  BFT_MALLOC(_g_ref, _n_vals, cs_real_t);
+
+  _pack(_x_prev);
+  _set_weights(_x_prev);
+
+  cs_param_convergence_t cvg_param = {0.,         /* atol */
+                                      0.,         /* rtol */
+                                      _dtol,      /* dtol */
+                                      INT_MAX};   /* n_max_iter */
+
+  _algo = cs_iter_algo_create_with_settings(CS_ITER_ALGO_ANDERSON,
+                                            0,
+                                            cvg_param);
+
+  cs_iter_algo_set_anderson_param(_algo, _aac_param, _n_vals);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate Anderson acceleration of steady-state outer iterations.
+ *
+ * This is only used with the steady algorithm
+ * (idtvar = CS_TIME_STEP_STEADY).
+ *
+ * \param[in]  n_max_dir      maximum number of directions (0 to deactivate)
+ * \param[in]  starting_iter  number of plain iterations before acceleration
+ * \param[in]  max_cond       maximum condition number of the least-squares
+ *                            problem, or < 0 for no limit
+ * \param[in]  beta           relaxation coefficient (0 for none)
+ * \param[in]  dtol           acceleration is restarted when the fixed-point
+ *                            residual grows by more than this factor
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_accel_set_anderson(int     n_max_dir,
+                             int     starting_iter,
+                             double  max_cond,
+                             double  beta,
+                             double  dtol)
+{
+  if (_algo != nullptr)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: acceleration settings may not be modified\n"
+                "once the acceleration has started."), __func__);
+
+  _aac_param.n_max_dir = (n_max_dir > 0) ? n_max_dir : 0;
+  _aac_param.starting_iter = (starting_iter > 0) ? starting_iter : 0;
+  _aac_param.max_cond = max_cond;
+  _aac_param.beta = beta;
+
+  _dtol = dtol;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply acceleration at the end of a steady-state outer iteration.
+ *
+ * This is a collective operation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_accel_apply(void)
+{
+  if (   _aac_param.n_max_dir < 1
+      || cs_glob_time_step_options->idtvar != CS_TIME_STEP_STEADY)
+    return;
+
+  /* The first call only defines the iterate from which to start */
+
+  if (_algo == nullptr) {
+    _initialize();
+    return;
+  }
+
+  _pack(_g);
+
+  /* Fixed-point residual of the plain iteration */
+
+# pragma omp parallel for if (_n_vals > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < _n_vals; i++)
+    _g_ref[i] = _g[i] - _x_prev[i];
+
+  double res = sqrt(_square_norm(_g_ref));
+
+  /* Nothing to accelerate if the iterate did not change */
+
+  if (res <= 0.)
+    return;
+
+  cs_sles_convergence_state_t cvg = CS_SLES_DIVERGED;
+
+  if (isfinite(res)) {
+    cs_iter_algo_update_residual(_algo, res);
+    cvg = cs_iter_algo_update_cvg_tol_given(_algo, 0.);
+  }
+
+  if (cvg == CS_SLES_DIVERGED) {
+
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("\n Steady-state Anderson acceleration restarted\n"
+                    "   (fixed-point residual: %12.5e)\n"), res);
+
+    cs_iter_algo_reset(_algo);
+    memcpy(_x_prev, _g, _n_vals*sizeof(cs_real_t));
+    return;
+
+  }
+
+  memcpy(_g_ref, _g, _n_vals*sizeof(cs_real_t));
+
+  cs_iter_algo_update_anderson(_algo, _g, _x_prev, _dotprod, _square_norm);
+
+  /* Keep positive variables positive */
+
+  for (int b_id = 0; b_id < _n_blocks; b_id++) {
+    const cs_steady_accel_block_t *bl = _blocks + b_id;
+    if (bl->positive == false)
+      continue;
+    cs_real_t *g = _g + bl->s_id;
+    const cs_real_t *g_ref = _g_ref + bl->s_id;
+#   pragma omp parallel for if (bl->n_vals > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < bl->n_vals; i++) {
+      if (g[i] <= 0.)
+        g[i] = g_ref[i];
+    }
+  }
+
+  _unpack(_g);
+
+  memcpy(_x_prev, _g, _n_vals*sizeof(cs_real_t));
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free steady-state acceleration data.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_accel_finalize(void)
+{
+  cs_iter_algo_free(&_algo);
+
+  BFT_FREE(_g_ref);
+  BFT_FREE(_g);
+  BFT_FREE(_x_prev);
+  BFT_FREE(_blocks);
+
+  _n_blocks = 0;
+  _n_vals = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,92 @@
+#ifndef __CS_STEADY_ACCEL_H__
+#define __CS_STEADY_ACCEL_H__
+
+/*============================================================================
+ * Acceleration of steady-state outer iterations.
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate Anderson acceleration of steady-state outer iterations.
+ *
+ * This is only used with the steady algorithm
+ * (idtvar = CS_TIME_STEP_STEADY).
+ *
+ * \param[in]  n_max_dir      maximum number of directions (0 to deactivate)
+ * \param[in]  starting_iter  number of plain iterations before acceleration
+ * \param[in]  max_cond       maximum condition number of the least-squares
+ *                            problem, or < 0 for no limit
+ * \param[in]  beta           relaxation coefficient (0 for none)
+ * \param[in]  dtol           acceleration is restarted when the fixed-point
+ *                            residual grows by more than this factor
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_accel_set_anderson(int     n_max_dir,
+                             int     starting_iter,
+                             double  max_cond,
+                             double  beta,
+                             double  dtol);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Apply acceleration at the end of a steady-state outer iteration.
+ *
+ * This is a collective operation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_accel_apply(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free steady-state acceleration data.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_steady_accel_finalize(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_STEADY_ACCEL_H__ */
@@ -59,6 +59,7 @@
 #include "cs_restart_default.h"
 #include "cs_prototypes.h"
 #include "cs_time_step.h"
+#include "cs_volume_zone.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -226,6 +227,7 @@ static cs_time_moment_t *_moment = NULL;
 
 static  bool _restart_info_checked = false;
 static  bool _restart_uses_main = false;
+static  double _restart_tolerance = -1.;
 static  cs_time_moment_restart_info_t *_restart_info = NULL;
 
 static double _t_prev_iter = 0.;
@@ -272,6 +274,128 @@ _assert_restart_success(int retcode)
               _("Error reading expected section in restart file."));
 }
 
+/*----------------------------------------------------------------------------
+ * Read a restart section for values on a given mesh location.
+ *
+ * Values on a subset of a main location (such as a volume zone) are
+ * stored on the parent location in restart files, with a value of 0
+ * outside the subset.
+ *
+ * parameters:
+ *   r           <-- associated restart file pointer
+ *   sec_name    <-- section name
+ *   location_id <-- associated mesh location id
+ *   dim         <-- number of values per element
+ *   val         --> values
+ *
+ * returns:
+ *   CS_RESTART_SUCCESS in case of success, error code otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_restart_read_section_on_location(cs_restart_t  *r,
+                                  const char    *sec_name,
+                                  int            location_id,
+                                  int            dim,
+                                  cs_real_t     *val)
+{
+  const int p_location_id = cs_mesh_location_get_type(location_id);
+
+  if (p_location_id == location_id || location_id == CS_MESH_LOCATION_NONE)
+    return cs_restart_read_section(r,
+                                   sec_name,
+                                   location_id,
+                                   dim,
+                                   CS_TYPE_cs_real_t,
+                                   val);
+
+  const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(location_id)[0];
+  const cs_lnum_t n_p_elts = cs_mesh_location_get_n_elts(p_location_id)[0];
+  const cs_lnum_t *elt_ids = cs_mesh_location_get_elt_ids_try(location_id);
+
+  cs_real_t *p_val;
+  BFT_MALLOC(p_val, n_p_elts*dim, cs_real_t);
+
+  int retcode = cs_restart_read_section(r,
+                                        sec_name,
+                                        p_location_id,
+                                        dim,
+                                        CS_TYPE_cs_real_t,
+                                        p_val);
+
+  if (retcode == CS_RESTART_SUCCESS) {
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      const cs_lnum_t e_id = (elt_ids != NULL) ? elt_ids[i] : i;
+      for (int j = 0; j < dim; j++)
+        val[i*dim + j] = p_val[e_id*dim + j];
+    }
+  }
+
+  BFT_FREE(p_val);
+
+  return retcode;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a restart section for values on a given mesh location.
+ *
+ * Values on a subset of a main location (such as a volume zone) are
+ * stored on the parent location in restart files, with a value of 0
+ * outside the subset.
+ *
+ * parameters:
+ *   r           <-- associated restart file pointer
+ *   sec_name    <-- section name
+ *   location_id <-- associated mesh location id
+ *   dim         <-- number of values per element
+ *   val         <-- values
+ *----------------------------------------------------------------------------*/
+
+static void
+_restart_write_section_on_location(cs_restart_t     *r,
+                                   const char       *sec_name,
+                                   int               location_id,
+                                   int               dim,
+                                   const cs_real_t  *val)
+{
+  const int p_location_id = cs_mesh_location_get_type(location_id);
+
+  if (p_location_id == location_id || location_id == CS_MESH_LOCATION_NONE) {
+    cs_restart_write_section(r,
+                             sec_name,
+                             location_id,
+                             dim,
+                             CS_TYPE_cs_real_t,
+                             val);
+    return;
+  }
+
+  const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(location_id)[0];
+  const cs_lnum_t n_p_elts = cs_mesh_location_get_n_elts(p_location_id)[0];
+  const cs_lnum_t *elt_ids = cs_mesh_location_get_elt_ids_try(location_id);
+
+  cs_real_t *p_val;
+  BFT_MALLOC(p_val, n_p_elts*dim, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_p_elts*dim; i++)
+    p_val[i] = 0.;
+
+  for (cs_lnum_t i = 0; i < n_elts; i++) {
+    const cs_lnum_t e_id = (elt_ids != NULL) ? elt_ids[i] : i;
+    for (int j = 0; j < dim; j++)
+      p_val[e_id*dim + j] = val[i*dim + j];
+  }
+
+  cs_restart_write_section(r,
+                           sec_name,
+                           p_location_id,
+                           dim,
+                           CS_TYPE_cs_real_t,
+                           p_val);
+
+  BFT_FREE(p_val);
+}
+
 /*----------------------------------------------------------------------------
  * Read restart metadata.
  *
@@ -716,6 +840,7 @@ _build_sd_desc(int        n_fields,
  *
  * parameters:
  *   name         <-- name of associated decription
+ *   location_id  <-- associated mesh location id, or -1 for that of fields
  *   n_fields     <-- number of multiplying fields
  *   field_id     <-- array of ids of multiplying fields
  *   comp_id      <-- array of ids of multiplying components
@@ -727,6 +852,7 @@ _build_sd_desc(int        n_fields,
 
 static int
 _find_or_add_sd(const char  *name,
+                int          location_id,
                 int          n_fields,
                 const int    f_id[],
                 const int    c_id[],
@@ -747,70 +873,25 @@ _find_or_add_sd(const char  *name,
     *is_intensive = (*is_intensive) && (f->type & CS_FIELD_INTENSIVE);
   }
 
-  /* Check if this definition has already been provided (assume field and
-     component ids are given in same order; at worse, if this is not the case
-     some data which could be shared will be duplicated, leading to slightly
-     higher memory usage and computational cost)
-
-     Also check if the time moment is a combination of intensive fields
-     and therefore is an intensive field
-     */
-
-  for (sd_id = 0; sd_id < _n_moment_sd_defs; sd_id++) {
-    bool is_different = false;
-    const int *msd = _moment_sd_defs[sd_id];
-    const int stride = 2 + msd[1];
-    if (n_fields != msd[2])
-      is_different = true;
-    else {
-      for (int i = 0; i < n_fields; i++) {
-        const cs_field_t *f = cs_field_by_id(f_id[i]);
-        const int _c_id = (f->dim > 1) ? c_id[i] : 0;
-        if (   msd[3 + i*stride] != f_id[i]
-            || msd[3 + i*stride+1] != _c_id)
-          is_different = true;
-      }
-    }
-    if (! is_different)
-      return sd_id;
-  }
-
-  /* If we did not return yet, a new structure must be added */
-
-  /* Reallocate if necessary */
-
-  if (_n_moment_sd_defs + 1 > _n_moment_sd_defs_max) {
-    if (_n_moment_sd_defs_max < 1)
-      _n_moment_sd_defs_max = 2;
-    else
-      _n_moment_sd_defs_max *= 2;
-    BFT_REALLOC(_moment_sd_defs,
-                _n_moment_sd_defs_max,
-                int *);
-  }
-
-  sd_id = _n_moment_sd_defs;
-  _n_moment_sd_defs += 1;
-
   /* Determine location and dimension */
 
-  int location_id = CS_MESH_LOCATION_NONE;
+  int f_location_id = CS_MESH_LOCATION_NONE;
   int dim = 1;
 
   for (int i = 0; i < n_fields; i++) {
     const cs_field_t *f = cs_field_by_id(f_id[i]);
-    if (location_id != f->location_id) {
-      if (location_id != CS_MESH_LOCATION_NONE) {
+    if (f_location_id != f->location_id) {
+      if (f_location_id != CS_MESH_LOCATION_NONE) {
         _build_sd_desc(n_fields, f_id, c_id, 256, sd_desc);
         bft_error
           (__FILE__, __LINE__, 0,
            _("Definition of simple data used for %s:\n"
              "%s\n"
              "mixes fields with location id %d and location id %d."),
-           name, sd_desc, location_id, f->location_id);
+           name, sd_desc, f_location_id, f->location_id);
       }
       else
-        location_id = f->location_id;
+        f_location_id = f->location_id;
     }
     if (c_id[i] < 0) { /* All components */
       if (f->dim != 1  && f->dim != 3 && f->dim != 6 && f->dim != 9) {
@@ -849,6 +930,69 @@ _find_or_add_sd(const char  *name,
     }
   }
 
+  /* Data may be restricted to a subset of the fields location */
+
+  int d_location_id = f_location_id;
+
+  if (location_id > -1 && location_id != f_location_id) {
+    if (   f_location_id != CS_MESH_LOCATION_NONE
+        && (int)cs_mesh_location_get_type(location_id) != f_location_id) {
+      _build_sd_desc(n_fields, f_id, c_id, 256, sd_desc);
+      bft_error
+        (__FILE__, __LINE__, 0,
+         _("Definition of simple data used for %s:\n"
+           "%s\n"
+           "uses location id %d, not a subset of field location id %d."),
+         name, sd_desc, location_id, f_location_id);
+    }
+    d_location_id = location_id;
+  }
+
+  /* Check if this definition has already been provided (assume field and
+     component ids are given in same order; at worse, if this is not the case
+     some data which could be shared will be duplicated, leading to slightly
+     higher memory usage and computational cost)
+
+     Also check if the time moment is a combination of intensive fields
+     and therefore is an intensive field
+     */
+
+  for (sd_id = 0; sd_id < _n_moment_sd_defs; sd_id++) {
+    bool is_different = false;
+    const int *msd = _moment_sd_defs[sd_id];
+    const int stride = 2 + msd[1];
+    if (n_fields != msd[2] || d_location_id != msd[0])
+      is_different = true;
+    else {
+      for (int i = 0; i < n_fields; i++) {
+        const cs_field_t *f = cs_field_by_id(f_id[i]);
+        const int _c_id = (f->dim > 1) ? c_id[i] : 0;
+        if (   msd[3 + i*stride] != f_id[i]
+            || msd[3 + i*stride+1] != _c_id)
+          is_different = true;
+      }
+    }
+    if (! is_different)
+      return sd_id;
+  }
+
+  /* If we did not return yet, a new structure must be added */
+
+  /* Reallocate if necessary */
+
+  if (_n_moment_sd_defs + 1 > _n_moment_sd_defs_max) {
+    if (_n_moment_sd_defs_max < 1)
+      _n_moment_sd_defs_max = 2;
+    else
+      _n_moment_sd_defs_max *= 2;
+    BFT_REALLOC(_moment_sd_defs,
+                _n_moment_sd_defs_max,
+                int *);
+  }
+
+  sd_id = _n_moment_sd_defs;
+  _n_moment_sd_defs += 1;
+
   /* Now initialize members */
 
   int stride = 2 + dim;
@@ -859,7 +1003,7 @@ _find_or_add_sd(const char  *name,
 
   _moment_sd_defs[sd_id] = msd;
 
-  msd[0] = location_id;
+  msd[0] = d_location_id;
   msd[1] = dim;
   msd[2] = n_fields;
 
@@ -954,6 +1098,12 @@ _sd_moment_data(const void  *input,
 
   const cs_lnum_t n_elts = cs_mesh_location_get_n_elts(location_id)[0];
 
+  /* Parent element ids if data is restricted to a subset of
+     the fields location (NULL for identity) */
+  const cs_lnum_t *elt_ids = NULL;
+  if ((int)cs_mesh_location_get_type(location_id) != location_id)
+    elt_ids = cs_mesh_location_get_elt_ids_try(location_id);
+
   int _f_dim[16*2];
   int *f_dim;
 
@@ -990,13 +1140,15 @@ _sd_moment_data(const void  *input,
 
   /* Now compute values */
 
+# pragma omp parallel for if (n_elts > CS_THR_MIN)
   for (cs_lnum_t  i = 0; i < n_elts; i++) {
+    const cs_lnum_t e_id = (elt_ids != NULL) ? elt_ids[i] : i;
     const cs_real_t *restrict v = f_val[0];
     cs_lnum_t m0 = f_dim[0];
     cs_lnum_t m1 = f_dim[1];
     for (cs_lnum_t k = 0; k < dim; k++) {
       cs_lnum_t c_id = msd[3 + 2 + k]; /* as below, with j = 0 */
-      vals[i*dim + k] = v[m0*i + m1*c_id];
+      vals[i*dim + k] = v[m0*e_id + m1*c_id];
     }
     for (int j = 1; j < n_fields; j++) {
       v = f_val[j];
@@ -1004,7 +1156,7 @@ _sd_moment_data(const void  *input,
       m1 = f_dim[j*2 + 1];
       for (cs_lnum_t k = 0; k < dim; k++) {
         cs_lnum_t c_id = msd[3 + j*stride + 2 + k];
-        vals[i*dim + k] *= v[m0*i + m1*c_id];
+        vals[i*dim + k] *= v[m0*e_id + m1*c_id];
       }
     }
   }
@@ -1542,7 +1694,75 @@ cs_time_moment_define_by_field_ids(const char                *name,
 {
   int m_id = -1;
   bool is_intensive = true;
-  int sd_id =_find_or_add_sd(name, n_fields, field_id, component_id,
+  int sd_id =_find_or_add_sd(name, -1, n_fields, field_id, component_id,
+                             &is_intensive);
+
+  const int *msd = _moment_sd_defs[sd_id];
+
+  m_id = cs_time_moment_define_by_func(name,
+                                       msd[0],
+                                       msd[1],
+                                       is_intensive,
+                                       _sd_moment_data,
+                                       msd,
+                                       NULL,
+                                       NULL,
+                                       type,
+                                       nt_start,
+                                       t_start,
+                                       restart_mode,
+                                       restart_name);
+
+  return m_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a moment of a product of existing fields components,
+ *        restricted to a volume zone.
+ *
+ * This is similar to \ref cs_time_moment_define_by_field_ids, but the
+ * moment is only computed and stored on the cells of the given zone,
+ * so its memory and update costs are proportional to the zone size.
+ * The associated field is defined on the zone's mesh location.
+ *
+ * Associated fields must be defined on cells (or be global values).
+ *
+ * \param[in]  name           name of associated moment
+ * \param[in]  z_name         name of associated volume zone
+ * \param[in]  n_fields       number of associated fields
+ * \param[in]  field_id       ids of associated fields
+ * \param[in]  component_id   ids of matching field components (-1 for all)
+ * \param[in]  type           moment type
+ * \param[in]  nt_start       starting time step (or -1 to use t_start)
+ * \param[in]  t_start        starting time
+ * \param[in]  restart_mode   behavior in case of restart (reset,
+ *                            automatic, or strict)
+ * \param[in]  restart_name   if not NULL, previous name in case of restart
+ *
+ * \return id of new moment in case of success, -1 in case of error.
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_time_moment_define_by_field_ids_on_zone
+  (const char                *name,
+   const char                *z_name,
+   int                        n_fields,
+   const int                  field_id[],
+   const int                  component_id[],
+   cs_time_moment_type_t      type,
+   int                        nt_start,
+   double                     t_start,
+   cs_time_moment_restart_t   restart_mode,
+   const char                *restart_name)
+{
+  const cs_zone_t *z = cs_volume_zone_by_name(z_name);
+
+  int m_id = -1;
+  bool is_intensive = true;
+  int sd_id =_find_or_add_sd(name, z->location_id,
+                             n_fields, field_id, component_id,
                              &is_intensive);
 
   const int *msd = _moment_sd_defs[sd_id];
@@ -2047,7 +2267,16 @@ cs_time_moment_update_all(void)
       wa_cur_data[i] = NULL;
   }
 
-  /* Loop on variances first */
+  /* Determine moments to update, variances first (as the associated
+     means are updated at the same time) */
+
+  int n_m_update = 0;
+  int *m_update_id, *m_data_id;
+  BFT_MALLOC(m_update_id, _n_moments, int);
+  BFT_MALLOC(m_data_id, _n_moments, int);
+
+  for (i = 0; i < _n_moments; i++)
+    m_data_id[i] = -1;
 
   for (int m_type = CS_TIME_MOMENT_VARIANCE;
        m_type >= (int)CS_TIME_MOMENT_MEAN;
@@ -2062,140 +2291,212 @@ cs_time_moment_update_all(void)
           && (int)(mt->type) == m_type
           && (mwa->nt_start > -1 && mwa->nt_start <= ts->nt_cur)) {
 
-        /* Current and accumulated weight */
+        bool handled = false;
+        if (mt->type == CS_TIME_MOMENT_MEAN) {
+          for (int j = 0; j < n_m_update; j++) {
+            if (_moment[m_update_id[j]].l_id == i)
+              handled = true;
+          }
+        }
 
-        cs_lnum_t  wa_stride;
-        cs_real_t *restrict wa_sum, *restrict x;
+        if (! handled) {
+          m_update_id[n_m_update] = i;
+          n_m_update++;
+        }
 
-        cs_real_t *const restrict w = wa_cur_data[mt->wa_id];
+      }
 
-        if (mwa->location_id == CS_MESH_LOCATION_NONE) {
-          wa_sum = &(mwa->val0);
-          wa_stride = 0;
-        }
-        else {
-          wa_sum = mwa->val;
-          wa_stride = 1;
-        }
+    }
 
-        /* Current value */
+  }
 
-        const cs_lnum_t n_elts
-          = cs_mesh_location_get_n_elts(mt->location_id)[0];
-        const cs_lnum_t nd = n_elts * mt->dim;
+  /* Moments sharing the same data definition (for example with different
+     weight accumulators or start times) share the computed data:
+     m_data_id[i] is the id of the first such moment, and data_ref_count
+     counts remaining uses, so that data is freed after its last use. */
 
-        BFT_MALLOC(x, nd, cs_real_t);
+  cs_real_t **m_data;
+  int *data_ref_count;
+  BFT_MALLOC(m_data, _n_moments, cs_real_t *);
+  BFT_MALLOC(data_ref_count, _n_moments, int);
 
-        mt->data_func(mt->data_input, x);
+  for (i = 0; i < _n_moments; i++) {
+    m_data[i] = NULL;
+    data_ref_count[i] = 0;
+  }
 
-        _ensure_init_moment(mt);
+  for (int j = 0; j < n_m_update; j++) {
+    const cs_time_moment_t *mt = _moment + m_update_id[j];
+    int d_id = m_update_id[j];
+    for (int j1 = 0; j1 < j; j1++) {
+      const cs_time_moment_t *mt1 = _moment + m_update_id[j1];
+      if (   mt->location_id == mt1->location_id
+          && mt->data_dim == mt1->data_dim
+          && mt->data_func == mt1->data_func
+          && mt->data_input == mt1->data_input) {
+        d_id = m_data_id[m_update_id[j1]];
+        break;
+      }
+    }
+    m_data_id[m_update_id[j]] = d_id;
+    data_ref_count[d_id] += 1;
+  }
 
-        cs_real_t *restrict val = mt->val;
-        if (mt->f_id > -1) {
-          cs_field_t *f = cs_field_by_id(mt->f_id);
-          val = f->val;
-        }
+  /* Now update moments */
 
-        if (mt->type == CS_TIME_MOMENT_VARIANCE) {
+  for (int j_update = 0; j_update < n_m_update; j_update++) {
 
-          assert(mt->l_id > -1);
+    i = m_update_id[j_update];
 
-          cs_time_moment_t *mt_mean = _moment + mt->l_id;
+    cs_time_moment_t *mt = _moment + i;
+    cs_time_moment_wa_t *mwa = _moment_wa + mt->wa_id;
 
-          _ensure_init_moment(mt_mean);
-          cs_real_t *restrict m = mt_mean->val;
-          if (mt_mean->f_id > -1) {
-            cs_field_t *f_mean = cs_field_by_id(mt_mean->f_id);
-            m = f_mean->val;
-          }
+    /* Current and accumulated weight */
 
-          if (mt->dim == 6) { /* variance-covariance matrix */
-            assert(mt->data_dim == 3);
-            for (cs_lnum_t je = 0; je < n_elts; je++) {
-              double delta[3], delta_n[3], r[3], m_n[3];
-              const cs_lnum_t k = je*wa_stride;
-              const double wa_sum_n = w[k] + wa_sum[k];
-              for (cs_lnum_t l = 0; l < 3; l++) {
-                cs_lnum_t jl = je*6 + l, jml = je*3 + l;
-                delta[l]   = x[jml] - m[jml];
-                r[l] = delta[l] * (w[k] / wa_sum_n);
-                m_n[l] = m[jml] + r[l];
-                delta_n[l] = x[jml] - m_n[l];
-                val[jl] =   (val[jl]*wa_sum[k] + (w[k]*delta[l]*delta_n[l]))
-                          / wa_sum_n;
-              }
-              /* Covariance terms.
-                 Note we could have a symmetric formula using
-                   0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
-                 instead of
-                   delta[i]*delta_n[j]
-                 but unit tests in cs_moment_test.c do not seem to favor
-                 one variant over the other; we use the simplest one.
-              */
-              cs_lnum_t j3 = je*6 + 3, j4 = je*6 + 4, j5 = je*6 + 5;
-              val[j3] =   (val[j3]*wa_sum[k] + (w[k]*delta[0]*delta_n[1]))
-                        / wa_sum_n;
-              val[j4] =   (val[j4]*wa_sum[k] + (w[k]*delta[1]*delta_n[2]))
-                        / wa_sum_n;
-              val[j5] =   (val[j5]*wa_sum[k] + (w[k]*delta[0]*delta_n[2]))
-                        / wa_sum_n;
-              for (cs_lnum_t l = 0; l < 3; l++)
-                m[je*3 + l] += r[l];
-            }
-          }
+    cs_lnum_t  wa_stride;
+    cs_real_t *restrict wa_sum;
 
-          else { /* simple variance */
-            for (cs_lnum_t j = 0; j < nd; j++) {
-              const cs_lnum_t k = (j*wa_stride) / mt->dim;
-              double wa_sum_n = w[k] + wa_sum[k];
-              double delta = x[j] - m[j];
-              double r = delta * (w[k] / wa_sum_n);
-              double m_n = m[j] + r;
-              val[j] = (val[j]*wa_sum[k] + (w[k]*delta*(x[j]-m_n))) / wa_sum_n;
-              m[j] += r;
-            }
-          }
+    cs_real_t *const restrict w = wa_cur_data[mt->wa_id];
 
-          mt_mean->nt_cur = ts->nt_cur;
-        }
+    if (mwa->location_id == CS_MESH_LOCATION_NONE) {
+      wa_sum = &(mwa->val0);
+      wa_stride = 0;
+    }
+    else {
+      wa_sum = mwa->val;
+      wa_stride = 1;
+    }
+
+    /* Current value */
+
+    const cs_lnum_t n_elts
+      = cs_mesh_location_get_n_elts(mt->location_id)[0];
+    const cs_lnum_t nd = n_elts * mt->dim;
+
+    const int d_id = m_data_id[i];
+
+    if (m_data[d_id] == NULL) {
+      BFT_MALLOC(m_data[d_id], n_elts * mt->data_dim, cs_real_t);
+      mt->data_func(mt->data_input, m_data[d_id]);
+    }
+
+    const cs_real_t *restrict x = m_data[d_id];
 
-        else if (mt->type == CS_TIME_MOMENT_MEAN) {
+    _ensure_init_moment(mt);
 
-          for (cs_lnum_t j = 0; j < nd; j++) {
-            const cs_lnum_t k = (j*wa_stride) / mt->dim;
-            val[j] += (x[j] - val[j]) * (w[k] / (w[k] + wa_sum[k]));
+    cs_real_t *restrict val = mt->val;
+    if (mt->f_id > -1) {
+      cs_field_t *f = cs_field_by_id(mt->f_id);
+      val = f->val;
+    }
+
+    if (mt->type == CS_TIME_MOMENT_VARIANCE) {
+
+      assert(mt->l_id > -1);
+
+      cs_time_moment_t *mt_mean = _moment + mt->l_id;
+
+      _ensure_init_moment(mt_mean);
+      cs_real_t *restrict m = mt_mean->val;
+      if (mt_mean->f_id > -1) {
+        cs_field_t *f_mean = cs_field_by_id(mt_mean->f_id);
+        m = f_mean->val;
+      }
+
+      if (mt->dim == 6) { /* variance-covariance matrix */
+        assert(mt->data_dim == 3);
+#       pragma omp parallel for if (n_elts > CS_THR_MIN)
+        for (cs_lnum_t je = 0; je < n_elts; je++) {
+          double delta[3], delta_n[3], r[3], m_n[3];
+          const cs_lnum_t k = je*wa_stride;
+          const double wa_sum_n = w[k] + wa_sum[k];
+          for (cs_lnum_t l = 0; l < 3; l++) {
+            cs_lnum_t jl = je*6 + l, jml = je*3 + l;
+            delta[l]   = x[jml] - m[jml];
+            r[l] = delta[l] * (w[k] / wa_sum_n);
+            m_n[l] = m[jml] + r[l];
+            delta_n[l] = x[jml] - m_n[l];
+            val[jl] =   (val[jl]*wa_sum[k] + (w[k]*delta[l]*delta_n[l]))
+                      / wa_sum_n;
           }
+          /* Covariance terms.
+             Note we could have a symmetric formula using
+               0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
+             instead of
+               delta[i]*delta_n[j]
+             but unit tests in cs_moment_test.c do not seem to favor
+             one variant over the other; we use the simplest one.
+          */
+          cs_lnum_t j3 = je*6 + 3, j4 = je*6 + 4, j5 = je*6 + 5;
+          val[j3] =   (val[j3]*wa_sum[k] + (w[k]*delta[0]*delta_n[1]))
+                    / wa_sum_n;
+          val[j4] =   (val[j4]*wa_sum[k] + (w[k]*delta[1]*delta_n[2]))
+                    / wa_sum_n;
+          val[j5] =   (val[j5]*wa_sum[k] + (w[k]*delta[0]*delta_n[2]))
+                    / wa_sum_n;
+          for (cs_lnum_t l = 0; l < 3; l++)
+            m[je*3 + l] += r[l];
+        }
+      }
 
+      else { /* simple variance */
+#       pragma omp parallel for if (nd > CS_THR_MIN)
+        for (cs_lnum_t j = 0; j < nd; j++) {
+          const cs_lnum_t k = (j*wa_stride) / mt->dim;
+          double wa_sum_n = w[k] + wa_sum[k];
+          double delta = x[j] - m[j];
+          double r = delta * (w[k] / wa_sum_n);
+          double m_n = m[j] + r;
+          val[j] = (val[j]*wa_sum[k] + (w[k]*delta*(x[j]-m_n))) / wa_sum_n;
+          m[j] += r;
         }
+      }
+
+      mt_mean->nt_cur = ts->nt_cur;
+    }
+
+    else if (mt->type == CS_TIME_MOMENT_MEAN) {
+
+#     pragma omp parallel for if (nd > CS_THR_MIN)
+      for (cs_lnum_t j = 0; j < nd; j++) {
+        const cs_lnum_t k = (j*wa_stride) / mt->dim;
+        val[j] += (x[j] - val[j]) * (w[k] / (w[k] + wa_sum[k]));
+      }
+
+    }
 
-        mt->nt_cur = ts->nt_cur;
-
-        BFT_FREE(x);
-
-        /* Sync ghost cells so downstream use is safe */
-
-        if (mt->location_id == CS_MESH_LOCATION_CELLS) {
-          const cs_halo_t *halo = cs_glob_mesh->halo;
-          if (halo != NULL) {
-            if (mt->dim == 1)
-              cs_halo_sync_var(halo, CS_HALO_EXTENDED, val);
-            else {
-              cs_halo_sync_var_strided(halo, CS_HALO_EXTENDED, val, mt->dim);
-              if (halo->n_transforms > 0) {
-                if (mt->dim == 3)
-                  cs_halo_perio_sync_var_vect(halo, CS_HALO_EXTENDED, val, 3);
-                else if (mt->dim == 6)
-                  cs_halo_perio_sync_var_sym_tens(halo, CS_HALO_EXTENDED, val);
-              }
-            }
+    mt->nt_cur = ts->nt_cur;
+
+    data_ref_count[d_id] -= 1;
+    if (data_ref_count[d_id] == 0)
+      BFT_FREE(m_data[d_id]);
+
+    /* Sync ghost cells so downstream use is safe */
+
+    if (mt->location_id == CS_MESH_LOCATION_CELLS) {
+      const cs_halo_t *halo = cs_glob_mesh->halo;
+      if (halo != NULL) {
+        if (mt->dim == 1)
+          cs_halo_sync_var(halo, CS_HALO_EXTENDED, val);
+        else {
+          cs_halo_sync_var_strided(halo, CS_HALO_EXTENDED, val, mt->dim);
+          if (halo->n_transforms > 0) {
+            if (mt->dim == 3)
+              cs_halo_perio_sync_var_vect(halo, CS_HALO_EXTENDED, val, 3);
+            else if (mt->dim == 6)
+              cs_halo_perio_sync_var_sym_tens(halo, CS_HALO_EXTENDED, val);
           }
         }
+      }
+    }
 
-      } /* End of test if moment is active */
 
-    } /* End of loop on moments */
+  } /* End of loop on moments to update */
 
-  } /* End of loop on moment types */
+  BFT_FREE(data_ref_count);
+  BFT_FREE(m_data);
+  BFT_FREE(m_data_id);
+  BFT_FREE(m_update_id);
 
   /* Update and free weight data */
 
@@ -2591,6 +2892,26 @@ cs_time_moment_restart_use_main(int  use_main)
     _restart_uses_main = false;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define error bound for lossy compression of checkpointed
+ *        moment values.
+ *
+ * Moment values are averages, for which a bounded error is usually
+ * acceptable, while weight accumulators are always saved without loss.
+ * \sa cs_restart_set_lossy_tolerance.
+ *
+ * \param[in]  tolerance  absolute error bound, 0 for lossless output,
+ *                        or < 0 to use the restart file's setting
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_restart_set_tolerance(double  tolerance)
+{
+  _restart_tolerance = tolerance;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read restart moment data
@@ -2625,12 +2946,11 @@ cs_time_moment_restart_read(cs_restart_t  *restart)
       char s[64];
       snprintf(s, 64, "time_moments:wa:%02d:val", mwa->restart_id);
       _ensure_init_weight_accumulator(mwa);
-      retcode = cs_restart_read_section(restart,
-                                        s,
-                                        mwa->location_id,
-                                        1,
-                                        CS_TYPE_cs_real_t,
-                                        mwa->val);
+      retcode = _restart_read_section_on_location(restart,
+                                                  s,
+                                                  mwa->location_id,
+                                                  1,
+                                                  mwa->val);
       _assert_restart_success(retcode);
     }
   }
@@ -2644,12 +2964,11 @@ cs_time_moment_restart_read(cs_restart_t  *restart)
         cs_field_t *f = cs_field_by_id(mt->f_id);
         val = f->val;
       }
-      retcode = cs_restart_read_section(restart,
-                                        ri->name[mt->restart_id],
-                                        mt->location_id,
-                                        mt->dim,
-                                        CS_TYPE_cs_real_t,
-                                        val);
+      retcode = _restart_read_section_on_location(restart,
+                                                  ri->name[mt->restart_id],
+                                                  mt->location_id,
+                                                  mt->dim,
+                                                  val);
       _assert_restart_success(retcode);
     }
   }
@@ -2835,12 +3154,11 @@ cs_time_moment_restart_write(cs_restart_t  *restart)
     if (j > -1 && mwa->location_id > CS_MESH_LOCATION_NONE) {
       char s[64];
       snprintf(s, 64, "time_moments:wa:%02d:val", i);
-      cs_restart_write_section(restart,
-                               s,
-                               mwa->location_id,
-                               1,
-                               CS_TYPE_cs_real_t,
-                               mwa->val);
+      _restart_write_section_on_location(restart,
+                                         s,
+                                         mwa->location_id,
+                                         1,
+                                         mwa->val);
     }
   }
 
@@ -2908,33 +3226,183 @@ cs_time_moment_restart_write(cs_restart_t  *restart)
   BFT_FREE(location_id);
   BFT_FREE(m_type);
 
+  /* Moment values proper, possibly with lossy compression */
+
+  double tolerance_prev = cs_restart_get_lossy_tolerance(restart);
+  if (_restart_tolerance >= 0)
+    cs_restart_set_lossy_tolerance(restart, _restart_tolerance);
+
   for (int i = 0; i < _n_moments; i++) {
     int j = active_moment_id[i];
     if (j > -1) {
       cs_time_moment_t *mt = _moment + i;
       if (mt->f_id > -1) {
         const cs_field_t *f = cs_field_by_id(mt->f_id);
-        cs_restart_write_section(restart,
-                                 f->name,
-                                 f->location_id,
-                                 f->dim,
-                                 CS_TYPE_cs_real_t,
-                                 f->val);
+        _restart_write_section_on_location(restart,
+                                           f->name,
+                                           f->location_id,
+                                           f->dim,
+                                           f->val);
       }
       else
-        cs_restart_write_section(restart,
-                                 mt->name,
-                                 mt->location_id,
-                                 mt->dim,
-                                 CS_TYPE_cs_real_t,
-                                 mt->val);
+        _restart_write_section_on_location(restart,
+                                           mt->name,
+                                           mt->location_id,
+                                           mt->dim,
+                                           mt->val);
     }
   }
 
+  cs_restart_set_lossy_tolerance(restart, tolerance_prev);
+
   BFT_FREE(active_moment_id);
   BFT_FREE(active_wa_id);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the local size of a moments state snapshot.
+ *
+ * The snapshot includes weight accumulators and the values of moments
+ * not based on a field (field values are handled with other fields).
+ *
+ * \return  number of values required by \ref cs_time_moment_snapshot_save
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_time_moment_snapshot_size(void)
+{
+  size_t n = 3;
+
+  for (int i = 0; i < _n_moment_wa; i++) {
+    const cs_time_moment_wa_t *mwa = _moment_wa + i;
+    n += 3;
+    if (mwa->location_id == CS_MESH_LOCATION_NONE)
+      n += 1;
+    else if (mwa->val != NULL)
+      n += cs_mesh_location_get_n_elts(mwa->location_id)[0];
+  }
+
+  for (int i = 0; i < _n_moments; i++) {
+    const cs_time_moment_t *mt = _moment + i;
+    n += 2;
+    if (mt->f_id < 0 && mt->val != NULL)
+      n +=   cs_mesh_location_get_n_elts(mt->location_id)[2]
+           * (size_t)(mt->dim);
+  }
+
+  return n;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Save moments state to a local snapshot buffer.
+ *
+ * \param[out]  buf  snapshot buffer, of size given by
+ *                   \ref cs_time_moment_snapshot_size
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_snapshot_save(cs_real_t  buf[])
+{
+  size_t k = 0;
+
+  buf[k++] = _n_moment_wa;
+  buf[k++] = _n_moments;
+  buf[k++] = _t_prev_iter;
+
+  for (int i = 0; i < _n_moment_wa; i++) {
+    const cs_time_moment_wa_t *mwa = _moment_wa + i;
+    buf[k++] = mwa->nt_start;
+    buf[k++] = mwa->t_start;
+    if (mwa->location_id == CS_MESH_LOCATION_NONE) {
+      buf[k++] = 1;
+      buf[k++] = mwa->val0;
+    }
+    else if (mwa->val != NULL) {
+      cs_lnum_t n_w_elts = cs_mesh_location_get_n_elts(mwa->location_id)[0];
+      buf[k++] = 1;
+      memcpy(buf + k, mwa->val, n_w_elts*sizeof(cs_real_t));
+      k += n_w_elts;
+    }
+    else
+      buf[k++] = 0;
+  }
+
+  for (int i = 0; i < _n_moments; i++) {
+    const cs_time_moment_t *mt = _moment + i;
+    buf[k++] = mt->nt_cur;
+    if (mt->f_id < 0 && mt->val != NULL) {
+      cs_lnum_t n_elts = cs_mesh_location_get_n_elts(mt->location_id)[2];
+      size_t n_d_elts = n_elts*(size_t)(mt->dim);
+      buf[k++] = 1;
+      memcpy(buf + k, mt->val, n_d_elts*sizeof(cs_real_t));
+      k += n_d_elts;
+    }
+    else
+      buf[k++] = 0;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Restore moments state from a local snapshot buffer.
+ *
+ * Moments defined after the matching call to
+ * \ref cs_time_moment_snapshot_save are left unchanged. Accumulators
+ * which were not active yet when the snapshot was saved are deactivated.
+ *
+ * \param[in]  buf  snapshot buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_snapshot_restore(const cs_real_t  buf[])
+{
+  size_t k = 0;
+
+  const int n_wa = (int)buf[k++];
+  const int n_moments = (int)buf[k++];
+
+  _t_prev_iter = buf[k++];
+
+  for (int i = 0; i < n_wa; i++) {
+    cs_time_moment_wa_t *mwa = _moment_wa + i;
+    mwa->nt_start = (int)buf[k++];
+    mwa->t_start = buf[k++];
+    bool active = (buf[k++] > 0);
+    if (mwa->location_id == CS_MESH_LOCATION_NONE)
+      mwa->val0 = buf[k++];
+    else if (active) {
+      cs_lnum_t n_w_elts = cs_mesh_location_get_n_elts(mwa->location_id)[0];
+      if (mwa->val == NULL)
+        BFT_MALLOC(mwa->val, n_w_elts, cs_real_t);
+      memcpy(mwa->val, buf + k, n_w_elts*sizeof(cs_real_t));
+      k += n_w_elts;
+    }
+    else
+      BFT_FREE(mwa->val);
+  }
+
+  for (int i = 0; i < n_moments; i++) {
+    cs_time_moment_t *mt = _moment + i;
+    mt->nt_cur = (int)buf[k++];
+    bool active = (buf[k++] > 0);
+    if (active) {
+      cs_lnum_t n_elts = cs_mesh_location_get_n_elts(mt->location_id)[2];
+      size_t n_d_elts = n_elts*(size_t)(mt->dim);
+      if (mt->val == NULL)
+        BFT_MALLOC(mt->val, n_d_elts, cs_real_t);
+      memcpy(mt->val, buf + k, n_d_elts*sizeof(cs_real_t));
+      k += n_d_elts;
+    }
+    else if (mt->f_id < 0)
+      BFT_FREE(mt->val);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -175,6 +175,42 @@ cs_time_moment_define_by_field_ids(const char                *name,
                                    cs_time_moment_restart_t   restart_mode,
                                    const char                *restart_name);
 
+/*----------------------------------------------------------------------------
+ * Define a moment of a product of existing field components,
+ * restricted to a volume zone.
+ *
+ * The moment is only computed and stored on the cells of the given zone.
+ * Associated fields must be defined on cells (or be global values).
+ *
+ * parameters:
+ *   name         <-- name of associated moment
+ *   z_name       <-- name of associated volume zone
+ *   n_fields     <-- number of associated fields
+ *   field_id     <-- ids of associated fields
+ *   component_id <-- ids of matching field components (-1 for all)
+ *   type         <-- moment type
+ *   nt_start     <-- starting time step (or -1 to use t_start)
+ *   t_start      <-- starting time
+ *   restart_mode <-- behavior in case of restart (reset, auto, or strict)
+ *   restart_name <-- if not NULL, previous name in case of restart
+ *
+ * returns:
+ *   id of new moment in case of success, -1 in case of error.
+ *----------------------------------------------------------------------------*/
+
+int
+cs_time_moment_define_by_field_ids_on_zone
+  (const char                *name,
+   const char                *z_name,
+   int                        n_fields,
+   const int                  field_id[],
+   const int                  component_id[],
+   cs_time_moment_type_t      type,
+   int                        nt_start,
+   double                     t_start,
+   cs_time_moment_restart_t   restart_mode,
+   const char                *restart_name);
+
 /*----------------------------------------------------------------------------
  * Define a moment whose data values will be computed using a
  * specified function.
@@ -344,6 +380,19 @@ cs_time_moment_log_iteration(void);
 void
 cs_time_moment_restart_use_main(int  use_main);
 
+/*----------------------------------------------------------------------------
+ * Define error bound for lossy compression of checkpointed moment values.
+ *
+ * Weight accumulators are always saved without loss.
+ *
+ * parameters:
+ *   tolerance <-- absolute error bound, 0 for lossless output,
+ *                 or < 0 to use the restart file's setting
+ *----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_restart_set_tolerance(double  tolerance);
+
 /*----------------------------------------------------------------------------
  * Read restart moment data
  *
@@ -364,6 +413,36 @@ cs_time_moment_restart_read(cs_restart_t  *restart);
 void
 cs_time_moment_restart_write(cs_restart_t  *restart);
 
+/*----------------------------------------------------------------------------
+ * Return the local size of a moments state snapshot.
+ *
+ * returns:
+ *   number of values required by cs_time_moment_snapshot_save
+ *----------------------------------------------------------------------------*/
+
+size_t
+cs_time_moment_snapshot_size(void);
+
+/*----------------------------------------------------------------------------
+ * Save moments state to a local snapshot buffer.
+ *
+ * parameters:
+ *   buf --> snapshot buffer, of size given by cs_time_moment_snapshot_size
+ *----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_snapshot_save(cs_real_t  buf[]);
+
+/*----------------------------------------------------------------------------
+ * Restore moments state from a local snapshot buffer.
+ *
+ * parameters:
+ *   buf <-- snapshot buffer
+ *----------------------------------------------------------------------------*/
+
+void
+cs_time_moment_snapshot_restore(const cs_real_t  buf[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
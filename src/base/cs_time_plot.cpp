@@ -64,6 +64,10 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Binary time plot file magic string */
+
+#define CS_TIME_PLOT_BIN_MAGIC "code_saturne binary time plot 1.0\n"
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
@@ -143,6 +147,50 @@ _ensure_buffer_size(cs_time_plot_t  *p,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Open a time plot file for header output.
+ *
+ * For the binary format, the magic string and an integer allowing
+ * endianness checks are written first; the following header is the
+ * same as for CSV files.
+ *
+ * parameters:
+ *   p <-> time plot values file handler
+ *
+ * returns:
+ *   pointer to opened file, or NULL in case of error
+ *----------------------------------------------------------------------------*/
+
+static FILE *
+_open_header_file(cs_time_plot_t  *p)
+{
+  FILE *_f = p->f;
+
+  if (_f != NULL) {
+    fclose(_f);
+    p->f = NULL;
+  }
+
+  if (p->format == CS_TIME_PLOT_BIN)
+    _f = fopen(p->file_name, "wb");
+  else
+    _f = fopen(p->file_name, "w");
+
+  if (_f == NULL) {
+    bft_error(__FILE__, __LINE__, errno,
+              _("Error opening file: \"%s\""), p->file_name);
+    return NULL;
+  }
+
+  if (p->format == CS_TIME_PLOT_BIN) {
+    const int32_t endian_check = 1;
+    fputs(CS_TIME_PLOT_BIN_MAGIC, _f);
+    fwrite(&endian_check, sizeof(int32_t), 1, _f);
+  }
+
+  return _f;
+}
+
 /*----------------------------------------------------------------------------
  * Write file header for xmgrace/qsplotlib readable .dat files
  *
@@ -163,19 +211,11 @@ _write_probe_header_dat(cs_time_plot_t    *p,
 {
   int i, probe_id;
   int col_id = 0;
-  FILE *_f = p->f;
-
-  if (_f != NULL) {
-    fclose(_f);
-    p->f = NULL;
-  }
+  FILE *_f = NULL;
 
-  _f = fopen(p->file_name, "w");
-  if (_f == NULL) {
-    bft_error(__FILE__, __LINE__, errno,
-              _("Error opening file: \"%s\""), p->file_name);
+  _f = _open_header_file(p);
+  if (_f == NULL)
     return;
-  }
 
   fprintf(_f, _("# Time varying values for: %s\n"
                 "#\n"), p->plot_name);
@@ -347,19 +387,11 @@ _write_probe_header_csv(cs_time_plot_t    *p,
                         const char        *probe_names[])
 {
   int i, probe_id;
-  FILE *_f = p->f;
-
-  if (_f != NULL) {
-    fclose(_f);
-    p->f = NULL;
-  }
+  FILE *_f = NULL;
 
-  _f = fopen(p->file_name, "w");
-  if (_f == NULL) {
-    bft_error(__FILE__, __LINE__, errno,
-              _("Error opening file: \"%s\""), p->file_name);
+  _f = _open_header_file(p);
+  if (_f == NULL)
     return;
-  }
 
   if (p->use_iteration)
     fprintf(_f, " iteration");
@@ -421,21 +453,13 @@ _write_struct_header_dat(cs_time_plot_t    *p,
 {
   int i, struct_id;
   int col_id = 0;
-  FILE *_f = p->f;
+  FILE *_f = NULL;
 
   const int perm_id[9] = {0, 3, 6, 1, 4, 7, 2, 5, 8};
 
-  if (_f != NULL) {
-    fclose(_f);
-    p->f = NULL;
-  }
-
-  _f = fopen(p->file_name, "w");
-  if (_f == NULL) {
-    bft_error(__FILE__, __LINE__, errno,
-              _("Error opening file: \"%s\""), p->file_name);
+  _f = _open_header_file(p);
+  if (_f == NULL)
     return;
-  }
 
   fprintf(_f, _("# Time varying values for: %s\n"
                 "#\n"), p->plot_name);
@@ -528,19 +552,11 @@ _write_struct_header_csv(cs_time_plot_t  *p,
                          int              n_structures)
 {
   int i;
-  FILE *_f = p->f;
-
-  if (_f != NULL) {
-    fclose(_f);
-    p->f = NULL;
-  }
+  FILE *_f = NULL;
 
-  _f = fopen(p->file_name, "w");
-  if (_f == NULL) {
-    bft_error(__FILE__, __LINE__, errno,
-              _("Error opening file: \"%s\""), p->file_name);
+  _f = _open_header_file(p);
+  if (_f == NULL)
     return;
-  }
 
   if (p->use_iteration)
     fprintf(_f, " iteration");
@@ -645,6 +661,9 @@ _plot_file_create(const char             *plot_name,
   case CS_TIME_PLOT_CSV:
     sprintf(p->file_name, "%s%s.csv", file_prefix, plot_name);
     break;
+  case CS_TIME_PLOT_BIN:
+    sprintf(p->file_name, "%s%s.tpb", file_prefix, plot_name);
+    break;
   default:
     break;
   }
@@ -698,7 +717,8 @@ _plot_file_check_or_write(cs_time_plot_t  *p)
   /* Ensure file is open */
 
   if (p->f == NULL) {
-    p->f = fopen(p->file_name, "a");
+    p->f = fopen(p->file_name,
+                 (p->format == CS_TIME_PLOT_BIN) ? "ab" : "a");
     if (p->f == NULL) {
       bft_error(__FILE__, __LINE__, errno,
                 _("Error re-opening file: \"%s\""), p->file_name);
@@ -792,6 +812,7 @@ cs_time_plot_init_probe(const char             *plot_name,
     _write_probe_header_dat(p, n_probes, probe_list, probe_coords, probe_names);
     break;
   case CS_TIME_PLOT_CSV:
+  case CS_TIME_PLOT_BIN:
     _write_probe_coords_csv(file_prefix,
                             plot_name,
                             n_probes,
@@ -859,6 +880,7 @@ cs_time_plot_init_struct(const char             *plot_name,
                              mass_matrixes, damping_matrixes, stiffness_matrixes);
     break;
   case CS_TIME_PLOT_CSV:
+  case CS_TIME_PLOT_BIN:
     _write_struct_header_csv(p, n_structures);
   break;
   default:
@@ -970,6 +992,32 @@ cs_time_plot_vals_write(cs_time_plot_t  *p,
 
     break;
 
+  case CS_TIME_PLOT_BIN:
+
+    /* Record: number of values and time step (int32), followed by
+       time and values (double) */
+
+    {
+      const int32_t r_head[2] = {n_vals, tn};
+      const double _t = t;
+
+      _ensure_buffer_size(p,   p->buffer_end + sizeof(r_head)
+                             + (n_vals + 1)*sizeof(double));
+
+      memcpy(p->buffer + p->buffer_end, r_head, sizeof(r_head));
+      p->buffer_end += sizeof(r_head);
+      memcpy(p->buffer + p->buffer_end, &_t, sizeof(double));
+      p->buffer_end += sizeof(double);
+
+      for (i = 0; i < n_vals; i++) {
+        const double v = vals[i];
+        memcpy(p->buffer + p->buffer_end, &v, sizeof(double));
+        p->buffer_end += sizeof(double);
+      }
+    }
+
+    break;
+
   default:
     break;
   }
@@ -55,7 +55,9 @@ typedef struct _cs_time_plot_t  cs_time_plot_t;
 
 typedef enum {
   CS_TIME_PLOT_DAT,  /* .dat file (usable by Qtplot or Grace) */
-  CS_TIME_PLOT_CSV   /* .csv file (readable by ParaView or spreadsheat) */
+  CS_TIME_PLOT_CSV,  /* .csv file (readable by ParaView or spreadsheat) */
+  CS_TIME_PLOT_BIN   /* .tpb binary file (CSV header and binary records,
+                        convertible to CSV with "code_saturne tpconvert") */
 } cs_time_plot_format_t;
 
 /*============================================================================
@@ -214,6 +214,14 @@ BEGIN_C_DECLS
         Relaxation coefficient for the steady algorithm.
         \ref relxst = 1 : no relaxation.
 
+  \var  cs_time_step_options_t::n_dt_classes
+        Number of multirate time step classes.\n
+        When greater than 1 and \ref idtvar is CS_TIME_STEP_ADAPTIVE, cells
+        are grouped in classes based on the ratio of their admissible time
+        step to the (uniform) time step, class k containing cells whose
+        admissible time step is at least 2^k times the time step
+        (see \ref cs_local_time_step_classes).
+
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -268,7 +276,8 @@ static cs_time_step_options_t  _time_step_options = {
   .varrdt = 0.1,
   .dtmin  = -1.e13,
   .dtmax  = -1.e13,
-  .relxst = 0.7 /* Not used in CDO schemes */
+  .relxst = 0.7, /* Not used in CDO schemes */
+  .n_dt_classes = 0
 };
 
 const cs_time_step_t  *cs_glob_time_step = &_time_step;
@@ -668,6 +677,13 @@ cs_time_step_log_setup(void)
          cs_glob_time_step_options->dtmax,
          ts->dt_ref);
 
+      if (   cs_glob_time_step_options->idtvar == CS_TIME_STEP_ADAPTIVE
+          && cs_glob_time_step_options->n_dt_classes > 1)
+        cs_log_printf
+          (CS_LOG_SETUP,
+           _("\n    n_dt_classes: %15d (Multirate time step classes)\n"),
+           cs_glob_time_step_options->n_dt_classes);
+
     }
   }
 
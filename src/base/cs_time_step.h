@@ -121,6 +121,10 @@ typedef struct {
 
   double    relxst; /* Relaxation coefficient for the steady algorithm. */
 
+  int       n_dt_classes; /* Number of power-of-two multirate time step
+                             classes (when idtvar is CS_TIME_STEP_ADAPTIVE);
+                             0 or 1 if not used. */
+
 } cs_time_step_options_t;
 
 /*============================================================================
@@ -85,10 +85,115 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Multirate time step class of each cell */
+
+static cs_lnum_t  _n_dt_class_cells = 0;
+static int       *_dt_class_id = nullptr;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Update the local admissible time step with a given constraint.
+ *
+ * parameters:
+ *   n_cells <-- number of cells
+ *   dt_lim  <-- time step verifying the constraint
+ *   dt_adm  <-> admissible time step
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_admissible_dt(cs_lnum_t         n_cells,
+                      const cs_real_t   dt_lim[],
+                      cs_real_t         dt_adm[])
+{
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    dt_adm[c_id] = cs_math_fmin(dt_adm[c_id], dt_lim[c_id]);
+}
+
+/*----------------------------------------------------------------------------
+ * Assign cells to power-of-two time step classes.
+ *
+ * A cell is in class k if its admissible time step is at least 2^k times
+ * the (uniform) time step, k being limited to the number of classes.
+ *
+ * parameters:
+ *   n_cells       <-- number of cells
+ *   dt_ref        <-- uniform time step
+ *   dt_adm        <-- local admissible time step
+ *   log_is_active <-- log class distribution if true
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_time_step_classes(cs_lnum_t         n_cells,
+                          cs_real_t         dt_ref,
+                          const cs_real_t   dt_adm[],
+                          bool              log_is_active)
+{
+  const int n_classes = cs_glob_time_step_options->n_dt_classes;
+
+  if (_n_dt_class_cells != n_cells) {
+    BFT_REALLOC(_dt_class_id, n_cells, int);
+    _n_dt_class_cells = n_cells;
+  }
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    int k = 0;
+    cs_real_t dt_k = 2.*dt_ref;
+    while (k < n_classes - 1 && dt_adm[c_id] >= dt_k) {
+      k++;
+      dt_k *= 2.;
+    }
+    _dt_class_id[c_id] = k;
+  }
+
+  if (!log_is_active)
+    return;
+
+  cs_gnum_t *count;
+  BFT_MALLOC(count, n_classes, cs_gnum_t);
+  for (int k = 0; k < n_classes; k++)
+    count[k] = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    count[_dt_class_id[c_id]] += 1;
+
+  cs_parall_counter(count, n_classes);
+
+  /* Cell updates per coarsest class step: n_cells * 2^(n_classes-1)
+     with the uniform time step, sum of count[k] * 2^(n_classes-1-k)
+     when each class uses its own time step. */
+
+  double n_uniform = 0, n_multirate = 0;
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n  Multirate time step classes\n"
+                  "  ---------------------------\n\n"
+                  "    class           dt  n_cells\n"));
+
+  for (int k = 0; k < n_classes; k++) {
+    cs_log_printf(CS_LOG_DEFAULT,
+                  "    %5d  %11.4e  %llu\n",
+                  k, dt_ref*(1 << k), (unsigned long long)count[k]);
+    n_uniform += count[k];
+    n_multirate += (double)count[k] / (1 << k);
+  }
+
+  if (n_multirate > 0)
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("\n    Potential work ratio: %8.3f\n"),
+                  n_uniform / n_multirate);
+
+  BFT_FREE(count);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -348,6 +453,14 @@ cs_local_time_step_compute(int  itrale)
       int icou = 0;
       int ifou = 0;
 
+      /* Local admissible time step, for multirate time step classes */
+
+      cs_real_t *dt_adm = nullptr;
+      if (idtvar == 1 && cs_glob_time_step_options->n_dt_classes > 1) {
+        BFT_MALLOC(dt_adm, n_cells, cs_real_t);
+        cs_array_real_set_scalar(n_cells, cs_math_big_r, dt_adm);
+      }
+
       /* Courant limitation
          ------------------ */
 
@@ -413,6 +526,9 @@ cs_local_time_step_compute(int  itrale)
 
         }
 
+        if (dt_adm != nullptr)
+          _update_admissible_dt(n_cells, w1, dt_adm);
+
         /* Uniform time step: we take the minimum of the constraint */
         if (idtvar == 1)  {
           cs_real_t w1min = cs_math_big_r;
@@ -460,6 +576,9 @@ cs_local_time_step_compute(int  itrale)
           w2[c_id] = foumax / cs_math_fmax(w2_l, cs_math_epzero);
         }
 
+        if (dt_adm != nullptr)
+          _update_admissible_dt(n_cells, w2, dt_adm);
+
         /* Uniform time step: we take the minimum of the constraint */
 
         if (idtvar == 1) {
@@ -496,6 +615,9 @@ cs_local_time_step_compute(int  itrale)
                       / cs_math_fmax(wcf[c_id], cs_math_epzero);
         }
 
+        if (dt_adm != nullptr)
+          _update_admissible_dt(n_cells, dam, dt_adm);
+
         /* Uniform time step: we take the minimum of ther constraint */
 
         if (idtvar == 1) {
@@ -589,6 +711,9 @@ cs_local_time_step_compute(int  itrale)
                                   &vmin,
                                   &vmax);
 
+        if (dt_adm != nullptr)
+          _update_admissible_dt(n_cells, w3, dt_adm);
+
         /* Uniform time step: we reuniform the time step */
 
         if (idtvar == 1) {
@@ -658,6 +783,9 @@ cs_local_time_step_compute(int  itrale)
 
         cs_array_real_set_scalar(n_cells, dtloc, dt);
 
+        if (dt_adm != nullptr)
+          _update_time_step_classes(n_cells, dtloc, dt_adm, log_is_active);
+
       }
       else if (log_is_active || eqp_p->verbosity >= 2) {
 
@@ -701,6 +829,8 @@ cs_local_time_step_compute(int  itrale)
            (unsigned long long)cpt[1], dtmax);
       }
 
+      BFT_FREE(dt_adm);
+
   }
 
     /* Ratio DT/DTmax related to density effect (display in cs_log_iteration.c) */
@@ -1163,6 +1293,38 @@ cs_courant_fourier_compute(void)
   BFT_FREE(bc_coeffs_loc.bf);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the multirate time step class of each cell.
+ *
+ * Classes are only determined with a time-adaptive (uniform) time step
+ * when cs_time_step_options_t::n_dt_classes is greater than 1; a cell
+ * in class k has an admissible time step (based on the Courant, Fourier
+ * and density related constraints) at least 2^k times the time step.
+ *
+ * \return  pointer to cell classes array, or nullptr if not available
+ */
+/*----------------------------------------------------------------------------*/
+
+const int *
+cs_local_time_step_classes(void)
+{
+  return _dt_class_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free multirate time step classes.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_local_time_step_classes_free(void)
+{
+  BFT_FREE(_dt_class_id);
+  _n_dt_class_cells = 0;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
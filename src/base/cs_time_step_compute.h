@@ -66,6 +66,26 @@ cs_local_time_step_compute(int itrale);
 void
 cs_courant_fourier_compute(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the multirate time step class of each cell.
+ *
+ * \return  pointer to cell classes array, or nullptr if not available
+ */
+/*----------------------------------------------------------------------------*/
+
+const int *
+cs_local_time_step_classes(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free multirate time step classes.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_local_time_step_classes_free(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
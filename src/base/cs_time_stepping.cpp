@@ -54,6 +54,7 @@
 #include "cs_ale.h"
 #include "cs_at_data_assim.h"
 #include "cs_atmo.h"
+#include "cs_base.h"
 #include "cs_boundary_conditions.h"
 #include "cs_boundary_conditions_set_coeffs.h"
 #include "cs_cdo_main.h"
@@ -95,6 +96,7 @@
 #include "cs_sat_coupling.h"
 #include "cs_solve_all.h"
 #include "cs_runaway_check.h"
+#include "cs_steady_accel.h"
 #include "cs_time_moment.h"
 #include "cs_time_step.h"
 #include "cs_timer_stats.h"
@@ -580,6 +582,11 @@ cs_time_stepping(void)
 
   cs_log_iteration();
 
+  /* Log memory use for the setup and initialization phase,
+     and start a new phase for the time loop */
+
+  cs_base_mem_log_subsystems(CS_LOG_SETUP, true);
+
   /* Start of time loop
      ------------------ */
 
@@ -720,6 +727,12 @@ cs_time_stepping(void)
 
     if (ts->nt_max > ts->nt_prev && itrale > 0) {
 
+      /* Accelerate steady-state outer iterations if required
+         ---------------------------------------------------- */
+
+      if (idtvar == CS_TIME_STEP_STEADY)
+        cs_steady_accel_apply();
+
       /* Solve CDO module(s) or user-defined equations using CDO schemes
          --------------------------------------------------------------- */
 
@@ -967,6 +980,8 @@ cs_time_stepping(void)
   if (cs_glob_les_balance->i_les_balance > 0)
     cs_les_balance_finalize();
 
+  cs_steady_accel_finalize();
+
   cs_log_printf
     (CS_LOG_DEFAULT,
      _("\n\n"
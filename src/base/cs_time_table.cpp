@@ -44,6 +44,7 @@
 #include "cs_defs.h"
 #include "cs_file.h"
 #include "cs_file_csv_parser.h"
+#include "cs_parall.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -74,6 +75,9 @@ struct _cs_time_table_t {
  int n_rows;                /* Number of rows */
 
  cs_double_int_t coeffs[2]; /* Coefficients used for interpolation */
+
+ cs_real_t time_step;       /* Time step if time values are uniformly
+                               spaced, 0 otherwise */
 };
 
 /*============================================================================
@@ -210,6 +214,7 @@ _time_table_create(const char *name)
   retval->n_cols      = 0;
   retval->time_col_id = 0;
   retval->time_offset = 0.;
+  retval->time_step   = 0.;
 
   for (int i = 0; i < 2; i++) {
     retval->coeffs[i].id  = 0;
@@ -238,8 +243,12 @@ _free_time_table(cs_time_table_t *t)
 {
   assert(t != nullptr);
 
+  /* Column values are stored contiguously, possibly in node-shared memory */
+
+  if (t->n_cols > 0)
+    cs_parall_shared_free(t->columns[0]);
+
   for (int i = 0; i < t->n_cols; i++) {
-    BFT_FREE(t->columns[i]);
     if (t->headers != nullptr)
       BFT_FREE(t->headers[i]);
   }
@@ -251,6 +260,80 @@ _free_time_table(cs_time_table_t *t)
   BFT_FREE(t);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check whether the time values of a table are uniformly spaced,
+ *        so that interpolation brackets may be computed directly.
+ *
+ * \param[in, out] table  Pointer to time table structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_time_table_update_axis(cs_time_table_t *table)
+{
+  table->time_step = 0.;
+
+  const int n_rows = table->n_rows;
+  if (n_rows < 2 || table->time_col_id >= table->n_cols)
+    return;
+
+  const cs_real_t *time_vals = table->columns[table->time_col_id];
+
+  const cs_real_t dt = (time_vals[n_rows-1] - time_vals[0]) / (n_rows - 1);
+  if (!(dt > 0.))
+    return;
+
+  const cs_real_t tol = 1e-10 * dt * (n_rows - 1);
+
+  for (int i = 1; i < n_rows - 1; i++) {
+    if (fabs(time_vals[i] - (time_vals[0] + i*dt)) > tol)
+      return;
+  }
+
+  table->time_step = dt;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Find the interval of time values containing a given time.
+ *
+ * The interval from the previous search and the next one are checked
+ * first, then a bisection is used, so that both forward and backward
+ * changes of the time value are handled.
+ *
+ * \param[in] time_vals  Time values (n_rows >= 2, increasing)
+ * \param[in] n_rows     Number of time values
+ * \param[in] prev_id    Interval id from previous search
+ * \param[in] t          Time value, with time_vals[0] <= t <= time_vals[n-1]
+ *
+ * \return id i such that time_vals[i] <= t <= time_vals[i+1]
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline int
+_time_table_find_interval(const cs_real_t  time_vals[],
+                          int              n_rows,
+                          int              prev_id,
+                          cs_real_t        t)
+{
+  for (int i = prev_id; i < prev_id + 2 && i < n_rows - 1; i++) {
+    if (t >= time_vals[i] && t <= time_vals[i+1])
+      return i;
+  }
+
+  int s_id = 0, e_id = n_rows - 1;
+  while (e_id - s_id > 1) {
+    int m_id = (s_id + e_id) / 2;
+    if (t < time_vals[m_id])
+      e_id = m_id;
+    else
+      s_id = m_id;
+  }
+
+  return s_id;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute value for column using the current defined time.
@@ -412,37 +495,81 @@ cs_time_table_from_csv_file(const char  *name,
   int _n_rows = 0;
   int _n_cols = 0;
 
-  char ***_data = cs_file_csv_parse(file_name,
-                                    separator,
-                                    n_headers,
-                                    n_columns,
-                                    col_idx,
-                                    ignore_missing_tokens,
-                                    &_n_rows,
-                                    &_n_cols);
+  /* The file is parsed by a single rank, and values are then broadcast
+     in binary form to the ranks storing them (one per node if node-shared
+     memory is available) */
+
+  char ***_data = nullptr;
+
+  if (cs_glob_rank_id < 1)
+    _data = cs_file_csv_parse(file_name,
+                              separator,
+                              n_headers,
+                              n_columns,
+                              col_idx,
+                              ignore_missing_tokens,
+                              &_n_rows,
+                              &_n_cols);
+
+  int n[2] = {_n_rows, _n_cols};
+  cs_parall_bcast(0, 2, CS_INT_TYPE, n);
+  _n_rows = n[0];
+  _n_cols = n[1];
 
   t = _time_table_create(name);
 
   t->n_rows = _n_rows;
   t->n_cols = _n_cols;
 
+  bool is_writer = true;
+  size_t n_vals = (size_t)_n_rows * (size_t)_n_cols;
+  cs_real_t *vals
+    = (cs_real_t *)cs_parall_shared_malloc(n_vals*sizeof(cs_real_t),
+                                           &is_writer);
+
   BFT_MALLOC(t->columns, _n_cols, cs_real_t *);
   for (int i = 0; i < _n_cols; i++)
-    BFT_MALLOC(t->columns[i], _n_rows, cs_real_t);
+    t->columns[i] = vals + (size_t)i*_n_rows;
 
-  for (int ir = 0; ir < _n_rows; ir++) {
-    char **_row = _data[ir];
-    for (int ic = 0; ic < _n_cols; ic++)
-      t->columns[ic][ir] = atof(_row[ic]);
+  if (_data != nullptr) {
+    for (int ir = 0; ir < _n_rows; ir++) {
+      char **_row = _data[ir];
+      for (int ic = 0; ic < _n_cols; ic++)
+        t->columns[ic][ir] = atof(_row[ic]);
+    }
   }
 
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    /* Rank 0 is always a writer, and the first rank of the sub-communicator */
+    MPI_Comm w_comm;
+    MPI_Comm_split(cs_glob_mpi_comm, (is_writer) ? 0 : MPI_UNDEFINED,
+                   cs_glob_rank_id, &w_comm);
+    if (w_comm != MPI_COMM_NULL) {
+      MPI_Bcast(vals, (int)n_vals, CS_MPI_REAL, 0, w_comm);
+      MPI_Comm_free(&w_comm);
+    }
+  }
+#endif
+
+  cs_parall_shared_sync(vals);
+
+  _time_table_update_axis(t);
+
+  /* With no columns, values are not referenced, so free them now */
+
+  if (_n_cols == 0)
+    cs_parall_shared_free(vals);
+
   // Free data which is no longer needed.
-  for (int i = 0; i < _n_rows; i++) {
-    for (int j = 0; j < _n_cols; j++)
-      BFT_FREE(_data[i][j]);
-    BFT_FREE(_data[i]);
+  if (_data != nullptr) {
+    for (int i = 0; i < _n_rows; i++) {
+      for (int j = 0; j < _n_cols; j++)
+        BFT_FREE(_data[i][j]);
+      BFT_FREE(_data[i]);
+    }
+    BFT_FREE(_data);
   }
-  BFT_FREE(_data);
 
   return t;
 }
@@ -523,6 +650,8 @@ cs_time_table_set_time_col_id(cs_time_table_t *table,
   assert(table != nullptr);
   assert(col_id > -1 && col_id < table->n_cols);
   table->time_col_id = col_id;
+
+  _time_table_update_axis(table);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -542,8 +671,10 @@ cs_time_table_set_time_from_label(cs_time_table_t *table,
 
   const int t_id = _time_table_column_id_by_name(table, time_label);
 
-  if (t_id > -1)
+  if (t_id > -1) {
     table->time_col_id = t_id;
+    _time_table_update_axis(table);
+  }
   else
     bft_error(__FILE__, __LINE__, 0,
               _("Error: table \"%s\" has no column with header \"%s\"\n"),
@@ -605,24 +736,27 @@ cs_time_table_update_position(cs_time_table_t *table,
     coeffs[0].val = 1.;
     coeffs[1].val = 0.;
   }
-  else if (_time > time_vals[n_rows - 1]) {
+  else if (_time >= time_vals[n_rows - 1]) {
     coeffs[0].id = n_rows - 1;
     coeffs[1].id = n_rows - 1;
     coeffs[0].val = 1.;
     coeffs[1].val = 0.;
   }
   else {
-    for (int i = t0_id; i < n_rows - 1; i++) {
-      if (_time >= time_vals[i] && _time < time_vals[i+1]) {
-        coeffs[1].id = i + 1;
-        coeffs[1].val = (_time - time_vals[i]) / (time_vals[i+1] - time_vals[i]);
+    int i = 0;
+    if (table->time_step > 0.) {
+      i = (int)((_time - time_vals[0]) / table->time_step);
+      if (i > n_rows - 2)
+        i = n_rows - 2;
+    }
+    else
+      i = _time_table_find_interval(time_vals, n_rows, t0_id, _time);
 
-        coeffs[0].id = i;
-        coeffs[0].val = 1. - coeffs[1].val;
+    coeffs[1].id = i + 1;
+    coeffs[1].val = (_time - time_vals[i]) / (time_vals[i+1] - time_vals[i]);
 
-        break;
-      }
-    }
+    coeffs[0].id = i;
+    coeffs[0].val = 1. - coeffs[1].val;
   }
 }
 
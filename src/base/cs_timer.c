@@ -61,6 +61,18 @@
 #include <unistd.h>
 #endif
 
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/* syscall() is not declared in strict POSIX mode */
+
+extern long syscall(long  number, ...);
+#endif
+
 /* Disable automatically-defined HAVE_CLOCK_GETTIME on Cygwin */
 
 #if defined(HAVE_CLOCK_GETTIME) && defined(__CYGWIN__)
@@ -203,6 +215,12 @@ static clock_t _cs_timer_clock_start;
 static cs_timer_t  _cs_timer_start = {.sec = 0, .nsec = 0};
 static cs_timer_t  _cs_timer_cpu_start = {.sec = 0, .nsec = 0};
 
+/* Hardware counters (group leader first, and matching counter ids) */
+
+static int  _cs_timer_hw_n = 0;
+static int  _cs_timer_hw_fd[CS_TIMER_HW_N_COUNTERS] = {-1, -1, -1};
+static int  _cs_timer_hw_id[CS_TIMER_HW_N_COUNTERS] = {-1, -1, -1};
+
 /*-----------------------------------------------------------------------------
  * Global variable definitions
  *-----------------------------------------------------------------------------*/
@@ -718,6 +736,131 @@ cs_timer_cpu_time_method(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Initialize hardware counters for the calling thread.
+ *
+ * Cycles, instructions, and last level cache miss counters are opened
+ * as a single group using the Linux perf_event interface when available,
+ * so that all values are obtained with a single system call.
+ * Counters which are not available (due to the hardware, virtualization,
+ * or the perf_event_paranoid setting) remain at 0.
+ *
+ * Only user-space events of the calling thread are counted.
+ *
+ * \return number of available hardware counters (0 if not available).
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_timer_hw_initialize(void)
+{
+  if (_cs_timer_hw_n > 0)
+    return _cs_timer_hw_n;
+
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+
+  const unsigned long long config[CS_TIMER_HW_N_COUNTERS]
+    = {PERF_COUNT_HW_CPU_CYCLES,
+       PERF_COUNT_HW_INSTRUCTIONS,
+       PERF_COUNT_HW_CACHE_MISSES};
+
+  for (int i = 0; i < CS_TIMER_HW_N_COUNTERS; i++) {
+
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config[i];
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.disabled = (_cs_timer_hw_n == 0) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    int group_fd = (_cs_timer_hw_n == 0) ? -1 : _cs_timer_hw_fd[0];
+    long fd = syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0);
+
+    if (fd > -1) {
+      _cs_timer_hw_fd[_cs_timer_hw_n] = (int)fd;
+      _cs_timer_hw_id[_cs_timer_hw_n] = i;
+      _cs_timer_hw_n += 1;
+    }
+
+  }
+
+  if (_cs_timer_hw_n > 0) {
+    ioctl(_cs_timer_hw_fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    if (ioctl(_cs_timer_hw_fd[0], PERF_EVENT_IOC_ENABLE,
+              PERF_IOC_FLAG_GROUP) != 0)
+      cs_timer_hw_finalize();
+  }
+
+#endif
+
+  return _cs_timer_hw_n;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Finalize hardware counters.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_hw_finalize(void)
+{
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+
+  for (int i = _cs_timer_hw_n - 1; i > -1; i--) {
+    close(_cs_timer_hw_fd[i]);
+    _cs_timer_hw_fd[i] = -1;
+    _cs_timer_hw_id[i] = -1;
+  }
+
+#endif
+
+  _cs_timer_hw_n = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return current hardware counter values.
+ *
+ * If hardware counters are not initialized, values are set to 0.
+ *
+ * \param[out]  hw  current counter values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_hw_read(cs_timer_hw_t  *hw)
+{
+  for (int i = 0; i < CS_TIMER_HW_N_COUNTERS; i++)
+    hw->count[i] = 0;
+
+#if defined(HAVE_LINUX_PERF_EVENT_H)
+
+  if (_cs_timer_hw_n > 0) {
+
+    /* Group read format: number of values, followed by values */
+
+    unsigned long long buf[CS_TIMER_HW_N_COUNTERS + 1];
+    ssize_t n = read(_cs_timer_hw_fd[0], buf, sizeof(buf));
+
+    if (n >= (ssize_t)sizeof(unsigned long long)) {
+      int n_vals = (int)buf[0];
+      if (n_vals > _cs_timer_hw_n)
+        n_vals = _cs_timer_hw_n;
+      for (int i = 0; i < n_vals; i++)
+        hw->count[_cs_timer_hw_id[i]] = (long long)buf[i+1];
+    }
+
+  }
+
+#endif
+}
+
 /*-----------------------------------------------------------------------------*/
 
 END_C_DECLS
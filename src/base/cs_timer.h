@@ -58,6 +58,16 @@ typedef struct {
 
 } cs_timer_counter_t;
 
+/* Hardware counter values (cycles, instructions, last level cache misses) */
+
+#define CS_TIMER_HW_N_COUNTERS  3
+
+typedef struct {
+
+  long long    count[CS_TIMER_HW_N_COUNTERS];  /* counter values */
+
+} cs_timer_hw_t;
+
 /*============================================================================
  * Public macros
  *============================================================================*/
@@ -208,6 +218,39 @@ cs_timer_wtime_method(void);
 const char *
 cs_timer_cpu_time_method(void);
 
+/*----------------------------------------------------------------------------
+ * Initialize hardware counters for the calling thread.
+ *
+ * Cycles, instructions, and last level cache miss counters are opened
+ * using the Linux perf_event interface when available. Counters which
+ * are not available remain at 0.
+ *
+ * returns:
+ *   number of available hardware counters (0 if not available).
+ *----------------------------------------------------------------------------*/
+
+int
+cs_timer_hw_initialize(void);
+
+/*----------------------------------------------------------------------------
+ * Finalize hardware counters.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_timer_hw_finalize(void);
+
+/*----------------------------------------------------------------------------
+ * Return current hardware counter values.
+ *
+ * If hardware counters are not initialized, values are set to 0.
+ *
+ * parameters:
+ *   hw --> current counter values
+ *----------------------------------------------------------------------------*/
+
+void
+cs_timer_hw_read(cs_timer_hw_t  *hw);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
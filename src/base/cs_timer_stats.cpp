@@ -42,7 +42,9 @@
  * Standard C library headers
  *----------------------------------------------------------------------------*/
 
+#include <errno.h>
 #include <math.h>
+#include <stdio.h>
 #include <string.h>
 #include <time.h>
 
@@ -52,8 +54,11 @@
 
 #include "bft_error.h"
 #include "bft_mem.h"
+#include "bft_printf.h"
 
+#include "cs_log.h"
 #include "cs_map.h"
+#include "cs_parall.h"
 #include "cs_timer.h"
 #include "cs_time_plot.h"
 
@@ -108,8 +113,30 @@ typedef struct {
   cs_timer_counter_t   t_cur;           /* Counter since last output */
   cs_timer_counter_t   t_tot;           /* Total time counter */
 
+  cs_timer_hw_t        hw_start;        /* Hardware counters at start */
+  cs_timer_hw_t        hw_tot;          /* Total hardware counters */
+
 } cs_timer_stats_t;
 
+/* Trace event (complete timer interval) */
+
+typedef struct {
+
+  double               ts;              /* Start time (microseconds) */
+  double               dur;             /* Duration (microseconds) */
+  int                  stats_id;        /* Associated statistic id */
+  int                  time_id;         /* Associated time step id */
+
+} cs_timer_stats_event_t;
+
+/*-------------------------------------------------------------------------------
+ * Local macro definitions
+ *-----------------------------------------------------------------------------*/
+
+/* Assumed cache line size for memory traffic estimation */
+
+#define _HW_CACHE_LINE_SIZE 64
+
 /*-------------------------------------------------------------------------------
  * Local macro documentation
  *-----------------------------------------------------------------------------*/
@@ -138,6 +165,19 @@ static int  _n_stats = 0;
 static int  _n_stats_max = 0;
 static cs_timer_stats_t  *_stats= nullptr;
 
+/* Hardware counters */
+
+static bool  _hw_on = false;
+
+/* Event trace (ring buffer, disabled by default) */
+
+static bool                     _trace_on = false;
+static int                      _trace_interval = 1;
+static size_t                   _trace_n_max = 0;
+static size_t                   _trace_n = 0;
+static cs_timer_t               _trace_t0;
+static cs_timer_stats_event_t  *_trace = nullptr;
+
 static cs_map_name_to_id_t  *_name_map = nullptr;
 
 /*============================================================================
@@ -277,6 +317,277 @@ _output_time_plot(void)
   BFT_FREE(vals);
 }
 
+/*----------------------------------------------------------------------------
+ * Record a complete timer interval in the event trace.
+ *
+ * parameters:
+ *   stats_id <-- associated statistic id
+ *   t0       <-- interval start time
+ *   t1       <-- interval end time
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_trace_record(int                stats_id,
+              const cs_timer_t  *t0,
+              const cs_timer_t  *t1)
+{
+  cs_timer_stats_event_t *e = _trace + (_trace_n % _trace_n_max);
+
+  e->ts =   (t0->sec - _trace_t0.sec)*1e6
+          + (t0->nsec - _trace_t0.nsec)*1e-3;
+  e->dur = (t1->sec - t0->sec)*1e6 + (t1->nsec - t0->nsec)*1e-3;
+  e->stats_id = stats_id;
+  e->time_id = _time_id;
+
+  _trace_n += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a string to a JSON file, escaping special characters.
+ *
+ * parameters:
+ *   f <-- output file
+ *   s <-- string to write
+ *----------------------------------------------------------------------------*/
+
+static void
+_json_write_string(FILE        *f,
+                   const char  *s)
+{
+  fputc('"', f);
+  for (const char *c = s; *c != '\0'; c++) {
+    if (*c == '"' || *c == '\\')
+      fputc('\\', f);
+    if ((unsigned char)(*c) >= 0x20)
+      fputc(*c, f);
+  }
+  fputc('"', f);
+}
+
+/*----------------------------------------------------------------------------
+ * Write the event trace in Chrome trace event (JSON) format, which may be
+ * read by Perfetto or chrome://tracing.
+ *
+ * Events of all ranks are gathered on rank 0, each rank being mapped to
+ * a separate process id, and each statistics tree to a separate thread id.
+ *----------------------------------------------------------------------------*/
+
+static void
+_trace_write(void)
+{
+  const int n_vals = sizeof(cs_timer_stats_event_t) / sizeof(double);
+  static_assert(sizeof(cs_timer_stats_event_t) % sizeof(double) == 0,
+                "trace event size must be a multiple of sizeof(double)");
+
+  cs_lnum_t n_events = (_trace_n < _trace_n_max) ? _trace_n : _trace_n_max;
+  size_t s_id = (_trace_n < _trace_n_max) ? 0 : _trace_n % _trace_n_max;
+
+  /* Order events from oldest to most recent */
+
+  cs_timer_stats_event_t *events;
+  BFT_MALLOC(events, n_events, cs_timer_stats_event_t);
+  for (cs_lnum_t i = 0; i < n_events; i++)
+    events[i] = _trace[(s_id + i) % _trace_n_max];
+
+  int n_ranks = cs_glob_n_ranks;
+  cs_lnum_t *rank_count = nullptr;
+
+#if defined(HAVE_MPI)
+
+  if (n_ranks > 1) {
+
+    int *count = nullptr, *displ = nullptr;
+    cs_timer_stats_event_t *g_events = nullptr;
+
+    /* Shift times to a common origin (earliest trace start) */
+
+    double l_t0 = _trace_t0.sec*1e6 + _trace_t0.nsec*1e-3, g_t0 = l_t0;
+    MPI_Allreduce(&l_t0, &g_t0, 1, MPI_DOUBLE, MPI_MIN, cs_glob_mpi_comm);
+
+    double t_shift = l_t0 - g_t0;
+    for (cs_lnum_t i = 0; i < n_events; i++)
+      events[i].ts += t_shift;
+
+    int l_count = n_events * n_vals;
+
+    if (cs_glob_rank_id == 0) {
+      BFT_MALLOC(count, n_ranks, int);
+      BFT_MALLOC(displ, n_ranks, int);
+    }
+
+    MPI_Gather(&l_count, 1, MPI_INT, count, 1, MPI_INT, 0, cs_glob_mpi_comm);
+
+    if (cs_glob_rank_id == 0) {
+      BFT_MALLOC(rank_count, n_ranks, cs_lnum_t);
+      int g_count = 0;
+      for (int i = 0; i < n_ranks; i++) {
+        displ[i] = g_count;
+        rank_count[i] = count[i] / n_vals;
+        g_count += count[i];
+      }
+      BFT_MALLOC(g_events, g_count / n_vals, cs_timer_stats_event_t);
+    }
+
+    MPI_Gatherv(events, l_count, MPI_DOUBLE,
+                g_events, count, displ, MPI_DOUBLE,
+                0, cs_glob_mpi_comm);
+
+    BFT_FREE(displ);
+    BFT_FREE(count);
+    BFT_FREE(events);
+    events = g_events;
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (rank_count == nullptr) {
+    n_ranks = 1;
+    BFT_MALLOC(rank_count, 1, cs_lnum_t);
+    rank_count[0] = n_events;
+  }
+
+  if (cs_glob_rank_id < 1) {
+
+    const char file_name[] = "timer_stats_trace.json";
+
+    FILE *f = fopen(file_name, "w");
+    if (f == nullptr)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error opening file: \"%s\""), file_name);
+
+    fprintf(f, "{\"displayTimeUnit\": \"ms\",\n\"traceEvents\": [");
+
+    const char *sep = "\n";
+    cs_lnum_t k = 0;
+
+    for (int rank_id = 0; rank_id < n_ranks; rank_id++) {
+      for (cs_lnum_t i = 0; i < rank_count[rank_id]; i++, k++) {
+        const cs_timer_stats_event_t *e = events + k;
+        const cs_timer_stats_t *s = _stats + e->stats_id;
+        fprintf(f, "%s{\"name\": ", sep);
+        _json_write_string(f, s->label);
+        fprintf(f, ", \"cat\": ");
+        _json_write_string(f, (_stats + s->root_id)->label);
+        fprintf(f, ", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, "
+                "\"pid\": %d, \"tid\": %d, "
+                "\"args\": {\"time_step\": %d}}",
+                e->ts, e->dur, rank_id, s->root_id, e->time_id);
+        sep = ",\n";
+      }
+    }
+
+    for (int rank_id = 0; rank_id < n_ranks; rank_id++)
+      fprintf(f, "%s{\"name\": \"process_name\", \"ph\": \"M\", "
+              "\"pid\": %d, \"args\": {\"name\": \"rank %d\"}}",
+              sep, rank_id, rank_id);
+
+    fprintf(f, "\n]}\n");
+
+    if (fclose(f) != 0)
+      bft_error(__FILE__, __LINE__, errno,
+                _("Error closing file: \"%s\""), file_name);
+
+  }
+
+  BFT_FREE(rank_count);
+  BFT_FREE(events);
+}
+
+/*----------------------------------------------------------------------------
+ * Add hardware counter differences to a statistic's total.
+ *
+ * parameters:
+ *   s  <-> pointer to statistic
+ *   hw <-- current hardware counter values
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_hw_add_diff(cs_timer_stats_t     *s,
+             const cs_timer_hw_t  *hw)
+{
+  for (int i = 0; i < CS_TIMER_HW_N_COUNTERS; i++)
+    s->hw_tot.count[i] += hw->count[i] - s->hw_start.count[i];
+}
+
+/*----------------------------------------------------------------------------
+ * Log hardware counter based statistics to the performance log.
+ *
+ * Counters are summed over ranks, and elapsed time is the maximum
+ * over ranks, so the memory bandwidth is an aggregate value.
+ * Memory traffic is estimated from last level cache misses.
+ *----------------------------------------------------------------------------*/
+
+static void
+_hw_log(void)
+{
+  const int n_vals = CS_TIMER_HW_N_COUNTERS;
+
+  /* Account for active statistics */
+
+  cs_timer_hw_t hw;
+  cs_timer_hw_read(&hw);
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    if (s->active) {
+      _hw_add_diff(s, &hw);
+      s->hw_start = hw;
+    }
+  }
+
+  double *vals, *t;
+  BFT_MALLOC(vals, _n_stats*n_vals, double);
+  BFT_MALLOC(t, _n_stats, double);
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    for (int i = 0; i < n_vals; i++)
+      vals[stats_id*n_vals + i] = s->hw_tot.count[i];
+    t[stats_id] = (s->t_tot.nsec + s->t_cur.nsec)*1e-9;
+  }
+
+  cs_parall_sum(_n_stats*n_vals, CS_DOUBLE, vals);
+  cs_parall_max(_n_stats, CS_DOUBLE, t);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nTimer statistics hardware counters "
+                  "(main thread, sum over ranks):\n\n"
+                  "  %-24s %10s %9s %5s %10s %9s %9s\n"),
+                _("statistic"), _("time (s)"), _("Gcycles"), _("IPC"),
+                _("LLC miss"), _("GB/s"), _("instr./B"));
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+
+    const cs_timer_stats_t  *s = _stats + stats_id;
+    const double *v = vals + stats_id*n_vals;
+
+    if (v[0] <= 0)
+      continue;
+
+    int depth = 0;
+    for (int p_id = s->parent_id; p_id > -1; p_id = _stats[p_id].parent_id)
+      depth++;
+
+    double ipc = v[1] / v[0];
+    double bytes = v[2] * _HW_CACHE_LINE_SIZE;
+    double bw = (t[stats_id] > 0) ? bytes / t[stats_id] * 1e-9 : 0;
+    double intensity = (bytes > 0) ? v[1] / bytes : 0;
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %*s%-*s %10.3f %9.3f %5.2f %10.4g %9.3f %9.3g\n",
+                  2*depth, "", 24 - 2*depth, s->label,
+                  t[stats_id], v[0]*1e-9, ipc, v[2], bw, intensity);
+
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  cs_log_separator(CS_LOG_PERFORMANCE);
+
+  BFT_FREE(t);
+  BFT_FREE(vals);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -329,6 +640,20 @@ cs_timer_stats_finalize(void)
   if (_time_plot != nullptr)
     cs_time_plot_finalize(&_time_plot);
 
+  if (_hw_on) {
+    _hw_log();
+    cs_timer_hw_finalize();
+    _hw_on = false;
+  }
+
+  if (_trace != nullptr) {
+    _trace_write();
+    BFT_FREE(_trace);
+    _trace_n = 0;
+    _trace_n_max = 0;
+    _trace_on = false;
+  }
+
   _time_id = -1;
 
   for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
@@ -396,6 +721,91 @@ cs_timer_stats_set_plot_options(cs_time_plot_format_t   format,
   _plot_flush_wtime = flush_wtime;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable hardware counters for timer statistics.
+ *
+ * When available (using the Linux perf_event interface), cycles,
+ * instructions, and last level cache misses of the main thread are
+ * accumulated for each statistic, and the associated instructions per
+ * cycle, estimated memory bandwidth, and instructions per byte are
+ * logged to the performance log at finalization.
+ *
+ * This adds a system call at each timer start and stop, so it is
+ * better suited to statistics of significant granularity.
+ *
+ * This is a collective operation.
+ *
+ * \return  number of available hardware counters (0 if not available)
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_timer_stats_enable_hw_counters(void)
+{
+  int n_hw = cs_timer_hw_initialize();
+
+  if (n_hw == 0)
+    bft_printf(_("\nWarning: hardware counters not available "
+                 "for timer statistics.\n"));
+
+  _hw_on = true;
+
+  /* Initialize counter base for already active statistics */
+
+  cs_timer_hw_t hw;
+  cs_timer_hw_read(&hw);
+
+  for (int stats_id = 0; stats_id < _n_stats; stats_id++) {
+    cs_timer_stats_t  *s = _stats + stats_id;
+    s->hw_start = hw;
+  }
+
+  return n_hw;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set timer statistics event trace options.
+ *
+ * When enabled, each completed timer statistics interval is recorded
+ * in a fixed-size ring buffer (so only the most recent events are kept
+ * if the buffer is full), and the trace of all ranks is written at
+ * finalization to a "timer_stats_trace.json" file, using the Chrome trace
+ * event format, which may be read by Perfetto (https://ui.perfetto.dev).
+ *
+ * Recording only requires a few memory writes per timer stop, but to limit
+ * the trace size, events may be recorded only every n time steps.
+ *
+ * \param[in]  n_max_events  maximum number of events kept per rank
+ *                           (0 to disable trace)
+ * \param[in]  interval      record events every n time steps
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_trace_options(int  n_max_events,
+                                 int  interval)
+{
+  _trace_interval = (interval > 0) ? interval : 1;
+
+  if (n_max_events < 0)
+    n_max_events = 0;
+
+  if ((size_t)n_max_events != _trace_n_max) {
+    BFT_FREE(_trace);
+    _trace_n_max = n_max_events;
+    _trace_n = 0;
+    if (_trace_n_max > 0) {
+      BFT_MALLOC(_trace, _trace_n_max, cs_timer_stats_event_t);
+      _trace_t0 = cs_timer_time();
+    }
+  }
+
+  _trace_on = (   _trace != nullptr
+               && (_time_id - _start_time_id) % _trace_interval == 0);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Increment time step for timer statistics.
@@ -414,6 +824,8 @@ cs_timer_stats_increment_time_step(void)
     cs_timer_stats_t  *s = _stats + stats_id;
     if (s->active) {
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_incr);
+      if (_trace_on)
+        _trace_record(stats_id, &(s->t_start), &t_incr);
       s->t_start = t_incr;
     }
   }
@@ -438,6 +850,9 @@ cs_timer_stats_increment_time_step(void)
   }
 
   _time_id += 1;
+
+  _trace_on = (   _trace != nullptr
+               && (_time_id - _start_time_id) % _trace_interval == 0);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -538,6 +953,11 @@ cs_timer_stats_create(const char  *parent_name,
   CS_TIMER_COUNTER_INIT(s->t_cur);
   CS_TIMER_COUNTER_INIT(s->t_tot);
 
+  for (int i = 0; i < CS_TIMER_HW_N_COUNTERS; i++) {
+    s->hw_start.count[i] = 0;
+    s->hw_tot.count[i] = 0;
+  }
+
   return stats_id;
 }
 
@@ -639,6 +1059,10 @@ cs_timer_stats_start(int  id)
 
   int parent_id = _common_parent_id(id, _active_id[root_id]);
 
+  cs_timer_hw_t hw;
+  if (_hw_on)
+    cs_timer_hw_read(&hw);
+
   /* Start timer and inactive parents */
 
   for (int p_id = id; p_id > parent_id; p_id = (_stats + p_id)->parent_id) {
@@ -648,6 +1072,8 @@ cs_timer_stats_start(int  id)
     if (s->active == false) {
       s->active = true;
       s->t_start = t_start;
+      if (_hw_on)
+        s->hw_start = hw;
     }
 
   }
@@ -674,6 +1100,10 @@ cs_timer_stats_stop(int  id)
 
   cs_timer_t t_stop = cs_timer_time();
 
+  cs_timer_hw_t hw;
+  if (_hw_on)
+    cs_timer_hw_read(&hw);
+
   /* Stop timer and active children */
 
   const int root_id = s->root_id;
@@ -686,6 +1116,10 @@ cs_timer_stats_stop(int  id)
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_stop);
+      if (_trace_on)
+        _trace_record((int)(s - _stats), &(s->t_start), &t_stop);
+      if (_hw_on)
+        _hw_add_diff(s, &hw);
     }
 
   }
@@ -723,6 +1157,10 @@ cs_timer_stats_switch(int  id)
 
   int parent_id = _common_parent_id(id, _active_id[root_id]);
 
+  cs_timer_hw_t hw;
+  if (_hw_on)
+    cs_timer_hw_read(&hw);
+
   /* Stop all active timers of same type which are lower level than the
      common parent. */
 
@@ -734,6 +1172,10 @@ cs_timer_stats_switch(int  id)
       s->active = false;
       _active_id[root_id] = s->parent_id;
       cs_timer_counter_add_diff(&(s->t_cur), &(s->t_start), &t_switch);
+      if (_trace_on)
+        _trace_record((int)(s - _stats), &(s->t_start), &t_switch);
+      if (_hw_on)
+        _hw_add_diff(s, &hw);
     }
 
   }
@@ -748,6 +1190,8 @@ cs_timer_stats_switch(int  id)
     if (s->active == false) {
       s->active = true;
       s->t_start = t_switch;
+      if (_hw_on)
+        s->hw_start = hw;
     }
 
   }
@@ -779,8 +1223,11 @@ cs_timer_stats_add_diff(int                id,
 
   cs_timer_stats_t  *s = _stats + id;
 
-  if (s->active == false)
+  if (s->active == false) {
     cs_timer_counter_add_diff(&(s->t_cur), t0, t1);
+    if (_trace_on)
+      _trace_record(id, t0, t1);
+  }
 }
 
 /*----------------------------------------------------------------------------*/
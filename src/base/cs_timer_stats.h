@@ -105,6 +105,41 @@ cs_timer_stats_set_plot_options(cs_time_plot_format_t   format,
                                 int                     n_buffer_steps,
                                 double                  flush_wtime);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Enable hardware counters for timer statistics.
+ *
+ * When available, cycles, instructions, and last level cache misses
+ * are accumulated for each statistic, and derived metrics are logged
+ * to the performance log at finalization.
+ *
+ * This is a collective operation.
+ *
+ * \return  number of available hardware counters (0 if not available)
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_timer_stats_enable_hw_counters(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set timer statistics event trace options.
+ *
+ * When enabled, completed timer statistics intervals are recorded in a
+ * ring buffer, and written at finalization to "timer_stats_trace.json"
+ * (Chrome trace event format, readable by Perfetto).
+ *
+ * \param[in]  n_max_events  maximum number of events kept per rank
+ *                           (0 to disable trace)
+ * \param[in]  interval      record events every n time steps
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_timer_stats_set_trace_options(int  n_max_events,
+                                 int  interval);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Increment time step for timer statistics.
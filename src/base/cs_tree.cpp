@@ -351,6 +351,156 @@ _node_free(cs_tree_node_t  **pnode)
   BFT_FREE(*pnode);
 }
 
+/*----------------------------------------------------------------------------
+ * Return the number of bytes used by a node's value.
+ *
+ * parameters:
+ *   node <-- pointer to node
+ *
+ * returns:
+ *   size of associated value, in bytes
+ *----------------------------------------------------------------------------*/
+
+static size_t
+_value_size(const cs_tree_node_t  *node)
+{
+  if (node->value == nullptr)
+    return 0;
+
+  if (node->flag & CS_TREE_NODE_INT)
+    return node->size * sizeof(int);
+  else if (node->flag & CS_TREE_NODE_REAL)
+    return node->size * sizeof(cs_real_t);
+  else if (node->flag & CS_TREE_NODE_BOOL)
+    return node->size * sizeof(bool);
+
+  return strlen((const char *)node->value) + 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Pack an integer and associated bytes to a buffer.
+ *
+ * If the buffer is null, only the required size is computed.
+ *
+ * parameters:
+ *   n    <-- number of bytes
+ *   src  <-- pointer to bytes, or null
+ *   buf  <-> buffer, or null
+ *   pos  <-> current position in buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_pack_bytes(int           n,
+            const void   *src,
+            char         *buf,
+            size_t       *pos)
+{
+  if (buf != nullptr) {
+    memcpy(buf + *pos, &n, sizeof(int));
+    if (n > 0)
+      memcpy(buf + *pos + sizeof(int), src, n);
+  }
+  *pos += sizeof(int) + n;
+}
+
+/*----------------------------------------------------------------------------
+ * Pack a node and its descendants to a buffer.
+ *
+ * If the buffer is null, only the required size is computed.
+ *
+ * parameters:
+ *   node <-- pointer to node
+ *   buf  <-> buffer, or null
+ *   pos  <-> current position in buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_pack_node(const cs_tree_node_t  *node,
+           char                  *buf,
+           size_t                *pos)
+{
+  int n_children = 0;
+  for (const cs_tree_node_t *c = node->children; c != nullptr; c = c->next)
+    n_children++;
+
+  int sizes[3] = {node->flag, node->size, n_children};
+
+  _pack_bytes((node->name != nullptr) ? strlen(node->name) + 1 : 0,
+              node->name, buf, pos);
+  _pack_bytes((node->desc != nullptr) ? strlen(node->desc) + 1 : 0,
+              node->desc, buf, pos);
+  _pack_bytes(sizeof(sizes), sizes, buf, pos);
+  _pack_bytes(_value_size(node), node->value, buf, pos);
+
+  for (const cs_tree_node_t *c = node->children; c != nullptr; c = c->next)
+    _pack_node(c, buf, pos);
+}
+
+/*----------------------------------------------------------------------------
+ * Unpack bytes packed by _pack_bytes.
+ *
+ * parameters:
+ *   buf  <-- buffer
+ *   pos  <-> current position in buffer
+ *   n    --> number of bytes
+ *
+ * returns:
+ *   pointer to bytes in buffer
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_unpack_bytes(const char  *buf,
+              size_t      *pos,
+              int         *n)
+{
+  memcpy(n, buf + *pos, sizeof(int));
+  const char *retval = buf + *pos + sizeof(int);
+  *pos += sizeof(int) + *n;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Unpack a node and its descendants from a buffer, adding them below
+ * a given parent.
+ *
+ * parameters:
+ *   parent <-> pointer to parent node
+ *   buf    <-- buffer
+ *   pos    <-> current position in buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_unpack_node(cs_tree_node_t  *parent,
+             const char      *buf,
+             size_t          *pos)
+{
+  int n;
+
+  const char *name = _unpack_bytes(buf, pos, &n);
+  cs_tree_node_t *node = cs_tree_add_child(parent, (n > 0) ? name : nullptr);
+
+  const char *desc = _unpack_bytes(buf, pos, &n);
+  if (n > 0) {
+    BFT_MALLOC(node->desc, n, char);
+    memcpy(node->desc, desc, n);
+  }
+
+  int sizes[3];
+  memcpy(sizes, _unpack_bytes(buf, pos, &n), sizeof(sizes));
+  node->flag = sizes[0];
+  node->size = sizes[1];
+
+  const char *value = _unpack_bytes(buf, pos, &n);
+  if (n > 0) {
+    BFT_MALLOC(node->value, n, char);
+    memcpy(node->value, value, n);
+  }
+
+  for (int i = 0; i < sizes[2]; i++)
+    _unpack_node(node, buf, pos);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1785,6 +1935,63 @@ cs_tree_dump(cs_log_t                log,
 
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Pack the descendants of a node to a contiguous buffer.
+ *
+ * This allows building a tree on a single rank and sending it to others
+ * instead of parsing its source on each rank.
+ *
+ * The caller is responsible for freeing the returned buffer.
+ *
+ * \param[in]   root  pointer to the node whose children are packed
+ * \param[out]  size  size of the returned buffer, in bytes
+ *
+ * \return  pointer to packed buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+char *
+cs_tree_pack_children(const cs_tree_node_t  *root,
+                      size_t                *size)
+{
+  size_t pos = 0;
+  for (const cs_tree_node_t *c = root->children; c != nullptr; c = c->next)
+    _pack_node(c, nullptr, &pos);
+
+  char *buf = nullptr;
+  BFT_MALLOC(buf, pos + 1, char);
+
+  *size = pos;
+
+  pos = 0;
+  for (const cs_tree_node_t *c = root->children; c != nullptr; c = c->next)
+    _pack_node(c, buf, &pos);
+
+  return buf;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Unpack nodes packed by \ref cs_tree_pack_children, appending them
+ *         to the children of a given node.
+ *
+ * \param[in, out]  root  pointer to the node to which children are added
+ * \param[in]       size  size of the packed buffer, in bytes
+ * \param[in]       buf   packed buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_tree_unpack_children(cs_tree_node_t  *root,
+                        size_t           size,
+                        const char      *buf)
+{
+  size_t pos = 0;
+  while (pos < size)
+    _unpack_node(root, buf, &pos);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
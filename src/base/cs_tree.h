@@ -907,6 +907,39 @@ cs_tree_dump(cs_log_t                log,
              int                     depth,
              const cs_tree_node_t   *node);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Pack the descendants of a node to a contiguous buffer.
+ *
+ * The caller is responsible for freeing the returned buffer.
+ *
+ * \param[in]   root  pointer to the node whose children are packed
+ * \param[out]  size  size of the returned buffer, in bytes
+ *
+ * \return  pointer to packed buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+char *
+cs_tree_pack_children(const cs_tree_node_t  *root,
+                      size_t                *size);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Unpack nodes packed by \ref cs_tree_pack_children, appending them
+ *         to the children of a given node.
+ *
+ * \param[in, out]  root  pointer to the node to which children are added
+ * \param[in]       size  size of the packed buffer, in bytes
+ * \param[in]       buf   packed buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_tree_unpack_children(cs_tree_node_t  *root,
+                        size_t           size,
+                        const char      *buf);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -126,6 +126,9 @@ typedef struct {
   cs_lnum_t                  n_b_faces_ref;     /* reference number of
                                                    boundary faces */
 
+  double                    *joined_angle;      /* rotation angles at last
+                                                   joining, or NULL */
+
   int                       *cell_rotor_num;    /* cell rotation axis number */
 
   cs_real_t                 *coftur;            /* wall BC coefficient to update
@@ -314,6 +317,7 @@ _turbomachinery_create(void)
 
   tbm->reference_mesh = cs_mesh_create();
   tbm->n_b_faces_ref = -1;
+  tbm->joined_angle = NULL;
   tbm->coftur = NULL;
   tbm->hfltur = NULL;
   tbm->cell_rotor_num = NULL;
@@ -685,13 +689,15 @@ _update_angle(const cs_time_step_t  *ts)
  * Update mesh vertex positions
  *
  * parameters:
- *   mesh <-> mesh to update
- *   dt   <-- associated time delta (0 for current, unmodified time)
+ *   mesh      <-> mesh to update
+ *   dt        <-- associated time delta (0 for current, unmodified time)
+ *   vtx_moved --> flag for vertices of rotor cells, or NULL
  *----------------------------------------------------------------------------*/
 
 static void
 _update_geometry(cs_mesh_t  *mesh,
-                 cs_real_t   dt)
+                 cs_real_t   dt,
+                 bool        vtx_moved[])
 {
   cs_turbomachinery_t *tbm = _turbomachinery;
 
@@ -760,6 +766,11 @@ _update_geometry(cs_mesh_t  *mesh,
                             &(mesh->vtx_coord[3*v_id]));
   }
 
+  if (vtx_moved != NULL) {
+    for (v_id = 0; v_id < mesh->n_vertices; v_id++)
+      vtx_moved[v_id] = (vtx_rotor_num[v_id] > 0) ? true : false;
+  }
+
   BFT_FREE(m);
   BFT_FREE(vtx_rotor_num);
 }
@@ -853,6 +864,35 @@ _select_rotor_cells(cs_turbomachinery_t  *tbm)
     _check_geometry(m);
 }
 
+/*----------------------------------------------------------------------------
+ * Check whether rotor positions have changed since the last joining.
+ *
+ * When rotors have not moved (for example when rotation velocities are
+ * zero), the joined mesh is unchanged, so the rotor-stator joining and
+ * the rebuild of halos, numberings and mesh quantities may be skipped.
+ *
+ * parameters:
+ *   tbm <-- turbomachinery options structure
+ *
+ * returns:
+ *   true if the mesh needs to be joined again, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_rotors_moved_since_join(const cs_turbomachinery_t  *tbm)
+{
+  if (tbm->joined_angle == NULL)
+    return true;
+
+  for (int j = 0; j < tbm->n_rotors+1; j++) {
+    const cs_rotation_t *r = tbm->rotation + j;
+    if (fabs(r->angle - tbm->joined_angle[j]) > 0.)
+      return true;
+  }
+
+  return false;
+}
+
 /*----------------------------------------------------------------------------
  * Update mesh for unsteady rotor/stator computation when no joining is used.
  *
@@ -887,12 +927,22 @@ _update_mesh_coupling(double  *t_elapsed)
 
   _update_angle(cs_glob_time_step);
 
-  if (tbm->n_rotors > 0)
-    _update_geometry(cs_glob_mesh, 0);
+  bool *vtx_moved = NULL;
 
-  /* Recompute geometric quantities related to the mesh */
+  if (tbm->n_rotors > 0) {
+    BFT_MALLOC(vtx_moved, cs_glob_mesh->n_vertices, bool);
+    _update_geometry(cs_glob_mesh, 0, vtx_moved);
+  }
 
-  cs_mesh_quantities_compute(cs_glob_mesh, cs_glob_mesh_quantities);
+  /* Recompute geometric quantities related to the mesh
+     (only for the rotating part, as the topology does not change) */
+
+  cs_mesh_quantities_update_moved(cs_glob_mesh,
+                                  cs_glob_mesh_quantities,
+                                  vtx_moved);
+  cs_gradient_invalidate_quantities();
+
+  BFT_FREE(vtx_moved);
 
   /* Update linear algebra APIs relative to mesh */
 
@@ -937,6 +987,17 @@ _update_mesh(bool     restart_mode,
     return;
   }
 
+  /* If rotors did not move since the last joining, the current
+     joined mesh may be kept as is */
+
+  _update_angle(cs_glob_time_step);
+
+  if (restart_mode == false && _rotors_moved_since_join(tbm) == false) {
+    *t_elapsed = cs_timer_wtime() - t_start;
+    cs_timer_stats_switch(t_top_id);
+    return;
+  }
+
   /* Cell and boundary face numberings can be moved from old mesh
      to new one, as the corresponding parts of the mesh should not change */
 
@@ -958,8 +1019,6 @@ _update_mesh(bool     restart_mode,
   cs_glob_mesh->verbosity = 0;
   cs_glob_mesh_builder = cs_mesh_builder_create();
 
-  _update_angle(cs_glob_time_step);
-
   if (restart_mode == false) {
 
     int n_retry = CS_MAX(tbm->n_max_join_tries, 1);
@@ -977,7 +1036,7 @@ _update_mesh(bool     restart_mode,
       /* Update geometry, if necessary */
 
       if (tbm->n_rotors > 0)
-        _update_geometry(cs_glob_mesh, eps_dt);
+        _update_geometry(cs_glob_mesh, eps_dt, NULL);
 
       /* Reset the interior faces -> cells connectivity */
       /* (in order to properly build the halo of the joined mesh) */
@@ -1104,6 +1163,10 @@ _update_mesh(bool     restart_mode,
 
   tbm->n_b_faces_ref = cs_glob_mesh->n_b_faces;
 
+  BFT_REALLOC(tbm->joined_angle, tbm->n_rotors+1, double);
+  for (int j = 0; j < tbm->n_rotors+1; j++)
+    tbm->joined_angle[j] = tbm->rotation[j].angle;
+
   /* Initialize extended connectivity, ghost cells and other remaining
      parallelism-related structures */
 
@@ -1703,6 +1766,7 @@ cs_turbomachinery_finalize(void)
     BFT_FREE(tbm->rotation);
 
     BFT_FREE(tbm->cell_rotor_num);
+    BFT_FREE(tbm->joined_angle);
 
     if (tbm->reference_mesh != NULL)
       cs_mesh_destroy(tbm->reference_mesh);
@@ -1755,6 +1819,10 @@ cs_turbomachinery_resize_cell_fields(void)
   const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(CS_MESH_LOCATION_CELLS);
   cs_lnum_t _n_cells = n_elts[2];
 
+  /* Grouped field values are reallocated individually, then regrouped */
+
+  cs_field_ungroup_values_all();
+
   for (int f_id = 0; f_id < n_fields; f_id++) {
 
     cs_field_t *f = cs_field_by_id(f_id);
@@ -1811,6 +1879,8 @@ cs_turbomachinery_resize_cell_fields(void)
       }
     }
   }
+
+  cs_field_group_values_all();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -529,6 +529,178 @@ _smoothe(const cs_mesh_t              *m,
   BFT_FREE(grad);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the interface band of the void fraction.
+ *
+ * The band contains mixed cells (with a void fraction strictly between
+ * 0 and 1, up to a tolerance) and pure cells adjacent to a cell with a
+ * different value, plus a margin layer. Interior faces whose adjacent
+ * cells are both outside the band separate cells in the same pure state,
+ * so they carry no drift (compressive) flux.
+ *
+ * \param[in]  m     pointer to mesh structure
+ * \param[in]  pvar  void fraction (synchronized)
+ *
+ * \return  band indicator (> 0 in band) on cells with ghosts
+ */
+/*----------------------------------------------------------------------------*/
+
+static char *
+_interface_band(const cs_mesh_t  *m,
+                const cs_real_t   pvar[])
+{
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *)m->i_face_cells;
+
+  /* Tolerance on pure states, and number of margin layers */
+  const cs_real_t eps = 1.e-6;
+  const char n_margin_layers = 1;
+
+  char *band;
+  BFT_MALLOC(band, n_cells_ext, char);
+
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+    band[c_id] = (pvar[c_id] > eps && pvar[c_id] < 1. - eps) ? 1 : 0;
+
+  /* Seed with sharp jumps, then add margin layers; cells of layer l
+     are marked l+1, so each pass adds a single layer */
+
+  for (char l = 0; l <= n_margin_layers; l++) {
+
+    if (l > 0 && m->halo != nullptr)
+      cs_halo_sync_untyped(m->halo, CS_HALO_STANDARD, sizeof(char), band);
+
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+             face_id++) {
+
+          cs_lnum_t ii = i_face_cells[face_id][0];
+          cs_lnum_t jj = i_face_cells[face_id][1];
+
+          if (l == 0) {
+            if (cs_math_fabs(pvar[ii] - pvar[jj]) > eps) {
+              band[ii] = 1;
+              band[jj] = 1;
+            }
+          }
+          else {
+            if (band[ii] == l && band[jj] == 0)
+              band[jj] = l + 1;
+            else if (band[jj] == l && band[ii] == 0)
+              band[ii] = l + 1;
+          }
+
+        }
+      }
+    }
+
+  }
+
+  if (m->halo != nullptr)
+    cs_halo_sync_untyped(m->halo, CS_HALO_STANDARD, sizeof(char), band);
+
+  return band;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the Deshpande drift flux at internal faces, optionally
+ *        restricted to the interface band.
+ *
+ * \param[in]  m     pointer to mesh structure
+ * \param[in]  mq    pointer to mesh quantities structure
+ * \param[in]  band  interface band indicator, or nullptr for all faces
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_deshpande_drift_flux(const cs_mesh_t             *m,
+                      const cs_mesh_quantities_t  *mq,
+                      const char                   band[])
+{
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_gnum_t n_g_cells = m->n_g_cells;
+  const cs_lnum_t n_cells_with_ghosts = m->n_cells_with_ghosts;
+
+  const cs_real_t tot_vol = mq->tot_vol;
+  const cs_real_t *i_face_surf = (const cs_real_t *)mq->i_face_surf;
+  const cs_real_3_t *i_face_normal = (const cs_real_3_t *)mq->i_face_normal;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+
+  /* Constant parameter */
+  const cs_real_t cdrift = _vof_parameters.cdrift;
+
+  const int kimasf = cs_field_key_id("inner_mass_flux_id");
+  const cs_real_t *restrict i_volflux =
+    cs_field_by_id(cs_field_get_key_int(CS_F_(void_f), kimasf))->val;
+
+  cs_real_t *cpro_idriftf = cs_field_by_name("inner_drift_velocity_flux")->val;
+
+  /* Check if field exists */
+  if (cpro_idriftf == nullptr)
+    bft_error(__FILE__, __LINE__, 0,_("error drift velocity not defined\n"));
+
+  cs_real_3_t *voidf_grad;
+  BFT_MALLOC(voidf_grad, n_cells_with_ghosts, cs_real_3_t);
+
+  /* Compute the gradient of the void fraction */
+  cs_field_gradient_scalar(CS_F_(void_f),
+                           true,           // use_previous_t
+                           1,              // inc
+                           voidf_grad);
+
+  /* Stabilization factor */
+  cs_real_t delta = pow(10,-8)/pow(tot_vol/n_g_cells,(1./3.));
+
+  /* Compute the max of flux/Surf over the entire domain*/
+  cs_real_t maxfluxsurf = 0.;
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (maxfluxsurf < std::abs(i_volflux[f_id])/i_face_surf[f_id])
+      maxfluxsurf = std::abs(i_volflux[f_id])/i_face_surf[f_id];
+  }
+  cs_parall_max(1, CS_REAL_TYPE, &maxfluxsurf);
+
+  /* Compute the relative velocity at internal faces */
+  cs_real_t gradface[3], normalface[3];
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t cell_id1 = i_face_cells[f_id][0];
+    cs_lnum_t cell_id2 = i_face_cells[f_id][1];
+
+    /* Faces outside the interface band do not contribute to the
+       drift term */
+    if (band != nullptr && band[cell_id1] == 0 && band[cell_id2] == 0) {
+      cpro_idriftf[f_id] = 0.;
+      continue;
+    }
+    cs_real_t fluxfactor
+      = cs_math_fmin(cdrift*std::abs(i_volflux[f_id])/i_face_surf[f_id],
+                     maxfluxsurf);
+
+    for (cs_lnum_t idim = 0; idim < 3; idim++)
+      gradface[idim] = (  voidf_grad[cell_id1][idim]
+                        + voidf_grad[cell_id2][idim])/2.;
+
+    cs_real_t normgrad = cs_math_3_norm(gradface);
+
+    for (cs_lnum_t idim = 0; idim < 3; idim++)
+      normalface[idim] = gradface[idim] / (normgrad+delta);
+
+    cpro_idriftf[f_id] =
+      fluxfactor*cs_math_3_dot_product(normalface, i_face_normal[f_id]);
+  }
+
+  BFT_FREE(voidf_grad);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1191,6 +1363,14 @@ cs_vof_surface_tension(const cs_mesh_t             *m,
                      nullptr,
                      gradnxyz);
 
+  /* The surface tension force is only non-zero in the interface band,
+     where the gradient of the diffused void fraction is non-zero */
+  char *band;
+  BFT_MALLOC(band, n_cells_ext, char);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+    band[c_id] = (cs_math_3_square_norm(surfxyz_unnormed[c_id]) > 0.) ? 1 : 0;
+
   /* Reconstructions for curvature computation */
   for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
     curv[c_id] = 0.;
@@ -1199,6 +1379,9 @@ cs_vof_surface_tension(const cs_mesh_t             *m,
     cs_lnum_t ii = i_face_cells[face_id][0];
     cs_lnum_t jj = i_face_cells[face_id][1];
 
+    if (band[ii] == 0 && band[jj] == 0)
+      continue;
+
     cs_real_t gradf[3];
 
     for (cs_lnum_t k = 0; k < 3; k++)
@@ -1216,11 +1399,18 @@ cs_vof_surface_tension(const cs_mesh_t             *m,
   }
 
   /* Compute volumic surface tension */
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (band[c_id] == 0) {
+      for (cs_lnum_t i = 0; i < 3; i++)
+        stf[c_id][i] = 0.;
+      continue;
+    }
     for (cs_lnum_t i = 0; i < 3; i++) {
       stf[c_id][i] = -cpro_surftens * surfxyz_unnormed[c_id][i] * curv[c_id];
     }
+  }
 
+  BFT_FREE(band);
   BFT_FREE(surfxyz_norm);
   BFT_FREE(surfxyz_unnormed);
   BFT_FREE(gradnxyz);
@@ -1275,71 +1465,7 @@ void
 cs_vof_deshpande_drift_flux(const cs_mesh_t             *m,
                             const cs_mesh_quantities_t  *mq)
 {
-  const cs_lnum_t n_i_faces = m->n_i_faces;
-  const cs_gnum_t n_g_cells = m->n_g_cells;
-  const cs_lnum_t n_cells_with_ghosts = m->n_cells_with_ghosts;
-
-  const cs_real_t tot_vol = mq->tot_vol;
-  const cs_real_t *i_face_surf = (const cs_real_t *)mq->i_face_surf;
-  const cs_real_3_t *i_face_normal = (const cs_real_3_t *)mq->i_face_normal;
-  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
-
-  /* Constant parameter */
-  const cs_real_t cdrift = _vof_parameters.cdrift;
-
-  const int kimasf = cs_field_key_id("inner_mass_flux_id");
-  const cs_real_t *restrict i_volflux =
-    cs_field_by_id(cs_field_get_key_int(CS_F_(void_f), kimasf))->val;
-
-  cs_real_t *cpro_idriftf = cs_field_by_name("inner_drift_velocity_flux")->val;
-
-  /* Check if field exists */
-  if (cpro_idriftf == nullptr)
-    bft_error(__FILE__, __LINE__, 0,_("error drift velocity not defined\n"));
-
-  cs_real_3_t *voidf_grad;
-  BFT_MALLOC(voidf_grad, n_cells_with_ghosts, cs_real_3_t);
-
-  /* Compute the gradient of the void fraction */
-  cs_field_gradient_scalar(CS_F_(void_f),
-                           true,           // use_previous_t
-                           1,              // inc
-                           voidf_grad);
-
-  /* Stabilization factor */
-  cs_real_t delta = pow(10,-8)/pow(tot_vol/n_g_cells,(1./3.));
-
-  /* Compute the max of flux/Surf over the entire domain*/
-  cs_real_t maxfluxsurf = 0.;
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-    if (maxfluxsurf < std::abs(i_volflux[f_id])/i_face_surf[f_id])
-      maxfluxsurf = std::abs(i_volflux[f_id])/i_face_surf[f_id];
-  }
-  cs_parall_max(1, CS_REAL_TYPE, &maxfluxsurf);
-
-  /* Compute the relative velocity at internal faces */
-  cs_real_t gradface[3], normalface[3];
-  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
-    cs_lnum_t cell_id1 = i_face_cells[f_id][0];
-    cs_lnum_t cell_id2 = i_face_cells[f_id][1];
-    cs_real_t fluxfactor
-      = cs_math_fmin(cdrift*std::abs(i_volflux[f_id])/i_face_surf[f_id],
-                     maxfluxsurf);
-
-    for (cs_lnum_t idim = 0; idim < 3; idim++)
-      gradface[idim] = (  voidf_grad[cell_id1][idim]
-                        + voidf_grad[cell_id2][idim])/2.;
-
-    cs_real_t normgrad = cs_math_3_norm(gradface);
-
-    for (cs_lnum_t idim = 0; idim < 3; idim++)
-      normalface[idim] = gradface[idim] / (normgrad+delta);
-
-    cpro_idriftf[f_id] =
-      fluxfactor*cs_math_3_dot_product(normalface, i_face_normal[f_id]);
-  }
-
-  BFT_FREE(voidf_grad);
+  _deshpande_drift_flux(m, mq, nullptr);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1418,6 +1544,10 @@ cs_vof_drift_term(int                        imrgra,
 
   const cs_real_t  *restrict _pvar = (pvar != nullptr) ? pvar : pvara;
 
+  /* Drift fluxes only need to be computed in the interface band */
+
+  char *band = _interface_band(m, _pvar);
+
   /*======================================================================
     Computation of the drift flux
     ======================================================================*/
@@ -1429,7 +1559,7 @@ cs_vof_drift_term(int                        imrgra,
   if (_vof_parameters.idrift == 1) {
 
     // FIXME Handle boundary terms bdriftflux
-    cs_vof_deshpande_drift_flux(cs_glob_mesh, cs_glob_mesh_quantities);
+    _deshpande_drift_flux(cs_glob_mesh, cs_glob_mesh_quantities, band);
 
   } else {
 
@@ -1518,6 +1648,9 @@ cs_vof_drift_term(int                        imrgra,
         cs_lnum_t ii = i_face_cells[face_id][0];
         cs_lnum_t jj = i_face_cells[face_id][1];
 
+        if (band[ii] == 0 && band[jj] == 0)
+          continue;
+
         cs_real_t irvf = 0.;
         if (idriftflux != nullptr)
           irvf = idriftflux->val[face_id];
@@ -1556,6 +1689,8 @@ cs_vof_drift_term(int                        imrgra,
       }
     }
   }
+
+  BFT_FREE(band);
 }
 
 /*----------------------------------------------------------------------------*/
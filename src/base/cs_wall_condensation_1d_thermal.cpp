@@ -610,15 +610,19 @@ cs_wall_condensation_1d_thermal_compute_temperature(void)
   /* Resolution of the 1-D thermal problem coupled with condensation
      ---------------------------------------------------------------*/
 
-  cs_real_t dtmur[znmurx];
-  cs_real_t da[znmurx], xsm[znmurx], xa[znmurx][2];
+  /* Faces are independent, so they are handled in parallel,
+     with thread-local work arrays */
 
+# pragma omp parallel for if (nfbpcd > CS_THR_MIN)
   for (cs_lnum_t ii = 0; ii < nfbpcd; ii++) {
     const cs_lnum_t iz = izzftcd[ii];
 
     if (iztag1d[iz] != 1)
       continue;
 
+    cs_real_t dtmur[znmurx];
+    cs_real_t da[znmurx], xsm[znmurx], xa[znmurx][2];
+
     const cs_lnum_t face_id = ifbpcd[ii];
     const cs_lnum_t c_id    = b_face_cells[face_id];
 
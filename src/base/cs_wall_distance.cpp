@@ -109,6 +109,218 @@ const cs_wall_distance_options_t *cs_glob_wall_distance_options
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Update the closest wall point of a cell from that of a neighbor cell.
+ *
+ * parameters:
+ *   c_id      <-- id of cell to update
+ *   n_id      <-- id of neighbor cell
+ *   cell_cen  <-- cell centers
+ *   w_pt      <-> closest known wall point of each cell
+ *   wall_dist <-> distance to closest known wall point of each cell
+ *
+ * returns:
+ *   1 if the cell was updated, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline int
+_update_closest_wall_point(cs_lnum_t          c_id,
+                           cs_lnum_t          n_id,
+                           const cs_real_3_t  cell_cen[],
+                           cs_real_3_t        w_pt[],
+                           cs_real_t          wall_dist[])
+{
+  if (wall_dist[n_id] >= cs_math_big_r)
+    return 0;
+
+  cs_real_t d = cs_math_3_distance(cell_cen[c_id], w_pt[n_id]);
+
+  if (d < wall_dist[c_id]*(1. - 1e-12)) {
+    wall_dist[c_id] = d;
+    for (int i = 0; i < 3; i++)
+      w_pt[c_id][i] = w_pt[n_id][i];
+    return 1;
+  }
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute distance to wall by propagation of the closest wall point.
+ *
+ * Each cell carries the closest wall point known so far, initialized
+ * from wall boundary faces (projection of the cell center on the face
+ * plane) and immersed walls. Alternating forward and backward sweeps
+ * over interior faces then propagate these points, as in a fast sweeping
+ * solver for the Eikonal equation, until no cell is improved.
+ * Convergence usually requires only a few sweeps, since updates are
+ * propagated along the whole face ordering within a single sweep.
+ *
+ * parameters:
+ *   m         <-- pointer to mesh
+ *   mq        <-- pointer to mesh quantities
+ *   bc_type   <-- boundary face types
+ *   wall_dist --> distance to wall
+ *----------------------------------------------------------------------------*/
+
+static void
+_wall_distance_sweep(const cs_mesh_t             *m,
+                     const cs_mesh_quantities_t  *mq,
+                     const int                    bc_type[],
+                     cs_real_t                    wall_dist[])
+{
+  const cs_lnum_t n_cells     = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces   = m->n_i_faces;
+  const cs_lnum_t n_b_faces   = m->n_b_faces;
+
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_lnum_t *b_face_cells = m->b_face_cells;
+  const cs_real_3_t *cell_cen = (const cs_real_3_t *)mq->cell_cen;
+  const cs_nreal_3_t *b_face_u_normal = mq->b_face_u_normal;
+  const cs_real_t *b_dist = mq->b_dist;
+
+  const int n_max_sweeps = 100;
+
+  cs_real_3_t *w_pt;
+  BFT_MALLOC(w_pt, n_cells_ext, cs_real_3_t);
+
+# pragma omp parallel for if (n_cells_ext > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    wall_dist[c_id] = cs_math_big_r;
+    for (int i = 0; i < 3; i++)
+      w_pt[c_id][i] = 0.;
+  }
+
+  /* Initialize from walls */
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    if (bc_type[f_id] == CS_SMOOTHWALL || bc_type[f_id] == CS_ROUGHWALL) {
+      cs_lnum_t c_id = b_face_cells[f_id];
+      if (b_dist[f_id] < wall_dist[c_id]) {
+        wall_dist[c_id] = b_dist[f_id];
+        for (int i = 0; i < 3; i++)
+          w_pt[c_id][i] =   cell_cen[c_id][i]
+                          + b_dist[f_id]*b_face_u_normal[f_id][i];
+      }
+    }
+  }
+
+  const cs_real_t *c_w_face_surf = mq->c_w_face_surf;
+  const cs_real_3_t *c_w_face_cog = (const cs_real_3_t *)mq->c_w_face_cog;
+
+  if (c_w_face_surf != nullptr && c_w_face_cog != nullptr) {
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      if (c_w_face_surf[c_id] > DBL_MIN) {
+        cs_real_t d = cs_math_3_distance(cell_cen[c_id], c_w_face_cog[c_id]);
+        if (d < wall_dist[c_id]) {
+          wall_dist[c_id] = d;
+          for (int i = 0; i < 3; i++)
+            w_pt[c_id][i] = c_w_face_cog[c_id][i];
+        }
+      }
+    }
+  }
+
+  /* Sweeps (sequential, as each update may be used by the next faces) */
+
+  int n_sweeps = 0;
+  cs_gnum_t n_updates = 0;
+
+  do {
+
+    if (m->halo != nullptr) {
+      cs_halo_sync_var(m->halo, CS_HALO_STANDARD, wall_dist);
+      cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD,
+                               (cs_real_t *)w_pt, 3);
+    }
+
+    n_updates = 0;
+
+    if (n_sweeps % 2 == 0) {
+      for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+        cs_lnum_t c_id0 = i_face_cells[f_id][0];
+        cs_lnum_t c_id1 = i_face_cells[f_id][1];
+        n_updates += _update_closest_wall_point(c_id0, c_id1, cell_cen,
+                                                w_pt, wall_dist);
+        n_updates += _update_closest_wall_point(c_id1, c_id0, cell_cen,
+                                                w_pt, wall_dist);
+      }
+    }
+    else {
+      for (cs_lnum_t f_id = n_i_faces - 1; f_id > -1; f_id--) {
+        cs_lnum_t c_id0 = i_face_cells[f_id][0];
+        cs_lnum_t c_id1 = i_face_cells[f_id][1];
+        n_updates += _update_closest_wall_point(c_id0, c_id1, cell_cen,
+                                                w_pt, wall_dist);
+        n_updates += _update_closest_wall_point(c_id1, c_id0, cell_cen,
+                                                w_pt, wall_dist);
+      }
+    }
+
+    n_sweeps++;
+
+    cs_parall_counter(&n_updates, 1);
+
+  } while (n_updates > 0 && n_sweeps < n_max_sweeps);
+
+  BFT_FREE(w_pt);
+
+  if (n_updates > 0)
+    cs_log_printf
+      (CS_LOG_DEFAULT,
+       _("@\n"
+         "@ @@ WARNING: Wall distance computation\n"
+         "@    =========\n"
+         "@  Closest wall point propagation not converged\n"
+         "@  after %d sweeps.\n"), n_sweeps);
+  else
+    cs_log_printf
+      (CS_LOG_DEFAULT,
+       _("\n"
+         "  Wall distance: closest wall point propagation converged"
+         " in %d sweeps.\n"), n_sweeps);
+}
+
+/*----------------------------------------------------------------------------
+ * Synchronize wall distance and log its bounds.
+ *
+ * parameters:
+ *   m         <-- pointer to mesh
+ *   wall_dist <-> distance to wall
+ *----------------------------------------------------------------------------*/
+
+static void
+_wall_distance_log_bounds(const cs_mesh_t  *m,
+                          cs_real_t         wall_dist[])
+{
+  const cs_lnum_t n_cells = m->n_cells;
+
+  if (cs_glob_rank_id > -1 || m->periodicity != NULL)
+    cs_halo_sync_var(m->halo, CS_HALO_EXTENDED, wall_dist);
+
+  cs_real_t _dismax = -cs_math_big_r;
+  cs_real_t _dismin =  cs_math_big_r;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    _dismin = cs_math_fmin(wall_dist[c_id], _dismin);
+    _dismax = cs_math_fmax(wall_dist[c_id], _dismax);
+  }
+
+  if (cs_glob_rank_id > -1)  {
+    cs_parall_min(1, CS_REAL_TYPE, &_dismin);
+    cs_parall_max(1, CS_REAL_TYPE, &_dismax);
+  }
+
+  cs_log_printf
+    (CS_LOG_DEFAULT,
+     _("\n"
+       " ** WALL DISTANCE\n"
+       "    -------------\n\n"
+       "  Min distance = %14.5e, Max distance = %14.5e.\n"),
+     _dismin, _dismax);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -129,6 +341,12 @@ const cs_wall_distance_options_t *cs_glob_wall_distance_options
  *  + \sqrt{ \grad \varia \cdot \grad \varia +2 \varia }
  *  \f]
  *
+ * With method 3, the distance is instead obtained by propagating the
+ * closest wall point from cell to cell.
+ *
+ * In both cases, the computation is skipped when boundary conditions are
+ * unchanged and the distance is already known (i.e. read at restart).
+ *
  * \param[in]     iterns        iteration number on Navier-Stokes equations
  */
 /*----------------------------------------------------------------------------*/
@@ -297,6 +515,19 @@ cs_wall_distance(int iterns)
     return;
   }
 
+  /* Geometric propagation instead of the diffusion equation */
+
+  if (_wall_distance_options.method == 3) {
+
+    CS_FREE_HD(smbrp);
+    CS_FREE_HD(rovsdt);
+
+    _wall_distance_sweep(mesh, mq, bc_type, wall_dist);
+    _wall_distance_log_bounds(mesh, wall_dist);
+
+    return;
+  }
+
   /* Prepare system to solve
      ----------------------- */
 
@@ -549,29 +780,7 @@ cs_wall_distance(int iterns)
   /* Compute bounds and print info
      ----------------------------- */
 
-  if (cs_glob_rank_id > -1 || mesh->periodicity != NULL)
-    cs_halo_sync_var(halo, CS_HALO_EXTENDED, wall_dist);
-
-  cs_real_t _dismax = -cs_math_big_r;
-  cs_real_t _dismin =  cs_math_big_r;
-
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-    _dismin = cs_math_fmin(wall_dist[c_id], _dismin);
-    _dismax = cs_math_fmax(wall_dist[c_id], _dismax);
-  }
-
-  if (cs_glob_rank_id > -1)  {
-    cs_parall_min(1, CS_REAL_TYPE, &_dismin);
-    cs_parall_max(1, CS_REAL_TYPE, &_dismax);
-  }
-
-  cs_log_printf
-    (CS_LOG_DEFAULT,
-     _("\n"
-       " ** WALL DISTANCE\n"
-       "    -------------\n\n"
-       "  Min distance = %14.5e, Max distance = %14.5e.\n"),
-     _dismin, _dismax);
+  _wall_distance_log_bounds(mesh, wall_dist);
 
   /* Free memory */
   CS_FREE_HD(i_visc);
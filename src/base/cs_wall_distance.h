@@ -59,6 +59,9 @@ typedef struct {
    * - 2: brute force algorithm (based on geometrical considerations),
    *      for serial mode without periodicity only; useful only
    *      as a reference for testing.
+   * - 3: propagation of the closest wall point by sweeps over the mesh
+   *      faces (geometric Eikonal solution, avoiding the linear solve;
+   *      not compatible with periodicity).
    *
    * Note that in the case of restarts, reading the distance from the
    * restart file will avoid minor differences due to the fact that
@@ -166,6 +166,12 @@ static cs_wall_functions_t  _wall_functions =
 
 const cs_wall_functions_t  * cs_glob_wall_functions = &_wall_functions;
 
+/* Number of Newton iterations for batch log-law solves; starting from
+   the Werner & Wengle estimate, convergence is quadratic, so this is
+   more than enough to reach machine precision in practice. */
+
+static const int _n_log_law_iter = 8;
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -202,6 +208,256 @@ cs_f_wall_functions_get_pointers(int     **iwallf,
   *ypluli  = &(_wall_functions.ypluli);
 }
 
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * One velocity scale log law for a set of elements.
+ *
+ * Both the viscous sub-layer and log layer values are computed for each
+ * element, and the result selected afterwards, so that the loop contains
+ * no data-dependent branch; the log-law equation
+ * u* (ln(y u* / nu) / kappa + B) = U is solved using a fixed number of
+ * Newton iterations starting from the Werner & Wengle value.
+ *
+ * parameters:
+ *   n_elts  <-- number of elements
+ *   elt_ids <-- element ids, or NULL
+ *   l_visc  <-- kinematic viscosity
+ *   vel     <-- wall projected cell center velocity
+ *   y       <-- wall distance
+ *   iuntur  --> indicator: 0 in the viscous sublayer
+ *   ustar   --> friction velocity
+ *   uk      --> friction velocity
+ *   yplus   --> dimensionless distance to the wall
+ *   ypup    --> yplus projected vel ratio
+ *   cofimp  --> |U_F|/|U_I^p| to ensure a good turbulence production
+ *
+ * returns:
+ *   number of elements in the viscous sub-layer
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_1scale_log_batch(cs_lnum_t         n_elts,
+                  const cs_lnum_t   elt_ids[],
+                  const cs_real_t   l_visc[],
+                  const cs_real_t   vel[],
+                  const cs_real_t   y[],
+                  int               iuntur[],
+                  cs_real_t         ustar[],
+                  cs_real_t         uk[],
+                  cs_real_t         yplus[],
+                  cs_real_t         ypup[],
+                  cs_real_t         cofimp[])
+{
+  const double ypluli = cs_glob_wall_functions->ypluli;
+  const double c_log = cs_turb_xkappa * cs_turb_cstlog + 1.;
+  const double c_min = exp(-cs_turb_cstlog * cs_turb_xkappa);
+
+  cs_gnum_t n_sub = 0;
+
+# pragma omp parallel for reduction(+:n_sub) if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_elts; ii++) {
+    const cs_lnum_t i = (elt_ids != NULL) ? elt_ids[ii] : ii;
+
+    const double ydvisc = y[i] / l_visc[i];
+    const int sub = (vel[i] * ydvisc <= ypluli * ypluli) ? 1 : 0;
+
+    /* Log layer: iterates remain above the minimum ustar, so the
+       logarithm is always defined */
+
+    double us_l = cs_math_fmax(pow(fabs(vel[i]) / cs_turb_apow
+                                   / pow(ydvisc, cs_turb_bpow),
+                                   cs_turb_dpow),
+                               c_min / ydvisc);
+    for (int iter = 0; iter < _n_log_law_iter; iter++)
+      us_l = (cs_turb_xkappa * vel[i] + us_l) / (log(ydvisc * us_l) + c_log);
+
+    /* Viscous sub-layer: U+ = y+ */
+    const double us_v = sqrt(vel[i] / ydvisc);
+
+    const double us = (sub) ? us_v : us_l;
+    const double yp = us * ydvisc;
+    const double yp_l = us_l * ydvisc;
+    const double ypup_l = yp_l / (log(yp_l) / cs_turb_xkappa + cs_turb_cstlog);
+
+    ustar[i] = us;
+    uk[i] = us;
+    yplus[i] = yp;
+    ypup[i] = (sub) ? 1. : ypup_l;
+    cofimp[i] = (sub) ? 0. : 1. - ypup_l / cs_turb_xkappa * 1.5 / yp_l;
+    iuntur[i] = 1 - sub;
+
+    n_sub += sub;
+  }
+
+  return n_sub;
+}
+
+/*----------------------------------------------------------------------------
+ * Two velocity scales log law for a set of elements.
+ *
+ * Both the viscous sub-layer and log layer values are computed for each
+ * element (with inputs replaced by harmless values where a branch is not
+ * used), and the result selected afterwards.
+ *
+ * parameters:
+ *   n_elts     <-- number of elements
+ *   elt_ids    <-- element ids, or NULL
+ *   l_visc     <-- kinematic viscosity
+ *   t_visc     <-- turbulent kinematic viscosity
+ *   vel        <-- wall projected cell center velocity
+ *   y          <-- wall distance
+ *   kinetic_en <-- turbulent kinetic energy
+ *   iuntur     --> indicator: 0 in the viscous sublayer
+ *   ustar      --> friction velocity
+ *   uk         --> friction velocity
+ *   yplus      --> dimensionless distance to the wall
+ *   ypup       --> yplus projected vel ratio
+ *   cofimp     --> |U_F|/|U_I^p| to ensure a good turbulence production
+ *
+ * returns:
+ *   number of elements in the viscous sub-layer
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_2scales_log_batch(cs_lnum_t         n_elts,
+                   const cs_lnum_t   elt_ids[],
+                   const cs_real_t   l_visc[],
+                   const cs_real_t   t_visc[],
+                   const cs_real_t   vel[],
+                   const cs_real_t   y[],
+                   const cs_real_t   kinetic_en[],
+                   int               iuntur[],
+                   cs_real_t         ustar[],
+                   cs_real_t         uk[],
+                   cs_real_t         yplus[],
+                   cs_real_t         ypup[],
+                   cs_real_t         cofimp[])
+{
+  const double ypluli = cs_glob_wall_functions->ypluli;
+  const double cmu05 = cs_turb_cmu025 * cs_turb_cmu025;
+
+  cs_gnum_t n_sub = 0;
+
+# pragma omp parallel for reduction(+:n_sub) if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_elts; ii++) {
+    const cs_lnum_t i = (elt_ids != NULL) ? elt_ids[ii] : ii;
+
+    /* Blending for very low values of k */
+    const double re = sqrt(kinetic_en[i]) * y[i] / l_visc[i];
+    const double g = exp(-re/11.);
+
+    const double uk_i = sqrt(  (1.-g) * cmu05 * kinetic_en[i]
+                             + g * l_visc[i] * vel[i] / y[i]);
+    const double yp = uk_i * y[i] / l_visc[i];
+
+    const int sub = (yp > ypluli) ? 0 : 1;
+
+    /* Log layer */
+    const double yp_l = (sub) ? 1. : yp;
+    const double t_visc_l = (sub) ? 1. : t_visc[i];
+    const double uplus = log(yp_l) / cs_turb_xkappa + cs_turb_cstlog;
+    const double ypup_l = yp_l / uplus;
+    const double ml_visc = cs_turb_xkappa * l_visc[i] * yp_l;
+    const double rcprod
+      = cs_math_fmin(cs_turb_xkappa,
+                     cs_math_fmax(1., sqrt(ml_visc / t_visc_l)) / yp_l);
+
+    /* Viscous sub-layer */
+    const double yp_v = (yp > 1.e-12) ? yp : 1.;
+    const double us_v = (yp > 1.e-12) ? fabs(vel[i] / yp_v) : 0.;
+
+    uk[i] = uk_i;
+    yplus[i] = yp;
+    ustar[i] = (sub) ? us_v : vel[i] / uplus;
+    ypup[i] = (sub) ? 1. : ypup_l;
+    cofimp[i] = (sub) ?
+      0. : 1. - ypup_l / cs_turb_xkappa * (2. * rcprod - 1. / (2. * yp_l));
+    iuntur[i] = 1 - sub;
+
+    n_sub += sub;
+  }
+
+  return n_sub;
+}
+
+/*----------------------------------------------------------------------------
+ * Scalable two velocity scales log law for a set of elements.
+ *
+ * parameters:
+ *   n_elts     <-- number of elements
+ *   elt_ids    <-- element ids, or NULL
+ *   l_visc     <-- kinematic viscosity
+ *   t_visc     <-- turbulent kinematic viscosity
+ *   vel        <-- wall projected cell center velocity
+ *   y          <-- wall distance
+ *   kinetic_en <-- turbulent kinetic energy
+ *   iuntur     --> indicator: 0 in the viscous sublayer
+ *   ustar      --> friction velocity
+ *   uk         --> friction velocity
+ *   yplus      --> dimensionless distance to the wall
+ *   ypup       --> yplus projected vel ratio
+ *   cofimp     --> |U_F|/|U_I^p| to ensure a good turbulence production
+ *   dplus      --> dimensionless shift to the wall
+ *
+ * returns:
+ *   number of elements in the viscous sub-layer
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_2scales_scalable_batch(cs_lnum_t         n_elts,
+                        const cs_lnum_t   elt_ids[],
+                        const cs_real_t   l_visc[],
+                        const cs_real_t   t_visc[],
+                        const cs_real_t   vel[],
+                        const cs_real_t   y[],
+                        const cs_real_t   kinetic_en[],
+                        int               iuntur[],
+                        cs_real_t         ustar[],
+                        cs_real_t         uk[],
+                        cs_real_t         yplus[],
+                        cs_real_t         ypup[],
+                        cs_real_t         cofimp[],
+                        cs_real_t         dplus[])
+{
+  const double ypluli = cs_glob_wall_functions->ypluli;
+
+  cs_gnum_t n_sub = 0;
+
+# pragma omp parallel for reduction(+:n_sub) if (n_elts > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_elts; ii++) {
+    const cs_lnum_t i = (elt_ids != NULL) ? elt_ids[ii] : ii;
+
+    const double uk_i = cs_turb_cmu025 * sqrt(kinetic_en[i]);
+    const double yp = uk_i * y[i] / l_visc[i];
+
+    /* Shift the wall in the viscous sub-layer */
+    const int sub = (yp > ypluli) ? 0 : 1;
+    const double dp = (sub) ? ypluli - yp : 0.;
+
+    const double ml_visc = cs_turb_xkappa * l_visc[i] * (yp + dp);
+    const double rcprod
+      = cs_math_fmin(cs_turb_xkappa,
+                     cs_math_fmax(1., sqrt(ml_visc / t_visc[i])) / (yp + dp));
+    const double uplus = log(yp + dp) / cs_turb_xkappa + cs_turb_cstlog;
+
+    uk[i] = uk_i;
+    yplus[i] = yp;
+    dplus[i] = dp;
+    ustar[i] = vel[i] / uplus;
+    ypup[i] = yp / uplus;
+    cofimp[i] = 1. - ypup[i] / cs_turb_xkappa
+                     * (2. * rcprod - 1. / (2. * yp + dp));
+    iuntur[i] = 1;
+
+    n_sub += sub;
+  }
+
+  return n_sub;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*=============================================================================
@@ -407,6 +663,126 @@ cs_wall_functions_velocity(cs_wall_f_type_t  iwallf,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the friction velocity and \f$y^+\f$ / \f$u^+\f$
+ *        for a set of elements.
+ *
+ * This is equivalent to calling \ref cs_wall_functions_velocity for each
+ * element, but the one velocity scale, two velocity scales and scalable
+ * log laws are evaluated using branch-free loops, in which the log-law
+ * equation is solved with a fixed number of Newton iterations, so they
+ * may be vectorized. Other laws are evaluated element by element.
+ *
+ * Input and output arrays are accessed through the element ids if
+ * present, or by position in the set otherwise.
+ *
+ * \param[in]     iwallf        wall function type
+ * \param[in]     n_elts        number of elements
+ * \param[in]     elt_ids       element ids, or NULL
+ * \param[in]     l_visc        kinematic viscosity
+ * \param[in]     t_visc        turbulent kinematic viscosity
+ * \param[in]     vel           wall projected cell center velocity
+ * \param[in]     y             wall distance
+ * \param[in]     rough_d       roughness length scale
+ *                              (not sand grain roughness)
+ * \param[in]     rnnb          \f$\vec{n}.(\tens{R}\vec{n})\f$
+ * \param[in]     kinetic_en    turbulent kinetic energy (cell center)
+ * \param[out]    iuntur        indicator: 0 in the viscous sublayer
+ * \param[in,out] nsubla        counter of cell in the viscous sublayer
+ * \param[in,out] nlogla        counter of cell in the log-layer
+ * \param[out]    ustar         friction velocity
+ * \param[out]    uk            friction velocity
+ * \param[out]    yplus         dimensionless distance to the wall
+ * \param[out]    ypup          yplus projected vel ratio
+ * \param[out]    cofimp        \f$\frac{|U_F|}{|U_I^p|}\f$ to ensure a good
+ *                              turbulence production
+ * \param[out]    dplus         dimensionless shift to the wall for scalable
+ *                              wall functions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_functions_velocity_batch(cs_wall_f_type_t  iwallf,
+                                 cs_lnum_t         n_elts,
+                                 const cs_lnum_t   elt_ids[],
+                                 const cs_real_t   l_visc[],
+                                 const cs_real_t   t_visc[],
+                                 const cs_real_t   vel[],
+                                 const cs_real_t   y[],
+                                 const cs_real_t   rough_d[],
+                                 const cs_real_t   rnnb[],
+                                 const cs_real_t   kinetic_en[],
+                                 int               iuntur[],
+                                 cs_gnum_t        *nsubla,
+                                 cs_gnum_t        *nlogla,
+                                 cs_real_t         ustar[],
+                                 cs_real_t         uk[],
+                                 cs_real_t         yplus[],
+                                 cs_real_t         ypup[],
+                                 cs_real_t         cofimp[],
+                                 cs_real_t         dplus[])
+{
+  cs_gnum_t n_sub = 0;
+
+  switch (iwallf) {
+
+  case CS_WALL_F_1SCALE_LOG:
+    n_sub = _1scale_log_batch(n_elts, elt_ids,
+                              l_visc, vel, y,
+                              iuntur, ustar, uk, yplus, ypup, cofimp);
+    break;
+
+  case CS_WALL_F_2SCALES_LOG:
+    n_sub = _2scales_log_batch(n_elts, elt_ids,
+                               l_visc, t_visc, vel, y, kinetic_en,
+                               iuntur, ustar, uk, yplus, ypup, cofimp);
+    break;
+
+  case CS_WALL_F_SCALABLE_2SCALES_LOG:
+    n_sub = _2scales_scalable_batch(n_elts, elt_ids,
+                                    l_visc, t_visc, vel, y, kinetic_en,
+                                    iuntur, ustar, uk, yplus, ypup, cofimp,
+                                    dplus);
+    break;
+
+  default:
+    for (cs_lnum_t ii = 0; ii < n_elts; ii++) {
+      const cs_lnum_t i = (elt_ids != NULL) ? elt_ids[ii] : ii;
+      cs_wall_functions_velocity(iwallf,
+                                 l_visc[i],
+                                 t_visc[i],
+                                 vel[i],
+                                 y[i],
+                                 rough_d[i],
+                                 rnnb[i],
+                                 kinetic_en[i],
+                                 iuntur + i,
+                                 nsubla,
+                                 nlogla,
+                                 ustar + i,
+                                 uk + i,
+                                 yplus + i,
+                                 ypup + i,
+                                 cofimp + i,
+                                 dplus + i);
+    }
+    return;
+
+  }
+
+  if (iwallf != CS_WALL_F_SCALABLE_2SCALES_LOG) {
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_elts; ii++) {
+      const cs_lnum_t i = (elt_ids != NULL) ? elt_ids[ii] : ii;
+      dplus[i] = 0.;
+    }
+  }
+
+  *nsubla += n_sub;
+  *nlogla += (cs_gnum_t)n_elts - n_sub;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  *  \brief Compute the correction of the exchange coefficient between the
@@ -1287,6 +1287,66 @@ cs_wall_functions_velocity(cs_wall_f_type_t  iwallf,
                            cs_real_t        *cofimp,
                            cs_real_t        *dplus);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the friction velocity and \f$y^+\f$ / \f$u^+\f$
+ *        for a set of elements.
+ *
+ * This is equivalent to calling \ref cs_wall_functions_velocity for each
+ * element, but the one velocity scale, two velocity scales and scalable
+ * log laws are evaluated using branch-free loops, in which the log-law
+ * equation is solved with a fixed number of Newton iterations, so they
+ * may be vectorized. Other laws are evaluated element by element.
+ *
+ * Input and output arrays are accessed through the element ids if
+ * present, or by position in the set otherwise.
+ *
+ * \param[in]     iwallf        wall function type
+ * \param[in]     n_elts        number of elements
+ * \param[in]     elt_ids       element ids, or NULL
+ * \param[in]     l_visc        kinematic viscosity
+ * \param[in]     t_visc        turbulent kinematic viscosity
+ * \param[in]     vel           wall projected cell center velocity
+ * \param[in]     y             wall distance
+ * \param[in]     rough_d       roughness length scale
+ *                              (not sand grain roughness)
+ * \param[in]     rnnb          \f$\vec{n}.(\tens{R}\vec{n})\f$
+ * \param[in]     kinetic_en    turbulent kinetic energy (cell center)
+ * \param[out]    iuntur        indicator: 0 in the viscous sublayer
+ * \param[in,out] nsubla        counter of cell in the viscous sublayer
+ * \param[in,out] nlogla        counter of cell in the log-layer
+ * \param[out]    ustar         friction velocity
+ * \param[out]    uk            friction velocity
+ * \param[out]    yplus         dimensionless distance to the wall
+ * \param[out]    ypup          yplus projected vel ratio
+ * \param[out]    cofimp        \f$\frac{|U_F|}{|U_I^p|}\f$ to ensure a good
+ *                              turbulence production
+ * \param[out]    dplus         dimensionless shift to the wall for scalable
+ *                              wall functions
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_wall_functions_velocity_batch(cs_wall_f_type_t  iwallf,
+                                 cs_lnum_t         n_elts,
+                                 const cs_lnum_t   elt_ids[],
+                                 const cs_real_t   l_visc[],
+                                 const cs_real_t   t_visc[],
+                                 const cs_real_t   vel[],
+                                 const cs_real_t   y[],
+                                 const cs_real_t   rough_d[],
+                                 const cs_real_t   rnnb[],
+                                 const cs_real_t   kinetic_en[],
+                                 int               iuntur[],
+                                 cs_gnum_t        *nsubla,
+                                 cs_gnum_t        *nlogla,
+                                 cs_real_t         ustar[],
+                                 cs_real_t         uk[],
+                                 cs_real_t         yplus[],
+                                 cs_real_t         ypup[],
+                                 cs_real_t         cofimp[],
+                                 cs_real_t         dplus[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  *  \brief Compute the correction of the exchange coefficient between the
@@ -143,10 +143,37 @@
 
 #define DIR_SEPARATOR '/'
 
+/* Maximum number of subsystems and nested scopes for accounting */
+
+#define BFT_MEM_N_MAX_SUBSYSTEMS  64
+#define BFT_MEM_N_MAX_SCOPES      16
+
 /*-------------------------------------------------------------------------------
  * Local type definitions
  *-----------------------------------------------------------------------------*/
 
+/* Map entry: block info and associated subsystem */
+
+typedef struct {
+
+  cs_mem_block_t  block;         /* block info */
+  int             subsystem_id;  /* associated subsystem id, or -1 */
+
+} _bft_mem_entry_t;
+
+/* Accounting for a given subsystem; for all sizes, index 0 is for
+   host memory, index 1 for device memory. */
+
+typedef struct {
+
+  char    name[32];         /* subsystem name */
+
+  size_t  size_cur[2];      /* current allocated size */
+  size_t  size_max[2];      /* maximum allocated size */
+  size_t  size_phase[2];    /* maximum allocated size since phase start */
+
+} _bft_mem_subsystem_t;
+
 /*-----------------------------------------------------------------------------
  * Local function prototypes
  *-----------------------------------------------------------------------------*/
@@ -181,7 +208,13 @@ static int  _bft_mem_global_init_mode = 0;
 
 static FILE *_bft_mem_global_file = nullptr;
 
-static std::map<const void *, cs_mem_block_t> _bft_alloc_map;
+static std::map<const void *, _bft_mem_entry_t> _bft_alloc_map;
+
+static int  _bft_mem_n_subsystems = 0;
+static _bft_mem_subsystem_t  _bft_mem_subsystem[BFT_MEM_N_MAX_SUBSYSTEMS];
+
+static int  _bft_mem_n_scopes = 0;
+static int  _bft_mem_scope[BFT_MEM_N_MAX_SCOPES];
 
 static size_t  _bft_mem_global_alloc_cur = 0;
 static size_t  _bft_mem_global_alloc_max = 0;
@@ -233,6 +266,125 @@ _bft_mem_basename(const char  *file_name)
   return (file_name + i);
 }
 
+/*
+ * Return id of subsystem with a given name, adding it if needed.
+ *
+ * If the maximum number of subsystems is reached, the last one is
+ * used for all remaining names.
+ *
+ * parameters:
+ *   name: <-- subsystem name.
+ *   l:    <-- name length.
+ *
+ * return:
+ *   subsystem id.
+ */
+
+static int
+_bft_mem_subsystem_id(const char    *name,
+                      size_t         l)
+{
+  if (l > 31)
+    l = 31;
+
+  for (int i = 0; i < _bft_mem_n_subsystems; i++) {
+    const char *s_name = _bft_mem_subsystem[i].name;
+    if (strncmp(s_name, name, l) == 0 && s_name[l] == '\0')
+      return i;
+  }
+
+  if (_bft_mem_n_subsystems >= BFT_MEM_N_MAX_SUBSYSTEMS)
+    return BFT_MEM_N_MAX_SUBSYSTEMS - 1;
+
+  _bft_mem_subsystem_t *ms = _bft_mem_subsystem + _bft_mem_n_subsystems;
+
+  memset(ms, 0, sizeof(_bft_mem_subsystem_t));
+  strncpy(ms->name, name, l);
+  ms->name[l] = '\0';
+
+  return _bft_mem_n_subsystems++;
+}
+
+/*
+ * Return id of subsystem associated with a new allocation.
+ *
+ * The innermost active scope is used if present. Otherwise, the subsystem
+ * is based on the calling source file's directory name (such as "alge"
+ * or "cdo"), or on the parent directory if it is named "src".
+ *
+ * parameters:
+ *   file_name: <-- name of calling source file.
+ *
+ * return:
+ *   subsystem id.
+ */
+
+static int
+_bft_mem_caller_subsystem_id(const char  *file_name)
+{
+  if (_bft_mem_n_scopes > 0)
+    return _bft_mem_scope[_bft_mem_n_scopes - 1];
+
+  const char *e = nullptr;
+  if (file_name != nullptr)
+    e = strrchr(file_name, DIR_SEPARATOR);
+
+  for (int i = 0; i < 2 && e != nullptr && e > file_name; i++) {
+    const char *b = e - 1;
+    while (b > file_name && *b != DIR_SEPARATOR)
+      b--;
+    if (*b == DIR_SEPARATOR)
+      b++;
+    size_t l = e - b;
+    if (l > 0 && !(l == 3 && strncmp(b, "src", 3) == 0))
+      return _bft_mem_subsystem_id(b, l);
+    e = (b > file_name) ? b - 1 : nullptr;
+  }
+
+  return _bft_mem_subsystem_id("other", 5);
+}
+
+/*
+ * Update accounting of a subsystem.
+ *
+ * parameters:
+ *   subsystem_id: <-- subsystem id.
+ *   mode:         <-- allocation mode.
+ *   size:         <-- allocated size.
+ *   sgn:          <-- 1 for allocation, -1 for deallocation.
+ */
+
+static void
+_bft_mem_subsystem_update(int              subsystem_id,
+                          cs_alloc_mode_t  mode,
+                          size_t           size,
+                          int              sgn)
+{
+  if (subsystem_id < 0 || size == 0)
+    return;
+
+  _bft_mem_subsystem_t *ms = _bft_mem_subsystem + subsystem_id;
+
+  /* Host and device parts, depending on allocation mode */
+
+  bool on_host_device[2] = {mode != CS_ALLOC_DEVICE,
+                            mode != CS_ALLOC_HOST};
+
+  for (int i = 0; i < 2; i++) {
+    if (on_host_device[i] == false)
+      continue;
+    if (sgn > 0) {
+      ms->size_cur[i] += size;
+      if (ms->size_max[i] < ms->size_cur[i])
+        ms->size_max[i] = ms->size_cur[i];
+      if (ms->size_phase[i] < ms->size_cur[i])
+        ms->size_phase[i] = ms->size_cur[i];
+    }
+    else
+      ms->size_cur[i] -= (size < ms->size_cur[i]) ? size : ms->size_cur[i];
+  }
+}
+
 /*
  * Determines values associated with an array representing a
  * long integer
@@ -463,7 +615,7 @@ bft_mem_get_block_info(const void  *p_get)
   if (it == _bft_alloc_map.end())
     _bft_mem_block_info_error(p_get);
 
-  return it->second;
+  return it->second.block;
 }
 
 /*!
@@ -485,7 +637,7 @@ bft_mem_get_block_info_try(const void  *p_get)
 
   auto it = _bft_alloc_map.find(p_get);
   if (it != _bft_alloc_map.end())
-    mbi = it->second;
+    mbi = it->second.block;
   else {
     mbi.host_ptr = nullptr;
 #if defined(HAVE_ACCEL)
@@ -552,12 +704,23 @@ bft_mem_update_block_info(const char            *var_name,
       omp_set_lock(&_bft_mem_lock);
 #endif
 
-    /* Update map */
+    /* Update map, keeping subsystem of reallocated blocks */
+
+    int subsystem_id = -1;
+
+    if (old_block != nullptr) {
+      auto it = _bft_alloc_map.find(p_m_old);
+      if (it != _bft_alloc_map.end()) {
+        subsystem_id = it->second.subsystem_id;
+        if (new_block == nullptr || p_m_new != p_m_old)
+          _bft_alloc_map.erase(it);
+      }
+    }
+    if (subsystem_id < 0 && _bft_mem_global_init_mode > 1)
+      subsystem_id = _bft_mem_caller_subsystem_id(file_name);
 
-    if (old_block != nullptr && (new_block == nullptr || p_m_new != p_m_old))
-      _bft_alloc_map.erase(p_m_old);
     if (new_block != nullptr && p_m_new != nullptr)
-      _bft_alloc_map[p_m_new] = *new_block;
+      _bft_alloc_map[p_m_new] = {*new_block, subsystem_id};
 
     /* Memory allocation counting */
 
@@ -580,6 +743,9 @@ bft_mem_update_block_info(const char            *var_name,
 
       _bft_mem_global_alloc_cur += size_diff;
 
+      _bft_mem_subsystem_update(subsystem_id, old_mode, old_size, -1);
+      _bft_mem_subsystem_update(subsystem_id, new_mode, new_size, 1);
+
       if (_bft_mem_global_alloc_max < _bft_mem_global_alloc_cur)
         _bft_mem_global_alloc_max = _bft_mem_global_alloc_cur;
 
@@ -787,6 +953,9 @@ bft_mem_end(void)
 
   _bft_alloc_map.clear();
 
+  _bft_mem_n_subsystems = 0;
+  _bft_mem_n_scopes = 0;
+
   _bft_mem_global_n_allocs = 0;
   _bft_mem_global_n_reallocs = 0;
   _bft_mem_global_n_frees = 0;
@@ -1120,6 +1289,131 @@ bft_mem_size_max(void)
   return (_bft_mem_global_alloc_max / 1024);
 }
 
+/*!
+ * \brief Enable allocation tracking and per-subsystem accounting.
+ *
+ * This is implied when logging is activated through \ref bft_mem_init
+ * (or when accelerator support is available). Otherwise, this function
+ * should be called just after \ref bft_mem_init, before any allocation.
+ */
+
+void
+bft_mem_enable_tracking(void)
+{
+  if (_bft_mem_global_init_mode == 1 && _bft_alloc_map.size() == 0)
+    _bft_mem_global_init_mode = 2;
+}
+
+/*!
+ * \brief Start an explicit memory accounting scope.
+ *
+ * Until the matching call to \ref bft_mem_scope_pop, new allocations
+ * are accounted to the subsystem with the given name instead of
+ * the subsystem based on the caller's source directory.
+ * Scopes may be nested.
+ *
+ * \param [in] name  subsystem name
+ */
+
+void
+bft_mem_scope_push(const char  *name)
+{
+  if (_bft_mem_global_init_mode < 2)
+    return;
+
+#if defined(HAVE_OPENMP)
+  if (omp_in_parallel())
+    return;
+#endif
+
+  int id = _bft_mem_subsystem_id(name, strlen(name));
+
+  if (_bft_mem_n_scopes < BFT_MEM_N_MAX_SCOPES)
+    _bft_mem_scope[_bft_mem_n_scopes] = id;
+  _bft_mem_n_scopes += 1;
+}
+
+/*!
+ * \brief End the innermost explicit memory accounting scope.
+ */
+
+void
+bft_mem_scope_pop(void)
+{
+  if (_bft_mem_global_init_mode < 2)
+    return;
+
+#if defined(HAVE_OPENMP)
+  if (omp_in_parallel())
+    return;
+#endif
+
+  if (_bft_mem_n_scopes > 0)
+    _bft_mem_n_scopes -= 1;
+}
+
+/*!
+ * \brief Return number of subsystems with memory accounting.
+ *
+ * \return number of subsystems (0 if allocations are not tracked).
+ */
+
+int
+bft_mem_n_subsystems(void)
+{
+  return (_bft_mem_global_init_mode > 1) ? _bft_mem_n_subsystems : 0;
+}
+
+/*!
+ * \brief Return memory accounting info of a given subsystem.
+ *
+ * For each array, index 0 is for host memory, index 1 for device memory.
+ *
+ * \param [in]  subsystem_id  subsystem id
+ * \param [out] size_cur      current allocated size (in bytes), or nullptr
+ * \param [out] size_max      maximum allocated size (in bytes), or nullptr
+ * \param [out] size_phase    maximum allocated size since the start of the
+ *                            current phase (in bytes), or nullptr
+ *
+ * \return subsystem name
+ */
+
+const char *
+bft_mem_subsystem_info(int     subsystem_id,
+                       size_t  size_cur[2],
+                       size_t  size_max[2],
+                       size_t  size_phase[2])
+{
+  const _bft_mem_subsystem_t *ms = _bft_mem_subsystem + subsystem_id;
+
+  for (int i = 0; i < 2; i++) {
+    if (size_cur != nullptr)
+      size_cur[i] = ms->size_cur[i];
+    if (size_max != nullptr)
+      size_max[i] = ms->size_max[i];
+    if (size_phase != nullptr)
+      size_phase[i] = ms->size_phase[i];
+  }
+
+  return ms->name;
+}
+
+/*!
+ * \brief Start a new phase for per-subsystem maximum memory accounting.
+ *
+ * Phase maximum sizes are reset to the current sizes.
+ */
+
+void
+bft_mem_subsystem_phase_start(void)
+{
+  for (int j = 0; j < _bft_mem_n_subsystems; j++) {
+    _bft_mem_subsystem_t *ms = _bft_mem_subsystem + j;
+    for (int i = 0; i < 2; i++)
+      ms->size_phase[i] = ms->size_cur[i];
+  }
+}
+
 /*!
  * \brief Indicate if a memory aligned allocation variant is available.
  *
@@ -426,6 +426,80 @@ bft_mem_size_current(void);
 size_t
 bft_mem_size_max(void);
 
+/*
+ * Enable allocation tracking and per-subsystem accounting.
+ *
+ * This is implied when logging is activated through bft_mem_init()
+ * (or when accelerator support is available). Otherwise, this function
+ * should be called just after bft_mem_init(), before any allocation.
+ */
+
+void
+bft_mem_enable_tracking(void);
+
+/*
+ * Start an explicit memory accounting scope.
+ *
+ * Until the matching call to bft_mem_scope_pop(), new allocations
+ * are accounted to the subsystem with the given name instead of
+ * the subsystem based on the caller's source directory.
+ * Scopes may be nested.
+ *
+ * parameter:
+ *   name <-- subsystem name.
+ */
+
+void
+bft_mem_scope_push(const char  *name);
+
+/*
+ * End the innermost explicit memory accounting scope.
+ */
+
+void
+bft_mem_scope_pop(void);
+
+/*
+ * Return number of subsystems with memory accounting.
+ *
+ * returns:
+ *   number of subsystems (0 if allocations are not tracked).
+ */
+
+int
+bft_mem_n_subsystems(void);
+
+/*
+ * Return memory accounting info of a given subsystem.
+ *
+ * For each array, index 0 is for host memory, index 1 for device memory.
+ *
+ * parameters:
+ *   subsystem_id <-- subsystem id.
+ *   size_cur     --> current allocated size (in bytes), or NULL.
+ *   size_max     --> maximum allocated size (in bytes), or NULL.
+ *   size_phase   --> maximum allocated size since the start of the
+ *                    current phase (in bytes), or NULL.
+ *
+ * returns:
+ *   subsystem name.
+ */
+
+const char *
+bft_mem_subsystem_info(int     subsystem_id,
+                       size_t  size_cur[2],
+                       size_t  size_max[2],
+                       size_t  size_phase[2]);
+
+/*
+ * Start a new phase for per-subsystem maximum memory accounting.
+ *
+ * Phase maximum sizes are reset to the current sizes.
+ */
+
+void
+bft_mem_subsystem_phase_start(void);
+
 /*
  * Indicate if a memory aligned allocation variant is available.
  *
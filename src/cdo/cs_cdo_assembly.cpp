@@ -33,6 +33,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <assert.h>
+#include <string.h>
 
 /*----------------------------------------------------------------------------
  * Local headers
@@ -663,15 +664,14 @@ _add_vect_values_single(const cs_cdo_assembly_row_t    *row,
   /* db_size != ebsize has not been handled by
    * cs_matrix_assembler_t in mpi case yet */
 
-  assert(db_size == 3);
-  assert(eb_size == 3);
+  assert(db_size == eb_size);
 
   /* Update the diagonal value */
 
   stride = db_size * db_size;
 
   for (int j = 0; j < stride; j++)
-    mc->_d_val[row->l_id*stride + j] += row->val[9*row->i + j];
+    mc->_d_val[row->l_id*stride + j] += row->val[stride*row->i + j];
 
   /* Update the extra-diagonal values */
 
@@ -680,11 +680,11 @@ _add_vect_values_single(const cs_cdo_assembly_row_t    *row,
   cs_real_t  *xvals = mc->_e_val + stride*ms->e.row_index[row->l_id];
   for (int j = 0; j < row->i; j++) /* Lower part */
     for (int k = 0; k < stride; k++)
-      xvals[row->col_idx[j]*stride + k] += row->val[9*j + k];
+      xvals[row->col_idx[j]*stride + k] += row->val[stride*j + k];
 
   for (int j = row->i+1; j < row->n_cols; j++) /* Upper part */
     for (int k = 0; k < stride; k++)
-      xvals[row->col_idx[j]*stride + k] += row->val[9*j + k];
+      xvals[row->col_idx[j]*stride + k] += row->val[stride*j + k];
 }
 
 /*----------------------------------------------------------------------------*/
@@ -726,8 +726,7 @@ _add_vect_values_atomic(const cs_cdo_assembly_row_t    *row,
   /* db_size != ebsize has not been handled by
    * cs_matrix_assembler_t in mpi case yet */
 
-  assert(db_size == 3);
-  assert(eb_size == 3);
+  assert(db_size == eb_size);
 
   /* Update the diagonal value */
 
@@ -735,7 +734,7 @@ _add_vect_values_atomic(const cs_cdo_assembly_row_t    *row,
 
   for (int j = 0; j < stride; j++) {
 # pragma omp atomic
-    mc->_d_val[row->l_id*stride + j] += row->val[9*row->i + j];
+    mc->_d_val[row->l_id*stride + j] += row->val[stride*row->i + j];
   }
 
   /* Update the extra-diagonal values */
@@ -747,7 +746,7 @@ _add_vect_values_atomic(const cs_cdo_assembly_row_t    *row,
     if (j != row->i) {
       for (int k = 0; k < stride; k++) {
 #     pragma omp atomic
-        xvals[row->col_idx[j]*stride + k] += row->val[9*j + k];
+        xvals[row->col_idx[j]*stride + k] += row->val[stride*j + k];
       }
     }
   }
@@ -792,8 +791,7 @@ _add_vect_values_critical(const cs_cdo_assembly_row_t    *row,
   /* db_size != ebsize has not been handled by
    * cs_matrix_assembler_t in mpi case yet */
 
-  assert(db_size == 3);
-  assert(eb_size == 3);
+  assert(db_size == eb_size);
 
   /* Update the diagonal value */
 
@@ -802,7 +800,7 @@ _add_vect_values_critical(const cs_cdo_assembly_row_t    *row,
     stride = db_size*db_size;
 
     for (int j = 0; j < stride; j++)
-      mc->_d_val[row->l_id*stride + j] += row->val[9*row->i + j];
+      mc->_d_val[row->l_id*stride + j] += row->val[stride*row->i + j];
 
     /* Update the extra-diagonal values */
 
@@ -812,7 +810,7 @@ _add_vect_values_critical(const cs_cdo_assembly_row_t    *row,
     for (int j = 0; j < row->n_cols; j++)
       if (j != row->i)
         for (int k = 0; k < stride; k++)
-          xvals[row->col_idx[j]*stride + k] += row->val[9*j + k];
+          xvals[row->col_idx[j]*stride + k] += row->val[stride*j + k];
     }
 }
 
@@ -1025,8 +1023,7 @@ _assemble_vect_dist_row_threaded(cs_matrix_assembler_values_t      *mav,
   /* db_size != ebsize has not been handled by cs_matrix_assembler_t in mpi
    * case yet */
 
-  assert(db_size == 3);
-  assert(eb_size == 3);
+  assert(db_size == eb_size);
 
   /* Diagonal term */
 
@@ -1040,7 +1037,7 @@ _assemble_vect_dist_row_threaded(cs_matrix_assembler_values_t      *mav,
 
   for (int k = 0; k < stride; k++) {
 # pragma omp atomic
-    mav->coeff_send[e_diag_id*stride + k] += row->val[9*row->i + k];
+    mav->coeff_send[e_diag_id*stride + k] += row->val[stride*row->i + k];
   }
 
   /* Loop on extra-diagonal entries */
@@ -1057,7 +1054,7 @@ _assemble_vect_dist_row_threaded(cs_matrix_assembler_values_t      *mav,
 
     for (int k = 0; k < stride; k++) {
 #   pragma omp atomic
-      mav->coeff_send[e_id*stride + k] += row->val[9*row->i + k];
+      mav->coeff_send[e_id*stride + k] += row->val[stride*j + k];
     }
 
   }
@@ -1072,7 +1069,7 @@ _assemble_vect_dist_row_threaded(cs_matrix_assembler_values_t      *mav,
 
     for (int k = 0; k < stride; k++) {
 #   pragma omp atomic
-      mav->coeff_send[e_id*stride + k] += row->val[9*row->i + k];
+      mav->coeff_send[e_id*stride + k] += row->val[stride*j + k];
     }
 
   }
@@ -1120,8 +1117,7 @@ _assemble_vect_dist_row_single(cs_matrix_assembler_values_t       *mav,
   /* db_size != ebsize has not been handled by cs_matrix_assembler_t in mpi
    * case yet */
 
-  assert(db_size == 3);
-  assert(eb_size == 3);
+  assert(db_size == eb_size);
 
   /* Diagonal term */
 
@@ -1134,7 +1130,7 @@ _assemble_vect_dist_row_single(cs_matrix_assembler_values_t       *mav,
   stride = db_size*db_size;
 
   for (int k = 0; k < stride; k++)
-    mav->coeff_send[e_diag_id*stride + k] += row->val[9*row->i + k];
+    mav->coeff_send[e_diag_id*stride + k] += row->val[stride*row->i + k];
 
   /* Loop on extra-diagonal entries */
 
@@ -1149,7 +1145,7 @@ _assemble_vect_dist_row_single(cs_matrix_assembler_values_t       *mav,
     /* Now add values to send coefficients */
 
     for (int k = 0; k < stride; k++)
-      mav->coeff_send[e_id*stride + k] += row->val[9*j + k];
+      mav->coeff_send[e_id*stride + k] += row->val[stride*j + k];
 
   }
 
@@ -1162,7 +1158,7 @@ _assemble_vect_dist_row_single(cs_matrix_assembler_values_t       *mav,
     /* Now add values to send coefficients */
 
     for (int k = 0; k < stride; k++)
-      mav->coeff_send[e_id*stride + k] += row->val[9*j + k];
+      mav->coeff_send[e_id*stride + k] += row->val[stride*j + k];
 
   }
 }
@@ -1217,6 +1213,7 @@ _init_assembly_struct(int                   ddim,
 
   asb->l_row_shift = 0;
   asb->l_col_shift = 0;
+  asb->cw_col_idx = nullptr;
 
   if (create) {
 
@@ -1428,6 +1425,137 @@ cs_cdo_assembly_set_shift(cs_cdo_assembly_t *asb,
   asb->l_col_shift = l_col_shift;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the map giving for each cellwise system the position of its
+ *        entries in the assembled matrix. Only scalar-valued systems on a
+ *        single rank are handled (nullptr is returned otherwise).
+ *
+ * The cellwise DoFs are assumed to follow the ordering of the c2x
+ * connectivity (as for cs_cell_mesh_t structures).
+ *
+ * \param[in] c2x     cell --> DoF entities connectivity
+ * \param[in] rset    pointer to the related cs_range_set_t structure
+ * \param[in] ma      pointer to the related matrix assembler
+ *
+ * \return a pointer to a new allocated structure or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_cdo_assembly_map_t *
+cs_cdo_assembly_map_create(const cs_adjacency_t         *c2x,
+                           const cs_range_set_t         *rset,
+                           const cs_matrix_assembler_t  *ma)
+{
+  if (c2x == nullptr || rset == nullptr || ma == nullptr)
+    return nullptr;
+  if (cs_glob_n_ranks > 1)
+    return nullptr;
+
+  const cs_lnum_t  n_cells = c2x->n_elts;
+
+  cs_cdo_assembly_map_t  *map = nullptr;
+  BFT_MALLOC(map, 1, cs_cdo_assembly_map_t);
+
+  map->n_cells = n_cells;
+  BFT_MALLOC(map->col_idx_shift, n_cells + 1, cs_lnum_t);
+
+  map->col_idx_shift[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const cs_lnum_t  n_x = c2x->idx[c_id+1] - c2x->idx[c_id];
+    map->col_idx_shift[c_id+1] = map->col_idx_shift[c_id] + n_x*n_x;
+  }
+
+  BFT_MALLOC(map->col_idx, map->col_idx_shift[n_cells], int);
+
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    const cs_lnum_t  *x_ids = c2x->ids + c2x->idx[c_id];
+    const int  n_x = c2x->idx[c_id+1] - c2x->idx[c_id];
+
+    int  *c_col_idx = map->col_idx + map->col_idx_shift[c_id];
+
+    for (int i = 0; i < n_x; i++) {
+
+      const cs_lnum_t  l_r_id = rset->g_id[x_ids[i]] - rset->l_range[0];
+      const cs_lnum_t  l_start = ma->r_idx[l_r_id];
+      const int  n_l_cols = ma->r_idx[l_r_id+1] - l_start;
+      const cs_lnum_t  *col_ids = ma->c_id + l_start;
+
+      int  *r_col_idx = c_col_idx + i*n_x;
+
+      for (int j = 0; j < n_x; j++) {
+
+        if (j == i)
+          r_col_idx[j] = -1;
+        else {
+          r_col_idx[j]
+            = _l_binary_search(0,
+                               n_l_cols,
+                               rset->g_id[x_ids[j]] - ma->l_range[0],
+                               col_ids);
+          assert(r_col_idx[j] > -1);
+        }
+
+      } /* Loop on cellwise columns */
+
+    } /* Loop on cellwise rows */
+
+  } /* Loop on cells */
+
+  return map;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free a cs_cdo_assembly_map_t structure
+ *
+ * \param[in, out] p_map    double pointer to the structure to free
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_map_free(cs_cdo_assembly_map_t   **p_map)
+{
+  if (p_map == nullptr)
+    return;
+
+  cs_cdo_assembly_map_t  *map = *p_map;
+  if (map == nullptr)
+    return;
+
+  BFT_FREE(map->col_idx_shift);
+  BFT_FREE(map->col_idx);
+
+  BFT_FREE(map);
+  *p_map = nullptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Use the precomputed column indexes of a cell for the next call to
+ *        an assembly function (scalar-valued sequential cases). Nothing is
+ *        done if map is nullptr.
+ *
+ * \param[in, out] asb     pointer to a cs_cdo_assembly_t to update
+ * \param[in]      map     pointer to a cs_cdo_assembly_map_t or nullptr
+ * \param[in]      c_id    id of the cell to assemble
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_set_cell_map(cs_cdo_assembly_t              *asb,
+                             const cs_cdo_assembly_map_t    *map,
+                             cs_lnum_t                       c_id)
+{
+  if (asb == nullptr || map == nullptr)
+    return;
+
+  assert(c_id > -1 && c_id < map->n_cells);
+  asb->cw_col_idx = map->col_idx + map->col_idx_shift[c_id];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Assemble a cellwise matrix into the global matrix.
@@ -1816,6 +1944,11 @@ cs_cdo_assembly_matrix_seqt(const cs_sdm_t                  *m,
 
   cs_cdo_assembly_row_t  *row = asb->row;
 
+  /* Precomputed column indexes are only valid for this cellwise system */
+
+  const int  *cw_col_idx = asb->cw_col_idx;
+  asb->cw_col_idx = nullptr;
+
   assert(m->n_rows <= m->n_cols);
   row->n_cols = m->n_cols;
 
@@ -1833,7 +1966,11 @@ cs_cdo_assembly_matrix_seqt(const cs_sdm_t                  *m,
     row->l_id = row->g_id - rset->l_range[0]; /* range set numbering */
     row->val = m->val + i*row->n_cols;
 
-    _set_col_idx_scal_loc(ma, row);
+    if (cw_col_idx != nullptr)
+      memcpy(row->col_idx, cw_col_idx + i*row->n_cols,
+             row->n_cols*sizeof(int));
+    else
+      _set_col_idx_scal_loc(ma, row);
 
 #if CS_CDO_OMP_SYNC_MODE > 0 /* OpenMP with critical section */
     _add_scal_values_critical(row, mav->matrix);
@@ -1868,6 +2005,11 @@ cs_cdo_assembly_matrix_seqs(const cs_sdm_t                  *m,
 
   cs_cdo_assembly_row_t  *row = asb->row;
 
+  /* Precomputed column indexes are only valid for this cellwise system */
+
+  const int  *cw_col_idx = asb->cw_col_idx;
+  asb->cw_col_idx = nullptr;
+
   assert(m->n_rows <= m->n_cols);
   row->n_cols = m->n_cols;
 
@@ -1884,7 +2026,12 @@ cs_cdo_assembly_matrix_seqs(const cs_sdm_t                  *m,
     row->l_id = row->g_id - rset->l_range[0]; /* range set numbering */
     row->val = m->val + i*row->n_cols;
 
-    _set_col_idx_scal_loc(ma, row);
+    if (cw_col_idx != nullptr)
+      memcpy(row->col_idx, cw_col_idx + i*row->n_cols,
+             row->n_cols*sizeof(int));
+    else
+      _set_col_idx_scal_loc(ma, row);
+
     _add_scal_values_single(row, mav->matrix);
   } /* Loop on rows */
 }
@@ -2938,6 +3085,348 @@ cs_cdo_assembly_block33_matrix_mpit(const cs_sdm_t                *m,
 }
 #endif /* defined(HAVE_MPI) */
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assemble a cellwise matrix into the global matrix.
+ *        Case of a block NxN entries, stored by NxN blocks in the global
+ *        matrix (the diagonal and extra-diagonal block sizes of the matrix
+ *        are equal to N). Sequential run without openMP threading.
+ *
+ * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      dof_ids  local DoF numbering (interlaced)
+ * \param[in]      rset     pointer to a cs_range_set_t structure
+ * \param[in, out] asb      pointer to an equation assembly structure
+ * \param[in, out] mav      pointer to a matrix assembler structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_block_matrix_seqs(const cs_sdm_t                *m,
+                                  const cs_lnum_t               *dof_ids,
+                                  const cs_range_set_t          *rset,
+                                  cs_cdo_assembly_t             *asb,
+                                  cs_matrix_assembler_values_t  *mav)
+{
+  const cs_sdm_block_t  *bd = m->block_desc;
+  const cs_matrix_assembler_t  *ma = mav->ma;
+
+  cs_cdo_assembly_row_t  *row = asb->row;
+
+  assert(m->flag & CS_SDM_BY_BLOCK);
+  assert(m->block_desc != nullptr);
+  assert(bd->n_row_blocks == bd->n_col_blocks);
+  assert(row->expval != nullptr);
+
+  /* All blocks are small square matrices of size dim */
+
+  const int  dim = bd->blocks[0].n_rows;
+  const int  dim2 = dim*dim;
+
+  assert(asb->ddim >= dim);
+
+  /* Expand the values for a bundle of rows */
+
+  cs_real_t  *b_row = row->expval;
+
+  assert(m->n_rows == m->n_cols);
+
+  row->n_cols = bd->n_row_blocks;
+
+  /* Switch to the global numbering */
+
+  for (int i = 0; i < row->n_cols; i++)
+    row->col_g_id[i] = rset->g_id[dof_ids[dim*i]/dim];
+
+  for (int bi = 0; bi < bd->n_row_blocks; bi++) {
+
+    /* Expand all the blocks for this row */
+
+    for (int bj = 0; bj < bd->n_col_blocks; bj++) {
+
+      const cs_sdm_t  *const mIJ = cs_sdm_get_block(m, bi, bj);
+      const cs_real_t  *const mIJ_vals = mIJ->val;
+
+      for (int k = 0; k < dim2; k++)
+        b_row[dim2*bj+k] = mIJ_vals[k];
+
+    } /* Loop on column-wise blocks */
+
+    row->i = bi;                              /* cellwise numbering */
+    row->g_id = row->col_g_id[bi];            /* global numbering */
+    row->l_id = row->g_id - rset->l_range[0]; /* range set numbering */
+    row->val = b_row;
+
+    /* All entries within one block share the same row and column */
+
+    _set_col_idx_scal_loc(ma, row);
+    _add_vect_values_single(row, mav->matrix);
+
+  } /* Loop on row-wise blocks */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assemble a cellwise matrix into the global matrix.
+ *        Case of a block NxN entries, stored by NxN blocks in the global
+ *        matrix (the diagonal and extra-diagonal block sizes of the matrix
+ *        are equal to N). Sequential run with openMP threading.
+ *
+ * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      dof_ids  local DoF numbering (interlaced)
+ * \param[in]      rset     pointer to a cs_range_set_t structure
+ * \param[in, out] asb      pointer to an equation assembly structure
+ * \param[in, out] mav      pointer to a matrix assembler structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_block_matrix_seqt(const cs_sdm_t                *m,
+                                  const cs_lnum_t               *dof_ids,
+                                  const cs_range_set_t          *rset,
+                                  cs_cdo_assembly_t             *asb,
+                                  cs_matrix_assembler_values_t  *mav)
+{
+  const cs_sdm_block_t  *bd = m->block_desc;
+  const cs_matrix_assembler_t  *ma = mav->ma;
+
+  cs_cdo_assembly_row_t  *row = asb->row;
+
+  assert(m->flag & CS_SDM_BY_BLOCK);
+  assert(m->block_desc != nullptr);
+  assert(bd->n_row_blocks == bd->n_col_blocks);
+  assert(row->expval != nullptr);
+
+  /* All blocks are small square matrices of size dim */
+
+  const int  dim = bd->blocks[0].n_rows;
+  const int  dim2 = dim*dim;
+
+  assert(asb->ddim >= dim);
+
+  /* Expand the values for a bundle of rows */
+
+  cs_real_t  *b_row = row->expval;
+
+  assert(m->n_rows == m->n_cols);
+
+  row->n_cols = bd->n_row_blocks;
+
+  /* Switch to the global numbering */
+
+  for (int i = 0; i < row->n_cols; i++)
+    row->col_g_id[i] = rset->g_id[dof_ids[dim*i]/dim];
+
+  for (int bi = 0; bi < bd->n_row_blocks; bi++) {
+
+    /* Expand all the blocks for this row */
+
+    for (int bj = 0; bj < bd->n_col_blocks; bj++) {
+
+      const cs_sdm_t  *const mIJ = cs_sdm_get_block(m, bi, bj);
+      const cs_real_t  *const mIJ_vals = mIJ->val;
+
+      for (int k = 0; k < dim2; k++)
+        b_row[dim2*bj+k] = mIJ_vals[k];
+
+    } /* Loop on column-wise blocks */
+
+    row->i = bi;                              /* cellwise numbering */
+    row->g_id = row->col_g_id[bi];            /* global numbering */
+    row->l_id = row->g_id - rset->l_range[0]; /* range set numbering */
+    row->val = b_row;
+
+    /* All entries within one block share the same row and column */
+
+    _set_col_idx_scal_loc(ma, row);
+
+#if CS_CDO_OMP_SYNC_MODE > 0 /* OpenMP with critical section */
+    _add_vect_values_critical(row, mav->matrix);
+#else
+    _add_vect_values_atomic(row, mav->matrix);
+#endif
+
+  } /* Loop on row-wise blocks */
+}
+
+#if defined(HAVE_MPI)
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assemble a cellwise matrix into the global matrix.
+ *        Case of a block NxN entries, stored by NxN blocks in the global
+ *        matrix (the diagonal and extra-diagonal block sizes of the matrix
+ *        are equal to N). Parallel run without openMP threading.
+ *
+ * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      dof_ids  local DoF numbering (interlaced)
+ * \param[in]      rset     pointer to a cs_range_set_t structure
+ * \param[in, out] asb      pointer to an equation assembly structure
+ * \param[in, out] mav      pointer to a matrix assembler structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_block_matrix_mpis(const cs_sdm_t                *m,
+                                  const cs_lnum_t               *dof_ids,
+                                  const cs_range_set_t          *rset,
+                                  cs_cdo_assembly_t             *asb,
+                                  cs_matrix_assembler_values_t  *mav)
+{
+  const cs_sdm_block_t  *bd = m->block_desc;
+  const cs_matrix_assembler_t  *ma = mav->ma;
+
+  cs_cdo_assembly_row_t  *row = asb->row;
+
+  assert(m->flag & CS_SDM_BY_BLOCK);
+  assert(m->block_desc != nullptr);
+  assert(bd->n_row_blocks == bd->n_col_blocks);
+  assert(row->expval != nullptr);
+
+  /* All blocks are small square matrices of size dim */
+
+  const int  dim = bd->blocks[0].n_rows;
+  const int  dim2 = dim*dim;
+
+  assert(asb->ddim >= dim);
+
+  /* Expand the values for a bundle of rows */
+
+  cs_real_t  *b_row = row->expval;
+
+  assert(m->n_rows == m->n_cols);
+
+  row->n_cols = bd->n_row_blocks;
+
+  /* Switch to the global numbering */
+
+  for (int i = 0; i < row->n_cols; i++)
+    row->col_g_id[i] = rset->g_id[dof_ids[dim*i]/dim];
+
+  for (int bi = 0; bi < bd->n_row_blocks; bi++) {
+
+    /* Expand all the blocks for this row */
+
+    for (int bj = 0; bj < bd->n_col_blocks; bj++) {
+
+      const cs_sdm_t  *const mIJ = cs_sdm_get_block(m, bi, bj);
+      const cs_real_t  *const mIJ_vals = mIJ->val;
+
+      for (int k = 0; k < dim2; k++)
+        b_row[dim2*bj+k] = mIJ_vals[k];
+
+    } /* Loop on column-wise blocks */
+
+    row->i = bi;                              /* cellwise numbering */
+    row->g_id = row->col_g_id[bi];            /* global numbering */
+    row->l_id = row->g_id - rset->l_range[0]; /* range set numbering */
+    row->val = b_row;
+
+    /* All entries within one block share the same row and column */
+
+    if (row->l_id < 0 || row->l_id >= rset->n_elts[0])
+      _assemble_vect_dist_row_single(mav, ma, row);
+
+    else {
+
+      _set_col_idx_scal_locdist(ma, row);
+      _add_vect_values_single(row, mav->matrix);
+
+    }
+
+  } /* Loop on row-wise blocks */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assemble a cellwise matrix into the global matrix.
+ *        Case of a block NxN entries, stored by NxN blocks in the global
+ *        matrix (the diagonal and extra-diagonal block sizes of the matrix
+ *        are equal to N). Parallel run with openMP threading.
+ *
+ * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      dof_ids  local DoF numbering (interlaced)
+ * \param[in]      rset     pointer to a cs_range_set_t structure
+ * \param[in, out] asb      pointer to an equation assembly structure
+ * \param[in, out] mav      pointer to a matrix assembler structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_block_matrix_mpit(const cs_sdm_t                *m,
+                                  const cs_lnum_t               *dof_ids,
+                                  const cs_range_set_t          *rset,
+                                  cs_cdo_assembly_t             *asb,
+                                  cs_matrix_assembler_values_t  *mav)
+{
+  const cs_sdm_block_t  *bd = m->block_desc;
+  const cs_matrix_assembler_t  *ma = mav->ma;
+
+  cs_cdo_assembly_row_t  *row = asb->row;
+
+  assert(m->flag & CS_SDM_BY_BLOCK);
+  assert(m->block_desc != nullptr);
+  assert(bd->n_row_blocks == bd->n_col_blocks);
+  assert(row->expval != nullptr);
+
+  /* All blocks are small square matrices of size dim */
+
+  const int  dim = bd->blocks[0].n_rows;
+  const int  dim2 = dim*dim;
+
+  assert(asb->ddim >= dim);
+
+  /* Expand the values for a bundle of rows */
+
+  cs_real_t  *b_row = row->expval;
+
+  assert(m->n_rows == m->n_cols);
+
+  row->n_cols = bd->n_row_blocks;
+
+  /* Switch to the global numbering */
+
+  for (int i = 0; i < row->n_cols; i++)
+    row->col_g_id[i] = rset->g_id[dof_ids[dim*i]/dim];
+
+  for (int bi = 0; bi < bd->n_row_blocks; bi++) {
+
+    /* Expand all the blocks for this row */
+
+    for (int bj = 0; bj < bd->n_col_blocks; bj++) {
+
+      const cs_sdm_t  *const mIJ = cs_sdm_get_block(m, bi, bj);
+      const cs_real_t  *const mIJ_vals = mIJ->val;
+
+      for (int k = 0; k < dim2; k++)
+        b_row[dim2*bj+k] = mIJ_vals[k];
+
+    } /* Loop on column-wise blocks */
+
+    row->i = bi;                              /* cellwise numbering */
+    row->g_id = row->col_g_id[bi];            /* global numbering */
+    row->l_id = row->g_id - rset->l_range[0]; /* range set numbering */
+    row->val = b_row;
+
+    /* All entries within one block share the same row and column */
+
+    if (row->l_id < 0 || row->l_id >= rset->n_elts[0])
+      _assemble_vect_dist_row_threaded(mav, ma, row);
+
+    else {
+
+      _set_col_idx_scal_locdist(ma, row);
+
+#if CS_CDO_OMP_SYNC_MODE > 0 /* OpenMP with critical section */
+      _add_vect_values_critical(row, mav->matrix);
+#else
+      _add_vect_values_atomic(row, mav->matrix);
+#endif
+
+    }
+
+  } /* Loop on row-wise blocks */
+}
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Assemble a cellwise matrix into the global matrix
@@ -33,6 +33,7 @@
 
 #include "cs_matrix.h"
 #include "cs_matrix_assembler.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_param_types.h"
 #include "cs_range_set.h"
 #include "cs_sdm.h"
@@ -123,8 +124,28 @@ struct _cs_cdo_assembly_t {
 
   cs_cdo_assembly_row_t    *row;
 
+  /* Precomputed column indexes of the current cellwise system (set by
+     cs_cdo_assembly_set_cell_map and reset after each assembly) */
+
+  const int                *cw_col_idx;
+
 };
 
+/* Precomputed positions in the assembled matrix of the entries of all the
+   cellwise systems (scalar-valued case, local rank only). For a cell c with
+   n DoFs, col_idx[col_idx_shift[c] + i*n + j] is the index of the column j
+   in the extra-diagonal part of the row related to the i-th DoF. This
+   avoids searching for the column index each time a matrix is assembled. */
+
+typedef struct {
+
+  cs_lnum_t     n_cells;        /* Number of cells */
+  cs_lnum_t    *col_idx_shift;  /* Start of each cellwise block (size:
+                                   n_cells + 1) */
+  int          *col_idx;        /* Column indexes (-1 on the diagonal) */
+
+} cs_cdo_assembly_map_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -196,6 +217,56 @@ cs_cdo_assembly_set_shift(cs_cdo_assembly_t    *asb,
                           cs_lnum_t             l_row_shift,
                           cs_lnum_t             l_col_shift);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the map giving for each cellwise system the position of its
+ *        entries in the assembled matrix. Only scalar-valued systems on a
+ *        single rank are handled (nullptr is returned otherwise).
+ *
+ * The cellwise DoFs are assumed to follow the ordering of the c2x
+ * connectivity (as for cs_cell_mesh_t structures).
+ *
+ * \param[in] c2x     cell --> DoF entities connectivity
+ * \param[in] rset    pointer to the related cs_range_set_t structure
+ * \param[in] ma      pointer to the related matrix assembler
+ *
+ * \return a pointer to a new allocated structure or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_cdo_assembly_map_t *
+cs_cdo_assembly_map_create(const cs_adjacency_t         *c2x,
+                           const cs_range_set_t         *rset,
+                           const cs_matrix_assembler_t  *ma);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free a cs_cdo_assembly_map_t structure
+ *
+ * \param[in, out] p_map    double pointer to the structure to free
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_map_free(cs_cdo_assembly_map_t   **p_map);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Use the precomputed column indexes of a cell for the next call to
+ *        an assembly function (scalar-valued sequential cases). Nothing is
+ *        done if map is nullptr.
+ *
+ * \param[in, out] asb     pointer to a cs_cdo_assembly_t to update
+ * \param[in]      map     pointer to a cs_cdo_assembly_map_t or nullptr
+ * \param[in]      c_id    id of the cell to assemble
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_set_cell_map(cs_cdo_assembly_t              *asb,
+                             const cs_cdo_assembly_map_t    *map,
+                             cs_lnum_t                       c_id);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Assemble a cellwise matrix into the global matrix.
@@ -579,6 +650,96 @@ cs_cdo_assembly_block33_matrix_mpit(const cs_sdm_t                *m,
                                     cs_matrix_assembler_values_t  *mav);
 #endif /* defined(HAVE_MPI) */
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assemble a cellwise matrix into the global matrix.
+ *        Case of a block NxN entries, stored by NxN blocks in the global
+ *        matrix (the diagonal and extra-diagonal block sizes of the matrix
+ *        are equal to N). Sequential run without openMP threading.
+ *
+ * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      dof_ids  local DoF numbering (interlaced)
+ * \param[in]      rset     pointer to a cs_range_set_t structure
+ * \param[in, out] asb      pointer to an equation assembly structure
+ * \param[in, out] mav      pointer to a matrix assembler structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_block_matrix_seqs(const cs_sdm_t                *m,
+                                  const cs_lnum_t               *dof_ids,
+                                  const cs_range_set_t          *rset,
+                                  cs_cdo_assembly_t             *asb,
+                                  cs_matrix_assembler_values_t  *mav);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assemble a cellwise matrix into the global matrix.
+ *        Case of a block NxN entries, stored by NxN blocks in the global
+ *        matrix (the diagonal and extra-diagonal block sizes of the matrix
+ *        are equal to N). Sequential run with openMP threading.
+ *
+ * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      dof_ids  local DoF numbering (interlaced)
+ * \param[in]      rset     pointer to a cs_range_set_t structure
+ * \param[in, out] asb      pointer to an equation assembly structure
+ * \param[in, out] mav      pointer to a matrix assembler structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_block_matrix_seqt(const cs_sdm_t                *m,
+                                  const cs_lnum_t               *dof_ids,
+                                  const cs_range_set_t          *rset,
+                                  cs_cdo_assembly_t             *asb,
+                                  cs_matrix_assembler_values_t  *mav);
+
+#if defined(HAVE_MPI)
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assemble a cellwise matrix into the global matrix.
+ *        Case of a block NxN entries, stored by NxN blocks in the global
+ *        matrix (the diagonal and extra-diagonal block sizes of the matrix
+ *        are equal to N). Parallel run without openMP threading.
+ *
+ * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      dof_ids  local DoF numbering (interlaced)
+ * \param[in]      rset     pointer to a cs_range_set_t structure
+ * \param[in, out] asb      pointer to an equation assembly structure
+ * \param[in, out] mav      pointer to a matrix assembler structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_block_matrix_mpis(const cs_sdm_t                *m,
+                                  const cs_lnum_t               *dof_ids,
+                                  const cs_range_set_t          *rset,
+                                  cs_cdo_assembly_t             *asb,
+                                  cs_matrix_assembler_values_t  *mav);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Assemble a cellwise matrix into the global matrix.
+ *        Case of a block NxN entries, stored by NxN blocks in the global
+ *        matrix (the diagonal and extra-diagonal block sizes of the matrix
+ *        are equal to N). Parallel run with openMP threading.
+ *
+ * \param[in]      m        cellwise view of the algebraic system
+ * \param[in]      dof_ids  local DoF numbering (interlaced)
+ * \param[in]      rset     pointer to a cs_range_set_t structure
+ * \param[in, out] asb      pointer to an equation assembly structure
+ * \param[in, out] mav      pointer to a matrix assembler structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_cdo_assembly_block_matrix_mpit(const cs_sdm_t                *m,
+                                  const cs_lnum_t               *dof_ids,
+                                  const cs_range_set_t          *rset,
+                                  cs_cdo_assembly_t             *asb,
+                                  cs_matrix_assembler_values_t  *mav);
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Assemble a cellwise matrix into the global matrix
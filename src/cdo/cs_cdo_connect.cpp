@@ -44,6 +44,7 @@
 #include "fvm_io_num.h"
 
 #include "cs_array.h"
+#include "cs_base_accel.h"
 #include "cs_flag.h"
 #include "cs_log.h"
 #include "cs_mesh_adjacencies.h"
@@ -374,6 +375,54 @@ _build_f2f_ed_through_edges(const cs_cdo_connect_t *connect)
   return f2f_ed;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Find the edge shared by a face and each face of the connectivity
+ *        face -> faces through edges with the same direction (MAC scheme).
+ *        The stencil of a face only depends on the mesh, so that this search
+ *        is done once and not each time a cellwise system is built.
+ *
+ * \param[in] connect  pointer to a cs_cdo_connect_t structure
+ *
+ * \return a pointer to a new allocated array (same index as f2f_ed)
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t *
+_build_f2f_ed_edge_ids(const cs_cdo_connect_t *connect)
+{
+  const cs_adjacency_t *f2f_ed = connect->f2f_ed;
+  const cs_adjacency_t *f2e = connect->f2e;
+  assert(f2f_ed != nullptr && f2e != nullptr); /* Has to be build before */
+
+  const cs_lnum_t n_faces = f2f_ed->n_elts;
+
+  cs_lnum_t *e_ids = nullptr;
+  BFT_MALLOC(e_ids, f2f_ed->idx[n_faces], cs_lnum_t);
+
+# pragma omp parallel for if (n_faces > CS_THR_MIN)
+  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+
+    for (cs_lnum_t j = f2f_ed->idx[f_id]; j < f2f_ed->idx[f_id+1]; j++) {
+
+      const cs_lnum_t fj_id = f2f_ed->ids[j];
+
+      e_ids[j] = -1;
+
+      for (cs_lnum_t ej = f2e->idx[fj_id]; ej < f2e->idx[fj_id+1]; ej++) {
+        for (cs_lnum_t ei = f2e->idx[f_id]; ei < f2e->idx[f_id+1]; ei++) {
+          if (f2e->ids[ei] == f2e->ids[ej])
+            e_ids[j] = f2e->ids[ei];
+        }
+      }
+
+    }
+
+  }
+
+  return e_ids;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Build an exteded connectivity face -> faces through cells + edges
@@ -1052,6 +1101,22 @@ cs_cdo_connect_build(cs_mesh_t *mesh,
 
   connect->c2f = cs_mesh_adjacency_c2f(mesh, 1);
 
+#if defined(HAVE_ACCEL)
+  /* This connectivity is also used in device kernels (for instance with the
+     unassembled (2,1)-block of saddle-point systems) */
+
+  {
+    cs_adjacency_t  *c2f = connect->c2f;
+
+    CS_REALLOC_HD(c2f->idx, n_cells + 1, cs_lnum_t,
+                  cs_alloc_mode_read_mostly);
+    CS_REALLOC_HD(c2f->ids, c2f->idx[n_cells], cs_lnum_t,
+                  cs_alloc_mode_read_mostly);
+    cs_mem_advise_set_read_mostly(c2f->idx);
+    cs_mem_advise_set_read_mostly(c2f->ids);
+  }
+#endif
+
   /* Build the face --> cells connectivity */
 
   connect->f2c = cs_adjacency_transpose(n_faces, connect->c2f);
@@ -1117,12 +1182,14 @@ cs_cdo_connect_build(cs_mesh_t *mesh,
     cs_adjacency_sort(connect->e2f);
 
     connect->f2f_ed = _build_f2f_ed_through_edges(connect);
+    connect->f2f_ed_e_ids = _build_f2f_ed_edge_ids(connect);
     connect->f2xf   = _build_f2xf_through_cell(connect);
   }
   else {
 
     connect->e2f    = NULL;
     connect->f2f_ed = NULL;
+    connect->f2f_ed_e_ids = NULL;
     connect->f2xf   = NULL;
   }
 
@@ -1178,10 +1245,29 @@ cs_cdo_connect_build(cs_mesh_t *mesh,
   /* Build the cell type for each cell */
 
   BFT_MALLOC(connect->cell_type, n_cells, fvm_element_t);
-#pragma omp parallel if (n_cells > CS_THR_MIN)
+#pragma omp parallel for if (n_cells > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
     connect->cell_type[c_id] = _get_cell_type(c_id, connect);
 
+  /* Group cells with the same topology (the initial ordering is kept inside
+     each group), so that cellwise builds see similar local systems in a
+     row */
+
+  BFT_MALLOC(connect->cell_ids_by_type, n_cells, cs_lnum_t);
+  {
+    cs_lnum_t type_idx[FVM_N_ELEMENT_TYPES + 1];
+    for (int i = 0; i < FVM_N_ELEMENT_TYPES + 1; i++)
+      type_idx[i] = 0;
+
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      type_idx[connect->cell_type[c_id] + 1] += 1;
+    for (int i = 0; i < FVM_N_ELEMENT_TYPES; i++)
+      type_idx[i+1] += type_idx[i];
+
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+      connect->cell_ids_by_type[type_idx[connect->cell_type[c_id]]++] = c_id;
+  }
+
   /* Build the cell flag for each cell */
 
   _build_cell_flag(connect, eb_scheme_flag, vb_scheme_flag, vcb_scheme_flag);
@@ -1228,9 +1314,11 @@ cs_cdo_connect_free(const cs_mesh_t *mesh, cs_cdo_connect_t *connect)
   cs_adjacency_destroy(&(connect->f2f));
   cs_adjacency_destroy(&(connect->f2xf));
   cs_adjacency_destroy(&(connect->f2f_ed));
+  BFT_FREE(connect->f2f_ed_e_ids);
   cs_adjacency_destroy(&(connect->e2e));
 
   BFT_FREE(connect->cell_type);
+  BFT_FREE(connect->cell_ids_by_type);
   BFT_FREE(connect->cell_flag);
 
   /* Structures for parallelism */
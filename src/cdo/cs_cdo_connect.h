@@ -112,6 +112,9 @@ typedef struct {
   cs_lnum_t              n_cells_with_ghosts;
 
   fvm_element_t         *cell_type;   /* type of cell */
+  cs_lnum_t             *cell_ids_by_type; /* cell ids ordered by type, so
+                                             that cells with the same
+                                             topology are contiguous */
   cs_flag_t             *cell_flag;   /* flag (border/solid) */
   cs_adjacency_t        *c2f;         /* cell --> faces connectivity */
   cs_adjacency_t        *c2e;         /* cell --> edges connectivity */
@@ -141,6 +144,8 @@ typedef struct {
                            * for MAC scheme */
   cs_adjacency_t *f2f_ed; /* face to faces through edges + same directions
                            * for MAC scheme */
+  cs_lnum_t      *f2f_ed_e_ids; /* edge shared by a face and each face of
+                                 * f2f_ed (same index) for MAC scheme */
   cs_adjacency_t *e2e;    /* edge to edges through cells */
 
 } cs_cdo_connect_t;
@@ -41,6 +41,7 @@
 #include "bft_mem.h"
 
 #include "cs_array.h"
+#include "cs_base_accel.h"
 #include "cs_flag.h"
 #include "cs_matrix_priv.h"
 #include "cs_param_cdo.h"
@@ -226,14 +227,14 @@ _set_block33_assembly_func(void)
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Choose which function will be used to perform the matrix assembly
- *         Case of block NxN matrices.
+ *         Case of block NxN matrices (expanded as scalar-valued entries).
  *
  * \return  a pointer to a function
  */
 /*----------------------------------------------------------------------------*/
 
 static inline cs_cdo_assembly_func_t *
-_set_block_assembly_func(void)
+_set_eblock_assembly_func(void)
 {
 #if defined(HAVE_MPI)
   if (cs_glob_n_ranks > 1) {  /* Parallel */
@@ -258,6 +259,41 @@ _set_block_assembly_func(void)
   return nullptr; /* Case not handled */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Choose which function will be used to perform the matrix assembly
+ *         Case of block NxN matrices (stored by NxN blocks).
+ *
+ * \return  a pointer to a function
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_cdo_assembly_func_t *
+_set_block_assembly_func(void)
+{
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {  /* Parallel */
+
+    if (cs_glob_n_threads < 2) /* Without OpenMP */
+      return cs_cdo_assembly_block_matrix_mpis;
+    else                      /* With OpenMP */
+      return cs_cdo_assembly_block_matrix_mpit;
+
+  }
+#endif /* defined(HAVE_MPI) */
+
+  if (cs_glob_n_ranks <= 1) {  /* Sequential */
+
+    if (cs_glob_n_threads < 2) /* Without OpenMP */
+      return cs_cdo_assembly_block_matrix_seqs;
+    else                      /* With OpenMP */
+      return cs_cdo_assembly_block_matrix_seqt;
+
+  }
+
+  return nullptr; /* Case not handled */
+}
+
 /*============================================================================
  * Private function prototypes
  *============================================================================*/
@@ -321,8 +357,14 @@ _assign_assembly_func(const cs_cdo_system_block_info_t   bi)
     }
 
   }
-  else
-    return _set_block_assembly_func();
+  else {
+
+    if (bi.unrolled)
+      return _set_eblock_assembly_func();
+    else
+      return _set_block_assembly_func();
+
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -789,6 +831,7 @@ _assign_ma_ms(bool                           forced,
 
         cs_matrix_assembler_destroy(&(db->matrix_assembler));
         cs_matrix_structure_destroy(&(db->matrix_structure));
+        cs_cdo_assembly_map_free(&(db->assembly_map));
         db->matrix_assembler = nullptr;
         db->matrix_structure = nullptr;
       }
@@ -864,6 +907,35 @@ _assign_ma_ms(bool                           forced,
   } /* End of switch on the type of block */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the map of the positions in the assembled matrix of the
+ *        cellwise entries for a scalar-valued default block (if not already
+ *        done). This avoids searching for the column index of each entry each
+ *        time a cellwise system is assembled.
+ *
+ * \param[in]      c2x       cell --> DoF entities connectivity
+ * \param[in, out] b         block structure to update
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_assign_assembly_map(const cs_adjacency_t          *c2x,
+                     cs_cdo_system_block_t         *b)
+{
+  assert(b != nullptr);
+
+  if (b->type != CS_CDO_SYSTEM_BLOCK_DEFAULT || b->info.stride > 1)
+    return;
+
+  cs_cdo_system_dblock_t *db = (cs_cdo_system_dblock_t *)b->block_pointer;
+
+  if (db->assembly_map == nullptr)
+    db->assembly_map = cs_cdo_assembly_map_create(c2x,
+                                                  db->range_set,
+                                                  db->matrix_assembler);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Find the block corresponding to the same set of metadata in the array
@@ -942,6 +1014,7 @@ _free_block(cs_cdo_system_block_t   **p_block)
 
         cs_matrix_assembler_destroy(&(db->matrix_assembler));
         cs_matrix_structure_destroy(&(db->matrix_structure));
+        cs_cdo_assembly_map_free(&(db->assembly_map));
 
         if (b->info.stride > 1 && b->info.unrolled) {
           cs_range_set_destroy(&(db->range_set));
@@ -1136,7 +1209,7 @@ cs_cdo_system_helper_free(cs_cdo_system_helper_t   **p_helper)
   BFT_FREE(sh->col_block_sizes);
   BFT_FREE(sh->max_col_block_sizes);
   BFT_FREE(sh->rhs_array);      /* array of pointers */
-  BFT_FREE(sh->_rhs);
+  CS_FREE_HD(sh->_rhs);
   sh->rhs = nullptr; /* shared pointer */
 
   for (int i = 0; i < sh->n_blocks; i++)
@@ -1229,6 +1302,7 @@ cs_cdo_system_add_dblock(cs_cdo_system_helper_t       *sh,
     db->interface_set    = nullptr;
     db->matrix_assembler = nullptr;
     db->matrix_structure = nullptr;
+    db->assembly_map     = nullptr;
 
     b->block_pointer = db;
     b->owner = true;
@@ -1753,8 +1827,10 @@ cs_cdo_system_build_block(cs_cdo_system_helper_t  *sh,
       assert(connect->n_vertices == b->info.n_elements);
       assert(connect->n_vertices == connect->v2v->n_elts);
       _assign_ifs_rset(false, b, connect->vtx_ifs, connect->vtx_rset);
-      if (b->type != CS_CDO_SYSTEM_BLOCK_UNASS)
+      if (b->type != CS_CDO_SYSTEM_BLOCK_UNASS) {
         _assign_ma_ms(false, connect->v2v, b);
+        _assign_assembly_map(connect->c2v, b);
+      }
       break;
 
     case CS_FLAG_LOCATION_PRIMAL_EDGE:
@@ -1762,8 +1838,10 @@ cs_cdo_system_build_block(cs_cdo_system_helper_t  *sh,
       assert(connect->n_edges == b->info.n_elements);
       assert(connect->n_edges == connect->e2e->n_elts);
       _assign_ifs_rset(false, b, connect->edge_ifs, connect->edge_rset);
-      if (b->type != CS_CDO_SYSTEM_BLOCK_UNASS)
+      if (b->type != CS_CDO_SYSTEM_BLOCK_UNASS) {
         _assign_ma_ms(false, connect->e2e, b);
+        _assign_assembly_map(connect->c2e, b);
+      }
       break;
 
     case CS_FLAG_LOCATION_PRIMAL_FACE:
@@ -1771,8 +1849,10 @@ cs_cdo_system_build_block(cs_cdo_system_helper_t  *sh,
       assert(connect->n_faces[CS_ALL_FACES] == b->info.n_elements);
       assert(connect->n_faces[CS_ALL_FACES] == connect->f2f->n_elts);
       _assign_ifs_rset(false, b, connect->face_ifs, connect->face_rset);
-      if (b->type != CS_CDO_SYSTEM_BLOCK_UNASS)
+      if (b->type != CS_CDO_SYSTEM_BLOCK_UNASS) {
         _assign_ma_ms(false, connect->f2f, b);
+        _assign_assembly_map(connect->c2f, b);
+      }
       break;
 
     case CS_FLAG_LOCATION_MAC_PRIMAL_FACE:
@@ -1817,7 +1897,7 @@ cs_cdo_system_helper_init_system(cs_cdo_system_helper_t    *sh,
   cs_real_t *rhs = *p_rhs;
   if (rhs == nullptr) {
 
-    BFT_MALLOC(sh->_rhs, sh->full_rhs_size, cs_real_t);
+    CS_MALLOC_HD(sh->_rhs, sh->full_rhs_size, cs_real_t, cs_alloc_mode);
     *p_rhs = sh->_rhs;
     sh->rhs = sh->_rhs;
 
@@ -2045,7 +2125,7 @@ cs_cdo_system_helper_reset(cs_cdo_system_helper_t    *sh)
   if (sh == nullptr)
     return;
 
-  BFT_FREE(sh->_rhs);
+  CS_FREE_HD(sh->_rhs);
   sh->rhs = nullptr;
 
   /* Free matrix (or matrices) */
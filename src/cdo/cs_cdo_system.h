@@ -205,6 +205,11 @@ typedef struct {
   cs_matrix_assembler_t          *matrix_assembler;
   cs_matrix_structure_t          *matrix_structure;
 
+  /* Precomputed position of cellwise entries in the assembled matrix
+     (scalar-valued blocks on a single rank; nullptr otherwise) */
+
+  cs_cdo_assembly_map_t          *assembly_map;
+
 } cs_cdo_system_dblock_t;
 
 
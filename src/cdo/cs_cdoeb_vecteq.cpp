@@ -423,6 +423,7 @@ _eb_assemble(const cs_cdoeb_vecteq_t      *eqc,
   assert(b->type == CS_CDO_SYSTEM_BLOCK_DEFAULT);
   cs_cdo_system_dblock_t *db = (cs_cdo_system_dblock_t *)b->block_pointer;
 
+  cs_cdo_assembly_set_cell_map(asb, db->assembly_map, csys->c_id);
   db->assembly_func(csys->mat, csys->dof_ids, db->range_set, asb, db->mav);
 
   /* RHS assembly */
@@ -50,6 +50,7 @@
 #include <bft_mem.h>
 
 #include "cs_array.h"
+#include "cs_base_accel.h"
 #include "cs_blas.h"
 #include "cs_cdo_bc.h"
 #include "cs_cdo_blas.h"
@@ -157,6 +158,45 @@ _mono_fields_to_previous(cs_cdofb_monolithic_t        *sc,
                        mom_eqc->face_values, mom_eqc->face_values_pre);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if the (2,1)-block can be applied on the fly (matrix-free)
+ *         for the given saddle-point solver. This is possible when the
+ *         (2,1)- and (1,2)-blocks are only used through the function pointers
+ *         performing the matrix-vector products.
+ *
+ * \param[in]  saddlep  set of parameters for the saddle-point solver
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_block21_can_be_matrix_free(const cs_param_saddle_t  *saddlep)
+{
+  if (!saddlep->block21_matrix_free)
+    return false;
+
+  switch (saddlep->solver) {
+
+  case CS_PARAM_SADDLE_SOLVER_ALU:
+    return true;
+
+  case CS_PARAM_SADDLE_SOLVER_GKB:
+    return (saddlep->solver_class != CS_PARAM_SOLVER_CLASS_PETSC);
+
+  case CS_PARAM_SADDLE_SOLVER_UZAWA_CG:
+    /* The other Schur approximations need the stored (2,1)-block */
+    return (saddlep->schur_approx == CS_PARAM_SADDLE_SCHUR_NONE     ||
+            saddlep->schur_approx == CS_PARAM_SADDLE_SCHUR_IDENTITY ||
+            saddlep->schur_approx == CS_PARAM_SADDLE_SCHUR_MASS_SCALED);
+
+  default:
+    return false;
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Make sure that the enforcement is done (remove tolerance that may
@@ -540,6 +580,39 @@ _assembly_by_blocks(const cs_cell_sys_t             *csys,
   memcpy(_div, nsb->div_op, 3 * cm->n_fc * sizeof(cs_real_t));
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update the mask of the faces related to a cell when the (2,1)-block
+ *        is applied on the fly. For each face, the k-th bit is set if the
+ *        k-th component of the cellwise divergence operator is not zero.
+ *
+ * \param[in]      cm     pointer to a cs_cell_mesh_t structure
+ * \param[in]      div    cellwise divergence operator (3*n_fc values)
+ * \param[in, out] mask   mask for each face
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_update_block21_mask(const cs_cell_mesh_t  *cm,
+                     const cs_real_t        div[],
+                     unsigned char          mask[])
+{
+  for (short int f = 0; f < cm->n_fc; f++) {
+
+    const cs_real_t  *_div_f = div + 3*f;
+
+    unsigned char  m = 0;
+    for (int k = 0; k < 3; k++)
+      if (fabs(_div_f[k]) > 0.)
+        m |= (1 << k);
+
+    /* Interior faces are shared by two cells which set the same value */
+
+    mask[cm->f_ids[f]] = m;
+
+  } /* Loop on cell faces */
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Perform the assembly stage for a vector-valued system obtained
@@ -567,7 +640,13 @@ _velocity_full_assembly(const cs_cell_sys_t             *csys,
   const cs_cdo_connect_t  *connect = cs_shared_connect;
 
   cs_cdo_system_helper_t  *sh = sc->system_helper;
-  cs_real_t  *_div = sc->block21_op + 3*connect->c2f->idx[cm->c_id];
+
+  /* When the (2,1)-block is applied on the fly, the cellwise divergence
+     operator of the builder is directly updated */
+
+  cs_real_t  *_div = nsb->div_op;
+  if (sc->block21_op != nullptr)
+    _div = sc->block21_op + 3*connect->c2f->idx[cm->c_id];
 
   /* 1. Store divergence operator in non assembly
    *    Take into account solid zone where DoF is set to zero */
@@ -584,9 +663,12 @@ _velocity_full_assembly(const cs_cell_sys_t             *csys,
     }
 
   }
-  else
+  else if (_div != nsb->div_op)
     memcpy(_div, nsb->div_op, 3*n_f*sizeof(cs_real_t));
 
+  if (sc->block21_mask != nullptr)
+    _update_block21_mask(cm, _div, sc->block21_mask);
+
   /* 1. Matrix assembly
    * ================== */
 
@@ -1891,6 +1973,9 @@ cs_cdofb_monolithic_init_scheme_context(const cs_navsto_param_t *nsp,
   /* Some saddle-point solver needs the (2,1)-block stored in an unassembled
      way. This corresponds to the -|c|.divergence operator */
 
+  sc->block21_op = nullptr;
+  sc->block21_mask = nullptr;
+
   switch (saddlep->solver) {
 
   case CS_PARAM_SADDLE_SOLVER_ALU:
@@ -1900,12 +1985,43 @@ cs_cdofb_monolithic_init_scheme_context(const cs_navsto_param_t *nsp,
   case CS_PARAM_SADDLE_SOLVER_NOTAY_TRANSFORM:
   case CS_PARAM_SADDLE_SOLVER_UZAWA_CG:
   case CS_PARAM_SADDLE_SOLVER_SIMPLE:
-    BFT_MALLOC(sc->block21_op, 3*connect->c2f->idx[quant->n_cells], cs_real_t);
+    if (_block21_can_be_matrix_free(saddlep)) {
+
+      /* Only a mask by face is stored. The divergence operator is rebuilt
+         on the fly from the face vectors and the c2f adjacency */
+
+      CS_MALLOC_HD(sc->block21_mask, quant->n_faces, unsigned char,
+                   cs_alloc_mode);
+      memset(sc->block21_mask, 0, quant->n_faces*sizeof(unsigned char));
+
+      double  mem_saved[2] =
+        {3.*connect->c2f->idx[quant->n_cells]*sizeof(cs_real_t),
+         1.*quant->n_faces*sizeof(unsigned char)};
+      cs_parall_sum(2, CS_DOUBLE, mem_saved);
+
+      cs_log_printf(CS_LOG_SETUP,
+                    "  * NavSto | Matrix-free (2,1)-block:"
+                    " %.3f MiB saved (%.3f MiB used for the face mask)\n",
+                    (mem_saved[0] - mem_saved[1])/(1024.*1024.),
+                    mem_saved[1]/(1024.*1024.));
+
+    }
+    else {
+
+      if (saddlep->block21_matrix_free)
+        cs_log_printf(CS_LOG_SETUP,
+                      "  * NavSto | Matrix-free (2,1)-block not available"
+                      " with this saddle-point solver settings.\n"
+                      "  * NavSto | Switch to a stored (2,1)-block.\n");
+
+      CS_MALLOC_HD(sc->block21_op, 3*connect->c2f->idx[quant->n_cells],
+                   cs_real_t, cs_alloc_mode);
+
+    }
     break;
 
   default:
     /* Nothing to do */
-    sc->block21_op = nullptr;
     break;
 
   }
@@ -2002,7 +2118,8 @@ cs_cdofb_monolithic_free_scheme_context(void   *scheme_context)
 
   /* Block (2,1) may be allocated */
 
-  BFT_FREE(sc->block21_op);
+  CS_FREE_HD(sc->block21_op);
+  CS_FREE_HD(sc->block21_mask);
 
   /* Free the context structure for solving saddle-point system */
 
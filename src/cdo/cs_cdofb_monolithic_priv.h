@@ -302,6 +302,16 @@ struct _cdofb_monolithic_t {
 
   cs_real_t                          *block21_op;
 
+  /* \var block21_mask
+   * Only allocated when the (2,1)-block is applied on the fly (matrix-free)
+   * instead of being stored in block21_op. For each face, bit k is set if
+   * the k-th component of the divergence operator is kept (i.e. not
+   * removed by the enforcement of the boundary conditions or of an internal
+   * enforcement).
+   */
+
+  unsigned char                      *block21_mask;
+
   /* \var system_helper
    * Set of structure to handle the saddle-point matrix and its rhs
    */
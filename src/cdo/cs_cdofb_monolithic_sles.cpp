@@ -53,9 +53,11 @@
  *----------------------------------------------------------------------------*/
 
 #include "cs_array.h"
+#include "cs_base_accel.h"
 #include "cs_blas.h"
 #include "cs_cdo_blas.h"
 #include "cs_cdo_solve.h"
+#include "cs_dispatch.h"
 #include "cs_equation.h"
 #include "cs_fp_exception.h"
 #include "cs_matrix_default.h"
@@ -113,6 +115,11 @@ static const cs_cdo_connect_t  *cs_shared_connect;
 static const cs_cdo_quantities_t  *cs_shared_quant;
 static const cs_mesh_t  *cs_shared_mesh;
 
+/* Mask by face used when the (2,1)-block is applied on the fly (shared with
+   the scheme context) */
+
+static const unsigned char  *cs_shared_block21_mask = nullptr;
+
 /*============================================================================
  * Private function prototypes
  *============================================================================*/
@@ -307,6 +314,178 @@ _build_shared_structures_full_system(cs_cdo_system_block_t  *block,
   BFT_FREE(gcols);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Run a dispatch context on the host if one of the given arrays is
+ *        not accessible from the device
+ *
+ * \param[in]      n_arrays  number of arrays to check
+ * \param[in]      arrays    list of arrays (nullptr entries are skipped)
+ * \param[in, out] dctx      dispatch context to update
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline void
+_set_dispatch_location(int                   n_arrays,
+                       const void           *arrays[],
+                       cs_dispatch_context  &dctx)
+{
+  for (int i = 0; i < n_arrays; i++) {
+    if (   arrays[i] != nullptr
+        && cs_check_device_ptr(arrays[i]) == CS_ALLOC_HOST) {
+      dctx.set_use_gpu(false);
+      return;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the resulting vector of the operation m12*x2 when the
+ *        (2,1)-block is not stored. Entries are rebuilt on the fly:
+ *        m21(c, f)[k] = -iota_{f,c} |f| n_f[k] unless the k-th bit of the
+ *        face mask is not set. This is an update operation.
+ *
+ * \param[in]      n2_dofs  number of DoFs for x2
+ * \param[in]      x2       array for the second set
+ * \param[in]      m21_adj  c2f adjacency (with face orientation)
+ * \param[in]      m21_val  unused (nullptr)
+ * \param[in, out] m12x2    resulting array (have to be allocated)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_m12_multiply_matrix_free(cs_lnum_t              n2_dofs,
+                          const cs_real_t       *x2,
+                          const cs_adjacency_t  *m21_adj,
+                          const cs_real_t       *m21_val,
+                          cs_real_t             *m12x2)
+{
+  CS_NO_WARN_IF_UNUSED(m21_val);
+  assert(n2_dofs == m21_adj->n_elts);
+  assert(m21_adj->sgn != nullptr);
+
+  const cs_cdo_quantities_t  *cdoq = cs_shared_quant;
+  const cs_lnum_t  n_i_faces = cdoq->n_i_faces;
+  const cs_real_t  *i_surf = cdoq->i_face_surf;
+  const cs_real_t  *b_surf = cdoq->b_face_surf;
+  const cs_nreal_3_t  *i_unorm = cdoq->i_face_u_normal;
+  const cs_nreal_3_t  *b_unorm = cdoq->b_face_u_normal;
+  const unsigned char  *mask = cs_shared_block21_mask;
+  const cs_lnum_t  *adj_idx = m21_adj->idx;
+  const cs_lnum_t  *adj_ids = m21_adj->ids;
+  const short int  *adj_sgn = m21_adj->sgn;
+
+  cs_dispatch_context  dctx;
+  const void  *arrays[] = {x2, adj_idx, adj_ids, adj_sgn, mask, m12x2,
+                           i_surf, b_surf, i_unorm, b_unorm};
+  _set_dispatch_location(10, arrays, dctx);
+
+  const cs_dispatch_sum_type_t  sum_type = CS_DISPATCH_SUM_ATOMIC;
+
+  dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
+
+    const cs_real_t  _x2 = x2[i2];
+    for (cs_lnum_t j = adj_idx[i2]; j < adj_idx[i2+1]; j++) {
+
+      const cs_lnum_t  f_id = adj_ids[j];
+      const unsigned char  m = mask[f_id];
+      if (m == 0)
+        continue;
+
+      const cs_nreal_t  *unorm = (f_id < n_i_faces) ?
+        i_unorm[f_id] : b_unorm[f_id - n_i_faces];
+      const cs_real_t  surf = (f_id < n_i_faces) ?
+        i_surf[f_id] : b_surf[f_id - n_i_faces];
+      const cs_real_t  coef = -adj_sgn[j]*surf*_x2;
+
+      cs_real_t  contrib[3];
+      for (int k = 0; k < 3; k++)
+        contrib[k] = (m & (1 << k)) ? coef*unorm[k] : 0.;
+
+      cs_dispatch_sum<3>(m12x2 + 3*f_id, contrib, sum_type);
+
+    } /* Loop on faces associated to a given cell */
+
+  }); /* Loop on x2 DoFs */
+
+  dctx.wait();
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute the resulting vector of the operation m21*x1 when the
+ *        (2,1)-block is not stored. Entries are rebuilt on the fly:
+ *        m21(c, f)[k] = -iota_{f,c} |f| n_f[k] unless the k-th bit of the
+ *        face mask is not set.
+ *
+ * \param[in]      n2_dofs  number of DoFs for x2
+ * \param[in]      x1       array for the first part (interlaced)
+ * \param[in]      m21_adj  c2f adjacency (with face orientation)
+ * \param[in]      m21_val  unused (nullptr)
+ * \param[in, out] m21x1    resulting vector (have to be allocated)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_m21_multiply_matrix_free(cs_lnum_t              n2_dofs,
+                          const cs_real_t       *x1,
+                          const cs_adjacency_t  *m21_adj,
+                          const cs_real_t       *m21_val,
+                          cs_real_t             *m21x1)
+{
+  CS_NO_WARN_IF_UNUSED(m21_val);
+  assert(n2_dofs == m21_adj->n_elts);
+  assert(m21_adj->sgn != nullptr);
+
+  const cs_cdo_quantities_t  *cdoq = cs_shared_quant;
+  const cs_lnum_t  n_i_faces = cdoq->n_i_faces;
+  const cs_real_t  *i_surf = cdoq->i_face_surf;
+  const cs_real_t  *b_surf = cdoq->b_face_surf;
+  const cs_nreal_3_t  *i_unorm = cdoq->i_face_u_normal;
+  const cs_nreal_3_t  *b_unorm = cdoq->b_face_u_normal;
+  const unsigned char  *mask = cs_shared_block21_mask;
+  const cs_lnum_t  *adj_idx = m21_adj->idx;
+  const cs_lnum_t  *adj_ids = m21_adj->ids;
+  const short int  *adj_sgn = m21_adj->sgn;
+
+  cs_dispatch_context  dctx;
+  const void  *arrays[] = {x1, adj_idx, adj_ids, adj_sgn, mask, m21x1,
+                           i_surf, b_surf, i_unorm, b_unorm};
+  _set_dispatch_location(10, arrays, dctx);
+
+  dctx.parallel_for(n2_dofs, [=] CS_F_HOST_DEVICE (cs_lnum_t i2) {
+
+    cs_real_t  _m21x1 = 0.;
+    for (cs_lnum_t j = adj_idx[i2]; j < adj_idx[i2+1]; j++) {
+
+      const cs_lnum_t  f_id = adj_ids[j];
+      const unsigned char  m = mask[f_id];
+      if (m == 0)
+        continue;
+
+      const cs_nreal_t  *unorm = (f_id < n_i_faces) ?
+        i_unorm[f_id] : b_unorm[f_id - n_i_faces];
+      const cs_real_t  surf = (f_id < n_i_faces) ?
+        i_surf[f_id] : b_surf[f_id - n_i_faces];
+      const cs_real_t  *_x1 = x1 + 3*f_id;
+
+      cs_real_t  dp = 0.;
+      for (int k = 0; k < 3; k++)
+        if (m & (1 << k))
+          dp += unorm[k]*_x1[k];
+
+      _m21x1 -= adj_sgn[j]*surf*dp;
+
+    } /* Loop on faces associated to a given cell */
+
+    m21x1[i2] = _m21x1;
+
+  }); /* Loop on x2 DoFs */
+
+  dctx.wait();
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define a diagonal scaled mass matrix
@@ -327,7 +506,7 @@ _get_scaled_diag_m22(const cs_navsto_param_t  *nsp,
   const cs_lnum_t  n_cells = cdoq->n_cells;
 
   cs_real_t *m22_mass_diag = nullptr;
-  BFT_MALLOC(m22_mass_diag, n_cells, cs_real_t);
+  CS_MALLOC_HD(m22_mass_diag, n_cells, cs_real_t, cs_alloc_mode);
 
   /* Compute scaling coefficients */
 
@@ -509,10 +688,10 @@ _gkb_init_context(cs_saddle_solver_t              *solver,
 
   /* Buffers of size n2_dofs */
 
-  BFT_MALLOC(ctx->q, n2_dofs, cs_real_t);
-  BFT_MALLOC(ctx->d, n2_dofs, cs_real_t);
-  BFT_MALLOC(ctx->m21v, n2_dofs, cs_real_t);
-  BFT_MALLOC(ctx->inv_m22, n2_dofs, cs_real_t);
+  CS_MALLOC_HD(ctx->q, n2_dofs, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(ctx->d, n2_dofs, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(ctx->m21v, n2_dofs, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(ctx->inv_m22, n2_dofs, cs_real_t, cs_alloc_mode);
 
   ctx->m22 = quant->cell_vol;   /* shared pointer */
   for (cs_lnum_t i = 0; i < n2_dofs; i++)
@@ -520,20 +699,21 @@ _gkb_init_context(cs_saddle_solver_t              *solver,
 
   /* Buffers of size n1_dofs */
 
-  BFT_MALLOC(ctx->m12q, n1_dofs, cs_real_t);
-  BFT_MALLOC(ctx->x1_tilda, n1_dofs, cs_real_t);
+  CS_MALLOC_HD(ctx->m12q, n1_dofs, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(ctx->x1_tilda, n1_dofs, cs_real_t, cs_alloc_mode);
 
   cs_cdo_system_helper_t  *sh = solver->system_helper;
 
   const cs_matrix_t  *m11 = cs_cdo_system_get_matrix(sh, 0);
   const cs_lnum_t  max_b11_size = CS_MAX(cs_matrix_get_n_columns(m11), n1_dofs);
 
-  BFT_MALLOC(ctx->w, max_b11_size, cs_real_t);
-  BFT_MALLOC(ctx->v, max_b11_size, cs_real_t);
+  CS_MALLOC_HD(ctx->w, max_b11_size, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(ctx->v, max_b11_size, cs_real_t, cs_alloc_mode);
 
   /* Rk: rhs_tilda stores quantities in space X1 and X2 alternatively */
 
-  BFT_MALLOC(ctx->rhs_tilda, CS_MAX(n1_dofs, n2_dofs), cs_real_t);
+  CS_MALLOC_HD(ctx->rhs_tilda, CS_MAX(n1_dofs, n2_dofs), cs_real_t,
+               cs_alloc_mode);
 
   /* Convergence members (energy norm estimation) */
 
@@ -635,14 +815,19 @@ _uzawa_cg_init_context(const cs_navsto_param_t              *nsp,
 
   /* Buffers of size n1_scatter_dofs */
 
-  BFT_MALLOC(ctx->b1_tilda, solver->n1_scatter_dofs, cs_real_t);
-  BFT_MALLOC(ctx->rhs, solver->n1_scatter_dofs, cs_real_t);
-  BFT_MALLOC(ctx->dzk, solver->n1_scatter_dofs, cs_real_t);
+  CS_MALLOC_HD(ctx->b1_tilda, solver->n1_scatter_dofs, cs_real_t,
+               cs_alloc_mode);
+  CS_MALLOC_HD(ctx->rhs, solver->n1_scatter_dofs, cs_real_t,
+               cs_alloc_mode);
+  CS_MALLOC_HD(ctx->dzk, solver->n1_scatter_dofs, cs_real_t,
+               cs_alloc_mode);
 
   /* Buffers of size n2_scatter_dofs */
 
-  BFT_MALLOC(ctx->res2, solver->n2_scatter_dofs, cs_real_t);
-  BFT_MALLOC(ctx->m21x1, solver->n2_scatter_dofs, cs_real_t);
+  CS_MALLOC_HD(ctx->res2, solver->n2_scatter_dofs, cs_real_t,
+               cs_alloc_mode);
+  CS_MALLOC_HD(ctx->m21x1, solver->n2_scatter_dofs, cs_real_t,
+               cs_alloc_mode);
 
   /* Since gk is used as a variable in a cell system, one has to take into
      account extra-space for synchronization */
@@ -650,7 +835,7 @@ _uzawa_cg_init_context(const cs_navsto_param_t              *nsp,
   cs_lnum_t  size = solver->n2_scatter_dofs;
   if (cs_glob_n_ranks > 1)
     size = CS_MAX(size, connect->n_cells_with_ghosts);
-  BFT_MALLOC(ctx->gk, size, cs_real_t);
+  CS_MALLOC_HD(ctx->gk, size, cs_real_t, cs_alloc_mode);
 
 
   ctx->inv_m22 = _get_scaled_diag_m22(nsp, ctx->pty_22);
@@ -805,7 +990,7 @@ cs_cdofb_monolithic_sles_init_system_helper(const cs_navsto_param_t  *nsp,
 
       b_ub->adjacency = connect->c2f;            /* shared pointer */
       b_ub->values = sc->block21_op;             /* shared pointer */
-      assert(b_ub->values != nullptr);
+      assert(b_ub->values != nullptr || sc->block21_mask != nullptr);
       b_ub->shared_structures = true;
       b_ub->range_set = a_db->range_set;         /* shared pointer */
       b_ub->interface_set = a_db->interface_set; /* shared pointer */
@@ -925,6 +1110,21 @@ cs_cdofb_monolithic_sles_init_solver(const cs_navsto_param_t  *nsp,
 
   sc->saddle_solver = solver;
 
+  /* When the (2,1)-block is not stored, the matrix-vector products with the
+     (1,2)- and (2,1)-blocks are performed on the fly */
+
+  cs_shared_block21_mask = sc->block21_mask;
+
+  cs_saddle_solver_matvec_t  *m12_multiply =
+    cs_saddle_solver_m12_multiply_vector;
+  cs_saddle_solver_matvec_t  *m21_multiply =
+    cs_saddle_solver_m21_multiply_vector;
+
+  if (sc->block21_mask != nullptr) {
+    m12_multiply = _m12_multiply_matrix_free;
+    m21_multiply = _m21_multiply_matrix_free;
+  }
+
   /* Set the solve function pointer */
 
   switch (saddlep->solver) {
@@ -939,8 +1139,8 @@ cs_cdofb_monolithic_sles_init_solver(const cs_navsto_param_t  *nsp,
         = (cs_saddle_solver_context_alu_t *)solver->context;
 
       ctx->square_norm_b11 = cs_cdo_blas_square_norm_pfvp;
-      ctx->m12_vector_multiply = cs_saddle_solver_m12_multiply_vector;
-      ctx->m21_vector_multiply = cs_saddle_solver_m21_multiply_vector;
+      ctx->m12_vector_multiply = m12_multiply;
+      ctx->m21_vector_multiply = m21_multiply;
     }
     break;
 
@@ -953,7 +1153,7 @@ cs_cdofb_monolithic_sles_init_solver(const cs_navsto_param_t  *nsp,
       cs_saddle_solver_context_notay_t *ctx
         = (cs_saddle_solver_context_notay_t *)solver->context;
 
-      ctx->m12_vector_multiply = cs_saddle_solver_m12_multiply_vector;
+      ctx->m12_vector_multiply = m12_multiply;
     }
     break;
 
@@ -971,8 +1171,8 @@ cs_cdofb_monolithic_sles_init_solver(const cs_navsto_param_t  *nsp,
         = (cs_saddle_solver_context_gkb_t *)solver->context;
 
       ctx->square_norm_b11 = cs_cdo_blas_square_norm_pfvp;
-      ctx->m12_vector_multiply = cs_saddle_solver_m12_multiply_vector;
-      ctx->m21_vector_multiply = cs_saddle_solver_m21_multiply_vector;
+      ctx->m12_vector_multiply = m12_multiply;
+      ctx->m21_vector_multiply = m21_multiply;
 
     }
     break;
@@ -987,8 +1187,8 @@ cs_cdofb_monolithic_sles_init_solver(const cs_navsto_param_t  *nsp,
       cs_saddle_solver_context_block_pcd_t *ctx
         = (cs_saddle_solver_context_block_pcd_t *)solver->context;
 
-      ctx->m12_vector_multiply = cs_saddle_solver_m12_multiply_vector;
-      ctx->m21_vector_multiply = cs_saddle_solver_m21_multiply_vector;
+      ctx->m12_vector_multiply = m12_multiply;
+      ctx->m21_vector_multiply = m21_multiply;
 
       if (nsp->turbulence->model->iturb == CS_TURB_NONE)
         ctx->pty_22 = nsp->lam_viscosity;
@@ -1019,8 +1219,8 @@ cs_cdofb_monolithic_sles_init_solver(const cs_navsto_param_t  *nsp,
         = (cs_saddle_solver_context_uzawa_cg_t *)solver->context;
 
       ctx->square_norm_b11 = cs_cdo_blas_square_norm_pfvp;
-      ctx->m12_vector_multiply = cs_saddle_solver_m12_multiply_vector;
-      ctx->m21_vector_multiply = cs_saddle_solver_m21_multiply_vector;
+      ctx->m12_vector_multiply = m12_multiply;
+      ctx->m21_vector_multiply = m21_multiply;
 
       if (nsp->turbulence->model->iturb == CS_TURB_NONE)
         ctx->pty_22 = nsp->lam_viscosity;
@@ -1051,8 +1251,8 @@ cs_cdofb_monolithic_sles_init_solver(const cs_navsto_param_t  *nsp,
         = (cs_saddle_solver_context_simple_t *)solver->context;
 
       ctx->square_norm_b11 = cs_cdo_blas_square_norm_pfvp;
-      ctx->m12_vector_multiply = cs_saddle_solver_m12_multiply_vector;
-      ctx->m21_vector_multiply = cs_saddle_solver_m21_multiply_vector;
+      ctx->m12_vector_multiply = m12_multiply;
+      ctx->m21_vector_multiply = m21_multiply;
 
       if (nsp->turbulence->model->iturb == CS_TURB_NONE)
         ctx->pty_22 = nsp->lam_viscosity;
@@ -1702,7 +1902,7 @@ cs_cdofb_monolithic_sles_uzawa_cg(const cs_navsto_param_t  *nsp,
   cs_real_t *x1 = nullptr;
 
   if (cs_glob_n_ranks > 1) {
-    BFT_MALLOC(x1, ctx->b11_max_size, cs_real_t);
+    CS_MALLOC_HD(x1, ctx->b11_max_size, cs_real_t, cs_alloc_mode);
     cs_array_real_copy(solver->n1_scatter_dofs, u_f, x1);
   }
   else
@@ -1797,7 +1997,7 @@ cs_cdofb_monolithic_sles_uzawa_cg(const cs_navsto_param_t  *nsp,
 
   if (cs_glob_n_ranks > 1) {
     cs_array_real_copy(solver->n1_scatter_dofs, x1, u_f);
-    BFT_FREE(x1);
+    CS_FREE_HD(x1);
   }
 
   /* 3. Monitoring and output */
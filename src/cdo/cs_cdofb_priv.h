@@ -33,6 +33,7 @@
 #include "cs_equation_bc.h"
 #include "cs_equation_builder.h"
 #include "cs_hodge.h"
+#include "cs_static_condensation.h"
 
 /*----------------------------------------------------------------------------*/
 
@@ -73,6 +74,9 @@ struct  _cs_cdofb_t {
                               Access to the values thanks to the c2f
                               connectivity */
 
+  cs_static_condensation_cache_t  *sc_cache; /* Cached condensed systems
+                                                (nullptr if not used) */
+
   /* Array storing the value arising from the contribution of all source
      terms (only allocated to n_cells) */
 
@@ -610,6 +610,7 @@ _sfb_assemble(const cs_cell_sys_t         *csys,
 
   /* Matrix assembly */
 
+  cs_cdo_assembly_set_cell_map(asb, db->assembly_map, csys->c_id);
   db->assembly_func(csys->mat, csys->dof_ids, db->range_set, asb, db->mav);
 
   /* RHS assembly (only on faces since a static condensation has been performed
@@ -868,6 +869,9 @@ cs_cdofb_scaleq_init_context(cs_equation_param_t    *eqp,
   cs_array_real_fill_zero(n_cells, eqc->rc_tilda);
   cs_array_real_fill_zero(connect->c2f->idx[n_cells], eqc->acf_tilda);
 
+  eqc->sc_cache = cs_static_condensation_cache_create(connect->c2f, 1,
+                                                      eqp->sc_cache_budget);
+
   bool  need_eigen =
     (eqp->default_enforcement == CS_PARAM_BC_ENFORCE_WEAK_NITSCHE ||
      eqp->default_enforcement == CS_PARAM_BC_ENFORCE_WEAK_SYM) ? true : false;
@@ -1118,6 +1122,7 @@ cs_cdofb_scaleq_free_context(void   *data)
 
   BFT_FREE(eqc->rc_tilda);
   BFT_FREE(eqc->acf_tilda);
+  cs_static_condensation_cache_free(&(eqc->sc_cache));
 
   BFT_FREE(eqc);
 
@@ -1351,7 +1356,9 @@ cs_cdofb_scaleq_interpolate(const cs_mesh_t            *mesh,
      * --------------------------------------------- */
 
 #   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (cs_lnum_t c_idx = 0; c_idx < quant->n_cells; c_idx++) {
+
+      const cs_lnum_t  c_id = connect->cell_ids_by_type[c_idx];
 
       /* Set the current cell flag */
 
@@ -1551,6 +1558,11 @@ cs_cdofb_scaleq_solve_steady_state(bool                        cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* Cellwise systems may be retrieved from a cache. They are rebuilt when
+     the key (related to the time step) changes */
+
+  cs_static_condensation_cache_start(eqc->sc_cache, 0.);
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
     const int  t_id = cs_get_thread_id();
@@ -1589,7 +1601,9 @@ cs_cdofb_scaleq_solve_steady_state(bool                        cur2prev,
      * --------------------------------------------- */
 
 #   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (cs_lnum_t c_idx = 0; c_idx < quant->n_cells; c_idx++) {
+
+      const cs_lnum_t  c_id = connect->cell_ids_by_type[c_idx];
 
       /* Set the current cell flag */
 
@@ -1649,9 +1663,10 @@ cs_cdofb_scaleq_solve_steady_state(bool                        cur2prev,
        * Store data in rc_tilda and acf_tilda to compute the values at cell
        * centers after solving the system */
 
-      cs_static_condensation_scalar_eq(connect->c2f,
-                                       eqc->rc_tilda, eqc->acf_tilda,
-                                       cb, csys);
+      cs_static_condensation_scalar_cached(connect->c2f,
+                                           eqc->sc_cache,
+                                           eqc->rc_tilda, eqc->acf_tilda,
+                                           cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 1
       if (cs_dbg_cw_test(eqp, cm, csys))
@@ -1683,6 +1698,8 @@ cs_cdofb_scaleq_solve_steady_state(bool                        cur2prev,
 
   } /* OPENMP Block */
 
+  cs_static_condensation_cache_end(eqc->sc_cache);
+
   /* Free temporary buffers and structures */
 
   cs_cdo_system_helper_finalize_assembly(sh);
@@ -1782,6 +1799,8 @@ cs_cdofb_scaleq_solve_implicit(bool                        cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  cs_static_condensation_cache_start(eqc->sc_cache, 1./ts->dt[0]);
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
     const int  t_id = cs_get_thread_id();
@@ -1828,7 +1847,9 @@ cs_cdofb_scaleq_solve_implicit(bool                        cur2prev,
     /* --------------------------------------------- */
 
 #   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (cs_lnum_t c_idx = 0; c_idx < quant->n_cells; c_idx++) {
+
+      const cs_lnum_t  c_id = connect->cell_ids_by_type[c_idx];
 
       /* Set the current cell flag */
 
@@ -1934,10 +1955,11 @@ cs_cdofb_scaleq_solve_implicit(bool                        cur2prev,
        * Store data in rc_tilda and acf_tilda to compute the values at cell
        * centers after solving the system */
 
-      cs_static_condensation_scalar_eq(connect->c2f,
-                                       eqc->rc_tilda,
-                                       eqc->acf_tilda,
-                                       cb, csys);
+      cs_static_condensation_scalar_cached(connect->c2f,
+                                           eqc->sc_cache,
+                                           eqc->rc_tilda,
+                                           eqc->acf_tilda,
+                                           cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 1
       if (cs_dbg_cw_test(eqp, cm, csys))
@@ -1970,6 +1992,8 @@ cs_cdofb_scaleq_solve_implicit(bool                        cur2prev,
 
   } /* OPENMP Block */
 
+  cs_static_condensation_cache_end(eqc->sc_cache);
+
   /* Free temporary buffers and structures */
 
   cs_cdo_system_helper_finalize_assembly(sh);
@@ -2082,6 +2106,8 @@ cs_cdofb_scaleq_solve_theta(bool                        cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  cs_static_condensation_cache_start(eqc->sc_cache, 1./ts->dt[0]);
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
     const int  t_id = cs_get_thread_id();
@@ -2131,7 +2157,9 @@ cs_cdofb_scaleq_solve_theta(bool                        cur2prev,
     /* --------------------------------------------- */
 
 #   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (cs_lnum_t c_idx = 0; c_idx < quant->n_cells; c_idx++) {
+
+      const cs_lnum_t  c_id = connect->cell_ids_by_type[c_idx];
 
       /* Set the current cell flag */
 
@@ -2281,9 +2309,10 @@ cs_cdofb_scaleq_solve_theta(bool                        cur2prev,
        * Store data in rc_tilda and acf_tilda to compute the values at cell
        * centers after solving the system */
 
-      cs_static_condensation_scalar_eq(connect->c2f,
-                                       eqc->rc_tilda, eqc->acf_tilda,
-                                       cb, csys);
+      cs_static_condensation_scalar_cached(connect->c2f,
+                                           eqc->sc_cache,
+                                           eqc->rc_tilda, eqc->acf_tilda,
+                                           cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 1
       if (cs_dbg_cw_test(eqp, cm, csys))
@@ -2316,6 +2345,8 @@ cs_cdofb_scaleq_solve_theta(bool                        cur2prev,
 
   } /* OPENMP Block */
 
+  cs_static_condensation_cache_end(eqc->sc_cache);
+
   /* Free temporary buffers and structures */
 
   cs_cdo_system_helper_finalize_assembly(sh);
@@ -2473,7 +2504,9 @@ cs_cdofb_scaleq_balance(const cs_equation_param_t     *eqp,
     /* --------------------------------------------- */
 
 #   pragma omp for CS_CDO_OMP_SCHEDULE
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (cs_lnum_t c_idx = 0; c_idx < quant->n_cells; c_idx++) {
+
+      const cs_lnum_t  c_id = connect->cell_ids_by_type[c_idx];
 
       cb->cell_flag = connect->cell_flag[c_id];
 
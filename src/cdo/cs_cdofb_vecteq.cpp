@@ -45,6 +45,7 @@
 #include <bft_mem.h>
 
 #include "cs_array.h"
+#include "cs_base_accel.h"
 #include "cs_cdo_advection.h"
 #include "cs_cdo_bc.h"
 #include "cs_cdo_diffusion.h"
@@ -773,6 +774,11 @@ cs_cdofb_vecteq_solve_steady_state(bool                       cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* Cellwise systems may be retrieved from a cache. They are rebuilt when
+     the key (related to the time step) changes */
+
+  cs_static_condensation_cache_start(eqc->sc_cache, 0.);
+
 #pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
     const int t_id = cs_get_thread_id();
@@ -857,10 +863,11 @@ cs_cdofb_vecteq_solve_steady_state(bool                       cur2prev,
        * Store data in rc_tilda and acf_tilda to compute the values at cell
        * centers after solving the system */
 
-      cs_static_condensation_vector_eq(connect->c2f,
-                                       eqc->rc_tilda,
-                                       eqc->acf_tilda,
-                                       cb, csys);
+      cs_static_condensation_vector_cached(connect->c2f,
+                                           eqc->sc_cache,
+                                           eqc->rc_tilda,
+                                           eqc->acf_tilda,
+                                           cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_VECTEQ_DBG > 1
       if (cs_dbg_cw_test(eqp, cm, csys))
@@ -887,6 +894,8 @@ cs_cdofb_vecteq_solve_steady_state(bool                       cur2prev,
 
   } /* OpenMP Block */
 
+  cs_static_condensation_cache_end(eqc->sc_cache);
+
   /* Free temporary buffers and structures */
 
   cs_cdo_system_helper_finalize_assembly(sh);
@@ -982,6 +991,8 @@ cs_cdofb_vecteq_solve_implicit(bool                        cur2prev,
   cs_cdo_system_helper_init_system(sh, &rhs);
   assert(rhs == sh->rhs);
 
+  cs_static_condensation_cache_start(eqc->sc_cache, inv_dtcur);
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
     const int  t_id = cs_get_thread_id();
@@ -1099,9 +1110,10 @@ cs_cdofb_vecteq_solve_implicit(bool                        cur2prev,
        * Store data in rc_tilda and acf_tilda to compute the values at cell
        * centers after solving the system */
 
-      cs_static_condensation_vector_eq(connect->c2f,
-                                       eqc->rc_tilda, eqc->acf_tilda,
-                                       cb, csys);
+      cs_static_condensation_vector_cached(connect->c2f,
+                                           eqc->sc_cache,
+                                           eqc->rc_tilda, eqc->acf_tilda,
+                                           cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_VECTEQ_DBG > 1
       if (cs_dbg_cw_test(eqp, cm, csys))
@@ -1129,6 +1141,8 @@ cs_cdofb_vecteq_solve_implicit(bool                        cur2prev,
   } /* OPENMP Block */
 
 
+  cs_static_condensation_cache_end(eqc->sc_cache);
+
   /* Free temporary buffers and structures */
 
   cs_cdo_system_helper_finalize_assembly(sh);
@@ -1230,6 +1244,8 @@ cs_cdofb_vecteq_solve_theta(bool                        cur2prev,
   cs_cdo_system_helper_init_system(sh, &rhs);
   assert(rhs == sh->rhs);
 
+  cs_static_condensation_cache_start(eqc->sc_cache, 1./ts->dt[0]);
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
     const int  t_id = cs_get_thread_id();
@@ -1387,9 +1403,10 @@ cs_cdofb_vecteq_solve_theta(bool                        cur2prev,
        * Store data in rc_tilda and acf_tilda to compute the values at cell
        * centers after solving the system */
 
-      cs_static_condensation_vector_eq(connect->c2f,
-                                       eqc->rc_tilda, eqc->acf_tilda,
-                                       cb, csys);
+      cs_static_condensation_vector_cached(connect->c2f,
+                                           eqc->sc_cache,
+                                           eqc->rc_tilda, eqc->acf_tilda,
+                                           cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_VECTEQ_DBG > 1
       if (cs_dbg_cw_test(eqp, cm, csys))
@@ -1416,6 +1433,8 @@ cs_cdofb_vecteq_solve_theta(bool                        cur2prev,
 
   } /* OPENMP Block */
 
+  cs_static_condensation_cache_end(eqc->sc_cache);
+
   /* Free temporary buffers and structures */
 
   cs_cdo_system_helper_finalize_assembly(sh);
@@ -1640,8 +1659,8 @@ cs_cdofb_vecteq_init_context(cs_equation_param_t    *eqp,
   eqb->bdy_flag = CS_FLAG_COMP_PV | CS_FLAG_COMP_EV | CS_FLAG_COMP_FE |
     CS_FLAG_COMP_FEQ;
 
-  BFT_MALLOC(eqc->face_values, 3*n_faces, cs_real_t);
-  BFT_MALLOC(eqc->face_values_pre, 3*n_faces, cs_real_t);
+  CS_MALLOC_HD(eqc->face_values, 3*n_faces, cs_real_t, cs_alloc_mode);
+  CS_MALLOC_HD(eqc->face_values_pre, 3*n_faces, cs_real_t, cs_alloc_mode);
   BFT_MALLOC(eqc->rc_tilda, 3*n_cells, cs_real_t);
 
 # pragma omp parallel if (3*n_cells > CS_THR_MIN)
@@ -1668,6 +1687,9 @@ cs_cdofb_vecteq_init_context(cs_equation_param_t    *eqp,
   BFT_MALLOC(eqc->acf_tilda, 3*connect->c2f->idx[n_cells], cs_real_t);
   cs_array_real_fill_zero(3*connect->c2f->idx[n_cells], eqc->acf_tilda);
 
+  eqc->sc_cache = cs_static_condensation_cache_create(connect->c2f, 3,
+                                                      eqp->sc_cache_budget);
+
   bool  need_eigen =
     (eqp->default_enforcement == CS_PARAM_BC_ENFORCE_WEAK_NITSCHE ||
      eqp->default_enforcement == CS_PARAM_BC_ENFORCE_WEAK_SYM) ? true : false;
@@ -1911,10 +1933,11 @@ cs_cdofb_vecteq_free_context(void   *data)
   /* Free temporary buffers */
 
   BFT_FREE(eqc->source_terms);
-  BFT_FREE(eqc->face_values);
-  BFT_FREE(eqc->face_values_pre);
+  CS_FREE_HD(eqc->face_values);
+  CS_FREE_HD(eqc->face_values_pre);
   BFT_FREE(eqc->rc_tilda);
   BFT_FREE(eqc->acf_tilda);
+  cs_static_condensation_cache_free(&(eqc->sc_cache));
 
   cs_hodge_free_context(&(eqc->diffusion_hodge));
   cs_hodge_free_context(&(eqc->mass_hodge));
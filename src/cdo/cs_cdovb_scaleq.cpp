@@ -1161,6 +1161,7 @@ _svb_assemble(const cs_cell_sys_t        *csys,
 
   /* Matrix assembly */
 
+  cs_cdo_assembly_set_cell_map(asb, db->assembly_map, csys->c_id);
   db->assembly_func(csys->mat, csys->dof_ids, db->range_set, asb, db->mav);
 
   /* RHS assembly */
@@ -2530,7 +2531,9 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
     /* --------------------------------------------- */
 
 #   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (cs_lnum_t c_idx = 0; c_idx < quant->n_cells; c_idx++) {
+
+      const cs_lnum_t  c_id = connect->cell_ids_by_type[c_idx];
 
       /* Set the current cell flag */
 
@@ -2760,7 +2763,9 @@ cs_cdovb_scaleq_solve_steady_state_incr(bool                        cur2prev,
     /* --------------------------------------------- */
 
 #   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (cs_lnum_t c_idx = 0; c_idx < quant->n_cells; c_idx++) {
+
+      const cs_lnum_t  c_id = connect->cell_ids_by_type[c_idx];
 
       /* Set the current cell flag */
 
@@ -3014,7 +3019,9 @@ cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
     /* --------------------------------------------- */
 
 #   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (cs_lnum_t c_idx = 0; c_idx < quant->n_cells; c_idx++) {
+
+      const cs_lnum_t  c_id = connect->cell_ids_by_type[c_idx];
 
       /* Set the current cell flag */
 
@@ -3250,7 +3257,9 @@ cs_cdovb_scaleq_solve_implicit_incr(bool                        cur2prev,
     /* --------------------------------------------- */
 
 #   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (cs_lnum_t c_idx = 0; c_idx < quant->n_cells; c_idx++) {
+
+      const cs_lnum_t  c_id = connect->cell_ids_by_type[c_idx];
 
       /* Set the current cell flag */
 
@@ -3569,7 +3578,9 @@ cs_cdovb_scaleq_solve_theta(bool                        cur2prev,
      * --------------------------------------------- */
 
 #   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (cs_lnum_t c_idx = 0; c_idx < quant->n_cells; c_idx++) {
+
+      const cs_lnum_t  c_id = connect->cell_ids_by_type[c_idx];
 
       /* Set the current cell flag */
 
@@ -3907,7 +3918,9 @@ cs_cdovb_scaleq_balance(const cs_equation_param_t     *eqp,
     /* --------------------------------------------- */
 
 #   pragma omp for CS_CDO_OMP_SCHEDULE
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (cs_lnum_t c_idx = 0; c_idx < quant->n_cells; c_idx++) {
+
+      const cs_lnum_t  c_id = connect->cell_ids_by_type[c_idx];
 
       /* Set the current cell flag */
 
@@ -4253,7 +4266,9 @@ cs_cdovb_scaleq_apply_stiffness(const cs_equation_param_t     *eqp,
     /* --------------------------------------------- */
 
 #   pragma omp for CS_CDO_OMP_SCHEDULE
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (cs_lnum_t c_idx = 0; c_idx < quant->n_cells; c_idx++) {
+
+      const cs_lnum_t  c_id = connect->cell_ids_by_type[c_idx];
 
       /* Set the current cell flag */
 
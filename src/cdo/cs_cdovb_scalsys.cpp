@@ -46,6 +46,7 @@
 
 #include "cs_array.h"
 #include "cs_cdo_assembly.h"
+#include "cs_cdo_solve.h"
 #include "cs_cdo_system.h"
 #include "cs_cdovb_priv.h"
 #include "cs_cdovb_scaleq.h"
@@ -356,6 +357,55 @@ _svb_one_dblock_assemble(const cs_cell_sys_t          *csys,
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Perform the assembly step. Add the current cell-wise system in the
+ *        full (coupled) system. The cell-wise system gathers all the
+ *        equations and is stored with one n_eqs x n_eqs block by vertex
+ *        (interlaced DoFs).
+ *
+ * \param[in]      csys       pointer to a cellwise view of the system
+ * \param[in, out] sh         pointer to the system helper of the coupled sys.
+ * \param[in, out] eqc        context for this kind of discretization
+ * \param[in, out] asb        pointer to a cs_cdo_assembly_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_svb_interlaced_assemble(const cs_cell_sys_t          *csys,
+                         cs_cdo_system_helper_t       *sh,
+                         cs_equation_builder_t        *eqb,
+                         cs_cdo_assembly_t            *asb)
+{
+  CS_NO_WARN_IF_UNUSED(eqb);
+
+  /* Members of the coupled system helper structure */
+
+  assert(sh->n_blocks == 1);
+  cs_cdo_system_block_t  *block = sh->blocks[0];
+  assert(block->type == CS_CDO_SYSTEM_BLOCK_DEFAULT);
+  cs_cdo_system_dblock_t *db = (cs_cdo_system_dblock_t *)block->block_pointer;
+  assert(block->info.interlaced == true);
+
+  /* Matrix assembly for the cellwise system inside the full system */
+
+  db->assembly_func(csys->mat, csys->dof_ids, db->range_set, asb, db->mav);
+
+  /* RHS assembly */
+
+#if CS_CDO_OMP_SYNC_MODE > 0
+# pragma omp critical
+  {
+    for (int i = 0; i < csys->n_dofs; i++)
+      sh->rhs[csys->dof_ids[i]] += csys->rhs[i];
+  }
+#else  /* Use atomic barrier */
+  for (int i = 0; i < csys->n_dofs; i++)
+#   pragma omp atomic
+    sh->rhs[csys->dof_ids[i]] += csys->rhs[i];
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Solve a linear system arising from CDO schemes with scalar-valued
@@ -471,6 +521,125 @@ _solve_mumps(int                                   n_eqs,
   return sinfo.n_it;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve a linear system arising from CDO schemes with scalar-valued
+ *        degrees of freedom. The system is stored with one n_eqs x n_eqs
+ *        block by vertex and solved with an iterative solver.
+ *
+ * \param[in]      n_eqs     number of equations constituting the system
+ * \param[in]      n_dofs    local number of DoFs (may be != n_gather_elts)
+ * \param[in]      sysp      parameter settings
+ * \param[in, out] sh        pointer to the system helper structure
+ * \param[in, out] fields    array of field pointers (one for each eq.)
+ *
+ * \return the number of iterations of the linear solver
+ */
+/*----------------------------------------------------------------------------*/
+
+static int
+_solve_block_it(int                                   n_eqs,
+                cs_lnum_t                             n_dofs,
+                const cs_equation_system_param_t     *sysp,
+                cs_cdo_system_helper_t               *sh,
+                cs_field_t                          **fields)
+{
+  assert(sh != nullptr);
+  assert(sh->n_blocks == 1);
+  assert(sh->blocks[0]->type == CS_CDO_SYSTEM_BLOCK_DEFAULT);
+  assert(n_dofs == sh->full_rhs_size);
+  CS_NO_WARN_IF_UNUSED(n_dofs);
+
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_lnum_t  n_vertices = quant->n_vertices;
+  const cs_matrix_t  *matrix = cs_cdo_system_get_matrix(sh, 0);
+  const cs_range_set_t  *rset = cs_cdo_system_get_range_set(sh, 0);
+  const cs_param_sles_t  *slesp = sysp->sles_param;
+
+  /* The matrix is defined by blocks: there are n_cols*n_eqs unknowns with
+     n_cols >= n_vertices in case of a parallel computation */
+
+  const cs_lnum_t  n_cols = cs_matrix_get_n_columns(matrix);
+
+  assert(n_dofs == n_eqs*n_vertices);
+  assert(n_vertices <= n_cols);
+
+  /* Initialize the solution array (interlaced) */
+
+  cs_real_t *dof_vals = nullptr;
+  BFT_MALLOC(dof_vals, n_cols*n_eqs, cs_real_t);
+
+  for (int i = 0; i < n_eqs; i++) {
+
+    const cs_real_t  *f_val = fields[i]->val;
+    for (cs_lnum_t v = 0; v < n_vertices; v++)
+      dof_vals[n_eqs*v + i] = f_val[v];
+
+  }
+
+  /* Move to a gathered view of the solution and rhs arrays */
+
+  cs_cdo_solve_prepare_system(n_eqs, true, n_vertices, rset, true,
+                              dof_vals, sh->rhs);
+
+  const cs_lnum_t  n_gather_rows =
+    (rset != nullptr) ? rset->n_elts[0] : n_vertices;
+
+  /* Retrieve the SLES structure */
+
+  cs_sles_t  *sles = cs_sles_find_or_add(-1, sysp->name);
+
+  /* Set the input monitoring state */
+
+  cs_solving_info_t sinfo = {
+    .n_it = 0, .rhs_norm = 1, .res_norm = 1e16, .derive = 0., .l2residual = 0.
+  };
+
+  cs_cdo_solve_sync_rhs_norm(CS_PARAM_RESNORM_NORM2_RHS, quant->vol_tot,
+                             n_gather_rows*n_eqs, sh->rhs,
+                             &(sinfo.rhs_norm));
+
+  cs_sles_convergence_state_t code = cs_sles_solve(sles,
+                                                   matrix,
+                                                   slesp->cvg_param.rtol,
+                                                   sinfo.rhs_norm,
+                                                   &(sinfo.n_it),
+                                                   &(sinfo.res_norm),
+                                                   sh->rhs,
+                                                   dof_vals,
+                                                   0,        /* aux. size */
+                                                   nullptr); /* aux. buffers */
+
+  /* Output information about the convergence of the resolution */
+
+  if (sysp->verbosity > 0 && cs_log_default_is_active())
+    cs_log_printf(CS_LOG_DEFAULT, "  <%20s/sles_cvg_code=%-d>"
+                  " n_iter %3d | res.norm % -8.4e | rhs.norm % -8.4e\n",
+                  sysp->name, code, sinfo.n_it, sinfo.res_norm, sinfo.rhs_norm);
+
+  cs_range_set_scatter(rset,
+                       CS_REAL_TYPE, n_eqs, /* type and stride */
+                       dof_vals, dof_vals);
+  cs_range_set_scatter(rset,
+                       CS_REAL_TYPE, n_eqs, /* type and stride */
+                       sh->rhs, sh->rhs);
+
+  /* dof_vals --> fields */
+
+  for (int i = 0; i < n_eqs; i++) {
+
+    cs_real_t  *f_val = fields[i]->val;
+    for (cs_lnum_t v = 0; v < n_vertices; v++)
+      f_val[v] = dof_vals[n_eqs*v + i];
+
+  }
+
+  BFT_FREE(dof_vals);
+  cs_sles_free(sles);
+
+  return sinfo.n_it;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Build the linear system of equations. The number of rows in
@@ -603,6 +772,193 @@ _cdovb_scalsys_build_implicit(bool                           cur2prev,
   cs_cdo_system_helper_finalize_assembly(sh);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the linear system of equations. The number of rows in
+ *        the system is equal to the number of equations. Thus there are
+ *        n_eqs*n_eqs blocks in the system. Each block corresponds potentially
+ *        to a scalar-valued unsteady convection/diffusion/reaction equation
+ *        with a CDO-Vb scheme.
+ *
+ *        Case of a system stored with one n_eqs x n_eqs block by vertex: all
+ *        the equations are built cell by cell and assembled at once.
+ *
+ * \param[in]      cur2prev  do a "current to previous" operation ?
+ * \param[in]      n_eqs     number of equations
+ * \param[in, out] blocks    array of the core members for an equation
+ * \param[in, out] scalsys   pointer to a structure cast on-the-fly
+ * \param[in, out] fields    array of pointers to the associated fields
+ * \param[in, out] sh        pointer to a system helper structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_cdovb_scalsys_build_interlaced(bool                           cur2prev,
+                                int                            n_equations,
+                                cs_equation_core_t           **blocks,
+                                cs_cdovb_scalsys_t            *scalsys,
+                                cs_field_t                   **fields,
+                                cs_cdo_system_helper_t        *sh)
+{
+  const cs_mesh_t  *mesh = cs_shared_mesh;
+  const cs_time_step_t  *ts = cs_shared_time_step;
+  const cs_cdo_quantities_t  *quant = cs_shared_quant;
+  const cs_cdo_connect_t  *connect = cs_shared_connect;
+  const int  n_max_vbyc = connect->n_max_vbyc;
+  const int  k = n_equations;
+
+  const cs_real_t  time_eval = ts->t_cur + ts->dt[0];
+
+  /* Setup stage for each block of the system: Set useful arrays:
+   * -> the Dirichlet values at vertices
+   * -> the translation of the enforcement values at vertices if needed
+   */
+
+  for (int ij = 0; ij < n_equations*n_equations; ij++) {
+
+    cs_equation_builder_t  *eqb = blocks[ij]->builder;
+    cs_cdovb_scaleq_t      *eqc
+      = static_cast<cs_cdovb_scaleq_t *>(blocks[ij]->scheme_context);
+
+    if (eqb->init_step) {
+
+      cs_cdovb_scaleq_setup(time_eval, mesh, blocks[ij]->param, eqb,
+                            eqc->vtx_bc_flag);
+
+      eqb->init_step = false;
+
+    }
+
+  }
+
+  int  *block_sizes = nullptr;
+  BFT_MALLOC(block_sizes, n_max_vbyc, int);
+  for (int i = 0; i < n_max_vbyc; i++)
+    block_sizes[i] = k;
+
+  /* ------------------------- */
+  /* Main OpenMP block on cell */
+  /* ------------------------- */
+
+# pragma omp parallel if (quant->n_cells > CS_THR_MIN)
+  {
+    /* Set variables and structures inside the OMP section so that each
+       thread has its own value */
+
+    const int  t_id = cs_get_thread_id();
+
+    cs_cell_builder_t *cb   = nullptr;
+    cs_cell_sys_t     *csys = nullptr;
+
+    cs_cdovb_scaleq_get(&csys, &cb);
+
+    cs_cdo_assembly_t  *asb = cs_cdo_assembly_get(t_id);
+
+    cs_cdo_assembly_set_shift(asb, 0, 0);
+
+    /* Cellwise system gathering all the equations (one k x k block by
+       vertex) */
+
+    cs_cell_sys_t  *bsys = cs_cell_sys_create(k*n_max_vbyc,
+                                              connect->n_max_fbyc,
+                                              n_max_vbyc,
+                                              block_sizes);
+
+    /* --------------------------------------------- */
+    /* Main loop on cells to build the linear system */
+    /* --------------------------------------------- */
+
+#   pragma omp for CS_CDO_OMP_SCHEDULE
+    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+
+      for (int i_eq = 0; i_eq < n_equations; i_eq++) {
+        for (int j_eq = 0; j_eq < n_equations; j_eq++) {
+
+          const int  ij = i_eq*n_equations + j_eq;
+
+          cs_equation_core_t  *block_ij = blocks[ij];
+
+          const cs_equation_param_t  *eqp = block_ij->param;
+          const cs_real_t  *f_val =
+            cur2prev ? fields[j_eq]->val : fields[j_eq]->val_pre;
+
+          cs_equation_builder_t  *eqb = block_ij->builder;
+          cs_cdovb_scaleq_t      *eqc
+            = static_cast<cs_cdovb_scaleq_t *>(block_ij->scheme_context);
+
+          /* Build the cellwise system related to the block (i_eq, j_eq) */
+
+          cs_cdovb_scaleq_init_properties(t_id, time_eval, eqp, eqb, eqc);
+
+          cs_cdovb_scaleq_build_block_implicit(t_id,
+                                               c_id,
+                                               (i_eq == j_eq),
+                                               f_val,
+                                               eqp,
+                                               eqb,
+                                               eqc,
+                                               cb, csys);
+
+#if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALSYS_DBG > 1
+          if (csys->c_id == 0) {
+            cs_log_printf(CS_LOG_DEFAULT, "%s: %s\n", __func__, eqp->name);
+            cs_cell_sys_dump("\n>> Cell system (Block system)", csys);
+          }
+#endif
+
+          const int  n_vc = csys->n_dofs;
+
+          if (ij == 0) { /* Initialize the gathered cellwise system */
+
+            bsys->c_id = c_id;
+            bsys->n_dofs = k*n_vc;
+            cs_sdm_block_init(bsys->mat, n_vc, n_vc,
+                              block_sizes, block_sizes);
+
+            for (int vi = 0; vi < n_vc; vi++) {
+              for (int l = 0; l < k; l++) {
+                bsys->dof_ids[k*vi + l] = k*csys->dof_ids[vi] + l;
+                bsys->rhs[k*vi + l] = 0.;
+              }
+            }
+
+          }
+
+          /* Scatter the scalar-valued cellwise system into the entry
+             (i_eq, j_eq) of each k x k block */
+
+          for (int vi = 0; vi < n_vc; vi++) {
+
+            const cs_real_t  *m_i = csys->mat->val + vi*n_vc;
+
+            for (int vj = 0; vj < n_vc; vj++) {
+              cs_sdm_t  *b_ij = cs_sdm_get_block(bsys->mat, vi, vj);
+              b_ij->val[i_eq*k + j_eq] = m_i[vj];
+            }
+
+            bsys->rhs[k*vi + i_eq] += csys->rhs[vi];
+
+          }
+
+        } /* j_eq */
+      } /* i_eq */
+
+      /* Assembly process
+       * ================ */
+
+      scalsys->assemble(bsys, sh, nullptr, asb);
+
+    } /* Main loop on cells */
+
+    cs_cell_sys_free(&bsys);
+
+  } /* OPENMP Block */
+
+  BFT_FREE(block_sizes);
+
+  cs_cdo_system_helper_finalize_assembly(sh);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create and initialize a cs_cdovb_scalsys_t structure
@@ -642,6 +998,13 @@ _create_scalsys(int                                 n_eqs,
     scalsys->solve = _solve_mumps;
     break;
 
+  case CS_EQUATION_SYSTEM_SLES_BLOCK_JACOBI:
+  case CS_EQUATION_SYSTEM_SLES_BLOCK_AMG:
+    scalsys->build = _cdovb_scalsys_build_interlaced;
+    scalsys->assemble = _svb_interlaced_assemble;
+    scalsys->solve = _solve_block_it;
+    break;
+
   default:
     bft_error(__FILE__, __LINE__, 0,
               "%s: Invalid strategy to solve the system.\n",
@@ -756,6 +1119,30 @@ cs_cdovb_scalsys_define(int                                 n_eqs,
     }
     break;
 
+  case CS_EQUATION_SYSTEM_SLES_BLOCK_JACOBI:
+  case CS_EQUATION_SYSTEM_SLES_BLOCK_AMG:
+    {
+      /* One n_eqs x n_eqs block by vertex */
+
+      cs_lnum_t  col_block_sizes = n_eqs * n_vertices;
+
+      sh = cs_cdo_system_helper_create(CS_CDO_SYSTEM_COUPLED,
+                                       1,   /* n_col_blocks */
+                                       &col_block_sizes,
+                                       1);  /* n_blocks */
+
+      cs_cdo_system_add_dblock(sh, 0,
+                               CS_CDO_SYSTEM_MATRIX_CS,
+                               cs_flag_primal_vtx,
+                               n_vertices,
+                               n_eqs,   /* stride */
+                               true,    /* interlaced */
+                               false);  /* unrolled */
+
+      cs_cdo_system_build_block(sh, 0); /* build/set structures */
+    }
+    break;
+
   default:
     bft_error(__FILE__, __LINE__, 0,
               "%s: Invalid SLES strategy for system \"%s\"\n",
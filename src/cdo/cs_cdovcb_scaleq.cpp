@@ -722,6 +722,7 @@ _svcb_assemble(const cs_cell_sys_t        *csys,
 
   /* Matrix assembly */
 
+  cs_cdo_assembly_set_cell_map(asb, db->assembly_map, csys->c_id);
   db->assembly_func(csys->mat, csys->dof_ids, db->range_set, asb, db->mav);
 
   /* RHS assembly: After the static condensation the cellwise system is reduced
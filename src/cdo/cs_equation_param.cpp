@@ -526,6 +526,13 @@ _set_key(cs_equation_param_t *eqp,
     }
     break;
 
+  case CS_EQKEY_SADDLE_MATRIX_FREE:
+    if (strcmp(keyval, "true") == 0)
+      eqp->saddle_param->block21_matrix_free = true;
+    else
+      eqp->saddle_param->block21_matrix_free = false;
+    break;
+
   case CS_EQKEY_SADDLE_MAX_ITER:
     eqp->saddle_param->cvg_param.n_max_iter = atoi(keyval);
     break;
@@ -638,6 +645,15 @@ _set_key(cs_equation_param_t *eqp,
     eqp->saddle_param->verbosity = atoi(keyval);
     break;
 
+  case CS_EQKEY_SC_CACHE_BUDGET:
+    eqp->sc_cache_budget = atof(keyval);
+    if (eqp->sc_cache_budget < 0) {
+      const char *_val = keyval;
+      bft_error(__FILE__, __LINE__, 0,
+                emsg, __func__, eqname, _val, "CS_EQKEY_SC_CACHE_BUDGET");
+    }
+    break;
+
   case CS_EQKEY_SLES_VERBOSITY: /* "verbosity" for SLES structures */
     eqp->sles_param->verbosity = atoi(keyval);
     break;
@@ -873,6 +889,7 @@ cs_equation_param_create(const char         *name,
   eqp->space_scheme = CS_SPACE_SCHEME_CDOVB;
   eqp->dof_reduction = CS_PARAM_REDUCTION_DERHAM;
   eqp->space_poly_degree = 0;
+  eqp->sc_cache_budget = 0.;    /* No cache for the static condensation */
 
   /* Default initialization for the legacy var_col_opt structure which is now
    * shared inside the cs_equation_param_t structure The default value used
@@ -903,6 +920,8 @@ cs_equation_param_create(const char         *name,
   eqp->blend_st = 0.;
   eqp->epsilo = 1.e-5;
   eqp->epsrsm = 1.e-4;
+  eqp->epsrsm_red = 0.;
+  eqp->epsinc = 0.;
   eqp->epsrgr = 1.e-4;
   eqp->climgr = 1.5;
   eqp->relaxv = 1.;
@@ -1060,6 +1079,7 @@ cs_equation_param_copy_from(const cs_equation_param_t *ref,
   dst->space_scheme = ref->space_scheme;
   dst->dof_reduction = ref->dof_reduction;
   dst->space_poly_degree = ref->space_poly_degree;
+  dst->sc_cache_budget = ref->sc_cache_budget;
 
   /* Members originally located in the cs_var_cal_opt_t structure */
 
@@ -1087,6 +1107,8 @@ cs_equation_param_copy_from(const cs_equation_param_t *ref,
   dst->blend_st = ref->blend_st;
   dst->epsilo = ref->epsilo;
   dst->epsrsm = ref->epsrsm;
+  dst->epsrsm_red = ref->epsrsm_red;
+  dst->epsinc = ref->epsinc;
   dst->epsrgr = ref->epsrgr;
   dst->climgr = ref->climgr;
   dst->relaxv = ref->relaxv;
@@ -1763,6 +1785,10 @@ cs_equation_param_log(const cs_equation_param_t *eqp)
 
   cs_log_printf(CS_LOG_SETUP, "  * %s | Space poly degree:  %d\n",
                 eqname, eqp->space_poly_degree);
+  if (eqp->sc_cache_budget > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  "  * %s | Static condensation cache: %.1f MiB\n",
+                  eqname, eqp->sc_cache_budget);
   cs_log_printf(CS_LOG_SETUP, "  * %s | Verbosity:          %d\n",
                 eqname, eqp->verbosity);
 
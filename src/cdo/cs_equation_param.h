@@ -239,6 +239,16 @@ typedef struct {
 
   int                         space_poly_degree;
 
+  /*! \var sc_cache_budget
+   * Memory budget (in MiB) used to cache the cellwise systems obtained after
+   * the static condensation (CDO face-based schemes). 0 means no cache.
+   * This is only relevant when the cellwise systems do not change from one
+   * build to another (linear problems with constant properties and time
+   * step) so that only the reduction of the right-hand side is performed.
+   */
+
+  double                      sc_cache_budget;
+
   /*!
    * @}
    * @name Legacy Settings
@@ -421,6 +431,21 @@ typedef struct {
    * the value may be increased (by default, in case of second-order in time,
    * with \ref nswrsm = 5 or 10, \ref epsrsm is increased to \f$ 10^-5 \f$ ).
    *
+   * \var epsrsm_red
+   * Minimum relative reduction of the right-hand side residual expected
+   * from a reconstruction sweep. When a sweep reduces the residual by less
+   * than this fraction, further sweeps are not expected to be useful, and
+   * the reconstruction loop is stopped before \ref nswrsm sweeps.
+   * The default is 0 (no adaptive stopping).
+   *
+   * \var epsinc
+   * Relative precision on the solution increment of a reconstruction sweep.
+   * When the L2 norm of the increment is below \ref epsinc times that of
+   * the variable, the right-hand side (including gradients) is not
+   * reconstructed again, and the reconstruction loop is stopped, the
+   * residual being estimated by that of the linear solver.
+   * The default is 0 (right-hand side always reconstructed).
+   *
    * \var epsrgr
    * Relative precision for the iterative gradient reconstruction.
    * (when \ref imrgra = 0).
@@ -480,6 +505,8 @@ typedef struct {
   double blend_st;
   double epsilo;
   double epsrsm;
+  double epsrsm_red;
+  double epsinc;
   double epsrgr;
   double climgr;
   double relaxv;
@@ -1080,6 +1107,13 @@ typedef struct {
  * more details.
  * - Example: "1000"
  *
+ * \var CS_EQKEY_SADDLE_MATRIX_FREE
+ * Apply the (2,1)- and (1,2)-blocks of a saddle-point system on the fly
+ * instead of storing them, when this is possible for the given solver.
+ * Read the description of the structure \ref cs_param_saddle_t for more
+ * details.
+ * - Examples: "true" or "false" (default)
+ *
  * \var CS_EQKEY_SADDLE_PRECOND
  * Block preconditioner used to solve a saddle-point system.\n
  * Please refer to \ref cs_param_saddle_precond_t for more details.\n
@@ -1089,6 +1123,8 @@ typedef struct {
  * - "lower",
  * - "upper",
  * - "sgs" (symmetric Gauss-Seidel)
+ * - "uzawa"
+ * - "simple" (SIMPLE-like approximate block factorization)
  *
  * \var CS_EQKEY_SADDLE_RTOL
  * Relative tolerance under which the iterative process stops when solving a
@@ -1135,6 +1171,13 @@ typedef struct {
  * Level of details displayed for the resolution of a saddle-point system
  * - Examples: "0", "1", "2"
  *
+ * \var CS_EQKEY_SC_CACHE_BUDGET
+ * Memory budget in MiB to cache the cellwise systems resulting from the
+ * static condensation (CDO face-based schemes). Cells beyond this budget are
+ * always condensed. Only useful when the cellwise systems do not change from
+ * one build to another (i.e. linear problems with constant properties)
+ * - Example: "0" (default, no cache) or "512"
+ *
  * \var CS_EQKEY_SLES_VERBOSITY
  * Level of details written by the code for the resolution of the linear system
  * - Examples: "0", "1", "2" or higher
@@ -1222,6 +1265,7 @@ typedef enum {
   CS_EQKEY_SADDLE_ATOL,
   CS_EQKEY_SADDLE_AUGMENT_SCALING,
   CS_EQKEY_SADDLE_DTOL,
+  CS_EQKEY_SADDLE_MATRIX_FREE,
   CS_EQKEY_SADDLE_MAX_ITER,
   CS_EQKEY_SADDLE_PRECOND,
   CS_EQKEY_SADDLE_RTOL,
@@ -1230,6 +1274,7 @@ typedef enum {
   CS_EQKEY_SADDLE_SOLVER_CLASS,
   CS_EQKEY_SADDLE_SOLVER_RESTART,
   CS_EQKEY_SADDLE_VERBOSITY,
+  CS_EQKEY_SC_CACHE_BUDGET,
   CS_EQKEY_SLES_VERBOSITY,
   CS_EQKEY_SOLVER_FAMILY,
   CS_EQKEY_SPACE_SCHEME,
@@ -70,6 +70,42 @@ BEGIN_C_DECLS
  * Private variables
  *============================================================================*/
 
+/*============================================================================
+ * Private function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the linear algebra settings related to a strategy relying on
+ *        the block (interlaced) storage of the full system
+ *
+ * \param[in]      strategy  block SLES strategy to set
+ * \param[in, out] sysp      pointer to a cs_equation_system_param_t struct.
+ * \param[in, out] slesp     pointer to the related cs_param_sles_t struct.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_set_block_sles_strategy(cs_equation_system_sles_strategy_t   strategy,
+                         cs_equation_system_param_t          *sysp,
+                         cs_param_sles_t                     *slesp)
+{
+  sysp->sles_strategy = strategy;
+
+  slesp->solver_class = CS_PARAM_SOLVER_CLASS_CS;
+  slesp->solver = CS_PARAM_SOLVER_GCR;
+  slesp->need_flexible = true;
+
+  if (strategy == CS_EQUATION_SYSTEM_SLES_BLOCK_AMG) {
+    slesp->precond = CS_PARAM_PRECOND_AMG;
+    slesp->amg_type = CS_PARAM_AMG_INHOUSE_V;
+  }
+  else {
+    slesp->precond = CS_PARAM_PRECOND_DIAG;
+    slesp->precond_block_type = CS_PARAM_PRECOND_BLOCK_DIAG;
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -128,31 +164,18 @@ cs_equation_system_param_create(const char       *name,
   slesp->precond = CS_PARAM_PRECOND_NONE;
   slesp->solver_class = CS_PARAM_SOLVER_CLASS_MUMPS;
 #else
-#if defined(HAVE_PETSC)
-#if defined(PETSC_HAVE_MUMPS)
+#if defined(HAVE_PETSC) && defined(PETSC_HAVE_MUMPS)
   sysp->sles_strategy = CS_EQUATION_SYSTEM_SLES_MUMPS;
 
   slesp->solver = CS_PARAM_SOLVER_MUMPS;
   slesp->precond = CS_PARAM_PRECOND_NONE;
   slesp->solver_class = CS_PARAM_SOLVER_CLASS_PETSC;
 #else
-  bft_error(__FILE__, __LINE__, 0,
-            " %s: System of eq. \"%s\"\n"
-            " Error detected while initializing the linear algebra.\n"
-            " MUMPS is not available with your installation.\n"
-            " This is mandatory with this settings.\n"
-            " Please check your installation.\n",
-            __func__, name);
-#endif
-#else
-  bft_error(__FILE__, __LINE__, 0,
-            " %s: System of eq. \"%s\"\n"
-            " Error detected while initializing the linear algebra.\n"
-            " MUMPS is not available with your installation.\n"
-            " This is mandatory with this settings.\n"
-            " Please check your installation.\n",
-            __func__, name);
-#endif  /* HAVE_PETSC */
+  /* No sparse direct solver available: the full system is stored by blocks
+     and solved with an in-house iterative solver */
+
+  _set_block_sles_strategy(CS_EQUATION_SYSTEM_SLES_BLOCK_AMG, sysp, slesp);
+#endif  /* HAVE_PETSC && PETSC_HAVE_MUMPS */
 #endif  /* HAVE_MUMPS */
 
   sysp->sles_param = slesp;
@@ -215,6 +238,18 @@ cs_equation_system_param_log(const cs_equation_system_param_t    *sysp)
     cs_log_printf(CS_LOG_SETUP, "%s Strategy: Full MUMPS\n", desc);
     break;
 
+  case CS_EQUATION_SYSTEM_SLES_BLOCK_JACOBI:
+    cs_log_printf(CS_LOG_SETUP,
+                  "%s Strategy: Block storage + GCR with block Jacobi\n",
+                  desc);
+    break;
+
+  case CS_EQUATION_SYSTEM_SLES_BLOCK_AMG:
+    cs_log_printf(CS_LOG_SETUP,
+                  "%s Strategy: Block storage + GCR with block AMG\n",
+                  desc);
+    break;
+
   default:
     cs_log_printf(CS_LOG_SETUP, "%s Strategy: Unknown\n", desc);
     break;
@@ -307,11 +342,17 @@ cs_equation_system_param_set(cs_equation_system_param_t    *sysp,
 #endif  /* HAVE_PETSC */
 #endif  /* HAVE_MUMPS */
     }
+    else if (strcmp(val, "block_jacobi") == 0)
+      _set_block_sles_strategy(CS_EQUATION_SYSTEM_SLES_BLOCK_JACOBI,
+                               sysp, sysp->sles_param);
+    else if (strcmp(val, "block_amg") == 0)
+      _set_block_sles_strategy(CS_EQUATION_SYSTEM_SLES_BLOCK_AMG,
+                               sysp, sysp->sles_param);
     else {
       const char *_val = val;
       bft_error(__FILE__, __LINE__, 0,
                 " %s: Invalid val %s related to key CS_SYSKEY_SLES_STRATEGY\n"
-                " Choice between: mumps\n",
+                " Choice between: mumps, block_jacobi, block_amg\n",
                 __func__, _val);
     }
     break;
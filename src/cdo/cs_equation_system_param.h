@@ -55,11 +55,25 @@ BEGIN_C_DECLS
  *      Associated keyword: "mumps"
  *      Direct solver to solve the full (coupled) system
  *
+ * \var CS_EQUATION_SYSTEM_SLES_BLOCK_JACOBI
+ *      Associated keyword: "block_jacobi"
+ *      The full (coupled) system is stored with a dense n_eqs x n_eqs block
+ *      for each couple of DoFs and solved with a GCR Krylov solver
+ *      preconditioned by a block Jacobi (inverse of the diagonal blocks)
+ *
+ * \var CS_EQUATION_SYSTEM_SLES_BLOCK_AMG
+ *      Associated keyword: "block_amg"
+ *      The full (coupled) system is stored with a dense n_eqs x n_eqs block
+ *      for each couple of DoFs and solved with a GCR Krylov solver
+ *      preconditioned by an in-house algebraic multigrid (V-cycle) working
+ *      on the block matrix
  */
 
 typedef enum {
 
   CS_EQUATION_SYSTEM_SLES_MUMPS,
+  CS_EQUATION_SYSTEM_SLES_BLOCK_JACOBI,
+  CS_EQUATION_SYSTEM_SLES_BLOCK_AMG,
 
   CS_EQUATION_SYSTEM_N_SLES_TYPES
 
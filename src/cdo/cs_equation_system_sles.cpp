@@ -41,7 +41,10 @@
 
 #include "cs_equation_param.h"
 #include "cs_fp_exception.h"
+#include "cs_multigrid.h"
 #include "cs_param_sles.h"
+#include "cs_sles_it.h"
+#include "cs_sles_pc.h"
 
 #if defined(HAVE_MUMPS)
 #include "cs_sles_mumps.h"
@@ -207,6 +210,41 @@ cs_equation_system_sles_init(int                            n_eqs,
     }
     break;
 
+  case CS_EQUATION_SYSTEM_SLES_BLOCK_JACOBI:
+  case CS_EQUATION_SYSTEM_SLES_BLOCK_AMG:
+    {
+      /* The full system is stored with k x k blocks per vertex, so that the
+         preconditioner handles the coupling between equations */
+
+      cs_sles_it_t *itc = cs_sles_it_define(-1,
+                                            sysp->name,
+                                            CS_SLES_GCR,
+                                            -1,
+                                            sys_slesp->cvg_param.n_max_iter);
+
+      cs_sles_pc_t *pc = nullptr;
+      if (sysp->sles_strategy == CS_EQUATION_SYSTEM_SLES_BLOCK_AMG)
+        pc = cs_multigrid_pc_create(CS_MULTIGRID_V_CYCLE);
+      else
+        pc = cs_sles_pc_block_jacobi_create();
+
+      cs_sles_it_transfer_pc(itc, &pc);
+
+      /* Propagate the settings to all blocks (only to get a consistent log) */
+
+      for (int i = 0; i < n_eqs*n_eqs; i++) {
+
+        cs_param_sles_t  *slesp = blocks[i]->param->sles_param;
+
+        int  field_id = slesp->field_id;
+
+        cs_param_sles_copy_from(sys_slesp, slesp);
+        slesp->field_id = field_id;
+
+      }
+    }
+    break;
+
   default:
     bft_error(__FILE__, __LINE__, 0,
               "%s: Invalid strategy for solving the linear system \"%s\"\n",
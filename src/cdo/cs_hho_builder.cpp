@@ -33,6 +33,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <assert.h>
+#include <string.h>
 
 /*----------------------------------------------------------------------------
  * Local headers
@@ -63,6 +64,34 @@ BEGIN_C_DECLS
 
 #define CS_HHO_BUILDER_DBG  0
 
+/* Number of cell shapes kept in the cache of a builder */
+
+#define CS_HHO_BUILDER_N_SHAPES  8
+
+/* Tolerance (relative to the cell diameter) used to detect cells which are
+   congruent by translation */
+
+#define CS_HHO_BUILDER_SHAPE_TOL  1e-12
+
+/* Quantities related to a cell shape and its diffusion operator */
+
+struct _cs_hho_shape_t {
+
+  bool            is_set;
+  fvm_element_t   type;
+  short int       n_vc;
+  short int       n_ec;
+  short int       n_fc;
+
+  short int      *topo;    /* f2e_idx, f2e_ids, e2v_ids and f_sgn */
+  cs_real_t      *xv;      /* vertex coordinates relative to the cell center */
+  cs_real_33_t    tensor;  /* diffusion tensor */
+
+  int             n_dofs;
+  cs_real_t      *mat;     /* diffusion operator (n_dofs x n_dofs) */
+
+};
+
 /*============================================================================
  * Private variables
  *============================================================================*/
@@ -734,6 +763,122 @@ _compute_mcg(const cs_cell_mesh_t    *cm,
   return mcg;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if the current cell is congruent by translation to the cell
+ *         related to a cached shape and shares the same diffusion tensor
+ *
+ * \param[in]  cm       pointer to a cs_cell_mesh_t structure
+ * \param[in]  tensor   diffusion tensor in the current cell
+ * \param[in]  s        pointer to a cs_hho_shape_t structure
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_shape_match(const cs_cell_mesh_t   *cm,
+             const cs_real_t         tensor[3][3],
+             const cs_hho_shape_t   *s)
+{
+  if (!s->is_set)
+    return false;
+  if (s->type != cm->type || s->n_vc != cm->n_vc || s->n_ec != cm->n_ec ||
+      s->n_fc != cm->n_fc)
+    return false;
+
+  /* Local connectivity */
+
+  const int  n_fe = cm->f2e_idx[cm->n_fc];
+  const short int  *topo = s->topo;
+
+  if (memcmp(topo, cm->f2e_idx, (cm->n_fc + 1)*sizeof(short int)) != 0)
+    return false;
+  topo += cm->n_fc + 1;
+  if (memcmp(topo, cm->f2e_ids, n_fe*sizeof(short int)) != 0)
+    return false;
+  topo += n_fe;
+  if (memcmp(topo, cm->e2v_ids, 2*cm->n_ec*sizeof(short int)) != 0)
+    return false;
+  topo += 2*cm->n_ec;
+  if (memcmp(topo, cm->f_sgn, cm->n_fc*sizeof(short int)) != 0)
+    return false;
+
+  /* Diffusion tensor */
+
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      if (fabs(tensor[i][j] - s->tensor[i][j]) > 0.)
+        return false;
+
+  /* Vertex coordinates up to a translation */
+
+  const cs_real_t  tol = CS_HHO_BUILDER_SHAPE_TOL * cm->diam_c;
+
+  for (short int v = 0; v < cm->n_vc; v++) {
+    const cs_real_t  *xv = cm->xv + 3*v;
+    const cs_real_t  *sxv = s->xv + 3*v;
+    for (int k = 0; k < 3; k++)
+      if (fabs(xv[k] - cm->xc[k] - sxv[k]) > tol)
+        return false;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Store the shape of the current cell and its diffusion operator
+ *
+ * \param[in]      cm       pointer to a cs_cell_mesh_t structure
+ * \param[in]      tensor   diffusion tensor in the current cell
+ * \param[in]      loc      diffusion operator
+ * \param[in, out] s        pointer to a cs_hho_shape_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_shape_store(const cs_cell_mesh_t   *cm,
+             const cs_real_t         tensor[3][3],
+             const cs_sdm_t         *loc,
+             cs_hho_shape_t         *s)
+{
+  const int  n_fe = cm->f2e_idx[cm->n_fc];
+  const int  topo_size = (cm->n_fc + 1) + n_fe + 2*cm->n_ec + cm->n_fc;
+
+  s->type = cm->type;
+  s->n_vc = cm->n_vc;
+  s->n_ec = cm->n_ec;
+  s->n_fc = cm->n_fc;
+
+  BFT_REALLOC(s->topo, topo_size, short int);
+
+  short int  *topo = s->topo;
+  memcpy(topo, cm->f2e_idx, (cm->n_fc + 1)*sizeof(short int));
+  topo += cm->n_fc + 1;
+  memcpy(topo, cm->f2e_ids, n_fe*sizeof(short int));
+  topo += n_fe;
+  memcpy(topo, cm->e2v_ids, 2*cm->n_ec*sizeof(short int));
+  topo += 2*cm->n_ec;
+  memcpy(topo, cm->f_sgn, cm->n_fc*sizeof(short int));
+
+  BFT_REALLOC(s->xv, 3*cm->n_vc, cs_real_t);
+  for (short int v = 0; v < cm->n_vc; v++)
+    for (int k = 0; k < 3; k++)
+      s->xv[3*v+k] = cm->xv[3*v+k] - cm->xc[k];
+
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      s->tensor[i][j] = tensor[i][j];
+
+  assert(loc->n_rows == loc->n_cols);
+  s->n_dofs = loc->n_rows;
+  BFT_REALLOC(s->mat, s->n_dofs*s->n_dofs, cs_real_t);
+  memcpy(s->mat, loc->val, s->n_dofs*s->n_dofs*sizeof(cs_real_t));
+
+  s->is_set = true;
+}
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -808,6 +953,17 @@ cs_hho_builder_create(int     order,
     bft_error(__FILE__, __LINE__, 0,
               " %s: Polynomial order handled up to order 2.\n", __func__);
 
+  /* Cache of diffusion operators */
+  b->n_shapes = CS_HHO_BUILDER_N_SHAPES;
+  b->next_shape = 0;
+  BFT_MALLOC(b->shapes, b->n_shapes, cs_hho_shape_t);
+  for (int i = 0; i < b->n_shapes; i++) {
+    b->shapes[i].is_set = false;
+    b->shapes[i].topo = nullptr;
+    b->shapes[i].xv = nullptr;
+    b->shapes[i].mat = nullptr;
+  }
+
   return b;
 }
 
@@ -842,6 +998,14 @@ cs_hho_builder_free(cs_hho_builder_t  **p_builder)
 
   b->hdg = cs_sdm_free(b->hdg);
 
+  /* Free the cache of diffusion operators */
+  for (int i = 0; i < b->n_shapes; i++) {
+    BFT_FREE(b->shapes[i].topo);
+    BFT_FREE(b->shapes[i].xv);
+    BFT_FREE(b->shapes[i].mat);
+  }
+  BFT_FREE(b->shapes);
+
   BFT_FREE(b);
 
   *p_builder = nullptr;
@@ -1441,6 +1605,61 @@ cs_hho_builder_diffusion(const cs_cell_mesh_t      *cm,
     BFT_FREE(array);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define the diffusion operator (stored in cb->loc). If a cell which
+ *         is congruent by translation to the current one (same local
+ *         connectivity, same relative vertex coordinates and same diffusion
+ *         tensor) has been recently handled, the operator is retrieved from
+ *         the cache of the builder. Otherwise, the gradient reconstruction
+ *         and the diffusion operators are computed and the result is cached.
+ *
+ * \param[in]       cm         pointer to a cs_cell_mesh_t structure
+ * \param[in]       diff_pty   pointer to a cs_property_data_t structure
+ * \param[in, out]  cb         pointer to a cell builder_t structure
+ * \param[in, out]  hhob       pointer to a cs_hho_builder_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_cached_diffusion(const cs_cell_mesh_t      *cm,
+                                const cs_property_data_t  *diff_pty,
+                                cs_cell_builder_t         *cb,
+                                cs_hho_builder_t          *hhob)
+{
+  if (hhob == nullptr)
+    return;
+
+  for (int i = 0; i < hhob->n_shapes; i++) {
+
+    const cs_hho_shape_t  *s = hhob->shapes + i;
+
+    if (_shape_match(cm, diff_pty->tensor, s)) {
+
+      const int  fs = hhob->face_basis[0]->size;
+      for (int f = 0; f < cm->n_fc; f++)
+        cb->ids[f] = fs;
+      cb->ids[cm->n_fc] = hhob->cell_basis->size;
+
+      cs_sdm_block_init(cb->loc, cm->n_fc + 1, cm->n_fc + 1, cb->ids, cb->ids);
+
+      assert(cb->loc->n_rows == s->n_dofs);
+      memcpy(cb->loc->val, s->mat, s->n_dofs*s->n_dofs*sizeof(cs_real_t));
+
+      return;
+
+    }
+
+  } /* Loop on cached shapes */
+
+  cs_hho_builder_compute_grad_reco(cm, diff_pty, cb, hhob);
+  cs_hho_builder_diffusion(cm, diff_pty, cb, hhob);
+
+  _shape_store(cm, diff_pty->tensor, cb->loc,
+               hhob->shapes + hhob->next_shape);
+  hhob->next_shape = (hhob->next_shape + 1) % hhob->n_shapes;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the reduction onto the polynomial spaces (cell and faces)
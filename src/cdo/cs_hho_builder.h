@@ -50,6 +50,10 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* Set of cellwise quantities shared by cells which are congruent by
+   translation (opaque structure) */
+typedef struct _cs_hho_shape_t  cs_hho_shape_t;
+
 /* Cellwise builder for HHO discretization */
 typedef struct {
 
@@ -70,6 +74,13 @@ typedef struct {
   cs_sdm_t   *jstab;         /* Stabilization part related to a face */
   cs_sdm_t   *hdg;           /* Another temporary matrix */
 
+  /* Cache of diffusion operators related to the last cell shapes met. Cells
+     sharing the same local connectivity and the same vertex coordinates up
+     to a translation share the same operator */
+  int              n_shapes;
+  int              next_shape;   /* Id of the next shape to replace */
+  cs_hho_shape_t  *shapes;
+
 } cs_hho_builder_t;
 
 /*============================================================================
@@ -185,6 +196,28 @@ cs_hho_builder_diffusion(const cs_cell_mesh_t      *cm,
                          cs_cell_builder_t         *cb,
                          cs_hho_builder_t          *hhob);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define the diffusion operator (stored in cb->loc). If a cell which
+ *         is congruent by translation to the current one (same local
+ *         connectivity, same relative vertex coordinates and same diffusion
+ *         tensor) has been recently handled, the operator is retrieved from
+ *         the cache of the builder. Otherwise, the gradient reconstruction
+ *         and the diffusion operators are computed and the result is cached.
+ *
+ * \param[in]       cm         pointer to a cs_cell_mesh_t structure
+ * \param[in]       diff_pty   pointer to a cs_property_data_t structure
+ * \param[in, out]  cb         pointer to a cell builder_t structure
+ * \param[in, out]  hhob       pointer to a cs_hho_builder_t structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_hho_builder_cached_diffusion(const cs_cell_mesh_t      *cm,
+                                const cs_property_data_t  *diff_pty,
+                                cs_cell_builder_t         *cb,
+                                cs_hho_builder_t          *hhob);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute the reduction onto the polynomial spaces (cell and faces)
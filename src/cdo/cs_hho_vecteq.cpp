@@ -1228,11 +1228,10 @@ cs_hho_vecteq_build_system(const cs_mesh_t            *mesh,
 
         }
 
-        /* Define the local stiffness matrix */
-        cs_hho_builder_compute_grad_reco(cm, diff_pty, cb, hhob);
-
-        /* Local matrix owned by the cellwise builder (store in cb->loc) */
-        cs_hho_builder_diffusion(cm, diff_pty, cb, hhob);
+        /* Define the local stiffness matrix. Local matrix owned by the
+           cellwise builder (store in cb->loc). It is shared by cells which
+           are congruent by translation */
+        cs_hho_builder_cached_diffusion(cm, diff_pty, cb, hhob);
 
         /* Add the local diffusion operator to the local system */
         int n_blocks = cb->loc->block_desc->n_col_blocks;
@@ -286,6 +286,7 @@ _partial_matvec(const int         i,
   for (int irow = i; irow < n_ent; irow++) {
     const double  *restrict m_i = dq_pq->val + irow*n_ent;
     double s = 0;
+#   pragma omp simd reduction(+:s)
     for (int j = 0; j < n_ent; j++) s += m_i[j]*vec[j];
     mvec[irow] = s;
   }
@@ -339,7 +339,7 @@ _anderson_damping(cs_iter_algo_aac_t    *c,
 
     const cs_real_t  *Qj = c->Q + j*c->n_elts;  /* get row j */
 
-#   pragma omp parallel if (c->n_elts > CS_THR_MIN)
+#   pragma omp parallel for if (c->n_elts > CS_THR_MIN)
     for (cs_lnum_t l = 0; l < c->n_elts; l++)
       x[l] += omb * (Qj[l] * R_gamma - c->fold[l]);
 
@@ -1045,7 +1045,7 @@ cs_iter_algo_update_anderson(cs_iter_algo_t               *algo,
 
     /* Set fold and gold */
 
-#   pragma omp parallel if (c->n_elts > CS_THR_MIN)
+#   pragma omp parallel for if (c->n_elts > CS_THR_MIN)
     for (cs_lnum_t i = 0; i < c->n_elts; i++) {
       c->fold[i] = gcur[i] - pre_iterate[i];
       c->gold[i] = gcur[i];
@@ -1075,7 +1075,7 @@ cs_iter_algo_update_anderson(cs_iter_algo_t               *algo,
 
     /* Set dg, df, fold and gold */
 
-#   pragma omp parallel if (c->n_elts > CS_THR_MIN)
+#   pragma omp parallel for if (c->n_elts > CS_THR_MIN)
     for (cs_lnum_t i = 0; i < c->n_elts; i++) {
 
       cs_real_t  fcur = gcur[i] - pre_iterate[i];
@@ -1108,7 +1108,7 @@ cs_iter_algo_update_anderson(cs_iter_algo_t               *algo,
 
     Rval[0] = df_norm; /* R(0,0) = |df|_L2 */
 
-#   pragma omp parallel if (c->n_elts > CS_THR_MIN)
+#   pragma omp parallel for if (c->n_elts > CS_THR_MIN)
     for (cs_lnum_t i = 0; i < c->n_elts; i++)
       c->Q[i] = c->df[i]*coef; /* Q(0) = df/|df|_L2 */
 
@@ -1131,7 +1131,7 @@ cs_iter_algo_update_anderson(cs_iter_algo_t               *algo,
 
       Rval[j*m_max + (c->n_dir-1)] = prod;  /* R(j, n_dir) = Qj*df */
 
-#     pragma omp parallel if (c->n_elts > CS_THR_MIN)
+#     pragma omp parallel for if (c->n_elts > CS_THR_MIN)
       for (cs_lnum_t l = 0; l < c->n_elts; l++)
         c->df[l] -= prod*Qj[l];  /* update df = df - R(j, n_dir)*Qj */
 
@@ -1148,7 +1148,7 @@ cs_iter_algo_update_anderson(cs_iter_algo_t               *algo,
 
     cs_real_t *q_n_dir = c->Q + (c->n_dir-1)*c->n_elts;
 
-#   pragma omp parallel if (c->n_elts > CS_THR_MIN)
+#   pragma omp parallel for if (c->n_elts > CS_THR_MIN)
     for (cs_lnum_t i = 0; i < c->n_elts; i++)
       q_n_dir[i] = c->df[i]*coef;  /* Q(n_dir, :) = df/|df|_L2 */
 
@@ -1194,7 +1194,7 @@ cs_iter_algo_update_anderson(cs_iter_algo_t               *algo,
     const cs_real_t  *dg_j = c->dg + j*c->n_elts;
     const double  gamma_j = c->gamma[j];
 
-#   pragma omp parallel if (c->n_elts > CS_THR_MIN)
+#   pragma omp parallel for if (c->n_elts > CS_THR_MIN)
     for (cs_lnum_t l = 0; l < c->n_elts; l++)
       cur_iterate[l] -= gamma_j * dg_j[l];
 
@@ -303,6 +303,15 @@ cs_macfb_builder_cellwise_setup(const cs_cell_mesh_t      *cm,
   cs_adjacency_t *f2e = connect->f2e;
   assert(f2e != nullptr); /* Has to be build before */
 
+  /* Edges shared by faces of f2f_ed and edge -> faces connectivity to avoid
+     searching common edges through f2e */
+
+  const cs_lnum_t *f2f_ed_e_ids = connect->f2f_ed_e_ids;
+  assert(f2f_ed_e_ids != nullptr); /* Has to be build before */
+
+  const cs_adjacency_t *e2f = connect->e2f;
+  assert(e2f != nullptr); /* Has to be build before */
+
   /* loop on internal faces */
   for (short int f = 0; f < 6; f++) {
     const cs_lnum_t f_id = cm->f_ids[f];
@@ -354,17 +363,8 @@ cs_macfb_builder_cellwise_setup(const cs_cell_mesh_t      *cm,
       macb->f2f_ids[shift_j] = fj_id;
       macb->f2f_h[shift_j]   = cs_math_3_distance(f_c, fj_c);
 
-      /* Find common edge */
-      for (short int ej = 0; ej < 4; ej++) {
-        const cs_lnum_t ej_id = f2e->ids[f2e->idx[fj_id] + ej];
-        for (short int ei = 0; ei < 4; ei++) {
-          const cs_lnum_t ei_id = f2e->ids[f2e->idx[f_id] + ei];
-          if (ei_id == ej_id) {
-            macb->f2e_ids[shift_j] = ei_id;
-            break;
-          }
-        }
-      }
+      /* Common edge */
+      macb->f2e_ids[shift_j] = f2f_ed_e_ids[f2f_ed->idx[f_id] + fj];
 
       const cs_quant_t ei_q
         = cs_quant_get_edge_center(macb->f2e_ids[shift_j], connect, quant);
@@ -388,19 +388,14 @@ cs_macfb_builder_cellwise_setup(const cs_cell_mesh_t      *cm,
 
       /* Loop on neighbourhood faces */
       for (short int fj = 0; fj < nb_f_outer; fj++) {
-        const cs_lnum_t fj_id = f2f_ed->ids[f2f_ed->idx[f_id] + fj];
+        const cs_lnum_t ej_id = macb->f2e_ids[4 * f + fj];
 
-        /* Loop on neighbourhood faces' edges */
-        for (short int ej = 0; ej < 4; ej++) {
-          const cs_lnum_t ej_id = f2e->ids[f2e->idx[fj_id] + ej];
-
-          /* Loop on faces' edges */
-          for (short int ei = 0; ei < 4; ei++) {
-            if (ej_id == fe_id[ei]) {
-              /* Same id -> not a boundary edge */
-              fe_id[ei] = -1;
-              break;
-            }
+        /* Loop on faces' edges */
+        for (short int ei = 0; ei < 4; ei++) {
+          if (ej_id == fe_id[ei]) {
+            /* Shared edge -> not a boundary edge */
+            fe_id[ei] = -1;
+            break;
           }
         }
       }
@@ -449,18 +444,18 @@ cs_macfb_builder_cellwise_setup(const cs_cell_mesh_t      *cm,
 
       const cs_lnum_t ej_id = macb->f2e_ids[shift_j];
 
+      /* Faces sharing this edge */
+      const cs_lnum_t *e2f_ids = e2f->ids + e2f->idx[ej_id];
+      const cs_lnum_t  n_e2f   = e2f->idx[ej_id + 1] - e2f->idx[ej_id];
+
       short int n_e_find = 0;
       for (short int fk = 0; fk < macb->n_fc; fk++) {
         /* Orthogonal direction */
         if (macb->f_axis[f] != macb->f_axis[fk]) {
           const cs_lnum_t fk_id = macb->f_ids[fk];
 
-          /* Boundary edges */
-          assert(f2e->idx[fk_id + 1] - f2e->idx[fk_id] == 4);
-
-          for (short int ek = 0; ek < 4; ek++) {
-            cs_lnum_t ek_id = f2e->ids[f2e->idx[fk_id] + ek];
-            if (ej_id == ek_id) {
+          for (cs_lnum_t ek = 0; ek < n_e2f; ek++) {
+            if (e2f_ids[ek] == fk_id) {
               macb->f2fo_idx[2 * shift_j + n_e_find] = fk;
               n_e_find++;
               break;
@@ -148,6 +148,7 @@ _add_new_def(cs_property_t     *pty)
   int  new_id = pty->n_definitions;
 
   pty->n_definitions += 1;
+  pty->state_id += 1;
   BFT_REALLOC(pty->defs, pty->n_definitions, cs_xdef_t *);
   BFT_REALLOC(pty->get_eval_at_cell, pty->n_definitions,
               cs_xdef_eval_t *);
@@ -989,9 +990,223 @@ _create_property(const char           *name,
   pty->b_defs          = nullptr;
   pty->b_def_ids       = nullptr;
 
+  pty->state_id   = 0;
+  pty->cell_cache = nullptr;
+
   return pty;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if the evaluation at cells of a property can be stored in a
+ *        cache. This is the case if all its definitions (and those of its
+ *        related properties) only depend on time.
+ *
+ * \param[in]      pty        pointer to a cs_property_t structure
+ * \param[in, out] is_steady  set to false if one definition is not steady
+ *
+ * \return true or false
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_cell_cache_is_allowed(const cs_property_t   *pty,
+                       bool                  *is_steady)
+{
+  for (int i = 0; i < pty->n_related_properties; i++)
+    if (!_cell_cache_is_allowed(pty->related_properties[i], is_steady))
+      return false;
+
+  for (int def_id = 0; def_id < pty->n_definitions; def_id++) {
+
+    const cs_xdef_t  *def = pty->defs[def_id];
+
+    if (def->state & CS_FLAG_STATE_STEADY)
+      continue;
+
+    *is_steady = false;
+
+    switch (def->type) {
+
+    case CS_XDEF_BY_VALUE:
+    case CS_XDEF_BY_TIME_FUNCTION:
+    case CS_XDEF_BY_ANALYTIC_FUNCTION:
+      break;
+
+    default: /* May depend on fields or arrays modified elsewhere */
+      return false;
+
+    }
+
+  } /* Loop on definitions */
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Evaluate the value of the property at each cell (without any
+ *        usage of the cache)
+ *
+ * \param[in]      t_eval   physical time at which one evaluates the term
+ * \param[in]      pty      pointer to a cs_property_t structure
+ * \param[in, out] array    pointer to an array of values (must be allocated)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_eval_at_cells(cs_real_t               t_eval,
+               const cs_property_t    *pty,
+               cs_real_t              *array)
+{
+  const cs_cdo_quantities_t  *quant = cs_cdo_quant;
+  const cs_lnum_t  n_cells = quant->n_cells;
+
+  double  scaling_factor =
+    (pty->type & CS_PROPERTY_SCALED) ? pty->scaling_factor : 1.0;
+
+  if (pty->type & CS_PROPERTY_BY_PRODUCT) {
+
+    assert(pty->related_properties != nullptr);
+    const cs_property_t  *a = pty->related_properties[0];
+    const cs_property_t  *b = pty->related_properties[1];
+
+    if (a->type & CS_PROPERTY_SCALED)
+      scaling_factor *= a->scaling_factor;
+    if (b->type & CS_PROPERTY_SCALED)
+      scaling_factor *= b->scaling_factor;
+
+    cs_real_t *tmp_val = nullptr;
+    BFT_MALLOC(tmp_val, n_cells, cs_real_t);
+    cs_array_real_fill_zero(n_cells, tmp_val);
+
+    if (pty->type & CS_PROPERTY_ISO) {
+
+      /* 1. Evaluate the property A */
+
+      for (int def_id = 0; def_id < a->n_definitions; def_id++)
+        cs_property_evaluate_def(a,
+                                 def_id,
+                                 false, /* dense output */
+                                 t_eval,
+                                 tmp_val);
+
+      /* 2. Evaluate the property B */
+
+      for (int def_id = 0; def_id < b->n_definitions; def_id++)
+        cs_property_evaluate_def(b,
+                                 def_id,
+                                 false, /* dense output */
+                                 t_eval,
+                                 array);
+
+      /* 3. Operate the product of the two evaluations */
+
+      for (cs_lnum_t i = 0; i < n_cells; i++)
+        array[i] *= tmp_val[i];
+
+    }
+    else {
+
+      if (a->type & CS_PROPERTY_ISO) {
+
+        /* 1. Evaluate the property A */
+
+        for (int def_id = 0; def_id < a->n_definitions; def_id++)
+          cs_property_evaluate_def(a,
+                                   def_id,
+                                   false, /* dense output */
+                                   t_eval,
+                                   tmp_val);
+
+        /* 2. Evaluate the property B */
+
+        int  b_dim = cs_property_get_dim(b);
+
+        for (int def_id = 0; def_id < b->n_definitions; def_id++)
+          cs_property_evaluate_def(b,
+                                   def_id,
+                                   false, /* dense output */
+                                   t_eval,
+                                   array);
+
+        /* 3. Operate the product of the two evaluations */
+
+        for (cs_lnum_t i = 0; i < n_cells; i++) {
+          const cs_real_t  acoef = tmp_val[i];
+          cs_real_t  *_a = array + b_dim*i;
+          for (int k = 0; k < b_dim; k++)
+            _a[k] *= acoef;
+        }
+
+      }
+      else if (b->type & CS_PROPERTY_ISO) {
+
+        /* 1. Evaluate the property B */
+
+        for (int def_id = 0; def_id < b->n_definitions; def_id++)
+          cs_property_evaluate_def(b,
+                                   def_id,
+                                   false, /* dense output */
+                                   t_eval,
+                                   tmp_val);
+
+        /* 2. Evaluate the property A */
+
+        int  a_dim = cs_property_get_dim(a);
+
+        for (int def_id = 0; def_id < a->n_definitions; def_id++)
+          cs_property_evaluate_def(a,
+                                   def_id,
+                                   false, /* dense output */
+                                   t_eval,
+                                   array);
+
+        /* 3. Operate the product of the two evaluations */
+
+        for (cs_lnum_t i = 0; i < n_cells; i++) {
+          const cs_real_t  bcoef = tmp_val[i];
+          cs_real_t  *_a = array + a_dim*i;
+          for (int k = 0; k < a_dim; k++)
+            _a[k] *= bcoef;
+        }
+
+      }
+      else
+        bft_error(__FILE__, __LINE__, 0,
+                  " %s: Property \"%s\". Case not handled yet.\n",
+                  __func__, pty->name);
+
+    } /* Either a or b is an isotropic property */
+
+    BFT_FREE(tmp_val);
+
+  }
+  else { /* Simple case: One has to evaluate the property */
+
+    if ((pty->type & CS_PROPERTY_ISO) && cs_property_is_constant(pty))
+      cs_array_real_set_scalar(n_cells, pty->ref_value, array);
+
+    else {
+
+      for (int def_id = 0; def_id < pty->n_definitions; def_id++)
+        cs_property_evaluate_def(pty,
+                                 def_id,
+                                 false, /* dense output */
+                                 t_eval,
+                                 array);
+
+    }
+
+  } /* Not defined as the product of two existing properties */
+
+  /* Apply a scaling factor is requested */
+
+  if (fabs(scaling_factor - 1.0) > 10*FLT_MIN)
+    cs_array_real_scale(
+      n_cells, cs_property_get_dim(pty), nullptr, scaling_factor, array);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1235,6 +1450,15 @@ cs_property_set_option(cs_property_t       *pty,
     pty->process_flag |= CS_PROPERTY_POST_FOURIER;
     break;
 
+  case CS_PTYKEY_CELL_CACHE:
+    pty->process_flag |= CS_PROPERTY_CELL_CACHE;
+    if (pty->cell_cache == nullptr) {
+      BFT_MALLOC(pty->cell_cache, 1, cs_property_cell_cache_t);
+      pty->cell_cache->val = nullptr;
+      pty->cell_cache->is_set = false;
+    }
+    break;
+
   default:
     bft_error(__FILE__, __LINE__, 0,
               _(" Key not implemented for setting a property."));
@@ -1261,6 +1485,7 @@ cs_property_set_reference_value(cs_property_t    *pty,
     bft_error(__FILE__, __LINE__, 0, _(_err_empty_pty));
 
   pty->ref_value = refval;
+  pty->state_id += 1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1284,6 +1509,7 @@ cs_property_set_scaling_factor(cs_property_t    *pty,
 
   pty->scaling_factor = val;
   pty->type |= CS_PROPERTY_SCALED;
+  pty->state_id += 1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1306,6 +1532,7 @@ cs_property_unscale(cs_property_t    *pty)
   pty->scaling_factor = 1.0;
   if (pty->type & CS_PROPERTY_SCALED)
     pty->type -= CS_PROPERTY_SCALED;
+  pty->state_id += 1;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1349,6 +1576,11 @@ cs_property_destroy_all(void)
 
     }
 
+    if (pty->cell_cache != nullptr) {
+      BFT_FREE(pty->cell_cache->val);
+      BFT_FREE(pty->cell_cache);
+    }
+
     BFT_FREE(pty);
 
   } /* Loop on properties */
@@ -3095,152 +3327,42 @@ cs_property_eval_at_cells(cs_real_t               t_eval,
     return;
   assert(array != nullptr);
 
-  const cs_cdo_quantities_t  *quant = cs_cdo_quant;
-  const cs_lnum_t  n_cells = quant->n_cells;
-
-  double  scaling_factor =
-    (pty->type & CS_PROPERTY_SCALED) ? pty->scaling_factor : 1.0;
-
-  if (pty->type & CS_PROPERTY_BY_PRODUCT) {
-
-    assert(pty->related_properties != nullptr);
-    const cs_property_t  *a = pty->related_properties[0];
-    const cs_property_t  *b = pty->related_properties[1];
-
-    if (a->type & CS_PROPERTY_SCALED)
-      scaling_factor *= a->scaling_factor;
-    if (b->type & CS_PROPERTY_SCALED)
-      scaling_factor *= b->scaling_factor;
-
-    cs_real_t *tmp_val = nullptr;
-    BFT_MALLOC(tmp_val, n_cells, cs_real_t);
-    cs_array_real_fill_zero(n_cells, tmp_val);
-
-    if (pty->type & CS_PROPERTY_ISO) {
-
-      /* 1. Evaluate the property A */
-
-      for (int def_id = 0; def_id < a->n_definitions; def_id++)
-        cs_property_evaluate_def(a,
-                                 def_id,
-                                 false, /* dense output */
-                                 t_eval,
-                                 tmp_val);
-
-      /* 2. Evaluate the property B */
-
-      for (int def_id = 0; def_id < b->n_definitions; def_id++)
-        cs_property_evaluate_def(b,
-                                 def_id,
-                                 false, /* dense output */
-                                 t_eval,
-                                 array);
-
-      /* 3. Operate the product of the two evaluations */
-
-      for (cs_lnum_t i = 0; i < n_cells; i++)
-        array[i] *= tmp_val[i];
-
-    }
-    else {
-
-      if (a->type & CS_PROPERTY_ISO) {
-
-        /* 1. Evaluate the property A */
-
-        for (int def_id = 0; def_id < a->n_definitions; def_id++)
-          cs_property_evaluate_def(a,
-                                   def_id,
-                                   false, /* dense output */
-                                   t_eval,
-                                   tmp_val);
-
-        /* 2. Evaluate the property B */
+  cs_property_cell_cache_t  *cache = pty->cell_cache;
+  bool  is_steady = true;
 
-        int  b_dim = cs_property_get_dim(b);
+  if (cache == nullptr || !_cell_cache_is_allowed(pty, &is_steady)) {
+    _eval_at_cells(t_eval, pty, array);
+    return;
+  }
 
-        for (int def_id = 0; def_id < b->n_definitions; def_id++)
-          cs_property_evaluate_def(b,
-                                   def_id,
-                                   false, /* dense output */
-                                   t_eval,
-                                   array);
+  const cs_lnum_t  n_vals = cs_property_get_dim(pty) * cs_cdo_quant->n_cells;
 
-        /* 3. Operate the product of the two evaluations */
+  int  state_ids[3] = {pty->state_id, -1, -1};
+  for (int i = 0; i < pty->n_related_properties && i < 2; i++)
+    state_ids[i+1] = pty->related_properties[i]->state_id;
 
-        for (cs_lnum_t i = 0; i < n_cells; i++) {
-          const cs_real_t  acoef = tmp_val[i];
-          cs_real_t  *_a = array + b_dim*i;
-          for (int k = 0; k < b_dim; k++)
-            _a[k] *= acoef;
-        }
+  bool  is_valid = cache->is_set;
+  if (is_valid && !is_steady)
+    is_valid = !(fabs(t_eval - cache->t_eval) > 0.);
+  for (int i = 0; i < 3 && is_valid; i++)
+    if (state_ids[i] != cache->state_ids[i])
+      is_valid = false;
 
-      }
-      else if (b->type & CS_PROPERTY_ISO) {
-
-        /* 1. Evaluate the property B */
-
-        for (int def_id = 0; def_id < b->n_definitions; def_id++)
-          cs_property_evaluate_def(b,
-                                   def_id,
-                                   false, /* dense output */
-                                   t_eval,
-                                   tmp_val);
+  if (!is_valid) { /* Lazy update of the cached values */
 
-        /* 2. Evaluate the property A */
+    if (cache->val == nullptr)
+      BFT_MALLOC(cache->val, n_vals, cs_real_t);
 
-        int  a_dim = cs_property_get_dim(a);
+    _eval_at_cells(t_eval, pty, cache->val);
 
-        for (int def_id = 0; def_id < a->n_definitions; def_id++)
-          cs_property_evaluate_def(a,
-                                   def_id,
-                                   false, /* dense output */
-                                   t_eval,
-                                   array);
-
-        /* 3. Operate the product of the two evaluations */
-
-        for (cs_lnum_t i = 0; i < n_cells; i++) {
-          const cs_real_t  bcoef = tmp_val[i];
-          cs_real_t  *_a = array + a_dim*i;
-          for (int k = 0; k < a_dim; k++)
-            _a[k] *= bcoef;
-        }
-
-      }
-      else
-        bft_error(__FILE__, __LINE__, 0,
-                  " %s: Property \"%s\". Case not handled yet.\n",
-                  __func__, pty->name);
-
-    } /* Either a or b is an isotropic property */
-
-    BFT_FREE(tmp_val);
+    cache->is_set = true;
+    cache->t_eval = t_eval;
+    for (int i = 0; i < 3; i++)
+      cache->state_ids[i] = state_ids[i];
 
   }
-  else { /* Simple case: One has to evaluate the property */
-
-    if ((pty->type & CS_PROPERTY_ISO) && cs_property_is_constant(pty))
-      cs_array_real_set_scalar(n_cells, pty->ref_value, array);
-
-    else {
-
-      for (int def_id = 0; def_id < pty->n_definitions; def_id++)
-        cs_property_evaluate_def(pty,
-                                 def_id,
-                                 false, /* dense output */
-                                 t_eval,
-                                 array);
-
-    }
-
-  } /* Not defined as the product of two existing properties */
 
-  /* Apply a scaling factor is requested */
-
-  if (fabs(scaling_factor - 1.0) > 10*FLT_MIN)
-    cs_array_real_scale(
-      n_cells, cs_property_get_dim(pty), nullptr, scaling_factor, array);
+  cs_array_real_copy(n_vals, cache->val, array);
 }
 
 /*----------------------------------------------------------------------------*/
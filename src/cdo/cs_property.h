@@ -60,6 +60,11 @@ BEGIN_C_DECLS
 
 #define CS_PROPERTY_POST_FOURIER  (1 << 0)
 
+/*!  2: Keep the evaluation at cells in a cache and reuse it as long as
+ *      neither the evaluation time nor the settings have changed */
+
+#define CS_PROPERTY_CELL_CACHE    (1 << 1)
+
 /*! @} */
 
 /*!
@@ -127,15 +132,37 @@ typedef cs_flag_t cs_property_type_t;
  *
  * \var CS_PTYKEY_POST_FOURIER
  * Perform the computation (and post-processing) of the Fourier number
+ *
+ * \var CS_PTYKEY_CELL_CACHE
+ * Store the evaluation of the property at cells and reuse it while the
+ * evaluation time and the settings are unchanged. Steady definitions are
+ * evaluated only once. This is only effective when all definitions are
+ * steady or are given by a value, a time function or an analytic function.
  */
 
 typedef enum {
 
   CS_PTYKEY_POST_FOURIER,
+  CS_PTYKEY_CELL_CACHE,
   CS_PTYKEY_N_KEYS
 
 } cs_property_key_t;
 
+/*!
+ * \struct cs_property_cell_cache_t
+ * \brief Cache storing the evaluation of a property at cells
+ */
+
+typedef struct {
+
+  cs_real_t     *val;            /*!< cached values (size dim*n_cells) */
+  bool           is_set;         /*!< true if the cached values are set */
+  cs_real_t      t_eval;         /*!< time of the cached evaluation */
+  int            state_ids[3];   /*!< state of the property and of its
+                                   related properties at evaluation */
+
+} cs_property_cell_cache_t;
+
 /* ======================================== */
 /* Set of parameters attached to a property */
 /* ======================================== */
@@ -212,6 +239,16 @@ struct _cs_property_t {
 
   short int              *b_def_ids;
 
+  /* Counter incremented each time a setting related to the evaluation of the
+     property is modified */
+
+  int                     state_id;
+
+  /* Optional: Cache for the evaluation at cells (nullptr if the process flag
+     CS_PROPERTY_CELL_CACHE is not set) */
+
+  cs_property_cell_cache_t  *cell_cache;
+
 };
 
 /*!
@@ -2047,6 +2047,45 @@ cs_quadrature_get_tria_integral(int                   dim,
   return NULL; /* Should not go to this stage */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the function computing the quadrature points and weights
+ *         on a triangle which is consistent with the integral function
+ *         returned by \ref cs_quadrature_get_tria_integral
+ *
+ * \param[in]      qtype      quadrature type
+ * \param[out]     n_pts      number of quadrature points per triangle
+ *
+ * \return a pointer to the function computing quadrature points
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline cs_quadrature_tria_t *
+cs_quadrature_get_tria_rule(cs_quadrature_type_t   qtype,
+                            int                   *n_pts)
+{
+  switch (qtype) {
+
+  case CS_QUADRATURE_BARY:
+  case CS_QUADRATURE_BARY_SUBDIV:
+    *n_pts = 1;
+    return cs_quadrature_tria_1pt;
+  case CS_QUADRATURE_HIGHER:
+    *n_pts = 4;
+    return cs_quadrature_tria_4pts;
+  case CS_QUADRATURE_HIGHEST:
+    *n_pts = 7;
+    return cs_quadrature_tria_7pts;
+
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              " %s: Invalid quadrature type\n", __func__);
+  }
+
+  *n_pts = 0;
+  return NULL; /* Should not go to this stage */
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Retrieve the integral function according to the quadrature type
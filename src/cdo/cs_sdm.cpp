@@ -65,6 +65,220 @@ static const char _msg_small_p[]
  * Private function prototypes
  *============================================================================*/
 
+END_C_DECLS /* templates require C++ linkage */
+
+/* Largest size for which fixed-size variants are instantiated */
+
+static const int _n_fixed_max = 10;
+
+/*----------------------------------------------------------------------------
+ * Dense matrix-vector product for a small square matrix of fixed size.
+ *
+ * parameters:
+ *   mat <-- local matrix to use (N x N)
+ *   vec <-- local vector to use
+ *   mv  --> result of the local matrix-vector product
+ *----------------------------------------------------------------------------*/
+
+template <int N>
+static void
+_square_matvec(const cs_sdm_t    *mat,
+               const cs_real_t   *vec,
+               cs_real_t         *mv)
+{
+  assert(mat->n_rows == N && mat->n_cols == N);
+
+  const cs_real_t  *m = mat->val;
+
+  for (int i = 0; i < N; i++) {
+    cs_real_t  s = m[i*N] * vec[0];
+    for (int j = 1; j < N; j++)
+      s += m[i*N + j] * vec[j];
+    mv[i] = s;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * LDL^T factorization of a symmetric matrix of fixed size.
+ *
+ * The storage of the factorization is the same as for
+ * cs_sdm_ldlt_compute.
+ *
+ * parameters:
+ *   m     <-- small dense matrix to factorize (N x N)
+ *   facto --> lower triangular matrix, with inverse of pivots on diagonal
+ *   dkk   --> pivots (work array)
+ *----------------------------------------------------------------------------*/
+
+template <int N>
+static void
+_ldlt_compute(const cs_sdm_t     *m,
+              cs_real_t          *facto,
+              cs_real_t          *dkk)
+{
+  assert(m->n_rows == N && m->n_cols == N);
+
+  const cs_real_t  *a = m->val;
+
+  int  rowj_idx = 0;
+
+  for (int j = 0; j < N; j++) {
+
+    rowj_idx += j;
+
+    /* d_jj = a_jj - \sum_{k=0}^{j-1} l_jk^2 * d_kk */
+
+    const cs_real_t  *l_j = facto + rowj_idx;
+
+    cs_real_t  sum = 0.;
+    for (int k = 0; k < j; k++)
+      sum += l_j[k]*l_j[k] * dkk[k];
+    const cs_real_t  djj = dkk[j] = a[j*N + j] - sum;
+
+    if (fabs(djj) < cs_math_zero_threshold)
+      bft_error(__FILE__, __LINE__, 0, _msg_small_p, "cs_sdm_ldlt_compute");
+
+    const cs_real_t  inv_djj = facto[rowj_idx + j] = 1. / djj;
+
+    /* l_ij = (a_ij - \sum_{k=0}^{j-1} l_ik * d_kk * l_jk ) / d_jj */
+
+    int  rowi_idx = rowj_idx;
+    for (int i = j+1; i < N; i++) {
+
+      rowi_idx += i;
+      cs_real_t  *l_i = facto + rowi_idx;
+      sum = 0.;
+      for (int k = 0; k < j; k++)
+        sum += l_i[k] * dkk[k] * l_j[k];
+      l_i[j] = (a[j*N + i] - sum) * inv_djj;
+
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Solve a system using a LDL^T factorization of fixed size.
+ *
+ * parameters:
+ *   n_rows <-- number of rows (N)
+ *   facto  <-- factorization built with _ldlt_compute
+ *   rhs    <-- right-hand side
+ *   sol    --> solution
+ *----------------------------------------------------------------------------*/
+
+template <int N>
+static void
+_ldlt_solve(int                n_rows,
+            const cs_real_t   *facto,
+            const cs_real_t   *rhs,
+            cs_real_t         *sol)
+{
+  assert(n_rows == N);
+  CS_NO_WARN_IF_UNUSED(n_rows);
+
+  /* Forward substitution: z_i = b_i - \sum_{k=0}^{i-1} l_ik * z_k */
+
+  sol[0] = rhs[0];
+
+  int  rowi_idx = 0;
+  for (int i = 1; i < N; i++) {
+    rowi_idx += i;
+    const cs_real_t  *l_i = facto + rowi_idx;
+    cs_real_t  sum = 0.;
+    for (int k = 0; k < i; k++)
+      sum += sol[k] * l_i[k];
+    sol[i] = rhs[i] - sum;
+  }
+
+  /* Backward substitution: x_i = z_i/d_ii - \sum_{k=i+1}^{n} l_ki * x_k */
+
+  const int  shift = N*(N-1)/2;
+  int  diagi_idx = shift + N - 1;
+  sol[N-1] *= facto[diagi_idx];
+
+  for (int i = N-2; i >= 0; i--) {
+
+    diagi_idx -= (i+2);
+    sol[i] *= facto[diagi_idx];
+
+    int  rowk_idx = shift;
+    cs_real_t  sum = 0.0;
+    for (int k = N-1; k > i; k--) {
+      sum += facto[rowk_idx + i] * sol[k];
+      rowk_idx -= k;
+    }
+    sol[i] -= sum;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Row-row product c += a.b^T of square matrices of fixed size.
+ *
+ * parameters:
+ *   a <-- local matrix to use (N x N)
+ *   b <-- local matrix to use (N x N)
+ *   c <-> result of the local matrix-product (N x N)
+ *----------------------------------------------------------------------------*/
+
+template <int N>
+static void
+_multiply_rowrow(const cs_sdm_t   *a,
+                 const cs_sdm_t   *b,
+                 cs_sdm_t         *c)
+{
+  const cs_real_t  *av = a->val, *bv = b->val;
+  cs_real_t  *cv = c->val;
+
+  for (int i = 0; i < N; i++) {
+    for (int j = 0; j < N; j++) {
+      cs_real_t  dp = 0;
+      for (int k = 0; k < N; k++)
+        dp += av[i*N + k] * bv[j*N + k];
+      cv[i*N + j] += dp;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a matrix is a 3x3 matrix.
+ *
+ * parameters:
+ *   m <-- local matrix
+ *
+ * returns:
+ *   true if the matrix has 3 rows and 3 columns
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_is_square_33(const cs_sdm_t  *m)
+{
+  return (m->n_rows == 3 && m->n_cols == 3);
+}
+
+/* Dispatch tables for fixed-size variants, indexed by size */
+
+static cs_sdm_matvec_t  *const _square_matvec_funcs[] = {
+  nullptr, nullptr,
+  _square_matvec<2>, _square_matvec<3>, _square_matvec<4>,
+  _square_matvec<5>, _square_matvec<6>, _square_matvec<7>,
+  _square_matvec<8>, _square_matvec<9>, _square_matvec<10>};
+
+static cs_sdm_ldlt_compute_t  *const _ldlt_compute_funcs[] = {
+  nullptr, nullptr,
+  _ldlt_compute<2>, _ldlt_compute<3>, _ldlt_compute<4>,
+  _ldlt_compute<5>, _ldlt_compute<6>, _ldlt_compute<7>,
+  _ldlt_compute<8>, _ldlt_compute<9>, _ldlt_compute<10>};
+
+static cs_sdm_ldlt_solve_t  *const _ldlt_solve_funcs[] = {
+  nullptr, nullptr,
+  _ldlt_solve<2>, _ldlt_solve<3>, _ldlt_solve<4>,
+  _ldlt_solve<5>, _ldlt_solve<6>, _ldlt_solve<7>,
+  _ldlt_solve<8>, _ldlt_solve<9>, _ldlt_solve<10>};
+
+BEGIN_C_DECLS
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Generic way to allocate a cs_sdm_t structure
@@ -742,7 +956,10 @@ cs_sdm_block_multiply_rowrow(const cs_sdm_t   *a,
         cs_sdm_t  *aIK = cs_sdm_get_block(a, i, k);
         cs_sdm_t  *bJK = cs_sdm_get_block(b, j, k);
 
-        cs_sdm_multiply_rowrow(aIK, bJK, cIJ);
+        if (_is_square_33(aIK) && _is_square_33(bJK))
+          _multiply_rowrow<3>(aIK, bJK, cIJ);
+        else
+          cs_sdm_multiply_rowrow(aIK, bJK, cIJ);
 
       } /* Loop on common blocks between a and b */
     } /* Loop on b row blocks */
@@ -795,7 +1012,10 @@ cs_sdm_block_multiply_rowrow_sym(const cs_sdm_t   *a,
         cs_sdm_t  *aIK = cs_sdm_get_block(a, i, k);
         cs_sdm_t  *bJK = cs_sdm_get_block(b, j, k);
 
-        cs_sdm_multiply_rowrow(aIK, bJK, cIJ);
+        if (_is_square_33(aIK) && _is_square_33(bJK))
+          _multiply_rowrow<3>(aIK, bJK, cIJ);
+        else
+          cs_sdm_multiply_rowrow(aIK, bJK, cIJ);
 
       } /* Loop on common blocks between a and b */
 
@@ -829,6 +1049,11 @@ cs_sdm_square_matvec(const cs_sdm_t    *mat,
 
   const int  n = mat->n_rows;
 
+  if (n > 1 && n <= _n_fixed_max) {
+    _square_matvec_funcs[n](mat, vec, mv);
+    return;
+  }
+
   /* Initialize mv */
 
   const cs_real_t  v = vec[0];
@@ -1826,6 +2051,10 @@ cs_sdm_ldlt_compute(const cs_sdm_t     *m,
     facto[0] = 1. / m->val[0];
     return;
   }
+  else if (n <= _n_fixed_max) {
+    _ldlt_compute_funcs[n](m, facto, dkk);
+    return;
+  }
 
   int  rowj_idx = 0;
 
@@ -2040,6 +2269,10 @@ cs_sdm_ldlt_solve(int                n_rows,
     sol[0] = rhs[0] * facto[0];
     return;
   }
+  else if (n_rows <= _n_fixed_max) {
+    _ldlt_solve_funcs[n_rows](n_rows, facto, rhs, sol);
+    return;
+  }
 
   /* 1 - Solving Lz = b with forward substitution :
    *     z_i = b_i - \sum_{k=0}^{i-1} l_ik * z_k
@@ -2087,6 +2320,72 @@ cs_sdm_ldlt_solve(int                n_rows,
   } /* backward substitution */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get the matrix-vector product function best suited to square
+ *         matrices of a given size.
+ *
+ * Fixed-size variants are used for small sizes, so that loops may be
+ * unrolled. Selecting the function once (for example when the cell
+ * system is built) avoids a size test at each call.
+ *
+ * \param[in]  n   number of rows (and columns)
+ *
+ * \return  pointer to matrix-vector product function
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sdm_matvec_t *
+cs_sdm_get_square_matvec(int  n)
+{
+  if (n > 1 && n <= _n_fixed_max)
+    return _square_matvec_funcs[n];
+
+  return cs_sdm_square_matvec;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get the L.D.L^T factorization function best suited to square
+ *         matrices of a given size.
+ *
+ * The factorization uses the same storage as \ref cs_sdm_ldlt_compute.
+ *
+ * \param[in]  n   number of rows (and columns)
+ *
+ * \return  pointer to factorization function
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sdm_ldlt_compute_t *
+cs_sdm_get_ldlt_compute(int  n)
+{
+  if (n > 1 && n <= _n_fixed_max)
+    return _ldlt_compute_funcs[n];
+
+  return cs_sdm_ldlt_compute;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get the L.D.L^T solve function best suited to systems
+ *         of a given size.
+ *
+ * \param[in]  n   number of rows
+ *
+ * \return  pointer to solve function
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sdm_ldlt_solve_t *
+cs_sdm_get_ldlt_solve(int  n)
+{
+  if (n > 1 && n <= _n_fixed_max)
+    return _ldlt_solve_funcs[n];
+
+  return cs_sdm_ldlt_solve;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Test if a matrix is symmetric. Return 0. if the extradiagonal
@@ -128,6 +128,39 @@ typedef void
                   const cs_real_t   *vec,
                   cs_real_t         *mv);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Generic prototype for computing a L.D.L^T factorization
+ *
+ * \param[in]      m      small dense matrix to factorize
+ * \param[in, out] facto  vector of the coefficients of the decomposition
+ * \param[in, out] dkk    store temporary the diagonal (size = n_rows)
+ */
+/*----------------------------------------------------------------------------*/
+
+typedef void
+(cs_sdm_ldlt_compute_t)(const cs_sdm_t     *m,
+                        cs_real_t          *facto,
+                        cs_real_t          *dkk);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Generic prototype for solving a system using a L.D.L^T
+ *        factorization
+ *
+ * \param[in]       n_rows   dimension of the system to solve
+ * \param[in]       facto    vector of the coefficients of the decomposition
+ * \param[in]       rhs      right-hand side
+ * \param[in, out]  sol      solution
+ */
+/*----------------------------------------------------------------------------*/
+
+typedef void
+(cs_sdm_ldlt_solve_t)(int                n_rows,
+                      const cs_real_t   *facto,
+                      const cs_real_t   *rhs,
+                      cs_real_t         *sol);
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -1264,6 +1297,54 @@ cs_sdm_ldlt_solve(int                n_rows,
                   const cs_real_t   *rhs,
                   cs_real_t         *sol);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get the matrix-vector product function best suited to square
+ *         matrices of a given size.
+ *
+ * Fixed-size variants are used for small sizes, so that loops may be
+ * unrolled. Selecting the function once (for example when the cell
+ * system is built) avoids a size test at each call.
+ *
+ * \param[in]  n   number of rows (and columns)
+ *
+ * \return  pointer to matrix-vector product function
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sdm_matvec_t *
+cs_sdm_get_square_matvec(int  n);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get the L.D.L^T factorization function best suited to square
+ *         matrices of a given size.
+ *
+ * The factorization uses the same storage as \ref cs_sdm_ldlt_compute.
+ *
+ * \param[in]  n   number of rows (and columns)
+ *
+ * \return  pointer to factorization function
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sdm_ldlt_compute_t *
+cs_sdm_get_ldlt_compute(int  n);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Get the L.D.L^T solve function best suited to systems
+ *         of a given size.
+ *
+ * \param[in]  n   number of rows
+ *
+ * \return  pointer to solve function
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sdm_ldlt_solve_t *
+cs_sdm_get_ldlt_solve(int  n);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Test if a matrix is symmetric. Return 0. if the extradiagonal
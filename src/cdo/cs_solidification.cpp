@@ -215,6 +215,46 @@ _which_state(const cs_solidification_binary_alloy_t     *alloy,
   }   /* liquidus */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Check if a cell is far enough from the solidification front so
+ *         that its liquid fraction and its thermal source term do not need
+ *         any update. This is the case for fully liquid (resp. solid) cells
+ *         which remain liquid (resp. solid) when the temperature is shifted
+ *         by the margin. Solid cells are considered only below the eutectic
+ *         concentration (eta is then constant).
+ *
+ * \param[in]  alloy    pointer to a binary alloy structure
+ * \param[in]  margin   temperature margin
+ * \param[in]  temp     value of the temperature
+ * \param[in]  conc     value of the bulk concentration
+ * \param[in]  gliq     value of the liquid fraction
+ * \param[in]  eta      value of the eta coefficient
+ *
+ * \return true if the cell is far from the front
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+_is_far_from_front(const cs_solidification_binary_alloy_t     *alloy,
+                   const cs_real_t                             margin,
+                   const cs_real_t                             temp,
+                   const cs_real_t                             conc,
+                   const cs_real_t                             gliq,
+                   const cs_real_t                             eta)
+{
+  if (gliq >= 1 && fabs(eta - 1) < FLT_MIN)
+    return (_which_state(alloy, temp - margin, conc)
+            == CS_SOLIDIFICATION_STATE_LIQUID);
+
+  else if (gliq <= 0 && conc < alloy->cs1
+           && fabs(eta - alloy->inv_kp) < FLT_MIN)
+    return (_which_state(alloy, temp + margin, conc)
+            == CS_SOLIDIFICATION_STATE_SOLID);
+
+  return false;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Determine in which state is a tuple (temp, conc, gl) from the
@@ -1689,7 +1729,13 @@ _update_gl_taylor(const cs_mesh_t             *mesh,
   /* Update g_l values in each cell as well as the cell state and the related
      count */
 
-  for (cs_lnum_t  c_id = 0; c_id < quant->n_cells; c_id++) {
+  const cs_lnum_t  *front_ids = alloy->front_cell_ids;
+  const cs_lnum_t  n_elts =
+    (alloy->n_front_cells < 0) ? quant->n_cells : alloy->n_front_cells;
+
+  for (cs_lnum_t  i = 0; i < n_elts; i++) {
+
+    const cs_lnum_t  c_id = (alloy->n_front_cells < 0) ? i : front_ids[i];
 
     if (connect->cell_flag[c_id] & CS_FLAG_SOLID_CELL)
       continue; /* No update */
@@ -1890,7 +1936,13 @@ _update_thm_taylor(const cs_mesh_t             *mesh,
   const cs_real_t  rhoLovdt = rhoL/ts->dt[0];
   const double  cpovL = solid->cp->ref_value/solid->latent_heat;
 
-  for (cs_lnum_t  c_id = 0; c_id < quant->n_cells; c_id++) {
+  const cs_lnum_t  *front_ids = alloy->front_cell_ids;
+  const cs_lnum_t  n_elts =
+    (alloy->n_front_cells < 0) ? quant->n_cells : alloy->n_front_cells;
+
+  for (cs_lnum_t  i = 0; i < n_elts; i++) {
+
+    const cs_lnum_t  c_id = (alloy->n_front_cells < 0) ? i : front_ids[i];
 
     if (connect->cell_flag[c_id] & CS_FLAG_SOLID_CELL)
       continue; /* No update */
@@ -2017,7 +2069,13 @@ _update_gl_binary_path(const cs_mesh_t             *mesh,
   /* Update g_l values in each cell as well as the cell state and the related
      count */
 
-  for (cs_lnum_t  c_id = 0; c_id < quant->n_cells; c_id++) {
+  const cs_lnum_t  *front_ids = alloy->front_cell_ids;
+  const cs_lnum_t  n_elts =
+    (alloy->n_front_cells < 0) ? quant->n_cells : alloy->n_front_cells;
+
+  for (cs_lnum_t  i = 0; i < n_elts; i++) {
+
+    const cs_lnum_t  c_id = (alloy->n_front_cells < 0) ? i : front_ids[i];
 
     if (connect->cell_flag[c_id] & CS_FLAG_SOLID_CELL)
       continue; /* No update */
@@ -2379,7 +2437,13 @@ _update_thm_binary_path(const cs_mesh_t             *mesh,
   const cs_real_t  rhoL = solid->mass_density->ref_value * solid->latent_heat;
   const cs_real_t  rhoLovdt = rhoL/ts->dt[0];
 
-  for (cs_lnum_t  c_id = 0; c_id < quant->n_cells; c_id++) {
+  const cs_lnum_t  *front_ids = alloy->front_cell_ids;
+  const cs_lnum_t  n_elts =
+    (alloy->n_front_cells < 0) ? quant->n_cells : alloy->n_front_cells;
+
+  for (cs_lnum_t  i = 0; i < n_elts; i++) {
+
+    const cs_lnum_t  c_id = (alloy->n_front_cells < 0) ? i : front_ids[i];
 
     if (connect->cell_flag[c_id] & CS_FLAG_SOLID_CELL)
       continue; /* No update */
@@ -3006,6 +3070,59 @@ _voller_non_linearities(const cs_mesh_t              *mesh,
   cs_parall_sum(CS_SOLIDIFICATION_N_STATES, CS_GNUM_TYPE, solid->n_g_cells);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build the list of cells close to the solidification front for a
+ *         binary alloy. Only these cells are updated during the next
+ *         sub-iteration. A cell is kept out of the list if it is far from the
+ *         front at the previous time step and at the current iterate. The
+ *         thermal source term is then reset in such cells.
+ *
+ * \param[in]      connect   pointer to a cs_cdo_connect_t structure
+ * \param[in]      quant     pointer to a cs_cdo_quantities_t structure
+ * \param[in, out] solid     pointer to the solidification structure
+ * \param[in, out] alloy     pointer to a binary alloy structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_build_front_cells(const cs_cdo_connect_t             *connect,
+                   const cs_cdo_quantities_t          *quant,
+                   cs_solidification_t                *solid,
+                   cs_solidification_binary_alloy_t   *alloy)
+{
+  const cs_real_t  margin = fmax(alloy->front_margin, alloy->delta_tolerance);
+
+  const cs_real_t  *c_bulk = alloy->c_bulk->val;
+  const cs_real_t  *c_bulk_pre = alloy->c_bulk->val_pre;
+  const cs_real_t  *t_bulk = solid->temperature->val;
+  const cs_real_t  *t_bulk_pre = solid->temperature->val_pre;
+  const cs_real_t  *g_l = solid->g_l_field->val;
+  const cs_real_t  *g_l_pre = solid->g_l_field->val_pre;
+  const cs_real_t  *eta = alloy->eta_coef_array;
+
+  cs_lnum_t  n_front_cells = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+
+    if (connect->cell_flag[c_id] & CS_FLAG_SOLID_CELL)
+      continue; /* Never updated */
+
+    if (   _is_far_from_front(alloy, margin, t_bulk_pre[c_id], c_bulk_pre[c_id],
+                              g_l_pre[c_id], eta[c_id])
+        && _is_far_from_front(alloy, margin, t_bulk[c_id], c_bulk[c_id],
+                              g_l[c_id], eta[c_id])) {
+      solid->thermal_reaction_coef_array[c_id] = 0;
+      solid->thermal_source_term_array[c_id] = 0;
+    }
+    else
+      alloy->front_cell_ids[n_front_cells++] = c_id;
+
+  } /* Loop on cells */
+
+  alloy->n_front_cells = n_front_cells;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Function aims at computing the new temperature/bulk concentration
@@ -3072,6 +3189,12 @@ _default_binary_coupling(const cs_mesh_t           *mesh,
   cs_array_real_copy(quant->n_cells, temp, alloy->tk_bulk);
   cs_array_real_copy(quant->n_cells, conc, alloy->ck_bulk);
 
+  /* Restrict the updates to the cells close to the solidification front if
+     requested */
+
+  if (alloy->front_margin > 0)
+    _build_front_cells(connect, quant, solid, alloy);
+
   cs_real_t  delta_temp = 1 + alloy->delta_tolerance;
   cs_real_t  delta_cbulk = 1 + alloy->delta_tolerance;
 
@@ -3133,6 +3256,11 @@ _default_binary_coupling(const cs_mesh_t           *mesh,
 
     } /* Loop on cells */
 
+    /* Update the set of cells close to the front with the new iterate */
+
+    if (alloy->front_margin > 0)
+      _build_front_cells(connect, quant, solid, alloy);
+
     /* Parallel synchronization */
 
     if (cs_glob_n_ranks > 1) {
@@ -3156,6 +3284,8 @@ _default_binary_coupling(const cs_mesh_t           *mesh,
 
   } /* while iterating */
 
+  alloy->n_front_cells = -1; /* Next updates are performed on all cells */
+
   /* Update the liquid concentration of the solute (c_l) */
 
   alloy->update_clc(mesh, connect, quant, time_step);
@@ -3513,6 +3643,12 @@ cs_solidification_activate(cs_solidification_model_t       model,
       b_model->eta_relax       = 0.;
       b_model->gliq_relax      = 0.;
 
+      /* No restriction of the updates to the solidification front */
+
+      b_model->front_margin   = -1;
+      b_model->n_front_cells  = -1;
+      b_model->front_cell_ids = nullptr;
+
       /* Strategy to perform the main steps of the simulation of a binary alloy
        * Default strategy: Taylor which corresponds to the Legacy one with
        * improvements thanks to some Taylor expansions */
@@ -4264,6 +4400,7 @@ cs_solidification_destroy_all(void)
       BFT_FREE(alloy->eta_coef_array);
       BFT_FREE(alloy->tk_bulk);
       BFT_FREE(alloy->ck_bulk);
+      BFT_FREE(alloy->front_cell_ids);
 
       if (solid->options & CS_SOLIDIFICATION_USE_EXTRAPOLATION) {
         BFT_FREE(alloy->tx_bulk);
@@ -4599,6 +4736,9 @@ cs_solidification_finalize_setup(const cs_cdo_connect_t       *connect,
     BFT_MALLOC(alloy->tk_bulk, n_cells, cs_real_t);
     BFT_MALLOC(alloy->ck_bulk, n_cells, cs_real_t);
 
+    if (alloy->front_margin > 0)
+      BFT_MALLOC(alloy->front_cell_ids, n_cells, cs_lnum_t);
+
     if (solid->options & CS_SOLIDIFICATION_USE_EXTRAPOLATION) {
       BFT_MALLOC(alloy->tx_bulk, n_cells, cs_real_t);
       BFT_MALLOC(alloy->cx_bulk, n_cells, cs_real_t);
@@ -4863,6 +5003,11 @@ cs_solidification_log_setup(void)
                       " n_iter_max %d; tolerance: %.3e\n",
                       module, alloy->n_iter_max, alloy->delta_tolerance);
 
+      if (alloy->front_margin > 0)
+        cs_log_printf(CS_LOG_SETUP, "  * %s | Options: Updates restricted to"
+                      " the solidification front; margin: %.3e\n",
+                      module, alloy->front_margin);
+
     } /* Binary alloy */
 
   default:
@@ -440,6 +440,25 @@ typedef struct {
   double                        eta_relax;
   double                        gliq_relax;
 
+  /* Restriction of the updates performed during the sub-iterations to the
+   * cells close to the solidification front (active set of cells)
+   *
+   * front_margin: temperature margin with respect to the liquidus and the
+   * solidus temperatures. Fully liquid (resp. solid) cells whose temperature
+   * remains above the liquidus (resp. below the solidus) temperature with
+   * this margin do not need any update of the liquid fraction or of the
+   * thermal source term. If front_margin <= 0 (default), all cells are
+   * updated. Otherwise, the margin is at least equal to delta_tolerance.
+   *
+   * n_front_cells: number of cells in front_cell_ids or -1 when all cells
+   *                are considered
+   * front_cell_ids: list of cells to update
+   */
+
+  double                        front_margin;
+  cs_lnum_t                     n_front_cells;
+  cs_lnum_t                    *front_cell_ids;
+
   /* During the non-linear iteration process one needs:
    *  temp_{n}         --> stored in field->val_pre
    *  temp_{n+1}^k     --> stored in tk_bulk (in this structure)
@@ -31,6 +31,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <assert.h>
+#include <math.h>
 #include <string.h>
 
 /*----------------------------------------------------------------------------
@@ -73,6 +74,151 @@ BEGIN_C_DECLS
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Create a cache for the cellwise systems resulting from a static
+ *          condensation. The number of cached cells is limited by the given
+ *          memory budget; other cells are always condensed.
+ *
+ * \param[in] c2x          pointer to a cs_adjacency_t structure
+ * \param[in] stride       1 (scalar-valued) or 3 (vector-valued)
+ * \param[in] budget_mib   memory budget in MiB (no cache if <= 0)
+ *
+ * \return a pointer to the new structure or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_static_condensation_cache_t *
+cs_static_condensation_cache_create(const cs_adjacency_t  *c2x,
+                                    int                    stride,
+                                    double                 budget_mib)
+{
+  if (c2x == nullptr || budget_mib <= 0)
+    return nullptr;
+
+  assert(stride == 1 || stride == 3);
+
+  const cs_lnum_t  n_cells = c2x->n_elts;
+  const double  budget = budget_mib * 1024. * 1024.;
+
+  /* Cells are cached following their numbering until the budget is
+     reached. Remaining cells are always condensed */
+
+  cs_lnum_t  n_cached_cells = 0;
+  double  mem = 0.;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    const cs_lnum_t  n_xc = c2x->idx[c_id+1] - c2x->idx[c_id];
+    const double  cell_mem =
+      (stride*stride*n_xc*n_xc + stride*(n_xc + 1))*sizeof(cs_real_t)
+      + sizeof(cs_lnum_t);
+
+    if (mem + cell_mem > budget)
+      break;
+
+    mem += cell_mem;
+    n_cached_cells++;
+
+  }
+
+  if (n_cached_cells == 0)
+    return nullptr;
+
+  cs_static_condensation_cache_t  *cache = nullptr;
+
+  BFT_MALLOC(cache, 1, cs_static_condensation_cache_t);
+
+  cache->stride = stride;
+  cache->n_cached_cells = n_cached_cells;
+  cache->is_filled = false;
+  cache->use_cache = false;
+  cache->key = 0.;
+
+  BFT_MALLOC(cache->mat_idx, n_cached_cells + 1, cs_lnum_t);
+
+  cache->mat_idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cached_cells; c_id++) {
+    const cs_lnum_t  n_xc = c2x->idx[c_id+1] - c2x->idx[c_id];
+    cache->mat_idx[c_id+1] = cache->mat_idx[c_id] + stride*stride*n_xc*n_xc;
+  }
+
+  BFT_MALLOC(cache->mat_val, cache->mat_idx[n_cached_cells], cs_real_t);
+  BFT_MALLOC(cache->inv_acc, stride*n_cached_cells, cs_real_t);
+  BFT_MALLOC(cache->axc, stride*c2x->idx[n_cached_cells], cs_real_t);
+
+  return cache;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Free a cs_static_condensation_cache_t structure
+ *
+ * \param[in, out] p_cache    double pointer to the structure to free
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_static_condensation_cache_free(cs_static_condensation_cache_t  **p_cache)
+{
+  cs_static_condensation_cache_t  *cache = *p_cache;
+
+  if (cache == nullptr)
+    return;
+
+  BFT_FREE(cache->mat_idx);
+  BFT_FREE(cache->mat_val);
+  BFT_FREE(cache->inv_acc);
+  BFT_FREE(cache->axc);
+
+  BFT_FREE(cache);
+  *p_cache = nullptr;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Start a new build of the cellwise systems. Cached systems are used
+ *          only if they have all been set during a previous build with the
+ *          same key. Do nothing if the cache is not allocated.
+ *
+ * \param[in, out] cache    pointer to the cache structure or nullptr
+ * \param[in]      key      value identifying the cellwise systems
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_static_condensation_cache_start(cs_static_condensation_cache_t  *cache,
+                                   double                           key)
+{
+  if (cache == nullptr)
+    return;
+
+  cache->use_cache = cache->is_filled && !(fabs(key - cache->key) > 0.);
+
+  if (!cache->use_cache) { /* Cached systems are rebuilt */
+    cache->is_filled = false;
+    cache->key = key;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Finalize a build of the cellwise systems. All cached cells have
+ *          been set. Do nothing if the cache is not allocated.
+ *
+ * \param[in, out] cache    pointer to the cache structure or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_static_condensation_cache_end(cs_static_condensation_cache_t  *cache)
+{
+  if (cache == nullptr)
+    return;
+
+  cache->is_filled = true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Proceed to a static condensation of the local system and store
@@ -140,6 +286,79 @@ cs_static_condensation_scalar_eq(const cs_adjacency_t    *c2x,
   } /* Loop on vi cell entities */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Same as \ref cs_static_condensation_scalar_eq but relying on a
+ *          cache. If the cellwise system of the current cell is cached and
+ *          the cache is in use, only the right-hand side is reduced and the
+ *          condensed matrix is copied from the cache. Otherwise, the static
+ *          condensation is performed and the cache is updated.
+ *
+ * \param[in]      c2x         pointer to a cs_adjacency_t structure
+ * \param[in, out] cache       pointer to a cache structure or nullptr
+ * \param[in, out] rc_tilda    pointer to the rhs related to cell DoFs (Acc-1
+ * \param[in, out] acx_tilda   pointer to an unrolled matrix Acc^-1 * Acx
+ * \param[in, out] cb          pointer to a cs_cell_builder_t structure
+ * \param[in, out] csys        pointer to a cs_cell_sys_t structure to update
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_static_condensation_scalar_cached(const cs_adjacency_t           *c2x,
+                                     cs_static_condensation_cache_t *cache,
+                                     cs_real_t                      *rc_tilda,
+                                     cs_real_t                      *acx_tilda,
+                                     cs_cell_builder_t              *cb,
+                                     cs_cell_sys_t                  *csys)
+{
+  const cs_lnum_t  c_id = csys->c_id;
+
+  if (cache == nullptr || c_id >= cache->n_cached_cells) {
+    cs_static_condensation_scalar_eq(c2x, rc_tilda, acx_tilda, cb, csys);
+    return;
+  }
+
+  assert(cache->stride == 1);
+
+  const int  n_dofs = csys->n_dofs;
+  const int  n_xc = n_dofs - 1;
+
+  assert(n_xc == c2x->idx[c_id+1] - c2x->idx[c_id]);
+
+  cs_real_t  *axc = cache->axc + c2x->idx[c_id];
+  cs_real_t  *mat_val = cache->mat_val + cache->mat_idx[c_id];
+
+  if (cache->use_cache) {
+
+    /* Only the reduction of the RHS is performed. acx_tilda is unchanged
+       since the cellwise system is unchanged */
+
+    const cs_real_t  rc = cache->inv_acc[c_id] * csys->rhs[n_xc];
+
+    rc_tilda[c_id] = rc;
+    for (short int i = 0; i < n_xc; i++)
+      csys->rhs[i] -= rc * axc[i];
+
+    csys->n_dofs = n_xc;
+    csys->mat->n_rows = csys->mat->n_cols = n_xc;
+    memcpy(csys->mat->val, mat_val, n_xc*n_xc*sizeof(cs_real_t));
+
+    return;
+  }
+
+  /* Store the quantities needed to reduce the RHS */
+
+  const double  *mval = csys->mat->val;
+
+  cache->inv_acc[c_id] = 1./mval[n_dofs*n_xc + n_xc];
+  for (int i = 0; i < n_xc; i++)
+    axc[i] = mval[n_dofs*i + n_xc];
+
+  cs_static_condensation_scalar_eq(c2x, rc_tilda, acx_tilda, cb, csys);
+
+  memcpy(mat_val, csys->mat->val, n_xc*n_xc*sizeof(cs_real_t));
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Opposite process of the static condensation.
@@ -291,6 +510,103 @@ cs_static_condensation_vector_eq(const cs_adjacency_t    *c2x,
   bd->n_col_blocks = n_xc;      /* instead of n_xc + 1 */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Same as \ref cs_static_condensation_vector_eq but relying on a
+ *          cache. If the cellwise system of the current cell is cached and
+ *          the cache is in use, only the right-hand side is reduced and the
+ *          condensed matrix is copied from the cache. Otherwise, the static
+ *          condensation is performed and the cache is updated.
+ *
+ * \param[in]      c2x         pointer to a cs_adjacency_t structure
+ * \param[in, out] cache       pointer to a cache structure or nullptr
+ * \param[in, out] rc_tilda    pointer to the rhs related to cell DoFs (Acc-1
+ * \param[in, out] acx_tilda   pointer to an unrolled matrix Acc^-1 * Acx
+ * \param[in, out] cb          pointer to a cs_cell_builder_t structure
+ * \param[in, out] csys        pointer to a cs_cell_sys_t structure to update
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_static_condensation_vector_cached(const cs_adjacency_t           *c2x,
+                                     cs_static_condensation_cache_t *cache,
+                                     cs_real_t                      *rc_tilda,
+                                     cs_real_t                      *acx_tilda,
+                                     cs_cell_builder_t              *cb,
+                                     cs_cell_sys_t                  *csys)
+{
+  const cs_lnum_t  c_id = csys->c_id;
+
+  if (cache == nullptr || c_id >= cache->n_cached_cells) {
+    cs_static_condensation_vector_eq(c2x, rc_tilda, acx_tilda, cb, csys);
+    return;
+  }
+
+  assert(cache->stride == 3);
+
+  cs_sdm_t  *m = csys->mat;
+  cs_sdm_block_t  *bd = m->block_desc;
+
+  const int  stride = 3;
+  const int  diag = stride + 1;
+  const int  n_xc = bd->n_row_blocks - 1;
+  const int  n_blocks = n_xc*n_xc;
+
+  assert(n_xc == c2x->idx[c_id+1] - c2x->idx[c_id]);
+
+  cs_real_t  *inv_acc = cache->inv_acc + stride*c_id;
+  cs_real_t  *axc = cache->axc + stride*c2x->idx[c_id];
+  cs_real_t  *mat_val = cache->mat_val + cache->mat_idx[c_id];
+
+  if (cache->use_cache) {
+
+    /* Only the reduction of the RHS is performed. acx_tilda is unchanged
+       since the cellwise system is unchanged */
+
+    const double  *cell_rhs = csys->rhs + stride*n_xc;
+
+    cs_real_t  *_rc_tilda = rc_tilda + stride*c_id;
+    for (int k = 0; k < stride; k++)
+      _rc_tilda[k] = cell_rhs[k] * inv_acc[k];
+
+    for (short int bfi = 0; bfi < n_xc; bfi++) {
+      const cs_real_t  *axc_i = axc + stride*bfi;
+      for (int k = 0; k < stride; k++)
+        csys->rhs[stride*bfi+k] -= _rc_tilda[k] * axc_i[k];
+    }
+
+    /* Set the condensed matrix (blocks are stored row by row) */
+
+    csys->n_dofs = stride*n_xc;
+    m->n_rows = m->n_cols = stride*n_xc;
+    bd->n_row_blocks = n_xc;
+    bd->n_col_blocks = n_xc;
+
+    for (int ij = 0; ij < n_blocks; ij++)
+      memcpy(bd->blocks[ij].val, mat_val + 9*ij, 9*sizeof(cs_real_t));
+
+    return;
+  }
+
+  /* Store the quantities needed to reduce the RHS */
+
+  const cs_sdm_t  *mcc = cs_sdm_get_block(m, n_xc, n_xc);
+
+  for (int k = 0; k < stride; k++)
+    inv_acc[k] = 1./mcc->val[diag*k];
+
+  for (int ix = 0; ix < n_xc; ix++) {
+    const cs_sdm_t  *mxc = cs_sdm_get_block(m, ix, n_xc);
+    for (int k = 0; k < stride; k++)
+      axc[stride*ix + k] = mxc->val[diag*k];
+  }
+
+  cs_static_condensation_vector_eq(c2x, rc_tilda, acx_tilda, cb, csys);
+
+  for (int ij = 0; ij < n_blocks; ij++)
+    memcpy(mat_val + 9*ij, bd->blocks[ij].val, 9*sizeof(cs_real_t));
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Opposite process of the static condensation.
@@ -44,10 +44,98 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/*! \struct cs_static_condensation_cache_t
+ *  \brief Storage of the cellwise systems resulting from a static
+ *         condensation. When these systems do not change from one build to
+ *         another, only the reduction of the right-hand side is performed.
+ *
+ *  Only cells with an id lower than n_cached_cells are stored (this number
+ *  results from the memory budget). Other cells are always condensed.
+ */
+
+typedef struct {
+
+  int           stride;          /*!< 1 (scalar-valued) or 3 (vector-valued) */
+  cs_lnum_t     n_cached_cells;  /*!< number of cells stored in the cache */
+
+  bool          is_filled;       /*!< true if all cached cells are set */
+  bool          use_cache;       /*!< true if the current build uses the
+                                   cached systems */
+  double        key;             /*!< value identifying the cached systems
+                                   (for instance, the inverse of the time
+                                   step) */
+
+  cs_lnum_t    *mat_idx;         /*!< index of the condensed matrix values
+                                   (size n_cached_cells + 1) */
+  cs_real_t    *mat_val;         /*!< condensed cellwise matrix values */
+  cs_real_t    *inv_acc;         /*!< inverse of the (diagonal) cell block
+                                   (size stride*n_cached_cells) */
+  cs_real_t    *axc;             /*!< diagonal of the Axc blocks
+                                   (size stride*c2x->idx[n_cached_cells]) */
+
+} cs_static_condensation_cache_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Create a cache for the cellwise systems resulting from a static
+ *          condensation. The number of cached cells is limited by the given
+ *          memory budget; other cells are always condensed.
+ *
+ * \param[in] c2x          pointer to a cs_adjacency_t structure
+ * \param[in] stride       1 (scalar-valued) or 3 (vector-valued)
+ * \param[in] budget_mib   memory budget in MiB (no cache if <= 0)
+ *
+ * \return a pointer to the new structure or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_static_condensation_cache_t *
+cs_static_condensation_cache_create(const cs_adjacency_t  *c2x,
+                                    int                    stride,
+                                    double                 budget_mib);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Free a cs_static_condensation_cache_t structure
+ *
+ * \param[in, out] p_cache    double pointer to the structure to free
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_static_condensation_cache_free(cs_static_condensation_cache_t  **p_cache);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Start a new build of the cellwise systems. Cached systems are used
+ *          only if they have all been set during a previous build with the
+ *          same key. Do nothing if the cache is not allocated.
+ *
+ * \param[in, out] cache    pointer to the cache structure or nullptr
+ * \param[in]      key      value identifying the cellwise systems
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_static_condensation_cache_start(cs_static_condensation_cache_t  *cache,
+                                   double                           key);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Finalize a build of the cellwise systems. All cached cells have
+ *          been set. Do nothing if the cache is not allocated.
+ *
+ * \param[in, out] cache    pointer to the cache structure or nullptr
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_static_condensation_cache_end(cs_static_condensation_cache_t  *cache);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Proceed to a static condensation of the local system and store
@@ -71,6 +159,31 @@ cs_static_condensation_scalar_eq(const cs_adjacency_t    *c2x,
                                  cs_cell_builder_t       *cb,
                                  cs_cell_sys_t           *csys);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Same as \ref cs_static_condensation_scalar_eq but relying on a
+ *          cache. If the cellwise system of the current cell is cached and
+ *          the cache is in use, only the right-hand side is reduced and the
+ *          condensed matrix is copied from the cache. Otherwise, the static
+ *          condensation is performed and the cache is updated.
+ *
+ * \param[in]      c2x         pointer to a cs_adjacency_t structure
+ * \param[in, out] cache       pointer to a cache structure or nullptr
+ * \param[in, out] rc_tilda    pointer to the rhs related to cell DoFs (Acc-1
+ * \param[in, out] acx_tilda   pointer to an unrolled matrix Acc^-1 * Acx
+ * \param[in, out] cb          pointer to a cs_cell_builder_t structure
+ * \param[in, out] csys        pointer to a cs_cell_sys_t structure to update
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_static_condensation_scalar_cached(const cs_adjacency_t           *c2x,
+                                     cs_static_condensation_cache_t *cache,
+                                     cs_real_t                      *rc_tilda,
+                                     cs_real_t                      *acx_tilda,
+                                     cs_cell_builder_t              *cb,
+                                     cs_cell_sys_t                  *csys);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Opposite process of the static condensation.
@@ -116,6 +229,31 @@ cs_static_condensation_vector_eq(const cs_adjacency_t    *c2x,
                                  cs_cell_builder_t       *cb,
                                  cs_cell_sys_t           *csys);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief   Same as \ref cs_static_condensation_vector_eq but relying on a
+ *          cache. If the cellwise system of the current cell is cached and
+ *          the cache is in use, only the right-hand side is reduced and the
+ *          condensed matrix is copied from the cache. Otherwise, the static
+ *          condensation is performed and the cache is updated.
+ *
+ * \param[in]      c2x         pointer to a cs_adjacency_t structure
+ * \param[in, out] cache       pointer to a cache structure or nullptr
+ * \param[in, out] rc_tilda    pointer to the rhs related to cell DoFs (Acc-1
+ * \param[in, out] acx_tilda   pointer to an unrolled matrix Acc^-1 * Acx
+ * \param[in, out] cb          pointer to a cs_cell_builder_t structure
+ * \param[in, out] csys        pointer to a cs_cell_sys_t structure to update
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_static_condensation_vector_cached(const cs_adjacency_t           *c2x,
+                                     cs_static_condensation_cache_t *cache,
+                                     cs_real_t                      *rc_tilda,
+                                     cs_real_t                      *acx_tilda,
+                                     cs_cell_builder_t              *cb,
+                                     cs_cell_sys_t                  *csys);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Opposite process of the static condensation.
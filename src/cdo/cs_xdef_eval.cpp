@@ -47,6 +47,7 @@
 #include "cs_defs.h"
 #include "cs_field.h"
 #include "cs_mesh_location.h"
+#include "cs_parall.h"
 #include "cs_reco.h"
 
 /*----------------------------------------------------------------------------
@@ -67,10 +68,55 @@ BEGIN_C_DECLS
 
 #define _dp3  cs_math_3_dot_product
 
+/* Number of quadrature points gathered before calling an analytic function
+   when computing face averages */
+
+#define _AVG_BATCH_SIZE  512
+
 /*============================================================================
  * Private function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Evaluate an analytic function on a batch of quadrature points and
+ *         add the weighted values to the related entries
+ *
+ * \param[in]      time_eval   physical time at which one evaluates the term
+ * \param[in]      cx          pointer to an analytic context structure
+ * \param[in]      dim         dimension of the analytic function return
+ * \param[in]      n_pts       number of quadrature points in the batch
+ * \param[in]      coords      coordinates of the quadrature points
+ * \param[in]      w           weights related to the quadrature points
+ * \param[in]      p2o         entry id related to each quadrature point
+ * \param[in, out] vals        buffer for the evaluations (size dim*n_pts)
+ * \param[in, out] eval        array storing the result
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_avg_batch_flush(cs_real_t                          time_eval,
+                 const cs_xdef_analytic_context_t  *cx,
+                 int                                dim,
+                 cs_lnum_t                          n_pts,
+                 const cs_real_t                    coords[],
+                 const cs_real_t                    w[],
+                 const cs_lnum_t                    p2o[],
+                 cs_real_t                          vals[],
+                 cs_real_t                          eval[])
+{
+  if (n_pts < 1)
+    return;
+
+  cx->func(time_eval, n_pts, nullptr, coords, false, cx->input, vals);
+
+  for (cs_lnum_t p = 0; p < n_pts; p++) {
+    cs_real_t  *_eval = eval + dim*p2o[p];
+    for (int k = 0; k < dim; k++)
+      _eval[k] += w[p] * vals[dim*p + k];
+  }
+}
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
@@ -1252,120 +1298,128 @@ cs_xdef_eval_avg_at_b_faces_by_analytic(cs_lnum_t                    n_elts,
   cs_xdef_analytic_context_t *cx = (cs_xdef_analytic_context_t *)context;
   assert(cx != nullptr);
 
-  cs_quadrature_tria_integral_t
-    *qfunc = cs_quadrature_get_tria_integral(dim, qtype);
+  const cs_lnum_t  n_faces = (elt_ids == nullptr) ? quant->n_b_faces : n_elts;
+
+  int  n_qp = 0;
+  cs_quadrature_tria_t  *qrule = cs_quadrature_get_tria_rule(qtype, &n_qp);
 
   const cs_adjacency_t  *f2e = connect->f2e;
   const cs_adjacency_t  *e2v = connect->e2v;
   const cs_real_t  *xv = quant->vtx_coord;
 
-  if (elt_ids == nullptr) { /* All boundary faces are selected */
-
-#   pragma omp parallel for if (quant->n_b_faces > CS_THR_MIN)
-    for (cs_lnum_t bf_id = 0; bf_id < quant->n_b_faces; bf_id++) {
-
-      const cs_lnum_t f_id = quant->n_i_faces + bf_id;
-      const cs_quant_t pfq = cs_quant_set_face(f_id, quant);
-      const cs_lnum_t  start = f2e->idx[f_id], end = f2e->idx[f_id+1];
-      double *val_i = eval + dim*bf_id;
-
-      /* Resetting */
+  /* Quadrature points are gathered over several faces before evaluating the
+     analytic function, so that it is called once for a batch of points
+     rather than once for each sub-triangle */
 
-      memset(val_i, 0, dim*sizeof(double));
+# pragma omp parallel if (n_faces > CS_THR_MIN)
+  {
+    cs_lnum_t  s_id, e_id;
+    cs_parall_thread_range(n_faces, sizeof(cs_real_t), &s_id, &e_id);
 
-      switch (end - start) {
+    cs_lnum_t  n_max_pts = _AVG_BATCH_SIZE, n_pts = 0;
+    cs_real_t  *pt_coords = nullptr, *pt_w = nullptr, *pt_vals = nullptr;
+    cs_lnum_t  *pt2f = nullptr;
 
-      case CS_TRIANGLE_CASE:
-        {
-          cs_lnum_t v1, v2, v3;
-          cs_connect_get_next_3_vertices(f2e->ids, e2v->ids, start,
-                                         &v1, &v2, &v3);
-          qfunc(time_eval, xv + 3*v1, xv + 3*v2, xv + 3*v3, pfq.meas,
-                cx->func, cx->input, val_i);
-        }
-        break;
+    BFT_MALLOC(pt_coords, 3*n_max_pts, cs_real_t);
+    BFT_MALLOC(pt_w, n_max_pts, cs_real_t);
+    BFT_MALLOC(pt_vals, dim*n_max_pts, cs_real_t);
+    BFT_MALLOC(pt2f, n_max_pts, cs_lnum_t);
 
-      default:
-        for (cs_lnum_t j = start; j < end; j++) {
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
 
-          const cs_lnum_t  _2e = 2*f2e->ids[j];
-          const cs_lnum_t  v1 = e2v->ids[_2e];
-          const cs_lnum_t  v2 = e2v->ids[_2e+1];
-
-          qfunc(time_eval, xv + 3*v1, xv + 3*v2, pfq.center,
-                cs_math_surftri(xv + 3*v1, xv + 3*v2, pfq.center),
-                cx->func, cx->input, val_i);
-
-        } /* Loop on edges */
+      const cs_lnum_t  bf_id = (elt_ids == nullptr) ? i : elt_ids[i];
+      const cs_lnum_t  f_id = quant->n_i_faces + bf_id;
+      const cs_lnum_t  start = f2e->idx[f_id], end = f2e->idx[f_id+1];
+      const cs_lnum_t  n_ef = end - start;
+      const cs_lnum_t  n_sub = (n_ef == CS_TRIANGLE_CASE) ? 1 : n_ef;
 
-      } /* Switch on the type of face. Special case for triangles */
+      const cs_lnum_t  o_id =
+        (elt_ids == nullptr || dense_output) ? i : bf_id;
 
-      /* Compute the average */
+      memset(eval + dim*o_id, 0, dim*sizeof(cs_real_t));
 
-      const double _os = 1./pfq.meas;
-      for (int k = 0; k < dim; k++)
-        val_i[k] *= _os;
+      /* Flush the current batch if this face does not fit anymore */
 
-    } /* Loop on faces */
-  }
-  else { /* There is an indirection list */
+      if (n_pts + n_sub*n_qp > n_max_pts) {
 
-#   pragma omp parallel for if (n_elts > CS_THR_MIN)
-    for (cs_lnum_t i = 0; i < n_elts; i++) { /* Loop on selected faces */
+        _avg_batch_flush(time_eval, cx, dim, n_pts,
+                         pt_coords, pt_w, pt2f, pt_vals, eval);
+        n_pts = 0;
 
-      const cs_lnum_t  bf_id = elt_ids[i];
-      const cs_lnum_t  f_id = quant->n_i_faces + bf_id;
-      const cs_quant_t  pfq = cs_quant_set_face(f_id, quant);
-      const cs_lnum_t  start = f2e->idx[f_id], end = f2e->idx[f_id+1];
+        if (n_sub*n_qp > n_max_pts) { /* Large polygonal face */
+          n_max_pts = n_sub*n_qp;
+          BFT_REALLOC(pt_coords, 3*n_max_pts, cs_real_t);
+          BFT_REALLOC(pt_w, n_max_pts, cs_real_t);
+          BFT_REALLOC(pt_vals, dim*n_max_pts, cs_real_t);
+          BFT_REALLOC(pt2f, n_max_pts, cs_lnum_t);
+        }
 
-      double  *val_i = dense_output ? eval + dim*i : eval + dim*bf_id;
+      }
 
-      /* Resetting */
+      if (n_ef == CS_TRIANGLE_CASE) {
 
-      memset(val_i, 0, dim*sizeof(double));
+        const cs_quant_t  pfq = cs_quant_set_face(f_id, quant);
 
-      switch (end - start) {
+        cs_lnum_t v1, v2, v3;
+        cs_connect_get_next_3_vertices(f2e->ids, e2v->ids, start,
+                                       &v1, &v2, &v3);
+        qrule(xv + 3*v1, xv + 3*v2, xv + 3*v3, pfq.meas,
+              (cs_real_3_t *)(pt_coords + 3*n_pts), pt_w + n_pts);
+        n_pts += n_qp;
 
-      case CS_TRIANGLE_CASE:
-        {
-          /* If triangle, one-shot computation */
+      }
+      else {
 
-          cs_lnum_t v1, v2, v3;
-          cs_connect_get_next_3_vertices(f2e->ids, e2v->ids, start,
-                                         &v1, &v2, &v3);
-          qfunc(time_eval, xv + 3*v1, xv + 3*v2, xv + 3*v3,
-                pfq.meas, cx->func, cx->input, val_i);
-        }
-        break;
+        const cs_real_t  *xf = quant->b_face_center + 3*bf_id;
 
-      default:
         for (cs_lnum_t j = start; j < end; j++) {
 
           const cs_lnum_t  _2e = 2*f2e->ids[j];
           const cs_lnum_t  v1 = e2v->ids[_2e];
           const cs_lnum_t  v2 = e2v->ids[_2e+1];
 
-          qfunc(time_eval, xv + 3*v1, xv + 3*v2, pfq.center,
-                cs_math_surftri(xv + 3*v1, xv + 3*v2, pfq.center),
-                cx->func, cx->input, val_i);
+          qrule(xv + 3*v1, xv + 3*v2, xf,
+                cs_math_surftri(xv + 3*v1, xv + 3*v2, xf),
+                (cs_real_3_t *)(pt_coords + 3*n_pts), pt_w + n_pts);
+          n_pts += n_qp;
 
         } /* Loop on edges */
 
-      } /* Switch on the type of face. Special case for triangles */
+      }
+
+      for (cs_lnum_t p = n_pts - n_sub*n_qp; p < n_pts; p++)
+        pt2f[p] = o_id;
+
+    } /* Loop on selected faces */
+
+    _avg_batch_flush(time_eval, cx, dim, n_pts,
+                     pt_coords, pt_w, pt2f, pt_vals, eval);
 
-      /* Compute the average */
+    BFT_FREE(pt_coords);
+    BFT_FREE(pt_w);
+    BFT_FREE(pt_vals);
+    BFT_FREE(pt2f);
 
-      const double _os = 1./pfq.meas;
+    /* Compute the average */
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+
+      const cs_lnum_t  bf_id = (elt_ids == nullptr) ? i : elt_ids[i];
+      const cs_lnum_t  o_id =
+        (elt_ids == nullptr || dense_output) ? i : bf_id;
+
+      const double _os = 1./quant->b_face_surf[bf_id];
       for (int k = 0; k < dim; k++)
-        val_i[k] *= _os;
+        eval[dim*o_id + k] *= _os;
 
-    } /* Loop on selected faces */
+    }
 
-  }
+  } /* OpenMP block */
 }
 
 /*----------------------------------------------------------------------------*/
 
 #undef _dp3
+#undef _AVG_BATCH_SIZE
 
 END_C_DECLS
@@ -382,164 +382,53 @@ use radiat
 
 implicit none
 
-integer :: dataIndex
+integer :: ii, kk
+integer :: i_zm(2), i_zvar(2), i_kim(2), i_xrm(2)
 
 double precision :: zm0, zvar0, kim0, xrm0, phim(nlibvar)
 double precision :: weight_zm, weight_zvar, weight_kim, weight_xrm
 
-double precision, dimension(:,:,:,:), allocatable :: phi_4
-double precision, dimension(:,:,:), allocatable :: phi_3
-double precision, dimension(:,:), allocatable :: phi_2
-double precision, dimension(:), allocatable :: xData
+double precision :: phi_3(nlibvar, 2), phi_2(nlibvar, 2)
 
 ! Work arrays for radiation
-double precision, dimension(:,:,:,:,:), allocatable :: rad_work4
-double precision, dimension(:,:,:,:), allocatable  :: rad_work3
-double precision, dimension(:,:,:), allocatable    :: rad_work2
+double precision :: rad_work3(2, nwsgg, 2), rad_work2(2, nwsgg, 2)
 double precision  rad_work(2, nwsgg)
 
 logical  update_rad
 
-allocate(phi_4(nlibvar,nxr,nki,nzvar))
-allocate(phi_3(nlibvar,nxr,nki))
-allocate(phi_2(nlibvar,nxr))
-
-if (update_rad.eqv..TRUE.) then
-  allocate(rad_work4(2,nwsgg,nxr,nki,nzvar))
-  allocate(rad_work3(2,nwsgg,nxr,nki))
-  allocate(rad_work2(2,nwsgg,nxr))
-endif
+call flamelet_interp_weights(zm0, zvar0, kim0, xrm0,   &
+                             i_zm, weight_zm, i_zvar, weight_zvar, &
+                             i_kim, weight_kim, i_xrm, weight_xrm)
 
-! Start with z_m
-allocate(xData(nzm))
-xData(:) = flamelet_library(FLAMELET_ZM,1,1,1,:)
-
-if(xData(1).ge.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(:,:,:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work4(:,:,:,:,:) = radiation_library(:,:,:,:,:,1)
-elseif(xData(size(xData)).le.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(:,:,:,:,nzm)
-  if (update_rad.eqv..TRUE.) rad_work4(:,:,:,:,:) = radiation_library(:,:,:,:,:,nzm)
-else
+! Interpolate over z_m and z_var at surrounding (XR_m, Ki_m) entries,
+! then over Ki_m and XR_m
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  if(dataIndex .gt.1 ) then
-    weight_zm = (zm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_4(:,:,:,:) = (1.0-weight_zm)*flamelet_library(:,:,:,:,dataIndex-1) &
-      + weight_zm*flamelet_library(:,:,:,:,dataIndex)
-
-    ! Interpolation grandeurs radiatives
+do ii = 1, 2
+  do kk = 1, 2
+    call flamelet_interp_zm_zvar_v(nlibvar, nxr, nki, flamelet_library,       &
+                                   i_xrm(ii), i_kim(kk),                      &
+                                   i_zm, weight_zm, i_zvar, weight_zvar,      &
+                                   phi_3(:,kk))
     if (update_rad.eqv..TRUE.) then
-      rad_work4(:,:,:,:,:) = (1.0-weight_zm)*radiation_library(:,:,:,:,:,dataIndex-1) &
-        + weight_zm*radiation_library(:,:,:,:,:,dataIndex)
+      call flamelet_interp_zm_zvar_v(2*nwsgg, nxr, nki, radiation_library,    &
+                                     i_xrm(ii), i_kim(kk),                    &
+                                     i_zm, weight_zm, i_zvar, weight_zvar,    &
+                                     rad_work3(:,:,kk))
     endif
-  endif
-endif
-
-deallocate(xData)
-
-! Then interpolate over z_var
-allocate(xData(nzvar))
-xData(:) = phi_4(FLAMELET_ZVAR,1,1,:)
-
-if(xData(1).ge.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work3(:,:,:,:) = rad_work4(:,:,:,:,1)
-elseif(xData(size(xData)).le.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,nzvar)
-  if (update_rad.eqv..TRUE.) rad_work3(:,:,:,:) = rad_work4(:,:,:,:,nzvar)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zvar0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
   enddo
-
-  if(dataIndex .gt. 1) then
-    weight_zvar = (zvar0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_3(:,:,:) = (1.0-weight_zvar)*phi_4(:,:,:,dataIndex-1) &
-      + weight_zvar*phi_4(:,:,:,dataIndex)
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work3(:,:,:,:) = (1.0-weight_zvar)*rad_work4(:,:,:,:,dataIndex-1) &
-        + weight_zvar*rad_work4(:,:,:,:,dataIndex)
-    endif
-  endif
-endif
-
-deallocate(xData)
-
-! Then interpolate over Ki_m
-allocate(xData(nki))
-xData(:) = phi_3(FLAMELET_KI,1,:)
-
-if(xData(1).ge.kim0) then
-  phi_2(:,:) = phi_3(:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work2(:,:,:) = rad_work3(:,:,:,1)
-elseif(xData(size(xData)).le.kim0) then
-  phi_2(:,:) = phi_3(:,:,nki)
-  if (update_rad.eqv..TRUE.) rad_work2(:,:,:) = rad_work3(:,:,:,nki)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt. kim0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
-
-  if(dataIndex .gt. 1) then
-    weight_kim = (kim0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_2(:,:) = (1.0-weight_kim)*phi_3(:,:,dataIndex-1) &
-      + weight_kim*phi_3(:,:,dataIndex)
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work2(:,:,:) = (1.0-weight_kim)*rad_work3(:,:,:,dataIndex-1) &
-        + weight_kim*rad_work3(:,:,:,dataIndex)
-    endif
+  phi_2(:,ii) = (1.d0-weight_kim)*phi_3(:,1) + weight_kim*phi_3(:,2)
+  if (update_rad.eqv..TRUE.) then
+    rad_work2(:,:,ii) =   (1.d0-weight_kim)*rad_work3(:,:,1) &
+                        + weight_kim*rad_work3(:,:,2)
   endif
-endif
-
-deallocate(xData)
-
-! Then interpolate over XR_m
-allocate(xData(nxr))
-xData(:) = phi_2(FLAMELET_XR,:)
-
-if(xData(1).ge.xrm0) then
-  phim(:) = phi_2(:,1)
-  if (update_rad.eqv..TRUE.) rad_work(:,:) = rad_work2(:,:,1)
-elseif(xData(size(xData)).le.xrm0) then
-  phim(:) = phi_2(:,nxr)
-  if (update_rad.eqv..TRUE.) rad_work(:,:) = rad_work2(:,:,nxr)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt. xrm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
+enddo
 
-  if(dataIndex.gt.1) then
-    weight_xrm = (xrm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phim(:) = (1.0-weight_xrm)*phi_2(:,dataIndex-1) &
-      + weight_xrm*phi_2(:,dataIndex)
-    if (update_rad.eqv..TRUE.) then
-      rad_work(:,:) = (1.0-weight_xrm)*rad_work2(:,:,dataIndex-1) &
-        + weight_xrm*rad_work2(:,:,dataIndex)
-    endif
-  endif
+phim(:) = (1.d0-weight_xrm)*phi_2(:,1) + weight_xrm*phi_2(:,2)
+if (update_rad.eqv..TRUE.) then
+  rad_work(:,:) =   (1.d0-weight_xrm)*rad_work2(:,:,1) &
+                  + weight_xrm*rad_work2(:,:,2)
 endif
 
-deallocate(xData)
-deallocate(phi_4,phi_3,phi_2)
-if (update_rad.eqv..TRUE.) deallocate(rad_work4, rad_work3, rad_work2)
-
 end subroutine
 
 !===============================================================================
@@ -564,124 +453,106 @@ use coincl
 
 implicit none
 
+integer :: ii, kk
+integer :: i_zm(2), i_zvar(2), i_kim(2), i_xrm(2)
+
 double precision :: zm0, zvar0, kim0, xrm0, rhom
 double precision :: weight_zm, weight_zvar, weight_kim, weight_xrm
+double precision :: phi_3(2), phi_2(2)
 
-double precision, dimension(:,:,:,:), allocatable :: phi_4
-double precision, dimension(:,:,:), allocatable :: phi_3
-double precision, dimension(:,:), allocatable :: phi_2
-double precision, dimension(:), allocatable :: xData
-
-integer :: dataIndex, n_var_local = 5
-integer :: var_sel(5)
-
-var_sel = (/FLAMELET_ZM, FLAMELET_ZVAR, FLAMELET_XR,          &
-            FLAMELET_RHO, FLAMELET_KI/)
-
-allocate(phi_4(n_var_local,nxr,nki,nzvar))
-allocate(phi_3(n_var_local,nxr,nki))
-allocate(phi_2(n_var_local,nxr))
+double precision, external :: flamelet_interp_zm_zvar
 
-! Start with z_m
-allocate(xData(nzm))
-xData(:) = flamelet_library(FLAMELET_ZM,1,1,1,:)
-
-if(xData(1).ge.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(var_sel,:,:,:,1)
-elseif(xData(size(xData)).le.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(var_sel,:,:,:,nzm)
-else
+call flamelet_interp_weights(zm0, zvar0, kim0, xrm0,   &
+                             i_zm, weight_zm, i_zvar, weight_zvar, &
+                             i_kim, weight_kim, i_xrm, weight_xrm)
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
+do ii = 1, 2
+  do kk = 1, 2
+    phi_3(kk) = flamelet_interp_zm_zvar(nlibvar, nxr, nki, flamelet_library, &
+                                        FLAMELET_RHO, i_xrm(ii), i_kim(kk),  &
+                                        i_zm, weight_zm, i_zvar, weight_zvar)
   enddo
+  phi_2(ii) = (1.d0-weight_kim)*phi_3(1) + weight_kim*phi_3(2)
+enddo
 
-  if(dataIndex .gt.1 ) then
-    weight_zm = (zm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_4(:,:,:,:) = (1.0-weight_zm)*flamelet_library(var_sel,:,:,:,dataIndex-1) &
-      + weight_zm*flamelet_library(var_sel,:,:,:,dataIndex)
-  endif
-endif
+rhom = (1.d0-weight_xrm)*phi_2(1) + weight_xrm*phi_2(2)
 
-deallocate(xData)
+end subroutine
 
-! Then interpolate over z_var
-allocate(xData(nzvar))
-xData(:) = phi_4(2,1,1,:)
+!===============================================================================
+! Function:
+! ---------
 
-if(xData(1).ge.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,1)
-elseif(xData(size(xData)).le.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,nzvar)
-else
+!> \file cs_steady_laminar_flamelet_physical_prop.f90
+!>
+!> \brief Specific physic subroutine: diffusion flame.
+!>
+!> Interpolation of mean thermophysic properties as a
+!> function of fm, fp2m, c, xr
+!-------------------------------------------------------------------------------
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zvar0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
+subroutine filtered_physical_prop_progvar(zm0, zvar0, cm0, xrm0,          &
+                                          phim, rad_work, update_rad)
 
-  if(dataIndex .gt. 1) then
-    weight_zvar = (zvar0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_3(:,:,:) = (1.0-weight_zvar)*phi_4(:,:,:,dataIndex-1) &
-      + weight_zvar*phi_4(:,:,:,dataIndex)
-  endif
-endif
+!===============================================================================
+! Module files
+!===============================================================================
 
-deallocate(xData)
+use coincl
+use radiat
 
-! Then interpolate over Ki_m
-allocate(xData(nki))
-xData(:) = phi_3(5,1,:)
+implicit none
 
-if(xData(1).ge.kim0) then
-  phi_2(:,:) = phi_3(:,:,1)
-elseif(xData(size(xData)).le.kim0) then
-  phi_2(:,:) = phi_3(:,:,nki)
-else
+integer :: ii, kk, i_ki
+integer :: i_zm(2), i_zvar(2), i_xrm(2, nki), i_cm(2)
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt. kim0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
+double precision :: zm0, zvar0, cm0, xrm0, phim(nlibvar)
+double precision :: weight_zm, weight_zvar, weight_cm, weight_xrm(nki)
 
-  if(dataIndex .gt. 1) then
-    weight_kim = (kim0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_2(:,:) = (1.0-weight_kim)*phi_3(:,:,dataIndex-1) &
-      + weight_kim*phi_3(:,:,dataIndex)
-  endif
-endif
+double precision :: phi_3(nlibvar, 2), phi_2(nlibvar, 2)
 
-deallocate(xData)
+! Work arrays for radiation
+double precision :: rad_work3(2, nwsgg, 2), rad_work2(2, nwsgg, 2)
+double precision  rad_work(2, nwsgg)
 
-! Then interpolate over XR_m
-allocate(xData(nxr))
-xData(:) = phi_2(3,:)
+logical update_rad, c_max_clip
 
-if(xData(1).ge.xrm0) then
-  rhom = phi_2(4,1)
-elseif(xData(size(xData)).le.xrm0) then
-  rhom = phi_2(4,nxr)
-else
+call flamelet_interp_weights_progvar(zm0, zvar0, cm0, xrm0, 4, FLAMELET_C,  &
+                                     i_zm, weight_zm, i_zvar, weight_zvar,  &
+                                     i_xrm, weight_xrm, i_cm, weight_cm,    &
+                                     c_max_clip)
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt. xrm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
+! Interpolate over z_m and z_var at surrounding (c_m, XR_m) entries,
+! then over XR_m and c_m
 
-  if(dataIndex.gt.1) then
-    weight_xrm = (xrm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    rhom = (1.0-weight_xrm)*phi_2(4,dataIndex-1) &
-      + weight_xrm*phi_2(4,dataIndex)
+do kk = 1, 2
+  i_ki = i_cm(kk)
+  do ii = 1, 2
+    call flamelet_interp_zm_zvar_v(nlibvar, nki, nxr, flamelet_library,       &
+                                   i_ki, i_xrm(ii, i_ki),                     &
+                                   i_zm, weight_zm, i_zvar, weight_zvar,      &
+                                   phi_3(:,ii))
+    if (update_rad.eqv..TRUE.) then
+      call flamelet_interp_zm_zvar_v(2*nwsgg, nki, nxr, radiation_library,    &
+                                     i_ki, i_xrm(ii, i_ki),                   &
+                                     i_zm, weight_zm, i_zvar, weight_zvar,    &
+                                     rad_work3(:,:,ii))
+    endif
+  enddo
+  phi_2(:,kk) =   (1.d0-weight_xrm(i_ki))*phi_3(:,1) &
+                + weight_xrm(i_ki)*phi_3(:,2)
+  if (update_rad.eqv..TRUE.) then
+    rad_work2(:,:,kk) =   (1.d0-weight_xrm(i_ki))*rad_work3(:,:,1) &
+                        + weight_xrm(i_ki)*rad_work3(:,:,2)
   endif
-endif
+enddo
 
-deallocate(xData)
-deallocate(phi_4,phi_3,phi_2)
+phim(:) = (1.d0-weight_cm)*phi_2(:,1) + weight_cm*phi_2(:,2)
+if (c_max_clip) phim(FLAMELET_OMG_C) = 0.0d0
+if (update_rad.eqv..TRUE.) then
+  rad_work(:,:) =   (1.d0-weight_cm)*rad_work2(:,:,1) &
+                  + weight_cm*rad_work2(:,:,2)
+endif
 
 end subroutine
 
@@ -693,189 +564,184 @@ end subroutine
 !>
 !> \brief Specific physic subroutine: diffusion flame.
 !>
-!> Interpolation of mean thermophysic properties as a
-!> function of fm, fp2m, c, xr
+!> Interpolation of mean density as a function of
+!> fm, fp2m, c, xr
 !-------------------------------------------------------------------------------
 
-subroutine filtered_physical_prop_progvar(zm0, zvar0, cm0, xrm0,          &
-                                          phim, rad_work, update_rad)
+subroutine filtered_density_progvar(zm0, zvar0, cm0, xrm0, rhom)
 
 !===============================================================================
 ! Module files
 !===============================================================================
 
 use coincl
-use radiat
 
 implicit none
 
-integer :: dataIndex, i_ki
+integer :: ii, kk, i_ki
+integer :: i_zm(2), i_zvar(2), i_xrm(2, nki), i_cm(2)
 
-double precision :: zm0, zvar0, cm0, xrm0, phim(nlibvar)
+double precision :: zm0, zvar0, cm0, xrm0, rhom
 double precision :: weight_zm, weight_zvar, weight_cm, weight_xrm(nki)
+double precision :: phi_3(2), phi_2(2)
 
-double precision, dimension(:,:,:,:), allocatable :: phi_4
-double precision, dimension(:,:,:), allocatable :: phi_3
-double precision, dimension(:,:), allocatable :: phi_2, xData2D
-double precision, dimension(:), allocatable :: xData
+double precision, external :: flamelet_interp_zm_zvar
 
-! Work arrays for radiation
-double precision, dimension(:,:,:,:,:), allocatable :: rad_work4
-double precision, dimension(:,:,:,:), allocatable  :: rad_work3
-double precision, dimension(:,:,:), allocatable    :: rad_work2
-double precision  rad_work(2, nwsgg)
+logical c_max_clip
 
-logical update_rad
+call flamelet_interp_weights_progvar(zm0, zvar0, cm0, xrm0,                  &
+                                     FLAMELET_XR, FLAMELET_KI,               &
+                                     i_zm, weight_zm, i_zvar, weight_zvar,   &
+                                     i_xrm, weight_xrm, i_cm, weight_cm,     &
+                                     c_max_clip)
 
-allocate(phi_4(nlibvar,nki,nxr,nzvar))
-allocate(phi_3(nlibvar,nki,nxr))
-allocate(phi_2(nlibvar,nki))
+do kk = 1, 2
+  i_ki = i_cm(kk)
+  do ii = 1, 2
+    phi_3(ii) = flamelet_interp_zm_zvar(nlibvar, nki, nxr, flamelet_library, &
+                                        FLAMELET_RHO, i_ki, i_xrm(ii, i_ki), &
+                                        i_zm, weight_zm, i_zvar, weight_zvar)
+  enddo
+  phi_2(kk) = (1.d0-weight_xrm(i_ki))*phi_3(1) + weight_xrm(i_ki)*phi_3(2)
+enddo
 
-if (update_rad.eqv..TRUE.) then
-  allocate(rad_work4(2,nwsgg,nki,nxr,nzvar))
-  allocate(rad_work3(2,nwsgg,nki,nxr))
-  allocate(rad_work2(2,nwsgg,nki))
-endif
+rhom = (1.d0-weight_cm)*phi_2(1) + weight_cm*phi_2(2)
 
-! Start with z_m
-allocate(xData(nzm))
-xData(:) = flamelet_library(FLAMELET_ZM,1,1,1,:)
+end subroutine
 
-if(xData(1).ge.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(:,:,:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work4(:,:,:,:,:) = radiation_library(:,:,:,:,:,1)
-elseif(xData(size(xData)).le.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(:,:,:,:,nzm)
-  if (update_rad.eqv..TRUE.) rad_work4(:,:,:,:,:) = radiation_library(:,:,:,:,:,nzm)
-else
+!===============================================================================
+! Function:
+! ---------
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
-  enddo
+!> \file cs_steady_laminar_flamelet_physical_prop.f90
+!>
+!> \brief Specific physic subroutine: diffusion flame.
+!>
+!> Interpolation indices and weight along a flamelet library axis
+!-------------------------------------------------------------------------------
 
-  weight_zm = 0.d0
-  if(dataIndex .gt.1 ) then
-    weight_zm = (zm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_4(:,:,:,:) = (1.0d0-weight_zm)*flamelet_library(:,:,:,:,dataIndex-1) &
-      + weight_zm*flamelet_library(:,:,:,:,dataIndex)
+!-------------------------------------------------------------------------------
+! Arguments
+!______________________________________________________________________________.
+!  mode           name          role
+!______________________________________________________________________________!
+!> \param[in]     n             number of axis values
+!> \param[in]     xData         axis values
+!> \param[in]     x0            interpolation point
+!> \param[out]    ii            lower and upper indices (equal when clipped)
+!> \param[out]    w             weight of upper index
+!______________________________________________________________________________!
 
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work4(:,:,:,:,:) = (1.0d0-weight_zm)*radiation_library(:,:,:,:,:,dataIndex-1) &
-        + weight_zm*radiation_library(:,:,:,:,:,dataIndex)
-    endif
-  endif
-endif
+subroutine flamelet_axis_weight(n, xData, x0, ii, w)
 
-deallocate(xData)
+implicit none
 
-! Then interpolate over z_var
-allocate(xData(nzvar))
-xData(:) = phi_4(FLAMELET_ZVAR,1,1,:)
+integer :: n, ii(2)
+double precision :: xData(n), x0, w
 
-if(xData(1).ge.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,1)
-  if (update_rad.eqv..TRUE.) rad_work3(:,:,:,:) = rad_work4(:,:,:,:,1)
-elseif(xData(size(xData)).le.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,nzvar)
-  if (update_rad.eqv..TRUE.) rad_work3(:,:,:,:) = rad_work4(:,:,:,:,nzvar)
+w = 0.d0
+
+if (xData(1).ge.x0) then
+  ii(:) = 1
+elseif (xData(n).le.x0) then
+  ii(:) = n
 else
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zvar0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
+  ii(2) = 1
+  do while(xData(ii(2)).lt.x0 .and. ii(2).lt.n)
+    ii(2) = ii(2) + 1
   enddo
 
-  weight_zvar = 0.d0
-  if(dataIndex .gt. 1) then
-    weight_zvar = (zvar0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_3(:,:,:) = (1.0d0-weight_zvar)*phi_4(:,:,:,dataIndex-1) &
-      + weight_zvar*phi_4(:,:,:,dataIndex)
-
-    ! Interpolation grandeurs radiatives
-    if (update_rad.eqv..TRUE.) then
-      rad_work3(:,:,:,:) = (1.0d0-weight_zvar)*rad_work4(:,:,:,:,dataIndex-1) &
-        + weight_zvar*rad_work4(:,:,:,:,dataIndex)
-    endif
+  ii(1) = max(ii(2) - 1, 1)
+  if (ii(2).gt.1) then
+    w = (x0 - xData(ii(1)))/(xData(ii(2))-xData(ii(1)))
   endif
-endif
 
-deallocate(xData)
+endif
 
-! Then interpolate over XR_m
-allocate(xData2D(nki,nxr))
-xData2D(:,:) = phi_3(4,:,:)
+end subroutine
 
-do i_ki = 1, nki
+!===============================================================================
+! Function:
+! ---------
 
-  if(xData2D(i_ki,1).ge.xrm0) then
-    phi_2(:,i_ki) = phi_3(:,i_ki,1)
-    if (update_rad.eqv..TRUE.) rad_work2(:,:,i_ki) = rad_work3(:,:,i_ki,1)
-  elseif(xData2D(i_ki,nxr).le. xrm0) then
-    phi_2(:,i_ki) = phi_3(:,i_ki,nxr)
-    if (update_rad.eqv..TRUE.) rad_work2(:,:,i_ki) = rad_work3(:,:,i_ki,nxr)
-  else
+!> \file cs_steady_laminar_flamelet_physical_prop.f90
+!>
+!> \brief Specific physic subroutine: diffusion flame.
+!>
+!> Interpolation indices and weights for fm, fp2m, ki, xr
+!>
+!> Only the library entries surrounding the interpolation point are used:
+!> weights are determined successively along each axis, whose values are
+!> themselves interpolated along the previous axes.
+!-------------------------------------------------------------------------------
 
-    dataIndex = 1
-    do while(xData2D(i_ki,dataIndex) .lt. xrm0 &
-        .and. dataIndex .lt. nxr)
-      dataIndex = dataIndex + 1
-    enddo
+!-------------------------------------------------------------------------------
+! Arguments
+!______________________________________________________________________________.
+!  mode           name          role
+!______________________________________________________________________________!
+!> \param[in]     zm0           mean mixture fraction
+!> \param[in]     zvar0         mixture fraction variance
+!> \param[in]     kim0          scalar dissipation rate
+!> \param[in]     xrm0          radiative loss
+!> \param[out]    i_zm          surrounding z_m indices
+!> \param[out]    w_zm          z_m upper index weight
+!> \param[out]    i_zvar        surrounding z_var indices
+!> \param[out]    w_zvar        z_var upper index weight
+!> \param[out]    i_kim         surrounding Ki_m indices
+!> \param[out]    w_kim         Ki_m upper index weight
+!> \param[out]    i_xrm         surrounding XR_m indices
+!> \param[out]    w_xrm         XR_m upper index weight
+!______________________________________________________________________________!
 
-    if(dataIndex .gt. 1) then
-      weight_xrm(i_ki) = (xrm0-xData2D(i_ki,dataIndex-1))/ &
-        (xData2D(i_ki,dataIndex)-xData2D(i_ki,dataIndex-1))
-      phi_2(:,i_ki) = (1.d0-weight_xrm(i_ki))*phi_3(:,i_ki,dataIndex-1) &
-        + weight_xrm(i_ki)*phi_3(:,i_ki,dataIndex)
-      if (update_rad.eqv..TRUE.) then
-        rad_work2(:,:,i_ki) = (1.0d0-weight_xrm(i_ki))*rad_work3(:,:,i_ki,dataIndex-1) &
-          + weight_xrm(i_ki)*rad_work3(:,:,i_ki,dataIndex)
-      endif
-    endif
-  endif
+subroutine flamelet_interp_weights(zm0, zvar0, kim0, xrm0,       &
+                                   i_zm, w_zm, i_zvar, w_zvar,   &
+                                   i_kim, w_kim, i_xrm, w_xrm)
 
-enddo
+use coincl
 
-deallocate(xData2D)
+implicit none
 
-! Then interpolate over c_m
-allocate(xData(nki))
-xData(:) = phi_2(FLAMELET_C,:)
+integer :: ii, jj, kk
+integer :: i_zm(2), i_zvar(2), i_kim(2), i_xrm(2)
 
-if(xData(1).ge.cm0) then
-  phim(:) = phi_2(:,1)
-  if (update_rad.eqv..TRUE.) rad_work(:,:) = rad_work2(:,:,1)
-elseif(xData(size(xData)).le.cm0) then
-  phim(:) = phi_2(:,nki)
-  phim(FLAMELET_OMG_C) = 0.0d0
-  if (update_rad.eqv..TRUE.) rad_work(:,:) = rad_work2(:,:,nki)
-else
+double precision :: zm0, zvar0, kim0, xrm0
+double precision :: w_zm, w_zvar, w_kim, w_xrm
+double precision :: phi_3(2)
+double precision :: xData(max(nzm, nzvar, nki, nxr))
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt. cm0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
+double precision, external :: flamelet_interp_zm_zvar
 
-  weight_cm = 0.d0
-  if(dataIndex .gt. 1) then
-    weight_cm = (cm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phim(:) = (1.0d0-weight_cm)*phi_2(:,dataIndex-1) &
-      + weight_cm*phi_2(:,dataIndex)
-    if (update_rad.eqv..TRUE.) then
-      rad_work(:,:) = (1.0d0-weight_cm)*rad_work2(:,:,dataIndex-1) &
-        + weight_cm*rad_work2(:,:,dataIndex)
-    endif
-  endif
-endif
+! Start with z_m
+xData(1:nzm) = flamelet_library(FLAMELET_ZM,1,1,1,:)
+call flamelet_axis_weight(nzm, xData, zm0, i_zm, w_zm)
 
-deallocate(xData)
+! Then z_var
+do jj = 1, nzvar
+  xData(jj) =   (1.d0-w_zm)*flamelet_library(FLAMELET_ZVAR,1,1,jj,i_zm(1)) &
+              + w_zm*flamelet_library(FLAMELET_ZVAR,1,1,jj,i_zm(2))
+enddo
+call flamelet_axis_weight(nzvar, xData, zvar0, i_zvar, w_zvar)
 
-deallocate(phi_4,phi_3,phi_2)
-if (update_rad.eqv..TRUE.) deallocate(rad_work4, rad_work3, rad_work2)
+! Then Ki_m
+do kk = 1, nki
+  xData(kk) = flamelet_interp_zm_zvar(nlibvar, nxr, nki, flamelet_library, &
+                                      FLAMELET_KI, 1, kk,                  &
+                                      i_zm, w_zm, i_zvar, w_zvar)
+enddo
+call flamelet_axis_weight(nki, xData, kim0, i_kim, w_kim)
+
+! Then XR_m
+do ii = 1, nxr
+  do kk = 1, 2
+    phi_3(kk) = flamelet_interp_zm_zvar(nlibvar, nxr, nki, flamelet_library, &
+                                        FLAMELET_XR, ii, i_kim(kk),          &
+                                        i_zm, w_zm, i_zvar, w_zvar)
+  enddo
+  xData(ii) = (1.d0-w_kim)*phi_3(1) + w_kim*phi_3(2)
+enddo
+call flamelet_axis_weight(nxr, xData, xrm0, i_xrm, w_xrm)
 
 end subroutine
 
@@ -887,144 +753,193 @@ end subroutine
 !>
 !> \brief Specific physic subroutine: diffusion flame.
 !>
-!> Interpolation of mean density as a function of
-!> fm, fp2m, c, xr
+!> Interpolation indices and weights for fm, fp2m, c, xr
+!>
+!> XR_m weights are determined for each progress variable entry.
 !-------------------------------------------------------------------------------
 
-subroutine filtered_density_progvar(zm0, zvar0, cm0, xrm0, rhom)
+!-------------------------------------------------------------------------------
+! Arguments
+!______________________________________________________________________________.
+!  mode           name          role
+!______________________________________________________________________________!
+!> \param[in]     zm0           mean mixture fraction
+!> \param[in]     zvar0         mixture fraction variance
+!> \param[in]     cm0           progress variable
+!> \param[in]     xrm0          radiative loss
+!> \param[in]     ixr_var       library variable used for XR_m values
+!> \param[in]     ic_var        library variable used for c_m values
+!> \param[out]    i_zm          surrounding z_m indices
+!> \param[out]    w_zm          z_m upper index weight
+!> \param[out]    i_zvar        surrounding z_var indices
+!> \param[out]    w_zvar        z_var upper index weight
+!> \param[out]    i_xrm         surrounding XR_m indices, per c_m entry
+!> \param[out]    w_xrm         XR_m upper index weight, per c_m entry
+!> \param[out]    i_cm          surrounding c_m indices
+!> \param[out]    w_cm          c_m upper index weight
+!> \param[out]    c_max_clip    true if c_m is clipped to its maximum
+!______________________________________________________________________________!
 
-!===============================================================================
-! Module files
-!===============================================================================
+subroutine flamelet_interp_weights_progvar(zm0, zvar0, cm0, xrm0,         &
+                                           ixr_var, ic_var,               &
+                                           i_zm, w_zm, i_zvar, w_zvar,    &
+                                           i_xrm, w_xrm, i_cm, w_cm,      &
+                                           c_max_clip)
 
 use coincl
 
 implicit none
 
-double precision, dimension(:), allocatable :: xData
-double precision :: zm0, zvar0, cm0, xrm0, rhom
-
-double precision, dimension(:,:,:,:), allocatable :: phi_4
-double precision, dimension(:,:,:), allocatable :: phi_3
-double precision, dimension(:,:), allocatable :: phi_2, xData2D
-double precision :: weight_zm, weight_zvar, weight_cm, weight_xrm(nki)
+integer :: ii, jj, kk
+integer :: ixr_var, ic_var
+integer :: i_zm(2), i_zvar(2), i_xrm(2, nki), i_cm(2)
 
-integer :: dataIndex, i_ki, n_var_local = 5
-integer :: var_sel(5)
+double precision :: zm0, zvar0, cm0, xrm0
+double precision :: w_zm, w_zvar, w_xrm(nki), w_cm
+double precision :: phi_3(2)
+double precision :: xData(max(nzm, nzvar, nki, nxr))
 
-var_sel = (/FLAMELET_ZM, FLAMELET_ZVAR, FLAMELET_XR,          &
-            FLAMELET_RHO, FLAMELET_KI/)
+double precision, external :: flamelet_interp_zm_zvar
 
-allocate(phi_4(n_var_local,nki,nxr,nzvar))
-allocate(phi_3(n_var_local,nki,nxr))
-allocate(phi_2(n_var_local,nki))
+logical c_max_clip
 
 ! Start with z_m
-allocate(xData(nzm))
-xData(:) = flamelet_library(FLAMELET_ZM,1,1,1,:)
+xData(1:nzm) = flamelet_library(FLAMELET_ZM,1,1,1,:)
+call flamelet_axis_weight(nzm, xData, zm0, i_zm, w_zm)
 
-if(xData(1).ge.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(var_sel,:,:,:,1)
-elseif(xData(size(xData)).le.zm0) then
-  phi_4(:,:,:,:) = flamelet_library(var_sel,:,:,:,nzm)
-else
-
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zm0 &
-      .and. dataIndex .lt. size(xData))
-    dataIndex = dataIndex + 1
+! Then z_var
+do jj = 1, nzvar
+  xData(jj) =   (1.d0-w_zm)*flamelet_library(FLAMELET_ZVAR,1,1,jj,i_zm(1)) &
+              + w_zm*flamelet_library(FLAMELET_ZVAR,1,1,jj,i_zm(2))
+enddo
+call flamelet_axis_weight(nzvar, xData, zvar0, i_zvar, w_zvar)
+
+! Then XR_m, for each c_m entry
+do kk = 1, nki
+  do ii = 1, nxr
+    xData(ii) = flamelet_interp_zm_zvar(nlibvar, nki, nxr, flamelet_library, &
+                                        ixr_var, kk, ii,                     &
+                                        i_zm, w_zm, i_zvar, w_zvar)
   enddo
+  call flamelet_axis_weight(nxr, xData, xrm0, i_xrm(:,kk), w_xrm(kk))
+enddo
 
-  weight_zm = 0.d0
-  if(dataIndex .gt.1 ) then
-    weight_zm = (zm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_4(:,:,:,:) = (1.0d0-weight_zm)*flamelet_library(var_sel,:,:,:,dataIndex-1) &
-      + weight_zm*flamelet_library(var_sel,:,:,:,dataIndex)
-  endif
-endif
+! Then c_m
+do kk = 1, nki
+  do ii = 1, 2
+    phi_3(ii) = flamelet_interp_zm_zvar(nlibvar, nki, nxr, flamelet_library, &
+                                        ic_var, kk, i_xrm(ii, kk),           &
+                                        i_zm, w_zm, i_zvar, w_zvar)
+  enddo
+  xData(kk) = (1.d0-w_xrm(kk))*phi_3(1) + w_xrm(kk)*phi_3(2)
+enddo
+call flamelet_axis_weight(nki, xData, cm0, i_cm, w_cm)
 
-deallocate(xData)
+c_max_clip = (xData(1).lt.cm0 .and. xData(nki).le.cm0)
 
-! Then interpolate over z_var
-allocate(xData(nzvar))
-xData(:) = phi_4(2,1,1,:)
+end subroutine
 
-if(xData(1).ge.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,1)
-elseif(xData(size(xData)).le.zvar0) then
-  phi_3(:,:,:) = phi_4(:,:,:,nzvar)
-else
+!===============================================================================
+! Function:
+! ---------
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt.zvar0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
+!> \file cs_steady_laminar_flamelet_physical_prop.f90
+!>
+!> \brief Specific physic subroutine: diffusion flame.
+!>
+!> Interpolation of a library value over z_m and z_var
+!-------------------------------------------------------------------------------
 
-  weight_zvar = 0.d0
-  if(dataIndex .gt. 1) then
-    weight_zvar = (zvar0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    phi_3(:,:,:) = (1.0d0-weight_zvar)*phi_4(:,:,:,dataIndex-1) &
-      + weight_zvar*phi_4(:,:,:,dataIndex)
-  endif
-endif
+!-------------------------------------------------------------------------------
+! Arguments
+!______________________________________________________________________________.
+!  mode           name          role
+!______________________________________________________________________________!
+!> \param[in]     nv            number of library variables
+!> \param[in]     n2            second library dimension
+!> \param[in]     n3            third library dimension
+!> \param[in]     lib           library values
+!> \param[in]     iv            variable index
+!> \param[in]     i2            second dimension index
+!> \param[in]     i3            third dimension index
+!> \param[in]     i_zm          surrounding z_m indices
+!> \param[in]     w_zm          z_m upper index weight
+!> \param[in]     i_zvar        surrounding z_var indices
+!> \param[in]     w_zvar        z_var upper index weight
+!______________________________________________________________________________!
 
-deallocate(xData)
+double precision function flamelet_interp_zm_zvar(nv, n2, n3, lib,        &
+                                                  iv, i2, i3,             &
+                                                  i_zm, w_zm,             &
+                                                  i_zvar, w_zvar)
 
-! Then interpolate over XR_m
-allocate(xData2D(nki,nxr))
-xData2D(:,:) = phi_3(3,:,:)
-do i_ki = 1, nki
+use coincl, only: nzvar, nzm
 
-  if(xData2D(i_ki,1).ge.xrm0) then
-    phi_2(:,i_ki) = phi_3(:,i_ki,1)
-  elseif(xData2D(i_ki,nxr).le. xrm0) then
-    phi_2(:,i_ki) = phi_3(:,i_ki,nxr)
-  else
+implicit none
 
-    dataIndex = 1
-    do while(xData2D(i_ki,dataIndex) .lt. xrm0 &
-        .and. dataIndex .lt. nxr)
-      dataIndex = dataIndex + 1
-    enddo
+integer :: nv, n2, n3, iv, i2, i3, jj
+integer :: i_zm(2), i_zvar(2)
 
-    if(dataIndex .gt. 1) then
-      weight_xrm(i_ki) = (xrm0-xData2D(i_ki,dataIndex-1))/ &
-        (xData2D(i_ki,dataIndex)-xData2D(i_ki,dataIndex-1))
-      phi_2(:,i_ki) = (1.d0-weight_xrm(i_ki))*phi_3(:,i_ki,dataIndex-1) &
-        + weight_xrm(i_ki)*phi_3(:,i_ki,dataIndex)
-    endif
-  endif
+double precision :: lib(nv, n2, n3, nzvar, nzm)
+double precision :: w_zm, w_zvar, phi_4(2)
 
+do jj = 1, 2
+  phi_4(jj) =   (1.d0-w_zm)*lib(iv, i2, i3, i_zvar(jj), i_zm(1)) &
+              + w_zm*lib(iv, i2, i3, i_zvar(jj), i_zm(2))
 enddo
-deallocate(xData2D)
 
-! Then interpolate over c_m
-allocate(xData(nki))
-xData(:) = phi_2(5,:)
+flamelet_interp_zm_zvar = (1.d0-w_zvar)*phi_4(1) + w_zvar*phi_4(2)
 
-if(xData(1).ge.cm0) then
-  rhom = phi_2(4,1)
-elseif(xData(size(xData)).le.cm0) then
-  rhom = phi_2(4,nki)
-else
+end function
 
-  dataIndex = 1
-  do while(xData(dataIndex).lt. cm0 &
-      .and. dataIndex .lt. size(XData))
-    dataIndex = dataIndex + 1
-  enddo
+!===============================================================================
+! Function:
+! ---------
 
-  if(dataIndex .gt. 1) then
-    weight_cm = (cm0 - xData(dataIndex-1))/(xData(dataIndex)-xData(dataIndex-1))
-    rhom = (1.0d0-weight_cm)*phi_2(4,dataIndex-1) &
-      + weight_cm*phi_2(4,dataIndex)
-  endif
-endif
+!> \file cs_steady_laminar_flamelet_physical_prop.f90
+!>
+!> \brief Specific physic subroutine: diffusion flame.
+!>
+!> Interpolation of all library variables over z_m and z_var
+!-------------------------------------------------------------------------------
 
-deallocate(xData)
+!-------------------------------------------------------------------------------
+! Arguments
+!______________________________________________________________________________.
+!  mode           name          role
+!______________________________________________________________________________!
+!> \param[in]     nv            number of library variables
+!> \param[in]     n2            second library dimension
+!> \param[in]     n3            third library dimension
+!> \param[in]     lib           library values
+!> \param[in]     i2            second dimension index
+!> \param[in]     i3            third dimension index
+!> \param[in]     i_zm          surrounding z_m indices
+!> \param[in]     w_zm          z_m upper index weight
+!> \param[in]     i_zvar        surrounding z_var indices
+!> \param[in]     w_zvar        z_var upper index weight
+!> \param[out]    phi           interpolated values
+!______________________________________________________________________________!
+
+subroutine flamelet_interp_zm_zvar_v(nv, n2, n3, lib, i2, i3,            &
+                                     i_zm, w_zm, i_zvar, w_zvar, phi)
+
+use coincl, only: nzvar, nzm
+
+implicit none
+
+integer :: nv, n2, n3, i2, i3
+integer :: i_zm(2), i_zvar(2)
+
+double precision :: lib(nv, n2, n3, nzvar, nzm), phi(nv)
+double precision :: w_zm, w_zvar
 
-deallocate(phi_4,phi_3,phi_2)
+phi(:) =   (1.d0-w_zvar)                                           &
+         * (  (1.d0-w_zm)*lib(:, i2, i3, i_zvar(1), i_zm(1))       &
+            + w_zm*lib(:, i2, i3, i_zvar(1), i_zm(2)))             &
+         + w_zvar                                                  &
+         * (  (1.d0-w_zm)*lib(:, i2, i3, i_zvar(2), i_zm(1))       &
+            + w_zm*lib(:, i2, i3, i_zvar(2), i_zm(2)))
 
 end subroutine
 
@@ -167,15 +167,6 @@ cs_ctwr_volume_mass_injection_dof_func(cs_lnum_t         n_elts,
 
   int evap_model = ct_opt->evap_model;
 
-  /* Need to cook up the cell value of the liquid mass flux
-     In the old code, it seems to be taken as the value of the
-     face mass flux upstream of the cell */
-
-  cs_real_t v_air = 0.;
-
-  cs_real_t mass_flux_h = 0.; /* Highly suspicious for rain
-                                 zones - not recomputed */
-
   /* Compute the bulk volume mass source terms */
 
   /* Fields for source terms post-processing */
@@ -235,6 +226,7 @@ cs_ctwr_volume_mass_injection_dof_func(cs_lnum_t         n_elts,
 
     assert(n_elts == ct->n_cells);
 
+#   pragma omp parallel for if (n_elts > CS_THR_MIN)
     for (cs_lnum_t j = 0; j < n_elts; j++) {
 
       cs_lnum_t cell_id = elt_ids[j];
@@ -257,6 +249,12 @@ cs_ctwr_volume_mass_injection_dof_func(cs_lnum_t         n_elts,
        * Counter or cross flow packing zone         *
        *--------------------------------------------*/
 
+      /* Need to cook up the cell value of the liquid mass flux
+         In the old code, it seems to be taken as the value of the
+         face mass flux upstream of the cell */
+
+      cs_real_t v_air = 0.;
+
       /* Counter flow packing */
       if (zone_type == CS_CTWR_COUNTER_CURRENT)
         v_air = CS_ABS(cs_math_3_dot_product(vel_h[cell_id], vertical));
@@ -266,7 +264,7 @@ cs_ctwr_volume_mass_injection_dof_func(cs_lnum_t         n_elts,
         v_air = CS_ABS(cs_math_3_dot_product(vel_h[cell_id], horizontal));
 
       /* Dry air flux */
-      mass_flux_h = rho_h[cell_id] * v_air * (1. - ym_w[cell_id]);
+      cs_real_t mass_flux_h = rho_h[cell_id] * v_air * (1. - ym_w[cell_id]);
 
       /* Liquid mass flux */
       cs_real_t mass_flux_l = rho_m[cell_id] * y_l_p[cell_id] * vel_l[cell_id];
@@ -578,15 +576,6 @@ cs_ctwr_source_term(int              f_id,
   cs_ctwr_zone_t **_ct_zone = cs_get_glob_ctwr_zone();
   const int *_n_ct_zones = cs_get_glob_ctwr_n_zones();
 
-  /* Need to cook up the cell value of the liquid mass flux
-     In the old code, it seems to be taken as the value of the
-     face mass flux upstream of the cell */
-
-  cs_real_t v_air = 0.;
-
-  cs_real_t mass_flux_h = 0.; /* Highly suspicious for rain
-                                 zones - not recomputed */
-
   /* Identify the source term formulation for the required field */
 
   const cs_field_t *f = cs_field_by_id(f_id);
@@ -664,6 +653,7 @@ cs_ctwr_source_term(int              f_id,
 
       const cs_lnum_t *ze_cell_ids = cs_volume_zone_by_name(ct->name)->elt_ids;
 
+#     pragma omp parallel for if (ct->n_cells > CS_THR_MIN)
       for (cs_lnum_t j = 0; j < ct->n_cells; j++) {
 
         cs_lnum_t cell_id = ze_cell_ids[j];
@@ -689,6 +679,12 @@ cs_ctwr_source_term(int              f_id,
          * Counter or cross flow packing zone         *
          *--------------------------------------------*/
 
+        /* Need to cook up the cell value of the liquid mass flux
+           In the old code, it seems to be taken as the value of the
+           face mass flux upstream of the cell */
+
+        cs_real_t v_air = 0.;
+
         if (zone_type == CS_CTWR_COUNTER_CURRENT) {
           /* Counter flow packing */
           v_air = CS_ABS(cs_math_3_dot_product(vel_h[cell_id], vertical));
@@ -699,7 +695,7 @@ cs_ctwr_source_term(int              f_id,
         }
 
         /* Dry air flux */
-        mass_flux_h = rho_h[cell_id] * v_air * (1. - ym_w[cell_id]);
+        cs_real_t mass_flux_h = rho_h[cell_id] * v_air * (1. - ym_w[cell_id]);
 
         /* Liquid mass flux */
         cs_real_t mass_flux_l = rho_m[cell_id] * y_l_p[cell_id] * vel_l[cell_id];
@@ -856,6 +852,7 @@ cs_ctwr_source_term(int              f_id,
       cs_real_t *y_rain = (cs_real_t *)cfld_yp->val;
       cs_real_t *t_l_r = (cs_real_t *)cs_field_by_name("temp_l_r")->val;
 
+#     pragma omp parallel for if (m->n_cells > CS_THR_MIN)
       for (cs_lnum_t cell_id = 0; cell_id < m->n_cells; cell_id++) {
 
         if (y_rain[cell_id] > 0.) {
@@ -233,6 +233,49 @@ _boxes_intersect_1d(const cs_coord_t  *extents,
     return true;
 }
 
+/*----------------------------------------------------------------------------
+ * Check if a leaf is the reference leaf for the intersection of two boxes.
+ *
+ * Two intersecting boxes may be linked to several common leaves. To report
+ * each intersection only once, it is only kept in the leaf containing the
+ * minimum corner of the intersection of both boxes (using the same
+ * half-open convention as the Morton encoding used to build the tree).
+ * All boxes containing this point are linked to this leaf.
+ *
+ * parameters:
+ *   boxes <-- pointer to associated boxes structure
+ *   node  <-- pointer to leaf node
+ *   id_0  <-- id of first box
+ *   id_1  <-- id of second box
+ *
+ * returns:
+ *   true or false
+ *---------------------------------------------------------------------------*/
+
+inline static bool
+_is_ref_leaf(const fvm_box_set_t  *boxes,
+             const _node_t        *node,
+             cs_lnum_t             id_0,
+             cs_lnum_t             id_1)
+{
+  const int  dim = boxes->dim;
+  const cs_coord_t  *min_0 = _box_min(boxes, id_0);
+  const cs_coord_t  *min_1 = _box_min(boxes, id_1);
+
+  cs_coord_t  p[3];
+  for (int i = 0; i < dim; i++)
+    p[i] = CS_MAX(CS_MAX(min_0[i], min_1[i]), 0.);
+
+  fvm_morton_code_t  p_code = fvm_morton_encode(dim, node->morton_code.L, p);
+
+  for (int i = 0; i < dim; i++) {
+    if (p_code.X[i] != node->morton_code.X[i])
+      return false;
+  }
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Update octree stat structure (min, max, mean, box ratio, ...)
  *
@@ -1703,7 +1746,8 @@ _count_intersections(const fvm_box_tree_t  *bt,
         for (j = i+1; j < node->n_boxes; j++) {
           cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
           cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
-          if (_boxes_intersect_3d(box_extents, id0, id1)) {
+          if (   _boxes_intersect_3d(box_extents, id0, id1)
+              && _is_ref_leaf(boxes, node, id0, id1)) {
             count[id0] += 1;
             count[id1] += 1;
           }
@@ -1718,7 +1762,8 @@ _count_intersections(const fvm_box_tree_t  *bt,
         for (j = i+1; j < node->n_boxes; j++) {
           cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
           cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
-          if (_boxes_intersect_2d(box_extents, id0, id1)) {
+          if (   _boxes_intersect_2d(box_extents, id0, id1)
+              && _is_ref_leaf(boxes, node, id0, id1)) {
             count[id0] += 1;
             count[id1] += 1;
           }
@@ -1733,7 +1778,8 @@ _count_intersections(const fvm_box_tree_t  *bt,
         for (j = i+1; j < node->n_boxes; j++) {
           cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
           cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
-          if (_boxes_intersect_1d(box_extents, id0, id1)) {
+          if (   _boxes_intersect_1d(box_extents, id0, id1)
+              && _is_ref_leaf(boxes, node, id0, id1)) {
             count[id0] += 1;
             count[id1] += 1;
           }
@@ -1790,7 +1836,8 @@ _get_intersections(const fvm_box_tree_t  *bt,
           cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
           cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
 
-          if (_boxes_intersect_3d(box_extents, id0, id1)) {
+          if (   _boxes_intersect_3d(box_extents, id0, id1)
+              && _is_ref_leaf(boxes, node, id0, id1)) {
             cs_lnum_t   shift0 = box_index[id0] + count[id0];
             cs_lnum_t   shift1 = box_index[id1] + count[id1];
             box_g_num[shift0] = boxes->g_num[id1];
@@ -1808,7 +1855,8 @@ _get_intersections(const fvm_box_tree_t  *bt,
           cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
           cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
 
-          if (_boxes_intersect_2d(box_extents, id0, id1)) {
+          if (   _boxes_intersect_2d(box_extents, id0, id1)
+              && _is_ref_leaf(boxes, node, id0, id1)) {
             cs_lnum_t   shift0 = box_index[id0] + count[id0];
             cs_lnum_t   shift1 = box_index[id1] + count[id1];
             box_g_num[shift0] = boxes->g_num[id1];
@@ -1827,7 +1875,8 @@ _get_intersections(const fvm_box_tree_t  *bt,
           cs_lnum_t   id0 = bt->box_ids[node->start_id + i];
           cs_lnum_t   id1 = bt->box_ids[node->start_id + j];
 
-          if (_boxes_intersect_1d(box_extents, id0, id1)) {
+          if (   _boxes_intersect_1d(box_extents, id0, id1)
+              && _is_ref_leaf(boxes, node, id0, id1)) {
             cs_lnum_t   shift0 = box_index[id0] + count[id0];
             cs_lnum_t   shift1 = box_index[id1] + count[id1];
             box_g_num[shift0] = boxes->g_num[id1];
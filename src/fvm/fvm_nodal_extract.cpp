@@ -707,6 +707,45 @@ _update_extents(int               dim,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Adjust extents of the leaf (cell of a regular subdivision of the mesh
+ * extents) containing the center of given element extents.
+ *
+ * parameters:
+ *   dim          <-- spatial (coordinates) dimension
+ *   n_div        <-- number of subdivisions per direction
+ *   mesh_extents <-- extents of subdivided mesh (size: 2*dim)
+ *   elt_extents  <-- extents associated with element (size: 2*dim)
+ *   leaf_extents <-> extents associated with leaves
+ *                    (size: n_div^dim * 2*dim)
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_update_leaf_extents(int                     dim,
+                     int                     n_div,
+                     const double  *restrict mesh_extents,
+                     double        *restrict elt_extents,
+                     double        *restrict leaf_extents)
+{
+  cs_lnum_t leaf_id = 0;
+
+  for (int i = dim - 1; i > -1; i--) {
+    int l = 0;
+    double w = mesh_extents[i+dim] - mesh_extents[i];
+    if (w > 0) {
+      double c = 0.5*(elt_extents[i] + elt_extents[i+dim]);
+      l = (int)((c - mesh_extents[i]) / w * n_div);
+      if (l < 0)
+        l = 0;
+      else if (l >= n_div)
+        l = n_div - 1;
+    }
+    leaf_id = leaf_id*n_div + l;
+  }
+
+  _update_extents(dim, elt_extents, leaf_extents + leaf_id*2*dim);
+}
+
 /*----------------------------------------------------------------------------
  * Compute extents of a nodal mesh representation section
  *
@@ -717,8 +756,12 @@ _update_extents(int               dim,
  *   vertex_coords    <-- pointer to vertex coordinates
  *   tolerance        <-- addition to local extents of each element:
  *                        extent = base_extent * (1 + tolerance)
+ *   n_div            <-- number of leaf subdivisions per direction
+ *   mesh_extents     <-- extents of subdivided mesh, or nullptr
  *   extents          <-> extents associated with section:
  *                        x_min, y_min, ..., x_max, y_max, ... (size: 2*dim)
+ *   leaf_extents     <-> optional extents associated with leaves
+ *                        (size: n_div^dim * 2*dim), or nullptr
  *----------------------------------------------------------------------------*/
 
 static void
@@ -727,7 +770,10 @@ _nodal_section_extents(const fvm_nodal_section_t  *this_section,
                        const cs_lnum_t            *parent_vertex_id,
                        const cs_coord_t            vertex_coords[],
                        double                      tolerance,
-                       double                      extents[])
+                       int                         n_div,
+                       const double                mesh_extents[],
+                       double                      extents[],
+                       double                      leaf_extents[])
 {
   cs_lnum_t   i, j, k, face_id, vertex_id;
   double elt_extents[6];
@@ -767,6 +813,9 @@ _nodal_section_extents(const fvm_nodal_section_t  *this_section,
 
       _elt_extents_finalize(dim, 3, tolerance, elt_extents);
       _update_extents(dim, elt_extents, extents);
+      if (leaf_extents != nullptr)
+        _update_leaf_extents(dim, n_div, mesh_extents,
+                             elt_extents, leaf_extents);
 
     }
 
@@ -799,6 +848,9 @@ _nodal_section_extents(const fvm_nodal_section_t  *this_section,
 
       _elt_extents_finalize(dim, 2, tolerance, elt_extents);
       _update_extents(dim, elt_extents, extents);
+      if (leaf_extents != nullptr)
+        _update_leaf_extents(dim, n_div, mesh_extents,
+                             elt_extents, leaf_extents);
 
     }
 
@@ -830,6 +882,9 @@ _nodal_section_extents(const fvm_nodal_section_t  *this_section,
                             tolerance,
                             elt_extents);
       _update_extents(dim, elt_extents, extents);
+      if (leaf_extents != nullptr)
+        _update_leaf_extents(dim, n_div, mesh_extents,
+                             elt_extents, leaf_extents);
 
     }
   }
@@ -1448,7 +1503,10 @@ fvm_nodal_extents(const fvm_nodal_t  *this_nodal,
                            this_nodal->parent_vertex_id,
                            this_nodal->vertex_coords,
                            tolerance,
-                           section_extents);
+                           0,
+                           nullptr,
+                           section_extents,
+                           nullptr);
 
     for (j = 0; j < this_nodal->dim; j++) {
       if (section_extents[j] < extents[j])
@@ -1459,6 +1517,103 @@ fvm_nodal_extents(const fvm_nodal_t  *this_nodal,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Compute extents of subsets of a nodal mesh representation.
+ *
+ * Mesh extents are subdivided regularly in 2^l parts in each direction
+ * (as for leaves of an octree of level l), with l the highest level such
+ * that the number of leaves does not exceed n_max_extents. Each element
+ * is assigned to the leaf containing the center of its extents, and the
+ * extents of non-empty leaves are reduced to those of their elements, so
+ * the union of sub-extents contains all elements.
+ *
+ * parameters:
+ *   this_nodal    <-- pointer to mesh representation structure
+ *   tolerance     <-- addition to local extents of each element:
+ *                     extent = base_extent * (1 + tolerance)
+ *   n_max_extents <-- maximum number of sub-extents
+ *   extents       <-> extents associated with mesh subsets:
+ *                     x_min_0, y_min_0, ..., x_max_i, y_max_i, ...
+ *                     (size: 2*dim*n_max_extents)
+ *
+ * returns:
+ *   number of non-empty sub-extents
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+fvm_nodal_sub_extents(const fvm_nodal_t  *this_nodal,
+                      double              tolerance,
+                      cs_lnum_t           n_max_extents,
+                      double              extents[])
+{
+  if (this_nodal == nullptr || n_max_extents < 1)
+    return 0;
+
+  const int dim = this_nodal->dim;
+  const int stride = dim*2;
+
+  /* Determine number of subdivisions */
+
+  int n_div = 1;
+  cs_lnum_t n_leaves = 1;
+  while (n_leaves * (1 << dim) <= n_max_extents) {
+    n_div *= 2;
+    n_leaves *= (1 << dim);
+  }
+
+  double mesh_extents[6];
+  fvm_nodal_extents(this_nodal, tolerance, mesh_extents);
+
+  if (n_div == 1 || mesh_extents[0] > mesh_extents[dim]) {
+    for (int j = 0; j < stride; j++)
+      extents[j] = mesh_extents[j];
+    return (mesh_extents[0] > mesh_extents[dim]) ? 0 : 1;
+  }
+
+  double *leaf_extents;
+  BFT_MALLOC(leaf_extents, n_leaves*stride, double);
+
+  for (cs_lnum_t i = 0; i < n_leaves; i++) {
+    for (int j = 0; j < dim; j++) {
+      leaf_extents[i*stride + j]       =  HUGE_VAL;
+      leaf_extents[i*stride + j + dim] = -HUGE_VAL;
+    }
+  }
+
+  for (int i = 0; i < this_nodal->n_sections; i++) {
+
+    double section_extents[6];
+
+    _nodal_section_extents(this_nodal->sections[i],
+                           this_nodal->dim,
+                           this_nodal->parent_vertex_id,
+                           this_nodal->vertex_coords,
+                           tolerance,
+                           n_div,
+                           mesh_extents,
+                           section_extents,
+                           leaf_extents);
+
+  }
+
+  /* Compact non-empty leaves */
+
+  cs_lnum_t n_extents = 0;
+
+  for (cs_lnum_t i = 0; i < n_leaves; i++) {
+    const double *l_extents = leaf_extents + i*stride;
+    if (l_extents[0] > l_extents[dim])
+      continue;
+    for (int j = 0; j < stride; j++)
+      extents[n_extents*stride + j] = l_extents[j];
+    n_extents++;
+  }
+
+  BFT_FREE(leaf_extents);
+
+  return n_extents;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
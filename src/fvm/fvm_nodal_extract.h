@@ -192,6 +192,35 @@ fvm_nodal_extents(const fvm_nodal_t  *this_nodal,
                   double              tolerance,
                   double              extents[]);
 
+/*----------------------------------------------------------------------------
+ * Compute extents of subsets of a nodal mesh representation.
+ *
+ * Mesh extents are subdivided regularly in 2^l parts in each direction
+ * (as for leaves of an octree of level l), with l the highest level such
+ * that the number of leaves does not exceed n_max_extents. Each element
+ * is assigned to the leaf containing the center of its extents, and the
+ * extents of non-empty leaves are reduced to those of their elements, so
+ * the union of sub-extents contains all elements.
+ *
+ * parameters:
+ *   this_nodal    <-- pointer to mesh representation structure
+ *   tolerance     <-- addition to local extents of each element:
+ *                     extent = base_extent * (1 + tolerance)
+ *   n_max_extents <-- maximum number of sub-extents
+ *   extents       <-> extents associated with mesh subsets:
+ *                     x_min_0, y_min_0, ..., x_max_i, y_max_i, ...
+ *                     (size: 2*dim*n_max_extents)
+ *
+ * returns:
+ *   number of non-empty sub-extents
+ *----------------------------------------------------------------------------*/
+
+cs_lnum_t
+fvm_nodal_sub_extents(const fvm_nodal_t  *this_nodal,
+                      double              tolerance,
+                      cs_lnum_t           n_max_extents,
+                      double              extents[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
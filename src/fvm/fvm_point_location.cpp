@@ -67,6 +67,10 @@ BEGIN_C_DECLS
  * Local macro definitions
  *============================================================================*/
 
+/* Number of points handled together in element location tests */
+
+#define _POINT_PACKET_SIZE 8
+
 /* In case <math.h> does not define HUGE_VAL, use a "safe" value */
 #if !defined(HUGE_VAL)
 #define HUGE_VAL 1.0e+30
@@ -1815,80 +1819,88 @@ _locate_in_tetra(cs_lnum_t         elt_num,
                  cs_lnum_t         location[],
                  float             distance[])
 {
-  double vol6;
-  double dist, max_dist;
-  int i, j, k;
+  double v01[3], v02[3], v03[3];
 
-  double isop_0, isop_1, isop_2;
-  double t00, t10, t20, t01, t02, t03, t11, t12, t13, t21, t22, t23;
-  double v01[3], v02[3], v03[3], shapef[4];
-
-  for (i = 0; i < 3; i++) {
+  for (int i = 0; i < 3; i++) {
     v01[i] = tetra_coords[1][i] - tetra_coords[0][i];
     v02[i] = tetra_coords[2][i] - tetra_coords[0][i];
     v03[i] = tetra_coords[3][i] - tetra_coords[0][i];
   }
 
-  vol6 = fabs(  v01[0] * (v02[1]*v03[2] - v02[2]*v03[1])
-              - v02[0] * (v01[1]*v03[2] - v01[2]*v03[1])
-              + v03[0] * (v01[1]*v02[2] - v01[2]*v02[1]));
+  const double vol6 = fabs(  v01[0] * (v02[1]*v03[2] - v02[2]*v03[1])
+                           - v02[0] * (v01[1]*v03[2] - v01[2]*v03[1])
+                           + v03[0] * (v01[1]*v02[2] - v01[2]*v02[1]));
 
   if (vol6 < _epsilon_denom)
     return;
 
-  for (k = 0; k < n_points_in_extents; k++) {
+  /* Parametric coordinates are obtained from the point's position relative
+     to the first vertex by a product with the (scaled) cofactor matrix,
+     which depends only on the element. */
+
+  const double vol6_inv = 1. / vol6;
 
-    i = points_in_extents[k];
+  const double m[3][3]
+    = {{ (v02[1]*v03[2] - v02[2]*v03[1]) * vol6_inv,
+        -(v02[0]*v03[2] - v02[2]*v03[0]) * vol6_inv,
+         (v02[0]*v03[1] - v02[1]*v03[0]) * vol6_inv},
+       {-(v01[1]*v03[2] - v01[2]*v03[1]) * vol6_inv,
+         (v01[0]*v03[2] - v01[2]*v03[0]) * vol6_inv,
+        -(v01[0]*v03[1] - v01[1]*v03[0]) * vol6_inv},
+       { (v01[1]*v02[2] - v01[2]*v02[1]) * vol6_inv,
+        -(v01[0]*v02[2] - v01[2]*v02[0]) * vol6_inv,
+         (v01[0]*v02[1] - v01[1]*v02[0]) * vol6_inv}};
 
-    t00  =   point_coords[i*3]     - tetra_coords[0][0];
-    t10  =   point_coords[i*3 + 1] - tetra_coords[0][1];
-    t20  =   point_coords[i*3 + 2] - tetra_coords[0][2];
+  const double max_dist_tol = 1. + 2.*tolerance;
 
-    t01  = - tetra_coords[0][0] + tetra_coords[1][0];
-    t02  = - tetra_coords[0][0] + tetra_coords[2][0];
-    t03  = - tetra_coords[0][0] + tetra_coords[3][0];
+  /* Handle points by packets, so that the computation of distances
+     may be vectorized, separately from the gather and update steps */
 
-    t11  = - tetra_coords[0][1] + tetra_coords[1][1];
-    t12  = - tetra_coords[0][1] + tetra_coords[2][1];
-    t13  = - tetra_coords[0][1] + tetra_coords[3][1];
+  for (cs_lnum_t k_s = 0;
+       k_s < n_points_in_extents;
+       k_s += _POINT_PACKET_SIZE) {
 
-    t21  = - tetra_coords[0][2] + tetra_coords[1][2];
-    t22  = - tetra_coords[0][2] + tetra_coords[2][2];
-    t23  = - tetra_coords[0][2] + tetra_coords[3][2];
+    const int n_p = CS_MIN(_POINT_PACKET_SIZE, n_points_in_extents - k_s);
+    const cs_lnum_t *p_ids = points_in_extents + k_s;
 
-    isop_0 = (  t00 * (t12*t23 - t13*t22)
-              - t10 * (t02*t23 - t22*t03)
-              + t20 * (t02*t13 - t12*t03)) / vol6;
-    isop_1 = (- t00 * (t11*t23 - t13*t21)
-              + t10 * (t01*t23 - t21*t03)
-              - t20 * (t01*t13 - t03*t11)) / vol6;
-    isop_2 = (  t00 * (t11*t22 - t21*t12)
-              - t10 * (t01*t22 - t21*t02)
-              + t20 * (t01*t12 - t11*t02)) / vol6;
+    double x[_POINT_PACKET_SIZE], y[_POINT_PACKET_SIZE];
+    double z[_POINT_PACKET_SIZE], max_dist[_POINT_PACKET_SIZE];
 
-    shapef[0] = 1. - isop_0 - isop_1 - isop_2;
-    shapef[1] =      isop_0;
-    shapef[2] =               isop_1;
-    shapef[3] =                        isop_2;
+    for (int l = 0; l < n_p; l++) {
+      const cs_coord_t *p_coords = point_coords + p_ids[l]*3;
+      x[l] = p_coords[0] - tetra_coords[0][0];
+      y[l] = p_coords[1] - tetra_coords[0][1];
+      z[l] = p_coords[2] - tetra_coords[0][2];
+    }
+
+#   pragma omp simd
+    for (int l = 0; l < n_p; l++) {
 
-    max_dist = -1.0;
+      const double isop_0 = m[0][0]*x[l] + m[0][1]*y[l] + m[0][2]*z[l];
+      const double isop_1 = m[1][0]*x[l] + m[1][1]*y[l] + m[1][2]*z[l];
+      const double isop_2 = m[2][0]*x[l] + m[2][1]*y[l] + m[2][2]*z[l];
 
-    for (j = 0; j < 4; j++){
+      const double d0 = 2.*fabs(0.5 - isop_0 - isop_1 - isop_2);
+      const double d1 = 2.*fabs(isop_0 - 0.5);
+      const double d2 = 2.*fabs(isop_1 - 0.5);
+      const double d3 = 2.*fabs(isop_2 - 0.5);
 
-      dist = 2.*CS_ABS(shapef[j] - 0.5);
+      const double d01 = (d0 > d1) ? d0 : d1;
+      const double d23 = (d2 > d3) ? d2 : d3;
 
-      if (max_dist < dist)
-        max_dist = dist;
+      max_dist[l] = (d01 > d23) ? d01 : d23;
     }
 
-    if (   (max_dist > -0.5 && max_dist < (1. + 2.*tolerance))
-        && (max_dist < distance[i] || distance[i] < 0)) {
-      location[i] = elt_num;
-      distance[i] = max_dist;
+    for (int l = 0; l < n_p; l++) {
+      const cs_lnum_t i = p_ids[l];
+      if (   max_dist[l] < max_dist_tol
+          && (max_dist[l] < distance[i] || distance[i] < 0)) {
+        location[i] = elt_num;
+        distance[i] = max_dist[l];
+      }
     }
 
   }
-
 }
 
 /*---------------------------------------------------------------------------
@@ -44,6 +44,7 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "cs_map.h"
 #include "cs_timer.h"
 
 #include "fvm_defs.h"
@@ -86,6 +87,9 @@ typedef struct {
 
   fvm_selector_postfix_t **postfix;    /* Array of postfix operations */
 
+  cs_map_name_to_id_t *infix_map;      /* Map from criteria strings to
+                                          operation ids */
+
   size_t *n_calls;                     /* Number of calls per operation */
 
   int    *n_group_classes;             /* Array of group class numbers
@@ -502,6 +506,8 @@ _operation_list_allocate(void)
              ops->n_max_operations,
              fvm_selector_postfix_t *);
 
+  ops->infix_map = cs_map_name_to_id_create();
+
   BFT_MALLOC(ops->n_calls, ops->n_max_operations, size_t);
 
   BFT_MALLOC(ops->n_group_classes, ops->n_max_operations, int);
@@ -581,6 +587,7 @@ _operation_list_free(_operation_list_t  *ops)
     }
     BFT_FREE(ops->postfix);
     BFT_FREE(ops->group_class_set);
+    cs_map_name_to_id_destroy(&(ops->infix_map));
     BFT_FREE(ops);
   }
 
@@ -720,15 +727,17 @@ _get_criteria_id(fvm_selector_t  *selector,
   if (selector->_operations == nullptr)
     selector->_operations = _operation_list_allocate();
 
-  for (op = 0; op < selector->_operations->n_operations; op++) {
-    const fvm_selector_postfix_t *pf = selector->_operations->postfix[op];
-    if (!strcmp(fvm_selector_postfix_get_infix(pf), teststr))
-      break;
-  }
+  op = cs_map_name_to_id_try(selector->_operations->infix_map, teststr);
 
   /* if teststr is not in the list : add teststrcpy in the list */
-  if (op == selector->_operations->n_operations)
+  if (op < 0) {
+    op = selector->_operations->n_operations;
     _add_new_operation(selector, teststr);
+    int map_id = cs_map_name_to_id(selector->_operations->infix_map,
+                                   teststr);
+    assert(map_id == op);
+    CS_NO_WARN_IF_UNUSED(map_id);
+  }
 
   return op;
 }
@@ -1014,20 +1023,36 @@ fvm_selector_get_list(fvm_selector_t  *this_selector,
                     "for 3 spatial dimension."),
                   str, dim);
 
-    /* Loop on all elements */
+    /* Loop on all elements, by blocks, so that the expression is
+       traversed only once per block */
 
-    for (i = 0; i < ts->n_elements; i++) {
+    const cs_lnum_t block_size = 256;
+    int gc_ids[256];
+    bool is_selected[256];
 
-      gc_id = ts->group_class_id[i] - ts->group_class_id_base;
+    for (cs_lnum_t s_id = 0; s_id < ts->n_elements; s_id += block_size) {
 
-      if (fvm_selector_postfix_eval(pf,
-                                    ts->n_class_groups[gc_id],
-                                    ts->n_class_attributes[gc_id],
-                                    ts->group_ids[gc_id],
-                                    ts->attribute_ids[gc_id],
-                                    ts->coords + (i*dim),
-                                    ts->normals + (i*dim)))
-        selected_elements[(*n_selected_elements)++] = i + elt_id_base;
+      cs_lnum_t n_b_elts = CS_MIN(block_size, ts->n_elements - s_id);
+
+      for (i = 0; i < n_b_elts; i++)
+        gc_ids[i] = ts->group_class_id[s_id + i] - ts->group_class_id_base;
+
+      fvm_selector_postfix_eval_block
+        (pf,
+         n_b_elts,
+         gc_ids,
+         ts->n_class_groups,
+         ts->n_class_attributes,
+         ts->group_ids,
+         ts->attribute_ids,
+         (ts->coords != nullptr) ? ts->coords + s_id*dim : nullptr,
+         (ts->normals != nullptr) ? ts->normals + s_id*dim : nullptr,
+         is_selected);
+
+      for (i = 0; i < n_b_elts; i++) {
+        if (is_selected[i])
+          selected_elements[(*n_selected_elements)++] = s_id + i + elt_id_base;
+      }
 
     }
   }
@@ -2840,6 +2840,129 @@ _eval_coord_le(const fvm_selector_postfix_t  *pf,
   return (coords[coord_id] <= cmp_val ? true : false);
 }
 
+/*----------------------------------------------------------------------------
+ * Read the arguments of a coordinate condition in a postfix expression
+ *
+ * parameters:
+ *   pf        <-- pointer to postfix structure
+ *   i         <-> current position in expression being evaluated
+ *   coord_id  --> id of compared coordinate
+ *   cmp_val   --> comparison value
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_read_coord_cond(const fvm_selector_postfix_t  *pf,
+                 size_t                        *i,
+                 int                           *coord_id,
+                 double                        *cmp_val)
+{
+  assert(*((_postfix_type_t *)(pf->elements + *i)) == PF_INT);
+  *i += _postfix_type_size;
+  *coord_id = *((int *)(pf->elements + *i));
+  *i += _postfix_int_size + _postfix_type_size;
+  assert(*((_postfix_type_t *)(pf->elements + *i - _postfix_type_size))
+         == PF_FLOAT);
+  *cmp_val = *((double *)(pf->elements + *i));
+  *i += _postfix_float_size;
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate a geometric function or condition of a postfix expression
+ * for a block of elements.
+ *
+ * Coordinate comparisons are decoded once and applied to all elements;
+ * for other functions, arguments are decoded for each element, but
+ * the expression is still traversed only once for the whole block.
+ *
+ * parameters:
+ *   pf        <-- pointer to postfix structure
+ *   oc        <-- operator code
+ *   n_elts    <-- number of elements in block (> 0)
+ *   coords    <-- coordinates associated with block (interlaced)
+ *   normals   <-- normals associated with block (interlaced)
+ *   i         <-> current position in expression being evaluated
+ *   retval    --> evaluation result for each element
+ *----------------------------------------------------------------------------*/
+
+static void
+_eval_geom_block(const fvm_selector_postfix_t  *pf,
+                 _operator_code_t               oc,
+                 cs_lnum_t                      n_elts,
+                 const double                   coords[],
+                 const double                   normals[],
+                 size_t                        *i,
+                 bool                           retval[])
+{
+  const size_t i_0 = *i;
+
+  switch(oc) {
+
+  case OC_NORMAL:
+    for (cs_lnum_t k = 0; k < n_elts; k++) {
+      *i = i_0;
+      retval[k] = _eval_normal(pf, normals + 3*k, i);
+    }
+    break;
+  case OC_PLANE:
+    for (cs_lnum_t k = 0; k < n_elts; k++) {
+      *i = i_0;
+      retval[k] = _eval_plane(pf, coords + 3*k, i);
+    }
+    break;
+  case OC_BOX:
+    for (cs_lnum_t k = 0; k < n_elts; k++) {
+      *i = i_0;
+      retval[k] = _eval_box(pf, coords + 3*k, i);
+    }
+    break;
+  case OC_CYLINDER:
+    for (cs_lnum_t k = 0; k < n_elts; k++) {
+      *i = i_0;
+      retval[k] = _eval_cylinder(pf, coords + 3*k, i);
+    }
+    break;
+  case OC_SPHERE:
+    for (cs_lnum_t k = 0; k < n_elts; k++) {
+      *i = i_0;
+      retval[k] = _eval_sphere(pf, coords + 3*k, i);
+    }
+    break;
+
+  case OC_GT:
+  case OC_LT:
+  case OC_GE:
+  case OC_LE:
+    {
+      int c_id;
+      double v;
+      _read_coord_cond(pf, i, &c_id, &v);
+      const double *c = coords + c_id;
+      if (oc == OC_GT) {
+        for (cs_lnum_t k = 0; k < n_elts; k++)
+          retval[k] = (c[3*k] > v);
+      }
+      else if (oc == OC_LT) {
+        for (cs_lnum_t k = 0; k < n_elts; k++)
+          retval[k] = (c[3*k] < v);
+      }
+      else if (oc == OC_GE) {
+        for (cs_lnum_t k = 0; k < n_elts; k++)
+          retval[k] = (c[3*k] >= v);
+      }
+      else {
+        for (cs_lnum_t k = 0; k < n_elts; k++)
+          retval[k] = (c[3*k] <= v);
+      }
+    }
+    break;
+
+  default:
+    bft_error(__FILE__, __LINE__, 0,
+              _("Operator %s not currently implemented."),
+              _operator_name[oc]);
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -3252,6 +3375,213 @@ fvm_selector_postfix_eval(const fvm_selector_postfix_t  *pf,
   return retval;
 }
 
+/*----------------------------------------------------------------------------
+ * Evaluate a postfix expression for a block of elements.
+ *
+ * The expression is traversed only once for the whole block, each operand
+ * or operator being applied to all elements of the block in turn, which
+ * is much cheaper than calling fvm_selector_postfix_eval() for
+ * each element when the expression depends on coordinates or normals.
+ *
+ * Coordinates and normals are assumed to be 3-dimensional.
+ *
+ * parameters:
+ *   pf             <-- pointer to postfix structure
+ *   n_elts         <-- number of elements in block
+ *   gc_id          <-- group class id (0 to n-1) of each element
+ *   n_class_groups <-- number of groups associated with each group class
+ *   n_class_attrs  <-- number of attributes associated with each group class
+ *   group_ids      <-- group ids associated with each group class
+ *   attribute_ids  <-- attribute ids associated with each group class
+ *   coords         <-- coordinates associated with block elements
+ *                      (interlaced), or nullptr
+ *   normals        <-- normals associated with block elements
+ *                      (interlaced), or nullptr
+ *   retval         --> result of expression evaluation for each element
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_selector_postfix_eval_block(const fvm_selector_postfix_t  *pf,
+                                cs_lnum_t                      n_elts,
+                                const int                      gc_id[],
+                                const int                      n_class_groups[],
+                                const int                      n_class_attrs[],
+                                const int              *const  group_ids[],
+                                const int              *const  attribute_ids[],
+                                const double                   coords[],
+                                const double                   normals[],
+                                bool                           retval[])
+{
+  size_t i = 0, eval_size = 0, eval_max_size = BASE_STACK_SIZE;
+  bool *eval_stack = nullptr;
+
+  if (n_elts < 1)
+    return;
+
+  BFT_MALLOC(eval_stack, eval_max_size*n_elts, bool);
+
+  /* Evaluate postfix_string */
+
+  while (i < pf->size) {
+
+    _postfix_type_t type = *((_postfix_type_t *)(pf->elements + i));
+
+    i += _postfix_type_size;
+
+    bool *s = eval_stack + eval_size*n_elts;
+
+    switch(type) {
+
+    case PF_GROUP_ID:
+    case PF_ATTRIBUTE_ID:
+      {
+        int val = *((int *)(pf->elements + i));
+        i += _postfix_int_size;
+        const int *n_ids
+          = (type == PF_GROUP_ID) ? n_class_groups : n_class_attrs;
+        const int *const *ids
+          = (type == PF_GROUP_ID) ? group_ids : attribute_ids;
+        for (cs_lnum_t k = 0; k < n_elts; k++) {
+          const int *_ids = ids[gc_id[k]];
+          s[k] = false;
+          for (int j = 0; j < n_ids[gc_id[k]]; j++) {
+            if (val == _ids[j]) {
+              s[k] = true;
+              break;
+            }
+          }
+        }
+        eval_size++;
+      }
+      break;
+    case PF_OPCODE:
+      {
+        size_t min_eval_size;
+        _operator_code_t oc = *((_operator_code_t *)(pf->elements + i));
+        i += _postfix_opcode_size;
+
+        if (oc == OC_NOT)
+          min_eval_size = 1;
+        else if (oc >= OC_AND && oc <= OC_XOR)
+          min_eval_size = 2;
+        else
+          min_eval_size = 0;
+
+        if (eval_size < min_eval_size) {
+          fvm_selector_postfix_dump(pf, 0, 0, nullptr, nullptr);
+          bft_error(__FILE__, __LINE__, 0,
+                    _("Postfix evaluation error."));
+        }
+
+        bool *s1 = s - n_elts, *s2 = s - 2*n_elts;
+
+        switch(oc) {
+
+        case OC_NOT:
+          for (cs_lnum_t k = 0; k < n_elts; k++)
+            s1[k] = !s1[k];
+          break;
+        case OC_AND:
+          for (cs_lnum_t k = 0; k < n_elts; k++)
+            s2[k] = (s2[k] && s1[k]);
+          eval_size--;
+          break;
+        case OC_OR:
+          for (cs_lnum_t k = 0; k < n_elts; k++)
+            s2[k] = (s2[k] || s1[k]);
+          eval_size--;
+          break;
+        case OC_XOR:
+          for (cs_lnum_t k = 0; k < n_elts; k++)
+            s2[k] = (s2[k] != s1[k]);
+          eval_size--;
+          break;
+
+        case OC_ALL:
+          for (cs_lnum_t k = 0; k < n_elts; k++)
+            s[k] = true;
+          eval_size++;
+          break;
+        case OC_NO_GROUP:
+          for (cs_lnum_t k = 0; k < n_elts; k++)
+            s[k] = (   n_class_groups[gc_id[k]] == 0
+                    && n_class_attrs[gc_id[k]] == 0);
+          eval_size++;
+          break;
+
+        case OC_RANGE:
+          {
+            _postfix_type_t type1, type2;
+            int val1, val2;
+
+            type1 = *((_postfix_type_t *)(pf->elements + i));
+            i += _postfix_type_size;
+            val1 = *((int *)(pf->elements + i));
+            i += _postfix_int_size;
+            type2 = *((_postfix_type_t *)(pf->elements + i));
+            i += _postfix_type_size;
+            val2 = *((int *)(pf->elements + i));
+            i += _postfix_int_size;
+
+            if (   (type1 != PF_GROUP_ID && type1 != PF_ATTRIBUTE_ID)
+                || type1 != type2) {
+              fvm_selector_postfix_dump(pf, 0, 0, nullptr, nullptr);
+              bft_error(__FILE__, __LINE__, 0,
+                        _("Postfix error: "
+                          "range arguments of different or incorrect type."));
+            }
+
+            const int *n_ids
+              = (type1 == PF_GROUP_ID) ? n_class_groups : n_class_attrs;
+            const int *const *ids
+              = (type1 == PF_GROUP_ID) ? group_ids : attribute_ids;
+            for (cs_lnum_t k = 0; k < n_elts; k++) {
+              const int *_ids = ids[gc_id[k]];
+              s[k] = false;
+              for (int j = 0; j < n_ids[gc_id[k]]; j++) {
+                if (_ids[j] >= val1 && _ids[j] <= val2) {
+                  s[k] = true;
+                  break;
+                }
+              }
+            }
+          }
+          eval_size++;
+          break;
+
+        default:
+          _eval_geom_block(pf, oc, n_elts, coords, normals, &i, s);
+          eval_size++;
+
+        } /* End of inside (operator) switch */
+
+      }
+      break;
+
+    default:
+      fvm_selector_postfix_dump(pf, 0, 0, nullptr, nullptr);
+      bft_error(__FILE__, __LINE__, 0,
+                _("Postfix evaluation error."));
+    }
+
+    if (eval_size == eval_max_size) {
+      eval_max_size *= 2;
+      BFT_REALLOC(eval_stack, eval_max_size*n_elts, bool);
+    }
+
+  } /* End of loop on postfix elements */
+
+  if (eval_size != 1) {
+    fvm_selector_postfix_dump(pf, 0, 0, nullptr, nullptr);
+    bft_error(__FILE__, __LINE__, 0,
+              _("Postfix evaluation error."));
+  }
+
+  memcpy(retval, eval_stack, n_elts*sizeof(bool));
+
+  BFT_FREE(eval_stack);
+}
+
 /*----------------------------------------------------------------------------
  * Dump the contents of a postfix structure in human readable form
  *
@@ -179,6 +179,43 @@ fvm_selector_postfix_eval(const fvm_selector_postfix_t  *pf,
                           const double                   coords[],
                           const double                   normal[]);
 
+/*----------------------------------------------------------------------------
+ * Evaluate a postfix expression for a block of elements.
+ *
+ * The expression is traversed only once for the whole block, each operand
+ * or operator being applied to all elements of the block in turn, which
+ * is much cheaper than calling fvm_selector_postfix_eval() for
+ * each element when the expression depends on coordinates or normals.
+ *
+ * Coordinates and normals are assumed to be 3-dimensional.
+ *
+ * parameters:
+ *   pf             <-- pointer to postfix structure
+ *   n_elts         <-- number of elements in block
+ *   gc_id          <-- group class id (0 to n-1) of each element
+ *   n_class_groups <-- number of groups associated with each group class
+ *   n_class_attrs  <-- number of attributes associated with each group class
+ *   group_ids      <-- group ids associated with each group class
+ *   attribute_ids  <-- attribute ids associated with each group class
+ *   coords         <-- coordinates associated with block elements
+ *                      (interlaced), or NULL
+ *   normals        <-- normals associated with block elements
+ *                      (interlaced), or NULL
+ *   retval         --> result of expression evaluation for each element
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_selector_postfix_eval_block(const fvm_selector_postfix_t  *pf,
+                                cs_lnum_t                      n_elts,
+                                const int                      gc_id[],
+                                const int                      n_class_groups[],
+                                const int                      n_class_attrs[],
+                                const int              *const  group_ids[],
+                                const int              *const  attribute_ids[],
+                                const double                   coords[],
+                                const double                   normals[],
+                                bool                           retval[]);
+
 /*----------------------------------------------------------------------------
  * Dump the contents of a postfix structure in human readable form
  *
@@ -233,6 +233,14 @@ struct _fvm_tesselation_t {
   cs_lnum_t         *_sub_elt_index[2];  /* sub_elt_index if owner,
                                             nullptr if shared */
 
+  /* Polyhedra vertex lists (used to compute values at added vertices) */
+
+  cs_lnum_t         *_vertex_list_idx;   /* index of distinct vertices of
+                                            each polyhedron, or nullptr */
+  cs_lnum_t         *_vertex_list;       /* distinct vertex ids (0 to n-1)
+                                            of each polyhedron, in
+                                            increasing order */
+
 };
 
 /*============================================================================
@@ -243,6 +251,27 @@ struct _fvm_tesselation_t {
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Return pointer to the coordinates of a given vertex of a tesselation.
+ *
+ * parameters:
+ *   ts         <-- tesselation structure
+ *   vertex_id  <-- vertex id (0 to n-1)
+ *
+ * returns:
+ *   pointer to vertex coordinates
+ *----------------------------------------------------------------------------*/
+
+static inline const cs_coord_t *
+_vertex_coords(const fvm_tesselation_t  *ts,
+               cs_lnum_t                 vertex_id)
+{
+  if (ts->parent_vertex_id != nullptr)
+    return ts->vertex_coords + (ts->parent_vertex_id[vertex_id] * 3);
+  else
+    return ts->vertex_coords + (vertex_id * 3);
+}
+
 /*----------------------------------------------------------------------------
  * Compute coordinates of added vertices for a tesselation of a polyhedron.
  *
@@ -638,81 +667,84 @@ _vertex_field_of_real_values(const fvm_tesselation_t  *this_tesselation,
                              const void         *const src_data[],
                              void               *const dest_data)
 {
-  int n_vertices_tot, pl, vertex_list_size;
-  cs_lnum_t i, j, parent_id, src_id, vertex_id;
-
-  int _src_dim_shift = src_dim_shift;
-  int max_list_size = 128;
-
-  cs_lnum_t _heap[128];
-  cs_lnum_t _vertex_list[128];
-  cs_lnum_t *heap = _heap;
-  cs_lnum_t *vertex_list = _vertex_list;
-
   const fvm_tesselation_t *ts = this_tesselation;
-  const cs_coord_t *current_coords = nullptr;
 
   if (ts->type != FVM_CELL_POLY)
     return;
 
+  assert(ts->_vertex_list_idx != nullptr || end_id <= start_id);
+
   /* Main loop on polyhedra */
   /*------------------------*/
 
-  for (i = start_id; i < end_id; i++) {
+#   pragma omp parallel for if (end_id - start_id > CS_THR_MIN)
+  for (cs_lnum_t i = start_id; i < end_id; i++) {
 
-    for (j = 0; j < dest_dim; j++) { /* Loop on destination dimension */
+    cs_coord_t vertex_coords[3];
 
-      cs_coord_t vertex_coords[3];
-      double coeff[4];
-      double interpolated_value, v_x, v_y, v_z;
-      double v_f = 0.;
+    _added_vertex_coords(ts, vertex_coords, nullptr, i);
 
-      double a[4][4] = {{0., 0., 0., 0.},
-                        {0., 0., 0., 0.},
-                        {0., 0., 0., 0.},
-                        {0., 0., 0., 0.}};
-      double b[4] = {0., 0., 0., 0.};
+    /* Cached list of polyhedron's vertices */
 
-      _added_vertex_coords(ts,
-                           vertex_coords,
-                           &n_vertices_tot,
-                           i);
+    const cs_lnum_t  vertex_list_size
+      = ts->_vertex_list_idx[i+1] - ts->_vertex_list_idx[i];
+    const cs_lnum_t  *vertex_list = ts->_vertex_list + ts->_vertex_list_idx[i];
 
-      /* Allocate or resize working arrays if too small */
+    /* Build matrix for least squares (shared by all components) */
 
-      if (n_vertices_tot > max_list_size) {
-        max_list_size *= 2;
-        if (heap == _heap) {
-          heap = nullptr;
-          vertex_list = nullptr;
-        }
-        BFT_REALLOC(heap, max_list_size, cs_lnum_t);
-        BFT_REALLOC(vertex_list, max_list_size, cs_lnum_t);
-      }
+    double a[4][4] = {{0., 0., 0., 0.},
+                      {0., 0., 0., 0.},
+                      {0., 0., 0., 0.},
+                      {0., 0., 0., 0.}};
+
+    for (cs_lnum_t k = 0; k < vertex_list_size; k++) {
+
+      const cs_coord_t *c = _vertex_coords(ts, vertex_list[k]);
+
+      a[0][0] += c[0] * c[0];
+      a[0][1] += c[0] * c[1];
+      a[0][2] += c[0] * c[2];
+      a[0][3] += c[0];
+
+      a[1][1] += c[1] * c[1];
+      a[1][2] += c[1] * c[2];
+      a[1][3] += c[1];
+
+      a[2][2] += c[2] * c[2];
+      a[2][3] += c[2];
 
-      /* Obtain list of polyhedron's vertices */
+      a[3][3] += 1.;
 
-      _polyhedron_vertices(ts,
-                           heap,
-                           vertex_list,
-                           &vertex_list_size,
-                           i);
+    }
+
+    /* Matrix is symmetric */
+
+    a[1][0] = a[0][1];
+    a[2][0] = a[0][2];
+    a[3][0] = a[0][3];
+
+    a[2][1] = a[1][2];
+    a[3][1] = a[1][3];
+
+    a[3][2] = a[2][3];
+
+    for (int j = 0; j < dest_dim; j++) { /* Loop on destination dimension */
+
+      double coeff[4];
+      double interpolated_value;
+      double v_f = 0.;
 
-      /* Build matrix for least squares */
+      double b[4] = {0., 0., 0., 0.};
 
-      for (j = 0; j < vertex_list_size; j++) {
+      /* Build right-hand side for least squares */
 
-        vertex_id = vertex_list[j];
+      for (cs_lnum_t k = 0; k < vertex_list_size; k++) {
 
-        if (ts->parent_vertex_id != nullptr)
-          current_coords
-            = ts->vertex_coords + (ts->parent_vertex_id[vertex_id] * 3);
-        else
-          current_coords = ts->vertex_coords + (vertex_id * 3);
+        int pl;
+        cs_lnum_t parent_id, src_id;
 
-        v_x = current_coords[0];
-        v_y = current_coords[1];
-        v_z = current_coords[2];
+        const cs_lnum_t vertex_id = vertex_list[k];
+        const cs_coord_t *c = _vertex_coords(ts, vertex_id);
 
         /* Position in source data for current vertex value */
 
@@ -736,10 +768,10 @@ _vertex_field_of_real_values(const fvm_tesselation_t  *this_tesselation,
         }
 
         if (src_interlace == CS_INTERLACE) {
-          src_id = parent_id * src_dim + _src_dim_shift;
+          src_id = parent_id * src_dim + src_dim_shift + j;
         }
         else {
-          pl = src_dim*pl + _src_dim_shift;
+          pl = src_dim*pl + src_dim_shift + j;
           src_id = parent_id;
         }
 
@@ -756,38 +788,13 @@ _vertex_field_of_real_values(const fvm_tesselation_t  *this_tesselation,
           assert(0);
         }
 
-        a[0][0] += v_x * v_x;
-        a[0][1] += v_x * v_y;
-        a[0][2] += v_x * v_z;
-        a[0][3] += v_x;
-
-        a[1][1] += v_y * v_y;
-        a[1][2] += v_y * v_z;
-        a[1][3] += v_y;
-
-        a[2][2] += v_z * v_z;
-        a[2][3] += v_z;
-
-        a[3][3] += 1.;
-
-        b[0] += v_x * v_f;
-        b[1] += v_y * v_f;
-        b[2] += v_z * v_f;
+        b[0] += c[0] * v_f;
+        b[1] += c[1] * v_f;
+        b[2] += c[2] * v_f;
         b[3] += v_f;
 
       } /* End of loop on element vertices */
 
-      /* Matrix is symmetric */
-
-      a[1][0] = a[0][1];
-      a[2][0] = a[0][2];
-      a[3][0] = a[0][3];
-
-      a[2][1] = a[1][2];
-      a[3][1] = a[1][3];
-
-      a[3][2] = a[2][3];
-
       /* Find hyperplane coefficients and compute added value */
 
       if (_solve_ax_b_4(a, b, coeff) == 0) {
@@ -804,10 +811,10 @@ _vertex_field_of_real_values(const fvm_tesselation_t  *this_tesselation,
 
       switch(dest_datatype) {
       case CS_FLOAT:
-        ((float *const)dest_data)[i] = interpolated_value;
+        ((float *const)dest_data)[i*dest_dim + j] = interpolated_value;
         break;
       case CS_DOUBLE:
-        ((double *const)dest_data)[i] = interpolated_value;
+        ((double *const)dest_data)[i*dest_dim + j] = interpolated_value;
         break;
       default:
         assert(0);
@@ -816,11 +823,67 @@ _vertex_field_of_real_values(const fvm_tesselation_t  *this_tesselation,
     } /* End of loop on destination dimension */
 
   } /* End of main loop on polyhedra */
+}
+
+/*----------------------------------------------------------------------------
+ * Build the sorted lists of distinct vertices of each polyhedron of a
+ * tesselation.
+ *
+ * Those lists depend only on the connectivity, so they are built once,
+ * and reused at each output of values at added vertices.
+ *
+ * parameters:
+ *   this_tesselation   <-> partially initialized tesselation structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_polyhedra_vertex_lists(fvm_tesselation_t  *this_tesselation)
+{
+  fvm_tesselation_t *ts = this_tesselation;
+
+  const cs_lnum_t n_elements = ts->n_elements;
+
+  BFT_FREE(ts->_vertex_list_idx);
+  BFT_FREE(ts->_vertex_list);
+
+  if (ts->face_index == nullptr)
+    return;
 
-  if (heap != _heap) {
-    BFT_FREE(heap);
-    BFT_FREE(vertex_list);
+  /* Upper bound of list sizes (vertex references of all faces) */
+
+  cs_lnum_t n_refs_max = 0, n_refs_tot = 0;
+
+  for (cs_lnum_t i = 0; i < n_elements; i++) {
+    cs_lnum_t n_refs = 0;
+    for (cs_lnum_t j = ts->face_index[i]; j < ts->face_index[i+1]; j++) {
+      cs_lnum_t face_id = CS_ABS(ts->face_num[j]) - 1;
+      n_refs += ts->vertex_index[face_id+1] - ts->vertex_index[face_id];
+    }
+    n_refs_max = CS_MAX(n_refs_max, n_refs);
+    n_refs_tot += n_refs;
   }
+
+  cs_lnum_t *heap;
+  BFT_MALLOC(heap, n_refs_max, cs_lnum_t);
+
+  BFT_MALLOC(ts->_vertex_list_idx, n_elements + 1, cs_lnum_t);
+  BFT_MALLOC(ts->_vertex_list, n_refs_tot, cs_lnum_t);
+
+  ts->_vertex_list_idx[0] = 0;
+
+  for (cs_lnum_t i = 0; i < n_elements; i++) {
+    int vertex_list_size = 0;
+    _polyhedron_vertices(ts,
+                         heap,
+                         ts->_vertex_list + ts->_vertex_list_idx[i],
+                         &vertex_list_size,
+                         i);
+    ts->_vertex_list_idx[i+1] = ts->_vertex_list_idx[i] + vertex_list_size;
+  }
+
+  BFT_FREE(heap);
+
+  BFT_REALLOC(ts->_vertex_list, ts->_vertex_list_idx[n_elements], cs_lnum_t);
 }
 
 /*----------------------------------------------------------------------------
@@ -862,17 +925,13 @@ _tesselate_polygons(fvm_tesselation_t  *this_tesselation,
                     cs_lnum_t          *error_count)
 {
   int type_id;
-  cs_lnum_t n_vertices, n_triangles, n_quads, n_elements;
+  cs_lnum_t n_elements;
   cs_lnum_t n_vertices_max, n_triangles_max;
-  cs_lnum_t i, j, k, vertex_id, encoding_id;
-  fvm_tesselation_encoding_t encoding_sub[3];
 
   cs_gnum_t n_g_elements_tot[2] = {0, 0}; /* Global new elements count */
   cs_lnum_t n_elements_tot[2] = {0, 0}; /* New triangles/quadrangles */
   cs_lnum_t n_g_elements_max[2] = {0, 0}; /* Global max triangles/quadrangles */
   cs_lnum_t n_elements_max[2] = {0, 0}; /* Max triangles/quadrangles */
-  cs_lnum_t *triangle_vertices = nullptr;
-  fvm_triangulate_state_t *state = nullptr;
 
   fvm_tesselation_t *ts = this_tesselation;
 
@@ -892,8 +951,8 @@ _tesselate_polygons(fvm_tesselation_t  *this_tesselation,
   n_triangles_max = 0;
 
   if (ts->vertex_index != nullptr) {
-    for (i = 0 ; i < n_elements ; i++) {
-      n_vertices = ts->vertex_index[i+1] - ts->vertex_index[i];
+    for (cs_lnum_t i = 0 ; i < n_elements ; i++) {
+      cs_lnum_t n_vertices = ts->vertex_index[i+1] - ts->vertex_index[i];
       if (n_vertices == 4)
         n_elements_tot[1] += 1;
       else
@@ -930,112 +989,143 @@ _tesselate_polygons(fvm_tesselation_t  *this_tesselation,
                ts->vertex_index[n_elements] - n_elements*2,
                fvm_tesselation_encoding_t);
     ts->encoding = ts->_encoding;
-    BFT_MALLOC(triangle_vertices, (n_vertices_max - 2) * 3, cs_lnum_t);
-    state = fvm_triangulate_state_create(n_vertices_max);
   }
 
   n_elements_tot[0] = 0; n_elements_tot[1] = 0; /* reset */
 
+  cs_lnum_t _error_count = 0;
+
   /* Main loop on section face elements */
   /*------------------------------------*/
 
-  for (i = 0 ; i < n_elements ; i++) {
+  /* The encoding of each polygon is placed based on its connectivity
+     index, so polygons may be triangulated in parallel, each thread
+     using its own triangulation state and counters */
 
-    n_triangles = 0;
-    n_quads = 0;
-    n_vertices = ts->vertex_index[i+1] - ts->vertex_index[i];
-    vertex_id = ts->vertex_index[i];
-
-    /* We calculate the encoding index base from the polygon's
-       connectivity index base, knowing that for a polygon
-       with n vertices, we have at most n-2 triangles
-       (exactly n-2 when no error occurs) */
+# pragma omp parallel if (n_elements > CS_THR_MIN)
+  {
+    cs_lnum_t t_n_elements_tot[2] = {0, 0};
+    cs_lnum_t t_n_elements_max[2] = {0, 0};
+    cs_lnum_t t_error_count = 0;
 
-    encoding_id = ts->vertex_index[i] - (i*2);
+    cs_lnum_t *triangle_vertices = nullptr;
+    fvm_triangulate_state_t *state = nullptr;
 
-    if (n_vertices == 4)
-      type_id = 1;
-    else
-      type_id = 0;
+    if (n_vertices_max > 4) {
+      BFT_MALLOC(triangle_vertices, (n_vertices_max - 2) * 3, cs_lnum_t);
+      state = fvm_triangulate_state_create(n_vertices_max);
+    }
 
-    /* If face must be subdivided */
+#   pragma omp for
+    for (cs_lnum_t i = 0; i < n_elements; i++) {
 
-    if (n_vertices > 4) {
+      cs_lnum_t n_triangles = 0;
+      cs_lnum_t n_quads = 0;
+      cs_lnum_t n_vertices = ts->vertex_index[i+1] - ts->vertex_index[i];
+      cs_lnum_t vertex_id = ts->vertex_index[i];
 
-      n_triangles = fvm_triangulate_polygon(dim,
-                                            1,
-                                            n_vertices,
-                                            vertex_coords,
-                                            parent_vertex_id,
-                                            (  ts->vertex_num
-                                             + vertex_id),
-                                            FVM_TRIANGULATE_ELT_DEF,
-                                            triangle_vertices,
-                                            state);
+      /* We calculate the encoding index base from the polygon's
+         connectivity index base, knowing that for a polygon
+         with n vertices, we have at most n-2 triangles
+         (exactly n-2 when no error occurs) */
 
-      if (n_triangles != (n_vertices - 2) && error_count != nullptr)
-        *error_count += 1;
+      cs_lnum_t encoding_id = ts->vertex_index[i] - (i*2);
 
-      /* Encode local triangle connectivity */
+      /* If face must be subdivided */
 
-      for (j = 0; j < n_triangles; j++) {
+      if (n_vertices > 4) {
 
-        for (k = 0; k < 3; k++)
-          encoding_sub[k]
-            = (   ((fvm_tesselation_encoding_t)(triangle_vertices[j*3 + k] - 1))
-               << (_ENCODING_BITS * k));
+        fvm_tesselation_encoding_t encoding_sub[3];
 
-        ts->_encoding[encoding_id + j]
-          = encoding_sub[0] | encoding_sub[1] | encoding_sub[2];
+        n_triangles = fvm_triangulate_polygon(dim,
+                                              1,
+                                              n_vertices,
+                                              vertex_coords,
+                                              parent_vertex_id,
+                                              (  ts->vertex_num
+                                               + vertex_id),
+                                              FVM_TRIANGULATE_ELT_DEF,
+                                              triangle_vertices,
+                                              state);
 
-      }
+        if (n_triangles != (n_vertices - 2))
+          t_error_count += 1;
 
-      /* In case of incomplete tesselation due to errors,
-         blank unused encoding values */
+        /* Encode local triangle connectivity */
 
-      for (j = n_triangles; j < (n_vertices - 2); j++)
-        ts->_encoding[encoding_id + j] = 0;
+        for (cs_lnum_t j = 0; j < n_triangles; j++) {
 
-      n_elements_tot[0] += n_triangles;
+          for (int k = 0; k < 3; k++)
+            encoding_sub[k]
+              = (   ((fvm_tesselation_encoding_t)
+                     (triangle_vertices[j*3 + k] - 1))
+                 << (_ENCODING_BITS * k));
 
-    }
+          ts->_encoding[encoding_id + j]
+            = encoding_sub[0] | encoding_sub[1] | encoding_sub[2];
 
-    /* Otherwise, tesselation trivial or not necessary for this face */
+        }
 
-    else {
+        /* In case of incomplete tesselation due to errors,
+           blank unused encoding values */
 
-      if (ts->_encoding != nullptr) {
-        for (j = 0; j < (n_vertices - 2); j++)
+        for (cs_lnum_t j = n_triangles; j < (n_vertices - 2); j++)
           ts->_encoding[encoding_id + j] = 0;
-      }
 
-      if (n_vertices == 4) {
-        n_elements_tot[1] += 1;
-        n_quads = 1;
+        t_n_elements_tot[0] += n_triangles;
+
       }
 
-      else if (n_vertices == 3) {
-        n_elements_tot[0] += 1;
-        n_triangles = 1;
+      /* Otherwise, tesselation trivial or not necessary for this face */
+
+      else {
+
+        if (ts->_encoding != nullptr) {
+          for (cs_lnum_t j = 0; j < (n_vertices - 2); j++)
+            ts->_encoding[encoding_id + j] = 0;
+        }
+
+        if (n_vertices == 4) {
+          t_n_elements_tot[1] += 1;
+          n_quads = 1;
+        }
+
+        else if (n_vertices == 3) {
+          t_n_elements_tot[0] += 1;
+          n_triangles = 1;
+        }
+
       }
 
-    }
+      if (n_triangles > t_n_elements_max[0])
+        t_n_elements_max[0] = n_triangles;
 
-    if (n_triangles > n_elements_max[0])
-      n_elements_max[0] = n_triangles;
+      if (n_quads > t_n_elements_max[1])
+        t_n_elements_max[1] = n_quads;
 
-    if (n_quads > n_elements_max[1])
-      n_elements_max[1] = n_triangles;
+    } /* End of loop on elements */
 
-  } /* End of loop on elements */
+    /* Free memory and state variables */
 
-  /* Free memory and state variables */
+    if (n_vertices_max > 4) {
+      BFT_FREE(triangle_vertices);
+      state = fvm_triangulate_state_destroy(state);
+    }
 
-  if (n_vertices_max > 4) {
-    BFT_FREE(triangle_vertices);
-    state = fvm_triangulate_state_destroy(state);
+#   pragma omp critical
+    {
+      for (int t_id = 0; t_id < 2; t_id++) {
+        n_elements_tot[t_id] += t_n_elements_tot[t_id];
+        if (t_n_elements_max[t_id] > n_elements_max[t_id])
+          n_elements_max[t_id] = t_n_elements_max[t_id];
+      }
+      _error_count += t_error_count;
+    }
   }
 
+  if (error_count != nullptr)
+    *error_count = _error_count;
+
   /* Update tesselation structure info */
 
   for (type_id = 0; type_id < 2; type_id++) {
@@ -2110,6 +2200,9 @@ fvm_tesselation_create(fvm_element_t        element_type,
     this_tesselation->_sub_elt_index[i] = nullptr;
   }
 
+  this_tesselation->_vertex_list_idx = nullptr;
+  this_tesselation->_vertex_list = nullptr;
+
   return (this_tesselation);
 }
 
@@ -2135,6 +2228,8 @@ fvm_tesselation_destroy(fvm_tesselation_t  * this_tesselation)
     if (this_tesselation->_sub_elt_index[i] != nullptr)
       BFT_FREE(this_tesselation->_sub_elt_index[i]);
   }
+  BFT_FREE(this_tesselation->_vertex_list_idx);
+  BFT_FREE(this_tesselation->_vertex_list);
   BFT_FREE(this_tesselation);
 
   return nullptr;
@@ -2177,6 +2272,7 @@ fvm_tesselation_init(fvm_tesselation_t  *this_tesselation,
     _count_and_index_sub_polyhedra(this_tesselation,
                                    error_count,
                                    true);
+    _build_polyhedra_vertex_lists(this_tesselation);
     break;
 
   case FVM_FACE_POLY:
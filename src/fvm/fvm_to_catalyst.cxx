@@ -104,9 +104,11 @@
 #include "fvm_io_num.h"
 #include "fvm_nodal.h"
 #include "fvm_nodal_priv.h"
+#include "fvm_writer_helper.h"
 #include "fvm_writer_priv.h"
 
 #include "cs_block_dist.h"
+#include "cs_field.h"
 #include "cs_file.h"
 #include "cs_parall.h"
 #include "cs_part_to_block.h"
@@ -136,6 +138,8 @@ typedef struct {
 
   int                   mesh_id;       /* Associated mesh structure id */
   int                   dim;           /* Field dimension */
+  bool                  shared;        /* true if VTK array references
+                                          field values in place */
   vtkUnstructuredGrid  *f;             /* Pointer to VTK writer fields */
 
 } fvm_catalyst_field_t;
@@ -168,6 +172,9 @@ typedef struct {
   bool                        private_comm;    /* Use private communicator */
   bool                        ensight_names;   /* Use EnSight rules for
                                                   field names */
+  bool                        zero_copy;       /* Reference field values and
+                                                  coordinates in place when
+                                                  possible */
 
   bool                        modified;        /* Has output been added since
                                                   last coprocessing ? */
@@ -975,6 +982,7 @@ _add_catalyst_field(fvm_to_catalyst_t         *writer,
   writer->fields[f_id]->mesh_id = mesh_id;
 
   writer->fields[f_id]->dim = dim;
+  writer->fields[f_id]->shared = false;
   writer->fields[f_id]->f = f;
 
   writer->n_fields++;
@@ -985,13 +993,19 @@ _add_catalyst_field(fvm_to_catalyst_t         *writer,
 /*----------------------------------------------------------------------------
  * Write vertex coordinates to VTK.
  *
+ * If zero_copy is true and coordinates are shared with the parent mesh
+ * (whose lifetime exceeds that of the writer's data), they are referenced
+ * in place rather than copied.
+ *
  * parameters:
  *   mesh        <-- pointer to nodal mesh structure
+ *   zero_copy   <-- reference coordinates in place if possible
  *   vtk_mesh    <-- pointer to VTK Mesh object
  *----------------------------------------------------------------------------*/
 
 static void
 _export_vertex_coords(const fvm_nodal_t        *mesh,
+                      bool                      zero_copy,
                       vtkUnstructuredGrid      *vtk_mesh)
 {
   cs_lnum_t   i, j;
@@ -1009,9 +1023,16 @@ _export_vertex_coords(const fvm_nodal_t        *mesh,
 
   vtkNew<vtkPoints> points;
 
-  points->Allocate(mesh->n_vertices);
-
-  if (mesh->parent_vertex_id != NULL) {
+  if (   zero_copy && mesh->dim == 3
+      && mesh->parent_vertex_id == NULL && mesh->_vertex_coords == NULL) {
+    vtkNew<vtkDoubleArray> coords;
+    coords->SetNumberOfComponents(3);
+    /* save = 1 so that VTK does not free the array */
+    coords->SetArray(const_cast<double *>(vertex_coords), 3*n_vertices, 1);
+    points->SetData(coords);
+  }
+  else if (mesh->parent_vertex_id != NULL) {
+    points->Allocate(mesh->n_vertices);
     const cs_lnum_t  *parent_vertex_id = mesh->parent_vertex_id;
     for (i = 0; i < n_vertices; i++) {
       for (j = 0; j < mesh->dim; j++)
@@ -1022,6 +1043,7 @@ _export_vertex_coords(const fvm_nodal_t        *mesh,
     }
   }
   else {
+    points->Allocate(mesh->n_vertices);
     for (i = 0; i < n_vertices; i++) {
       for (j = 0; j < mesh->dim; j++)
         point[j] = vertex_coords[i*stride + j];
@@ -1232,6 +1254,143 @@ _export_nodal_polyhedra(cs_lnum_t                   n_vertices,
   BFT_FREE(vtx_marker);
 }
 
+/*----------------------------------------------------------------------------
+ * Check if values belong to a field's storage.
+ *
+ * Field values remain allocated until fields are destroyed, after
+ * writers are finalized, so they may be referenced until the next
+ * coprocessing step (mesh modifications leading to their reallocation
+ * also lead to new exports).
+ *
+ * parameters:
+ *   values <-- pointer to values
+ *
+ * returns:
+ *   true if values are those of a field, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_is_field_storage(const void  *values)
+{
+  const int n_fields = cs_field_n_fields();
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+    const cs_field_t *f = cs_field_by_id(f_id);
+    if (f->vals == NULL)
+      continue;
+    for (int i = 0; i < f->n_time_vals; i++) {
+      if ((const void *)(f->vals[i]) == values)
+        return true;
+    }
+  }
+
+  return false;
+}
+
+/*----------------------------------------------------------------------------
+ * Reference field values in place in a VTK array if possible.
+ *
+ * This is possible when the writer's zero_copy option is set, values are
+ * stored in a field whose layout matches that of the VTK array (i.e.
+ * interlaced double precision values for all the exported entities,
+ * in order). Otherwise, if values were previously referenced, the VTK
+ * array is detached from them, so that values may be copied.
+ *
+ * parameters:
+ *   w                <-- pointer to associated writer
+ *   cf               <-> pointer to Catalyst field structure
+ *   mesh             <-- pointer to nodal mesh structure
+ *   fieldname        <-- field name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dim              <-- field dimension
+ *   interlace        <-- indicates if field in memory is interlaced
+ *   n_parent_lists   <-- indicates if field values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent list to common number index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   field_values     <-- array of associated field value arrays
+ *
+ * returns:
+ *   true if values are referenced in place, false if they must be copied
+ *----------------------------------------------------------------------------*/
+
+static bool
+_share_field_values(const fvm_to_catalyst_t  *w,
+                    fvm_catalyst_field_t     *cf,
+                    const fvm_nodal_t        *mesh,
+                    const char               *fieldname,
+                    fvm_writer_var_loc_t      location,
+                    int                       dim,
+                    cs_interlace_t            interlace,
+                    int                       n_parent_lists,
+                    const cs_lnum_t           parent_num_shift[],
+                    cs_datatype_t             datatype,
+                    const void         *const field_values[])
+{
+  vtkUnstructuredGrid *f = cf->f;
+
+  if (f == NULL)
+    return false;
+
+  vtkDataSetAttributes *attr = NULL;
+  vtkIdType n_tuples = 0;
+
+  if (location == FVM_WRITER_PER_NODE) {
+    attr = f->GetPointData();
+    n_tuples = f->GetNumberOfPoints();
+  }
+  else {
+    attr = f->GetCellData();
+    n_tuples = f->GetNumberOfCells();
+  }
+
+  vtkDoubleArray *values
+    = vtkDoubleArray::SafeDownCast(attr->GetArray(fieldname));
+
+  /* Symmetric tensors are expanded, so always copied */
+
+  const void *s_values = NULL;
+
+  if (w->zero_copy && dim != 6)
+    s_values = fvm_writer_field_shared_values(mesh,
+                                              location,
+                                              dim,
+                                              0,
+                                              interlace,
+                                              CS_INTERLACE,
+                                              n_parent_lists,
+                                              parent_num_shift,
+                                              datatype,
+                                              CS_DOUBLE,
+                                              field_values);
+
+  if (s_values != NULL && _is_field_storage(s_values) == false)
+    s_values = NULL;
+
+  if (s_values != NULL) {
+    /* save = 1 so that VTK does not free the array */
+    values->SetArray(static_cast<double *>(const_cast<void *>(s_values)),
+                     dim*n_tuples,
+                     1);
+    cf->shared = true;
+    return true;
+  }
+
+  /* Detach from previously referenced values so as not to overwrite them */
+
+  if (cf->shared) {
+    const int dest_dim = (dim == 6) ? 9 : dim;
+    values->Initialize();
+    values->SetNumberOfComponents(dest_dim);
+    values->SetNumberOfTuples(n_tuples);
+    cf->shared = false;
+  }
+
+  return false;
+}
+
 /*----------------------------------------------------------------------------
  * Write field values associated with nodal values of a nodal mesh to VTK.
  *
@@ -1417,6 +1576,8 @@ BEGIN_C_DECLS
  *   names=<fmt>         use same naming rules as <fmt> format
  *                       (default: ensight)
  *   input_name=<name>   define input name (default: writer name)
+ *   zero_copy           reference field values and vertex coordinates
+ *                       in place instead of copying them when possible
  *
  * parameters:
  *   name           <-- base output case name.
@@ -1467,6 +1628,7 @@ fvm_to_catalyst_init_writer(const char             *name,
   w->time_value = 0.0;
 
   w->ensight_names = true;
+  w->zero_copy = false;
   w->input_name = NULL;
 
   /* Writer name */
@@ -1508,6 +1670,8 @@ fvm_to_catalyst_init_writer(const char             *name,
         strncpy(w->input_name, options + i1 + 11, l);
         w->input_name[l] = '\0';
       }
+      else if ((l_opt == 9) && (strncmp(options + i1, "zero_copy", l_opt) == 0))
+        w->zero_copy = true;
 
       for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
 
@@ -1672,7 +1836,7 @@ fvm_to_catalyst_export_nodal(void               *this_writer_p,
   /* Vertex coordinates */
   /*--------------------*/
 
-  _export_vertex_coords(mesh, ugrid);
+  _export_vertex_coords(mesh, w->zero_copy, ugrid);
 
   /* Element connectivity size */
   /*---------------------------*/
@@ -1831,10 +1995,25 @@ fvm_to_catalyst_export_field(void                  *this_writer_p,
 
   vtkUnstructuredGrid  *f = w->fields[field_id]->f;
 
+  /* Values referenced in place */
+  /*----------------------------*/
+
+  bool in_place = _share_field_values(w,
+                                      w->fields[field_id],
+                                      mesh,
+                                      _name,
+                                      location,
+                                      dimension,
+                                      interlace,
+                                      n_parent_lists,
+                                      parent_num_shift,
+                                      datatype,
+                                      field_values);
+
   /* Per node variable */
   /*-------------------*/
 
-  if (location == FVM_WRITER_PER_NODE)
+  if (in_place == false && location == FVM_WRITER_PER_NODE)
     _export_field_values_n(mesh,
                            _name,
                            dimension,
@@ -1849,7 +2028,7 @@ fvm_to_catalyst_export_field(void                  *this_writer_p,
   /* Per element variable */
   /*----------------------*/
 
-  else if (location == FVM_WRITER_PER_ELEMENT)
+  else if (in_place == false && location == FVM_WRITER_PER_ELEMENT)
     _export_field_values_e(mesh,
                            _name,
                            dimension,
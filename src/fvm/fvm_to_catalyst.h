@@ -64,6 +64,8 @@ BEGIN_C_DECLS
  *   names=<fmt>         use same naming rules as <fmt> format
  *                       (default: ensight)
  *   input_name=<name>   define input name (default: writer name)
+ *   zero_copy           reference field values and vertex coordinates
+ *                       in place instead of copying them when possible
  *
  * parameters:
  *   name           <-- base output case name.
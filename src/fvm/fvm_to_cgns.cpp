@@ -46,6 +46,10 @@
 
 #include <cgnslib.h>
 
+#if defined(HAVE_CGNS_MPI)
+#include <pcgnslib.h>
+#endif
+
 /*----------------------------------------------------------------------------
  *  Local headers
  *----------------------------------------------------------------------------*/
@@ -185,6 +189,9 @@ struct _fvm_to_cgns_writer_t {
 
   bool         preserve_precision; /* Preserve double precison variable type */
 
+  bool         parallel_io;        /* Use parallel CGNS (MPI-IO) API */
+  int          deflate_level;      /* HDF5 compression level (0: none) */
+
   int          rank;               /* Rank of current process in communicator */
   int          n_ranks;            /* Number of processes in communicator */
 
@@ -340,6 +347,9 @@ _create_writer(const char           *name,
 
   w->preserve_precision = false;
 
+  w->parallel_io = false;
+  w->deflate_level = 0;
+
   w->rank = 0;
   w->n_ranks = 1;
 
@@ -357,6 +367,8 @@ _create_writer(const char           *name,
     w->discard_polyhedra = reference->discard_polyhedra;
     w->divide_polyhedra = reference->divide_polyhedra;
     w->preserve_precision = reference->preserve_precision;
+    w->parallel_io = reference->parallel_io;
+    w->deflate_level = reference->deflate_level;
     w->rank = reference->rank;
     w->n_ranks = reference->n_ranks;
 #if defined(HAVE_MPI)
@@ -384,6 +396,25 @@ _create_writer(const char           *name,
   return w;
 }
 
+/*----------------------------------------------------------------------------
+ * Indicate if the current rank calls the CGNS library for a given writer.
+ *
+ * With the serial CGNS API, only rank 0 accesses the file; with the
+ * parallel API, all calls (including metadata) are collective.
+ *
+ * parameters:
+ *   writer     <-- CGNS writer structure
+ *
+ * returns:
+ *   true if CGNS functions are called on this rank, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static inline bool
+_is_io_rank(const fvm_to_cgns_writer_t  *writer)
+{
+  return (writer->rank == 0 || writer->parallel_io);
+}
+
 /*----------------------------------------------------------------------------
  * Open a CGNS file.
  *
@@ -401,6 +432,35 @@ _open_file(fvm_to_cgns_writer_t   *writer)
 
   writer->index = -1;
 
+  /* Compression settings are global to the CGNS library,
+     so they are set for each file */
+
+#if defined(CG_CONFIG_HDF5_COMPRESS)
+  if (_is_io_rank(writer))
+    cg_configure(CG_CONFIG_HDF5_COMPRESS,
+                 (void *)((size_t)(writer->deflate_level)));
+#endif
+
+#if defined(HAVE_CGNS_MPI)
+
+  if (writer->parallel_io) {
+
+    cgp_mpi_comm(writer->comm);
+    cgp_pio_mode(CGNS_ENUMV(CGP_COLLECTIVE));
+
+    if (cgp_open(writer->filename, CG_MODE_WRITE, &fn) != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cgp_open() failed to open file \"%s\" : \n%s"),
+                writer->filename, cg_get_error());
+
+    writer->index = fn;
+    writer->is_open = true;
+
+    return;
+  }
+
+#endif /* defined(HAVE_CGNS_MPI) */
+
   if (writer->rank == 0) {
 
     if (cg_open(writer->filename, CG_MODE_WRITE, &fn) != CG_OK)
@@ -432,7 +492,18 @@ _close_file(fvm_to_cgns_writer_t   *writer)
 {
   if (writer->is_open == true) {
 
-    if (writer->rank == 0) {
+    if (writer->parallel_io) {
+
+#if defined(HAVE_CGNS_MPI)
+      if (cgp_close(writer->index) != CG_OK)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("cgp_close() failed to close file \"%s\" :\n%s"),
+                  writer->filename, cg_get_error());
+#endif
+
+    }
+
+    else if (writer->rank == 0) {
 
       if (cg_close(writer->index) != CG_OK)
         bft_error(__FILE__, __LINE__, 0,
@@ -554,7 +625,6 @@ _add_base(fvm_to_cgns_writer_t  *writer,
   int  i;
 
   int  base_index = 0;
-  int  rank = writer->rank;
 
   int entity_dim = fvm_nodal_get_max_entity_dim(mesh);
 
@@ -581,7 +651,7 @@ _add_base(fvm_to_cgns_writer_t  *writer,
   writer->bases[i]->n_sols = 0;
   writer->bases[i]->solutions = nullptr;
 
-  if (rank == 0) {
+  if (_is_io_rank(writer)) {
     retval = cg_base_write(writer->index,
                            base_name,
                            entity_dim,
@@ -654,7 +724,7 @@ _write_zone_link(fvm_to_cgns_writer_t      *writer,
                  const char                *nodename,
                  const char                *filename)
 {
-  if (writer->rank == 0) {
+  if (_is_io_rank(writer)) {
 
     /* Simply add link */
 
@@ -718,7 +788,6 @@ _add_solution(fvm_to_cgns_writer_t        *writer,
 
   int  zone_index = 1; /* We always write to the first zone */
   int  sol_index = 0;
-  int  rank = writer->rank;
 
   int  retval = CG_OK;
 
@@ -756,7 +825,7 @@ _add_solution(fvm_to_cgns_writer_t        *writer,
   strncpy(base->solutions[sol_id]->name, sol_name, sol_length + 1);
   base->solutions[sol_id]->name[sol_length] = '\0';
 
-  if (rank == 0) {
+  if (_is_io_rank(writer)) {
     retval = cg_sol_write(writer->index,
                           base->index,
                           zone_index,
@@ -900,7 +969,7 @@ _add_zone(const fvm_nodal_t           *mesh,
 
   assert(writer != nullptr);
 
-  if (writer->rank != 0)
+  if (!_is_io_rank(writer))
     return;
 
   /* Compute global number of vertices in this zone */
@@ -1138,9 +1207,61 @@ _coord_output(const fvm_to_cgns_writer_t  *w,
 
   const int   zone_index = 1; /* We always use zone index = 1 */
 
-  /* Output in parallel case */
+  /* Output with parallel CGNS API */
+
+#if defined(HAVE_CGNS_MPI)
+
+  if (w->parallel_io) {
+
+    /* Ranks with an empty block still take part in collective calls,
+       with a null data pointer (empty selection) */
 
-  /* TODO: add variant for parallel CGNS */
+    cgsize_t rmin = block_start, rmax = block_end - 1;
+    const void *_values = buffer;
+
+    if (block_end <= block_start) {
+      rmin = 1;
+      rmax = 1;
+      _values = nullptr;
+    }
+
+    /* Fixed or first coordinates (deforming mesh not handled yet) */
+
+    if (grid_index < 2) {
+
+      int retval = cgp_coord_write(w->index,
+                                   base->index,
+                                   zone_index,
+                                   cgns_datatype,
+                                   coord_name,
+                                   &coord_index);
+
+      if (retval == CG_OK)
+        retval = cgp_coord_write_data(w->index,
+                                      base->index,
+                                      zone_index,
+                                      coord_index,
+                                      &rmin,
+                                      &rmax,
+                                      _values);
+
+      if (retval != CG_OK)
+        bft_error(__FILE__, __LINE__, 0,
+                  _("%s() failed to write coords:\n"
+                    "Associated writer: \"%s\"\n"
+                    "Associated base: \"%s\"\n"
+                    "CGNS error:%s"),
+                  "cgp_coord_write_data",
+                  w->name, base->name, cg_get_error());
+
+    }
+
+    return;
+  }
+
+#endif /* defined(HAVE_CGNS_MPI) */
+
+  /* Output in parallel case, using serializer */
 
 #if defined(HAVE_MPI)
 
@@ -1277,9 +1398,9 @@ _bcs_output(void           *context,
   const fvm_to_cgns_writer_t *w = c->writer;
 
   /* Array should be gathered to rank 0 due to CGNS API limitation
-     when using serial CGNS API */
+     (no partial write for boundary conditions) */
 
-  if (w->rank > 0) {
+  if (w->rank > 0 && w->parallel_io == false) {
     assert(block_start >= block_end);
     return;
   }
@@ -1291,6 +1412,26 @@ _bcs_output(void           *context,
 
   cgsize_t    n_elts = block_end - block_start;
   int        *f_gc_id = (int *)buffer;
+  int        *_f_gc_id = nullptr;
+
+  /* With the parallel CGNS API, writes are collective, so the lists
+     gathered on rank 0 are broadcast and processed identically
+     on all ranks */
+
+#if defined(HAVE_CGNS_MPI)
+
+  if (w->parallel_io) {
+    cs_gnum_t _n_elts = n_elts;
+    MPI_Bcast(&_n_elts, 1, CS_MPI_GNUM, 0, w->comm);
+    n_elts = _n_elts;
+    if (w->rank > 0) {
+      BFT_MALLOC(_f_gc_id, n_elts, int);
+      f_gc_id = _f_gc_id;
+    }
+    MPI_Bcast(f_gc_id, n_elts, MPI_INT, 0, w->comm);
+  }
+
+#endif
 
   int n_gc_sets = fvm_group_class_set_size(gc_set) + 1;
 
@@ -1528,6 +1669,8 @@ _bcs_output(void           *context,
   BFT_FREE(g_elts);
 
   cs_map_name_to_id_destroy(&group_names);
+
+  BFT_FREE(_f_gc_id);
 }
 
 /*----------------------------------------------------------------------------
@@ -1588,9 +1731,58 @@ _field_output(void           *context,
     assert(0);
   }
 
-  /* Output in parallel case */
+  /* Output with parallel CGNS API */
+
+#if defined(HAVE_CGNS_MPI)
+
+  if (w->parallel_io) {
+
+    /* Ranks with an empty block still take part in collective calls,
+       with a null data pointer (empty selection) */
+
+    cgsize_t rmin = block_start, rmax = block_end - 1;
+    const void *_values = buffer;
+
+    if (block_end <= block_start) {
+      rmin = 1;
+      rmax = 1;
+      _values = nullptr;
+    }
 
-  /* TODO: add variant for parallel CGNS */
+    int retval = cgp_field_write(w->index,
+                                 c->base->index,
+                                 zone_index,
+                                 c->solution_index,
+                                 cgns_datatype,
+                                 field_c_label,
+                                 &field_index);
+
+    if (retval == CG_OK)
+      retval = cgp_field_write_data(w->index,
+                                    c->base->index,
+                                    zone_index,
+                                    c->solution_index,
+                                    field_index,
+                                    &rmin,
+                                    &rmax,
+                                    _values);
+
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s() failed to write "
+                  "field values:\n\"%s\"\n"
+                  "Associated writer: \"%s\"\n"
+                  "Associated base: \"%s\"\n%s"),
+                "cgp_field_write_data",
+                field_c_label, w->name, c->base->name,
+                cg_get_error());
+
+    return;
+  }
+
+#endif /* defined(HAVE_CGNS_MPI) */
+
+  /* Output in parallel case, using serializer */
 
 #if defined(HAVE_MPI)
 
@@ -1982,7 +2174,71 @@ _write_block_connect_s_g(const fvm_writer_section_t  *current_section,
 
   _define_section(current_section, section_id, section_name, &cgns_elt_type);
 
-  /* TODO add parallel version of the API */
+  /* With parallel IO, each rank writes its own block */
+
+#if defined(HAVE_CGNS_MPI)
+
+  if (writer->parallel_io) {
+
+    cs_gnum_t n_l_elts = num_end - num_start, n_g_elts = 0;
+    MPI_Allreduce(&n_l_elts, &n_g_elts, 1, CS_MPI_GNUM, MPI_SUM,
+                  writer->comm);
+
+    cgsize_t  s_start = *global_counter + 1;
+    cgsize_t  s_end   = *global_counter + n_g_elts;
+
+    retval = cgp_section_write(writer->index,
+                               base->index,
+                               zone_index,
+                               section_name,
+                               cgns_elt_type,
+                               s_start,
+                               s_end,
+                               0, /* unsorted boundary elements */
+                               &section_index);
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cgp_section_write() failed to write elements:\n"
+                  "Associated writer: \"%s\"\n"
+                  "Associated base: \"%s\"\n"
+                  "Associated section name: \"%s\"\n%s"),
+                writer->name, base->name, section_name, cg_get_error());
+
+    /* Ranks with an empty block use a null data pointer */
+
+    cgsize_t  b_start = *global_counter + num_start;
+    cgsize_t  b_end   = *global_counter + num_end - 1;
+    const cgsize_t  *_block_connect = block_connect;
+
+    if (n_l_elts == 0) {
+      b_start = s_start;
+      b_end = s_start;
+      _block_connect = nullptr;
+    }
+
+    retval = cgp_elements_write_data(writer->index,
+                                     base->index,
+                                     zone_index,
+                                     section_index,
+                                     b_start,
+                                     b_end,
+                                     _block_connect);
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cgp_elements_write_data() failed to write elements:\n"
+                  "Associated writer: \"%s\"\n"
+                  "Associated base: \"%s\"\n"
+                  "Associated section name: \"%s\"\n"
+                  "Associated range: [%llu, %llu]\n%s\n"),
+                writer->name, base->name, section_name,
+                (unsigned long long) b_start,
+                (unsigned long long) b_end,
+                cg_get_error());
+
+    return;
+  }
+
+#endif /* defined(HAVE_CGNS_MPI) */
 
   /* For non-parallel IO, use serializer */
 
@@ -2584,6 +2840,104 @@ _write_block_connect_i_g(const fvm_writer_section_t  *current_section,
 
   _define_section(current_section, section_id, section_name, &cgns_elt_type);
 
+  /* With parallel IO, each rank writes its own block, with connectivity
+     offsets shifted by those of previous ranks */
+
+#if defined(HAVE_CGNS_MPI)
+
+  if (writer->parallel_io) {
+
+    const cs_gnum_t  n_l_elts = num_end - num_start;
+
+    /* Remove element sizes from connectivity and build offsets */
+
+    cgsize_t *block_offsets;
+    BFT_MALLOC(block_offsets, n_l_elts + 1, cgsize_t);
+
+    cs_lnum_t  j = 0, k = 0;
+    block_offsets[0] = 0;
+    for (cs_gnum_t i = 0; i < n_l_elts; i++) {
+      cs_lnum_t elt_size = block_connect[j++];
+      for (cs_lnum_t l = 0; l < elt_size; l++)
+        block_connect[k++] = block_connect[j++];
+      block_offsets[i+1] = k;
+    }
+    assert(j == block_size);
+
+    cs_gnum_t  l_sizes[2] = {n_l_elts, (cs_gnum_t)k}, g_sizes[2] = {0, 0};
+    cs_gnum_t  connect_end = 0;
+
+    MPI_Allreduce(l_sizes, g_sizes, 2, CS_MPI_GNUM, MPI_SUM, writer->comm);
+    MPI_Scan(l_sizes + 1, &connect_end, 1, CS_MPI_GNUM, MPI_SUM,
+             writer->comm);
+
+    cgsize_t  connect_shift = connect_end - l_sizes[1];
+    for (cs_gnum_t i = 0; i < n_l_elts + 1; i++)
+      block_offsets[i] += connect_shift;
+
+    cgsize_t  s_start = *global_counter + 1;
+    cgsize_t  s_end   = *global_counter + g_sizes[0];
+
+    retval = cgp_poly_section_write(writer->index,
+                                    base->index,
+                                    zone_index,
+                                    section_name,
+                                    cgns_elt_type,
+                                    s_start,
+                                    s_end,
+                                    g_sizes[1],
+                                    0, /* unsorted boundary elements */
+                                    &section_index);
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cgp_poly_section_write() failed to write elements:\n"
+                  "Associated writer: \"%s\"\n"
+                  "Associated base: \"%s\"\n"
+                  "Associated section name: \"%s\"\n%s"),
+                writer->name, base->name, section_name, cg_get_error());
+
+    /* Ranks with an empty block use null data pointers */
+
+    cgsize_t  b_start = *global_counter + num_start;
+    cgsize_t  b_end   = *global_counter + num_end - 1;
+    const cgsize_t  *_block_connect = block_connect;
+    const cgsize_t  *_block_offsets = block_offsets;
+
+    if (n_l_elts == 0) {
+      b_start = s_start;
+      b_end = s_start;
+      _block_connect = nullptr;
+      _block_offsets = nullptr;
+    }
+
+    retval = cgp_poly_elements_write_data(writer->index,
+                                          base->index,
+                                          zone_index,
+                                          section_index,
+                                          b_start,
+                                          b_end,
+                                          _block_connect,
+                                          _block_offsets);
+    if (retval != CG_OK)
+      bft_error(__FILE__, __LINE__, 0,
+                _("cgp_poly_elements_write_data() failed to write "
+                  "elements:\n"
+                  "Associated writer: \"%s\"\n"
+                  "Associated base: \"%s\"\n"
+                  "Associated section name: \"%s\"\n"
+                  "Associated range: [%llu, %llu]\n%s\n"),
+                writer->name, base->name, section_name,
+                (unsigned long long) b_start,
+                (unsigned long long) b_end,
+                cg_get_error());
+
+    BFT_FREE(block_offsets);
+
+    return;
+  }
+
+#endif /* defined(HAVE_CGNS_MPI) */
+
   /* For non-parallel IO, use serializer */
 
   {
@@ -3470,6 +3824,11 @@ fvm_to_cgns_version_string(int string_index,
  *   adf                 use ADF file type
  *   hdf5                use HDF5 file type (default if available)
  *   links               split output to separate files using links
+ *   serial_io           do not use the parallel CGNS API (data is
+ *                       serialized through rank 0), even if available
+ *   deflate=<level>     HDF5 compression level, 0 to 9 (default: 0);
+ *                       with parallel IO, requires HDF5 and CGNS builds
+ *                       supporting filters with collective writes
  *
  * As CGNS does not handle polyhedral elements in a simple manner,
  * polyhedra are automatically tesselated with tetrahedra and pyramids
@@ -3518,6 +3877,9 @@ fvm_to_cgns_init_writer(const char             *name,
       writer->n_ranks = n_ranks;
       writer->min_rank_step = 1;
       writer->min_block_size = cs_parall_get_min_coll_buf_size();
+#if defined(HAVE_CGNS_MPI)
+      writer->parallel_io = (n_ranks > 1) ? true : false;
+#endif
     }
     else
       writer->comm = MPI_COMM_NULL;
@@ -3574,6 +3936,17 @@ fvm_to_cgns_init_writer(const char             *name,
                && (strncmp(options + i1, "links", l_opt) == 0))
         use_links = true;
 
+      else if (   (l_opt == 9)
+               && (strncmp(options + i1, "serial_io", l_opt) == 0))
+        writer->parallel_io = false;
+
+      else if (   (l_opt > 8)
+               && (strncmp(options + i1, "deflate=", 8) == 0)) {
+        writer->deflate_level = atoi(options + i1 + 8);
+        writer->deflate_level = CS_MAX(writer->deflate_level, 0);
+        writer->deflate_level = CS_MIN(writer->deflate_level, 9);
+      }
+
       for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
     }
   }
@@ -3624,7 +3997,7 @@ fvm_to_cgns_finalize_writer(void  *this_writer_p)
     writer->mesh_writer =
       (fvm_to_cgns_writer_t *)fvm_to_cgns_finalize_writer(writer->mesh_writer);
 
-  if (writer->rank == 0 && writer->index > -1) {
+  if (_is_io_rank(writer) && writer->index > -1) {
 
     if (writer->bases != nullptr) {
 
@@ -3636,7 +4009,7 @@ fvm_to_cgns_finalize_writer(void  *this_writer_p)
 
     /* Close CGNS File */
 
-  } /* End if rank = 0 */
+  } /* End if I/O rank */
 
   _close_file(writer);
 
@@ -4106,8 +4479,6 @@ fvm_to_cgns_export_field(void                   *this_writer_p,
   int sol_index = 0;
   CGNS_ENUMT(GridLocation_t)  cgns_location = CGNS_ENUMV(GridLocationNull);
 
-  const int  rank = writer->rank;
-
   if (writer->discard_steady && time_step < 0)
     return;
 
@@ -4199,7 +4570,7 @@ fvm_to_cgns_export_field(void                   *this_writer_p,
   /* Field_Name adaptation if necessary */
   /*-----------------------------------*/
 
-  if (rank == 0) {
+  if (_is_io_rank(writer)) {
 
     int        i, shift, pos;
     char      *tmp;
@@ -4263,7 +4634,7 @@ fvm_to_cgns_export_field(void                   *this_writer_p,
       }
     } /* End of loop on output dimension */
 
-  } /* End if rank == 0 */
+  } /* End if I/O rank */
 
   /* Initialize writer helper */
   /*--------------------------*/
@@ -4350,8 +4721,7 @@ fvm_to_cgns_export_field(void                   *this_writer_p,
 
   BFT_FREE(export_list);
 
-  if (rank == 0)
-    BFT_FREE(field_label);
+  BFT_FREE(field_label);
 }
 
 /*----------------------------------------------------------------------------
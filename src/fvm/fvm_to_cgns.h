@@ -108,6 +108,11 @@ fvm_to_cgns_version_string(int string_index,
  *   adf                 use ADF file type
  *   hdf5                use HDF5 file type (default if available)
  *   links               split output to separate files using links
+ *   serial_io           do not use the parallel CGNS API (data is
+ *                       serialized through rank 0), even if available
+ *   deflate=<level>     HDF5 compression level, 0 to 9 (default: 0);
+ *                       with parallel IO, requires HDF5 and CGNS builds
+ *                       supporting filters with collective writes
  *
  * As CGNS does not handle polyhedral elements in a simple manner,
  * polyhedra are automatically tesselated with tetrahedra and pyramids
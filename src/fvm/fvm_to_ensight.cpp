@@ -94,6 +94,9 @@ typedef struct {
   bool         divide_polygons;    /* Option to tesselate polygonal elements */
   bool         divide_polyhedra;   /* Option to tesselate polyhedral elements */
 
+  bool         async_io;           /* Option to write binary files
+                                      asynchronously */
+
   fvm_to_ensight_case_t  *case_info;  /* Associated case structure */
 
 #if defined(HAVE_MPI)
@@ -101,6 +104,8 @@ typedef struct {
   int          min_block_size;     /* Minimum block buffer size */
   MPI_Comm     block_comm;         /* Associated MPI block communicator */
   MPI_Comm     comm;               /* Associated MPI communicator */
+  bool         own_block_comm;     /* true if block_comm was created for
+                                      this writer */
 #endif
 
 } fvm_to_ensight_writer_t;
@@ -187,6 +192,8 @@ _open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
 
     MPI_Info hints;
     cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+    if (this_writer->async_io)
+      method = CS_FILE_STDIO_SERIAL;
     f.bf = cs_file_open(filename,
                         mode,
                         method,
@@ -203,6 +210,9 @@ _open_ensight_file(const fvm_to_ensight_writer_t  *this_writer,
 
     if (this_writer->swap_endian == true)
       cs_file_set_swap_endian(f.bf, 1);
+
+    if (this_writer->async_io == true)
+      cs_file_set_async_write(f.bf);
   }
 
   return f;
@@ -2509,6 +2519,44 @@ _export_field_values_el(const fvm_writer_section_t      *export_section,
   return current_section;
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Set the number of ranks used for distributed block writes.
+ *
+ * Blocks are then only assigned to ranks which are a multiple of the
+ * associated rank step, and files are accessed through a reduced
+ * communicator, so that data is aggregated on those ranks.
+ *
+ * parameters:
+ *   this_writer   <-> pointer to EnSight Gold writer structure
+ *   n_aggregators <-- requested number of aggregator ranks
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_aggregators(fvm_to_ensight_writer_t  *this_writer,
+                 int                       n_aggregators)
+{
+  if (this_writer->comm == MPI_COMM_NULL || this_writer->n_ranks < 2)
+    return;
+
+  /* Ranks whose id is a multiple of the rank step aggregate data
+     (consistent with cs_block_dist_compute_sizes) */
+
+  int n_ranks = this_writer->n_ranks;
+  n_aggregators = CS_MIN(n_aggregators, n_ranks);
+
+  int rank_step = n_ranks / n_aggregators;
+  if (n_ranks % n_aggregators)
+    rank_step += 1;
+
+  this_writer->min_rank_step = rank_step;
+  this_writer->block_comm = cs_file_block_comm(rank_step, this_writer->comm);
+  this_writer->own_block_comm = true;
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -2527,6 +2575,11 @@ _export_field_values_el(const fvm_writer_section_t      *export_section,
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   async               gather binary output on a single rank and write it
+ *                       using a helper thread, overlapping output with
+ *                       subsequent computations
+ *   aggregators=<n>     write distributed binary blocks using (at most)
+ *                       n aggregator ranks (using MPI-IO if available)
  *
  * parameters:
  *   name           <-- base output case name.
@@ -2568,6 +2621,7 @@ fvm_to_ensight_init_writer(const char             *name,
   this_writer->discard_polyhedra = false;
   this_writer->divide_polygons = false;
   this_writer->divide_polyhedra = false;
+  this_writer->async_io = false;
 
   this_writer->rank = 0;
   this_writer->n_ranks = 1;
@@ -2580,6 +2634,7 @@ fvm_to_ensight_init_writer(const char             *name,
     this_writer->min_block_size = 0;
     this_writer->block_comm = MPI_COMM_NULL;
     this_writer->comm = MPI_COMM_NULL;
+    this_writer->own_block_comm = false;
     MPI_Initialized(&mpi_flag);
     if (mpi_flag && comm != MPI_COMM_NULL) {
       size_t min_block_size = cs_parall_get_min_coll_buf_size();
@@ -2600,6 +2655,8 @@ fvm_to_ensight_init_writer(const char             *name,
 
   /* Parse options */
 
+  int n_aggregators = 0;
+
   if (options != nullptr) {
 
     int i1, i2, l_opt;
@@ -2640,12 +2697,24 @@ fvm_to_ensight_init_writer(const char             *name,
                && (strncmp(options + i1, "divide_polyhedra", l_opt) == 0))
         this_writer->divide_polyhedra = true;
 
+      else if ((l_opt == 5) && (strncmp(options + i1, "async", l_opt) == 0))
+        this_writer->async_io = true;
+
+      else if (   (l_opt > 12)
+               && (strncmp(options + i1, "aggregators=", 12) == 0))
+        n_aggregators = CS_MAX(atoi(options + i1 + 12), 1);
+
       for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
 
     }
 
   }
 
+#if defined(HAVE_MPI)
+  if (n_aggregators > 0)
+    _set_aggregators(this_writer, n_aggregators);
+#endif
+
   this_writer->case_info = fvm_to_ensight_case_create(name,
                                                       path,
                                                       time_dependency);
@@ -2675,6 +2744,12 @@ fvm_to_ensight_finalize_writer(void  *this_writer_p)
 
   fvm_to_ensight_case_destroy(this_writer->case_info);
 
+#if defined(HAVE_MPI)
+  if (   this_writer->own_block_comm
+      && this_writer->block_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(this_writer->block_comm));
+#endif
+
   BFT_FREE(this_writer);
 
   return nullptr;
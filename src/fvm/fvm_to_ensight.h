@@ -66,6 +66,11 @@ BEGIN_C_DECLS
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   async               gather binary output on a single rank and write it
+ *                       using a helper thread, overlapping output with
+ *                       subsequent computations
+ *   aggregators=<n>     write distributed binary blocks using (at most)
+ *                       n aggregator ranks (using MPI-IO if available)
  *
  * parameters:
  *   name           <-- base output case name.
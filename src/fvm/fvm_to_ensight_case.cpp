@@ -122,6 +122,11 @@ struct _fvm_to_ensight_case_t {
 
   int            geom_time_set;               /* Index of time set
                                                  associated with geometry */
+  int            geom_file_time_set;          /* Index of time set
+                                                 associated with geometry
+                                                 files, if not all time
+                                                 steps have their own
+                                                 geometry (-1 otherwise) */
 
   fvm_writer_time_dep_t   time_dependency;    /* Mesh time dependency */
 
@@ -186,6 +191,31 @@ _time_set_destroy(fvm_to_ensight_case_time_t  *this_time)
   return nullptr;
 }
 
+/*----------------------------------------------------------------------------
+ * Create a copy of a time set structure.
+ *
+ * parameters:
+ *   src  <-- time set structure to copy
+ *
+ * returns:
+ *   pointer to new time set structure
+ *----------------------------------------------------------------------------*/
+
+static fvm_to_ensight_case_time_t *
+_time_set_copy(const fvm_to_ensight_case_time_t  *src)
+{
+  fvm_to_ensight_case_time_t  *this_time = _time_set_create();
+
+  this_time->n_time_values = src->n_time_values;
+  this_time->last_time_step = src->last_time_step;
+
+  BFT_MALLOC(this_time->time_value, src->n_time_values, double);
+  for (int i = 0; i < src->n_time_values; i++)
+    this_time->time_value[i] = src->time_value[i];
+
+  return this_time;
+}
+
 /*----------------------------------------------------------------------------
  * Add a new time step number and value to a time set if necessary:
  * if the corresponding physical time is not present in the structure,
@@ -510,6 +540,9 @@ _update_geom_file_name(fvm_to_ensight_case_t  *const this_case)
 {
   int geom_index = 0;
 
+  const int geom_time_set = (this_case->geom_file_time_set > -1) ?
+    this_case->geom_file_time_set : this_case->geom_time_set;
+
   /* Set first time */
 
   if (this_case->geom_file_name == nullptr) {
@@ -517,9 +550,8 @@ _update_geom_file_name(fvm_to_ensight_case_t  *const this_case)
     char extension[16] = ".geo";
 
     if (this_case->time_dependency != FVM_WRITER_FIXED_MESH) {
-      if (this_case->geom_time_set > -1)
-        geom_index =
-          (this_case->time_set[this_case->geom_time_set])->n_time_values;
+      if (geom_time_set > -1)
+        geom_index = (this_case->time_set[geom_time_set])->n_time_values;
       sprintf(extension, ".geo.%05d", geom_index);
     }
 
@@ -534,9 +566,8 @@ _update_geom_file_name(fvm_to_ensight_case_t  *const this_case)
   /* Change geometry index */
 
   else if (this_case->time_dependency != FVM_WRITER_FIXED_MESH) {
-    if (this_case->geom_time_set > -1) {
-      geom_index =
-        (this_case->time_set[this_case->geom_time_set])->n_time_values;
+    if (geom_time_set > -1) {
+      geom_index = (this_case->time_set[geom_time_set])->n_time_values;
       sprintf(this_case->geom_file_name + strlen(this_case->geom_file_name) - 5,
               "%05d", geom_index);
     }
@@ -626,6 +657,7 @@ fvm_to_ensight_case_create(const char                   *const name,
   this_case->var = nullptr;
 
   this_case->geom_time_set = -1; /* no time set yet */
+  this_case->geom_file_time_set = -1;
 
   this_case->time_dependency = time_dependency;
 
@@ -735,10 +767,15 @@ fvm_to_ensight_case_set_geom_time(fvm_to_ensight_case_t  *const this_case,
     this_case->time_set[this_case->geom_time_set] = _time_set_create();
   }
 
-  if (this_case->time_dependency != FVM_WRITER_FIXED_MESH)
+  if (this_case->time_dependency != FVM_WRITER_FIXED_MESH) {
     retval = _add_time(this_case->time_set[this_case->geom_time_set],
                        time_step,
                        time_value);
+    if (this_case->geom_file_time_set > -1)
+      retval = _add_time(this_case->time_set[this_case->geom_file_time_set],
+                         time_step,
+                         time_value);
+  }
 
   if (retval > 0) {
     _update_geom_file_name(this_case);
@@ -974,6 +1011,25 @@ fvm_to_ensight_case_get_var_file(fvm_to_ensight_case_t       *const this_case,
     }
 
     time_set = this_case->geom_time_set;
+
+    /* If the geometry was not output for this (new) time step,
+       geometry files are based on a separate time set, so that
+       the previous geometry is reused */
+
+    const fvm_to_ensight_case_time_t *ts = this_case->time_set[time_set];
+    if (   this_case->time_dependency != FVM_WRITER_FIXED_MESH
+        && this_case->geom_file_time_set < 0
+        && ts->n_time_values > 0
+        && time_step > ts->last_time_step) {
+      this_case->geom_file_time_set = this_case->n_time_sets;
+      this_case->n_time_sets += 1;
+      BFT_REALLOC(this_case->time_set,
+                  this_case->n_time_sets,
+                  fvm_to_ensight_case_time_t *);
+      this_case->time_set[this_case->geom_file_time_set]
+        = _time_set_copy(ts);
+    }
+
     if (_add_time(this_case->time_set[time_set], time_step, time_value) > 0)
       this_case->modified = true;
   }
@@ -1037,6 +1093,9 @@ fvm_to_ensight_case_write_case(fvm_to_ensight_case_t  *this_case,
   if (rank > 0)
     return;
 
+  const int geom_time_set = (this_case->geom_file_time_set > -1) ?
+    this_case->geom_file_time_set : this_case->geom_time_set;
+
   /* Open case file (overwrite it if present) */
 
   f = fopen(this_case->case_file_name, "w");
@@ -1064,12 +1123,12 @@ fvm_to_ensight_case_write_case(fvm_to_ensight_case_t  *this_case,
 
   else if (this_case->time_dependency == FVM_WRITER_TRANSIENT_COORDS)
     fprintf(f, "model: %d %s.geo.*****  change_coords_only\n",
-            this_case->geom_time_set + 1,
+            geom_time_set + 1,
             this_case->file_name_prefix + this_case->dir_name_length);
 
   else
     fprintf(f, "model: %d %s.geo.*****\n",
-            this_case->geom_time_set + 1,
+            geom_time_set + 1,
             this_case->file_name_prefix + this_case->dir_name_length);
 
   /* Output variables */
@@ -0,0 +1,1433 @@
+/*============================================================================
+ * Write a nodal representation associated with a mesh and associated
+ * variables to compressed HDF5 files
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_HDF5)
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ * HDF5 library headers
+ *----------------------------------------------------------------------------*/
+
+#include <hdf5.h>
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+
+#include "fvm_defs.h"
+#include "fvm_io_num.h"
+#include "fvm_nodal.h"
+#include "fvm_nodal_priv.h"
+#include "fvm_writer_helper.h"
+#include "fvm_writer_priv.h"
+
+#include "cs_block_dist.h"
+#include "cs_part_to_block.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "fvm_to_hdf5.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+#define FVM_HDF5_PATH_SIZE     256     /* Maximum dataset path length */
+
+#define FVM_HDF5_CHUNK_SIZE  65536     /* Default number of entities
+                                          per dataset chunk */
+
+#define FVM_HDF5_FILTER_ZFP  32013     /* Registered id of the H5Z-ZFP
+                                          filter plugin */
+
+/*============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * HDF5 writer structure
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  char        *name;               /* Writer name */
+  char        *filename;           /* Associated (sub)file name */
+
+  hid_t        file_id;            /* Associated file id, or -1 on
+                                      ranks which do not write */
+
+  int          rank;               /* Rank of current process in
+                                      communicator */
+  int          n_ranks;            /* Number of processes in
+                                      communicator */
+
+  int          n_subfiles;         /* Number of subfiles */
+  int          subfile_id;         /* Local subfile id, or -1 */
+  int          min_rank_step;      /* Step between writing ranks */
+
+  fvm_writer_time_dep_t   time_dependency; /* Mesh time dependency */
+
+  int          time_step;          /* Current mesh time step */
+  double       time_value;         /* Current mesh time value */
+
+  int          deflate_level;      /* zlib compression level (0: none) */
+  double       tolerance;          /* Absolute error bound for lossy
+                                      compression of field values
+                                      (0: lossless) */
+  bool         use_zfp;            /* Use ZFP filter for lossy compression
+                                      if available */
+  hsize_t      chunk_size;         /* Number of entities per chunk */
+
+  bool         discard_polygons;   /* Option to discard polygonal elements */
+  bool         discard_polyhedra;  /* Option to discard polyhedral elements */
+
+#if defined(HAVE_MPI)
+  MPI_Comm     comm;               /* Associated MPI communicator */
+#endif
+
+} fvm_to_hdf5_writer_t;
+
+/*----------------------------------------------------------------------------
+ * Context structure for fvm_writer_field_helper_output_* functions.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  const fvm_to_hdf5_writer_t  *writer;      /* Pointer to writer structure */
+
+  const char                  *path;        /* Dataset path */
+  cs_gnum_t                    n_g_ent;     /* Global number of entities */
+
+} _hdf5_context_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static char _hdf5_version_string[2][32] = {"", ""};
+
+/*=============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return HDF5 native datatype matching a given datatype.
+ *
+ * parameters:
+ *   datatype <-- datatype
+ *
+ * returns:
+ *   matching HDF5 datatype
+ *----------------------------------------------------------------------------*/
+
+static hid_t
+_hdf5_datatype(cs_datatype_t  datatype)
+{
+  hid_t retval = -1;
+
+  switch(datatype) {
+  case CS_CHAR:
+    retval = H5T_NATIVE_UCHAR;
+    break;
+  case CS_FLOAT:
+    retval = H5T_NATIVE_FLOAT;
+    break;
+  case CS_DOUBLE:
+    retval = H5T_NATIVE_DOUBLE;
+    break;
+  case CS_INT32:
+    retval = H5T_NATIVE_INT32;
+    break;
+  case CS_INT64:
+    retval = H5T_NATIVE_INT64;
+    break;
+  case CS_UINT32:
+    retval = H5T_NATIVE_UINT32;
+    break;
+  case CS_UINT64:
+    retval = H5T_NATIVE_UINT64;
+    break;
+  default:
+    assert(0);
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Build a name usable as an HDF5 link name.
+ *
+ * parameters:
+ *   name     <-- base name
+ *   h5_name  --> associated link name (sanitized and truncated)
+ *----------------------------------------------------------------------------*/
+
+static void
+_link_name(const char  *name,
+           char         h5_name[FVM_HDF5_PATH_SIZE/4 + 1])
+{
+  size_t l = strlen(name);
+  if (l > FVM_HDF5_PATH_SIZE/4)
+    l = FVM_HDF5_PATH_SIZE/4;
+
+  for (size_t i = 0; i < l; i++) {
+    if (name[i] == '/')
+      h5_name[i] = '_';
+    else
+      h5_name[i] = name[i];
+  }
+  h5_name[l] = '\0';
+
+  if (l == 0)
+    strcpy(h5_name, "_");
+}
+
+/*----------------------------------------------------------------------------
+ * Build the path of the group matching a given time step.
+ *
+ * parameters:
+ *   mesh_name   <-- mesh name
+ *   category    <-- "geometry" or "fields/<field_name>"
+ *   time_step   <-- time step, or -1 for time-independent data
+ *   path        --> associated group path
+ *----------------------------------------------------------------------------*/
+
+static void
+_group_path(const char  *mesh_name,
+            const char  *category,
+            int          time_step,
+            char         path[FVM_HDF5_PATH_SIZE])
+{
+  char h5_mesh_name[FVM_HDF5_PATH_SIZE/4 + 1];
+  _link_name(mesh_name, h5_mesh_name);
+
+  if (time_step < 0)
+    snprintf(path, FVM_HDF5_PATH_SIZE, "/%s/%s/constant",
+             h5_mesh_name, category);
+  else
+    snprintf(path, FVM_HDF5_PATH_SIZE, "/%s/%s/step_%d",
+             h5_mesh_name, category, time_step);
+
+  path[FVM_HDF5_PATH_SIZE - 1] = '\0';
+}
+
+/*----------------------------------------------------------------------------
+ * Remove a link from an HDF5 file if it is already present.
+ *
+ * As H5Lexists requires all intermediate path components to exist,
+ * they are checked in turn.
+ *
+ * parameters:
+ *   file_id <-- associated file id
+ *   path    <-- absolute link path
+ *----------------------------------------------------------------------------*/
+
+static void
+_remove_link(hid_t        file_id,
+             const char  *path)
+{
+  char sub_path[FVM_HDF5_PATH_SIZE];
+
+  size_t l = strlen(path);
+  if (l >= FVM_HDF5_PATH_SIZE)
+    l = FVM_HDF5_PATH_SIZE - 1;
+
+  for (size_t i = 1; i <= l; i++) {
+    if (i == l || path[i] == '/') {
+      memcpy(sub_path, path, i);
+      sub_path[i] = '\0';
+      if (H5Lexists(file_id, sub_path, H5P_DEFAULT) <= 0)
+        return;
+    }
+  }
+
+  H5Ldelete(file_id, path, H5P_DEFAULT);
+}
+
+/*----------------------------------------------------------------------------
+ * Add a scalar attribute to an HDF5 object.
+ *
+ * parameters:
+ *   obj_id <-- associated object id
+ *   name   <-- attribute name
+ *   type   <-- HDF5 datatype
+ *   value  <-- pointer to attribute value
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_attribute(hid_t        obj_id,
+                 const char  *name,
+                 hid_t        type,
+                 const void  *value)
+{
+  hid_t space_id = H5Screate(H5S_SCALAR);
+  hid_t attr_id = H5Acreate2(obj_id, name, type, space_id,
+                             H5P_DEFAULT, H5P_DEFAULT);
+  H5Awrite(attr_id, type, value);
+  H5Aclose(attr_id);
+  H5Sclose(space_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Add a character string attribute to an HDF5 object.
+ *
+ * parameters:
+ *   obj_id <-- associated object id
+ *   name   <-- attribute name
+ *   value  <-- attribute value
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_string_attribute(hid_t        obj_id,
+                        const char  *name,
+                        const char  *value)
+{
+  hid_t type_id = H5Tcopy(H5T_C_S1);
+  H5Tset_size(type_id, strlen(value) + 1);
+  H5Tset_strpad(type_id, H5T_STR_NULLTERM);
+
+  _write_attribute(obj_id, name, type_id, value);
+
+  H5Tclose(type_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Write a 1 or 2-dimensional array to a dataset of the writer's
+ * (sub)file, using a chunked and compressed layout.
+ *
+ * Lossy compression is only applied to floating-point values when
+ * the lossy argument is true and the writer tolerance is positive.
+ *
+ * parameters:
+ *   w            <-- pointer to associated writer
+ *   path         <-- absolute dataset path
+ *   datatype     <-- datatype of values
+ *   n_rows       <-- local number of rows
+ *   n_cols       <-- number of columns (1 for 1-dimensional arrays)
+ *   lossy        <-- allow lossy compression
+ *   global_start <-- global number of first row (or 0 if not applicable)
+ *   n_g_rows     <-- global number of rows (or 0 if not applicable)
+ *   values       <-- pointer to values
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_dataset(const fvm_to_hdf5_writer_t  *w,
+               const char                  *path,
+               cs_datatype_t                datatype,
+               size_t                       n_rows,
+               int                          n_cols,
+               bool                         lossy,
+               cs_gnum_t                    global_start,
+               cs_gnum_t                    n_g_rows,
+               const void                  *values)
+{
+  assert(w->file_id >= 0);
+
+  const hid_t h5_type = _hdf5_datatype(datatype);
+  const int n_dims = (n_cols > 1) ? 2 : 1;
+
+  hsize_t dims[2] = {n_rows, (hsize_t)n_cols};
+
+  _remove_link(w->file_id, path);
+
+  hid_t space_id = H5Screate_simple(n_dims, dims, nullptr);
+  hid_t lcpl_id = H5Pcreate(H5P_LINK_CREATE);
+  hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+
+  H5Pset_create_intermediate_group(lcpl_id, 1);
+
+  /* Empty datasets use a contiguous layout without filters */
+
+  if (n_rows > 0) {
+
+    hsize_t chunk_dims[2] = {w->chunk_size, (hsize_t)n_cols};
+    if (chunk_dims[0] > n_rows)
+      chunk_dims[0] = n_rows;
+
+    H5Pset_chunk(dcpl_id, n_dims, chunk_dims);
+
+    bool is_real = (datatype == CS_FLOAT || datatype == CS_DOUBLE);
+    bool use_deflate = (   w->deflate_level > 0
+                        && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0);
+
+    if (lossy && is_real && w->tolerance > 0) {
+
+      if (w->use_zfp && H5Zfilter_avail(FVM_HDF5_FILTER_ZFP) > 0) {
+
+        /* Fixed accuracy mode, with tolerance stored in cd_values[2-3] */
+
+        unsigned int cd_values[4] = {3, 0, 0, 0};
+        memcpy(cd_values + 2, &(w->tolerance), sizeof(double));
+        H5Pset_filter(dcpl_id, FVM_HDF5_FILTER_ZFP, H5Z_FLAG_MANDATORY,
+                      4, cd_values);
+        use_deflate = false;
+
+      }
+      else {
+
+        /* Decimal scaling leads to an error bound of 0.5*10^(-D) */
+
+        int d_scale = ceil(log10(0.5 / w->tolerance));
+        if (d_scale < 0)
+          d_scale = 0;
+        H5Pset_scaleoffset(dcpl_id, H5Z_SO_FLOAT_DSCALE, d_scale);
+
+      }
+
+    }
+    else if (use_deflate)
+      H5Pset_shuffle(dcpl_id);
+
+    if (use_deflate)
+      H5Pset_deflate(dcpl_id, w->deflate_level);
+
+  }
+
+  hid_t dset_id = H5Dcreate2(w->file_id, path, h5_type, space_id,
+                             lcpl_id, dcpl_id, H5P_DEFAULT);
+
+  if (dset_id < 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("HDF5: error creating dataset \"%s\" in file \"%s\"."),
+              path, w->filename);
+
+  if (n_rows > 0)
+    H5Dwrite(dset_id, h5_type, H5S_ALL, H5S_ALL, H5P_DEFAULT, values);
+
+  if (n_g_rows > 0) {
+    unsigned long long _global_start = global_start;
+    unsigned long long _n_g_rows = n_g_rows;
+    _write_attribute(dset_id, "global_start", H5T_NATIVE_ULLONG,
+                     &_global_start);
+    _write_attribute(dset_id, "global_size", H5T_NATIVE_ULLONG,
+                     &_n_g_rows);
+  }
+
+  H5Dclose(dset_id);
+  H5Pclose(dcpl_id);
+  H5Pclose(lcpl_id);
+  H5Sclose(space_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Add time attributes to a group of the writer's (sub)file.
+ *
+ * parameters:
+ *   w          <-- pointer to associated writer
+ *   path       <-- absolute group path
+ *   time_step  <-- time step number
+ *   time_value <-- time value
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_time_attributes(const fvm_to_hdf5_writer_t  *w,
+                       const char                  *path,
+                       int                          time_step,
+                       double                       time_value)
+{
+  hid_t group_id = H5Gopen2(w->file_id, path, H5P_DEFAULT);
+
+  if (group_id < 0)
+    return;
+
+  if (H5Aexists(group_id, "time_step") > 0)
+    H5Adelete(group_id, "time_step");
+  if (H5Aexists(group_id, "time_value") > 0)
+    H5Adelete(group_id, "time_value");
+
+  _write_attribute(group_id, "time_step", H5T_NATIVE_INT, &time_step);
+  _write_attribute(group_id, "time_value", H5T_NATIVE_DOUBLE, &time_value);
+
+  H5Gclose(group_id);
+}
+
+/*----------------------------------------------------------------------------
+ * Output function for field values.
+ *
+ * This function is passed to fvm_writer_field_helper_output_* functions.
+ *
+ * parameters:
+ *   context      <-> pointer to writer and mesh context
+ *   datatype     <-- output datatype
+ *   dimension    <-- output field dimension
+ *   component_id <-- output component id (if non-interleaved)
+ *   block_start  <-- start global number of element for current block
+ *   block_end    <-- past-the-end global number of element for current block
+ *   buffer       <-> associated output buffer
+ *----------------------------------------------------------------------------*/
+
+static void
+_field_output(void           *context,
+              cs_datatype_t   datatype,
+              int             dimension,
+              int             component_id,
+              cs_gnum_t       block_start,
+              cs_gnum_t       block_end,
+              void           *buffer)
+{
+  CS_UNUSED(component_id);
+
+  auto c = static_cast<_hdf5_context_t *>(context);
+
+  const fvm_to_hdf5_writer_t  *w = c->writer;
+
+  if (w->file_id < 0)
+    return;
+
+  _write_dataset(w,
+                 c->path,
+                 datatype,
+                 block_end - block_start,
+                 dimension,
+                 true,
+                 block_start,
+                 c->n_g_ent,
+                 buffer);
+}
+
+/*----------------------------------------------------------------------------
+ * Count vertex connectivity values of a local element in the
+ * "element_connect" representation.
+ *
+ * Polyhedra are defined by their number of faces, followed by each face's
+ * number of vertices and vertex numbers.
+ *
+ * parameters:
+ *   section <-- pointer to nodal mesh section
+ *   elt_id  <-- element id in section
+ *
+ * returns:
+ *   number of connectivity values
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_elt_connect_size(const  fvm_nodal_section_t  *section,
+                  cs_lnum_t                    elt_id)
+{
+  cs_lnum_t n = 0;
+
+  if (section->stride > 0)
+    n = section->stride;
+
+  else if (section->type == FVM_FACE_POLY)
+    n =   section->vertex_index[elt_id+1]
+        - section->vertex_index[elt_id];
+
+  else {
+    n = 1;
+    for (cs_lnum_t j = section->face_index[elt_id];
+         j < section->face_index[elt_id+1];
+         j++) {
+      cs_lnum_t f_id = CS_ABS(section->face_num[j]) - 1;
+      n += 1 + section->vertex_index[f_id+1] - section->vertex_index[f_id];
+    }
+  }
+
+  return n;
+}
+
+/*----------------------------------------------------------------------------
+ * Build local element type, connectivity index, and connectivity arrays.
+ *
+ * Elements of all exported sections are concatenated.
+ *
+ * parameters:
+ *   export_list   <-- pointer to section list to export
+ *   vtx_gnum      <-- vertex global numbers, or nullptr for local numbers
+ *   n_elts        --> number of local elements
+ *   elt_type      --> element type codes
+ *   elt_idx       --> element connectivity index
+ *   elt_connect   --> element connectivity values
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_part_connect(const fvm_writer_section_t   *export_list,
+                    const cs_gnum_t              *vtx_gnum,
+                    cs_lnum_t                    *n_elts,
+                    unsigned char               **elt_type,
+                    cs_lnum_t                   **elt_idx,
+                    cs_gnum_t                   **elt_connect)
+{
+  cs_lnum_t _n_elts = 0;
+
+  for (const fvm_writer_section_t *s = export_list;
+       s != nullptr;
+       s = s->next)
+    _n_elts += s->section->n_elements;
+
+  unsigned char *_elt_type;
+  cs_lnum_t *_elt_idx;
+  cs_gnum_t *_elt_connect;
+
+  BFT_MALLOC(_elt_type, _n_elts, unsigned char);
+  BFT_MALLOC(_elt_idx, _n_elts + 1, cs_lnum_t);
+
+  /* Build index */
+
+  cs_lnum_t k = 0;
+  _elt_idx[0] = 0;
+
+  for (const fvm_writer_section_t *s = export_list;
+       s != nullptr;
+       s = s->next) {
+    const fvm_nodal_section_t  *section = s->section;
+    for (cs_lnum_t i = 0; i < section->n_elements; i++) {
+      _elt_type[k] = (unsigned char)(section->type);
+      _elt_idx[k+1] = _elt_idx[k] + _elt_connect_size(section, i);
+      k++;
+    }
+  }
+
+  BFT_MALLOC(_elt_connect, _elt_idx[_n_elts], cs_gnum_t);
+
+# define _VTX_GNUM(_v) \
+  ((vtx_gnum != nullptr) ? vtx_gnum[(_v) - 1] : (cs_gnum_t)(_v))
+
+  /* Build connectivity */
+
+  cs_gnum_t *c = _elt_connect;
+
+  for (const fvm_writer_section_t *s = export_list;
+       s != nullptr;
+       s = s->next) {
+
+    const fvm_nodal_section_t  *section = s->section;
+
+    if (section->stride > 0) {
+      size_t n = section->n_elements * section->stride;
+      for (size_t i = 0; i < n; i++)
+        *c++ = _VTX_GNUM(section->vertex_num[i]);
+    }
+
+    else if (section->type == FVM_FACE_POLY) {
+      cs_lnum_t n = section->vertex_index[section->n_elements];
+      for (cs_lnum_t i = 0; i < n; i++)
+        *c++ = _VTX_GNUM(section->vertex_num[i]);
+    }
+
+    else {
+      for (cs_lnum_t i = 0; i < section->n_elements; i++) {
+        *c++ = section->face_index[i+1] - section->face_index[i];
+        for (cs_lnum_t j = section->face_index[i];
+             j < section->face_index[i+1];
+             j++) {
+          cs_lnum_t f_id = CS_ABS(section->face_num[j]) - 1;
+          cs_lnum_t s_id = section->vertex_index[f_id];
+          cs_lnum_t e_id = section->vertex_index[f_id+1];
+          *c++ = e_id - s_id;
+          if (section->face_num[j] > 0) {
+            for (cs_lnum_t l = s_id; l < e_id; l++)
+              *c++ = _VTX_GNUM(section->vertex_num[l]);
+          }
+          else {
+            for (cs_lnum_t l = e_id - 1; l >= s_id; l--)
+              *c++ = _VTX_GNUM(section->vertex_num[l]);
+          }
+        }
+      }
+    }
+
+  }
+
+# undef _VTX_GNUM
+
+  assert(c == _elt_connect + _elt_idx[_n_elts]);
+
+  *n_elts = _n_elts;
+  *elt_type = _elt_type;
+  *elt_idx = _elt_idx;
+  *elt_connect = _elt_connect;
+}
+
+/*----------------------------------------------------------------------------
+ * Write vertex coordinates and element connectivity.
+ *
+ * parameters:
+ *   w           <-- pointer to associated writer
+ *   mesh        <-- pointer to nodal mesh structure
+ *   export_list <-- pointer to section list to export
+ *   path        <-- associated geometry group path
+ *----------------------------------------------------------------------------*/
+
+static void
+_export_geometry(const fvm_to_hdf5_writer_t  *w,
+                 const fvm_nodal_t           *mesh,
+                 const fvm_writer_section_t  *export_list,
+                 const char                  *path)
+{
+  char  d_path[FVM_HDF5_PATH_SIZE + 32];
+
+  const int dim = mesh->dim;
+  const cs_lnum_t   *parent_vertex_id = mesh->parent_vertex_id;
+  const cs_lnum_t  n_vertices = mesh->n_vertices;
+  const cs_gnum_t  n_g_vertices
+    = fvm_nodal_get_n_g_vertices(mesh);
+
+  /* Local coordinates, always padded to 3 dimensions */
+
+  double *part_coords;
+  BFT_MALLOC(part_coords, n_vertices*3, double);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    cs_lnum_t j = (parent_vertex_id != nullptr) ? parent_vertex_id[i] : i;
+    for (int k = 0; k < 3; k++)
+      part_coords[i*3 + k] = (k < dim) ? mesh->vertex_coords[j*dim + k] : 0.;
+  }
+
+  /* Local connectivity */
+
+  const cs_gnum_t *vtx_gnum = nullptr;
+  if (w->n_ranks > 1)
+    vtx_gnum = fvm_io_num_get_global_num(mesh->global_vertex_num);
+
+  cs_lnum_t  n_elts = 0;
+  unsigned char  *elt_type = nullptr;
+  cs_lnum_t  *elt_idx = nullptr;
+  cs_gnum_t  *elt_connect = nullptr;
+
+  _build_part_connect(export_list,
+                      vtx_gnum,
+                      &n_elts,
+                      &elt_type,
+                      &elt_idx,
+                      &elt_connect);
+
+  cs_gnum_t n_g_elts = 0;
+  for (const fvm_writer_section_t *s = export_list;
+       s != nullptr;
+       s = s->next)
+    n_g_elts += fvm_io_num_get_global_count(s->section->global_element_num);
+
+  cs_gnum_t v_start = 1, e_start = 1;
+  cs_lnum_t  n_vtx_block = n_vertices, n_elt_block = n_elts;
+
+  double *block_coords = part_coords;
+  unsigned char  *block_type = elt_type;
+  cs_lnum_t  *block_idx = elt_idx;
+  cs_gnum_t  *block_connect = elt_connect;
+
+#if defined(HAVE_MPI)
+
+  /* Distribute to aggregating ranks */
+
+  if (w->n_ranks > 1) {
+
+    cs_block_dist_info_t  bi;
+    cs_part_to_block_t  *d = nullptr;
+
+    fvm_writer_vertex_part_to_block_create(w->min_rank_step,
+                                           0,
+                                           0,
+                                           0,
+                                           mesh,
+                                           &bi,
+                                           &d,
+                                           w->comm);
+
+    v_start = bi.gnum_range[0];
+    n_vtx_block = bi.gnum_range[1] - bi.gnum_range[0];
+
+    BFT_MALLOC(block_coords, n_vtx_block*3, double);
+    cs_part_to_block_copy_array(d, CS_DOUBLE, 3, part_coords, block_coords);
+    cs_part_to_block_destroy(&d);
+
+    /* Global element numbers, shifted by section */
+
+    cs_gnum_t *elt_gnum;
+    BFT_MALLOC(elt_gnum, n_elts, cs_gnum_t);
+
+    cs_lnum_t k = 0;
+    cs_gnum_t gnum_shift = 0;
+    for (const fvm_writer_section_t *s = export_list;
+         s != nullptr;
+         s = s->next) {
+      const fvm_io_num_t *io_num = s->section->global_element_num;
+      const cs_lnum_t n_s_elts = fvm_io_num_get_local_count(io_num);
+      const cs_gnum_t *s_gnum = fvm_io_num_get_global_num(io_num);
+      for (cs_lnum_t i = 0; i < n_s_elts; i++)
+        elt_gnum[k++] = s_gnum[i] + gnum_shift;
+      gnum_shift += fvm_io_num_get_global_count(io_num);
+    }
+
+    bi = cs_block_dist_compute_sizes(w->rank,
+                                     w->n_ranks,
+                                     w->min_rank_step,
+                                     0,
+                                     n_g_elts);
+
+    e_start = bi.gnum_range[0];
+    n_elt_block = bi.gnum_range[1] - bi.gnum_range[0];
+
+    d = cs_part_to_block_create_by_gnum(w->comm, bi, n_elts, elt_gnum);
+    cs_part_to_block_transfer_gnum(d, elt_gnum);
+
+    BFT_MALLOC(block_type, n_elt_block, unsigned char);
+    BFT_MALLOC(block_idx, n_elt_block + 1, cs_lnum_t);
+    block_idx[0] = 0;
+
+    cs_part_to_block_copy_array(d, CS_CHAR, 1, elt_type, block_type);
+    cs_part_to_block_copy_index(d, elt_idx, block_idx);
+
+    BFT_MALLOC(block_connect, block_idx[n_elt_block], cs_gnum_t);
+
+    cs_part_to_block_copy_indexed(d,
+                                  CS_GNUM_TYPE,
+                                  elt_idx,
+                                  elt_connect,
+                                  block_idx,
+                                  block_connect);
+
+    cs_part_to_block_destroy(&d);
+
+    BFT_FREE(part_coords);
+    BFT_FREE(elt_type);
+    BFT_FREE(elt_idx);
+    BFT_FREE(elt_connect);
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  /* Write datasets */
+
+  if (w->file_id >= 0) {
+
+    snprintf(d_path, FVM_HDF5_PATH_SIZE + 32, "%s/vertex_coords", path);
+    _write_dataset(w, d_path, CS_DOUBLE, n_vtx_block, 3, false,
+                   v_start, n_g_vertices, block_coords);
+
+    snprintf(d_path, FVM_HDF5_PATH_SIZE + 32, "%s/element_type", path);
+    _write_dataset(w, d_path, CS_CHAR, n_elt_block, 1, false,
+                   e_start, n_g_elts, block_type);
+
+    snprintf(d_path, FVM_HDF5_PATH_SIZE + 32, "%s/element_index", path);
+    _write_dataset(w, d_path, CS_LNUM_TYPE, n_elt_block + 1, 1, false,
+                   0, 0, block_idx);
+
+    snprintf(d_path, FVM_HDF5_PATH_SIZE + 32, "%s/element_connect", path);
+    _write_dataset(w, d_path, CS_GNUM_TYPE, block_idx[n_elt_block], 1, false,
+                   0, 0, block_connect);
+
+  }
+
+  BFT_FREE(block_coords);
+  BFT_FREE(block_type);
+  BFT_FREE(block_idx);
+  BFT_FREE(block_connect);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Returns number of library version strings associated with the HDF5 format.
+ *
+ * returns:
+ *   number of library version strings associated with the HDF5 format.
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_to_hdf5_n_version_strings(void)
+{
+  return 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Returns a library version string associated with the HDF5 format.
+ *
+ * The run-time version string is returned by default. Setting the
+ * compile_time flag to 1, the compile-time version string will be returned
+ * if this is different from the run-time version; otherwise, a nullptr
+ * character string will be returned with this flag set.
+ *
+ * parameters:
+ *   string_index <-- index in format's version string list (0 to n-1)
+ *   compile_time <-- 0 by default, 1 if we want the compile-time version
+ *                    string, if different from the run-time version.
+ *
+ * returns:
+ *   pointer to constant string containing the library's version.
+ *----------------------------------------------------------------------------*/
+
+const char *
+fvm_to_hdf5_version_string(int string_index,
+                           int compile_time_version)
+{
+  const char * retval = nullptr;
+
+  if (string_index != 0)
+    return retval;
+
+  unsigned majnum, minnum, relnum;
+  H5get_libversion(&majnum, &minnum, &relnum);
+
+  if (compile_time_version) {
+    if (   majnum != H5_VERS_MAJOR
+        || minnum != H5_VERS_MINOR
+        || relnum != H5_VERS_RELEASE) {
+      snprintf(_hdf5_version_string[1], 31, "HDF5 %d.%d.%d",
+               H5_VERS_MAJOR, H5_VERS_MINOR, H5_VERS_RELEASE);
+      _hdf5_version_string[1][31] = '\0';
+      retval = _hdf5_version_string[1];
+    }
+  }
+  else {
+    snprintf(_hdf5_version_string[0], 31, "HDF5 %u.%u.%u",
+             majnum, minnum, relnum);
+    _hdf5_version_string[0][31] = '\0';
+    retval = _hdf5_version_string[0];
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM to HDF5 file writer.
+ *
+ * Data is distributed in contiguous blocks of global entity numbers over
+ * a subset of "aggregator" ranks, each of which writes its block to its
+ * own subfile using chunked and compressed datasets.
+ *
+ * Options are:
+ *   subfiles=<n>        number of subfiles (aggregating ranks); default: 1
+ *   chunk_size=<n>      number of entities per dataset chunk
+ *                       (default: 65536)
+ *   deflate=<level>     zlib compression level, 0 to 9 (default: 4);
+ *                       0 disables lossless compression
+ *   tolerance=<value>   absolute error bound for lossy compression of
+ *                       field values (default: 0, lossless)
+ *   zfp                 use the ZFP filter plugin (fixed accuracy mode)
+ *                       for lossy compression if available, instead of
+ *                       the built-in scale-offset filter
+ *   discard_polygons    do not output polygons or related values
+ *   discard_polyhedra   do not output polyhedra or related values
+ *
+ * parameters:
+ *   name           <-- base output case name.
+ *   options        <-- whitespace separated, lowercase options list
+ *   time_dependecy <-- indicates if and how meshes will change with time
+ *   comm           <-- associated MPI communicator.
+ *
+ * returns:
+ *   pointer to opaque HDF5 writer structure.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+void *
+fvm_to_hdf5_init_writer(const char             *name,
+                        const char             *path,
+                        const char             *options,
+                        fvm_writer_time_dep_t   time_dependency,
+                        MPI_Comm                comm)
+#else
+void *
+fvm_to_hdf5_init_writer(const char             *name,
+                        const char             *path,
+                        const char             *options,
+                        fvm_writer_time_dep_t   time_dependency)
+#endif
+{
+  fvm_to_hdf5_writer_t  *writer = nullptr;
+
+  /* Initialize writer */
+
+  BFT_MALLOC(writer, 1, fvm_to_hdf5_writer_t);
+
+  BFT_MALLOC(writer->name, strlen(name) + 1, char);
+  strcpy(writer->name, name);
+
+  writer->filename = nullptr;
+  writer->file_id = -1;
+
+  writer->rank = 0;
+  writer->n_ranks = 1;
+  writer->n_subfiles = 1;
+  writer->subfile_id = 0;
+  writer->min_rank_step = 1;
+
+  writer->time_dependency = time_dependency;
+  writer->time_step = -1;
+  writer->time_value = 0.;
+
+  writer->deflate_level = 4;
+  writer->tolerance = 0.;
+  writer->use_zfp = false;
+  writer->chunk_size = FVM_HDF5_CHUNK_SIZE;
+
+  writer->discard_polygons = false;
+  writer->discard_polyhedra = false;
+
+#if defined(HAVE_MPI)
+  {
+    int mpi_flag, rank, n_ranks;
+    MPI_Initialized(&mpi_flag);
+
+    writer->comm = MPI_COMM_NULL;
+
+    if (mpi_flag && comm != MPI_COMM_NULL) {
+      MPI_Comm_rank(comm, &rank);
+      MPI_Comm_size(comm, &n_ranks);
+      if (n_ranks > 1) {
+        writer->comm = comm;
+        writer->rank = rank;
+        writer->n_ranks = n_ranks;
+      }
+    }
+  }
+#endif /* defined(HAVE_MPI) */
+
+  /* Parse options */
+
+  int n_subfiles = 1;
+
+  if (options != nullptr) {
+    int i1, i2, l_opt;
+    int l_tot = strlen(options);
+
+    i1 = 0; i2 = 0;
+    while (i1 < l_tot) {
+      for (i2 = i1; i2 < l_tot && options[i2] != ' '; i2++);
+
+      l_opt = i2 - i1;
+
+      if (   (l_opt > 9)
+          && (strncmp(options + i1, "subfiles=", 9) == 0))
+        n_subfiles = atoi(options + i1 + 9);
+
+      else if (   (l_opt > 11)
+               && (strncmp(options + i1, "chunk_size=", 11) == 0)) {
+        long long chunk_size = atoll(options + i1 + 11);
+        if (chunk_size > 0)
+          writer->chunk_size = chunk_size;
+      }
+
+      else if (   (l_opt > 8)
+               && (strncmp(options + i1, "deflate=", 8) == 0)) {
+        writer->deflate_level = atoi(options + i1 + 8);
+        writer->deflate_level = CS_MAX(writer->deflate_level, 0);
+        writer->deflate_level = CS_MIN(writer->deflate_level, 9);
+      }
+
+      else if (   (l_opt > 10)
+               && (strncmp(options + i1, "tolerance=", 10) == 0)) {
+        writer->tolerance = atof(options + i1 + 10);
+        if (writer->tolerance < 0)
+          writer->tolerance = 0.;
+      }
+
+      else if (   (l_opt == 3)
+               && (strncmp(options + i1, "zfp", l_opt) == 0))
+        writer->use_zfp = true;
+
+      else if (   (l_opt == 16)
+               && (strncmp(options + i1, "discard_polygons", l_opt) == 0))
+        writer->discard_polygons = true;
+
+      else if (   (l_opt == 17)
+               && (strncmp(options + i1, "discard_polyhedra", l_opt) == 0))
+        writer->discard_polyhedra = true;
+
+      for (i1 = i2 + 1; i1 < l_tot && options[i1] == ' '; i1++);
+    }
+  }
+
+  /* Aggregation: ranks whose id is a multiple of the rank step write
+     a subfile (consistent with cs_block_dist_compute_sizes) */
+
+  n_subfiles = CS_MAX(n_subfiles, 1);
+  n_subfiles = CS_MIN(n_subfiles, writer->n_ranks);
+
+  writer->min_rank_step = writer->n_ranks / n_subfiles;
+  if (writer->n_ranks % n_subfiles)
+    writer->min_rank_step += 1;
+
+  writer->n_subfiles = writer->n_ranks / writer->min_rank_step;
+  if (writer->n_ranks % writer->min_rank_step)
+    writer->n_subfiles += 1;
+
+  if (writer->rank % writer->min_rank_step == 0)
+    writer->subfile_id = writer->rank / writer->min_rank_step;
+  else
+    writer->subfile_id = -1;
+
+  /* Build file name */
+
+  {
+    char suffix[32] = ".h5";
+    if (writer->n_subfiles > 1) {
+      int n_digits = 1;
+      for (int i = writer->n_subfiles - 1; i >= 10; i /= 10)
+        n_digits++;
+      snprintf(suffix, 31, ".%0*d.h5",
+               n_digits, CS_MAX(writer->subfile_id, 0));
+    }
+
+    size_t path_len = (path != nullptr) ? strlen(path) : 0;
+    BFT_MALLOC(writer->filename,
+               path_len + strlen(name) + strlen(suffix) + 1,
+               char);
+
+    if (path != nullptr)
+      strcpy(writer->filename, path);
+    else
+      writer->filename[0] = '\0';
+
+    strcat(writer->filename, name);
+    strcat(writer->filename, suffix);
+  }
+
+  /* Create file on writing ranks */
+
+  if (writer->subfile_id > -1) {
+
+    writer->file_id = H5Fcreate(writer->filename, H5F_ACC_TRUNC,
+                                H5P_DEFAULT, H5P_DEFAULT);
+
+    if (writer->file_id < 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("HDF5: error creating file \"%s\"."), writer->filename);
+
+    hid_t root_id = H5Gopen2(writer->file_id, "/", H5P_DEFAULT);
+
+    _write_attribute(root_id, "n_subfiles", H5T_NATIVE_INT,
+                     &(writer->n_subfiles));
+    _write_attribute(root_id, "subfile_id", H5T_NATIVE_INT,
+                     &(writer->subfile_id));
+
+    {
+      char type_names[256] = "";
+      for (int i = 0; i < FVM_N_ELEMENT_TYPES; i++) {
+        if (i > 0)
+          strncat(type_names, ";", 255 - strlen(type_names));
+        strncat(type_names, fvm_elements_type_name[i],
+                255 - strlen(type_names));
+      }
+      _write_string_attribute(root_id, "element_type_names", type_names);
+    }
+
+    H5Gclose(root_id);
+  }
+
+  return writer;
+}
+
+/*----------------------------------------------------------------------------
+ * Finalize FVM to HDF5 file writer.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to opaque HDF5 writer structure.
+ *
+ * returns:
+ *   nullptr pointer.
+ *----------------------------------------------------------------------------*/
+
+void *
+fvm_to_hdf5_finalize_writer(void  *this_writer_p)
+{
+  fvm_to_hdf5_writer_t  *writer = (fvm_to_hdf5_writer_t *)this_writer_p;
+
+  assert(writer != nullptr);
+
+  if (writer->file_id >= 0) {
+    H5Fclose(writer->file_id);
+    writer->file_id = -1;
+  }
+
+  BFT_FREE(writer->name);
+  BFT_FREE(writer->filename);
+
+  BFT_FREE(writer);
+
+  return nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Associate new time step with an HDF5 geometry.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   time_step     <-- time step number
+ *   time_value    <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_hdf5_set_mesh_time(void     *this_writer_p,
+                          int       time_step,
+                          double    time_value)
+{
+  fvm_to_hdf5_writer_t  *writer = (fvm_to_hdf5_writer_t *)this_writer_p;
+
+  writer->time_step = time_step;
+  writer->time_value = time_value;
+}
+
+/*----------------------------------------------------------------------------
+ * Write nodal mesh to HDF5 files
+ *
+ * Only elements of the highest dimension present in the mesh are exported,
+ * all element types being concatenated in a single element list.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer.
+ *   mesh          <-- pointer to nodal mesh structure that should be written.
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_hdf5_export_nodal(void               *this_writer_p,
+                         const fvm_nodal_t  *mesh)
+{
+  char  path[FVM_HDF5_PATH_SIZE];
+
+  fvm_to_hdf5_writer_t  *w = (fvm_to_hdf5_writer_t *)this_writer_p;
+
+  const int elt_dim = fvm_nodal_get_max_entity_dim(mesh);
+
+  int time_step = w->time_step;
+  if (w->time_dependency == FVM_WRITER_FIXED_MESH)
+    time_step = -1;
+
+  _group_path(mesh->name, "geometry", time_step, path);
+
+  fvm_writer_section_t  *export_list
+    = fvm_writer_export_list(mesh,
+                             elt_dim,
+                             elt_dim,
+                             -1,
+                             false,
+                             true,
+                             w->discard_polygons,
+                             w->discard_polyhedra,
+                             false,
+                             false);
+
+  _export_geometry(w, mesh, export_list, path);
+
+  if (w->file_id >= 0 && time_step > -1)
+    _write_time_attributes(w, path, w->time_step, w->time_value);
+
+  BFT_FREE(export_list);
+}
+
+/*----------------------------------------------------------------------------
+ * Write field associated with a nodal mesh to HDF5 files.
+ *
+ * Assigning a negative value to the time step indicates a time-independent
+ * field (in which case the time_value argument is unused).
+ *
+ * parameters:
+ *   this_writer_p    <-- pointer to associated writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension (0: constant, 1: scalar,
+ *                        3: vector, 6: sym. tensor, 9: asym. tensor)
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_hdf5_export_field(void                   *this_writer_p,
+                         const fvm_nodal_t      *mesh,
+                         const char             *name,
+                         fvm_writer_var_loc_t    location,
+                         int                     dimension,
+                         cs_interlace_t          interlace,
+                         int                     n_parent_lists,
+                         const cs_lnum_t         parent_num_shift[],
+                         cs_datatype_t           datatype,
+                         int                     time_step,
+                         double                  time_value,
+                         const void       *const field_values[])
+{
+  char  category[FVM_HDF5_PATH_SIZE/4 + 8];
+  char  path[FVM_HDF5_PATH_SIZE];
+  char  d_path[FVM_HDF5_PATH_SIZE + 16];
+
+  fvm_to_hdf5_writer_t  *w = (fvm_to_hdf5_writer_t *)this_writer_p;
+
+  const int elt_dim = fvm_nodal_get_max_entity_dim(mesh);
+
+  /* Floating-point values keep their precision, others are
+     converted to double precision */
+
+  cs_datatype_t  export_datatype
+    = (datatype == CS_FLOAT) ? CS_FLOAT : CS_DOUBLE;
+
+  {
+    char h5_field_name[FVM_HDF5_PATH_SIZE/4 + 1];
+    _link_name(name, h5_field_name);
+    snprintf(category, FVM_HDF5_PATH_SIZE/4 + 8, "fields/%s", h5_field_name);
+  }
+
+  _group_path(mesh->name, category, time_step, path);
+  snprintf(d_path, FVM_HDF5_PATH_SIZE + 16, "%s/values", path);
+
+  /* Initialize writer helper */
+
+  fvm_writer_section_t  *export_list
+    = fvm_writer_export_list(mesh,
+                             elt_dim,
+                             elt_dim,
+                             -1,
+                             false,
+                             true,
+                             w->discard_polygons,
+                             w->discard_polyhedra,
+                             false,
+                             false);
+
+  if (export_list == nullptr && location == FVM_WRITER_PER_ELEMENT)
+    return;
+
+  fvm_writer_field_helper_t  *helper
+    = fvm_writer_field_helper_create(mesh,
+                                     export_list,
+                                     dimension,
+                                     CS_INTERLACE,
+                                     export_datatype,
+                                     location);
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1)
+    fvm_writer_field_helper_init_g(helper,
+                                   w->min_rank_step,
+                                   0,
+                                   w->comm);
+
+#endif
+
+  _hdf5_context_t c;
+  c.writer = w;
+  c.path = d_path;
+
+  if (location == FVM_WRITER_PER_ELEMENT) {
+
+    c.n_g_ent = 0;
+    for (const fvm_writer_section_t *s = export_list;
+         s != nullptr;
+         s = s->next)
+      c.n_g_ent += fvm_io_num_get_global_count(s->section->global_element_num);
+
+    const fvm_writer_section_t  *next_section
+      = fvm_writer_field_helper_output_e(helper,
+                                         &c,
+                                         export_list,
+                                         dimension,
+                                         interlace,
+                                         nullptr, /* comp_order */
+                                         n_parent_lists,
+                                         parent_num_shift,
+                                         datatype,
+                                         field_values,
+                                         _field_output);
+
+    assert(next_section == nullptr);
+    CS_NO_WARN_IF_UNUSED(next_section);
+
+  }
+  else if (location == FVM_WRITER_PER_NODE) {
+
+    c.n_g_ent = fvm_nodal_get_n_g_vertices(mesh);
+
+    fvm_writer_field_helper_output_n(helper,
+                                     &c,
+                                     mesh,
+                                     dimension,
+                                     interlace,
+                                     nullptr, /* comp_order */
+                                     n_parent_lists,
+                                     parent_num_shift,
+                                     datatype,
+                                     field_values,
+                                     _field_output);
+
+  }
+
+  fvm_writer_field_helper_destroy(&helper);
+
+  BFT_FREE(export_list);
+
+  if (w->file_id >= 0 && time_step > -1)
+    _write_time_attributes(w, path, time_step, time_value);
+}
+
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * parameters:
+ *   this_writer_p    <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_hdf5_flush(void  *this_writer_p)
+{
+  fvm_to_hdf5_writer_t  *w = (fvm_to_hdf5_writer_t *)this_writer_p;
+
+  if (w->file_id >= 0)
+    H5Fflush(w->file_id, H5F_SCOPE_GLOBAL);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* HAVE_HDF5 */
@@ -0,0 +1,234 @@
+#ifndef __FVM_TO_HDF5_H__
+#define __FVM_TO_HDF5_H__
+
+#if defined(HAVE_HDF5)
+
+/*============================================================================
+ * Write a nodal representation associated with a mesh and associated
+ * variables to compressed HDF5 files
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "fvm_defs.h"
+#include "fvm_nodal.h"
+#include "fvm_writer.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*=============================================================================
+ * Macro definitions
+ *============================================================================*/
+
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/*=============================================================================
+ * Public function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Returns number of library version strings associated with the HDF5 format.
+ *
+ * returns:
+ *   number of library version strings associated with the HDF5 format.
+ *----------------------------------------------------------------------------*/
+
+int
+fvm_to_hdf5_n_version_strings(void);
+
+/*----------------------------------------------------------------------------
+ * Returns a library version string associated with the HDF5 format.
+ *
+ * The run-time version string is returned by default. Setting the
+ * compile_time flag to 1, the compile-time version string will be returned
+ * if this is different from the run-time version; otherwise, a NULL
+ * character string will be returned with this flag set.
+ *
+ * parameters:
+ *   string_index <-- index in format's version string list (0 to n-1)
+ *   compile_time <-- 0 by default, 1 if we want the compile-time version
+ *                    string, if different from the run-time version.
+ *
+ * returns:
+ *   pointer to constant string containing the library's version.
+ *----------------------------------------------------------------------------*/
+
+const char *
+fvm_to_hdf5_version_string(int string_index,
+                           int compile_time_version);
+
+/*----------------------------------------------------------------------------
+ * Initialize FVM to HDF5 file writer.
+ *
+ * Data is distributed in contiguous blocks of global entity numbers over
+ * a subset of "aggregator" ranks, each of which writes its block to its
+ * own subfile using chunked and compressed datasets.
+ *
+ * Options are:
+ *   subfiles=<n>        number of subfiles (aggregating ranks); default: 1
+ *   chunk_size=<n>      number of entities per dataset chunk
+ *                       (default: 65536)
+ *   deflate=<level>     zlib compression level, 0 to 9 (default: 4);
+ *                       0 disables lossless compression
+ *   tolerance=<value>   absolute error bound for lossy compression of
+ *                       field values (default: 0, lossless)
+ *   zfp                 use the ZFP filter plugin (fixed accuracy mode)
+ *                       for lossy compression if available, instead of
+ *                       the built-in scale-offset filter
+ *   discard_polygons    do not output polygons or related values
+ *   discard_polyhedra   do not output polyhedra or related values
+ *
+ * parameters:
+ *   name           <-- base output case name.
+ *   options        <-- whitespace separated, lowercase options list
+ *   time_dependecy <-- indicates if and how meshes will change with time
+ *   comm           <-- associated MPI communicator.
+ *
+ * returns:
+ *   pointer to opaque HDF5 writer structure.
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+void *
+fvm_to_hdf5_init_writer(const char             *name,
+                        const char             *path,
+                        const char             *options,
+                        fvm_writer_time_dep_t   time_dependency,
+                        MPI_Comm                comm);
+
+#else
+
+void *
+fvm_to_hdf5_init_writer(const char             *name,
+                        const char             *path,
+                        const char             *options,
+                        fvm_writer_time_dep_t   time_dependency);
+
+#endif
+
+/*----------------------------------------------------------------------------
+ * Finalize FVM to HDF5 file writer.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to opaque HDF5 writer structure.
+ *
+ * returns:
+ *   NULL pointer.
+ *----------------------------------------------------------------------------*/
+
+void *
+fvm_to_hdf5_finalize_writer(void  *this_writer_p);
+
+/*----------------------------------------------------------------------------
+ * Associate new time step with an HDF5 geometry.
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer
+ *   time_step     <-- time step number
+ *   time_value    <-- time_value number
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_hdf5_set_mesh_time(void     *this_writer_p,
+                          int       time_step,
+                          double    time_value);
+
+/*----------------------------------------------------------------------------
+ * Write nodal mesh to HDF5 files
+ *
+ * parameters:
+ *   this_writer_p <-- pointer to associated writer.
+ *   mesh          <-- pointer to nodal mesh structure that should be written.
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_hdf5_export_nodal(void               *this_writer_p,
+                         const fvm_nodal_t  *mesh);
+
+/*----------------------------------------------------------------------------
+ * Write field associated with a nodal mesh to HDF5 files.
+ *
+ * Assigning a negative value to the time step indicates a time-independent
+ * field (in which case the time_value argument is unused).
+ *
+ * parameters:
+ *   this_writer_p    <-- pointer to associated writer
+ *   mesh             <-- pointer to associated nodal mesh structure
+ *   name             <-- variable name
+ *   location         <-- variable definition location (nodes or elements)
+ *   dimension        <-- variable dimension (0: constant, 1: scalar,
+ *                        3: vector, 6: sym. tensor, 9: asym. tensor)
+ *   interlace        <-- indicates if variable in memory is interlaced
+ *   n_parent_lists   <-- indicates if variable values are to be obtained
+ *                        directly through the local entity index (when 0) or
+ *                        through the parent entity numbers (when 1 or more)
+ *   parent_num_shift <-- parent number to value array index shifts;
+ *                        size: n_parent_lists
+ *   datatype         <-- indicates the data type of (source) field values
+ *   time_step        <-- number of the current time step
+ *   time_value       <-- associated time value
+ *   field_values     <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_hdf5_export_field(void                   *this_writer_p,
+                         const fvm_nodal_t      *mesh,
+                         const char             *name,
+                         fvm_writer_var_loc_t    location,
+                         int                     dimension,
+                         cs_interlace_t          interlace,
+                         int                     n_parent_lists,
+                         const cs_lnum_t         parent_num_shift[],
+                         cs_datatype_t           datatype,
+                         int                     time_step,
+                         double                  time_value,
+                         const void       *const field_values[]);
+
+/*----------------------------------------------------------------------------
+ * Flush files associated with a given writer.
+ *
+ * parameters:
+ *   this_writer_p    <-- pointer to associated writer
+ *----------------------------------------------------------------------------*/
+
+void
+fvm_to_hdf5_flush(void  *this_writer_p);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* HAVE_HDF5 */
+
+#endif /* __FVM_TO_HDF5_H__ */
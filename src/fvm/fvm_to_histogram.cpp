@@ -310,7 +310,7 @@ _compute_local_minmax(cs_lnum_t        n_vals,
  *   var_min      <--  minimum variable value
  *   var_max      <--  maximum variable value
  *   count        <->  count for each histogram slice (size: w->n_sub)
- *                     local values in, global values out
+ *                     local values in, global values out on rank 0
  *   display_func <--  function pointer to display the histogram
  *   w            <--> histogram writer
  *   var_name     <--  name of the variable
@@ -328,14 +328,17 @@ _display_histograms(cs_real_t                   var_min,
 
 #if defined(HAVE_MPI)
 
+  /* Only rank 0 displays the histogram, so a single reduction
+     of local bin counts to that rank is sufficient */
+
   if (w->n_ranks > 1) {
 
     cs_gnum_t *g_count = nullptr;
 
     BFT_MALLOC(g_count, w->n_sub, cs_gnum_t);
 
-    MPI_Allreduce(count, g_count, w->n_sub, CS_MPI_GNUM, MPI_SUM,
-                  w->comm);
+    MPI_Reduce(count, g_count, w->n_sub, CS_MPI_GNUM, MPI_SUM, 0,
+               w->comm);
 
     for (i = 0; i < w->n_sub; i++)
       count[i] = g_count[i];
@@ -392,11 +395,13 @@ _histogram(cs_lnum_t                    n_vals,
 #if defined(HAVE_MPI)
 
   if (w->n_ranks > 1) {
-    MPI_Allreduce(&_min, &min, 1, CS_MPI_REAL, MPI_MIN,
-                  w->comm);
+    cs_real_t l_minmax[2] = {-_min, _max}, g_minmax[2];
 
-    MPI_Allreduce(&_max, &max, 1, CS_MPI_REAL, MPI_MAX,
+    MPI_Allreduce(l_minmax, g_minmax, 2, CS_MPI_REAL, MPI_MAX,
                   w->comm);
+
+    min = -g_minmax[0];
+    max = g_minmax[1];
   }
 
 #endif
@@ -414,12 +419,20 @@ _histogram(cs_lnum_t                    n_vals,
 
     for (i = 0; i < n_vals; i++) {
 
-      /* Associated subdivision */
+      /* Associated subdivision (first estimated, then adjusted so
+         that bounds are handled exactly as by a linear search) */
+
+      j = (int)((var[i] - min) / step);
+      if (j < 0)
+        j = 0;
+      else if (j >= w->n_sub)
+        j = w->n_sub - 1;
+
+      for (k = j; k > 0 && var[i] < min + k*step; k--);
+      j = k;
+      for (k = j + 1; k < w->n_sub && var[i] >= min + k*step; k++);
+      j = k - 1;
 
-      for (j = 0, k = 1; k < w->n_sub; j++, k++) {
-        if (var[i] < min + k*step)
-          break;
-      }
       count[j] += 1;
 
     }
@@ -431,6 +444,58 @@ _histogram(cs_lnum_t                    n_vals,
   BFT_FREE(count);
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Check if local elements of a given dimension may be binned directly.
+ *
+ * This is the case when the sum of local element counts matches the
+ * global element count, that is when no element is shared by several
+ * ranks, so the distribution to blocks is not needed.
+ *
+ * parameters:
+ *   mesh       <-- pointer to nodal mesh structure
+ *   entity_dim <-- dimension of exported elements
+ *   w          <-- histogram writer
+ *
+ * returns:
+ *   true if local elements are distinct across ranks, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_local_elements_are_distinct(const fvm_nodal_t                *mesh,
+                             int                               entity_dim,
+                             const fvm_to_histogram_writer_t  *w)
+{
+  cs_gnum_t n_l_elts = 0, n_g_elts = 0;
+  cs_gnum_t l_count[FVM_N_ELEMENT_TYPES], g_count[FVM_N_ELEMENT_TYPES];
+
+  for (int i = 0; i < FVM_N_ELEMENT_TYPES; i++)
+    l_count[i] = 0;
+
+  for (int i = 0; i < mesh->n_sections; i++) {
+    const fvm_nodal_section_t  *section = mesh->sections[i];
+    if (section->entity_dim == entity_dim) {
+      n_l_elts += section->n_elements;
+      l_count[section->type] += fvm_nodal_section_n_g_elements(section);
+    }
+  }
+
+  /* Ranks with no section of a given type do not know its global count */
+
+  MPI_Allreduce(l_count, g_count, FVM_N_ELEMENT_TYPES, CS_MPI_GNUM, MPI_MAX,
+                w->comm);
+
+  for (int i = 0; i < FVM_N_ELEMENT_TYPES; i++)
+    n_g_elts += g_count[i];
+
+  cs_parall_counter(&n_l_elts, 1);
+
+  return (n_l_elts == n_g_elts);
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------
  * Output function for field values.
  *
@@ -785,29 +850,78 @@ fvm_to_histogram_export_field(void                  *writer,
                                      dest_datatype,
                                      location);
 
+  _histogram_context_t c = {.writer = w, .name = name};
+
+  /* Vertices shared by several ranks must be counted only once,
+     so per-node values are distributed to blocks on all ranks */
+
+  if (location == FVM_WRITER_PER_NODE) {
+
+#if defined(HAVE_MPI)
+    if (w->n_ranks > 1)
+      fvm_writer_field_helper_init_g(helper,
+                                     1,
+                                     0,
+                                     w->comm);
+#endif
+
+    fvm_writer_field_helper_output_n(helper,
+                                     &c,
+                                     mesh,
+                                     dimension,
+                                     interlace,
+                                     nullptr,
+                                     n_parent_lists,
+                                     parent_num_shift,
+                                     datatype,
+                                     field_values,
+                                     _field_output);
+
+  }
+
+  else {
+
+    bool local_binning = true;
+
 #if defined(HAVE_MPI)
 
-  if (w->n_ranks > 1)
-    fvm_writer_field_helper_init_g(helper,
-                                   w->n_ranks,
-                                   0,
-                                   w->comm);
+    /* Histograms only require bin counts, so elements are binned on the
+       ranks holding them, followed by a single reduction of counts;
+       values are distributed to blocks on all ranks only when some
+       elements are shared, so as to count them only once */
+
+    if (w->n_ranks > 1) {
+      local_binning = _local_elements_are_distinct(mesh, export_dim, w);
+      if (!local_binning)
+        fvm_writer_field_helper_init_g(helper,
+                                       1,
+                                       0,
+                                       w->comm);
+    }
 
 #endif
 
-  _histogram_context_t c = {.writer = w, .name = name};
+    if (export_list != nullptr || !local_binning)
+      fvm_writer_field_helper_output_e(helper,
+                                       &c,
+                                       export_list,
+                                       dimension,
+                                       interlace,
+                                       nullptr,
+                                       n_parent_lists,
+                                       parent_num_shift,
+                                       datatype,
+                                       field_values,
+                                       _field_output);
+
+    /* Ranks with no local elements still take part in reductions */
+
+    else {
+      for (int comp_id = 0; comp_id < dimension; comp_id++)
+        _field_output(&c, dest_datatype, dimension, comp_id, 1, 1, nullptr);
+    }
 
-  fvm_writer_field_helper_output_e(helper,
-                                   &c,
-                                   export_list,
-                                   dimension,
-                                   interlace,
-                                   nullptr,
-                                   n_parent_lists,
-                                   parent_num_shift,
-                                   datatype,
-                                   field_values,
-                                   _field_output);
+  }
 
   BFT_FREE(export_list);
 
@@ -589,11 +589,52 @@ fvm_to_melissa_export_field(void                  *this_writer_p,
 
   w->f_ts[f_id] = time_step;
 
+  int export_dim = fvm_nodal_get_max_entity_dim(mesh);
+
+  /* Send values in place when no redistribution or conversion is needed */
+  /*----------------------------------------------------------------------*/
+
+  if (n_ranks == 1) {
+
+    const void *c_values[9];
+    int n_shared = 0;
+
+    if (dimension <= 9) {
+      for (int i = 0; i < dimension; i++) {
+        c_values[i] = fvm_writer_field_shared_values(mesh,
+                                                     location,
+                                                     dimension,
+                                                     i,
+                                                     interlace,
+                                                     CS_NO_INTERLACE,
+                                                     n_parent_lists,
+                                                     parent_num_shift,
+                                                     datatype,
+                                                     CS_DOUBLE,
+                                                     field_values);
+        if (c_values[i] == nullptr)
+          break;
+        n_shared++;
+      }
+    }
+
+    if (n_shared == dimension) {
+      cs_gnum_t n_values = 0;
+      if (location == FVM_WRITER_PER_NODE)
+        n_values = mesh->n_vertices;
+      else
+        n_values = fvm_nodal_get_n_entities(mesh, export_dim);
+      for (int i = 0; i < dimension; i++)
+        _field_c_output(&c, CS_DOUBLE, dimension, i, 1, n_values + 1,
+                        const_cast<void *>(c_values[i]));
+      return;
+    }
+
+  }
+
   /* Initialize writer helper */
   /*--------------------------*/
 
-  int export_dim = fvm_nodal_get_max_entity_dim(mesh);
-
   /* Build list of sections that are used here, in order of output */
   export_list = fvm_writer_export_list(mesh,
                                        export_dim,
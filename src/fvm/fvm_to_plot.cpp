@@ -32,7 +32,6 @@
  *----------------------------------------------------------------------------*/
 
 #include <assert.h>
-#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -102,14 +101,19 @@ typedef struct {
 
   int               n_cols;        /* Number of columns */
   int               n_cols_max;    /* Max. number of columns */
-  int               n_rows;        /* Number of rows */
+  int               n_rows;        /* Number of local rows */
 
-  cs_real_t        *buffer;        /* Values buffer */
+  cs_real_t        *buffer;        /* Local block values buffer */
 
   char             *file_name;     /* File name */
-  FILE             *f;             /* Associated plots */
+  char             *header;        /* Header (column titles), or nullptr
+                                      if no output is pending */
+  size_t            header_size;   /* Header length */
 
 #if defined(HAVE_MPI)
+  int          min_rank_step;      /* Minimum rank step */
+  int          min_block_size;     /* Minimum block buffer size */
+  MPI_Comm     block_comm;         /* Associated MPI block communicator */
   MPI_Comm     comm;               /* Associated MPI communicator */
 #endif
 
@@ -135,6 +139,25 @@ typedef struct {
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Append a string to the header of the pending output.
+ *
+ * parameters:
+ *   w <-> pointer to associated writer
+ *   s <-- string to append
+ *----------------------------------------------------------------------------*/
+
+static void
+_header_append(fvm_to_plot_writer_t  *w,
+               const char            *s)
+{
+  size_t l = strlen(s);
+
+  BFT_REALLOC(w->header, w->header_size + l + 1, char);
+  memcpy(w->header + w->header_size, s, l + 1);
+  w->header_size += l;
+}
+
 /*----------------------------------------------------------------------------
  * Output function for field values.
  *
@@ -166,14 +189,25 @@ _field_output(void           *context,
 
   fvm_to_plot_writer_t  *w = c->writer;
 
-  if (w->rank > 0)
-    return;
+  /* Each rank keeps its own block of rows, which are all written
+     together when the writer is flushed */
 
   const int n_rows = (block_end > block_start) ? block_end - block_start : 0;
 
+  /* Local blocks differ if global sizes differ, so check on all ranks */
+
+  int mismatch = (w->n_cols > 0 && w->n_rows != n_rows) ? 1 : 0;
+
+#if defined(HAVE_MPI)
+  if (w->n_ranks > 1) {
+    int l_mismatch = mismatch;
+    MPI_Allreduce(&l_mismatch, &mismatch, 1, MPI_INT, MPI_MAX, w->comm);
+  }
+#endif
+
   if (w->n_cols == 0)
     w->n_rows = n_rows;
-  else if (w->n_rows != n_rows) {
+  else if (mismatch) {
     const char e[] = "";
     const char *name = (c->name != nullptr) ? c->name : e;
     bft_printf(_("Warning: inconsistent data size for plot \"%s\" between\n"
@@ -182,9 +216,9 @@ _field_output(void           *context,
     return;
   }
 
-  /* Create file and write headers on first output */
+  /* Define file name and headers on first output */
 
-  if (w->f == nullptr) {
+  if (w->header == nullptr) {
 
     char t_stamp[32];
     if (w->no_time_step || w->nt < 0)
@@ -200,23 +234,21 @@ _field_output(void           *context,
     else
       sprintf(w->file_name, "%s%s%s.csv", w->path, w->name, t_stamp);
 
-    w->f = fopen(w->file_name, "w");
-
-    if (w->f ==  nullptr) {
-      bft_error(__FILE__, __LINE__, errno,
-                _("Error opening file: \"%s\""), w->file_name);
-      return;
-    }
+    w->header_size = 0;
+    _header_append(w, "");  /* Header is non-null once output starts */
 
     if (w->format == CS_PLOT_DAT) {
-      fprintf(w->f, "# code_saturne plot output\n#\n");
+      char line[64];
+      _header_append(w, "# code_saturne plot output\n#\n");
       if (w->nt < 0)
-        fprintf(w->f, "# time independent\n");
+        _header_append(w, "# time independent\n");
       else {
-        fprintf(w->f, "# time step id: %i\n", w->nt);
-        fprintf(w->f, "# time:         %12.5e\n#\n", w->t);
+        snprintf(line, 64, "# time step id: %i\n", w->nt);
+        _header_append(w, line);
+        snprintf(line, 64, "# time:         %12.5e\n#\n", w->t);
+        _header_append(w, line);
       }
-      fprintf(w->f, "#COLUMN_TITLES: ");
+      _header_append(w, "#COLUMN_TITLES: ");
     }
 
   }
@@ -254,18 +286,11 @@ _field_output(void           *context,
       fvm_writer_field_component_name(name_buf+l, 3, true, dimension, i);
     }
 
-    if (w->format == CS_PLOT_DAT) {
-      if (w->n_cols > 0)
-        fprintf(w->f, " | %s", name_buf);
-      else
-        fprintf(w->f, " %s", name_buf);
-    }
-    else if (w->format == CS_PLOT_CSV) {
-      if (w->n_cols > 0)
-        fprintf(w->f, ", %s", name_buf);
-      else
-        fprintf(w->f, "%s", name_buf);
-    }
+    if (w->format == CS_PLOT_DAT)
+      _header_append(w, (w->n_cols > 0) ? " | " : " ");
+    else if (w->format == CS_PLOT_CSV && w->n_cols > 0)
+      _header_append(w, ", ");
+    _header_append(w, name_buf);
 
     /* Update buffer */
 
@@ -281,24 +306,91 @@ _field_output(void           *context,
 }
 
 /*----------------------------------------------------------------------------
- * Close the file associated with a given writer.
+ * Write pending output to file.
  *
- * This assumes w->f != nullptr on entry.
+ * Each rank formats its own block of rows, and the resulting text
+ * blocks are written in rank order using parallel file I/O when
+ * available, so that no rank needs to hold the whole plot.
  *
  * parameters:
- *   w <-- pointer to associated writer
+ *   w <-> pointer to associated writer
  *----------------------------------------------------------------------------*/
 
 static void
-_file_close(fvm_to_plot_writer_t  *w)
+_write_file(fvm_to_plot_writer_t  *w)
 {
-  assert(w->f != nullptr);
+  const int n_cols = w->n_cols;
+  const int n_rows = w->n_rows;
 
-  if (fclose(w->f) != 0)
-    bft_error(__FILE__, __LINE__, errno,
-              _("Error closing file: \"%s\""), w->file_name);
+  const char *sep = (w->format == CS_PLOT_DAT) ? " " : ", ";
 
-  w->f = nullptr;
+  /* Format local rows (the header is written by the first rank) */
+
+  size_t n_max = 24*((size_t)n_rows*n_cols + 1) + 2;
+  if (w->rank == 0)
+    n_max += w->header_size;
+
+  char *text;
+  BFT_MALLOC(text, n_max, char);
+
+  size_t n = 0;
+
+  if (w->rank == 0) {
+    memcpy(text, w->header, w->header_size);
+    n = w->header_size;
+    text[n++] = '\n';
+  }
+
+  if (w->buffer != nullptr) {
+    for (int i = 0; i < n_rows; i++) {
+      for (int j = 0; j < n_cols - 1; j++)
+        n += snprintf(text + n, n_max - n, "%12.5e%s",
+                      w->buffer[n_rows*j + i], sep);
+      if (n_cols > 0) {
+        int j = n_cols -1;
+        n += snprintf(text + n, n_max - n, "%12.5e\n",
+                      w->buffer[n_rows*j + i]);
+      }
+    }
+  }
+
+  /* Write blocks in rank order */
+
+  cs_gnum_t range[2] = {1, (cs_gnum_t)n + 1};
+
+  cs_file_t *f = nullptr;
+  cs_file_access_t method;
+
+#if defined(HAVE_MPI)
+
+  if (w->n_ranks > 1) {
+    cs_gnum_t l_size = n, shift = 0;
+    MPI_Scan(&l_size, &shift, 1, CS_MPI_GNUM, MPI_SUM, w->comm);
+    range[0] = shift - l_size + 1;
+    range[1] = shift + 1;
+  }
+
+  MPI_Info hints;
+  cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+  f = cs_file_open(w->file_name,
+                   CS_FILE_MODE_WRITE,
+                   method,
+                   hints,
+                   w->block_comm,
+                   w->comm);
+
+#else
+
+  cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
+  f = cs_file_open(w->file_name, CS_FILE_MODE_WRITE, method);
+
+#endif
+
+  cs_file_write_block_buffer(f, text, 1, 1, range[0], range[1]);
+
+  f = cs_file_free(f);
+
+  BFT_FREE(text);
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -360,6 +452,10 @@ fvm_to_plot_init_writer(const char             *name,
 #if defined(HAVE_MPI)
   {
     int mpi_flag, rank, n_ranks;
+    MPI_Comm w_block_comm, w_comm;
+    w->min_rank_step = 1;
+    w->min_block_size = 0;
+    w->block_comm = MPI_COMM_NULL;
     w->comm = MPI_COMM_NULL;
     MPI_Initialized(&mpi_flag);
     if (mpi_flag && comm != MPI_COMM_NULL) {
@@ -368,6 +464,11 @@ fvm_to_plot_init_writer(const char             *name,
       MPI_Comm_size(w->comm, &n_ranks);
       w->rank = rank;
       w->n_ranks = n_ranks;
+      cs_file_get_default_comm(nullptr, &w_block_comm, &w_comm);
+      if (comm == w_comm) {
+        w->min_block_size = cs_parall_get_min_coll_buf_size();
+        w->block_comm = w_block_comm;
+      }
     }
   }
 #endif /* defined(HAVE_MPI) */
@@ -387,7 +488,8 @@ fvm_to_plot_init_writer(const char             *name,
   w->buffer = nullptr;
 
   w->file_name = nullptr;
-  w->f = nullptr;
+  w->header = nullptr;
+  w->header_size = 0;
 
   /* Parse options */
 
@@ -441,9 +543,6 @@ fvm_to_plot_finalize_writer(void  *writer)
 
   fvm_to_plot_flush(writer);
 
-  if (w->f != nullptr)
-    _file_close(w);
-
   BFT_FREE(w->file_name);
 
   BFT_FREE(w);
@@ -467,12 +566,8 @@ fvm_to_plot_set_mesh_time(void    *writer,
 {
   fvm_to_plot_writer_t  *w = (fvm_to_plot_writer_t *)writer;
 
-  if (w->nt != time_step) {
-    if (w->n_cols > 0)
-      fvm_to_plot_flush(writer);
-    if (w->f != nullptr)
-      _file_close(w);
-  }
+  if (w->nt != time_step)
+    fvm_to_plot_flush(writer);
   w->nt = time_step;
   w->t = time_value;
 
@@ -608,8 +703,8 @@ fvm_to_plot_export_field(void                  *writer,
 
   if (w->n_ranks > 1)
     fvm_writer_field_helper_init_g(helper,
-                                   w->n_ranks,
-                                   0,
+                                   w->min_rank_step,
+                                   w->min_block_size,
                                    w->comm);
 
 #endif
@@ -653,47 +748,18 @@ fvm_to_plot_flush(void  *writer)
 {
   fvm_to_plot_writer_t  *w = (fvm_to_plot_writer_t *)writer;
 
-  if (w->f != nullptr && w->buffer != nullptr) {
+  if (w->header != nullptr) {
 
     /* Transpose output on write */
 
-    int n_cols = w->n_cols;
-    int n_rows = w->n_rows;
-
-    if (w->format == CS_PLOT_DAT) {
-
-      fprintf(w->f, "\n");
-
-      for (int i = 0; i < n_rows; i++) {
-        for (int j = 0; j < n_cols - 1; j++)
-          fprintf(w->f, "%12.5e ", w->buffer[w->n_rows*j + i]);
-        if (n_cols > 0) {
-          int j = n_cols -1;
-          fprintf(w->f, "%12.5e\n", w->buffer[w->n_rows*j + i]);
-        }
-      }
-
-    }
-    else if (w->format == CS_PLOT_CSV) {
-
-      fprintf(w->f, "\n");
-
-      for (int i = 0; i < n_rows; i++) {
-        for (int j = 0; j < n_cols-1; j++)
-          fprintf(w->f, "%12.5e, ", w->buffer[w->n_rows*j + i]);
-        if (n_cols > 0) {
-          int j = n_cols -1;
-          fprintf(w->f, "%12.5e\n", w->buffer[w->n_rows*j + i]);
-        }
-      }
-
-    }
+    _write_file(w);
 
     w->n_rows = 0;
     w->n_cols = 0;
     w->n_cols_max = 0;
 
-    _file_close(w);
+    BFT_FREE(w->header);
+    w->header_size = 0;
 
   }
 
@@ -107,6 +107,17 @@ typedef struct {
 
 #if defined(HAVE_MPI)
   MPI_Comm     comm;               /* Associated MPI communicator */
+
+  /* Cached gather layout for per-node values (built once per mesh) */
+
+  const fvm_nodal_t  *g_mesh;      /* Mesh for which layout is defined */
+  cs_lnum_t           g_n_vertices;   /* Local number of vertices */
+  cs_gnum_t           g_n_g_vertices; /* Global number of vertices */
+  int                *g_count;     /* Number of vertices per rank
+                                      (rank 0 only) */
+  int                *g_displ;     /* Displacement per rank (rank 0 only) */
+  cs_gnum_t          *g_num;       /* Global numbers of gathered vertices,
+                                      in rank order (rank 0 only) */
 #endif
 
 } fvm_to_time_plot_writer_t;
@@ -184,7 +195,7 @@ _coords_output(void           *context,
 
   if (w->format == CS_TIME_PLOT_DAT)
     sprintf(file_name, "%scoords%s.dat", w->prefix, t_stamp);
-  else if (w->format == CS_TIME_PLOT_CSV)
+  else
     sprintf(file_name, "%scoords%s.csv", w->prefix, t_stamp);
 
   _f = fopen(file_name, "w");
@@ -237,9 +248,9 @@ _coords_output(void           *context,
 
   }
 
-  /* CSV format */
+  /* CSV format (also used for coordinates of binary plots) */
 
-  else if (w->format == CS_TIME_PLOT_CSV) {
+  else {
 
     switch(dimension) {
     case 3:
@@ -388,6 +399,162 @@ _field_output(void           *context,
   BFT_FREE(_vals);
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Free cached gather layout.
+ *
+ * parameters:
+ *   w <-> pointer to time plot writer structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_gather_layout(fvm_to_time_plot_writer_t  *w)
+{
+  w->g_mesh = nullptr;
+  w->g_n_vertices = 0;
+  w->g_n_g_vertices = 0;
+
+  BFT_FREE(w->g_count);
+  BFT_FREE(w->g_displ);
+  BFT_FREE(w->g_num);
+}
+
+/*----------------------------------------------------------------------------
+ * Build or check cached gather layout for a given mesh.
+ *
+ * The layout allows direct gathering of per-node values to rank 0
+ * using a single MPI_Gatherv, without rebuilding a part-to-block
+ * distribution for each exported field.
+ *
+ * parameters:
+ *   w    <-> pointer to time plot writer structure
+ *   mesh <-- pointer to nodal mesh structure
+ *
+ * returns:
+ *   true if layout is usable, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_update_gather_layout(fvm_to_time_plot_writer_t  *w,
+                      const fvm_nodal_t          *mesh)
+{
+  /* Status: 0 if unusable, 1 if rebuild needed, 2 if up to date;
+     the minimum over all ranks is used so that all ranks agree */
+
+  int l_status = 1, g_status = 0;
+
+  if (mesh->global_vertex_num == nullptr)
+    l_status = 0;
+  else if (   w->g_mesh == mesh
+           && w->g_n_vertices == mesh->n_vertices
+           && w->g_n_g_vertices == fvm_nodal_get_n_g_vertices(mesh))
+    l_status = 2;
+
+  MPI_Allreduce(&l_status, &g_status, 1, MPI_INT, MPI_MIN, w->comm);
+
+  if (g_status == 0)
+    return false;
+  else if (g_status == 2)
+    return true;
+
+  _free_gather_layout(w);
+
+  int n_local = mesh->n_vertices;
+  const cs_gnum_t *g_num
+    = fvm_io_num_get_global_num(mesh->global_vertex_num);
+
+  int n_gather = 0;
+
+  if (w->rank == 0) {
+    BFT_MALLOC(w->g_count, w->n_ranks, int);
+    BFT_MALLOC(w->g_displ, w->n_ranks, int);
+  }
+
+  MPI_Gather(&n_local, 1, MPI_INT, w->g_count, 1, MPI_INT, 0, w->comm);
+
+  if (w->rank == 0) {
+    for (int i = 0; i < w->n_ranks; i++) {
+      w->g_displ[i] = n_gather;
+      n_gather += w->g_count[i];
+    }
+    BFT_MALLOC(w->g_num, n_gather, cs_gnum_t);
+  }
+
+  MPI_Gatherv(g_num, n_local, CS_MPI_GNUM,
+              w->g_num, w->g_count, w->g_displ, CS_MPI_GNUM,
+              0, w->comm);
+
+  w->g_mesh = mesh;
+  w->g_n_vertices = mesh->n_vertices;
+  w->g_n_g_vertices = fvm_nodal_get_n_g_vertices(mesh);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Export interlaced real per-node values using the cached gather layout.
+ *
+ * Values are gathered to rank 0 with a single collective call and
+ * reordered by global vertex number before output.
+ *
+ * parameters:
+ *   c            <-> pointer to writer and field context
+ *   dimension    <-- field dimension
+ *   field_values <-- array of associated field value arrays
+ *----------------------------------------------------------------------------*/
+
+static void
+_export_field_gathered(_time_plot_context_t  *c,
+                       int                    dimension,
+                       const void      *const field_values[])
+{
+  fvm_to_time_plot_writer_t  *w = c->writer;
+
+  const int n_g = w->g_n_g_vertices;
+  const int n_gather = (w->rank == 0) ?
+    w->g_displ[w->n_ranks-1] + w->g_count[w->n_ranks-1] : 0;
+
+  cs_real_t *recv_vals = nullptr, *vals = nullptr;
+  int *count = nullptr, *displ = nullptr;
+
+  if (w->rank == 0) {
+    BFT_MALLOC(recv_vals, (size_t)n_gather*dimension, cs_real_t);
+    BFT_MALLOC(vals, (size_t)n_g*dimension, cs_real_t);
+    BFT_MALLOC(count, w->n_ranks, int);
+    BFT_MALLOC(displ, w->n_ranks, int);
+    for (int i = 0; i < w->n_ranks; i++) {
+      count[i] = w->g_count[i]*dimension;
+      displ[i] = w->g_displ[i]*dimension;
+    }
+  }
+
+  MPI_Gatherv(field_values[0], w->g_n_vertices*dimension, CS_MPI_REAL,
+              recv_vals, count, displ, CS_MPI_REAL,
+              0, w->comm);
+
+  if (w->rank == 0) {
+
+    for (int i = 0; i < n_g*dimension; i++)
+      vals[i] = 0.;
+
+    for (int i = 0; i < n_gather; i++) {
+      const cs_gnum_t j = w->g_num[i] - 1;
+      for (int k = 0; k < dimension; k++)
+        vals[j*dimension + k] = recv_vals[i*dimension + k];
+    }
+
+    _field_output(c, CS_REAL_TYPE, dimension, 0, 1, n_g + 1, vals);
+
+    BFT_FREE(displ);
+    BFT_FREE(count);
+    BFT_FREE(vals);
+    BFT_FREE(recv_vals);
+  }
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -400,6 +567,8 @@ _field_output(void           *context,
  * Options are:
  *   csv                 output CSV (comma-separated-values) files
  *   dat                 output dat (space-separated) files
+ *   binary              output binary files (converted to CSV using
+ *                       "code_saturne tpconvert")
  *   use_iteration       use time step id instead of time value for
  *                       first column
  *   flush_wtime=<wt>    flush output file every 'wt' seconds
@@ -465,6 +634,12 @@ fvm_to_time_plot_init_writer(const char             *name,
       w->rank = rank;
       w->n_ranks = n_ranks;
     }
+    w->g_mesh = nullptr;
+    w->g_n_vertices = 0;
+    w->g_n_g_vertices = 0;
+    w->g_count = nullptr;
+    w->g_displ = nullptr;
+    w->g_num = nullptr;
   }
 #endif /* defined(HAVE_MPI) */
 
@@ -501,6 +676,8 @@ fvm_to_time_plot_init_writer(const char             *name,
         w->format = CS_TIME_PLOT_CSV;
       else if ((l_opt == 3) && (strncmp(options + i1, "dat", l_opt) == 0))
         w->format = CS_TIME_PLOT_DAT;
+      else if ((l_opt == 6) && (strncmp(options + i1, "binary", l_opt) == 0))
+        w->format = CS_TIME_PLOT_BIN;
       else if ((l_opt == 13) && (strcmp(options + i1, "use_iteration") == 0))
         w->use_iteration = true;
       else if (strncmp(options + i1, "n_buf_steps=", 12) == 0) {
@@ -548,6 +725,10 @@ fvm_to_time_plot_finalize_writer(void  *writer)
   BFT_FREE(w->name);
   BFT_FREE(w->prefix);
 
+#if defined(HAVE_MPI)
+  _free_gather_layout(w);
+#endif
+
   if (w->rank <= 0) {
     for (int i = 0; i < w->n_plots; i++)
       cs_time_plot_finalize(&(w->tp[i]));
@@ -597,6 +778,10 @@ fvm_to_time_plot_export_nodal(void               *writer,
     fvm_to_time_plot_writer_t  *w
       = (fvm_to_time_plot_writer_t *)writer;
 
+#if defined(HAVE_MPI)
+    _free_gather_layout(w);
+#endif
+
     fvm_writer_field_helper_t  *helper
       = fvm_writer_field_helper_create(mesh,
                                        nullptr, /* section list */
@@ -685,6 +870,29 @@ fvm_to_time_plot_export_field(void                  *writer,
                                    time_step,
                                    time_value);
 
+  /* Real interlaced values using local vertex ids may be gathered directly,
+     reusing the layout built for previous fields on the same mesh */
+
+#if defined(HAVE_MPI)
+
+  if (   w->n_ranks > 1
+      && location == FVM_WRITER_PER_NODE
+      && datatype == CS_REAL_TYPE
+      && n_parent_lists == 0
+      && (interlace == CS_INTERLACE || dimension == 1)) {
+
+    if (_update_gather_layout(w, mesh)) {
+      _time_plot_context_t c = {.writer = w,
+                                .mesh = mesh,
+                                .name = name};
+      _export_field_gathered(&c, dimension, field_values);
+      return;
+    }
+
+  }
+
+#endif
+
   /* Initialize writer helper */
 
   cs_datatype_t  dest_datatype = CS_REAL_TYPE;
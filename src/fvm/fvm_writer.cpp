@@ -69,6 +69,7 @@
 #include "fvm_to_cgns.h"
 #include "fvm_to_med.h"
 #include "fvm_to_ensight.h"
+#include "fvm_to_hdf5.h"
 #include "fvm_to_histogram.h"
 #include "fvm_to_plot.h"
 #include "fvm_to_time_plot.h"
@@ -107,16 +108,17 @@ BEGIN_C_DECLS
 
 /* Number and status of defined formats */
 
-static const int _fvm_writer_n_formats = 10;
+static const int _fvm_writer_n_formats = 11;
 
-static fvm_writer_format_t _fvm_writer_format_list[10] = {
+static fvm_writer_format_t _fvm_writer_format_list[11] = {
 
   /* Built-in EnSight Gold writer */
   {
     "EnSight Gold",
     "7.4 +",
     (  FVM_WRITER_FORMAT_HAS_POLYGON
-     | FVM_WRITER_FORMAT_HAS_POLYHEDRON),
+     | FVM_WRITER_FORMAT_HAS_POLYHEDRON
+     | FVM_WRITER_FORMAT_MESH_REUSE),
     FVM_WRITER_TRANSIENT_CONNECT,
     0,                                 /* dynamic library count */
     0,                                 /* dynamic library flags */
@@ -446,6 +448,42 @@ static fvm_writer_format_t _fvm_writer_format_list[10] = {
     nullptr,
     nullptr,
     nullptr
+#endif
+  },
+
+  /* Compressed HDF5 writer */
+  {
+    "HDF5",
+    "1.10 +",
+    (  FVM_WRITER_FORMAT_USE_EXTERNAL
+     | FVM_WRITER_FORMAT_HAS_POLYGON
+     | FVM_WRITER_FORMAT_HAS_POLYHEDRON),
+    FVM_WRITER_TRANSIENT_CONNECT,
+    0,                                 /* dynamic library count */
+    0,                                 /* dynamic library flags */
+    nullptr,                           /* dynamic library */
+    nullptr,                           /* dynamic library name */
+    nullptr,                           /* dynamic library prefix */
+#if defined(HAVE_HDF5)
+    fvm_to_hdf5_n_version_strings,     /* n_version_strings_func */
+    fvm_to_hdf5_version_string,        /* version_string_func */
+    fvm_to_hdf5_init_writer,           /* init_func */
+    fvm_to_hdf5_finalize_writer,       /* finalize_func */
+    fvm_to_hdf5_set_mesh_time,         /* set_mesh_time_func */
+    nullptr,                           /* needs_tesselation_func */
+    fvm_to_hdf5_export_nodal,          /* export_nodal_func */
+    fvm_to_hdf5_export_field,          /* export_field_func */
+    fvm_to_hdf5_flush                  /* flush_func */
+#else
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr
 #endif
   }
 
@@ -883,6 +921,8 @@ fvm_writer_get_format_id(const char  *format_name)
     strcpy(closest_name, "CCM-IO");
   else if (strncmp(tmp_name, "melissa", 7) == 0)
     strcpy(closest_name, "Melissa");
+  else if (strncmp(tmp_name, "hdf5", 4) == 0)
+    strcpy(closest_name, "HDF5");
   else
     strcpy(closest_name, tmp_name);
 
@@ -1108,6 +1148,8 @@ fvm_writer_filter_option(char        *format_options,
  *   divide_polygons     tesselate polygons with triangles
  *   divide_polyhedra    tesselate polyhedra with tetrahedra and pyramids
  *                       (adding a vertex near each polyhedron's center)
+ *   async               gather binary output on a single rank and write it
+ *                       using a helper thread (for EnSight)
  *   separate_meshes     use a different writer for each mesh
  *
  * parameters:
@@ -1399,6 +1441,28 @@ fvm_writer_get_time_dep(const fvm_writer_t  *this_writer)
   return this_writer->time_dep;
 }
 
+/*----------------------------------------------------------------------------
+ * Query if a writer allows skipping mesh output at time steps where
+ * no mesh has changed, reusing the previously output meshes.
+ *
+ * This is relevant only for time-dependent meshes.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *
+ * returns:
+ *   true if unchanged meshes do not need to be output again
+ *----------------------------------------------------------------------------*/
+
+bool
+fvm_writer_allows_mesh_reuse(const fvm_writer_t  *this_writer)
+{
+  if (this_writer->format->info_mask & FVM_WRITER_FORMAT_MESH_REUSE)
+    return true;
+
+  return false;
+}
+
 /*----------------------------------------------------------------------------
  * Associate new time step with a mesh.
  *
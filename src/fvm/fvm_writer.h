@@ -213,6 +213,11 @@ fvm_writer_filter_option(char        *format_options,
  *   big_endian          force binary files to big-endian (EnSight)
  *   adf                 use ADF file type (CGNS)
  *   hdf5                use HDF5 file type (CGNS, default if available)
+ *   subfiles=<n>        number of aggregating ranks and subfiles (HDF5)
+ *   deflate=<level>     lossless compression level, 0 to 9 (HDF5)
+ *   tolerance=<value>   absolute error bound for lossy compression (HDF5)
+ *   zfp                 use ZFP lossy compression plugin (HDF5)
+ *   chunk_size=<n>      number of entities per dataset chunk (HDF5)
  *   discard_polygons    do not output polygons or related values
  *   discard_polyhedra   do not output polyhedra or related values
  *   divide_polygons     tesselate polygons with triangles
@@ -318,6 +323,22 @@ fvm_writer_get_path(const fvm_writer_t  *this_writer);
 fvm_writer_time_dep_t
 fvm_writer_get_time_dep(const fvm_writer_t  *this_writer);
 
+/*----------------------------------------------------------------------------
+ * Query if a writer allows skipping mesh output at time steps where
+ * no mesh has changed, reusing the previously output meshes.
+ *
+ * This is relevant only for time-dependent meshes.
+ *
+ * parameters:
+ *   this_writer <-- pointer to mesh and field output writer
+ *
+ * returns:
+ *   true if unchanged meshes do not need to be output again
+ *----------------------------------------------------------------------------*/
+
+bool
+fvm_writer_allows_mesh_reuse(const fvm_writer_t  *this_writer);
+
 /*----------------------------------------------------------------------------
  * Associate new time step with a mesh.
  *
@@ -2391,6 +2391,111 @@ fvm_writer_field_helper_output_n(fvm_writer_field_helper_t  *helper,
                             output_func);
 }
 
+/*----------------------------------------------------------------------------
+ * Return a pointer to local field values which may be used in place by
+ * a writer, if their layout matches that of the output.
+ *
+ * This is the case when values of all the mesh vertices (per node values)
+ * or of all sections of highest dimension (per element values) are
+ * contiguous and in order in a single source array, with the requested
+ * datatype and interlacing (or a single component).
+ *
+ * This allows writers handing data to in-situ libraries to avoid copies;
+ * no parallel redistribution is considered here, so this is relevant only
+ * to local outputs, and it is up to the caller to ensure the source values
+ * remain available as long as they are referenced.
+ *
+ * parameters:
+ *   mesh               <-- pointer to nodal mesh
+ *   location           <-- variable definition location (nodes or elements)
+ *   src_dim            <-- dimension of source data
+ *   component_id       <-- component id for non-interlaced output
+ *   src_interlace      <-- indicates if field in memory is interlaced
+ *   dest_interlace     <-- indicates if output should be interlaced
+ *   n_parent_lists     <-- indicates if field values are to be obtained
+ *                          directly through the local entity index (when 0) or
+ *                          through the parent entity numbers (when 1 or more)
+ *   parent_num_shift   <-- parent list to common number index shifts;
+ *                          size: n_parent_lists
+ *   datatype           <-- indicates the data type of (source) field values
+ *   dest_datatype      <-- output data type
+ *   field_values       <-- array of associated field value arrays
+ *
+ * returns:
+ *   pointer to values which may be used in place, or nullptr
+ *----------------------------------------------------------------------------*/
+
+const void *
+fvm_writer_field_shared_values(const fvm_nodal_t     *mesh,
+                               fvm_writer_var_loc_t   location,
+                               int                    src_dim,
+                               int                    component_id,
+                               cs_interlace_t         src_interlace,
+                               cs_interlace_t         dest_interlace,
+                               int                    n_parent_lists,
+                               const cs_lnum_t        parent_num_shift[],
+                               cs_datatype_t          datatype,
+                               cs_datatype_t          dest_datatype,
+                               const void      *const field_values[])
+{
+  assert(mesh != nullptr);
+
+  if (datatype != dest_datatype || src_dim < 1 || field_values == nullptr)
+    return nullptr;
+
+  /* Only implicit parent numbering (with no shift) may be used in place */
+
+  if (n_parent_lists > 1)
+    return nullptr;
+  else if (n_parent_lists == 1 && parent_num_shift[0] != 0)
+    return nullptr;
+
+  if (location == FVM_WRITER_PER_NODE) {
+    if (mesh->parent_vertex_id != nullptr)
+      return nullptr;
+  }
+  else if (location == FVM_WRITER_PER_ELEMENT) {
+
+    /* With parent lists, each section's values start at the same index,
+       so only a single section may share the source values */
+
+    int n_sections = 0;
+    const int  elt_dim = fvm_nodal_get_max_entity_dim(mesh);
+
+    for (int i = 0; i < mesh->n_sections; i++) {
+      const fvm_nodal_section_t  *section = mesh->sections[i];
+      if (section->entity_dim < elt_dim)
+        continue;
+      if (section->parent_element_id != nullptr)
+        return nullptr;
+      n_sections++;
+    }
+
+    if (n_sections > 1 && n_parent_lists > 0)
+      return nullptr;
+
+  }
+  else
+    return nullptr;
+
+  /* Check interlacing */
+
+  if (src_dim == 1)
+    return field_values[0];
+
+  else if (dest_interlace == CS_INTERLACE) {
+    if (src_interlace == CS_INTERLACE)
+      return field_values[0];
+  }
+
+  else if (src_interlace == CS_NO_INTERLACE) {
+    if (component_id > -1 && component_id < src_dim)
+      return field_values[component_id];
+  }
+
+  return nullptr;
+}
+
 /*----------------------------------------------------------------------------
  * Set string representing a field component's name based on its id.
  *
@@ -61,6 +61,8 @@ BEGIN_C_DECLS
 
 #define FVM_WRITER_FORMAT_NAME_IS_OPTIONAL     (1 << 5)
 
+#define FVM_WRITER_FORMAT_MESH_REUSE           (1 << 6)
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -70,12 +70,14 @@
 #include "cs_geom.h"
 #include "cs_internal_coupling.h"
 #include "cs_math.h"
+#include "cs_math_expr.h"
 #include "cs_meg_prototypes.h"
 #include "cs_meg_xdef_wrapper.h"
 #include "cs_mesh.h"
 #include "cs_mesh_quantities.h"
 #include "cs_mesh_location.h"
 #include "cs_multigrid.h"
+#include "cs_notebook.h"
 #include "cs_order.h"
 #include "cs_parall.h"
 #include "cs_porous_model.h"
@@ -139,6 +141,23 @@ BEGIN_C_DECLS
 static int                            _n_v_meg_contexts = 0;
 static cs_gui_volume_meg_context_t  **_v_meg_contexts = NULL;
 
+/* Compiled expressions for interpreted physical property laws,
+   by property and zone */
+
+typedef struct {
+
+  char            *prop_name;   /* property name */
+  int              zone_id;     /* zone id */
+  char            *law;         /* formula */
+  int              n_symbols;   /* number of input symbols */
+  cs_math_expr_t  *e;           /* compiled expression, or NULL if the
+                                   formula can not be interpreted */
+
+} _property_expr_t;
+
+static int                _n_property_exprs = 0;
+static _property_expr_t  *_property_exprs = NULL;
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -344,6 +363,143 @@ _thermal_table_needed(const char *name)
   return choice;
 }
 
+/*-----------------------------------------------------------------------------
+ * Compute a physical property based on a user law, using the expression
+ * interpreter.
+ *
+ * Symbols available to the interpreter are the cell coordinates, time
+ * values, reference fluid properties, notebook variables and cell-based
+ * fields (by name or label). If the formula uses other symbols, it is
+ * not handled here, and the MEG generated function must be used instead.
+ *
+ * parameters:
+ *   prop_name  <-- property name in formula
+ *   law        <-- formula
+ *   z          <-- pointer to zone
+ *   vals       <-> property values
+ *
+ * returns:
+ *   true if the property was computed, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_physical_property_interpreted(const char       *prop_name,
+                               const char       *law,
+                               const cs_zone_t  *z,
+                               cs_real_t        *vals)
+{
+  const cs_fluid_properties_t *fp = cs_glob_fluid_properties;
+  const cs_time_step_t *ts = cs_glob_time_step;
+
+  const char *base_names[] = {"x", "y", "z", "t", "dt", "iter",
+                              "rho0", "mu0", "p0", "t0", "cp0", "lambda0",
+                              "viscv0"};
+  const int n_base = sizeof(base_names) / sizeof(base_names[0]);
+
+  const int n_nb = cs_notebook_nb_var();
+  const int n_fields = cs_field_n_fields();
+  const int n_max_symbols = n_base + n_nb + 2*n_fields;
+
+  const char **symbols;
+  cs_math_expr_input_t *inputs;
+  cs_real_t *nb_vals;
+  BFT_MALLOC(symbols, n_max_symbols, const char *);
+  BFT_MALLOC(inputs, n_max_symbols, cs_math_expr_input_t);
+  BFT_MALLOC(nb_vals, n_nb + 1, cs_real_t);
+
+  const cs_real_t *cell_cen
+    = (const cs_real_t *)cs_glob_mesh_quantities->cell_cen;
+  const cs_real_t iter = ts->nt_cur;
+
+  const cs_real_t *base_vals[] = {cell_cen, cell_cen + 1, cell_cen + 2,
+                                  &(ts->t_cur), ts->dt, &iter,
+                                  &(fp->ro0), &(fp->viscl0), &(fp->p0),
+                                  &(fp->t0), &(fp->cp0), &(fp->lambda0),
+                                  &(fp->viscv0)};
+
+  int n_symbols = 0;
+
+  for (int i = 0; i < n_base; i++) {
+    symbols[n_symbols] = base_names[i];
+    inputs[n_symbols].val = base_vals[i];
+    inputs[n_symbols].stride = (i < 3) ? 3 : 0;
+    inputs[n_symbols].indexed = true;
+    n_symbols++;
+  }
+
+  for (int i = 0; i < n_nb; i++) {
+    symbols[n_symbols] = cs_notebook_name_by_id(i);
+    nb_vals[i] = cs_notebook_parameter_value_by_name(symbols[n_symbols]);
+    inputs[n_symbols].val = nb_vals + i;
+    inputs[n_symbols].stride = 0;
+    inputs[n_symbols].indexed = true;
+    n_symbols++;
+  }
+
+  for (int f_id = 0; f_id < n_fields; f_id++) {
+    const cs_field_t *f = cs_field_by_id(f_id);
+    if (f->location_id != CS_MESH_LOCATION_CELLS)
+      continue;
+    for (int j = 0; j < 2; j++) {
+      symbols[n_symbols] = (j == 0) ? f->name : cs_field_get_label(f);
+      inputs[n_symbols].val = f->val;
+      inputs[n_symbols].stride = f->dim;
+      inputs[n_symbols].indexed = true;
+      n_symbols++;
+    }
+  }
+
+  /* Compile expression only the first time it is used, or if the law
+     or the available symbols have changed; only input values
+     are updated otherwise */
+
+  _property_expr_t *pe = NULL;
+
+  for (int i = 0; i < _n_property_exprs; i++) {
+    if (   _property_exprs[i].zone_id == z->id
+        && strcmp(_property_exprs[i].prop_name, prop_name) == 0) {
+      pe = _property_exprs + i;
+      break;
+    }
+  }
+
+  if (pe == NULL) {
+    BFT_REALLOC(_property_exprs, _n_property_exprs + 1, _property_expr_t);
+    pe = _property_exprs + _n_property_exprs;
+    _n_property_exprs += 1;
+    BFT_MALLOC(pe->prop_name, strlen(prop_name) + 1, char);
+    strcpy(pe->prop_name, prop_name);
+    pe->zone_id = z->id;
+    pe->law = NULL;
+    pe->n_symbols = -1;
+    pe->e = NULL;
+  }
+
+  if (pe->n_symbols != n_symbols || strcmp(pe->law, law) != 0) {
+    cs_math_expr_destroy(&(pe->e));
+    BFT_REALLOC(pe->law, strlen(law) + 1, char);
+    strcpy(pe->law, law);
+    pe->n_symbols = n_symbols;
+    pe->e = cs_math_expr_create(law,
+                                n_symbols, symbols,
+                                1, &prop_name,
+                                false);
+  }
+
+  bool retval = (pe->e != NULL);
+
+  if (pe->e != NULL) {
+    cs_math_expr_output_t output = {vals, 1, true};
+    cs_math_expr_evaluate(pe->e, z->n_elts, z->elt_ids, inputs, &output);
+  }
+
+  BFT_FREE(nb_vals);
+  BFT_FREE(inputs);
+  BFT_FREE(symbols);
+
+  return retval;
+}
+
 /*-----------------------------------------------------------------------------
  * Compute a physical property based on a thermal law.
  *----------------------------------------------------------------------------*/
@@ -446,7 +602,8 @@ _physical_property_th_diffusivity(cs_field_t          *c_prop,
 
     const char *law = _property_formula(prop_name, z->name);
 
-    if (law != NULL) {
+    if (law != NULL
+        && !_physical_property_interpreted(prop_name, law, z, c_prop->val)) {
       /* Pass "field overlay": shallow copy of field with modified name
        so as to be handled by the MEG volume function. */
       cs_field_t _c_prop = *c_prop;
@@ -546,7 +703,9 @@ _physical_property(cs_field_t          *c_prop,
 
     const char *law = _property_formula(c_prop->name, z->name);
 
-    if (law != NULL) {
+    if (law != NULL
+        && !_physical_property_interpreted(c_prop->name, law, z,
+                                           c_prop->val)) {
       const cs_real_3_t *restrict cell_cen =
         (const cs_real_3_t *restrict)cs_glob_mesh_quantities->cell_cen;
       cs_meg_volume_function(z->name,
@@ -2227,6 +2386,17 @@ cs_gui_finalize(void)
     BFT_FREE(_v_meg_contexts[i]);
 
   BFT_FREE(_v_meg_contexts);
+
+  /* Clean compiled property expressions */
+
+  for (int i = 0; i < _n_property_exprs; i++) {
+    BFT_FREE(_property_exprs[i].prop_name);
+    BFT_FREE(_property_exprs[i].law);
+    cs_math_expr_destroy(&(_property_exprs[i].e));
+  }
+
+  _n_property_exprs = 0;
+  BFT_FREE(_property_exprs);
 }
 
 /*----------------------------------------------------------------------------
@@ -3741,6 +3911,8 @@ cs_gui_parallel_io(void)
         m = CS_FILE_MPI_NON_COLLECTIVE;
       else if (!strcmp(method_name, "mpi collective"))
         m = CS_FILE_MPI_COLLECTIVE;
+      else if (!strcmp(method_name, "mmap"))
+        m = CS_FILE_MMAP;
 #if defined(HAVE_MPI)
       cs_file_set_default_access(op_mode[op_id], m, MPI_INFO_NULL);
 #else
@@ -654,24 +654,21 @@ _read_header(cs_xml_t  *doc)
   assert(found);
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*============================================================================
- * Public function definitions
- *============================================================================*/
-
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Read and parse XML file to tree.
  *
- * \param[in, out]   r    root node to which XML contents are read
- * \param[in]  path  path to XML file
+ * \param[in, out]  r      root node to which XML contents are read
+ * \param[in]       path   path to XML file
+ * \param[in]       local  if true, read on the current rank only;
+ *                         otherwise, read on rank 0 and broadcast
  */
 /*----------------------------------------------------------------------------*/
 
-void
-cs_tree_xml_read(cs_tree_node_t  *r,
-                 const char       path[])
+static void
+_read_file(cs_tree_node_t  *r,
+           const char       path[],
+           bool             local)
 {
   /* Read buffer */
 
@@ -679,9 +676,10 @@ cs_tree_xml_read(cs_tree_node_t  *r,
   BFT_MALLOC(doc, 1, cs_xml_t);
 
   cs_gnum_t f_size;
-  if (cs_glob_rank_id < 1)
+  if (local || cs_glob_rank_id < 1)
     f_size = cs_file_size(path);
-  cs_parall_bcast(0, 1, CS_GNUM_TYPE, &f_size);
+  if (!local)
+    cs_parall_bcast(0, 1, CS_GNUM_TYPE, &f_size);
 
   if (f_size <= 0)
     bft_error(__FILE__, __LINE__, 0,
@@ -699,7 +697,14 @@ cs_tree_xml_read(cs_tree_node_t  *r,
   doc->node = r;
   doc->parent = NULL;
 
-  cs_file_t *f = cs_file_open_serial(path, CS_FILE_MODE_READ);
+  cs_file_t *f = NULL;
+#if defined(HAVE_MPI)
+  if (local)
+    f = cs_file_open(path, CS_FILE_MODE_READ, CS_FILE_STDIO_SERIAL,
+                     MPI_INFO_NULL, MPI_COMM_NULL, MPI_COMM_SELF);
+  else
+#endif
+    f = cs_file_open_serial(path, CS_FILE_MODE_READ);
   cs_file_read_global(f, doc->buf, 1, f_size);
   f = cs_file_free(f);
 
@@ -721,6 +726,63 @@ cs_tree_xml_read(cs_tree_node_t  *r,
 
   BFT_FREE(doc->buf);
   BFT_FREE(doc);
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Read and parse XML file to tree.
+ *
+ * In parallel, the file is parsed on rank 0 only, and the resulting
+ * tree is broadcast to other ranks in a packed (binary) form, which is
+ * both smaller than the XML text and avoids parsing it on every rank.
+ *
+ * \param[in, out]   r    root node to which XML contents are read
+ * \param[in]  path  path to XML file
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_tree_xml_read(cs_tree_node_t  *r,
+                 const char       path[])
+{
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    char *buf = NULL;
+    size_t size = 0;
+
+    if (cs_glob_rank_id == 0) {
+      cs_tree_node_t *t = cs_tree_node_create(NULL);
+      _read_file(t, path, true);
+      buf = cs_tree_pack_children(t, &size);
+      cs_tree_node_free(&t);
+    }
+
+    cs_gnum_t g_size = size;
+    cs_parall_bcast(0, 1, CS_GNUM_TYPE, &g_size);
+
+    if (cs_glob_rank_id > 0)
+      BFT_MALLOC(buf, g_size + 1, char);
+
+    MPI_Bcast(buf, g_size, MPI_CHAR, 0, cs_glob_mpi_comm);
+
+    cs_tree_unpack_children(r, g_size, buf);
+
+    BFT_FREE(buf);
+
+  }
+  else
+
+#endif
+
+    _read_file(r, path, false);
 
 #if 0 && defined(DEBUG) && !defined(NDEBUG)
   cs_tree_dump(CS_LOG_DEFAULT, 0, r);
@@ -631,6 +631,21 @@ typedef struct {
    *
    * \var nl_algo
    *      Structure used to manage the non-linearities
+   *
+   * \var soil_update_rtol
+   *      Relative variation of the capillarity pressure at the vertices of a
+   *      cell under which the soil laws (liquid saturation, capacity and
+   *      relative permeabilities) are not evaluated again in this cell. If
+   *      the value is <= 0 (default), soil laws are evaluated in all cells at
+   *      each update.
+   *
+   * \var pc_in_law
+   *      Values of the capillarity pressure at cell vertices (with a c2v
+   *      indexing) used for the last evaluation of the soil laws in each
+   *      cell. Allocated only if soil_update_rtol > 0.
+   *
+   * \var pc_in_law_is_set
+   *      true once all cells have been evaluated at least once
    */
 
   cs_gwf_tpf_approx_type_t       approx_type;
@@ -649,6 +664,10 @@ typedef struct {
 
   cs_iter_algo_t                *nl_algo;
 
+  double                         soil_update_rtol;
+  cs_real_t                     *pc_in_law;
+  bool                           pc_in_law_is_set;
+
   /*!
    * @}
    */
@@ -577,6 +577,50 @@ _update_iso_soil_vgm_spf(const cs_real_t              t_eval,
   } /* Loop on selected cells */
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if the soil laws have to be evaluated again in a cell.
+ *        This is the case if the capillarity pressure at one of the cell
+ *        vertices has changed beyond the tolerance set in the model context
+ *        since the last evaluation. In this case, the reference values of
+ *        the capillarity pressure are updated.
+ *
+ * \param[in]      c_id     cell id
+ * \param[in]      c2v      pointer to the cell -> vertices adjacency
+ * \param[in]      pc_val   values of the capillarity pressure at vertices
+ * \param[in, out] hc       pointer to the hydraulic context
+ *
+ * \return true if the soil laws have to be evaluated in this cell
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline bool
+_tpf_needs_update(cs_lnum_t                c_id,
+                  const cs_adjacency_t    *c2v,
+                  const cs_real_t         *pc_val,
+                  cs_gwf_tpf_t            *hc)
+{
+  if (hc->pc_in_law == nullptr)
+    return true;
+
+  cs_real_t  *pc_ref = hc->pc_in_law;
+  const cs_lnum_t  s = c2v->idx[c_id], e = c2v->idx[c_id+1];
+
+  bool  needs_update = !(hc->pc_in_law_is_set);
+  for (cs_lnum_t j = s; j < e && !needs_update; j++) {
+    const cs_real_t  pc_v = pc_val[c2v->ids[j]];
+    if (fabs(pc_v - pc_ref[j]) > hc->soil_update_rtol*fabs(pc_ref[j]))
+      needs_update = true;
+  }
+
+  if (needs_update) {
+    for (cs_lnum_t j = s; j < e; j++)
+      pc_ref[j] = pc_val[c2v->ids[j]];
+  }
+
+  return needs_update;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute the new property values related to a soil with a Van
@@ -643,6 +687,8 @@ _update_iso_soil_tpf(const cs_real_t              t_eval,
     for (cs_lnum_t i = 0; i < zone->n_elts; i++) {
 
       const cs_lnum_t  c_id = zone->elt_ids[i];
+      if (!_tpf_needs_update(c_id, c2v, pc_val, hc))
+        continue;
 
       /* Mean value of the capillarity pressure in the current cell */
 
@@ -666,6 +712,8 @@ _update_iso_soil_tpf(const cs_real_t              t_eval,
     for (cs_lnum_t i = 0; i < zone->n_elts; i++) {
 
       const cs_lnum_t  c_id = zone->elt_ids[i];
+      if (!_tpf_needs_update(c_id, c2v, pc_val, hc))
+        continue;
 
       double  pc_sum = 0, sl_sum = 0, dsldpc_sum = 0;
       double  krg_sum = 0, krl_sum = 0;
@@ -711,6 +759,8 @@ _update_iso_soil_tpf(const cs_real_t              t_eval,
     for (cs_lnum_t i = 0; i < zone->n_elts; i++) {
 
       const cs_lnum_t  c_id = zone->elt_ids[i];
+      if (!_tpf_needs_update(c_id, c2v, pc_val, hc))
+        continue;
 
       /* Mean value of the capillarity pressure in the current cell */
 
@@ -751,6 +801,8 @@ _update_iso_soil_tpf(const cs_real_t              t_eval,
     for (cs_lnum_t i = 0; i < zone->n_elts; i++) {
 
       const cs_lnum_t  c_id = zone->elt_ids[i];
+      if (!_tpf_needs_update(c_id, c2v, pc_val, hc))
+        continue;
 
       double  sl_sum = 0, dsldpc_sum = 0, krg_sum = 0, krl_sum = 0;
 
@@ -787,6 +839,8 @@ _update_iso_soil_tpf(const cs_real_t              t_eval,
     for (cs_lnum_t i = 0; i < zone->n_elts; i++) {
 
       const cs_lnum_t  c_id = zone->elt_ids[i];
+      if (!_tpf_needs_update(c_id, c2v, pc_val, hc))
+        continue;
       for (cs_lnum_t j = c2v->idx[c_id]; j < c2v->idx[c_id+1]; j++)
         sp->eval_properties(sp, pc_val[c2v->ids[j]],
                             &(lsat[j]), &(lcap[j]), &(krl[j]), &(krg[j]));
@@ -2930,6 +2930,10 @@ cs_gwf_tpf_create(cs_gwf_model_type_t      model)
 
   tpf->nl_algo = nullptr;
 
+  tpf->soil_update_rtol = -1;  /* All cells are updated by default */
+  tpf->pc_in_law = nullptr;
+  tpf->pc_in_law_is_set = false;
+
   return tpf;
 }
 
@@ -2964,6 +2968,7 @@ cs_gwf_tpf_free(cs_gwf_tpf_t    **p_tpf)
 
   BFT_FREE(tpf->srct_w_array);
   BFT_FREE(tpf->srct_h_array);
+  BFT_FREE(tpf->pc_in_law);
 
   /* Free the structure handling the convergence of the non-linear algorithm */
 
@@ -3109,6 +3114,11 @@ cs_gwf_tpf_log_setup(cs_gwf_tpf_t          *tpf)
     }
 
   } /* There is a non-linear algorithm */
+
+  if (tpf->soil_update_rtol > 0)
+    cs_log_printf(CS_LOG_SETUP, "  * GWF | Lazy update of soil laws:"
+                  " rtol on the capillarity pressure: %5.3e\n",
+                  tpf->soil_update_rtol);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3525,6 +3535,11 @@ cs_gwf_tpf_finalize_setup(const cs_cdo_connect_t      *connect,
   default:
     bft_error(__FILE__, __LINE__, 0, "%s: Invalid solver type", __func__);
   }
+
+  /* Reference values for a lazy evaluation of the soil laws */
+
+  if (tpf->soil_update_rtol > 0)
+    BFT_MALLOC(tpf->pc_in_law, c2v_size, cs_real_t);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -3743,6 +3758,9 @@ cs_gwf_tpf_update(const cs_mesh_t             *mesh,
 
   cs_gwf_soil_update(time_eval, mesh, connect, cdoq);
 
+  if (tpf->pc_in_law != nullptr)
+    tpf->pc_in_law_is_set = true;
+
   /* Define the liquid saturation in each cell when the liquid saturation has
      been defined on the submesh */
 
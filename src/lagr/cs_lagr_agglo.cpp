@@ -97,10 +97,99 @@ BEGIN_C_DECLS
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
 
+/*============================================================================
+ * Local structure definitions
+ *============================================================================*/
+
+/* Map from class id to new parcels: open addressing hash table on
+   class ids, with parcels of a same class chained in creation order */
+
+struct _cs_lagr_agglo_class_map_t {
+
+  cs_lnum_t   n_slots;         /* number of hash table slots
+                                  (power of 2) */
+  cs_lnum_t   n_used_slots;    /* number of used slots */
+
+  cs_lnum_t  *slot_class;      /* class id for each slot, or -1 */
+  cs_lnum_t  *slot_first;      /* first parcel of class for each slot */
+  cs_lnum_t  *slot_last;       /* last parcel of class for each slot */
+
+  cs_lnum_t   n_parcels;       /* number of parcels */
+  cs_lnum_t   n_parcels_max;   /* allocated size of next_parcel */
+  cs_lnum_t  *next_parcel;     /* next parcel of the same class, or -1 */
+
+};
+
 /*=============================================================================
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the hash table slot matching a class id in a class map.
+ *
+ * \param[in]  cm        pointer to class map
+ * \param[in]  class_id  class id
+ *
+ * \return  slot id (either used by class_id, or free)
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_class_map_slot(const cs_lagr_agglo_class_map_t  *cm,
+                cs_lnum_t                         class_id)
+{
+  const unsigned long long mask = cm->n_slots - 1;
+
+  cs_lnum_t s_id = ((unsigned long long)class_id * 2654435761ULL) & mask;
+
+  while (   cm->slot_class[s_id] != class_id
+         && cm->slot_class[s_id] != -1)
+    s_id = (s_id + 1) & mask;
+
+  return s_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief (Re)allocate hash table of class map, and re-insert classes.
+ *
+ * \param[in, out]  cm       pointer to class map
+ * \param[in]       n_slots  new number of slots (power of 2)
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_class_map_resize(cs_lagr_agglo_class_map_t  *cm,
+                  cs_lnum_t                   n_slots)
+{
+  cs_lnum_t n_slots_prev = cm->n_slots;
+  cs_lnum_t *slot_class_prev = cm->slot_class;
+  cs_lnum_t *slot_first_prev = cm->slot_first;
+  cs_lnum_t *slot_last_prev = cm->slot_last;
+
+  cm->n_slots = n_slots;
+  BFT_MALLOC(cm->slot_class, n_slots, cs_lnum_t);
+  BFT_MALLOC(cm->slot_first, n_slots, cs_lnum_t);
+  BFT_MALLOC(cm->slot_last, n_slots, cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_slots; i++)
+    cm->slot_class[i] = -1;
+
+  for (cs_lnum_t i = 0; i < n_slots_prev; i++) {
+    if (slot_class_prev[i] > -1) {
+      cs_lnum_t s_id = _class_map_slot(cm, slot_class_prev[i]);
+      cm->slot_class[s_id] = slot_class_prev[i];
+      cm->slot_first[s_id] = slot_first_prev[i];
+      cm->slot_last[s_id] = slot_last_prev[i];
+    }
+  }
+
+  BFT_FREE(slot_class_prev);
+  BFT_FREE(slot_first_prev);
+  BFT_FREE(slot_last_prev);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Obtain the (i,j) index of an upper triangular matrix
@@ -292,6 +381,155 @@ _gaps_classes(cs_lnum_2_t  *array,
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a map from class id to newly created parcels.
+ *
+ * Parcels created by agglomeration or fragmentation in a given cell are
+ * appended to the particle set; this map allows finding the parcels of a
+ * given class among them in constant time, rather than scanning all
+ * new parcels.
+ *
+ * \return  pointer to new class map
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lagr_agglo_class_map_t *
+cs_lagr_agglo_class_map_create(void)
+{
+  cs_lagr_agglo_class_map_t *cm;
+
+  BFT_MALLOC(cm, 1, cs_lagr_agglo_class_map_t);
+
+  cm->n_slots = 0;
+  cm->n_used_slots = 0;
+  cm->slot_class = NULL;
+  cm->slot_first = NULL;
+  cm->slot_last = NULL;
+
+  cm->n_parcels = 0;
+  cm->n_parcels_max = 16;
+  BFT_MALLOC(cm->next_parcel, cm->n_parcels_max, cs_lnum_t);
+
+  _class_map_resize(cm, 32);
+
+  return cm;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a class map.
+ *
+ * \param[in, out]  cm  pointer to class map pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_map_destroy(cs_lagr_agglo_class_map_t  **cm)
+{
+  cs_lagr_agglo_class_map_t *_cm = *cm;
+
+  if (_cm != NULL) {
+    BFT_FREE(_cm->slot_class);
+    BFT_FREE(_cm->slot_first);
+    BFT_FREE(_cm->slot_last);
+    BFT_FREE(_cm->next_parcel);
+    BFT_FREE(*cm);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a new parcel of a given class to a class map.
+ *
+ * Parcels must be added in creation order; the id of the added parcel
+ * (relative to the first new parcel) is the number of previously added
+ * parcels.
+ *
+ * \param[in, out]  cm        pointer to class map
+ * \param[in]       class_id  class of new parcel
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_map_add(cs_lagr_agglo_class_map_t  *cm,
+                            cs_lnum_t                   class_id)
+{
+  assert(class_id > -1);
+
+  /* Keep hash table at most half full */
+
+  if (2*(cm->n_used_slots + 1) > cm->n_slots)
+    _class_map_resize(cm, cm->n_slots*2);
+
+  cs_lnum_t p_id = cm->n_parcels;
+
+  if (p_id >= cm->n_parcels_max) {
+    cm->n_parcels_max *= 2;
+    BFT_REALLOC(cm->next_parcel, cm->n_parcels_max, cs_lnum_t);
+  }
+  cm->next_parcel[p_id] = -1;
+  cm->n_parcels += 1;
+
+  cs_lnum_t s_id = _class_map_slot(cm, class_id);
+
+  if (cm->slot_class[s_id] == -1) {
+    cm->slot_class[s_id] = class_id;
+    cm->slot_first[s_id] = p_id;
+    cm->n_used_slots += 1;
+  }
+  else
+    cm->next_parcel[cm->slot_last[s_id]] = p_id;
+
+  cm->slot_last[s_id] = p_id;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the first new parcel of a given class in a class map.
+ *
+ * \param[in]  cm        pointer to class map
+ * \param[in]  class_id  class id
+ *
+ * \return  id of first parcel of this class (relative to the first new
+ *          parcel), or -1 if none
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_map_first(const cs_lagr_agglo_class_map_t  *cm,
+                              cs_lnum_t                         class_id)
+{
+  cs_lnum_t s_id = _class_map_slot(cm, class_id);
+
+  if (cm->slot_class[s_id] == -1)
+    return -1;
+
+  return cm->slot_first[s_id];
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the next new parcel with the same class in a class map.
+ *
+ * \param[in]  cm         pointer to class map
+ * \param[in]  parcel_id  id of current parcel (relative to the first
+ *                        new parcel)
+ *
+ * \return  id of next parcel of the same class, in creation order,
+ *          or -1 if none
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_map_next(const cs_lagr_agglo_class_map_t  *cm,
+                             cs_lnum_t                         parcel_id)
+{
+  assert(parcel_id > -1 && parcel_id < cm->n_parcels);
+
+  return cm->next_parcel[parcel_id];
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Merge two sorted arrays in a third sorted array
@@ -449,6 +687,9 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
   long long int vp = 0;
   cs_lnum_t n_classes_new = 0;
 
+  /* Map from class to parcels created in this cell */
+  cs_lagr_agglo_class_map_t *cm = cs_lagr_agglo_class_map_create();
+
   /* Treat agglomeration between pairs*/
   while (kk >= 0) {
     cs_real_t rand;
@@ -565,15 +806,13 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
 
       cs_lnum_t add_to_end = 1;
 
-      for (cs_lnum_t indx = p_set->n_particles;
-          indx < p_set->n_particles + newpart;
-          indx++) {
-        cs_lnum_t stat_class
-          = cs_lagr_particles_get_lnum(p_set, indx, CS_LAGR_AGGLO_CLASS_ID);
+      for (cs_lnum_t k = cs_lagr_agglo_class_map_first(cm, n_classes_new);
+           k > -1;
+           k = cs_lagr_agglo_class_map_next(cm, k)) {
+        cs_lnum_t indx = p_set->n_particles + k;
         cs_real_t stat_weight
           = cs_lagr_particles_get_real(p_set, indx, CS_LAGR_STAT_WEIGHT);
-        if (   (stat_class == n_classes_new)
-            && (stat_weight + vp <= agglo_max_weight)) {
+        if (stat_weight + vp <= agglo_max_weight) {
           cs_lagr_particles_set_real(p_set, indx, CS_LAGR_STAT_WEIGHT,
                                      round(stat_weight)+vp);
 
@@ -586,6 +825,7 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
          Principle: copy parcel p1 and modify its properties */
       if ( add_to_end == 1 ) {
         newpart++;
+        cs_lagr_agglo_class_map_add(cm, n_classes_new);
 
         /* Copy parcel p1 into a new parcel */
         cs_lnum_t inserted_parts = p_set->n_particles + newpart;
@@ -651,6 +891,8 @@ cs_lagr_agglomeration(cs_lnum_t  cell_id,
     kk--;
   }
 
+  cs_lagr_agglo_class_map_destroy(&cm);
+
   /* Store class and index of newly created particles */
   cs_lnum_2_t *interf_agglo;
   BFT_MALLOC(interf_agglo, newpart, cs_lnum_2_t);
@@ -41,10 +41,95 @@
 
 BEGIN_C_DECLS
 
+/*============================================================================
+ * Type definitions
+ *============================================================================*/
+
+/* Map from class id to parcels created in a given cell (opaque) */
+
+typedef struct _cs_lagr_agglo_class_map_t  cs_lagr_agglo_class_map_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create a map from class id to newly created parcels.
+ *
+ * Parcels created by agglomeration or fragmentation in a given cell are
+ * appended to the particle set; this map allows finding the parcels of a
+ * given class among them in constant time, rather than scanning all
+ * new parcels.
+ *
+ * \return  pointer to new class map
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lagr_agglo_class_map_t *
+cs_lagr_agglo_class_map_create(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a class map.
+ *
+ * \param[in, out]  cm  pointer to class map pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_map_destroy(cs_lagr_agglo_class_map_t  **cm);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a new parcel of a given class to a class map.
+ *
+ * Parcels must be added in creation order; the id of the added parcel
+ * (relative to the first new parcel) is the number of previously added
+ * parcels.
+ *
+ * \param[in, out]  cm        pointer to class map
+ * \param[in]       class_id  class of new parcel
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_agglo_class_map_add(cs_lagr_agglo_class_map_t  *cm,
+                            cs_lnum_t                   class_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the first new parcel of a given class in a class map.
+ *
+ * \param[in]  cm        pointer to class map
+ * \param[in]  class_id  class id
+ *
+ * \return  id of first parcel of this class (relative to the first new
+ *          parcel), or -1 if none
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_map_first(const cs_lagr_agglo_class_map_t  *cm,
+                              cs_lnum_t                         class_id);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the next new parcel with the same class in a class map.
+ *
+ * \param[in]  cm         pointer to class map
+ * \param[in]  parcel_id  id of current parcel (relative to the first
+ *                        new parcel)
+ *
+ * \return  id of next parcel of the same class, in creation order,
+ *          or -1 if none
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_lnum_t
+cs_lagr_agglo_class_map_next(const cs_lagr_agglo_class_map_t  *cm,
+                             cs_lnum_t                         parcel_id);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Merge two sorted arrays in a third sorted array
@@ -93,6 +93,63 @@ static const cs_lnum_t _t2v[3][3] = {{0, 3, 5},
                                      {3, 1, 4},
                                      {5, 4, 2}};
 
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Build a cell -> particles index and list.
+ *
+ * Particles are bucketed by cell with a stable counting sort, so that
+ * source terms may be accumulated by cell (with no write conflict between
+ * threads), in the same order as a loop on particles.
+ *
+ * parameters:
+ *   p_set     <-- pointer to particle set
+ *   n_cells   <-- number of cells
+ *   c_p_idx   --> cell -> particles index (size: n_cells + 1)
+ *   c_p_ids   --> particle ids, sorted by cell (size: n_particles)
+ *----------------------------------------------------------------------------*/
+
+static void
+_cell_particle_list(const cs_lagr_particle_set_t  *p_set,
+                    cs_lnum_t                      n_cells,
+                    cs_lnum_t                    **c_p_idx,
+                    cs_lnum_t                    **c_p_ids)
+{
+  const cs_lnum_t n_particles = p_set->n_particles;
+
+  cs_lnum_t *idx, *ids;
+  BFT_MALLOC(idx, n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(ids, n_particles, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells + 1; c_id++)
+    idx[c_id] = 0;
+
+  for (cs_lnum_t p_id = 0; p_id < n_particles; p_id++) {
+    cs_lnum_t c_id = cs_lagr_particles_get_lnum(p_set, p_id, CS_LAGR_CELL_ID);
+    idx[c_id + 1] += 1;
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    idx[c_id + 1] += idx[c_id];
+
+  for (cs_lnum_t p_id = 0; p_id < n_particles; p_id++) {
+    cs_lnum_t c_id = cs_lagr_particles_get_lnum(p_set, p_id, CS_LAGR_CELL_ID);
+    ids[idx[c_id]] = p_id;
+    idx[c_id] += 1;
+  }
+
+  /* Shift index back */
+
+  for (cs_lnum_t c_id = n_cells; c_id > 0; c_id--)
+    idx[c_id] = idx[c_id - 1];
+  idx[0] = 0;
+
+  *c_p_idx = idx;
+  *c_p_ids = ids;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -226,12 +283,19 @@ cs_lagr_coupling(const cs_real_t    taup[],
     volm[c_id] = 0.0;
   }
 
+  /* Particles sorted by cell, so that source terms are accumulated with
+     no write conflict between threads */
+
+  cs_lnum_t *c_p_idx = NULL, *c_p_ids = NULL;
+  _cell_particle_list(p_set, ncel, &c_p_idx, &c_p_ids);
+
   /* Preliminary computations
      ======================== */
 
   /* Finalization of external forces (if the particle interacts with a
      domain boundary, revert to order 1). */
 
+# pragma omp parallel for if (nbpart > CS_THR_MIN)
   for (cs_lnum_t p_id = 0; p_id < nbpart; p_id++) {
 
     cs_real_t aux1 = dtp / taup[p_id];
@@ -247,6 +311,7 @@ cs_lagr_coupling(const cs_real_t    taup[],
 
   }
 
+# pragma omp parallel for if (nbpart > CS_THR_MIN)
   for (cs_lnum_t p_id = 0; p_id < nbpart; p_id++) {
 
     cs_real_t  p_stat_w = cs_lagr_particles_get_real(p_set, p_id,
@@ -286,36 +351,39 @@ cs_lagr_coupling(const cs_real_t    taup[],
     cs_array_real_fill_zero(3 * n_cells_ext, (cs_real_t *) t_st_vel);
     cs_array_real_fill_zero(n_cells_ext,  t_st_imp_vel);
 
-    for (cs_lnum_t p_id = 0; p_id < nbpart; p_id++) {
+#   pragma omp parallel for if (ncel > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+      for (cs_lnum_t ii = c_p_idx[c_id]; ii < c_p_idx[c_id+1]; ii++) {
 
-      unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
+        cs_lnum_t p_id = c_p_ids[ii];
 
-      cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am,
-                                                      CS_LAGR_STAT_WEIGHT);
+        unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
 
-      cs_real_t  prev_p_diam = cs_lagr_particle_get_real_n(particle, p_am, 1,
-                                                           CS_LAGR_DIAMETER);
-      cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1,
-                                                           CS_LAGR_MASS);
-      cs_real_t  p_mass = cs_lagr_particle_get_real(particle, p_am,
-                                                    CS_LAGR_MASS);
+        cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am,
+                                                        CS_LAGR_STAT_WEIGHT);
 
-      cs_lnum_t c_id = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_CELL_ID);
+        cs_real_t  prev_p_diam = cs_lagr_particle_get_real_n(particle, p_am, 1,
+                                                             CS_LAGR_DIAMETER);
+        cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1,
+                                                             CS_LAGR_MASS);
+        cs_real_t  p_mass = cs_lagr_particle_get_real(particle, p_am,
+                                                      CS_LAGR_MASS);
 
-      /* Volume and mass of particles in cell */
-      volp[c_id] += p_stat_w * cs_math_pi * pow(prev_p_diam, 3) / 6.0;
-      volm[c_id] += p_stat_w * prev_p_mass;
+        /* Volume and mass of particles in cell */
+        volp[c_id] += p_stat_w * cs_math_pi * pow(prev_p_diam, 3) / 6.0;
+        volm[c_id] += p_stat_w * prev_p_mass;
 
-      /* Momentum source term */
-      cs_real_t dvol = 0.;
-      if (has_dc * c_disable_flag[has_dc * c_id] == 0)
-        dvol = 1. / cell_f_vol[c_id];
+        /* Momentum source term */
+        cs_real_t dvol = 0.;
+        if (has_dc * c_disable_flag[has_dc * c_id] == 0)
+          dvol = 1. / cell_f_vol[c_id];
 
-      for (cs_lnum_t i = 0; i < 3; i++)
-        t_st_vel[c_id][i] -= dvol * auxl[p_id][i];
+        for (cs_lnum_t i = 0; i < 3; i++)
+          t_st_vel[c_id][i] -= dvol * auxl[p_id][i];
 
-      t_st_imp_vel[c_id] -= 2.0 * dvol * p_stat_w * p_mass / taup[p_id];
+        t_st_imp_vel[c_id] -= 2.0 * dvol * p_stat_w * p_mass / taup[p_id];
 
+      }
     }
 
   /* Turbulence source terms
@@ -337,29 +405,32 @@ cs_lagr_coupling(const cs_real_t    taup[],
 
       cs_array_real_fill_zero(n_cells_ext, t_st_k);
 
-      for (cs_lnum_t p_id = 0; p_id < nbpart; p_id++) {
+#     pragma omp parallel for if (ncel > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+        for (cs_lnum_t ii = c_p_idx[c_id]; ii < c_p_idx[c_id+1]; ii++) {
 
-        unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
+          cs_lnum_t p_id = c_p_ids[ii];
+
+          unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
 
-        cs_lnum_t  c_id         = cs_lagr_particle_get_lnum(particle, p_am,
-                                                           CS_LAGR_CELL_ID);
-        cs_real_t *prev_f_vel  =
-          (cs_real_t *)cs_lagr_particle_attr_n(particle, p_am, 1,
+          cs_real_t *prev_f_vel  =
+            (cs_real_t *)cs_lagr_particle_attr_n(particle, p_am, 1,
+                                                 CS_LAGR_VELOCITY_SEEN);
+          cs_real_t *f_vel       =
+            (cs_real_t *)cs_lagr_particle_attr(particle, p_am,
                                                CS_LAGR_VELOCITY_SEEN);
-        cs_real_t *f_vel       =
-          (cs_real_t *)cs_lagr_particle_attr(particle, p_am,
-                                             CS_LAGR_VELOCITY_SEEN);
 
-        cs_real_3_t vel_s =
-        { 0.5 * (prev_f_vel[0] + f_vel[0]),
-          0.5 * (prev_f_vel[1] + f_vel[1]),
-          0.5 * (prev_f_vel[2] + f_vel[2])};
+          cs_real_3_t vel_s =
+          { 0.5 * (prev_f_vel[0] + f_vel[0]),
+            0.5 * (prev_f_vel[1] + f_vel[1]),
+            0.5 * (prev_f_vel[2] + f_vel[2])};
 
-        cs_real_t dvol = 0.;
-        if (has_dc * c_disable_flag[has_dc * c_id] == 0)
-          dvol = 1. / cell_f_vol[c_id];
-        t_st_k[c_id] -= dvol * cs_math_3_dot_product(vel_s, auxl[p_id]);
+          cs_real_t dvol = 0.;
+          if (has_dc * c_disable_flag[has_dc * c_id] == 0)
+            dvol = 1. / cell_f_vol[c_id];
+          t_st_k[c_id] -= dvol * cs_math_3_dot_product(vel_s, auxl[p_id]);
 
+        }
       }
 
       for (cs_lnum_t c_id = 0; c_id < ncel; c_id++)
@@ -375,38 +446,40 @@ cs_lagr_coupling(const cs_real_t    taup[],
 
       cs_array_real_fill_zero(n_cells_ext * 6, (cs_real_t *)t_st_rij);
 
-      for (cs_lnum_t p_id = 0; p_id < nbpart; p_id++) {
+#     pragma omp parallel for if (ncel > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+        for (cs_lnum_t ii = c_p_idx[c_id]; ii < c_p_idx[c_id+1]; ii++) {
 
-        unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
+          cs_lnum_t p_id = c_p_ids[ii];
 
-        cs_lnum_t  c_id         = cs_lagr_particle_get_lnum(particle, p_am,
-                                                           CS_LAGR_CELL_ID);
+          unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
 
-        cs_real_t *prev_f_vel  =
-          (cs_real_t *)cs_lagr_particle_attr_n(particle, p_am, 1,
+          cs_real_t *prev_f_vel  =
+            (cs_real_t *)cs_lagr_particle_attr_n(particle, p_am, 1,
+                                                 CS_LAGR_VELOCITY_SEEN);
+          cs_real_t *f_vel       =
+            (cs_real_t *)cs_lagr_particle_attr(particle, p_am,
                                                CS_LAGR_VELOCITY_SEEN);
-        cs_real_t *f_vel       =
-          (cs_real_t *)cs_lagr_particle_attr(particle, p_am,
-                                             CS_LAGR_VELOCITY_SEEN);
 
-        cs_real_3_t vel_s =
-        { 0.5 * (prev_f_vel[0] + f_vel[0]),
-          0.5 * (prev_f_vel[1] + f_vel[1]),
-          0.5 * (prev_f_vel[2] + f_vel[2])};
+          cs_real_3_t vel_s =
+          { 0.5 * (prev_f_vel[0] + f_vel[0]),
+            0.5 * (prev_f_vel[1] + f_vel[1]),
+            0.5 * (prev_f_vel[2] + f_vel[2])};
 
-        cs_real_t dvol = 0.;
-        if (has_dc * c_disable_flag[has_dc * c_id] == 0)
-          dvol = 1. / cell_f_vol[c_id];
+          cs_real_t dvol = 0.;
+          if (has_dc * c_disable_flag[has_dc * c_id] == 0)
+            dvol = 1. / cell_f_vol[c_id];
 
-        for (cs_lnum_t ij = 0; ij < 6; ij++) {
-          cs_lnum_t i = _iv2t[ij];
-          cs_lnum_t j = _jv2t[ij];
+          for (cs_lnum_t ij = 0; ij < 6; ij++) {
+            cs_lnum_t i = _iv2t[ij];
+            cs_lnum_t j = _jv2t[ij];
 
-          t_st_rij[c_id][ij] -= ( vel_s[i] * auxl[p_id][j]
-                                + vel_s[j] * auxl[p_id][i])*dvol;
-        }
+            t_st_rij[c_id][ij] -= ( vel_s[i] * auxl[p_id][j]
+                                  + vel_s[j] * auxl[p_id][i])*dvol;
+          }
 
 
+        }
       }
       for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
         for (cs_lnum_t ij = 0; ij < 6; ij++) {
@@ -438,27 +511,29 @@ cs_lagr_coupling(const cs_real_t    taup[],
 
     cs_array_real_fill_zero(n_cells_ext, t_st_p);
 
-    for (cs_lnum_t p_id = 0; p_id < nbpart; p_id++) {
+#   pragma omp parallel for if (ncel > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+      for (cs_lnum_t ii = c_p_idx[c_id]; ii < c_p_idx[c_id+1]; ii++) {
 
-      unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
+        cs_lnum_t p_id = c_p_ids[ii];
 
-      cs_real_t  p_stat_w
-        = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
-      cs_real_t  prev_p_mass
-        = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
-      cs_real_t  p_mass
-        = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
+        unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
 
-      /* Fluid mass source term > 0 -> add mass to fluid */
-      cs_lnum_t c_id = cs_lagr_particle_get_lnum(particle, p_am,
-                                                    CS_LAGR_CELL_ID);
+        cs_real_t  p_stat_w
+          = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+        cs_real_t  prev_p_mass
+          = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
+        cs_real_t  p_mass
+          = cs_lagr_particle_get_real_n(particle, p_am, 0, CS_LAGR_MASS);
 
-      cs_real_t dvol = 0.;
-      if (has_dc * c_disable_flag[has_dc * c_id] == 0)
-        dvol = 1. / cell_f_vol[c_id];
+        /* Fluid mass source term > 0 -> add mass to fluid */
+        cs_real_t dvol = 0.;
+        if (has_dc * c_disable_flag[has_dc * c_id] == 0)
+          dvol = 1. / cell_f_vol[c_id];
 
-      t_st_p[c_id] += - p_stat_w * (p_mass - prev_p_mass) / dtp * dvol;
+        t_st_p[c_id] += - p_stat_w * (p_mass - prev_p_mass) / dtp * dvol;
 
+      }
     }
 
   }
@@ -483,49 +558,26 @@ cs_lagr_coupling(const cs_real_t    taup[],
       cs_array_real_fill_zero(n_cells_ext, t_st_t_e);
       cs_array_real_fill_zero(n_cells_ext, t_st_t_i);
 
-      for (cs_lnum_t p_id = 0; p_id < nbpart; p_id++) {
-
-        unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
-        cs_lnum_t  c_id = cs_lagr_particle_get_lnum(particle, p_am,
-                                                   CS_LAGR_CELL_ID);
-        cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0,
-                                                        CS_LAGR_MASS);
-        cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n(particle, p_am, 1,
-                                                             CS_LAGR_MASS);
-        cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0,
-                                                      CS_LAGR_CP);
-        cs_real_t  prev_p_cp = cs_lagr_particle_get_real_n(particle, p_am, 1,
-                                                           CS_LAGR_CP);
-        cs_real_t  p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 0,
-                                                       CS_LAGR_TEMPERATURE);
-        cs_real_t  prev_p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 1,
-                                                            CS_LAGR_TEMPERATURE);
-        cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am,
-                                                        CS_LAGR_STAT_WEIGHT);
-
-        cs_real_t dvol = 0.;
-        if (has_dc * c_disable_flag[has_dc * c_id] == 0)
-          dvol = 1. / cell_f_vol[c_id];
-
-        t_st_t_e[c_id] += - (p_mass * p_tmp * p_cp
-                            - prev_p_mass * prev_p_tmp * prev_p_cp
-                            ) / dtp * p_stat_w * dvol;
-        t_st_t_i[c_id] += tempct[nbpart + p_id] * p_stat_w; //FIXME not homogeneous
-
-      }
-      if (extra->radiative_model > 0) {
+#     pragma omp parallel for if (ncel > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+        for (cs_lnum_t ii = c_p_idx[c_id]; ii < c_p_idx[c_id+1]; ii++) {
 
-        for (cs_lnum_t p_id = 0; p_id < nbpart; p_id++) {
+          cs_lnum_t p_id = c_p_ids[ii];
 
           unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
-          cs_lnum_t  c_id = cs_lagr_particle_get_lnum(particle, p_am,
-                                                     CS_LAGR_CELL_ID);
-          cs_real_t  p_diam = cs_lagr_particle_get_real_n(particle, p_am, 0,
-                                                          CS_LAGR_DIAMETER);
-          cs_real_t  p_eps = cs_lagr_particle_get_real_n(particle, p_am, 0,
-                                                         CS_LAGR_EMISSIVITY);
+          cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0,
+                                                          CS_LAGR_MASS);
+          cs_real_t  prev_p_mass
+            = cs_lagr_particle_get_real_n(particle, p_am, 1, CS_LAGR_MASS);
+          cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0,
+                                                        CS_LAGR_CP);
+          cs_real_t  prev_p_cp = cs_lagr_particle_get_real_n(particle, p_am, 1,
+                                                             CS_LAGR_CP);
           cs_real_t  p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 0,
                                                          CS_LAGR_TEMPERATURE);
+          cs_real_t  prev_p_tmp
+            = cs_lagr_particle_get_real_n(particle, p_am, 1,
+                                          CS_LAGR_TEMPERATURE);
           cs_real_t  p_stat_w = cs_lagr_particle_get_real(particle, p_am,
                                                           CS_LAGR_STAT_WEIGHT);
 
@@ -533,12 +585,43 @@ cs_lagr_coupling(const cs_real_t    taup[],
           if (has_dc * c_disable_flag[has_dc * c_id] == 0)
             dvol = 1. / cell_f_vol[c_id];
 
-          cs_real_t aux1 = cs_math_pi * p_diam * p_diam * p_eps * dvol
-                          * (extra->rad_energy->val[c_id]
-                             - 4.0 * _c_stephan * cs_math_pow4(p_tmp));
+          t_st_t_e[c_id] += - (p_mass * p_tmp * p_cp
+                              - prev_p_mass * prev_p_tmp * prev_p_cp
+                              ) / dtp * p_stat_w * dvol;
+          //FIXME not homogeneous
+          t_st_t_i[c_id] += tempct[nbpart + p_id] * p_stat_w;
+
+        }
+      }
+      if (extra->radiative_model > 0) {
+
+#       pragma omp parallel for if (ncel > CS_THR_MIN)
+        for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+          for (cs_lnum_t ii = c_p_idx[c_id]; ii < c_p_idx[c_id+1]; ii++) {
+
+            cs_lnum_t p_id = c_p_ids[ii];
+
+            unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
+            cs_real_t  p_diam = cs_lagr_particle_get_real_n(particle, p_am, 0,
+                                                            CS_LAGR_DIAMETER);
+            cs_real_t  p_eps = cs_lagr_particle_get_real_n(particle, p_am, 0,
+                                                           CS_LAGR_EMISSIVITY);
+            cs_real_t  p_tmp = cs_lagr_particle_get_real_n(particle, p_am, 0,
+                                                           CS_LAGR_TEMPERATURE);
+            cs_real_t  p_stat_w
+              = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_STAT_WEIGHT);
+
+            cs_real_t dvol = 0.;
+            if (has_dc * c_disable_flag[has_dc * c_id] == 0)
+              dvol = 1. / cell_f_vol[c_id];
+
+            cs_real_t aux1 = cs_math_pi * p_diam * p_diam * p_eps * dvol
+                            * (extra->rad_energy->val[c_id]
+                               - 4.0 * _c_stephan * cs_math_pow4(p_tmp));
 
-          t_st_t_e[c_id] += aux1 * p_stat_w;
+            t_st_t_e[c_id] += aux1 * p_stat_w;
 
+          }
         }
 
       }
@@ -563,40 +646,42 @@ cs_lagr_coupling(const cs_real_t    taup[],
         cs_array_real_fill_zero(n_cells_ext, t_st_t_e);
         cs_array_real_fill_zero(n_cells_ext, t_st_t_i);
 
-        for (cs_lnum_t p_id = 0; p_id < nbpart; p_id++) {
-
-          unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
-
-          cs_lnum_t  c_id = cs_lagr_particle_get_lnum(particle, p_am,
-                                                     CS_LAGR_CELL_ID);
-
-          cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0,
-                                                          CS_LAGR_MASS);
-          cs_real_t  p_tmp = cs_lagr_particle_get_real(particle, p_am,
-                                                       CS_LAGR_TEMPERATURE);
-          cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0,
-                                                        CS_LAGR_CP);
-
-          cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n
-                                     (particle, p_am, 1, CS_LAGR_MASS);
-          cs_real_t  prev_p_tmp  = cs_lagr_particle_get_real_n
-                                     (particle, p_am, 1, CS_LAGR_TEMPERATURE);
-          cs_real_t  prev_p_cp   = cs_lagr_particle_get_real_n
-                                     (particle, p_am, 1, CS_LAGR_CP);
-
-          cs_real_t  p_stat_w = cs_lagr_particle_get_real
-                                  (particle, p_am, CS_LAGR_STAT_WEIGHT);
+#       pragma omp parallel for if (ncel > CS_THR_MIN)
+        for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+          for (cs_lnum_t ii = c_p_idx[c_id]; ii < c_p_idx[c_id+1]; ii++) {
 
-          cs_real_t dvol = 0.;
-          if (has_dc * c_disable_flag[has_dc * c_id] == 0)
-            dvol = 1. / cell_f_vol[c_id];
+            cs_lnum_t p_id = c_p_ids[ii];
 
-          t_st_t_e[c_id] += - (  p_mass * p_tmp * p_cp
-                              - prev_p_mass * prev_p_tmp * prev_p_cp
-                              ) / dtp * p_stat_w * dvol;
-          t_st_t_i[c_id] += p_stat_w * p_mass * p_cp * dvol
-                          / tempct[nbpart + p_id];
+            unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
 
+            cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0,
+                                                            CS_LAGR_MASS);
+            cs_real_t  p_tmp = cs_lagr_particle_get_real(particle, p_am,
+                                                         CS_LAGR_TEMPERATURE);
+            cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0,
+                                                          CS_LAGR_CP);
+
+            cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n
+                                       (particle, p_am, 1, CS_LAGR_MASS);
+            cs_real_t  prev_p_tmp  = cs_lagr_particle_get_real_n
+                                       (particle, p_am, 1, CS_LAGR_TEMPERATURE);
+            cs_real_t  prev_p_cp   = cs_lagr_particle_get_real_n
+                                       (particle, p_am, 1, CS_LAGR_CP);
+
+            cs_real_t  p_stat_w = cs_lagr_particle_get_real
+                                    (particle, p_am, CS_LAGR_STAT_WEIGHT);
+
+            cs_real_t dvol = 0.;
+            if (has_dc * c_disable_flag[has_dc * c_id] == 0)
+              dvol = 1. / cell_f_vol[c_id];
+
+            t_st_t_e[c_id] += - (  p_mass * p_tmp * p_cp
+                                - prev_p_mass * prev_p_tmp * prev_p_cp
+                                ) / dtp * p_stat_w * dvol;
+            t_st_t_i[c_id] += p_stat_w * p_mass * p_cp * dvol
+                            / tempct[nbpart + p_id];
+
+          }
         }
 
       }
@@ -616,40 +701,42 @@ cs_lagr_coupling(const cs_real_t    taup[],
       cs_array_real_fill_zero(n_cells_ext, t_st_t_e);
       cs_array_real_fill_zero(n_cells_ext, t_st_t_i);
 
-      for (cs_lnum_t p_id = 0; p_id < nbpart; p_id++) {
+#     pragma omp parallel for if (ncel > CS_THR_MIN)
+      for (cs_lnum_t c_id = 0; c_id < ncel; c_id++) {
+        for (cs_lnum_t ii = c_p_idx[c_id]; ii < c_p_idx[c_id+1]; ii++) {
 
-        unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
+          cs_lnum_t p_id = c_p_ids[ii];
 
-        cs_lnum_t  c_id = cs_lagr_particle_get_lnum(particle, p_am,
-                                                   CS_LAGR_CELL_ID);
+          unsigned char *particle = p_set->p_buffer + p_am->extents * p_id;
 
-        cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0,
-                                                        CS_LAGR_MASS);
-        cs_real_t  p_tmp = cs_lagr_particle_get_real(particle, p_am,
-                                                     CS_LAGR_TEMPERATURE);
-        cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0,
-                                                      CS_LAGR_CP);
+          cs_real_t  p_mass = cs_lagr_particle_get_real_n(particle, p_am, 0,
+                                                          CS_LAGR_MASS);
+          cs_real_t  p_tmp = cs_lagr_particle_get_real(particle, p_am,
+                                                       CS_LAGR_TEMPERATURE);
+          cs_real_t  p_cp = cs_lagr_particle_get_real_n(particle, p_am, 0,
+                                                        CS_LAGR_CP);
 
-        cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n
-                                   (particle, p_am, 1, CS_LAGR_MASS);
-        cs_real_t  prev_p_tmp  = cs_lagr_particle_get_real_n
-                                   (particle, p_am, 1, CS_LAGR_TEMPERATURE);
-        cs_real_t  prev_p_cp   = cs_lagr_particle_get_real_n
-                                   (particle, p_am, 1, CS_LAGR_CP);
+          cs_real_t  prev_p_mass = cs_lagr_particle_get_real_n
+                                     (particle, p_am, 1, CS_LAGR_MASS);
+          cs_real_t  prev_p_tmp  = cs_lagr_particle_get_real_n
+                                     (particle, p_am, 1, CS_LAGR_TEMPERATURE);
+          cs_real_t  prev_p_cp   = cs_lagr_particle_get_real_n
+                                     (particle, p_am, 1, CS_LAGR_CP);
 
-        cs_real_t  p_stat_w = cs_lagr_particle_get_real
-                                (particle, p_am, CS_LAGR_STAT_WEIGHT);
+          cs_real_t  p_stat_w = cs_lagr_particle_get_real
+                                  (particle, p_am, CS_LAGR_STAT_WEIGHT);
 
-        cs_real_t dvol = 0.;
-        if (has_dc * c_disable_flag[has_dc * c_id] == 0)
-          dvol = 1. / cell_f_vol[c_id];
+          cs_real_t dvol = 0.;
+          if (has_dc * c_disable_flag[has_dc * c_id] == 0)
+            dvol = 1. / cell_f_vol[c_id];
 
-        t_st_t_e[c_id] += - (  p_mass * p_tmp * p_cp
-                             - prev_p_mass * prev_p_tmp * prev_p_cp
-                             ) / dtp * p_stat_w * dvol;
-        t_st_t_i[c_id] += p_stat_w * p_mass * p_cp * dvol
-                          / tempct[nbpart + p_id];
+          t_st_t_e[c_id] += - (  p_mass * p_tmp * p_cp
+                               - prev_p_mass * prev_p_tmp * prev_p_cp
+                               ) / dtp * p_stat_w * dvol;
+          t_st_t_i[c_id] += p_stat_w * p_mass * p_cp * dvol
+                            / tempct[nbpart + p_id];
 
+        }
       }
 
     }
@@ -795,6 +882,9 @@ cs_lagr_coupling(const cs_real_t    taup[],
   if (t_st_t_i != st_t_i)
     BFT_FREE(t_st_t_i);
 
+  BFT_FREE(c_p_ids);
+  BFT_FREE(c_p_idx);
+
   BFT_FREE(volp);
   BFT_FREE(volm);
 
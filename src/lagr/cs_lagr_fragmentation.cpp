@@ -212,20 +212,24 @@ _find_class(cs_lnum_t  array[][2],
  * \param[in]  mass                    mass of the particles
  * \param[in]  agglo_max_weight                 maximum statistical weight that a
  *                                     particle can have
+ * \param[in]  interf                  sorted (class, index) array of
+ *                                     particles in cell
+ * \param[in]  cm                      map from class to new parcels
  */
 /*----------------------------------------------------------------------------*/
 
 static void
-_add_particle(cs_lnum_t   lnum_particles,
-              cs_lnum_t  *newpart,
-              cs_lnum_t   vp,
-              cs_lnum_t  *corr,
-              cs_lnum_t   frag_idx,
-              cs_lnum_t   newclass,
-              cs_real_t   minimum_particle_diam,
-              cs_real_t   mass,
-              cs_real_t   agglo_max_weight,
-              cs_lnum_t   interf[][2])
+_add_particle(cs_lnum_t                   lnum_particles,
+              cs_lnum_t                  *newpart,
+              cs_lnum_t                   vp,
+              cs_lnum_t                  *corr,
+              cs_lnum_t                   frag_idx,
+              cs_lnum_t                   newclass,
+              cs_real_t                   minimum_particle_diam,
+              cs_real_t                   mass,
+              cs_real_t                   agglo_max_weight,
+              cs_lnum_t                   interf[][2],
+              cs_lagr_agglo_class_map_t  *cm)
 {
   /* Get information on the new fragment*/
   cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
@@ -247,15 +251,13 @@ _add_particle(cs_lnum_t   lnum_particles,
 
   /* Add a new particle at the end of the set (otherwise)*/
   cs_lnum_t add_to_end = 1;
-  for (cs_lnum_t indx = p_set->n_particles;
-       indx < p_set->n_particles + *newpart;
-       indx++) {
-    int stat_class = cs_lagr_particles_get_lnum(p_set, indx,
-                                                CS_LAGR_AGGLO_CLASS_ID);
+  for (cs_lnum_t k = cs_lagr_agglo_class_map_first(cm, newclass);
+       k > -1;
+       k = cs_lagr_agglo_class_map_next(cm, k)) {
+    cs_lnum_t indx = p_set->n_particles + k;
     cs_real_t stat_weight = cs_lagr_particles_get_real(p_set, indx,
                                                        CS_LAGR_STAT_WEIGHT);
-    if ((stat_class == newclass)
-       && (stat_weight + vp <= agglo_max_weight)) {
+    if (stat_weight + vp <= agglo_max_weight) {
       long long int auxx = round(stat_weight);
       cs_lagr_particles_set_real(p_set, indx, CS_LAGR_STAT_WEIGHT, auxx+vp);
 
@@ -266,6 +268,7 @@ _add_particle(cs_lnum_t   lnum_particles,
 
   if (add_to_end) {
     (*newpart)++;
+    cs_lagr_agglo_class_map_add(cm, newclass);
     _insert_particles(*newpart, vp, corr, frag_idx, newclass,
                       minimum_particle_diam, mass);
   }
@@ -483,6 +486,9 @@ cs_lagr_fragmentation(cs_real_t  dt,
   cs_real_t cker = 0.;
   cker = cs_glob_lagr_fragmentation_model->scalar_kernel;
 
+  /* Map from class to parcels created in this cell */
+  cs_lagr_agglo_class_map_t *cm = cs_lagr_agglo_class_map_create();
+
   for (cs_lnum_t i = 0; i < lnum_particles; ++i) {
 
     if (cs_lagr_particles_get_flag(p_set, corr[i], CS_LAGR_PART_TO_DELETE))
@@ -524,21 +530,23 @@ cs_lagr_fragmentation(cs_real_t  dt,
 
           _add_particle(lnum_particles, &newpart, vp, corr, i, class_nb_1,
                         minimum_particle_diam, mass*class_nb_1/class_nb,
-                        agglo_max_weight, interf);
+                        agglo_max_weight, interf, cm);
           _add_particle(lnum_particles, &newpart, vp, corr, i, class_nb_2,
                         minimum_particle_diam, mass*class_nb_2/class_nb,
-                        agglo_max_weight, interf);
+                        agglo_max_weight, interf, cm);
         }
         else {
           cs_lnum_t class_nb_even = class_nb / 2;
           _add_particle(lnum_particles, &newpart, 2*vp, corr, i, class_nb_even,
                         minimum_particle_diam, mass*0.5, agglo_max_weight,
-                        interf);
+                        interf, cm);
         }
       }
     }
   }
 
+  cs_lagr_agglo_class_map_destroy(&cm);
+
   /* Local array to save new fragments (class, index) */
   cs_lnum_2_t *interf_frag;
   BFT_MALLOC(interf_frag, newpart, cs_lnum_2_t);
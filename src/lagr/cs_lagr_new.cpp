@@ -212,6 +212,7 @@ _face_sub_surfaces(cs_lnum_t        n_vertices,
  * \param[in]   acc_surf_r     accumulated surface ratio associated to
  *                             each edge (or negative edge lengths in
  *                             degenerate cases)
+ * \param[in]   r_u            uniformly distributed random values
  * \param[out]  coords         coordinates of point in face
  */
 /*----------------------------------------------------------------------------*/
@@ -222,15 +223,14 @@ _random_point_in_face(cs_lnum_t        n_vertices,
                       const cs_real_t  vertex_coords[][3],
                       const cs_real_t  face_center[3],
                       const cs_real_t  acc_surf_r[],
+                      const cs_real_t  r_u[3],
                       cs_real_t        coords[3])
 {
   cs_lnum_t tri_id = 0;
-  cs_real_t r[3];
+  cs_real_t r[3] = {r_u[0], r_u[1], r_u[2]};
 
   /* determine triangle to choose */
 
-  cs_random_uniform(3, r);
-
   if (r[2] > 1) /* account for possible ? rounding errors */
     r[2] = 1;
 
@@ -282,6 +282,29 @@ _random_point_in_face(cs_lnum_t        n_vertices,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Draw a key for counter-based random values of an injection call.
+ *
+ * The key is drawn from the main (rank-seeded) generator, so successive
+ * calls use independent streams, while values for a given element
+ * depend only on the key and that element's global number, not
+ * on the thread distribution.
+ *
+ * \return  counter-based generator key
+ */
+/*----------------------------------------------------------------------------*/
+
+static uint64_t
+_injection_random_key(void)
+{
+  cs_real_t r[2];
+  cs_random_uniform(2, r);
+
+  return   ((uint64_t)(r[0] * 4294967296.) << 32)
+         ^ (uint64_t)(r[1] * 4294967296.);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -313,11 +336,16 @@ cs_lagr_new(cs_lagr_particle_set_t  *particles,
   cs_mesh_t  *mesh = cs_glob_mesh;
   cs_mesh_quantities_t *fvq  = cs_glob_mesh_quantities;
 
-  cs_real_t  *acc_surf_r = NULL;
-  cs_lnum_t   n_vertices_max = 0;
+  const uint64_t r_key = _injection_random_key();
 
   /* Loop on faces */
 
+# pragma omp parallel if (n_faces > CS_THR_MIN)
+  {
+  cs_real_t  *acc_surf_r = NULL, *r_u = NULL;
+  cs_lnum_t   n_vertices_max = 0, n_r_max = 0;
+
+# pragma omp for schedule(dynamic, CS_CL_SIZE)
   for (cs_lnum_t li = 0; li < n_faces; li++) {
 
     cs_lnum_t n_f_p = face_particle_idx[li+1] - face_particle_idx[li];
@@ -340,6 +368,18 @@ cs_lagr_new(cs_lagr_particle_set_t  *particles,
       BFT_REALLOC(acc_surf_r, n_vertices_max, cs_real_t);
     }
 
+    /* random values for this face's particles, based on its global number */
+
+    if (n_f_p*3 > n_r_max) {
+      n_r_max = n_f_p*3;
+      BFT_REALLOC(r_u, n_r_max, cs_real_t);
+    }
+
+    cs_gnum_t f_g_num = (mesh->global_b_face_num != NULL) ?
+      mesh->global_b_face_num[face_id] : (cs_gnum_t)face_id + 1;
+
+    cs_random_counter_uniform(r_key, f_g_num, n_f_p*3, r_u);
+
     _face_sub_surfaces(n_vertices,
                        vertex_ids,
                        (const cs_real_3_t *)mesh->vtx_coord,
@@ -365,6 +405,7 @@ cs_lagr_new(cs_lagr_particle_set_t  *particles,
                             (const cs_real_3_t *)mesh->vtx_coord,
                             fvq->b_face_cog + 3*face_id,
                             acc_surf_r,
+                            r_u + 3*i,
                             part_coord);
 
       /* For safety, move particle slightly inside cell */
@@ -376,7 +417,9 @@ cs_lagr_new(cs_lagr_particle_set_t  *particles,
 
   }
 
+  BFT_FREE(r_u);
   BFT_FREE(acc_surf_r);
+  } /* end of OpenMP parallel section */
 }
 
 /*----------------------------------------------------------------------------*/
@@ -411,13 +454,19 @@ cs_lagr_new_v(cs_lagr_particle_set_t  *particles,
   if (ma->cell_i_faces == NULL)
     cs_mesh_adjacencies_update_cell_i_faces();
 
+  const uint64_t r_key = _injection_random_key();
+
+  /* Loop on cells */
+
+# pragma omp parallel if (n_cells > CS_THR_MIN)
+  {
   cs_lnum_t  *cell_subface_index = NULL;
   cs_real_t  *acc_vol_r = NULL;
   cs_real_t  *acc_surf_r = NULL;
-  cs_lnum_t  n_divisions_max = 0, n_faces_max = 0;
-
-  /* Loop on cells */
+  cs_real_t  *r_u = NULL;
+  cs_lnum_t  n_divisions_max = 0, n_faces_max = 0, n_r_max = 0;
 
+# pragma omp for schedule(dynamic, CS_CL_SIZE)
   for (cs_lnum_t li = 0; li < n_cells; li++) {
 
     cs_lnum_t n_c_p = cell_particle_idx[li+1] - cell_particle_idx[li];
@@ -554,6 +603,19 @@ cs_lagr_new_v(cs_lagr_particle_set_t  *particles,
       }
     }
 
+    /* random values for this cell's particles, based on its global number
+       (2 for cone and position along its axis, 3 for point in face) */
+
+    if (n_c_p*5 > n_r_max) {
+      n_r_max = n_c_p*5;
+      BFT_REALLOC(r_u, n_r_max, cs_real_t);
+    }
+
+    cs_gnum_t c_g_num = (mesh->global_cell_num != NULL) ?
+      mesh->global_cell_num[cell_id] : (cs_gnum_t)cell_id + 1;
+
+    cs_random_counter_uniform(r_key, c_g_num, n_c_p*5, r_u);
+
     /* distribute new particles */
 
     for (cs_lnum_t c_i = 0; c_i < n_c_p; c_i++) {
@@ -567,8 +629,7 @@ cs_lagr_new_v(cs_lagr_particle_set_t  *particles,
 
       /* search for matching center-to-face cone */
 
-      cs_real_t r[2];
-      cs_random_uniform(2, r);
+      const cs_real_t *r = r_u + 5*c_i;
 
       cs_lnum_t i = 0;
       while (i < n_cell_faces && r[0] > acc_vol_r[i])
@@ -612,6 +673,7 @@ cs_lagr_new_v(cs_lagr_particle_set_t  *particles,
                             (const cs_real_3_t *)mesh->vtx_coord,
                             face_cog,
                             acc_surf_r + cell_subface_index[i],
+                            r + 2,
                             part_coord);
 
       /* In regular case, place point on segment joining cell center and
@@ -639,9 +701,11 @@ cs_lagr_new_v(cs_lagr_particle_set_t  *particles,
 
   } /* end of loop on cells */
 
+  BFT_FREE(r_u);
   BFT_FREE(acc_surf_r);
   BFT_FREE(acc_vol_r);
   BFT_FREE(cell_subface_index);
+  } /* end of OpenMP parallel section */
 }
 
 /*----------------------------------------------------------------------------*/
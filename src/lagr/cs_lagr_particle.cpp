@@ -230,6 +230,10 @@ const char *cs_lagr_attribute_name[] = {
 
 static cs_lagr_attribute_map_t  *_p_attr_map = NULL;
 
+/* Particle attributes layout */
+
+static cs_lagr_particle_layout_t  _p_layout = CS_LAGR_PARTICLE_LAYOUT_DEFAULT;
+
 /* Particle set reallocation parameters */
 
 static  double              _reallocation_factor = 2.0;
@@ -268,6 +272,37 @@ _align_extents(size_t  size)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*
+ * Check if an attribute is placed in the leading ("hot") part of particle
+ * data with the CS_LAGR_PARTICLE_LAYOUT_HOT_FIRST layout.
+ *
+ * parameters:
+ *   attr <-- particle attribute
+ *
+ * returns:
+ *   true if the attribute is accessed in most time step loops
+ *----------------------------------------------------------------------------*/
+
+static bool
+_is_hot_attr(cs_lagr_attribute_t  attr)
+{
+  switch(attr) {
+  case CS_LAGR_P_FLAG:
+  case CS_LAGR_CELL_ID:
+  case CS_LAGR_RANK_ID:
+  case CS_LAGR_STAT_WEIGHT:
+  case CS_LAGR_RESIDENCE_TIME:
+  case CS_LAGR_MASS:
+  case CS_LAGR_DIAMETER:
+  case CS_LAGR_COORDS:
+  case CS_LAGR_VELOCITY:
+  case CS_LAGR_VELOCITY_SEEN:
+    return true;
+  default:
+    return false;
+  }
+}
+
 /*----------------------------------------------------------------------------*
  * Map particle attributes for a given configuration.
  *
@@ -344,85 +379,99 @@ _create_attr_map(cs_lnum_t attr_keys[CS_LAGR_N_ATTRIBUTES][3])
                             order,
                             CS_LAGR_N_ATTRIBUTES);
 
-  /* Loop on available times */
+  /* With the "hot first" layout, frequently accessed attributes are
+     mapped first (with their previous values), then the other attributes;
+     otherwise, all attributes are handled in a single pass. */
 
-  for (int time_id = 0; time_id < p_am->n_time_vals; time_id++) {
+  const int n_passes
+    = (_p_layout == CS_LAGR_PARTICLE_LAYOUT_HOT_FIRST) ? 2 : 1;
 
-    int array_prev = 0;
+  for (int pass_id = 0; pass_id < n_passes; pass_id++) {
 
-    /* Now loop on ordered attributes */
+    /* Loop on available times */
 
-    for (int i = 0; i < CS_LAGR_N_ATTRIBUTES; i++) {
+    for (int time_id = 0; time_id < p_am->n_time_vals; time_id++) {
 
-      cs_datatype_t datatype = CS_REAL_TYPE;
-      int min_time_id = 0;
-      int max_time_id = 0;
+      int array_prev = 0;
 
-      attr = static_cast<cs_lagr_attribute_t>(order[i]);
+      /* Now loop on ordered attributes */
 
-      if (time_id == 0)
-        p_am->datatype[attr] = CS_DATATYPE_NULL;
-      p_am->displ[time_id][attr] =-1;
-      p_am->count[time_id][attr] = 0;
-
-      if (attr_keys[attr][0] < 1) continue;
-
-      /*
-        ieptp/ieptpa integer values at current and previous time steps
-        pepa real values at current time step
-        ipepa integer values at current time step */
-
-      /* Behavior depending on array */
-
-      switch(attr_keys[attr][0]) {
-      case CS_LAGR_P_RVAR_TS:
-      case CS_LAGR_P_RVAR:
-        max_time_id = 1;
-        break;
-      case CS_LAGR_P_IVAR:
-        datatype = CS_LNUM_TYPE;
-        max_time_id = 1;
-        break;
-      case CS_LAGR_P_RPRP:
-        break;
-      case CS_LAGR_P_IPRP:
-        datatype = CS_LNUM_TYPE;
-        break;
-      case CS_LAGR_P_RKID:
-        datatype = CS_LNUM_TYPE;
-        min_time_id = 1;
-        max_time_id = 1;
-        break;
-      default:
-        continue;
-      }
+      for (int i = 0; i < CS_LAGR_N_ATTRIBUTES; i++) {
 
-      if (time_id < min_time_id || time_id > max_time_id)
-        continue;
+        cs_datatype_t datatype = CS_REAL_TYPE;
+        int min_time_id = 0;
+        int max_time_id = 0;
 
-      /* Add padding for alignment when changing array */
+        attr = static_cast<cs_lagr_attribute_t>(order[i]);
 
-      if (attr_keys[attr][0] != array_prev) {
-        p_am->extents = _align_extents(p_am->extents);
-        array_prev = attr_keys[attr][0];
-      }
+        if (n_passes > 1 && _is_hot_attr(attr) != (pass_id == 0))
+          continue;
+
+        if (time_id == 0)
+          p_am->datatype[attr] = CS_DATATYPE_NULL;
+        p_am->displ[time_id][attr] =-1;
+        p_am->count[time_id][attr] = 0;
+
+        if (attr_keys[attr][0] < 1) continue;
+
+        /*
+          ieptp/ieptpa integer values at current and previous time steps
+          pepa real values at current time step
+          ipepa integer values at current time step */
 
-      /* Add attribute to map */
+        /* Behavior depending on array */
+
+        switch(attr_keys[attr][0]) {
+        case CS_LAGR_P_RVAR_TS:
+        case CS_LAGR_P_RVAR:
+          max_time_id = 1;
+          break;
+        case CS_LAGR_P_IVAR:
+          datatype = CS_LNUM_TYPE;
+          max_time_id = 1;
+          break;
+        case CS_LAGR_P_RPRP:
+          break;
+        case CS_LAGR_P_IPRP:
+          datatype = CS_LNUM_TYPE;
+          break;
+        case CS_LAGR_P_RKID:
+          datatype = CS_LNUM_TYPE;
+          min_time_id = 1;
+          max_time_id = 1;
+          break;
+        default:
+          continue;
+        }
+
+        if (time_id < min_time_id || time_id > max_time_id)
+          continue;
+
+        /* Add padding for alignment when changing array */
+
+        if (attr_keys[attr][0] != array_prev) {
+          p_am->extents = _align_extents(p_am->extents);
+          array_prev = attr_keys[attr][0];
+        }
+
+        /* Add attribute to map */
+
+        p_am->displ[time_id][attr] = p_am->extents;
+        p_am->count[time_id][attr] = attr_keys[attr][2];
+        if (time_id == min_time_id) {
+          p_am->datatype[attr] = datatype;
+          p_am->size[attr] =   p_am->count[time_id][attr]
+                             * cs_datatype_size[p_am->datatype[attr]];
+        }
+
+        p_am->extents += p_am->size[attr];
 
-      p_am->displ[time_id][attr] = p_am->extents;
-      p_am->count[time_id][attr] = attr_keys[attr][2];
-      if (time_id == min_time_id) {
-        p_am->datatype[attr] = datatype;
-        p_am->size[attr] =   p_am->count[time_id][attr]
-                           * cs_datatype_size[p_am->datatype[attr]];
       }
 
-      p_am->extents += p_am->size[attr];
+      p_am->extents = _align_extents(p_am->extents);
 
     }
 
-    p_am->extents = _align_extents(p_am->extents);
-
   }
 
   /* Add source terms for 2nd order */
@@ -1229,6 +1278,70 @@ cs_lagr_particle_set_resize(cs_lnum_t  n_min_particles)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append copies of particles to a secondary particle set.
+ *
+ * The secondary set shares the source set's attribute map, and is created
+ * if needed (*dest == NULL), then resized as required. It may be used to
+ * buffer particle data (including previous time step values).
+ *
+ * \param[in, out]  dest           pointer to destination particle set
+ * \param[in]       src            source particle set
+ * \param[in]       n_particles    number of particles to copy
+ * \param[in]       particle_list  list of particles (1 to n numbering),
+ *                                 or NULL for the first n_particles
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_append(cs_lagr_particle_set_t        **dest,
+                            const cs_lagr_particle_set_t   *src,
+                            cs_lnum_t                       n_particles,
+                            const cs_lnum_t                 particle_list[])
+{
+  assert(src != NULL);
+
+  if (*dest == NULL)
+    *dest = _create_particle_set(CS_MAX(n_particles, 1), src->p_am);
+
+  cs_lagr_particle_set_t *_dest = *dest;
+  assert(_dest->p_am == src->p_am);
+
+  const size_t extents = src->p_am->extents;
+
+  _particle_set_resize(_dest, _dest->n_particles + n_particles);
+
+  unsigned char *d_buf = _dest->p_buffer + _dest->n_particles*extents;
+
+  if (particle_list == NULL)
+    memcpy(d_buf, src->p_buffer, n_particles*extents);
+  else {
+    for (cs_lnum_t i = 0; i < n_particles; i++)
+      memcpy(d_buf + i*extents,
+             src->p_buffer + (particle_list[i] - 1)*extents,
+             extents);
+  }
+
+  _dest->n_particles += n_particles;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a secondary particle set built by
+ *        \ref cs_lagr_particle_set_append.
+ *
+ * \param[in, out]  set  pointer to particle set pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_destroy(cs_lagr_particle_set_t  **set)
+{
+  if (*set != NULL)
+    _destroy_particle_set(set);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set reallocation factor for particle sets.
@@ -1339,6 +1452,24 @@ cs_lagr_particle_set_dump(const cs_lagr_particle_set_t  *particles)
   bft_printf_flush();
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select the layout of attributes in particle data.
+ *
+ * This must be called before \ref cs_lagr_particle_attr_initialize
+ * to be taken into account. Particle accessors are independent of
+ * the layout.
+ *
+ * \param[in]  layout  particle attribute layout
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_layout(cs_lagr_particle_layout_t  layout)
+{
+  _p_layout = layout;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set number of user particle variables.
@@ -183,6 +183,23 @@ typedef enum {
 
 } cs_lagr_attribute_t;
 
+/*! Particle attribute layout */
+/* -------------------------- */
+
+typedef enum {
+
+  CS_LAGR_PARTICLE_LAYOUT_DEFAULT,    /*!< attributes grouped by category,
+                                           all current values first */
+  CS_LAGR_PARTICLE_LAYOUT_HOT_FIRST   /*!< attributes accessed in most
+                                           time step loops (position,
+                                           velocities, cell, flags, mass,
+                                           diameter, weight) grouped with
+                                           their previous values at the
+                                           start of each particle, so that
+                                           they share fewer cache lines */
+
+} cs_lagr_particle_layout_t;
+
 /*! Particle attribute structure mapping */
 /* ------------------------------------- */
 
@@ -277,6 +294,21 @@ extern cs_lagr_particle_set_t  *cs_glob_lagr_particle_set;
 void
 cs_lagr_particle_attr_initialize(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Select the layout of attributes in particle data.
+ *
+ * This must be called before \ref cs_lagr_particle_attr_initialize
+ * to be taken into account. Particle accessors are independent of
+ * the layout.
+ *
+ * \param[in]  layout  particle attribute layout
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_layout(cs_lagr_particle_layout_t  layout);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Return const pointer to the main particle attribute map structure.
@@ -1408,6 +1440,40 @@ cs_lagr_particle_source_term_const(void                           *particle,
 int
 cs_lagr_particle_set_resize(cs_lnum_t  n_min_particles);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Append copies of particles to a secondary particle set.
+ *
+ * The secondary set shares the source set's attribute map, and is created
+ * if needed (*dest == NULL), then resized as required. It may be used to
+ * buffer particle data (including previous time step values).
+ *
+ * \param[in, out]  dest           pointer to destination particle set
+ * \param[in]       src            source particle set
+ * \param[in]       n_particles    number of particles to copy
+ * \param[in]       particle_list  list of particles (1 to n numbering),
+ *                                 or NULL for the first n_particles
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_append(cs_lagr_particle_set_t        **dest,
+                            const cs_lagr_particle_set_t   *src,
+                            cs_lnum_t                       n_particles,
+                            const cs_lnum_t                 particle_list[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Destroy a secondary particle set built by
+ *        \ref cs_lagr_particle_set_append.
+ *
+ * \param[in, out]  set  pointer to particle set pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_lagr_particle_set_destroy(cs_lagr_particle_set_t  **set);
+
 /*----------------------------------------------------------------------------
  * Set reallocation factor for particle sets.
  *
@@ -202,7 +202,19 @@ cs_lagr_resuspension(void)
   if (cs_glob_thermal_model->temperature_scale == CS_TEMPERATURE_SCALE_CELSIUS)
     xmtk = cs_physical_constants_celsius_to_kelvin;
 
-  for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
+  /* Only particles near a wall or interacting with a face are concerned;
+     when that list is not available, loop on all particles */
+
+  cs_lnum_t n_nw_particles = 0;
+  const cs_lnum_t *nw_particle_ids
+    = cs_lagr_tracking_near_wall_particles(&n_nw_particles);
+
+  cs_lnum_t n_loop = (nw_particle_ids != NULL) ?
+    n_nw_particles : p_set->n_particles;
+
+  for (cs_lnum_t jp = 0; jp < n_loop; jp++) {
+
+    cs_lnum_t ip = (nw_particle_ids != NULL) ? nw_particle_ids[jp] : jp;
 
     unsigned char *part = p_set->p_buffer + p_am->extents * ip;
     cs_lnum_t face_id
@@ -252,6 +252,18 @@ typedef struct {
  * Local structure definitions
  *============================================================================*/
 
+/* Particle-based moment update helper structure */
+
+typedef struct {
+
+  const cs_lagr_moment_t  *mt;        /* Associated moment */
+  cs_lagr_attribute_t      attr_id;   /* Associated attribute id */
+  cs_real_t               *val;       /* Moment values */
+  cs_real_t               *mean_val;  /* Associated mean values
+                                         (for variances), or NULL */
+
+} cs_lagr_moment_p_update_t;
+
 /*=============================================================================
  * Local Enumeration definitions
  *============================================================================*/
@@ -2814,6 +2826,307 @@ _location_attr(int location_id)
   return location_attr;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the cell -> particles index of a particle set, if the set
+ *        is sorted by cell and threading may be used.
+ *
+ * \param[in]  p_set  pointer to particle set
+ *
+ * \return  pointer to cell -> particles index, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+static const cs_lnum_t *
+_sorted_cell_particle_index(const cs_lagr_particle_set_t  *p_set)
+{
+  if (cs_glob_n_threads < 2 || p_set != cs_glob_lagr_particle_set)
+    return NULL;
+
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+  const cs_lnum_t *cell_idx = cs_lagr_tracking_cell_particle_index();
+
+  if (cell_idx == NULL)
+    return NULL;
+  if (cell_idx[n_cells] != p_set->n_particles)
+    return NULL;
+
+  /* Check that cell ids were not modified since the index was built */
+
+  const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+  int n_moved = 0;
+
+# pragma omp parallel for reduction(+:n_moved) if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (cs_lnum_t p_id = cell_idx[c_id]; p_id < cell_idx[c_id+1]; p_id++) {
+      const unsigned char *particle = p_set->p_buffer + p_am->extents*p_id;
+      if (cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_CELL_ID) != c_id)
+        n_moved += 1;
+    }
+  }
+
+  if (n_moved > 0)
+    return NULL;
+
+  return cell_idx;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update a set of particle-based moments sharing a weight
+ *        accumulator and class, for a given range of particles.
+ *
+ * Particles are handled in order, so that the update of each moment
+ * matches that of a separate pass on particles for that moment.
+ *
+ * \param[in]       p_set      pointer to particle set
+ * \param[in]       mwa        pointer to weight accumulator
+ * \param[in]       class_id   statistical class id
+ * \param[in]       n_moments  number of moments
+ * \param[in]       moments    moment update helpers
+ * \param[in]       dt_val     time step values
+ * \param[in]       dt_mult    time step multiplier (0 or 1)
+ * \param[in]       p_range    start and past-the-end particle ids
+ * \param[in, out]  pval_buf   work buffer for computed particle values
+ * \param[in, out]  l_wa_sum   current weight sum
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_update_particle_moments_range(const cs_lagr_particle_set_t     *p_set,
+                               const cs_lagr_moment_wa_t        *mwa,
+                               int                               class_id,
+                               int                               n_moments,
+                               const cs_lagr_moment_p_update_t   moments[],
+                               const cs_real_t                   dt_val[],
+                               cs_lnum_t                         dt_mult,
+                               const cs_lnum_t                   p_range[2],
+                               cs_real_t                        *pval_buf,
+                               cs_real_t              *restrict  l_wa_sum)
+{
+  const cs_lagr_attribute_map_t *p_am = p_set->p_am;
+
+  for (cs_lnum_t part = p_range[0]; part < p_range[1]; part++) {
+
+    unsigned char *particle = p_set->p_buffer + p_am->extents * part;
+
+    cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_am,
+                                                  CS_LAGR_CELL_ID);
+
+    int p_class = 0;
+    if (p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
+      p_class = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_STAT_CLASS);
+
+    if (cell_id < 0 || (p_class != class_id && class_id != 0))
+      continue;
+
+    /* weight associated to current particle */
+
+    cs_real_t p_weight;
+
+    if (mwa->p_data_func == NULL)
+      p_weight = cs_lagr_particle_get_real(particle, p_am,
+                                           CS_LAGR_STAT_WEIGHT);
+    else
+      mwa->p_data_func(mwa->data_input, particle, p_am, &p_weight);
+    p_weight *= dt_val[cell_id*dt_mult];
+
+    /* update weight sum with new particle weight */
+    const cs_real_t wa_sum_n = CS_MAX(p_weight + l_wa_sum[cell_id], 1e-100);
+
+    cs_real_t *pval_m = pval_buf;
+
+    for (int m_id = 0; m_id < n_moments; m_id++) {
+
+      const cs_lagr_moment_t *mt = moments[m_id].mt;
+      cs_real_t *restrict val = moments[m_id].val;
+      cs_real_t *restrict mean_val = moments[m_id].mean_val;
+
+      cs_real_t *pval;
+      if (mt->p_data_func == NULL)
+        pval = cs_lagr_particle_attr_get_ptr<cs_real_t>(particle, p_am,
+                                                        moments[m_id].attr_id);
+      else {
+        pval = pval_m;
+        mt->p_data_func(mt->data_input, particle, p_am, pval);
+        pval_m += mt->data_dim;
+      }
+
+      if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
+
+        if (mt->dim == 6) { /* variance-covariance matrix */
+
+          assert(mt->data_dim == 3);
+
+          double delta[3], delta_n[3], r[3], m_n[3];
+
+          for (int l = 0; l < 3; l++) {
+
+            cs_lnum_t jl = cell_id*6 + l;
+            cs_lnum_t jml = cell_id*3 + l;
+            delta[l]   = pval[l] - mean_val[jml];
+            r[l] = delta[l] * (p_weight / wa_sum_n);
+            m_n[l] = mean_val[jml] + r[l];
+            delta_n[l] = pval[l] - m_n[l];
+            val[jl] = (  val[jl]*l_wa_sum[cell_id]
+                       + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
+
+          }
+
+          /* Covariance terms.
+             Note we could have a symmetric formula using
+             0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
+             instead of
+             delta[i]*delta_n[j]
+             but unit tests in cs_moment_test.c do not seem to favor
+             one variant over the other; we use the simplest one.  */
+
+          cs_lnum_t j3 = cell_id*6 + 3,
+                    j4 = cell_id*6 + 4,
+                    j5 = cell_id*6 + 5;
+
+          val[j3] = (  val[j3]*l_wa_sum[cell_id]
+                     + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
+          val[j4] = (  val[j4]*l_wa_sum[cell_id]
+                     + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
+          val[j5] = (  val[j5]*l_wa_sum[cell_id]
+                     + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
+
+          /* update mean value */
+
+          for (cs_lnum_t l = 0; l < 3; l++)
+            mean_val[cell_id*3 + l] += r[l];
+
+        }
+
+        else { /* simple variance */
+
+          /* new weight for the cell: weight attached to
+             current particle (=dt*weight) plus old weight */
+
+          const cs_lnum_t dim = mt->dim;
+
+          for (cs_lnum_t l = 0; l < dim; l++) {
+
+            double delta = pval[l] - mean_val[cell_id*dim+l];
+            double r = delta * (p_weight / wa_sum_n);
+            double m_n = mean_val[cell_id*dim+l] + r;
+
+            val[cell_id*dim+l]
+              = (  val[cell_id*dim+l]*l_wa_sum[cell_id]
+                 + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
+
+            /* update mean value */
+
+            mean_val[cell_id*dim+l] += r;
+
+          }
+
+        }
+
+      }
+
+      else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
+
+        const cs_lnum_t dim = mt->dim;
+
+        for (cs_lnum_t l = 0; l < dim; l++)
+          val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
+                                * p_weight / wa_sum_n;
+
+      } /* End of test if moment is a variance or a mean */
+
+    } /* End of loop on moments */
+
+    /* update local weight associated to current accumulator and class */
+
+    l_wa_sum[cell_id] += p_weight;
+
+  } /* end of loop on particles */
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Update a set of particle-based moments sharing a weight
+ *        accumulator and class, in a single pass on particles.
+ *
+ * If particles are sorted by cell, cells are handled in parallel; as
+ * each cell's particles are still handled in order, results do not
+ * depend on the number of threads.
+ *
+ * \param[in]       p_set      pointer to particle set
+ * \param[in]       cell_idx   cell -> particles index if particles are
+ *                             sorted by cell, or NULL
+ * \param[in]       mwa        pointer to weight accumulator
+ * \param[in]       class_id   statistical class id
+ * \param[in]       n_moments  number of moments
+ * \param[in]       moments    moment update helpers
+ * \param[in]       dt_val     time step values
+ * \param[in]       dt_mult    time step multiplier (0 or 1)
+ * \param[in, out]  l_wa_sum   current weight sum
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_update_particle_moments(const cs_lagr_particle_set_t     *p_set,
+                         const cs_lnum_t                   cell_idx[],
+                         const cs_lagr_moment_wa_t        *mwa,
+                         int                               class_id,
+                         int                               n_moments,
+                         const cs_lagr_moment_p_update_t   moments[],
+                         const cs_real_t                   dt_val[],
+                         cs_lnum_t                         dt_mult,
+                         cs_real_t                        *l_wa_sum)
+{
+  int pval_size = 0;
+  for (int m_id = 0; m_id < n_moments; m_id++) {
+    if (moments[m_id].mt->p_data_func != NULL)
+      pval_size += moments[m_id].mt->data_dim;
+  }
+
+  if (   cell_idx != NULL
+      && cs_mesh_location_get_type(mwa->location_id)
+         == CS_MESH_LOCATION_CELLS) {
+
+    const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+#   pragma omp parallel if (n_cells > CS_THR_MIN)
+    {
+      cs_real_t *pval_buf = NULL;
+      if (pval_size > 0)
+        BFT_MALLOC(pval_buf, pval_size, cs_real_t);
+
+#     pragma omp for schedule(dynamic, CS_CL_SIZE)
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+        const cs_lnum_t p_range[2] = {cell_idx[c_id], cell_idx[c_id+1]};
+        _update_particle_moments_range(p_set, mwa, class_id,
+                                       n_moments, moments,
+                                       dt_val, dt_mult, p_range,
+                                       pval_buf, l_wa_sum);
+      }
+
+      BFT_FREE(pval_buf);
+    }
+
+  }
+
+  else {
+
+    cs_real_t *pval_buf = NULL;
+    if (pval_size > 0)
+      BFT_MALLOC(pval_buf, pval_size, cs_real_t);
+
+    const cs_lnum_t p_range[2] = {0, p_set->n_particles};
+    _update_particle_moments_range(p_set, mwa, class_id,
+                                   n_moments, moments,
+                                   dt_val, dt_mult, p_range,
+                                   pval_buf, l_wa_sum);
+
+    BFT_FREE(pval_buf);
+
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Update all particle-based moment and time moment accumulators.
@@ -2828,6 +3141,10 @@ _cs_lagr_stat_update_all(void)
   const cs_real_t *dt_val = _dt_val();
   cs_lnum_t dt_mult = (cs_glob_time_step->is_local) ? 1 : 0;
 
+  /* Particles may be handled by cell if sorted */
+
+  const cs_lnum_t *cell_idx = _sorted_cell_particle_index(p_set);
+
   /* First, update mesh-based statistics */
 
   _cs_lagr_stat_update_mesh_stats(ts);
@@ -2862,7 +3179,13 @@ _cs_lagr_stat_update_all(void)
     cs_real_t m_w0[1];
     cs_real_t *restrict m_weight = _compute_current_weight_m(mwa, dt_val, m_w0);
 
-    /* Loop on variances first, then means */
+    /* Loop on variances first, then means.
+       Mesh-based moments are updated directly, while particle-based
+       moments are gathered so as to be updated in a single pass
+       on particles */
+
+    int n_p_moments = 0;
+    cs_lagr_moment_p_update_t *p_moments = NULL;
 
     for (int m_type = CS_LAGR_MOMENT_VARIANCE;
          m_type >= (int)CS_LAGR_MOMENT_MEAN;
@@ -2878,189 +3201,45 @@ _cs_lagr_stat_update_all(void)
             && mwa->nt_start <= ts->nt_cur
             && mt->nt_cur < ts->nt_cur) {
 
-          cs_lagr_attribute_t attr_id =
-            (cs_lagr_attribute_t) cs_lagr_stat_type_to_attr_id(mt->stat_type);
-
           _ensure_init_moment(mt);
 
-          /* Copy weight sum content to a local array
-             for every new moment inside the current class */
+          /* Copy weight sum content to a local array */
 
-          if (m_weight == NULL && l_wa_sum == NULL)
+          if (m_weight == NULL && l_wa_sum == NULL) {
             BFT_MALLOC(l_wa_sum, n_w_elts, cs_real_t);
-
-          for (cs_lnum_t j = 0; j < n_w_elts; j++)
-            l_wa_sum[j] = g_wa_sum[j];
+            for (cs_lnum_t j = 0; j < n_w_elts; j++)
+              l_wa_sum[j] = g_wa_sum[j];
+          }
 
           /* Case where data is particle-based */
           /*-----------------------------------*/
 
           if (mt->m_data_func == NULL) {
 
-            cs_field_t *f = cs_field_by_id(mt->f_id);
-            cs_real_t *restrict val = f->val;
+            if (p_moments == NULL)
+              BFT_MALLOC(p_moments, _n_lagr_moments,
+                         cs_lagr_moment_p_update_t);
 
-            /* prepare submoment definition */
+            cs_lagr_moment_p_update_t *pm = p_moments + n_p_moments;
+            n_p_moments += 1;
 
-            cs_lagr_moment_t *mt_mean = NULL;
-            cs_real_t *restrict mean_val = NULL;
+            pm->mt = mt;
+            pm->attr_id = (cs_lagr_attribute_t)
+                            cs_lagr_stat_type_to_attr_id(mt->stat_type);
+            pm->val = cs_field_by_id(mt->f_id)->val;
+            pm->mean_val = NULL;
 
-            /* Check if lower moment is defined and attached */
+            /* Lower moment is updated with the variance */
 
             if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
               assert(mt->l_id > -1);
-              mt_mean = _lagr_moments + mt->l_id;
+              cs_lagr_moment_t *mt_mean = _lagr_moments + mt->l_id;
               _ensure_init_moment(mt_mean);
-
-              cs_field_t *f_mean = cs_field_by_id(mt_mean->f_id);
-              mean_val = f_mean->val;
+              pm->mean_val = cs_field_by_id(mt_mean->f_id)->val;
+              mt_mean->nt_cur = ts->nt_cur;
             }
 
-            cs_real_t *pval = NULL;
-            if (mt->p_data_func != NULL)
-              BFT_MALLOC(pval, mt->data_dim, cs_real_t);
-
-            for (cs_lnum_t part = 0; part < p_set->n_particles; part++) {
-
-              unsigned char *particle
-                = p_set->p_buffer + p_set->p_am->extents * part;
-
-              cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_set->p_am,
-                                                            CS_LAGR_CELL_ID);
-
-              int p_class = 0;
-              if (p_set->p_am->displ[0][CS_LAGR_STAT_CLASS] > 0)
-                p_class = cs_lagr_particle_get_lnum(particle,
-                                                    p_set->p_am,
-                                                    CS_LAGR_STAT_CLASS);
-
-              if (cell_id >= 0 && (p_class == mt->class_id || mt->class_id == 0)) {
-
-                /* weight associated to current particle */
-
-                cs_real_t p_weight;
-
-                if (mwa->p_data_func == NULL)
-                  p_weight = cs_lagr_particle_get_real(particle,
-                                                       p_set->p_am,
-                                                       CS_LAGR_STAT_WEIGHT);
-                else
-                  mwa->p_data_func(mwa->data_input,
-                                   particle,
-                                   p_set->p_am,
-                                   &p_weight);
-                p_weight *= dt_val[cell_id*dt_mult];
-
-                if (mt->p_data_func == NULL)
-                  pval = cs_lagr_particle_attr_get_ptr<cs_real_t>(particle,
-                                                                  p_set->p_am,
-                                                                  attr_id);
-                else
-                  mt->p_data_func(mt->data_input, particle, p_set->p_am, pval);
-
-                /* update weight sum with new particle weight */
-                const cs_real_t wa_sum_n = CS_MAX(p_weight + l_wa_sum[cell_id],
-                                                  1e-100);
-
-                if (mt->m_type == CS_LAGR_MOMENT_VARIANCE) {
-
-                  if (mt->dim == 6) { /* variance-covariance matrix */
-
-                    assert(mt->data_dim == 3);
-
-                    double delta[3], delta_n[3], r[3], m_n[3];
-
-                    for (int l = 0; l < 3; l++) {
-
-                      cs_lnum_t jl = cell_id*6 + l;
-                      cs_lnum_t jml = cell_id*3 + l;
-                      delta[l]   = pval[l] - mean_val[jml];
-                      r[l] = delta[l] * (p_weight / wa_sum_n);
-                      m_n[l] = mean_val[jml] + r[l];
-                      delta_n[l] = pval[l] - m_n[l];
-                      val[jl] = (  val[jl]*l_wa_sum[cell_id]
-                                 + p_weight*delta[l]*delta_n[l]) / wa_sum_n;
-
-                    }
-
-                    /* Covariance terms.
-                       Note we could have a symmetric formula using
-                       0.5*(delta[i]*delta_n[j] + delta[j]*delta_n[i])
-                       instead of
-                       delta[i]*delta_n[j]
-                       but unit tests in cs_moment_test.c do not seem to favor
-                       one variant over the other; we use the simplest one.  */
-
-                    cs_lnum_t j3 = cell_id*6 + 3,
-                              j4 = cell_id*6 + 4,
-                              j5 = cell_id*6 + 5;
-
-                    val[j3] = (  val[j3]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[1]) / wa_sum_n;
-                    val[j4] = (  val[j4]*l_wa_sum[cell_id]
-                               + p_weight*delta[1]*delta_n[2]) / wa_sum_n;
-                    val[j5] = (  val[j5]*l_wa_sum[cell_id]
-                               + p_weight*delta[0]*delta_n[2]) / wa_sum_n;
-
-                    /* update mean value */
-
-                    for (cs_lnum_t l = 0; l < 3; l++)
-                      mean_val[cell_id*3 + l] += r[l];
-
-                  }
-
-                  else { /* simple variance */
-
-                    /* new weight for the cell: weight attached to
-                       current particle (=dt*weight) plus old weight */
-
-                    const cs_lnum_t dim = mt->dim;
-
-                    for (cs_lnum_t l = 0; l < dim; l++) {
-
-                      double delta = pval[l] - mean_val[cell_id*dim+l];
-                      double r = delta * (p_weight / wa_sum_n);
-                      double m_n = mean_val[cell_id*dim+l] + r;
-
-                      val[cell_id*dim+l]
-                        = (  val[cell_id*dim+l]*l_wa_sum[cell_id]
-                           + (p_weight*delta*(pval[l]-m_n))) / wa_sum_n;
-
-                      /* update mean value */
-
-                      mean_val[cell_id*dim+l] += r;
-
-                    }
-
-                  }
-
-                }
-
-                else if (mt->m_type == CS_LAGR_MOMENT_MEAN) {
-
-                  const cs_lnum_t dim = mt->dim;
-
-                  for (cs_lnum_t l = 0; l < dim; l++)
-                    val[cell_id*dim+l] +=   (pval[l] - val[cell_id*dim+l])
-                                          * p_weight / wa_sum_n;
-
-                } /* End of test if moment is a variance or a mean */
-
-                /* update local weight associated to current moment and class */
-
-                l_wa_sum[cell_id] += p_weight;
-
-              } /* End of test if particle is in a cell
-                   and if particle class corresponds to moment class */
-
-            } /* end of loop on particles */
-
-            if (mt->p_data_func != NULL)
-              BFT_FREE(pval);
-
             mt->nt_cur = ts->nt_cur;
-            if (mt->m_type == CS_LAGR_MOMENT_VARIANCE)
-              mt_mean->nt_cur = ts->nt_cur;
           }
 
           /* Case where data is mesh-based */
@@ -3078,6 +3257,44 @@ _cs_lagr_stat_update_all(void)
 
     } /* End of loop on moments */
 
+    /* Single pass on particles for each class of particle-based moments */
+
+    int s_id = 0;
+    while (s_id < n_p_moments) {
+
+      const int class_id = p_moments[s_id].mt->class_id;
+
+      int e_id = s_id + 1;
+      for (int j = e_id; j < n_p_moments; j++) {
+        if (p_moments[j].mt->class_id == class_id) {
+          cs_lagr_moment_p_update_t tmp = p_moments[e_id];
+          p_moments[e_id] = p_moments[j];
+          p_moments[j] = tmp;
+          e_id++;
+        }
+      }
+
+      /* Each class pass starts from the accumulated weight */
+
+      for (cs_lnum_t j = 0; j < n_w_elts; j++)
+        l_wa_sum[j] = g_wa_sum[j];
+
+      _update_particle_moments(p_set,
+                               cell_idx,
+                               mwa,
+                               class_id,
+                               e_id - s_id,
+                               p_moments + s_id,
+                               dt_val,
+                               dt_mult,
+                               l_wa_sum);
+
+      s_id = e_id;
+
+    }
+
+    BFT_FREE(p_moments);
+
     /* At end of loop on moments inside a class, update
        global class weight array */
 
@@ -70,6 +70,7 @@
 #include "cs_random.h"
 #include "cs_rotation.h"
 #include "cs_search.h"
+#include "cs_time_step.h"
 #include "cs_timer_stats.h"
 #include "cs_turbomachinery.h"
 
@@ -157,6 +158,21 @@ typedef struct {
 
 } face_yplus_t;
 
+/* Deposition-type boundary faces adjacent to each cell */
+/* ----------------------------------------------------- */
+
+typedef struct {
+
+  int           nt;           /* time step at which data was built */
+  cs_lnum_t     n_cells;      /* number of cells */
+
+  cs_lnum_t    *idx;          /* cell -> wall faces index (size n_cells+1) */
+  cs_lnum_t    *face_id;      /* wall face ids */
+  cs_real_3_t  *normal;       /* wall face unit normals */
+  cs_real_3_t  *cog;          /* wall face centers */
+
+} cs_lagr_wall_cell_faces_t;
+
 /* Manage the exchange of particles between communicating ranks */
 /* -------------------------------------------------------------*/
 
@@ -216,6 +232,20 @@ static  cs_lagr_track_builder_t  *_particle_track_builder = NULL;
 
 static  int            _max_propagation_loops = 100;
 
+/* Cell -> particles index, valid after the last full displacement */
+
+static  cs_lnum_t     *_cell_particle_idx = NULL;
+
+/* Wall faces adjacent to each cell, for the deposition model */
+
+static  cs_lagr_wall_cell_faces_t  *_wall_cell_faces = NULL;
+
+/* Particles near a wall or interacting with a face, valid after the
+   last full displacement */
+
+static  cs_lnum_t      _n_near_wall_particles = -1;
+static  cs_lnum_t     *_near_wall_particle_ids = NULL;
+
 /* MPI datatype associated to each particle "structure" */
 
 #if defined(HAVE_MPI)
@@ -230,6 +260,153 @@ static  MPI_Datatype  _cs_mpi_particle_type;
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Free wall faces adjacent to cells.
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_wall_cell_faces(void)
+{
+  if (_wall_cell_faces == NULL)
+    return;
+
+  BFT_FREE(_wall_cell_faces->idx);
+  BFT_FREE(_wall_cell_faces->face_id);
+  BFT_FREE(_wall_cell_faces->normal);
+  BFT_FREE(_wall_cell_faces->cog);
+
+  BFT_FREE(_wall_cell_faces);
+}
+
+/*----------------------------------------------------------------------------
+ * Return deposition-type boundary faces adjacent to each cell.
+ *
+ * Face unit normals and centers are precomputed, so that the wall
+ * distance test only loops on the relevant faces. This data is rebuilt
+ * once per time step, as boundary conditions or mesh quantities
+ * may change from one time step to the next.
+ *
+ * returns:
+ *   pointer to wall faces by cell structure
+ *----------------------------------------------------------------------------*/
+
+static const cs_lagr_wall_cell_faces_t *
+_get_wall_cell_faces(void)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  if (   _wall_cell_faces != NULL
+      && _wall_cell_faces->nt == nt_cur
+      && _wall_cell_faces->n_cells == n_cells)
+    return _wall_cell_faces;
+
+  _free_wall_cell_faces();
+
+  assert(cs_glob_lagr_boundary_conditions != NULL);
+
+  const char *elt_type = cs_glob_lagr_boundary_conditions->elt_type;
+  const cs_mesh_adjacencies_t *ma = cs_glob_mesh_adjacencies;
+  const cs_lnum_t *cell_b_faces_idx = ma->cell_b_faces_idx;
+  const cs_lnum_t *cell_b_faces = ma->cell_b_faces;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->b_face_normal;
+  const cs_real_3_t *restrict b_face_cog
+    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->b_face_cog;
+
+  cs_lagr_wall_cell_faces_t *wcf;
+  BFT_MALLOC(wcf, 1, cs_lagr_wall_cell_faces_t);
+
+  wcf->nt = nt_cur;
+  wcf->n_cells = n_cells;
+
+  BFT_MALLOC(wcf->idx, n_cells + 1, cs_lnum_t);
+
+  wcf->idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    cs_lnum_t n_c_faces = 0;
+    for (cs_lnum_t i = cell_b_faces_idx[c_id];
+         i < cell_b_faces_idx[c_id+1];
+         i++) {
+      const char b_type = elt_type[cell_b_faces[i]];
+      if (   (b_type == CS_LAGR_DEPO1)
+          || (b_type == CS_LAGR_DEPO2)
+          || (b_type == CS_LAGR_DEPO_DLVO))
+        n_c_faces++;
+    }
+    wcf->idx[c_id+1] = wcf->idx[c_id] + n_c_faces;
+  }
+
+  const cs_lnum_t n_wall_faces = wcf->idx[n_cells];
+
+  BFT_MALLOC(wcf->face_id, n_wall_faces, cs_lnum_t);
+  BFT_MALLOC(wcf->normal, n_wall_faces, cs_real_3_t);
+  BFT_MALLOC(wcf->cog, n_wall_faces, cs_real_3_t);
+
+  cs_lnum_t j = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    for (cs_lnum_t i = cell_b_faces_idx[c_id];
+         i < cell_b_faces_idx[c_id+1];
+         i++) {
+      cs_lnum_t f_id = cell_b_faces[i];
+      const char b_type = elt_type[f_id];
+      if (   (b_type == CS_LAGR_DEPO1)
+          || (b_type == CS_LAGR_DEPO2)
+          || (b_type == CS_LAGR_DEPO_DLVO)) {
+        wcf->face_id[j] = f_id;
+        cs_math_3_normalize(b_face_normal[f_id], wcf->normal[j]);
+        for (int k = 0; k < 3; k++)
+          wcf->cog[j][k] = b_face_cog[f_id][k];
+        j++;
+      }
+    }
+  }
+
+  _wall_cell_faces = wcf;
+
+  return _wall_cell_faces;
+}
+
+/*----------------------------------------------------------------------------
+ * Build the list of particles near a wall or interacting with a face.
+ *
+ * These are particles with an associated neighbor face, or with
+ * deposition or imposed motion flags. Other particles are ignored
+ * by the near-wall (resuspension) models.
+ *
+ * parameters:
+ *   particles <-- pointer to particle set structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_near_wall_particles(const cs_lagr_particle_set_t  *particles)
+{
+  const cs_lagr_attribute_map_t  *p_am = particles->p_am;
+  const cs_lnum_t n_particles = particles->n_particles;
+
+  const int flag_mask =   CS_LAGR_PART_DEPOSITION_FLAGS
+                        | CS_LAGR_PART_IMPOSED_MOTION;
+
+  BFT_REALLOC(_near_wall_particle_ids, n_particles, cs_lnum_t);
+
+  cs_lnum_t n = 0;
+
+  for (cs_lnum_t i = 0; i < n_particles; i++) {
+
+    const unsigned char *particle = particles->p_buffer + p_am->extents * i;
+
+    if (   cs_lagr_particle_get_lnum(particle, p_am,
+                                     CS_LAGR_NEIGHBOR_FACE_ID) > -1
+        || (cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_P_FLAG)
+            & flag_mask))
+      _near_wall_particle_ids[n++] = i;
+
+  }
+
+  _n_near_wall_particles = n;
+}
+
 /*----------------------------------------------------------------------------
  * Get pointer to a particle's tracking information.
  *
@@ -324,6 +501,11 @@ _apply_vector_rotation(const cs_real_t   matrix[3][4],
 /*----------------------------------------------------------------------------
  * Create a MPI_Datatype which maps main particle characteristics.
  *
+ * Only bytes holding particle attributes or tracking data which must persist
+ * across ranks are mapped: alignment padding and the tracking state (reset
+ * on reception) are not exchanged. The datatype is resized to the particle
+ * extents, so that contiguous particles may be exchanged in a single call.
+ *
  * parameters:
  *   am  <-- attributes map
  *
@@ -335,7 +517,7 @@ static MPI_Datatype
 _define_particle_datatype(const cs_lagr_attribute_map_t  *p_am)
 {
   size_t i;
-  MPI_Datatype  new_type;
+  MPI_Datatype  packed_type, new_type;
   int           count;
   cs_datatype_t *cs_type;
   int           *blocklengths;
@@ -344,12 +526,12 @@ _define_particle_datatype(const cs_lagr_attribute_map_t  *p_am)
 
   size_t tot_extents = p_am->extents;
 
-  /* Mark bytes with associated type */
+  /* Mark bytes with associated type (unmarked bytes are not exchanged) */
 
   BFT_MALLOC(cs_type, tot_extents, cs_datatype_t);
 
   for (i = 0; i < tot_extents; i++)
-    cs_type[i] = CS_CHAR;
+    cs_type[i] = CS_DATATYPE_NULL;
 
   /* Map tracking info */
 
@@ -365,11 +547,6 @@ _define_particle_datatype(const cs_lagr_attribute_map_t  *p_am)
   for (i = attr_start; i < attr_end; i++)
     cs_type[i] = CS_LNUM_TYPE;
 
-  attr_start = offsetof(cs_lagr_tracking_info_t, last_face_id);
-  attr_end = attr_start + sizeof(int);
-  for (i = attr_start; i < attr_end; i++)
-    cs_type[i] = CS_INT_TYPE;
-
   /* Map attributes */
 
   for (int j = 0; j < p_am->n_time_vals; j++) {
@@ -397,7 +574,8 @@ _define_particle_datatype(const cs_lagr_attribute_map_t  *p_am)
       if (cs_type[j] != cs_type[i])
         break;
     }
-    count += 1;
+    if (cs_type[i] != CS_DATATYPE_NULL)
+      count += 1;
     i = j;
   }
 
@@ -412,31 +590,35 @@ _define_particle_datatype(const cs_lagr_attribute_map_t  *p_am)
   i = 0;
   while (i < tot_extents) {
     size_t j;
-    types[count] = cs_datatype_to_mpi[cs_type[i]];
-    displacements[count] = i;
     for (j = i; j < tot_extents; j++) {
       if (cs_type[j] != cs_type[i])
         break;
     }
-    blocklengths[count] = (j-i) / cs_datatype_size[cs_type[i]];
-    count += 1;
+    if (cs_type[i] != CS_DATATYPE_NULL) {
+      types[count] = cs_datatype_to_mpi[cs_type[i]];
+      displacements[count] = i;
+      blocklengths[count] = (j-i) / cs_datatype_size[cs_type[i]];
+      count += 1;
+    }
     i = j;
   }
 
   /* Create new datatype */
 
   MPI_Type_create_struct(count, blocklengths, displacements, types,
-                         &new_type);
+                         &packed_type);
+
+  MPI_Type_create_resized(packed_type, 0, tot_extents, &new_type);
 
   MPI_Type_commit(&new_type);
 
+  MPI_Type_free(&packed_type);
+
   BFT_FREE(displacements);
   BFT_FREE(types);
   BFT_FREE(blocklengths);
   BFT_FREE(cs_type);
 
-  MPI_Type_commit(&new_type);
-
   return new_type;
 }
 
@@ -1821,10 +2003,13 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
  *   failsafe_mode            <-- with (0) / without (1) failure capability
  *   b_face_zone_id           <-- boundary face zone id
  *   visc_length              <-- viscous layer thickness
+ *   u                        <-- fluid velocity field
+ *   defer_interactions       <-- if true, stop before boundary or internal
+ *                                condition faces
  *
  * returns:
  *   a state associated to the status of the particle (treated, to be deleted,
- *   to be synchonised)
+ *   to be synchonised; CS_LAGR_PART_TO_SYNC if interactions were deferred)
  *----------------------------------------------------------------------------*/
 
 static cs_lnum_t
@@ -1835,7 +2020,8 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
                    int                             failsafe_mode,
                    const int                       b_face_zone_id[],
                    const cs_real_t                 visc_length[],
-                   const cs_field_t               *u)
+                   const cs_field_t               *u,
+                   bool                            defer_interactions)
 {
   cs_real_t  disp[3];
 
@@ -1854,6 +2040,8 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
     = (const cs_real_3_t *restrict)fvq->b_face_cog;
 
   const cs_lagr_model_t *lagr_model = cs_glob_lagr_model;
+  const cs_lagr_internal_condition_t *internal_conditions
+    = cs_glob_lagr_internal_conditions;
 
   const cs_lagr_attribute_map_t  *p_am = particles->p_am;
   unsigned char *particle = particles->p_buffer + p_am->extents * p_id;
@@ -2112,6 +2300,19 @@ _local_propagation(cs_lagr_particle_set_t         *particles,
       goto reloop_cen;
     }
 
+    /* When interactions are deferred, stop before crossing a boundary
+       face or an interior face with an internal condition; the particle
+       remains in the same cell, so this step is simply redone when
+       interactions are handled. */
+
+    if (defer_interactions && exit_face >= 0) {
+      if (exit_face >= mesh->n_i_faces)
+        return particle_state;
+      else if (   internal_conditions != NULL
+               && internal_conditions->i_face_zone_id[exit_face] > -1)
+        return particle_state;
+    }
+
     /* Update boundary events when particle changes */
 
     if (lagr_model->deposition && exit_face >= 0) {
@@ -2927,7 +3128,10 @@ _initialize_displacement(cs_lagr_particle_set_t  *particles,
 }
 
 /*----------------------------------------------------------------------------
- * Update particle set structures: compact array.
+ * Update particle set structures: sort particles by cell.
+ *
+ * The matching cell -> particles index is kept, and may be accessed
+ * using cs_lagr_tracking_cell_particle_index().
  *
  * parameters:
  *   particles      <-> pointer to particle set structure
@@ -2941,19 +3145,20 @@ _finalize_displacement(cs_lagr_particle_set_t  *particles)
 
   const cs_lnum_t n_particles = particles->n_particles;
 
-  cs_lnum_t *cell_idx;
-  unsigned char *swap_buffer;
-  size_t swap_buffer_size = p_am->extents * ((size_t)n_particles);
+  const cs_lnum_t p_extents = particles->p_am->extents;
+  const cs_lnum_t cell_num_displ = particles->p_am->displ[0][CS_LAGR_CELL_ID];
 
-  BFT_MALLOC(cell_idx, n_cells+1, cs_lnum_t);
-  BFT_MALLOC(swap_buffer, swap_buffer_size, unsigned char);
+  BFT_REALLOC(_cell_particle_idx, n_cells+1, cs_lnum_t);
+
+  cs_lnum_t *cell_idx = _cell_particle_idx;
 
   /* Cell index (count first) */
 
   for (cs_lnum_t i = 0; i < n_cells+1; i++)
     cell_idx[i] = 0;
 
-  /* Copy unordered particle data to buffer */
+  bool ordered = true;
+  cs_lnum_t cell_id_prev = 0;
 
   for (cs_lnum_t i = 0; i < n_particles; i++) {
 
@@ -2962,12 +3167,13 @@ _finalize_displacement(cs_lagr_particle_set_t  *particles)
     assert(   cur_part_state < CS_LAGR_PART_OUT
            && cur_part_state != CS_LAGR_PART_TO_SYNC);
 
-    cs_lnum_t cell_id = cs_lagr_particles_get_lnum(particles, i,
-                                                   CS_LAGR_CELL_ID);
+    cs_lnum_t cell_id
+      = *((const cs_lnum_t *)(  particles->p_buffer + p_extents*i
+                              + cell_num_displ));
 
-    memcpy(swap_buffer + p_am->extents*i,
-           particles->p_buffer + p_am->extents*i,
-           p_am->extents);
+    if (cell_id < cell_id_prev)
+      ordered = false;
+    cell_id_prev = cell_id;
 
     cell_idx[cell_id+1] += 1;
 
@@ -2980,10 +3186,21 @@ _finalize_displacement(cs_lagr_particle_set_t  *particles)
 
   assert(n_particles == cell_idx[n_cells]);
 
-  /* Now copy particle data and update some statistics */
+  /* Nothing more to do if particles are already sorted */
 
-  const cs_lnum_t p_extents = particles->p_am->extents;
-  const cs_lnum_t cell_num_displ = particles->p_am->displ[0][CS_LAGR_CELL_ID];
+  if (ordered)
+    return;
+
+  /* Copy unordered particle data to buffer */
+
+  unsigned char *swap_buffer;
+  size_t swap_buffer_size = p_am->extents * ((size_t)n_particles);
+
+  BFT_MALLOC(swap_buffer, swap_buffer_size, unsigned char);
+
+  memcpy(swap_buffer, particles->p_buffer, swap_buffer_size);
+
+  /* Now copy particle data and update some statistics */
 
   for (cs_lnum_t i = 0; i < n_particles; i++) {
 
@@ -3003,7 +3220,12 @@ _finalize_displacement(cs_lagr_particle_set_t  *particles)
   }
 
   BFT_FREE(swap_buffer);
-  BFT_FREE(cell_idx);
+
+  /* Restore index (shifted by the copy above) */
+
+  for (cs_lnum_t i = n_cells; i > 0; i--)
+    cell_idx[i] = cell_idx[i-1];
+  cell_idx[0] = 0;
 
 #if 0 && defined(DEBUG) && !defined(NDEBUG)
   bft_printf("\n Particle set after %s\n", __func__);
@@ -3101,13 +3323,56 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[],
 
   const int *b_face_zone_id = cs_boundary_zone_face_class_id();
 
+  BFT_FREE(_cell_particle_idx);
+  _n_near_wall_particles = -1;
+
   _initialize_displacement(particles, particle_range);
 
   /* Main loop on particles: global propagation */
 
+  /* With multiple threads, a first propagation pass handles the purely
+     geometric part of the tracking, which only modifies each particle's
+     own data. Interactions with boundary or internal condition faces
+     update shared counters, statistics, and events, and may use random
+     numbers, so they are deferred to the serial pass, which handles
+     particles in the same order as without threading.
+     The deposition model also updates particles near walls, and
+     is handled by the serial pass only. */
+
+  const bool threaded_pass = (   cs_glob_n_threads > 1
+                              && lagr_model->deposition == 0);
+
   while (continue_displacement) {
 
-    /* Local propagation */
+    /* Local propagation, threaded pass */
+
+    if (threaded_pass) {
+
+      const cs_lnum_t n_range = particle_range[1] - particle_range[0];
+
+#     pragma omp parallel for schedule(dynamic, CS_CL_SIZE) \
+                              if (n_range > CS_THR_MIN)
+      for (cs_lnum_t i = particle_range[0]; i < particle_range[1]; i++) {
+        cs_lagr_tracking_info_t *p_info = _tracking_info(particles, i);
+        if (p_info->state == CS_LAGR_PART_TO_SYNC) {
+          cs_lnum_t p_state = _local_propagation(particles,
+                                                 events,
+                                                 i,
+                                                 displacement_step_id,
+                                                 failsafe_mode,
+                                                 b_face_zone_id,
+                                                 visc_length,
+                                                 u,
+                                                 true);
+          p_info->state = (cs_lagr_tracking_state_t)p_state;
+        }
+      }
+
+    }
+
+    /* Local propagation, serial pass (particles with remaining
+       interactions, or all particles if not threaded) */
+
     for (cs_lnum_t i = particle_range[0]; i < particle_range[1]; i++) {
 
       /* Local copies of the current and previous particles state vectors
@@ -3128,7 +3393,8 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[],
                                                         failsafe_mode,
                                                         b_face_zone_id,
                                                         visc_length,
-                                                        u);
+                                                        u,
+                                                        false);
 
         _tracking_info(particles, i)->state = cur_part_state;
 
@@ -3219,8 +3485,11 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[],
   }
 
   /* If the whole set of particles is tracked rearrange particles */
-  if (particle_range[1] - particle_range[0] == particles->n_particles)
+  if (particle_range[1] - particle_range[0] == particles->n_particles) {
     _finalize_displacement(particles);
+    if (lagr_model->deposition > 0)
+      _build_near_wall_particles(particles);
+  }
 
   if (   cs_glob_porous_model == 3
       && lagr_model->deposition == 1)
@@ -3229,6 +3498,62 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[],
   cs_timer_stats_switch(t_top_id);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the cell -> particles index of the main particle set.
+ *
+ * After a displacement step applied to the whole particle set, particles
+ * are sorted by cell, in the mesh's cell order, so particles of cell c
+ * have ids index[c] to index[c+1] - 1. Particles with ids greater than
+ * or equal to index[n_cells] were added since the last displacement
+ * (by injection for example) and are not sorted.
+ *
+ * \return  pointer to cell -> particles index (size: n_cells + 1),
+ *          or NULL if the last displacement step was not applied to
+ *          the whole particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_lagr_tracking_cell_particle_index(void)
+{
+  return _cell_particle_idx;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the list of particles of the main particle set which are
+ *        near a wall or interacting with a face.
+ *
+ * This list is built with the deposition model, after a displacement step
+ * applied to the whole particle set. It contains the particles having
+ * an associated neighbor face, or deposition or imposed motion flags,
+ * which are the only ones handled by the near-wall models.
+ *
+ * \param[out]  n_particles  number of particles in list
+ *
+ * \return  pointer to particle ids, or NULL if not available
+ *          (in which case all particles should be considered)
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_lagr_tracking_near_wall_particles(cs_lnum_t  *n_particles)
+{
+  const cs_lagr_particle_set_t *p_set = cs_glob_lagr_particle_set;
+
+  if (   _n_near_wall_particles < 0
+      || p_set == NULL
+      || _cell_particle_idx == NULL
+      || _cell_particle_idx[cs_glob_mesh->n_cells] != p_set->n_particles) {
+    *n_particles = 0;
+    return NULL;
+  }
+
+  *n_particles = _n_near_wall_particles;
+  return _near_wall_particle_ids;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Finalize Lagrangian module.
@@ -3252,6 +3577,12 @@ cs_lagr_tracking_finalize(void)
   /* Destroy builder */
   _particle_track_builder = _destroy_track_builder(_particle_track_builder);
 
+  BFT_FREE(_cell_particle_idx);
+  BFT_FREE(_near_wall_particle_ids);
+  _n_near_wall_particles = -1;
+
+  _free_wall_cell_faces();
+
   /* Destroy internal condition structure*/
 
   cs_lagr_finalize_internal_cond();
@@ -3306,48 +3637,31 @@ cs_lagr_test_wall_cell(const void                     *particle,
   *yplus = 10000;
   *face_id = -1;
 
-  cs_lnum_t  *cell_b_face_idx = cs_glob_mesh_adjacencies->cell_b_faces_idx;
-  cs_lnum_t  *cell_b_faces = cs_glob_mesh_adjacencies->cell_b_faces;
-  const cs_real_3_t *restrict b_face_normal
-    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->b_face_normal;
-  const cs_real_3_t *restrict b_face_cog
-    = (const cs_real_3_t *restrict)cs_glob_mesh_quantities->b_face_cog;
+  const cs_lagr_wall_cell_faces_t *wcf = _get_wall_cell_faces();
+
+  cs_lnum_t  start = wcf->idx[cell_id];
+  cs_lnum_t  end =  wcf->idx[cell_id + 1];
+
+  if (start == end)
+    return;
 
   const cs_real_t  *particle_coord
     = cs_lagr_particle_attr_get_const_ptr<cs_real_t>(particle, p_am,
                                                      CS_LAGR_COORDS);
 
-  cs_lnum_t  start = cell_b_face_idx[cell_id];
-  cs_lnum_t  end =  cell_b_face_idx[cell_id + 1];
-
   for (cs_lnum_t i = start; i < end; i++) {
-    cs_lnum_t f_id = cell_b_faces[i];
-
-    assert(cs_glob_lagr_boundary_conditions != NULL);
-
-    const char b_type = cs_glob_lagr_boundary_conditions->elt_type[f_id];
-
-    if (   (b_type == CS_LAGR_DEPO1)
-        || (b_type == CS_LAGR_DEPO2)
-        || (b_type == CS_LAGR_DEPO_DLVO)) {
-
-      /* normal vector coordinates */
-      cs_real_3_t normal;
-      cs_math_3_normalize(b_face_normal[f_id], normal);
-
-      /* [(x_f - x_p) . n ] / L */
-      cs_real_t dist_norm = CS_ABS(
-          cs_math_3_distance_dot_product(b_face_cog[f_id],
-                                         particle_coord,
-                                         normal)) / visc_length[f_id];
-      if (dist_norm  < *yplus) {
-        *yplus = dist_norm;
-        *face_id = f_id;
-      }
+    cs_lnum_t f_id = wcf->face_id[i];
+
+    /* [(x_f - x_p) . n ] / L */
+    cs_real_t dist_norm = CS_ABS(
+        cs_math_3_distance_dot_product(wcf->cog[i],
+                                       particle_coord,
+                                       wcf->normal[i])) / visc_length[f_id];
+    if (dist_norm  < *yplus) {
+      *yplus = dist_norm;
+      *face_id = f_id;
     }
-
   }
-
 }
 
 /*----------------------------------------------------------------------------*/
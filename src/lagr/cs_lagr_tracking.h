@@ -92,6 +92,45 @@ void
 cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[],
                                    cs_lnum_t        particle_range[2]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the cell -> particles index of the main particle set.
+ *
+ * After a displacement step applied to the whole particle set, particles
+ * are sorted by cell, in the mesh's cell order, so particles of cell c
+ * have ids index[c] to index[c+1] - 1. Particles with ids greater than
+ * or equal to index[n_cells] were added since the last displacement
+ * (by injection for example) and are not sorted.
+ *
+ * \return  pointer to cell -> particles index (size: n_cells + 1),
+ *          or NULL if the last displacement step was not applied to
+ *          the whole particle set
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_lagr_tracking_cell_particle_index(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the list of particles of the main particle set which are
+ *        near a wall or interacting with a face.
+ *
+ * This list is built with the deposition model, after a displacement step
+ * applied to the whole particle set. It contains the particles having
+ * an associated neighbor face, or deposition or imposed motion flags,
+ * which are the only ones handled by the near-wall models.
+ *
+ * \param[out]  n_particles  number of particles in list
+ *
+ * \return  pointer to particle ids, or NULL if not available
+ *          (in which case all particles should be considered)
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_lnum_t *
+cs_lagr_tracking_near_wall_particles(cs_lnum_t  *n_particles);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Finalize Lagrangian module.
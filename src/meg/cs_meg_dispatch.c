@@ -0,0 +1,100 @@
+/*============================================================================
+ * MEG (Mathematical Expression Generator) functions block dispatch
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <string.h>
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_meg_dispatch.h"
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the id of the generated code block matching a given key.
+ *
+ * Generated MEG functions contain one block per (zone, variable, condition)
+ * combination. Rather than comparing the arguments with the names of each
+ * block in turn, the generated code provides a table of block keys, sorted
+ * in lexicographical order (part by part), and searched by bisection,
+ * so the lookup cost depends only logarithmically on the number of blocks.
+ *
+ * A null key part is handled as an empty string.
+ *
+ * \param[in]  n_blocks  number of blocks
+ * \param[in]  n_parts   number of parts in each key
+ * \param[in]  keys      sorted block keys (size: n_blocks*n_parts)
+ * \param[in]  key       key searched for (size: n_parts)
+ *
+ * \return  id of matching block, or -1 if not found
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_meg_dispatch_id(int                n_blocks,
+                   int                n_parts,
+                   const char  *const keys[],
+                   const char  *const key[])
+{
+  int start_id = 0;
+  int end_id = n_blocks;
+
+  while (start_id < end_id) {
+
+    int mid_id = start_id + (end_id - start_id) / 2;
+    const char *const *b_key = keys + mid_id*n_parts;
+
+    int cmp = 0;
+    for (int i = 0; i < n_parts && cmp == 0; i++)
+      cmp = strcmp((key[i] != NULL) ? key[i] : "", b_key[i]);
+
+    if (cmp == 0)
+      return mid_id;
+    else if (cmp < 0)
+      end_id = mid_id;
+    else
+      start_id = mid_id + 1;
+
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -29,6 +29,7 @@
  * Local headers
  *----------------------------------------------------------------------------*/
 
+#include "cs_meg_dispatch.h"
 #include "cs_meg_prototypes.h"
 #include "cs_meg_xdef_wrapper.h"
 
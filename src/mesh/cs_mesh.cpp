@@ -271,6 +271,37 @@ _print_halo_info(const cs_mesh_t  *mesh,
                 _("  Total time for halo creation:              %.3g s\n\n"),
                 halo_time + interface_time + ext_neighborhood_time);
 
+#if defined(HAVE_MPI)
+
+  /* Halo statistics inside and between compute nodes */
+
+  if (mesh->n_domains > 1) {
+
+    cs_lnum_t n_elts[2];
+    int n_ranks[2];
+    cs_halo_count_by_node(mesh->halo, n_elts, n_ranks);
+
+    cs_gnum_t n_g_elts[2] = {(cs_gnum_t)n_elts[0], (cs_gnum_t)n_elts[1]};
+    cs_parall_counter(n_g_elts, 2);
+    cs_parall_max(2, CS_INT_TYPE, n_ranks);
+
+    double f = 0.;
+    if (n_g_elts[0] + n_g_elts[1] > 0)
+      f = (double)n_g_elts[1] / (double)(n_g_elts[0] + n_g_elts[1]);
+
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("  Halo elements:              intra-node  inter-node\n"
+                    "    total:                  %10llu  %10llu\n"
+                    "    max. neighbor ranks:    %10d  %10d\n"
+                    "    inter-node fraction:    %10.3g\n\n"),
+                  (unsigned long long)n_g_elts[0],
+                  (unsigned long long)n_g_elts[1],
+                  n_ranks[0], n_ranks[1], f);
+
+  }
+
+#endif
+
   cs_log_separator(CS_LOG_PERFORMANCE);
   cs_log_printf_flush(CS_LOG_PERFORMANCE);
 }
@@ -530,9 +530,12 @@ _update_cell_vertices(cs_mesh_adjacencies_t  *ma,
 
   cs_adjacency_t *c2v = ma->_c2v;
 
-  if (c2v->n_elts != m->n_cells)
-    BFT_REALLOC(c2v->idx, m->n_cells+1, cs_lnum_t);
-  BFT_FREE(c2v->ids);
+  /* Follow mesh mapping, so as to be usable on device when available */
+
+  cs_alloc_mode_t alloc_mode = cs_check_device_ptr(m->i_face_cells);
+
+  CS_REALLOC_HD(c2v->idx, m->n_cells+1, cs_lnum_t, alloc_mode);
+  CS_FREE_HD(c2v->ids);
 
   const cs_lnum_t n_cells = m->n_cells;
 
@@ -574,7 +577,7 @@ _update_cell_vertices(cs_mesh_adjacencies_t  *ma,
 
   /* Add vertices */
 
-  BFT_REALLOC(c2v->ids, c2v->idx[n_cells], cs_lnum_t);
+  CS_MALLOC_HD(c2v->ids, c2v->idx[n_cells], cs_lnum_t, alloc_mode);
 
   cs_lnum_t *ids = c2v->ids;
 
@@ -638,7 +641,9 @@ _update_cell_vertices(cs_mesh_adjacencies_t  *ma,
     s_id = e_id;
   }
 
-  BFT_REALLOC(c2v->ids, c2v->idx[n_cells], cs_lnum_t);
+  CS_REALLOC_HD(c2v->ids, c2v->idx[n_cells], cs_lnum_t, alloc_mode);
+  cs_mem_advise_set_read_mostly(c2v->idx);
+  cs_mem_advise_set_read_mostly(c2v->ids);
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -860,6 +865,14 @@ cs_mesh_adjacencies_update_device(cs_alloc_mode_t  alloc_mode)
     cs_mem_advise_set_read_mostly(ma->cell_hb_faces_idx);
     cs_mem_advise_set_read_mostly(ma->cell_hb_faces);
   }
+
+  if (ma->_c2v != nullptr) {
+    cs_adjacency_t *c2v = ma->_c2v;
+    CS_REALLOC_HD(c2v->idx, n_cells+1, cs_lnum_t, alloc_mode);
+    CS_REALLOC_HD(c2v->ids, c2v->idx[n_cells], cs_lnum_t, alloc_mode);
+    cs_mem_advise_set_read_mostly(c2v->idx);
+    cs_mem_advise_set_read_mostly(c2v->ids);
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1073,12 +1086,14 @@ cs_adjacency_destroy(cs_adjacency_t   **p_adj)
   bool  is_shared = (adj->flag & CS_ADJACENCY_SHARED) ? true : false;
   if (!is_shared) {
 
+    /* Arrays may have been mapped to the device */
+
     if (adj->stride < 1)
-      BFT_FREE(adj->idx);
+      CS_FREE_HD(adj->idx);
 
-    BFT_FREE(adj->ids);
+    CS_FREE_HD(adj->ids);
     if (adj->flag & CS_ADJACENCY_SIGNED)
-      BFT_FREE(adj->sgn);
+      CS_FREE_HD(adj->sgn);
   }
 
   BFT_FREE(adj);
@@ -98,402 +98,342 @@ static int  _call_type_visualize = 0;
  *============================================================================*/
 
 /*----------------------------------------------------------------------------
- * Evaluate cell's non-orthogonality.
+ * Compute the least-squares gradient quality indicator of a cell.
  *
- * Compute orthogonal normal using the distance between two consecutive
- * cell centers and the surface vector orthogonal to the face.
- * Evaluates a level of non-orthogonality and tags identified bad cells.
+ * The indicator is the ratio of the smallest to largest eigenvalue
+ * (in absolute value) of the cell's least-squares matrix.
  *
  * parameters:
- *   mesh                 <-- pointer to associated mesh structure.
- *   mesh_quantities      <-- pointer to associated mesh quantities structure
- *   bad_cell_flag        <-- array of bad cell flags for various uses
+ *   w1 <-- least-squares matrix coefficients (xx, yy, zz, xy, xz, yz)
+ *
+ * returns:
+ *   least-squares gradient quality indicator
  *----------------------------------------------------------------------------*/
 
-static void
-_compute_ortho_norm(const cs_mesh_t             *mesh,
-                    const cs_mesh_quantities_t  *mesh_quantities,
-                    unsigned                     bad_cell_flag[])
+static cs_real_t
+_lsq_quality(const cs_real_t  w1[6])
 {
-  cs_lnum_t  i, face_id, cell1, cell2;
-
-  cs_real_t  cell_center1[3], cell_center2[3];
-  cs_real_t  face_center[3];
-  cs_real_t  face_normal[3], vect[3];
-
-  double  cos_alpha, i_face_ortho, b_face_ortho;
-
-  const cs_lnum_t  dim = 3;
-
-  /* Loop on interior faces */
-  /*------------------------*/
-
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
-
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
-
-    /* Get information on mesh quantities */
-
-    for (i = 0; i < dim; i++) {
-
-      /* Center of gravity for each cell */
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
-      cell_center2[i] = mesh_quantities->cell_cen[cell2*dim + i];
-
-      /* Surface vector (orthogonal to the face) */
-      face_normal[i] = mesh_quantities->i_face_normal[face_id*dim + i];
-
-    }
-
-    /* Evaluate the non-orthogonality. */
+  cs_real_3_t   eigenvalues;
+  cs_real_33_t  w2;
 
-    for (i = 0; i < dim; i++)
-      vect[i] = cell_center2[i] - cell_center1[i];
+  double xam, q, p, r, phi;
 
-    cs_real_t v1[3], v2[3];
+  const double pi = 4 * atan(1);
 
-    cs_math_3_normalize(vect, v1);
-    cs_math_3_normalize(face_normal, v2);
+  w2[0][0] = w1[0];
+  w2[1][1] = w1[1];
+  w2[2][2] = w1[2];
+  w2[0][1] = w1[3];
+  w2[0][2] = w1[4];
+  w2[1][2] = w1[5];
+  w2[1][0] = w1[3];
+  w2[2][0] = w1[4];
+  w2[2][1] = w1[5];
 
-    cos_alpha = cs_math_3_dot_product(v1, v2);
+  /* Compute the eigenvalues for a given real symmetric 3x3 matrix */
 
-    i_face_ortho = cos_alpha;
+  xam = w2[0][1] * w2[0][1] + w2[0][2] * w2[0][2] + w2[1][2] * w2[1][2];
 
-    if (i_face_ortho < 0.1) {
-      bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
-      bad_cell_flag[cell2] |= CS_BAD_CELL_ORTHO_NORM;
-    }
+  /* First check if the matrix is diagonal */
+  if (xam <= 0.) {
+    for (int i = 0; i < 3; i++)
+      eigenvalues[i] = w2[i][i];
   }
 
-  /* Loop on boundary faces */
-  /*------------------------*/
-
-  for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
+  /* If the matrix is not diagonal, we get the eigenvalues from a
+     trigonometric solution                                       */
+  else {
+    q = (w2[0][0] + w2[1][1] + w2[2][2]) / 3.;
 
-    cell1 = mesh->b_face_cells[face_id];
+    p = (w2[0][0] - q) * (w2[0][0] - q) +
+        (w2[1][1] - q) * (w2[1][1] - q) +
+        (w2[2][2] - q) * (w2[2][2] - q) + 2. * xam;
 
-    /* Get information on mesh quantities */
-
-    for (i = 0; i < dim; i++) {
-
-      /* Center of gravity of the cell */
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
-
-      /* Face center coordinates */
-      face_center[i] = mesh_quantities->b_face_cog[face_id*dim + i];
-
-      /* Surface vector (orthogonal to the face) */
-      face_normal[i] = mesh_quantities->b_face_normal[face_id*dim + i];
+    p = sqrt(p / 6.);
 
+    for (int i = 0; i < 3; i++) {
+      for (int k = 0; k < 3; k++) {
+        if (i == k)
+          w2[i][k] = (1. / p) * (w2[i][k] - q);
+        else
+          w2[i][k] = (1. / p) * (w2[i][k]);
+      }
     }
 
-    /* Evaluate the non-orthogonality. */
-    for (i = 0; i < dim; i++)
-      vect[i] = face_center[i] - cell_center1[i];
-
-    cs_real_t v1[3], v2[3];
-
-    cs_math_3_normalize(vect, v1);
-    cs_math_3_normalize(face_normal, v2);
-
-    cos_alpha = cs_math_3_dot_product(v1, v2);
+    r =   w2[0][0] * w2[1][1] * w2[2][2]
+        + w2[0][1] * w2[1][2] * w2[2][0]
+        + w2[0][2] * w2[1][0] * w2[2][1]
+        - w2[0][2] * w2[1][1] * w2[2][0]
+        - w2[0][1] * w2[1][0] * w2[2][2]
+        - w2[0][0] * w2[1][2] * w2[2][1];
+
+    r *= 0.5;
+
+    /* In exact arithmetic for a symmetric matrix  -1 <= r <= 1
+       but computation error can leave it slightly outside this range */
+    if (r <= -1.)
+      phi = pi / 3.;
+    else if (r >= 1.)
+      phi = 0.;
+    else
+      phi = acos(r) / 3.;
+
+    /* The eigenvalues satisfy eig3 <= eig2 <= eig1
+       with tr(w2) = eig1 + eig2 + eig3             */
+    eigenvalues[0] = q + 2. * p * cos(phi);
+    eigenvalues[2] = q + 2. * p * cos(phi + (2. * pi / 3.));
+    eigenvalues[1] = 3. * q - eigenvalues[0] - eigenvalues[2];
+  }
 
-    b_face_ortho = cos_alpha;
+  double min_diag = 1.e15;
+  double max_diag = 0.;
 
-    if (b_face_ortho < 0.1)
-      bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
+  for (int i = 0; i < 3; i++) {
+    min_diag = fmin(min_diag, fabs(eigenvalues[i]));
+    max_diag = fmax(max_diag, fabs(eigenvalues[i]));
   }
 
-  if (mesh->halo != nullptr)
-    cs_halo_sync_untyped(mesh->halo,
-                         CS_HALO_EXTENDED,
-                         sizeof(unsigned),
-                         bad_cell_flag);
+  return min_diag / max_diag;
 }
 
 /*----------------------------------------------------------------------------
- * Evaluate cell's center offsetting.
+ * Evaluate face-based bad cell criteria in a single sweep.
+ *
+ * Non-orthogonality, center offsetting, least-squares gradient quality
+ * and volume ratio criteria are evaluated together, using a single loop
+ * on interior faces, a single loop on boundary faces, and a single
+ * loop on cells, with thread parallelism based on the face numbering
+ * (so that no two threads update the same cell at the same time).
  *
- * Compute center offsetting coefficient for interior faces.
- * Evaluates a non-matching level (offset) and tags identified bad cells.
+ * - non-orthogonality: the cosine of the angle between the face normal
+ *   and the vector joining adjacent cell centers is below 0.1
+ * - offset: a center offsetting coefficient, computed in a manner
+ *   consistent with iterative gradient reconstruction, is below 0.1
+ * - least-squares gradient: the ratio of extreme eigenvalues of the
+ *   least-squares gradient matrix is below 0.1
+ * - volume ratio: the ratio of adjacent cell volumes is below 0.01
  *
  * parameters:
- *   mesh                   <-- pointer to associated mesh structure
- *   mesh_quantities        <-- pointer to associated mesh quantities
- *                              structure
- *   bad_cell_flag          <-- array of bad cell flags for various uses
+ *   mesh             <-- pointer to associated mesh structure
+ *   mesh_quantities  <-- pointer to associated mesh quantities structure
+ *   criteria_mask    <-- mask of criteria to evaluate
+ *   bad_cell_flag    <-> array of bad cell flags for various uses
  *----------------------------------------------------------------------------*/
 
 static void
-_compute_offsetting(const cs_mesh_t             *mesh,
-                    const cs_mesh_quantities_t  *mesh_quantities,
-                    unsigned                     bad_cell_flag[])
+_compute_face_criteria(const cs_mesh_t             *mesh,
+                       const cs_mesh_quantities_t  *mesh_quantities,
+                       int                          criteria_mask,
+                       unsigned                     bad_cell_flag[])
 {
-  cs_lnum_t  face_id, cell1, cell2;
-  double  of_n, off_1, off_2;
+  const cs_lnum_t  n_cells = mesh->n_cells;
+  const cs_lnum_t  n_cells_wghosts = mesh->n_cells_with_ghosts;
 
-  const cs_real_t *v_of, *v_n;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)mesh->i_face_cells;
+  const cs_lnum_t *b_face_cells = mesh->b_face_cells;
 
-  /* Loop on interior faces */
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)mesh_quantities->cell_cen;
+  const cs_real_t *cell_vol = mesh_quantities->cell_vol;
+  const cs_real_3_t *i_face_normal
+    = (const cs_real_3_t *)mesh_quantities->i_face_normal;
+  const cs_real_3_t *b_face_normal
+    = (const cs_real_3_t *)mesh_quantities->b_face_normal;
+  const cs_real_3_t *b_face_cog
+    = (const cs_real_3_t *)mesh_quantities->b_face_cog;
+  const cs_real_3_t *dofij
+    = (const cs_real_3_t *)mesh_quantities->dofij;
+
+  const bool c_ortho = (criteria_mask & CS_BAD_CELL_ORTHO_NORM);
+  const bool c_offset = (criteria_mask & CS_BAD_CELL_OFFSET);
+  const bool c_lsq = (criteria_mask & CS_BAD_CELL_LSQ_GRAD);
+  const bool c_ratio = (criteria_mask & CS_BAD_CELL_RATIO);
+
+  /* Thread groups (use a single group and thread if no numbering
+     is available yet) */
+
+  const cs_lnum_t _i_group_index[2] = {0, mesh->n_i_faces};
+  const cs_lnum_t _b_group_index[2] = {0, mesh->n_b_faces};
+
+  int n_i_groups = 1, n_i_threads = 1, n_b_groups = 1, n_b_threads = 1;
+  const cs_lnum_t *i_group_index = _i_group_index;
+  const cs_lnum_t *b_group_index = _b_group_index;
+
+  if (mesh->i_face_numbering != nullptr) {
+    n_i_groups = mesh->i_face_numbering->n_groups;
+    n_i_threads = mesh->i_face_numbering->n_threads;
+    i_group_index = mesh->i_face_numbering->group_index;
+  }
+  if (mesh->b_face_numbering != nullptr) {
+    n_b_groups = mesh->b_face_numbering->n_groups;
+    n_b_threads = mesh->b_face_numbering->n_threads;
+    b_group_index = mesh->b_face_numbering->group_index;
+  }
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+  /* Least-squares matrix coefficients (xx, yy, zz, xy, xz, yz) */
 
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
+  cs_real_6_t *w1 = nullptr;
 
-    /* Compute center offsetting coefficient,
-       in a manner consistent with iterative gradient reconstruction */
+  if (c_lsq) {
+    BFT_MALLOC(w1, n_cells_wghosts, cs_real_6_t);
+#   pragma omp parallel for if (n_cells_wghosts > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_cells_wghosts; i++) {
+      for (cs_lnum_t j = 0; j < 6; j++)
+        w1[i][j] = 0.;
+    }
+  }
 
-    v_of = &(mesh_quantities->dofij[face_id*3]);
-    v_n = &(mesh_quantities->i_face_normal[face_id*3]);
-    of_n = cs_math_3_norm(v_of) * cs_math_3_norm(v_n);
+  /* Loop on interior faces */
+  /*------------------------*/
 
-    off_1 = 1 - pow(of_n / mesh_quantities->cell_vol[cell1], 1/3.);
-    off_2 = 1 - pow(of_n / mesh_quantities->cell_vol[cell2], 1/3.);
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-    if (off_1 < 0.1)
-      bad_cell_flag[cell1] |= CS_BAD_CELL_OFFSET;
-    if (off_2 < 0.1)
-      bad_cell_flag[cell2] |= CS_BAD_CELL_OFFSET;
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-  }
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
 
-  if (mesh->halo != nullptr)
-    cs_halo_sync_untyped(mesh->halo,
-                         CS_HALO_EXTENDED,
-                         sizeof(unsigned),
-                         bad_cell_flag);
-}
+        cs_lnum_t cell1 = i_face_cells[face_id][0];
+        cs_lnum_t cell2 = i_face_cells[face_id][1];
 
-/*----------------------------------------------------------------------------
- * Evaluate cell's distorsion.
- *
- * Compute Least Squares Gradient coefficient for cells.
- * Evaluates a distorsion level (based on LSQ Gradient Method) and tags
- * identified bad cells.
- *
- * parameters:
- *   mesh               <-- pointer to associated mesh structure
- *   mesh_quantities    <-- pointer to associated mesh quantities structure
- *   bad_cell_flag      --> array of bad cell flags for various uses
- *----------------------------------------------------------------------------*/
+        unsigned flag1 = 0, flag2 = 0;
 
-static void
-_compute_least_squares(const cs_mesh_t             *mesh,
-                       const cs_mesh_quantities_t  *mesh_quantities,
-                       unsigned                     bad_cell_flag[])
-{
-  cs_real_t lsq;
-  const cs_lnum_t  dim = mesh->dim;
-  const cs_lnum_t  n_cells = mesh->n_cells;
-  const cs_lnum_t  n_cells_wghosts = mesh->n_cells_with_ghosts;
+        cs_real_t vect[3], v1[3];
 
-  const cs_real_3_t *b_face_normal
-    = (const cs_real_3_t *)mesh_quantities->b_face_normal;
+        for (cs_lnum_t i = 0; i < 3; i++)
+          vect[i] = cell_cen[cell2][i] - cell_cen[cell1][i];
 
-  cs_lnum_t     i, k, face_id, cell1, cell2, cell_id;
-  cs_real_3_t   cell_center1, cell_center2, vect, dij, eigenvalues;
-  cs_real_33_t  w2;
+        cs_math_3_normalize(vect, v1);
 
-  double min_diag, max_diag;
-  double xam, q, p, r, phi;
+        /* Non-orthogonality */
 
-  cs_real_t *w1 = nullptr;
+        if (c_ortho) {
+          cs_real_t v2[3];
+          cs_math_3_normalize(i_face_normal[face_id], v2);
 
-  const double pi = 4 * atan(1);
+          double cos_alpha = cs_math_3_dot_product(v1, v2);
 
-  BFT_MALLOC(w1, 6 * n_cells_wghosts, cs_real_t);
+          if (cos_alpha < 0.1) {
+            flag1 |= CS_BAD_CELL_ORTHO_NORM;
+            flag2 |= CS_BAD_CELL_ORTHO_NORM;
+          }
+        }
 
-  for (i = 0; i < 6 * n_cells_wghosts; i++)
-    w1[i] = 0.;
+        /* Center offsetting */
 
-  /* Loop on interior faces */
+        if (c_offset) {
+          double of_n =   cs_math_3_norm(dofij[face_id])
+                        * cs_math_3_norm(i_face_normal[face_id]);
 
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
+          double off_1 = 1 - pow(of_n / cell_vol[cell1], 1/3.);
+          double off_2 = 1 - pow(of_n / cell_vol[cell2], 1/3.);
 
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
+          if (off_1 < 0.1)
+            flag1 |= CS_BAD_CELL_OFFSET;
+          if (off_2 < 0.1)
+            flag2 |= CS_BAD_CELL_OFFSET;
+        }
 
-    /* Center of gravity for each cell */
+        /* Least-squares gradient matrix contribution */
 
-    for (i = 0; i < dim; i++) {
-      cell_center1[i] = mesh_quantities->cell_cen[cell1*dim + i];
-      cell_center2[i] = mesh_quantities->cell_cen[cell2*dim + i];
-      vect[i] = cell_center2[i] - cell_center1[i];
-    }
+        if (c_lsq) {
+          const cs_real_t w[6] = {v1[0]*v1[0], v1[1]*v1[1], v1[2]*v1[2],
+                                  v1[0]*v1[1], v1[0]*v1[2], v1[1]*v1[2]};
+          for (cs_lnum_t j = 0; j < 6; j++) {
+            w1[cell1][j] += w[j];
+            w1[cell2][j] += w[j];
+          }
+        }
+
+        /* Volume ratio */
 
-    cs_real_t v[3];
-    cs_math_3_normalize(vect, v);
+        if (c_ratio) {
+          double vol_ratio = fmin(cell_vol[cell1] / cell_vol[cell2],
+                                  cell_vol[cell2] / cell_vol[cell1]);
 
-    for (i = 0; i < dim; i++)
-      dij[i] = v[i];
+          if (vol_ratio < 0.1*0.1) {
+            flag1 |= CS_BAD_CELL_RATIO;
+            flag2 |= CS_BAD_CELL_RATIO;
+          }
+        }
+
+        bad_cell_flag[cell1] |= flag1;
+        bad_cell_flag[cell2] |= flag2;
 
-    w1[cell1] += dij[0] * dij[0];
-    w1[cell1 + n_cells_wghosts] += dij[1] * dij[1];
-    w1[cell1 + 2 * n_cells_wghosts] += dij[2] * dij[2];
-    w1[cell1 + 3 * n_cells_wghosts] += dij[0] * dij[1];
-    w1[cell1 + 4 * n_cells_wghosts] += dij[0] * dij[2];
-    w1[cell1 + 5 * n_cells_wghosts] += dij[1] * dij[2];
+      }
 
-    w1[cell2] += dij[0] * dij[0];
-    w1[cell2 + n_cells_wghosts] += dij[1] * dij[1];
-    w1[cell2 + 2 * n_cells_wghosts] += dij[2] * dij[2];
-    w1[cell2 + 3 * n_cells_wghosts] += dij[0] * dij[1];
-    w1[cell2 + 4 * n_cells_wghosts] += dij[0] * dij[2];
-    w1[cell2 + 5 * n_cells_wghosts] += dij[1] * dij[2];
+    }
 
   }
 
   /* Loop on boundary faces */
   /*------------------------*/
 
-  for (face_id = 0; face_id < mesh->n_b_faces; face_id++) {
-    cell1 = mesh->b_face_cells[face_id];
+  if (c_ortho || c_lsq) {
 
-    cs_real_t bn[3];
+    for (int g_id = 0; g_id < n_b_groups; g_id++) {
 
-    cs_math_3_normalize(b_face_normal[face_id], bn);
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_b_threads; t_id++) {
 
-    for (i = 0; i < dim; i++)
-      dij[i] = bn[i];
+        for (cs_lnum_t face_id = b_group_index[(t_id*n_b_groups + g_id)*2];
+             face_id < b_group_index[(t_id*n_b_groups + g_id)*2 + 1];
+             face_id++) {
 
-    w1[cell1] += dij[0] * dij[0];
-    w1[cell1 + n_cells_wghosts] += dij[1] * dij[1];
-    w1[cell1 + 2 * n_cells_wghosts] += dij[2] * dij[2];
-    w1[cell1 + 3 * n_cells_wghosts] += dij[0] * dij[1];
-    w1[cell1 + 4 * n_cells_wghosts] += dij[0] * dij[2];
-    w1[cell1 + 5 * n_cells_wghosts] += dij[1] * dij[2];
-  }
+          cs_lnum_t cell1 = b_face_cells[face_id];
 
-  for (cell_id = 0; cell_id < n_cells; cell_id++) {
+          cs_real_t bn[3];
+          cs_math_3_normalize(b_face_normal[face_id], bn);
 
-    w2[0][0] = w1[cell_id];
-    w2[1][1] = w1[cell_id + n_cells_wghosts];
-    w2[2][2] = w1[cell_id + 2 * n_cells_wghosts];
-    w2[0][1] = w1[cell_id + 3 * n_cells_wghosts];
-    w2[0][2] = w1[cell_id + 4 * n_cells_wghosts];
-    w2[1][2] = w1[cell_id + 5 * n_cells_wghosts];
-    w2[1][0] = w1[cell_id + 3 * n_cells_wghosts];
-    w2[2][0] = w1[cell_id + 4 * n_cells_wghosts];
-    w2[2][1] = w1[cell_id + 5 * n_cells_wghosts];
+          /* Non-orthogonality */
 
-    /* Compute the eigenvalues for a given real symmetric 3x3 matrix */
+          if (c_ortho) {
+            cs_real_t vect[3], v1[3];
+            for (cs_lnum_t i = 0; i < 3; i++)
+              vect[i] = b_face_cog[face_id][i] - cell_cen[cell1][i];
 
-    xam = w2[0][1] * w2[0][1] + w2[0][2] * w2[0][2] + w2[1][2] * w2[1][2];
+            cs_math_3_normalize(vect, v1);
 
-    /* First check if the matrix is diagonal */
-    if (xam <= 0.) {
-      for (i = 0; i < 3; i++)
-        eigenvalues[i] = w2[i][i];
-    }
+            double cos_alpha = cs_math_3_dot_product(v1, bn);
 
-    /* If the matrix is not diagonal, we get the eigenvalues from a
-       trigonometric solution                                       */
-    else {
-      q = (w2[0][0] + w2[1][1] + w2[2][2]) / 3.;
+            if (cos_alpha < 0.1)
+              bad_cell_flag[cell1] |= CS_BAD_CELL_ORTHO_NORM;
+          }
 
-      p = (w2[0][0] - q) * (w2[0][0] - q) +
-          (w2[1][1] - q) * (w2[1][1] - q) +
-          (w2[2][2] - q) * (w2[2][2] - q) + 2. * xam;
+          /* Least-squares gradient matrix contribution */
 
-      p = sqrt(p / 6.);
+          if (c_lsq) {
+            w1[cell1][0] += bn[0] * bn[0];
+            w1[cell1][1] += bn[1] * bn[1];
+            w1[cell1][2] += bn[2] * bn[2];
+            w1[cell1][3] += bn[0] * bn[1];
+            w1[cell1][4] += bn[0] * bn[2];
+            w1[cell1][5] += bn[1] * bn[2];
+          }
 
-      for (i = 0; i < 3; i++) {
-        for (k = 0; k < 3; k++) {
-          if (i == k)
-            w2[i][k] = (1. / p) * (w2[i][k] - q);
-          else
-            w2[i][k] = (1. / p) * (w2[i][k]);
         }
-      }
 
-      r =   w2[0][0] * w2[1][1] * w2[2][2]
-          + w2[0][1] * w2[1][2] * w2[2][0]
-          + w2[0][2] * w2[1][0] * w2[2][1]
-          - w2[0][2] * w2[1][1] * w2[2][0]
-          - w2[0][1] * w2[1][0] * w2[2][2]
-          - w2[0][0] * w2[1][2] * w2[2][1];
-
-      r *= 0.5;
-
-      /* In exact arithmetic for a symmetric matrix  -1 <= r <= 1
-         but computation error can leave it slightly outside this range */
-      if (r <= -1.)
-        phi = pi / 3.;
-      else if (r >= 1.)
-        phi = 0.;
-      else
-        phi = acos(r) / 3.;
-
-      /* The eigenvalues satisfy eig3 <= eig2 <= eig1
-         with tr(w2) = eig1 + eig2 + eig3             */
-      eigenvalues[0] = q + 2. * p * cos(phi);
-      eigenvalues[2] = q + 2. * p * cos(phi + (2. * pi / 3.));
-      eigenvalues[1] = 3. * q - eigenvalues[0] - eigenvalues[2];
-    }
-
-    min_diag = 1.e15;
-    max_diag = 0.;
+      }
 
-    for (i = 0; i < 3; i++) {
-      min_diag = fmin(min_diag, fabs(eigenvalues[i]));
-      max_diag = fmax(max_diag, fabs(eigenvalues[i]));
     }
 
-    lsq = min_diag / max_diag;
-
-    if (lsq < 0.1)
-      bad_cell_flag[cell_id] |= CS_BAD_CELL_LSQ_GRAD;
   }
 
-  BFT_FREE(w1);
+  /* Loop on cells */
+  /*---------------*/
 
-  if (mesh->halo != nullptr)
-    cs_halo_sync_untyped(mesh->halo,
-                         CS_HALO_EXTENDED,
-                         sizeof(unsigned),
-                         bad_cell_flag);
-}
-
-/*----------------------------------------------------------------------------
- * Evaluate cell's volume ratio.
- *
- * Compute Volume Ratio coefficient for cells.
- * Evaluates a the cell's geometric continuity (based on volume ratio) and
- * tags identified bad cells.
- *
- * parameters:
- *   mesh                <-- pointer to associated mesh structure
- *   mesh_quantities     <-- pointer to associated mesh quantities structure
- *   bad_cell_flag       --> array of bad cell flags for various uses
- *----------------------------------------------------------------------------*/
-
-static void
-_compute_volume_ratio(const cs_mesh_t             *mesh,
-                      const cs_mesh_quantities_t  *mesh_quantities,
-                      unsigned                     bad_cell_flag[])
-{
-  double vol_ratio;
-  cs_real_t *volume = mesh_quantities->cell_vol;
-
-  cs_lnum_t   face_id, cell1, cell2;
+  if (c_lsq) {
 
-  /* Loop on interior faces */
-  /*------------------------*/
-
-  for (face_id = 0; face_id < mesh->n_i_faces; face_id++) {
-
-    cell1 = mesh->i_face_cells[face_id][0];
-    cell2 = mesh->i_face_cells[face_id][1];
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells; cell_id++) {
+      if (_lsq_quality(w1[cell_id]) < 0.1)
+        bad_cell_flag[cell_id] |= CS_BAD_CELL_LSQ_GRAD;
+    }
 
-    vol_ratio = fmin(volume[cell1] / volume[cell2],
-                     volume[cell2] / volume[cell1]);
+    BFT_FREE(w1);
 
-    if (vol_ratio < 0.1*0.1) {
-      bad_cell_flag[cell1] |= CS_BAD_CELL_RATIO;
-      bad_cell_flag[cell2] |= CS_BAD_CELL_RATIO;
-    }
   }
 
   if (mesh->halo != nullptr)
@@ -878,14 +818,28 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
   /* Evaluate mesh quality criteria */
   /*--------------------------------*/
 
-  /* Condition 1: Orthogonal Normal */
-  /*--------------------------------*/
+  /* Face-based criteria (conditions 1 to 4) are computed in a single
+     sweep, and logged separately */
 
-  if (_type_flag_compute[call_type] & CS_BAD_CELL_ORTHO_NORM)
-    _compute_ortho_norm(mesh,
-                        mesh_quantities,
-                        bad_cell_flag);
+  {
+    int criteria_mask
+      = _type_flag_compute[call_type] & (  CS_BAD_CELL_ORTHO_NORM
+                                         | CS_BAD_CELL_OFFSET
+                                         | CS_BAD_CELL_LSQ_GRAD
+                                         | CS_BAD_CELL_RATIO);
 
+    if (cs_glob_mesh_quantities->min_vol < 0.)
+      criteria_mask &= ~CS_BAD_CELL_OFFSET;
+
+    if (criteria_mask)
+      _compute_face_criteria(mesh,
+                             mesh_quantities,
+                             criteria_mask,
+                             bad_cell_flag);
+  }
+
+  /* Condition 1: Orthogonal Normal */
+  /*--------------------------------*/
 
   if (_type_flag_compute[call_type_log] & CS_BAD_CELL_ORTHO_NORM) {
 
@@ -913,12 +867,6 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
   /* Condition 2: Orthogonal A-Frame */
   /*---------------------------------*/
 
-  if (   _type_flag_compute[call_type] & CS_BAD_CELL_OFFSET
-      && cs_glob_mesh_quantities->min_vol >= 0.)
-    _compute_offsetting(mesh,
-                        mesh_quantities,
-                        bad_cell_flag);
-
   if (   _type_flag_compute[call_type_log] & CS_BAD_CELL_OFFSET
       && cs_glob_mesh_quantities->min_vol >= 0.) {
 
@@ -946,11 +894,6 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
   /* Condition 3: Least Squares Gradient */
   /*-------------------------------------*/
 
-  if (_type_flag_compute[call_type] & CS_BAD_CELL_LSQ_GRAD)
-    _compute_least_squares(mesh,
-                           mesh_quantities,
-                           bad_cell_flag);
-
   if (_type_flag_compute[call_type_log] & CS_BAD_CELL_LSQ_GRAD) {
 
     ibad = 0;
@@ -977,11 +920,6 @@ cs_mesh_bad_cells_detect(const cs_mesh_t       *mesh,
   /* Condition 4: Volume Ratio */
   /*---------------------------*/
 
-  if (_type_flag_compute[call_type] & CS_BAD_CELL_RATIO)
-    _compute_volume_ratio(mesh,
-                          mesh_quantities,
-                          bad_cell_flag);
-
   if (_type_flag_compute[call_type_log] & CS_BAD_CELL_RATIO) {
 
     ibad = 0;
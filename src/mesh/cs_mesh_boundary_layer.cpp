@@ -55,7 +55,9 @@
 #include "cs_equation.h"
 
 #include "cs_log.h"
+#include "cs_math.h"
 #include "cs_interface.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_mesh_builder.h"
 #include "cs_mesh_deform.h"
 #include "cs_mesh_extrude.h"
@@ -95,6 +97,13 @@ BEGIN_C_DECLS
 
 static const cs_mesh_extrude_vectors_t  *_extrude_vectors = nullptr;
 
+/* Displacement propagation options */
+
+static cs_mesh_boundary_layer_propagation_t
+  _propagation = CS_MESH_BOUNDARY_LAYER_PROPAGATION_CDO;
+
+static int _n_propagation_layers = 20;
+
 /*=============================================================================
  * Private function definitions
  *============================================================================*/
@@ -384,12 +393,159 @@ _prescribe_displacements(const cs_mesh_extrude_vectors_t  *e)
   BFT_FREE(_c_shift);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Propagate displacements from extruded vertices to the volume mesh
+ *        using inverse-distance weighted smoothing with a localized support.
+ *
+ * Displacements are prescribed on extruded and fixed vertices, and are
+ * then propagated through mesh edges using Jacobi iterations, each edge
+ * being weighted by the inverse of its length. As one layer of vertices
+ * is reached at each iteration, vertices more than the given number of
+ * layers away from prescribed vertices are not displaced.
+ *
+ * Only vertex-based operations and interface sums are required, so this
+ * is much cheaper than an elasticity-like solve, and scales as well as
+ * the distribution of the mesh itself.
+ *
+ * \param[in]   m                 mesh
+ * \param[in]   e                 extrusion vector definitions
+ * \param[in]   n_fixed_vertices  local number of fixed vertices
+ * \param[in]   fixed_vertex_ids  ids of fixed vertices, or nullptr
+ * \param[in]   v2v               vertex to vertices (edges) adjacency
+ * \param[out]  vd                vertex displacements
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_propagate_displacements_idw(const cs_mesh_t                  *m,
+                             const cs_mesh_extrude_vectors_t  *e,
+                             cs_lnum_t                         n_fixed_vertices,
+                             const cs_lnum_t                  *fixed_vertex_ids,
+                             const cs_adjacency_t             *v2v,
+                             cs_real_3_t                       vd[])
+{
+  const cs_lnum_t n_vertices = m->n_vertices;
+  const cs_real_3_t *vtx_coord = (const cs_real_3_t *)m->vtx_coord;
+
+  /* Prescribed values */
+
+  char *vtx_fixed;
+  BFT_MALLOC(vtx_fixed, n_vertices, char);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    vtx_fixed[i] = 0;
+    for (cs_lnum_t j = 0; j < 3; j++)
+      vd[i][j] = 0;
+  }
+
+  for (cs_lnum_t i = 0; i < e->n_vertices; i++) {
+    cs_lnum_t v_id = e->vertex_ids[i];
+    vtx_fixed[v_id] = 1;
+    for (cs_lnum_t j = 0; j < 3; j++)
+      vd[v_id][j] = - e->coord_shift[i][j];
+  }
+
+  if (fixed_vertex_ids != nullptr) {
+    for (cs_lnum_t i = 0; i < n_fixed_vertices; i++) {
+      cs_lnum_t v_id = fixed_vertex_ids[i];
+      vtx_fixed[v_id] = 1;
+      for (cs_lnum_t j = 0; j < 3; j++)
+        vd[v_id][j] = 0;
+    }
+  }
+
+  /* Edge weights */
+
+  const cs_lnum_t n_edges = v2v->idx[n_vertices];
+
+  cs_real_t *e_w;
+  BFT_MALLOC(e_w, n_edges, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_vertices; i++) {
+    for (cs_lnum_t k = v2v->idx[i]; k < v2v->idx[i+1]; k++) {
+      cs_real_t d = cs_math_3_distance(vtx_coord[i], vtx_coord[v2v->ids[k]]);
+      e_w[k] = (d > 0) ? 1./d : 0.;
+    }
+  }
+
+  /* Jacobi iterations; sums are stored as 4 values per vertex
+     (weighted displacement and total weight) for interface exchanges */
+
+  cs_real_4_t *sum;
+  BFT_MALLOC(sum, n_vertices, cs_real_4_t);
+
+  for (int iter = 0; iter < _n_propagation_layers; iter++) {
+
+    for (cs_lnum_t i = 0; i < n_vertices; i++) {
+      for (cs_lnum_t j = 0; j < 4; j++)
+        sum[i][j] = 0;
+    }
+
+    for (cs_lnum_t i = 0; i < n_vertices; i++) {
+      for (cs_lnum_t k = v2v->idx[i]; k < v2v->idx[i+1]; k++) {
+        cs_lnum_t l = v2v->ids[k];
+        cs_real_t w = e_w[k];
+        for (cs_lnum_t j = 0; j < 3; j++) {
+          sum[i][j] += w*vd[l][j];
+          sum[l][j] += w*vd[i][j];
+        }
+        sum[i][3] += w;
+        sum[l][3] += w;
+      }
+    }
+
+    if (m->vtx_interfaces != nullptr)
+      cs_interface_set_sum(m->vtx_interfaces,
+                           n_vertices,
+                           4,
+                           true,
+                           CS_REAL_TYPE,
+                           sum);
+
+#   pragma omp parallel for if (n_vertices > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_vertices; i++) {
+      if (vtx_fixed[i] == 0 && sum[i][3] > 0) {
+        for (cs_lnum_t j = 0; j < 3; j++)
+          vd[i][j] = sum[i][j] / sum[i][3];
+      }
+    }
+
+  }
+
+  BFT_FREE(sum);
+  BFT_FREE(e_w);
+  BFT_FREE(vtx_fixed);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
  * Public function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the method used to propagate the displacement of boundary
+ *        vertices to the volume mesh when inserting boundary layers.
+ *
+ * \param[in]  propagation  propagation method
+ * \param[in]  n_layers     number of vertex layers reached by the
+ *                          displacement (for localized methods)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_boundary_layer_set_propagation
+  (cs_mesh_boundary_layer_propagation_t  propagation,
+   int                                   n_layers)
+{
+  _propagation = propagation;
+
+  if (n_layers > 0)
+    _n_propagation_layers = n_layers;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Insert mesh boundary layers.
@@ -430,76 +586,93 @@ cs_mesh_boundary_layer_insert(cs_mesh_t                  *m,
     cs_mesh_location_build(m, -1);
   }
 
-  /* Define associated boundary zone */
+  const bool use_cdo
+    = (_propagation == CS_MESH_BOUNDARY_LAYER_PROPAGATION_CDO);
 
-  _extrude_vectors = e;
+  cs_domain_t  *domain = cs_glob_domain;
+  cs_adjacency_t *v2v = nullptr;
+  cs_real_3_t *_vd = nullptr;
 
-  const char *z_name = "_boundary_layer_insert";
-  int z_id[1] = {-1};
+  if (use_cdo) {
 
-  {
-    const cs_zone_t  *z = cs_boundary_zone_by_name_try(z_name);
-    if (z != nullptr) {
-      z_id[0] = z->id;
-      assert(z->type & CS_BOUNDARY_ZONE_PRIVATE);
+    /* Define associated boundary zone */
+
+    _extrude_vectors = e;
+
+    const char *z_name = "_boundary_layer_insert";
+    int z_id[1] = {-1};
+
+    {
+      const cs_zone_t  *z = cs_boundary_zone_by_name_try(z_name);
+      if (z != nullptr) {
+        z_id[0] = z->id;
+        assert(z->type & CS_BOUNDARY_ZONE_PRIVATE);
+      }
     }
-  }
-  if (z_id[0] < 0)
-    z_id[0] = cs_boundary_zone_define_by_func(z_name,
-                                              _transfer_bl_faces_selection,
-                                              nullptr,
-                                              CS_BOUNDARY_ZONE_PRIVATE);
+    if (z_id[0] < 0)
+      z_id[0] = cs_boundary_zone_define_by_func(z_name,
+                                                _transfer_bl_faces_selection,
+                                                nullptr,
+                                                CS_BOUNDARY_ZONE_PRIVATE);
 
-  cs_boundary_zone_build_private(z_id[0]);
+    cs_boundary_zone_build_private(z_id[0]);
 
-  /* Local activation of CDO module if required */
+    /* Local activation of CDO module if required */
 
-  cs_param_cdo_mode_set(CS_PARAM_CDO_MODE_WITH_FV);
+    cs_param_cdo_mode_set(CS_PARAM_CDO_MODE_WITH_FV);
 
-  cs_mesh_deform_define_dirichlet_bc_zones(1, z_id);
+    cs_mesh_deform_define_dirichlet_bc_zones(1, z_id);
 
-  cs_mesh_deform_activate();
+    cs_mesh_deform_activate();
 
-  bool pre_init_setup = false, pre_init_structures = false;
-  cs_cdo_is_initialized(&pre_init_setup, &pre_init_structures);
+    bool pre_init_setup = false, pre_init_structures = false;
+    cs_cdo_is_initialized(&pre_init_setup, &pre_init_structures);
 
-  /* Now prescribe displacements (invert extrusion direction)
-     before initializing structures */
+    /* Now prescribe displacements (invert extrusion direction)
+       before initializing structures */
 
-  _prescribe_displacements(e);
+    _prescribe_displacements(e);
 
-  cs_mesh_deform_force_displacements(n_fixed_vertices,
-                                     fixed_vertex_ids,
-                                     nullptr);
+    cs_mesh_deform_force_displacements(n_fixed_vertices,
+                                       fixed_vertex_ids,
+                                       nullptr);
 
-  cs_domain_t  *domain = cs_glob_domain;
-  if (pre_init_setup == false)
-    cs_cdo_initialize_setup(domain);
+    if (pre_init_setup == false)
+      cs_cdo_initialize_setup(domain);
 
-  /* Deactivate logging and visualization for deformation
-     fields, as they are reset to 0 anyways after extrusion */
+    /* Deactivate logging and visualization for deformation
+       fields, as they are reset to 0 anyways after extrusion */
 
-  const char *eq_name[] = {"mesh_deform_x", "mesh_deform_y", "mesh_deform_z"};
-  for (int i = 0; i < 3; i++) {
-    cs_field_t *f = cs_field_by_name(eq_name[i]);
-    cs_field_set_key_int(f, cs_field_key_id("log"), 0);
-    cs_field_set_key_int(f, cs_field_key_id("post_vis"), 0);
-  }
+    const char *eq_name[] = {"mesh_deform_x", "mesh_deform_y",
+                             "mesh_deform_z"};
+    for (int i = 0; i < 3; i++) {
+      cs_field_t *f = cs_field_by_name(eq_name[i]);
+      cs_field_set_key_int(f, cs_field_key_id("log"), 0);
+      cs_field_set_key_int(f, cs_field_key_id("post_vis"), 0);
+    }
+
+    if (pre_init_structures == false)
+      cs_cdo_initialize_structures(domain, m, mq);
+
+    /* Create an equation builder structure for each equation */
 
-  if (pre_init_structures == false)
-    cs_cdo_initialize_structures(domain, m, mq);
+    cs_equation_define_builders(m);
 
-  /* Create an equation builder structure for each equation */
+    /* Define the context structure associated to an equation */
 
-  cs_equation_define_builders(m);
+    cs_equation_define_context_structures();
 
-  /* Define the context structure associated to an equation */
+    /* Initialize field values */
 
-  cs_equation_define_context_structures();
+    cs_equation_init_field_values(domain->mesh, domain->time_step);
 
-  /* Initialize field values */
+  }
+  else {
 
-  cs_equation_init_field_values(domain->mesh, domain->time_step);
+    v2v = cs_mesh_adjacency_v2v(m);
+    BFT_MALLOC(_vd, m->n_vertices, cs_real_3_t);
+
+  }
 
   /* Compute or access reference volume for displacement limiter */
 
@@ -512,11 +685,22 @@ cs_mesh_boundary_layer_insert(cs_mesh_t                  *m,
 
     /* Now deform mesh */
 
-    cs_mesh_deform_solve_displacement(domain);
+    const cs_real_3_t *vd = _vd;
 
-    _extrude_vectors = nullptr;
+    if (use_cdo) {
+      cs_mesh_deform_solve_displacement(domain);
 
-    const cs_real_3_t *vd = cs_mesh_deform_get_displacement();
+      _extrude_vectors = nullptr;
+
+      vd = cs_mesh_deform_get_displacement();
+    }
+    else
+      _propagate_displacements_idw(m,
+                                   e,
+                                   n_fixed_vertices,
+                                   fixed_vertex_ids,
+                                   v2v,
+                                   _vd);
 
     for (cs_lnum_t i = 0; i < m->n_vertices; i++) {
       m->vtx_coord[i*3]     += vd[i][0];
@@ -616,7 +800,8 @@ cs_mesh_boundary_layer_insert(cs_mesh_t                  *m,
 
         /* Prescribe new displacement */
 
-        _prescribe_displacements(e);
+        if (use_cdo)
+          _prescribe_displacements(e);
 
       }
 
@@ -624,18 +809,29 @@ cs_mesh_boundary_layer_insert(cs_mesh_t                  *m,
 
   }
 
-  cs_mesh_deform_finalize();
-
   cell_vol_ref = nullptr;
 
   cs_timer_t  t1 = cs_timer_time();
   cs_timer_counter_t  time_count = cs_timer_diff(&t0, &t1);
 
-  CS_TIMER_COUNTER_ADD(domain->tca, domain->tca, time_count);
+  if (use_cdo) {
+    cs_mesh_deform_finalize();
 
-  cs_log_printf(CS_LOG_PERFORMANCE, " %-40s %9.3f s\n",
-                "<CDO/Boundary layer insertion> Runtime", time_count.nsec*1e-9);
-  cs_cdo_finalize(domain);
+    CS_TIMER_COUNTER_ADD(domain->tca, domain->tca, time_count);
+
+    cs_log_printf(CS_LOG_PERFORMANCE, " %-40s %9.3f s\n",
+                  "<CDO/Boundary layer insertion> Runtime",
+                  time_count.nsec*1e-9);
+    cs_cdo_finalize(domain);
+  }
+  else {
+    BFT_FREE(_vd);
+    cs_adjacency_destroy(&v2v);
+
+    cs_log_printf(CS_LOG_PERFORMANCE, " %-40s %9.3f s\n",
+                  "<Boundary layer insertion> Runtime",
+                  time_count.nsec*1e-9);
+  }
 
   cs_mesh_extrude(m, e, interior_gc);
 
@@ -48,10 +48,38 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/*! Propagation of boundary vertex displacements to the volume mesh */
+
+typedef enum {
+
+  CS_MESH_BOUNDARY_LAYER_PROPAGATION_CDO,  /*!< CDO-based mesh deformation
+                                                (elasticity-like solve) */
+  CS_MESH_BOUNDARY_LAYER_PROPAGATION_IDW   /*!< inverse-distance weighted
+                                                smoothing over a limited
+                                                number of vertex layers */
+
+} cs_mesh_boundary_layer_propagation_t;
+
 /*============================================================================
  * Public function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the method used to propagate the displacement of boundary
+ *        vertices to the volume mesh when inserting boundary layers.
+ *
+ * \param[in]  propagation  propagation method
+ * \param[in]  n_layers     number of vertex layers reached by the
+ *                          displacement (for localized methods)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_boundary_layer_set_propagation
+  (cs_mesh_boundary_layer_propagation_t  propagation,
+   int                                   n_layers);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Insert mesh boundary layers.
@@ -0,0 +1,1015 @@
+/*============================================================================
+ * Partitioned mesh cache
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <assert.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HAVE_MPI)
+#include <mpi.h>
+#endif
+
+/*----------------------------------------------------------------------------
+ *  Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_file.h"
+#include "cs_halo.h"
+#include "cs_interface.h"
+#include "cs_io.h"
+#include "cs_join_util.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_warping.h"
+#include "cs_numbering.h"
+#include "cs_partition.h"
+#include "cs_preprocessor_data.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------
+ *  Header for the current file
+ *----------------------------------------------------------------------------*/
+
+#include "cs_mesh_cache.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
+/*! \cond DOXYGEN_SHOULD_SKIP_THIS */
+
+/*=============================================================================
+ * Local Macro Definitions
+ *============================================================================*/
+
+/* Directory name separator */
+
+#define DIR_SEPARATOR '/'
+
+/* Global signature: number of ranks and threads, halo type,
+   mesh input dimensions (cells, faces, vertices), groups and families,
+   mesh input and preprocessing options checksums */
+
+#define CS_MESH_CACHE_N_SIG         11
+
+/* Local scalar dimensions preceding array sizes in rank sizes block */
+
+#define CS_MESH_CACHE_N_DIMS         7
+
+/* Local arrays */
+
+#define CS_MESH_CACHE_N_ARRAYS      30
+
+/* Values saved for each numbering structure */
+
+#define CS_MESH_CACHE_N_NUM_INFO     6
+
+/*=============================================================================
+ * Local Type Definitions
+ *============================================================================*/
+
+/* Local array description */
+
+typedef struct {
+
+  const char     *name;      /* Section name */
+  cs_datatype_t   type;      /* Data type */
+  cs_lnum_t       n_vals;    /* Local number of values */
+  void          **p;         /* Pointer to array pointer */
+
+} _cache_array_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+static char  *_cache_path = nullptr;
+
+static bool  _loaded = false;
+
+static cs_gnum_t  _input_sig[5] = {0, 0, 0, 0, 0};
+
+static const char  _magic_string[] = "Partitioned mesh cache, R0";
+
+/*=============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return cache file name for the current number of ranks.
+ *
+ * The caller is responsible for freeing the returned string.
+ *----------------------------------------------------------------------------*/
+
+static char *
+_cache_file_name(void)
+{
+  char *name;
+  BFT_MALLOC(name, strlen(_cache_path) + 64, char);
+  sprintf(name, "%s%cpartitioned_mesh_%d.csm",
+          _cache_path, DIR_SEPARATOR, cs_glob_n_ranks);
+
+  return name;
+}
+
+/*----------------------------------------------------------------------------
+ * Update a checksum with a given set of bytes (64-bit FNV-1a hash).
+ *
+ * parameters:
+ *   h <-> checksum
+ *   p <-- pointer to bytes
+ *   n <-- number of bytes
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_checksum_add(uint64_t    *h,
+              const void  *p,
+              size_t       n)
+{
+  const unsigned char *b = static_cast<const unsigned char *>(p);
+  for (size_t i = 0; i < n; i++) {
+    *h ^= b[i];
+    *h *= 1099511628211ULL;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a checksum of preprocessing options which modify the mesh
+ * before it is saved to the cache (joinings and periodicities, warped
+ * faces cutting, preprocessing partitioning stage).
+ *
+ * Options are defined identically on all ranks, so no communication
+ * is required.
+ *
+ * returns:
+ *   checksum of preprocessing options
+ *----------------------------------------------------------------------------*/
+
+static uint64_t
+_preprocess_options_checksum(void)
+{
+  uint64_t h = 14695981039346656037ULL;
+
+  _checksum_add(&h, &cs_glob_n_joinings, sizeof(int));
+
+  for (int i = 0; i < cs_glob_n_joinings; i++) {
+    const cs_join_t *j = cs_glob_join_array[i];
+    const cs_join_param_t *p = &(j->param);
+
+    if (j->criteria != nullptr)
+      _checksum_add(&h, j->criteria, strlen(j->criteria) + 1);
+
+    _checksum_add(&h, &(p->perio_type), sizeof(int));
+    if (p->perio_type != FVM_PERIODICITY_NULL)
+      _checksum_add(&h, p->perio_matrix, 12*sizeof(double));
+
+    const float f_vals[5] = {p->fraction, p->plane, p->merge_tol_coef,
+                             p->pre_merge_factor, p->tree_max_box_ratio};
+    const int i_vals[6] = {p->n_max_equiv_breaks, p->tcm, p->icm,
+                           p->max_sub_faces, p->tree_max_level,
+                           p->tree_n_max_boxes};
+    _checksum_add(&h, f_vals, sizeof(f_vals));
+    _checksum_add(&h, i_vals, sizeof(i_vals));
+  }
+
+  double max_warp_angle = -1;
+  cs_mesh_warping_get_defaults(&max_warp_angle, nullptr);
+  _checksum_add(&h, &max_warp_angle, sizeof(double));
+
+  const int preprocess_partition = cs_partition_get_preprocess();
+  _checksum_add(&h, &preprocess_partition, sizeof(int));
+
+  return h;
+}
+
+/*----------------------------------------------------------------------------
+ * Open cache file.
+ *
+ * parameters:
+ *   name <-- file name
+ *   mode <-- file mode
+ *
+ * returns:
+ *   pointer to kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static cs_io_t *
+_open(const char    *name,
+      cs_io_mode_t   mode)
+{
+  cs_io_t *cs_io = nullptr;
+  cs_file_access_t method;
+  cs_file_mode_t f_mode
+    = (mode == CS_IO_MODE_READ) ? CS_FILE_MODE_READ : CS_FILE_MODE_WRITE;
+
+  /* Each rank reads or writes its own data, so all ranks take part
+     in block operations */
+
+#if defined(HAVE_MPI)
+  MPI_Info hints;
+  cs_file_get_default_access(f_mode, &method, &hints);
+  cs_io = cs_io_initialize(name,
+                           _magic_string,
+                           mode,
+                           method,
+                           CS_IO_ECHO_OPEN_CLOSE,
+                           hints,
+                           cs_glob_mpi_comm,
+                           cs_glob_mpi_comm);
+#else
+  cs_file_get_default_access(f_mode, &method);
+  cs_io = cs_io_initialize(name,
+                           _magic_string,
+                           mode,
+                           method,
+                           CS_IO_ECHO_OPEN_CLOSE);
+#endif
+
+  return cs_io;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute global range of local values in a rank-ordered section.
+ *
+ * parameters:
+ *   n_vals   <-- local number of values
+ *   range    --> start and past-the-end global number (1 to n)
+ *
+ * returns:
+ *   global number of values
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_rank_range(cs_lnum_t  n_vals,
+            cs_gnum_t  range[2])
+{
+  cs_gnum_t n_l = n_vals, n_g = n_vals, shift = 0;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Scan(&n_l, &shift, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+    shift -= n_l;
+    MPI_Allreduce(&n_l, &n_g, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+  }
+#endif
+
+  range[0] = shift + 1;
+  range[1] = shift + n_l + 1;
+
+  return n_g;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a section whose values are concatenated in rank order.
+ *
+ * parameters:
+ *   sec_name <-- section name
+ *   type     <-- data type
+ *   n_vals   <-- local number of values
+ *   vals     <-- local values
+ *   outp     <-> output kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_write_rank_section(const char     *sec_name,
+                    cs_datatype_t   type,
+                    cs_lnum_t       n_vals,
+                    const void     *vals,
+                    cs_io_t        *outp)
+{
+  cs_gnum_t range[2];
+  cs_gnum_t n_g_vals = _rank_range(n_vals, range);
+
+  /* Values may be modified (byte-swapped) when written, so use a copy */
+
+  size_t n_bytes = n_vals*cs_datatype_size[type];
+  unsigned char *buffer;
+  BFT_MALLOC(buffer, n_bytes, unsigned char);
+  if (n_bytes > 0)
+    memcpy(buffer, vals, n_bytes);
+
+  cs_io_write_block_buffer(sec_name,
+                           n_g_vals,
+                           range[0],
+                           range[1],
+                           0,
+                           0,
+                           1,
+                           type,
+                           buffer,
+                           outp);
+
+  BFT_FREE(buffer);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a section header and check it matches the expected section.
+ *
+ * parameters:
+ *   sec_name <-- expected section name
+ *   type     <-- expected data type
+ *   header   --> section header
+ *   inp      <-> input kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_header(const char          *sec_name,
+             cs_datatype_t        type,
+             cs_io_sec_header_t  *header,
+             cs_io_t             *inp)
+{
+  if (   cs_io_read_header(inp, header) != 0
+      || strcmp(header->sec_name, sec_name) != 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error reading partitioned mesh cache \"%s\":\n"
+                "  section \"%s\" expected."),
+              cs_io_get_name(inp), sec_name);
+
+  /* Empty sections have no associated type */
+
+  if (header->n_vals == 0)
+    return;
+
+  if (type == CS_LNUM_TYPE)
+    cs_io_set_cs_lnum(header, inp);
+  else if (type == CS_GNUM_TYPE)
+    cs_io_set_cs_gnum(header, inp);
+  else if (type == CS_REAL_TYPE)
+    cs_io_assert_cs_real(header, inp);
+  else if (header->elt_type != type)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error reading partitioned mesh cache \"%s\":\n"
+                "  unexpected data type for section \"%s\"."),
+              cs_io_get_name(inp), sec_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Read a section whose values are concatenated in rank order.
+ *
+ * parameters:
+ *   sec_name <-- section name
+ *   type     <-- data type
+ *   n_vals   <-- local number of values
+ *   inp      <-> input kernel IO structure
+ *
+ * returns:
+ *   pointer to newly allocated local values (NULL if n_vals = 0)
+ *----------------------------------------------------------------------------*/
+
+static void *
+_read_rank_section(const char     *sec_name,
+                   cs_datatype_t   type,
+                   cs_lnum_t       n_vals,
+                   cs_io_t        *inp)
+{
+  cs_io_sec_header_t header;
+  _read_header(sec_name, type, &header, inp);
+
+  cs_gnum_t range[2];
+  cs_gnum_t n_g_vals = _rank_range(n_vals, range);
+
+  if ((cs_gnum_t)(header.n_vals) != n_g_vals)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error reading partitioned mesh cache \"%s\":\n"
+                "  section \"%s\" has an unexpected size."),
+              cs_io_get_name(inp), sec_name);
+
+  unsigned char *vals;
+  BFT_MALLOC(vals, n_vals*cs_datatype_size[type], unsigned char);
+
+  cs_io_read_block(&header, range[0], range[1], vals, inp);
+
+  return vals;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a global section.
+ *
+ * parameters:
+ *   sec_name <-- section name
+ *   type     <-- data type
+ *   n_vals   <-- number of values
+ *   vals     --> values
+ *   inp      <-> input kernel IO structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_global_section(const char     *sec_name,
+                     cs_datatype_t   type,
+                     cs_lnum_t       n_vals,
+                     void           *vals,
+                     cs_io_t        *inp)
+{
+  cs_io_sec_header_t header;
+  _read_header(sec_name, type, &header, inp);
+
+  if (header.n_vals != n_vals)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error reading partitioned mesh cache \"%s\":\n"
+                "  section \"%s\" has an unexpected size."),
+              cs_io_get_name(inp), sec_name);
+
+  cs_io_read_global(&header, vals, inp);
+}
+
+/*----------------------------------------------------------------------------
+ * Return total size of numbering group index arrays.
+ *
+ * parameters:
+ *   m <-- pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_numbering_group_index_size(const cs_mesh_t  *m)
+{
+  cs_lnum_t n_num_g_idx = 0;
+  const cs_numbering_t *numbering[4] = {m->cell_numbering,
+                                        m->i_face_numbering,
+                                        m->b_face_numbering,
+                                        m->vtx_numbering};
+  for (int i = 0; i < 4; i++) {
+    if (numbering[i] != nullptr)
+      n_num_g_idx += numbering[i]->n_threads*numbering[i]->n_groups*2;
+  }
+
+  return n_num_g_idx;
+}
+
+/*----------------------------------------------------------------------------
+ * Define local array descriptions.
+ *
+ * Sizes are those of the given mesh; when reading, they are replaced
+ * by the sizes found in the cache.
+ *
+ * parameters:
+ *   m         <-- pointer to mesh structure
+ *   halo_arr  <-- pointers to halo arrays (c_domain_rank, send_index,
+ *                 index, send_list)
+ *   num_info  <-- pointer to numbering info array
+ *   num_g_idx <-- pointer to numbering group index array
+ *   a         --> array descriptions
+ *----------------------------------------------------------------------------*/
+
+static void
+_define_arrays(cs_mesh_t       *m,
+               void            *halo_arr[4],
+               cs_lnum_t      **num_info,
+               cs_lnum_t      **num_g_idx,
+               _cache_array_t   a[CS_MESH_CACHE_N_ARRAYS])
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_t n_vertices = m->n_vertices;
+
+  const cs_halo_t *halo = m->halo;
+  const int n_c_domains = (halo != nullptr) ? halo->n_c_domains : 0;
+
+  const cs_lnum_t n_num_g_idx = _numbering_group_index_size(m);
+
+# define _DEF_ARRAY(_id, _name, _type, _n, _p) \
+  a[_id].name = _name; a[_id].type = _type; \
+  a[_id].p = reinterpret_cast<void **>(_p); \
+  a[_id].n_vals = (*(a[_id].p) != nullptr) ? _n : 0;
+
+  _DEF_ARRAY(0, "vertex_coords", CS_REAL_TYPE, n_vertices*3,
+             &(m->vtx_coord));
+  _DEF_ARRAY(1, "face_cells:interior", CS_LNUM_TYPE, n_i_faces*2,
+             &(m->i_face_cells));
+  _DEF_ARRAY(2, "face_cells:boundary", CS_LNUM_TYPE, n_b_faces,
+             &(m->b_face_cells));
+  _DEF_ARRAY(3, "face_vertices_index:interior", CS_LNUM_TYPE, n_i_faces+1,
+             &(m->i_face_vtx_idx));
+  _DEF_ARRAY(4, "face_vertices:interior", CS_LNUM_TYPE,
+             m->i_face_vtx_connect_size, &(m->i_face_vtx_lst));
+  _DEF_ARRAY(5, "face_vertices_index:boundary", CS_LNUM_TYPE, n_b_faces+1,
+             &(m->b_face_vtx_idx));
+  _DEF_ARRAY(6, "face_vertices:boundary", CS_LNUM_TYPE,
+             m->b_face_vtx_connect_size, &(m->b_face_vtx_lst));
+  _DEF_ARRAY(7, "global_cell_num", CS_GNUM_TYPE, n_cells,
+             &(m->global_cell_num));
+  _DEF_ARRAY(8, "global_face_num:interior", CS_GNUM_TYPE, n_i_faces,
+             &(m->global_i_face_num));
+  _DEF_ARRAY(9, "global_face_num:boundary", CS_GNUM_TYPE, n_b_faces,
+             &(m->global_b_face_num));
+  _DEF_ARRAY(10, "global_vertex_num", CS_GNUM_TYPE, n_vertices,
+             &(m->global_vtx_num));
+  _DEF_ARRAY(11, "cell_family", CS_INT_TYPE, n_cells_ext,
+             &(m->cell_family));
+  _DEF_ARRAY(12, "face_family:interior", CS_INT_TYPE, n_i_faces,
+             &(m->i_face_family));
+  _DEF_ARRAY(13, "face_family:boundary", CS_INT_TYPE, n_b_faces,
+             &(m->b_face_family));
+  _DEF_ARRAY(14, "halo:rank", CS_INT_TYPE, n_c_domains,
+             halo_arr);
+  _DEF_ARRAY(15, "halo:send_index", CS_LNUM_TYPE, 2*n_c_domains + 1,
+             halo_arr + 1);
+  _DEF_ARRAY(16, "halo:index", CS_LNUM_TYPE, 2*n_c_domains + 1,
+             halo_arr + 2);
+  _DEF_ARRAY(17, "halo:send_list", CS_LNUM_TYPE,
+             (halo != nullptr) ? halo->n_send_elts[1] : 0,
+             halo_arr + 3);
+  _DEF_ARRAY(18, "cell_cells_index", CS_LNUM_TYPE, n_cells + 1,
+             &(m->cell_cells_idx));
+  _DEF_ARRAY(19, "cell_cells", CS_LNUM_TYPE,
+             (m->cell_cells_idx != nullptr) ? m->cell_cells_idx[n_cells] : 0,
+             &(m->cell_cells_lst));
+  _DEF_ARRAY(20, "ghost_cell_vertices_index", CS_LNUM_TYPE,
+             m->n_ghost_cells + 1,
+             &(m->gcell_vtx_idx));
+  _DEF_ARRAY(21, "ghost_cell_vertices", CS_LNUM_TYPE,
+             (m->gcell_vtx_idx != nullptr) ?
+             m->gcell_vtx_idx[m->n_ghost_cells] : 0,
+             &(m->gcell_vtx_lst));
+  _DEF_ARRAY(22, "face_refinement_generation:interior", CS_CHAR, n_i_faces,
+             &(m->i_face_r_gen));
+  _DEF_ARRAY(23, "vertex_refinement_generation", CS_CHAR, n_vertices,
+             &(m->vtx_r_gen));
+  _DEF_ARRAY(24, "numbering:info", CS_LNUM_TYPE, 4*CS_MESH_CACHE_N_NUM_INFO,
+             num_info);
+  _DEF_ARRAY(25, "numbering:group_index", CS_LNUM_TYPE, n_num_g_idx,
+             num_g_idx);
+
+  /* Unused slots, reserved for future extensions */
+
+  for (int i = 26; i < CS_MESH_CACHE_N_ARRAYS; i++) {
+    a[i].name = nullptr;
+    a[i].type = CS_DATATYPE_NULL;
+    a[i].n_vals = 0;
+    a[i].p = nullptr;
+  }
+
+# undef _DEF_ARRAY
+}
+
+/*----------------------------------------------------------------------------
+ * Serialize numbering structures info.
+ *
+ * parameters:
+ *   m         <-- pointer to mesh structure
+ *   num_info  <-> numbering info (size: 4*CS_MESH_CACHE_N_NUM_INFO)
+ *   num_g_idx <-> numbering group index
+ *----------------------------------------------------------------------------*/
+
+static void
+_pack_numbering(const cs_mesh_t  *m,
+                cs_lnum_t         num_info[],
+                cs_lnum_t         num_g_idx[])
+{
+  const cs_numbering_t *numbering[4] = {m->cell_numbering,
+                                        m->i_face_numbering,
+                                        m->b_face_numbering,
+                                        m->vtx_numbering};
+
+  cs_lnum_t shift = 0;
+
+  for (int i = 0; i < 4; i++) {
+    cs_lnum_t *n_i = num_info + i*CS_MESH_CACHE_N_NUM_INFO;
+    const cs_numbering_t *n = numbering[i];
+    if (n == nullptr) {
+      n_i[0] = -1;
+      for (int j = 1; j < CS_MESH_CACHE_N_NUM_INFO; j++)
+        n_i[j] = 0;
+      continue;
+    }
+    n_i[0] = n->type;
+    n_i[1] = n->vector_size;
+    n_i[2] = n->n_threads;
+    n_i[3] = n->n_groups;
+    n_i[4] = n->n_no_adj_halo_groups;
+    n_i[5] = n->n_no_adj_halo_elts;
+    cs_lnum_t n_idx = n->n_threads*n->n_groups*2;
+    memcpy(num_g_idx + shift, n->group_index, n_idx*sizeof(cs_lnum_t));
+    shift += n_idx;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Rebuild numbering structures from serialized info.
+ *
+ * parameters:
+ *   m         <-> pointer to mesh structure
+ *   num_info  <-- numbering info (size: 4*CS_MESH_CACHE_N_NUM_INFO)
+ *   num_g_idx <-- numbering group index
+ *----------------------------------------------------------------------------*/
+
+static void
+_unpack_numbering(cs_mesh_t        *m,
+                  const cs_lnum_t   num_info[],
+                  cs_lnum_t         num_g_idx[])
+{
+  cs_numbering_t **numbering[4] = {&(m->cell_numbering),
+                                   &(m->i_face_numbering),
+                                   &(m->b_face_numbering),
+                                   &(m->vtx_numbering)};
+
+  cs_lnum_t shift = 0;
+
+  for (int i = 0; i < 4; i++) {
+    const cs_lnum_t *n_i = num_info + i*CS_MESH_CACHE_N_NUM_INFO;
+    cs_numbering_destroy(numbering[i]);
+    if (n_i[0] < 0)
+      continue;
+    cs_numbering_t *n = cs_numbering_create_threaded(n_i[2],
+                                                     n_i[3],
+                                                     num_g_idx + shift);
+    n->type = (cs_numbering_type_t)(n_i[0]);
+    n->vector_size = n_i[1];
+    n->n_no_adj_halo_groups = n_i[4];
+    n->n_no_adj_halo_elts = n_i[5];
+    shift += n_i[2]*n_i[3]*2;
+    *(numbering[i]) = n;
+  }
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the directory used for the partitioned mesh cache.
+ *
+ * When a directory is defined, the mesh obtained after preprocessing
+ * (reading, joining, partitioning, and renumbering) is saved there for
+ * the current number of ranks, and reloaded directly on subsequent
+ * runs using the same number of ranks and the same mesh input.
+ *
+ * This should be called from \ref cs_user_mesh_input, before the mesh
+ * is read.
+ *
+ * \param[in]  path  cache directory path, or nullptr to disable the cache
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_set_path(const char  *path)
+{
+  BFT_FREE(_cache_path);
+
+  if (path != nullptr) {
+    BFT_MALLOC(_cache_path, strlen(path) + 1, char);
+    strcpy(_cache_path, path);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Try to load the local mesh from the partitioned mesh cache.
+ *
+ * The cache is used only if it was built with the same number of ranks
+ * and threads, the same halo type, the same mesh input dimensions
+ * (as read by \ref cs_preprocessor_data_read_headers) and mesh input
+ * file checksum, and the same joining, periodicity, warped faces cutting
+ * and preprocessing partitioning options as the current computation;
+ * otherwise, it is rebuilt. Mesh modifications by user functions are
+ * not detected, and for internally generated meshes, only dimensions
+ * are checked. Periodicity is not handled.
+ *
+ * This is a collective operation.
+ *
+ * \param[in, out]  m          pointer to mesh structure
+ * \param[in]       mb         pointer to mesh builder structure
+ *                             (with mesh input metadata)
+ * \param[in]       halo_type  requested halo type
+ *
+ * \return  true if the mesh was loaded from the cache, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_cache_read(cs_mesh_t                *m,
+                   const cs_mesh_builder_t  *mb,
+                   cs_halo_type_t            halo_type)
+{
+  _input_sig[0] = m->n_g_cells;
+  _input_sig[1] = mb->n_g_faces;
+  _input_sig[2] = m->n_g_vertices;
+
+  if (_cache_path == nullptr)
+    return false;
+
+  /* Checksums (truncated if cs_gnum_t is a 32-bit type) */
+
+  _input_sig[3] = (cs_gnum_t)cs_preprocessor_data_input_checksum();
+  _input_sig[4] = (cs_gnum_t)_preprocess_options_checksum();
+
+  char *name = _cache_file_name();
+
+  if (!cs_file_isreg(name)) {
+    bft_printf(_("\n Partitioned mesh cache \"%s\" not found;\n"
+                 " it will be built after mesh preprocessing.\n"), name);
+    BFT_FREE(name);
+    return false;
+  }
+
+  cs_timer_t t0 = cs_timer_time();
+
+  cs_io_t *inp = _open(name, CS_IO_MODE_READ);
+
+  /* Check the cache matches the current computation */
+
+  /* Caches built by older versions have a shorter signature */
+
+  cs_gnum_t sig[CS_MESH_CACHE_N_SIG];
+  for (int i = 0; i < CS_MESH_CACHE_N_SIG; i++)
+    sig[i] = 0;
+
+  cs_io_sec_header_t header;
+  _read_header("signature", CS_GNUM_TYPE, &header, inp);
+  bool sig_match = (header.n_vals == CS_MESH_CACHE_N_SIG);
+  if (sig_match)
+    cs_io_read_global(&header, sig, inp);
+
+  if (   sig_match == false
+      || sig[0] != (cs_gnum_t)cs_glob_n_ranks
+      || sig[1] != (cs_gnum_t)cs_glob_n_threads
+      || sig[2] != (cs_gnum_t)halo_type
+      || sig[3] != _input_sig[0]
+      || sig[4] != _input_sig[1]
+      || sig[5] != _input_sig[2]
+      || sig[9] != _input_sig[3]
+      || sig[10] != _input_sig[4]) {
+    bft_printf(_("\n Partitioned mesh cache \"%s\" does not match the\n"
+                 " current computation; it will be rebuilt.\n"), name);
+    cs_io_finalize(&inp);
+    BFT_FREE(name);
+    return false;
+  }
+
+  /* Groups and families */
+
+  BFT_FREE(m->group_idx);
+  BFT_FREE(m->group);
+  BFT_FREE(m->family_item);
+
+  m->n_groups = sig[6];
+  m->n_families = sig[7];
+  m->n_max_family_items = sig[8];
+
+  BFT_MALLOC(m->group_idx, m->n_groups + 1, int);
+  _read_global_section("group_name_index", CS_INT_TYPE, m->n_groups + 1,
+                       m->group_idx, inp);
+
+  BFT_MALLOC(m->group, m->group_idx[m->n_groups], char);
+  _read_global_section("group_name", CS_CHAR, m->group_idx[m->n_groups],
+                       m->group, inp);
+
+  BFT_MALLOC(m->family_item, m->n_families*m->n_max_family_items, int);
+  _read_global_section("group_class_properties", CS_INT_TYPE,
+                       m->n_families*m->n_max_family_items,
+                       m->family_item, inp);
+
+  /* Local dimensions and array sizes */
+
+  cs_lnum_t *sizes
+    = static_cast<cs_lnum_t *>
+        (_read_rank_section("rank_sizes",
+                            CS_LNUM_TYPE,
+                            CS_MESH_CACHE_N_DIMS + CS_MESH_CACHE_N_ARRAYS,
+                            inp));
+
+  m->n_cells = sizes[0];
+  m->n_cells_with_ghosts = sizes[1];
+  m->n_ghost_cells = sizes[1] - sizes[0];
+  m->n_i_faces = sizes[2];
+  m->n_b_faces = sizes[3];
+  m->n_vertices = sizes[4];
+  m->i_face_vtx_connect_size = sizes[5];
+  m->b_face_vtx_connect_size = sizes[6];
+
+  /* Local arrays */
+
+  void *halo_arr[4] = {nullptr, nullptr, nullptr, nullptr};
+  cs_lnum_t *num_info = nullptr, *num_g_idx = nullptr;
+
+  _cache_array_t a[CS_MESH_CACHE_N_ARRAYS];
+  _define_arrays(m, halo_arr, &num_info, &num_g_idx, a);
+
+  for (int i = 0; i < CS_MESH_CACHE_N_ARRAYS; i++) {
+    if (a[i].name == nullptr)
+      continue;
+    void *vals = _read_rank_section(a[i].name,
+                                    a[i].type,
+                                    sizes[CS_MESH_CACHE_N_DIMS + i],
+                                    inp);
+    BFT_FREE(*(a[i].p));
+    *(a[i].p) = vals;
+  }
+
+  cs_io_finalize(&inp);
+
+  /* Rebuild structures */
+
+  m->halo_type = halo_type;
+  m->n_domains = cs_glob_n_ranks;
+  m->domain_num = cs_glob_rank_id + 1;
+  m->have_r_gen = (m->i_face_r_gen != nullptr || m->vtx_r_gen != nullptr);
+
+  if (halo_arr[1] != nullptr) {
+    const cs_lnum_t *send_index = static_cast<const cs_lnum_t *>(halo_arr[1]);
+    int n_c_domains = sizes[CS_MESH_CACHE_N_DIMS + 14];
+    m->halo
+      = cs_halo_create_from_index(n_c_domains,
+                                  static_cast<const int *>(halo_arr[0]),
+                                  m->n_cells,
+                                  send_index,
+                                  static_cast<const cs_lnum_t *>(halo_arr[3]),
+                                  static_cast<const cs_lnum_t *>(halo_arr[2]));
+  }
+  for (int i = 0; i < 4; i++)
+    BFT_FREE(halo_arr[i]);
+
+  BFT_FREE(sizes);
+
+  if (cs_glob_n_ranks > 1)
+    m->vtx_interfaces = cs_interface_set_create(m->n_vertices,
+                                                nullptr,
+                                                m->global_vtx_num,
+                                                nullptr,
+                                                0,
+                                                nullptr,
+                                                nullptr,
+                                                nullptr);
+
+  _unpack_numbering(m, num_info, num_g_idx);
+
+  BFT_FREE(num_info);
+  BFT_FREE(num_g_idx);
+
+  cs_mesh_update_auxiliary(m);
+
+  m->modified = 0;
+
+  _loaded = true;
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_t dt;
+  CS_TIMER_COUNTER_INIT(dt);
+  cs_timer_counter_add_diff(&dt, &t0, &t1);
+
+  bft_printf(_("\n Mesh loaded from partitioned mesh cache \"%s\""
+               " (%.3g s)\n"),
+             name, dt.nsec*1e-9);
+
+  BFT_FREE(name);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Save the preprocessed local mesh to the partitioned mesh cache.
+ *
+ * This function does nothing if no cache directory is defined or if
+ * the mesh was loaded from the cache. It should be called once the mesh
+ * is partitioned and renumbered, and must follow a call to
+ * \ref cs_mesh_cache_read, which records the mesh input metadata.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]  m  pointer to mesh structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_write(const cs_mesh_t  *m)
+{
+  if (_cache_path == nullptr || _loaded)
+    return;
+
+  if (m->n_init_perio > 0) {
+    bft_printf(_("\n Partitioned mesh cache not written:\n"
+                 " periodicity is not handled.\n"));
+    return;
+  }
+
+  if (cs_glob_rank_id < 1) {
+    if (cs_file_mkdir_default(_cache_path) != 0)
+      bft_error(__FILE__, __LINE__, 0,
+                _("The %s directory cannot be created"), _cache_path);
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+
+  char *name = _cache_file_name();
+
+  cs_io_t *outp = _open(name, CS_IO_MODE_WRITE);
+
+  /* Global data */
+
+  cs_gnum_t sig[CS_MESH_CACHE_N_SIG]
+    = {(cs_gnum_t)cs_glob_n_ranks,
+       (cs_gnum_t)cs_glob_n_threads,
+       (cs_gnum_t)(m->halo_type),
+       _input_sig[0], _input_sig[1], _input_sig[2],
+       (cs_gnum_t)(m->n_groups),
+       (cs_gnum_t)(m->n_families),
+       (cs_gnum_t)(m->n_max_family_items),
+       _input_sig[3], _input_sig[4]};
+
+  cs_io_write_global("signature", CS_MESH_CACHE_N_SIG, 0, 0, 1,
+                     CS_GNUM_TYPE, sig, outp);
+
+  int group_idx_0 = 0;
+  cs_io_write_global("group_name_index", m->n_groups + 1, 0, 0, 1,
+                     CS_INT_TYPE,
+                     (m->group_idx != nullptr) ? m->group_idx : &group_idx_0,
+                     outp);
+  cs_io_write_global("group_name",
+                     (m->group_idx != nullptr) ? m->group_idx[m->n_groups] : 0,
+                     0, 0, 1, CS_CHAR, m->group, outp);
+  cs_io_write_global("group_class_properties",
+                     m->n_families*m->n_max_family_items, 0, 0, 1,
+                     CS_INT_TYPE, m->family_item, outp);
+
+  /* Local arrays */
+
+  const cs_halo_t *halo = m->halo;
+  void *halo_arr[4] = {nullptr, nullptr, nullptr, nullptr};
+  if (halo != nullptr) {
+    halo_arr[0] = halo->c_domain_rank;
+    halo_arr[1] = halo->send_index;
+    halo_arr[2] = halo->index;
+    halo_arr[3] = halo->send_list;
+  }
+
+  cs_lnum_t num_info[4*CS_MESH_CACHE_N_NUM_INFO];
+  cs_lnum_t *num_info_p = num_info, *num_g_idx = nullptr;
+
+  BFT_MALLOC(num_g_idx, _numbering_group_index_size(m), cs_lnum_t);
+  _pack_numbering(m, num_info, num_g_idx);
+
+  _cache_array_t a[CS_MESH_CACHE_N_ARRAYS];
+  _define_arrays(const_cast<cs_mesh_t *>(m),
+                 halo_arr, &num_info_p, &num_g_idx, a);
+
+  cs_lnum_t sizes[CS_MESH_CACHE_N_DIMS + CS_MESH_CACHE_N_ARRAYS]
+    = {m->n_cells, m->n_cells_with_ghosts, m->n_i_faces, m->n_b_faces,
+       m->n_vertices, m->i_face_vtx_connect_size, m->b_face_vtx_connect_size};
+  for (int i = 0; i < CS_MESH_CACHE_N_ARRAYS; i++)
+    sizes[CS_MESH_CACHE_N_DIMS + i] = a[i].n_vals;
+
+  _write_rank_section("rank_sizes",
+                      CS_LNUM_TYPE,
+                      CS_MESH_CACHE_N_DIMS + CS_MESH_CACHE_N_ARRAYS,
+                      sizes,
+                      outp);
+
+  for (int i = 0; i < CS_MESH_CACHE_N_ARRAYS; i++) {
+    if (a[i].name != nullptr)
+      _write_rank_section(a[i].name, a[i].type, a[i].n_vals, *(a[i].p), outp);
+  }
+
+  BFT_FREE(num_g_idx);
+
+  cs_io_finalize(&outp);
+
+  bft_printf(_("\n Mesh saved to partitioned mesh cache \"%s\"\n"), name);
+
+  BFT_FREE(name);
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
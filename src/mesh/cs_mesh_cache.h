@@ -0,0 +1,114 @@
+#ifndef __CS_MESH_CACHE_H__
+#define __CS_MESH_CACHE_H__
+
+/*============================================================================
+ * Partitioned mesh cache
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "cs_halo.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public C function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define the directory used for the partitioned mesh cache.
+ *
+ * When a directory is defined, the mesh obtained after preprocessing
+ * (reading, joining, partitioning, and renumbering) is saved there for
+ * the current number of ranks, and reloaded directly on subsequent
+ * runs using the same number of ranks and the same mesh input.
+ *
+ * This should be called from \ref cs_user_mesh_input, before the mesh
+ * is read.
+ *
+ * \param[in]  path  cache directory path, or NULL to disable the cache
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_set_path(const char  *path);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Try to load the local mesh from the partitioned mesh cache.
+ *
+ * The cache is used only if it was built with the same number of ranks
+ * and threads, the same halo type, the same mesh input dimensions
+ * (as read by \ref cs_preprocessor_data_read_headers) and mesh input
+ * file checksum, and the same joining, periodicity, warped faces cutting
+ * and preprocessing partitioning options as the current computation;
+ * otherwise, it is rebuilt. Mesh modifications by user functions are
+ * not detected, and for internally generated meshes, only dimensions
+ * are checked. Periodicity is not handled.
+ *
+ * This is a collective operation.
+ *
+ * \param[in, out]  m          pointer to mesh structure
+ * \param[in]       mb         pointer to mesh builder structure
+ *                             (with mesh input metadata)
+ * \param[in]       halo_type  requested halo type
+ *
+ * \return  true if the mesh was loaded from the cache, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_cache_read(cs_mesh_t                *m,
+                   const cs_mesh_builder_t  *mb,
+                   cs_halo_type_t            halo_type);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Save the preprocessed local mesh to the partitioned mesh cache.
+ *
+ * This function does nothing if no cache directory is defined or if
+ * the mesh was loaded from the cache. It should be called once the mesh
+ * is partitioned and renumbered, and must follow a call to
+ * \ref cs_mesh_cache_read, which records the mesh input metadata.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]  m  pointer to mesh structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cache_write(const cs_mesh_t  *m);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_CACHE_H__ */
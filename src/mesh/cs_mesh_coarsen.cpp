@@ -1758,25 +1758,20 @@ _filter_vertices(cs_mesh_t  *m,
   _update_vertices(m, n_vtx_new, v_o2n);
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*============================================================================
- * Public function definitions
- *============================================================================*/
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Coarsen flagged mesh cells.
+/*----------------------------------------------------------------------------
+ * Coarsen flagged mesh cells, optionally returning the old to new cells map.
  *
- * \param[in, out]  m           mesh
- * \param[in]       cell_flag   coarsening flag for each cell
- *                              (0: do not coarsen; 1: coarsen)
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   m         <-> mesh
+ *   cell_flag <-- coarsening flag for each cell (0: do not coarsen;
+ *                 1: coarsen)
+ *   c_o2n_p   --> pointer to old to new cells map, or NULL
+ *----------------------------------------------------------------------------*/
 
-void
-cs_mesh_coarsen_simple(cs_mesh_t  *m,
-                       const int   cell_flag[])
+static void
+_coarsen_cells(cs_mesh_t   *m,
+               const int    cell_flag[],
+               cs_lnum_t  **c_o2n_p)
 {
   /* Timers:
      0: total
@@ -1854,7 +1849,11 @@ cs_mesh_coarsen_simple(cs_mesh_t  *m,
   _merge_i_faces(m, n_i_f_new, i_f_o2n);
 
   BFT_FREE(i_f_o2n);
-  BFT_FREE(c_o2n);
+
+  if (c_o2n_p != NULL)
+    *c_o2n_p = c_o2n;
+  else
+    BFT_FREE(c_o2n);
 
   /* Then merge boundary faces */
 
@@ -1908,6 +1907,29 @@ cs_mesh_coarsen_simple(cs_mesh_t  *m,
   }
 }
 
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Coarsen flagged mesh cells.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       cell_flag   coarsening flag for each cell
+ *                              (0: do not coarsen; 1: coarsen)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_coarsen_simple(cs_mesh_t  *m,
+                       const int   cell_flag[])
+{
+  _coarsen_cells(m, cell_flag, NULL);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Coarsen selected mesh cells.
@@ -1945,6 +1967,101 @@ cs_mesh_coarsen_simple_selected(cs_mesh_t        *m,
   BFT_FREE(cell_flag);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Coarsen mesh cells based on an indicator, transferring
+ *        cell-based arrays to the coarsened mesh.
+ *
+ * Cells whose indicator is lower than the given threshold are flagged
+ * for coarsening; as for \ref cs_mesh_coarsen_simple, only cells
+ * resulting from a prior refinement of a same parent may be merged.
+ *
+ * Values of each array on merged cells are averaged, weighted by the
+ * (old) cell volumes if provided. Arrays must be allocated with
+ * BFT_MALLOC, and are reallocated to the new number of cells with ghosts;
+ * ghost values are synchronized when a halo is present.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       indicator   indicator value for each cell
+ * \param[in]       threshold   coarsen cells where indicator < threshold
+ * \param[in]       cell_vol    cell volumes before coarsening, or NULL
+ * \param[in]       n_arrays    number of cell-based arrays to transfer
+ * \param[in]       strides     stride of each array
+ * \param[in, out]  arrays      pointers to cell-based arrays
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_coarsen_indicator(cs_mesh_t        *m,
+                          const cs_real_t   indicator[],
+                          cs_real_t         threshold,
+                          const cs_real_t   cell_vol[],
+                          int               n_arrays,
+                          const int         strides[],
+                          cs_real_t        *arrays[])
+{
+  cs_lnum_t n_c_ini = m->n_cells;
+
+  int *cell_flag;
+  BFT_MALLOC(cell_flag, n_c_ini, int);
+  for (cs_lnum_t i = 0; i < n_c_ini; i++)
+    cell_flag[i] = (indicator[i] < threshold) ? 1 : 0;
+
+  cs_lnum_t *c_o2n = NULL;
+  _coarsen_cells(m, cell_flag, &c_o2n);
+
+  BFT_FREE(cell_flag);
+
+  const cs_lnum_t n_c_new = m->n_cells;
+  const cs_lnum_t n_c_ext = m->n_cells_with_ghosts;
+
+  /* Merged cell weights */
+
+  cs_real_t *w_sum;
+  BFT_MALLOC(w_sum, n_c_new, cs_real_t);
+  for (cs_lnum_t i = 0; i < n_c_new; i++)
+    w_sum[i] = 0;
+  for (cs_lnum_t i = 0; i < n_c_ini; i++)
+    w_sum[c_o2n[i]] += (cell_vol != NULL) ? cell_vol[i] : 1.;
+
+  /* Transfer arrays */
+
+  for (int a_id = 0; a_id < n_arrays; a_id++) {
+
+    const cs_lnum_t stride = strides[a_id];
+    cs_real_t *v = arrays[a_id];
+
+    cs_real_t *v_n;
+    BFT_MALLOC(v_n, n_c_ext*stride, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_c_ext*stride; i++)
+      v_n[i] = 0;
+
+    for (cs_lnum_t i = 0; i < n_c_ini; i++) {
+      cs_real_t w = (cell_vol != NULL) ? cell_vol[i] : 1.;
+      cs_lnum_t j = c_o2n[i];
+      for (cs_lnum_t k = 0; k < stride; k++)
+        v_n[j*stride + k] += w*v[i*stride + k];
+    }
+
+    for (cs_lnum_t j = 0; j < n_c_new; j++) {
+      if (w_sum[j] > 0) {
+        for (cs_lnum_t k = 0; k < stride; k++)
+          v_n[j*stride + k] /= w_sum[j];
+      }
+    }
+
+    if (m->halo != NULL)
+      cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD, v_n, stride);
+
+    BFT_FREE(arrays[a_id]);
+    arrays[a_id] = v_n;
+
+  }
+
+  BFT_FREE(w_sum);
+  BFT_FREE(c_o2n);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -80,6 +80,39 @@ cs_mesh_coarsen_simple_selected(cs_mesh_t        *m,
                                 cs_lnum_t         n_cells,
                                 const cs_lnum_t   cells[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Coarsen mesh cells based on an indicator, transferring
+ *        cell-based arrays to the coarsened mesh.
+ *
+ * Cells whose indicator is lower than the given threshold are flagged
+ * for coarsening; as for \ref cs_mesh_coarsen_simple, only cells
+ * resulting from a prior refinement of a same parent may be merged.
+ *
+ * Values of each array on merged cells are averaged, weighted by the
+ * (old) cell volumes if provided. Arrays must be allocated with
+ * BFT_MALLOC, and are reallocated to the new number of cells with ghosts;
+ * ghost values are synchronized when a halo is present.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       indicator   indicator value for each cell
+ * \param[in]       threshold   coarsen cells where indicator < threshold
+ * \param[in]       cell_vol    cell volumes before coarsening, or NULL
+ * \param[in]       n_arrays    number of cell-based arrays to transfer
+ * \param[in]       strides     stride of each array
+ * \param[in, out]  arrays      pointers to cell-based arrays
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_coarsen_indicator(cs_mesh_t        *m,
+                          const cs_real_t   indicator[],
+                          cs_real_t         threshold,
+                          const cs_real_t   cell_vol[],
+                          int               n_arrays,
+                          const int         strides[],
+                          cs_real_t        *arrays[]);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
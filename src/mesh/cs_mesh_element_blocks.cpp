@@ -0,0 +1,900 @@
+/*============================================================================
+ * Distributed mesh construction from nodal element blocks
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------
+ * Standard C library headers
+ *----------------------------------------------------------------------------*/
+
+#include <string.h>
+#include <stdlib.h>
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "fvm_nodal.h"
+
+#include "cs_all_to_all.h"
+#include "cs_block_dist.h"
+#include "cs_order.h"
+#include "cs_parall.h"
+
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_element_blocks.h"
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Local macro definitions
+ *============================================================================*/
+
+/* Face record: parent cell number, number of vertices, vertex numbers */
+
+#define CS_MESH_ELEMENT_BLOCKS_FACE_STRIDE  6
+
+/*============================================================================
+ * Structure definitions
+ *============================================================================*/
+
+/* Family definition */
+
+typedef struct {
+
+  int     family_num;    /* Family number in element blocks */
+  int     n_groups;      /* Number of associated groups */
+  char  **group_names;   /* Associated group names */
+
+} _family_def_t;
+
+/*============================================================================
+ * Private global variables
+ *============================================================================*/
+
+/* Flag to tell if element blocks were defined */
+
+static int _defined = 0;
+
+/* Family definitions, ordered by family number */
+
+static int             _n_families = 0;
+static _family_def_t  *_families = nullptr;
+static int             _gc_id_shift = 0;
+
+/* Local vertex slice */
+
+static cs_lnum_t   _n_vertices = 0;
+static cs_gnum_t   _vtx_shift = 0;
+static cs_real_t  *_vtx_coords = nullptr;
+
+/* Local cell slice */
+
+static cs_lnum_t   _n_cells = 0;
+static cs_gnum_t   _cell_shift = 0;
+static int        *_cell_family = nullptr;
+
+/* Face records generated from local cells and boundary face elements,
+   later replaced by matched faces */
+
+static cs_lnum_t   _n_face_rec = 0;
+static cs_lnum_t   _n_face_rec_max = 0;
+static cs_gnum_t  *_face_rec = nullptr;
+static int        *_face_family = nullptr;
+
+static cs_lnum_t   _n_faces = 0;
+static cs_gnum_t   _face_shift = 0;
+static cs_gnum_t  *_face_cells = nullptr;
+static cs_lnum_t  *_face_vtx_idx = nullptr;
+static cs_gnum_t  *_face_vtx = nullptr;
+
+/* Faces of standard cells, with outwards-pointing normals
+   (indexed by element type - FVM_CELL_TETRA) */
+
+static const int _n_cell_faces[4] = {4, 5, 5, 6};
+
+static const int _cell_face_vtx[4][6][4]
+  = {{{0, 2, 1, -1}, {0, 1, 3, -1}, {0, 3, 2, -1}, {1, 2, 3, -1}},
+     {{0, 1, 4, -1}, {0, 4, 3, -1}, {1, 2, 4, -1}, {2, 3, 4, -1},
+      {0, 3, 2, 1}},
+     {{0, 2, 1, -1}, {3, 4, 5, -1}, {0, 1, 4, 3}, {0, 3, 5, 2},
+      {1, 2, 5, 4}},
+     {{0, 3, 2, 1}, {0, 1, 5, 4}, {0, 4, 7, 3}, {1, 2, 6, 5},
+      {2, 3, 7, 6}, {4, 5, 6, 7}}};
+
+/*============================================================================
+ * Private function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Return group class id matching a given family number.
+ *
+ * parameters:
+ *   family_num <-- family number in element blocks
+ *
+ * returns:
+ *   matching group class id (1 for the default family)
+ *----------------------------------------------------------------------------*/
+
+static int
+_family_gc_id(int  family_num)
+{
+  int start_id = 0, end_id = _n_families;
+
+  while (start_id < end_id) {
+    int mid_id = start_id + (end_id - start_id)/2;
+    if (_families[mid_id].family_num < family_num)
+      start_id = mid_id + 1;
+    else
+      end_id = mid_id;
+  }
+
+  if (start_id < _n_families && _families[start_id].family_num == family_num)
+    return _gc_id_shift + start_id + 1;
+
+  return 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Reserve space for additional face records.
+ *
+ * parameters:
+ *   n_add <-- number of records to add
+ *----------------------------------------------------------------------------*/
+
+static void
+_reserve_face_rec(cs_lnum_t  n_add)
+{
+  if (_n_face_rec + n_add > _n_face_rec_max) {
+    _n_face_rec_max = CS_MAX(_n_face_rec_max*2, _n_face_rec + n_add);
+    BFT_REALLOC(_face_rec,
+                _n_face_rec_max*CS_MESH_ELEMENT_BLOCKS_FACE_STRIDE,
+                cs_gnum_t);
+    BFT_REALLOC(_face_family, _n_face_rec_max, int);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add families and associated groups to a mesh.
+ *
+ * parameters:
+ *   m <-> pointer to mesh structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_add_families(cs_mesh_t  *m)
+{
+  /* Ensure at least default family is present */
+  if (m->n_families == 0)
+    m->n_families = 1;
+
+  const int n_old = m->n_families;
+  const int n_new = n_old + _n_families;
+
+  int n_max_items = CS_MAX(m->n_max_family_items, 1);
+  int n_add_groups = 0;
+  for (int i = 0; i < _n_families; i++) {
+    n_max_items = CS_MAX(n_max_items, _families[i].n_groups);
+    n_add_groups += _families[i].n_groups;
+  }
+
+  /* Copy and pad previous definitions */
+
+  int *family_item;
+  BFT_MALLOC(family_item, n_new*n_max_items, int);
+
+  for (int j = 0; j < n_max_items; j++) {
+    for (int i = 0; i < n_new; i++) {
+      if (   i < n_old && j < m->n_max_family_items
+          && m->family_item != nullptr)
+        family_item[n_new*j + i] = m->family_item[n_old*j + i];
+      else
+        family_item[n_new*j + i] = 0;
+    }
+  }
+
+  /* Add groups, which may be duplicated here, as they are cleaned
+     later using cs_mesh_group_clean */
+
+  if (m->group_idx == nullptr) {
+    BFT_MALLOC(m->group_idx, m->n_groups + n_add_groups + 1, int);
+    m->group_idx[0] = 0;
+  }
+  else
+    BFT_REALLOC(m->group_idx, m->n_groups + n_add_groups + 1, int);
+
+  int g_id = m->n_groups;
+  for (int i = 0; i < _n_families; i++) {
+    for (int j = 0; j < _families[i].n_groups; j++) {
+      m->group_idx[g_id + 1] =   m->group_idx[g_id]
+                               + strlen(_families[i].group_names[j]) + 1;
+      family_item[n_new*j + n_old + i] = -(g_id + 1);
+      g_id++;
+    }
+  }
+
+  BFT_REALLOC(m->group, m->group_idx[g_id], char);
+
+  g_id = m->n_groups;
+  for (int i = 0; i < _n_families; i++) {
+    for (int j = 0; j < _families[i].n_groups; j++) {
+      strcpy(m->group + m->group_idx[g_id], _families[i].group_names[j]);
+      g_id++;
+    }
+  }
+
+  BFT_FREE(m->family_item);
+  m->family_item = family_item;
+  m->n_families = n_new;
+  m->n_max_family_items = n_max_items;
+  m->n_groups = g_id;
+
+  _gc_id_shift = n_old;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute global numbering shift and total count for local entities
+ *
+ * parameters:
+ *   n_ents  <-- number of local entities
+ *   n_g_ents --> global number of entities
+ *
+ * returns:
+ *   global number shift for local entities
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_global_shift(cs_lnum_t   n_ents,
+              cs_gnum_t  *n_g_ents)
+{
+  cs_gnum_t shift = 0;
+  cs_gnum_t n_g = n_ents;
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_gnum_t n_l = n_ents;
+    MPI_Scan(&n_l, &shift, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+    shift -= n_l;
+    MPI_Allreduce(&n_l, &n_g, 1, CS_MPI_GNUM, MPI_SUM, cs_glob_mpi_comm);
+  }
+#endif
+
+  *n_g_ents = n_g;
+
+  return shift;
+}
+
+/*----------------------------------------------------------------------------
+ * Match face records, building faces.
+ *
+ * Records sharing the same vertices are grouped; records with a parent
+ * cell define faces (with the orientation of the lowest numbered cell),
+ * while those with no parent cell only provide the face family.
+ *
+ * parameters:
+ *   n_rec      <-- number of face records
+ *   rec        <-- face records
+ *   rec_family <-- face record family numbers
+ *----------------------------------------------------------------------------*/
+
+static void
+_match_faces(cs_lnum_t         n_rec,
+             const cs_gnum_t   rec[],
+             const int         rec_family[])
+{
+  const int stride = CS_MESH_ELEMENT_BLOCKS_FACE_STRIDE;
+
+  /* Sort records by vertex tuple, then parent cell */
+
+  cs_gnum_t *key;
+  BFT_MALLOC(key, n_rec*5, cs_gnum_t);
+
+  for (cs_lnum_t i = 0; i < n_rec; i++) {
+    const cs_gnum_t *r = rec + i*stride;
+    cs_gnum_t *k = key + i*5;
+    int n_f_vtx = r[1];
+    for (int j = 0; j < 4; j++)
+      k[j] = (j < n_f_vtx) ? r[2+j] : 0;
+    for (int j = 1; j < n_f_vtx; j++) {
+      cs_gnum_t v = k[j];
+      int l = j - 1;
+      while (l >= 0 && k[l] > v) {
+        k[l+1] = k[l];
+        l--;
+      }
+      k[l+1] = v;
+    }
+    k[4] = r[0];
+  }
+
+  cs_lnum_t *order = cs_order_gnum_s(nullptr, key, 5, n_rec);
+
+  BFT_MALLOC(_face_cells, n_rec*2, cs_gnum_t);
+  BFT_MALLOC(_face_family, n_rec, int);
+  BFT_MALLOC(_face_vtx_idx, n_rec + 1, cs_lnum_t);
+  BFT_MALLOC(_face_vtx, n_rec*4, cs_gnum_t);
+
+  _face_vtx_idx[0] = 0;
+
+  cs_gnum_t n_isolated = 0, n_multiple = 0;
+
+  cs_lnum_t n_faces = 0;
+  cs_lnum_t s_id = 0;
+
+  while (s_id < n_rec) {
+
+    const cs_gnum_t *k0 = key + order[s_id]*5;
+    cs_lnum_t e_id = s_id + 1;
+    while (e_id < n_rec) {
+      const cs_gnum_t *k1 = key + order[e_id]*5;
+      if (   k1[0] != k0[0] || k1[1] != k0[1]
+          || k1[2] != k0[2] || k1[3] != k0[3])
+        break;
+      e_id++;
+    }
+
+    int family_num = 0, n_f_cells = 0;
+    bool have_family = false;
+    cs_gnum_t c_num[2] = {0, 0};
+    const cs_gnum_t *r_f = nullptr;
+
+    for (cs_lnum_t i = s_id; i < e_id; i++) {
+      const cs_gnum_t *r = rec + order[i]*stride;
+      if (r[0] == 0) {
+        family_num = rec_family[order[i]];
+        have_family = true;
+      }
+      else {
+        if (n_f_cells == 0)
+          r_f = r;
+        if (n_f_cells < 2)
+          c_num[n_f_cells] = r[0];
+        n_f_cells++;
+      }
+    }
+
+    if (n_f_cells == 0)
+      n_isolated++;
+    else {
+      if (n_f_cells > 2)
+        n_multiple++;
+      _face_cells[n_faces*2]     = c_num[0];
+      _face_cells[n_faces*2 + 1] = c_num[1];
+      _face_family[n_faces] = (have_family) ? _family_gc_id(family_num) : 1;
+      cs_lnum_t n_f_vtx = r_f[1];
+      for (cs_lnum_t j = 0; j < n_f_vtx; j++)
+        _face_vtx[_face_vtx_idx[n_faces] + j] = r_f[2+j];
+      _face_vtx_idx[n_faces + 1] = _face_vtx_idx[n_faces] + n_f_vtx;
+      n_faces++;
+    }
+
+    s_id = e_id;
+  }
+
+  BFT_FREE(order);
+  BFT_FREE(key);
+
+  _n_faces = n_faces;
+
+  BFT_REALLOC(_face_cells, n_faces*2, cs_gnum_t);
+  BFT_REALLOC(_face_family, n_faces, int);
+  BFT_REALLOC(_face_vtx_idx, n_faces + 1, cs_lnum_t);
+  BFT_REALLOC(_face_vtx, _face_vtx_idx[n_faces], cs_gnum_t);
+
+  cs_parall_counter(&n_isolated, 1);
+  cs_parall_counter(&n_multiple, 1);
+
+  if (n_multiple > 0)
+    bft_error(__FILE__, __LINE__, 0,
+              _("Error building faces from element blocks:\n"
+                "  %llu faces are shared by more than 2 cells."),
+              (unsigned long long)n_multiple);
+
+  if (n_isolated > 0)
+    bft_printf(_("\n %llu face elements not matching any cell face"
+                 " were ignored.\n"),
+               (unsigned long long)n_isolated);
+}
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a family referenced by element blocks.
+ *
+ * Family numbers are those found in the input (for example MED family
+ * numbers or CGNS zone/boundary condition ids); elements referencing
+ * an undefined family number are assigned to the default family.
+ *
+ * This function should be called with the same arguments on all ranks.
+ *
+ * \param[in]  family_num   family number in element blocks
+ * \param[in]  n_groups     number of groups for this family
+ * \param[in]  group_names  names of groups for this family
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_element_blocks_define_family(int                family_num,
+                                     int                n_groups,
+                                     const char *const  group_names[])
+{
+  /* Insert family in ordered list */
+
+  int f_id = _n_families;
+  while (f_id > 0 && _families[f_id-1].family_num > family_num)
+    f_id--;
+
+  if (f_id > 0 && _families[f_id-1].family_num == family_num)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: family number %d is already defined."),
+              __func__, family_num);
+
+  BFT_REALLOC(_families, _n_families + 1, _family_def_t);
+  for (int i = _n_families; i > f_id; i--)
+    _families[i] = _families[i-1];
+  _n_families += 1;
+
+  _family_def_t *f = _families + f_id;
+
+  f->family_num = family_num;
+  f->n_groups = n_groups;
+  BFT_MALLOC(f->group_names, n_groups, char *);
+  for (int i = 0; i < n_groups; i++) {
+    BFT_MALLOC(f->group_names[i], strlen(group_names[i]) + 1, char);
+    strcpy(f->group_names[i], group_names[i]);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a slice of vertices for mesh construction from element blocks.
+ *
+ * Global vertex numbers are implicitly defined by concatenation of the
+ * slices added on each rank, in rank order. This function should be
+ * called on all ranks, possibly with an empty slice.
+ *
+ * \param[in]  n_vertices  number of vertices in slice
+ * \param[in]  coords      vertex coordinates (interlaced)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_element_blocks_add_vertices(cs_lnum_t        n_vertices,
+                                    const cs_real_t  coords[])
+{
+  _defined = 1;
+
+  BFT_REALLOC(_vtx_coords, (_n_vertices + n_vertices)*3, cs_real_t);
+  memcpy(_vtx_coords + _n_vertices*3,
+         coords,
+         n_vertices*3*sizeof(cs_real_t));
+
+  _n_vertices += n_vertices;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a slice of an element block for mesh construction.
+ *
+ * Cells (tetrahedra, pyramids, prisms, hexahedra) define the mesh;
+ * faces (triangles, quadrangles) are used only to assign families to
+ * matching cell faces. Vertex ordering follows the FVM (and MED/CGNS)
+ * nodal convention, and vertices are referenced by global number.
+ *
+ * Global cell numbers are implicitly defined by concatenation of the
+ * cell slices added on each rank, in rank order. This function should
+ * be called on all ranks, possibly with an empty slice.
+ *
+ * \param[in]  type        element type
+ * \param[in]  n_elts      number of elements in slice
+ * \param[in]  vertex_num  global element vertex numbers (1 to n)
+ * \param[in]  family_num  element family numbers, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_element_blocks_add(fvm_element_t    type,
+                           cs_lnum_t        n_elts,
+                           const cs_gnum_t  vertex_num[],
+                           const int        family_num[])
+{
+  const int stride = CS_MESH_ELEMENT_BLOCKS_FACE_STRIDE;
+  const int n_e_vtx = fvm_nodal_n_vertices_element[type];
+
+  _defined = 1;
+
+  if (type >= FVM_CELL_TETRA && type <= FVM_CELL_HEXA) {
+
+    const int t_id = type - FVM_CELL_TETRA;
+    const int n_c_faces = _n_cell_faces[t_id];
+
+    BFT_REALLOC(_cell_family, _n_cells + n_elts, int);
+
+    _reserve_face_rec(n_elts*n_c_faces);
+
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+
+      const cs_gnum_t *e_vtx = vertex_num + i*n_e_vtx;
+
+      _cell_family[_n_cells + i] = (family_num != nullptr) ? family_num[i] : 0;
+
+      /* Parent cell numbers are local here, and shifted when building
+         faces, once global cell numbering is known */
+
+      for (int j = 0; j < n_c_faces; j++) {
+        const int *fv = _cell_face_vtx[t_id][j];
+        cs_gnum_t *r = _face_rec + _n_face_rec*stride;
+        int n_f_vtx = (fv[3] < 0) ? 3 : 4;
+        r[0] = _n_cells + i + 1;
+        r[1] = n_f_vtx;
+        for (int k = 0; k < 4; k++)
+          r[2+k] = (k < n_f_vtx) ? e_vtx[fv[k]] : 0;
+        _face_family[_n_face_rec] = 0;
+        _n_face_rec++;
+      }
+
+    }
+
+    _n_cells += n_elts;
+
+  }
+  else if (type == FVM_FACE_TRIA || type == FVM_FACE_QUAD) {
+
+    _reserve_face_rec(n_elts);
+
+    for (cs_lnum_t i = 0; i < n_elts; i++) {
+      cs_gnum_t *r = _face_rec + _n_face_rec*stride;
+      r[0] = 0;
+      r[1] = n_e_vtx;
+      for (int k = 0; k < 4; k++)
+        r[2+k] = (k < n_e_vtx) ? vertex_num[i*n_e_vtx + k] : 0;
+      _face_family[_n_face_rec] = (family_num != nullptr) ? family_num[i] : 0;
+      _n_face_rec++;
+    }
+
+  }
+  else
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: element type \"%s\" is not handled."),
+              __func__, fvm_element_type_name[type]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if a mesh should be built from element blocks.
+ *
+ * \returns 1 if element blocks were defined, 0 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_mesh_element_blocks_need_build(void)
+{
+  return _defined;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build faces from element blocks and set mesh dimensions.
+ *
+ * Faces are generated from the cells of each rank's slices, and matched
+ * in parallel on ranks chosen by their lowest vertex number, so that
+ * no rank ever needs the whole mesh. Families are translated locally
+ * to group classes added to the mesh.
+ *
+ * This is a collective operation.
+ *
+ * \param[in, out]  m   pointer to mesh structure
+ * \param[in, out]  mb  pointer to mesh builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_element_blocks_build_faces(cs_mesh_t          *m,
+                                   cs_mesh_builder_t  *mb)
+{
+  const int stride = CS_MESH_ELEMENT_BLOCKS_FACE_STRIDE;
+
+  cs_gnum_t n_g_cells = 0, n_g_vertices = 0, n_g_faces = 0;
+
+  _add_families(m);
+
+  /* Global numbering of cells and vertices */
+
+  _cell_shift = _global_shift(_n_cells, &n_g_cells);
+  _vtx_shift = _global_shift(_n_vertices, &n_g_vertices);
+
+  for (cs_lnum_t i = 0; i < _n_face_rec; i++) {
+    if (_face_rec[i*stride] > 0)
+      _face_rec[i*stride] += _cell_shift;
+  }
+
+  for (cs_lnum_t i = 0; i < _n_cells; i++)
+    _cell_family[i] = _family_gc_id(_cell_family[i]);
+
+  /* Gather records of a same face on the rank owning its lowest vertex */
+
+  cs_lnum_t   n_rec = _n_face_rec;
+  cs_gnum_t  *rec = _face_rec;
+  int        *rec_family = _face_family;
+
+  _face_rec = nullptr;
+  _face_family = nullptr;
+  _n_face_rec = 0;
+  _n_face_rec_max = 0;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    cs_block_dist_info_t bi
+      = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    1,
+                                    0,
+                                    n_g_vertices);
+
+    cs_gnum_t *min_vtx;
+    BFT_MALLOC(min_vtx, n_rec, cs_gnum_t);
+
+    for (cs_lnum_t i = 0; i < n_rec; i++) {
+      const cs_gnum_t *r = rec + i*stride;
+      min_vtx[i] = r[2];
+      for (cs_gnum_t j = 1; j < r[1]; j++)
+        min_vtx[i] = CS_MIN(min_vtx[i], r[2+j]);
+    }
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(n_rec,
+                                        0, /* flags */
+                                        min_vtx,
+                                        bi,
+                                        cs_glob_mpi_comm);
+
+    cs_gnum_t *b_rec = cs_all_to_all_copy_array(d, stride, false, rec);
+    int *b_rec_family = cs_all_to_all_copy_array(d, 1, false, rec_family);
+
+    n_rec = cs_all_to_all_n_elts_dest(d);
+
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(min_vtx);
+    BFT_FREE(rec);
+    BFT_FREE(rec_family);
+
+    rec = b_rec;
+    rec_family = b_rec_family;
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  _match_faces(n_rec, rec, rec_family);
+
+  BFT_FREE(rec);
+  BFT_FREE(rec_family);
+
+  /* Global numbering of faces */
+
+  _face_shift = _global_shift(_n_faces, &n_g_faces);
+
+  cs_gnum_t n_g_face_connect_size = _face_vtx_idx[_n_faces];
+  cs_parall_counter(&n_g_face_connect_size, 1);
+
+  m->n_g_cells = n_g_cells;
+  m->n_g_vertices = n_g_vertices;
+
+  mb->n_g_faces = n_g_faces;
+  mb->n_g_face_connect_size = n_g_face_connect_size;
+
+  bft_printf(_("\n Mesh built from element blocks:\n\n"
+               "   Number of cells:          %llu\n"
+               "   Number of faces:          %llu\n"
+               "   Number of vertices:       %llu\n"),
+             (unsigned long long)n_g_cells,
+             (unsigned long long)n_g_faces,
+             (unsigned long long)n_g_vertices);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Distribute mesh data built from element blocks to the mesh
+ *        builder's block distribution.
+ *
+ * Block ranges must have been set in the mesh builder, and
+ * \ref cs_mesh_element_blocks_build_faces must have been called.
+ * Element block data is freed once transferred.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]       m   pointer to mesh structure
+ * \param[in, out]  mb  pointer to mesh builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_element_blocks_to_builder(const cs_mesh_t    *m,
+                                  cs_mesh_builder_t  *mb)
+{
+  CS_UNUSED(m);
+
+  cs_lnum_t n_cells = (mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0]);
+  cs_lnum_t n_faces = (mb->face_bi.gnum_range[1] - mb->face_bi.gnum_range[0]);
+  cs_lnum_t n_vertices = (  mb->vertex_bi.gnum_range[1]
+                          - mb->vertex_bi.gnum_range[0]);
+
+  BFT_MALLOC(mb->cell_gc_id, n_cells, int);
+  BFT_MALLOC(mb->vertex_coords, n_vertices*3, cs_real_t);
+  BFT_MALLOC(mb->face_cells, n_faces*2, cs_gnum_t);
+  BFT_MALLOC(mb->face_gc_id, n_faces, int);
+  BFT_MALLOC(mb->face_vertices_idx, n_faces + 1, cs_lnum_t);
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    MPI_Comm comm = cs_glob_mpi_comm;
+    cs_gnum_t *g_num;
+    cs_all_to_all_t *d;
+
+    /* Cells */
+
+    BFT_MALLOC(g_num, CS_MAX(_n_cells, CS_MAX(_n_faces, _n_vertices)),
+               cs_gnum_t);
+
+    for (cs_lnum_t i = 0; i < _n_cells; i++)
+      g_num[i] = _cell_shift + i + 1;
+
+    d = cs_all_to_all_create_from_block(_n_cells,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        g_num,
+                                        mb->cell_bi,
+                                        comm);
+
+    cs_all_to_all_copy_array(d, 1, false, _cell_family, mb->cell_gc_id);
+
+    cs_all_to_all_destroy(&d);
+
+    /* Vertices */
+
+    for (cs_lnum_t i = 0; i < _n_vertices; i++)
+      g_num[i] = _vtx_shift + i + 1;
+
+    d = cs_all_to_all_create_from_block(_n_vertices,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        g_num,
+                                        mb->vertex_bi,
+                                        comm);
+
+    cs_all_to_all_copy_array(d, 3, false, _vtx_coords, mb->vertex_coords);
+
+    cs_all_to_all_destroy(&d);
+
+    /* Faces */
+
+    for (cs_lnum_t i = 0; i < _n_faces; i++)
+      g_num[i] = _face_shift + i + 1;
+
+    d = cs_all_to_all_create_from_block(_n_faces,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        g_num,
+                                        mb->face_bi,
+                                        comm);
+
+    cs_all_to_all_copy_array(d, 2, false, _face_cells, mb->face_cells);
+    cs_all_to_all_copy_array(d, 1, false, _face_family, mb->face_gc_id);
+
+    cs_all_to_all_copy_index(d, false, _face_vtx_idx, mb->face_vertices_idx);
+
+    BFT_MALLOC(mb->face_vertices,
+               mb->face_vertices_idx[n_faces],
+               cs_gnum_t);
+
+    cs_all_to_all_copy_indexed(d,
+                               false,
+                               _face_vtx_idx,
+                               _face_vtx,
+                               mb->face_vertices_idx,
+                               mb->face_vertices);
+
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(g_num);
+
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  if (cs_glob_n_ranks == 1) {
+
+    memcpy(mb->cell_gc_id, _cell_family, n_cells*sizeof(int));
+    memcpy(mb->vertex_coords, _vtx_coords, n_vertices*3*sizeof(cs_real_t));
+    memcpy(mb->face_cells, _face_cells, n_faces*2*sizeof(cs_gnum_t));
+    memcpy(mb->face_gc_id, _face_family, n_faces*sizeof(int));
+    memcpy(mb->face_vertices_idx, _face_vtx_idx,
+           (n_faces+1)*sizeof(cs_lnum_t));
+
+    BFT_MALLOC(mb->face_vertices, _face_vtx_idx[n_faces], cs_gnum_t);
+    memcpy(mb->face_vertices, _face_vtx,
+           _face_vtx_idx[n_faces]*sizeof(cs_gnum_t));
+
+  }
+
+  /* Free data which is not needed anymore, keeping only definitions */
+
+  BFT_FREE(_vtx_coords);
+  BFT_FREE(_cell_family);
+  BFT_FREE(_face_cells);
+  BFT_FREE(_face_family);
+  BFT_FREE(_face_vtx_idx);
+  BFT_FREE(_face_vtx);
+
+  _n_vertices = 0;
+  _n_cells = 0;
+  _n_faces = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free element block definitions.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_element_blocks_destroy(void)
+{
+  for (int i = 0; i < _n_families; i++) {
+    for (int j = 0; j < _families[i].n_groups; j++)
+      BFT_FREE(_families[i].group_names[j]);
+    BFT_FREE(_families[i].group_names);
+  }
+  BFT_FREE(_families);
+  _n_families = 0;
+
+  BFT_FREE(_vtx_coords);
+  BFT_FREE(_cell_family);
+  BFT_FREE(_face_rec);
+  BFT_FREE(_face_cells);
+  BFT_FREE(_face_family);
+  BFT_FREE(_face_vtx_idx);
+  BFT_FREE(_face_vtx);
+
+  _n_vertices = 0;
+  _n_cells = 0;
+  _n_face_rec = 0;
+  _n_face_rec_max = 0;
+  _n_faces = 0;
+
+  _defined = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
@@ -0,0 +1,173 @@
+#ifndef __CS_MESH_ELEMENT_BLOCKS_H__
+#define __CS_MESH_ELEMENT_BLOCKS_H__
+
+/*============================================================================
+ * Distributed mesh construction from nodal element blocks
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------
+ * Local headers
+ *----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include "fvm_defs.h"
+
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public C function prototypes
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a family referenced by element blocks.
+ *
+ * Family numbers are those found in the input (for example MED family
+ * numbers or CGNS zone/boundary condition ids); elements referencing
+ * an undefined family number are assigned to the default family.
+ *
+ * This function should be called with the same arguments on all ranks.
+ *
+ * \param[in]  family_num   family number in element blocks
+ * \param[in]  n_groups     number of groups for this family
+ * \param[in]  group_names  names of groups for this family
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_element_blocks_define_family(int                family_num,
+                                     int                n_groups,
+                                     const char *const  group_names[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a slice of vertices for mesh construction from element blocks.
+ *
+ * Global vertex numbers are implicitly defined by concatenation of the
+ * slices added on each rank, in rank order. This function should be
+ * called on all ranks, possibly with an empty slice.
+ *
+ * \param[in]  n_vertices  number of vertices in slice
+ * \param[in]  coords      vertex coordinates (interlaced)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_element_blocks_add_vertices(cs_lnum_t        n_vertices,
+                                    const cs_real_t  coords[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Add a slice of an element block for mesh construction.
+ *
+ * Cells (tetrahedra, pyramids, prisms, hexahedra) define the mesh;
+ * faces (triangles, quadrangles) are used only to assign families to
+ * matching cell faces. Vertex ordering follows the FVM (and MED/CGNS)
+ * nodal convention, and vertices are referenced by global number.
+ *
+ * Global cell numbers are implicitly defined by concatenation of the
+ * cell slices added on each rank, in rank order. This function should
+ * be called on all ranks, possibly with an empty slice.
+ *
+ * \param[in]  type        element type
+ * \param[in]  n_elts      number of elements in slice
+ * \param[in]  vertex_num  global element vertex numbers (1 to n)
+ * \param[in]  family_num  element family numbers, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_element_blocks_add(fvm_element_t    type,
+                           cs_lnum_t        n_elts,
+                           const cs_gnum_t  vertex_num[],
+                           const int        family_num[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate if a mesh should be built from element blocks.
+ *
+ * \returns 1 if element blocks were defined, 0 otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_mesh_element_blocks_need_build(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build faces from element blocks and set mesh dimensions.
+ *
+ * Faces are generated from the cells of each rank's slices, and matched
+ * in parallel on ranks chosen by their lowest vertex number, so that
+ * no rank ever needs the whole mesh. Families are translated locally
+ * to group classes added to the mesh.
+ *
+ * This is a collective operation.
+ *
+ * \param[in, out]  m   pointer to mesh structure
+ * \param[in, out]  mb  pointer to mesh builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_element_blocks_build_faces(cs_mesh_t          *m,
+                                   cs_mesh_builder_t  *mb);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Distribute mesh data built from element blocks to the mesh
+ *        builder's block distribution.
+ *
+ * Block ranges must have been set in the mesh builder, and
+ * \ref cs_mesh_element_blocks_build_faces must have been called.
+ * Element block data is freed once transferred.
+ *
+ * This is a collective operation.
+ *
+ * \param[in]       m   pointer to mesh structure
+ * \param[in, out]  mb  pointer to mesh builder structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_element_blocks_to_builder(const cs_mesh_t    *m,
+                                  cs_mesh_builder_t  *mb);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free element block definitions.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_element_blocks_destroy(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
+#endif /* __CS_MESH_ELEMENT_BLOCKS_H__ */
@@ -46,7 +46,9 @@
 #include "cs_mesh_boundary.h"
 #include "cs_mesh_boundary_layer.h"
 #include "cs_mesh_builder.h"
+#include "cs_mesh_cache.h"
 #include "cs_mesh_cartesian.h"
+#include "cs_mesh_element_blocks.h"
 #include "cs_mesh_coarsen.h"
 #include "cs_mesh_coherency.h"
 #include "cs_mesh_connect.h"
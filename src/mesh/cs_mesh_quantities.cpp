@@ -47,6 +47,8 @@
 
 #include "cs_array.h"
 #include "cs_base.h"
+#include "cs_base_accel.h"
+#include "cs_dispatch.h"
 #include "cs_halo_perio.h"
 #include "cs_log.h"
 #include "cs_math.h"
@@ -339,6 +341,36 @@ _compute_corr_grad_lin(const cs_mesh_t       *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Check whether all arrays used by a kernel may be accessed on the device.
+ *
+ * Kernels are dispatched on the device only when this is the case,
+ * so that no host-device copy of mesh data is required.
+ *
+ * parameters:
+ *   n_ptrs <-- number of arrays
+ *   ptrs   <-- pointers to arrays (null pointers are ignored)
+ *
+ * returns:
+ *   true if all arrays use shared host-device memory
+ *----------------------------------------------------------------------------*/
+
+static bool
+_device_accessible(int          n_ptrs,
+                   const void  *ptrs[])
+{
+  if (cs_get_device_id() < 0)
+    return false;
+
+  for (int i = 0; i < n_ptrs; i++) {
+    if (   ptrs[i] != nullptr
+        && cs_check_device_ptr(ptrs[i]) != CS_ALLOC_HOST_DEVICE_SHARED)
+      return false;
+  }
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Compute quantities associated to faces (border or internal)
  *
@@ -381,10 +413,14 @@ _compute_face_quantities(cs_lnum_t        n_faces,
   const cs_real_t one_third = 1./3.;
   const cs_real_t s_epsilon = 1.e-32; /* TODO define better "zero" threshold */
 
+  cs_dispatch_context ctx;
+  const void *ptrs[] = {vtx_coord, face_vtx_idx, face_vtx,
+                        face_cog, face_normal};
+  ctx.set_use_gpu(_device_accessible(5, ptrs));
+
   /* Loop on faces */
 
-# pragma omp parallel for  if (n_faces > CS_THR_MIN)
-  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+  ctx.parallel_for(n_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_id) {
 
     /* Define the polygon (P) according to the vertices (Pi) of the face */
 
@@ -549,7 +585,9 @@ _compute_face_quantities(cs_lnum_t        n_faces,
 
     } /* end of test on triangle */
 
-  } /* end of loop on faces */
+  }); /* end of loop on faces */
+
+  ctx.wait();
 }
 
 /*----------------------------------------------------------------------------
@@ -589,10 +627,13 @@ _compute_face_normal(cs_lnum_t         n_faces,
 
   assert(face_normal != nullptr || n_faces == 0);
 
+  cs_dispatch_context ctx;
+  const void *ptrs[] = {vtx_coord, face_vtx_idx, face_vtx, face_normal};
+  ctx.set_use_gpu(_device_accessible(4, ptrs));
+
   /* Loop on faces */
 
-# pragma omp parallel for  if (n_faces > CS_THR_MIN)
-  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++) {
+  ctx.parallel_for(n_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_id) {
 
     /* Define the polygon (P) according to the vertices (Pi) of the face */
 
@@ -658,7 +699,9 @@ _compute_face_normal(cs_lnum_t         n_faces,
 
     } /* end of test on triangle */
 
-  } /* end of loop on faces */
+  }); /* end of loop on faces */
+
+  ctx.wait();
 }
 
 /*----------------------------------------------------------------------------
@@ -675,9 +718,15 @@ _compute_face_surface(cs_lnum_t        n_faces,
                       const cs_real_t  face_norm[],
                       cs_real_t        face_surf[])
 {
-# pragma omp parallel for  if (n_faces > CS_THR_MIN)
-  for (cs_lnum_t f_id = 0; f_id < n_faces; f_id++)
+  cs_dispatch_context ctx;
+  const void *ptrs[] = {face_norm, face_surf};
+  ctx.set_use_gpu(_device_accessible(2, ptrs));
+
+  ctx.parallel_for(n_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_id) {
     face_surf[f_id] = cs_math_3_norm(face_norm + f_id*3);
+  });
+
+  ctx.wait();
 }
 
 /*----------------------------------------------------------------------------
@@ -1737,8 +1786,10 @@ _cell_volume_reductions(const cs_mesh_t  *mesh,
  * Compute some distances relative to faces and associated weighting.
  *
  * parameters:
- *   n_i_faces      <--  number of interior faces
- *   n_b_faces      <--  number of border  faces
+ *   n_i_faces      <--  number of interior faces (or listed faces)
+ *   n_b_faces      <--  number of border faces (or listed faces)
+ *   i_face_ids     <--  optional list of interior faces, or nullptr
+ *   b_face_ids     <--  optional list of border faces, or nullptr
  *   i_face_cells   <--  interior "faces -> cells" connectivity
  *   b_face_cells   <--  border "faces -> cells" connectivity
  *   i_face_u_norm  <--  unit normal of interior faces
@@ -1757,6 +1808,8 @@ _cell_volume_reductions(const cs_mesh_t  *mesh,
 static void
 _compute_face_distances(cs_lnum_t        n_i_faces,
                         cs_lnum_t        n_b_faces,
+                        const cs_lnum_t  i_face_ids[],
+                        const cs_lnum_t  b_face_ids[],
                         const cs_lnum_t  i_face_cells[][2],
                         const cs_lnum_t  b_face_cells[],
                         const cs_real_t  i_face_u_normal[][3],
@@ -1771,11 +1824,26 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
                         cs_real_t        b_dist[],
                         cs_real_t        weight[])
 {
-  cs_gnum_t w_count[2] = {0};
+  const int mq_flag = cs_glob_mesh_quantities_flag;
+
+  cs_dispatch_context ctx;
+  const void *ptrs[] = {i_face_ids, b_face_ids, i_face_cells, b_face_cells,
+                        i_face_u_normal, i_face_normal,
+                        b_face_u_normal, b_face_normal,
+                        i_face_cog, b_face_cog, cell_cen, cell_vol,
+                        i_dist, b_dist, weight};
+  ctx.set_use_gpu(_device_accessible(15, ptrs));
+
+  double w_count[2] = {0, 0};
 
   /* Interior faces */
 
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+  ctx.parallel_for_reduce_sum
+    (n_i_faces, w_count[0], [=] CS_F_HOST_DEVICE
+     (cs_lnum_t f_idx, CS_DISPATCH_SUM_DOUBLE &sum) {
+
+    const cs_lnum_t face_id
+      = (i_face_ids != nullptr) ? i_face_ids[f_idx] : f_idx;
 
     const cs_real_t *u_normal = i_face_u_normal[face_id];
 
@@ -1802,7 +1870,7 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
     }
 
     /* Clipping of cell cell distances */
-    if (cs_glob_mesh_quantities_flag & CS_FACE_DISTANCE_CLIP) {
+    if (mq_flag & CS_FACE_DISTANCE_CLIP) {
 
       /* Min value between IJ and
        * (Omega_i+Omega_j)/S_ij which is exactly the distance for tetras */
@@ -1813,7 +1881,7 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
       /* If CS_FACE_NULL_SURFACE is used, only update distmax value
        * if the face surface is not 0.
        */
-      if (   !(cs_glob_mesh_quantities_flag & CS_FACE_NULL_SURFACE)
+      if (   !(mq_flag & CS_FACE_NULL_SURFACE)
           && face_normal_norm > 1.e-20)
         distmax = cs_math_fmin(cs_math_3_distance(cell_cen[cell_id1],
                                                   cell_cen[cell_id2]),
@@ -1824,12 +1892,12 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
       /* 0.01 seems better and safer for the moment */
       const cs_real_t critmin = 0.01;
       if (i_dist[face_id] < critmin * distmax) {
-        w_count[0] += 1;
+        sum += 1;
         i_dist[face_id] = cs_math_fmax(i_dist[face_id], critmin * distmax);
       }
 
       /* Clippings due to null surface */
-      if (cs_glob_mesh_quantities_flag & CS_FACE_NULL_SURFACE) {
+      if (mq_flag & CS_FACE_NULL_SURFACE) {
         if (face_normal_norm <= 1.e-20)
           i_dist[face_id] = cs_math_3_distance(cell_cen[cell_id1],
                                                cell_cen[cell_id2]);
@@ -1845,11 +1913,16 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
       weight[face_id] = cs_math_fmax(weight[face_id], 0.001);
       weight[face_id] = cs_math_fmin(weight[face_id], 0.999);
     }
-  }
+  });
 
   /* Boundary faces */
 
-  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+  ctx.parallel_for_reduce_sum
+    (n_b_faces, w_count[1], [=] CS_F_HOST_DEVICE
+     (cs_lnum_t f_idx, CS_DISPATCH_SUM_DOUBLE &sum) {
+
+    const cs_lnum_t face_id
+      = (b_face_ids != nullptr) ? b_face_ids[f_idx] : f_idx;
 
     const cs_real_t *normal = b_face_u_normal[face_id];
 
@@ -1861,7 +1934,7 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
                                                      b_face_cog[face_id],
                                                      normal);
     /* Clipping of cell boundary distances */
-    if (cs_glob_mesh_quantities_flag & CS_FACE_DISTANCE_CLIP) {
+    if (mq_flag & CS_FACE_DISTANCE_CLIP) {
 
       /* Min value between IF and
        * (Omega_i)/S which is exactly the distance for tetrahedra */
@@ -1871,7 +1944,7 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
       /* If CS_FACE_NULL_SURFACE is used, only update distmax value
        * if the face surface is not 0.
        */
-      if (   !(cs_glob_mesh_quantities_flag & CS_FACE_NULL_SURFACE)
+      if (   !(mq_flag & CS_FACE_NULL_SURFACE)
           && face_normal_norm > 1.e-20) {
         distmax = fmin(cs_math_3_distance(cell_cen[cell_id],
                                           b_face_cog[face_id]),
@@ -1880,12 +1953,12 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
 
       double critmin = 0.01;
       if (b_dist[face_id] < critmin * distmax) {
-        w_count[1] += 1;
+        sum += 1;
         b_dist[face_id] = fmax(b_dist[face_id], critmin * distmax);
       }
 
       /* Clippings due to null surface */
-      if (cs_glob_mesh_quantities_flag & CS_FACE_NULL_SURFACE) {
+      if (mq_flag & CS_FACE_NULL_SURFACE) {
         if (face_normal_norm <= 1.e-20)
           b_dist[face_id] = cs_math_3_distance(cell_cen[cell_id],
                                                b_face_cog[face_id]);
@@ -1898,22 +1971,25 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
       }
 
     }
-  }
+  });
 
-  cs_parall_counter(w_count, 2);
+  ctx.wait();
 
-  if (w_count[0] > 0)
+  cs_gnum_t n_clip[2] = {(cs_gnum_t)w_count[0], (cs_gnum_t)w_count[1]};
+  cs_parall_counter(n_clip, 2);
+
+  if (n_clip[0] > 0)
     bft_printf(_("\n"
                  "%llu faces have a too small distance between centers.\n"
                  "For these faces, the weight may be clipped.\n"),
-               (unsigned long long)w_count[0]);
+               (unsigned long long)n_clip[0]);
 
 
-  if (w_count[1] > 0)
+  if (n_clip[1] > 0)
     bft_printf(_("\n"
                  "%llu boundary faces have a too small distance between\n"
                  "cell center and face center.\n"),
-               (unsigned long long)w_count[1]);
+               (unsigned long long)n_clip[1]);
 }
 
 /*----------------------------------------------------------------------------
@@ -1941,8 +2017,10 @@ _compute_face_distances(cs_lnum_t        n_i_faces,
  *
  * parameters:
  *   dim            <--  dimension
- *   n_i_faces      <--  number of interior faces
- *   n_b_faces      <--  number of border  faces
+ *   n_i_faces      <--  number of interior faces (or listed faces)
+ *   n_b_faces      <--  number of border faces (or listed faces)
+ *   i_face_ids     <--  optional list of interior faces, or nullptr
+ *   b_face_ids     <--  optional list of border faces, or nullptr
  *   i_face_cells   <--  interior "faces -> cells" connectivity
  *   b_face_cells   <--  border "faces -> cells" connectivity
  *   i_face_u_norm  <--  unit normal of interior faces
@@ -1960,6 +2038,8 @@ static void
 _compute_face_vectors(int              dim,
                       cs_lnum_t        n_i_faces,
                       cs_lnum_t        n_b_faces,
+                      const cs_lnum_t  i_face_ids[],
+                      const cs_lnum_t  b_face_ids[],
                       const cs_lnum_t  i_face_cells[][2],
                       const cs_lnum_t  b_face_cells[],
                       const cs_real_t  i_face_u_normal[][3],
@@ -1973,9 +2053,21 @@ _compute_face_vectors(int              dim,
                       cs_real_t        diipb[],
                       cs_real_t        dofij[])
 {
+  const int mq_flag = cs_glob_mesh_quantities_flag;
+
+  cs_dispatch_context ctx;
+  const void *ptrs[] = {i_face_ids, b_face_ids, i_face_cells, b_face_cells,
+                        i_face_u_normal, b_face_u_normal,
+                        i_face_cog, b_face_cog, cell_cen, weight, b_dist,
+                        dijpf, diipb, dofij};
+  ctx.set_use_gpu(_device_accessible(14, ptrs));
+
   /* Interior faces */
 
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+  ctx.parallel_for(n_i_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t f_idx) {
+
+    const cs_lnum_t face_id
+      = (i_face_ids != nullptr) ? i_face_ids[f_idx] : f_idx;
 
     const cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     const cs_lnum_t cell_id2 = i_face_cells[face_id][1];
@@ -2012,12 +2104,17 @@ _compute_face_vectors(int              dim,
     dofij[face_id*dim + 2] = i_face_cog[face_id*dim + 2]
       - (        pond *cell_cen[cell_id1*dim + 2]
          + (1. - pond)*cell_cen[cell_id2*dim + 2]);
-  }
+  });
 
   /* Boundary faces */
-  cs_gnum_t w_count = 0;
+  double n_clip = 0;
 
-  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+  ctx.parallel_for_reduce_sum
+    (n_b_faces, n_clip, [=] CS_F_HOST_DEVICE
+     (cs_lnum_t f_idx, CS_DISPATCH_SUM_DOUBLE &sum) {
+
+    const cs_lnum_t face_id
+      = (b_face_ids != nullptr) ? b_face_ids[f_idx] : f_idx;
 
     cs_lnum_t cell_id = b_face_cells[face_id];
 
@@ -2033,7 +2130,7 @@ _compute_face_vectors(int              dim,
     cs_math_3_orthogonal_projection(normal, vec_if, &diipb[face_id*dim]);
 
     /* Limiter on boundary face reconstruction */
-    if (cs_glob_mesh_quantities_flag & CS_FACE_RECONSTRUCTION_CLIP) {
+    if (mq_flag & CS_FACE_RECONSTRUCTION_CLIP) {
       cs_real_t iip = cs_math_3_norm(&diipb[face_id*dim]);
 
       bool is_clipped = false;
@@ -2049,10 +2146,13 @@ _compute_face_vectors(int              dim,
       diipb[face_id*dim +2] *= corri;
 
       if (is_clipped)
-        w_count++;
+        sum += 1;
     }
-  }
+  });
+
+  ctx.wait();
 
+  cs_gnum_t w_count = n_clip;
   cs_parall_counter(&w_count, 1);
 
   if (w_count > 0)
@@ -2086,7 +2186,8 @@ _compute_face_vectors(int              dim,
  *
  * parameters:
  *   n_cells        <--  number of cells
- *   n_i_faces      <--  number of interior faces
+ *   n_i_faces      <--  number of interior faces (or listed faces)
+ *   i_face_ids     <--  optional list of interior faces, or nullptr
  *   i_face_cells   <--  interior "faces -> cells" connectivity
  *   i_face_u_norm  <--  unit normal of interior faces
  *   i_face_norm    <--  surface normal of interior faces
@@ -2101,6 +2202,7 @@ _compute_face_vectors(int              dim,
 static void
 _compute_face_sup_vectors(cs_lnum_t          n_cells,
                           cs_lnum_t          n_i_faces,
+                          const cs_lnum_t    i_face_ids[],
                           const cs_lnum_2_t  i_face_cells[],
                           const cs_real_t    i_face_u_normal[][3],
                           const cs_real_t    i_face_normal[][3],
@@ -2115,7 +2217,10 @@ _compute_face_sup_vectors(cs_lnum_t          n_cells,
 
   /* Interior faces */
 
-  for (cs_lnum_t face_id = 0; face_id < n_i_faces; face_id++) {
+  for (cs_lnum_t f_idx = 0; f_idx < n_i_faces; f_idx++) {
+
+    const cs_lnum_t face_id
+      = (i_face_ids != nullptr) ? i_face_ids[f_idx] : f_idx;
 
     const cs_lnum_t cell_id1 = i_face_cells[face_id][0];
     const cs_lnum_t cell_id2 = i_face_cells[face_id][1];
@@ -2609,15 +2714,23 @@ _compute_unit_normals(const cs_mesh_t       *m,
     cs_mem_advise_set_read_mostly(mq->b_face_u_normal);
   }
 
-# pragma omp parallel for  if (n_i_faces > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_i_faces; i++) {
-    cs_math_3_normalize(i_face_normal[i], mq->i_face_u_normal[i]);
-  }
+  cs_nreal_3_t *i_face_u_normal = mq->i_face_u_normal;
+  cs_nreal_3_t *b_face_u_normal = mq->b_face_u_normal;
 
-# pragma omp parallel for  if (n_b_faces > CS_THR_MIN)
-  for (cs_lnum_t i = 0; i < n_b_faces; i++) {
-    cs_math_3_normalize(b_face_normal[i], mq->b_face_u_normal[i]);
-  }
+  cs_dispatch_context ctx;
+  const void *ptrs[] = {i_face_normal, b_face_normal,
+                        i_face_u_normal, b_face_u_normal};
+  ctx.set_use_gpu(_device_accessible(4, ptrs));
+
+  ctx.parallel_for(n_i_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    cs_math_3_normalize(i_face_normal[i], i_face_u_normal[i]);
+  });
+
+  ctx.parallel_for(n_b_faces, [=] CS_F_HOST_DEVICE (cs_lnum_t i) {
+    cs_math_3_normalize(b_face_normal[i], b_face_u_normal[i]);
+  });
+
+  ctx.wait();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2827,6 +2940,297 @@ _post_plane_ib(const cs_lnum_t      n_ib_cells,
   BFT_FREE(edge);
 }
 
+/*----------------------------------------------------------------------------
+ * Update quantities associated to a subset of faces (border or internal).
+ *
+ * The connectivity of the selected faces is compacted so that the
+ * standard face quantities computation (and optional face center
+ * adjustments) may be reused.
+ *
+ * parameters:
+ *   n_faces         <--  number of selected faces
+ *   face_ids        <--  ids of selected faces
+ *   vtx_coord       <--  vertex coordinates
+ *   face_vtx_idx    <--  "face -> vertices" connectivity index
+ *   face_vtx        <--  "face -> vertices" connectivity
+ *   face_cog        <->  coordinates of the center of gravity of the faces
+ *   face_normal     <->  face surface normals
+ *   face_surf       <->  face surfaces
+ *   face_u_normal   <->  face unit normals
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_face_quantities_subset(cs_lnum_t          n_faces,
+                               const cs_lnum_t    face_ids[],
+                               const cs_real_t    vtx_coord[][3],
+                               const cs_lnum_t    face_vtx_idx[],
+                               const cs_lnum_t    face_vtx[],
+                               cs_real_t          face_cog[][3],
+                               cs_real_t          face_normal[][3],
+                               cs_real_t          face_surf[],
+                               cs_nreal_3_t       face_u_normal[])
+{
+  if (n_faces < 1)
+    return;
+
+  cs_lnum_t *s_face_vtx_idx, *s_face_vtx;
+  BFT_MALLOC(s_face_vtx_idx, n_faces + 1, cs_lnum_t);
+
+  s_face_vtx_idx[0] = 0;
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    cs_lnum_t f_id = face_ids[i];
+    s_face_vtx_idx[i+1] =   s_face_vtx_idx[i]
+                          + face_vtx_idx[f_id+1] - face_vtx_idx[f_id];
+  }
+
+  BFT_MALLOC(s_face_vtx, s_face_vtx_idx[n_faces], cs_lnum_t);
+
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    cs_lnum_t f_id = face_ids[i];
+    memcpy(s_face_vtx + s_face_vtx_idx[i],
+           face_vtx + face_vtx_idx[f_id],
+           (s_face_vtx_idx[i+1] - s_face_vtx_idx[i])*sizeof(cs_lnum_t));
+  }
+
+  cs_real_3_t *s_face_cog, *s_face_normal;
+  BFT_MALLOC(s_face_cog, n_faces, cs_real_3_t);
+  BFT_MALLOC(s_face_normal, n_faces, cs_real_3_t);
+
+  _compute_face_quantities(n_faces,
+                           vtx_coord,
+                           s_face_vtx_idx,
+                           s_face_vtx,
+                           s_face_cog,
+                           s_face_normal);
+
+  if (cs_glob_mesh_quantities_flag & CS_FACE_CENTER_REFINE)
+    _refine_warped_face_centers(n_faces,
+                                vtx_coord,
+                                s_face_vtx_idx,
+                                s_face_vtx,
+                                s_face_cog,
+                                (const cs_real_3_t *)s_face_normal);
+
+  if (_ajust_face_cog_compat_v11_v52)
+    _adjust_face_cog_v11_v52(n_faces,
+                             vtx_coord,
+                             s_face_vtx_idx,
+                             s_face_vtx,
+                             s_face_cog,
+                             (const cs_real_3_t *)s_face_normal);
+
+  for (cs_lnum_t i = 0; i < n_faces; i++) {
+    cs_lnum_t f_id = face_ids[i];
+    for (cs_lnum_t j = 0; j < 3; j++) {
+      face_cog[f_id][j] = s_face_cog[i][j];
+      face_normal[f_id][j] = s_face_normal[i][j];
+    }
+    face_surf[f_id] = cs_math_3_norm(face_normal[f_id]);
+    cs_math_3_normalize(face_normal[f_id], face_u_normal[f_id]);
+  }
+
+  BFT_FREE(s_face_normal);
+  BFT_FREE(s_face_cog);
+  BFT_FREE(s_face_vtx);
+  BFT_FREE(s_face_vtx_idx);
+}
+
+/*----------------------------------------------------------------------------
+ * Update centers and volumes of flagged cells.
+ *
+ * The given face lists must contain all faces adjacent to flagged cells,
+ * in increasing order, so that contributions are accumulated in the same
+ * order as for a full computation (see cs_mesh_quantities_cell_faces_cog,
+ * _compute_cell_quantities, and _compute_cell_volume).
+ *
+ * parameters:
+ *   m          <--  pointer to mesh structure
+ *   n_i_faces  <--  number of listed interior faces
+ *   i_face_ids <--  ids of listed interior faces
+ *   n_b_faces  <--  number of listed boundary faces
+ *   b_face_ids <--  ids of listed boundary faces
+ *   c_flag     <--  flag for cells to update
+ *   mq         <->  pointer to mesh quantities structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_cell_quantities_subset(const cs_mesh_t       *m,
+                               cs_lnum_t              n_i_faces,
+                               const cs_lnum_t        i_face_ids[],
+                               cs_lnum_t              n_b_faces,
+                               const cs_lnum_t        b_face_ids[],
+                               const char             c_flag[],
+                               cs_mesh_quantities_t  *mq)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)(m->i_face_cells);
+  const cs_lnum_t *b_face_cells = m->b_face_cells;
+
+  const cs_real_3_t *i_face_norm = (const cs_real_3_t *)mq->i_face_normal;
+  const cs_real_3_t *i_face_cog = (const cs_real_3_t *)mq->i_face_cog;
+  const cs_real_3_t *b_face_norm = (const cs_real_3_t *)mq->b_face_normal;
+  const cs_real_3_t *b_face_cog = (const cs_real_3_t *)mq->b_face_cog;
+
+  cs_real_3_t *cell_cen = (cs_real_3_t *)mq->cell_cen;
+  cs_real_t *cell_vol = mq->cell_vol;
+
+  const bool null_surf = (  cs_glob_mesh_quantities_flag
+                          & CS_FACE_NULL_SURFACE) ? true : false;
+
+  /* Approximate cell centers using face centers weighted by surfaces */
+
+  cs_real_t *cell_area;
+  cs_real_3_t *a_cell_cen;
+  BFT_MALLOC(cell_area, n_cells, cs_real_t);
+  BFT_MALLOC(a_cell_cen, n_cells, cs_real_3_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (c_flag[c_id]) {
+      cell_area[c_id] = 0.;
+      for (cs_lnum_t i = 0; i < 3; i++)
+        a_cell_cen[c_id][i] = 0.;
+    }
+  }
+
+  for (cs_lnum_t f_idx = 0; f_idx < n_i_faces; f_idx++) {
+    cs_lnum_t f_id = i_face_ids[f_idx];
+    cs_real_t area = cs_math_3_norm(i_face_norm[f_id]);
+    if (null_surf == false || area > 1.e-20) {
+      for (cs_lnum_t j = 0; j < 2; j++) {
+        cs_lnum_t c_id = i_face_cells[f_id][j];
+        if (c_id > -1 && c_id < n_cells && c_flag[c_id]) {
+          cell_area[c_id] += area;
+          for (cs_lnum_t i = 0; i < 3; i++)
+            a_cell_cen[c_id][i] += i_face_cog[f_id][i]*area;
+        }
+      }
+    }
+  }
+
+  for (cs_lnum_t f_idx = 0; f_idx < n_b_faces; f_idx++) {
+    cs_lnum_t f_id = b_face_ids[f_idx];
+    cs_lnum_t c_id = b_face_cells[f_id];
+    if (c_id > -1 && c_flag[c_id]) {
+      cs_real_t area = cs_math_3_norm(b_face_norm[f_id]);
+      if (null_surf == false || area > 1.e-20) {
+        cell_area[c_id] += area;
+        for (cs_lnum_t i = 0; i < 3; i++)
+          a_cell_cen[c_id][i] += b_face_cog[f_id][i]*area;
+      }
+    }
+  }
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (c_flag[c_id]) {
+      for (cs_lnum_t i = 0; i < 3; i++)
+        a_cell_cen[c_id][i] /= cell_area[c_id];
+    }
+  }
+
+  BFT_FREE(cell_area);
+
+  /* Cell centers and volumes */
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (c_flag[c_id]) {
+      cell_vol[c_id] = 0.;
+      for (cs_lnum_t i = 0; i < 3; i++)
+        cell_cen[c_id][i] = (_cell_cen_algorithm == 0) ? a_cell_cen[c_id][i]
+                                                       : 0.;
+    }
+  }
+
+  if (_cell_cen_algorithm == 0) {
+
+    /* Volume based on cell centers */
+
+    for (cs_lnum_t f_idx = 0; f_idx < n_i_faces; f_idx++) {
+      cs_lnum_t f_id = i_face_ids[f_idx];
+      cs_lnum_t c_id1 = i_face_cells[f_id][0];
+      cs_lnum_t c_id2 = i_face_cells[f_id][1];
+      if (c_id1 < n_cells && c_flag[c_id1])
+        cell_vol[c_id1] += cs_math_3_distance_dot_product(cell_cen[c_id1],
+                                                          i_face_cog[f_id],
+                                                          i_face_norm[f_id]);
+      if (c_id2 < n_cells && c_flag[c_id2])
+        cell_vol[c_id2] -= cs_math_3_distance_dot_product(cell_cen[c_id2],
+                                                          i_face_cog[f_id],
+                                                          i_face_norm[f_id]);
+    }
+
+    for (cs_lnum_t f_idx = 0; f_idx < n_b_faces; f_idx++) {
+      cs_lnum_t f_id = b_face_ids[f_idx];
+      cs_lnum_t c_id = b_face_cells[f_id];
+      if (c_id > -1 && c_flag[c_id])
+        cell_vol[c_id] += cs_math_3_distance_dot_product(cell_cen[c_id],
+                                                         b_face_cog[f_id],
+                                                         b_face_norm[f_id]);
+    }
+
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      if (c_flag[c_id])
+        cell_vol[c_id] *= 1.0/3.0;
+    }
+
+  }
+  else {
+
+    /* Implicit subdivision of cells into face-approximate center pyramids */
+
+    for (cs_lnum_t f_idx = 0; f_idx < n_i_faces; f_idx++) {
+      cs_lnum_t f_id = i_face_ids[f_idx];
+      cs_lnum_t c_id1 = i_face_cells[f_id][0];
+      cs_lnum_t c_id2 = i_face_cells[f_id][1];
+      if (c_id1 < n_cells && c_flag[c_id1]) {
+        cs_real_t pyra_vol_3
+          = cs_math_3_distance_dot_product(a_cell_cen[c_id1],
+                                           i_face_cog[f_id],
+                                           i_face_norm[f_id]);
+        for (cs_lnum_t i = 0; i < 3; i++)
+          cell_cen[c_id1][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
+                                             + 0.25*a_cell_cen[c_id1][i]);
+        cell_vol[c_id1] += pyra_vol_3;
+      }
+      if (c_id2 < n_cells && c_flag[c_id2]) {
+        cs_real_t pyra_vol_3
+          = cs_math_3_distance_dot_product(i_face_cog[f_id],
+                                           a_cell_cen[c_id2],
+                                           i_face_norm[f_id]);
+        for (cs_lnum_t i = 0; i < 3; i++)
+          cell_cen[c_id2][i] += pyra_vol_3 *(  0.75*i_face_cog[f_id][i]
+                                             + 0.25*a_cell_cen[c_id2][i]);
+        cell_vol[c_id2] += pyra_vol_3;
+      }
+    }
+
+    for (cs_lnum_t f_idx = 0; f_idx < n_b_faces; f_idx++) {
+      cs_lnum_t f_id = b_face_ids[f_idx];
+      cs_lnum_t c_id = b_face_cells[f_id];
+      if (c_id > -1 && c_flag[c_id]) {
+        cs_real_t pyra_vol_3
+          = cs_math_3_distance_dot_product(a_cell_cen[c_id],
+                                           b_face_cog[f_id],
+                                           b_face_norm[f_id]);
+        for (cs_lnum_t i = 0; i < 3; i++)
+          cell_cen[c_id][i] += pyra_vol_3 *(  0.75*b_face_cog[f_id][i]
+                                            + 0.25*a_cell_cen[c_id][i]);
+        cell_vol[c_id] += pyra_vol_3;
+      }
+    }
+
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      if (c_flag[c_id]) {
+        for (cs_lnum_t i = 0; i < 3; i++)
+          cell_cen[c_id][i] /= cell_vol[c_id];
+        cell_vol[c_id] /= 3.0;
+      }
+    }
+
+  }
+
+  BFT_FREE(a_cell_cen);
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -4174,6 +4578,8 @@ cs_mesh_quantities_solid_compute(const cs_mesh_t       *m,
 
   _compute_face_distances(m->n_i_faces,
                           m->n_b_faces,
+                          nullptr,
+                          nullptr,
                           (const cs_lnum_2_t *)(m->i_face_cells),
                           (const cs_lnum_t   *)(m->b_face_cells),
                           (const cs_real_3_t *)(mq->i_face_u_normal),
@@ -4191,6 +4597,8 @@ cs_mesh_quantities_solid_compute(const cs_mesh_t       *m,
   _compute_face_vectors(m->dim,
                         m->n_i_faces,
                         m->n_b_faces,
+                        nullptr,
+                        nullptr,
                         (const cs_lnum_2_t *)(m->i_face_cells),
                         m->b_face_cells,
                         (const cs_real_3_t *)mq->i_face_u_normal,
@@ -4206,6 +4614,7 @@ cs_mesh_quantities_solid_compute(const cs_mesh_t       *m,
 
   _compute_face_sup_vectors(m->n_cells,
                             m->n_i_faces,
+                            nullptr,
                             (const cs_lnum_2_t *)(m->i_face_cells),
                             (const cs_real_3_t *)(mq->i_face_u_normal),
                             (const cs_real_3_t *)(mq->i_face_normal),
@@ -4594,6 +5003,8 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
 
   _compute_face_distances(m->n_i_faces,
                           m->n_b_faces,
+                          nullptr,
+                          nullptr,
                           (const cs_lnum_2_t *)(m->i_face_cells),
                           m->b_face_cells,
                           (const cs_real_3_t *)(mq->i_face_u_normal),
@@ -4613,6 +5024,8 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
   _compute_face_vectors(dim,
                         m->n_i_faces,
                         m->n_b_faces,
+                        nullptr,
+                        nullptr,
                         (const cs_lnum_2_t *)(m->i_face_cells),
                         m->b_face_cells,
                         (const cs_real_3_t *)mq->i_face_u_normal,
@@ -4632,6 +5045,7 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
   _compute_face_sup_vectors
     (m->n_cells,
      m->n_i_faces,
+     nullptr,
      (const cs_lnum_2_t *)(m->i_face_cells),
      (const cs_real_3_t *)(mq->i_face_u_normal),
      (const cs_real_3_t *)(mq->i_face_normal),
@@ -4669,6 +5083,269 @@ cs_mesh_quantities_compute(const cs_mesh_t       *m,
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update mesh quantities after displacement of a subset of vertices.
+ *
+ * Only faces containing moved vertices, cells adjacent to those faces,
+ * and faces adjacent to those cells are updated, so the cost is
+ * proportional to the moving part of the mesh (such as rotors or
+ * mobile structures). Results are identical to those of
+ * \ref cs_mesh_quantities_compute.
+ *
+ * If quantities have not been computed yet, or if non-local corrections
+ * (cell center or volume corrections, warped cells gradient correction)
+ * or porous models are active, a full computation is done instead.
+ *
+ * Mesh topology must not have changed since the last computation.
+ *
+ * \param[in]       m          pointer to mesh structure
+ * \param[in, out]  mq         pointer to mesh quantities structures
+ * \param[in]       vtx_moved  flag for vertices which may have moved,
+ *                             or nullptr for a full computation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_update_moved(const cs_mesh_t       *m,
+                                cs_mesh_quantities_t  *mq,
+                                const bool             vtx_moved[])
+{
+  const int non_local_flags =   CS_BAD_CELLS_WARPED_CORRECTION
+                              | CS_CELL_FACE_CENTER_CORRECTION
+                              | CS_CELL_CENTER_CORRECTION
+                              | CS_CELL_VOLUME_RATIO_CORRECTION;
+
+  if (   vtx_moved == nullptr
+      || mq->i_dist == nullptr
+      || (cs_glob_mesh_quantities_flag & non_local_flags)
+      || m->n_b_faces_all > m->n_b_faces
+      || mq->i_f_face_normal != mq->i_face_normal
+      || mq->cell_f_vol != mq->cell_vol) {
+    cs_mesh_quantities_compute(m, mq);
+    return;
+  }
+
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)(m->i_face_cells);
+  const cs_lnum_t *b_face_cells = m->b_face_cells;
+
+  /* Mark faces with moved vertices and adjacent cells */
+
+  char *c_flag;
+  BFT_MALLOC(c_flag, n_cells_ext, char);
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++)
+    c_flag[c_id] = 0;
+
+  cs_lnum_t *i_face_ids, *b_face_ids;
+  BFT_MALLOC(i_face_ids, n_i_faces, cs_lnum_t);
+  BFT_MALLOC(b_face_ids, n_b_faces, cs_lnum_t);
+
+  cs_lnum_t n_i_moved = 0, n_b_moved = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    for (cs_lnum_t j = m->i_face_vtx_idx[f_id];
+         j < m->i_face_vtx_idx[f_id+1];
+         j++) {
+      if (vtx_moved[m->i_face_vtx_lst[j]]) {
+        i_face_ids[n_i_moved++] = f_id;
+        c_flag[i_face_cells[f_id][0]] = 1;
+        c_flag[i_face_cells[f_id][1]] = 1;
+        break;
+      }
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    for (cs_lnum_t j = m->b_face_vtx_idx[f_id];
+         j < m->b_face_vtx_idx[f_id+1];
+         j++) {
+      if (vtx_moved[m->b_face_vtx_lst[j]]) {
+        b_face_ids[n_b_moved++] = f_id;
+        if (b_face_cells[f_id] > -1)
+          c_flag[b_face_cells[f_id]] = 1;
+        break;
+      }
+    }
+  }
+
+  cs_gnum_t n_g_moved = n_i_moved + n_b_moved;
+  cs_parall_counter(&n_g_moved, 1);
+
+  if (n_g_moved == 0) {
+    BFT_FREE(b_face_ids);
+    BFT_FREE(i_face_ids);
+    BFT_FREE(c_flag);
+    return;
+  }
+
+  _n_computations++;
+
+  /* Ghost cell flags are those of the matching cells on distant ranks
+     (whose quantities are updated through halo synchronization) */
+
+  if (m->halo != nullptr)
+    cs_halo_sync_untyped(m->halo, CS_HALO_EXTENDED, sizeof(char), c_flag);
+
+  /* Face centers, normals, surfaces */
+
+  _update_face_quantities_subset(n_i_moved,
+                                 i_face_ids,
+                                 (const cs_real_3_t *)m->vtx_coord,
+                                 m->i_face_vtx_idx,
+                                 m->i_face_vtx_lst,
+                                 (cs_real_3_t *)mq->i_face_cog,
+                                 (cs_real_3_t *)mq->i_face_normal,
+                                 mq->i_face_surf,
+                                 mq->i_face_u_normal);
+
+  _update_face_quantities_subset(n_b_moved,
+                                 b_face_ids,
+                                 (const cs_real_3_t *)m->vtx_coord,
+                                 m->b_face_vtx_idx,
+                                 m->b_face_vtx_lst,
+                                 (cs_real_3_t *)mq->b_face_cog,
+                                 (cs_real_3_t *)mq->b_face_normal,
+                                 mq->b_face_surf,
+                                 mq->b_face_u_normal);
+
+  /* Faces adjacent to updated cells */
+
+  cs_lnum_t n_i_upd = 0, n_b_upd = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    if (c_flag[i_face_cells[f_id][0]] || c_flag[i_face_cells[f_id][1]])
+      i_face_ids[n_i_upd++] = f_id;
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    if (b_face_cells[f_id] > -1 && c_flag[b_face_cells[f_id]])
+      b_face_ids[n_b_upd++] = f_id;
+  }
+
+  /* Cell centers and volumes */
+
+  _update_cell_quantities_subset(m,
+                                 n_i_upd,
+                                 i_face_ids,
+                                 n_b_upd,
+                                 b_face_ids,
+                                 c_flag,
+                                 mq);
+
+  BFT_FREE(c_flag);
+
+  if (m->halo != nullptr) {
+
+    cs_halo_sync_var_strided(m->halo, CS_HALO_EXTENDED,
+                             mq->cell_cen, 3);
+    if (m->n_init_perio > 0)
+      cs_halo_perio_sync_coords(m->halo, CS_HALO_EXTENDED,
+                                mq->cell_cen);
+
+    cs_halo_sync_var(m->halo, CS_HALO_EXTENDED, mq->cell_vol);
+
+  }
+
+  _cell_volume_reductions(m,
+                          mq->cell_vol,
+                          &(mq->min_vol),
+                          &(mq->max_vol),
+                          &(mq->tot_vol));
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+
+    cs_real_t  _min_vol, _max_vol, _tot_vol;
+
+    MPI_Allreduce(&(mq->min_vol), &_min_vol, 1, CS_MPI_REAL,
+                  MPI_MIN, cs_glob_mpi_comm);
+
+    MPI_Allreduce(&(mq->max_vol), &_max_vol, 1, CS_MPI_REAL,
+                  MPI_MAX, cs_glob_mpi_comm);
+
+    MPI_Allreduce(&(mq->tot_vol), &_tot_vol, 1, CS_MPI_REAL,
+                  MPI_SUM, cs_glob_mpi_comm);
+
+    mq->min_vol = _min_vol;
+    mq->max_vol = _max_vol;
+    mq->tot_vol = _tot_vol;
+
+  }
+#endif
+
+  mq->min_f_vol = mq->min_vol;
+  mq->max_f_vol = mq->max_vol;
+  mq->tot_f_vol = mq->tot_vol;
+
+  /* Distances, weights and vectors relative to updated faces */
+
+  _compute_face_distances(n_i_upd,
+                          n_b_upd,
+                          i_face_ids,
+                          b_face_ids,
+                          i_face_cells,
+                          b_face_cells,
+                          (const cs_real_3_t *)(mq->i_face_u_normal),
+                          (const cs_real_3_t *)(mq->i_face_normal),
+                          (const cs_real_3_t *)(mq->b_face_u_normal),
+                          (const cs_real_3_t *)(mq->b_face_normal),
+                          (const cs_real_3_t *)(mq->i_face_cog),
+                          (const cs_real_3_t *)(mq->b_face_cog),
+                          (const cs_real_3_t *)(mq->cell_cen),
+                          (const cs_real_t *)(mq->cell_vol),
+                          mq->i_dist,
+                          mq->b_dist,
+                          mq->weight);
+
+  _compute_face_vectors(m->dim,
+                        n_i_upd,
+                        n_b_upd,
+                        i_face_ids,
+                        b_face_ids,
+                        i_face_cells,
+                        b_face_cells,
+                        (const cs_real_3_t *)mq->i_face_u_normal,
+                        (const cs_real_3_t *)mq->b_face_u_normal,
+                        mq->i_face_cog,
+                        mq->b_face_cog,
+                        mq->cell_cen,
+                        mq->weight,
+                        mq->b_dist,
+                        mq->dijpf,
+                        mq->diipb,
+                        mq->dofij);
+
+  _compute_face_sup_vectors(m->n_cells,
+                            n_i_upd,
+                            i_face_ids,
+                            i_face_cells,
+                            (const cs_real_3_t *)(mq->i_face_u_normal),
+                            (const cs_real_3_t *)(mq->i_face_normal),
+                            (const cs_real_3_t *)(mq->i_face_cog),
+                            (const cs_real_3_t *)(mq->cell_cen),
+                            mq->cell_vol,
+                            mq->i_dist,
+                            (cs_real_3_t *)(mq->diipf),
+                            (cs_real_3_t *)(mq->djjpf));
+
+  BFT_FREE(b_face_ids);
+  BFT_FREE(i_face_ids);
+
+  if (mq->min_vol <= 0.) {
+    bft_printf(_(" --- Information on the volumes\n"
+                 "       Minimum control volume      = %14.7e\n"
+                 "       Maximum control volume      = %14.7e\n"
+                 "       Total volume for the domain = %14.7e\n"),
+               mq->min_vol, mq->max_vol,
+               mq->tot_vol);
+    bft_printf(_("\nAbort due to the detection of a negative control "
+                 "volume.\n"));
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute min, max, and total
  *
@@ -4795,6 +5472,7 @@ cs_mesh_quantities_sup_vectors(const cs_mesh_t       *mesh,
   _compute_face_sup_vectors
     (mesh->n_cells,
      mesh->n_i_faces,
+     nullptr,
      (const cs_lnum_2_t *)(mesh->i_face_cells),
      (const cs_real_3_t *)(mesh_quantities->i_face_u_normal),
      (const cs_real_3_t *)(mesh_quantities->i_face_normal),
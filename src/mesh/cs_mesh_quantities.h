@@ -293,6 +293,29 @@ void
 cs_mesh_quantities_compute(const cs_mesh_t       *m,
                            cs_mesh_quantities_t  *mq);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Update mesh quantities after displacement of a subset of vertices.
+ *
+ * Only faces containing moved vertices, cells adjacent to those faces,
+ * and faces adjacent to those cells are updated. If quantities have not
+ * been computed yet, or if non-local corrections or porous models are
+ * active, a full computation is done instead.
+ *
+ * Mesh topology must not have changed since the last computation.
+ *
+ * \param[in]       m          pointer to mesh structure
+ * \param[in, out]  mq         pointer to mesh quantities structures
+ * \param[in]       vtx_moved  flag for vertices which may have moved,
+ *                             or NULL for a full computation
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_quantities_update_moved(const cs_mesh_t       *m,
+                                cs_mesh_quantities_t  *mq,
+                                const bool             vtx_moved[]);
+
 /*----------------------------------------------------------------------------
  * Compute fluid mesh quantities
  *
@@ -56,9 +56,11 @@
 #include "cs_math.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_builder.h"
 #include "cs_mesh_quantities.h"
 #include "cs_order.h"
 #include "cs_parall.h"
+#include "cs_partition.h"
 
 /*----------------------------------------------------------------------------
  * Header for the current file
@@ -4818,28 +4820,22 @@ _o2n_idx_update_cell_i_face_arrays(cs_mesh_t        *m,
   m->i_face_vtx_connect_size = m->i_face_vtx_idx[n_new];
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*============================================================================
- * Public function definitions
- *============================================================================*/
-
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Refine flagged mesh cells.
+/*----------------------------------------------------------------------------
+ * Refine flagged mesh cells, optionally returning the old to new cells index.
  *
- * \param[in, out]  m           mesh
- * \param[in]       conforming  if true, propagate refinement to ensure
- *                              subdivision is conforming
- * \param[in]       cell_flag   subdivision type for each cell
- *                              (0: none; 1: isotropic)
- */
-/*----------------------------------------------------------------------------*/
+ * parameters:
+ *   m           <-> mesh
+ *   conforming  <-- if true, propagate refinement to ensure subdivision
+ *                   is conforming
+ *   cell_flag   <-- subdivision type for each cell (0: none; 1: isotropic)
+ *   c_o2n_idx_p --> pointer to old to new cells index, or nullptr
+ *----------------------------------------------------------------------------*/
 
-void
-cs_mesh_refine_simple(cs_mesh_t  *m,
-                      bool        conforming,
-                      const int   cell_flag[])
+static void
+_refine_cells(cs_mesh_t   *m,
+              bool         conforming,
+              const int    cell_flag[],
+              cs_lnum_t  **c_o2n_idx_p)
 {
   /* Timers:
      0: total
@@ -5254,7 +5250,10 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
 
   BFT_FREE(c2f2v_start);
 
-  BFT_FREE(c_o2n_idx);
+  if (c_o2n_idx_p != nullptr)
+    *c_o2n_idx_p = c_o2n_idx;
+  else
+    BFT_FREE(c_o2n_idx);
   BFT_FREE(c_i_face_idx);
 
   BFT_FREE(refined_cell_id);
@@ -5330,6 +5329,32 @@ cs_mesh_refine_simple(cs_mesh_t  *m,
   }
 }
 
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+/*============================================================================
+ * Public function definitions
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Refine flagged mesh cells.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       conforming  if true, propagate refinement to ensure
+ *                              subdivision is conforming
+ * \param[in]       cell_flag   subdivision type for each cell
+ *                              (0: none; 1: isotropic)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_refine_simple(cs_mesh_t  *m,
+                      bool        conforming,
+                      const int   cell_flag[])
+{
+  _refine_cells(m, conforming, cell_flag, nullptr);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Refine selected mesh cells.
@@ -5370,6 +5395,114 @@ cs_mesh_refine_simple_selected(cs_mesh_t        *m,
   BFT_FREE(cell_flag);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Refine mesh cells based on an indicator, transferring
+ *        cell-based arrays to the refined mesh.
+ *
+ * Cells whose indicator is higher than the given threshold are flagged
+ * for isotropic refinement.
+ *
+ * Values of each array are copied from parent to sub-cells. Arrays must be
+ * allocated with BFT_MALLOC, and are reallocated to the new number of
+ * cells with ghosts; ghost values are synchronized when a halo is present.
+ *
+ * Combined with \ref cs_mesh_coarsen_indicator, this allows adapting the
+ * resolution to a solution-based indicator. As repartitioning changes the
+ * cell numbering, arrays should be transferred before calling
+ * \ref cs_mesh_refine_repartition.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       conforming  if true, propagate refinement to ensure
+ *                              subdivision is conforming
+ * \param[in]       indicator   indicator value for each cell
+ * \param[in]       threshold   refine cells where indicator > threshold
+ * \param[in]       n_arrays    number of cell-based arrays to transfer
+ * \param[in]       strides     stride of each array
+ * \param[in, out]  arrays      pointers to cell-based arrays
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_refine_indicator(cs_mesh_t        *m,
+                         bool              conforming,
+                         const cs_real_t   indicator[],
+                         cs_real_t         threshold,
+                         int               n_arrays,
+                         const int         strides[],
+                         cs_real_t        *arrays[])
+{
+  cs_lnum_t n_c_ini = m->n_cells;
+
+  int *cell_flag;
+  BFT_MALLOC(cell_flag, n_c_ini, int);
+  for (cs_lnum_t i = 0; i < n_c_ini; i++)
+    cell_flag[i] = (indicator[i] > threshold) ? 1 : 0;
+
+  cs_lnum_t *c_o2n_idx = nullptr;
+  _refine_cells(m, conforming, cell_flag, &c_o2n_idx);
+
+  BFT_FREE(cell_flag);
+
+  const cs_lnum_t n_c_ext = m->n_cells_with_ghosts;
+
+  for (int a_id = 0; a_id < n_arrays; a_id++) {
+
+    const cs_lnum_t stride = strides[a_id];
+    const cs_real_t *v = arrays[a_id];
+
+    cs_real_t *v_n;
+    BFT_MALLOC(v_n, n_c_ext*stride, cs_real_t);
+
+    for (cs_lnum_t i = 0; i < n_c_ini; i++) {
+      for (cs_lnum_t j = c_o2n_idx[i]; j < c_o2n_idx[i+1]; j++) {
+        for (cs_lnum_t k = 0; k < stride; k++)
+          v_n[j*stride + k] = v[i*stride + k];
+      }
+    }
+
+    if (m->halo != nullptr)
+      cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD, v_n, stride);
+
+    BFT_FREE(arrays[a_id]);
+    arrays[a_id] = v_n;
+
+  }
+
+  BFT_FREE(c_o2n_idx);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Repartition a mesh in memory if its load imbalance is too high,
+ *        typically after a local refinement.
+ *
+ * The mesh is transferred to the global mesh builder, partitioned using the
+ * options defined for the main partitioning stage (see
+ * \ref cs_partition_set_algorithm), and rebuilt with the new distribution,
+ * without writing or reading any mesh file.
+ *
+ * The load imbalance is defined as the ratio of the maximum to the mean
+ * number of cells on ranks, minus 1. Cell numbering is modified if the
+ * mesh is repartitioned, so that cell-based arrays built previously are
+ * not valid anymore.
+ *
+ * \param[in, out]  m              mesh
+ * \param[in]       imbalance_tol  repartition only if the load imbalance is
+ *                                 higher than this value (0 to always
+ *                                 repartition in parallel)
+ *
+ * \return  true if the mesh was repartitioned, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_refine_repartition(cs_mesh_t  *m,
+                           double      imbalance_tol)
+{
+  return cs_partition_rebalance(m, nullptr, imbalance_tol);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set refinement options, using key/value pairs.
@@ -86,6 +86,71 @@ cs_mesh_refine_simple_selected(cs_mesh_t        *m,
                                cs_lnum_t         n_cells,
                                const cs_lnum_t   cells[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Refine mesh cells based on an indicator, transferring
+ *        cell-based arrays to the refined mesh.
+ *
+ * Cells whose indicator is higher than the given threshold are flagged
+ * for isotropic refinement.
+ *
+ * Values of each array are copied from parent to sub-cells. Arrays must be
+ * allocated with BFT_MALLOC, and are reallocated to the new number of
+ * cells with ghosts; ghost values are synchronized when a halo is present.
+ *
+ * Combined with \ref cs_mesh_coarsen_indicator, this allows adapting the
+ * resolution to a solution-based indicator. As repartitioning changes the
+ * cell numbering, arrays should be transferred before calling
+ * \ref cs_mesh_refine_repartition.
+ *
+ * \param[in, out]  m           mesh
+ * \param[in]       conforming  if true, propagate refinement to ensure
+ *                              subdivision is conforming
+ * \param[in]       indicator   indicator value for each cell
+ * \param[in]       threshold   refine cells where indicator > threshold
+ * \param[in]       n_arrays    number of cell-based arrays to transfer
+ * \param[in]       strides     stride of each array
+ * \param[in, out]  arrays      pointers to cell-based arrays
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_refine_indicator(cs_mesh_t        *m,
+                         bool              conforming,
+                         const cs_real_t   indicator[],
+                         cs_real_t         threshold,
+                         int               n_arrays,
+                         const int         strides[],
+                         cs_real_t        *arrays[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Repartition a mesh in memory if its load imbalance is too high,
+ *        typically after a local refinement.
+ *
+ * The mesh is transferred to the global mesh builder, partitioned using the
+ * options defined for the main partitioning stage (see
+ * \ref cs_partition_set_algorithm), and rebuilt with the new distribution,
+ * without writing or reading any mesh file.
+ *
+ * The load imbalance is defined as the ratio of the maximum to the mean
+ * number of cells on ranks, minus 1. Cell numbering is modified if the
+ * mesh is repartitioned, so that cell-based arrays built previously are
+ * not valid anymore.
+ *
+ * \param[in, out]  m              mesh
+ * \param[in]       imbalance_tol  repartition only if the load imbalance is
+ *                                 higher than this value (0 to always
+ *                                 repartition in parallel)
+ *
+ * \return  true if the mesh was repartitioned, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_mesh_refine_repartition(cs_mesh_t  *m,
+                           double      imbalance_tol);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set refinement options, using key/value pairs.
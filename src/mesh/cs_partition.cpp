@@ -97,7 +97,10 @@ extern "C" {
 #include "cs_log.h"
 #include "cs_mesh.h"
 #include "cs_mesh_builder.h"
+#include "cs_mesh_from_builder.h"
+#include "cs_mesh_to_builder.h"
 #include "cs_order.h"
+#include "cs_parall.h"
 #include "cs_part_to_block.h"
 #include "cs_timer.h"
 
@@ -209,6 +212,18 @@ static int                        _part_n_extra_partitions = 0;
 static int                       *_part_extra_partitions_list = nullptr;
 
 static bool                       _part_uniform_sfc_block_size = false;
+static bool                       _part_node_aware = false;
+
+static cs_lnum_t                  _part_n_weighted_cells = 0;
+static cs_gnum_t                 *_part_cell_gnum = nullptr;
+static cs_real_t                 *_part_cell_weight = nullptr;
+
+static int                        _part_n_group_weights = 0;
+static char                     **_part_group_weight_name = nullptr;
+static double                    *_part_group_weight = nullptr;
+
+static cs_partition_cell_weight_t  *_part_cell_weight_func = nullptr;
+static void                        *_part_cell_weight_input = nullptr;
 
 #if defined(WIN32) || defined(_WIN32)
 static const char _dir_separator = '\\';
@@ -928,6 +943,318 @@ _precompute_cell_center_l(const cs_mesh_builder_t  *mb,
   BFT_FREE(weight);
 }
 
+/*----------------------------------------------------------------------------
+ * Free cell weights defined by cs_partition_set_cell_weights.
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_cell_weights(void)
+{
+  _part_n_weighted_cells = 0;
+  BFT_FREE(_part_cell_gnum);
+  BFT_FREE(_part_cell_weight);
+}
+
+/*----------------------------------------------------------------------------
+ * Transfer cell weights defined by cs_partition_set_cell_weights to the
+ * block distribution of a mesh builder.
+ *
+ * The partition-based weights are freed after this call.
+ *
+ * parameters:
+ *   mb <-- pointer to mesh builder helper structure
+ *
+ * returns:
+ *   cell weights in block distribution, or null if not defined
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_block_cell_weights(const cs_mesh_builder_t  *mb)
+{
+  if (_part_cell_weight == nullptr)
+    return nullptr;
+
+  cs_lnum_t n_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+  cs_real_t *cell_weight;
+  BFT_MALLOC(cell_weight, n_cells, cs_real_t);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_part_to_block_t *d
+      = cs_part_to_block_create_by_gnum(cs_glob_mpi_comm,
+                                        mb->cell_bi,
+                                        _part_n_weighted_cells,
+                                        _part_cell_gnum);
+    cs_part_to_block_copy_array(d,
+                                CS_REAL_TYPE,
+                                1,
+                                _part_cell_weight,
+                                cell_weight);
+    cs_part_to_block_destroy(&d);
+  }
+#endif
+
+  if (cs_glob_n_ranks == 1) {
+    for (cs_lnum_t i = 0; i < _part_n_weighted_cells; i++) {
+      cs_gnum_t j = _part_cell_gnum[i] - mb->cell_bi.gnum_range[0];
+      cell_weight[j] = _part_cell_weight[i];
+    }
+  }
+
+  _free_cell_weights();
+
+  return cell_weight;
+}
+
+/*----------------------------------------------------------------------------
+ * Free group-based cell weight and cell weight function definitions.
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_cell_weight_definitions(void)
+{
+  for (int i = 0; i < _part_n_group_weights; i++)
+    BFT_FREE(_part_group_weight_name[i]);
+  BFT_FREE(_part_group_weight_name);
+  BFT_FREE(_part_group_weight);
+  _part_n_group_weights = 0;
+
+  _part_cell_weight_func = nullptr;
+  _part_cell_weight_input = nullptr;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute cell weights in block distribution based on group weights
+ * and on the cell weight function, if defined.
+ *
+ * parameters:
+ *   mesh <-- pointer to mesh structure (for families and groups)
+ *   mb   <-- pointer to mesh builder helper structure
+ *
+ * returns:
+ *   cell weights in block distribution, or null if not defined
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_defined_cell_weights(const cs_mesh_t          *mesh,
+                      const cs_mesh_builder_t  *mb)
+{
+  if (_part_n_group_weights == 0 && _part_cell_weight_func == nullptr)
+    return nullptr;
+
+  cs_lnum_t n_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
+
+  /* Weights associated with families */
+
+  int n_families = mesh->n_families;
+
+  double *f_weight;
+  BFT_MALLOC(f_weight, n_families + 1, double);
+
+  for (int i = 0; i < n_families + 1; i++)
+    f_weight[i] = -1.;
+
+  for (int i = 0; i < n_families; i++) {
+    for (int j = 0; j < mesh->n_max_family_items; j++) {
+      int g_id = -1 - mesh->family_item[mesh->n_families*j + i];
+      if (g_id < 0)
+        continue;
+      const char *g_name = mesh->group + mesh->group_idx[g_id];
+      for (int k = 0; k < _part_n_group_weights; k++) {
+        if (strcmp(g_name, _part_group_weight_name[k]) == 0)
+          f_weight[i+1] = CS_MAX(f_weight[i+1], _part_group_weight[k]);
+      }
+    }
+  }
+
+  for (int i = 0; i < n_families + 1; i++) {
+    if (f_weight[i] < 0.)
+      f_weight[i] = 1.;
+  }
+
+  cs_real_t *cell_weight;
+  BFT_MALLOC(cell_weight, n_cells, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    int f_id = (mb->cell_gc_id != nullptr) ? mb->cell_gc_id[i] : 0;
+    cell_weight[i] = (f_id > 0 && f_id <= n_families) ? f_weight[f_id] : 1.;
+  }
+
+  BFT_FREE(f_weight);
+
+  /* User-defined function */
+
+  if (_part_cell_weight_func != nullptr) {
+
+    cs_coord_t *cell_center;
+    BFT_MALLOC(cell_center, n_cells*3, cs_coord_t);
+
+#if defined(HAVE_MPI)
+    if (cs_glob_n_ranks > 1)
+      _precompute_cell_center_g(mb, cell_center, cs_glob_mpi_comm);
+#endif
+    if (cs_glob_n_ranks == 1)
+      _precompute_cell_center_l(mb, cell_center);
+
+    _part_cell_weight_func(_part_cell_weight_input,
+                           mesh,
+                           n_cells,
+                           cell_center,
+                           mb->cell_gc_id,
+                           cell_weight);
+
+    BFT_FREE(cell_center);
+
+  }
+
+  return cell_weight;
+}
+
+/*----------------------------------------------------------------------------
+ * Define cell ranks based on cell weights accumulated along a global
+ * ordering (usually based on a space-filling curve).
+ *
+ * Each rank is assigned a contiguous range of cells in the given ordering,
+ * so that the sum of the weights of its cells is close to the mean.
+ *
+ * Negative weights are handled as zero weights; if all weights are zero,
+ * ranks are assigned based on cell counts only.
+ *
+ * parameters:
+ *   n_g_cells   <-- global number of cells
+ *   n_ranks     <-- number of ranks in partition
+ *   n_cells     <-- local number of cells
+ *   cell_num    <-- cell global number in ordering (1 to n)
+ *   cell_weight <-- cell weight
+ *   cell_rank   --> cell rank (1 to n numbering)
+ *   comm        <-- associated MPI communicator
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+static void
+_cell_rank_by_weight(cs_gnum_t         n_g_cells,
+                     int               n_ranks,
+                     cs_lnum_t         n_cells,
+                     const cs_gnum_t   cell_num[],
+                     const cs_real_t   cell_weight[],
+                     int               cell_rank[],
+                     MPI_Comm          comm)
+
+#else
+
+static void
+_cell_rank_by_weight(cs_gnum_t         n_g_cells,
+                     int               n_ranks,
+                     cs_lnum_t         n_cells,
+                     const cs_gnum_t   cell_num[],
+                     const cs_real_t   cell_weight[],
+                     int               cell_rank[])
+
+#endif
+{
+  int comm_size = 1;
+  cs_lnum_t n_o_cells = n_cells;
+  cs_gnum_t o_shift = 0;
+  cs_real_t *o_weight = nullptr;
+
+  /* Distribute weights by blocks in the given ordering */
+
+#if defined(HAVE_MPI)
+  int comm_rank = 0;
+  cs_all_to_all_t *d = nullptr;
+
+  MPI_Comm_size(comm, &comm_size);
+
+  if (comm_size > 1) {
+    MPI_Comm_rank(comm, &comm_rank);
+    cs_block_dist_info_t  bi = cs_block_dist_compute_sizes(comm_rank,
+                                                           comm_size,
+                                                           1,
+                                                           0,
+                                                           n_g_cells);
+
+    d = cs_all_to_all_create_from_block(n_cells,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        cell_num,
+                                        bi,
+                                        comm);
+
+    o_weight = cs_all_to_all_copy_array(d, 1, false, cell_weight);
+    n_o_cells = cs_all_to_all_n_elts_dest(d);
+    o_shift = bi.gnum_range[0] - 1;
+  }
+#endif
+
+  if (comm_size == 1) {
+    BFT_MALLOC(o_weight, n_cells, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      o_weight[cell_num[i] - 1] = cell_weight[i];
+  }
+
+  /* Prefix sum of weights along ordering */
+
+  double w_local = 0., w_shift = 0.;
+  for (cs_lnum_t i = 0; i < n_o_cells; i++) {
+    if (o_weight[i] > 0.)
+      w_local += o_weight[i];
+  }
+
+  double w_tot = w_local;
+
+#if defined(HAVE_MPI)
+  if (comm_size > 1) {
+    MPI_Exscan(&w_local, &w_shift, 1, MPI_DOUBLE, MPI_SUM, comm);
+    MPI_Allreduce(&w_local, &w_tot, 1, MPI_DOUBLE, MPI_SUM, comm);
+    if (comm_rank == 0)
+      w_shift = 0.;
+  }
+#endif
+
+  bool uniform = !(w_tot > 0.);
+  if (uniform) {
+    w_shift = o_shift;
+    w_tot = n_g_cells;
+  }
+
+  /* Assign each cell to the rank containing the mid-point of its
+     weight interval */
+
+  int *o_rank;
+  BFT_MALLOC(o_rank, n_o_cells, int);
+
+  double r_scale = (double)n_ranks / w_tot;
+  double w_sum = w_shift;
+
+  for (cs_lnum_t i = 0; i < n_o_cells; i++) {
+    double w = 1.;
+    if (uniform == false)
+      w = (o_weight[i] > 0.) ? o_weight[i] : 0.;
+    int r = (int)((w_sum + 0.5*w) * r_scale);
+    o_rank[i] = CS_MIN(r, n_ranks - 1);
+    w_sum += w;
+  }
+
+  BFT_FREE(o_weight);
+
+  /* Return rank to original distribution */
+
+#if defined(HAVE_MPI)
+  if (comm_size > 1) {
+    cs_all_to_all_copy_array(d, 1, true, o_rank, cell_rank);
+    cs_all_to_all_destroy(&d);
+  }
+#endif
+
+  if (comm_size == 1) {
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      cell_rank[i] = o_rank[cell_num[i] - 1];
+  }
+
+  BFT_FREE(o_rank);
+}
+
 /*----------------------------------------------------------------------------
  * Define cell ranks using a space-filling curve.
  *
@@ -936,6 +1263,7 @@ _precompute_cell_center_l(const cs_mesh_builder_t  *mb,
  *   n_ranks     <-- number of ranks in partition
  *   mb          <-- pointer to mesh builder helper structure
  *   sfc_type    <-- type of space-filling curve
+ *   cell_weight <-- cell weight in block distribution, or null
  *   cell_rank   --> cell rank (1 to n numbering)
  *   comm        <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -947,6 +1275,7 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
                   int                       n_ranks,
                   const cs_mesh_builder_t  *mb,
                   fvm_io_num_sfc_t          sfc_type,
+                  const cs_real_t           cell_weight[],
                   int                       cell_rank[],
                   MPI_Comm                  comm)
 
@@ -957,6 +1286,7 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
                   int                       n_ranks,
                   const cs_mesh_builder_t  *mb,
                   fvm_io_num_sfc_t          sfc_type,
+                  const cs_real_t           cell_weight[],
                   int                       cell_rank[])
 
 #endif
@@ -1011,7 +1341,19 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
 
   /* Determine rank based on global numbering with SFC ordering; */
 
-  if (_part_uniform_sfc_block_size == false) {
+  if (cell_weight != nullptr && _part_uniform_sfc_block_size == false) {
+
+#if defined(HAVE_MPI)
+    _cell_rank_by_weight(n_g_cells, n_ranks, n_cells, cell_num,
+                         cell_weight, cell_rank, comm);
+#else
+    _cell_rank_by_weight(n_g_cells, n_ranks, n_cells, cell_num,
+                         cell_weight, cell_rank);
+#endif
+
+  }
+
+  else if (_part_uniform_sfc_block_size == false) {
 
     cs_gnum_t cells_per_rank = n_g_cells / n_ranks;
     cs_lnum_t rmdr = n_g_cells - cells_per_rank * (cs_gnum_t)n_ranks;
@@ -2669,6 +3011,93 @@ _read_cell_rank(cs_mesh_t            *mesh,
   return retval;
 }
 
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Build a mapping from partition ids to ranks so that consecutive
+ * partitions are placed on ranks of the same compute node.
+ *
+ * Nodes are ordered by their lowest rank, and ranks inside a node by
+ * their node-local rank. As space-filling curve partitions are contiguous
+ * along the curve, this amounts to a first split of the curve between
+ * nodes, followed by a split between ranks of each node.
+ *
+ * parameters:
+ *   comm <-- associated MPI communicator
+ *
+ * returns:
+ *   rank associated with each partition, or null if this mapping
+ *   is the identity (such as with a single node or block rank placement)
+ *----------------------------------------------------------------------------*/
+
+static int *
+_node_aware_rank_map(MPI_Comm  comm)
+{
+  int *part_rank = nullptr;
+
+#if (MPI_VERSION >= 3)
+
+  int rank_id, n_ranks;
+  MPI_Comm_rank(comm, &rank_id);
+  MPI_Comm_size(comm, &n_ranks);
+
+  MPI_Comm node_comm;
+  MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0,
+                      MPI_INFO_NULL, &node_comm);
+
+  int node_rank_id, node_leader;
+  MPI_Comm_rank(node_comm, &node_rank_id);
+  MPI_Allreduce(&rank_id, &node_leader, 1, MPI_INT, MPI_MIN, node_comm);
+  MPI_Comm_free(&node_comm);
+
+  int l_key[2] = {node_leader, node_rank_id};
+  int *g_key;
+  BFT_MALLOC(g_key, n_ranks*2, int);
+  MPI_Allgather(l_key, 2, MPI_INT, g_key, 2, MPI_INT, comm);
+
+  cs_gnum_t *key;
+  cs_lnum_t *order;
+  BFT_MALLOC(key, n_ranks, cs_gnum_t);
+  BFT_MALLOC(order, n_ranks, cs_lnum_t);
+
+  int n_nodes = 0;
+  for (int i = 0; i < n_ranks; i++) {
+    key[i] = (cs_gnum_t)g_key[i*2]*n_ranks + g_key[i*2+1];
+    if (g_key[i*2] == i)
+      n_nodes++;
+  }
+
+  BFT_FREE(g_key);
+
+  cs_order_gnum_allocated(nullptr, key, order, n_ranks);
+
+  BFT_FREE(key);
+
+  bool is_identity = true;
+  for (int i = 0; i < n_ranks; i++) {
+    if (order[i] != i)
+      is_identity = false;
+  }
+
+  bft_printf(_("\n Node-aware partitioning, number of nodes: %d%s.\n"),
+             n_nodes,
+             (is_identity) ? _(" (block rank placement)") : "");
+
+  if (is_identity == false) {
+    BFT_MALLOC(part_rank, n_ranks, int);
+    for (int i = 0; i < n_ranks; i++)
+      part_rank[i] = order[i];
+  }
+
+  BFT_FREE(order);
+
+#endif /* (MPI_VERSION >= 3) */
+
+  return part_rank;
+}
+
+#endif /* defined(HAVE_MPI) */
+
 /*----------------------------------------------------------------------------*
  * Define a naive partitioning by blocks.
  *
@@ -3065,6 +3494,28 @@ cs_partition_get_preprocess(void)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate node-aware placement of partitions.
+ *
+ * When active, partitions built using a space-filling curve are assigned
+ * to ranks so that consecutive portions of the curve are placed on the
+ * same compute node, first splitting the curve between nodes, then
+ * between ranks of each node. Most halo exchanges are then done inside
+ * nodes, even when ranks are not placed by blocks on nodes.
+ *
+ * This does not change the partitioning for graph-based algorithms.
+ *
+ * \param[in]  node_aware  true to activate node-aware placement
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_node_aware(bool  node_aware)
+{
+  _part_node_aware = node_aware;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define list of extra partitionings to build.
@@ -3096,6 +3547,213 @@ cs_partition_add_partitions(int  n_extra_partitions,
            sizeof(int)*n_extra_partitions);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Associate a cell weight with a group for the main partitioning.
+ *
+ * This allows accounting for the expected additional cost of physical
+ * models restricted to some zones (such as Lagrangian injection, immersed
+ * boundary or cooling tower packing zones) when these zones are based on
+ * mesh groups. Cells belonging to no weighted group have a unit weight;
+ * if a cell belongs to several weighted groups, the highest weight is used.
+ *
+ * Group weighting is only used by space-filling curve algorithms, and
+ * applies to the next partitioning for the main stage, after which
+ * these definitions are cleared.
+ *
+ * \param[in]  group_name  name of group
+ * \param[in]  weight      associated cell weight
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_add_group_cell_weight(const char  *group_name,
+                                   double       weight)
+{
+  if (group_name == nullptr)
+    return;
+
+  int i = _part_n_group_weights;
+
+  for (int j = 0; j < _part_n_group_weights; j++) {
+    if (strcmp(group_name, _part_group_weight_name[j]) == 0) {
+      i = j;
+      break;
+    }
+  }
+
+  if (i == _part_n_group_weights) {
+    _part_n_group_weights += 1;
+    BFT_REALLOC(_part_group_weight_name, _part_n_group_weights, char *);
+    BFT_REALLOC(_part_group_weight, _part_n_group_weights, double);
+    BFT_MALLOC(_part_group_weight_name[i], strlen(group_name) + 1, char);
+    strcpy(_part_group_weight_name[i], group_name);
+  }
+
+  _part_group_weight[i] = weight;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a function modifying cell weights for the main
+ *        partitioning.
+ *
+ * The function is called with cells in the block distribution used for
+ * partitioning, with weights initialized to 1 or based on group weights
+ * (see \ref cs_partition_add_group_cell_weight), which it may modify.
+ *
+ * This definition is only used by space-filling curve algorithms, and
+ * applies to the next partitioning for the main stage, after which it
+ * is cleared.
+ *
+ * \param[in]       func   associated function, or null
+ * \param[in, out]  input  pointer to optional (untyped) value or structure
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weight_function(cs_partition_cell_weight_t  *func,
+                                      void                        *input)
+{
+  _part_cell_weight_func = func;
+  _part_cell_weight_input = input;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define cell weights for the next partitioning.
+ *
+ * Weights are associated with the cells of the current mesh distribution,
+ * and may for example be based on measured or model-provided computational
+ * cost per cell. They are used (and freed) by the next call to
+ * \ref cs_partition; only space-filling curve algorithms currently
+ * take them into account, other algorithms ignore them.
+ *
+ * \param[in]  mesh         pointer to mesh structure
+ * \param[in]  cell_weight  cell weights (size: mesh->n_cells), or null
+ *                          to remove previously defined weights
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weights(const cs_mesh_t  *mesh,
+                              const cs_real_t   cell_weight[])
+{
+  _free_cell_weights();
+
+  if (cell_weight == nullptr)
+    return;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+
+  BFT_MALLOC(_part_cell_gnum, n_cells, cs_gnum_t);
+  BFT_MALLOC(_part_cell_weight, n_cells, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    _part_cell_gnum[i] = (mesh->global_cell_num != nullptr) ?
+      mesh->global_cell_num[i] : (cs_gnum_t)(i+1);
+    _part_cell_weight[i] = cell_weight[i];
+  }
+
+  _part_n_weighted_cells = n_cells;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Repartition a mesh in memory if its load imbalance is too high.
+ *
+ * The load of each rank is based on the sum of its cell weights, or on its
+ * number of cells if no weights are given. If the relative imbalance
+ * (maximum load over mean load, minus 1) exceeds the given tolerance,
+ * the mesh is converted back to a builder structure, repartitioned
+ * with the main stage options, and redistributed, with no intermediate
+ * file output.
+ *
+ * Only the mesh is redistributed; this function should thus be called
+ * before mesh quantities and fields are built, or at a synchronization
+ * point where other data is rebuilt (as when restarting).
+ *
+ * \param[in, out]  mesh           pointer to mesh structure
+ * \param[in]       cell_weight    cell weights (size: mesh->n_cells),
+ *                                 or null
+ * \param[in]       imbalance_tol  tolerated load imbalance
+ *
+ * \return  true if the mesh was repartitioned, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_partition_rebalance(cs_mesh_t        *mesh,
+                       const cs_real_t   cell_weight[],
+                       double            imbalance_tol)
+{
+  if (cs_glob_n_ranks < 2)
+    return false;
+
+  double w_max = mesh->n_cells;
+  if (cell_weight != nullptr) {
+    w_max = 0.;
+    for (cs_lnum_t i = 0; i < mesh->n_cells; i++) {
+      if (cell_weight[i] > 0.)
+        w_max += cell_weight[i];
+    }
+  }
+  double w_mean = w_max;
+
+  cs_parall_max(1, CS_DOUBLE, &w_max);
+  cs_parall_sum(1, CS_DOUBLE, &w_mean);
+  w_mean /= cs_glob_n_ranks;
+
+  if (!(w_mean > 0.))
+    return false;
+
+  double imbalance = w_max / w_mean - 1.;
+
+  if (imbalance <= imbalance_tol)
+    return false;
+
+  cs_timer_t t0 = cs_timer_time();
+
+  cs_partition_set_cell_weights(mesh, cell_weight);
+
+  cs_mesh_builder_destroy(&cs_glob_mesh_builder);
+  cs_glob_mesh_builder = cs_mesh_builder_create();
+  cs_mesh_to_builder(mesh, cs_glob_mesh_builder, true, nullptr);
+
+  cs_partition(mesh, cs_glob_mesh_builder, CS_PARTITION_MAIN);
+
+  cs_mesh_from_builder(mesh, cs_glob_mesh_builder);
+  cs_mesh_init_halo(mesh, cs_glob_mesh_builder, mesh->halo_type, -1, true);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_t dt = cs_timer_diff(&t0, &t1);
+
+  /* Weights are not migrated, so the final imbalance is only known
+     when based on cell counts */
+
+  if (cell_weight == nullptr) {
+    w_max = mesh->n_cells;
+    cs_parall_max(1, CS_DOUBLE, &w_max);
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("\n"
+                    " Mesh repartitioned in memory:\n"
+                    "   load imbalance before: %.3g, after: %.3g\n"),
+                  imbalance, w_max / w_mean - 1.);
+  }
+  else
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("\n"
+                    " Mesh repartitioned in memory using cell weights:\n"
+                    "   load imbalance before: %.3g\n"),
+                  imbalance);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nMesh repartitioning: %.3g s\n"),
+                (double)(dt.nsec*1.e-9));
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Partition mesh based on current options.
@@ -3161,12 +3819,15 @@ cs_partition(cs_mesh_t             *mesh,
     _read_cell_rank(mesh, mb, stage, CS_IO_ECHO_OPEN_CLOSE);
     if (mb->have_cell_rank) {
       cs_partition_set_preprocess(false);
+      _free_cell_weights();
       return;
     }
   }
   else { /* if (cs_glob_n_ranks == 1) */
-    if (stage != CS_PARTITION_MAIN || n_extra_partitions < 1)
+    if (stage != CS_PARTITION_MAIN || n_extra_partitions < 1) {
+      _free_cell_weights();
       return;
+    }
   }
 
   (void)cs_timer_wtime();
@@ -3470,6 +4131,19 @@ cs_partition(cs_mesh_t             *mesh,
 
     BFT_MALLOC(cell_part, n_cells, int);
 
+    cs_real_t *cell_weight = _block_cell_weights(mb);
+    if (cell_weight == nullptr && stage == CS_PARTITION_MAIN)
+      cell_weight = _defined_cell_weights(mesh, mb);
+
+    if (cell_weight != nullptr)
+      bft_printf(_("\n Using cell weights for partitioning.\n"));
+
+    int *part_rank = nullptr;
+#if defined(HAVE_MPI)
+    if (_part_node_aware && cs_glob_n_ranks > 1)
+      part_rank = _node_aware_rank_map(cs_glob_mpi_comm);
+#endif
+
     for (i = 0; i < n_extra_partitions + 1; i++) {
 
       int  n_ranks = cs_glob_n_ranks;
@@ -3490,12 +4164,19 @@ cs_partition(cs_mesh_t             *mesh,
                         n_ranks,
                         mb,
                         sfc_type,
+                        cell_weight,
                         cell_part,
                         cs_glob_mpi_comm);
 #else
-      _cell_rank_by_sfc(mesh->n_g_cells, n_ranks, mb, sfc_type, cell_part);
+      _cell_rank_by_sfc(mesh->n_g_cells, n_ranks, mb, sfc_type,
+                        cell_weight, cell_part);
 #endif
 
+      if (part_rank != nullptr && n_ranks == cs_glob_n_ranks) {
+        for (cs_lnum_t j = 0; j < n_cells; j++)
+          cell_part[j] = part_rank[cell_part[j]];
+      }
+
       _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
 
       if (write_output || i < n_extra_partitions)
@@ -3505,6 +4186,9 @@ cs_partition(cs_mesh_t             *mesh,
                       cell_part);
     }
 
+    BFT_FREE(part_rank);
+    BFT_FREE(cell_weight);
+
   }
 
   /* Naive partitioner */
@@ -3517,6 +4201,17 @@ cs_partition(cs_mesh_t             *mesh,
 
   }
 
+  /* Cell weights are only handled by space-filling curve partitioning */
+
+  if (_part_cell_weight != nullptr) {
+    bft_printf(_("\n Cell weights are ignored by this partitioning"
+                 " algorithm.\n"));
+    _free_cell_weights();
+  }
+
+  if (stage == CS_PARTITION_MAIN)
+    _free_cell_weight_definitions();
+
   /* Reset extra partitions list if used */
 
   if (n_extra_partitions > 0) {
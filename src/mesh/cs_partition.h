@@ -116,6 +116,30 @@ typedef enum {
 
 } cs_partition_algorithm_t;
 
+/*----------------------------------------------------------------------------
+ * Function pointer for definition of cell weights for partitioning.
+ *
+ * Cells are provided in the block distribution used for partitioning,
+ * so the full mesh connectivity is not available; cell centers and
+ * families (with the associated mesh groups) may be used.
+ *
+ * parameters:
+ *   input       <-> pointer to optional (untyped) value or structure
+ *   mesh        <-- pointer to mesh structure (families and groups only)
+ *   n_cells     <-- number of cells in local block
+ *   cell_center <-- cell centers (interlaced, size: n_cells*3)
+ *   cell_family <-- cell family number (1 to n, 0 if none), or null
+ *   cell_weight <-> cell weights
+ *----------------------------------------------------------------------------*/
+
+typedef void
+(cs_partition_cell_weight_t) (void               *input,
+                              const cs_mesh_t    *mesh,
+                              cs_lnum_t           n_cells,
+                              const cs_coord_t    cell_center[],
+                              const int           cell_family[],
+                              cs_real_t           cell_weight[]);
+
 /*============================================================================
  * Static global variables
  *============================================================================*/
@@ -208,6 +232,24 @@ cs_partition_set_preprocess(bool  active);
 bool
 cs_partition_get_preprocess(void);
 
+/*----------------------------------------------------------------------------
+ * Activate or deactivate node-aware placement of partitions.
+ *
+ * When active, partitions built using a space-filling curve are assigned
+ * to ranks so that consecutive portions of the curve are placed on the
+ * same compute node, first splitting the curve between nodes, then
+ * between ranks of each node. Most halo exchanges are then done inside
+ * nodes, even when ranks are not placed by blocks on nodes.
+ *
+ * This does not change the partitioning for graph-based algorithms.
+ *
+ * parameters:
+ *   node_aware <-- true to activate node-aware placement
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_node_aware(bool  node_aware);
+
 /*----------------------------------------------------------------------------
  * Define list of extra partitionings to build.
  *
@@ -228,6 +270,95 @@ void
 cs_partition_add_partitions(int  n_extra_partitions,
                             int  extra_partitions_list[]);
 
+/*----------------------------------------------------------------------------
+ * Associate a cell weight with a group for the main partitioning.
+ *
+ * This allows accounting for the expected additional cost of physical
+ * models restricted to some zones (such as Lagrangian injection, immersed
+ * boundary or cooling tower packing zones) when these zones are based on
+ * mesh groups. Cells belonging to no weighted group have a unit weight;
+ * if a cell belongs to several weighted groups, the highest weight is used.
+ *
+ * Group weighting is only used by space-filling curve algorithms, and
+ * applies to the next partitioning for the main stage, after which
+ * these definitions are cleared.
+ *
+ * parameters:
+ *   group_name <-- name of group
+ *   weight     <-- associated cell weight
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_add_group_cell_weight(const char  *group_name,
+                                   double       weight);
+
+/*----------------------------------------------------------------------------
+ * Define a function modifying cell weights for the main partitioning.
+ *
+ * The function is called with cells in the block distribution used for
+ * partitioning, with weights initialized to 1 or based on group weights
+ * (see cs_partition_add_group_cell_weight), which it may modify.
+ *
+ * This definition is only used by space-filling curve algorithms, and
+ * applies to the next partitioning for the main stage, after which it
+ * is cleared.
+ *
+ * parameters:
+ *   func  <-- associated function, or null
+ *   input <-> pointer to optional (untyped) value or structure
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weight_function(cs_partition_cell_weight_t  *func,
+                                      void                        *input);
+
+/*----------------------------------------------------------------------------
+ * Define cell weights for the next partitioning.
+ *
+ * Weights are associated with the cells of the current mesh distribution,
+ * and may for example be based on measured or model-provided computational
+ * cost per cell. They are used (and freed) by the next call to
+ * cs_partition(); only space-filling curve algorithms currently
+ * take them into account, other algorithms ignore them.
+ *
+ * parameters:
+ *   mesh        <-- pointer to mesh structure
+ *   cell_weight <-- cell weights (size: mesh->n_cells), or null
+ *                   to remove previously defined weights
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weights(const cs_mesh_t  *mesh,
+                              const cs_real_t   cell_weight[]);
+
+/*----------------------------------------------------------------------------
+ * Repartition a mesh in memory if its load imbalance is too high.
+ *
+ * The load of each rank is based on the sum of its cell weights, or on its
+ * number of cells if no weights are given. If the relative imbalance
+ * (maximum load over mean load, minus 1) exceeds the given tolerance,
+ * the mesh is converted back to a builder structure, repartitioned
+ * with the main stage options, and redistributed, with no intermediate
+ * file output.
+ *
+ * Only the mesh is redistributed; this function should thus be called
+ * before mesh quantities and fields are built, or at a synchronization
+ * point where other data is rebuilt (as when restarting).
+ *
+ * parameters:
+ *   mesh          <-> pointer to mesh structure
+ *   cell_weight   <-- cell weights (size: mesh->n_cells), or null
+ *   imbalance_tol <-- tolerated load imbalance
+ *
+ * returns:
+ *   true if the mesh was repartitioned, false otherwise
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_partition_rebalance(cs_mesh_t        *mesh,
+                       const cs_real_t   cell_weight[],
+                       double            imbalance_tol);
+
 /*----------------------------------------------------------------------------
  * Compute partitioning for a given mesh.
  *
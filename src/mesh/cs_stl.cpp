@@ -2131,18 +2131,8 @@ cs_stl_refine(cs_stl_mesh_t *stl_mesh,
     /* Every 2 refinemet stages and at the end, re-partition
      * the mesh to limit imbalance in the processors load */
 
-    if ((n_level%2 == 0 || n_level == n_ref -1)
-        && cs_glob_rank_id > -1) {
-
-      cs_mesh_builder_destroy(&cs_glob_mesh_builder);
-      cs_glob_mesh_builder = cs_mesh_builder_create();
-      cs_mesh_to_builder(m, cs_glob_mesh_builder, true, nullptr);
-
-      cs_partition(m, cs_glob_mesh_builder, CS_PARTITION_MAIN);
-
-      cs_mesh_from_builder(m, cs_glob_mesh_builder);
-      cs_mesh_init_halo(m, cs_glob_mesh_builder, m->halo_type, -1, true);
-    }
+    if (n_level%2 == 0 || n_level == n_ref -1)
+      cs_mesh_refine_repartition(m, 0.);
 
     cs_mesh_update_auxiliary(m);
   }
@@ -2484,30 +2474,61 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
   if (m->halo!=nullptr)
     cs_halo_sync_num(m->halo, CS_HALO_STANDARD, cell_tag);
 
-  /* Loop on internal faces "Algo glouton" */
+  /* Propagate outside tags through interior faces.
+     On each rank, a front (work list) seeded with outside cells
+     (including ghosts) is advanced until exhaustion, so global
+     iterations are only needed to cross rank boundaries. */
 
-  bool new_cells_found = true;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
 
-  while (new_cells_found) {
+  cs_lnum_t *c2c_idx = nullptr, *c2c = nullptr, *front = nullptr;
+  BFT_MALLOC(c2c_idx, n_cells_ext + 1, cs_lnum_t);
+  BFT_MALLOC(front, n_cells_ext, cs_lnum_t);
 
-    cs_gnum_t cpt = 0;
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext + 1; cell_id++)
+    c2c_idx[cell_id] = 0;
 
-    for (cs_lnum_t face_id = 0; face_id < m->n_i_faces; face_id ++) {
+  for (cs_lnum_t face_id = 0; face_id < m->n_i_faces; face_id++) {
+    c2c_idx[ifacel[face_id][0] + 1] += 1;
+    c2c_idx[ifacel[face_id][1] + 1] += 1;
+  }
 
-      cs_lnum_t ii = ifacel[face_id][0];
-      cs_lnum_t jj = ifacel[face_id][1];
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++)
+    c2c_idx[cell_id + 1] += c2c_idx[cell_id];
 
-      int ti = cell_tag[ii];
-      int tj = cell_tag[jj];
+  BFT_MALLOC(c2c, c2c_idx[n_cells_ext], cs_lnum_t);
 
-      if (ti == 1 && tj == -1) {
-        cell_tag[ii] = -1;
-        cpt ++;
-      }
+  for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++)
+    front[cell_id] = c2c_idx[cell_id];
+
+  for (cs_lnum_t face_id = 0; face_id < m->n_i_faces; face_id++) {
+    cs_lnum_t ii = ifacel[face_id][0];
+    cs_lnum_t jj = ifacel[face_id][1];
+    c2c[front[ii]++] = jj;
+    c2c[front[jj]++] = ii;
+  }
 
-      if (ti == -1 && tj == 1) {
-        cell_tag[jj] = -1;
-        cpt ++;
+  bool new_cells_found = true;
+
+  while (new_cells_found) {
+
+    cs_gnum_t cpt = 0;
+    cs_lnum_t n_front = 0;
+
+    for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++) {
+      if (cell_tag[cell_id] == -1)
+        front[n_front++] = cell_id;
+    }
+
+    while (n_front > 0) {
+      cs_lnum_t ii = front[--n_front];
+      for (cs_lnum_t j = c2c_idx[ii]; j < c2c_idx[ii+1]; j++) {
+        cs_lnum_t jj = c2c[j];
+        if (cell_tag[jj] == 1) {
+          cell_tag[jj] = -1;
+          front[n_front++] = jj;
+          cpt ++;
+        }
       }
     }
 
@@ -2521,6 +2542,10 @@ cs_stl_compute_porosity(cs_stl_mesh_t *stl_mesh,
       cs_halo_sync_num(m->halo, CS_HALO_STANDARD, cell_tag);
   }
 
+  BFT_FREE(front);
+  BFT_FREE(c2c);
+  BFT_FREE(c2c_idx);
+
   for (cs_lnum_t cell_id = 0; cell_id < m->n_cells; cell_id ++) {
     if (indic != nullptr)
       indic[cell_id] = cell_tag[cell_id];
@@ -114,6 +114,64 @@ const cs_real_t x_kg[5] = {0.0001, 0.25, 0.5, 0.75, 1.0};
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Allocate the k-distributions table.
+ *
+ * When running on multiple ranks, the table is allocated in node-shared
+ * memory, so that a single copy is stored per node.
+ *
+ * \param[in]  n_values  number of table values
+ *
+ * \return  true if the local rank must read and fill the table
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_kmfs_allocate(size_t  n_values)
+{
+  bool fill_table = true;
+
+  kmfs = (cs_real_t *)cs_parall_shared_malloc(n_values*sizeof(cs_real_t),
+                                              &fill_table);
+
+  return fill_table;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Synchronize the k-distributions table and associated values
+ *        once filled.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_kmfs_sync(void)
+{
+  cs_parall_shared_sync(kmfs);
+
+#if defined(HAVE_MPI)
+
+  MPI_Comm node_comm = cs_parall_shared_comm();
+  if (node_comm != MPI_COMM_NULL)
+    MPI_Bcast(gi, ng, CS_MPI_REAL, 0, node_comm);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free the k-distributions table.
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_kmfs_free(void)
+{
+  cs_parall_shared_free(kmfs);
+  kmfs = nullptr;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Convert a line of values in a file into an array of cs_real_t and
@@ -965,10 +1023,10 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
     BFT_MALLOC(wv,    nband, cs_real_t);
     BFT_MALLOC(dwv,   nband, cs_real_t);
 
-    BFT_MALLOC(kmfs, nconc * nconc * nt *nt *ng, cs_real_t);
+    bool fill_kmfs = _kmfs_allocate((size_t)nconc * nconc * nt * nt * ng);
 
     /* Read k-distributions */
-    {
+    if (fill_kmfs) {
       snprintf(filepath, 256, "%s/data/thch/dp_radiat_MFS_FSCK", pathdatadir);
       radfile = fopen(filepath, "r");
       char line[256];
@@ -997,6 +1055,8 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
       fclose(radfile);
     }
 
+    _kmfs_sync();
+
     /* Read the Planck coefficients */
     {
       snprintf(filepath, 256, "%s/data/thch/dp_radiat_Planck_CO2", pathdatadir);
@@ -1328,7 +1388,7 @@ cs_rad_transfer_fsck(const cs_real_t  *restrict pco2,
     BFT_FREE(kph2o);
     BFT_FREE(wv);
     BFT_FREE(dwv);
-    BFT_FREE(kmfs);
+    _kmfs_free();
     BFT_FREE(gq);
   }
 
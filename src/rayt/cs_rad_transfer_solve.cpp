@@ -102,6 +102,12 @@ BEGIN_C_DECLS
 
 static int ipadom = 0;
 
+/* Boundary normalization factor for DOM radiance boundary conditions
+   (pi / integral of incoming s.n over directions), which depends only
+   on the mesh and quadrature, so is computed once */
+
+static cs_real_t *_b_dom_bc_factor = nullptr;
+
 /*=============================================================================
  * Local Macro Definitions
  *============================================================================*/
@@ -218,9 +224,214 @@ _order_axis(const cs_real_t  s[],
 
 }
 
+/*----------------------------------------------------------------------------
+ * Insert a value in a binary min-heap.
+ *
+ * parameters:
+ *   heap   <-> heap values
+ *   n_heap <-> number of values in heap
+ *   v      <-- value to insert
+ *----------------------------------------------------------------------------*/
+
+inline static void
+_heap_push(cs_lnum_t   heap[],
+           cs_lnum_t  *n_heap,
+           cs_lnum_t   v)
+{
+  cs_lnum_t i = *n_heap;
+  *n_heap += 1;
+
+  while (i > 0) {
+    cs_lnum_t p = (i-1) / 2;
+    if (heap[p] <= v)
+      break;
+    heap[i] = heap[p];
+    i = p;
+  }
+
+  heap[i] = v;
+}
+
+/*----------------------------------------------------------------------------
+ * Remove and return the smallest value of a binary min-heap.
+ *
+ * parameters:
+ *   heap   <-> heap values
+ *   n_heap <-> number of values in heap (> 0)
+ *
+ * returns:
+ *   smallest heap value
+ *----------------------------------------------------------------------------*/
+
+inline static cs_lnum_t
+_heap_pop(cs_lnum_t   heap[],
+          cs_lnum_t  *n_heap)
+{
+  cs_lnum_t retval = heap[0];
+
+  *n_heap -= 1;
+
+  cs_lnum_t n = *n_heap;
+  cs_lnum_t v = heap[n];
+  cs_lnum_t i = 0;
+
+  while (2*i + 1 < n) {
+    cs_lnum_t c = 2*i + 1;
+    if (c + 1 < n && heap[c+1] < heap[c])
+      c++;
+    if (v <= heap[c])
+      break;
+    heap[i] = heap[c];
+    i = c;
+  }
+
+  if (n > 0)
+    heap[i] = v;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Order cells from upwind to downwind for a given direction.
+ *
+ * Cells are ordered topologically based on the sign of the direction's
+ * flux through interior faces, so that for the non-dispersive transport
+ * equation, an ordered Gauss-Seidel sweep is a direct solve on each rank
+ * (except for halo dependencies). Ready cells are processed by increasing
+ * axial coordinate, which is also used to break possible cycles
+ * (in which case a few sweeps are needed).
+ *
+ * parameters:
+ *   v     <-- direction vector
+ *   s     <-> work array for axial coordinate (size: n_cells)
+ *   order --> pointer to pre-allocated ordering table
+ *----------------------------------------------------------------------------*/
+
+static void
+_order_upwind(const cs_real_t  v[3],
+              cs_real_t        s[],
+              cs_lnum_t        order[])
+{
+  const cs_mesh_t  *m = cs_glob_mesh;
+  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *restrict i_face_cells = m->i_face_cells;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *)fvq->i_face_normal;
+
+  /* Axial ordering, used as priority */
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    s[c_id] = cs_math_3_dot_product(v, cell_cen[c_id]);
+
+  cs_lnum_t *a_order, *a_rank, *n_up, *down_idx, *down, *heap;
+  BFT_MALLOC(a_order, n_cells, cs_lnum_t);
+  BFT_MALLOC(a_rank, n_cells, cs_lnum_t);
+  BFT_MALLOC(n_up, n_cells, cs_lnum_t);
+  BFT_MALLOC(down_idx, n_cells+1, cs_lnum_t);
+
+  _order_axis(s, a_order, n_cells);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    a_rank[a_order[i]] = i;
+
+  /* Build downwind adjacency (local cells only) */
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    n_up[c_id] = 0;
+    down_idx[c_id] = 0;
+  }
+  down_idx[n_cells] = 0;
+
+  for (int pass = 0; pass < 2; pass++) {
+
+    for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+      cs_lnum_t c0 = i_face_cells[f_id][0], c1 = i_face_cells[f_id][1];
+      if (c0 >= n_cells || c1 >= n_cells)
+        continue;
+      cs_real_t flux = cs_math_3_dot_product(v, i_face_normal[f_id]);
+      cs_lnum_t c_up = c0, c_down = c1;
+      if (flux < 0) {
+        c_up = c1;
+        c_down = c0;
+      }
+      else if (flux <= 0)
+        continue;
+      if (pass == 0) {
+        down_idx[c_up+1] += 1;
+        n_up[c_down] += 1;
+      }
+      else
+        down[down_idx[c_up] + order[c_up]++] = c_down;
+    }
+
+    if (pass == 0) {
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+        down_idx[c_id+1] += down_idx[c_id];
+        order[c_id] = 0; /* used as insertion counter in next pass */
+      }
+      BFT_MALLOC(down, down_idx[n_cells], cs_lnum_t);
+    }
+
+  }
+
+  /* Topological ordering, by axial priority */
+
+  BFT_MALLOC(heap, n_cells, cs_lnum_t);
+
+  cs_lnum_t n_heap = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    if (n_up[c_id] == 0)
+      _heap_push(heap, &n_heap, a_rank[c_id]);
+  }
+
+  cs_lnum_t a_id = 0;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+
+    cs_lnum_t c_id;
+
+    if (n_heap > 0)
+      c_id = a_order[_heap_pop(heap, &n_heap)];
+
+    else { /* Cycle: force first remaining cell in axial order */
+      while (n_up[a_order[a_id]] < 0)
+        a_id++;
+      c_id = a_order[a_id];
+    }
+
+    order[i] = c_id;
+    n_up[c_id] = -1;
+
+    for (cs_lnum_t j = down_idx[c_id]; j < down_idx[c_id+1]; j++) {
+      cs_lnum_t c_down = down[j];
+      if (n_up[c_down] > 0) {
+        n_up[c_down] -= 1;
+        if (n_up[c_down] == 0)
+          _heap_push(heap, &n_heap, a_rank[c_down]);
+      }
+    }
+
+  }
+
+  BFT_FREE(heap);
+  BFT_FREE(down);
+  BFT_FREE(down_idx);
+  BFT_FREE(n_up);
+  BFT_FREE(a_rank);
+  BFT_FREE(a_order);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Order linear solvers for DOM radiative model.
+ *
+ * Without dispersion, each direction is solved using Gauss-Seidel
+ * sweeps ordered from upwind to downwind cells (computed once).
  */
 /*----------------------------------------------------------------------------*/
 
@@ -228,11 +439,8 @@ static void
 _order_by_direction(void)
 {
   const cs_mesh_t  *m = cs_glob_mesh;
-  const cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
 
   const cs_lnum_t n_cells = m->n_cells;
-  const cs_real_3_t *restrict cell_cen
-    = (const cs_real_3_t *)fvq->cell_cen;
 
   int kdir = 0;
 
@@ -266,15 +474,10 @@ _order_by_direction(void)
                                                    0,      /* poly_degree */
                                                    1000);  /* n_max_iter */
 
-              for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
-                s[c_id] =   v[0]*cell_cen[c_id][0]
-                          + v[1]*cell_cen[c_id][1]
-                          + v[2]*cell_cen[c_id][2];
-
               cs_lnum_t *order;
               BFT_MALLOC(order, n_cells, cs_lnum_t);
 
-              _order_axis(s, order, n_cells);
+              _order_upwind(v, s, order);
 
               cs_sles_it_assign_order(sc, &order); /* becomes owner of order */
 
@@ -521,7 +724,7 @@ _cs_rad_transfer_sol(int       gg_id,
    */
 
   cs_real_t aa;
-  if (!one_dir) {
+  if (!one_dir && _b_dom_bc_factor == nullptr) {
     for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
       f_snplus->val[face_id] = 0.0;
 
@@ -545,9 +748,15 @@ _cs_rad_transfer_sol(int       gg_id,
       }
     }
 
+    BFT_MALLOC(_b_dom_bc_factor, n_b_faces, cs_real_t);
+    for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++)
+      _b_dom_bc_factor[face_id] = cs_math_pi / f_snplus->val[face_id];
+  }
+
+  if (!one_dir) {
     for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
-      coefap[face_id] *= cs_math_pi / f_snplus->val[face_id];
-      cofafp[face_id] *= cs_math_pi / f_snplus->val[face_id];
+      coefap[face_id] *= _b_dom_bc_factor[face_id];
+      cofafp[face_id] *= _b_dom_bc_factor[face_id];
     }
   }
 
@@ -2291,6 +2500,18 @@ cs_rad_transfer_solve(int  bc_type[])
   BFT_FREE(iqpar);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free cached data used by the radiative transfer solver.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_finalize(void)
+{
+  BFT_FREE(_b_dom_bc_factor);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -68,6 +68,15 @@ BEGIN_C_DECLS
 void
 cs_rad_transfer_solve(int  bc_type[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free cached data used by the radiative transfer solver.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_solve_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
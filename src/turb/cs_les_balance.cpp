@@ -67,6 +67,7 @@
 #include "cs_geom.h"
 #include "cs_gradient.h"
 #include "cs_halo.h"
+#include "cs_log.h"
 #include "cs_math.h"
 #include "cs_parall.h"
 #include "cs_physical_constants.h"
@@ -221,6 +222,19 @@ static cs_field_t *_gradv   = nullptr;
 static cs_field_t *_gradnut = nullptr;
 static cs_field_t **_gradt  = nullptr;
 
+/* Operator work data shared by all budget terms of a time step
+   (boundary coefficients, face fluxes and face viscosities only
+   depend on the mesh and boundary types, so they are built once
+   per time step instead of once per divergence or Laplacian) */
+
+static int                    _work_nt = -1;
+static cs_field_bc_coeffs_t   _work_bc_v;
+static cs_field_bc_coeffs_t   _work_bc_lapl[2];
+static cs_real_t             *_work_i_flux = nullptr;
+static cs_real_t             *_work_b_flux = nullptr;
+static cs_real_t             *_work_i_visc = nullptr;
+static cs_real_t             *_work_b_visc = nullptr;
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -310,20 +324,49 @@ _les_balance_get_tm_by_scalar_id(int scalar_id,
   return f;
 }
 
-/*----------------------------------------------------------------------------*
- * Compute the Laplacian of a scalar.
- *
- * parameters:
- *   wa   <--  scalar array
- *   res  <->  Laplacian of wa
- *   type <--  called for Rij (0) or Tui (1) LES balance
+/*----------------------------------------------------------------------------
+ * Free operator work data shared by budget terms.
  *----------------------------------------------------------------------------*/
 
 static void
-_les_balance_laplacian(cs_real_t   *wa,
-                       cs_real_t   *res,
-                       int         type)
+_les_balance_work_free(void)
+{
+  if (_work_nt < 0)
+    return;
+
+  BFT_FREE(_work_bc_v.a);
+  BFT_FREE(_work_bc_v.b);
+
+  for (int type = 0; type < 2; type++) {
+    BFT_FREE(_work_bc_lapl[type].a);
+    BFT_FREE(_work_bc_lapl[type].b);
+    BFT_FREE(_work_bc_lapl[type].af);
+    BFT_FREE(_work_bc_lapl[type].bf);
+  }
+
+  BFT_FREE(_work_i_flux);
+  BFT_FREE(_work_b_flux);
+  BFT_FREE(_work_i_visc);
+  BFT_FREE(_work_b_visc);
+
+  _work_nt = -1;
+}
+
+/*----------------------------------------------------------------------------
+ * Build operator work data shared by budget terms, if not already
+ * built for the current time step.
+ *----------------------------------------------------------------------------*/
+
+static void
+_les_balance_work_update(void)
 {
+  const int nt_cur = cs_glob_time_step->nt_cur;
+
+  if (_work_nt == nt_cur)
+    return;
+
+  _les_balance_work_free();
+
   const cs_mesh_t *m = cs_glob_mesh;
   cs_mesh_quantities_t *fvq = cs_glob_mesh_quantities;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
@@ -333,77 +376,110 @@ _les_balance_laplacian(cs_real_t   *wa,
 
   const int *bc_type = cs_glob_bc_type;
 
-  cs_field_bc_coeffs_t bc_coeffs_loc; // a voir ci dessous (a=af,b=bf)
-  cs_field_bc_coeffs_init(&bc_coeffs_loc);
-  BFT_MALLOC(bc_coeffs_loc.a,  n_b_faces, cs_real_t);
-  BFT_MALLOC(bc_coeffs_loc.b,  n_b_faces, cs_real_t);
-  BFT_MALLOC(bc_coeffs_loc.af, n_b_faces, cs_real_t);
-  BFT_MALLOC(bc_coeffs_loc.bf, n_b_faces, cs_real_t);
-
-  cs_real_t *coefa = bc_coeffs_loc.a;
-  cs_real_t *coefb = bc_coeffs_loc.b;
-  cs_real_t *coefaf = bc_coeffs_loc.af;
-  cs_real_t *coefbf = bc_coeffs_loc.bf;
-
-  const cs_real_t visc = 1., pimp = 0., qimp = 0.; // hext = -1;
-  //cs_real_t a, b;
-
-  for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
-    cs_real_t hint = visc / fvq->b_dist[face_id];
-
-    if (   type == 0
-        && (   bc_type[face_id] == CS_SMOOTHWALL
-            || bc_type[face_id] == CS_ROUGHWALL) ) {
-      /*cs_boundary_conditions_set_dirichlet_scalar(&a,
-                                                  &coefaf[face_id],
-                                                  &b,
-                                                  &coefbf[face_id],
-                                                  pimp,
-                                                  hint,
-                                                  hext);
-      */
-
-      coefaf[face_id] = -hint*pimp;
-      coefbf[face_id] =  hint;
+  /* Vector BC coefficients and fluxes for divergence */
 
-      coefa[face_id] = coefaf[face_id];
-      coefb[face_id] = coefbf[face_id];
+  cs_field_bc_coeffs_init(&_work_bc_v);
+  BFT_MALLOC(_work_bc_v.b, 9*n_b_faces, cs_real_t);
+  BFT_MALLOC(_work_bc_v.a, 3*n_b_faces, cs_real_t);
 
+  cs_real_3_t  *coefav = (cs_real_3_t  *)_work_bc_v.a;
+  cs_real_33_t *coefbv = (cs_real_33_t *)_work_bc_v.b;
+
+  for (cs_lnum_t ifac = 0; ifac < n_b_faces; ifac++) {
+    for (cs_lnum_t ii = 0; ii < 3; ii++) {
+        coefav[ifac][ii] = 0.;
+        for (cs_lnum_t pp = 0; pp < 3; pp++) {
+          if (bc_type[ifac] == CS_SMOOTHWALL
+           || bc_type[ifac] == CS_ROUGHWALL)
+            coefbv[ifac][ii][pp] = 0.;
+          else
+            coefbv[ifac][ii][pp] = 1.;
+      }
     }
-    else {
-      /*
-      cs_boundary_conditions_set_neumann_scalar(&a,
-                                                &coefaf[face_id],
-                                                &b,
-                                                &coefbf[face_id],
-                                                qimp,
-                                                hint);
-      */
-
-      coefaf[face_id] = qimp;
-      coefbf[face_id] = 0.;
+  }
+
+  BFT_MALLOC(_work_i_flux, n_i_faces, cs_real_t);
+  BFT_MALLOC(_work_b_flux, n_b_faces, cs_real_t);
+
+  /* Scalar BC coefficients for Laplacian (a=af, b=bf),
+     for Rij (0) or Tui (1) LES balance */
+
+  const cs_real_t visc = 1., pimp = 0., qimp = 0.;
+
+  for (int type = 0; type < 2; type++) {
+
+    cs_field_bc_coeffs_t *bc_coeffs_loc = _work_bc_lapl + type;
+    cs_field_bc_coeffs_init(bc_coeffs_loc);
+    BFT_MALLOC(bc_coeffs_loc->a,  n_b_faces, cs_real_t);
+    BFT_MALLOC(bc_coeffs_loc->b,  n_b_faces, cs_real_t);
+    BFT_MALLOC(bc_coeffs_loc->af, n_b_faces, cs_real_t);
+    BFT_MALLOC(bc_coeffs_loc->bf, n_b_faces, cs_real_t);
+
+    cs_real_t *coefa = bc_coeffs_loc->a;
+    cs_real_t *coefb = bc_coeffs_loc->b;
+    cs_real_t *coefaf = bc_coeffs_loc->af;
+    cs_real_t *coefbf = bc_coeffs_loc->bf;
+
+    for (cs_lnum_t face_id = 0; face_id < n_b_faces; face_id++) {
+      cs_real_t hint = visc / fvq->b_dist[face_id];
+
+      if (   type == 0
+          && (   bc_type[face_id] == CS_SMOOTHWALL
+              || bc_type[face_id] == CS_ROUGHWALL) ) {
+        /* Dirichlet */
+        coefaf[face_id] = -hint*pimp;
+        coefbf[face_id] =  hint;
+      }
+      else {
+        /* Neumann */
+        coefaf[face_id] = qimp;
+        coefbf[face_id] = 0.;
+      }
 
       coefa[face_id] = coefaf[face_id];
       coefb[face_id] = coefbf[face_id];
-
     }
+
   }
 
-  cs_real_t *c_visc, *i_visc, *b_visc;
+  /* Unit face viscosity */
+
+  cs_real_t *c_visc;
   BFT_MALLOC(c_visc, n_cells_ext, cs_real_t);
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
     c_visc[c_id] = visc;
 
-  BFT_MALLOC(i_visc, n_i_faces, cs_real_t);
-  BFT_MALLOC(b_visc, n_b_faces, cs_real_t);
+  BFT_MALLOC(_work_i_visc, n_i_faces, cs_real_t);
+  BFT_MALLOC(_work_b_visc, n_b_faces, cs_real_t);
   cs_face_viscosity(m,
                     fvq,
                     0,      /* mean type */
                     c_visc,
-                    i_visc,
-                    b_visc);
+                    _work_i_visc,
+                    _work_b_visc);
   BFT_FREE(c_visc);
 
+  _work_nt = nt_cur;
+}
+
+/*----------------------------------------------------------------------------*
+ * Compute the Laplacian of a scalar.
+ *
+ * parameters:
+ *   wa   <--  scalar array
+ *   res  <->  Laplacian of wa
+ *   type <--  called for Rij (0) or Tui (1) LES balance
+ *----------------------------------------------------------------------------*/
+
+static void
+_les_balance_laplacian(cs_real_t   *wa,
+                       cs_real_t   *res,
+                       int         type)
+{
+  const cs_lnum_t n_cells = cs_glob_mesh->n_cells;
+
+  _les_balance_work_update();
+
   const cs_equation_param_t *eqp = cs_field_get_equation_param_const(CS_F_(vel));
   cs_equation_param_t _eqp = *eqp;
   _eqp.iconv = 0; /* only diffusion */
@@ -418,21 +494,13 @@ _les_balance_laplacian(cs_real_t   *wa,
                                  wa,             /* pvar */
                                  nullptr,           /* pvara (not used) */
                                  0,              /* icvfli (not used) */
-                                 &bc_coeffs_loc, /* coefa & b not used */
-                                 i_visc,         /* mass flux (not used) */
-                                 b_visc,         /* mass flux (not used) */
-                                 i_visc,
-                                 b_visc,
+                                 _work_bc_lapl + type, /* a & b not used */
+                                 _work_i_visc,   /* mass flux (not used) */
+                                 _work_b_visc,   /* mass flux (not used) */
+                                 _work_i_visc,
+                                 _work_b_visc,
                                  res);
 
-  BFT_FREE(coefa);
-  BFT_FREE(coefb);
-  BFT_FREE(coefaf);
-  BFT_FREE(coefbf);
-
-  BFT_FREE(i_visc);
-  BFT_FREE(b_visc);
-
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
     res[c_id] /= cs_glob_mesh_quantities->cell_f_vol[c_id];
 }
@@ -453,25 +521,11 @@ _les_balance_laplacian(cs_real_t   *wa,
 {
   const cs_mesh_t *m = cs_glob_mesh;
   cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
-  const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
-  const cs_lnum_t n_i_faces = cs_glob_mesh->n_i_faces;
-  const int *bc_type = cs_glob_bc_type;
   int f_id, itypfl, iflmb0, init, inc;
 
-  cs_real_t *i_massflux, *b_massflux;
-
   const cs_equation_param_t *eqp = cs_field_get_equation_param_const(CS_F_(vel));
 
-  cs_field_bc_coeffs_t bc_coeffs_v_loc;
-  cs_field_bc_coeffs_init(&bc_coeffs_v_loc);
-  BFT_MALLOC(bc_coeffs_v_loc.b, 9*n_b_faces, cs_real_t);
-  BFT_MALLOC(bc_coeffs_v_loc.a, 3*n_b_faces, cs_real_t);
-
-  cs_real_3_t  *coefav = (cs_real_3_t  *)bc_coeffs_v_loc.a;
-  cs_real_33_t *coefbv = (cs_real_33_t *)bc_coeffs_v_loc.b;
-
-  BFT_MALLOC(i_massflux, n_i_faces, cs_real_t);
-  BFT_MALLOC(b_massflux, n_b_faces, cs_real_t);
+  _les_balance_work_update();
 
   f_id = -1;
   itypfl = 0;
@@ -479,20 +533,6 @@ _les_balance_laplacian(cs_real_t   *wa,
   init = 1;
   inc = 1;
 
-  /* Bc coeffs */
-  for (cs_lnum_t ifac = 0; ifac < n_b_faces; ifac++) {
-    for (cs_lnum_t ii = 0; ii < 3; ii++) {
-        coefav[ifac][ii] = 0.;
-        for (cs_lnum_t pp = 0; pp < 3; pp++) {
-          if (bc_type[ifac] == CS_SMOOTHWALL
-           || bc_type[ifac] == CS_ROUGHWALL)
-            coefbv[ifac][ii][pp] = 0.;
-          else
-            coefbv[ifac][ii][pp] = 1.;
-      }
-    }
-  }
-
   cs_mass_flux(m,
                mq,
                f_id,
@@ -509,21 +549,15 @@ _les_balance_laplacian(cs_real_t   *wa,
                nullptr,
                nullptr,
                (const cs_real_3_t *)wa,
-               &bc_coeffs_v_loc,
-               i_massflux,
-               b_massflux);
+               &_work_bc_v,
+               _work_i_flux,
+               _work_b_flux);
 
   cs_divergence(m,
                 init,
-                i_massflux,
-                b_massflux,
+                _work_i_flux,
+                _work_b_flux,
                 res);
-
-  BFT_FREE(coefav);
-  BFT_FREE(coefbv);
-
-  BFT_FREE(i_massflux);
-  BFT_FREE(b_massflux);
 }
 
 /*----------------------------------------------------------------------------
@@ -2627,6 +2661,67 @@ _les_balance_create_tui(void)
   _les_balance_initialize_tui();
 }
 
+/*----------------------------------------------------------------------------
+ * Log an estimate of the memory used by the LES balance.
+ *
+ * parameters:
+ *   n_moments_0 <-- number of time moments before LES balance setup
+ *----------------------------------------------------------------------------*/
+
+static void
+_les_balance_log_memory(int  n_moments_0)
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+
+  /* Values per cell */
+
+  double n_c_vals_m = 0, n_c_vals_b = 0;
+
+  const int n_moments = cs_time_moment_n_moments();
+  for (int m_id = n_moments_0; m_id < n_moments; m_id++) {
+    cs_field_t *f = cs_time_moment_get_field(m_id);
+    if (f != nullptr)
+      n_c_vals_m += f->dim;
+  }
+
+  if (_les_balance.type & CS_LES_BALANCE_RIJ) {
+    n_c_vals_b += 8*6;
+    if (_les_balance.type & CS_LES_BALANCE_RIJ_BASE)
+      n_c_vals_b += 6;
+    if (_les_balance.type & CS_LES_BALANCE_RIJ_FULL)
+      n_c_vals_b += 6*9;
+  }
+
+  if (_les_balance.type & CS_LES_BALANCE_TUI) {
+    double n_tui = 7 + 10*3;
+    if (_les_balance.type & CS_LES_BALANCE_TUI_BASE)
+      n_tui += 1 + 3;
+    if (_les_balance.type & CS_LES_BALANCE_TUI_FULL)
+      n_tui += 6 + 10*3;
+    n_c_vals_b += nscal*n_tui;
+  }
+
+  /* Shared operator work data (boundary coefficients, face fluxes
+     and viscosities) */
+
+  double mem[3] = {n_c_vals_m * m->n_cells_with_ghosts,
+                   n_c_vals_b * m->n_cells,
+                   22.*m->n_b_faces + 2.*m->n_i_faces};
+
+  cs_parall_sum(3, CS_DOUBLE, mem);
+
+  for (int i = 0; i < 3; i++)
+    mem[i] *= sizeof(cs_real_t) / (1024.*1024.);
+
+  cs_log_printf(CS_LOG_SETUP,
+                _("\n"
+                  "LES balance memory estimate (all ranks):\n"
+                  "  time moments:             %12.1f MiB\n"
+                  "  budget term arrays:       %12.1f MiB\n"
+                  "  shared operator work data:%12.1f MiB\n"),
+                mem[0], mem[1], mem[2]);
+}
+
 /*============================================================================
  * Prototypes for functions intended for use only by Fortran wrappers.
  * (descriptions follow, with function bodies).
@@ -2789,6 +2884,8 @@ cs_les_balance_create(void)
 
   cs_les_balance_create_fields();
 
+  const int n_moments_0 = cs_time_moment_n_moments();
+
   /* Creation of the generic time moments used for both Rij
      and Tui LES balance */
   _les_balance_time_moment();
@@ -2813,6 +2910,8 @@ cs_les_balance_create(void)
     _les_balance_create_tui();
   }
 
+  _les_balance_log_memory(n_moments_0);
+
   /* Add time moments log in the listing in DEBUG mode */
 #if DEBUG_LES == 1
   const int log_key_id = cs_field_key_id("log");
@@ -2905,7 +3004,7 @@ cs_les_balance_compute_rij(void)
   uiujuk[1] = cs_field_by_name("u1u1u1_m")->val;
   uiujuk[2] = cs_field_by_name("u1u1u2_m")->val;
   uiujuk[3] = cs_field_by_name("u1u1u3_m")->val;
-  uiujuk[3] = cs_field_by_name("u2u2u1_m")->val;
+  uiujuk[4] = cs_field_by_name("u2u2u1_m")->val;
   uiujuk[5] = cs_field_by_name("u2u2u2_m")->val;
   uiujuk[6] = cs_field_by_name("u2u2u3_m")->val;
   uiujuk[7] = cs_field_by_name("u3u3u1_m")->val;
@@ -3842,6 +3941,9 @@ cs_les_balance_finalize(void)
 
   /* Freeing of the btui structure */
   _les_balance.btui = _les_balance_destroy_tui(_les_balance.btui);
+
+  /* Freeing of shared operator work data */
+  _les_balance_work_free();
 }
 
 /*----------------------------------------------------------------------------*/
@@ -50,11 +50,13 @@
 #include "bft_mem.h"
 #include "bft_printf.h"
 
+#include "cs_ale.h"
 #include "cs_cell_to_vertex.h"
 #include "cs_ext_neighborhood.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
 #include "cs_mesh_quantities.h"
+#include "cs_turbomachinery.h"
 
 /*----------------------------------------------------------------------------
  *  Header for the current file
@@ -82,201 +84,216 @@ BEGIN_C_DECLS
  * Static global variables
  *============================================================================*/
 
+/* Extended neighborhood filter operator, in CSR form
+   (row self and neighbor cells, with normalized volume weights) */
+
+static cs_lnum_t   _ext_f_n_rows = -1;
+static cs_lnum_t  *_ext_f_idx = nullptr;
+static cs_lnum_t  *_ext_f_ids = nullptr;
+static cs_real_t  *_ext_f_w = nullptr;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
 
 /*----------------------------------------------------------------------------*/
 /*!
- * \brief Compute filters for dynamic models.
- *
- * This function deals with the standard or extended neighborhood.
- *
- * \param[in]   stride   stride of array to filter
- * \param[in]   val      array of values to filter
- * \param[out]  f_val    array of filtered values
+ * \brief Free the extended neighborhood filter operator.
  */
 /*----------------------------------------------------------------------------*/
 
 static void
-_les_filter_ext_neighborhood(int        stride,
-                             cs_real_t  val[],
-                             cs_real_t  f_val[])
+_ext_filter_operator_free(void)
 {
-  cs_real_t *w1 = nullptr, *w2 = nullptr;
+  BFT_FREE(_ext_f_w);
+  BFT_FREE(_ext_f_ids);
+  BFT_FREE(_ext_f_idx);
+  _ext_f_n_rows = -1;
+}
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Build the extended neighborhood filter operator if needed.
+ *
+ * The filtered value of a cell is the volume-weighted average over the
+ * cell itself, its extended neighbors (cell_cells connectivity) and its
+ * face neighbors. Weights only depend on the mesh, so they are built once,
+ * unless the mesh may move or change (ALE, transient turbomachinery).
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_ext_filter_operator_update(void)
+{
   const cs_mesh_t  *mesh = cs_glob_mesh;
-  const cs_lnum_t  _stride = stride;
   const cs_lnum_t  n_cells = mesh->n_cells;
-  const cs_lnum_t  n_cells_ext = mesh->n_cells_with_ghosts;
-  const cs_lnum_t  n_elts_l = n_cells * _stride;
-  const cs_lnum_t  n_elts = n_cells_ext * _stride;
-  const int n_i_groups = mesh->i_face_numbering->n_groups;
-  const int n_i_threads = mesh->i_face_numbering->n_threads;
-  const cs_lnum_t *restrict i_group_index = mesh->i_face_numbering->group_index;
+  const cs_lnum_t  n_i_faces = mesh->n_i_faces;
   const cs_lnum_t  *cell_cells_idx = mesh->cell_cells_idx;
   const cs_lnum_t  *cell_cells_lst = mesh->cell_cells_lst;
   const cs_real_t  *cell_vol = cs_glob_mesh_quantities->cell_vol;
 
   assert(cell_cells_idx != nullptr);
 
-  /* Allocate and initialize working buffers */
-
-  BFT_MALLOC(w1, n_elts, cs_real_t);
-  BFT_MALLOC(w2, n_elts, cs_real_t);
-
-  /* Case for scalar variable */
-  /*--------------------------*/
-
-  if (stride == 1) {
-
-    /* Synchronize variable */
-
-    if (mesh->halo != nullptr)
-      cs_halo_sync_var(mesh->halo, CS_HALO_EXTENDED, val);
-
-    /* Define filtered variable array */
+  bool mutable_mesh = (   cs_glob_ale != CS_ALE_NONE
+                       ||    cs_turbomachinery_get_model()
+                          == CS_TURBOMACHINERY_TRANSIENT);
 
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_cells; i++) {
+  if (_ext_f_n_rows == n_cells && !mutable_mesh)
+    return;
 
-      w1[i] = val[i] * cell_vol[i];
-      w2[i] = cell_vol[i];
+  _ext_filter_operator_free();
 
-      /* Loop on connected cells (without cells sharing a face) */
+  BFT_MALLOC(_ext_f_idx, n_cells + 1, cs_lnum_t);
 
-      for (cs_lnum_t j = cell_cells_idx[i]; j < cell_cells_idx[i+1]; j++) {
-        cs_lnum_t k = cell_cells_lst[j];
-        w1[i] += val[k] * cell_vol[k];
-        w2[i] += cell_vol[k];
-      }
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _ext_f_idx[i+1] = 1 + cell_cells_idx[i+1] - cell_cells_idx[i];
 
-    } /* End of loop on cells */
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t i = mesh->i_face_cells[f_id][0];
+    cs_lnum_t j = mesh->i_face_cells[f_id][1];
+    if (i < n_cells)
+      _ext_f_idx[i+1] += 1;
+    if (j < n_cells)
+      _ext_f_idx[j+1] += 1;
+  }
 
-#   pragma omp parallel for if (mesh->n_ghost_cells > CS_THR_MIN)
-    for (cs_lnum_t i = n_cells; i < n_cells_ext; i++) {
-      w1[i] = 0;
-      w2[i] = 0;
-    }
+  _ext_f_idx[0] = 0;
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    _ext_f_idx[i+1] += _ext_f_idx[i];
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+  BFT_MALLOC(_ext_f_ids, _ext_f_idx[n_cells], cs_lnum_t);
+  BFT_MALLOC(_ext_f_w, _ext_f_idx[n_cells], cs_real_t);
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+  /* Self and extended neighbors first, then face neighbors
+     (in face order, so cells sharing several faces appear
+     several times, as in the face-based assembly) */
 
-        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             face_id++) {
+  cs_lnum_t *shift;
+  BFT_MALLOC(shift, n_cells, cs_lnum_t);
 
-          cs_lnum_t i = mesh->i_face_cells[face_id][0];
-          cs_lnum_t j = mesh->i_face_cells[face_id][1];
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cs_lnum_t s_id = _ext_f_idx[i];
+    _ext_f_ids[s_id++] = i;
+    for (cs_lnum_t j = cell_cells_idx[i]; j < cell_cells_idx[i+1]; j++)
+      _ext_f_ids[s_id++] = cell_cells_lst[j];
+    shift[i] = s_id;
+  }
 
-          w1[i] += val[j] * cell_vol[j];
-          w2[i] += cell_vol[j];
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t i = mesh->i_face_cells[f_id][0];
+    cs_lnum_t j = mesh->i_face_cells[f_id][1];
+    if (i < n_cells)
+      _ext_f_ids[shift[i]++] = j;
+    if (j < n_cells)
+      _ext_f_ids[shift[j]++] = i;
+  }
 
-          w1[j] += val[i] * cell_vol[i];
-          w2[j] += cell_vol[i];
-        }
+  BFT_FREE(shift);
 
-      }
+  /* Normalized volume weights */
 
+# pragma omp parallel for if (n_cells > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    cs_real_t w_sum = 0;
+    for (cs_lnum_t j = _ext_f_idx[i]; j < _ext_f_idx[i+1]; j++) {
+      _ext_f_w[j] = cell_vol[_ext_f_ids[j]];
+      w_sum += _ext_f_w[j];
     }
-
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_cells; i++)
-      f_val[i] = w1[i]/w2[i];
-
-    /* Synchronize variable */
-
-    if (mesh->halo != nullptr)
-      cs_halo_sync_var(mesh->halo, CS_HALO_STANDARD, f_val);
+    const cs_real_t inv_w_sum = 1. / w_sum;
+    for (cs_lnum_t j = _ext_f_idx[i]; j < _ext_f_idx[i+1]; j++)
+      _ext_f_w[j] *= inv_w_sum;
   }
 
-  /* Case for vector or tensor variable */
-  /*------------------------------------*/
-
-  else {
+  _ext_f_n_rows = n_cells;
+}
 
-    /* Synchronize variable */
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute filters for dynamic models.
+ *
+ * This function deals with the extended neighborhood, applying the
+ * precomputed filter operator to several arrays of the same stride
+ * in a single pass over the operator.
+ *
+ * \param[in]   n_arrays  number of arrays to filter
+ * \param[in]   stride    stride of arrays to filter
+ * \param[in]   val       arrays of values to filter
+ * \param[out]  f_val     arrays of filtered values
+ */
+/*----------------------------------------------------------------------------*/
 
-    if (mesh->halo != nullptr)
-      cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED, val, stride);
+static void
+_les_filter_ext_neighborhood(int         n_arrays,
+                             int         stride,
+                             cs_real_t  *val[],
+                             cs_real_t  *f_val[])
+{
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  const cs_lnum_t  _stride = stride;
+  const cs_lnum_t  n_cells = mesh->n_cells;
 
-    /* Define filtered variable array */
+  _ext_filter_operator_update();
 
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_cells; i++) {
+  const cs_lnum_t  *f_idx = _ext_f_idx;
+  const cs_lnum_t  *f_ids = _ext_f_ids;
+  const cs_real_t  *f_w = _ext_f_w;
 
-      for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-        const cs_lnum_t ic = i *_stride + c_id;
-        w1[ic] = val[ic] * cell_vol[i];
-        w2[ic] = cell_vol[i];
-      }
+  /* Synchronize variables */
 
-      /* Loop on connected cells (without cells sharing a face) */
+  if (mesh->halo != nullptr) {
+    for (int a_id = 0; a_id < n_arrays; a_id++)
+      cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED,
+                               val[a_id], stride);
+  }
 
-      for (cs_lnum_t j = cell_cells_idx[i]; j < cell_cells_idx[i+1]; j++) {
-        cs_lnum_t k = cell_cells_lst[j];
-        for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-          const cs_lnum_t ic = i *_stride + c_id;
-          const cs_lnum_t kc = k *_stride + c_id;
-          w1[ic] += val[kc] * cell_vol[k];
-          w2[ic] += cell_vol[k];
-        }
-      }
+  /* Apply filter operator */
 
-    } /* End of loop on cells */
+  if (_stride == 1) {
 
-#   pragma omp parallel for if (mesh->n_ghost_cells > CS_THR_MIN)
-    for (cs_lnum_t i = n_cells; i < n_cells_ext; i++) {
-      for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-        const cs_lnum_t ic = i *_stride + c_id;
-        w1[ic] = 0;
-        w2[ic] = 0;
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      for (int a_id = 0; a_id < n_arrays; a_id++) {
+        const cs_real_t *_val = val[a_id];
+        cs_real_t _f_val = 0;
+        for (cs_lnum_t j = f_idx[i]; j < f_idx[i+1]; j++)
+          _f_val += f_w[j] * _val[f_ids[j]];
+        f_val[a_id][i] = _f_val;
       }
     }
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
-
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
-
-        for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-             face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-             face_id++) {
-
-          cs_lnum_t i = mesh->i_face_cells[face_id][0];
-          cs_lnum_t j = mesh->i_face_cells[face_id][1];
-
-          for (cs_lnum_t c_id = 0; c_id < _stride; c_id++) {
-            const cs_lnum_t ic = i *_stride + c_id;
-            const cs_lnum_t jc = j *_stride + c_id;
-
-            w1[ic] += val[jc] * cell_vol[j];
-            w2[ic] += cell_vol[j];
+  }
+  else {
 
-            w1[jc] += val[ic] * cell_vol[i];
-            w2[jc] += cell_vol[i];
-          }
+    assert(_stride <= 9);
 
+#   pragma omp parallel for if (n_cells > CS_THR_MIN)
+    for (cs_lnum_t i = 0; i < n_cells; i++) {
+      for (int a_id = 0; a_id < n_arrays; a_id++) {
+        const cs_real_t *_val = val[a_id];
+        cs_real_t _f_val[9];
+        for (cs_lnum_t k = 0; k < _stride; k++)
+          _f_val[k] = 0;
+        for (cs_lnum_t j = f_idx[i]; j < f_idx[i+1]; j++) {
+          const cs_real_t w = f_w[j];
+          const cs_real_t *v_j = _val + f_ids[j]*_stride;
+          for (cs_lnum_t k = 0; k < _stride; k++)
+            _f_val[k] += w * v_j[k];
         }
-
+        for (cs_lnum_t k = 0; k < _stride; k++)
+          f_val[a_id][i*_stride + k] = _f_val[k];
       }
-
     }
 
-#   pragma omp parallel for
-    for (cs_lnum_t i = 0; i < n_elts_l; i++)
-      f_val[i] = w1[i]/w2[i];
+  }
 
-    /* Synchronize variable */
+  /* Synchronize variables */
 
-    if (mesh->halo != nullptr)
-      cs_halo_sync_var_strided(mesh->halo, CS_HALO_EXTENDED, f_val, stride);
+  if (mesh->halo != nullptr) {
+    cs_halo_type_t halo_type
+      = (_stride == 1) ? CS_HALO_STANDARD : CS_HALO_EXTENDED;
+    for (int a_id = 0; a_id < n_arrays; a_id++)
+      cs_halo_sync_var_strided(mesh->halo, halo_type, f_val[a_id], stride);
   }
-
-  BFT_FREE(w2);
-  BFT_FREE(w1);
 }
 
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
@@ -303,7 +320,7 @@ cs_les_filter(int        stride,
               cs_real_t  f_val[])
 {
   if (cs_ext_neighborhood_get_type() == CS_EXT_NEIGHBORHOOD_COMPLETE) {
-    _les_filter_ext_neighborhood(stride, val, f_val);
+    _les_filter_ext_neighborhood(1, stride, &val, &f_val);
     return;
   }
 
@@ -396,6 +413,48 @@ cs_les_filter(int        stride,
     cs_halo_sync_var_strided(mesh->halo, CS_HALO_STANDARD, f_val, _stride);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute filters for dynamic models for several arrays.
+ *
+ * With the extended neighborhood, all arrays are filtered in a single
+ * pass over the filter operator; otherwise, this is equivalent to
+ * successive calls to \ref cs_les_filter.
+ *
+ * \param[in]   n_arrays  number of arrays to filter
+ * \param[in]   stride    stride of arrays to filter
+ * \param[in]   val       arrays of values to filter
+ * \param[out]  f_val     arrays of filtered values
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_multi(int         n_arrays,
+                    int         stride,
+                    cs_real_t  *val[],
+                    cs_real_t  *f_val[])
+{
+  if (cs_ext_neighborhood_get_type() == CS_EXT_NEIGHBORHOOD_COMPLETE) {
+    _les_filter_ext_neighborhood(n_arrays, stride, val, f_val);
+    return;
+  }
+
+  for (int a_id = 0; a_id < n_arrays; a_id++)
+    cs_les_filter(stride, val[a_id], f_val[a_id]);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free data associated with LES filters.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_finalize(void)
+{
+  _ext_filter_operator_free();
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
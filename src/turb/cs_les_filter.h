@@ -65,6 +65,32 @@ cs_les_filter(int        stride,
               cs_real_t  val[],
               cs_real_t  f_val[]);
 
+/*----------------------------------------------------------------------------
+ * Compute filters for dynamic models for several arrays.
+ *
+ * With the extended neighborhood, all arrays are filtered in a single
+ * pass over the filter operator.
+ *
+ * parameters:
+ *   n_arrays <--  number of arrays to filter
+ *   stride   <--  stride of arrays to filter
+ *   val      <->  arrays of values to filter
+ *   f_val    -->  arrays of filtered values
+ *----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_multi(int         n_arrays,
+                    int         stride,
+                    cs_real_t  *val[],
+                    cs_real_t  *f_val[]);
+
+/*----------------------------------------------------------------------------
+ * Free data associated with LES filters.
+ *----------------------------------------------------------------------------*/
+
+void
+cs_les_filter_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -34,6 +34,7 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #if defined(HAVE_MPI)
 #include <mpi.h>
@@ -467,6 +468,105 @@ _rescale_flowrate(cs_lnum_t         n_points,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Sort synthetic eddies into a uniform grid of bins covering the virtual box.
+ *
+ * The bin width in each direction is at least the given maximum eddy
+ * length scale, so that the support of a point only overlaps a few bins.
+ * The total number of bins is bounded by the number of structures.
+ *
+ * parameters:
+ *   n_structures  <-- number of synthetic eddies
+ *   position      <-- eddy positions
+ *   box_min_coord <-- minimum coordinates of the virtual box
+ *   box_length    <-- dimensions of the virtual box
+ *   ls_max        <-- maximum local length scale in each direction
+ *   n_div         --> number of bins in each direction
+ *   bin_width     --> width of bins in each direction
+ *   bin_idx       --> index of eddies in each bin (size: n_bins + 1)
+ *   bin_struct    --> eddy ids, sorted by bin (size: n_structures)
+ *----------------------------------------------------------------------------*/
+
+static void
+_sem_bin_structures(int                n_structures,
+                    const cs_real_3_t  position[],
+                    const cs_real_t    box_min_coord[3],
+                    const cs_real_t    box_length[3],
+                    const cs_real_t    ls_max[3],
+                    cs_lnum_t          n_div[3],
+                    cs_real_t          bin_width[3],
+                    cs_lnum_t        **bin_idx,
+                    int              **bin_struct)
+{
+  for (int coo_id = 0; coo_id < 3; coo_id++) {
+    n_div[coo_id] = 1;
+    if (ls_max[coo_id] > 0. && box_length[coo_id] > 0.) {
+      double r = box_length[coo_id] / ls_max[coo_id];
+      if (r > n_structures)
+        r = n_structures;
+      n_div[coo_id] = CS_MAX((cs_lnum_t)r, 1);
+    }
+  }
+
+  while (n_div[0]*n_div[1]*n_div[2] > CS_MAX(n_structures, 1)) {
+    int c_max = 0;
+    for (int coo_id = 1; coo_id < 3; coo_id++) {
+      if (n_div[coo_id] > n_div[c_max])
+        c_max = coo_id;
+    }
+    n_div[c_max] = CS_MAX(n_div[c_max]/2, 1);
+  }
+
+  for (int coo_id = 0; coo_id < 3; coo_id++)
+    bin_width[coo_id] = (box_length[coo_id] > 0.) ?
+      box_length[coo_id] / n_div[coo_id] : 1.;
+
+  const cs_lnum_t n_bins = n_div[0]*n_div[1]*n_div[2];
+
+  cs_lnum_t *_bin_idx;
+  int *_bin_struct, *s_bin_id;
+  BFT_MALLOC(_bin_idx, n_bins + 1, cs_lnum_t);
+  BFT_MALLOC(_bin_struct, n_structures, int);
+  BFT_MALLOC(s_bin_id, n_structures, int);
+
+  for (cs_lnum_t b_id = 0; b_id < n_bins + 1; b_id++)
+    _bin_idx[b_id] = 0;
+
+  /* Eddies slightly outside the box are kept in the boundary bins */
+
+  for (int struct_id = 0; struct_id < n_structures; struct_id++) {
+    cs_lnum_t b_ijk[3];
+    for (int coo_id = 0; coo_id < 3; coo_id++) {
+      cs_real_t r =   (position[struct_id][coo_id] - box_min_coord[coo_id])
+                    / bin_width[coo_id];
+      b_ijk[coo_id] = (r > 0.) ? (cs_lnum_t)r : 0;
+      b_ijk[coo_id] = CS_MIN(b_ijk[coo_id], n_div[coo_id] - 1);
+    }
+    s_bin_id[struct_id] = (b_ijk[2]*n_div[1] + b_ijk[1])*n_div[0] + b_ijk[0];
+    _bin_idx[s_bin_id[struct_id] + 1] += 1;
+  }
+
+  for (cs_lnum_t b_id = 0; b_id < n_bins; b_id++)
+    _bin_idx[b_id + 1] += _bin_idx[b_id];
+
+  /* Counting sort, keeping increasing eddy ids in each bin */
+
+  for (int struct_id = 0; struct_id < n_structures; struct_id++) {
+    int b_id = s_bin_id[struct_id];
+    _bin_struct[_bin_idx[b_id]] = struct_id;
+    _bin_idx[b_id] += 1;
+  }
+
+  for (cs_lnum_t b_id = n_bins; b_id > 0; b_id--)
+    _bin_idx[b_id] = _bin_idx[b_id - 1];
+  _bin_idx[0] = 0;
+
+  BFT_FREE(s_bin_id);
+
+  *bin_idx = _bin_idx;
+  *bin_struct = _bin_struct;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -2028,33 +2128,88 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
   alpha = sqrt(box_volume / (double)inflow->n_structures);
 
+  /* Eddies are binned on a uniform grid so that each point only
+     visits the eddies of bins overlapping its support */
+
+  cs_real_t ls_max[3] = {0., 0., 0.};
   for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
+    for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+      ls_max[coo_id] = CS_MAX(ls_max[coo_id], length_scale[point_id][coo_id]);
+  }
 
-    cs_real_t distance[3];
+  cs_lnum_t n_div[3];
+  cs_real_t bin_width[3];
+  cs_lnum_t *bin_idx = nullptr;
+  int *bin_struct = nullptr;
+
+  _sem_bin_structures(inflow->n_structures,
+                      (const cs_real_3_t *)inflow->position,
+                      box_min_coord,
+                      box_length,
+                      ls_max,
+                      n_div,
+                      bin_width,
+                      &bin_idx,
+                      &bin_struct);
+
+  const cs_real_3_t *s_position = (const cs_real_3_t *)inflow->position;
+  const cs_real_3_t *s_energy = (const cs_real_3_t *)inflow->energy;
+
+# pragma omp parallel for if (n_points > CS_THR_MIN)
+  for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
 
-    for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    const cs_real_t *p_coo = point_coordinates[point_id];
+    const cs_real_t *p_ls = length_scale[point_id];
 
-      for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-        distance[coo_id] =
-          CS_ABS(point_coordinates[point_id][coo_id]
-                 - inflow->position[struct_id][coo_id]);
+    cs_lnum_t b_min[3], b_max[3];
+    for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+      cs_real_t r0 = (p_coo[coo_id] - p_ls[coo_id] - box_min_coord[coo_id])
+                     / bin_width[coo_id];
+      cs_real_t r1 = (p_coo[coo_id] + p_ls[coo_id] - box_min_coord[coo_id])
+                     / bin_width[coo_id];
+      b_min[coo_id] = (r0 > 0.) ? (cs_lnum_t)r0 : 0;
+      b_max[coo_id] = (r1 > 0.) ? (cs_lnum_t)r1 : 0;
+      b_min[coo_id] = CS_MIN(b_min[coo_id], n_div[coo_id] - 1);
+      b_max[coo_id] = CS_MIN(b_max[coo_id], n_div[coo_id] - 1);
+    }
 
-      if (   distance[0] < length_scale[point_id][0]
-          && distance[1] < length_scale[point_id][1]
-          && distance[2] < length_scale[point_id][2]) {
+    for (cs_lnum_t bk = b_min[2]; bk <= b_max[2]; bk++) {
+      for (cs_lnum_t bj = b_min[1]; bj <= b_max[1]; bj++) {
+        for (cs_lnum_t bi = b_min[0]; bi <= b_max[0]; bi++) {
 
-        cs_real_t form_function = 1.;
-        for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-          form_function *=
-            (1.-distance[coo_id]/length_scale[point_id][coo_id])
-            /sqrt(2./3.*length_scale[point_id][coo_id]);
+          cs_lnum_t b_id = (bk*n_div[1] + bj)*n_div[0] + bi;
 
-        for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-          fluctuations[point_id][coo_id]
-            += inflow->energy[struct_id][coo_id]*form_function;
+          for (cs_lnum_t s_idx = bin_idx[b_id];
+               s_idx < bin_idx[b_id + 1];
+               s_idx++) {
 
-      }
+            int struct_id = bin_struct[s_idx];
+            cs_real_t distance[3];
+
+            for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+              distance[coo_id] =
+                CS_ABS(p_coo[coo_id] - s_position[struct_id][coo_id]);
+
+            if (   distance[0] < p_ls[0]
+                && distance[1] < p_ls[1]
+                && distance[2] < p_ls[2]) {
+
+              cs_real_t form_function = 1.;
+              for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+                form_function *=
+                  (1.-distance[coo_id]/p_ls[coo_id])
+                  /sqrt(2./3.*p_ls[coo_id]);
 
+              for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+                fluctuations[point_id][coo_id]
+                  += s_energy[struct_id][coo_id]*form_function;
+
+            }
+
+          }
+
+        }
+      }
     }
 
     for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
@@ -2062,6 +2217,8 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
   }
 
+  BFT_FREE(bin_idx);
+  BFT_FREE(bin_struct);
   BFT_FREE(length_scale);
 }
 
@@ -2195,6 +2352,106 @@ cs_les_inflow_set_restart(bool  allow_read,
   _allow_restart_write = allow_write;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the local size of a LES inflow state snapshot.
+ *
+ * \return  number of values required by \ref cs_les_inflow_snapshot_save
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_les_inflow_snapshot_size(void)
+{
+  size_t n = 1;
+
+  for (int inlet_id = 0; inlet_id < cs_glob_inflow_n_inlets; inlet_id++) {
+    const cs_inlet_t *inlet = cs_glob_inflow_inlet_array[inlet_id];
+    n += 6;
+    if (inlet->type == CS_INFLOW_SEM) {
+      const cs_inflow_sem_t *inflow = (const cs_inflow_sem_t *)inlet->inflow;
+      n += 6*(size_t)(inflow->n_structures);
+    }
+  }
+
+  return n;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Save LES inflow state to a local snapshot buffer.
+ *
+ * The mean flow information and initialization indicator of each inlet
+ * are saved, as well as the coherent structures for the SEM method.
+ * Batten method modes do not evolve, and the random number generator
+ * state is not saved.
+ *
+ * \param[out]  buf  snapshot buffer, of size given by
+ *                   \ref cs_les_inflow_snapshot_size
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_inflow_snapshot_save(cs_real_t  buf[])
+{
+  size_t k = 0;
+
+  buf[k++] = cs_glob_inflow_n_inlets;
+
+  for (int inlet_id = 0; inlet_id < cs_glob_inflow_n_inlets; inlet_id++) {
+    const cs_inlet_t *inlet = cs_glob_inflow_inlet_array[inlet_id];
+    for (int coo_id = 0; coo_id < 3; coo_id++)
+      buf[k++] = inlet->vel_m[coo_id];
+    buf[k++] = inlet->k_r;
+    buf[k++] = inlet->eps_r;
+    buf[k++] = inlet->initialize;
+    if (inlet->type == CS_INFLOW_SEM) {
+      const cs_inflow_sem_t *inflow = (const cs_inflow_sem_t *)inlet->inflow;
+      size_t n = 3*(size_t)(inflow->n_structures);
+      memcpy(buf + k, inflow->position, n*sizeof(cs_real_t));
+      k += n;
+      memcpy(buf + k, inflow->energy, n*sizeof(cs_real_t));
+      k += n;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Restore LES inflow state from a local snapshot buffer.
+ *
+ * Inlets defined after the matching call to
+ * \ref cs_les_inflow_snapshot_save are left unchanged.
+ *
+ * \param[in]  buf  snapshot buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_inflow_snapshot_restore(const cs_real_t  buf[])
+{
+  size_t k = 0;
+
+  const int n_inlets = (int)buf[k++];
+
+  for (int inlet_id = 0; inlet_id < n_inlets; inlet_id++) {
+    cs_inlet_t *inlet = cs_glob_inflow_inlet_array[inlet_id];
+    for (int coo_id = 0; coo_id < 3; coo_id++)
+      inlet->vel_m[coo_id] = buf[k++];
+    inlet->k_r = buf[k++];
+    inlet->eps_r = buf[k++];
+    inlet->initialize = (int)buf[k++];
+    if (inlet->type == CS_INFLOW_SEM) {
+      cs_inflow_sem_t *inflow = (cs_inflow_sem_t *)inlet->inflow;
+      size_t n = 3*(size_t)(inflow->n_structures);
+      memcpy(inflow->position, buf + k, n*sizeof(cs_real_t));
+      k += n;
+      memcpy(inflow->energy, buf + k, n*sizeof(cs_real_t));
+      k += n;
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
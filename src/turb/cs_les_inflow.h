@@ -269,6 +269,40 @@ void
 cs_les_inflow_set_restart(bool  allow_read,
                           bool  allow_write);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the local size of a LES inflow state snapshot.
+ *
+ * \return  number of values required by \ref cs_les_inflow_snapshot_save
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_les_inflow_snapshot_size(void);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Save LES inflow state to a local snapshot buffer.
+ *
+ * \param[out]  buf  snapshot buffer, of size given by
+ *                   \ref cs_les_inflow_snapshot_size
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_inflow_snapshot_save(cs_real_t  buf[]);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Restore LES inflow state from a local snapshot buffer.
+ *
+ * \param[in]  buf  snapshot buffer
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_les_inflow_snapshot_restore(const cs_real_t  buf[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Define parameters of synthetic turbulence at LES inflow.
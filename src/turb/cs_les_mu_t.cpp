@@ -389,8 +389,10 @@ cs_les_mu_t_smago_dyn(void)
      denominator, then only compute  the quotient. The user can overwrite
      this in cs_user_physical_properties_turb_viscosity. */
 
-  cs_les_filter(1, w1, w3);
-  cs_les_filter(1, w2, w4);
+  {
+    cs_real_t *f_in[2] = {w1, w2}, *f_out[2] = {w3, w4};
+    cs_les_filter_multi(2, 1, f_in, f_out);
+  }
 
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
     if (fabs(w4[c_id]) <= cs_math_epzero)
@@ -631,8 +633,10 @@ cs_les_mu_t_smago_dyn(void)
 
       BFT_FREE(f_sca_vel);
 
-      cs_les_filter(1, w1, w3);
-      cs_les_filter(1, w2, w4);
+      {
+        cs_real_t *f_in[2] = {w1, w2}, *f_out[2] = {w3, w4};
+        cs_les_filter_multi(2, 1, f_in, f_out);
+      }
 
       /*
        * Compute the SGS flux coefficient and SGS diffusivity
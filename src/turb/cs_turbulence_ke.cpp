@@ -713,16 +713,14 @@ cs_turbulence_ke(int              phase_id,
     tinstk[c_id] = k_istat*romvsd;
     tinste[c_id] = eps_istat*romvsd;
 
-  });
-
-  /* Compute the square root of the strain and the turbulent
-     kinetic energy for Launder-Sharma k-epsilon source terms */
-  if (turb_model_type == CS_TURB_K_EPSILON_LS) {
-    ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+    /* Compute the square root of the strain and the turbulent
+       kinetic energy for Launder-Sharma k-epsilon source terms */
+    if (strain != nullptr) {
       strain[c_id] = sqrt(strain_sq[c_id]);
       sqrt_k[c_id] = sqrt(cs_math_fabs(cvar_k[c_id]));
-    });
-  }
+    }
+
+  });
 
   /* Compute the first part of the production term: muT (S^D)**2
    * Going out of the step we keep strain_sq, divu,
@@ -732,7 +730,11 @@ cs_turbulence_ke(int              phase_id,
    * the production term is assumed to be asymptotic in S and
    * not in mu_TxS**2 */
 
+  /* The production is saved for post processing within the same
+     kernel, if requested */
+
   cs_field_t *f_tke_prod = cs_field_by_name_try("algo:k_production");
+  cs_real_t *tke_prod = (f_tke_prod != nullptr) ? f_tke_prod->val : nullptr;
 
   if (turb_model_type == CS_TURB_K_EPSILON_LIN_PROD) {
     ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
@@ -742,13 +744,9 @@ cs_turbulence_ke(int              phase_id,
                                       sqrcmu);
       smbrk[c_id] = rho*cmueta*xs*cvara_k[c_id];
       smbre[c_id] = smbrk[c_id];
+      if (tke_prod != nullptr)
+        tke_prod[c_id] = smbrk[c_id] / rho;
     });
-    /* Save production for post processing */
-    if (f_tke_prod != nullptr) {
-      ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
-        f_tke_prod->val[c_id] = smbrk[c_id] / cromo[c_id];
-      });
-    }
   }
   else if (turb_model_type == CS_TURB_K_EPSILON_QUAD) {
 
@@ -820,15 +818,10 @@ cs_turbulence_ke(int              phase_id,
                     - 4.*xqc3*visct*xttke* (wkwjksji - d1s3*wijwij*divu[c_id]);
       smbre[c_id] = smbrk[c_id];
 
-    }); /* End loop on cells */
-
-    /* Save production for post processing */
-    if (f_tke_prod != nullptr) {
-      cs_real_t *tke_prod = f_tke_prod->val;
-      ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+      if (tke_prod != nullptr)
         tke_prod[c_id] = smbrk[c_id] / crom[c_id];
-      });
-    }
+
+    }); /* End loop on cells */
 
     /* End test on specific k-epsilon model
        In the general case Pk = mu_t*SijSij */
@@ -837,14 +830,9 @@ cs_turbulence_ke(int              phase_id,
     ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
       smbrk[c_id] = cpro_pcvto[c_id] * strain_sq[c_id];
       smbre[c_id] = smbrk[c_id];
-    });
-    /* Save production for post processing */
-    if (f_tke_prod != nullptr) {
-      cs_real_t *tke_prod = f_tke_prod->val;
-      ctx.parallel_for(n_cells, [=] CS_F_HOST_DEVICE (cs_lnum_t c_id) {
+      if (tke_prod != nullptr)
         tke_prod[c_id] = smbrk[c_id] / crom[c_id];
-      });
-    }
+    });
   }
 
   /* Take into account rotation/curvature correction, if necessary
@@ -432,15 +432,16 @@ cs_turbulence_kw(int phase_id)
 
   bool use_previous_t = true;
 
-  cs_field_gradient_scalar(f_k,
-                           use_previous_t,
-                           1,     /* inc */
-                           gradk);
-
-  cs_field_gradient_scalar(f_omg,
-                           use_previous_t,
-                           1,     /* inc */
-                           grado);
+  {
+    const cs_field_t *f_ko[2] = {f_k, f_omg};
+    cs_real_3_t *grad_ko[2] = {gradk, grado};
+
+    cs_field_gradient_scalars(2,
+                              f_ko,
+                              use_previous_t,
+                              1,     /* inc */
+                              grad_ko);
+  }
 
   /* Initialization of work arrays in case of Hybrid turbulence modelling */
 
@@ -1548,29 +1549,8 @@ cs_turbulence_kw(int phase_id)
   /* Clip values
      ============ */
 
-  /* Compute Min/Max before clipping, for logging */
-
-  cs_real_t *cvar_var = nullptr;
-  cs_real_t vrmax[2];
-  cs_real_t vrmin[2];
-
-  const double l_threshold = 1.e12;
-  for (int ii = 0; ii < 2; ii++) {
-    if (ii == 0)
-      cvar_var = cvar_k;
-    else if (ii == 1)
-      cvar_var = cvar_omg;
-
-    vrmin[ii] =  l_threshold;
-    vrmax[ii] = -l_threshold;
-    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-      cs_real_t var = cvar_var[c_id];
-      vrmin[ii] = CS_MIN(vrmin[ii], var);
-      vrmax[ii] = CS_MAX(vrmax[ii], var);
-    }
-  }
-
-  /* Simply clip k and omega by absolute value */
+  /* Simply clip k and omega by absolute value; Min/Max before clipping
+     are computed in the same pass, for logging */
 
   int kclipp = cs_field_key_id("clipping_id");
 
@@ -1591,11 +1571,19 @@ cs_turbulence_kw(int phase_id)
   if (clip_w_id >= 0)
     cs_arrays_set_value<cs_real_t, 1>(n_cells, 0., cpro_w_clipped);
 
+  const double l_threshold = 1.e12;
+  cs_real_t vrmax[2] = {-l_threshold, -l_threshold};
+  cs_real_t vrmin[2] = {l_threshold, l_threshold};
+
   cs_lnum_t iclipk[1] = {0};
   cs_lnum_t iclipw = 0;
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
     cs_real_t xk = cvar_k[c_id];
     cs_real_t xw = cvar_omg[c_id];
+    vrmin[0] = CS_MIN(vrmin[0], xk);
+    vrmax[0] = CS_MAX(vrmax[0], xk);
+    vrmin[1] = CS_MIN(vrmin[1], xw);
+    vrmax[1] = CS_MAX(vrmax[1], xw);
     if (fabs(xk) <= epz2) {
       iclipk[0] = iclipk[0] + 1;
       if (clip_k_id >= 0)
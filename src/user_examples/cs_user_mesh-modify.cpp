@@ -405,6 +405,11 @@ cs_user_mesh_modify(cs_mesh_t  *mesh)
                                    selected_cells);
 
     BFT_FREE(selected_cells);
+
+    /* Rebalance the partitioning if local refinement led to a load
+       imbalance higher than 10% */
+
+    cs_mesh_refine_repartition(mesh, 0.1);
   }
   /*! [mesh_modify_refine_1] */
 
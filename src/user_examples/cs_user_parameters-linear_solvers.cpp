@@ -372,6 +372,8 @@ cs_user_linear_solvers(void)
    *  CS_SLES_P_GAUSS_SEIDEL      (process-local Gauss-Seidel)
    *  CS_SLES_P_SYM_GAUSS_SEIDEL  (process-local symmetric Gauss-Seidel)
    *  CS_SLES_PCR3                (3-layer conjugate residual)
+   *  CS_SLES_PIPELINED_CG        (pipelined conjugate gradient)
+   *  CS_SLES_DEFLATED_CG         (deflated conjugate gradient)
    *
    *  The multigrid solver uses the conjugate gradient as a smoother
    *  and coarse solver by default, but this behavior may be modified. */
@@ -507,6 +509,28 @@ cs_user_linear_solvers(void)
   }
   /*! [sles_mgp_2] */
 
+  /* Example: deflated conjugate gradient preconditioned by multigrid
+     for pressure; approximate eigenvectors associated with the smallest
+     eigenvalues are recycled from one time step to the next */
+  /*---------------------------------------------------------------------*/
+
+  /*! [sles_mgp_deflated] */
+  {
+    cs_sles_it_t *c = cs_sles_it_define(CS_F_(p)->id,
+                                        NULL,
+                                        CS_SLES_DEFLATED_CG,
+                                        -1,
+                                        10000);
+
+    cs_sles_it_set_deflation(c,
+                             8,    /* deflation vectors (default 8) */
+                             16);  /* harvested directions (default 16) */
+
+    cs_sles_pc_t *pc = cs_multigrid_pc_create(CS_MULTIGRID_V_CYCLE);
+    cs_sles_it_transfer_pc(c, &pc);
+  }
+  /*! [sles_mgp_deflated] */
+
   /* Example: conjugate gradient preconditioned by K-cycle multigrid in the *
    *          the saddle-point system for coupled velocity-pressure relying *
    *          on CDO face-based schemes. One considers this solver for the  *
@@ -84,6 +84,12 @@ cs_user_matrix_tuning(void)
 
   cs_matrix_default_set_type(CS_MATRIX_BLOCK_D, CS_MATRIX_MSR);
 
+  /* Use sliced ELLPACK (SELL-C-sigma) storage for scalar symmetric
+     matrices, with default slice size and sorting window */
+
+  cs_matrix_default_set_type(CS_MATRIX_SCALAR_SYM, CS_MATRIX_SELL);
+  cs_matrix_set_sell_parameters(0, 0);
+
   /* Also allow tuning for multigrid for all expected levels
    * (we rarely have more than 10 or 11 levels except for huge meshes). */
 
@@ -89,6 +89,8 @@ cs_user_parallel_io(void)
      CS_FILE_MPI_NON_COLLECTIVE  Non-collective MPI-IO
                                  with collective file open and close
      CS_FILE_MPI_COLLECTIVE      Collective MPI-IO
+     CS_FILE_MMAP                Per-process memory-mapped files
+                                 (for reading only)
   */
 
   int block_rank_step = 8;
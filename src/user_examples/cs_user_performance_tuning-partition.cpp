@@ -145,6 +145,18 @@ cs_user_partition(void)
   }
   /*! [performance_tuning_partition_4] */
 
+  /*! [performance_tuning_partition_5] */
+  {
+    /* Example: increase the weight of cells in groups associated with
+     * costly physical models for the main partitioning, so that these
+     * cells are spread over more ranks (only handled by space-filling
+     * curve algorithms). */
+
+    cs_partition_add_group_cell_weight("packing", 3.);
+    cs_partition_add_group_cell_weight("injection", 5.);
+  }
+  /*! [performance_tuning_partition_5] */
+
 }
 
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,304 @@
+/*============================================================================
+ * Unit test for cs_math_expr.cpp;
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_math_expr.h"
+
+/*---------------------------------------------------------------------------*/
+
+/* Number of test elements (more than one evaluation block) */
+
+#define N_ELTS 300
+
+/*----------------------------------------------------------------------------
+ * Evaluate a formula for a single output over all test elements, with
+ * a vector input "x" (dimension 3) and uniform input "a".
+ *
+ * parameters:
+ *   formula  <-- expression text
+ *   n_elts   <-- number of elements
+ *   elt_ids  <-- element ids, or nullptr
+ *   x        <-- values of x (interleaved)
+ *   a        <-- value of a
+ *   vals     <-> output values (indexed by element ids)
+ *
+ * returns:
+ *   true if the formula was compiled, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_evaluate(const char       *formula,
+          cs_lnum_t         n_elts,
+          const cs_lnum_t  *elt_ids,
+          const cs_real_t  *x,
+          cs_real_t         a,
+          cs_real_t        *vals)
+{
+  const char *symbols[] = {"x", "a"};
+  const char *outputs[] = {"y"};
+
+  cs_math_expr_t *e = cs_math_expr_create(formula,
+                                          2, symbols,
+                                          1, outputs,
+                                          false);
+  if (e == nullptr)
+    return false;
+
+  cs_math_expr_input_t inputs[2] = {{x, 3, true}, {&a, 0, true}};
+  cs_math_expr_output_t output = {vals, 1, true};
+
+  cs_math_expr_evaluate(e, n_elts, elt_ids, inputs, &output);
+
+  cs_math_expr_destroy(&e);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Check a formula against reference values.
+ *
+ * parameters:
+ *   formula  <-- expression text
+ *   x        <-- values of x (interleaved)
+ *   a        <-- value of a
+ *   ref      <-- reference value function
+ *
+ * returns:
+ *   number of errors
+ *----------------------------------------------------------------------------*/
+
+static int
+_check(const char       *formula,
+       const cs_real_t  *x,
+       cs_real_t         a,
+       cs_real_t       (*ref)(const cs_real_t  x[3],
+                              cs_real_t        a))
+{
+  cs_real_t vals[N_ELTS];
+  for (cs_lnum_t i = 0; i < N_ELTS; i++)
+    vals[i] = -1.e30;
+
+  if (_evaluate(formula, N_ELTS, nullptr, x, a, vals) == false) {
+    bft_printf("FAILED: \"%s\" not compiled\n", formula);
+    return 1;
+  }
+
+  int n_errors = 0;
+  for (cs_lnum_t i = 0; i < N_ELTS; i++) {
+    cs_real_t r = ref(x + 3*i, a);
+    if (fabs(vals[i] - r) > 1.e-12*(1. + fabs(r))) {
+      if (n_errors == 0)
+        bft_printf("FAILED: \"%s\": element %d: %g (expected %g)\n",
+                   formula, (int)i, vals[i], r);
+      n_errors++;
+    }
+  }
+
+  if (n_errors == 0)
+    bft_printf("ok: \"%s\"\n", formula);
+
+  return (n_errors > 0) ? 1 : 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Reference functions
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t
+_ref_precedence(const cs_real_t  x[3],
+                cs_real_t        a)
+{
+  return a + x[0]*x[1] - x[2]/4.;
+}
+
+static cs_real_t
+_ref_power(const cs_real_t  x[3],
+           cs_real_t        a)
+{
+  CS_UNUSED(x);
+  return -pow(a, pow(2., 3.)) + 2.*pow(3., 2);
+}
+
+static cs_real_t
+_ref_parentheses(const cs_real_t  x[3],
+                 cs_real_t        a)
+{
+  return (a + x[0])*(x[1] - x[2]);
+}
+
+static cs_real_t
+_ref_logical(const cs_real_t  x[3],
+             cs_real_t        a)
+{
+  CS_UNUSED(a);
+  return (x[0] < 0.5 || (x[1] > 1. && x[2] <= 2.)) ? 1. : 0.;
+}
+
+static cs_real_t
+_ref_if_else(const cs_real_t  x[3],
+             cs_real_t        a)
+{
+  cs_real_t y;
+  if (x[0] < 0.3)
+    y = a;
+  else if (x[0] < 0.6)
+    y = 2*a;
+  else
+    y = sqrt(x[0]);
+  return y;
+}
+
+static cs_real_t
+_ref_masked_division(const cs_real_t  x[3],
+                     cs_real_t        a)
+{
+  CS_UNUSED(a);
+  return (x[0] > 0.) ? 1./x[0] : 0.;
+}
+
+static cs_real_t
+_ref_components(const cs_real_t  x[3],
+                cs_real_t        a)
+{
+  cs_real_t t = x[2] - x[0];
+  return a*t + x[1];
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+int
+main (int argc, char *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  int n_failed = 0;
+
+  cs_real_t *x;
+  BFT_MALLOC(x, 3*N_ELTS, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < N_ELTS; i++) {
+    x[i*3]     = (cs_real_t)i / N_ELTS;
+    x[i*3 + 1] = 1. + 0.01*i;
+    x[i*3 + 2] = 3. - 0.02*i;
+  }
+
+  const cs_real_t a = 1.5;
+
+  /* Operator precedence and associativity */
+
+  n_failed += _check("y = a + x[0]*x[1] - x[2]/4;",
+                     x, a, _ref_precedence);
+
+  n_failed += _check("y = -a^2^3 + 2*3**2;",
+                     x, a, _ref_power);
+
+  n_failed += _check("y = (a + x[0])*(x[1] - x[2]);",
+                     x, a, _ref_parentheses);
+
+  n_failed += _check("y = 0; if (x[0] < 0.5 || x[1] > 1 && x[2] <= 2) y = 1;",
+                     x, a, _ref_logical);
+
+  /* Conditional blocks; both branches are evaluated and masked,
+     so a division by zero in an inactive branch must not leak */
+
+  n_failed += _check("if (x[0] < 0.3) y = a;\n"
+                     "else if (x[0] < 0.6) { t = 2; y = t*a; }\n"
+                     "else y = sqrt(x[0]);",
+                     x, a, _ref_if_else);
+
+  n_failed += _check("if (x[0] > 0) y = 1/x[0]; else y = 0;",
+                     x, a, _ref_masked_division);
+
+  /* Component indexing, and intermediate variables */
+
+  n_failed += _check("t = x[2] - x[0];\ny = a*t + x[1];",
+                     x, a, _ref_components);
+
+  /* Element ids subset: only selected outputs are modified */
+
+  {
+    cs_lnum_t elt_ids[N_ELTS/2];
+    cs_real_t vals[N_ELTS];
+    for (cs_lnum_t i = 0; i < N_ELTS/2; i++)
+      elt_ids[i] = 2*i + 1;
+    for (cs_lnum_t i = 0; i < N_ELTS; i++)
+      vals[i] = -1;
+
+    _evaluate("y = x[1];", N_ELTS/2, elt_ids, x, a, vals);
+
+    int n_errors = 0;
+    for (cs_lnum_t i = 0; i < N_ELTS; i++) {
+      cs_real_t r = (i%2 == 1) ? x[i*3 + 1] : -1;
+      if (fabs(vals[i] - r) > 1.e-12)
+        n_errors++;
+    }
+    if (n_errors > 0) {
+      bft_printf("FAILED: indexed evaluation (%d errors)\n", n_errors);
+      n_failed++;
+    }
+    else
+      bft_printf("ok: indexed evaluation\n");
+  }
+
+  /* Unknown symbols or syntax errors are not fatal, but are reported
+     so that the caller may use a fallback (MEG functions) */
+
+  const char *bad_formulas[] = {"y = b*x[0];",
+                                "y = x[0] +;",
+                                "if (x[0] > 0 y = 1;",
+                                "y = unknown_function(x[0]);"};
+
+  for (int i = 0; i < 4; i++) {
+    cs_real_t vals[N_ELTS];
+    if (_evaluate(bad_formulas[i], N_ELTS, nullptr, x, a, vals)) {
+      bft_printf("FAILED: \"%s\" should not be compiled\n", bad_formulas[i]);
+      n_failed++;
+    }
+    else
+      bft_printf("ok: \"%s\" rejected\n", bad_formulas[i]);
+  }
+
+  BFT_FREE(x);
+
+  if (n_failed > 0) {
+    bft_printf("\n%d cs_math_expr test(s) failed\n", n_failed);
+    exit(EXIT_FAILURE);
+  }
+
+  exit(EXIT_SUCCESS);
+}
@@ -23,6 +23,7 @@
 #include "cs_defs.h"
 
 #include <assert.h>
+#include <float.h>
 #include <math.h>
 #include <stdlib.h>
 #include <stdarg.h>
@@ -739,6 +740,8 @@ main(int argc, char *argv[])
   CS_UNUSED(argc);
   CS_UNUSED(argv);
 
+  int n_failed = 0;
+
   /* Internationalization */
 
 #ifdef HAVE_SETLOCALE
@@ -857,27 +860,32 @@ main(int argc, char *argv[])
 #endif
 
     /* Create associated structures and matrices
-       (2 matrices are created simultaneously, to exercice
+       (3 matrices are created simultaneously, to exercice
        the const/shareable aspect of the assembler) */
 
     cs_matrix_structure_t  *ms_0
       = cs_matrix_structure_create_from_assembler(CS_MATRIX_CSR, ma);
     cs_matrix_structure_t  *ms_1
       = cs_matrix_structure_create_from_assembler(CS_MATRIX_MSR, ma);
+    cs_matrix_structure_t  *ms_2
+      = cs_matrix_structure_create_from_assembler(CS_MATRIX_SELL, ma);
 
     cs_matrix_t  *m_0 = cs_matrix_create(ms_0);
     cs_matrix_t  *m_1 = cs_matrix_create(ms_1);
+    cs_matrix_t  *m_2 = cs_matrix_create(ms_2);
 
     /* Now prepare to add values */
 
-    for (int mav_id = 0; mav_id < 2; mav_id++) {
+    for (int mav_id = 0; mav_id < 3; mav_id++) {
 
       cs_matrix_assembler_values_t *mav = NULL;
 
       if (mav_id == 0)
         mav = cs_matrix_assembler_values_init(m_0, 1, 1);
-      else
+      else if (mav_id == 1)
         mav = cs_matrix_assembler_values_init(m_1, 1, 1);
+      else
+        mav = cs_matrix_assembler_values_init(m_2, 1, 1);
 
       /* Same ids required as for assembler (at least, no additional ids),
          so loop in a similar manner for safety, but with different
@@ -935,10 +943,11 @@ main(int argc, char *argv[])
     cs_lnum_t n_rows = cs_matrix_get_n_rows(m_0);
     cs_lnum_t n_cols = cs_matrix_get_n_columns(m_0);
 
-    cs_real_t *x, *y_0, *y_1;
+    cs_real_t *x, *y_0, *y_1, *y_2;
     BFT_MALLOC(x, n_cols, cs_real_t);
     BFT_MALLOC(y_0, n_cols, cs_real_t);
     BFT_MALLOC(y_1, n_cols, cs_real_t);
+    BFT_MALLOC(y_2, n_cols, cs_real_t);
     for (cs_lnum_t i = 0; i < _n_vtx; i++)
       x[i] = (_g_vtx_id[i]+1)*0.5;
 
@@ -955,10 +964,58 @@ main(int argc, char *argv[])
 
     cs_matrix_vector_multiply(m_0, x, y_0);
     cs_matrix_vector_multiply(m_1, x, y_1);
+    cs_matrix_vector_multiply(m_2, x, y_2);
+
+    /* Compare with single-precision extra-diagonal coefficients */
+
+    {
+      cs_real_t *y_f, *tol;
+      BFT_MALLOC(y_f, n_cols, cs_real_t);
+      BFT_MALLOC(tol, n_rows, cs_real_t);
+
+      /* Rounding of extra-diagonal coefficients to single precision
+         bounds the error on each row to about FLT_EPSILON/2 times
+         the sum of absolute extra-diagonal contributions */
+
+      const cs_lnum_t *row_index, *col_id;
+      const cs_real_t *d_val, *x_val;
+      cs_matrix_get_msr_arrays(m_1, &row_index, &col_id, &d_val, &x_val);
+
+      for (cs_lnum_t i = 0; i < n_rows; i++) {
+        double s = 0;
+        for (cs_lnum_t j = row_index[i]; j < row_index[i+1]; j++)
+          s += fabs(x_val[j] * x[col_id[j]]);
+        tol[i] = FLT_EPSILON*s + 16*DBL_EPSILON*(s + fabs(d_val[i]*x[i]));
+      }
+
+      cs_matrix_set_coefficients_type(m_1, CS_FLOAT);
+      cs_matrix_vector_multiply(m_1, x, y_f);
+
+      double d_max = 0;
+      cs_lnum_t n_diff = 0;
+      for (cs_lnum_t i = 0; i < n_rows; i++) {
+        double d = fabs(y_f[i] - y_1[i]);
+        d_max = CS_MAX(d_max, d);
+        if (d > tol[i])
+          n_diff++;
+      }
+
+      bft_printf("\nSpMV pass %d (single precision coefficients):\n"
+                 "  max. difference: %g\n", id_ie, d_max);
+
+      if (n_diff > 0) {
+        bft_printf("  %d rows differ by more than rounding tolerance\n",
+                   (int)n_diff);
+        n_failed++;
+      }
+
+      BFT_FREE(tol);
+      BFT_FREE(y_f);
+    }
 
     bft_printf("\nSpMV pass %d (on range set)\n", id_ie);
     for (cs_lnum_t i = 0; i < n_rows; i++)
-      bft_printf("%d: %f %f\n", i, y_0[i], y_1[i]);
+      bft_printf("%d: %f %f %f\n", i, y_0[i], y_1[i], y_2[i]);
 
     cs_range_set_scatter(rs,
                          CS_REAL_TYPE,
@@ -972,22 +1029,33 @@ main(int argc, char *argv[])
                          y_1,
                          y_1);
 
+    cs_range_set_scatter(rs,
+                         CS_REAL_TYPE,
+                         1,
+                         y_2,
+                         y_2);
+
     bft_printf("\nSpMV pass %d (scattered)\n", id_ie);
     for (cs_lnum_t i = 0; i < _n_vtx; i++)
-      bft_printf("%d (%d): %f %f\n", i, (int)_g_vtx_id[i], y_0[i], y_1[i]);
+      bft_printf("%d (%d): %f %f %f\n", i, (int)_g_vtx_id[i],
+                 y_0[i], y_1[i], y_2[i]);
 
     BFT_FREE(x);
     BFT_FREE(y_0);
     BFT_FREE(y_1);
+    BFT_FREE(y_2);
 
     cs_matrix_release_coefficients(m_0);
     cs_matrix_release_coefficients(m_1);
+    cs_matrix_release_coefficients(m_2);
 
     cs_matrix_destroy(&m_0);
     cs_matrix_destroy(&m_1);
+    cs_matrix_destroy(&m_2);
 
     cs_matrix_structure_destroy(&ms_0);
     cs_matrix_structure_destroy(&ms_1);
+    cs_matrix_structure_destroy(&ms_2);
 
     cs_matrix_assembler_destroy(&ma);
   }
@@ -1079,5 +1147,8 @@ main(int argc, char *argv[])
   }
 #endif /* HAVE_MPI */
 
+  if (n_failed > 0)
+    exit (EXIT_FAILURE);
+
   exit (EXIT_SUCCESS);
 }
@@ -0,0 +1,409 @@
+/*============================================================================
+ * Unit test for some preconditioners of cs_sles_pc.cpp;
+ *============================================================================*/
+
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2024 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bft_error.h"
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_matrix.h"
+#include "cs_sles_pc.h"
+#include "cs_sles_pc_priv.h"
+
+/*---------------------------------------------------------------------------*/
+
+/* Grid size for 2D 5-point test problem */
+
+#define NX 13
+#define NY 9
+
+/*----------------------------------------------------------------------------
+ * Build a non-symmetric matrix for a 2D convection-diffusion problem.
+ *
+ * parameters:
+ *   zero_pivot  <-- if true, set the first diagonal coefficient to zero
+ *   ms          --> pointer to associated matrix structure
+ *
+ * returns:
+ *   pointer to matrix
+ *----------------------------------------------------------------------------*/
+
+static cs_matrix_t *
+_build_matrix(bool                     zero_pivot,
+              cs_matrix_structure_t  **ms)
+{
+  const cs_lnum_t n_rows = NX*NY;
+  const cs_lnum_t n_edges = (NX-1)*NY + NX*(NY-1);
+
+  cs_lnum_2_t *edges;
+  cs_real_t *da, *xa;
+  BFT_MALLOC(edges, n_edges, cs_lnum_2_t);
+  BFT_MALLOC(da, n_rows, cs_real_t);
+  BFT_MALLOC(xa, 2*n_edges, cs_real_t);
+
+  cs_lnum_t e_id = 0;
+  for (cs_lnum_t j = 0; j < NY; j++) {
+    for (cs_lnum_t i = 0; i < NX; i++) {
+      cs_lnum_t c_id = j*NX + i;
+      if (i < NX-1) {
+        edges[e_id][0] = c_id;
+        edges[e_id][1] = c_id + 1;
+        e_id++;
+      }
+      if (j < NY-1) {
+        edges[e_id][0] = c_id;
+        edges[e_id][1] = c_id + NX;
+        e_id++;
+      }
+    }
+  }
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    da[i] = 4.5 + 0.01*(i%7);
+
+  /* Upwinded convection in both directions, with variable velocity */
+
+  for (cs_lnum_t i = 0; i < n_edges; i++) {
+    double v = 0.5 + 0.3*sin(0.1*i);
+    xa[i*2]     = -0.7 - 0.3*v;
+    xa[i*2 + 1] = -0.7 + 0.25*v;
+  }
+
+  if (zero_pivot)
+    da[0] = 0;
+
+  *ms = cs_matrix_structure_create(CS_MATRIX_MSR,
+                                   n_rows,
+                                   n_rows,
+                                   n_edges,
+                                   (const cs_lnum_2_t *)edges,
+                                   NULL,
+                                   NULL);
+
+  cs_matrix_t *m = cs_matrix_create(*ms);
+
+  cs_matrix_copy_coefficients(m,
+                              false,
+                              1,
+                              1,
+                              n_edges,
+                              (const cs_lnum_2_t *)edges,
+                              da,
+                              xa);
+
+  BFT_FREE(xa);
+  BFT_FREE(da);
+  BFT_FREE(edges);
+
+  return m;
+}
+
+/*----------------------------------------------------------------------------
+ * Reference (sequential, row by row) triangular solves using the factors
+ * of an ILU(0) preconditioner context.
+ *
+ * parameters:
+ *   c  <-- ILU(0) preconditioner context
+ *   b  <-- right-hand side
+ *   x  --> solution
+ *----------------------------------------------------------------------------*/
+
+static void
+_ilu0_reference_solve(const cs_sles_pc_ilu0_t  *c,
+                      const cs_real_t           b[],
+                      cs_real_t                 x[])
+{
+  const cs_lnum_t n_rows = c->n_rows;
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    cs_real_t s = b[i];
+    for (cs_lnum_t p = c->row_index[i]; p < c->diag_id[i]; p++)
+      s -= c->val[p]*x[c->col_id[p]];
+    x[i] = s;
+  }
+
+  for (cs_lnum_t i = n_rows - 1; i > -1; i--) {
+    cs_real_t s = x[i];
+    for (cs_lnum_t p = c->diag_id[i] + 1; p < c->row_index[i+1]; p++)
+      s -= c->val[p]*x[c->col_id[p]];
+    x[i] = s / c->val[c->diag_id[i]];
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Check that the ILU(0) factors of a preconditioner context reproduce
+ * the matrix coefficients on the matrix sparsity pattern.
+ *
+ * parameters:
+ *   m  <-- matrix
+ *   c  <-- ILU(0) preconditioner context
+ *
+ * returns:
+ *   1 in case of failure, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_check_ilu0_factors(const cs_matrix_t        *m,
+                    const cs_sles_pc_ilu0_t  *c)
+{
+  const cs_lnum_t n_rows = c->n_rows;
+
+  const cs_lnum_t *a_row_index, *a_col_id;
+  const cs_real_t *a_d_val, *a_x_val;
+  cs_matrix_get_msr_arrays(m, &a_row_index, &a_col_id, &a_d_val, &a_x_val);
+
+  cs_real_t *w;
+  BFT_MALLOC(w, n_rows, cs_real_t);
+  for (cs_lnum_t j = 0; j < n_rows; j++)
+    w[j] = 0;
+
+  double d_max = 0;
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+
+    /* Row i of L.U (L with unit diagonal) */
+
+    for (cs_lnum_t p = c->diag_id[i]; p < c->row_index[i+1]; p++)
+      w[c->col_id[p]] += c->val[p];
+
+    for (cs_lnum_t p = c->row_index[i]; p < c->diag_id[i]; p++) {
+      cs_lnum_t k = c->col_id[p];
+      for (cs_lnum_t q = c->diag_id[k]; q < c->row_index[k+1]; q++)
+        w[c->col_id[q]] += c->val[p]*c->val[q];
+    }
+
+    d_max = CS_MAX(d_max, fabs(w[i] - a_d_val[i]));
+    w[i] = 0;
+    for (cs_lnum_t p = a_row_index[i]; p < a_row_index[i+1]; p++) {
+      cs_lnum_t j = a_col_id[p];
+      d_max = CS_MAX(d_max, fabs(w[j] - a_x_val[p]));
+      w[j] = 0;
+    }
+
+    /* Fill-in outside the pattern is dropped; reset it */
+
+    for (cs_lnum_t p = c->row_index[i]; p < c->diag_id[i]; p++) {
+      cs_lnum_t k = c->col_id[p];
+      for (cs_lnum_t q = c->diag_id[k]; q < c->row_index[k+1]; q++)
+        w[c->col_id[q]] = 0;
+    }
+
+  }
+
+  BFT_FREE(w);
+
+  bool ok = (d_max <= 1e-12);
+
+  bft_printf("%s ILU(0) factors: max. difference with matrix: %g\n",
+             (ok) ? "ok:    " : "FAILED:", d_max);
+
+  return (ok) ? 0 : 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Compare a preconditioned vector with a reference.
+ *
+ * parameters:
+ *   label   <-- test label
+ *   n_rows  <-- number of rows
+ *   x       <-- computed values
+ *   x_ref   <-- reference values
+ *
+ * returns:
+ *   1 in case of failure, 0 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare(const char       *label,
+         cs_lnum_t         n_rows,
+         const cs_real_t   x[],
+         const cs_real_t   x_ref[])
+{
+  double d_max = 0, r_max = 0;
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    d_max = CS_MAX(d_max, fabs(x[i] - x_ref[i]));
+    r_max = CS_MAX(r_max, fabs(x_ref[i]));
+  }
+
+  bool ok = (d_max <= 1e-12*r_max);
+
+  bft_printf("%s %s: max. difference: %g (max. value %g)\n",
+             (ok) ? "ok:    " : "FAILED:", label, d_max, r_max);
+
+  return (ok) ? 0 : 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Test ILU(0) solves with a given number of sweeps against the reference
+ * triangular solves.
+ *
+ * parameters:
+ *   m          <-- matrix
+ *   n_sweeps   <-- number of Jacobi sweeps, or 0 for level scheduling
+ *   in_place   <-- apply preconditioner in place ?
+ *   n_levels   --> if non-NULL, max. number of substitution levels
+ *                  (the factors are also checked in this case)
+ *
+ * returns:
+ *   number of failures
+ *----------------------------------------------------------------------------*/
+
+static int
+_test_ilu0(const cs_matrix_t  *m,
+           int                 n_sweeps,
+           bool                in_place,
+           int                *n_levels)
+{
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(m);
+
+  cs_sles_pc_t *pc = cs_sles_pc_ilu0_create(n_sweeps);
+  cs_sles_pc_setup(pc, "ilu0_test", m, false, 0);
+
+  const cs_sles_pc_ilu0_t *c = cs_sles_pc_get_context(pc);
+
+  int retval = 0;
+
+  if (n_levels != NULL) {
+    *n_levels = CS_MAX(c->n_l_levels, c->n_u_levels);
+    retval += _check_ilu0_factors(m, c);
+  }
+
+  cs_real_t *b, *x, *x_ref;
+  BFT_MALLOC(b, n_rows, cs_real_t);
+  BFT_MALLOC(x, n_rows, cs_real_t);
+  BFT_MALLOC(x_ref, n_rows, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    b[i] = cos(0.3*i) + 0.1*i;
+
+  _ilu0_reference_solve(c, b, x_ref);
+
+  if (in_place) {
+    memcpy(x, b, n_rows*sizeof(cs_real_t));
+    cs_sles_pc_apply(pc, NULL, x);
+  }
+  else
+    cs_sles_pc_apply(pc, b, x);
+
+  char label[64];
+  if (n_sweeps > 0)
+    snprintf(label, 63, "ILU(0), %d Jacobi sweeps%s",
+             n_sweeps, (in_place) ? ", in place" : "");
+  else
+    snprintf(label, 63, "ILU(0), level-scheduled%s",
+             (in_place) ? ", in place" : "");
+  label[63] = '\0';
+
+  retval += _compare(label, n_rows, x, x_ref);
+
+  BFT_FREE(x_ref);
+  BFT_FREE(x);
+  BFT_FREE(b);
+
+  cs_sles_pc_destroy(&pc);
+
+  return retval;
+}
+
+/*============================================================================
+ * Main program
+ *============================================================================*/
+
+int
+main (int argc, char *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  int n_failed = 0;
+
+  cs_matrix_structure_t *ms = NULL;
+  cs_matrix_t *m = _build_matrix(false, &ms);
+
+  /* Level-scheduled solves are exact */
+
+  int n_levels = 0;
+  n_failed += _test_ilu0(m, 0, false, &n_levels);
+  n_failed += _test_ilu0(m, 0, true, NULL);
+
+  /* Jacobi sweeps are exact for triangular solves once the number
+     of sweeps reaches the number of substitution levels; test both
+     an even and an odd number of sweeps (swapped work arrays) */
+
+  n_failed += _test_ilu0(m, n_levels, false, NULL);
+  n_failed += _test_ilu0(m, n_levels + 1, false, NULL);
+  n_failed += _test_ilu0(m, n_levels + 1, true, NULL);
+
+  cs_matrix_destroy(&m);
+  cs_matrix_structure_destroy(&ms);
+
+  /* Zero pivot: the factorization must shift it */
+
+  m = _build_matrix(true, &ms);
+
+  {
+    cs_sles_pc_t *pc = cs_sles_pc_ilu0_create(0);
+    cs_sles_pc_setup(pc, "ilu0_test", m, false, 0);
+
+    const cs_sles_pc_ilu0_t *c = cs_sles_pc_get_context(pc);
+
+    bool ok = true;
+    for (cs_lnum_t i = 0; i < c->n_rows; i++) {
+      cs_real_t u_ii = c->val[c->diag_id[i]];
+      if (!(fabs(u_ii) > 0) || !isfinite(u_ii))
+        ok = false;
+    }
+
+    bft_printf("%s ILU(0), zero pivot shifted\n",
+               (ok) ? "ok:    " : "FAILED:");
+    if (!ok)
+      n_failed++;
+
+    cs_sles_pc_destroy(&pc);
+  }
+
+  n_failed += _test_ilu0(m, 0, false, NULL);
+
+  cs_matrix_destroy(&m);
+  cs_matrix_structure_destroy(&ms);
+
+  bft_mem_end();
+
+  if (n_failed > 0) {
+    bft_printf("\n%d ILU(0) test(s) failed\n", n_failed);
+    exit(EXIT_FAILURE);
+  }
+
+  exit(EXIT_SUCCESS);
+}